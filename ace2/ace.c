@@ -10,6 +10,7 @@
 #include "blif.h"
 #include "cycle.h"
 #include "sim.h"
+#include "bitsim.h"
 #include "bdd.h"
 #include "depth.h"
 #include "cube.h"
@@ -25,7 +26,8 @@ void alloc_and_init_activity_info(Abc_Ntk_t * ntk);
 void ace_update_latch_probs(Abc_Ntk_t * ntk);
 void print_node_bdd(Abc_Ntk_t * ntk);
 void print_nodes(Vec_Ptr_t * nodes);
-int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name);
+bool ace_pis_have_vectors(Abc_Ntk_t * ntk);
+int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name, const ace_sim_opts_t * sim_opts);
 
 st__table * ace_info_hash_table;
 
@@ -143,7 +145,20 @@ void print_nodes(Vec_Ptr_t * nodes) {
 	fflush(0);
 }
 
-int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name) {
+bool ace_pis_have_vectors(Abc_Ntk_t * ntk) {
+	Abc_Obj_t * obj;
+	int i;
+
+	Abc_NtkForEachPi(ntk, obj, i)
+	{
+		if (Ace_ObjInfo(obj)->values) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name, const ace_sim_opts_t * sim_opts) {
 	int error = 0;
 	Vec_Ptr_t * nodes_all;
 	Vec_Ptr_t * nodes_logic;
@@ -196,7 +211,14 @@ int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name) {
 
 		//print_nodes(next_state_node_vec);
 
-		ace_sim_activities(ntk, next_state_node_vec, num_vectors, 0.05);
+		if (sim_opts->mode == ACE_SIM_BIT_PARALLEL && ace_pis_have_vectors(ntk)) {
+			printf("Bit-parallel simulation does not support input vectors, simulating sequentially...\n");
+			ace_sim_activities(ntk, next_state_node_vec, num_vectors, 0.05);
+		} else if (sim_opts->mode == ACE_SIM_BIT_PARALLEL) {
+			ace_bitsim_activities(ntk, num_vectors, sim_opts->num_threads);
+		} else {
+			ace_sim_activities(ntk, next_state_node_vec, num_vectors, 0.05);
+		}
 		//ace_sim_activities(ntk, nodes_logic, num_vectors, 0.05);
 
 		ace_update_latch_probs(ntk);
@@ -282,6 +304,9 @@ int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name) {
 		if (Abc_ObjFaninNum(obj) < 1) {
 			info2->switch_act = 0.0;
 			continue;
+		} else if (sim_opts->max_bdd_fanin >= 0 && Abc_ObjFaninNum(obj) > sim_opts->max_bdd_fanin) {
+			/* Too large for the BDD estimate, use the simulated activity */
+			info2->switch_act = info2->switch_prob;
 		} else {
 			Vec_Ptr_t * literals = Vec_PtrAlloc(0);
 			Abc_Obj_t * fanin;
@@ -339,6 +364,11 @@ int main(int argc, char * argv[]) {
 	Abc_Ntk_t * ntk;
 	Abc_Obj_t * obj;
 	int seed = 0;
+	ace_sim_opts_t sim_opts;
+
+	sim_opts.mode = ACE_SIM_SEQUENTIAL;
+	sim_opts.num_threads = 1;
+	sim_opts.max_bdd_fanin = -1;
 
 	p = ACE_PI_STATIC_PROB;
 	d = ACE_PI_SWITCH_PROB;
@@ -347,7 +377,7 @@ int main(int argc, char * argv[]) {
 	char new_blif_file_name[BLIF_FILE_NAME_LEN];
     char* clk_name = NULL;
 	ace_io_parse_argv(argc, argv, &BLIF, &IN_ACT, &OUT_ACT, blif_file_name,
-			new_blif_file_name, &pi_format, &p, &d, &seed, &clk_name);
+			new_blif_file_name, &pi_format, &p, &d, &seed, &clk_name, &sim_opts);
 
 	srand(seed);
 
@@ -429,7 +459,7 @@ int main(int argc, char * argv[]) {
 	}
 
 	if (!error) {
-		error = ace_calc_activity(ntk, ACE_NUM_VECTORS, clk_name);
+		error = ace_calc_activity(ntk, ACE_NUM_VECTORS, clk_name, &sim_opts);
 	}
 
 	//Abc_NtkToSop(ntk, 0);
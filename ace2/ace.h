@@ -31,6 +31,7 @@
 
 #define ACE_CHAR_BUFFER_SIZE 	4096
 #define ACE_NUM_VECTORS			5000
+#define ACE_BITSIM_MIN_CYCLES	64	/* Minimum length of each bit-parallel vector stream */
 
 typedef enum {
 	ACE_VEC, ACE_ACT, ACE_PD, ACE_CODED
@@ -38,6 +39,15 @@ typedef enum {
 typedef enum {
 	ACE_UNDEF, ACE_DEF, ACE_SIM, ACE_NEW, ACE_OLD
 } ace_status_t;
+typedef enum {
+	ACE_SIM_SEQUENTIAL, ACE_SIM_BIT_PARALLEL
+} ace_sim_mode_t;
+
+typedef struct {
+	ace_sim_mode_t mode;
+	int num_threads; /* Threads used by the bit-parallel simulation */
+	int max_bdd_fanin; /* Nodes with more fanins take their simulated switching activity, rather than the BDD estimate (-1: no limit) */
+} ace_sim_opts_t;
 
 void prob_epsilon_fix(double * d);
 
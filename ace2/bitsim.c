@@ -0,0 +1,381 @@
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "vtr_assert.h"
+
+#include "ace.h"
+#include "bitsim.h"
+
+#include "bdd/cudd/cudd.h"
+#include "bdd/cudd/cuddInt.h"
+
+#define ACE_BITSIM_PROB_BITS	16	/* Precision of the random input probabilities */
+
+/* A (regular) BDD node of a logic node's function: var ? then : else */
+typedef struct {
+	int var; /* Index of the fanin */
+	int then_op;
+	uint64_t then_mask; /* All ones if the then edge is complemented */
+	int else_op;
+	uint64_t else_mask;
+} bitsim_bdd_op_t;
+
+/* A logic node, and its function as BDD ops in evaluation order (ops[0] is the constant one) */
+typedef struct {
+	int id;
+	std::vector<int> fanins;
+	std::vector<bitsim_bdd_op_t> ops;
+	int root_op;
+	uint64_t root_mask;
+} bitsim_node_t;
+
+/* A primary input, with its probabilities in units of 2^-ACE_BITSIM_PROB_BITS */
+typedef struct {
+	int id;
+	uint32_t prob_init;
+	uint32_t prob0to1;
+	uint32_t prob1to0;
+	uint64_t rng_state;
+} bitsim_pi_t;
+
+typedef struct {
+	int bo_id;
+	int d_id; /* Object driving the latch input */
+} bitsim_latch_t;
+
+typedef struct {
+	std::mutex mutex;
+	std::condition_variable cv;
+	int num_threads;
+	int num_waiting;
+	int generation;
+} bitsim_barrier_t;
+
+typedef struct {
+	int num_words; /* Words (of 64 vector streams) per object */
+	int num_cycles;
+	int num_threads;
+
+	std::vector<bitsim_pi_t> pis;
+	std::vector<bitsim_latch_t> latches;
+	std::vector<std::vector<bitsim_node_t> > levels;
+
+	std::vector<uint64_t> values; /* num_words per object id */
+	std::vector<uint64_t> latch_next; /* num_words per latch */
+	std::vector<uint64_t> num_ones; /* Per object id */
+	std::vector<uint64_t> num_toggles; /* Per object id */
+
+	bitsim_barrier_t barrier;
+} bitsim_t;
+
+static uint64_t bitsim_splitmix(uint64_t x) {
+	x += 0x9E3779B97F4A7C15ULL;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+}
+
+/* xorshift64* */
+static uint64_t bitsim_rand(uint64_t * state) {
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 0x2545F4914F6CDD1DULL;
+}
+
+static uint32_t bitsim_fixed_prob(double prob) {
+	if (prob <= 0.) {
+		return 0;
+	} else if (prob >= 1.) {
+		return 1u << ACE_BITSIM_PROB_BITS;
+	}
+	return (uint32_t) (prob * (1u << ACE_BITSIM_PROB_BITS) + 0.5);
+}
+
+/* Returns a word whose bits are independently set with probability prob */
+static uint64_t bitsim_random_word(uint64_t * rng_state, uint32_t prob) {
+	uint64_t word = 0;
+	int bit;
+
+	if (prob == 0) {
+		return 0;
+	} else if (prob >= (1u << ACE_BITSIM_PROB_BITS)) {
+		return ~(uint64_t) 0;
+	}
+
+	/* From the least significant bit of prob, P(set) = (bit + P(set)) / 2 */
+	for (bit = 0; bit < ACE_BITSIM_PROB_BITS; bit++) {
+		uint64_t rand_word = bitsim_rand(rng_state);
+		word = ((prob >> bit) & 1) ? (word | rand_word) : (word & rand_word);
+	}
+	return word;
+}
+
+static void bitsim_barrier_wait(bitsim_barrier_t * barrier) {
+	if (barrier->num_threads == 1) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(barrier->mutex);
+	int generation = barrier->generation;
+	if (++barrier->num_waiting == barrier->num_threads) {
+		barrier->num_waiting = 0;
+		barrier->generation++;
+		barrier->cv.notify_all();
+	} else {
+		barrier->cv.wait(lock, [&] {return barrier->generation != generation;});
+	}
+}
+
+static int bitsim_add_bdd_op(DdManager * mgr, bitsim_node_t * node,
+		DdNode * regular, std::unordered_map<DdNode*, int> & op_indices) {
+	bitsim_bdd_op_t op;
+
+	if (Cudd_IsConstant(regular)) {
+		VTR_ASSERT(regular == Cudd_ReadOne(mgr));
+		return 0;
+	}
+
+	std::unordered_map<DdNode*, int>::iterator found = op_indices.find(regular);
+	if (found != op_indices.end()) {
+		return found->second;
+	}
+
+	DdNode * then_node = cuddT(regular);
+	DdNode * else_node = cuddE(regular);
+
+	op.var = regular->index;
+	VTR_ASSERT(op.var < (int) node->fanins.size());
+	op.then_op = bitsim_add_bdd_op(mgr, node, Cudd_Regular(then_node), op_indices);
+	op.then_mask = Cudd_IsComplement(then_node) ? ~(uint64_t) 0 : 0;
+	op.else_op = bitsim_add_bdd_op(mgr, node, Cudd_Regular(else_node), op_indices);
+	op.else_mask = Cudd_IsComplement(else_node) ? ~(uint64_t) 0 : 0;
+
+	node->ops.push_back(op);
+	op_indices[regular] = node->ops.size() - 1;
+	return node->ops.size() - 1;
+}
+
+static void bitsim_load_node(DdManager * mgr, Abc_Obj_t * obj, bitsim_node_t * node) {
+	Abc_Obj_t * fanin;
+	int i;
+	std::unordered_map<DdNode*, int> op_indices;
+
+	node->id = Abc_ObjId(obj);
+	Abc_ObjForEachFanin(obj, fanin, i)
+	{
+		node->fanins.push_back(Abc_ObjId(fanin));
+	}
+
+	DdNode * bdd = (DdNode*) obj->pData;
+	node->ops.resize(1); /* Constant one */
+	node->root_op = bitsim_add_bdd_op(mgr, node, Cudd_Regular(bdd), op_indices);
+	node->root_mask = Cudd_IsComplement(bdd) ? ~(uint64_t) 0 : 0;
+}
+
+/* Sets the value of an object in one word of vector streams, counting its ones and toggles */
+static void bitsim_set_value(bitsim_t * sim, int id, int word, uint64_t value, int cycle) {
+	uint64_t & old_value = sim->values[(size_t) id * sim->num_words + word];
+
+	sim->num_ones[id] += __builtin_popcountll(value);
+	if (cycle > 0) {
+		sim->num_toggles[id] += __builtin_popcountll(old_value ^ value);
+	}
+	old_value = value;
+}
+
+static uint64_t bitsim_eval_node(const bitsim_t * sim, const bitsim_node_t & node, int word,
+		std::vector<uint64_t> & op_values) {
+	size_t i;
+
+	op_values.resize(node.ops.size());
+	op_values[0] = ~(uint64_t) 0;
+	for (i = 1; i < node.ops.size(); i++) {
+		const bitsim_bdd_op_t & op = node.ops[i];
+		uint64_t var_value = sim->values[(size_t) node.fanins[op.var] * sim->num_words + word];
+		uint64_t then_value = op_values[op.then_op] ^ op.then_mask;
+		uint64_t else_value = op_values[op.else_op] ^ op.else_mask;
+		op_values[i] = (var_value & then_value) | (~var_value & else_value);
+	}
+	return op_values[node.root_op] ^ node.root_mask;
+}
+
+static void bitsim_get_range(size_t num_items, int num_threads, int thread, size_t * begin, size_t * end) {
+	*begin = num_items * thread / num_threads;
+	*end = num_items * (thread + 1) / num_threads;
+}
+
+/* Simulates this thread's share of every level of every cycle */
+static void bitsim_run_thread(bitsim_t * sim, int thread) {
+	std::vector<uint64_t> op_values;
+	size_t begin, end, i;
+	int cycle, word;
+
+	for (cycle = 0; cycle < sim->num_cycles; cycle++) {
+		/* Primary inputs and latch outputs */
+		bitsim_get_range(sim->pis.size() + sim->latches.size(), sim->num_threads, thread, &begin, &end);
+		for (i = begin; i < end; i++) {
+			if (i < sim->pis.size()) {
+				bitsim_pi_t & pi = sim->pis[i];
+				for (word = 0; word < sim->num_words; word++) {
+					uint64_t value;
+					if (cycle == 0) {
+						value = bitsim_random_word(&pi.rng_state, pi.prob_init);
+					} else {
+						uint64_t old_value = sim->values[(size_t) pi.id * sim->num_words + word];
+						uint64_t rise = ~old_value & bitsim_random_word(&pi.rng_state, pi.prob0to1);
+						uint64_t fall = old_value & bitsim_random_word(&pi.rng_state, pi.prob1to0);
+						value = old_value ^ (rise | fall);
+					}
+					bitsim_set_value(sim, pi.id, word, value, cycle);
+				}
+			} else {
+				size_t latch = i - sim->pis.size();
+				for (word = 0; word < sim->num_words; word++) {
+					bitsim_set_value(sim, sim->latches[latch].bo_id, word,
+							sim->latch_next[latch * sim->num_words + word], cycle);
+				}
+			}
+		}
+		bitsim_barrier_wait(&sim->barrier);
+
+		/* Logic, one level at a time */
+		for (const std::vector<bitsim_node_t> & level : sim->levels) {
+			bitsim_get_range(level.size(), sim->num_threads, thread, &begin, &end);
+			for (i = begin; i < end; i++) {
+				for (word = 0; word < sim->num_words; word++) {
+					bitsim_set_value(sim, level[i].id, word,
+							bitsim_eval_node(sim, level[i], word, op_values), cycle);
+				}
+			}
+			bitsim_barrier_wait(&sim->barrier);
+		}
+
+		/* Latch inputs, seen at the latch outputs next cycle */
+		bitsim_get_range(sim->latches.size(), sim->num_threads, thread, &begin, &end);
+		for (i = begin; i < end; i++) {
+			for (word = 0; word < sim->num_words; word++) {
+				sim->latch_next[i * sim->num_words + word] =
+						sim->values[(size_t) sim->latches[i].d_id * sim->num_words + word];
+			}
+		}
+		bitsim_barrier_wait(&sim->barrier);
+	}
+}
+
+void ace_bitsim_activities(Abc_Ntk_t * ntk, int num_vectors, int num_threads) {
+	Abc_Obj_t * obj;
+	Ace_Obj_Info_t * info;
+	Vec_Ptr_t * logic_nodes;
+	int i, j;
+	bitsim_t sim;
+
+	VTR_ASSERT(num_vectors > 0);
+	VTR_ASSERT(num_threads > 0);
+
+	/* Long enough streams for the latch states to be representative */
+	sim.num_words = MAX(1, num_vectors / (64 * ACE_BITSIM_MIN_CYCLES));
+	sim.num_cycles = (num_vectors + 64 * sim.num_words - 1) / (64 * sim.num_words);
+	sim.num_threads = num_threads;
+
+	/* Primary inputs, each with its own random stream (so results do not depend on num_threads) */
+	uint64_t seed = (uint64_t) rand();
+	Abc_NtkForEachPi(ntk, obj, i)
+	{
+		bitsim_pi_t pi;
+
+		info = Ace_ObjInfo(obj);
+		VTR_ASSERT(!info->values);
+
+		double prob0to1 = ACE_P0TO1(info->static_prob, info->switch_prob);
+		double prob1to0 = ACE_P1TO0(info->static_prob, info->switch_prob);
+
+		pi.id = Abc_ObjId(obj);
+		pi.prob_init = bitsim_fixed_prob(info->static_prob);
+		pi.prob0to1 = bitsim_fixed_prob(prob0to1);
+		pi.prob1to0 = bitsim_fixed_prob(prob1to0);
+		pi.rng_state = bitsim_splitmix(seed + i);
+		if (pi.rng_state == 0) {
+			pi.rng_state = 1;
+		}
+		sim.pis.push_back(pi);
+	}
+
+	Abc_NtkForEachLatch(ntk, obj, i)
+	{
+		bitsim_latch_t latch;
+		latch.bo_id = Abc_ObjId(Abc_ObjFanout0(obj));
+		latch.d_id = Abc_ObjId(Abc_ObjFanin0(Abc_ObjFanin0(obj)));
+		sim.latches.push_back(latch);
+	}
+
+	/* Levelize the logic */
+	std::vector<int> obj_levels(Abc_NtkObjNumMax(ntk), 0);
+	logic_nodes = Abc_NtkDfs(ntk, TRUE);
+	Vec_PtrForEachEntry(Abc_Obj_t*, logic_nodes, obj, i)
+	{
+		Abc_Obj_t * fanin;
+		int level = 0;
+
+		Abc_ObjForEachFanin(obj, fanin, j)
+		{
+			level = MAX(level, obj_levels[Abc_ObjId(fanin)]);
+		}
+		obj_levels[Abc_ObjId(obj)] = level + 1;
+
+		if ((int) sim.levels.size() < level + 1) {
+			sim.levels.resize(level + 1);
+		}
+		sim.levels[level].emplace_back();
+		bitsim_load_node((DdManager*) ntk->pManFunc, obj, &sim.levels[level].back());
+	}
+	Vec_PtrFree(logic_nodes);
+
+	sim.values.resize((size_t) Abc_NtkObjNumMax(ntk) * sim.num_words, 0);
+	sim.latch_next.resize(sim.latches.size() * sim.num_words, 0); /* Latches start at 0 */
+	sim.num_ones.resize(Abc_NtkObjNumMax(ntk), 0);
+	sim.num_toggles.resize(Abc_NtkObjNumMax(ntk), 0);
+
+	sim.barrier.num_threads = num_threads;
+	sim.barrier.num_waiting = 0;
+	sim.barrier.generation = 0;
+
+	std::vector<std::thread> threads;
+	for (i = 1; i < num_threads; i++) {
+		threads.emplace_back(bitsim_run_thread, &sim, i);
+	}
+	bitsim_run_thread(&sim, 0);
+	for (std::thread & thread : threads) {
+		thread.join();
+	}
+
+	double num_simulated = (double) sim.num_cycles * 64 * sim.num_words;
+	Abc_NtkForEachObj(ntk, obj, i)
+	{
+		int id = Abc_ObjId(obj);
+
+		/* Latches and outputs take the values of their drivers */
+		if (Abc_ObjIsPo(obj) || Abc_ObjIsBi(obj)) {
+			id = Abc_ObjId(Abc_ObjFanin0(obj));
+		} else if (Abc_ObjIsLatch(obj)) {
+			id = Abc_ObjId(Abc_ObjFanin0(Abc_ObjFanin0(obj)));
+		}
+
+		info = Ace_ObjInfo(obj);
+		info->num_ones = (int) sim.num_ones[id];
+		info->num_toggles = (int) sim.num_toggles[id];
+		info->static_prob = sim.num_ones[id] / num_simulated;
+		VTR_ASSERT(info->static_prob >= 0.0 && info->static_prob <= 1.0);
+		info->switch_prob = sim.num_toggles[id] / num_simulated;
+		VTR_ASSERT(info->switch_prob >= 0.0 && info->switch_prob <= 1.0);
+
+		VTR_ASSERT(info->switch_prob - EPSILON <= 2.0 * (1.0 - info->static_prob));
+		VTR_ASSERT(info->switch_prob - EPSILON <= 2.0 * (info->static_prob));
+
+		info->status = ACE_SIM;
+	}
+}
@@ -0,0 +1,17 @@
+#ifndef __ACE_BITSIM_H__
+#define __ACE_BITSIM_H__
+
+#include "ace.h"
+
+/*
+ * Estimates the static and switching probabilities of all objects by random-pattern
+ * simulation, as ace_sim_activities() does, but simulating 64 independent vector
+ * streams per machine word.  Each simulated cycle is evaluated one logic level at a
+ * time, with the objects of a level split across num_threads threads.
+ *
+ * At least num_vectors vectors are simulated in total.  Primary inputs defined by
+ * vectors (ACE_VEC) are not supported; use ace_sim_activities() for them.
+ */
+void ace_bitsim_activities(Abc_Ntk_t * ntk, int num_vectors, int num_threads);
+
+#endif
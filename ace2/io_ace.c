@@ -100,7 +100,8 @@ void ace_io_print_activity(Abc_Ntk_t * ntk, FILE * fp) {
 
 int ace_io_parse_argv(int argc, char ** argv, FILE ** BLIF, FILE ** IN_ACT,
 		FILE ** OUT_ACT, char * blif_file_name, char * new_blif_file_name,
-		ace_pi_format_t * pi_format, double *p, double * d, int * seed, char** clk_name) {
+		ace_pi_format_t * pi_format, double *p, double * d, int * seed, char** clk_name,
+		ace_sim_opts_t * sim_opts) {
 	int i;
 	char option;
 
@@ -150,6 +151,28 @@ int ace_io_parse_argv(int argc, char ** argv, FILE ** BLIF, FILE ** IN_ACT,
 			case 'c':
 				*clk_name = argv[i];
 				break;
+			case 'm':
+				if (strcmp(argv[i], "sequential") == 0) {
+					sim_opts->mode = ACE_SIM_SEQUENTIAL;
+				} else if (strcmp(argv[i], "bitparallel") == 0) {
+					sim_opts->mode = ACE_SIM_BIT_PARALLEL;
+				} else {
+					printf("Unknown simulation mode '%s'\n", argv[i]);
+					ace_io_print_usage();
+					exit(1);
+				}
+				break;
+			case 'j':
+				sim_opts->num_threads = atoi(argv[i]);
+				if (sim_opts->num_threads < 1) {
+					printf("Number of threads must be at least 1\n");
+					ace_io_print_usage();
+					exit(1);
+				}
+				break;
+			case 'k':
+				sim_opts->max_bdd_fanin = atoi(argv[i]);
+				break;
 			default:
 				ace_io_print_usage();
 				exit(1);
@@ -193,6 +216,13 @@ void ace_io_print_usage() {
 	(void) fprintf(stderr, "    -p [PI static probability]    |\n");
 	(void) fprintf(stderr, "    -d [PI switching activity]    |\n");
 	(void) fprintf(stderr, "                                --+\n");
+	(void) fprintf(stderr, "\n");
+	(void) fprintf(stderr, "                                --+\n");
+	(void) fprintf(stderr, "    -m [sequential|bitparallel]   | optional, simulation mode\n");
+	(void) fprintf(stderr, "    -j [bit-parallel threads]     | optional\n");
+	(void) fprintf(stderr, "    -k [max BDD fanin]            | optional, larger nodes use\n");
+	(void) fprintf(stderr, "                                  | their simulated activity\n");
+	(void) fprintf(stderr, "                                --+\n");
 }
 
 int ace_io_read_activity(Abc_Ntk_t * ntk, FILE * in_file_desc,
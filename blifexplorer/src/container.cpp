@@ -23,6 +23,11 @@ OTHER DEALINGS IN THE SOFTWARE.
 */
 #include "container.h"
 #include <time.h>
+#include "vtr_memory.h"
+
+//nodes driving more units than this are connected to a fanout summary node
+static const int MAX_SHOWN_FANOUT = 64;
+static const char FANOUT_SUMMARY_SUFFIX[] = "~fanout";
 
 Container::Container(ExplorerScene* scene)
 {
@@ -223,8 +228,13 @@ void Container::copySimCyclesIntoNodes()
              int value;
              int i;
              QString name = blockIterator.key();
-             LogicUnit* visNode = unithashtable[name];
+             LogicUnit* visNode = unithashtable.value(name);
              nnode_t* node = blockIterator.value();
+             //nodes of collapsed modules get their values when they are created
+             if(visNode == NULL){
+                 ++blockIterator;
+                 continue;
+             }
              //for each output pin of the node update the current value
              for(i=0;i<node->num_output_pins;i++){
                  value = myOdin->getOutputValue(node, i, cycle);
@@ -236,27 +246,38 @@ void Container::copySimCyclesIntoNodes()
     }
 }
 
+/*---------------------------------------------------------------------------------------------
+ * (function: copySimCyclesIntoNode)
+ *-------------------------------------------------------------------------------------------*/
+//copies the values of the cycles simulated so far into a node created afterwards
+void Container::copySimCyclesIntoNode(LogicUnit *visNode, nnode_t *node)
+{
+    for(int cycle=simOffset;cycle<maxSimStep;cycle++){
+        for(int i=0;i<node->num_output_pins;i++){
+            visNode->setOutValue(i, myOdin->getOutputValue(node, i, cycle), cycle);
+        }
+    }
+    visNode->setCurrentCycle(actSimStep);
+}
+
 /*---------------------------------------------------------------------------------------------
  * (function: computeLayers)
  *-------------------------------------------------------------------------------------------*/
 //compute the layers of all modules inside the container
 void Container::computeLayers()
 {
+    //the layers follow the connections between the created units, so the
+    //nodes of collapsed modules and fanouts are laid out as their summary node
     QQueue<LogicUnit*> nodequeue;
+    QSet<LogicUnit*> queued;
     QHash<QString, LogicUnit*> donehashtable;
-    for (int i = 0; i < myOdin->blifexplorer_netlist->num_top_input_nodes; i++){
-        QString name = myOdin->blifexplorer_netlist->top_input_nodes[i]->name;
-        nodequeue.enqueue(getReferenceToUnit(name));
-    }
 
-    // Enqueue constant nodes.
-    nnode_t* constant_nodes[] = {myOdin->blifexplorer_netlist->gnd_node,
-                                 myOdin->blifexplorer_netlist->vcc_node,
-                                 myOdin->blifexplorer_netlist->pad_node};
-    int num_constant_nodes = 3;
-    for (int i = 0; i < num_constant_nodes; i++){
-        QString name = constant_nodes[i]->name;
-        nodequeue.enqueue(getReferenceToUnit(name));
+    //start with the units without parents (inputs and constants)
+    foreach(LogicUnit* unit, unitcontainer){
+        if(unit->getParents().isEmpty()){
+            nodequeue.enqueue(unit);
+            queued.insert(unit);
+        }
     }
 
     // go through the netlist. While doing so
@@ -279,38 +300,25 @@ void Container::computeLayers()
         }
         //save node in hash, so it will be processed only once
         donehashtable[nodeName] = node;
-        //Enqueue child nodes which are ready
-        int num_children = 0;
-        nnode_t** children = get_children_of(node->getOdinRef(), &num_children);
 
-        // connect node to all children
         //enqueue children if not already done or in queue
-        for(int i=0; i< num_children; i++){
-            nnode_t* nodeKid = children[i];
-            QString kidName(nodeKid->name);
-            LogicUnit* kidUnit = getReferenceToUnit(kidName);
-
-            bool inQueue = nodequeue.contains(kidUnit);
-            bool done = donehashtable.contains(kidName);
-
-            if(!inQueue && !done && parentsDone(kidUnit,donehashtable)){
+        foreach(LogicUnit* kidUnit, node->getChildren()){
+            if(!queued.contains(kidUnit) && parentsDone(kidUnit,donehashtable)){
                 nodequeue.enqueue(kidUnit);
+                queued.insert(kidUnit);
             }
         }
     }
     maxlayer++;
     /*Locate all outputs at the very end of the graph*/
     QHash<QString, LogicUnit*>::const_iterator blockIterator = unithashtable.constBegin();
-    for(int i = 0; i<=maxlayer;i++){
-        blockIterator = unithashtable.constBegin();
-        while(blockIterator != unithashtable.constEnd()){
-            LogicUnit* actUnit = blockIterator.value();
-            if(actUnit->getName().contains("top^out")){
-                actUnit->setLayer(maxlayer);
-            }
-
-            ++blockIterator;
+    while(blockIterator != unithashtable.constEnd()){
+        LogicUnit* actUnit = blockIterator.value();
+        if(actUnit->getName().contains("top^out")){
+            actUnit->setLayer(maxlayer);
         }
+
+        ++blockIterator;
     }
 
 }
@@ -320,28 +328,31 @@ void Container::computeLayers()
  *-------------------------------------------------------------------------------------------*/
 void Container::spreadLayers()
 {
+    //sort the visible units into their layers, so each is visited once
+    QVector<QList<LogicUnit*> > layers(maxlayer+1);
     QHash<QString, LogicUnit*>::const_iterator blockIterator = unithashtable.constBegin();
+    while(blockIterator != unithashtable.constEnd()){
+        LogicUnit* actUnit = blockIterator.value();
+        int layer = actUnit->getLayer();
+        if(actUnit->isVisible() && layer >= 0 && layer <= maxlayer){
+            layers[layer].append(actUnit);
+        }
+        ++blockIterator;
+    }
+
     LogicUnit* lastUnit = NULL;
     int counter = 0;
     int offset = 200;
 
     for(int i = 0; i<=maxlayer;i++){
-        blockIterator = unithashtable.constBegin();
-
-        while(blockIterator != unithashtable.constEnd()){
-            LogicUnit* actUnit = blockIterator.value();
-            if(actUnit->isVisible()){
-                if(actUnit->getLayer()== i){
-                    actUnit->setPos(offset+15*counter,100.0+200*counter);
-                    actUnit->updateWires();
-                    lastUnit = actUnit;
-                    counter++;
-                }
-                if(maxcountPerLayer < counter){
-                    maxcountPerLayer = counter;
-                }
-            }
-            ++blockIterator;
+        foreach(LogicUnit* actUnit, layers[i]){
+            actUnit->setPos(offset+15*counter,100.0+200*counter);
+            actUnit->updateWires();
+            lastUnit = actUnit;
+            counter++;
+        }
+        if(maxcountPerLayer < counter){
+            maxcountPerLayer = counter;
         }
         if(lastUnit!=NULL){
             offset = lastUnit->x()+200;
@@ -381,6 +392,75 @@ void Container::startOdin(){
     }
 }
 
+/*---------------------------------------------------------------------------------------------
+ * (function: getUnitType)
+ *-------------------------------------------------------------------------------------------*/
+LogicUnit::UnitType Container::getUnitType(nnode_t *node)
+{
+    LogicUnit::UnitType type;
+
+    switch(node->type){
+    case CLOCK_NODE:
+        type = LogicUnit::Clock;
+        break;
+    case INPUT_NODE:
+        type = LogicUnit::Input;
+       break;
+    case FF_NODE:
+        type = LogicUnit::Latch;
+        break;
+    case OUTPUT_NODE:
+        type = LogicUnit::Output;
+        break;
+    case LOGICAL_AND:
+        type = LogicUnit::And;
+        break;
+    case LOGICAL_OR:
+        type = LogicUnit::Or;
+        break;
+    case LOGICAL_NOT:
+        type = LogicUnit::Not;
+        break;
+    case LOGICAL_NAND:
+        type = LogicUnit::Nand;
+        break;
+    case LOGICAL_XOR:
+        type = LogicUnit::Xor;
+        break;
+    case LOGICAL_XNOR:
+        type = LogicUnit::Xnor;
+        break;
+    case LOGICAL_NOR:
+        type = LogicUnit::Nor;
+        break;
+    case MUX_2:
+        type = LogicUnit::MUX;
+        break;
+    case ADDER_FUNC:
+        type = LogicUnit::ADDER_FUNC;
+        break;
+    case CARRY_FUNC:
+        type = LogicUnit::CARRY_FUNC;
+        break;
+    case MULTIPLY:
+        type = LogicUnit::MULTIPLY;
+        break;
+    case ADD:
+        type = LogicUnit::ADD;
+        break;
+    case MINUS:
+        type = LogicUnit::MINUS;
+        break;
+    case MEMORY:
+        type = LogicUnit::MEMORY;
+        break;
+    default:
+        type = LogicUnit::LogicGate;
+        break;
+    }
+    return type;
+}
+
 /*---------------------------------------------------------------------------------------------
  * (function: createNodesFromOdin)
  *-------------------------------------------------------------------------------------------*/
@@ -391,73 +471,15 @@ int Container::createNodesFromOdin(){
      while(blockIterator != odinTable.constEnd()){
          QString actName = blockIterator.key();
          nnode_t* actOdinNode = blockIterator.value();
-         operation_list odinType = actOdinNode->type;
-         LogicUnit::UnitType type;
-
-         switch(odinType){
-         case CLOCK_NODE:
-             type = LogicUnit::Clock;
-             break;
-         case INPUT_NODE:
-             type = LogicUnit::Input;
-            break;
-         case FF_NODE:
-             type = LogicUnit::Latch;
-             break;
-         case OUTPUT_NODE:
-             type = LogicUnit::Output;
-             break;
-         case LOGICAL_AND:
-             type = LogicUnit::And;
-             break;
-         case LOGICAL_OR:
-             type = LogicUnit::Or;
-             break;
-         case LOGICAL_NOT:
-             type = LogicUnit::Not;
-             break;
-         case LOGICAL_NAND:
-             type = LogicUnit::Nand;
-             break;
-         case LOGICAL_XOR:
-             type = LogicUnit::Xor;
-             break;
-         case LOGICAL_XNOR:
-             type = LogicUnit::Xnor;
-             break;
-         case LOGICAL_NOR:
-             type = LogicUnit::Nor;
-             break;
-         case MUX_2:
-             type = LogicUnit::MUX;
-             break;
-         case ADDER_FUNC:
-             type = LogicUnit::ADDER_FUNC;
-             break;
-         case CARRY_FUNC:
-             type = LogicUnit::CARRY_FUNC;
-             break;
-         case MULTIPLY:
-             type = LogicUnit::MULTIPLY;
-             break;
-         case ADD:
-             type = LogicUnit::ADD;
-             break;
-         case MINUS:
-             type = LogicUnit::MINUS;
-             break;
-         case MEMORY:
-             type = LogicUnit::MEMORY;
-             break;
-         default:
-             type = LogicUnit::LogicGate;
-             break;
-         }
-        //add Unit with name and type
-         addUnit(actName, type,QPointF(100,100),actOdinNode);
+         //nodes of subcircuits are only created when their module is expanded
          if(actName.contains("+")){
-             assignToModule(actName);
-             unithashtable[actName]->setVisible(false);
+             QString moduleName = extractModuleFromName(actName);
+             if(!unithashtable.contains(moduleName)){
+                 addModule(moduleName);
+             }
+             collapsedModules[moduleName].append(actOdinNode);
+         }else{
+             addUnit(actName, getUnitType(actOdinNode),QPointF(100,100),actOdinNode);
          }
          items++;
          if((100*items/odinNodeCount)%5==0)
@@ -476,9 +498,10 @@ int Container::createNodesFromOdin(){
 bool Container::parentsDone(LogicUnit *unit, QHash<QString, LogicUnit *> donehashlist)
 {
     //in case it is a flipFlop the parents don't have to be done
-    //FlipFlops can be parts of cycles.
+    //FlipFlops (and the flipflops inside collapsed modules) can be parts of cycles.
     if(unit->unitType() == LogicUnit::Latch ||
-            unit->unitType() == LogicUnit::MEMORY){
+            unit->unitType() == LogicUnit::MEMORY ||
+            unit->unitType() == LogicUnit::Module){
         return true;
     }
 
@@ -513,151 +536,195 @@ int Container::createConnectionsFromOdinIterate()
     //only create connections if nodes are created
     if(myItemcount <= 0)
         return -1;
-    //create all connections while iterating through all nodes
+    //create the output connections of all nodes. The ones of nodes in collapsed
+    //modules start and end at their module.
     //leave out the clocks
     //(visual reasons. The clock should be added last to be at the right port)
-    int conCount = 0;
     int itemNr = 0;
-    int j,i, itemTotal;
-    bool clocksFound = false;
+    int itemTotal = odinTable.count();
 
-    QHash<QString, LogicUnit *> hash =unithashtable;
-    QHash<QString, LogicUnit *>::const_iterator blockIterator = hash.constBegin();
-    itemTotal = hash.count();
-     while(blockIterator != hash.constEnd()){
-         QString actName = blockIterator.key();
-         LogicUnit* actNode = blockIterator.value();
+    QHash<QString, nnode_t *>::const_iterator blockIterator = odinTable.constBegin();
+    while(blockIterator != odinTable.constEnd()){
+        QString actName = blockIterator.key();
+        nnode_t* actOdinNode = blockIterator.value();
 
-         if(actNode->unitType() == LogicUnit::Module){
-             ++blockIterator;
-             continue;
-         }
+        if(actOdinNode->type == CLOCK_NODE && unithashtable.contains(actName)){
+            LogicUnit* clock = unithashtable.value(actName);
+            if(!clocks.contains(clock)){
+                clocks.append(clock);
+            }
+        }else{
+            createOutputConnections(actOdinNode, true);
+        }
 
-         if(actNode->getOdinRef()->type == CLOCK_NODE){
-             if(!clocks.contains(actNode)){
-                clocks.append(actNode);
-                clocksFound = true;
-             }
-         }else{//if the node is not a clock node, create all output connections
-             int output_number = actNode->getOdinRef()->num_output_pins;
-             for(j=0; j<output_number;j++)
-             {
-                 int num_children = 0;
-                 nnode_t** children = get_children_of_nodepin(actNode->getOdinRef(), &num_children,j);
-                 QHash<QString, nnode_t*> childrenDone;
-                 for(i=0; i< num_children; i++){
-                     nnode_t* nodeKid = children[i];
-                     QString kidName(nodeKid->name);
-                     //LogicUnit* kidUnit = getReferenceToUnit(kidName);
-
-                     if(!childrenDone.contains(kidName)){
-                         //bool success = addConnectionHashByRef(actNode,kidUnit);
-                         bool success = addConnectionHash(actName,kidName);
-                         if(!success){
-                             /*FIXME: This error is sometimes created by Odin as
-                                         the method get_children_of(node->getOdinRef(), &num_children)
-                                         sometimes returns a node itself as its child.*/
-                             fprintf(stderr, "CONTAINER:  Warning: Node has itself in childlist in Odin II:");
-                             fprintf(stderr,"%s", ((char*)actName.toLocal8Bit().data()));
-                             fprintf(stderr,"\n");
-                         }else{
-                         //for hard blocks add the output pin of the created connection
-                             Wire* newWire = getConnectionBetween(actName, kidName);
-                             newWire->setMaxOutputPinNumber(
-                                         actNode->getOdinRef()->num_output_pins);
-                             newWire->setMyOutputPinNumber(j+1);
-                             //add modules to connection if needed
-                             LogicUnit* startNode = unithashtable[actName];
-                             LogicUnit* startModule;
-                             LogicUnit* endNode = unithashtable[kidName];
-                             LogicUnit* endModule;
-                            if(startNode->hasModule && endNode->hasModule){
-                                startModule = startNode->getModule();
-                                endModule = endNode->getModule();
-                                if(startModule->getName().compare(endModule->getName())!=0){
-                                //both connections are in modules
-                                    startModule->addConnection(newWire);
-                                    endModule->addConnection(newWire);
-                                    newWire->setEndModule(endModule);
-                                    newWire->setStartModule(startModule);
-                                }
-                            }else if(startNode->hasModule){
-                                startModule = startNode->getModule();
-                                startModule->addConnection(newWire);
-                                newWire->setStartModule(startModule);
-                            }else if(endNode->hasModule){
-                                endModule = endNode->getModule();
-                                endModule->addConnection(newWire);
-                                newWire->setEndModule(endModule);
-                            }
-
-                             childrenDone[kidName] = nodeKid;
-                             conCount++;
-                             if(conCount%500 == 0){
-                                fprintf(stdout, "CONTAINER:  Connection progress: %d Cons, %d.%d Percent.\n", conCount, 100*itemNr/itemTotal,
-                                        (10000*itemNr/itemTotal)%100);
-                                fflush(stdout);
-                             }
-                         }
-                     }
-                 }
-             }
-         }
+        itemNr++;
+        if(itemNr%5000 == 0){
+            fprintf(stdout, "CONTAINER:  Connection progress: %d Cons, %d.%d Percent.\n", connectedUnits.count(), 100*itemNr/itemTotal,
+                    (10000*itemNr/itemTotal)%100);
+            fflush(stdout);
+        }
+        ++blockIterator;
+    }
 
-         //go through each output pin of the node and create all connections
-         itemNr++;
-         ++blockIterator;
-     }
+    //create all clock connections
+    foreach(LogicUnit* clock, clocks){
+        createOutputConnections(clock->getOdinRef(), true);
+    }
+    return connectedUnits.count();
+}
 
-     //create all clock connections if clocks exist
-     if(clocksFound){
-         //for all clocks create the connections
-         foreach(LogicUnit* clock, clocks){
-             int num_children = 0;
-             nnode_t** children = get_children_of(clock->getOdinRef(), &num_children);
-             QString clockName = clock->getName();
-
-             // connect clock to all children
-             for(i=0; i< num_children; i++){
-                 nnode_t* nodeKid = children[i];
-                 QString kidName(nodeKid->name);
-                 addConnectionHash(clockName,kidName);
-
-                 Wire* newWire = getConnectionBetween(clockName, kidName);
-                 LogicUnit* startNode = unithashtable[clockName];
-                 LogicUnit* startModule;
-                 LogicUnit* endNode = unithashtable[kidName];
-                 LogicUnit* endModule;
-
-                 if(startNode->hasModule && endNode->hasModule){
-                     startModule = startNode->getModule();
-                     endModule = endNode->getModule();
-                     if(startModule->getName().compare(endModule->getName())!=0){
-                    //both connections are in modules
-                         startModule->addConnection(newWire);
-                         endModule->addConnection(newWire);
-                         newWire->setEndModule(endModule);
-                         newWire->setStartModule(startModule);
-                     }
-                 }else if(startNode->hasModule){
-                     startModule = startNode->getModule();
-                     startModule->addConnection(newWire);
-                     newWire->setStartModule(startModule);
-                 }else if(endNode->hasModule){
-                    endModule = endNode->getModule();
-                    endModule->addConnection(newWire);
-                    newWire->setEndModule(endModule);
-                 }
-
-                 conCount++;
-             }
-         }
-     }
-     return conCount;
+/*---------------------------------------------------------------------------------------------
+ * (function: getRepresentative)
+ *-------------------------------------------------------------------------------------------*/
+//returns the unit of the node, or the one of its module if that is still collapsed
+LogicUnit *Container::getRepresentative(nnode_t *node)
+{
+    QString name(node->name);
+    LogicUnit* unit = unithashtable.value(name);
+    if(unit == NULL && name.contains("+")){
+        unit = unithashtable.value(extractModuleFromName(name));
+    }
+    return unit;
+}
+
+/*---------------------------------------------------------------------------------------------
+ * (function: connectUnits)
+ *-------------------------------------------------------------------------------------------*/
+bool Container::connectUnits(LogicUnit *start, LogicUnit *end,
+                             int outputPin, int maxOutputPin)
+{
+    QPair<LogicUnit *, LogicUnit *> con(start, end);
 
+    //do not connect units with themself (connections inside a collapsed module) or twice
+    if(start == NULL || end == NULL || start == end || connectedUnits.contains(con))
+        return false;
+
+    Wire* newWire = myScene->addConnection(start, end);
+    if(newWire == NULL)
+        return false;
 
+    //for hard blocks add the output pin of the created connection
+    if(start->unitType() != LogicUnit::Module){
+        newWire->setMaxOutputPinNumber(maxOutputPin);
+        newWire->setMyOutputPinNumber(outputPin);
+    }
+    connectedUnits.insert(con);
+    return true;
 }
 
+/*---------------------------------------------------------------------------------------------
+ * (function: createOutputConnections)
+ *-------------------------------------------------------------------------------------------*/
+//connects the node to all its children. If summarizeFanout is set, a created node
+//with more than MAX_SHOWN_FANOUT children is connected to a fanout summary node
+//instead, which creates the connections to the children once it is expanded.
+void Container::createOutputConnections(nnode_t *node, bool summarizeFanout)
+{
+    QString nodeName(node->name);
+    LogicUnit* startUnit = getRepresentative(node);
+    if(startUnit == NULL)
+        return;
+
+    //collect the children of each output pin
+    QList<QPair<nnode_t *, int> > kids;
+    QSet<nnode_t *> distinctKids;
+    for(int j=0; j<node->num_output_pins; j++){
+        int num_children = 0;
+        nnode_t** children = get_children_of_nodepin(node, &num_children, j);
+        for(int i=0; i<num_children; i++){
+            kids.append(qMakePair(children[i], j));
+            distinctKids.insert(children[i]);
+        }
+        vtr::free(children);
+    }
+
+    if(summarizeFanout && distinctKids.count() > MAX_SHOWN_FANOUT
+            && unithashtable.value(nodeName) == startUnit){
+        QString summaryName = nodeName + FANOUT_SUMMARY_SUFFIX;
+        LogicUnit* summary = addModule(summaryName);
+        collapsedFanouts[summaryName] = node;
+        connectUnits(startUnit, summary, 1, 1);
+        return;
+    }
+
+    for(int i=0; i<kids.count(); i++){
+        connectUnits(startUnit, getRepresentative(kids[i].first),
+                     kids[i].second+1, node->num_output_pins);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------
+ * (function: createInputConnections)
+ *-------------------------------------------------------------------------------------------*/
+//connects the drivers of the node, other than the nodes of its own module
+//and the nodes behind a fanout summary node, to the node
+void Container::createInputConnections(nnode_t *node, QSet<nnode_t *> moduleNodes)
+{
+    LogicUnit* endUnit = unithashtable.value(QString(node->name));
+
+    for(int i=0; i<node->num_input_pins; i++){
+        npin_t* pin = node->input_pins[i];
+        if(!pin || !pin->net)
+            continue;
+
+        for(int j=0; j<pin->net->num_driver_pins; j++){
+            npin_t* driverPin = pin->net->driver_pins[j];
+            nnode_t* driver = driverPin->node;
+            if(!driver || moduleNodes.contains(driver))
+                continue;
+            if(collapsedFanouts.contains(QString(driver->name) + FANOUT_SUMMARY_SUFFIX))
+                continue;
+
+            connectUnits(getRepresentative(driver), endUnit,
+                         driverPin->pin_node_idx+1, driver->num_output_pins);
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------
+ * (function: materializeModule)
+ *-------------------------------------------------------------------------------------------*/
+//creates the nodes of a collapsed module and their connections
+void Container::materializeModule(QString modulename)
+{
+    QList<nnode_t *> members = collapsedModules.take(modulename);
+    QSet<nnode_t *> moduleNodes;
+
+    foreach(nnode_t* node, members){
+        QString name(node->name);
+        LogicUnit* unit = addUnit(name, getUnitType(node), QPointF(100,100), node);
+        assignNodeToModule(name, modulename);
+        if(maxSimStep > 0){
+            copySimCyclesIntoNode(unit, node);
+        }
+        moduleNodes.insert(node);
+    }
+
+    //fanout summary nodes are not part of the module, so the fanouts of
+    //its nodes are connected right away
+    foreach(nnode_t* node, members){
+        createInputConnections(node, moduleNodes);
+        createOutputConnections(node, false);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------
+ * (function: expandFanout)
+ *-------------------------------------------------------------------------------------------*/
+//replaces a fanout summary node by the connections to all children of its driver
+void Container::expandFanout(QString summaryname)
+{
+    nnode_t* driver = collapsedFanouts.take(summaryname);
+    LogicUnit* summary = unithashtable.value(summaryname);
+
+    connectedUnits.remove(qMakePair(getRepresentative(driver), summary));
+    summary->removeConnections();
+    deleteModule(summaryname);
+    myScene->removeItem(summary);
+    delete summary;
+
+    createOutputConnections(driver, false);
+}
 
 /*---------------------------------------------------------------------------------------------
  * (function: createConnectionsFromOdin)
@@ -785,17 +852,20 @@ int Container::readInFileOdinOnly(){
     start = clock();
     //let odin ii parse in the file and return a hashtable of all nodes in the netlist
     startOdin();
+    //do not index the items in the scene while they are created
+    myScene->setItemIndexMethod(QGraphicsScene::NoIndex);
     fprintf(stdout, "VISUALIZATION: Creating nodes...\n");
     //iterate through the hashtable and create all nodes based on the type
     myItemcount = createNodesFromOdin();
     fprintf(stdout, "VISUALIZATION: Creating Node connections...\n");
      //create connections
     cons = createConnectionsFromOdinIterate();
+    myScene->setItemIndexMethod(QGraphicsScene::BspTreeIndex);
      if(myItemcount <= 0)
          return -1;
 
      finish = clock();
-     fprintf(stderr, "Nodes: %d, Cons: %d, Time: %f\n", myItemcount, cons, (double)(finish - start)/CLOCKS_PER_SEC);
+     fprintf(stderr, "Nodes: %d (%d created), Cons: %d, Time: %f\n", myItemcount, unitcontainer.count(), cons, (double)(finish - start)/CLOCKS_PER_SEC);
      return 0;
 
 }
@@ -817,6 +887,20 @@ QHash<QString, LogicUnit *> Container::findByName(QString name)
          }
          ++blockIterator;
      }
+
+     //nodes of collapsed modules are found as their module
+     QHash<QString, QList<nnode_t *> >::const_iterator moduleIterator = collapsedModules.constBegin();
+     while(moduleIterator != collapsedModules.constEnd()){
+         foreach(nnode_t* node, moduleIterator.value()){
+             QString actName(node->name);
+             if(actName.contains(name, Qt::CaseInsensitive)){
+                 LogicUnit* module = unithashtable.value(moduleIterator.key());
+                 result.insert(actName, module);
+                 module->setBrush(QColor(23,255,255,255));
+             }
+         }
+         ++moduleIterator;
+     }
      return result;
 }
 
@@ -912,7 +996,11 @@ void Container::showActivity()
 
     while(blockIterator != odinTable.constEnd()){
          QString name = blockIterator.key();
-         LogicUnit* visNode = unithashtable[name];
+         LogicUnit* visNode = unithashtable.value(name);
+         if(visNode == NULL){
+             ++blockIterator;
+             continue;
+         }
          //get all connections outgoing and advise them to
          //represent the activity by color
          QList<Wire*> outgoingWires = visNode->getOutCons();
@@ -935,7 +1023,11 @@ void Container::getActivityInformation()
 
     while(blockIterator != odinTable.constEnd()){
          QString name = blockIterator.key();
-         LogicUnit* visNode = unithashtable[name];
+         LogicUnit* visNode = unithashtable.value(name);
+         if(visNode == NULL){
+             ++blockIterator;
+             continue;
+         }
          //get all connections outgoing and advise them to
          //represent the activity by color
          QList<Wire*> outgoingWires = visNode->getOutCons();
@@ -966,8 +1058,10 @@ void Container::showSimulationStep(int cycle)
 
     while(blockIterator != odinTable.constEnd()){
          QString name = blockIterator.key();
-         LogicUnit* visNode = unithashtable[name];
-         visNode->setCurrentCycle(cycle);
+         LogicUnit* visNode = unithashtable.value(name);
+         if(visNode != NULL){
+             visNode->setCurrentCycle(cycle);
+         }
          ++blockIterator;
     }
     //actSimStep = (simOffset+1)%64;
@@ -979,23 +1073,11 @@ void Container::showSimulationStep(int cycle)
 Wire *Container::getConnectionBetween(QString nodeName, QString kidName)
 {
     Wire* result = NULL;
-    QHash<QString, Wire *> wires;
-    QHash<QString, LogicUnit *> hash =unithashtable;
-    QHash<QString, LogicUnit *>::const_iterator blockIterator = hash.constBegin();
-
-     while(blockIterator != unithashtable.constEnd()){
-         QString actName = blockIterator.key();
-         if(actName.compare(nodeName)==0){
-             LogicUnit* actUnit = blockIterator.value();
-             wires = actUnit->getOutConsHash();
-         }
-         ++blockIterator;
-     }
 
-     if(wires.contains(kidName)){
-        result = wires.value(kidName);
-     }
-     return result;
+    if(unithashtable.contains(nodeName)){
+        result = unithashtable.value(nodeName)->getOutConsHash().value(kidName);
+    }
+    return result;
 }
 
 QList<LogicUnit *> Container::getClocks()
@@ -1037,12 +1119,26 @@ void Container::assignToModule(QString actName)
 void Container::expandCollapse(QString modulename)
 {
     bool makeAllVisible;
+
+    //fanout summary nodes are replaced by their connections
+    if(collapsedFanouts.contains(modulename)){
+        expandFanout(modulename);
+        arrangeContainer();
+        return;
+    }
+
+    //the nodes of a module are created when it is expanded the first time
+    if(collapsedModules.contains(modulename)){
+        materializeModule(modulename);
+    }
+
     LogicUnit* module = unithashtable[modulename];
 
     makeAllVisible = module->isVisible();
 
     //toggle module visibility
     module->setVisible(!module->isVisible());
+    module->updateWires();
 
     QHash<QString, LogicUnit *> hash =unithashtable;
     QHash<QString, LogicUnit *>::const_iterator blockIterator = hash.constBegin();
@@ -1052,6 +1148,8 @@ void Container::expandCollapse(QString modulename)
          if(actNode->hasModule &&
                  actNode->getModule()->getName().compare(modulename)==0){
             actNode->setVisible(makeAllVisible);
+            //also hides the connections between nodes of the module
+            actNode->updateWires();
          }
          ++blockIterator;
      }
@@ -29,6 +29,8 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "explorerscene.h"
 #include "odininterface.h"
 #include<QHash>
+#include<QSet>
+#include<QPair>
 
 class Container
 {
@@ -72,6 +74,14 @@ private:
     int createNodesFromOdin();
     int createConnectionsFromOdin();
     int createConnectionsFromOdinIterate();
+    LogicUnit::UnitType getUnitType(nnode_t *node);
+    LogicUnit *getRepresentative(nnode_t *node);
+    bool connectUnits(LogicUnit *start, LogicUnit *end, int outputPin, int maxOutputPin);
+    void createOutputConnections(nnode_t *node, bool summarizeFanout);
+    void createInputConnections(nnode_t *node, QSet<nnode_t *> moduleNodes);
+    void materializeModule(QString modulename);
+    void expandFanout(QString summaryname);
+    void copySimCyclesIntoNode(LogicUnit *visNode, nnode_t *node);
     int createLatches();
     int createConnections();
     int getNodeListFromOdin();
@@ -100,6 +110,12 @@ private:
     QHash<QString, LogicUnit *> completeNodes;
     int simOffset, maxSimStep, actSimStep;
     QList<LogicUnit*> clocks;
+    //nodes of subcircuits, which are only created when their module is expanded
+    QHash<QString, QList<nnode_t *> > collapsedModules;
+    //drivers of big fanouts, which are only connected when their summary node is expanded
+    QHash<QString, nnode_t *> collapsedFanouts;
+    //every pair of connected units, so no connection is created twice
+    QSet<QPair<LogicUnit *, LogicUnit *> > connectedUnits;
 
     };
 
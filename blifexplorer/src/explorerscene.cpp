@@ -263,11 +263,11 @@ LogicUnit *ExplorerScene::addLogicUnit(QString name, LogicUnit::UnitType type,QP
 /*---------------------------------------------------------------------------------------------
  * (function: addConnection)
  *-------------------------------------------------------------------------------------------*/
-bool ExplorerScene::addConnection(LogicUnit *startUnit, LogicUnit *endUnit)
+Wire *ExplorerScene::addConnection(LogicUnit *startUnit, LogicUnit *endUnit)
 {
 
     if(startUnit->getName().compare(endUnit->getName())==0)
-        return false;
+        return NULL;
 
     Wire *wire = new Wire(startUnit, endUnit);
     wire->setColor(myLineColor);
@@ -277,7 +277,7 @@ bool ExplorerScene::addConnection(LogicUnit *startUnit, LogicUnit *endUnit)
     addItem(wire);
     wire->updatePosition();
 
-    return true;
+    return wire;
 }
 
 
@@ -61,7 +61,7 @@ public:
     void setItemColor(const QColor &color);
     void setFont(const QFont &font);
     LogicUnit *addLogicUnit(QString name, LogicUnit::UnitType type,QPointF position);
-    bool addConnection(LogicUnit *startUnit, LogicUnit *endUnit);
+    Wire *addConnection(LogicUnit *startUnit, LogicUnit *endUnit);
 
 
 
@@ -153,9 +153,19 @@ void LogicUnit::addConnection(Wire *wire)
             wire->setMaxNumber(myIncount);
         }
         wires.append(wire);
-        itemChange(QGraphicsPolygonItem::ItemPositionChange,QVariant(0));
+        //only the new wire has to be placed (the inputs are placed by setMaxNumber)
+        wire->updatePosition();
     }else{//I am a Module
-        if(wire->startUnit()->hasModule){
+        if(wire->endUnit() == this){
+            //I am the end of a connection to the collapsed module
+            myIncount++;
+            wires.append(wire);
+            wire->setNumber(myIncount);
+        }else if(wire->startUnit() == this){
+            //I am the start of a connection from the collapsed module
+            wires.append(wire);
+            wire->updatePosition();
+        }else if(wire->startUnit()->hasModule){
             //I am the start module
             if(wire->startUnit()->getModule()->getName().compare(myName)==0){
                 LogicUnit* startNode = wire->startUnit();
@@ -286,6 +296,19 @@ QVariant LogicUnit::itemChange(GraphicsItemChange change,
     return value;
 }
 
+/*---------------------------------------------------------------------------------------------
+ * (function: getUnitImage)
+ *-------------------------------------------------------------------------------------------*/
+//the pictures of the unit types are loaded once, not each time a unit is painted
+static QImage getUnitImage(const QString &path)
+{
+    static QHash<QString, QImage> images;
+    if(!images.contains(path)){
+        images.insert(path, QImage(path));
+    }
+    return images.value(path);
+}
+
 /*---------------------------------------------------------------------------------------------
  * (function: paint)
  *-------------------------------------------------------------------------------------------*/
@@ -297,63 +320,63 @@ QImage image;
 
     switch (myUnitType) {
     case And:
-        image.load(":/images/nodeTypes/AND.png");
+        image = getUnitImage(":/images/nodeTypes/AND.png");
         painter->drawImage(boundingRect(),image);
             break;
     case Nand:
-        image.load(":/images/nodeTypes/NAND.png");
+        image = getUnitImage(":/images/nodeTypes/NAND.png");
         painter->drawImage(boundingRect(),image);
             break;
     case Or:
-        image.load(":/images/nodeTypes/OR.png");
+        image = getUnitImage(":/images/nodeTypes/OR.png");
         painter->drawImage(boundingRect(),image);
             break;
     case Nor:
-        image.load(":/images/nodeTypes/NOR.png");
+        image = getUnitImage(":/images/nodeTypes/NOR.png");
         painter->drawImage(boundingRect(),image);
             break;
     case Xor:
-        image.load(":/images/nodeTypes/XOR.png");
+        image = getUnitImage(":/images/nodeTypes/XOR.png");
         painter->drawImage(boundingRect(),image);
             break;
     case Xnor:
-        image.load(":/images/nodeTypes/XNOR.png");
+        image = getUnitImage(":/images/nodeTypes/XNOR.png");
         painter->drawImage(boundingRect(),image);
             break;
     case Not:
-        image.load(":/images/nodeTypes/NOT.png");
+        image = getUnitImage(":/images/nodeTypes/NOT.png");
         painter->drawImage(boundingRect(),image);
             break;
     case MUX:
-        image.load(":/images/nodeTypes/MUX.png");
+        image = getUnitImage(":/images/nodeTypes/MUX.png");
         painter->drawImage(boundingRect(),image);
             break;
     case ADDER_FUNC:
-        image.load(":/images/nodeTypes/ADDER_FUNC.png");
+        image = getUnitImage(":/images/nodeTypes/ADDER_FUNC.png");
         painter->drawImage(boundingRect(),image);
             break;
     case CARRY_FUNC:
-        image.load(":/images/nodeTypes/CARRY_FUNC.png");
+        image = getUnitImage(":/images/nodeTypes/CARRY_FUNC.png");
         painter->drawImage(boundingRect(),image);
         break;
     case MEMORY:
-        image.load(":/images/nodeTypes/Hmemory.png");
+        image = getUnitImage(":/images/nodeTypes/Hmemory.png");
         painter->drawImage(boundingRect(),image);
         break;
     case Module:
-        image.load(":/images/nodeTypes/module.png");
+        image = getUnitImage(":/images/nodeTypes/module.png");
         painter->drawImage(boundingRect(),image);
         break;
     case MINUS:
-        image.load(":/images/nodeTypes/Hminus.png");
+        image = getUnitImage(":/images/nodeTypes/Hminus.png");
         painter->drawImage(boundingRect(),image);
         break;
     case ADD:
-        image.load(":/images/nodeTypes/Hadd.png");
+        image = getUnitImage(":/images/nodeTypes/Hadd.png");
         painter->drawImage(boundingRect(),image);
         break;
     case MULTIPLY:
-        image.load(":/images/nodeTypes/Hmult.png");
+        image = getUnitImage(":/images/nodeTypes/Hmult.png");
         painter->drawImage(boundingRect(),image);
         break;
     case LogicGate:
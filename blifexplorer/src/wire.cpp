@@ -165,7 +165,9 @@ void Wire::updatePosition()
         end = myEndModule;
     } else {
         number = myNumber;
-        maxnumber = myMaxNumber;
+        //modules number their inputs as they are connected
+        maxnumber = (myEndUnit->unitType() == LogicUnit::Module) ?
+                    myEndUnit->getMaxNumber() : myMaxNumber;
         end = myEndUnit;
     }
 
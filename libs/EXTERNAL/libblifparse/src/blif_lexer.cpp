@@ -16,6 +16,14 @@ Lexer::Lexer(FILE* file, Callback& callback)
     blifparse_set_in(file, state_);
 }
 
+Lexer::Lexer(const char* data, size_t size, int first_lineno, Callback& callback)
+    : callback_(callback) {
+    blifparse_lex_init(&state_);
+    //Scans a copy of data, which is freed when the lexer is destroyed
+    blifparse__scan_bytes(data, static_cast<int>(size), state_);
+    blifparse_set_lineno(first_lineno, state_);
+}
+
 Lexer::~Lexer() {
     blifparse_lex_destroy(state_);
 }
@@ -11,6 +11,8 @@ typedef void* yyscan_t;
 class Lexer {
     public:
         Lexer(FILE* file, Callback& callback);
+        //Lexes the size bytes at data, with their first line numbered first_lineno
+        Lexer(const char* data, size_t size, int first_lineno, Callback& callback);
         ~Lexer();
         Parser::symbol_type next_token();
         const char* text() const;
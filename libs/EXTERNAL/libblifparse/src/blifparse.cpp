@@ -75,4 +75,21 @@ void blif_parse_file(FILE* blif_file, Callback& callback, const char* filename)
     callback.finish_parse();
 }
 
+void blif_parse_buffer(const char* data, size_t size, Callback& callback, const char* filename, int first_lineno) {
+    Lexer lexer(data, size, first_lineno, callback);
+
+    Parser parser(lexer, callback);
+
+    callback.start_parse();
+
+    callback.filename(filename);
+
+    int error = parser.parse();
+    if(error) {
+        blif_error_wrap(callback, 0, "", "File failed to parse.\n");
+    }
+
+    callback.finish_parse();
+}
+
 }
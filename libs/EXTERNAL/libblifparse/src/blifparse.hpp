@@ -101,6 +101,14 @@ void blif_parse_filename(const char* filename, Callback& callback);
 //Loads from 'blif'. 'filename' only used to pass a filename to callback and can be left unspecified
 void blif_parse_file(FILE* blif, Callback& callback, const char* filename=""); 
 
+//Loads from the 'size' bytes at 'data' (which need not be null terminated), numbering their first
+//line 'first_lineno'. This allows a large file to be split (e.g. at .names or .subckt lines) and
+//the parts parsed independently.
+//
+//The parser keeps no global state, so different buffers may be parsed concurrently (each with
+//its own callback).
+void blif_parse_buffer(const char* data, size_t size, Callback& callback, const char* filename="", int first_lineno=1);
+
 /*
  * Enumerations
  */
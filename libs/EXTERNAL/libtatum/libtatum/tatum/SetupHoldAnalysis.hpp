@@ -110,6 +110,8 @@ class SetupHoldAnalysis : public GraphVisitor {
 #endif
         TimingTags::tag_range hold_node_slacks(const NodeId node_id) const { return hold_visitor_.hold_node_slacks(node_id); }
 
+        size_t memory_usage() const { return setup_visitor_.memory_usage() + hold_visitor_.memory_usage(); }
+
         SetupAnalysis& setup_visitor() { return setup_visitor_; }
         HoldAnalysis& hold_visitor() { return hold_visitor_; }
     private:
@@ -29,6 +29,26 @@ tatum::util::linear_map<Id,Id> compress_ids(const tatum::util::linear_map<Id,Id>
     return id_map;
 }
 
+//Heap memory used by the elements of a container
+template<typename Container>
+size_t container_memory_usage(const Container& container) {
+    return container.capacity() * sizeof(*container.begin());
+}
+
+template<typename Id>
+size_t container_memory_usage(const tatum::util::linear_map<Id,bool>& container) {
+    return container.capacity() / 8; //Bit packed
+}
+
+template<typename Container>
+size_t nested_container_memory_usage(const Container& container) {
+    size_t bytes = container_memory_usage(container);
+    for (const auto& elem : container) {
+        bytes += container_memory_usage(elem);
+    }
+    return bytes;
+}
+
 //Returns a vector based on 'values', which has had entries dropped and 
 //re-ordered according according to 'id_map'.
 //
@@ -176,6 +196,8 @@ LevelId TimingGraph::node_level(const NodeId node) const {
 
 
 NodeId TimingGraph::add_node(const NodeType type) {
+    unpack_node_edges();
+
     //Invalidate the levelization
     is_levelized_ = false;
 
@@ -204,6 +226,8 @@ EdgeId TimingGraph::add_edge(const EdgeType type, const NodeId src_node, const N
     TATUM_ASSERT(valid_node_id(src_node));
     TATUM_ASSERT(valid_node_id(sink_node));
 
+    unpack_node_edges();
+
     //Invalidate the levelization
     is_levelized_ = false;
 
@@ -232,10 +256,82 @@ EdgeId TimingGraph::add_edge(const EdgeType type, const NodeId src_node, const N
     return edge_id;
 }
 
+void TimingGraph::add_edges(const std::vector<EdgeType>& types, const std::vector<NodeId>& src_nodes, const std::vector<NodeId>& sink_nodes) {
+    TATUM_ASSERT(types.size() == src_nodes.size());
+    TATUM_ASSERT(types.size() == sink_nodes.size());
+
+    pack_node_edges();
+
+    //Invalidate the levelization
+    is_levelized_ = false;
+
+    size_t num_nodes = node_ids_.size();
+    size_t num_new_edges = types.size();
+
+    //Count the new in/out edges of each node
+    std::vector<size_t> in_pos(num_nodes, 0);
+    std::vector<size_t> out_pos(num_nodes, 0);
+    for (size_t i = 0; i < num_new_edges; ++i) {
+        TATUM_ASSERT(valid_node_id(src_nodes[i]));
+        TATUM_ASSERT(valid_node_id(sink_nodes[i]));
+        ++out_pos[size_t(src_nodes[i])];
+        ++in_pos[size_t(sink_nodes[i])];
+    }
+
+    //Lay out each node's edge references (the existing ones followed by the new ones), and
+    //copy over the existing ones. Afterwards in_pos/out_pos hold where each node's next new
+    //edge reference goes.
+    std::vector<EdgeId> packed_edges(packed_node_edges_.size() + 2 * num_new_edges);
+    std::vector<size_t> in_edges_begin(num_nodes + 1);
+    std::vector<size_t> out_edges_begin(num_nodes);
+    size_t offset = 0;
+    for (size_t inode = 0; inode < num_nodes; ++inode) {
+        NodeId node_id(inode);
+
+        auto in_edges = node_in_edges(node_id);
+        in_edges_begin[inode] = offset;
+        std::copy(in_edges.begin(), in_edges.end(), packed_edges.begin() + offset);
+        offset += in_edges.size();
+        size_t num_new_in = in_pos[inode];
+        in_pos[inode] = offset;
+        offset += num_new_in;
+
+        auto out_edges = node_out_edges(node_id);
+        out_edges_begin[inode] = offset;
+        std::copy(out_edges.begin(), out_edges.end(), packed_edges.begin() + offset);
+        offset += out_edges.size();
+        size_t num_new_out = out_pos[inode];
+        out_pos[inode] = offset;
+        offset += num_new_out;
+    }
+    in_edges_begin[num_nodes] = offset;
+    TATUM_ASSERT(offset == packed_edges.size());
+
+    //Create the edges
+    for (size_t i = 0; i < num_new_edges; ++i) {
+        EdgeId edge_id = EdgeId(edge_ids_.size());
+        edge_ids_.push_back(edge_id);
+
+        edge_types_.push_back(types[i]);
+        edge_src_nodes_.push_back(src_nodes[i]);
+        edge_sink_nodes_.push_back(sink_nodes[i]);
+        edges_disabled_.push_back(false);
+
+        packed_edges[out_pos[size_t(src_nodes[i])]++] = edge_id;
+        packed_edges[in_pos[size_t(sink_nodes[i])]++] = edge_id;
+    }
+
+    packed_node_edges_ = std::move(packed_edges);
+    packed_node_in_edges_begin_ = std::move(in_edges_begin);
+    packed_node_out_edges_begin_ = std::move(out_edges_begin);
+}
+
 
 void TimingGraph::remove_node(const NodeId node_id) {
     TATUM_ASSERT(valid_node_id(node_id));
 
+    unpack_node_edges();
+
     //Invalidate the levelization
     is_levelized_ = false;
 
@@ -259,6 +355,8 @@ void TimingGraph::remove_node(const NodeId node_id) {
 void TimingGraph::remove_edge(const EdgeId edge_id) {
     TATUM_ASSERT(valid_edge_id(edge_id));
 
+    unpack_node_edges();
+
     //Invalidate the levelization
     is_levelized_ = false;
 
@@ -463,6 +561,28 @@ bool TimingGraph::validate() const {
     return valid;
 }
 
+size_t TimingGraph::memory_usage() const {
+    size_t bytes = 0;
+    bytes += container_memory_usage(node_ids_);
+    bytes += container_memory_usage(node_types_);
+    bytes += nested_container_memory_usage(node_in_edges_);
+    bytes += nested_container_memory_usage(node_out_edges_);
+    bytes += container_memory_usage(node_levels_);
+    bytes += container_memory_usage(packed_node_edges_);
+    bytes += container_memory_usage(packed_node_in_edges_begin_);
+    bytes += container_memory_usage(packed_node_out_edges_begin_);
+    bytes += container_memory_usage(edge_ids_);
+    bytes += container_memory_usage(edge_types_);
+    bytes += container_memory_usage(edge_sink_nodes_);
+    bytes += container_memory_usage(edge_src_nodes_);
+    bytes += container_memory_usage(edges_disabled_);
+    bytes += container_memory_usage(level_ids_);
+    bytes += nested_container_memory_usage(level_nodes_);
+    bytes += container_memory_usage(primary_inputs_);
+    bytes += container_memory_usage(logical_outputs_);
+    return bytes;
+}
+
 GraphIdMaps TimingGraph::optimize_layout() {
     auto node_id_map = optimize_node_layout();
     remap_nodes(node_id_map);
@@ -474,9 +594,68 @@ GraphIdMaps TimingGraph::optimize_layout() {
 
     levelize();
 
+    pack_node_edges();
+
     return {node_id_map, edge_id_map};
 }
 
+void TimingGraph::pack_node_edges() {
+    if (node_edges_packed_) return;
+
+    size_t num_edge_refs = 0;
+    for (size_t inode = 0; inode < node_ids_.size(); ++inode) {
+        NodeId node_id(inode);
+        num_edge_refs += node_in_edges_[node_id].size() + node_out_edges_[node_id].size();
+    }
+
+    packed_node_edges_.clear();
+    packed_node_edges_.reserve(num_edge_refs);
+    packed_node_in_edges_begin_.clear();
+    packed_node_in_edges_begin_.reserve(node_ids_.size() + 1);
+    packed_node_out_edges_begin_.clear();
+    packed_node_out_edges_begin_.reserve(node_ids_.size());
+
+    for (size_t inode = 0; inode < node_ids_.size(); ++inode) {
+        NodeId node_id(inode);
+        packed_node_in_edges_begin_.push_back(packed_node_edges_.size());
+        packed_node_edges_.insert(packed_node_edges_.end(), node_in_edges_[node_id].begin(), node_in_edges_[node_id].end());
+
+        packed_node_out_edges_begin_.push_back(packed_node_edges_.size());
+        packed_node_edges_.insert(packed_node_edges_.end(), node_out_edges_[node_id].begin(), node_out_edges_[node_id].end());
+    }
+    packed_node_in_edges_begin_.push_back(packed_node_edges_.size());
+
+    //Free the per-node vectors
+    node_in_edges_ = tatum::util::linear_map<NodeId,std::vector<EdgeId>>();
+    node_out_edges_ = tatum::util::linear_map<NodeId,std::vector<EdgeId>>();
+
+    node_edges_packed_ = true;
+}
+
+void TimingGraph::unpack_node_edges() {
+    if (!node_edges_packed_) return;
+
+    tatum::util::linear_map<NodeId,std::vector<EdgeId>> unpacked_in_edges(node_ids_.size());
+    tatum::util::linear_map<NodeId,std::vector<EdgeId>> unpacked_out_edges(node_ids_.size());
+    for (size_t inode = 0; inode < node_ids_.size(); ++inode) {
+        NodeId node_id(inode);
+
+        auto in_edges = node_in_edges(node_id);
+        unpacked_in_edges[node_id].assign(in_edges.begin(), in_edges.end());
+
+        auto out_edges = node_out_edges(node_id);
+        unpacked_out_edges[node_id].assign(out_edges.begin(), out_edges.end());
+    }
+    node_in_edges_ = std::move(unpacked_in_edges);
+    node_out_edges_ = std::move(unpacked_out_edges);
+
+    std::vector<EdgeId>().swap(packed_node_edges_);
+    std::vector<size_t>().swap(packed_node_in_edges_begin_);
+    std::vector<size_t>().swap(packed_node_out_edges_begin_);
+
+    node_edges_packed_ = false;
+}
+
 tatum::util::linear_map<EdgeId,EdgeId> TimingGraph::optimize_edge_layout() const {
     //Make all edges in a level be contiguous in memory
 
@@ -552,10 +731,45 @@ void TimingGraph::remap_nodes(const tatum::util::linear_map<NodeId,NodeId>& node
     is_levelized_ = false;
 
     //Update values
+    if (node_edges_packed_) {
+        //Re-order the packed edge references (without unpacking them)
+        std::vector<NodeId> old_node_ids;
+        for (size_t inode = 0; inode < node_id_map.size(); ++inode) {
+            NodeId new_id = node_id_map[NodeId(inode)];
+            if (!new_id) continue;
+
+            if (size_t(new_id) >= old_node_ids.size()) {
+                old_node_ids.resize(size_t(new_id) + 1);
+            }
+            old_node_ids[size_t(new_id)] = NodeId(inode);
+        }
+
+        std::vector<EdgeId> packed_edges;
+        packed_edges.reserve(packed_node_edges_.size());
+        std::vector<size_t> in_edges_begin;
+        in_edges_begin.reserve(old_node_ids.size() + 1);
+        std::vector<size_t> out_edges_begin;
+        out_edges_begin.reserve(old_node_ids.size());
+        for (NodeId old_id : old_node_ids) {
+            auto in_edges = node_in_edges(old_id);
+            in_edges_begin.push_back(packed_edges.size());
+            packed_edges.insert(packed_edges.end(), in_edges.begin(), in_edges.end());
+
+            auto out_edges = node_out_edges(old_id);
+            out_edges_begin.push_back(packed_edges.size());
+            packed_edges.insert(packed_edges.end(), out_edges.begin(), out_edges.end());
+        }
+        in_edges_begin.push_back(packed_edges.size());
+
+        packed_node_edges_ = std::move(packed_edges);
+        packed_node_in_edges_begin_ = std::move(in_edges_begin);
+        packed_node_out_edges_begin_ = std::move(out_edges_begin);
+    } else {
+        node_in_edges_ = clean_and_reorder_values(node_in_edges_, node_id_map);
+        node_out_edges_ = clean_and_reorder_values(node_out_edges_, node_id_map);
+    }
     node_ids_ = clean_and_reorder_ids(node_id_map);
     node_types_ = clean_and_reorder_values(node_types_, node_id_map);
-    node_in_edges_ = clean_and_reorder_values(node_in_edges_, node_id_map);
-    node_out_edges_ = clean_and_reorder_values(node_out_edges_, node_id_map);
 
     //Update references
     edge_src_nodes_ = update_all_refs(edge_src_nodes_, node_id_map);
@@ -573,11 +787,42 @@ void TimingGraph::remap_edges(const tatum::util::linear_map<EdgeId,EdgeId>& edge
     edges_disabled_ = clean_and_reorder_values(edges_disabled_, edge_id_map);
 
     //Update cross-references
-    for(auto& edges_ref : node_in_edges_) {
-        edges_ref = update_valid_refs(edges_ref, edge_id_map);
-    }
-    for(auto& edges_ref : node_out_edges_) {
-        edges_ref = update_valid_refs(edges_ref, edge_id_map);
+    if (node_edges_packed_) {
+        //Update the packed references in place, dropping any removed edges (which can only
+        //shift the remaining references towards the front)
+        size_t new_size = 0;
+        auto update_refs = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                EdgeId orig_edge = packed_node_edges_[i];
+                if (!orig_edge) continue;
+
+                EdgeId new_edge = edge_id_map[orig_edge];
+                if (!new_edge) continue;
+
+                packed_node_edges_[new_size++] = new_edge;
+            }
+        };
+
+        size_t num_nodes = packed_node_out_edges_begin_.size();
+        for (size_t inode = 0; inode < num_nodes; ++inode) {
+            size_t in_begin = packed_node_in_edges_begin_[inode];
+            size_t out_begin = packed_node_out_edges_begin_[inode];
+            size_t out_end = packed_node_in_edges_begin_[inode + 1];
+
+            packed_node_in_edges_begin_[inode] = new_size;
+            update_refs(in_begin, out_begin);
+            packed_node_out_edges_begin_[inode] = new_size;
+            update_refs(out_begin, out_end);
+        }
+        packed_node_in_edges_begin_[num_nodes] = new_size;
+        packed_node_edges_.resize(new_size);
+    } else {
+        for(auto& edges_ref : node_in_edges_) {
+            edges_ref = update_valid_refs(edges_ref, edge_id_map);
+        }
+        for(auto& edges_ref : node_out_edges_) {
+            edges_ref = update_valid_refs(edges_ref, edge_id_map);
+        }
     }
 }
 
@@ -595,8 +840,10 @@ bool TimingGraph::valid_level_id(const LevelId level_id) const {
 
 bool TimingGraph::validate_sizes() const {
     if (   node_ids_.size() != node_types_.size()
-        || node_ids_.size() != node_in_edges_.size()
-        || node_ids_.size() != node_out_edges_.size()
+        || (!node_edges_packed_ && node_ids_.size() != node_in_edges_.size())
+        || (!node_edges_packed_ && node_ids_.size() != node_out_edges_.size())
+        || (node_edges_packed_ && node_ids_.size() + 1 != packed_node_in_edges_begin_.size())
+        || (node_edges_packed_ && node_ids_.size() != packed_node_out_edges_begin_.size())
         || node_ids_.size() != node_levels_.size()) {
         throw tatum::Error("Inconsistent node attribute sizes");
     }
@@ -622,7 +869,7 @@ bool TimingGraph::validate_values() const {
             throw tatum::Error("Invalid node id", node_id);
         }
 
-        for(EdgeId edge_id : node_in_edges_[node_id]) {
+        for(EdgeId edge_id : node_in_edges(node_id)) {
             if(!valid_edge_id(edge_id)) {
                 throw tatum::Error("Invalid node-in-edge reference", node_id, edge_id);
             }
@@ -632,7 +879,7 @@ bool TimingGraph::validate_values() const {
                 throw tatum::Error("Mismatched edge-sink/node-in-edge reference", node_id, edge_id);
             }
         }
-        for(EdgeId edge_id : node_out_edges_[node_id]) {
+        for(EdgeId edge_id : node_out_edges(node_id)) {
             if(!valid_edge_id(edge_id)) {
                 throw tatum::Error("Invalid node-out-edge reference", node_id, edge_id);
             }
@@ -48,9 +48,15 @@
  * and ensures that each cache line pulled into the cache will (likely) be accessed multiple times
  * before being evicted.
  *
- * Note that performing these optimizations is currently done explicity by calling the optimize_edge_layout()
- * and optimize_node_layout() member functions.  In the future (particularily if incremental modification
- * support is added), it may be a good idea apply these modifications automatically as needed.
+ * Note that performing these optimizations is currently done explicity by calling the optimize_layout()
+ * member function.  In the future (particularily if incremental modification support is added), it may
+ * be a good idea apply these modifications automatically as needed.
+ *
+ * optimize_layout() also packs the in and out edge references of all nodes into a single array
+ * (in node order, with each node's in-edges followed by its out-edges), rather than a separately
+ * allocated vector per node.  A node's edges are then next to those of the nodes processed before
+ * and after it.  Adding or removing individual nodes/edges afterwards unpacks them again (see
+ * unpack_node_edges()), but add_edges() adds edges in bulk directly into the packed form.
  *
  */
 #include <vector>
@@ -86,11 +92,23 @@ class TimingGraph {
 
         ///\param id The node id
         ///\returns A range of all out-going edges the node drives
-        edge_range node_out_edges(const NodeId id) const { return tatum::util::make_range(node_out_edges_[id].begin(), node_out_edges_[id].end()); }
+        edge_range node_out_edges(const NodeId id) const {
+            if (node_edges_packed_) {
+                return tatum::util::make_range(packed_node_edges_.begin() + packed_node_out_edges_begin_[size_t(id)],
+                                               packed_node_edges_.begin() + packed_node_in_edges_begin_[size_t(id) + 1]);
+            }
+            return tatum::util::make_range(node_out_edges_[id].begin(), node_out_edges_[id].end());
+        }
 
         ///\param id The node id
         ///\returns A range of all in-coming edges the node drives
-        edge_range node_in_edges(const NodeId id) const { return tatum::util::make_range(node_in_edges_[id].begin(), node_in_edges_[id].end()); }
+        edge_range node_in_edges(const NodeId id) const {
+            if (node_edges_packed_) {
+                return tatum::util::make_range(packed_node_edges_.begin() + packed_node_in_edges_begin_[size_t(id)],
+                                               packed_node_edges_.begin() + packed_node_out_edges_begin_[size_t(id)]);
+            }
+            return tatum::util::make_range(node_in_edges_[id].begin(), node_in_edges_[id].end());
+        }
 
         ///\param id The Node id
         ///\returns The number of active (undisabled) edges terminating at the node
@@ -190,6 +208,9 @@ class TimingGraph {
         //\returns true if the timing graph is internally consistent, throws an exception if not
         bool validate() const;
 
+        //\returns The (approximate) heap memory used by the timing graph, in bytes
+        size_t memory_usage() const;
+
     public: //Mutators
         /*
          * Graph modifiers
@@ -207,6 +228,16 @@ class TimingGraph {
         ///\warning Graph will likely need to be re-levelized after modification
         EdgeId add_edge(const EdgeType type, const NodeId src_node, const NodeId sink_node);
 
+        ///Adds several edges to the timing graph, with the same result as calling add_edge() for each in order.
+        ///The node edge references are built directly in their packed form, which for large graphs is much
+        ///faster and uses much less memory than adding the edges individually.
+        ///\param types The type of each edge
+        ///\param src_nodes The node id of each edge's driving node
+        ///\param sink_nodes The node id of each edge's sink node
+        ///\pre All the source/sink nodes must have been already added to the graph
+        ///\warning Graph will likely need to be re-levelized after modification
+        void add_edges(const std::vector<EdgeType>& types, const std::vector<NodeId>& src_nodes, const std::vector<NodeId>& sink_nodes);
+
         ///Removes a node (and it's associated edges) from the timing graph
         ///\param node_id The node to remove
         ///\warning This will leave invalid ID references in the timing graph until compress() is called
@@ -259,6 +290,12 @@ class TimingGraph {
         //          (i.e. cache locality)
         tatum::util::linear_map<NodeId,NodeId> optimize_node_layout() const;
 
+        ///Packs the in/out edge references of all nodes into packed_node_edges_
+        void pack_node_edges();
+
+        ///Restores the per-node edge reference vectors, so the graph can be modified
+        void unpack_node_edges();
+
         void remap_nodes(const tatum::util::linear_map<NodeId,NodeId>& node_id_map);
         void remap_edges(const tatum::util::linear_map<EdgeId,EdgeId>& edge_id_map);
 
@@ -286,6 +323,14 @@ class TimingGraph {
         tatum::util::linear_map<NodeId,std::vector<EdgeId>> node_out_edges_; //Out going edge IDs for node
         tatum::util::linear_map<NodeId,LevelId> node_levels_; //Out going edge IDs for node
 
+        //Packed node edge references, which replace node_in_edges_/node_out_edges_ after optimize_layout().
+        //Node i's in-edges are packed_node_edges_[packed_node_in_edges_begin_[i]..packed_node_out_edges_begin_[i])
+        //and its out-edges are packed_node_edges_[packed_node_out_edges_begin_[i]..packed_node_in_edges_begin_[i+1])
+        std::vector<EdgeId> packed_node_edges_;
+        std::vector<size_t> packed_node_in_edges_begin_; //One entry per node, plus the end
+        std::vector<size_t> packed_node_out_edges_begin_;
+        bool node_edges_packed_ = false;
+
         //Edge data
         tatum::util::linear_map<EdgeId,EdgeId> edge_ids_; //The edge IDs in the graph
         tatum::util::linear_map<EdgeId,EdgeType> edge_types_; //Type of edge
@@ -29,6 +29,12 @@ class TimingGraphNameResolver {
             //Default no edge delay breakdown
             return EdgeDelayBreakdown();
         }
+
+        //Returns true if the above may be called concurrently from multiple threads,
+        //which allows reports to be generated in parallel
+        virtual bool is_thread_safe() const {
+            return false;
+        }
 };
 
 } //namespace
@@ -1,9 +1,14 @@
+#include <algorithm>
 #include <map>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <vector>
 
+#ifdef TATUM_USE_TBB
+# include <tbb/parallel_for.h>
+#endif
+
 #include "tatum/util/tatum_math.hpp"
 #include "tatum/util/OsFormatGuard.hpp"
 #include "tatum/error.hpp"
@@ -203,11 +208,38 @@ void TimingReporter::report_timing(std::ostream& os,
     os << "# Output precision: " << precision_ << "\n";
     os << "\n";
 
-    size_t i = 0;
-    for(const auto& path : paths) {
-        os << "#Path " << ++i << "\n";
-        report_timing_path(os, path);
-        os << "\n";
+#ifdef TATUM_USE_TBB
+    if (name_resolver_.is_thread_safe()) {
+        //Format blocks of paths in parallel into separate buffers, and then write them out in order
+        constexpr size_t PATHS_PER_BLOCK = 1024;
+        std::vector<std::string> path_reports;
+
+        for (size_t block_begin = 0; block_begin < paths.size(); block_begin += PATHS_PER_BLOCK) {
+            size_t block_end = std::min(block_begin + PATHS_PER_BLOCK, paths.size());
+            path_reports.resize(block_end - block_begin);
+
+            tbb::parallel_for(block_begin, block_end, [&](size_t i) {
+                std::ostringstream path_os;
+                path_os.copyfmt(os);
+                path_os << "#Path " << i + 1 << "\n";
+                report_timing_path(path_os, paths[i]);
+                path_os << "\n";
+                path_reports[i - block_begin] = path_os.str();
+            });
+
+            for (const std::string& path_report : path_reports) {
+                os << path_report;
+            }
+        }
+    } else
+#endif
+    {
+        size_t i = 0;
+        for(const auto& path : paths) {
+            os << "#Path " << ++i << "\n";
+            report_timing_path(os, path);
+            os << "\n";
+        }
     }
 
     os << "#End of timing report\n";
@@ -69,6 +69,7 @@ class FullSetupTimingAnalyzer : public SetupTimingAnalyzer {
         double get_profiling_data_impl(std::string key) const override { return graph_walker_.get_profiling_data(key); }
         size_t num_unconstrained_startpoints_impl() const override { return graph_walker_.num_unconstrained_startpoints(); }
         size_t num_unconstrained_endpoints_impl() const override { return graph_walker_.num_unconstrained_endpoints(); }
+        size_t memory_usage_impl() const override { return setup_visitor_.memory_usage(); }
 
         //SetupTimingAnalyzer
         TimingTags::tag_range setup_tags_impl(NodeId node_id) const override { return setup_visitor_.setup_tags(node_id); }
@@ -45,6 +45,9 @@ class TimingAnalyzer {
         virtual size_t num_unconstrained_startpoints() const { return num_unconstrained_startpoints_impl(); }
         virtual size_t num_unconstrained_endpoints() const { return num_unconstrained_endpoints_impl(); }
 
+        ///Returns the heap memory (in bytes) used by the analyzer's timing tags
+        size_t memory_usage() const { return memory_usage_impl(); }
+
     protected:
 
         virtual void update_timing_impl() = 0;
@@ -56,6 +59,8 @@ class TimingAnalyzer {
 
         virtual size_t num_unconstrained_startpoints_impl() const = 0;
         virtual size_t num_unconstrained_endpoints_impl() const = 0;
+
+        virtual size_t memory_usage_impl() const = 0;
 };
 
 } //namepsace
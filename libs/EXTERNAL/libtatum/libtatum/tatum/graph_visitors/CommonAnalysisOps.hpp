@@ -32,6 +32,16 @@ class CommonAnalysisOps {
         CommonAnalysisOps& operator=(const CommonAnalysisOps&) = delete;
         CommonAnalysisOps& operator=(CommonAnalysisOps&&) = delete;
 
+        ///\returns The heap memory used by the tags, in bytes
+        size_t memory_usage() const {
+            size_t bytes = memory_usage(node_tags_);
+#ifdef TATUM_CALCULATE_EDGE_SLACKS
+            bytes += memory_usage(edge_slacks_);
+#endif
+            bytes += memory_usage(node_slacks_);
+            return bytes;
+        }
+
         TimingTags::mutable_tag_range get_mutable_tags(const NodeId node_id) { 
             return node_tags_[node_id].mutable_tags(); 
         }
@@ -89,6 +99,16 @@ class CommonAnalysisOps {
         }
 
 
+    private:
+        template<typename Id>
+        static size_t memory_usage(const tatum::util::linear_map<Id,TimingTags>& tags) {
+            size_t bytes = tags.capacity() * sizeof(TimingTags);
+            for (const TimingTags& elem_tags : tags) {
+                bytes += elem_tags.memory_usage();
+            }
+            return bytes;
+        }
+
     protected:
         tatum::util::linear_map<NodeId,TimingTags> node_tags_;
 
@@ -31,6 +31,9 @@ class CommonAnalysisVisitor : public GraphVisitor {
         CommonAnalysisVisitor(size_t num_tags, size_t num_slacks)
             : ops_(num_tags, num_slacks) { }
 
+        ///\returns The heap memory used by the analysis tags, in bytes
+        size_t memory_usage() const { return ops_.memory_usage(); }
+
         void do_reset_node(const NodeId node_id) override { ops_.reset_node(node_id); }
 #ifdef TATUM_CALCULATE_EDGE_SLACKS
         void do_reset_edge(const EdgeId edge_id) override { ops_.reset_edge(edge_id); }
@@ -309,13 +312,8 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGr
             if(!src_launch_clk_tags.empty()) {
                 const Time clk_launch_edge_delay = ops_.launch_clock_edge_delay(dc, tg, edge_id);
 
-                for(const TimingTag& src_launch_clk_tag : src_launch_clk_tags) {
-                    //Standard propagation through the clock network
-
-                    Time new_arr = src_launch_clk_tag.time() + clk_launch_edge_delay;
-                    timing_modified |= ops_.merge_arr_tags(node_id, new_arr, src_node_id, src_launch_clk_tag);
-
-                }
+                //Standard propagation through the clock network
+                timing_modified |= ops_.merge_arr_tags(node_id, src_launch_clk_tags, clk_launch_edge_delay, src_node_id);
             }
         }
 
@@ -326,10 +324,8 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGr
             if(!src_capture_clk_tags.empty()) {
                 const Time clk_capture_edge_delay = ops_.capture_clock_edge_delay(dc, tg, edge_id);
 
-                for(const TimingTag& src_capture_clk_tag : src_capture_clk_tags) {
-                    //Standard propagation through the clock network
-                    timing_modified |= ops_.merge_arr_tags(node_id, src_capture_clk_tag.time() + clk_capture_edge_delay, src_node_id, src_capture_clk_tag);
-                }
+                //Standard propagation through the clock network
+                timing_modified |= ops_.merge_arr_tags(node_id, src_capture_clk_tags, clk_capture_edge_delay, src_node_id);
             }
         }
     }
@@ -373,10 +369,7 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGr
             const Time edge_delay = ops_.data_edge_delay(dc, tg, edge_id);
             TATUM_ASSERT_SAFE(edge_delay.valid());
 
-            for(const TimingTag& src_data_tag : src_data_tags) {
-                Time new_arr = src_data_tag.time() + edge_delay;
-                timing_modified |= ops_.merge_arr_tags(node_id, new_arr, src_node_id, src_data_tag);
-            }
+            timing_modified |= ops_.merge_arr_tags(node_id, src_data_tags, edge_delay, src_node_id);
         }
     }
 
@@ -431,10 +424,8 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_required_traverse_edge(const TimingG
         const Time& edge_delay = ops_.data_edge_delay(dc, tg, edge_id);
         TATUM_ASSERT_SAFE(edge_delay.valid());
 
-        for(const TimingTag& sink_tag : sink_data_tags) {
-            //We only propogate the required time if we have a valid matching arrival time
-            timing_modified |= ops_.merge_req_tags(node_id, sink_tag.time() - edge_delay, sink_node_id, sink_tag, true);
-        }
+        //We only propogate the required time if we have a valid matching arrival time
+        timing_modified |= ops_.merge_req_tags(node_id, sink_data_tags, -edge_delay, sink_node_id, true);
     }
 
     return timing_modified;
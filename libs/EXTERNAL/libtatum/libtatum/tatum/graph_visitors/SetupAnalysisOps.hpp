@@ -67,6 +67,10 @@ class SetupAnalysisOps : public CommonAnalysisOps {
             return node_tags_[node].min(time, origin, ref_tag, arrival_must_be_valid); 
         }
 
+        bool merge_req_tags(const NodeId node, TimingTags::tag_range ref_tags, const Time delay, const NodeId origin, bool arrival_must_be_valid=false) { 
+            return node_tags_[node].min(ref_tags, delay, origin, arrival_must_be_valid); 
+        }
+
         bool merge_arr_tags(const NodeId node, const TimingTag& ref_tag) { 
             return merge_arr_tags(node, ref_tag.time(), ref_tag.origin_node(), ref_tag);
         }
@@ -75,6 +79,10 @@ class SetupAnalysisOps : public CommonAnalysisOps {
             return node_tags_[node].max(time, origin, ref_tag); 
         }
 
+        bool merge_arr_tags(const NodeId node, TimingTags::tag_range ref_tags, const Time delay, const NodeId origin) { 
+            return node_tags_[node].max(ref_tags, delay, origin); 
+        }
+
         Time data_edge_delay(const DelayCalculator& dc, const TimingGraph& tg, const EdgeId edge_id) { 
             Time delay = dc.max_edge_delay(tg, edge_id); 
 
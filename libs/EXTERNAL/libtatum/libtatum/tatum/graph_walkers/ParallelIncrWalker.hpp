@@ -0,0 +1,461 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#ifdef TATUM_USE_TBB
+# include <tbb/concurrent_vector.h>
+# include <tbb/parallel_for_each.h>
+# include <tbb/combinable.h>
+#endif
+
+#include "tatum/graph_walkers/TimingGraphWalker.hpp"
+#include "tatum/TimingGraph.hpp"
+#include "tatum/delay_calc/DelayCalculator.hpp"
+#include "tatum/graph_visitors/GraphVisitor.hpp"
+
+namespace tatum {
+
+/**
+ * A parallel graph walker which incrementally updates the timing graph
+ * based on invalidated edges, like SerialIncrWalker, but processes the
+ * nodes queued within each level in parallel using Thread Building
+ * Blocks (TBB). If TBB is not available it operates serially and is
+ * equivalent to the SerialIncrWalker.
+ *
+ * Since a node's fanout (fanin) is always at a later (earlier) level, the
+ * nodes of a level can be processed independently during the arrival
+ * (required) traversal: they only read the tags of already processed levels,
+ * and only enqueue nodes of levels which are still to be processed. The
+ * per-level queues and the enqueued/invalidated/modified flags are therefore
+ * thread safe (concurrent vectors and atomic flags) so nodes can be enqueued
+ * concurrently.
+ *
+ * Like SerialIncrWalker this walker performs edge invalidation (see
+ * TATUM_INCR_BLOCK_INVALIDATION), and assumes the timing constraints
+ * don't change.
+ */
+class ParallelIncrWalker : public TimingGraphWalker {
+    protected:
+        void invalidate_edge_impl(const EdgeId edge) override {
+            //The walker does not know the size of the timing graph until the next
+            //traversal, so externally invalidated edges are only recorded here (which
+            //is thread safe), and de-duplicated by prepare_incr_update()
+            external_invalidated_edges_.push_back(edge);
+        }
+
+        void clear_invalidated_edges_impl() override {
+            external_invalidated_edges_.clear();
+
+            for (EdgeId edge : invalidated_edges_) {
+                edge_invalidated_.reset(size_t(edge));
+            }
+            invalidated_edges_.clear();
+        }
+
+        node_range modified_nodes_impl() const override {
+            return tatum::util::make_range(nodes_modified_.cbegin(), nodes_modified_.cend());
+        }
+
+        void do_arrival_pre_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, GraphVisitor& visitor) override {
+            num_unconstrained_startpoints_ = 0;
+
+            LevelId first_level = *tg.levels().begin();
+            auto nodes = tg.level_nodes(first_level);
+#if defined(TATUM_USE_TBB)
+            tbb::combinable<size_t> unconstrained_counter(zero);
+
+            tbb::parallel_for_each(nodes.begin(), nodes.end(), [&](auto node) {
+                bool constrained = visitor.do_arrival_pre_traverse_node(tg, tc, node);
+
+                if(!constrained) {
+                    unconstrained_counter.local() += 1;
+                }
+            });
+
+            num_unconstrained_startpoints_ = unconstrained_counter.combine(std::plus<size_t>());
+#else //Serial
+            for(auto iter = nodes.begin(); iter != nodes.end(); ++iter) {
+                bool constrained = visitor.do_arrival_pre_traverse_node(tg, tc, *iter);
+
+                if(!constrained) {
+                    num_unconstrained_startpoints_ += 1;
+                }
+            }
+#endif
+        }
+
+        void do_required_pre_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, GraphVisitor& visitor) override {
+            num_unconstrained_endpoints_ = 0;
+            const auto& po = tg.logical_outputs();
+#if defined(TATUM_USE_TBB)
+            tbb::combinable<size_t> unconstrained_counter(zero);
+
+            tbb::parallel_for_each(po.begin(), po.end(), [&](auto node) {
+                bool constrained = visitor.do_required_pre_traverse_node(tg, tc, node);
+
+                if(!constrained) {
+                    unconstrained_counter.local() += 1;
+                }
+            });
+
+            num_unconstrained_endpoints_ = unconstrained_counter.combine(std::plus<size_t>());
+#else //Serial
+            for(auto iter = po.begin(); iter != po.end(); ++iter) {
+                bool constrained = visitor.do_required_pre_traverse_node(tg, tc, *iter);
+
+                if(!constrained) {
+                    num_unconstrained_endpoints_ += 1;
+                }
+            }
+#endif
+        }
+
+        void do_arrival_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            prepare_incr_update(tg);
+
+            //Nodes are only enqueued at later levels, so max_level may grow while traversing
+            for(int level_idx = incr_arr_update_.min_level; level_idx <= incr_arr_update_.max_level; ++level_idx) {
+                auto& level_nodes = incr_arr_update_.nodes_to_process[level_idx];
+
+                //Sorting the level nodes tends to help memory locality, since the
+                //timing graph is laid out in traversal order
+                std::sort(level_nodes.begin(), level_nodes.end());
+
+                auto process_node = [&](NodeId node) {
+                    invalidate_node_for_arrival_traversal(node, tg, visitor);
+
+                    bool node_updated = visitor.do_arrival_traverse_node(tg, tc, dc, node);
+
+                    if (node_updated) {
+                        //Record that this node was updated, for later efficient slack update
+                        enqueue_modified_node(node);
+
+                        //Queue this node's downstream dependencies for updating
+                        for (EdgeId edge : tg.node_out_edges(node)) {
+                            NodeId snk_node = tg.edge_sink_node(edge);
+                            enqueue_arr_node(tg, snk_node, edge);
+                        }
+                    }
+                };
+#if defined(TATUM_USE_TBB)
+                tbb::parallel_for_each(level_nodes.begin(), level_nodes.end(), process_node);
+#else //Serial
+                for (NodeId node : level_nodes) {
+                    process_node(node);
+                }
+#endif
+            }
+        }
+
+        void do_required_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            //Nodes are only enqueued at earlier levels, so min_level may shrink while traversing
+            for(int level_idx = incr_req_update_.max_level; level_idx >= incr_req_update_.min_level; --level_idx) {
+                auto& level_nodes = incr_req_update_.nodes_to_process[level_idx];
+
+                //Sorting the level nodes tends to help memory locality, since the
+                //timing graph is laid out in traversal order
+                std::sort(level_nodes.begin(), level_nodes.end());
+
+                auto process_node = [&](NodeId node) {
+                    invalidate_node_for_required_traversal(node, tg, visitor);
+                    bool node_updated = visitor.do_required_traverse_node(tg, tc, dc, node);
+
+                    if (node_updated) {
+                        //Record that this node was updated, for later efficient slack update
+                        enqueue_modified_node(node);
+
+                        //Queue this node's upstream dependencies for updating
+                        for (EdgeId edge : tg.node_in_edges(node)) {
+                            NodeId src_node = tg.edge_src_node(edge);
+
+                            enqueue_req_node(tg, src_node, edge);
+                        }
+                    }
+                };
+#if defined(TATUM_USE_TBB)
+                tbb::parallel_for_each(level_nodes.begin(), level_nodes.end(), process_node);
+#else //Serial
+                for (NodeId node : level_nodes) {
+                    process_node(node);
+                }
+#endif
+            }
+        }
+
+        void do_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            //Expose the modified nodes as a sorted std::vector (see modified_nodes_impl())
+            nodes_modified_.assign(concurrent_nodes_modified_.begin(), concurrent_nodes_modified_.end());
+            std::sort(nodes_modified_.begin(), nodes_modified_.end());
+
+            auto process_node = [&](NodeId node) {
+#ifdef TATUM_CALCULATE_EDGE_SLACKS
+                for (EdgeId edge : tg.node_in_edges(node)) {
+                    visitor.do_reset_edge(edge);
+                }
+#endif
+                visitor.do_reset_node_slack_tags(node);
+
+                visitor.do_slack_traverse_node(tg, dc, node);
+            };
+#if defined(TATUM_USE_TBB)
+            tbb::parallel_for_each(nodes_modified_.begin(), nodes_modified_.end(), process_node);
+#else //Serial
+            for (NodeId node : nodes_modified_) {
+                process_node(node);
+            }
+#endif
+        }
+
+        void do_reset_impl(const TimingGraph& tg, GraphVisitor& visitor) override {
+            auto nodes = tg.nodes();
+#if defined(TATUM_USE_TBB)
+            tbb::parallel_for_each(nodes.begin(), nodes.end(), [&](auto node) {
+                visitor.do_reset_node(node);
+            });
+#   ifdef TATUM_CALCULATE_EDGE_SLACKS
+            auto edges = tg.edges();
+            tbb::parallel_for_each(edges.begin(), edges.end(), [&](auto edge) {
+                visitor.do_reset_edge(edge);
+            });
+#   endif
+#else //Serial
+            for(auto node_iter = nodes.begin(); node_iter != nodes.end(); ++node_iter) {
+                visitor.do_reset_node(*node_iter);
+            }
+#   ifdef TATUM_CALCULATE_EDGE_SLACKS
+            auto edges = tg.edges();
+            for(auto edge_iter = edges.begin(); edge_iter != edges.end(); ++edge_iter) {
+                visitor.do_reset_edge(*edge_iter);
+            }
+#   endif
+#endif
+        }
+
+        size_t num_unconstrained_startpoints_impl() const override { return num_unconstrained_startpoints_; }
+        size_t num_unconstrained_endpoints_impl() const override { return num_unconstrained_endpoints_; }
+    private:
+#if defined(TATUM_USE_TBB)
+        template<class T>
+        using concurrent_vector = tbb::concurrent_vector<T>;
+
+        //Function to initialize tbb:combinable<size_t> to zero (see ParallelLevelizedWalker)
+        static size_t zero() { return 0; }
+#else
+        template<class T>
+        using concurrent_vector = std::vector<T>;
+#endif
+
+        /*
+         * A fixed size set of flags, which can be set and tested concurrently
+         */
+        class AtomicFlags {
+            public:
+                //Resizes to num_flags, all unset (only if the size changed)
+                void resize(size_t num_flags) {
+                    if (flags_.size() != num_flags) {
+                        std::vector<std::atomic<bool>>(num_flags).swap(flags_);
+                    }
+                }
+
+                bool test(size_t i) const {
+                    return flags_[i].load(std::memory_order_relaxed);
+                }
+
+                //Sets flag i, and returns true if it was not set before
+                bool set(size_t i) {
+                    return !flags_[i].exchange(true, std::memory_order_relaxed);
+                }
+
+                void reset(size_t i) {
+                    flags_[i].store(false, std::memory_order_relaxed);
+                }
+
+            private:
+                std::vector<std::atomic<bool>> flags_;
+        };
+
+        static void atomic_min(std::atomic<int>& value, int new_value) {
+            int old_value = value.load(std::memory_order_relaxed);
+            while (new_value < old_value && !value.compare_exchange_weak(old_value, new_value, std::memory_order_relaxed)) {
+            }
+        }
+
+        static void atomic_max(std::atomic<int>& value, int new_value) {
+            int old_value = value.load(std::memory_order_relaxed);
+            while (new_value > old_value && !value.compare_exchange_weak(old_value, new_value, std::memory_order_relaxed)) {
+            }
+        }
+
+        bool not_invalidated(EdgeId edge) const {
+            return !edge_invalidated_.test(size_t(edge));
+        }
+
+        //Marks edge as invalidated for the current update. Thread safe
+        void mark_invalidated(EdgeId edge) {
+            if (edge_invalidated_.set(size_t(edge))) {
+                invalidated_edges_.push_back(edge);
+            }
+        }
+
+        void clear_modified() {
+            for (NodeId node : concurrent_nodes_modified_) {
+                node_is_modified_.reset(size_t(node));
+            }
+            concurrent_nodes_modified_.clear();
+            nodes_modified_.clear();
+        }
+
+        void prepare_incr_update(const TimingGraph& tg) {
+            //Size the flags for the timing graph (the first time, since it does not change size)
+            edge_invalidated_.resize(tg.edges().size());
+            node_is_modified_.resize(tg.nodes().size());
+
+            //Reset incremental traversal tracking data
+            clear_modified();
+            incr_arr_update_.clear(tg);
+            incr_req_update_.clear(tg);
+
+            //Process the externally invalidated edges to prepare for the incremental traversal
+            auto process_edge = [&](EdgeId edge) {
+                NodeId snk_node = tg.edge_sink_node(edge);
+                enqueue_arr_node(tg, snk_node, edge);
+
+                NodeId src_node = tg.edge_src_node(edge);
+                enqueue_req_node(tg, src_node, edge);
+            };
+#if defined(TATUM_USE_TBB)
+            tbb::parallel_for_each(external_invalidated_edges_.begin(), external_invalidated_edges_.end(), process_edge);
+#else //Serial
+            for (EdgeId edge : external_invalidated_edges_) {
+                process_edge(edge);
+            }
+#endif
+        }
+
+        //Enqueues a node for arrival time processing which was invalidated by invalidated_edge. Thread safe
+        void enqueue_arr_node(const TimingGraph& tg, NodeId node, EdgeId invalidated_edge) {
+            mark_invalidated(invalidated_edge);
+            incr_arr_update_.enqueue_node(tg, node);
+        }
+
+        //Enqueues a node for required time processing which was invalidated by invalidated_edge. Thread safe
+        void enqueue_req_node(const TimingGraph& tg, NodeId node, EdgeId invalidated_edge) {
+            mark_invalidated(invalidated_edge);
+            incr_req_update_.enqueue_node(tg, node);
+        }
+
+        //Record the specified node as having been modified. Thread safe
+        void enqueue_modified_node(const NodeId node) {
+            if (node_is_modified_.set(size_t(node))) {
+                concurrent_nodes_modified_.push_back(node);
+            }
+        }
+
+        void invalidate_node_for_arrival_traversal(const NodeId node, const TimingGraph& tg, GraphVisitor& visitor) {
+            //Edge invalidation (see SerialIncrWalker::invalidate_node_for_arrival_traversal())
+            for (EdgeId edge : tg.node_in_edges(node)) {
+                if (not_invalidated(edge)) continue;
+
+                NodeId src_node = tg.edge_src_node(edge);
+                visitor.do_reset_node_arrival_tags_from_origin(node, /*origin=*/src_node);
+
+                EdgeType edge_type = tg.edge_type(edge);
+                if (edge_type == EdgeType::PRIMITIVE_CLOCK_CAPTURE) {
+                    //The data required times of the sink are marked from the clock capture time
+                    //during the arrival traversal, so they are reset and the sink's predecessors
+                    //are explicitly queued for the required traversal
+                    visitor.do_reset_node_required_tags(node);
+
+                    for (EdgeId sink_in_edge : tg.node_in_edges(node)) {
+                        NodeId sink_src_node = tg.edge_src_node(sink_in_edge);
+                        enqueue_req_node(tg, sink_src_node, sink_in_edge);
+                    }
+                } else if (edge_type == EdgeType::PRIMITIVE_CLOCK_LAUNCH) {
+                    //On propagating to a SOURCE node, CLOCK_LAUNCH becomes DATA_ARRIVAL
+                    visitor.do_reset_node_arrival_tags(node);
+                }
+            }
+        }
+
+        void invalidate_node_for_required_traversal(const NodeId node, const TimingGraph& tg, GraphVisitor& visitor) {
+            //Edge invalidation
+            for (EdgeId edge : tg.node_out_edges(node)) {
+                if (not_invalidated(edge)) continue;
+
+                NodeId snk_node = tg.edge_sink_node(edge);
+                visitor.do_reset_node_required_tags_from_origin(node, /*origin=*/snk_node);
+            }
+        }
+
+        /*
+         * Helper struct to record incremental traversal information, which
+         * nodes may be concurrently enqueued to
+         */
+        struct t_incr_traversal_update {
+            public:
+
+                //The nodes per-level which need to be updated/processed
+                std::vector<concurrent_vector<NodeId>> nodes_to_process;
+
+                //The range of levels which need to be updated
+                std::atomic<int> min_level{0};
+                std::atomic<int> max_level{0};
+
+                //Thread safe
+                void enqueue_node(const TimingGraph& tg, NodeId node) {
+                    if (!node_is_enqueued.set(size_t(node))) return;
+
+                    int level = size_t(tg.node_level(node));
+
+                    nodes_to_process[level].push_back(node);
+                    atomic_min(min_level, level);
+                    atomic_max(max_level, level);
+                }
+
+                void clear(const TimingGraph& tg) {
+                    if (nodes_to_process.size() != tg.levels().size()) {
+                        nodes_to_process.clear();
+                        nodes_to_process.resize(tg.levels().size());
+                    } else {
+                        //Only the levels in the previous range have queued nodes
+                        for (int level = min_level; level <= max_level; ++level) {
+                            for (NodeId node : nodes_to_process[level]) {
+                                node_is_enqueued.reset(size_t(node));
+                            }
+                            nodes_to_process[level].clear();
+                        }
+                    }
+                    node_is_enqueued.resize(tg.nodes().size());
+
+                    min_level = size_t(*(tg.levels().end() - 1));
+                    max_level = size_t(*tg.levels().begin());
+                }
+
+            private:
+                //Bitset to record whether a node has already been enqueued
+                AtomicFlags node_is_enqueued;
+        };
+
+        //State info about the incremental arr/req updates
+        t_incr_traversal_update incr_arr_update_;
+        t_incr_traversal_update incr_req_update_;
+
+        //Edges invalidated by invalidate_edge() since the last update (may contain duplicates)
+        concurrent_vector<EdgeId> external_invalidated_edges_;
+
+        //Edges invalidated during the current update, and bitset for membership
+        concurrent_vector<EdgeId> invalidated_edges_;
+        AtomicFlags edge_invalidated_;
+
+        //Nodes which have been modified during timing update, and bitset for membership.
+        //They are copied to nodes_modified_ for modified_nodes_impl()
+        concurrent_vector<NodeId> concurrent_nodes_modified_;
+        AtomicFlags node_is_modified_;
+        std::vector<NodeId> nodes_modified_;
+
+        size_t num_unconstrained_startpoints_ = 0;
+        size_t num_unconstrained_endpoints_ = 0;
+};
+
+} //namepsace
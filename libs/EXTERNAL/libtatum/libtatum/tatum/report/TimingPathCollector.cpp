@@ -4,6 +4,11 @@
 #include "tatum/report/TimingReportTagRetriever.hpp"
 #include "tatum/report/timing_path_tracing.hpp"
 #include <map>
+#include <queue>
+
+#ifdef TATUM_USE_TBB
+# include <tbb/parallel_for.h>
+#endif
 
 namespace tatum {
 
@@ -24,35 +29,54 @@ std::vector<TimingPath> collect_worst_timing_paths(const TimingGraph& timing_gra
 
     };
 
-    std::vector<TagNode> tags_and_sinks;
+    //Sort in ascending slack order so most negative slacks are first.
+    //Ties are broken by node and clock domains so the reported paths are deterministic.
+    auto ascending_slack_order = [](const TagNode& lhs, const TagNode& rhs) {
+        if (lhs.tag.time() < rhs.tag.time()) return true;
+        if (rhs.tag.time() < lhs.tag.time()) return false;
+        if (lhs.node != rhs.node) return lhs.node < rhs.node;
+        if (lhs.tag.launch_clock_domain() != rhs.tag.launch_clock_domain()) return lhs.tag.launch_clock_domain() < rhs.tag.launch_clock_domain();
+        return lhs.tag.capture_clock_domain() < rhs.tag.capture_clock_domain();
+    };
 
-    //Add the slacks of all sink
+    //Find the npaths worst slacks of all sinks, keeping only the best of them at the top
+    //of a bounded heap (rather than sorting the slacks of all sinks, which may be many more)
+    std::priority_queue<TagNode, std::vector<TagNode>, decltype(ascending_slack_order)> worst_tags(ascending_slack_order);
     for(NodeId node : timing_graph.logical_outputs()) {
         for(TimingTag tag : tag_retriever.slacks(node)) {
-            tags_and_sinks.emplace_back(tag,node);
+            TagNode tag_node(tag, node);
+            if (worst_tags.size() < npaths) {
+                worst_tags.push(tag_node);
+            } else if (npaths > 0 && ascending_slack_order(tag_node, worst_tags.top())) {
+                worst_tags.pop();
+                worst_tags.push(tag_node);
+            }
         }
     }
 
-    //Sort in ascending slack order so most negative slacks are first
-    auto ascending_slack_order = [](const TagNode& lhs, const TagNode& rhs) {
-        return lhs.tag.time() < rhs.tag.time();
-    };
-    std::sort(tags_and_sinks.begin(), tags_and_sinks.end(), ascending_slack_order);
-
-
-    //Trace the paths for each tag/node pair
-    // The the map will sort the nodes and tags from worst to best slack (i.e. ascending slack order),
-    // so the first pair is the most critical end-point
-    for(const auto& tag_node : tags_and_sinks) {
-        NodeId sink_node = tag_node.node;
-        TimingTag sink_tag = tag_node.tag;
+    //Pop from best to worst slack, so the most critical end-point is first
+    std::vector<TagNode> tags_and_sinks(worst_tags.size(), TagNode(TimingTag(), NodeId::INVALID()));
+    for (size_t i = tags_and_sinks.size(); i-- > 0; ) {
+        tags_and_sinks[i] = worst_tags.top();
+        worst_tags.pop();
+    }
 
-        TimingPath path = detail::trace_path(timing_graph, tag_retriever, sink_tag.launch_clock_domain(), sink_tag.capture_clock_domain(), sink_node); 
+    //Trace the paths for each tag/node pair (independently, so in parallel if possible)
+    paths.resize(tags_and_sinks.size());
+    auto trace_tag_node_path = [&](size_t i) {
+        NodeId sink_node = tags_and_sinks[i].node;
+        TimingTag sink_tag = tags_and_sinks[i].tag;
 
-        paths.push_back(path);
+        paths[i] = detail::trace_path(timing_graph, tag_retriever, sink_tag.launch_clock_domain(), sink_tag.capture_clock_domain(), sink_node);
+    };
 
-        if(paths.size() >= npaths) break;
+#ifdef TATUM_USE_TBB
+    tbb::parallel_for(size_t(0), tags_and_sinks.size(), trace_tag_node_path);
+#else
+    for (size_t i = 0; i < tags_and_sinks.size(); ++i) {
+        trace_tag_node_path(i);
     }
+#endif
 
     return paths;
 }
@@ -156,10 +180,12 @@ std::vector<SkewPath> collect_worst_skew_paths(const TimingGraph& timing_graph,
             return lhs.clock_skew > rhs.clock_skew;
         }
     };
-    std::sort(paths.begin(), paths.end(), skew_order);
+    //Only the npaths worst skews need to be in order
+    size_t num_worst = std::min(paths.size(), npaths);
+    std::partial_sort(paths.begin(), paths.begin() + num_worst, paths.end(), skew_order);
 
     //TODO: not very efficient, since we generate all paths first and then trim to npaths...
-    paths.resize(std::min(paths.size(), npaths));
+    paths.resize(num_worst);
 
     return paths;
 }
@@ -23,6 +23,14 @@ namespace tatum {
  *
  * Note that to allow efficient iteration of tag ranges (by type) we ensure that tags of the
  * same type are adjacent in the storage vector (i.e. the vector is sorted by type)
+ *
+ * Designs with many clock domains have many tags per node, and merging each of an upstream
+ * node's tags with a linear search is quadratic in the number of tags. The tag range merges
+ * (max()/min() of a tag_range) instead search from the position after the previous match,
+ * since propagated tags usually arrive in the same domain order as the tags they merge with.
+ * This is only done when neither the searched tags nor the merged tag are wildcards in a domain
+ * the other specifies (see domain_validity()), so that the match found is the same as the
+ * linear search's.
  */
 class TimingTags {
     public:
@@ -34,6 +42,9 @@ class TimingTags {
         constexpr static size_t DEFAULT_TAGS_TO_RESERVE = 3;
         constexpr static size_t GROWTH_FACTOR = 2;
 
+        //Merging only a few tags is faster with the plain linear searches
+        constexpr static size_t MAX_TAGS_TO_MERGE_INDIVIDUALLY = 4;
+
     public:
 
         typedef Iterator<TimingTag> iterator;
@@ -59,6 +70,9 @@ class TimingTags {
         size_t size() const;
         bool empty() const { return size() == 0; }
 
+        ///\returns The heap memory used by the tags, in bytes
+        size_t memory_usage() const;
+
         ///\returns A range of all tags
         tag_range tags() const;
 
@@ -97,6 +111,17 @@ class TimingTags {
         ///\remark Finds (or creates) the tag with the same clock domain as base_tag and update the required time if new_time is smaller
         bool min(const Time& new_time, const NodeId origin, const TimingTag& base_tag, bool arr_must_be_valid=false);
 
+        ///Updates the times of this set of tags to be the maximum with each of base_tags, offset by delay.
+        ///\param base_tags The tags to merge (all of one type), typically those of an adjacent node
+        ///\param delay The offset added to the time of each of base_tags
+        ///\param origin The origin node of any updated tag
+        ///\remark Equivalent to calling max() for each of base_tags in order, but faster with many clock domains
+        bool max(tag_range base_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid=false);
+
+        ///Updates the times of this set of tags to be the minimum with each of base_tags, offset by delay.
+        ///\remark Equivalent to calling min() for each of base_tags in order, but faster with many clock domains
+        bool min(tag_range base_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid=false);
+
         ///Clears the tags in the current set
         void clear();
 
@@ -179,6 +204,22 @@ class TimingTags {
         //          corresponding arrival time, or end(TagType::DATA_REQUIRED)
         std::pair<bool,iterator> find_data_required_with_valid_data_arrival(DomainId launch_domain, DomainId capture_domain);
 
+        ///Like find_matching_tag(type, launch_domain, capture_domain), but when range_validity (the validity
+        ///of the tags of type) allows it, only searches the first num_search tags of type starting from the
+        ///position hint. hint is updated to the position after the matching tag
+        iterator find_matching_tag(TagType type, DomainId launch_domain, DomainId capture_domain,
+                                   unsigned char range_validity, size_t num_search, size_t& hint);
+
+        ///Merges each of base_tags, offset by delay, with merge_op(tag, new_time, origin, base_tag)
+        template<class MergeOp>
+        bool merge_tags(tag_range base_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid, MergeOp merge_op);
+
+        ///\returns The DomainValidity flags of the domains of a tag
+        static unsigned char domain_validity(DomainId launch_domain, DomainId capture_domain);
+
+        ///\returns The union of the DomainValidity flags of the tags in range
+        static unsigned char domain_validity(tag_range range);
+
 
         iterator insert(iterator iter, const TimingTag& tag);
         void grow_insert(size_t index, const TimingTag& tag);
@@ -187,6 +228,14 @@ class TimingTags {
 
 
     private:
+        //Flags of which domains of a set of tags are specified (valid) or wildcards (invalid)
+        enum DomainValidity : unsigned char {
+            LAUNCH_VALID = 0x1,
+            LAUNCH_WILDCARD = 0x2,
+            CAPTURE_VALID = 0x4,
+            CAPTURE_WILDCARD = 0x8
+        };
+
         //We don't expect many tags in a node so unsigned short's/unsigned char's
         //should be more than sufficient. This also allows the class
         //to be packed down to 16 bytes (8 for counters, 8 for pointer)
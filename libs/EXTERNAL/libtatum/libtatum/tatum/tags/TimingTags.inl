@@ -228,6 +228,79 @@ inline bool TimingTags::min(const Time& new_time, const NodeId origin, const Tim
     return modified;
 }
 
+inline bool TimingTags::max(tag_range base_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid) {
+    if(base_tags.size() <= MAX_TAGS_TO_MERGE_INDIVIDUALLY) {
+        bool modified = false;
+        for(const TimingTag& base_tag : base_tags) {
+            modified |= max(base_tag.time() + delay, origin, base_tag, arr_must_be_valid);
+        }
+        return modified;
+    }
+    return merge_tags(base_tags, delay, origin, arr_must_be_valid,
+                      [](TimingTag& tag, const Time& new_time, const NodeId new_origin, const TimingTag& base_tag) {
+                          return tag.max(new_time, new_origin, base_tag);
+                      });
+}
+
+inline bool TimingTags::min(tag_range base_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid) {
+    if(base_tags.size() <= MAX_TAGS_TO_MERGE_INDIVIDUALLY) {
+        bool modified = false;
+        for(const TimingTag& base_tag : base_tags) {
+            modified |= min(base_tag.time() + delay, origin, base_tag, arr_must_be_valid);
+        }
+        return modified;
+    }
+    return merge_tags(base_tags, delay, origin, arr_must_be_valid,
+                      [](TimingTag& tag, const Time& new_time, const NodeId new_origin, const TimingTag& base_tag) {
+                          return tag.min(new_time, new_origin, base_tag);
+                      });
+}
+
+template<class MergeOp>
+inline bool TimingTags::merge_tags(tag_range base_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid, MergeOp merge_op) {
+    bool modified = false;
+    if(base_tags.empty()) return modified;
+
+    const TagType type = base_tags.begin()->type();
+    TATUM_ASSERT(!arr_must_be_valid || type == TagType::DATA_REQUIRED);
+
+    //The validity of the tags being merged into, which is conservatively updated as they change
+    unsigned char validity = domain_validity(tags(type));
+    unsigned char arr_validity = arr_must_be_valid ? domain_validity(tags(TagType::DATA_ARRIVAL)) : 0;
+
+    //Without wildcards each domain pair has at most one tag in base_tags, so they never match the
+    //tags added by this merge, and only the tags which existed before it need to be searched
+    const size_t num_search = std::distance(begin(type), end(type));
+    const size_t num_arr_search = std::distance(begin(TagType::DATA_ARRIVAL), end(TagType::DATA_ARRIVAL));
+
+    size_t hint = 0;
+    size_t arr_hint = 0;
+    for(const TimingTag& base_tag : base_tags) {
+        TATUM_ASSERT_SAFE(base_tag.type() == type);
+
+        if(arr_must_be_valid) {
+            //Only merge the required time if there is a valid matching arrival
+            auto arr_iter = find_matching_tag(TagType::DATA_ARRIVAL, base_tag.launch_clock_domain(), DomainId::INVALID(), arr_validity, num_arr_search, arr_hint);
+            if(arr_iter == end(TagType::DATA_ARRIVAL) || !arr_iter->time().valid()) continue;
+        }
+
+        Time new_time = base_tag.time() + delay;
+
+        auto iter = find_matching_tag(type, base_tag.launch_clock_domain(), base_tag.capture_clock_domain(), validity, num_search, hint);
+        if(iter == end(type)) {
+            //First time we've seen this domain
+            modified |= add_tag(TimingTag(new_time, origin, base_tag));
+        } else {
+            modified |= merge_op(*iter, new_time, origin, base_tag);
+        }
+
+        //The added or merged tag now has base_tag's domains (merging may change the domains of a constant generator tag)
+        validity |= domain_validity(base_tag.launch_clock_domain(), base_tag.capture_clock_domain());
+    }
+
+    return modified;
+}
+
 inline void TimingTags::clear() {
     size_ = 0;
     num_clock_launch_tags_ = 0;
@@ -279,8 +352,50 @@ inline std::pair<bool,TimingTags::iterator> TimingTags::find_data_required_with_
     return {true, find_matching_tag(TagType::DATA_REQUIRED, launch_domain, capture_domain)};
 }
 
+inline TimingTags::iterator TimingTags::find_matching_tag(TagType type, DomainId launch_domain, DomainId capture_domain,
+                                                          unsigned char range_validity, size_t num_search, size_t& hint) {
+    unsigned char validity = range_validity | domain_validity(launch_domain, capture_domain);
+    if((validity & (LAUNCH_VALID | LAUNCH_WILDCARD)) == (LAUNCH_VALID | LAUNCH_WILDCARD)
+       || (validity & (CAPTURE_VALID | CAPTURE_WILDCARD)) == (CAPTURE_VALID | CAPTURE_WILDCARD)) {
+        //A wildcard may match a specified domain, so only the first match found by a linear search is correct
+        return find_matching_tag(type, launch_domain, capture_domain);
+    }
+
+    //Without wildcard matches, tags only match if their domains are identical, and each
+    //domain pair has at most one tag, so any match is the one a linear search would find
+    auto b = begin(type);
+    TATUM_ASSERT_SAFE(num_search <= size_t(std::distance(b, end(type))));
+    if(hint >= num_search) hint = 0;
+
+    for(size_t i = 0; i < num_search; ++i) {
+        size_t index = hint + i;
+        if(index >= num_search) index -= num_search;
+
+        auto iter = b + index;
+        if(iter->launch_clock_domain() == launch_domain && iter->capture_clock_domain() == capture_domain) {
+            hint = index + 1;
+            return iter;
+        }
+    }
+    return end(type);
+}
+
+inline unsigned char TimingTags::domain_validity(DomainId launch_domain, DomainId capture_domain) {
+    return (launch_domain ? LAUNCH_VALID : LAUNCH_WILDCARD) | (capture_domain ? CAPTURE_VALID : CAPTURE_WILDCARD);
+}
+
+inline unsigned char TimingTags::domain_validity(tag_range range) {
+    unsigned char validity = 0;
+    for(const TimingTag& tag : range) {
+        validity |= domain_validity(tag.launch_clock_domain(), tag.capture_clock_domain());
+    }
+    return validity;
+}
+
 inline size_t TimingTags::capacity() const { return capacity_; }
 
+inline size_t TimingTags::memory_usage() const { return capacity() * sizeof(TimingTag); }
+
 inline TimingTags::iterator TimingTags::insert(iterator iter, const TimingTag& tag) {
     size_t index = std::distance(begin(), iter);
     TATUM_ASSERT(index <= size());
@@ -31,6 +31,7 @@
 #include "verify.hpp"
 #include "util.hpp"
 #include "profile.hpp"
+#include "sweep.hpp"
 
 #if defined(TATUM_USE_TBB) 
 # include <tbb/task_scheduler_init.h>
@@ -73,6 +74,9 @@ struct Args {
     //Number of parallel runs to perform
     size_t num_parallel_runs = 30;
 
+    //Number of parallel incremental runs to perform
+    size_t num_parallel_incr_runs = 10;
+
     //Use unit delays instead of from file?
     float unit_delay = 0;
 
@@ -95,6 +99,16 @@ struct Args {
     //dumped .dot file (useful for debugging). Values < 0 dump the
     //entire graph.
     int debug_dot_node = -1;
+
+    //Numbers of parallel workers to sweep the graph walkers over
+    //(empty implies no sweep)
+    std::vector<size_t> sweep_workers;
+
+    //Number of runs of each graph walker during the sweep
+    size_t num_sweep_runs = 10;
+
+    //JSON file the sweep results are written to
+    std::string sweep_json = "walker_sweep.json";
 };
 
 void usage(std::string prog);
@@ -153,6 +167,9 @@ void usage(std::string prog) {
     cout << "                                               (default " << default_args.num_serial_incr_runs << ")\n";
     cout << "    --num_parallel NUM_PARALLEL_RUNS:          Number of serial runs to perform.\n";
     cout << "                                               (default " << default_args.num_parallel_runs << ")\n";
+    cout << "    --num_parallel_incr NUM_PARALLEL_INCR_RUNS: Number of parallel incremental runs to perform.\n";
+    cout << "                                               Each is verified against a full serial analysis.\n";
+    cout << "                                               (default " << default_args.num_parallel_incr_runs << ")\n";
     cout << "    --edge_change_prob EDGE_CHANGE_PROB:       Probability of an edge delay changing in a serial incremental run\n";
     cout << "                                               (default " << default_args.edge_change_prob << ")\n";
     cout << "    --unit_delay UNIT_DELAY:                   Use specified unit delay for all edges.\n";
@@ -180,6 +197,13 @@ void usage(std::string prog) {
     cout << "                                               Values >= 0 dump the transitive connections of\n";
     cout << "                                               the matching node.\n";
     cout << "                                               (default " << default_args.debug_dot_node << ")\n";
+    cout << "    --sweep_workers NUM_WORKERS_LIST:          Comma separated numbers of parallel workers (e.g. 1,2,4,8)\n";
+    cout << "                                               to profile the full and incremental graph walkers with.\n";
+    cout << "                                               empty implies no sweep.\n";
+    cout << "    --num_sweep NUM_SWEEP_RUNS:                Number of runs of each graph walker during the sweep.\n";
+    cout << "                                               (default " << default_args.num_sweep_runs << ")\n";
+    cout << "    --sweep_json SWEEP_JSON:                   JSON file the sweep results are written to.\n";
+    cout << "                                               (default " << default_args.sweep_json << ")\n";
 }
 
 void cmd_error(std::string prog, std::string msg) {
@@ -210,6 +234,22 @@ Args parse_args(int argc, char** argv) {
                 args.write_echo = argv[i+1];
             } else if (arg_str == "--analysis_type") {
                 args.analysis_type = argv[i+1];
+            } else if (arg_str == "--sweep_json") {
+                args.sweep_json = argv[i+1];
+            } else if (arg_str == "--sweep_workers") {
+                std::istringstream list_ss(argv[i+1]);
+                std::string count_str;
+                while (std::getline(list_ss, count_str, ',')) {
+                    std::istringstream ss(count_str);
+                    size_t num_workers = 0;
+                    ss >> num_workers;
+                    if (ss.fail() || !ss.eof() || num_workers == 0) {
+                        std::stringstream msg;
+                        msg << "Invalid number of workers '" << count_str << "' in '" << argv[i+1] << "'\n";
+                        cmd_error(prog, msg.str());
+                    }
+                    args.sweep_workers.push_back(num_workers);
+                }
             } else {
 
                 std::istringstream ss(argv[i+1]);
@@ -229,6 +269,8 @@ Args parse_args(int argc, char** argv) {
                     args.num_serial_incr_runs = arg_val;
                 } else if (argv[i] == std::string("--num_parallel")) { 
                     args.num_parallel_runs = arg_val;
+                } else if (argv[i] == std::string("--num_parallel_incr")) {
+                    args.num_parallel_incr_runs = arg_val;
                 } else if (argv[i] == std::string("--edge_change_prob")) { 
                     args.edge_change_prob = arg_val;
                 } else if (argv[i] == std::string("--unit_delay")) { 
@@ -243,6 +285,8 @@ Args parse_args(int argc, char** argv) {
                     args.report = arg_val;
                 } else if (argv[i] == std::string("--debug_dot_node")) { 
                     args.debug_dot_node = arg_val;
+                } else if (argv[i] == std::string("--num_sweep")) {
+                    args.num_sweep_runs = arg_val;
                 } else {
                     std::stringstream msg;
                     msg << "Invalid option '" << arg_str << "'\n";
@@ -734,6 +778,66 @@ int main(int argc, char** argv) {
         cout << endl << "Net Parallel Analysis elapsed time: " << parallel_analyzer->get_profiling_data("total_analysis_sec") << " sec over " << parallel_analyzer->get_profiling_data("num_full_updates") << " full updates" << endl;
     }
 
+    if (args.num_parallel_incr_runs) {
+        std::shared_ptr<tatum::TimingAnalyzer> parallel_incr_analyzer;
+        if (args.analysis_type == "setuphold") {
+            parallel_incr_analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis,tatum::ParallelIncrWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
+        } else if (args.analysis_type == "setup") {
+            parallel_incr_analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis,tatum::ParallelIncrWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
+        } else if (args.analysis_type == "hold") {
+            parallel_incr_analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis,tatum::ParallelIncrWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
+        } else {
+            std::stringstream ss;
+            ss << "Unrecognized analysis type '" << args.analysis_type << "'";
+            cmd_error(argv[0], ss.str());
+        }
+
+        std::map<std::string,std::vector<double>> parallel_incr_prof_data;
+        {
+            cout << "Running ParallelIncr Analysis " << args.num_parallel_incr_runs << " times" << endl;
+
+            //Analyze, after random edge invalidations, and compare the arrival/required
+            //tags and slacks with a full analysis by the SerialWalker of the same delays
+            bool equivalent = profile_incr(args.num_parallel_incr_runs,
+                                           args.edge_change_prob,
+                                           args.verify,
+                                           *timing_graph,
+                                           parallel_incr_analyzer,
+                                           serial_analyzer,
+                                           *delay_calculator,
+                                           parallel_incr_prof_data);
+
+            if(!equivalent) {
+                cout << "Verification failed!\n";
+                exit_code = 1;
+            }
+
+            cout << endl;
+            cout << "ParallelIncr Analysis took " << std::setprecision(6) << std::setw(6) << arithmean_skip_first(parallel_incr_prof_data["analysis_sec"])*args.num_parallel_incr_runs << " sec";
+            if(parallel_incr_prof_data["analysis_sec"].size() > 0) {
+                cout << " AVG: " << arithmean_skip_first(parallel_incr_prof_data["analysis_sec"]);
+                cout << " Median: " << median_skip_first(parallel_incr_prof_data["analysis_sec"]);
+                cout << " Min: " << *std::min_element(parallel_incr_prof_data["analysis_sec"].begin(), parallel_incr_prof_data["analysis_sec"].end());
+                cout << " Max: " << *std::max_element(parallel_incr_prof_data["analysis_sec"].begin(), parallel_incr_prof_data["analysis_sec"].end());
+            }
+            cout << endl;
+
+            cout << "Verifying ParallelIncr Analysis took: " << std::accumulate(parallel_incr_prof_data["verify_sec"].begin(), parallel_incr_prof_data["verify_sec"].end(), 0.) << " sec" << endl;
+        }
+        cout << endl;
+
+        cout << "ParallelIncr Speed-Up: " << std::fixed << median(parallel_incr_prof_data["ref_analysis_sec"]) / median(parallel_incr_prof_data["analysis_sec"]) << "x" << endl;
+        cout << endl;
+    }
+
+    if (!args.sweep_workers.empty() && args.num_sweep_runs) {
+        auto sweep_results = sweep_walkers(*timing_graph, *timing_constraints, *delay_calculator,
+                                           args.analysis_type, args.sweep_workers,
+                                           args.num_sweep_runs, args.edge_change_prob);
+        write_sweep_json(args.sweep_json, *timing_graph, args.analysis_type, args.edge_change_prob, sweep_results);
+        cout << endl;
+    }
+
     //Tag stats
     if(serial_setup_analyzer) {
         print_setup_tags_histogram(*timing_graph, *serial_setup_analyzer);
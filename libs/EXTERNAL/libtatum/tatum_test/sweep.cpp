@@ -0,0 +1,232 @@
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <cmath>
+#include <memory>
+#include "sweep.hpp"
+
+#include "tatum/util/tatum_assert.hpp"
+#include "tatum/timing_analyzers.hpp"
+#include "tatum/graph_walkers.hpp"
+#include "tatum/analyzer_factory.hpp"
+
+#if defined(TATUM_USE_TBB)
+# include <tbb/task_arena.h>
+#endif
+
+namespace {
+
+const std::vector<std::string> PROFILING_KEYS = {"arrival_pre_traversal_sec", "arrival_traversal_sec", "required_pre_traversal_sec", "required_traversal_sec", "reset_sec", "update_slack_sec", "analysis_sec"};
+
+template<class GraphWalker>
+std::shared_ptr<tatum::TimingAnalyzer> make_analyzer(std::string analysis_type,
+                                                     const tatum::TimingGraph& tg,
+                                                     const tatum::TimingConstraints& tc,
+                                                     const tatum::DelayCalculator& dc) {
+    if (analysis_type == "setuphold") {
+        return tatum::AnalyzerFactory<tatum::SetupHoldAnalysis,GraphWalker>::make(tg, tc, dc);
+    } else if (analysis_type == "setup") {
+        return tatum::AnalyzerFactory<tatum::SetupAnalysis,GraphWalker>::make(tg, tc, dc);
+    } else {
+        TATUM_ASSERT_MSG(analysis_type == "hold", "Unrecognized analysis type");
+        return tatum::AnalyzerFactory<tatum::HoldAnalysis,GraphWalker>::make(tg, tc, dc);
+    }
+}
+
+//Randomly perturbs (and invalidates) a fraction edge_change_prob of the edge delays, like profile_incr()
+void change_edge_delays(const tatum::TimingGraph& tg,
+                        float edge_change_prob,
+                        std::minstd_rand& rng,
+                        tatum::FixedDelayCalculator& delay_calc,
+                        tatum::TimingAnalyzer& analyzer) {
+    std::uniform_int_distribution<size_t> uniform_distr(0, tg.edges().size() - 1);
+    std::normal_distribution<float> normal_distr(0, 1e-9);
+
+    size_t num_edges = edge_change_prob * tg.edges().size();
+    for (size_t i = 0; i < num_edges; i++) {
+        tatum::EdgeId edge(uniform_distr(rng));
+        analyzer.invalidate_edge(edge);
+
+        if (tg.edge_type(edge) == tatum::EdgeType::PRIMITIVE_CLOCK_CAPTURE) {
+            float new_setup = std::max<float>(0, delay_calc.setup_time(tg, edge).value() + normal_distr(rng));
+            float new_hold = std::max<float>(0, delay_calc.hold_time(tg, edge).value() + normal_distr(rng));
+            delay_calc.set_setup_time(tg, edge, tatum::Time(new_setup));
+            delay_calc.set_hold_time(tg, edge, tatum::Time(new_hold));
+        } else {
+            float new_max = std::max<float>(0, delay_calc.max_edge_delay(tg, edge).value() + normal_distr(rng));
+            float new_min = std::max<float>(0, delay_calc.min_edge_delay(tg, edge).value() + normal_distr(rng));
+            delay_calc.set_max_edge_delay(tg, edge, tatum::Time(new_max));
+            delay_calc.set_min_edge_delay(tg, edge, tatum::Time(new_min));
+        }
+    }
+}
+
+template<class GraphWalker>
+std::map<std::string,std::vector<double>> profile_walker(const tatum::TimingGraph& tg,
+                                                         const tatum::TimingConstraints& tc,
+                                                         const tatum::FixedDelayCalculator& delay_calc,
+                                                         std::string analysis_type,
+                                                         bool incremental,
+                                                         size_t num_runs,
+                                                         float edge_change_prob) {
+    //Each walker gets its own copy of the delays, which it perturbs identically
+    tatum::FixedDelayCalculator walker_delay_calc = delay_calc;
+    std::minstd_rand rng;
+
+    auto analyzer = make_analyzer<GraphWalker>(analysis_type, tg, tc, walker_delay_calc);
+    if (incremental) {
+        analyzer->update_timing(); //Initial full update
+    }
+
+    std::map<std::string,std::vector<double>> prof_data;
+    for (size_t i = 0; i < num_runs; i++) {
+        if (incremental) {
+            change_edge_delays(tg, edge_change_prob, rng, walker_delay_calc, *analyzer);
+        }
+
+        analyzer->update_timing();
+
+        for (const auto& key : PROFILING_KEYS) {
+            prof_data[key].push_back(analyzer->get_profiling_data(key));
+        }
+    }
+    return prof_data;
+}
+
+template<class GraphWalker>
+SweepResult run_sweep_point(std::string walker,
+                            bool incremental,
+                            size_t num_workers,
+                            const tatum::TimingGraph& tg,
+                            const tatum::TimingConstraints& tc,
+                            const tatum::FixedDelayCalculator& delay_calc,
+                            std::string analysis_type,
+                            size_t num_runs,
+                            float edge_change_prob) {
+    SweepResult result;
+    result.walker = walker;
+    result.incremental = incremental;
+    result.num_workers = num_workers;
+
+#if defined(TATUM_USE_TBB)
+    tbb::task_arena arena(num_workers);
+    arena.execute([&] {
+        result.prof_data = profile_walker<GraphWalker>(tg, tc, delay_calc, analysis_type, incremental, num_runs, edge_change_prob);
+    });
+#else
+    result.prof_data = profile_walker<GraphWalker>(tg, tc, delay_calc, analysis_type, incremental, num_runs, edge_change_prob);
+#endif
+
+    auto& analysis_sec = result.prof_data["analysis_sec"];
+    std::cout << "  " << walker << " with " << num_workers << " worker(s): ";
+    std::cout << std::accumulate(analysis_sec.begin(), analysis_sec.end(), 0.) / analysis_sec.size() << " sec per update\n";
+
+    return result;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    if (values.size() % 2 == 0) {
+        return (values[values.size() / 2 - 1] + values[values.size() / 2]) / 2;
+    } else {
+        return values[values.size() / 2];
+    }
+}
+
+//Quantities a walker doesn't measure are NaN, which JSON has no literal for
+void write_json_number(std::ostream& os, double value) {
+    if (std::isfinite(value)) {
+        os << value;
+    } else {
+        os << "null";
+    }
+}
+
+void write_json_stats(std::ostream& os, const std::vector<double>& values) {
+    os << "{\"median\": ";
+    write_json_number(os, median(values));
+    os << ", \"mean\": ";
+    write_json_number(os, std::accumulate(values.begin(), values.end(), 0.) / values.size());
+    os << ", \"min\": ";
+    write_json_number(os, *std::min_element(values.begin(), values.end()));
+    os << ", \"max\": ";
+    write_json_number(os, *std::max_element(values.begin(), values.end()));
+    os << "}";
+}
+
+} //namespace
+
+std::vector<SweepResult> sweep_walkers(const tatum::TimingGraph& tg,
+                                       const tatum::TimingConstraints& tc,
+                                       const tatum::FixedDelayCalculator& delay_calc,
+                                       std::string analysis_type,
+                                       const std::vector<size_t>& worker_counts,
+                                       size_t num_runs,
+                                       float edge_change_prob) {
+    TATUM_ASSERT(num_runs > 0);
+
+    std::cout << "Sweeping graph walkers (" << num_runs << " runs each)\n";
+
+    std::vector<SweepResult> results;
+    results.push_back(run_sweep_point<tatum::SerialWalker>("serial", false, 1, tg, tc, delay_calc, analysis_type, num_runs, edge_change_prob));
+    results.push_back(run_sweep_point<tatum::SerialIncrWalker>("serial_incr", true, 1, tg, tc, delay_calc, analysis_type, num_runs, edge_change_prob));
+
+#if defined(TATUM_USE_TBB)
+    for (size_t num_workers : worker_counts) {
+        results.push_back(run_sweep_point<tatum::ParallelWalker>("parallel", false, num_workers, tg, tc, delay_calc, analysis_type, num_runs, edge_change_prob));
+        results.push_back(run_sweep_point<tatum::ParallelIncrWalker>("parallel_incr", true, num_workers, tg, tc, delay_calc, analysis_type, num_runs, edge_change_prob));
+    }
+#else
+    if (!worker_counts.empty()) {
+        std::cout << "Tatum built with only serial execution support, skipping the parallel walkers\n";
+    }
+#endif
+
+    return results;
+}
+
+void write_sweep_json(std::string filename,
+                      const tatum::TimingGraph& tg,
+                      std::string analysis_type,
+                      float edge_change_prob,
+                      const std::vector<SweepResult>& results) {
+    std::ofstream os(filename);
+
+    //Speed-ups are relative to the (first) full serial walker
+    double serial_median = 0.;
+    for (const auto& result : results) {
+        if (result.walker == "serial") {
+            serial_median = median(result.prof_data.at("analysis_sec"));
+            break;
+        }
+    }
+
+    os << "{\n";
+    os << "  \"timing_graph\": {\"nodes\": " << tg.nodes().size() << ", \"edges\": " << tg.edges().size() << ", \"levels\": " << tg.levels().size() << "},\n";
+    os << "  \"analysis_type\": \"" << analysis_type << "\",\n";
+    os << "  \"edge_change_prob\": " << edge_change_prob << ",\n";
+    os << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const SweepResult& result = results[i];
+        os << ((i == 0) ? "\n" : ",\n");
+        os << "    {\"walker\": \"" << result.walker << "\"";
+        os << ", \"incremental\": " << (result.incremental ? "true" : "false");
+        os << ", \"num_workers\": " << result.num_workers;
+        os << ", \"runs\": " << result.prof_data.at("analysis_sec").size();
+
+        double result_median = median(result.prof_data.at("analysis_sec"));
+        os << ", \"speed_up\": ";
+        write_json_number(os, serial_median / result_median);
+        for (const auto& kv : result.prof_data) {
+            os << ",\n     \"" << kv.first << "\": ";
+            write_json_stats(os, kv.second);
+        }
+        os << "}";
+    }
+    os << "\n  ]\n";
+    os << "}\n";
+
+    std::cout << "Wrote walker sweep results to " << filename << "\n";
+}
@@ -0,0 +1,42 @@
+#ifndef TATUM_SWEEP
+#define TATUM_SWEEP
+#include <map>
+#include <string>
+#include <vector>
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/TimingConstraints.hpp"
+#include "tatum/delay_calc/FixedDelayCalculator.hpp"
+
+//The profiling results of one graph walker at one number of workers
+struct SweepResult {
+    std::string walker;
+    bool incremental = false;
+    size_t num_workers = 1;
+    std::map<std::string,std::vector<double>> prof_data;
+};
+
+//Profiles the full and incremental, serial and parallel walkers of analysis_type
+//('setuphold', 'setup' or 'hold') num_runs times each. The parallel walkers are
+//profiled once for every entry of worker_counts.
+//
+//The incremental walkers start from a full update (not included in the results), then a
+//fraction edge_change_prob of the edge delays is changed before each run. The delay changes
+//are made to a copy of delay_calc, in the same order for every walker.
+std::vector<SweepResult> sweep_walkers(const tatum::TimingGraph& tg,
+                                       const tatum::TimingConstraints& tc,
+                                       const tatum::FixedDelayCalculator& delay_calc,
+                                       std::string analysis_type,
+                                       const std::vector<size_t>& worker_counts,
+                                       size_t num_runs,
+                                       float edge_change_prob);
+
+//Writes the results of sweep_walkers() as JSON: the median/mean/min/max of each profiled
+//quantity per walker and number of workers, and its speed-up over the full serial walker
+void write_sweep_json(std::string filename,
+                      const tatum::TimingGraph& tg,
+                      std::string analysis_type,
+                      float edge_change_prob,
+                      const std::vector<SweepResult>& results);
+
+#endif
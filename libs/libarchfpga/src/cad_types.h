@@ -127,6 +127,7 @@ struct t_cluster_placement_primitive {
     bool valid;
     float base_cost;        /* cost independent of current status of packing */
     float incremental_cost; /* cost dependant on current status of packing */
+    int pb_type_index = -1; /* index of its pb_type in the primitive pb_types of its cluster placement stats */
 };
 
 #endif
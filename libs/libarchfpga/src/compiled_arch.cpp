@@ -0,0 +1,1391 @@
+#include "compiled_arch.h"
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "vtr_assert.h"
+#include "vtr_digest.h"
+#include "vtr_flat_blob.h"
+#include "vtr_log.h"
+#include "vtr_memory.h"
+#include "vtr_util.h"
+#include "vtr_version.h"
+
+#include "arch_error.h"
+#include "arch_util.h"
+
+/*
+ * A compiled architecture is a flat blob with three sections:
+ *  0. A t_compiled_arch_header
+ *  1. The VTR version and the digest of the source XML (each nul terminated)
+ *  2. The payload: a byte stream of the architecture data
+ *
+ * The payload is written and read by the same io() functions, with an archive (a
+ * CompiledArchWriter or CompiledArchReader) which either appends each value to the
+ * stream or reads it back. Keeping a single function per type keeps the reader and the
+ * writer in sync: each field is listed once, in the order it is stored.
+ *
+ * Pointers between the architecture structures are stored as indices:
+ *  - Physical and logical types by their index in PhysicalTileTypes/LogicalBlockTypes
+ *  - The parents of pb_types, modes, interconnects and ports are implied by the pb_type tree
+ *  - The grid location metadata by the index of the location owning it
+ *
+ * The models of the pb_types (and the pb_types of the models) are not stored, but
+ * re-linked by SyncModelsPbTypes() once loaded, as done by XmlReadArch(). The model
+ * library is likewise re-created by CreateModelLibrary().
+ *
+ * Heap allocated structures are allocated the same way as by XmlReadArch() (new or
+ * vtr::calloc/malloc/strdup), so that they are freed by free_arch() and
+ * free_type_descriptors().
+ *
+ * Changes to the architecture structures must be reflected in the io() functions, and
+ * COMPILED_ARCH_VERSION incremented.
+ */
+
+namespace {
+
+constexpr uint64_t COMPILED_ARCH_MAGIC = 0x4843524150525456; //"VTRPARCH"
+constexpr uint64_t COMPILED_ARCH_VERSION = 1;
+
+constexpr size_t HEADER_SECTION = 0;
+constexpr size_t SOURCE_SECTION = 1;
+constexpr size_t PAYLOAD_SECTION = 2;
+
+struct t_compiled_arch_header {
+    uint64_t magic = COMPILED_ARCH_MAGIC;
+    uint64_t version = COMPILED_ARCH_VERSION;
+    uint64_t timing_enabled = 0; ///<Whether the architecture was read with timing analysis enabled
+    uint64_t power = 0;          ///<Whether the architecture was read with power estimation (t_arch::power and clocks) enabled
+};
+
+///@brief Appends the architecture data to a byte stream
+class CompiledArchWriter {
+  public:
+    static constexpr bool reading = false;
+
+    CompiledArchWriter(const t_arch& arch,
+                       const std::vector<t_physical_tile_type>& physical_types,
+                       const std::vector<t_logical_block_type>& logical_types)
+        : arch_(arch)
+        , physical_types_(physical_types)
+        , logical_types_(logical_types) {}
+
+    template<typename T>
+    void pod(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be stored directly");
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        data_.insert(data_.end(), bytes, bytes + sizeof(T));
+    }
+
+    size_t count(size_t num) {
+        uint64_t stored = num;
+        pod(stored);
+        return num;
+    }
+
+    bool flag(bool value) {
+        pod(value);
+        return value;
+    }
+
+    void str(std::string& value) {
+        count(value.size());
+        data_.insert(data_.end(), value.begin(), value.end());
+    }
+
+    void cstr(char*& value) {
+        if (flag(value != nullptr)) {
+            std::string copy(value);
+            str(copy);
+        }
+    }
+
+    void interned(vtr::interned_string value) {
+        std::string copy = value.get(&arch_.strings);
+        str(copy);
+    }
+
+    ///@brief Stores ptr as its index in pool (-1 for nullptr)
+    template<typename T>
+    void index(const T*& ptr, const std::vector<T>& pool) {
+        int64_t idx = -1;
+        if (ptr != nullptr) {
+            idx = ptr - pool.data();
+            VTR_ASSERT(idx >= 0 && size_t(idx) < pool.size());
+        }
+        pod(idx);
+    }
+
+    const std::vector<t_physical_tile_type>& physical_types() const { return physical_types_; }
+    const std::vector<t_logical_block_type>& logical_types() const { return logical_types_; }
+
+    const std::vector<char>& data() const { return data_; }
+
+  private:
+    const t_arch& arch_;
+    const std::vector<t_physical_tile_type>& physical_types_;
+    const std::vector<t_logical_block_type>& logical_types_;
+    std::vector<char> data_;
+};
+
+///@brief Reads the architecture data back from a byte stream, throwing ArchFpgaError if it is truncated or inconsistent
+class CompiledArchReader {
+  public:
+    static constexpr bool reading = true;
+
+    CompiledArchReader(const char* file,
+                       vtr::array_view<const char> data,
+                       t_arch& arch,
+                       const std::vector<t_physical_tile_type>& physical_types,
+                       const std::vector<t_logical_block_type>& logical_types)
+        : file_(file)
+        , data_(data)
+        , arch_(arch)
+        , physical_types_(physical_types)
+        , logical_types_(logical_types) {}
+
+    template<typename T>
+    void pod(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be stored directly");
+        require(sizeof(T));
+        std::memcpy(reinterpret_cast<char*>(&value), data_.data() + pos_, sizeof(T));
+        pos_ += sizeof(T);
+    }
+
+    size_t count(size_t /*num*/) {
+        uint64_t stored = 0;
+        pod(stored);
+        //Every stored element takes at least one byte, so this also catches absurd sizes before they are allocated
+        require(stored);
+        return stored;
+    }
+
+    bool flag(bool /*value*/) {
+        bool stored = false;
+        pod(stored);
+        return stored;
+    }
+
+    void str(std::string& value) {
+        size_t size = count(0);
+        value.assign(data_.data() + pos_, size);
+        pos_ += size;
+    }
+
+    void cstr(char*& value) {
+        value = nullptr;
+        if (flag(false)) {
+            std::string copy;
+            str(copy);
+            value = vtr::strdup(copy.c_str());
+        }
+    }
+
+    vtr::interned_string interned() {
+        std::string value;
+        str(value);
+        return arch_.strings.intern_string(vtr::string_view(value.data(), value.size()));
+    }
+
+    template<typename T>
+    void index(const T*& ptr, const std::vector<T>& pool) {
+        int64_t idx = -1;
+        pod(idx);
+        if (idx < -1 || idx >= int64_t(pool.size())) {
+            error("index out of range");
+        }
+        ptr = (idx == -1) ? nullptr : &pool[idx];
+    }
+
+    const std::vector<t_physical_tile_type>& physical_types() const { return physical_types_; }
+    const std::vector<t_logical_block_type>& logical_types() const { return logical_types_; }
+
+    bool done() const { return pos_ == data_.size(); }
+
+    [[noreturn]] void error(const char* what) const {
+        archfpga_throw(file_, 0, "Invalid compiled architecture (%s at offset %zu)\n", what, pos_);
+    }
+
+  private:
+    void require(size_t num_bytes) const {
+        if (num_bytes > data_.size() - pos_) {
+            error("truncated");
+        }
+    }
+
+    const char* file_;
+    vtr::array_view<const char> data_;
+    size_t pos_ = 0;
+    t_arch& arch_;
+    const std::vector<t_physical_tile_type>& physical_types_;
+    const std::vector<t_logical_block_type>& logical_types_;
+};
+
+} // namespace
+
+/*
+ * io() function declarations
+ */
+
+//Generic values and containers
+template<class Ar, typename T>
+static std::enable_if_t<std::is_arithmetic<T>::value || std::is_enum<T>::value> io(Ar& ar, T& value);
+template<class Ar>
+static void io(Ar& ar, std::string& value);
+template<class Ar>
+static void io(Ar& ar, char*& value);
+template<class Ar>
+static void io(Ar& ar, std::vector<bool>& vec);
+template<class Ar, typename T>
+static void io(Ar& ar, std::vector<T>& vec);
+template<class Ar, typename A, typename B>
+static void io(Ar& ar, std::pair<A, B>& pair);
+template<class Ar, typename K, typename V>
+static void io(Ar& ar, std::map<K, V>& map);
+template<class Ar, typename K, typename V>
+static void io(Ar& ar, std::unordered_map<K, V>& map);
+template<class Ar, typename T, size_t N>
+static void io(Ar& ar, vtr::NdMatrix<T, N>& matrix);
+template<class Ar, typename T>
+static void io_calloced(Ar& ar, T*& ptr);
+
+//Architecture structures
+template<class Ar>
+static void io(Ar& ar, t_metadata_dict& dict);
+template<class Ar>
+static void io(Ar& ar, t_logical_block_type_ptr& type);
+template<class Ar>
+static void io(Ar& ar, t_physical_tile_type_ptr& type);
+template<class Ar>
+static void io(Ar& ar, t_chan& chan);
+template<class Ar>
+static void io(Ar& ar, SB_Side_Connection& conn);
+template<class Ar>
+static void io(Ar& ar, t_wire_switchpoints& switchpoints);
+template<class Ar>
+static void io(Ar& ar, t_wireconn_inf& wireconn);
+template<class Ar>
+static void io(Ar& ar, t_switchblock_inf& switchblock);
+template<class Ar>
+static void io(Ar& ar, t_segment_inf& segment);
+template<class Ar>
+static void io(Ar& ar, t_arch_switch_inf& arch_switch);
+template<class Ar>
+static void io(Ar& ar, t_direct_inf& direct);
+template<class Ar>
+static void io(Ar& ar, t_model_ports*& ports);
+template<class Ar>
+static void io(Ar& ar, t_model*& models);
+template<class Ar>
+static void io(Ar& ar, t_clock_network& clock);
+template<class Ar>
+static void io(Ar& ar, t_lut_cell& lut_cell);
+template<class Ar>
+static void io(Ar& ar, t_lut_bel& lut_bel);
+template<class Ar>
+static void io(Ar& ar, t_lut_element& lut_element);
+template<class Ar>
+static void io(Ar& ar, t_grid_loc_spec& spec);
+template<class Ar>
+static void io(Ar& ar, t_grid_def& grid_def);
+template<class Ar>
+static void io(Ar& ar, t_metal_layer& metal_layer);
+template<class Ar>
+static void io(Ar& ar, t_clock_network_arch& clock_network);
+template<class Ar>
+static void io(Ar& ar, t_clock_connection_arch& clock_connection);
+template<class Ar>
+static void io(Ar& ar, t_clock_arch_spec& clock_arch);
+template<class Ar>
+static void io(Ar& ar, t_router& router);
+template<class Ar>
+static void io(Ar& ar, t_noc_inf& noc);
+template<class Ar>
+static void io(Ar& ar, t_class& class_inf);
+template<class Ar>
+static void io(Ar& ar, t_class_range& range);
+template<class Ar>
+static void io(Ar& ar, t_pin_range& range);
+template<class Ar>
+static void io(Ar& ar, t_fc_specification& fc_spec);
+template<class Ar>
+static void io(Ar& ar, t_physical_tile_port& port);
+template<class Ar>
+static void io(Ar& ar, t_sub_tile& sub_tile);
+template<class Ar>
+static void io(Ar& ar, vtr::bimap<t_logical_pin, t_physical_pin>& pin_map);
+template<class Ar>
+static void io(Ar& ar, t_physical_tile_type& type);
+template<class Ar>
+static void io(Ar& ar, t_power_usage& power_usage);
+template<class Ar>
+static void io(Ar& ar, t_pb_type_power& power);
+template<class Ar>
+static void io(Ar& ar, t_mode_power& power);
+template<class Ar>
+static void io(Ar& ar, t_interconnect_power& power);
+template<class Ar>
+static void io(Ar& ar, t_port_power& power);
+template<class Ar>
+static void io(Ar& ar, t_pin_to_pin_annotation& annotation);
+template<class Ar>
+static void io_annotations(Ar& ar, t_pin_to_pin_annotation*& annotations, int& num_annotations);
+template<class Ar>
+static void io_port(Ar& ar, t_port& port, t_pb_type* parent_pb_type);
+template<class Ar>
+static void io_interconnect(Ar& ar, t_interconnect& interconnect, t_mode* parent_mode);
+template<class Ar>
+static void io_mode(Ar& ar, t_mode& mode, t_pb_type* parent_pb_type);
+template<class Ar>
+static void io_pb_type(Ar& ar, t_pb_type& pb_type, t_mode* parent_mode);
+template<class Ar>
+static void io(Ar& ar, t_logical_block_type& type);
+template<class Ar>
+static void io_arch(Ar& ar, t_arch& arch);
+template<class Ar>
+static void io_types(Ar& ar, std::vector<t_physical_tile_type>& physical_types, std::vector<t_logical_block_type>& logical_types);
+
+/*
+ * Public functions
+ */
+
+void WriteCompiledArch(const char* compiled_file,
+                       const t_arch& arch,
+                       const std::vector<t_physical_tile_type>& PhysicalTileTypes,
+                       const std::vector<t_logical_block_type>& LogicalBlockTypes,
+                       bool timing_enabled) {
+    t_compiled_arch_header header;
+    header.timing_enabled = timing_enabled;
+    header.power = (arch.power != nullptr);
+
+    std::string source = std::string(vtr::VERSION) + '\0' + arch.architecture_id + '\0';
+
+    //The io() functions are shared with the reader so take non-const references, but do not modify them when writing
+    CompiledArchWriter writer(arch, PhysicalTileTypes, LogicalBlockTypes);
+    io_arch(writer, const_cast<t_arch&>(arch));
+    io_types(writer,
+             const_cast<std::vector<t_physical_tile_type>&>(PhysicalTileTypes),
+             const_cast<std::vector<t_logical_block_type>&>(LogicalBlockTypes));
+
+    vtr::FlatBlobWriter blob;
+    blob.add_array(std::vector<t_compiled_arch_header>{header});
+    blob.add_array(std::vector<char>(source.begin(), source.end()));
+    blob.add_array(vtr::array_view<const char>(writer.data().data(), writer.data().size()));
+    blob.write(compiled_file);
+}
+
+bool ReadCompiledArch(const char* compiled_file,
+                      const char* arch_file,
+                      bool timing_enabled,
+                      t_arch* arch,
+                      std::vector<t_physical_tile_type>& PhysicalTileTypes,
+                      std::vector<t_logical_block_type>& LogicalBlockTypes) {
+    VTR_ASSERT(PhysicalTileTypes.empty() && LogicalBlockTypes.empty());
+
+    std::unique_ptr<vtr::FlatBlobReader> blob;
+    std::string architecture_id;
+    try {
+        blob = std::make_unique<vtr::FlatBlobReader>(compiled_file);
+        if (blob->num_sections() != PAYLOAD_SECTION + 1) {
+            VTR_LOG_WARN("'%s' is not a compiled architecture\n", compiled_file);
+            return false;
+        }
+
+        vtr::array_view<const t_compiled_arch_header> header = blob->array<t_compiled_arch_header>(HEADER_SECTION);
+        if (header.size() != 1 || header[0].magic != COMPILED_ARCH_MAGIC) {
+            VTR_LOG_WARN("'%s' is not a compiled architecture\n", compiled_file);
+            return false;
+        }
+
+        vtr::array_view<const char> source = blob->section_data(SOURCE_SECTION);
+        std::string version(source.data(), strnlen(source.data(), source.size()));
+        if (header[0].version != COMPILED_ARCH_VERSION || version != vtr::VERSION) {
+            VTR_LOG_WARN("Compiled architecture '%s' was written by a different VTR version\n", compiled_file);
+            return false;
+        }
+        if (header[0].timing_enabled != uint64_t(timing_enabled) || header[0].power != uint64_t(arch->power != nullptr)) {
+            VTR_LOG_WARN("Compiled architecture '%s' was compiled with different timing analysis or power estimation options\n", compiled_file);
+            return false;
+        }
+
+        if (version.size() + 1 < source.size()) {
+            const char* stored_id = source.data() + version.size() + 1;
+            architecture_id.assign(stored_id, strnlen(stored_id, source.size() - version.size() - 1));
+        }
+        if (architecture_id != vtr::secure_digest_file(arch_file)) {
+            VTR_LOG_WARN("Compiled architecture '%s' was not compiled from the current '%s'\n", compiled_file, arch_file);
+            return false;
+        }
+    } catch (const vtr::VtrError& error) {
+        VTR_LOG_WARN("Failed to load compiled architecture '%s': %s\n", compiled_file, error.what());
+        return false;
+    }
+
+    //The file is up to date, so any inconsistency from here on is a corrupt file, which throws
+    set_arch_file_name(arch_file);
+
+    CompiledArchReader reader(compiled_file, blob->section_data(PAYLOAD_SECTION), *arch, PhysicalTileTypes, LogicalBlockTypes);
+    io_arch(reader, *arch);
+    io_types(reader, PhysicalTileTypes, LogicalBlockTypes);
+    if (!reader.done()) {
+        reader.error("trailing data");
+    }
+    if (!arch->architecture_id || architecture_id != arch->architecture_id) {
+        reader.error("inconsistent architecture id");
+    }
+
+    CreateModelLibrary(arch);
+    SyncModelsPbTypes(arch, LogicalBlockTypes);
+
+    return true;
+}
+
+/*
+ * Generic values and containers
+ */
+
+template<class Ar, typename T>
+static std::enable_if_t<std::is_arithmetic<T>::value || std::is_enum<T>::value> io(Ar& ar, T& value) {
+    ar.pod(value);
+}
+
+template<class Ar>
+static void io(Ar& ar, std::string& value) {
+    ar.str(value);
+}
+
+template<class Ar>
+static void io(Ar& ar, char*& value) {
+    ar.cstr(value);
+}
+
+template<class Ar>
+static void io(Ar& ar, std::vector<bool>& vec) {
+    size_t size = ar.count(vec.size());
+    if constexpr (Ar::reading) {
+        vec.resize(size);
+    }
+    for (size_t i = 0; i < size; ++i) {
+        bool value = vec[i];
+        ar.pod(value);
+        vec[i] = value;
+    }
+}
+
+template<class Ar, typename T>
+static void io(Ar& ar, std::vector<T>& vec) {
+    size_t size = ar.count(vec.size());
+    if constexpr (Ar::reading) {
+        vec.resize(size);
+    }
+    for (T& elem : vec) {
+        io(ar, elem);
+    }
+}
+
+template<class Ar, typename A, typename B>
+static void io(Ar& ar, std::pair<A, B>& pair) {
+    io(ar, pair.first);
+    io(ar, pair.second);
+}
+
+template<class Ar, typename K, typename V>
+static void io(Ar& ar, std::map<K, V>& map) {
+    size_t size = ar.count(map.size());
+    if constexpr (Ar::reading) {
+        for (size_t i = 0; i < size; ++i) {
+            K key{};
+            io(ar, key);
+            io(ar, map[key]);
+        }
+    } else {
+        for (auto& kv : map) {
+            K key = kv.first;
+            io(ar, key);
+            io(ar, kv.second);
+        }
+    }
+}
+
+template<class Ar, typename K, typename V>
+static void io(Ar& ar, std::unordered_map<K, V>& map) {
+    size_t size = ar.count(map.size());
+    if constexpr (Ar::reading) {
+        for (size_t i = 0; i < size; ++i) {
+            K key{};
+            io(ar, key);
+            io(ar, map[key]);
+        }
+    } else {
+        for (auto& kv : map) {
+            K key = kv.first;
+            io(ar, key);
+            io(ar, kv.second);
+        }
+    }
+}
+
+template<class Ar, typename T, size_t N>
+static void io(Ar& ar, vtr::NdMatrix<T, N>& matrix) {
+    std::array<size_t, N> dim_sizes = matrix.dim_sizes();
+    for (size_t& dim_size : dim_sizes) {
+        dim_size = ar.count(dim_size);
+    }
+    if constexpr (Ar::reading) {
+        matrix.resize(dim_sizes);
+    }
+    matrix.for_each_index([&](const std::array<size_t, N>& index) {
+        io(ar, matrix.element(index));
+    });
+}
+
+///@brief Stores a (nullable) structure allocated with vtr::calloc
+template<class Ar, typename T>
+static void io_calloced(Ar& ar, T*& ptr) {
+    if (ar.flag(ptr != nullptr)) {
+        if constexpr (Ar::reading) {
+            ptr = (T*)vtr::calloc(1, sizeof(T));
+        }
+        io(ar, *ptr);
+    } else if constexpr (Ar::reading) {
+        ptr = nullptr;
+    }
+}
+
+/*
+ * Architecture structures
+ */
+
+template<class Ar>
+static void io(Ar& ar, t_metadata_dict& dict) {
+    size_t num_keys = ar.count(dict.size());
+    if constexpr (Ar::reading) {
+        for (size_t ikey = 0; ikey < num_keys; ++ikey) {
+            vtr::interned_string key = ar.interned();
+            size_t num_values = ar.count(0);
+            for (size_t ivalue = 0; ivalue < num_values; ++ivalue) {
+                dict.add(key, ar.interned());
+            }
+        }
+    } else {
+        for (const auto& kv : dict) {
+            ar.interned(kv.first);
+            ar.count(kv.second.size());
+            for (const t_metadata_value& value : kv.second) {
+                ar.interned(value.as_string());
+            }
+        }
+    }
+}
+
+template<class Ar>
+static void io(Ar& ar, t_logical_block_type_ptr& type) {
+    ar.index(type, ar.logical_types());
+}
+
+template<class Ar>
+static void io(Ar& ar, t_physical_tile_type_ptr& type) {
+    ar.index(type, ar.physical_types());
+}
+
+template<class Ar>
+static void io(Ar& ar, t_chan& chan) {
+    io(ar, chan.type);
+    io(ar, chan.peak);
+    io(ar, chan.width);
+    io(ar, chan.xpeak);
+    io(ar, chan.dc);
+}
+
+template<class Ar>
+static void io(Ar& ar, SB_Side_Connection& conn) {
+    io(ar, conn.from_side);
+    io(ar, conn.to_side);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_wire_switchpoints& switchpoints) {
+    io(ar, switchpoints.segment_name);
+    io(ar, switchpoints.switchpoints);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_wireconn_inf& wireconn) {
+    io(ar, wireconn.from_switchpoint_set);
+    io(ar, wireconn.to_switchpoint_set);
+    io(ar, wireconn.from_switchpoint_order);
+    io(ar, wireconn.to_switchpoint_order);
+    io(ar, wireconn.switch_override_indx);
+    io(ar, wireconn.num_conns_formula);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_switchblock_inf& switchblock) {
+    io(ar, switchblock.name);
+    io(ar, switchblock.location);
+    io(ar, switchblock.directionality);
+    io(ar, switchblock.permutation_map);
+    io(ar, switchblock.wireconns);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_segment_inf& segment) {
+    io(ar, segment.name);
+    io(ar, segment.frequency);
+    io(ar, segment.length);
+    io(ar, segment.arch_wire_switch);
+    io(ar, segment.arch_opin_switch);
+    io(ar, segment.arch_opin_between_dice_switch);
+    io(ar, segment.frac_cb);
+    io(ar, segment.frac_sb);
+    io(ar, segment.longline);
+    io(ar, segment.Rmetal);
+    io(ar, segment.Cmetal);
+    io(ar, segment.directionality);
+    io(ar, segment.parallel_axis);
+    io(ar, segment.cb);
+    io(ar, segment.sb);
+    io(ar, segment.seg_index);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_arch_switch_inf& arch_switch) {
+    io(ar, arch_switch.name);
+    io(ar, arch_switch.R);
+    io(ar, arch_switch.Cin);
+    io(ar, arch_switch.Cout);
+    io(ar, arch_switch.Cinternal);
+    io(ar, arch_switch.mux_trans_size);
+    io(ar, arch_switch.buf_size_type);
+    io(ar, arch_switch.buf_size);
+    io(ar, arch_switch.power_buffer_type);
+    io(ar, arch_switch.power_buffer_size);
+    io(ar, arch_switch.intra_tile);
+
+    SwitchType type = arch_switch.type();
+    io(ar, type);
+    std::map<int, double> Tdel_map = arch_switch.Tdel_map();
+    io(ar, Tdel_map);
+    if constexpr (Ar::reading) {
+        arch_switch.set_type(type);
+        for (const auto& kv : Tdel_map) {
+            arch_switch.set_Tdel(kv.first, kv.second);
+        }
+    }
+}
+
+template<class Ar>
+static void io(Ar& ar, t_direct_inf& direct) {
+    io(ar, direct.name);
+    io(ar, direct.from_pin);
+    io(ar, direct.to_pin);
+    io(ar, direct.x_offset);
+    io(ar, direct.y_offset);
+    io(ar, direct.sub_tile_offset);
+    io(ar, direct.switch_type);
+    io(ar, direct.from_side);
+    io(ar, direct.to_side);
+    io(ar, direct.line);
+}
+
+///@brief Stores a linked list of model ports, as allocated by ProcessModelPorts()
+template<class Ar>
+static void io(Ar& ar, t_model_ports*& ports) {
+    size_t num_ports = 0;
+    for (t_model_ports* port = ports; port != nullptr; port = port->next) {
+        ++num_ports;
+    }
+    num_ports = ar.count(num_ports);
+
+    t_model_ports** link = &ports;
+    for (size_t iport = 0; iport < num_ports; ++iport) {
+        if constexpr (Ar::reading) {
+            *link = new t_model_ports;
+        }
+        t_model_ports* port = *link;
+        io(ar, port->dir);
+        io(ar, port->name);
+        io(ar, port->size);
+        io(ar, port->min_size);
+        io(ar, port->is_clock);
+        io(ar, port->is_non_clock_global);
+        io(ar, port->clock);
+        io(ar, port->combinational_sink_ports);
+        io(ar, port->index);
+        link = &port->next;
+    }
+}
+
+///@brief Stores a linked list of (user) models, as allocated by ProcessModels()
+template<class Ar>
+static void io(Ar& ar, t_model*& models) {
+    size_t num_models = 0;
+    for (t_model* model = models; model != nullptr; model = model->next) {
+        ++num_models;
+    }
+    num_models = ar.count(num_models);
+
+    t_model** link = &models;
+    for (size_t imodel = 0; imodel < num_models; ++imodel) {
+        if constexpr (Ar::reading) {
+            *link = new t_model;
+        }
+        t_model* model = *link;
+        io(ar, model->name);
+        io(ar, model->inputs);
+        io(ar, model->outputs);
+        io(ar, model->never_prune);
+        io(ar, model->index);
+        link = &model->next;
+    }
+}
+
+template<class Ar>
+static void io(Ar& ar, t_clock_network& clock) {
+    io(ar, clock.autosize_buffer);
+    io(ar, clock.buffer_size);
+    io(ar, clock.C_wire);
+    io(ar, clock.prob);
+    io(ar, clock.dens);
+    io(ar, clock.period);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_lut_cell& lut_cell) {
+    io(ar, lut_cell.name);
+    io(ar, lut_cell.init_param);
+    io(ar, lut_cell.inputs);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_lut_bel& lut_bel) {
+    io(ar, lut_bel.name);
+    io(ar, lut_bel.input_pins);
+    io(ar, lut_bel.output_pin);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_lut_element& lut_element) {
+    io(ar, lut_element.site_type);
+    io(ar, lut_element.width);
+    io(ar, lut_element.lut_bels);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_grid_loc_spec& spec) {
+    io(ar, spec.start_expr);
+    io(ar, spec.end_expr);
+    io(ar, spec.repeat_expr);
+    io(ar, spec.incr_expr);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_grid_def& grid_def) {
+    io(ar, grid_def.grid_type);
+    io(ar, grid_def.name);
+    io(ar, grid_def.width);
+    io(ar, grid_def.height);
+    io(ar, grid_def.aspect_ratio);
+
+    //Locations of all layers, to link their metadata
+    std::vector<t_grid_loc_def*> loc_defs;
+    std::vector<int64_t> meta_owners;
+
+    size_t num_layers = ar.count(grid_def.layers.size());
+    if constexpr (Ar::reading) {
+        grid_def.layers.resize(num_layers);
+    }
+    for (t_layer_def& layer : grid_def.layers) {
+        size_t num_loc_defs = ar.count(layer.loc_defs.size());
+        for (size_t iloc = 0; iloc < num_loc_defs; ++iloc) {
+            if constexpr (Ar::reading) {
+                layer.loc_defs.emplace_back("", 0);
+            }
+            t_grid_loc_def& loc_def = layer.loc_defs[iloc];
+            io(ar, loc_def.block_type);
+            io(ar, loc_def.priority);
+            io(ar, loc_def.x);
+            io(ar, loc_def.y);
+
+            if (ar.flag(loc_def.owned_meta != nullptr)) {
+                if constexpr (Ar::reading) {
+                    loc_def.owned_meta = std::make_unique<t_metadata_dict>();
+                }
+                io(ar, *loc_def.owned_meta);
+            }
+        }
+        for (t_grid_loc_def& loc_def : layer.loc_defs) {
+            loc_defs.push_back(&loc_def);
+        }
+    }
+
+    //The metadata is shared by the locations created from the same XML tag, and owned by one of them
+    for (t_grid_loc_def* loc_def : loc_defs) {
+        int64_t owner = -1;
+        if constexpr (!Ar::reading) {
+            if (loc_def->meta != nullptr) {
+                for (size_t iowner = 0; iowner < loc_defs.size(); ++iowner) {
+                    if (loc_defs[iowner]->owned_meta.get() == loc_def->meta) {
+                        owner = iowner;
+                    }
+                }
+                VTR_ASSERT_MSG(owner != -1, "Grid location metadata must be owned by a location of the same grid");
+            }
+        }
+        io(ar, owner);
+        if constexpr (Ar::reading) {
+            if (owner < -1 || owner >= int64_t(loc_defs.size()) || (owner != -1 && !loc_defs[owner]->owned_meta)) {
+                ar.error("invalid grid location metadata");
+            }
+            loc_def->meta = (owner == -1) ? nullptr : loc_defs[owner]->owned_meta.get();
+        }
+    }
+}
+
+template<class Ar>
+static void io(Ar& ar, t_metal_layer& metal_layer) {
+    io(ar, metal_layer.r_metal);
+    io(ar, metal_layer.c_metal);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_clock_network_arch& clock_network) {
+    io(ar, clock_network.name);
+    io(ar, clock_network.num_inst);
+    io(ar, clock_network.type);
+    io(ar, clock_network.metal_layer);
+    io(ar, clock_network.wire.start);
+    io(ar, clock_network.wire.end);
+    io(ar, clock_network.wire.position);
+    io(ar, clock_network.repeat.x);
+    io(ar, clock_network.repeat.y);
+    io(ar, clock_network.drive.name);
+    io(ar, clock_network.drive.offset);
+    io(ar, clock_network.drive.arch_switch_idx);
+    io(ar, clock_network.tap.name);
+    io(ar, clock_network.tap.offset);
+    io(ar, clock_network.tap.increment);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_clock_connection_arch& clock_connection) {
+    io(ar, clock_connection.from);
+    io(ar, clock_connection.to);
+    io(ar, clock_connection.arch_switch_idx);
+    io(ar, clock_connection.locationx);
+    io(ar, clock_connection.locationy);
+    io(ar, clock_connection.fc);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_clock_arch_spec& clock_arch) {
+    io(ar, clock_arch.clock_networks_arch);
+    io(ar, clock_arch.clock_metal_layers);
+    io(ar, clock_arch.clock_connections_arch);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_router& router) {
+    io(ar, router.id);
+    io(ar, router.device_x_position);
+    io(ar, router.device_y_position);
+    io(ar, router.connection_list);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_noc_inf& noc) {
+    io(ar, noc.link_bandwidth);
+    io(ar, noc.link_latency);
+    io(ar, noc.router_latency);
+    io(ar, noc.router_list);
+    io(ar, noc.noc_router_tile_name);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_class& class_inf) {
+    io(ar, class_inf.type);
+    io(ar, class_inf.equivalence);
+    io(ar, class_inf.num_pins);
+    io(ar, class_inf.pinlist);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_class_range& range) {
+    io(ar, range.low);
+    io(ar, range.high);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_pin_range& range) {
+    io(ar, range.low);
+    io(ar, range.high);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_fc_specification& fc_spec) {
+    io(ar, fc_spec.fc_type);
+    io(ar, fc_spec.fc_value_type);
+    io(ar, fc_spec.fc_value);
+    io(ar, fc_spec.seg_index);
+    io(ar, fc_spec.pins);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_physical_tile_port& port) {
+    io(ar, port.name);
+    io(ar, port.type);
+    io(ar, port.is_clock);
+    io(ar, port.is_non_clock_global);
+    io(ar, port.num_pins);
+    io(ar, port.equivalent);
+    io(ar, port.index);
+    io(ar, port.absolute_first_pin_index);
+    io(ar, port.port_index_by_type);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_sub_tile& sub_tile) {
+    io(ar, sub_tile.name);
+    io(ar, sub_tile.sub_tile_to_tile_pin_indices);
+    io(ar, sub_tile.ports);
+    io(ar, sub_tile.equivalent_sites);
+    io(ar, sub_tile.capacity.low);
+    io(ar, sub_tile.capacity.high);
+    io(ar, sub_tile.class_range);
+    io(ar, sub_tile.primitive_class_range);
+    io(ar, sub_tile.intra_pin_range);
+    io(ar, sub_tile.num_phy_pins);
+    io(ar, sub_tile.index);
+}
+
+template<class Ar>
+static void io(Ar& ar, vtr::bimap<t_logical_pin, t_physical_pin>& pin_map) {
+    size_t size = 0;
+    for (auto iter = pin_map.begin(); iter != pin_map.end(); ++iter) {
+        ++size;
+    }
+    size = ar.count(size);
+
+    auto iter = pin_map.begin();
+    for (size_t i = 0; i < size; ++i) {
+        int logical_pin = -1;
+        int physical_pin = -1;
+        if constexpr (!Ar::reading) {
+            logical_pin = iter->first.pin;
+            physical_pin = iter->second.pin;
+            ++iter;
+        }
+        io(ar, logical_pin);
+        io(ar, physical_pin);
+        if constexpr (Ar::reading) {
+            pin_map.insert(t_logical_pin(logical_pin), t_physical_pin(physical_pin));
+        }
+    }
+}
+
+template<class Ar>
+static void io(Ar& ar, t_physical_tile_type& type) {
+    //Filled in once the pb_graphs are built
+    VTR_ASSERT(type.on_tile_pin_num_to_pb_pin.empty() && type.pin_num_to_pb_pin.empty());
+
+    io(ar, type.name);
+    io(ar, type.num_pins);
+    io(ar, type.num_inst_pins);
+    io(ar, type.num_input_pins);
+    io(ar, type.num_output_pins);
+    io(ar, type.num_clock_pins);
+    io(ar, type.clock_pin_indices);
+    io(ar, type.capacity);
+    io(ar, type.width);
+    io(ar, type.height);
+    io(ar, type.pinloc);
+    io(ar, type.class_inf);
+    io(ar, type.primitive_class_starting_idx);
+    io(ar, type.primitive_class_inf);
+    io(ar, type.pin_layer_offset);
+    io(ar, type.pin_width_offset);
+    io(ar, type.pin_height_offset);
+    io(ar, type.pin_class);
+    io(ar, type.primitive_pin_class);
+    io(ar, type.is_ignored_pin);
+    io(ar, type.is_pin_global);
+    io(ar, type.fc_specs);
+    io(ar, type.switchblock_locations);
+    io(ar, type.switchblock_switch_overrides);
+    io(ar, type.area);
+    io(ar, type.num_drivers);
+    io(ar, type.num_receivers);
+    io(ar, type.index);
+    io(ar, type.sub_tiles);
+    io(ar, type.tile_block_pin_directs_map);
+    io(ar, type.is_input_type);
+    io(ar, type.is_output_type);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_power_usage& power_usage) {
+    io(ar, power_usage.dynamic);
+    io(ar, power_usage.leakage);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_pb_type_power& power) {
+    io(ar, power.estimation_method);
+    io(ar, power.absolute_power_per_instance);
+    io(ar, power.C_internal);
+    io(ar, power.leakage_default_mode);
+    io(ar, power.power_usage);
+    io(ar, power.power_usage_bufs_wires);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_mode_power& power) {
+    io(ar, power.power_usage);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_interconnect_power& power) {
+    io(ar, power.power_usage);
+    io(ar, power.port_info_initialized);
+    io(ar, power.num_input_ports);
+    io(ar, power.num_output_ports);
+    io(ar, power.num_pins_per_port);
+    io(ar, power.transistor_cnt);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_port_power& power) {
+    //Set up by the power estimation in VPR
+    VTR_ASSERT(power.scaled_by_port == nullptr);
+
+    io(ar, power.wire_type);
+    io(ar, power.wire.C); //All members of the union are floats
+    io(ar, power.buffer_type);
+    io(ar, power.buffer_size);
+    io(ar, power.pin_toggle_initialized);
+    io(ar, power.energy_per_toggle);
+    io(ar, power.scaled_by_port_pin_idx);
+    io(ar, power.reverse_scaled);
+}
+
+template<class Ar>
+static void io(Ar& ar, t_pin_to_pin_annotation& annotation) {
+    io(ar, annotation.num_value_prop_pairs);
+    if constexpr (Ar::reading) {
+        annotation.value = (char**)vtr::calloc(annotation.num_value_prop_pairs, sizeof(char*));
+        annotation.prop = (int*)vtr::calloc(annotation.num_value_prop_pairs, sizeof(int));
+    }
+    for (int i = 0; i < annotation.num_value_prop_pairs; ++i) {
+        io(ar, annotation.value[i]);
+        io(ar, annotation.prop[i]);
+    }
+    io(ar, annotation.type);
+    io(ar, annotation.format);
+    io(ar, annotation.input_pins);
+    io(ar, annotation.output_pins);
+    io(ar, annotation.clock);
+    io(ar, annotation.line_num);
+}
+
+template<class Ar>
+static void io_annotations(Ar& ar, t_pin_to_pin_annotation*& annotations, int& num_annotations) {
+    io(ar, num_annotations);
+    if constexpr (Ar::reading) {
+        if (num_annotations < 0) {
+            ar.error("invalid number of annotations");
+        }
+        annotations = (t_pin_to_pin_annotation*)vtr::calloc(num_annotations, sizeof(t_pin_to_pin_annotation));
+    }
+    for (int i = 0; i < num_annotations; ++i) {
+        io(ar, annotations[i]);
+    }
+}
+
+template<class Ar>
+static void io_port(Ar& ar, t_port& port, t_pb_type* parent_pb_type) {
+    VTR_ASSERT(port.parent_pb_type == parent_pb_type || Ar::reading);
+
+    io(ar, port.name);
+    io(ar, port.type);
+    io(ar, port.is_clock);
+    io(ar, port.is_non_clock_global);
+    io(ar, port.num_pins);
+    io(ar, port.equivalent);
+    io(ar, port.port_class);
+    io(ar, port.index);
+    io(ar, port.port_index_by_type);
+    io(ar, port.absolute_first_pin_index);
+    io_calloced(ar, port.port_power);
+
+    if constexpr (Ar::reading) {
+        port.model_port = nullptr; //Set by SyncModelsPbTypes()
+        port.parent_pb_type = parent_pb_type;
+    }
+}
+
+template<class Ar>
+static void io_interconnect(Ar& ar, t_interconnect& interconnect, t_mode* parent_mode) {
+    VTR_ASSERT(interconnect.parent_mode == parent_mode || Ar::reading);
+
+    io(ar, interconnect.type);
+    io(ar, interconnect.name);
+    io(ar, interconnect.input_string);
+    io(ar, interconnect.output_string);
+    io_annotations(ar, interconnect.annotations, interconnect.num_annotations);
+    io(ar, interconnect.infer_annotations);
+    io(ar, interconnect.line_num);
+    io(ar, interconnect.parent_mode_index);
+    io_calloced(ar, interconnect.interconnect_power);
+    io(ar, interconnect.meta);
+
+    if constexpr (Ar::reading) {
+        interconnect.parent_mode = parent_mode;
+    }
+}
+
+template<class Ar>
+static void io_mode(Ar& ar, t_mode& mode, t_pb_type* parent_pb_type) {
+    VTR_ASSERT(mode.parent_pb_type == parent_pb_type || Ar::reading);
+
+    io(ar, mode.name);
+    io(ar, mode.index);
+    io(ar, mode.disable_packing);
+    io_calloced(ar, mode.mode_power);
+    io(ar, mode.meta);
+
+    io(ar, mode.num_pb_type_children);
+    if (ar.flag(mode.pb_type_children != nullptr)) {
+        if constexpr (Ar::reading) {
+            if (mode.num_pb_type_children < 0) {
+                ar.error("invalid number of pb_type children");
+            }
+            mode.pb_type_children = new t_pb_type[mode.num_pb_type_children];
+        }
+        for (int i = 0; i < mode.num_pb_type_children; ++i) {
+            io_pb_type(ar, mode.pb_type_children[i], &mode);
+        }
+    }
+
+    io(ar, mode.num_interconnect);
+    if (ar.flag(mode.interconnect != nullptr)) {
+        if constexpr (Ar::reading) {
+            if (mode.num_interconnect < 0) {
+                ar.error("invalid number of interconnects");
+            }
+            mode.interconnect = new t_interconnect[mode.num_interconnect];
+        }
+        for (int i = 0; i < mode.num_interconnect; ++i) {
+            io_interconnect(ar, mode.interconnect[i], &mode);
+        }
+    }
+
+    if constexpr (Ar::reading) {
+        mode.parent_pb_type = parent_pb_type;
+    }
+}
+
+template<class Ar>
+static void io_pb_type(Ar& ar, t_pb_type& pb_type, t_mode* parent_mode) {
+    VTR_ASSERT(pb_type.parent_mode == parent_mode || Ar::reading);
+
+    io(ar, pb_type.name);
+    io(ar, pb_type.num_pb);
+    io(ar, pb_type.blif_model);
+    io(ar, pb_type.class_type);
+    io(ar, pb_type.num_clock_pins);
+    io(ar, pb_type.num_input_pins);
+    io(ar, pb_type.num_output_pins);
+    io(ar, pb_type.num_pins);
+    io(ar, pb_type.depth);
+    io(ar, pb_type.index_in_logical_block);
+    io_calloced(ar, pb_type.pb_type_power);
+    io(ar, pb_type.meta);
+
+    io(ar, pb_type.num_ports);
+    if constexpr (Ar::reading) {
+        if (pb_type.num_ports < 0) {
+            ar.error("invalid number of ports");
+        }
+        pb_type.ports = (t_port*)vtr::calloc(pb_type.num_ports, sizeof(t_port));
+    }
+    for (int i = 0; i < pb_type.num_ports; ++i) {
+        io_port(ar, pb_type.ports[i], &pb_type);
+    }
+
+    io_annotations(ar, pb_type.annotations, pb_type.num_annotations);
+
+    io(ar, pb_type.num_modes);
+    if (ar.flag(pb_type.modes != nullptr)) {
+        if constexpr (Ar::reading) {
+            if (pb_type.num_modes < 0) {
+                ar.error("invalid number of modes");
+            }
+            pb_type.modes = new t_mode[pb_type.num_modes];
+        }
+        for (int i = 0; i < pb_type.num_modes; ++i) {
+            io_mode(ar, pb_type.modes[i], &pb_type);
+        }
+    }
+
+    if constexpr (Ar::reading) {
+        pb_type.model = nullptr; //Set by SyncModelsPbTypes()
+        pb_type.parent_mode = parent_mode;
+    }
+}
+
+template<class Ar>
+static void io(Ar& ar, t_logical_block_type& type) {
+    //Filled in once the pb_graphs are built
+    VTR_ASSERT(type.pb_graph_head == nullptr);
+    VTR_ASSERT(type.pin_logical_num_to_pb_pin_mapping.empty() && type.primitive_pb_pin_to_logical_class_num_mapping.empty());
+    VTR_ASSERT(type.pb_graph_node_class_range.empty());
+
+    io(ar, type.name);
+    io(ar, type.index);
+    if (ar.flag(type.pb_type != nullptr)) {
+        if constexpr (Ar::reading) {
+            type.pb_type = new t_pb_type;
+        }
+        io_pb_type(ar, *type.pb_type, nullptr);
+    }
+    io(ar, type.equivalent_tiles);
+    io(ar, type.primitive_logical_class_inf);
+}
+
+template<class Ar>
+static void io_arch(Ar& ar, t_arch& arch) {
+    //The internment is stored in id order, so that re-interning gives every string its original id
+    size_t num_strings = ar.count(arch.strings.unique_strings());
+    for (size_t i = 0; i < num_strings; ++i) {
+        std::string str;
+        if constexpr (!Ar::reading) {
+            vtr::string_view view = arch.strings.get_string(vtr::StringId(i));
+            str.assign(view.data(), view.size());
+        }
+        io(ar, str);
+        if constexpr (Ar::reading) {
+            arch.strings.intern_string(vtr::string_view(str.data(), str.size()));
+        }
+    }
+
+    size_t num_interned_strings = ar.count(arch.interned_strings.size());
+    for (size_t i = 0; i < num_interned_strings; ++i) {
+        if constexpr (Ar::reading) {
+            arch.interned_strings.push_back(ar.interned());
+        } else {
+            ar.interned(arch.interned_strings[i]);
+        }
+    }
+
+    io(ar, arch.architecture_id);
+    io(ar, arch.Chans.chan_x_dist);
+    io(ar, arch.Chans.chan_y_dist);
+    io(ar, arch.SBType);
+    io(ar, arch.switchblocks);
+    io(ar, arch.R_minW_nmos);
+    io(ar, arch.R_minW_pmos);
+    io(ar, arch.Fs);
+    io(ar, arch.grid_logic_tile_area);
+    io(ar, arch.Segments);
+
+    io(ar, arch.num_switches);
+    if (ar.flag(arch.Switches != nullptr)) {
+        if constexpr (Ar::reading) {
+            if (arch.num_switches < 0) {
+                ar.error("invalid number of switches");
+            }
+            arch.Switches = new t_arch_switch_inf[arch.num_switches];
+        }
+        for (int i = 0; i < arch.num_switches; ++i) {
+            io(ar, arch.Switches[i]);
+        }
+    }
+
+    io(ar, arch.num_directs);
+    if (ar.flag(arch.Directs != nullptr)) {
+        if constexpr (Ar::reading) {
+            if (arch.num_directs < 0) {
+                ar.error("invalid number of directs");
+            }
+            arch.Directs = (t_direct_inf*)vtr::malloc(arch.num_directs * sizeof(t_direct_inf));
+        }
+        for (int i = 0; i < arch.num_directs; ++i) {
+            io(ar, arch.Directs[i]);
+        }
+    }
+
+    io(ar, arch.models);
+
+    //Allocated by the caller if power estimation is enabled (checked against the header)
+    if (arch.power) {
+        io(ar, arch.power->C_wire_local);
+        io(ar, arch.power->logical_effort_factor);
+        io(ar, arch.power->local_interc_factor);
+        io(ar, arch.power->transistors_per_SRAM_bit);
+        io(ar, arch.power->mux_transistor_size);
+        io(ar, arch.power->FF_size);
+        io(ar, arch.power->LUT_transistor_size);
+    }
+    if (ar.flag(arch.clocks != nullptr)) {
+        if constexpr (Ar::reading) {
+            if (!arch.clocks) {
+                ar.error("unexpected clocks");
+            }
+        }
+        io(ar, arch.clocks->num_global_clocks);
+        if (ar.flag(arch.clocks->clock_inf != nullptr)) {
+            if constexpr (Ar::reading) {
+                if (arch.clocks->num_global_clocks < 0) {
+                    ar.error("invalid number of global clocks");
+                }
+                arch.clocks->clock_inf = (t_clock_network*)vtr::malloc(arch.clocks->num_global_clocks * sizeof(t_clock_network));
+            }
+            for (int i = 0; i < arch.clocks->num_global_clocks; ++i) {
+                io(ar, arch.clocks->clock_inf[i]);
+            }
+        }
+    }
+
+    io(ar, arch.layer_global_routing);
+    io(ar, arch.gnd_cell);
+    io(ar, arch.vcc_cell);
+    io(ar, arch.gnd_net);
+    io(ar, arch.vcc_net);
+    io(ar, arch.lut_cells);
+    io(ar, arch.lut_elements);
+    io(ar, arch.ipin_cblock_switch_name);
+    io(ar, arch.grid_layouts);
+    io(ar, arch.clock_arch);
+
+    if (ar.flag(arch.noc != nullptr)) {
+        if constexpr (Ar::reading) {
+            arch.noc = new t_noc_inf;
+        }
+        io(ar, *arch.noc);
+    }
+}
+
+template<class Ar>
+static void io_types(Ar& ar, std::vector<t_physical_tile_type>& physical_types, std::vector<t_logical_block_type>& logical_types) {
+    //Both vectors are sized up-front, since the types refer to each other by pointer
+    size_t num_physical_types = ar.count(physical_types.size());
+    size_t num_logical_types = ar.count(logical_types.size());
+    if constexpr (Ar::reading) {
+        physical_types.resize(num_physical_types);
+        logical_types.resize(num_logical_types);
+    }
+
+    for (t_physical_tile_type& type : physical_types) {
+        io(ar, type);
+    }
+    for (t_logical_block_type& type : logical_types) {
+        io(ar, type);
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef COMPILED_ARCH_H
+#define COMPILED_ARCH_H
+
+/**
+ * @file
+ * @brief A compiled (binary) form of an architecture, which loads much faster than its XML.
+ *
+ * XmlReadArch() parses the architecture XML and expands it (pb_type hierarchy, pin
+ * locations, Fc specifications, ...), which can take seconds for large architectures.
+ * WriteCompiledArch() stores the result of this expansion, i.e. the t_arch and the
+ * physical and logical types, and ReadCompiledArch() loads it back without parsing
+ * the XML at all.
+ *
+ * FPGA Interchange devices are compiled the same way (the expansion of FPGAInterchangeReadArch()
+ * from the device resources takes tens of seconds for large devices), with the device file in
+ * place of the XML.
+ *
+ * A compiled architecture records the digest of the XML file it was compiled from
+ * (the architecture_id), and the options the expansion depends on (timing analysis,
+ * power estimation). ReadCompiledArch() only loads it if they all match, so a stale
+ * compiled architecture is detected and the XML can be read instead.
+ *
+ * The file is a vtr::FlatBlobWriter blob, only portable between builds of the same
+ * VTR version on hosts with the same endianness and type sizes.
+ *
+ * Example:
+ *
+ *      if (!ReadCompiledArch(compiled_file, arch_file, timing_enabled, &arch, physical_types, logical_types)) {
+ *          XmlReadArch(arch_file, timing_enabled, &arch, physical_types, logical_types);
+ *          WriteCompiledArch(compiled_file, arch, physical_types, logical_types, timing_enabled);
+ *      }
+ */
+
+#include <vector>
+
+#include "physical_types.h"
+
+/**
+ * @brief Writes the architecture read by XmlReadArch() to compiled_file
+ *
+ * Must be called before the pb_graphs of the logical types are built, since they are not
+ * stored (the pb_graph is still built from the loaded pb_types). Throws vtr::VtrError on failure.
+ */
+void WriteCompiledArch(const char* compiled_file,
+                       const t_arch& arch,
+                       const std::vector<t_physical_tile_type>& PhysicalTileTypes,
+                       const std::vector<t_logical_block_type>& LogicalBlockTypes,
+                       bool timing_enabled);
+
+/**
+ * @brief Loads the architecture compiled from arch_file, as XmlReadArch() would have read it
+ *
+ * arch is expected to be newly constructed (except for arch->power and arch->clocks, which
+ * are allocated beforehand if power estimation is enabled, as for XmlReadArch()) and the
+ * type vectors empty.
+ *
+ * Returns false (leaving arch and the types unchanged) if compiled_file is not a valid
+ * compiled architecture, or was not compiled from the current contents of arch_file with
+ * the same timing and power options.
+ */
+bool ReadCompiledArch(const char* compiled_file,
+                      const char* arch_file,
+                      bool timing_enabled,
+                      t_arch* arch,
+                      std::vector<t_physical_tile_type>& PhysicalTileTypes,
+                      std::vector<t_logical_block_type>& LogicalBlockTypes);
+
+#endif
@@ -1,8 +1,13 @@
 #include "device_grid.h"
 
+#include <unordered_map>
+
+#include "vtr_assert.h"
+
 DeviceGrid::DeviceGrid(std::string grid_name, vtr::NdMatrix<t_grid_tile, 3> grid)
     : name_(grid_name)
     , grid_(grid) {
+    pack_tiles();
     count_instances();
 }
 
@@ -42,9 +47,36 @@ size_t DeviceGrid::num_instances(t_physical_tile_type_ptr type, int layer_num) c
 
 void DeviceGrid::clear() {
     grid_.clear();
+    packed_tiles_.clear();
+    tile_types_.clear();
     instance_counts_.clear();
 }
 
+void DeviceGrid::pack_tiles() {
+    tile_types_.clear();
+    packed_tiles_.resize(std::array<size_t, 3>{grid_.dim_size(0), grid_.dim_size(1), grid_.dim_size(2)});
+
+    std::unordered_map<t_physical_tile_type_ptr, uint32_t> type_indices;
+    for (size_t i = 0; i < grid_.size(); ++i) {
+        const t_grid_tile& tile = grid_.get(i);
+
+        auto result = type_indices.emplace(tile.type, tile_types_.size());
+        if (result.second) {
+            tile_types_.push_back(tile.type);
+        }
+        uint32_t type_index = result.first->second;
+
+        VTR_ASSERT_MSG(type_index <= PACKED_TYPE_MASK, "Too many tile types to pack the device grid");
+        VTR_ASSERT_MSG(tile.width_offset >= 0 && uint32_t(tile.width_offset) <= PACKED_OFFSET_MASK, "Tile width offset too large to pack the device grid");
+        VTR_ASSERT_MSG(tile.height_offset >= 0 && uint32_t(tile.height_offset) <= PACKED_OFFSET_MASK, "Tile height offset too large to pack the device grid");
+
+        //packed_tiles_ and grid_ have the same dimensions, so share the same flat indices
+        packed_tiles_.get(i) = type_index
+                               | (uint32_t(tile.width_offset) << PACKED_WIDTH_OFFSET_SHIFT)
+                               | (uint32_t(tile.height_offset) << PACKED_HEIGHT_OFFSET_SHIFT);
+    }
+}
+
 void DeviceGrid::count_instances() {
     int num_layers = (int)grid_.dim_size(0);
     instance_counts_.clear();
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <cstdint>
 #include "vtr_ndmatrix.h"
 #include "physical_types.h"
 
@@ -58,19 +59,27 @@ class DeviceGrid {
      */
     std::vector<t_logical_block_type_ptr> limiting_resources() const { return limiting_resources_; }
 
+    ///@brief Sets the block types which limit the device size
+    void set_limiting_resources(std::vector<t_logical_block_type_ptr> limiting_res) { limiting_resources_ = std::move(limiting_res); }
+
     ///@brief Return the t_physical_tile_type_ptr at the specified location
     inline t_physical_tile_type_ptr get_physical_type(const t_physical_tile_loc& tile_loc) const {
-        return grid_[tile_loc.layer_num][tile_loc.x][tile_loc.y].type;
+        return tile_types_[packed_tiles_[tile_loc.layer_num][tile_loc.x][tile_loc.y] & PACKED_TYPE_MASK];
     }
 
     ///@brief Return the width offset of the tile at the specified location. The root location of the tile is where width_offset and height_offset are 0.
     inline int get_width_offset(const t_physical_tile_loc& tile_loc) const {
-        return grid_[tile_loc.layer_num][tile_loc.x][tile_loc.y].width_offset;
+        return (packed_tiles_[tile_loc.layer_num][tile_loc.x][tile_loc.y] >> PACKED_WIDTH_OFFSET_SHIFT) & PACKED_OFFSET_MASK;
     }
 
     ///@brief Return the height offset of the tile at the specified location. The root location of the tile is where width_offset and height_offset are 0
     inline int get_height_offset(const t_physical_tile_loc& tile_loc) const {
-        return grid_[tile_loc.layer_num][tile_loc.x][tile_loc.y].height_offset;
+        return (packed_tiles_[tile_loc.layer_num][tile_loc.x][tile_loc.y] >> PACKED_HEIGHT_OFFSET_SHIFT) & PACKED_OFFSET_MASK;
+    }
+
+    ///@brief Return true if the specified location is the root location of its tile (i.e. both of its offsets are 0)
+    inline bool is_root_location(const t_physical_tile_loc& tile_loc) const {
+        return (packed_tiles_[tile_loc.layer_num][tile_loc.x][tile_loc.y] >> PACKED_WIDTH_OFFSET_SHIFT) == 0;
     }
 
     ///@brief Return the metadata of the tile at the specified location
@@ -109,6 +118,21 @@ class DeviceGrid {
     ///@brief count_instances() counts the number of each tile type on each layer and store it in instance_counts_. It is called in the constructor.
     void count_instances();
 
+    ///@brief pack_tiles() loads packed_tiles_ and tile_types_ from grid_. It is called in the constructor.
+    void pack_tiles();
+
+    /*
+     * A packed tile holds the index of its type in tile_types_ (lowest bits), then its width
+     * offset and height offset.
+     */
+    static constexpr int PACKED_TYPE_BITS = 12;
+    static constexpr int PACKED_OFFSET_BITS = 10;
+    static constexpr int PACKED_WIDTH_OFFSET_SHIFT = PACKED_TYPE_BITS;
+    static constexpr int PACKED_HEIGHT_OFFSET_SHIFT = PACKED_TYPE_BITS + PACKED_OFFSET_BITS;
+    static constexpr uint32_t PACKED_TYPE_MASK = (uint32_t(1) << PACKED_TYPE_BITS) - 1;
+    static constexpr uint32_t PACKED_OFFSET_MASK = (uint32_t(1) << PACKED_OFFSET_BITS) - 1;
+    static_assert(PACKED_TYPE_BITS + 2 * PACKED_OFFSET_BITS == 32, "A packed tile is 32 bits");
+
     std::string name_;
 
     /**
@@ -120,6 +144,16 @@ class DeviceGrid {
      */
     vtr::NdMatrix<t_grid_tile, 3> grid_; //This stores the grid of complex blocks. It is a a 3D matrix: [0..num_layers-1][0..grid.width()-1][0..grid_height()-1]
 
+    /**
+     * @brief packed_tiles_ is a compact copy of the type and offsets of each tile in grid_, which the
+     *        accessors of the tiles read (a packed tile is 4 bytes, where a t_grid_tile is 24).
+     * @note Same dimensions as grid_.
+     */
+    vtr::NdMatrix<uint32_t, 3> packed_tiles_;
+
+    ///@brief tile_types_ are the distinct types of the tiles in grid_, indexed by the type index of a packed tile
+    std::vector<t_physical_tile_type_ptr> tile_types_;
+
     ///@brief instance_counts_ stores the number of each tile type on each layer. It is initialized in count_instances().
     std::vector<std::map<t_physical_tile_type_ptr, size_t>> instance_counts_; /* [layer_num][physical_tile_type_ptr] */
 
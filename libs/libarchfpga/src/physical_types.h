@@ -1696,6 +1696,9 @@ struct t_arch_switch_inf {
     //Returns true if the Tdel value is independent of fanout
     bool fixed_Tdel() const;
 
+    //Returns the delay of each fanin specified (fanin UNDEFINED_FANIN if fixed)
+    const std::map<int, double>& Tdel_map() const { return Tdel_map_; }
+
   public:
     void set_Tdel(int fanin, float delay);
     void set_type(SwitchType type_val);
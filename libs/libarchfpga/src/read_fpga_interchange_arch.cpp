@@ -1,5 +1,4 @@
 #include <algorithm>
-#include <kj/std/iostream.h>
 #include <limits>
 #include <map>
 #include <regex>
@@ -2502,21 +2501,26 @@ void FPGAInterchangeReadArch(const char* FPGAInterchangeDeviceFile,
                              t_arch* arch,
                              std::vector<t_physical_tile_type>& PhysicalTileTypes,
                              std::vector<t_logical_block_type>& LogicalBlockTypes) {
-    // Decompress GZipped capnproto device file
+    // Decompress GZipped capnproto device file, directly into a word aligned buffer
+    // which the message is then read from in place (devices inflate to hundreds of MB)
     gzFile file = gzopen(FPGAInterchangeDeviceFile, "r");
     VTR_ASSERT(file != Z_NULL);
+    gzbuffer(file, 1 << 20);
 
-    std::vector<uint8_t> output_data;
-    output_data.resize(4096);
-    std::stringstream sstream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    std::vector<uint64_t> words(1 << 17);
+    size_t num_bytes = 0;
     while (true) {
-        int ret = gzread(file, output_data.data(), output_data.size());
+        size_t capacity = words.size() * sizeof(uint64_t);
+        if (num_bytes == capacity) {
+            words.resize(2 * words.size());
+            capacity *= 2;
+        }
+        size_t chunk = std::min<size_t>(capacity - num_bytes, 1 << 30);
+        int ret = gzread(file, reinterpret_cast<char*>(words.data()) + num_bytes, chunk);
         VTR_ASSERT(ret >= 0);
         if (ret > 0) {
-            sstream.write((const char*)output_data.data(), ret);
-            VTR_ASSERT(sstream);
+            num_bytes += ret;
         } else {
-            VTR_ASSERT(ret == 0);
             int error;
             gzerror(file, &error);
             VTR_ASSERT(error == Z_OK);
@@ -2526,15 +2530,15 @@ void FPGAInterchangeReadArch(const char* FPGAInterchangeDeviceFile,
 
     VTR_ASSERT(gzclose(file) == Z_OK);
 
-    sstream.seekg(0);
-    kj::std::StdInputStream istream(sstream);
+    VTR_ASSERT(num_bytes % sizeof(uint64_t) == 0);
+    kj::ArrayPtr<const capnp::word> message_words(reinterpret_cast<const capnp::word*>(words.data()), num_bytes / sizeof(uint64_t));
 
     // Reader options
     capnp::ReaderOptions reader_options;
     reader_options.nestingLimit = std::numeric_limits<int>::max();
     reader_options.traversalLimitInWords = std::numeric_limits<uint64_t>::max();
 
-    capnp::InputStreamMessageReader message_reader(istream, reader_options);
+    capnp::FlatArrayMessageReader message_reader(message_words, reader_options);
 
     auto device_reader = message_reader.getRoot<DeviceResources::Device>();
 
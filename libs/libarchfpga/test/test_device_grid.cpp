@@ -0,0 +1,64 @@
+// test framework
+#include "catch2/catch_test_macros.hpp"
+
+#include "device_grid.h"
+
+namespace {
+
+TEST_CASE("DeviceGrid tile accessors", "[DeviceGrid]") {
+    std::vector<t_physical_tile_type> types(3);
+    t_physical_tile_type& empty_type = types[0];
+    t_physical_tile_type& clb_type = types[1];
+    t_physical_tile_type& dsp_type = types[2];
+    empty_type.capacity = 0;
+    clb_type.capacity = 1;
+    dsp_type.capacity = 1;
+    dsp_type.width = 2;
+    dsp_type.height = 3;
+
+    //A 4x4 grid of clbs, with a 2x3 dsp rooted at (1, 0)
+    vtr::NdMatrix<t_grid_tile, 3> tiles({1, 4, 4});
+    for (size_t x = 0; x < 4; ++x) {
+        for (size_t y = 0; y < 4; ++y) {
+            tiles[0][x][y].type = &clb_type;
+        }
+    }
+    tiles[0][0][3].type = &empty_type;
+    for (int x_offset = 0; x_offset < dsp_type.width; ++x_offset) {
+        for (int y_offset = 0; y_offset < dsp_type.height; ++y_offset) {
+            t_grid_tile& tile = tiles[0][1 + x_offset][y_offset];
+            tile.type = &dsp_type;
+            tile.width_offset = x_offset;
+            tile.height_offset = y_offset;
+        }
+    }
+
+    DeviceGrid grid("test", tiles);
+
+    REQUIRE(grid.get_num_layers() == 1);
+    REQUIRE(grid.width() == 4);
+    REQUIRE(grid.height() == 4);
+
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            const t_grid_tile& tile = tiles[0][x][y];
+            REQUIRE(grid.get_physical_type({x, y, 0}) == tile.type);
+            REQUIRE(grid.get_width_offset({x, y, 0}) == tile.width_offset);
+            REQUIRE(grid.get_height_offset({x, y, 0}) == tile.height_offset);
+            REQUIRE(grid.is_root_location({x, y, 0}) == (tile.width_offset == 0 && tile.height_offset == 0));
+        }
+    }
+
+    REQUIRE(grid.num_instances(&clb_type, 0) == 9);
+    REQUIRE(grid.num_instances(&dsp_type, -1) == 1);
+    REQUIRE(grid.num_instances(&empty_type, 0) == 0);
+
+    //Copies (e.g. of cached grids) are independent
+    DeviceGrid copy = grid;
+    grid.clear();
+    REQUIRE(copy.get_physical_type({2, 2, 0}) == &dsp_type);
+    REQUIRE(copy.get_width_offset({2, 2, 0}) == 1);
+    REQUIRE(copy.get_height_offset({2, 2, 0}) == 2);
+}
+
+} // namespace
@@ -7,15 +7,19 @@
 
 #include <stdio.h>
 #include <stdarg.h> /* Allows for variable arguments, necessary for wrapping printf */
+#include <atomic>
+#include <string>
 #include "log.h"
 
 #define LOG_DEFAULT_FILE_NAME "output.log"
 
-static int log_warning = 0;
-static int log_error = 0;
+static std::atomic<int> log_warning(0);
+static std::atomic<int> log_error(0);
 FILE* log_stream = nullptr;
 
 static void check_init();
+static std::string format_message(const char* prefix, const char* message, va_list args);
+static void write_message(FILE* stream, const std::string& msg);
 
 /* Set the output file of logger.
  * If different than current log file, close current log file and reopen to new log file
@@ -42,19 +46,19 @@ void log_print_direct(const char* message, ...) {
     va_end(args);
 }
 
+/* The messages are formatted once, and written with a single call per stream, so
+ * the messages of concurrent threads are not interleaved within a message */
 void log_print_info(const char* message, ...) {
     check_init(); /* Check if output log file setup, if not, then this function also sets it up */
 
     va_list args;
     va_start(args, message);
-    vprintf(message, args);
+    std::string msg = format_message("", message, args);
     va_end(args);
 
+    write_message(stdout, msg);
     if (log_stream) {
-        va_start(args, message); /* Must reset variable arguments so that they can be read again */
-        vfprintf(log_stream, message, args);
-        va_end(args);
-
+        write_message(log_stream, msg);
         fflush(log_stream);
     }
 }
@@ -62,20 +66,16 @@ void log_print_info(const char* message, ...) {
 void log_print_warning(const char* /*filename*/, unsigned int /*line_num*/, const char* message, ...) {
     check_init(); /* Check if output log file setup, if not, then this function also sets it up */
 
+    std::string prefix = "Warning " + std::to_string(++log_warning) + ": ";
+
     va_list args;
     va_start(args, message);
-    log_warning++;
-
-    printf("Warning %d: ", log_warning);
-    vprintf(message, args);
+    std::string msg = format_message(prefix.c_str(), message, args);
     va_end(args);
 
+    write_message(stdout, msg);
     if (log_stream) {
-        va_start(args, message); /* Must reset variable arguments so that they can be read again */
-        fprintf(log_stream, "Warning %d: ", log_warning);
-        vfprintf(log_stream, message, args);
-
-        va_end(args);
+        write_message(log_stream, msg);
         fflush(log_stream);
     }
 }
@@ -83,26 +83,43 @@ void log_print_warning(const char* /*filename*/, unsigned int /*line_num*/, cons
 void log_print_error(const char* /*filename*/, unsigned int /*line_num*/, const char* message, ...) {
     check_init(); /* Check if output log file setup, if not, then this function also sets it up */
 
+    std::string prefix = "Error " + std::to_string(++log_error) + ": ";
+
     va_list args;
     va_start(args, message);
-    log_error++;
-
-    check_init();
-    fprintf(stderr, "Error %d: ", log_error);
-    vfprintf(stderr, message, args);
+    std::string msg = format_message(prefix.c_str(), message, args);
     va_end(args);
 
+    write_message(stderr, msg);
     if (log_stream) {
-        va_start(args, message); /* Must reset variable arguments so that they can be read again */
-        fprintf(log_stream, "Error %d: ", log_error);
-        vfprintf(log_stream, message, args);
-
-        va_end(args);
-
+        write_message(log_stream, msg);
         fflush(log_stream);
     }
 }
 
+/**
+ * Returns prefix followed by the formatted message
+ */
+static std::string format_message(const char* prefix, const char* message, va_list args) {
+    std::string msg(prefix);
+    size_t prefix_len = msg.size();
+
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int len = vsnprintf(nullptr, 0, message, args_copy);
+    va_end(args_copy);
+
+    if (len > 0) {
+        msg.resize(prefix_len + len);
+        vsnprintf(&msg[prefix_len], len + 1, message, args);
+    }
+    return msg;
+}
+
+static void write_message(FILE* stream, const std::string& msg) {
+    fwrite(msg.data(), 1, msg.size(), stream);
+}
+
 /**
  * Check if output log file setup, if not, then this function also sets it up
  */
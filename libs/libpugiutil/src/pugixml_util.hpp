@@ -51,6 +51,16 @@ class XmlError : public std::runtime_error {
 loc_data load_xml(pugi::xml_document& doc,     //Document object to be loaded with file contents
                   const std::string filename); //Filename to load from
 
+//Loads the XML fragment of filename held in buffer (which starts on line first_line of the file)
+//into the passed pugi::xml_document
+//
+//Returns loc_data look-up for xml node line numbers (within the file)
+loc_data load_xml(pugi::xml_document& doc,  //Document object to be loaded with the fragment
+                  const std::string filename, //Filename the fragment is from
+                  const char* buffer,         //The fragment
+                  std::size_t size,           //Size of the fragment in bytes
+                  std::size_t first_line);    //Line of filename the fragment starts on
+
 //Defines whether something (e.g. a node/attribute) is optional or required.
 //  We use this to improve clarity at the function call site (compared to just
 //  using boolean values).
@@ -10,6 +10,11 @@
 
 #include "describe_rr_node.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/blocked_range.h>
+#    include <tbb/parallel_for.h>
+#endif
+
 /*********************** Subroutines local to this module *******************/
 
 static bool rr_node_is_global_clb_ipin(const RRGraphView& rr_graph, const DeviceGrid& grid, RRNodeId inode);
@@ -64,20 +69,20 @@ void check_rr_graph(const RRGraphView& rr_graph,
     auto switch_types_from_current_to_node = std::vector<unsigned char>(rr_graph.num_nodes());
     const int num_rr_switches = rr_graph.num_rr_switches();
 
-    std::vector<std::pair<int, int>> edges;
-
-    for (const RRNodeId& rr_node : rr_graph.nodes()) {
+    //Checks a node and its out-going edges. This only reads the RR graph (and
+    //reports errors), so nodes are checked in parallel when possible.
+    auto check_node = [&](RRNodeId rr_node, std::vector<std::pair<int, int>>& edges) {
         size_t inode = (size_t)rr_node;
         rr_graph.validate_node(rr_node);
 
         /* Ignore any uninitialized rr_graph nodes */
         if (!rr_graph.node_is_initialized(rr_node)) {
-            continue;
+            return;
         }
 
         // Virtual clock network sink is special, ignore.
         if (virtual_clock_network_root_idx == int(inode)) {
-            continue;
+            return;
         }
 
         t_rr_type rr_type = rr_graph.node_type(rr_node);
@@ -108,7 +113,6 @@ void check_rr_graph(const RRGraphView& rr_graph,
                           is_flat);
 
             edges.emplace_back(to_node, iedge);
-            total_edges_to_node[to_node]++;
 
             auto switch_type = rr_graph.edge_switch(rr_node, iedge);
 
@@ -176,7 +180,7 @@ void check_rr_graph(const RRGraphView& rr_graph,
             //
             //Identify any such edges with identical switches
             std::map<short, int> switch_counts;
-            for (const auto& to_edge : vtr::Range<decltype(edges)::const_iterator>(range.first, range.second)) {
+            for (const auto& to_edge : vtr::Range<std::vector<std::pair<int, int>>::const_iterator>(range.first, range.second)) {
                 auto edge = to_edge.second;
                 auto edge_switch = rr_graph.edge_switch(rr_node, edge);
 
@@ -218,7 +222,31 @@ void check_rr_graph(const RRGraphView& rr_graph,
             }
         }
 
-    } /* End for all rr_nodes */
+    };
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, rr_graph.num_nodes()), [&](const tbb::blocked_range<size_t>& nodes) {
+        std::vector<std::pair<int, int>> edges;
+        for (size_t inode = nodes.begin(); inode != nodes.end(); ++inode) {
+            check_node(RRNodeId(inode), edges);
+        }
+    });
+#else
+    std::vector<std::pair<int, int>> edges;
+    for (const RRNodeId& rr_node : rr_graph.nodes()) {
+        check_node(rr_node, edges);
+    }
+#endif
+
+    //Count the edges to every node (all sink nodes were range checked above)
+    for (const RRNodeId& rr_node : rr_graph.nodes()) {
+        if (!rr_graph.node_is_initialized(rr_node) || virtual_clock_network_root_idx == int(size_t(rr_node))) {
+            continue;
+        }
+        for (t_edge_size iedge = 0; iedge < rr_graph.num_edges(rr_node); iedge++) {
+            total_edges_to_node[size_t(rr_graph.edge_sink_node(rr_node, iedge))]++;
+        }
+    }
 
     // AM: For the time being, if is_flat is enabled, we don't have proper tests to check whether a node should have an incoming
     // edge or not
@@ -1,8 +1,114 @@
 #ifndef _METADATA_STORAGE_H_
 #define _METADATA_STORAGE_H_
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+#include "physical_types.h"
+#include "vtr_array_view.h"
 #include "vtr_string_interning.h"
 
+/**
+ * @brief A view of the metadata of one lookup key of a MetadataStorage
+ *
+ * Provides the lookups of a t_metadata_dict, and iterates over t_entry's
+ * holding a metadata name (first) and its values (second).
+ */
+class t_metadata_storage_dict {
+  public:
+    typedef vtr::array_view<const t_metadata_value> t_values;
+
+    struct t_entry {
+        vtr::interned_string first;
+        t_values second;
+    };
+
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = t_entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const t_entry*;
+        using reference = t_entry;
+
+        const_iterator(const t_metadata_storage_dict* dict, size_t iname)
+            : dict_(dict)
+            , iname_(iname) {}
+
+        t_entry operator*() const { return dict_->entry(iname_); }
+
+        const_iterator& operator++() {
+            ++iname_;
+            return *this;
+        }
+
+        bool operator==(const const_iterator& other) const { return iname_ == other.iname_; }
+        bool operator!=(const const_iterator& other) const { return iname_ != other.iname_; }
+
+      private:
+        const t_metadata_storage_dict* dict_;
+        size_t iname_;
+    };
+
+    t_metadata_storage_dict() = default;
+
+    /**
+     * @brief Views num_names (sorted) names, where the values of names[i] are
+     *        values[value_offsets[i]] to values[value_offsets[i + 1] - 1]
+     */
+    t_metadata_storage_dict(const vtr::interned_string* names, const uint32_t* value_offsets, const t_metadata_value* values, size_t num_names)
+        : names_(names)
+        , value_offsets_(value_offsets)
+        , values_(values)
+        , num_names_(num_names) {}
+
+    size_t size() const { return num_names_; }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, num_names_); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    t_entry entry(size_t iname) const {
+        return t_entry{names_[iname], t_values(values_ + value_offsets_[iname], value_offsets_[iname + 1] - value_offsets_[iname])};
+    }
+
+    // Is this key present in the dict?
+    bool has(vtr::interned_string key) const {
+        return find_name(key) != num_names_;
+    }
+
+    // Get metadata value matching key.
+    //
+    // Returns nullptr if key is not found or if multiple values are present
+    // per key.
+    const t_metadata_value* one(vtr::interned_string key) const {
+        size_t iname = find_name(key);
+        if (iname == num_names_ || value_offsets_[iname + 1] - value_offsets_[iname] != 1) {
+            return nullptr;
+        }
+        return &values_[value_offsets_[iname]];
+    }
+
+  private:
+    size_t find_name(vtr::interned_string key) const {
+        const vtr::interned_string* name = std::lower_bound(names_, names_ + num_names_, key, vtr::interned_string_less());
+        if (name == names_ + num_names_ || *name != key) {
+            return num_names_;
+        }
+        return name - names_;
+    }
+
+    const vtr::interned_string* names_ = nullptr;
+    const uint32_t* value_offsets_ = nullptr;
+    const t_metadata_value* values_ = nullptr;
+    size_t num_names_ = 0;
+};
+
 /**
  * MetadataStorage is a two phase data structure.  In the first phase,
  * metadata is added cheaply by simply pushing onto a vector.  This is
@@ -14,102 +120,187 @@
  * In the event that the lookup is never needed, this saves the time spent
  * building the lookup, and reduces the number of outstanding memory
  * allocations dramatically.
+ *
+ * The lookup is stored in a compressed sparse row (CSR) layout: the sorted
+ * lookup keys, the range of metadata names of each key, and the range of
+ * values of each name.  Besides the offsets, a metadata entry only costs its
+ * interned name and value, instead of a t_metadata_dict (with its heap
+ * allocations) per lookup key.
  */
 template<typename LookupKey>
 class MetadataStorage {
   public:
+    ///@brief A lookup key and its metadata
+    struct t_lookup_entry {
+        LookupKey first;
+        t_metadata_storage_dict second;
+    };
+
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = t_lookup_entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const t_lookup_entry*;
+        using reference = const t_lookup_entry&;
+
+        const_iterator(const MetadataStorage* storage, size_t ikey)
+            : storage_(storage)
+            , ikey_(ikey) {}
+
+        const t_lookup_entry& operator*() const {
+            entry_ = storage_->lookup_entry(ikey_);
+            return entry_;
+        }
+        const t_lookup_entry* operator->() const { return &**this; }
+
+        const_iterator& operator++() {
+            ++ikey_;
+            return *this;
+        }
+
+        bool operator==(const const_iterator& other) const { return ikey_ == other.ikey_; }
+        bool operator!=(const const_iterator& other) const { return ikey_ != other.ikey_; }
+
+      private:
+        const MetadataStorage* storage_;
+        size_t ikey_;
+        mutable t_lookup_entry entry_;
+    };
+
     void reserve(size_t s) {
-        VTR_ASSERT(map_.empty());
+        VTR_ASSERT(keys_.empty());
         data_.reserve(s);
     }
     void add_metadata(const LookupKey& lookup_key, vtr::interned_string meta_key, vtr::interned_string meta_value) {
         // Can only add metadata prior to building the map.
-        VTR_ASSERT(map_.empty());
+        VTR_ASSERT(keys_.empty());
         data_.push_back(std::make_tuple(lookup_key, meta_key, meta_value));
     }
 
     // Use the given mapping function to change the keys
     void remap_keys(std::function<LookupKey(LookupKey)> key_map) {
-        if (map_.empty()) {
+        if (keys_.empty()) {
             for (auto& entry : data_) {
                 std::get<0>(entry) = key_map(std::get<0>(entry));
             }
         } else {
             VTR_ASSERT(data_.empty());
-            for (auto& dict : map_) {
-                for (auto& entry : dict.second) {
-                    for (auto& value : entry.second) {
-                        data_.push_back(std::make_tuple(key_map(dict.first), entry.first, value.as_string()));
+            data_.reserve(values_.size());
+            for (size_t ikey = 0; ikey < keys_.size(); ++ikey) {
+                for (uint32_t iname = key_offsets_[ikey]; iname < key_offsets_[ikey + 1]; ++iname) {
+                    for (uint32_t ivalue = value_offsets_[iname]; ivalue < value_offsets_[iname + 1]; ++ivalue) {
+                        data_.push_back(std::make_tuple(key_map(keys_[ikey]), names_[iname], values_[ivalue].as_string()));
                     }
                 }
             }
-            map_.clear();
+            clear_map();
             build_map();
         }
     }
 
-    typename vtr::flat_map<LookupKey, t_metadata_dict>::const_iterator find(const LookupKey& lookup_key) const {
+    const_iterator find(const LookupKey& lookup_key) const {
         check_for_map();
 
-        return map_.find(lookup_key);
+        auto iter = std::lower_bound(keys_.begin(), keys_.end(), lookup_key);
+        if (iter == keys_.end() || *iter != lookup_key) {
+            return end();
+        }
+        return const_iterator(this, iter - keys_.begin());
     }
 
     void clear() {
         data_.clear();
-        map_.clear();
+        clear_map();
     }
 
     size_t size() const {
         check_for_map();
-        return map_.size();
+        return keys_.size();
     }
 
-    typename vtr::flat_map<LookupKey, t_metadata_dict>::const_iterator begin() const {
+    const_iterator begin() const {
         check_for_map();
-        return map_.begin();
+        return const_iterator(this, 0);
     }
 
-    typename vtr::flat_map<LookupKey, t_metadata_dict>::const_iterator end() const {
+    const_iterator end() const {
         check_for_map();
-        return map_.end();
+        return const_iterator(this, keys_.size());
     }
 
   private:
+    t_lookup_entry lookup_entry(size_t ikey) const {
+        uint32_t first_name = key_offsets_[ikey];
+        return t_lookup_entry{keys_[ikey],
+                              t_metadata_storage_dict(names_.data() + first_name,
+                                                      value_offsets_.data() + first_name,
+                                                      values_.data(),
+                                                      key_offsets_[ikey + 1] - first_name)};
+    }
+
     // Check to see if the map has been built yet, builds it if it hasn't been
     // built.
     void check_for_map() const {
-        if (map_.empty() && !data_.empty()) {
+        if (keys_.empty() && !data_.empty()) {
             build_map();
         }
     }
 
-    // Constructs the metadata lookup map from the flat data.
+    void clear_map() {
+        keys_.clear();
+        key_offsets_.clear();
+        names_.clear();
+        value_offsets_.clear();
+        values_.clear();
+    }
+
+    // Constructs the metadata lookup from the flat data.
     void build_map() const {
         VTR_ASSERT(!data_.empty());
-        VTR_ASSERT(map_.empty());
+        VTR_ASSERT(keys_.empty());
 
-        std::sort(data_.begin(), data_.end(), [](const std::tuple<LookupKey, vtr::interned_string, vtr::interned_string>& lhs, const std::tuple<LookupKey, vtr::interned_string, vtr::interned_string>& rhs) {
-            return std::get<0>(lhs) < std::get<0>(rhs);
+        vtr::interned_string_less name_less;
+        std::sort(data_.begin(), data_.end(), [&](const std::tuple<LookupKey, vtr::interned_string, vtr::interned_string>& lhs, const std::tuple<LookupKey, vtr::interned_string, vtr::interned_string>& rhs) {
+            if (std::get<0>(lhs) != std::get<0>(rhs)) {
+                return std::get<0>(lhs) < std::get<0>(rhs);
+            }
+            return name_less(std::get<1>(lhs), std::get<1>(rhs));
         });
 
-        std::vector<typename vtr::flat_map<LookupKey, t_metadata_dict>::value_type> storage;
-        storage.push_back(std::make_pair(std::get<0>(data_[0]), t_metadata_dict()));
+        values_.reserve(data_.size());
         for (const auto& value : data_) {
-            if (storage.back().first != std::get<0>(value)) {
-                storage.push_back(std::make_pair(std::get<0>(value), t_metadata_dict()));
+            if (keys_.empty() || keys_.back() != std::get<0>(value)) {
+                keys_.push_back(std::get<0>(value));
+                key_offsets_.push_back(names_.size());
             }
-
-            storage.back().second.add(std::get<1>(value), std::get<2>(value));
+            if (names_.size() == key_offsets_.back() || names_.back() != std::get<1>(value)) {
+                names_.push_back(std::get<1>(value));
+                value_offsets_.push_back(values_.size());
+            }
+            values_.emplace_back(std::get<2>(value));
         }
+        key_offsets_.push_back(names_.size());
+        value_offsets_.push_back(values_.size());
 
-        map_.assign_sorted(std::move(storage));
+        keys_.shrink_to_fit();
+        key_offsets_.shrink_to_fit();
+        names_.shrink_to_fit();
+        value_offsets_.shrink_to_fit();
 
         data_.clear();
         data_.shrink_to_fit();
     }
 
     mutable std::vector<std::tuple<LookupKey, vtr::interned_string, vtr::interned_string>> data_;
-    mutable vtr::flat_map<LookupKey, t_metadata_dict> map_;
+
+    // The CSR lookup: the names of keys_[i] are names_[key_offsets_[i]] to names_[key_offsets_[i + 1] - 1],
+    // and the values of names_[j] are values_[value_offsets_[j]] to values_[value_offsets_[j + 1] - 1].
+    mutable std::vector<LookupKey> keys_;
+    mutable std::vector<uint32_t> key_offsets_;
+    mutable std::vector<vtr::interned_string> names_;
+    mutable std::vector<uint32_t> value_offsets_;
+    mutable std::vector<t_metadata_value> values_;
 };
 
 #endif /* _METADATA_STORAGE_H_ */
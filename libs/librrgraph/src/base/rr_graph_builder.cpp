@@ -1,8 +1,14 @@
 #include "vtr_log.h"
 #include "rr_graph_builder.h"
 #include "vtr_time.h"
+#include "vtr_math.h"
+#include "vtr_parallel.h"
 #include <queue>
 #include <random>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_sort.h>
+#endif
 //#include <algorithm>
 
 //#include "globals.h"
@@ -131,14 +137,40 @@ void RRGraphBuilder::reorder_nodes(e_rr_node_reorder_algorithm reorder_rr_graph_
     } else if (reorder_rr_graph_nodes_algorithm == RANDOM_SHUFFLE) {
         std::mt19937 g(reorder_rr_graph_nodes_seed);
         std::shuffle(src_order.begin(), src_order.end(), g);
+    } else if (reorder_rr_graph_nodes_algorithm == SPATIAL_HILBERT) {
+        // Nodes are laid out by layer, then by the Hilbert index of their low corner, then by type,
+        // so the nodes of a tile (and of the nearby tiles, which the router expands next) are
+        // close in memory. The keys are unique (the old id breaks ties), so the parallel sort
+        // gives the same order whatever the number of threads.
+        constexpr int HILBERT_ORDER = 16; // Covers the (short) coordinates of any node
+        std::vector<std::pair<uint64_t, RRNodeId>> keys(v_num);
+        vtr::parallel_for(0, v_num, [&](size_t i) {
+            RRNodeId node(i);
+            uint64_t key = uint64_t(uint8_t(node_storage_.node_layer(node))) << 56;
+            key |= vtr::hilbert_index(uint16_t(node_storage_.node_xlow(node)), uint16_t(node_storage_.node_ylow(node)), HILBERT_ORDER) << 24;
+            key |= uint64_t(node_storage_.node_type(node)) << 20;
+            keys[i] = std::make_pair(key, node);
+        });
+#ifdef VPR_USE_TBB
+        tbb::parallel_sort(keys.begin(), keys.end());
+#else
+        std::sort(keys.begin(), keys.end());
+#endif
+        vtr::parallel_for(0, v_num, [&](size_t i) {
+            src_order[RRNodeId(i)] = keys[i].second;
+        });
     }
     vtr::vector<RRNodeId, RRNodeId> dest_order(v_num);
-    cur_idx = 0;
-    for (auto u : src_order)
-        dest_order[u] = RRNodeId(cur_idx++);
+    vtr::parallel_for(0, v_num, [&](size_t i) {
+        dest_order[src_order[RRNodeId(i)]] = RRNodeId(i);
+    });
 
     VTR_ASSERT_SAFE(node_storage_.validate(rr_switch_inf_));
     node_storage_.reorder(dest_order, src_order);
+    if (reorder_rr_graph_nodes_algorithm == SPATIAL_HILBERT) {
+        // Also visit the fan-out of each node in memory order
+        node_storage_.sort_edges_by_dest_node(rr_switch_inf_);
+    }
     VTR_ASSERT_SAFE(node_storage_.validate(rr_switch_inf_));
 
     node_lookup().reorder(dest_order);
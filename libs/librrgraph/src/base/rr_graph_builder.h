@@ -54,20 +54,24 @@ class RRGraphBuilder {
         return rr_edge_metadata_.size();
     }
     /** @brief Find the node in rr_node_metadata */
-    inline vtr::flat_map<int, t_metadata_dict>::const_iterator find_rr_node_metadata(const int& lookup_key) const {
+    inline MetadataStorage<int>::const_iterator find_rr_node_metadata(const int& lookup_key) const {
         return rr_node_metadata_.find(lookup_key);
     }
     /** @brief Find the edge in rr_edge_metadata */
-    inline vtr::flat_map<std::tuple<int, int, short int>, t_metadata_dict>::const_iterator find_rr_edge_metadata(const std::tuple<int, int, short int>& lookup_key) const {
+    inline MetadataStorage<std::tuple<int, int, short>>::const_iterator find_rr_edge_metadata(const std::tuple<int, int, short int>& lookup_key) const {
         return rr_edge_metadata_.find(lookup_key);
     }
+    /** @brief Return the first edge in rr_edge_metadata */
+    inline MetadataStorage<std::tuple<int, int, short>>::const_iterator begin_rr_edge_metadata() const {
+        return rr_edge_metadata_.begin();
+    }
     /** @brief Return the last node in rr_node_metadata */
-    inline vtr::flat_map<int, t_metadata_dict>::const_iterator end_rr_node_metadata() const {
+    inline MetadataStorage<int>::const_iterator end_rr_node_metadata() const {
         return rr_node_metadata_.end();
     }
 
     /** @brief Return the last edge in rr_edge_metadata */
-    inline vtr::flat_map<std::tuple<int, int, short int>, t_metadata_dict>::const_iterator end_rr_edge_metadata() const {
+    inline MetadataStorage<std::tuple<int, int, short>>::const_iterator end_rr_edge_metadata() const {
         return rr_edge_metadata_.end();
     }
 
@@ -142,6 +146,9 @@ class RRGraphBuilder {
      * Reorder RRNodeId's using one of these algorithms:
      *   - DEGREE_BFS: Order by degree primarily, and BFS traversal order secondarily.
      *   - RANDOM_SHUFFLE: Shuffle using the specified seed. Great for testing.
+     *   - SPATIAL_HILBERT: Order by layer, then along a Hilbert curve over the (xlow, ylow) node
+     *     locations, then by node type; the out-going edges of each node are then sorted by
+     *     (new) destination node. The sort is parallel (with TBB), so it scales to large graphs.
      * The DEGREE_BFS algorithm was selected because it had the best performance of seven
      * existing algorithms here: https://github.com/SymbiFlow/vtr-rrgraph-reordering-tool
      * It might be worth further research, as the DEGREE_BFS algorithm is simple and
@@ -336,6 +343,34 @@ class RRGraphBuilder {
         node_storage_.init_fan_in();
     }
 
+    /** @brief Init the per node incoming edge lists (see RRGraphView::node_fan_in_edges).
+     * Should only be called after the RR graph edges have been partitioned.
+     * @note
+     * This is an O(N) operation which also adds one RREdgeId of memory per edge,
+     * so it should only be called by algorithms that walk the RR graph backwards.
+     * It does nothing if the lists are already built. */
+    inline void init_fan_in_edges() {
+        node_storage_.init_fan_in_edges();
+    }
+
+    /** @brief Init the packed (sink node, switch) edge array read by the router inner loop.
+     * Should only be called once the RR graph is complete (edges partitioned and switches remapped).
+     * @note
+     * This costs 8 bytes of memory per edge, so it is only built on request.
+     * It does nothing if the array is already built. */
+    inline void init_hot_edges() {
+        node_storage_.init_hot_edges();
+    }
+
+    /** @brief Release the per edge source node array, which can be recomputed from the partitioned edges.
+     * Should only be called once the RR graph is complete (edges partitioned).
+     * @note
+     * This saves one RRNodeId of memory per edge, but RRGraphView::edge_src_node becomes a binary search.
+     * The array is rebuilt if edges are later added (see reset_rr_graph_flags) or nodes re-ordered. */
+    inline void compress_edge_src_nodes() {
+        node_storage_.compress_edge_src_nodes();
+    }
+
     /** @brief Disable the flags which would prevent adding adding extra-resources, when flat-routing
      * is enabled, to the RR Graph
      * @note
@@ -343,6 +378,7 @@ class RRGraphBuilder {
      * are already added. This function disables the flags which would prevent adding extra-resources to the RR Graph
      */
     inline void reset_rr_graph_flags() {
+        node_storage_.expand_edge_src_nodes();
         node_storage_.edges_read_ = false;
         node_storage_.partitioned_ = false;
         node_storage_.remapped_edges_ = false;
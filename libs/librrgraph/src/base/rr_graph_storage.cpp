@@ -4,7 +4,10 @@
 
 #include <algorithm>
 
+#include "vtr_memory_usage.h"
+
 void t_rr_graph_storage::reserve_edges(size_t num_edges) {
+    expand_edge_src_nodes();
     edge_src_node_.reserve(num_edges);
     edge_dest_node_.reserve(num_edges);
     edge_switch_.reserve(num_edges);
@@ -20,6 +23,28 @@ void t_rr_graph_storage::emplace_back_edge(RRNodeId src, RRNodeId dest, short ed
     edge_remapped_.emplace_back(remapped);
 }
 
+void t_rr_graph_storage::load_edges(vtr::array_view<const RRNodeId> src_nodes,
+                                    vtr::array_view<const RRNodeId> dest_nodes,
+                                    vtr::array_view<const short> switches,
+                                    std::shared_ptr<const void> mapped_data) {
+    // Cannot mutate edges once edges have been read!
+    VTR_ASSERT(!edges_read_);
+    VTR_ASSERT(src_nodes.size() == dest_nodes.size() && src_nodes.size() == switches.size());
+
+    edge_src_nodes_compressed_ = false;
+    if (mapped_data) {
+        mapped_data_ = mapped_data;
+        edge_src_node_.view(src_nodes);
+        edge_dest_node_.view(dest_nodes);
+        edge_switch_.view(switches);
+    } else {
+        edge_src_node_.assign(src_nodes.begin(), src_nodes.end());
+        edge_dest_node_.assign(dest_nodes.begin(), dest_nodes.end());
+        edge_switch_.assign(switches.begin(), switches.end());
+    }
+    edge_remapped_.assign(switches.size(), true);
+}
+
 // Typical node to edge ratio.  This allows a preallocation guess for the edges
 // to avoid repeated reallocation.
 constexpr size_t kEdgeToNodeRatio = 10;
@@ -82,9 +107,9 @@ struct edge_swapper {
 
         RREdgeId edge(idx_);
         RREdgeId other_edge(other.idx_);
-        storage_->edge_src_node_[edge] = storage_->edge_src_node_[other_edge];
-        storage_->edge_dest_node_[edge] = storage_->edge_dest_node_[other_edge];
-        storage_->edge_switch_[edge] = storage_->edge_switch_[other_edge];
+        storage_->edge_src_node_.mut(edge) = storage_->edge_src_node_[other_edge];
+        storage_->edge_dest_node_.mut(edge) = storage_->edge_dest_node_[other_edge];
+        storage_->edge_switch_.mut(edge) = storage_->edge_switch_[other_edge];
         storage_->edge_remapped_[edge] = storage_->edge_remapped_[other_edge];
         return *this;
     }
@@ -92,9 +117,9 @@ struct edge_swapper {
     edge_swapper& operator=(const t_rr_edge_info& edge) {
         VTR_ASSERT(idx_ < storage_->edge_src_node_.size());
 
-        storage_->edge_src_node_[RREdgeId(idx_)] = RRNodeId(edge.from_node);
-        storage_->edge_dest_node_[RREdgeId(idx_)] = RRNodeId(edge.to_node);
-        storage_->edge_switch_[RREdgeId(idx_)] = edge.switch_type;
+        storage_->edge_src_node_.mut(RREdgeId(idx_)) = RRNodeId(edge.from_node);
+        storage_->edge_dest_node_.mut(RREdgeId(idx_)) = RRNodeId(edge.to_node);
+        storage_->edge_switch_.mut(RREdgeId(idx_)) = edge.switch_type;
         storage_->edge_remapped_[RREdgeId(idx_)] = edge.remapped;
         return *this;
     }
@@ -118,9 +143,9 @@ struct edge_swapper {
         RREdgeId a_edge(a.idx_);
         RREdgeId b_edge(b.idx_);
 
-        std::swap(a.storage_->edge_src_node_[a_edge], a.storage_->edge_src_node_[b_edge]);
-        std::swap(a.storage_->edge_dest_node_[a_edge], a.storage_->edge_dest_node_[b_edge]);
-        std::swap(a.storage_->edge_switch_[a_edge], a.storage_->edge_switch_[b_edge]);
+        std::swap(a.storage_->edge_src_node_.mut(a_edge), a.storage_->edge_src_node_.mut(b_edge));
+        std::swap(a.storage_->edge_dest_node_.mut(a_edge), a.storage_->edge_dest_node_.mut(b_edge));
+        std::swap(a.storage_->edge_switch_.mut(a_edge), a.storage_->edge_switch_.mut(b_edge));
         std::vector<bool>::swap(a.storage_->edge_remapped_[a_edge], a.storage_->edge_remapped_[b_edge]);
     }
 
@@ -385,7 +410,7 @@ bool t_rr_graph_storage::verify_first_edges() const {
     // Each edge should belong with the edge range defined by
     // [node_first_edge_[src_node], node_first_edge_[src_node+1]).
     for (size_t iedge = 0; iedge < num_edges; ++iedge) {
-        RRNodeId src_node = edge_src_node_.at(RREdgeId(iedge));
+        RRNodeId src_node = edge_src_node_[RREdgeId(iedge)];
         RREdgeId first_edge = node_first_edge_.at(src_node);
         RREdgeId second_edge = node_first_edge_.at(RRNodeId(size_t(src_node) + 1));
         VTR_ASSERT(iedge >= size_t(first_edge));
@@ -406,6 +431,83 @@ void t_rr_graph_storage::init_fan_in() {
     }
 }
 
+void t_rr_graph_storage::init_fan_in_edges() {
+    VTR_ASSERT(partitioned_);
+    if (fan_in_edges_initialized()) {
+        return;
+    }
+
+    edges_read_ = true;
+
+    //Count the fan-in of each node, offset by one so the prefix sum below
+    //yields the first fan-in edge of each node
+    node_first_fan_in_edge_.resize(node_storage_.size() + 1, 0);
+    for (const auto& edge_id : edge_dest_node_.keys()) {
+        node_first_fan_in_edge_[RRNodeId(size_t(edge_dest_node_[edge_id]) + 1)] += 1;
+    }
+    for (size_t inode = 1; inode < node_first_fan_in_edge_.size(); ++inode) {
+        node_first_fan_in_edge_[RRNodeId(inode)] += node_first_fan_in_edge_[RRNodeId(inode - 1)];
+    }
+
+    //Scatter the edges into their sink node's fan-in list
+    std::vector<uint32_t> next_fan_in_edge(node_first_fan_in_edge_.begin(), node_first_fan_in_edge_.end() - 1);
+    fan_in_edges_.resize(edge_dest_node_.size());
+    for (const auto& edge_id : edge_dest_node_.keys()) {
+        fan_in_edges_[next_fan_in_edge[size_t(edge_dest_node_[edge_id])]++] = edge_id;
+    }
+}
+
+void t_rr_graph_storage::compress_edge_src_nodes() {
+    VTR_ASSERT(partitioned_);
+    if (edge_src_nodes_compressed_) {
+        return;
+    }
+
+    edges_read_ = true;
+
+    //Swap with an empty vector, since clear() and shrink_to_fit() may not release the memory
+    vtr::mapped_vector<RREdgeId, RRNodeId>().swap(edge_src_node_);
+    edge_src_nodes_compressed_ = true;
+}
+
+void t_rr_graph_storage::expand_edge_src_nodes() {
+    if (!edge_src_nodes_compressed_) {
+        return;
+    }
+
+    edge_src_node_.resize(edge_dest_node_.size());
+    for (size_t inode = 0; inode < node_storage_.size(); ++inode) {
+        RRNodeId node(inode);
+        for (size_t iedge = size_t(first_edge(node)); iedge < size_t(last_edge(node)); ++iedge) {
+            edge_src_node_.mut(RREdgeId(iedge)) = node;
+        }
+    }
+    edge_src_nodes_compressed_ = false;
+}
+
+RRNodeId t_rr_graph_storage::find_edge_src_node(RREdgeId edge) const {
+    //node_first_edge_ is non-decreasing (with a final entry equal to the number of edges),
+    //so the source is the last node whose first edge is not after edge
+    auto itr = std::upper_bound(node_first_edge_.begin(), node_first_edge_.end(), edge);
+    VTR_ASSERT_SAFE(itr != node_first_edge_.begin());
+    return RRNodeId(std::distance(node_first_edge_.begin(), itr) - 1);
+}
+
+void t_rr_graph_storage::init_hot_edges() {
+    VTR_ASSERT(partitioned_);
+    VTR_ASSERT(remapped_edges_);
+    if (hot_edges_initialized()) {
+        return;
+    }
+
+    edges_read_ = true;
+
+    edge_hot_.resize(edge_dest_node_.size());
+    for (const auto& edge_id : edge_dest_node_.keys()) {
+        edge_hot_[edge_id] = {edge_dest_node_[edge_id], edge_switch_[edge_id]};
+    }
+}
+
 size_t t_rr_graph_storage::count_rr_switches(
     const std::vector<t_arch_switch_inf>& arch_switch_inf,
     t_arch_switch_fanin& arch_switch_fanins) {
@@ -485,7 +587,7 @@ void t_rr_graph_storage::remap_rr_node_switch_indices(const t_arch_switch_fanin&
     edges_read_ = true;
 
     VTR_ASSERT(!remapped_edges_);
-    for (size_t i = 0; i < edge_src_node_.size(); ++i) {
+    for (size_t i = 0; i < edge_dest_node_.size(); ++i) {
         RREdgeId edge(i);
         if(edge_remapped_[edge]) {
             continue;
@@ -504,7 +606,7 @@ void t_rr_graph_storage::remap_rr_node_switch_indices(const t_arch_switch_fanin&
 
         int rr_switch_index = itr->second;
 
-        edge_switch_[edge] = rr_switch_index;
+        edge_switch_.mut(edge) = rr_switch_index;
         edge_remapped_[edge] = true;
     }
     remapped_edges_ = true;
@@ -515,6 +617,20 @@ void t_rr_graph_storage::mark_edges_as_rr_switch_ids() {
     remapped_edges_ = true;
 }
 
+bool t_rr_graph_storage::edges_partitioned(const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches) const {
+    edge_compare_src_node_and_configurable_first compare(rr_switches);
+    for (size_t iedge = 1; iedge < edge_src_node_.size(); ++iedge) {
+        RREdgeId prev_edge(iedge - 1);
+        RREdgeId edge(iedge);
+        t_rr_edge_info prev_info(edge_src_node_[prev_edge], edge_dest_node_[prev_edge], edge_switch_[prev_edge], edge_remapped_[prev_edge]);
+        t_rr_edge_info info(edge_src_node_[edge], edge_dest_node_[edge], edge_switch_[edge], edge_remapped_[edge]);
+        if (compare(info, prev_info)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void t_rr_graph_storage::partition_edges(const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches) {
     if (partitioned_) {
         return;
@@ -527,18 +643,48 @@ void t_rr_graph_storage::partition_edges(const vtr::vector<RRSwitchId, t_rr_swit
     //    by assign_first_edges()
     //  - Edges within a source node have the configurable edges before the
     //    non-configurable edges.
-    std::sort(
-        edge_sort_iterator(this, 0),
-        edge_sort_iterator(this, edge_src_node_.size()),
-        edge_compare_src_node_and_configurable_first(rr_switches));
+    //
+    // Edges loaded from a flat binary RR graph file are already sorted; not
+    // sorting them again also keeps the edge arrays viewed in place.
+    if (!edges_partitioned(rr_switches)) {
+        std::sort(
+            edge_sort_iterator(this, 0),
+            edge_sort_iterator(this, edge_src_node_.size()),
+            edge_compare_src_node_and_configurable_first(rr_switches));
+    }
 
     partitioned_ = true;
 
+    // Edge ids are about to change, so any fan-in edge lists are stale
+    clear_fan_in_edges();
+    clear_hot_edges();
+
     assign_first_edges();
 
     VTR_ASSERT_SAFE(validate(rr_switches));
 }
 
+void t_rr_graph_storage::sort_edges_by_dest_node(const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches) {
+    VTR_ASSERT(!node_first_edge_.empty());
+
+    // The edges are already grouped by source node, so sorting each node's slice gives the
+    // same order as partition_edges() would. The slices are sorted serially as they may
+    // share the words of edge_remapped_ (a std::vector<bool>).
+    edge_compare_src_node_and_configurable_first compare(rr_switches);
+    for (size_t inode = 0; inode < node_storage_.size(); ++inode) {
+        RRNodeId node(inode);
+        size_t first_edge = size_t(node_first_edge_[node]);
+        size_t last_edge = size_t(node_first_edge_[RRNodeId(inode + 1)]);
+        if (last_edge - first_edge > 1) {
+            std::sort(edge_sort_iterator(this, first_edge),
+                      edge_sort_iterator(this, last_edge),
+                      compare);
+        }
+    }
+
+    clear_hot_edges();
+}
+
 t_edge_size t_rr_graph_storage::num_configurable_edges(RRNodeId id, const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches) const {
     VTR_ASSERT(!node_first_edge_.empty() && remapped_edges_);
 
@@ -619,36 +765,36 @@ const char* t_rr_graph_storage::node_side_string(RRNodeId id) const {
 }
 
 void t_rr_graph_storage::set_node_layer(RRNodeId id, short layer) {
-    node_layer_[id] = layer;
+    node_layer_.mut(id) = layer;
 }
 
 void t_rr_graph_storage::set_node_ptc_twist_incr(RRNodeId id, short twist_incr){
     VTR_ASSERT(!node_ptc_twist_incr_.empty());
-    node_ptc_twist_incr_[id] = twist_incr;
+    node_ptc_twist_incr_.mut(id) = twist_incr;
 }
 
 void t_rr_graph_storage::set_node_ptc_num(RRNodeId id, int new_ptc_num) {
-    node_ptc_[id].ptc_.pin_num = new_ptc_num; //TODO: eventually remove
+    node_ptc_.mut(id).ptc_.pin_num = new_ptc_num; //TODO: eventually remove
 }
 void t_rr_graph_storage::set_node_pin_num(RRNodeId id, int new_pin_num) {
     if (node_type(id) != IPIN && node_type(id) != OPIN) {
         VTR_LOG_ERROR("Attempted to set RR node 'pin_num' for non-IPIN/OPIN type '%s'", node_type_string(id));
     }
-    node_ptc_[id].ptc_.pin_num = new_pin_num;
+    node_ptc_.mut(id).ptc_.pin_num = new_pin_num;
 }
 
 void t_rr_graph_storage::set_node_track_num(RRNodeId id, int new_track_num) {
     if (node_type(id) != CHANX && node_type(id) != CHANY) {
         VTR_LOG_ERROR("Attempted to set RR node 'track_num' for non-CHANX/CHANY type '%s'", node_type_string(id));
     }
-    node_ptc_[id].ptc_.track_num = new_track_num;
+    node_ptc_.mut(id).ptc_.track_num = new_track_num;
 }
 
 void t_rr_graph_storage::set_node_class_num(RRNodeId id, int new_class_num) {
     if (node_type(id) != SOURCE && node_type(id) != SINK) {
         VTR_LOG_ERROR("Attempted to set RR node 'class_num' for non-SOURCE/SINK type '%s'", node_type_string(id));
     }
-    node_ptc_[id].ptc_.class_num = new_class_num;
+    node_ptc_.mut(id).ptc_.class_num = new_class_num;
 }
 
 int t_rr_graph_storage::node_ptc_num(RRNodeId id) const {
@@ -708,11 +854,11 @@ int t_rr_graph_storage::node_class_num(RRNodeId id) const {
 }
 
 void t_rr_graph_storage::set_node_type(RRNodeId id, t_rr_type new_type) {
-    node_storage_[id].type_ = new_type;
+    node_storage_.mut(id).type_ = new_type;
 }
 
 void t_rr_graph_storage::set_node_coordinates(RRNodeId id, short x1, short y1, short x2, short y2) {
-    auto& node = node_storage_[id];
+    auto& node = node_storage_.mut(id);
     if (x1 < x2) {
         node.xlow_ = x1;
         node.xhigh_ = x2;
@@ -731,7 +877,7 @@ void t_rr_graph_storage::set_node_coordinates(RRNodeId id, short x1, short y1, s
 }
 
 void t_rr_graph_storage::set_node_cost_index(RRNodeId id, RRIndexedDataId new_cost_index) {
-    auto& node = node_storage_[id];
+    auto& node = node_storage_.mut(id);
     if ((size_t)new_cost_index >= std::numeric_limits<decltype(node.cost_index_)>::max()) {
         VTR_LOG_ERROR("Attempted to set cost_index_ %zu above cost_index storage max value.",
                       new_cost_index);
@@ -740,19 +886,19 @@ void t_rr_graph_storage::set_node_cost_index(RRNodeId id, RRIndexedDataId new_co
 }
 
 void t_rr_graph_storage::set_node_rc_index(RRNodeId id, NodeRCIndex new_rc_index) {
-    node_storage_[id].rc_index_ = (size_t)new_rc_index;
+    node_storage_.mut(id).rc_index_ = (size_t)new_rc_index;
 }
 
 void t_rr_graph_storage::set_node_capacity(RRNodeId id, short new_capacity) {
     VTR_ASSERT(new_capacity >= 0);
-    node_storage_[id].capacity_ = new_capacity;
+    node_storage_.mut(id).capacity_ = new_capacity;
 }
 
 void t_rr_graph_storage::set_node_direction(RRNodeId id, Direction new_direction) {
     if (node_type(id) != CHANX && node_type(id) != CHANY) {
         VTR_LOG_ERROR("Attempted to set RR node 'direction' for non-channel type '%s'", node_type_string(id));
     }
-    node_storage_[id].dir_side_.direction = new_direction;
+    node_storage_.mut(id).dir_side_.direction = new_direction;
 }
 
 void t_rr_graph_storage::add_node_side(RRNodeId id, e_side new_side) {
@@ -764,7 +910,7 @@ void t_rr_graph_storage::add_node_side(RRNodeId id, e_side new_side) {
     if (side_bits.to_ulong() > CHAR_MAX) {
         VTR_LOG_ERROR("Invalid side '%s' to be added to rr node %u", SIDE_STRING[new_side], size_t(id));
     }
-    node_storage_[id].dir_side_.sides = static_cast<unsigned char>(side_bits.to_ulong());
+    node_storage_.mut(id).dir_side_.sides = static_cast<unsigned char>(side_bits.to_ulong());
 }
 
 int t_rr_graph_view::node_ptc_num(RRNodeId id) const {
@@ -781,6 +927,24 @@ int t_rr_graph_view::node_class_num(RRNodeId id) const {
 }
 
 
+size_t t_rr_graph_storage::memory_usage() const {
+    size_t bytes = 0;
+    bytes += vtr::memory_usage(node_storage_);
+    bytes += vtr::memory_usage(node_ptc_);
+    bytes += vtr::memory_usage(node_first_edge_);
+    bytes += vtr::memory_usage(node_fan_in_);
+    bytes += vtr::memory_usage(node_first_fan_in_edge_);
+    bytes += vtr::memory_usage(fan_in_edges_);
+    bytes += vtr::memory_usage(edge_hot_);
+    bytes += vtr::memory_usage(node_layer_);
+    bytes += vtr::memory_usage(node_ptc_twist_incr_);
+    bytes += vtr::memory_usage(edge_src_node_);
+    bytes += vtr::memory_usage(edge_dest_node_);
+    bytes += vtr::memory_usage(edge_switch_);
+    bytes += vtr::memory_usage(edge_remapped_);
+    return bytes;
+}
+
 t_rr_graph_view t_rr_graph_storage::view() const {
     VTR_ASSERT(partitioned_);
     VTR_ASSERT(node_storage_.size() == node_fan_in_.size());
@@ -793,7 +957,42 @@ t_rr_graph_view t_rr_graph_storage::view() const {
         vtr::make_const_array_view_id(node_ptc_twist_incr_),
         vtr::make_const_array_view_id(edge_src_node_),
         vtr::make_const_array_view_id(edge_dest_node_),
-        vtr::make_const_array_view_id(edge_switch_));
+        vtr::make_const_array_view_id(edge_switch_),
+        vtr::make_const_array_view_id(edge_hot_));
+}
+
+void t_rr_graph_storage::load_nodes(vtr::array_view<const t_rr_node_data> nodes,
+                                    vtr::array_view<const t_rr_node_ptc_data> node_ptc,
+                                    vtr::array_view<const short> node_layer,
+                                    vtr::array_view<const short> node_ptc_twist_incr,
+                                    std::shared_ptr<const void> mapped_data) {
+    VTR_ASSERT(node_ptc.size() == nodes.size() && node_layer.size() == nodes.size());
+    VTR_ASSERT(node_ptc_twist_incr.empty() || node_ptc_twist_incr.size() == nodes.size());
+
+    clear();
+    if (mapped_data) {
+        mapped_data_ = mapped_data;
+        node_storage_.view(nodes);
+        node_ptc_.view(node_ptc);
+        node_layer_.view(node_layer);
+        node_ptc_twist_incr_.view(node_ptc_twist_incr);
+    } else {
+        node_storage_.assign(nodes.begin(), nodes.end());
+        node_ptc_.assign(node_ptc.begin(), node_ptc.end());
+        node_layer_.assign(node_layer.begin(), node_layer.end());
+        node_ptc_twist_incr_.assign(node_ptc_twist_incr.begin(), node_ptc_twist_incr.end());
+    }
+}
+
+template<typename K, typename V, typename A>
+static size_t mapped_bytes(const vtr::mapped_vector<K, V, A>& vec) {
+    return vec.viewing() ? vec.size() * sizeof(V) : 0;
+}
+
+size_t t_rr_graph_storage::mapped_memory_usage() const {
+    return mapped_bytes(node_storage_) + mapped_bytes(node_ptc_) + mapped_bytes(node_layer_)
+           + mapped_bytes(node_ptc_twist_incr_) + mapped_bytes(edge_src_node_) + mapped_bytes(edge_dest_node_)
+           + mapped_bytes(edge_switch_);
 }
 
 // Given `order`, a vector mapping each RRNodeId to a new one (old -> new),
@@ -813,6 +1012,9 @@ t_rr_graph_view t_rr_graph_storage::view() const {
 void t_rr_graph_storage::reorder(const vtr::vector<RRNodeId, RRNodeId>& order,
                                  const vtr::vector<RRNodeId, RRNodeId>& inverse_order) {
     VTR_ASSERT(order.size() == inverse_order.size());
+    expand_edge_src_nodes();
+    clear_fan_in_edges();
+    clear_hot_edges();
     {
         auto old_node_storage = node_storage_;
 
@@ -820,7 +1022,7 @@ void t_rr_graph_storage::reorder(const vtr::vector<RRNodeId, RRNodeId>& order,
         for (size_t i = 0; i < node_storage_.size(); i++) {
             auto n = RRNodeId(i);
             VTR_ASSERT(n == inverse_order[order[n]]);
-            node_storage_[order[n]] = old_node_storage[n];
+            node_storage_.mut(order[n]) = old_node_storage[n];
         }
     }
     {
@@ -838,9 +1040,9 @@ void t_rr_graph_storage::reorder(const vtr::vector<RRNodeId, RRNodeId>& order,
             for (auto e = old_node_first_edge[n];
                  e < old_node_first_edge[RRNodeId(size_t(n) + 1)];
                  e = RREdgeId(size_t(e) + 1)) {
-                edge_src_node_[cur_edge] = order[old_edge_src_node[e]]; // == n?
-                edge_dest_node_[cur_edge] = order[old_edge_dest_node[e]];
-                edge_switch_[cur_edge] = old_edge_switch[e];
+                edge_src_node_.mut(cur_edge) = order[old_edge_src_node[e]]; // == n?
+                edge_dest_node_.mut(cur_edge) = order[old_edge_dest_node[e]];
+                edge_switch_.mut(cur_edge) = old_edge_switch[e];
                 edge_remapped_[cur_edge] = old_edge_remapped[e];
                 cur_edge = RREdgeId(size_t(cur_edge) + 1);
             }
@@ -849,7 +1051,7 @@ void t_rr_graph_storage::reorder(const vtr::vector<RRNodeId, RRNodeId>& order,
     {
         auto old_node_ptc = node_ptc_;
         for (size_t i = 0; i < node_ptc_.size(); i++) {
-            node_ptc_[order[RRNodeId(i)]] = old_node_ptc[RRNodeId(i)];
+            node_ptc_.mut(order[RRNodeId(i)]) = old_node_ptc[RRNodeId(i)];
         }
     }
     {
@@ -3,8 +3,10 @@
 
 #include <exception>
 #include <bitset>
+#include <memory>
 
 #include "vtr_vector.h"
+#include "vtr_mapped_vector.h"
 #include "physical_types.h"
 #include "rr_graph_storage_utils.h"
 #include "rr_node_types.h"
@@ -99,6 +101,16 @@ struct t_rr_node_ptc_data {
     } ptc_;
 };
 
+/* t_rr_hot_edge packs the edge data read by the router for every expanded
+ * edge (the sink node and the switch), so that a node's out-going edges can
+ * be walked with a single sequential stream of 8 byte records rather than
+ * two parallel arrays. See t_rr_graph_storage::init_hot_edges.            */
+struct t_rr_hot_edge {
+    RRNodeId dest_node;
+    short switch_id;
+};
+static_assert(sizeof(t_rr_hot_edge) == 8, "Check t_rr_hot_edge size");
+
 class t_rr_graph_view;
 
 // RR node and edge storage class.
@@ -341,8 +353,51 @@ class t_rr_graph_storage {
         return edge_dest_node_[edge];
     }
 
+    /** @brief Get the source node for the specified edge.
+     *
+     * This is a binary search over the node edge offsets if the source node
+     * array was released by compress_edge_src_nodes.
+     */
+    RRNodeId edge_src_node(const RREdgeId& edge) const {
+        if (edge_src_nodes_compressed_) {
+            return find_edge_src_node(edge);
+        }
+        return edge_src_node_[edge];
+    }
+
+    /** @brief Returns the incoming edges (fan-in edges) of the specified RRNodeId.
+     *
+     * init_fan_in_edges must have been called first.
+     */
+    vtr::array_view<const RREdgeId> fan_in_edges(RRNodeId id) const {
+        size_t first = node_first_fan_in_edge_[id];
+        size_t last = (&node_first_fan_in_edge_[id])[1];
+        return vtr::array_view<const RREdgeId>(fan_in_edges_.data() + first, last - first);
+    }
+
+    /** @brief Has init_fan_in_edges been called since the edges were last modified? */
+    bool fan_in_edges_initialized() const {
+        return !node_first_fan_in_edge_.empty();
+    }
+
+    /** @brief Has init_hot_edges been called since the edges were last modified? */
+    bool hot_edges_initialized() const {
+        return !edge_hot_.empty();
+    }
+
     /** @brief Call the `apply` function with the edge id, source, and sink nodes of every edge. */
     void for_each_edge(std::function<void(RREdgeId, RRNodeId, RRNodeId)> apply) const {
+        if (edge_src_nodes_compressed_) {
+            //Edges are partitioned by source node, so walk the nodes instead
+            for (size_t inode = 0; inode < node_storage_.size(); inode++) {
+                RRNodeId node(inode);
+                for (size_t iedge = size_t(first_edge(node)); iedge < size_t(last_edge(node)); iedge++) {
+                    RREdgeId edge(iedge);
+                    apply(edge, node, edge_dest_node_[edge]);
+                }
+            }
+            return;
+        }
         for (size_t i = 0; i < edge_dest_node_.size(); i++) {
             RREdgeId edge(i);
             apply(edge, edge_src_node_[edge], edge_dest_node_[edge]);
@@ -453,11 +508,19 @@ class t_rr_graph_storage {
         return node_storage_.size();
     }
 
+    /** @brief Number of RR edges that can be accessed. */
+    size_t edge_count() const {
+        return edge_dest_node_.size();
+    }
+
     /** @brief Is the RR graph currently empty? */
     bool empty() const {
         return node_storage_.empty();
     }
 
+    /** @brief Returns the (approximate) heap memory used by the node and edge storage, in bytes */
+    size_t memory_usage() const;
+
     /** @brief Remove all nodes and edges from the RR graph.
      * This method re-enables graph mutation if the graph was read-only.
      */
@@ -466,12 +529,16 @@ class t_rr_graph_storage {
         node_ptc_.clear();
         node_first_edge_.clear();
         node_fan_in_.clear();
+        clear_fan_in_edges();
+        clear_hot_edges();
         node_layer_.clear();
         node_ptc_twist_incr_.clear();
         edge_src_node_.clear();
         edge_dest_node_.clear();
         edge_switch_.clear();
         edge_remapped_.clear();
+        mapped_data_.reset();
+        edge_src_nodes_compressed_ = false;
         edges_read_ = false;
         partitioned_ = false;
         remapped_edges_ = false;
@@ -500,6 +567,9 @@ class t_rr_graph_storage {
         node_ptc_.shrink_to_fit();
         node_first_edge_.shrink_to_fit();
         node_fan_in_.shrink_to_fit();
+        node_first_fan_in_edge_.shrink_to_fit();
+        fan_in_edges_.shrink_to_fit();
+        edge_hot_.shrink_to_fit();
         node_layer_.shrink_to_fit();
         node_ptc_twist_incr_.shrink_to_fit();
         edge_src_node_.shrink_to_fit();
@@ -517,6 +587,33 @@ class t_rr_graph_storage {
         node_layer_.emplace_back();
     }
 
+    /** @brief Replaces all nodes (and removes all edges) with a bulk copy of the given arrays,
+     * e.g. read from a flat binary RR graph file. node_ptc_twist_incr may be empty.
+     *
+     * If mapped_data is given, it owns the (read-only) memory of the arrays, which are then
+     * viewed in place instead of copied; e.g. the sections of a memory-mapped file, whose pages
+     * are shared by all the processes attaching it. An array is only copied if it is modified.
+     */
+    void load_nodes(vtr::array_view<const t_rr_node_data> nodes,
+                    vtr::array_view<const t_rr_node_ptc_data> node_ptc,
+                    vtr::array_view<const short> node_layer,
+                    vtr::array_view<const short> node_ptc_twist_incr,
+                    std::shared_ptr<const void> mapped_data = nullptr);
+
+    /** @brief Raw node arrays, e.g. to write a flat binary RR graph file */
+    vtr::array_view<const t_rr_node_data> node_data() const {
+        return vtr::array_view<const t_rr_node_data>(node_storage_.data(), node_storage_.size());
+    }
+    vtr::array_view<const t_rr_node_ptc_data> node_ptc_data() const {
+        return vtr::array_view<const t_rr_node_ptc_data>(node_ptc_.data(), node_ptc_.size());
+    }
+    vtr::array_view<const short> node_layer_data() const {
+        return vtr::array_view<const short>(node_layer_.data(), node_layer_.size());
+    }
+    vtr::array_view<const short> node_ptc_twist_incr_data() const {
+        return vtr::array_view<const short>(node_ptc_twist_incr_.data(), node_ptc_twist_incr_.size());
+    }
+
     /** @brief Given `order`, a vector mapping each RRNodeId to a new one (old -> new),
      * and `inverse_order`, its inverse (new -> old), update the t_rr_graph_storage
      * data structure to an isomorphic graph using the new RRNodeId's.
@@ -619,6 +716,31 @@ class t_rr_graph_storage {
     /** @brief Adds a batch of edges.*/
     void alloc_and_load_edges(const t_rr_edge_info_set* rr_edges_to_create);
 
+    /** @brief Replaces all edges with a bulk copy of the given arrays, e.g. read from a
+     * flat binary RR graph file. The switches must already be rr switch ids (i.e. remapped).
+     *
+     * If mapped_data is given, the arrays are viewed in place instead (see load_nodes()).
+     */
+    void load_edges(vtr::array_view<const RRNodeId> src_nodes,
+                    vtr::array_view<const RRNodeId> dest_nodes,
+                    vtr::array_view<const short> switches,
+                    std::shared_ptr<const void> mapped_data = nullptr);
+
+    /** @brief Returns the bytes of node and edge data viewed in place (see load_nodes()), rather than owned */
+    size_t mapped_memory_usage() const;
+
+    /** @brief Raw edge arrays, e.g. to write a flat binary RR graph file */
+    vtr::array_view<const RRNodeId> edge_src_node_data() const {
+        VTR_ASSERT(!edge_src_nodes_compressed_);
+        return vtr::array_view<const RRNodeId>(edge_src_node_.data(), edge_src_node_.size());
+    }
+    vtr::array_view<const RRNodeId> edge_dest_node_data() const {
+        return vtr::array_view<const RRNodeId>(edge_dest_node_.data(), edge_dest_node_.size());
+    }
+    vtr::array_view<const short> edge_switch_data() const {
+        return vtr::array_view<const short>(edge_switch_.data(), edge_switch_.size());
+    }
+
     /* Edge finalization methods */
 
     /** @brief Counts the number of rr switches needed based on fan in to support mux
@@ -650,6 +772,12 @@ class t_rr_graph_storage {
      */
     void partition_edges(const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches);
 
+    /** @brief
+     * Sorts the out-going edges of each node by destination node (keeping the configurable
+     * edges first), e.g. after reorder() which keeps the edge order of each node.
+     */
+    void sort_edges_by_dest_node(const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches);
+
     /** @brief Validate that edge data is partitioned correctly.*/
     bool validate_node(RRNodeId node_id, const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches) const;
     bool validate(const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches) const;
@@ -664,6 +792,50 @@ class t_rr_graph_storage {
      * have a complete rr-graph and not called often.*/
     void init_fan_in();
 
+    /** @brief Init the per node list of incoming edges (see fan_in_edges).
+     * Should only be called after partition_edges, since edges are refered to
+     * by RREdgeId. Like init_fan_in this is an O(N) operation, and it also
+     * costs one RREdgeId of memory per edge, so it is only built on demand by
+     * algorithms which walk the RR graph backwards (e.g. from a sink). */
+    void init_fan_in_edges();
+
+    /** @brief Release the memory used by the fan-in edge lists. */
+    void clear_fan_in_edges() {
+        node_first_fan_in_edge_.clear();
+        fan_in_edges_.clear();
+    }
+
+    /** @brief Init the packed, read-only copy of the edge sink nodes and
+     * switches (see t_rr_hot_edge) used by t_rr_graph_view::edge_hot.
+     * Should only be called once the edges have been partitioned and their
+     * switches remapped, since it is a snapshot of the final edges. It costs
+     * 8 bytes of memory per edge, so it is only built when requested. Views
+     * created before this call keep reading the parallel edge arrays. */
+    void init_hot_edges();
+
+    /** @brief Release the memory used by the packed edge array. */
+    void clear_hot_edges() {
+        edge_hot_.clear();
+    }
+
+    /** @brief Release the memory used by the per edge source node array.
+     * Once the edges have been partitioned, the source node of an edge is the
+     * node whose edge range contains it, so it need not be stored. This saves
+     * one RRNodeId of memory per edge, at the cost of a binary search in
+     * edge_src_node. Should only be called once the RR graph is complete;
+     * the array is rebuilt by expand_edge_src_nodes (or by any method which
+     * re-orders the edges). */
+    void compress_edge_src_nodes();
+
+    /** @brief Rebuild the per edge source node array released by
+     * compress_edge_src_nodes. Does nothing if it was not released. */
+    void expand_edge_src_nodes();
+
+    /** @brief Has the per edge source node array been released by compress_edge_src_nodes? */
+    bool edge_src_nodes_compressed() const {
+        return edge_src_nodes_compressed_;
+    }
+
     static inline Direction get_node_direction(
         vtr::array_view_id<RRNodeId, const t_rr_node_data> node_storage,
         RRNodeId id) {
@@ -695,6 +867,8 @@ class t_rr_graph_storage {
     }
 
   private:
+    RRNodeId find_edge_src_node(RREdgeId edge) const;
+
     friend struct edge_swapper;
     friend class edge_sort_iterator;
     friend class edge_compare_dest_node;
@@ -706,6 +880,9 @@ class t_rr_graph_storage {
      */
     void assign_first_edges();
 
+    /** @brief Returns true if the edges are already in the order partition_edges() sorts them in. */
+    bool edges_partitioned(const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches) const;
+
     /** @brief Verify that first_edge_ array correctly partitions rr edge data. */
     bool verify_first_edges() const;
 
@@ -729,13 +906,13 @@ class t_rr_graph_storage {
      * storage_ stores the core RR node data used by the router and is **very**
      * hot.
      */
-    vtr::vector<RRNodeId, t_rr_node_data, vtr::aligned_allocator<t_rr_node_data>> node_storage_;
+    vtr::mapped_vector<RRNodeId, t_rr_node_data, vtr::aligned_allocator<t_rr_node_data>> node_storage_;
 
     /**@brief
      * The PTC data is cold data, and is generally not used during the inner
      * loop of either the placer or router.
      */
-    vtr::vector<RRNodeId, t_rr_node_ptc_data> node_ptc_;
+    vtr::mapped_vector<RRNodeId, t_rr_node_ptc_data> node_ptc_;
 
     /** @brief
      * This array stores the first edge of each RRNodeId.  Not that the length
@@ -747,13 +924,27 @@ class t_rr_graph_storage {
     /** @brief Fan in counts for each RR node. */
     vtr::vector<RRNodeId, t_edge_size> node_fan_in_;
 
+    /** @brief
+     * Optional fan-in edge lists, built by init_fan_in_edges.
+     * The incoming edges of node id are fan_in_edges_[node_first_fan_in_edge_[id], node_first_fan_in_edge_[id + 1]).
+     * Like node_first_edge_, node_first_fan_in_edge_ is storage_.size() + 1 long when initialized.
+     */
+    vtr::vector<RRNodeId, uint32_t> node_first_fan_in_edge_;
+    std::vector<RREdgeId> fan_in_edges_;
+
+    /** @brief
+     * Optional packed copy of edge_dest_node_ and edge_switch_, built by init_hot_edges.
+     * Edges are partitioned by source node, so the out-going edges of a node are contiguous.
+     */
+    vtr::vector<RREdgeId, t_rr_hot_edge> edge_hot_;
+
     /** @brief
      * Layer number that each RR node is located at
      * Layer number refers to the die that the node belongs to. The layer number of base die is zero and die above it one, etc.
      * This data is also considered as a hot data since it is used in inner loop of router, but since it didn't fit nicely into t_rr_node_data due to alignment issues, we had to store it
      *in a separate vector.
      */
-    vtr::vector<RRNodeId, short> node_layer_;
+    vtr::mapped_vector<RRNodeId, short> node_layer_;
 
     /** @brief
      *Twist Increment number is defined for CHANX/CHANY nodes; it is useful for layout of tileable FPGAs used by openFPGA.
@@ -762,12 +953,18 @@ class t_rr_graph_storage {
      * Twist increment number is only meaningful for CHANX and CHANY nodes; it is 0 for other node types.
      * We also don't bother allocating this storage if the FPGA is not specified to be tileable; instead in that case the twist for all nodes will always be returned as 0.
      */
-    vtr::vector<RRNodeId, short> node_ptc_twist_incr_;
+    vtr::mapped_vector<RRNodeId, short> node_ptc_twist_incr_;
 
     /** @brief Edge storage */
-    vtr::vector<RREdgeId, RRNodeId> edge_src_node_;
-    vtr::vector<RREdgeId, RRNodeId> edge_dest_node_;
-    vtr::vector<RREdgeId, short> edge_switch_;
+    vtr::mapped_vector<RREdgeId, RRNodeId> edge_src_node_;
+    vtr::mapped_vector<RREdgeId, RRNodeId> edge_dest_node_;
+    vtr::mapped_vector<RREdgeId, short> edge_switch_;
+
+    /** @brief Owner of the memory viewed by the node and edge arrays, if loaded in place (see load_nodes()) */
+    std::shared_ptr<const void> mapped_data_;
+
+    /** @brief Set after compress_edge_src_nodes has released edge_src_node_. */
+    bool edge_src_nodes_compressed_;
 
     /** @brief
      * The delay of certain switches specified in the architecture file depends on the number of inputs of the edge's sink node (pins or tracks).
@@ -836,7 +1033,8 @@ class t_rr_graph_view {
         const vtr::array_view_id<RRNodeId, const short> node_ptc_twist_incr,
         const vtr::array_view_id<RREdgeId, const RRNodeId> edge_src_node,
         const vtr::array_view_id<RREdgeId, const RRNodeId> edge_dest_node,
-        const vtr::array_view_id<RREdgeId, const short> edge_switch)
+        const vtr::array_view_id<RREdgeId, const short> edge_switch,
+        const vtr::array_view_id<RREdgeId, const t_rr_hot_edge> edge_hot)
         : node_storage_(node_storage)
         , node_ptc_(node_ptc)
         , node_first_edge_(node_first_edge)
@@ -845,7 +1043,8 @@ class t_rr_graph_view {
         , node_ptc_twist_incr_(node_ptc_twist_incr)
         , edge_src_node_(edge_src_node)
         , edge_dest_node_(edge_dest_node)
-        , edge_switch_(edge_switch) {}
+        , edge_switch_(edge_switch)
+        , edge_hot_(edge_hot) {}
 
     /****************
      * Node methods *
@@ -940,6 +1139,27 @@ class t_rr_graph_view {
         return edge_switch_[edge];
     }
 
+    // Get the destination node and switch of the specified edge.
+    //
+    // Reads the packed edge array when it was built when this view was
+    // created (see t_rr_graph_storage::init_hot_edges), and the parallel
+    // edge arrays otherwise.  Intended for the router inner loop.
+    t_rr_hot_edge edge_hot(RREdgeId edge) const {
+        if (!edge_hot_.empty()) {
+            return edge_hot_[edge];
+        }
+        return {edge_dest_node_[edge], edge_switch_[edge]};
+    }
+
+    // Prefetch the packed edge records of a node's out-going edges.
+    //
+    // Note: This is a NOP if the packed edge array was not built.
+    inline void prefetch_edges(RRNodeId id) const {
+        if (!edge_hot_.empty() && first_edge(id) != last_edge(id)) {
+            VTR_PREFETCH(&edge_hot_[first_edge(id)], 0, 0);
+        }
+    }
+
   private:
     RREdgeId first_edge(RRNodeId id) const {
         return node_first_edge_[id];
@@ -958,6 +1178,7 @@ class t_rr_graph_view {
     vtr::array_view_id<RREdgeId, const RRNodeId> edge_src_node_;
     vtr::array_view_id<RREdgeId, const RRNodeId> edge_dest_node_;
     vtr::array_view_id<RREdgeId, const short> edge_switch_;
+    vtr::array_view_id<RREdgeId, const t_rr_hot_edge> edge_hot_;
 };
 
 #endif /* _RR_GRAPH_STORAGE_ */
@@ -140,6 +140,23 @@ class RRGraphView {
         return node_storage_.fan_in(node);
     }
 
+    /** @brief Get the incoming edges of a routing resource node.
+     * Only available once RRGraphBuilder::init_fan_in_edges() has been called (see has_fan_in_edges()).
+     * This function is inlined for runtime optimization. */
+    inline vtr::array_view<const RREdgeId> node_fan_in_edges(RRNodeId node) const {
+        return node_storage_.fan_in_edges(node);
+    }
+
+    /** @brief Have the incoming edge lists of the routing resource nodes been built? */
+    inline bool has_fan_in_edges() const {
+        return node_storage_.fan_in_edges_initialized();
+    }
+
+    /** @brief Get the source node of an edge. This function is inlined for runtime optimization. */
+    inline RRNodeId edge_src_node(RREdgeId edge) const {
+        return node_storage_.edge_src_node(edge);
+    }
+
     /** @brief Get the minimum x-coordinate of a routing resource node. This function is inlined for runtime optimization. */
     inline short node_xlow(RRNodeId node) const {
         return node_storage_.node_xlow(node);
@@ -462,11 +479,11 @@ class RRGraphView {
 
     /** .. warning:: The Metadata should stay as an independent data structure than rest of the internal data,
      *  e.g., node_lookup! */
-    MetadataStorage<int> rr_node_metadata_data() const {
+    const MetadataStorage<int>& rr_node_metadata_data() const {
         return rr_node_metadata_;
     }
 
-    MetadataStorage<std::tuple<int, int, short>> rr_edge_metadata_data() const {
+    const MetadataStorage<std::tuple<int, int, short>>& rr_edge_metadata_data() const {
         return rr_edge_metadata_;
     }
 
@@ -40,6 +40,28 @@ void add_rr_edge_metadata(MetadataStorage<std::tuple<int, int, short>>& rr_edge_
                                   arch->strings.intern_string(value));
 }
 
+vtr::vector<RREdgeId, const t_metadata_value*> rr_edge_metadata_table(const RRGraphBuilder& rr_graph_builder, const t_rr_graph_storage& rr_nodes, vtr::interned_string key) {
+    vtr::vector<RREdgeId, const t_metadata_value*> table(rr_nodes.edge_count(), nullptr);
+
+    for (auto iter = rr_graph_builder.begin_rr_edge_metadata(); iter != rr_graph_builder.end_rr_edge_metadata(); ++iter) {
+        const t_metadata_value* value = iter->second.one(key);
+        if (value == nullptr) {
+            continue;
+        }
+
+        int src_node, sink_node;
+        short switch_id;
+        std::tie(src_node, sink_node, switch_id) = iter->first;
+        for (RREdgeId edge : rr_nodes.edge_range(RRNodeId(src_node))) {
+            if (rr_nodes.edge_sink_node(edge) == RRNodeId(sink_node) && rr_nodes.edge_switch(edge) == switch_id) {
+                table[edge] = value;
+            }
+        }
+    }
+
+    return table;
+}
+
 void add_rr_edge_metadata(MetadataStorage<std::tuple<int, int, short>>& rr_edge_metadata, int src_node, int sink_id, short switch_id, vtr::interned_string key, vtr::interned_string value) {
     auto rr_edge = std::make_tuple(src_node, sink_id, switch_id);
     rr_edge_metadata.add_metadata(rr_edge,
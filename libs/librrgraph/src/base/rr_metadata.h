@@ -12,6 +12,14 @@ void add_rr_node_metadata(MetadataStorage<int>& rr_node_metadata, int src_node,
 
 const t_metadata_value* rr_edge_metadata(const RRGraphBuilder& rr_graph_builder, int src_node, int sink_node, short switch_id, vtr::interned_string key);
 void add_rr_edge_metadata(MetadataStorage<std::tuple<int, int, short>>& rr_edge_metadata, int src_node, int sink_node, short switch_id, vtr::interned_string key, vtr::interned_string value);
+
+/**
+ * @brief Returns the value of key in the metadata of each RR edge of rr_nodes, or nullptr for the edges without it
+ *
+ * Indexing this table by edge avoids searching the edge metadata by (source node, sink node, switch)
+ * when the metadata of many edges is needed, e.g. for the FASM features of all the routed edges.
+ */
+vtr::vector<RREdgeId, const t_metadata_value*> rr_edge_metadata_table(const RRGraphBuilder& rr_graph_builder, const t_rr_graph_storage& rr_nodes, vtr::interned_string key);
 void add_rr_edge_metadata(MetadataStorage<std::tuple<int, int, short>>& rr_edge_metadata, int src_node, int sink_node, short switch_id, vtr::string_view key, vtr::string_view value, const t_arch* arch);
 
 } // namespace vpr
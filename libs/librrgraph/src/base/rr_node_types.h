@@ -54,6 +54,7 @@ enum e_rr_node_reorder_algorithm {
     DONT_REORDER,
     DEGREE_BFS,
     RANDOM_SHUFFLE,
+    SPATIAL_HILBERT,
 };
 
 ///@brief Type used to express rr_node edge index.
@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <limits>
+
 #include "vtr_assert.h"
+#include "vtr_memory_usage.h"
 #include "rr_spatial_lookup.h"
 
 RRSpatialLookup::RRSpatialLookup() {
@@ -45,6 +49,14 @@ RRNodeId RRSpatialLookup::find_node(int layer,
         std::swap(node_x, node_y);
     }
 
+    if (compacted_) {
+        vtr::array_view<const RRNodeId> nodes = find_compact_nodes(layer, node_x, node_y, type, node_side);
+        if (size_t(ptc) >= nodes.size()) {
+            return RRNodeId::INVALID();
+        }
+        return nodes[ptc];
+    }
+
     VTR_ASSERT_SAFE(4 == rr_node_indices_[type].ndims());
 
     /* Sanity check to ensure the layer, x, y, side and ptc are in range
@@ -105,6 +117,17 @@ std::vector<RRNodeId> RRSpatialLookup::find_nodes(int layer,
         std::swap(node_x, node_y);
     }
 
+    if (compacted_) {
+        vtr::array_view<const RRNodeId> all_nodes = find_compact_nodes(layer, node_x, node_y, type, side);
+        nodes.reserve(std::count_if(all_nodes.begin(), all_nodes.end(), [](RRNodeId node) { return bool(node); }));
+        for (RRNodeId node : all_nodes) {
+            if (node) {
+                nodes.push_back(node);
+            }
+        }
+        return nodes;
+    }
+
     VTR_ASSERT_SAFE(4 == rr_node_indices_[type].ndims());
 
     /* Sanity check to ensure the x, y, side are in range 
@@ -149,6 +172,29 @@ std::vector<RRNodeId> RRSpatialLookup::find_nodes(int layer,
     return nodes;
 }
 
+vtr::array_view<const RRNodeId> RRSpatialLookup::find_compact_nodes(size_t layer,
+                                                                    size_t x,
+                                                                    size_t y,
+                                                                    t_rr_type type,
+                                                                    size_t side) const {
+    if (size_t(type) >= compact_node_indices_.size()) {
+        return vtr::array_view<const RRNodeId>();
+    }
+
+    const t_compact_node_indices& indices = compact_node_indices_[type];
+    if (layer >= indices.dim_sizes[0]
+        || x >= indices.dim_sizes[1]
+        || y >= indices.dim_sizes[2]
+        || side >= indices.dim_sizes[3]) {
+        return vtr::array_view<const RRNodeId>();
+    }
+
+    size_t loc = ((layer * indices.dim_sizes[1] + x) * indices.dim_sizes[2] + y) * indices.dim_sizes[3] + side;
+    uint32_t begin = indices.first_node[loc];
+    uint32_t end = indices.first_node[loc + 1];
+    return vtr::array_view<const RRNodeId>(indices.nodes.data() + begin, end - begin);
+}
+
 std::vector<RRNodeId> RRSpatialLookup::find_channel_nodes(int layer,
                                                           int x,
                                                           int y,
@@ -220,6 +266,7 @@ void RRSpatialLookup::reserve_nodes(int layer,
                                     t_rr_type type,
                                     int num_nodes,
                                     e_side side) {
+    expand();
     VTR_ASSERT_SAFE(4 == rr_node_indices_[type].ndims());
 
     /* For non-IPIN/OPIN nodes, the side should always be the TOP side which follows the convention in find_node() API! */
@@ -240,6 +287,7 @@ void RRSpatialLookup::add_node(RRNodeId node,
                                int ptc,
                                e_side side) {
     VTR_ASSERT(node); /* Must have a valid node id to be added */
+    expand();
     VTR_ASSERT_SAFE(4 == rr_node_indices_[type].ndims());
 
     /* For non-IPIN/OPIN nodes, the side should always be the TOP side which follows the convention in find_node() API! */
@@ -264,6 +312,7 @@ void RRSpatialLookup::mirror_nodes(const int layer,
                                    t_rr_type type,
                                    e_side side) {
     VTR_ASSERT(SOURCE == type || SINK == type);
+    expand();
     resize_nodes(layer, des_coord.x(), des_coord.y(), type, side);
     rr_node_indices_[type][layer][des_coord.x()][des_coord.y()][side] = rr_node_indices_[type][layer][src_coord.x()][src_coord.y()][side];
 }
@@ -277,6 +326,7 @@ void RRSpatialLookup::resize_nodes(int layer,
      * This may seldom happen because the rr_graph building function
      * should ensure the fast look-up well organized  
      */
+    expand();
     VTR_ASSERT(type < rr_node_indices_.size());
     VTR_ASSERT(x >= 0);
     VTR_ASSERT(y >= 0);
@@ -295,6 +345,17 @@ void RRSpatialLookup::resize_nodes(int layer,
 
 void RRSpatialLookup::reorder(const vtr::vector<RRNodeId, RRNodeId> dest_order) {
     // update rr_node_indices, a map to optimize rr_index lookups
+    if (compacted_) {
+        for (auto& indices : compact_node_indices_) {
+            for (RRNodeId& node : indices.nodes) {
+                if (node) {
+                    node = dest_order[node];
+                }
+            }
+        }
+        return;
+    }
+
     for (auto& grid : rr_node_indices_) {
         for(size_t l = 0; l < grid.dim_size(0); l++) {
             for (size_t x = 0; x < grid.dim_size(1); x++) {
@@ -316,4 +377,70 @@ void RRSpatialLookup::clear() {
     for (auto& data : rr_node_indices_) {
         data.clear();
     }
+    for (auto& indices : compact_node_indices_) {
+        indices = t_compact_node_indices();
+    }
+    compacted_ = false;
+}
+
+void RRSpatialLookup::compact() {
+    if (compacted_) {
+        return;
+    }
+
+    for (size_t type = 0; type < rr_node_indices_.size(); ++type) {
+        auto& grid = rr_node_indices_[type];
+        t_compact_node_indices& indices = compact_node_indices_[type];
+        for (size_t dim = 0; dim < 4; ++dim) {
+            indices.dim_sizes[dim] = grid.dim_size(dim);
+        }
+
+        size_t num_nodes = 0;
+        for (size_t i = 0; i < grid.size(); ++i) {
+            num_nodes += grid.get(i).size();
+        }
+        VTR_ASSERT(num_nodes <= std::numeric_limits<uint32_t>::max());
+
+        //The NdMatrix elements are in (layer, x, y, side) row-major order, as indexed by find_compact_nodes()
+        indices.first_node.reserve(grid.size() + 1);
+        indices.nodes.reserve(num_nodes);
+        for (size_t i = 0; i < grid.size(); ++i) {
+            indices.first_node.push_back(indices.nodes.size());
+            for (int node : grid.get(i)) {
+                indices.nodes.push_back(node == OPEN ? RRNodeId::INVALID() : RRNodeId(node));
+            }
+        }
+        indices.first_node.push_back(indices.nodes.size());
+
+        grid.clear();
+    }
+    compacted_ = true;
+}
+
+void RRSpatialLookup::expand() {
+    if (!compacted_) {
+        return;
+    }
+
+    for (size_t type = 0; type < rr_node_indices_.size(); ++type) {
+        auto& grid = rr_node_indices_[type];
+        t_compact_node_indices& indices = compact_node_indices_[type];
+        grid.resize({indices.dim_sizes[0], indices.dim_sizes[1], indices.dim_sizes[2], indices.dim_sizes[3]});
+        for (size_t i = 0; i < grid.size(); ++i) {
+            for (uint32_t inode = indices.first_node[i]; inode < indices.first_node[i + 1]; ++inode) {
+                RRNodeId node = indices.nodes[inode];
+                grid.get(i).push_back(node ? int(size_t(node)) : OPEN);
+            }
+        }
+        indices = t_compact_node_indices();
+    }
+    compacted_ = false;
+}
+
+size_t RRSpatialLookup::memory_usage() const {
+    size_t bytes = vtr::memory_usage(rr_node_indices_);
+    for (const t_compact_node_indices& indices : compact_node_indices_) {
+        bytes += vtr::memory_usage(indices.first_node) + vtr::memory_usage(indices.nodes);
+    }
+    return bytes;
 }
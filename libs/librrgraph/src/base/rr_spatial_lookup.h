@@ -14,7 +14,16 @@
  *
  *   - Update the look-up with new nodes
  *   - Find the id of a node with given information, e.g., x, y, type etc.
+ *
+ * Once the graph is complete, the look-up can be compacted (see compact()) into one flat
+ * array of nodes per type, indexed by (layer, x, y, side) offsets. This is much smaller than the
+ * nested per location vectors, and a query is a couple of array reads rather than a chase
+ * through several levels of pointers.
  */
+#include <array>
+#include <cstdint>
+
+#include "vtr_array_view.h"
 #include "vtr_geometry.h"
 #include "vtr_vector.h"
 #include "physical_types.h"
@@ -117,6 +126,14 @@ class RRSpatialLookup {
                                                        int y,
                                                        t_rr_type rr_type) const;
 
+    /** @brief Has the look-up been compacted by compact()? */
+    bool compacted() const {
+        return compacted_;
+    }
+
+    /** @brief Returns the (approximate) heap memory used by the look-up, in bytes */
+    size_t memory_usage() const;
+
     /* -- Mutators -- */
   public:
     /** @brief Reserve the memory for a list of nodes at (layer, x, y) location with given type and side */
@@ -227,6 +244,19 @@ class RRSpatialLookup {
     /** @brief Clear all the data inside */
     void clear();
 
+    /**
+     * @brief Replace the per location node lists by a flat (CSR like) array of nodes per type
+     *
+     * Should be called once the graph is complete. Queries return the same nodes as before,
+     * but are cheaper and the look-up uses less memory.
+     *
+     * @note Any later mutator (except reorder() and clear()) first calls expand(), which is expensive
+     */
+    void compact();
+
+    /** @brief Rebuild the per location node lists released by compact(). Does nothing if the look-up is not compacted */
+    void expand();
+
     /* -- Internal data queries -- */
   private:
     /* An internal API to find all the nodes in a specific location with a given type
@@ -240,10 +270,34 @@ class RRSpatialLookup {
                                      t_rr_type type,
                                      e_side side = SIDES[0]) const;
 
+    /* Returns the nodes (including invalid ids) registered at a location of the compacted look-up,
+     * indexed by ptc, or an empty list if the location is out of range.
+     * Note that (x, y) must already be swapped for CHANX
+     */
+    vtr::array_view<const RRNodeId> find_compact_nodes(size_t layer,
+                                                       size_t x,
+                                                       size_t y,
+                                                       t_rr_type type,
+                                                       size_t side) const;
+
     /* -- Internal data storage -- */
   private:
     /* Fast look-up: TODO: Should rework the data type. Currently it is based on a 3-dimensional array mater where some dimensions must always be accessed with a specific index. Such limitation should be overcome */
     t_rr_node_indices rr_node_indices_;
+
+    /* The compacted look-up of one node type (see compact()) */
+    struct t_compact_node_indices {
+        /* Sizes of the (layer, x, y, side) dimensions */
+        std::array<size_t, 4> dim_sizes = {0, 0, 0, 0};
+        /* Offset of the first node of each (layer, x, y, side) location in nodes, plus a final entry
+         * equal to nodes.size(), so the ptcs of a location are [first_node[i], first_node[i + 1]) */
+        std::vector<uint32_t> first_node;
+        std::vector<RRNodeId> nodes;
+    };
+
+    /* Replaces rr_node_indices_ (which is then empty) if compacted_ */
+    std::array<t_compact_node_indices, NUM_RR_TYPES> compact_node_indices_;
+    bool compacted_ = false;
 };
 
 #endif
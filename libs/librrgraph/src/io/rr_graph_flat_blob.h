@@ -0,0 +1,151 @@
+#ifndef RR_GRAPH_FLAT_BLOB_H
+#define RR_GRAPH_FLAT_BLOB_H
+
+/**
+ * @file
+ * @brief Layout of the native flat binary RR graph format (.blob files).
+ *
+ * Unlike the XML and Cap'n Proto formats, which visit every attribute of every
+ * node and edge, this format stores the t_rr_graph_storage node and edge arrays
+ * verbatim as vtr::FlatBlobReader sections. Loading a graph is then a few bulk
+ * copies out of the memory-mapped file, followed by the usual post-processing
+ * (RR node lookup, edge partitioning and indexed data).
+ *
+ * The architecture dependent sections (switch, segment, block type and grid
+ * descriptions) are only used to check the file matches the architecture, as for
+ * the other formats.
+ *
+ * A blob written from a graph which passed check_rr_graph() carries a check stamp:
+ * a digest of all the other sections and of the architecture it was checked against.
+ * Loading an unchanged blob against the same architecture then skips check_rr_graph().
+ *
+ * Files are only portable between builds with the same t_rr_node_data layout and
+ * endianness; a mismatch in element size is detected on load.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "vtr_array_view.h"
+#include "vtr_digest.h"
+
+///@brief Bumped whenever the meaning of a section changes
+constexpr uint64_t RR_GRAPH_BLOB_VERSION = 2;
+
+///@brief The sections of an RR graph blob, in file order
+enum e_rr_graph_blob_section {
+    RR_GRAPH_BLOB_HEADER = 0,          ///<uint64_t: version, number of layers, grid width, grid height
+    RR_GRAPH_BLOB_TOOL,                ///<strings: VPR version, architecture comment
+    RR_GRAPH_BLOB_CHAN_WIDTH,          ///<int: max, x_min, x_max, y_min, y_max
+    RR_GRAPH_BLOB_CHAN_X_LIST,         ///<int: t_chan_width::x_list
+    RR_GRAPH_BLOB_CHAN_Y_LIST,         ///<int: t_chan_width::y_list
+    RR_GRAPH_BLOB_SWITCHES,            ///<t_rr_blob_switch: per RR switch
+    RR_GRAPH_BLOB_SWITCH_NAMES,        ///<strings: per RR switch
+    RR_GRAPH_BLOB_SEGMENTS,            ///<t_rr_blob_segment: per segment
+    RR_GRAPH_BLOB_SEGMENT_NAMES,       ///<strings: per segment
+    RR_GRAPH_BLOB_BLOCK_TYPES,         ///<t_rr_blob_block_type: per physical tile type
+    RR_GRAPH_BLOB_BLOCK_TYPE_NAMES,    ///<strings: per physical tile type
+    RR_GRAPH_BLOB_GRID_LOCS,           ///<t_rr_blob_grid_loc: per grid location
+    RR_GRAPH_BLOB_NODES,               ///<t_rr_node_data: per node
+    RR_GRAPH_BLOB_NODE_PTC,            ///<t_rr_node_ptc_data: per node
+    RR_GRAPH_BLOB_NODE_LAYER,          ///<short: per node
+    RR_GRAPH_BLOB_NODE_PTC_TWIST_INCR, ///<short: per node (or empty)
+    RR_GRAPH_BLOB_RC_DATA,             ///<t_rr_rc_data: indexed by the node rc_index
+    RR_GRAPH_BLOB_SEG_INDEX,           ///<short: segment of each cost index (-1 if none)
+    RR_GRAPH_BLOB_EDGE_SRC_NODES,      ///<RRNodeId: per edge
+    RR_GRAPH_BLOB_EDGE_DEST_NODES,     ///<RRNodeId: per edge
+    RR_GRAPH_BLOB_EDGE_SWITCHES,       ///<short: RR switch of each edge
+    RR_GRAPH_BLOB_NODE_META_NODES,     ///<int: node of each node metadata entry
+    RR_GRAPH_BLOB_NODE_META_NAMES,     ///<strings: per node metadata entry
+    RR_GRAPH_BLOB_NODE_META_VALUES,    ///<strings: per node metadata entry
+    RR_GRAPH_BLOB_EDGE_META_EDGES,     ///<t_rr_blob_edge_key: edge of each edge metadata entry
+    RR_GRAPH_BLOB_EDGE_META_NAMES,     ///<strings: per edge metadata entry
+    RR_GRAPH_BLOB_EDGE_META_VALUES,    ///<strings: per edge metadata entry
+    RR_GRAPH_BLOB_CHECK_STAMP,         ///<strings: the check stamp (see rr_graph_blob_check_stamp()), or none if unchecked
+    RR_GRAPH_BLOB_NUM_SECTIONS
+};
+
+///@brief An RR switch (t_rr_switch_inf), as stored in an RR graph blob
+struct t_rr_blob_switch {
+    float R;
+    float Cin;
+    float Cout;
+    float Cinternal;
+    float Tdel;
+    float buf_size;
+    float mux_trans_size;
+    int32_t type; ///<SwitchType
+};
+
+///@brief The timing of a segment (t_segment_inf), as stored in an RR graph blob
+struct t_rr_blob_segment {
+    float Rmetal;
+    float Cmetal;
+};
+
+///@brief The size of a physical tile type, as stored in an RR graph blob
+struct t_rr_blob_block_type {
+    int32_t width;
+    int32_t height;
+    int32_t num_classes;
+};
+
+///@brief A grid location, as stored in an RR graph blob
+struct t_rr_blob_grid_loc {
+    int32_t block_type;
+    int32_t width_offset;
+    int32_t height_offset;
+};
+
+///@brief The edge an edge metadata entry belongs to, as stored in an RR graph blob
+struct t_rr_blob_edge_key {
+    int32_t src_node;
+    int32_t sink_node;
+    int32_t switch_id;
+};
+
+///@brief Packs strings as a single section of nul terminated characters
+inline std::vector<char> pack_rr_graph_blob_strings(const std::vector<std::string>& strings) {
+    std::vector<char> chars;
+    for (const std::string& str : strings) {
+        chars.insert(chars.end(), str.begin(), str.end());
+        chars.push_back('\0');
+    }
+    return chars;
+}
+
+///@brief Inverse of pack_rr_graph_blob_strings()
+inline std::vector<std::string> unpack_rr_graph_blob_strings(vtr::array_view<const char> chars) {
+    std::vector<std::string> strings;
+    size_t begin = 0;
+    for (size_t i = 0; i < chars.size(); ++i) {
+        if (chars[i] == '\0') {
+            strings.emplace_back(chars.data() + begin, i - begin);
+            begin = i + 1;
+        }
+    }
+    return strings;
+}
+
+/**
+ * @brief Returns the check stamp of an RR graph blob which passed check_rr_graph() against architecture_id.
+ *
+ * section_data(isection) must return the raw bytes of each section before RR_GRAPH_BLOB_CHECK_STAMP
+ * (e.g. vtr::FlatBlobReader::section_data()).
+ */
+template<typename SectionData>
+std::string rr_graph_blob_check_stamp(const SectionData& section_data, const std::string& architecture_id, bool is_flat) {
+    std::vector<vtr::array_view<const char>> buffers;
+    for (size_t isection = 0; isection < RR_GRAPH_BLOB_CHECK_STAMP; ++isection) {
+        buffers.push_back(section_data(isection));
+    }
+
+    //check_rr_graph() also depends on the architecture and on whether the graph is flat
+    std::string check_key = architecture_id + (is_flat ? ",flat" : "");
+    buffers.emplace_back(check_key.data(), check_key.size());
+
+    return vtr::secure_digest_buffers(buffers);
+}
+
+#endif
@@ -1,4 +1,4 @@
-/* This function loads in a routing resource graph written in xml format
+/* This function loads in a routing resource graph written in xml (or binary) format
  * into vpr when the option --read_rr_graph <file name> is specified.
  * When it is not specified the build_rr_graph function is then called.
  * This is done using the libpugixml library. This is useful
@@ -56,6 +56,7 @@ void load_rr_file(RRGraphBuilder* rr_graph_builder,
                   const char* read_rr_graph_name,
                   std::string* read_rr_graph_filename,
                   bool read_edge_metadata,
+                  bool attach_blob,
                   bool do_check_rr_graph,
                   bool echo_enabled,
                   const char* echo_file_name,
@@ -110,10 +111,16 @@ void load_rr_file(RRGraphBuilder* rr_graph_builder,
         void* context;
         uxsd::load_rr_graph_capnp(reader, f.getData(), context, read_rr_graph_name);
 #endif
+    } else if (vtr::check_file_name_extension(read_rr_graph_name, ".blob")) {
+        try {
+            reader.load_flat_blob(read_rr_graph_name, arch->architecture_id, attach_blob);
+        } catch (const std::runtime_error& e) {
+            vpr_throw(VPR_ERROR_ROUTE, read_rr_graph_name, 0, "%s", e.what());
+        }
     } else {
         VTR_LOG_WARN(
             "RR graph file '%s' may be in incorrect format. "
-            "Expecting .xml or .bin format\n",
+            "Expecting .xml, .bin or .blob format\n",
             read_rr_graph_name);
     }
 }
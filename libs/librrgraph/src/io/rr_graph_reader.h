@@ -31,6 +31,7 @@ void load_rr_file(RRGraphBuilder* rr_graph_builder,
                   const char* read_rr_graph_name,
                   std::string* read_rr_graph_filename,
                   bool read_edge_metadata,
+                  bool attach_blob,
                   bool do_check_rr_graph,
                   bool echo_enabled,
                   const char* echo_file_name,
@@ -3,8 +3,10 @@
 #include <vector>
 #include <cstring>
 #include <algorithm>
+#include <memory>
 
 #include "rr_graph_uxsdcxx_interface.h"
+#include "rr_graph_flat_blob.h"
 
 #include "rr_node.h"
 #include "rr_graph_type.h"
@@ -25,6 +27,8 @@
 #include "vtr_log.h"
 #include "vtr_version.h"
 #include "vtr_util.h"
+#include "vtr_flat_blob.h"
+#include "vtr_optional.h"
 #include "arch_util.h"
 #include "physical_types_util.h"
 
@@ -125,16 +129,16 @@ class MetadataBind {
 // Context for walking metadata.
 class t_metadata_dict_iterator {
   public:
-    explicit t_metadata_dict_iterator(const t_metadata_dict* d, const std::function<void(const char*)>* report_error)
+    explicit t_metadata_dict_iterator(const t_metadata_storage_dict& d, const std::function<void(const char*)>* report_error)
         : meta(d)
         , current_index(0)
         , report_error_(report_error) {}
 
     size_t size() {
-        return meta->size();
+        return meta.size();
     }
 
-    const t_metadata_dict::value_type* advance(int n) {
+    const t_metadata_storage_dict::t_entry* advance(int n) {
         if (n != current_index) {
             (*report_error_)(vtr::string_fmt("Iterator out of sync %d != %d",
                                              n, current_index)
@@ -142,19 +146,14 @@ class t_metadata_dict_iterator {
         }
 
         current_index += 1;
-        if (n == 0) {
-            iter = meta->cbegin();
-        } else {
-            ++iter;
-        }
-
-        VTR_ASSERT(iter != meta->end());
-        return &*iter;
+        VTR_ASSERT(size_t(n) < meta.size());
+        current = meta.entry(n);
+        return &current.value();
     }
 
   private:
-    const t_metadata_dict* meta;
-    t_metadata_dict::const_iterator iter;
+    t_metadata_storage_dict meta;
+    vtr::optional<t_metadata_storage_dict::t_entry> current;
     int current_index;
     const std::function<void(const char*)>* report_error_;
 };
@@ -244,7 +243,7 @@ struct RrGraphContextTypes : public uxsd::DefaultRrGraphContextTypes {
     using NodeLocReadContext = const t_rr_node;
     using NodeTimingReadContext = const t_rr_node;
     using NodeSegmentReadContext = const t_rr_node;
-    using MetaReadContext = const t_metadata_dict::value_type*;
+    using MetaReadContext = const t_metadata_storage_dict::t_entry*;
     using MetadataReadContext = t_metadata_dict_iterator;
     using NodeReadContext = const t_rr_node;
     using EdgeReadContext = const EdgeWalker*;
@@ -644,7 +643,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     std::string temp_;
 
   public:
-    inline const char* get_meta_name(const t_metadata_dict::value_type*& meta_value) final {
+    inline const char* get_meta_name(const t_metadata_storage_dict::t_entry*& meta_value) final {
         meta_value->first.get(strings_, &temp_);
         return temp_.c_str();
     }
@@ -652,7 +651,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     inline void set_meta_value(const char* value, MetadataBind& bind) final {
         bind.set_value(value);
     }
-    inline const char* get_meta_value(const t_metadata_dict::value_type*& meta_value) final {
+    inline const char* get_meta_value(const t_metadata_storage_dict::t_entry*& meta_value) final {
         VTR_ASSERT(meta_value->second.size() == 1);
         meta_value->second[0].as_string().get(strings_, &temp_);
         return temp_.c_str();
@@ -677,7 +676,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     inline size_t num_metadata_meta(t_metadata_dict_iterator& itr) final {
         return itr.size();
     }
-    inline const t_metadata_dict::value_type* get_metadata_meta(int n, t_metadata_dict_iterator& itr) final {
+    inline const t_metadata_storage_dict::t_entry* get_metadata_meta(int n, t_metadata_dict_iterator& itr) final {
         return itr.advance(n);
     }
 
@@ -859,7 +858,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     }
     inline t_metadata_dict_iterator get_node_metadata(const t_rr_node& node) final {
         const auto itr = rr_node_metadata_->find(get_node_id(node));
-        return t_metadata_dict_iterator(&itr->second, report_error_);
+        return t_metadata_dict_iterator(itr->second, report_error_);
     }
     inline bool has_node_metadata(const t_rr_node& node) final {
         const auto itr = rr_node_metadata_->find(get_node_id(node));
@@ -1046,7 +1045,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
         bind.finish();
     }
     inline t_metadata_dict_iterator get_edge_metadata(const EdgeWalker*& walker) final {
-        return t_metadata_dict_iterator(&rr_edge_metadata_->find(
+        return t_metadata_dict_iterator(rr_edge_metadata_->find(
                                                               std::make_tuple(
                                                                   walker->current_src_node(),
                                                                   walker->current_sink_node(),
@@ -1755,7 +1754,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
         VTR_ASSERT(read_rr_graph_name_ != nullptr);
         read_rr_graph_filename_->assign(read_rr_graph_name_);
 
-        if (do_check_rr_graph_) {
+        if (do_check_rr_graph_ && !rr_graph_checked_) {
             check_rr_graph(*rr_graph_,
                            physical_tile_types_,
                            *rr_indexed_data_,
@@ -1767,6 +1766,342 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
         }
     }
 
+    /**
+     * @brief Writes the RR graph in the native flat binary format (see rr_graph_flat_blob.h).
+     *
+     * The node and edge arrays are written straight from t_rr_graph_storage (see
+     * vtr::FlatBlobWriter::add_array()), so the memory used while writing does not
+     * grow with the number of nodes and edges (only with the amount of metadata).
+     *
+     * If checked_architecture_id is not null, the graph passed check_rr_graph() against that
+     * architecture, and the blob is given a check stamp.
+     * Throws vtr::VtrError if the file can not be written.
+     */
+    void write_flat_blob(const char* file_name, const char* checked_architecture_id) {
+        vtr::FlatBlobWriter writer;
+
+        writer.add_array(std::vector<uint64_t>{RR_GRAPH_BLOB_VERSION, uint64_t(grid_.get_num_layers()), grid_.width(), grid_.height()});
+        writer.add_array(pack_rr_graph_blob_strings({vtr::VERSION, std::string("Generated from arch file ") + get_arch_file_name()}));
+
+        writer.add_array(std::vector<int>{chan_width_->max, chan_width_->x_min, chan_width_->x_max, chan_width_->y_min, chan_width_->y_max});
+        writer.add_array(chan_width_->x_list);
+        writer.add_array(chan_width_->y_list);
+
+        std::vector<t_rr_blob_switch> switches;
+        std::vector<std::string> switch_names;
+        for (const t_rr_switch_inf& sw : *rr_switch_inf_) {
+            switches.push_back({sw.R, sw.Cin, sw.Cout, sw.Cinternal, sw.Tdel, sw.buf_size, sw.mux_trans_size, int32_t(sw.type())});
+            switch_names.push_back(sw.name);
+        }
+        writer.add_array(switches);
+        writer.add_array(pack_rr_graph_blob_strings(switch_names));
+
+        std::vector<t_rr_blob_segment> segments;
+        std::vector<std::string> segment_names;
+        for (const t_segment_inf& segment : segment_inf_) {
+            segments.push_back({segment.Rmetal, segment.Cmetal});
+            segment_names.push_back(segment.name);
+        }
+        writer.add_array(segments);
+        writer.add_array(pack_rr_graph_blob_strings(segment_names));
+
+        std::vector<t_rr_blob_block_type> block_types;
+        std::vector<std::string> block_type_names;
+        for (const t_physical_tile_type& tile : physical_tile_types_) {
+            block_types.push_back({tile.width, tile.height, int32_t(tile.class_inf.size())});
+            block_type_names.push_back(tile.name);
+        }
+        writer.add_array(block_types);
+        writer.add_array(pack_rr_graph_blob_strings(block_type_names));
+
+        std::vector<t_rr_blob_grid_loc> grid_locs;
+        grid_locs.reserve(grid_.grid_size());
+        for (size_t iloc = 0; iloc < grid_.grid_size(); ++iloc) {
+            const t_grid_tile* grid_loc = grid_.get_grid_locs_grid_loc(iloc);
+            grid_locs.push_back({grid_loc->type->index, grid_loc->width_offset, grid_loc->height_offset});
+        }
+        writer.add_array(grid_locs);
+
+        writer.add_array(rr_nodes_->node_data());
+        writer.add_array(rr_nodes_->node_ptc_data());
+        writer.add_array(rr_nodes_->node_layer_data());
+        writer.add_array(rr_nodes_->node_ptc_twist_incr_data());
+        writer.add_array(*rr_rc_data_);
+
+        std::vector<short> seg_index;
+        for (const t_rr_indexed_data& indexed_data : *rr_indexed_data_) {
+            seg_index.push_back(indexed_data.seg_index);
+        }
+        writer.add_array(seg_index);
+
+        writer.add_array(rr_nodes_->edge_src_node_data());
+        writer.add_array(rr_nodes_->edge_dest_node_data());
+        writer.add_array(rr_nodes_->edge_switch_data());
+
+        std::vector<int> node_meta_nodes;
+        std::vector<std::string> node_meta_names;
+        std::vector<std::string> node_meta_values;
+        for (const auto& node_meta : *rr_node_metadata_) {
+            for (const auto& meta : node_meta.second) {
+                for (const auto& value : meta.second) {
+                    node_meta_nodes.push_back(node_meta.first);
+                    node_meta_names.push_back(meta.first.get(strings_));
+                    node_meta_values.push_back(value.as_string().get(strings_));
+                }
+            }
+        }
+        writer.add_array(node_meta_nodes);
+        writer.add_array(pack_rr_graph_blob_strings(node_meta_names));
+        writer.add_array(pack_rr_graph_blob_strings(node_meta_values));
+
+        std::vector<t_rr_blob_edge_key> edge_meta_edges;
+        std::vector<std::string> edge_meta_names;
+        std::vector<std::string> edge_meta_values;
+        for (const auto& edge_meta : *rr_edge_metadata_) {
+            for (const auto& meta : edge_meta.second) {
+                for (const auto& value : meta.second) {
+                    edge_meta_edges.push_back({std::get<0>(edge_meta.first), std::get<1>(edge_meta.first), std::get<2>(edge_meta.first)});
+                    edge_meta_names.push_back(meta.first.get(strings_));
+                    edge_meta_values.push_back(value.as_string().get(strings_));
+                }
+            }
+        }
+        writer.add_array(edge_meta_edges);
+        writer.add_array(pack_rr_graph_blob_strings(edge_meta_names));
+        writer.add_array(pack_rr_graph_blob_strings(edge_meta_values));
+
+        std::vector<std::string> check_stamp;
+        if (checked_architecture_id) {
+            VTR_ASSERT(writer.num_sections() == RR_GRAPH_BLOB_CHECK_STAMP);
+            check_stamp.push_back(rr_graph_blob_check_stamp([&](size_t isection) { return writer.section_data(isection); },
+                                                            checked_architecture_id, is_flat_));
+        }
+        writer.add_array(pack_rr_graph_blob_strings(check_stamp));
+
+        writer.write(file_name);
+    }
+
+    /**
+     * @brief Loads an RR graph written by write_flat_blob(), checking it matches the architecture.
+     *
+     * The node and edge arrays are bulk copied from the memory-mapped file, or with attach, viewed
+     * in place: the file then stays mapped (read-only) for the lifetime of the graph, and the pages
+     * of the arrays are shared by all the processes attaching the same file. The remaining
+     * post-processing is shared with the other formats (finish_rr_graph_rr_edges() and finish_load()).
+     * check_rr_graph() is skipped if the blob carries a valid check stamp for architecture_id
+     * (which may be null).
+     * Throws vtr::VtrError or std::runtime_error if the file is invalid.
+     */
+    void load_flat_blob(const char* file_name, const char* architecture_id, bool attach) {
+        auto mapped_blob = std::make_shared<const vtr::FlatBlobReader>(file_name);
+        const vtr::FlatBlobReader& blob = *mapped_blob;
+        void* ctx = nullptr;
+
+        if (blob.num_sections() != RR_GRAPH_BLOB_NUM_SECTIONS) {
+            report_error("RR graph blob has %zu sections (expected %d)", blob.num_sections(), RR_GRAPH_BLOB_NUM_SECTIONS);
+        }
+
+        auto header = blob.array<uint64_t>(RR_GRAPH_BLOB_HEADER);
+        if (header.size() != 4 || header[0] != RR_GRAPH_BLOB_VERSION) {
+            report_error("RR graph blob has an unsupported version (expected %zu)", size_t(RR_GRAPH_BLOB_VERSION));
+        }
+        if (header[1] != size_t(grid_.get_num_layers()) || header[2] != grid_.width() || header[3] != grid_.height()) {
+            report_error("Architecture file does not match RR graph's grid size: arch uses %dx%zux%zu, RR graph uses %zux%zux%zu",
+                         grid_.get_num_layers(), grid_.width(), grid_.height(), size_t(header[1]), size_t(header[2]), size_t(header[3]));
+        }
+
+        std::vector<std::string> tool = unpack_rr_graph_blob_strings(blob.array<char>(RR_GRAPH_BLOB_TOOL));
+        if (tool.size() != 2) {
+            report_error("RR graph blob has an invalid tool section");
+        }
+        set_rr_graph_tool_version(tool[0].c_str(), ctx);
+        set_rr_graph_tool_comment(tool[1].c_str(), ctx);
+
+        /* Channels */
+        auto chan_width = blob.array<int>(RR_GRAPH_BLOB_CHAN_WIDTH);
+        if (chan_width.size() != 5) {
+            report_error("RR graph blob has an invalid channel section");
+        }
+        init_channels_channel(ctx, chan_width[0], chan_width[2], chan_width[1], chan_width[4], chan_width[3]);
+        auto x_list = blob.array<int>(RR_GRAPH_BLOB_CHAN_X_LIST);
+        auto y_list = blob.array<int>(RR_GRAPH_BLOB_CHAN_Y_LIST);
+        if (x_list.size() != chan_width_->x_list.size() || y_list.size() != chan_width_->y_list.size()) {
+            report_error("RR graph blob channel lists do not match the grid size");
+        }
+        chan_width_->x_list.assign(x_list.begin(), x_list.end());
+        chan_width_->y_list.assign(y_list.begin(), y_list.end());
+
+        /* Switches */
+        auto switches = blob.array<t_rr_blob_switch>(RR_GRAPH_BLOB_SWITCHES);
+        std::vector<std::string> switch_names = unpack_rr_graph_blob_strings(blob.array<char>(RR_GRAPH_BLOB_SWITCH_NAMES));
+        if (switch_names.size() != switches.size()) {
+            report_error("RR graph blob has %zu switches but %zu switch names", switches.size(), switch_names.size());
+        }
+        rr_switch_inf_->clear();
+        rr_switch_inf_->resize(switches.size());
+        for (size_t iswitch = 0; iswitch < switches.size(); ++iswitch) {
+            t_rr_switch_inf* sw = &(*rr_switch_inf_)[RRSwitchId(iswitch)];
+            set_switch_name(switch_names[iswitch].c_str(), sw);
+            sw->set_type(SwitchType(switches[iswitch].type));
+            sw->R = switches[iswitch].R;
+            sw->Cin = switches[iswitch].Cin;
+            sw->Cout = switches[iswitch].Cout;
+            sw->Cinternal = switches[iswitch].Cinternal;
+            sw->Tdel = switches[iswitch].Tdel;
+            sw->buf_size = switches[iswitch].buf_size;
+            sw->mux_trans_size = switches[iswitch].mux_trans_size;
+        }
+
+        /* Segments */
+        auto segments = blob.array<t_rr_blob_segment>(RR_GRAPH_BLOB_SEGMENTS);
+        std::vector<std::string> segment_names = unpack_rr_graph_blob_strings(blob.array<char>(RR_GRAPH_BLOB_SEGMENT_NAMES));
+        preallocate_segments_segment(ctx, segments.size());
+        if (segment_names.size() != segments.size()) {
+            report_error("RR graph blob has %zu segments but %zu segment names", segments.size(), segment_names.size());
+        }
+        for (size_t iseg = 0; iseg < segments.size(); ++iseg) {
+            const t_segment_inf* segment = add_segments_segment(ctx, iseg);
+            set_segment_name(segment_names[iseg].c_str(), segment);
+            set_segment_timing_R_per_meter(segments[iseg].Rmetal, segment);
+            set_segment_timing_C_per_meter(segments[iseg].Cmetal, segment);
+        }
+
+        /* Block types */
+        auto block_types = blob.array<t_rr_blob_block_type>(RR_GRAPH_BLOB_BLOCK_TYPES);
+        std::vector<std::string> block_type_names = unpack_rr_graph_blob_strings(blob.array<char>(RR_GRAPH_BLOB_BLOCK_TYPE_NAMES));
+        preallocate_block_types_block_type(ctx, block_types.size());
+        if (block_type_names.size() != block_types.size()) {
+            report_error("RR graph blob has %zu block types but %zu block type names", block_types.size(), block_type_names.size());
+        }
+        for (size_t itype = 0; itype < block_types.size(); ++itype) {
+            auto context = add_block_types_block_type(ctx, block_types[itype].height, itype, block_types[itype].width);
+            set_block_type_name(block_type_names[itype].c_str(), context);
+            if ((int)physical_tile_types_[itype].class_inf.size() != block_types[itype].num_classes) {
+                report_error("Architecture file does not match block type");
+            }
+        }
+
+        /* Grid */
+        auto grid_locs = blob.array<t_rr_blob_grid_loc>(RR_GRAPH_BLOB_GRID_LOCS);
+        if (grid_locs.size() != grid_.grid_size()) {
+            report_error("Architecture file does not match RR graph's number of grid locations");
+        }
+        for (size_t iloc = 0; iloc < grid_locs.size(); ++iloc) {
+            const t_grid_tile* grid_loc = grid_.get_grid_locs_grid_loc(iloc);
+            if (grid_loc->type->index != grid_locs[iloc].block_type
+                || grid_loc->width_offset != grid_locs[iloc].width_offset
+                || grid_loc->height_offset != grid_locs[iloc].height_offset) {
+                report_error("Architecture file does not match RR graph's block type at (%d, %d, %d)",
+                             grid_.get_grid_loc_layer(grid_loc), grid_.get_grid_loc_x(grid_loc), grid_.get_grid_loc_y(grid_loc));
+            }
+        }
+
+        /* Nodes */
+        auto nodes = blob.array<t_rr_node_data>(RR_GRAPH_BLOB_NODES);
+        auto node_ptc = blob.array<t_rr_node_ptc_data>(RR_GRAPH_BLOB_NODE_PTC);
+        auto node_layer = blob.array<short>(RR_GRAPH_BLOB_NODE_LAYER);
+        auto node_ptc_twist_incr = blob.array<short>(RR_GRAPH_BLOB_NODE_PTC_TWIST_INCR);
+        if (node_ptc.size() != nodes.size() || node_layer.size() != nodes.size()
+            || (!node_ptc_twist_incr.empty() && node_ptc_twist_incr.size() != nodes.size())) {
+            report_error("RR graph blob node arrays have inconsistent sizes");
+        }
+        rr_nodes_->load_nodes(nodes, node_ptc, node_layer, node_ptc_twist_incr,
+                              attach ? mapped_blob : nullptr);
+
+        //The RC data is deduplicated with any already loaded, so node RC indices only need
+        //to be remapped if it was not empty
+        auto rc_data = blob.array<t_rr_rc_data>(RR_GRAPH_BLOB_RC_DATA);
+        std::vector<short> rc_index_map;
+        bool identity_rc_index_map = true;
+        for (size_t irc = 0; irc < rc_data.size(); ++irc) {
+            rc_index_map.push_back(find_create_rr_rc_data(rc_data[irc].R, rc_data[irc].C, *rr_rc_data_));
+            identity_rc_index_map &= (rc_index_map.back() == short(irc));
+        }
+        for (size_t inode = 0; inode < nodes.size(); ++inode) {
+            if (size_t(nodes[inode].rc_index_) >= rc_data.size()) {
+                report_error("inode %zu has RC index %d, larger than the %zu RC values", inode, nodes[inode].rc_index_, rc_data.size());
+            }
+            if (!identity_rc_index_map) {
+                rr_graph_builder_->set_node_rc_index(RRNodeId(inode), NodeRCIndex(rc_index_map[nodes[inode].rc_index_]));
+            }
+        }
+
+        auto seg_index = blob.array<short>(RR_GRAPH_BLOB_SEG_INDEX);
+        if (seg_index.size() != CHANX_COST_INDEX_START + segment_inf_x_.size() + segment_inf_y_.size()) {
+            report_error("RR graph blob has %zu cost indices (expected %zu)",
+                         seg_index.size(), CHANX_COST_INDEX_START + segment_inf_x_.size() + segment_inf_y_.size());
+        }
+        seg_index_.assign(seg_index.begin(), seg_index.end());
+
+        /* Edges */
+        auto edge_src_nodes = blob.array<RRNodeId>(RR_GRAPH_BLOB_EDGE_SRC_NODES);
+        auto edge_dest_nodes = blob.array<RRNodeId>(RR_GRAPH_BLOB_EDGE_DEST_NODES);
+        auto edge_switches = blob.array<short>(RR_GRAPH_BLOB_EDGE_SWITCHES);
+        if (edge_dest_nodes.size() != edge_src_nodes.size() || edge_switches.size() != edge_src_nodes.size()) {
+            report_error("RR graph blob edge arrays have inconsistent sizes");
+        }
+        for (RRNodeId src_node : edge_src_nodes) {
+            if (size_t(src_node) >= rr_nodes_->size()) {
+                report_error("source_node %zu is larger than rr_nodes.size() %zu", size_t(src_node), rr_nodes_->size());
+            }
+        }
+        rr_nodes_->load_edges(edge_src_nodes, edge_dest_nodes, edge_switches,
+                              attach ? mapped_blob : nullptr);
+        //Checks the sink nodes and switches
+        finish_rr_graph_rr_edges(ctx);
+
+        /* Metadata */
+        auto node_meta_nodes = blob.array<int>(RR_GRAPH_BLOB_NODE_META_NODES);
+        std::vector<std::string> node_meta_names = unpack_rr_graph_blob_strings(blob.array<char>(RR_GRAPH_BLOB_NODE_META_NAMES));
+        std::vector<std::string> node_meta_values = unpack_rr_graph_blob_strings(blob.array<char>(RR_GRAPH_BLOB_NODE_META_VALUES));
+        if (node_meta_names.size() != node_meta_nodes.size() || node_meta_values.size() != node_meta_nodes.size()) {
+            report_error("RR graph blob node metadata arrays have inconsistent sizes");
+        }
+        for (size_t imeta = 0; imeta < node_meta_nodes.size(); ++imeta) {
+            MetadataBind bind(rr_node_metadata_, rr_edge_metadata_, strings_, empty_);
+            bind.set_node_target(node_meta_nodes[imeta]);
+            bind.set_name(node_meta_names[imeta].c_str());
+            bind.set_value(node_meta_values[imeta].c_str());
+            bind.bind();
+            bind.finish();
+        }
+
+        if (read_edge_metadata_) {
+            auto edge_meta_edges = blob.array<t_rr_blob_edge_key>(RR_GRAPH_BLOB_EDGE_META_EDGES);
+            std::vector<std::string> edge_meta_names = unpack_rr_graph_blob_strings(blob.array<char>(RR_GRAPH_BLOB_EDGE_META_NAMES));
+            std::vector<std::string> edge_meta_values = unpack_rr_graph_blob_strings(blob.array<char>(RR_GRAPH_BLOB_EDGE_META_VALUES));
+            if (edge_meta_names.size() != edge_meta_edges.size() || edge_meta_values.size() != edge_meta_edges.size()) {
+                report_error("RR graph blob edge metadata arrays have inconsistent sizes");
+            }
+            for (size_t imeta = 0; imeta < edge_meta_edges.size(); ++imeta) {
+                MetadataBind bind(rr_node_metadata_, rr_edge_metadata_, strings_, empty_);
+                bind.set_edge_target(edge_meta_edges[imeta].src_node, edge_meta_edges[imeta].sink_node, edge_meta_edges[imeta].switch_id);
+                bind.set_name(edge_meta_names[imeta].c_str());
+                bind.set_value(edge_meta_values[imeta].c_str());
+                bind.bind();
+                bind.finish();
+            }
+        }
+
+        /* Check stamp */
+        std::vector<std::string> check_stamp = unpack_rr_graph_blob_strings(blob.array<char>(RR_GRAPH_BLOB_CHECK_STAMP));
+        if (do_check_rr_graph_ && architecture_id && check_stamp.size() == 1) {
+            if (check_stamp[0] == rr_graph_blob_check_stamp([&](size_t isection) { return blob.section_data(isection); }, architecture_id, is_flat_)) {
+                VTR_LOG("RR graph blob was already checked against this architecture, skipping RR graph check\n");
+                rr_graph_checked_ = true;
+            } else {
+                VTR_LOG("RR graph blob check stamp does not match, re-checking RR graph\n");
+            }
+        }
+
+        finish_load();
+
+        if (attach) {
+            VTR_LOG("Attached RR graph blob: %.1f MiB of node and edge data shared read-only\n",
+                    rr_nodes_->mapped_memory_usage() / (1024. * 1024.));
+        }
+    }
+
   private:
     /*Allocates and load the rr_node look up table. SINK and SOURCE, IPIN and OPIN
      *share the same look-up table. CHANX and CHANY have individual look-ups */
@@ -2068,6 +2403,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     const t_graph_type graph_type_;
     const enum e_base_cost_type base_cost_type_;
     const bool do_check_rr_graph_;
+    bool rr_graph_checked_ = false; ///<Set if the loaded graph carried a valid check stamp (see load_flat_blob())
     const char* read_rr_graph_name_;
     const bool read_edge_metadata_;
     const bool echo_enabled_;
@@ -40,7 +40,8 @@ void write_rr_graph(RRGraphBuilder* rr_graph_builder,
                     const int virtual_clock_network_root_idx,
                     bool echo_enabled,
                     const char* echo_file_name,
-                    bool is_flat) {
+                    bool is_flat,
+                    bool is_checked) {
 
     RrGraphSerializer reader(
         /*graph_type=*/t_graph_type(),
@@ -84,6 +85,12 @@ void write_rr_graph(RRGraphBuilder* rr_graph_builder,
         uxsd::write_rr_graph_capnp(reader, context, rr_graph);
         writeMessageToFile(file_name, &builder);
 #endif
+    } else if (vtr::check_file_name_extension(file_name, ".blob")) {
+        try {
+            reader.write_flat_blob(file_name, is_checked ? arch->architecture_id : nullptr);
+        } catch (const vtr::VtrError& e) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to write RR graph blob: %s\n", e.what());
+        }
     } else {
         VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
                         "Unknown extension on output %s",
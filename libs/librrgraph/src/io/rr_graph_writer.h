@@ -1,6 +1,9 @@
 /*
  * This function writes the RR_graph generated by VPR into a file in XML format
  * Information included in the file includes rr nodes, rr switches, the grid, block info, node indices
+ *
+ * is_checked should be set if the RR graph passed check_rr_graph(), so that loading
+ * an unchanged .blob file can skip the check.
  */
 
 #ifndef RR_GRAPH_WRITER_H
@@ -26,6 +29,7 @@ void write_rr_graph(RRGraphBuilder* rr_graph_builder,
                     const int virtual_clock_network_root_idx,
                     bool echo_enabled,
                     const char* echo_file_name,
-                    bool is_flat);
+                    bool is_flat,
+                    bool is_checked);
 
 #endif
@@ -296,6 +296,23 @@ _static_unused(l_half_sum)
     }
 }
 
+/**
+ * mask of the n least significant bits of a 64 bit word
+ */
+static inline uint64_t word_mask(size_t n) {
+    return (n >= 64) ? ~static_cast<uint64_t>(0) : ((static_cast<uint64_t>(1) << n) - 1);
+}
+
+/**
+ * extends the n bit long word to 64 bits with its msb if signed, and with 0 otherwise
+ */
+static inline uint64_t extend_word(uint64_t word, size_t n, bool is_signed) {
+    word &= word_mask(n);
+    if (is_signed && n && n < 64 && ((word >> (n - 1)) & 0x1))
+        word |= ~word_mask(n);
+    return word;
+}
+
 static char bit_to_u(bit_value_t bit) {
     switch (bit) {
         case _1:
@@ -427,6 +444,17 @@ class BitFields {
     static size_t size() {
         return (sizeof(T) << 2); // 8 bit in a byte, 2 bits for a verilog bits = 4 bits in a byte, << 2 = sizeof x 4
     }
+
+    /**
+     * raw access to the 2 bit encoded verilog bits
+     */
+    T get_bits() const {
+        return this->bits;
+    }
+
+    void set_bits(T new_bits) {
+        this->bits = new_bits;
+    }
 };
 
 // #define DEBUG_V_BITS
@@ -525,14 +553,55 @@ class VerilogBits {
     }
 
     bool has_unknown() {
-        for (size_t address = 0x0; address < this->size(); address++) {
-            if (is_unk[this->get_bit(address)])
+        // x and z are the encodings with the high bit set, so whole bitfields are checked at once
+        const size_t field_size = BitFields<veri_internal_bits_t>::size();
+        for (size_t index = 0; index * field_size < this->size(); index++) {
+            uint64_t unknown = this->bits[index].get_bits() & static_cast<veri_internal_bits_t>(_All_x);
+            unknown &= word_mask(2 * std::min(field_size, this->size() - index * field_size));
+            if (unknown)
                 return true;
         }
 
         return false;
     }
 
+    /**
+     * Fast path for small values: gets the bits as a 64 bit word, bit i being bit i of the bitstring
+     * returns false if there are more than 64 bits, or any of them is unknown
+     */
+    bool get_known_word(uint64_t& word) {
+        if (this->size() > 64 || this->has_unknown())
+            return false;
+
+        const size_t field_size = BitFields<veri_internal_bits_t>::size();
+        word = 0;
+        for (size_t index = 0; index * field_size < this->size(); index++) {
+            uint64_t field_bits = this->bits[index].get_bits();
+            for (size_t i = 0; i < field_size; i++)
+                word |= ((field_bits >> (2 * i)) & 0x1) << (index * field_size + i);
+        }
+        word &= word_mask(this->size());
+        return true;
+    }
+
+    /**
+     * builds a bitstring of data_size known bits from a word
+     * the bits past the 64 of the word repeat its msb, as for a sign extended integer
+     */
+    static VerilogBits from_word(size_t data_size, uint64_t word) {
+        VerilogBits other(data_size, (data_size > 64 && (word >> 63)) ? _1 : _0);
+
+        const size_t field_size = BitFields<veri_internal_bits_t>::size();
+        word &= word_mask(data_size);
+        for (size_t index = 0; index * field_size < data_size && index * field_size < 64; index++) {
+            veri_internal_bits_t field_bits = 0;
+            for (size_t i = 0; i < field_size; i++)
+                field_bits = static_cast<veri_internal_bits_t>(field_bits | (((word >> (index * field_size + i)) & 0x1) << (2 * i)));
+            other.bits[index].set_bits(field_bits);
+        }
+        return other;
+    }
+
     bool is_only_z() {
         for (size_t address = 0x0; address < this->size(); address++) {
             if (!is_z_bit[this->get_bit(address)])
@@ -595,6 +664,10 @@ class VerilogBits {
     }
 
     VerilogBits twos_complement(BitSpace::bit_value_t previous_carry) {
+        uint64_t word;
+        if ((previous_carry == _0 || previous_carry == _1) && this->get_known_word(word))
+            return from_word(this->bit_size, ~word + previous_carry);
+
         VerilogBits other(this->bit_size, _0);
 
         for (size_t i = 0; i < this->size(); i++) {
@@ -637,6 +710,13 @@ class VerilogBits {
             new_size = last_bit_id + 1;
         }
 
+        uint64_t word;
+        if (new_size <= 64 && (pad == _0 || pad == _1) && this->get_known_word(word)) {
+            if (pad == _1)
+                word |= ~word_mask(this->size());
+            return from_word(new_size, word);
+        }
+
         VerilogBits other(new_size, BitSpace::_0);
 
         size_t i = 0;
@@ -747,6 +827,17 @@ class VNumber {
         this->defined_size = this_defined_size;
     }
 
+    /***
+     * fast path for small values, see VerilogBits::get_known_word
+     */
+    bool get_known_word(uint64_t& word) {
+        return this->bitstring.get_known_word(word);
+    }
+
+    static VNumber from_word(size_t len, uint64_t word, bool input_sign, bool this_defined_size) {
+        return VNumber(BitSpace::VerilogBits::from_word(len, word), this_defined_size, input_sign);
+    }
+
     /***
      * getters to 64 bit int
      */
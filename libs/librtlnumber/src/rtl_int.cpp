@@ -54,6 +54,34 @@ static compare_bit eval_op(VNumber& a_in, VNumber& b_in) {
     bool neg_a = (a_in.is_negative());
     bool neg_b = (b_in.is_negative());
 
+    // fast path: known values of up to 64 bits are compared as words, the same way as the bits below
+    uint64_t word_a;
+    uint64_t word_b;
+    size_t word_length = std::max(a_in.size(), b_in.size());
+    if (word_length <= 64 && a_in.get_known_word(word_a) && b_in.get_known_word(word_b)) {
+        if (neg_a && !neg_b) {
+            return LT_EVAL;
+        } else if (!neg_a && neg_b) {
+            return GT_EVAL;
+        }
+
+        bool invert_result = (neg_a && neg_b);
+        if (invert_result) {
+            word_a = -word_a;
+            word_b = -word_b;
+        }
+
+        word_a = extend_word(word_a, a_in.size(), a_in.is_signed()) & word_mask(word_length);
+        word_b = extend_word(word_b, b_in.size(), b_in.is_signed()) & word_mask(word_length);
+
+        if (word_a < word_b) {
+            return (!invert_result) ? LT_EVAL : GT_EVAL;
+        } else if (word_a > word_b) {
+            return (!invert_result) ? GT_EVAL : LT_EVAL;
+        }
+        return EQ_EVAL;
+    }
+
     if (neg_a && !neg_b) {
         return LT_EVAL;
     } else if (!neg_a && neg_b) {
@@ -140,6 +168,14 @@ static VNumber sum_op(VNumber& a, VNumber& b, const bit_value_t& initial_carry,
 
     //("pad_b: '" << (unsigned(pad_b)) << "'");
 
+    // fast path: known values of up to 64 bits are added as words
+    uint64_t word_a;
+    uint64_t word_b;
+    if (new_length <= 64 && (initial_carry == _0 || initial_carry == _1) && a.get_known_word(word_a) && b.get_known_word(word_b)) {
+        uint64_t sum = extend_word(word_a, a.size(), pad_a == _1) + extend_word(word_b, b.size(), pad_b == _1) + initial_carry;
+        return VNumber::from_word(new_length, sum, is_addition_signed_operation, a.is_defined_size() && b.is_defined_size());
+    }
+
     bit_value_t previous_carry = initial_carry;
     VNumber result(new_length, _0, is_addition_signed_operation, a.is_defined_size() && b.is_defined_size());
 
@@ -163,10 +199,22 @@ static VNumber sum_op(VNumber& a, VNumber& b, const bit_value_t& initial_carry,
 
 static VNumber shift_op(VNumber& a, int64_t b, bool sign_shift) {
     VNumber to_return;
+    uint64_t word;
 
     if (b == 0) {
         to_return = a;
     }
+    // fast path: known values of up to 64 bits are shifted as words
+    else if (b < 0 && static_cast<size_t>(-b) < a.size() && a.get_known_word(word)) {
+        size_t u_b = static_cast<size_t>(-b);
+        bit_value_t pad = (sign_shift) ? a.get_padding_bit() : BitSpace::_0;
+        word >>= u_b;
+        if (pad == BitSpace::_1)
+            word |= word_mask(a.size()) & ~word_mask(a.size() - u_b);
+        to_return = VNumber::from_word(a.size(), word, sign_shift, a.is_defined_size());
+    } else if (b > 0 && (a.size() + static_cast<size_t>(b)) <= 64 && a.get_known_word(word)) {
+        to_return = VNumber::from_word(a.size() + static_cast<size_t>(b), word << b, sign_shift, a.is_defined_size());
+    }
     //if b is negative then shift right
     else if (b < 0) {
         size_t u_b = static_cast<size_t>(-b);
@@ -519,11 +567,77 @@ VNumber V_MINUS(VNumber& a, VNumber& b) {
     return V_MINUS(a, b, _0);
 }
 
+/**
+ * Sets product to a * b, and returns whether it fits in a signed 64 bit word
+ */
+static bool multiply_fits_signed_word(uint64_t a, uint64_t b, uint64_t& product) {
+#if defined(__GNUC__) || defined(__clang__)
+    if (__builtin_mul_overflow(a, b, &product))
+        return false;
+#else
+    product = a * b;
+    if (a != 0 && product / a != b)
+        return false;
+#endif
+    return !(product >> 63);
+}
+
+/**
+ * Fast path of V_MULTIPLY for known values of up to 64 bits whose product fits in a signed 64 bit word
+ * The value is the product, and the size and sign are the ones the shift and add loop of V_MULTIPLY ends with
+ */
+static bool multiply_words(VNumber& a_in, VNumber& b_in, VNumber& result) {
+    uint64_t word_a;
+    uint64_t word_b;
+    if (!a_in.get_known_word(word_a) || !b_in.get_known_word(word_b))
+        return false;
+
+    bool is_multiply_signed_operation = is_signed_operation(a_in, b_in);
+    bool neg_a = a_in.is_negative();
+    bool neg_b = b_in.is_negative();
+
+    // the magnitudes, one bit longer when their 2's complement is identical to the original
+    size_t size_a = a_in.size();
+    size_t size_b = b_in.size();
+    if (neg_a) {
+        word_a = -extend_word(word_a, size_a, true);
+        size_a += (word_a == (static_cast<uint64_t>(1) << (size_a - 1)));
+    }
+    if (neg_b) {
+        word_b = -extend_word(word_b, size_b, true);
+        size_b += (word_b == (static_cast<uint64_t>(1) << (size_b - 1)));
+    }
+
+    uint64_t product;
+    if (!multiply_fits_signed_word(word_a, word_b, product))
+        return false;
+
+    // the result starts as the 32 bit signed "0", and grows by one bit past the shifted b at each add
+    size_t result_size = 32;
+    bool result_sign = true;
+    bool result_defined_size = false;
+    for (size_t i = 0; i < size_a; i++) {
+        if (i < 64 && ((word_a >> i) & 0x1)) {
+            result_size = std::max(result_size, size_b + i) + 1;
+            result_sign = result_sign && ((i == 0) ? b_in.is_signed() : is_multiply_signed_operation);
+        }
+    }
+
+    bool invert_result = ((!neg_a && neg_b) || (neg_a && !neg_b));
+    result = VNumber::from_word(result_size, (invert_result) ? -product : product, result_sign, result_defined_size);
+    return true;
+}
+
 VNumber V_MULTIPLY(VNumber& a_in, VNumber& b_in) {
     if (a_in.has_unknown() || b_in.has_unknown()) {
         return AMBIGUOUS_VALUE;
     }
 
+    VNumber fast_result;
+    if (multiply_words(a_in, b_in, fast_result)) {
+        return fast_result;
+    }
+
     VNumber a;
     VNumber b;
 
@@ -75,6 +75,7 @@ t_array_ref *assignment_list = NULL;
 t_array_ref *node_list = NULL;
 t_array_ref *pin_list = NULL;
 t_hash_table *pin_hash = NULL;
+t_hash_table *node_hash = NULL;
 t_node	*most_recently_used_node = NULL;
 
 /*  //Moved to vqm_common.h
@@ -90,6 +91,8 @@ int find_position_for_net_in_array(char *name, t_array_ref *net_list);
 char most_recent_error[ERROR_LENGTH];
 
 size_t hash_func(char* key, t_hash_table* hash_table);
+t_hash_table* create_hash_table(size_t size);
+void free_hash_table(t_hash_table** hash_table);
 t_hash_elem* get_hash_entry(char* key, t_hash_table* hash_table);
 void insert_hash(char* key, size_t value, t_hash_table* hash_table);
 t_index_pass find_position_for_net_in_array_by_hash(char* name, t_array_ref *net_list);
@@ -119,6 +122,8 @@ void vqm_data_cleanup()
 		free(module_list);
 		module_list = NULL;
 	}
+	free_hash_table(&pin_hash);
+	free_hash_table(&node_hash);
 	/* Set other reference lists to NULL */
 	module_list = NULL;
 	assignment_list = NULL;
@@ -317,6 +322,10 @@ void add_module(char *name, t_array_ref **pins, t_array_ref **assignments, t_arr
 	*assignments = NULL;
 	*pins = NULL;
 	*nodes = NULL;
+
+	/* The name lookups index into the lists just released, so the next module starts afresh */
+	free_hash_table(&pin_hash);
+	free_hash_table(&node_hash);
 }
 
 
@@ -352,13 +361,9 @@ t_pin_def *add_pin(char *name, int left, int right, t_pin_def_type type, t_parse
 
     /* Create the hash table for quick name -> pin_index lookup */
     if (pin_hash == NULL) {
-
-        pin_hash = (t_hash_table*) malloc(sizeof(t_hash_table));
-
         //Allocate twice as many spaces in the hash table as is needed, this should prevent
         //the table from becoming too full.
-        pin_hash->table = (t_hash_elem*) malloc(2*parse_info->number_of_pins*sizeof(t_hash_elem));
-        pin_hash->size = 2*parse_info->number_of_pins;
+        pin_hash = create_hash_table(2*parse_info->number_of_pins);
     }
 
     //Append the element, the position is one less thatn the size of the array
@@ -583,8 +588,15 @@ void add_node(char* type, char *name, t_array_ref **ports, t_parse_info* parse_i
 		node_list->pointer = (void**) malloc(parse_info->number_of_nodes * ELEMENT_SIZE);
 	}
 
+	/* Create the hash table for quick name -> node lookup by defparams */
+	if (node_hash == NULL)
+	{
+		node_hash = create_hash_table(2*parse_info->number_of_nodes);
+	}
+
 	/* Add node to the list */
-    append_array_element((intptr_t) my_node, node_list);
+    size_t position = append_array_element((intptr_t) my_node, node_list) - 1;
+    insert_hash(my_node->name, position, node_hash);
 
 	/* Set most recently used node */
 	most_recently_used_node = my_node;
@@ -641,22 +653,60 @@ size_t hash_func(char* key, t_hash_table* hash_table)
  * size of the hash table
  */
 {
-    //VPRs hash function
+    //FNV-1a: a single pass over the key, spreading the long, mostly identical
+    //hierarchical names of a VQM netlist well over the table
+    uint64_t hash_val = 14695981039346656037ULL;
+    const unsigned char* c;
+
+    for (c = (const unsigned char*) key; *c != 0; c++) {
+        hash_val ^= *c;
+        hash_val *= 1099511628211ULL;
+    }
+
+    return (size_t) (hash_val % hash_table->size);
+}
+
+t_hash_table* create_hash_table(size_t size)
+/* Allocates a hash table with size empty entries (at least one).
+ */
+{
+    t_hash_table* hash_table = (t_hash_table*) malloc(sizeof(t_hash_table));
+    VTR_ASSERT(hash_table != NULL);
 
-    int i;
-	int hash_val = 0, mult = 1;
+    if (size == 0) {
+        size = 1;
+    }
 
-	i = strlen(key);
-	for (i = strlen(key) - 1; i >= 0; i--) {
-		hash_val += mult * ((int) key[i]);
-		mult *= 7;
-	}
-	hash_val += (int) key[0];
-	hash_val %= hash_table->size;
+    //Empty entries must have NULL key and next
+    hash_table->table = (t_hash_elem*) calloc(size, sizeof(t_hash_elem));
+    VTR_ASSERT(hash_table->table != NULL);
+    hash_table->size = size;
+
+    return hash_table;
+}
 
-	hash_val = abs(hash_val);
+void free_hash_table(t_hash_table** hash_table)
+/* Frees the hash table (but not the keys, which are owned by the netlist),
+ * and sets it to NULL.
+ */
+{
+    size_t index;
+
+    if (*hash_table == NULL) {
+        return;
+    }
 
-    return hash_val;
+    for (index = 0; index < (*hash_table)->size; index++) {
+        t_hash_elem* entry = (*hash_table)->table[index].next;
+        while (entry != NULL) {
+            t_hash_elem* next = entry->next;
+            free(entry);
+            entry = next;
+        }
+    }
+    free((*hash_table)->table);
+    free(*hash_table);
+    *hash_table = NULL;
 }
 
 t_hash_elem* get_hash_entry(char* key, t_hash_table* hash_table)
@@ -776,8 +826,9 @@ t_index_pass find_position_for_net_in_array_by_hash(char* name, t_array_ref* /*n
     t_hash_elem* entry = get_hash_entry(name, pin_hash);
 
     //We now should have a matching element, the name field should not
-    //be NULL.  If it is, then this name hasn't been seen before.
-    if (entry->key == NULL) {
+    //be NULL (or another name hashed to the same slot).  If it is, then
+    //this name hasn't been seen before.
+    if (entry->key == NULL || strcmp(entry->key, name) != 0) {
         net_index.found = T_FALSE;
         net_index.index = 0; //Set index to zero, but it isn't really valid
 
@@ -961,24 +1012,23 @@ t_node *locate_node_by_name(char *name)
  * found then return NULL.
  */
 {
-	size_t index;
-	t_node *result = NULL;
+	t_hash_elem *entry;
 
 	VTR_ASSERT(name != NULL);
 
-	/* Perform a linear search */
-	for(index = 0; index < node_list->array_size; index++)
+	if (node_hash == NULL)
 	{
-		t_node *temp_node = (t_node *) (node_list->pointer[index]);
+		return NULL;
+	}
 
-		if (strcmp(temp_node->name, name) == 0)
-		{
-			result = temp_node;
-			break;
-		}
+	/* Look the node up by name, rather than searching every node of the module per defparam */
+	entry = get_hash_entry(name, node_hash);
+	if (entry->key == NULL || strcmp(entry->key, name) != 0)
+	{
+		return NULL;
 	}
 
-	return result;
+	return (t_node *) (node_list->pointer[entry->value]);
 }
 
 
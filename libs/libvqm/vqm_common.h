@@ -42,6 +42,7 @@ extern t_array_ref *assignment_list;
 extern t_array_ref *node_list;
 extern t_array_ref *pin_list;
 extern t_hash_table *pin_hash;
+extern t_hash_table *node_hash;
 
 /*******************************************************************************************/
 /****************************           DECLARATIONS             ***************************/
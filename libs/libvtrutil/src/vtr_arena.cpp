@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "vtr_arena.h"
+
+namespace vtr {
+
+namespace {
+
+constexpr size_t NUM_SIZE_CLASSES = Arena::MAX_SIZE / Arena::GRANULARITY;
+
+///@brief Size of the blocks of storage the size classes are carved from
+constexpr size_t SLAB_SIZE = 64 * 1024;
+
+struct FreeItem {
+    FreeItem* next;
+};
+
+struct FreeList {
+    FreeItem* head = nullptr;
+    size_t count = 0;
+};
+
+size_t size_class(size_t size) {
+    return size == 0 ? 0 : (size - 1) / Arena::GRANULARITY;
+}
+
+size_t class_size(size_t iclass) {
+    return (iclass + 1) * Arena::GRANULARITY;
+}
+
+///@brief Number of items moved at once between a thread cache and the depot (~4 KiB worth)
+size_t batch_size(size_t iclass) {
+    return std::max<size_t>(8, 4096 / class_size(iclass));
+}
+
+///@brief Removes the first num_items of list (which must have as many), returning their head and setting tail
+FreeItem* split_front(FreeList& list, size_t num_items, FreeItem*& tail) {
+    FreeItem* head = list.head;
+    tail = head;
+    for (size_t i = 1; i < num_items; ++i) {
+        tail = tail->next;
+    }
+    list.head = tail->next;
+    list.count -= num_items;
+    tail->next = nullptr;
+    return head;
+}
+
+///@brief The storage shared by all threads
+class Depot {
+  public:
+    ///@brief Adds num_items items of size class iclass to list
+    void refill(size_t iclass, FreeList& list, size_t num_items) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        //Reuse freed items first
+        FreeList& free_list = free_lists_[iclass];
+        size_t num_reused = std::min(num_items, free_list.count);
+        if (num_reused > 0) {
+            FreeItem* tail;
+            FreeItem* head = split_front(free_list, num_reused, tail);
+            tail->next = list.head;
+            list.head = head;
+            list.count += num_reused;
+        }
+
+        size_t item_size = class_size(iclass);
+        for (size_t i = num_reused; i < num_items; ++i) {
+            if (slab_left_[iclass] < item_size) {
+                slab_next_[iclass] = static_cast<char*>(::operator new(SLAB_SIZE));
+                slab_left_[iclass] = SLAB_SIZE;
+                slabs_.push_back(slab_next_[iclass]);
+                bytes_ += SLAB_SIZE;
+            }
+            FreeItem* item = reinterpret_cast<FreeItem*>(slab_next_[iclass]);
+            slab_next_[iclass] += item_size;
+            slab_left_[iclass] -= item_size;
+
+            item->next = list.head;
+            list.head = item;
+            ++list.count;
+        }
+    }
+
+    ///@brief Moves the first num_items items of list (of size class iclass) to the depot
+    void drain(size_t iclass, FreeList& list, size_t num_items) {
+        if (num_items == 0) {
+            return;
+        }
+        FreeItem* tail;
+        FreeItem* head = split_front(list, num_items, tail);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        FreeList& free_list = free_lists_[iclass];
+        tail->next = free_list.head;
+        free_list.head = head;
+        free_list.count += num_items;
+    }
+
+    size_t memory_usage() const {
+        return bytes_;
+    }
+
+  private:
+    std::mutex mutex_;
+    FreeList free_lists_[NUM_SIZE_CLASSES];
+    char* slab_next_[NUM_SIZE_CLASSES] = {};
+    size_t slab_left_[NUM_SIZE_CLASSES] = {};
+    std::vector<void*> slabs_;
+    std::atomic<size_t> bytes_{0};
+};
+
+Depot& depot() {
+    //Never destroyed, since objects (e.g. in globals) may be freed during static destruction
+    static Depot* the_depot = new Depot;
+    return *the_depot;
+}
+
+struct ThreadCache {
+    FreeList free_lists[NUM_SIZE_CLASSES];
+};
+
+//The cache of the calling thread. Trivially destructible, so they remain accessible
+//while (and after) the thread's other thread_local objects are destroyed.
+thread_local ThreadCache* t_cache = nullptr;
+thread_local bool t_cache_destroyed = false;
+
+//Returns the cached items to the depot when the thread exits
+struct ThreadCacheOwner {
+    ThreadCache cache;
+
+    ~ThreadCacheOwner() {
+        for (size_t iclass = 0; iclass < NUM_SIZE_CLASSES; ++iclass) {
+            depot().drain(iclass, cache.free_lists[iclass], cache.free_lists[iclass].count);
+        }
+        t_cache = nullptr;
+        t_cache_destroyed = true;
+    }
+};
+
+///@brief Returns the calling thread's cache, or nullptr if it has already been destroyed
+ThreadCache* thread_cache() {
+    if (!t_cache && !t_cache_destroyed) {
+        thread_local ThreadCacheOwner owner;
+        t_cache = &owner.cache;
+    }
+    return t_cache;
+}
+
+} // namespace
+
+void* Arena::allocate(size_t size) {
+    if (size > MAX_SIZE) {
+        return ::operator new(size);
+    }
+
+    size_t iclass = size_class(size);
+    ThreadCache* cache = thread_cache();
+    FreeList uncached;
+    FreeList& list = cache ? cache->free_lists[iclass] : uncached;
+    if (!list.head) {
+        depot().refill(iclass, list, cache ? batch_size(iclass) : 1);
+    }
+
+    FreeItem* item = list.head;
+    list.head = item->next;
+    --list.count;
+    return item;
+}
+
+void Arena::deallocate(void* ptr, size_t size) noexcept {
+    if (!ptr) {
+        return;
+    }
+    if (size > MAX_SIZE) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    size_t iclass = size_class(size);
+    ThreadCache* cache = thread_cache();
+    FreeList uncached;
+    FreeList& list = cache ? cache->free_lists[iclass] : uncached;
+
+    FreeItem* item = static_cast<FreeItem*>(ptr);
+    item->next = list.head;
+    list.head = item;
+    ++list.count;
+
+    //Return surplus items, so storage freed by one thread (but allocated by another) is shared
+    size_t batch = batch_size(iclass);
+    if (!cache) {
+        depot().drain(iclass, list, list.count);
+    } else if (list.count > 2 * batch) {
+        depot().drain(iclass, list, batch);
+    }
+}
+
+size_t Arena::memory_usage() {
+    return depot().memory_usage();
+}
+
+} // namespace vtr
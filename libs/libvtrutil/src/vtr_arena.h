@@ -0,0 +1,53 @@
+#ifndef VTR_ARENA_H
+#define VTR_ARENA_H
+/**
+ * @file
+ * @brief A thread safe allocator for small objects
+ *
+ * vtr::Arena hands out small allocations from size-class free lists, which avoids
+ * the general purpose allocator for the many small, short-lived objects VPR creates
+ * (e.g. route tree nodes). Each thread allocates from (and frees to) its own cache,
+ * so only refilling or draining a cache takes a lock. Storage may be freed by a
+ * different thread from the one which allocated it.
+ *
+ * Classes are allocated from the arena by defining their class specific operator
+ * new/delete in terms of it, e.g.:
+ *
+ *      class RouteTreeNode {
+ *        public:
+ *          static void* operator new(size_t size) { return vtr::Arena::allocate(size); }
+ *          static void operator delete(void* ptr, size_t size) { vtr::Arena::deallocate(ptr, size); }
+ *          ...
+ *      };
+ *
+ * The size passed to deallocate() must be that passed to allocate(), which the sized
+ * operator delete guarantees (for classes which are not used polymorphically).
+ *
+ * The storage of the arena is never returned to the operating system, but is
+ * reused by later allocations (of the same size class).
+ */
+#include <cstddef>
+
+namespace vtr {
+
+class Arena {
+  public:
+    ///@brief Allocations larger than this are forwarded to ::operator new
+    static constexpr size_t MAX_SIZE = 512;
+
+    ///@brief Allocations are rounded up to a multiple of this, which is also their alignment
+    static constexpr size_t GRANULARITY = 16;
+
+    ///@brief Returns size bytes of storage
+    static void* allocate(size_t size);
+
+    ///@brief Frees storage returned by allocate(size)
+    static void deallocate(void* ptr, size_t size) noexcept;
+
+    ///@brief Returns the storage (in bytes) held by the arena, whether currently allocated or not
+    static size_t memory_usage();
+};
+
+} // namespace vtr
+
+#endif
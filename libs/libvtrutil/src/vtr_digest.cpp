@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <algorithm>
 #include <array>
 
 #include "picosha2.h"
@@ -36,4 +37,20 @@ std::string secure_digest_stream(std::istream& is) {
     return "SHA256:" + picosha2::get_hash_hex_string(hasher);
 }
 
+std::string secure_digest_buffers(const std::vector<array_view<const char>>& buffers) {
+    picosha2::hash256_one_by_one hasher;
+    for (array_view<const char> buffer : buffers) {
+        //Process in chunks, since the hasher copies its input
+        constexpr size_t CHUNK_SIZE = 1 << 16;
+        for (size_t offset = 0; offset < buffer.size(); offset += CHUNK_SIZE) {
+            size_t chunk_size = std::min(CHUNK_SIZE, buffer.size() - offset);
+            hasher.process(buffer.data() + offset, buffer.data() + offset + chunk_size);
+        }
+    }
+    hasher.finish();
+
+    //Same format as secure_digest_stream()
+    return "SHA256:" + picosha2::get_hash_hex_string(hasher);
+}
+
 } // namespace vtr
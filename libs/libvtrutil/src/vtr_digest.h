@@ -2,6 +2,9 @@
 #define VTR_DIGEST_H
 #include <iosfwd>
 #include <string>
+#include <vector>
+
+#include "vtr_array_view.h"
 
 namespace vtr {
 
@@ -11,6 +14,9 @@ std::string secure_digest_file(const std::string& filepath);
 ///@brief Generate a secure hash of a stream
 std::string secure_digest_stream(std::istream& is);
 
+///@brief Generate a secure hash of the concatenation of in-memory buffers
+std::string secure_digest_buffers(const std::vector<array_view<const char>>& buffers);
+
 } // namespace vtr
 
 #endif
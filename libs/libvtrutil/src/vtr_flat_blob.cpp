@@ -0,0 +1,215 @@
+#include "vtr_flat_blob.h"
+#include "vtr_util.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace vtr {
+
+namespace {
+
+constexpr char FLAT_BLOB_MAGIC[8] = {'V', 'T', 'R', 'B', 'L', 'O', 'B', '\0'};
+constexpr uint32_t FLAT_BLOB_VERSION = 2;
+
+///@brief The fixed-size header at the start of every flat blob, followed by num_sections t_flat_blob_section
+struct t_flat_blob_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_sections;
+};
+
+size_t align_up(size_t offset) {
+    return (offset + FLAT_BLOB_ALIGNMENT - 1) / FLAT_BLOB_ALIGNMENT * FLAT_BLOB_ALIGNMENT;
+}
+
+size_t section_bytes(const t_flat_blob_section& section) {
+    size_t bytes = section.elem_size;
+    for (size_t dim = 0; dim < section.ndims; ++dim) {
+        size_t dim_size = section.dim_sizes[dim];
+        if (section.tile_size > 0 && dim + 2 >= section.ndims) {
+            //Tiled dimensions are padded to a multiple of the tile size
+            dim_size = (dim_size + section.tile_size - 1) / section.tile_size * section.tile_size;
+        }
+        bytes *= dim_size;
+    }
+    return bytes;
+}
+
+} // namespace
+
+FlatBlobReader::FlatBlobReader(const std::string& file)
+    : file_(file) {
+#ifndef _WIN32
+    int fd = open(file.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw VtrError(string_fmt("Failed to open flat blob '%s'", file.c_str()), __FILE__, __LINE__);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw VtrError(string_fmt("Failed to stat flat blob '%s'", file.c_str()), __FILE__, __LINE__);
+    }
+    size_ = st.st_size;
+
+    if (size_ > 0) {
+        void* addr = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED) {
+            throw VtrError(string_fmt("Failed to mmap flat blob '%s'", file.c_str()), __FILE__, __LINE__);
+        }
+        data_ = static_cast<const char*>(addr);
+    } else {
+        close(fd);
+    }
+#else
+    //No mmap, fall back to reading the whole file into an aligned buffer
+    std::ifstream is(file, std::ios::binary);
+    if (!is) {
+        throw VtrError(string_fmt("Failed to open flat blob '%s'", file.c_str()), __FILE__, __LINE__);
+    }
+    std::vector<char> contents((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    size_ = contents.size();
+    char* buf = static_cast<char*>(::operator new(size_, std::align_val_t(FLAT_BLOB_ALIGNMENT)));
+    std::copy(contents.begin(), contents.end(), buf);
+    data_ = buf;
+#endif
+
+    t_flat_blob_header header;
+    if (size_ < sizeof(header)) {
+        throw VtrError(string_fmt("Flat blob '%s' is truncated", file.c_str()), __FILE__, __LINE__);
+    }
+    std::memcpy(&header, data_, sizeof(header));
+    if (std::memcmp(header.magic, FLAT_BLOB_MAGIC, sizeof(FLAT_BLOB_MAGIC)) != 0) {
+        throw VtrError(string_fmt("'%s' is not a flat blob", file.c_str()), __FILE__, __LINE__);
+    }
+    if (header.version != FLAT_BLOB_VERSION) {
+        throw VtrError(string_fmt("Flat blob '%s' has version %u (expected %u)",
+                                  file.c_str(), header.version, FLAT_BLOB_VERSION),
+                       __FILE__, __LINE__);
+    }
+
+    size_t sections_end = sizeof(header) + header.num_sections * sizeof(t_flat_blob_section);
+    if (size_ < sections_end) {
+        throw VtrError(string_fmt("Flat blob '%s' is truncated", file.c_str()), __FILE__, __LINE__);
+    }
+    sections_.resize(header.num_sections);
+    std::memcpy(sections_.data(), data_ + sizeof(header), header.num_sections * sizeof(t_flat_blob_section));
+
+    for (const t_flat_blob_section& section : sections_) {
+        if (section.ndims > FLAT_BLOB_MAX_DIMS
+            || section.offset % FLAT_BLOB_ALIGNMENT != 0
+            || section.offset + section_bytes(section) > size_) {
+            throw VtrError(string_fmt("Flat blob '%s' has an invalid section", file.c_str()), __FILE__, __LINE__);
+        }
+    }
+}
+
+FlatBlobReader::~FlatBlobReader() {
+#ifndef _WIN32
+    if (data_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+#else
+    ::operator delete(const_cast<char*>(data_), std::align_val_t(FLAT_BLOB_ALIGNMENT));
+#endif
+}
+
+const t_flat_blob_section& FlatBlobReader::checked_section(size_t isection, size_t elem_size, size_t ndims, size_t tile_size) const {
+    if (isection >= sections_.size()) {
+        throw VtrError(string_fmt("Flat blob '%s' has no section %zu", file_.c_str(), isection), __FILE__, __LINE__);
+    }
+
+    const t_flat_blob_section& section = sections_[isection];
+    if (section.elem_size != elem_size || section.ndims != ndims) {
+        throw VtrError(string_fmt("Flat blob '%s' section %zu has %zu dimensions of %zu byte elements (expected %zu dimensions of %zu byte elements)",
+                                  file_.c_str(), isection, size_t(section.ndims), size_t(section.elem_size), ndims, elem_size),
+                       __FILE__, __LINE__);
+    }
+    if (section.tile_size != tile_size) {
+        throw VtrError(string_fmt("Flat blob '%s' section %zu has tile size %zu (expected %zu)",
+                                  file_.c_str(), isection, size_t(section.tile_size), tile_size),
+                       __FILE__, __LINE__);
+    }
+    return section;
+}
+
+array_view<const char> FlatBlobReader::section_data(size_t isection) const {
+    if (isection >= sections_.size()) {
+        throw VtrError(string_fmt("Flat blob '%s' has no section %zu", file_.c_str(), isection), __FILE__, __LINE__);
+    }
+
+    const t_flat_blob_section& section = sections_[isection];
+    return array_view<const char>(data_ + section.offset, section_bytes(section));
+}
+
+void FlatBlobWriter::add_raw_section(size_t elem_size, size_t ndims, const size_t* dim_sizes, const char* data, size_t tile_size) {
+    add_raw_section_ref(elem_size, ndims, dim_sizes, data, tile_size);
+
+    //Moving the copy into owned_data_ keeps its buffer (and so the reference) valid
+    array_view<const char>& bytes = section_data_.back();
+    std::vector<char> copy(bytes.begin(), bytes.end());
+    bytes = array_view<const char>(copy.data(), copy.size());
+    owned_data_.push_back(std::move(copy));
+}
+
+void FlatBlobWriter::add_raw_section_ref(size_t elem_size, size_t ndims, const size_t* dim_sizes, const char* data, size_t tile_size) {
+    VTR_ASSERT(ndims <= FLAT_BLOB_MAX_DIMS);
+
+    t_flat_blob_section section;
+    section.elem_size = elem_size;
+    section.ndims = ndims;
+    section.tile_size = tile_size;
+    for (size_t dim = 0; dim < ndims; ++dim) {
+        section.dim_sizes[dim] = dim_sizes[dim];
+    }
+
+    size_t bytes = section_bytes(section);
+    section_data_.emplace_back(data, data ? bytes : 0);
+    sections_.push_back(section);
+}
+
+void FlatBlobWriter::write(const std::string& file) const {
+    t_flat_blob_header header;
+    std::memcpy(header.magic, FLAT_BLOB_MAGIC, sizeof(FLAT_BLOB_MAGIC));
+    header.version = FLAT_BLOB_VERSION;
+    header.num_sections = sections_.size();
+
+    //Lay out the sections after the header, each aligned
+    std::vector<t_flat_blob_section> sections = sections_;
+    size_t offset = sizeof(header) + sections.size() * sizeof(t_flat_blob_section);
+    for (t_flat_blob_section& section : sections) {
+        section.offset = align_up(offset);
+        offset = section.offset + section_bytes(section);
+    }
+
+    std::ofstream os(file, std::ios::binary | std::ios::trunc);
+    if (!os) {
+        throw VtrError(string_fmt("Failed to open '%s' for writing", file.c_str()), __FILE__, __LINE__);
+    }
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char*>(sections.data()), sections.size() * sizeof(t_flat_blob_section));
+    size_t pos = sizeof(header) + sections.size() * sizeof(t_flat_blob_section);
+    for (size_t isection = 0; isection < sections.size(); ++isection) {
+        std::vector<char> padding(sections[isection].offset - pos, '\0');
+        os.write(padding.data(), padding.size());
+        os.write(section_data_[isection].data(), section_data_[isection].size());
+        pos = sections[isection].offset + section_data_[isection].size();
+    }
+
+    if (!os) {
+        throw VtrError(string_fmt("Failed to write flat blob '%s'", file.c_str()), __FILE__, __LINE__);
+    }
+}
+
+} // namespace vtr
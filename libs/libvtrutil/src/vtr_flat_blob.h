@@ -0,0 +1,164 @@
+#ifndef VTR_FLAT_BLOB_H
+#define VTR_FLAT_BLOB_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "vtr_array_view.h"
+#include "vtr_error.h"
+#include "vtr_ndmatrix.h"
+
+/**
+ * @file
+ * @brief A flat, aligned binary container for large read-only tables.
+ *
+ * A flat blob file holds a sequence of sections, each an N-dimensional
+ * array of trivially copyable elements, stored row-major or tiled (see
+ * vtr::NdMatrixTiled). Every section starts on a
+ * FLAT_BLOB_ALIGNMENT byte boundary, so once the file is memory-mapped the
+ * tables can be queried in place through vtr::NdMatrixView, with no
+ * deserialization step. Since the mapping is read-only and shared, several
+ * processes loading the same file share its pages in the OS page cache.
+ *
+ * Files are only portable between hosts with the same endianness and
+ * element layout; a mismatch in element size is detected on load.
+ *
+ * FlatBlobWriter copies matrices and vectors, but only references array
+ * views, which are written straight from their storage. Writing large
+ * existing arrays through views therefore needs no extra memory.
+ *
+ * Example:
+ *
+ *      vtr::FlatBlobWriter writer;
+ *      writer.add_matrix(cost_matrix); //Section 0
+ *      writer.write("costs.blob");
+ *
+ *      vtr::FlatBlobReader reader("costs.blob");
+ *      vtr::NdMatrixView<float, 3> costs = reader.matrix<float, 3>(0);
+ */
+
+namespace vtr {
+
+///@brief Alignment (in bytes) of each section within a flat blob
+constexpr size_t FLAT_BLOB_ALIGNMENT = 64;
+
+///@brief Maximum number of dimensions of a flat blob section
+constexpr size_t FLAT_BLOB_MAX_DIMS = 8;
+
+///@brief Description of one section of a flat blob, as stored in the file
+struct t_flat_blob_section {
+    uint64_t elem_size = 0;                                  ///<Size of each element in bytes
+    uint64_t ndims = 0;                                      ///<Number of dimensions
+    std::array<uint64_t, FLAT_BLOB_MAX_DIMS> dim_sizes = {}; ///<Size of each dimension
+    uint64_t tile_size = 0;                                  ///<Tile size of the storage layout (see NdMatrixTiled), 0 if row-major
+    uint64_t offset = 0;                                     ///<Offset of the first element from the start of the file
+};
+
+///@brief Memory-maps a flat blob file and gives zero-copy access to its sections
+class FlatBlobReader {
+  public:
+    ///@brief Maps file, throwing VtrError if it can not be opened or is not a valid flat blob
+    explicit FlatBlobReader(const std::string& file);
+    ~FlatBlobReader();
+
+    FlatBlobReader(const FlatBlobReader&) = delete;
+    FlatBlobReader& operator=(const FlatBlobReader&) = delete;
+
+    ///@brief Returns the number of sections in the file
+    size_t num_sections() const { return sections_.size(); }
+
+    ///@brief Returns a view of section isection as an N-dimensional matrix
+    template<typename T, size_t N, typename Layout = NdMatrixRowMajor>
+    NdMatrixView<T, N, Layout> matrix(size_t isection) const {
+        const t_flat_blob_section& section = checked_section(isection, sizeof(T), N, Layout::TILE_SIZE);
+
+        std::array<size_t, N> dim_sizes;
+        for (size_t dim = 0; dim < N; ++dim) {
+            dim_sizes[dim] = section.dim_sizes[dim];
+        }
+        return NdMatrixView<T, N, Layout>(dim_sizes, reinterpret_cast<const T*>(data_ + section.offset));
+    }
+
+    ///@brief Returns a view of section isection as a 1-dimensional array
+    template<typename T>
+    array_view<const T> array(size_t isection) const {
+        const t_flat_blob_section& section = checked_section(isection, sizeof(T), 1);
+
+        return array_view<const T>(reinterpret_cast<const T*>(data_ + section.offset), section.dim_sizes[0]);
+    }
+
+    ///@brief Returns the raw bytes of section isection, whatever its element type and dimensions
+    array_view<const char> section_data(size_t isection) const;
+
+  private:
+    const t_flat_blob_section& checked_section(size_t isection, size_t elem_size, size_t ndims, size_t tile_size = 0) const;
+
+    std::string file_;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    std::vector<t_flat_blob_section> sections_;
+};
+
+///@brief Builds a flat blob file from a sequence of arrays
+class FlatBlobWriter {
+  public:
+    ///@brief Appends matrix (in its storage layout) as the next section
+    template<typename T, size_t N, typename Layout>
+    void add_matrix(const NdMatrix<T, N, Layout>& matrix) {
+        add_section(sizeof(T), N, matrix.dim_sizes().data(), matrix.empty() ? nullptr : &matrix.get(0), Layout::TILE_SIZE);
+    }
+
+    ///@brief Appends the elements of vec as the next (1-dimensional) section
+    template<typename T>
+    void add_array(const std::vector<T>& vec) {
+        size_t dim_size = vec.size();
+        add_section(sizeof(T), 1, &dim_size, vec.data());
+    }
+
+    /**
+     * @brief Appends the elements of view as the next (1-dimensional) section
+     *
+     * The elements are not copied, so they must stay valid (and unchanged) until write().
+     */
+    template<typename T>
+    void add_array(array_view<const T> view) {
+        static_assert(std::is_trivially_copyable<T>::value, "Flat blob elements must be trivially copyable");
+        size_t dim_size = view.size();
+        add_raw_section_ref(sizeof(T), 1, &dim_size, reinterpret_cast<const char*>(view.data()));
+    }
+
+    ///@brief Returns the number of sections added so far
+    size_t num_sections() const { return sections_.size(); }
+
+    ///@brief Returns the raw bytes of section isection, as they will be written
+    array_view<const char> section_data(size_t isection) const {
+        return section_data_[isection];
+    }
+
+    ///@brief Writes all sections to file, throwing VtrError on failure
+    void write(const std::string& file) const;
+
+  private:
+    template<typename T>
+    void add_section(size_t elem_size, size_t ndims, const size_t* dim_sizes, const T* data, size_t tile_size = 0) {
+        static_assert(std::is_trivially_copyable<T>::value, "Flat blob elements must be trivially copyable");
+        add_raw_section(elem_size, ndims, dim_sizes, reinterpret_cast<const char*>(data), tile_size);
+    }
+
+    ///@brief Adds a section holding a copy of data
+    void add_raw_section(size_t elem_size, size_t ndims, const size_t* dim_sizes, const char* data, size_t tile_size = 0);
+
+    ///@brief Adds a section referencing data
+    void add_raw_section_ref(size_t elem_size, size_t ndims, const size_t* dim_sizes, const char* data, size_t tile_size = 0);
+
+    std::vector<t_flat_blob_section> sections_;
+    std::vector<array_view<const char>> section_data_; ///<The bytes of each section, either in owned_data_ or referenced
+    std::vector<std::vector<char>> owned_data_;        ///<Copies of the sections added by value
+};
+
+} // namespace vtr
+
+#endif
@@ -1,15 +1,77 @@
+#include <algorithm>
 #include <string>
 #include <fstream>
 #include <cstdarg>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "vtr_util.h"
 #include "vtr_log.h"
 #include "log.h"
 
 namespace vtr {
-PrintHandlerInfo printf = log_print_info;
-PrintHandlerInfo printf_info = log_print_info;
-PrintHandlerWarning printf_warning = log_print_warning;
+
+namespace {
+
+struct t_buffered_message {
+    size_t order_key;
+    bool is_warning;
+    const char* file;
+    unsigned int line;
+    std::string text;
+};
+
+struct t_thread_log_buffer {
+    std::vector<t_buffered_message> messages;
+    size_t order_key = 0;
+    int depth = 0; //Number of enclosing ScopedLogBuffers
+};
+
+//The buffers of all the threads which have buffered messages. They are never freed,
+//so they remain valid for flush_log_buffers() after their thread exits.
+std::mutex buffers_mutex;
+std::vector<std::unique_ptr<t_thread_log_buffer>> buffers;
+
+thread_local t_thread_log_buffer* t_log_buffer = nullptr;
+
+///@brief Returns the buffer of the calling thread if its messages are currently buffered
+t_thread_log_buffer* active_log_buffer() {
+    return (t_log_buffer && t_log_buffer->depth > 0) ? t_log_buffer : nullptr;
+}
+
+void print_info(const char* message, ...) {
+    va_list va_args;
+    va_start(va_args, message);
+    std::string msg = vtr::vstring_fmt(message, va_args);
+    va_end(va_args);
+
+    if (t_thread_log_buffer* buffer = active_log_buffer()) {
+        buffer->messages.push_back({buffer->order_key, false, nullptr, 0, std::move(msg)});
+    } else {
+        log_print_info("%s", msg.c_str());
+    }
+}
+
+void print_warning(const char* file, unsigned int line, const char* message, ...) {
+    va_list va_args;
+    va_start(va_args, message);
+    std::string msg = vtr::vstring_fmt(message, va_args);
+    va_end(va_args);
+
+    if (t_thread_log_buffer* buffer = active_log_buffer()) {
+        buffer->messages.push_back({buffer->order_key, true, file, line, std::move(msg)});
+    } else {
+        log_print_warning(file, line, "%s", msg.c_str());
+    }
+}
+
+} // namespace
+
+PrintHandlerInfo printf = print_info;
+PrintHandlerInfo printf_info = print_info;
+PrintHandlerWarning printf_warning = print_warning;
 PrintHandlerError printf_error = log_print_error;
 PrintHandlerDirect printf_direct = log_print_direct;
 
@@ -17,6 +79,50 @@ void set_log_file(const char* filename) {
     log_set_output_file(filename);
 }
 
+ScopedLogBuffer::ScopedLogBuffer(size_t order_key) {
+    if (!t_log_buffer) {
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        buffers.push_back(std::make_unique<t_thread_log_buffer>());
+        t_log_buffer = buffers.back().get();
+    }
+    prev_order_key_ = t_log_buffer->order_key;
+    t_log_buffer->order_key = order_key;
+    ++t_log_buffer->depth;
+}
+
+ScopedLogBuffer::~ScopedLogBuffer() {
+    t_log_buffer->order_key = prev_order_key_;
+    --t_log_buffer->depth;
+}
+
+void flush_log_buffers() {
+    std::vector<t_buffered_message> messages;
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        for (auto& buffer : buffers) {
+            std::move(buffer->messages.begin(), buffer->messages.end(), std::back_inserter(messages));
+            buffer->messages.clear();
+        }
+    }
+
+    std::stable_sort(messages.begin(), messages.end(),
+                     [](const t_buffered_message& lhs, const t_buffered_message& rhs) {
+                         return lhs.order_key < rhs.order_key;
+                     });
+
+    for (const t_buffered_message& msg : messages) {
+        if (msg.is_warning) {
+            log_print_warning(msg.file, msg.line, "%s", msg.text.c_str());
+        } else {
+            log_print_info("%s", msg.text.c_str());
+        }
+    }
+}
+
+void LogRateLimiter::log_suppression(const char* file, unsigned int line) const {
+    vtr::printf_info("Suppressing further messages from %s:%u (logged %zu times)\n", file, line, max_count_);
+}
+
 } // namespace vtr
 
 void add_warnings_to_suppress(std::string function_name) {
@@ -40,7 +146,7 @@ void print_or_suppress_warning(const char* pszFileName, unsigned int lineNum, co
 
     auto result = warnings_to_suppress.find(function_name);
     if (result == warnings_to_suppress.end()) {
-        vtr::printf_warning(pszFileName, lineNum, msg.data());
+        vtr::printf_warning(pszFileName, lineNum, "%s", msg.c_str());
     } else if (!noisy_warn_log_file.empty()) {
         std::ofstream log;
         log.open(noisy_warn_log_file.data(), std::ios_base::app);
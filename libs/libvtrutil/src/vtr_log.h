@@ -1,5 +1,7 @@
 #ifndef VTR_LOG_H
 #define VTR_LOG_H
+#include <atomic>
+#include <cstddef>
 #include <tuple>
 #include <unordered_set>
 #include <string>
@@ -44,7 +46,33 @@
  * For example:
  *
  *      VTR_LOGF("my_file.txt", "This message will be logged from file 'my_file.txt' line %d\n", 42);
- *  
+ *
+ * Rate Limited Logging
+ * ====================
+ *
+ * Messages which may be logged very often (e.g. a warning for each failed
+ * connection of a congested routing) have VTR_LOG*_LIMITED variants, which
+ * log at most max_count messages from the call site, followed by a note that
+ * the remainder are suppressed.
+ *
+ * For example:
+ *
+ *      VTR_LOG_WARN_LIMITED(100, "Only the first %d of these warnings are logged\n", 100);
+ *
+ * Multi-threaded Logging
+ * ======================
+ *
+ * Messages logged concurrently by several threads are not interleaved within
+ * a message, but their order depends on the thread scheduling. Workers can
+ * instead buffer their messages in a vtr::ScopedLogBuffer, which are then all
+ * printed (in a deterministic order) by vtr::flush_log_buffers():
+ *
+ *      tbb::parallel_for(size_t(0), num_regions, [&](size_t iregion) {
+ *          vtr::ScopedLogBuffer log_buffer(iregion); //Messages are ordered by region
+ *          VTR_LOG("Routed region %zu\n", iregion);
+ *      });
+ *      vtr::flush_log_buffers();
+ *
  * Debug Logging
  * =============
  *
@@ -76,6 +104,24 @@
 // Custom file-line-func location logging macros
 #define VTR_LOGFF_WARN(file, line, func, ...) VTR_LOGVFF_WARN(true, file, line, func, __VA_ARGS__)
 
+// Rate limited logging macros
+#define VTR_LOG_LIMITED(max_count, ...) VTR_LOGV_LIMITED(true, max_count, __VA_ARGS__)
+#define VTR_LOG_WARN_LIMITED(max_count, ...) VTR_LOGV_WARN_LIMITED(true, max_count, __VA_ARGS__)
+
+#define VTR_LOGV_LIMITED(expr, max_count, ...)                                                       \
+    do {                                                                                             \
+        static vtr::LogRateLimiter vtr_log_rate_limiter(max_count);                                  \
+        if ((expr) && vtr_log_rate_limiter.should_log(__FILE__, __LINE__)) vtr::printf(__VA_ARGS__); \
+    } while (false)
+
+#define VTR_LOGV_WARN_LIMITED(expr, max_count, ...)                               \
+    do {                                                                          \
+        static vtr::LogRateLimiter vtr_log_rate_limiter(max_count);               \
+        if ((expr) && vtr_log_rate_limiter.should_log(__FILE__, __LINE__)) {      \
+            print_or_suppress_warning(__FILE__, __LINE__, __func__, __VA_ARGS__); \
+        }                                                                         \
+    } while (false)
+
 // Conditional logging and custom file-line location macros
 #define VTR_LOGVF(expr, file, line, ...)    \
     do {                                    \
@@ -140,6 +186,60 @@ extern PrintHandlerDirect printf_direct;
 
 void set_log_file(const char* filename);
 
+/**
+ * @brief Buffers the info and warning messages logged by the calling thread while in scope
+ *
+ * Appending to the buffer takes no lock. The buffered messages are held (tagged with
+ * order_key) until flush_log_buffers() prints them. Scopes may be nested, in which case
+ * the innermost order_key applies. Errors are not buffered, but printed immediately.
+ */
+class ScopedLogBuffer {
+  public:
+    explicit ScopedLogBuffer(size_t order_key);
+    ~ScopedLogBuffer();
+
+    ScopedLogBuffer(const ScopedLogBuffer&) = delete;
+    ScopedLogBuffer& operator=(const ScopedLogBuffer&) = delete;
+
+  private:
+    size_t prev_order_key_;
+};
+
+/**
+ * @brief Prints (and clears) the messages buffered by all threads, in increasing order of
+ *        their order_key, and otherwise in the order each thread logged them
+ *
+ * Must not be called while other threads are logging into buffers, e.g. call it once the
+ * parallel work is done.
+ */
+void flush_log_buffers();
+
+/**
+ * @brief Counts the messages of a rate limited call site (see VTR_LOG_LIMITED)
+ *
+ * Thread safe, without locking.
+ */
+class LogRateLimiter {
+  public:
+    explicit LogRateLimiter(size_t max_count)
+        : max_count_(max_count) {}
+
+    ///@brief Returns true if the message from file:line should be logged
+    bool should_log(const char* file, unsigned int line) {
+        size_t count = count_.fetch_add(1, std::memory_order_relaxed);
+        if (count == max_count_) {
+            log_suppression(file, line);
+        }
+        return count < max_count_;
+    }
+
+  private:
+    void log_suppression(const char* file, unsigned int line) const;
+
+    const size_t max_count_;
+    std::atomic<size_t> count_{0};
+};
+
 } // namespace vtr
 
 static std::unordered_set<std::string> warnings_to_suppress;
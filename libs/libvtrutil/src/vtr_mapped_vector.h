@@ -0,0 +1,176 @@
+#ifndef VTR_MAPPED_VECTOR_H
+#define VTR_MAPPED_VECTOR_H
+
+#include <cstddef>
+#include <utility>
+
+#include "vtr_array_view.h"
+#include "vtr_range.h"
+#include "vtr_vector.h"
+
+namespace vtr {
+
+/**
+ * @brief A vtr::vector which can instead view a read-only array owned elsewhere
+ *
+ * After view(), the elements are read in place from the viewed memory (e.g. a section of a
+ * memory-mapped vtr::FlatBlobReader, whose pages are shared with the other processes mapping
+ * the same file). The viewed memory must outlive the view, and is never written.
+ *
+ * Element access is read-only: operator[], data() and the iterators are const. Elements are
+ * written through mut(), and the other mutating methods (resize/push_back/assign...) work as
+ * for vtr::vector; the first of these copies the viewed elements into owned storage, so only
+ * the containers which are actually modified stop sharing their memory.
+ *
+ * Copies of a viewing mapped_vector view the same memory.
+ */
+template<typename K, typename V, typename Allocator = std::allocator<V>>
+class mapped_vector {
+    using storage = vtr::vector<K, V, Allocator>;
+
+  public:
+    typedef K key_type;
+    typedef V value_type;
+    typedef const V& const_reference;
+    typedef const V* const_iterator;
+    typedef typename storage::key_iterator key_iterator;
+    typedef vtr::Range<key_iterator> key_range;
+
+    mapped_vector() = default;
+
+    mapped_vector(const mapped_vector& other)
+        : owned_(other.owned_)
+        , viewing_(other.viewing_)
+        , view_size_(other.view_size_) {
+        data_ = viewing_ ? other.data_ : owned_.data();
+    }
+
+    mapped_vector(mapped_vector&& other) noexcept {
+        swap(other);
+    }
+
+    mapped_vector& operator=(mapped_vector other) {
+        swap(other);
+        return *this;
+    }
+
+    ///@brief Views the size elements at data instead of any owned elements
+    void view(const V* data, size_t size) {
+        storage().swap(owned_);
+        viewing_ = size > 0;
+        view_size_ = size;
+        data_ = viewing_ ? data : owned_.data();
+    }
+    void view(vtr::array_view<const V> elements) {
+        view(elements.data(), elements.size());
+    }
+
+    ///@brief Returns true if the elements are viewed rather than owned
+    bool viewing() const { return viewing_; }
+
+    size_t size() const { return viewing_ ? view_size_ : owned_.size(); }
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return viewing_ ? view_size_ : owned_.capacity(); }
+
+    const_reference operator[](const key_type id) const {
+        return data_[size_t(id)];
+    }
+    const_reference back() const { return data_[size() - 1]; }
+    const V* data() const { return data_; }
+
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    key_range keys() const {
+        return vtr::make_range(key_iterator(key_type(0)), key_iterator(key_type(size())));
+    }
+
+    ///@brief Returns a writable reference to element id, first copying any viewed elements
+    V& mut(const key_type id) {
+        own();
+        return owned_[id];
+    }
+
+    void reserve(size_t new_capacity) {
+        own();
+        owned_.reserve(new_capacity);
+        data_ = owned_.data();
+    }
+    void resize(size_t new_size) {
+        own();
+        owned_.resize(new_size);
+        data_ = owned_.data();
+    }
+    void resize(size_t new_size, const V& value) {
+        own();
+        owned_.resize(new_size, value);
+        data_ = owned_.data();
+    }
+    void shrink_to_fit() {
+        own();
+        owned_.shrink_to_fit();
+        data_ = owned_.data();
+    }
+    void clear() {
+        viewing_ = false;
+        view_size_ = 0;
+        owned_.clear();
+        data_ = owned_.data();
+    }
+
+    template<typename Iter>
+    void assign(Iter first, Iter last) {
+        clear();
+        owned_.assign(first, last);
+        data_ = owned_.data();
+    }
+    void assign(size_t count, const V& value) {
+        clear();
+        owned_.assign(count, value);
+        data_ = owned_.data();
+    }
+
+    void push_back(const V& value) {
+        own();
+        owned_.push_back(value);
+        data_ = owned_.data();
+    }
+    template<typename... Args>
+    void emplace_back(Args&&... args) {
+        own();
+        owned_.emplace_back(std::forward<Args>(args)...);
+        data_ = owned_.data();
+    }
+
+    void swap(mapped_vector& other) noexcept {
+        std::swap(owned_, other.owned_);
+        std::swap(viewing_, other.viewing_);
+        std::swap(view_size_, other.view_size_);
+        std::swap(data_, other.data_);
+        //The data of owned elements moves with the swapped vectors
+        if (!viewing_) data_ = owned_.data();
+        if (!other.viewing_) other.data_ = other.owned_.data();
+    }
+
+  private:
+    ///@brief Copies any viewed elements into owned storage
+    void own() {
+        if (viewing_) {
+            owned_.assign(data_, data_ + view_size_);
+            viewing_ = false;
+            view_size_ = 0;
+            data_ = owned_.data();
+        }
+    }
+
+    storage owned_;
+    const V* data_ = nullptr; ///<The elements: either viewed, or owned_.data()
+    bool viewing_ = false;
+    size_t view_size_ = 0;
+};
+
+} // namespace vtr
+
+#endif
@@ -22,6 +22,29 @@ int ipow(int base, int exp) {
     return result;
 }
 
+uint64_t hilbert_index(uint32_t x, uint32_t y, int order) {
+    VTR_ASSERT(order >= 0 && order <= 32);
+
+    //Walk the quadrants from the coarsest, turning the coordinates into the orientation
+    //of the curve within the selected quadrant (only the bits below the current one are
+    //read afterwards, so reflecting is a complement)
+    uint64_t index = 0;
+    for (int bit = order - 1; bit >= 0; --bit) {
+        uint32_t rx = (x >> bit) & 1;
+        uint32_t ry = (y >> bit) & 1;
+        index += uint64_t((3 * rx) ^ ry) << (2 * bit);
+
+        if (ry == 0) {
+            if (rx == 1) {
+                x = ~x;
+                y = ~y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
+
 float median(std::vector<float> vector) {
     VTR_ASSERT(vector.size() > 0);
 
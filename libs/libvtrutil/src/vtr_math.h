@@ -4,6 +4,7 @@
 #include <map>
 #include <vector>
 #include <cmath>
+#include <cstdint>
 
 #include "vtr_assert.h"
 
@@ -19,6 +20,15 @@ namespace vtr {
 ///@brief Calculates the value pow(base, exp)
 int ipow(int base, int exp);
 
+/**
+ * @brief Returns the distance of (x, y) along the Hilbert curve filling the 2^order x 2^order grid
+ *
+ * Consecutive indices are adjacent points, and nearby indices are mostly nearby points, so
+ * sorting by this index gives a good spatial locality. x and y must be less than 2^order,
+ * and order at most 32.
+ */
+uint64_t hilbert_index(uint32_t x, uint32_t y, int order);
+
 ///@brief Returns the median of an input vector.
 float median(std::vector<float> vector);
 
@@ -33,6 +33,9 @@ struct t_linked_vptr; //Forward declaration
  * This structure is to keep track of chunks of memory that is being	
  * allocated to save overhead when allocating very small memory pieces. 
  * For a complete description, please see the comment in chunk_malloc
+ *
+ * Note that chunk memory is never reused; new code should prefer vtr::ObjectPool
+ * (vtr_object_pool.h) or vtr::Arena (vtr_arena.h).
  */
 struct t_chunk {
     t_linked_vptr* chunk_ptr_head = nullptr;
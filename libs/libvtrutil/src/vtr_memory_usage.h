@@ -0,0 +1,172 @@
+#ifndef VTR_MEMORY_USAGE_H
+#define VTR_MEMORY_USAGE_H
+/**
+ * @file
+ * @brief Estimates of the heap memory used by containers
+ *
+ * vtr::memory_usage(container) returns the heap memory (in bytes) allocated by
+ * a container, including that allocated by its (nested container) elements, e.g.:
+ *
+ *      std::vector<std::vector<int>> v(10, std::vector<int>(100));
+ *      size_t bytes = vtr::memory_usage(v); //~10 * sizeof(std::vector<int>) + 10 * 100 * sizeof(int)
+ *
+ * The estimates are based on container capacities, and so include unused reserved
+ * space but not allocator overheads. They are intended for memory accounting of
+ * the major data structures (see e.g. t_rr_graph_storage::memory_usage()).
+ */
+#include <array>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "vtr_vector.h"
+#include "vtr_mapped_vector.h"
+#include "vtr_vector_map.h"
+#include "vtr_ndmatrix.h"
+
+namespace vtr {
+
+//Declared up front so nested containers resolve to the overloads of their elements
+template<typename T, typename A>
+size_t memory_usage(const std::vector<T, A>& vec);
+template<typename A>
+size_t memory_usage(const std::vector<bool, A>& vec);
+template<typename K, typename V, typename A>
+size_t memory_usage(const vtr::vector<K, V, A>& vec);
+template<typename K, typename A>
+size_t memory_usage(const vtr::vector<K, bool, A>& vec);
+template<typename K, typename V, typename A>
+size_t memory_usage(const vtr::mapped_vector<K, V, A>& vec);
+template<typename K, typename V, typename S>
+size_t memory_usage(const vtr::vector_map<K, V, S>& vec);
+template<typename T, size_t N>
+size_t memory_usage(const std::array<T, N>& arr);
+template<typename T, size_t N, typename L>
+size_t memory_usage(const vtr::NdMatrix<T, N, L>& matrix);
+template<typename K, typename V, typename H, typename E, typename A>
+size_t memory_usage(const std::unordered_map<K, V, H, E, A>& map);
+template<typename K, typename H, typename E, typename A>
+size_t memory_usage(const std::unordered_set<K, H, E, A>& set);
+template<typename K, typename V, typename C, typename A>
+size_t memory_usage(const std::map<K, V, C, A>& map);
+inline size_t memory_usage(const std::string& str);
+
+namespace detail {
+
+template<typename T, typename = void>
+struct has_memory_usage : std::false_type {};
+
+template<typename T>
+struct has_memory_usage<T, std::void_t<decltype(vtr::memory_usage(std::declval<const T&>()))>> : std::true_type {};
+
+///@brief Returns the heap memory used by each of the elements in [begin, end) (zero for flat elements)
+template<typename T, typename Iter>
+size_t elements_memory_usage(Iter begin, Iter end) {
+    size_t bytes = 0;
+    if constexpr (has_memory_usage<T>::value) {
+        for (Iter iter = begin; iter != end; ++iter) {
+            bytes += vtr::memory_usage(*iter);
+        }
+    }
+    return bytes;
+}
+
+} // namespace detail
+
+template<typename T, typename A>
+size_t memory_usage(const std::vector<T, A>& vec) {
+    return vec.capacity() * sizeof(T) + detail::elements_memory_usage<T>(vec.begin(), vec.end());
+}
+
+template<typename A>
+size_t memory_usage(const std::vector<bool, A>& vec) {
+    return vec.capacity() / 8; //Bit packed
+}
+
+template<typename K, typename V, typename A>
+size_t memory_usage(const vtr::vector<K, V, A>& vec) {
+    return vec.capacity() * sizeof(V) + detail::elements_memory_usage<V>(vec.begin(), vec.end());
+}
+
+template<typename K, typename A>
+size_t memory_usage(const vtr::vector<K, bool, A>& vec) {
+    return vec.capacity() / 8; //Bit packed
+}
+
+template<typename K, typename V, typename A>
+size_t memory_usage(const vtr::mapped_vector<K, V, A>& vec) {
+    //Viewed elements are not allocated by the container
+    return vec.viewing() ? 0 : vec.capacity() * sizeof(V);
+}
+
+template<typename K, typename V, typename S>
+size_t memory_usage(const vtr::vector_map<K, V, S>& vec) {
+    return vec.capacity() * sizeof(V) + detail::elements_memory_usage<V>(vec.begin(), vec.end());
+}
+
+template<typename T, size_t N>
+size_t memory_usage(const std::array<T, N>& arr) {
+    //The array itself is not heap allocated
+    return detail::elements_memory_usage<T>(arr.begin(), arr.end());
+}
+
+template<typename T, size_t N, typename L>
+size_t memory_usage(const vtr::NdMatrix<T, N, L>& matrix) {
+    size_t bytes = matrix.storage_size() * sizeof(T);
+    if constexpr (detail::has_memory_usage<T>::value) {
+        for (size_t i = 0; i < matrix.storage_size(); ++i) {
+            bytes += memory_usage(matrix.get(i));
+        }
+    }
+    return bytes;
+}
+
+template<typename K, typename V, typename H, typename E, typename A>
+size_t memory_usage(const std::unordered_map<K, V, H, E, A>& map) {
+    //Each element is a separately allocated node (holding the element and the next pointer)
+    size_t bytes = map.bucket_count() * sizeof(void*) + map.size() * (sizeof(std::pair<const K, V>) + sizeof(void*));
+    for (const auto& kv : map) {
+        if constexpr (detail::has_memory_usage<K>::value) {
+            bytes += memory_usage(kv.first);
+        }
+        if constexpr (detail::has_memory_usage<V>::value) {
+            bytes += memory_usage(kv.second);
+        }
+    }
+    return bytes;
+}
+
+template<typename K, typename H, typename E, typename A>
+size_t memory_usage(const std::unordered_set<K, H, E, A>& set) {
+    size_t bytes = set.bucket_count() * sizeof(void*) + set.size() * (sizeof(K) + sizeof(void*));
+    return bytes + detail::elements_memory_usage<K>(set.begin(), set.end());
+}
+
+template<typename K, typename V, typename C, typename A>
+size_t memory_usage(const std::map<K, V, C, A>& map) {
+    //Each element is a separately allocated tree node (holding the element, three pointers and the node colour)
+    size_t bytes = map.size() * (sizeof(std::pair<const K, V>) + 4 * sizeof(void*));
+    for (const auto& kv : map) {
+        if constexpr (detail::has_memory_usage<K>::value) {
+            bytes += memory_usage(kv.first);
+        }
+        if constexpr (detail::has_memory_usage<V>::value) {
+            bytes += memory_usage(kv.second);
+        }
+    }
+    return bytes;
+}
+
+inline size_t memory_usage(const std::string& str) {
+    //Short strings are stored inline
+    return str.capacity() > std::string().capacity() ? str.capacity() + 1 : 0;
+}
+
+} // namespace vtr
+
+#endif
@@ -3,11 +3,100 @@
 #include <algorithm>
 #include <array>
 #include <memory>
+#include <utility>
 
 #include "vtr_assert.h"
 
 namespace vtr {
 
+/**
+ * @brief Row-major (c-style) storage layout of an NdMatrix (the default)
+ *
+ * The right-most index is laid out in contiguous memory.
+ *
+ * A layout policy defines how the elements of a matrix are placed in its storage:
+ *  - calc_strides() sets the stride of each dimension, and returns the number of
+ *    storage elements (which may exceed the number of matrix elements, e.g. for padding)
+ *  - offset<M>() returns the storage offset of index in the dimension with stride
+ *    (where M counts the remaining dimensions, including this one)
+ */
+struct NdMatrixRowMajor {
+    ///@brief Zero, since the storage is not tiled
+    static constexpr size_t TILE_SIZE = 0;
+
+    template<size_t N>
+    static size_t calc_strides(const std::array<size_t, N>& dim_sizes, std::array<size_t, N>& dim_strides) {
+        size_t size = 1;
+        for (size_t dim = N; dim-- > 0;) {
+            dim_strides[dim] = size;
+            size *= dim_sizes[dim];
+        }
+        if (size == 0) {
+            dim_strides.fill(0);
+        }
+        return size;
+    }
+
+    template<size_t M>
+    static size_t offset(size_t index, size_t stride) {
+        return index * stride;
+    }
+};
+
+/**
+ * @brief Tiled storage layout of an NdMatrix
+ *
+ * The last two dimensions are split into TILE x TILE blocks, each stored contiguously
+ * (in row-major order, as are the elements within each block). Look-ups which vary both
+ * of the last two indices by small amounts (e.g. the dx/dy of the lookahead and delay
+ * model tables) then touch far fewer cache lines than with a row-major layout, where
+ * each step in the second to last index jumps a whole row.
+ *
+ * The last two dimensions are padded up to a multiple of TILE, which must be a power of two.
+ */
+template<size_t TILE = 8>
+struct NdMatrixTiled {
+    static_assert(TILE > 0 && (TILE & (TILE - 1)) == 0, "Tile size must be a power of two");
+
+    static constexpr size_t TILE_SIZE = TILE;
+
+    template<size_t N>
+    static size_t calc_strides(const std::array<size_t, N>& dim_sizes, std::array<size_t, N>& dim_strides) {
+        static_assert(N >= 2, "Tiled layout requires at least two dimensions");
+        size_t padded_cols = round_up(dim_sizes[N - 1]);
+        size_t padded_rows = round_up(dim_sizes[N - 2]);
+
+        dim_strides[N - 1] = TILE * TILE;     //Between blocks of a row of blocks
+        dim_strides[N - 2] = padded_cols * TILE; //Between rows of blocks
+        size_t size = padded_rows * padded_cols;
+        for (size_t dim = N - 2; dim-- > 0;) {
+            dim_strides[dim] = size;
+            size *= dim_sizes[dim];
+        }
+        if (size == 0 || dim_sizes[N - 1] == 0 || dim_sizes[N - 2] == 0) {
+            dim_strides.fill(0);
+            size = 0;
+        }
+        return size;
+    }
+
+    template<size_t M>
+    static size_t offset(size_t index, size_t stride) {
+        if constexpr (M == 1) {
+            return (index / TILE) * stride + index % TILE;
+        } else if constexpr (M == 2) {
+            return (index / TILE) * stride + (index % TILE) * TILE;
+        } else {
+            return index * stride;
+        }
+    }
+
+  private:
+    static size_t round_up(size_t dim_size) {
+        return (dim_size + TILE - 1) / TILE * TILE;
+    }
+};
+
 /**
  * @brief Proxy class for a sub-matrix of a NdMatrix class.
  * 
@@ -21,7 +110,7 @@ namespace vtr {
  * 
  * Recursive case: N-dimensional array
  */
-template<typename T, size_t N>
+template<typename T, size_t N, typename Layout = NdMatrixRowMajor>
 class NdMatrixProxy {
   public:
     static_assert(N > 0, "Must have at least one dimension");
@@ -34,29 +123,29 @@ class NdMatrixProxy {
      *    @param dim_stride: The stride of this dimension (i.e. how many element in memory between indicies of this dimension)
      *    @param  start: Pointer to the start of the sub-matrix this proxy represents
      */
-    NdMatrixProxy<T, N>(const size_t* dim_sizes, const size_t* dim_strides, T* start)
+    NdMatrixProxy(const size_t* dim_sizes, const size_t* dim_strides, T* start)
         : dim_sizes_(dim_sizes)
         , dim_strides_(dim_strides)
         , start_(start) {}
 
-    NdMatrixProxy<T, N>& operator=(const NdMatrixProxy<T, N>& other) = delete;
+    NdMatrixProxy& operator=(const NdMatrixProxy& other) = delete;
 
     ///@brief const [] operator
-    const NdMatrixProxy<T, N - 1> operator[](size_t index) const {
+    const NdMatrixProxy<T, N - 1, Layout> operator[](size_t index) const {
         VTR_ASSERT_SAFE_MSG(index < dim_sizes_[0], "Index out of range (above dimension maximum)");
         VTR_ASSERT_SAFE_MSG(dim_sizes_[1] > 0, "Can not index into zero-sized dimension");
 
         // Strip off one dimension
-        return NdMatrixProxy<T, N - 1>(
-            dim_sizes_ + 1,                    // Pass the dimension information
-            dim_strides_ + 1,                  // Pass the stride for the next dimension
-            start_ + dim_strides_[0] * index); // Advance to index in this dimension
+        return NdMatrixProxy<T, N - 1, Layout>(
+            dim_sizes_ + 1,                                              // Pass the dimension information
+            dim_strides_ + 1,                                            // Pass the stride for the next dimension
+            start_ + Layout::template offset<N>(index, dim_strides_[0])); // Advance to index in this dimension
     }
 
     ///@brief [] operator
-    NdMatrixProxy<T, N - 1> operator[](size_t index) {
+    NdMatrixProxy<T, N - 1, Layout> operator[](size_t index) {
         // Call the const version and cast-away constness
-        return const_cast<const NdMatrixProxy<T, N>*>(this)->operator[](index);
+        return const_cast<const NdMatrixProxy*>(this)->operator[](index);
     }
 
   private:
@@ -66,8 +155,8 @@ class NdMatrixProxy {
 };
 
 ///@brief Base case: 1-dimensional array
-template<typename T>
-class NdMatrixProxy<T, 1> {
+template<typename T, typename Layout>
+class NdMatrixProxy<T, 1, Layout> {
   public:
     /**
      * @brief Construct a 1-d matrix proxy object
@@ -76,26 +165,26 @@ class NdMatrixProxy<T, 1> {
      *    @param dim_stride: The stride of this dimension (i.e. how many element in memory between indicies of this dimension)
      *    @param  start: Pointer to the start of the sub-matrix this proxy represents
      */
-    NdMatrixProxy<T, 1>(const size_t* dim_sizes, const size_t* dim_stride, T* start)
+    NdMatrixProxy(const size_t* dim_sizes, const size_t* dim_stride, T* start)
         : dim_sizes_(dim_sizes)
         , dim_strides_(dim_stride)
         , start_(start) {}
 
-    NdMatrixProxy<T, 1>& operator=(const NdMatrixProxy<T, 1>& other) = delete;
+    NdMatrixProxy& operator=(const NdMatrixProxy& other) = delete;
 
     ///@brief const [] operator
     const T& operator[](size_t index) const {
-        VTR_ASSERT_SAFE_MSG(dim_strides_[0] == 1, "Final dimension must have stride 1");
+        VTR_ASSERT_SAFE_MSG(Layout::TILE_SIZE > 0 || dim_strides_[0] == 1, "Final dimension must have stride 1");
         VTR_ASSERT_SAFE_MSG(index < dim_sizes_[0], "Index out of range (above dimension maximum)");
 
         //Base case
-        return start_[index];
+        return start_[Layout::template offset<1>(index, dim_strides_[0])];
     }
 
     ///@brief [] operator
     T& operator[](size_t index) {
         // Call the const version and cast-away constness
-        return const_cast<T&>(const_cast<const NdMatrixProxy<T, 1>*>(this)->operator[](index));
+        return const_cast<T&>(const_cast<const NdMatrixProxy*>(this)->operator[](index));
     }
 
     /**
@@ -108,13 +197,14 @@ class NdMatrixProxy<T, 1> {
      * not to clobber elements in other dimensions
      */
     const T* data() const {
+        static_assert(Layout::TILE_SIZE == 0, "The elements of the last dimension are only contiguous in a row-major layout");
         return start_;
     }
 
     ///@brief same as above but allow update the value
     T* data() {
         // Call the const version and cast-away constness
-        return const_cast<T*>(const_cast<const NdMatrixProxy<T, 1>*>(this)->data());
+        return const_cast<T*>(const_cast<const NdMatrixProxy*>(this)->data());
     }
 
   private:
@@ -134,7 +224,8 @@ class NdMatrixProxy<T, 1> {
  * Implementation:
  * 
  * This class uses a single linear array to store the matrix in c-style (row major)
- * order. That is, the right-most index is laid out contiguous memory.
+ * order. That is, the right-most index is laid out contiguous memory. The Layout
+ * policy may select another order (e.g. NdMatrixTiled), without changing the indexing API.
  *
  * This should improve memory usage (no extra pointers to store for each dimension),
  * and cache locality (less indirection via pointers, predictable strides).
@@ -143,7 +234,7 @@ class NdMatrixProxy<T, 1> {
  * Since the indexing calculations are visible to the compiler at compile time they can be
  * optimized to be efficient.
  */
-template<typename T, size_t N>
+template<typename T, size_t N, typename Layout = NdMatrixRowMajor>
 class NdMatrixBase {
   public:
     static_assert(N >= 1, "Minimum dimension 1");
@@ -165,6 +256,15 @@ class NdMatrixBase {
         resize(dim_sizes, value);
     }
 
+    ///@brief Copy of a matrix with another storage layout
+    template<typename OtherLayout>
+    explicit NdMatrixBase(const NdMatrixBase<T, N, OtherLayout>& other)
+        : NdMatrixBase(other.dim_sizes()) {
+        other.for_each_index([&](const std::array<size_t, N>& index) {
+            element(index) = other.element(index);
+        });
+    }
+
   public: //Accessors
     ///@brief Returns the size of the matrix (number of elements)
     size_t size() const {
@@ -203,22 +303,63 @@ class NdMatrixBase {
         return dim_sizes_[i];
     }
 
-    ///@brief const Flat accessors of NdMatrix
+    ///@brief Returns the sizes of all dimensions
+    const std::array<size_t, N>& dim_sizes() const {
+        return dim_sizes_;
+    }
+
+    ///@brief Returns the number of elements of the underlying storage (which includes any padding of the layout)
+    size_t storage_size() const {
+        return storage_size_;
+    }
+
+    /**
+     * @brief const Flat accessors of NdMatrix
+     *
+     * Indexes the underlying storage, so for a layout other than row-major
+     * (see NdMatrixTiled) the order differs, and i ranges up to storage_size().
+     */
     const T& get(size_t i) const {
-        VTR_ASSERT_SAFE(i < size_);
+        VTR_ASSERT_SAFE(i < storage_size_);
         return data_[i];
     }
 
     ///@brief Flat accessors of NdMatrix
     T& get(size_t i) {
-        VTR_ASSERT_SAFE(i < size_);
+        VTR_ASSERT_SAFE(i < storage_size_);
         return data_[i];
     }
 
+    ///@brief const access to the element at index (one index per dimension)
+    const T& element(const std::array<size_t, N>& index) const {
+        return data_[storage_offset(index, std::make_index_sequence<N>())];
+    }
+
+    ///@brief Access to the element at index (one index per dimension)
+    T& element(const std::array<size_t, N>& index) {
+        return data_[storage_offset(index, std::make_index_sequence<N>())];
+    }
+
+    ///@brief Calls func(index) for the index of each element, in row-major order
+    template<typename Func>
+    void for_each_index(Func func) const {
+        std::array<size_t, N> index;
+        index.fill(0);
+        for (size_t i = 0; i < size_; ++i) {
+            func(index);
+            for (size_t dim = N; dim-- > 0;) {
+                if (++index[dim] < dim_sizes_[dim]) {
+                    break;
+                }
+                index[dim] = 0;
+            }
+        }
+    }
+
   public: //Mutators
     ///@brief Set all elements to 'value'
     void fill(T value) {
-        std::fill(data_.get(), data_.get() + size(), value);
+        std::fill(data_.get(), data_.get() + storage_size_, value);
     }
 
     /**
@@ -230,16 +371,9 @@ class NdMatrixBase {
     void resize(std::array<size_t, N> dim_sizes, T value = T()) {
         dim_sizes_ = dim_sizes;
         size_ = calc_size();
+        storage_size_ = Layout::calc_strides(dim_sizes_, dim_strides_);
         alloc();
         fill(value);
-        if (size_ > 0) {
-            dim_strides_[0] = size_ / dim_sizes_[0];
-            for (size_t dim = 1; dim < N; ++dim) {
-                dim_strides_[dim] = dim_strides_[dim - 1] / dim_sizes_[dim];
-            }
-        } else {
-            dim_strides_.fill(0);
-        }
     }
 
     ///@brief Reset the matrix to size zero
@@ -248,13 +382,14 @@ class NdMatrixBase {
         dim_sizes_.fill(0);
         dim_strides_.fill(0);
         size_ = 0;
+        storage_size_ = 0;
     }
 
   public: //Lifetime management
     ///@brief Copy constructor
     NdMatrixBase(const NdMatrixBase& other)
         : NdMatrixBase(other.dim_sizes_) {
-        std::copy(other.data_.get(), other.data_.get() + other.size(), data_.get());
+        std::copy(other.data_.get(), other.data_.get() + other.storage_size_, data_.get());
     }
 
     ///@brief Move constructor
@@ -274,9 +409,10 @@ class NdMatrixBase {
     }
 
     ///@brief Swap two NdMatrixBase objects
-    friend void swap(NdMatrixBase<T, N>& m1, NdMatrixBase<T, N>& m2) {
+    friend void swap(NdMatrixBase& m1, NdMatrixBase& m2) {
         using std::swap;
         swap(m1.size_, m2.size_);
+        swap(m1.storage_size_, m2.storage_size_);
         swap(m1.dim_sizes_, m2.dim_sizes_);
         swap(m1.dim_strides_, m2.dim_strides_);
         swap(m1.data_, m2.data_);
@@ -285,7 +421,7 @@ class NdMatrixBase {
   private:
     ///@brief Allocate space for all the elements
     void alloc() {
-        data_ = std::make_unique<T[]>(size());
+        data_ = std::make_unique<T[]>(storage_size_);
     }
 
     ///@brief Returns the size of the matrix (number of elements) calucated from the current dimensions
@@ -298,8 +434,14 @@ class NdMatrixBase {
         return cnt;
     }
 
+    template<size_t... Dims>
+    size_t storage_offset(const std::array<size_t, N>& index, std::index_sequence<Dims...>) const {
+        return (Layout::template offset<N - Dims>(index[Dims], dim_strides_[Dims]) + ...);
+    }
+
   protected:
-    size_t size_ = 0;
+    size_t size_ = 0;         //Number of elements
+    size_t storage_size_ = 0; //Number of elements of data_
     std::array<size_t, N> dim_sizes_;
     std::array<size_t, N> dim_strides_;
     std::unique_ptr<T[]> data_ = nullptr;
@@ -334,15 +476,21 @@ class NdMatrixBase {
  * 
  *       //Resizing an existing matrix (all elements set to value 88)
  *       m3.resize({15,55}, 88)
+ *
+ *       //A 3-dimensional matrix whose last two dimensions are stored in 8x8 tiles
+ *       NdMatrix<float,3,NdMatrixTiled<8>> m4({2,100,100});
+ *
+ *       //Copying between layouts
+ *       NdMatrix<float,3> m5(m4);
  */
-template<typename T, size_t N>
-class NdMatrix : public NdMatrixBase<T, N> {
+template<typename T, size_t N, typename Layout = NdMatrixRowMajor>
+class NdMatrix : public NdMatrixBase<T, N, Layout> {
     //General case
     static_assert(N >= 2, "Minimum dimension 2");
 
   public:
     ///@brief Use the base constructors
-    using NdMatrixBase<T, N>::NdMatrixBase;
+    using NdMatrixBase<T, N, Layout>::NdMatrixBase;
 
   public:
     /**
@@ -350,16 +498,16 @@ class NdMatrix : public NdMatrixBase<T, N> {
      *
      * Returns a proxy-object to allow chained array-style indexing  (N >= 2 case)
      */
-    const NdMatrixProxy<T, N - 1> operator[](size_t index) const {
+    const NdMatrixProxy<T, N - 1, Layout> operator[](size_t index) const {
         VTR_ASSERT_SAFE_MSG(this->dim_size(0) > 0, "Can not index into size zero dimension");
         VTR_ASSERT_SAFE_MSG(this->dim_size(1) > 0, "Can not index into size zero dimension");
         VTR_ASSERT_SAFE_MSG(index < this->dim_sizes_[0], "Index out of range (above dimension maximum)");
 
         // Peel off the first dimension
-        return NdMatrixProxy<T, N - 1>(
-            this->dim_sizes_.data() + 1,                        //Pass the dimension information
-            this->dim_strides_.data() + 1,                      //Pass the stride for the next dimension
-            this->data_.get() + this->dim_strides_[0] * index); //Advance to index in this dimension
+        return NdMatrixProxy<T, N - 1, Layout>(
+            this->dim_sizes_.data() + 1,                                               //Pass the dimension information
+            this->dim_strides_.data() + 1,                                             //Pass the stride for the next dimension
+            this->data_.get() + Layout::template offset<N>(index, this->dim_strides_[0])); //Advance to index in this dimension
     }
 
     /**
@@ -367,9 +515,9 @@ class NdMatrix : public NdMatrixBase<T, N> {
      *
      * Returns a proxy-object to allow chained array-style indexing
      */
-    NdMatrixProxy<T, N - 1> operator[](size_t index) {
+    NdMatrixProxy<T, N - 1, Layout> operator[](size_t index) {
         //Call the const version, since returned by value don't need to worry about const
-        return const_cast<const NdMatrix<T, N>*>(this)->operator[](index);
+        return const_cast<const NdMatrix*>(this)->operator[](index);
     }
 };
 
@@ -378,11 +526,11 @@ class NdMatrix : public NdMatrixBase<T, N> {
  *
  * This is considered a specialization for N=1
  */
-template<typename T>
-class NdMatrix<T, 1> : public NdMatrixBase<T, 1> {
+template<typename T, typename Layout>
+class NdMatrix<T, 1, Layout> : public NdMatrixBase<T, 1, Layout> {
   public:
     ///@brief Use the base constructors
-    using NdMatrixBase<T, 1>::NdMatrixBase;
+    using NdMatrixBase<T, 1, Layout>::NdMatrixBase;
 
   public:
     ///@brief Access an element (immutable)
@@ -397,7 +545,7 @@ class NdMatrix<T, 1> : public NdMatrixBase<T, 1> {
     ///@brief Access an element (mutable)
     T& operator[](size_t index) {
         //Call the const version, and cast away const-ness
-        return const_cast<T&>(const_cast<const NdMatrix<T, 1>*>(this)->operator[](index));
+        return const_cast<T&>(const_cast<const NdMatrix*>(this)->operator[](index));
     }
 };
 
@@ -405,5 +553,113 @@ class NdMatrix<T, 1> : public NdMatrixBase<T, 1> {
 template<typename T>
 using Matrix = NdMatrix<T, 2>;
 
+/**
+ * @brief A read-only, non-owning view of an N-dimensional matrix.
+ *
+ * Indexes data stored elsewhere (e.g. in an NdMatrix, or in a memory-mapped
+ * file) in the specified Layout exactly like a const NdMatrix would, so large
+ * tables can be queried in place without first being copied into an NdMatrix.
+ *
+ * The viewed data must outlive the view.
+ *
+ * Examples:
+ *
+ *       vtr::NdMatrix<float,3> m({2,3,4});
+ *       vtr::NdMatrixView<float,3> v(m);
+ *       float f = v[1][2][3]; //Same element as m[1][2][3]
+ *
+ *       //View of a raw buffer with dimensions [0..9][0..19]
+ *       vtr::NdMatrixView<float,2> v2({10,20}, buf);
+ */
+template<typename T, size_t N, typename Layout = NdMatrixRowMajor>
+class NdMatrixView {
+    static_assert(N >= 2, "Minimum dimension 2");
+
+  public:
+    ///@brief An empty view (all dimensions size zero)
+    NdMatrixView() {
+        dim_sizes_.fill(0);
+        dim_strides_.fill(0);
+    }
+
+    ///@brief View of a dim_sizes matrix whose storage (in Layout) starts at data
+    NdMatrixView(std::array<size_t, N> dim_sizes, const T* data)
+        : dim_sizes_(dim_sizes)
+        , data_(data) {
+        storage_size_ = Layout::calc_strides(dim_sizes_, dim_strides_);
+        if (storage_size_ == 0) {
+            data_ = nullptr;
+        }
+    }
+
+    ///@brief View of the elements of matrix
+    explicit NdMatrixView(const NdMatrix<T, N, Layout>& matrix)
+        : NdMatrixView(matrix.dim_sizes(), matrix.empty() ? nullptr : &matrix.get(0)) {}
+
+  public: //Accessors
+    ///@brief Returns the number of elements in the view
+    size_t size() const {
+        return calc_size();
+    }
+
+    ///@brief Returns the number of elements of the viewed storage (which includes any padding of the layout)
+    size_t storage_size() const {
+        return storage_size_;
+    }
+
+    ///@brief Returns true if there are no elements in the view
+    bool empty() const {
+        return data_ == nullptr;
+    }
+
+    ///@brief Returns the number of dimensions (i.e. N)
+    size_t ndims() const {
+        return N;
+    }
+
+    ///@brief Returns the size of the ith dimension
+    size_t dim_size(size_t i) const {
+        VTR_ASSERT_SAFE(i < N);
+
+        return dim_sizes_[i];
+    }
+
+    ///@brief Returns a pointer to the viewed storage
+    const T* data() const {
+        return data_;
+    }
+
+    /**
+     * @brief Access an element
+     *
+     * Returns a proxy-object to allow chained array-style indexing
+     */
+    const NdMatrixProxy<const T, N - 1, Layout> operator[](size_t index) const {
+        VTR_ASSERT_SAFE_MSG(dim_sizes_[0] > 0, "Can not index into size zero dimension");
+        VTR_ASSERT_SAFE_MSG(dim_sizes_[1] > 0, "Can not index into size zero dimension");
+        VTR_ASSERT_SAFE_MSG(index < dim_sizes_[0], "Index out of range (above dimension maximum)");
+
+        // Peel off the first dimension
+        return NdMatrixProxy<const T, N - 1, Layout>(
+            dim_sizes_.data() + 1,
+            dim_strides_.data() + 1,
+            data_ + Layout::template offset<N>(index, dim_strides_[0]));
+    }
+
+  private:
+    size_t calc_size() const {
+        size_t cnt = dim_sizes_[0];
+        for (size_t dim = 1; dim < N; ++dim) {
+            cnt *= dim_sizes_[dim];
+        }
+        return cnt;
+    }
+
+    std::array<size_t, N> dim_sizes_;
+    std::array<size_t, N> dim_strides_;
+    size_t storage_size_ = 0;
+    const T* data_ = nullptr;
+};
+
 } // namespace vtr
 #endif
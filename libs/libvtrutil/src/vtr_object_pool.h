@@ -0,0 +1,128 @@
+#ifndef VTR_OBJECT_POOL_H
+#define VTR_OBJECT_POOL_H
+/**
+ * @file
+ * @brief A pool of objects of a single type
+ *
+ * vtr::ObjectPool<T> allocates objects from large blocks of storage, and keeps
+ * destroyed objects on a free list for reuse, e.g.:
+ *
+ *      vtr::ObjectPool<t_heap> pool;
+ *      t_heap* item = pool.create();
+ *      ...
+ *      pool.destroy(item); //Storage is reused by the next create()
+ *      ...
+ *      pool.clear(); //Releases all the storage
+ *
+ * Unlike vtr::chunk_malloc() the storage of destroyed objects is reused. A pool
+ * is not thread safe, and is intended to be owned by a single (per thread)
+ * object such as a router's heap. See vtr::Arena for objects shared between threads.
+ *
+ * Copying a pool does not copy its objects: the copy is an empty pool. This keeps
+ * the owners copyable, e.g. routers which are copied from an exemplar for each thread.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace vtr {
+
+template<typename T>
+class ObjectPool {
+  public:
+    ObjectPool() = default;
+
+    ///@brief Constructs an empty pool (see above)
+    ObjectPool(const ObjectPool&) {}
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    ~ObjectPool() {
+        clear();
+    }
+
+    ///@brief Constructs a new object (from args) in the pool
+    template<typename... Args>
+    T* create(Args&&... args) {
+        void* storage;
+        if (free_head_) {
+            storage = free_head_;
+            free_head_ = free_head_->next;
+        } else {
+            if (next_in_block_ == block_size_) {
+                add_block();
+            }
+            storage = &blocks_.back()[next_in_block_++];
+        }
+        ++num_objects_;
+        return new (storage) T(std::forward<Args>(args)...);
+    }
+
+    ///@brief Destroys an object created by this pool, making its storage available for reuse
+    void destroy(T* obj) {
+        if (!obj) {
+            return;
+        }
+        obj->~T();
+        Slot* slot = reinterpret_cast<Slot*>(obj);
+        slot->next = free_head_;
+        free_head_ = slot;
+        --num_objects_;
+    }
+
+    /**
+     * @brief Releases all the storage of the pool
+     *
+     * The objects are not destroyed, so all objects with non-trivial destructors
+     * should have been destroyed first.
+     */
+    void clear() {
+        std::vector<std::unique_ptr<Slot[]>>().swap(blocks_);
+        free_head_ = nullptr;
+        next_in_block_ = 0;
+        block_size_ = 0;
+        num_slots_ = 0;
+        num_objects_ = 0;
+    }
+
+    ///@brief Returns the number of (not yet destroyed) objects created by the pool
+    size_t size() const {
+        return num_objects_;
+    }
+
+    ///@brief Returns the heap memory used by the pool
+    size_t memory_usage() const {
+        return num_slots_ * sizeof(Slot) + blocks_.capacity() * sizeof(std::unique_ptr<Slot[]>);
+    }
+
+  private:
+    //Storage of an object, or (once destroyed) the next item of the free list
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static constexpr size_t MIN_BLOCK_SIZE = 64;
+    static constexpr size_t MAX_BLOCK_SIZE = 64 * 1024;
+
+    void add_block() {
+        //Start small, since many pools only hold a few objects
+        block_size_ = blocks_.empty() ? MIN_BLOCK_SIZE : std::min(2 * block_size_, MAX_BLOCK_SIZE);
+        blocks_.emplace_back(new Slot[block_size_]);
+        next_in_block_ = 0;
+        num_slots_ += block_size_;
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> blocks_;
+    Slot* free_head_ = nullptr;
+    size_t next_in_block_ = 0; //Next never used slot of the last block
+    size_t block_size_ = 0;    //Size (in slots) of the last block
+    size_t num_slots_ = 0;     //Total size (in slots) of the blocks
+    size_t num_objects_ = 0;
+};
+
+} // namespace vtr
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef VTR_PARALLEL_H
+#define VTR_PARALLEL_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+/**
+ * @file
+ * @brief Parallel loops and reductions whose results do not depend on the number of threads
+ *
+ * These wrap TBB in the translation units built with VPR_USE_TBB (i.e. in VPR), and run
+ * serially otherwise.
+ */
+
+namespace vtr {
+
+///@brief The default number of loop indices summarized by a chunk of parallel_reduce_deterministic()
+constexpr size_t DEFAULT_REDUCE_CHUNK_SIZE = 1024;
+
+/**
+ * @brief Calls func(i) for each i in [begin, end)
+ *
+ * The calls may run concurrently (in any order), so they must be independent of each other.
+ */
+template<typename Func>
+void parallel_for(size_t begin, size_t end, const Func& func) {
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(begin, end, [&](size_t i) {
+        func(i);
+    });
+#else
+    for (size_t i = begin; i < end; ++i) {
+        func(i);
+    }
+#endif
+}
+
+/**
+ * @brief Reduces [begin, end) to a single value, identically whatever the number of threads
+ *
+ * The range is split into fixed chunks of chunk_size indices (the last one may be shorter), each
+ * summarized by chunk_func(first, last) -> T, possibly concurrently. The chunk values are then
+ * combined by reduce(T, const T&) -> T as a pairwise tree whose shape only depends on the number
+ * of chunks: chunk 2k is combined with chunk 2k+1, then those pairs pairwise, and so on.
+ *
+ * Since neither the chunking nor the combination order depend on the scheduling, non-associative
+ * reductions (e.g. floating point sums) are bit-identical from run to run and thread count to thread
+ * count (they may however differ in the last bits from a sequential left-to-right loop).
+ *
+ * Returns identity for an empty range.
+ */
+template<typename T, typename ChunkFunc, typename ReduceFunc>
+T parallel_reduce_deterministic(size_t begin,
+                                size_t end,
+                                T identity,
+                                const ChunkFunc& chunk_func,
+                                const ReduceFunc& reduce,
+                                size_t chunk_size = DEFAULT_REDUCE_CHUNK_SIZE) {
+    if (end <= begin) {
+        return identity;
+    }
+    if (chunk_size == 0) {
+        chunk_size = 1;
+    }
+    size_t num_chunks = (end - begin + chunk_size - 1) / chunk_size;
+
+    std::vector<T> chunk_values(num_chunks, identity);
+    vtr::parallel_for(0, num_chunks, [&](size_t ichunk) {
+        size_t first = begin + ichunk * chunk_size;
+        size_t last = (end - first > chunk_size) ? first + chunk_size : end;
+        chunk_values[ichunk] = chunk_func(first, last);
+    });
+
+    for (size_t stride = 1; stride < num_chunks; stride *= 2) {
+        for (size_t ichunk = 0; ichunk + stride < num_chunks; ichunk += 2 * stride) {
+            chunk_values[ichunk] = reduce(std::move(chunk_values[ichunk]), chunk_values[ichunk + stride]);
+        }
+    }
+    return std::move(chunk_values[0]);
+}
+
+} // namespace vtr
+
+#endif
@@ -0,0 +1,232 @@
+#include "vtr_profile.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+
+#include "vtr_log.h"
+
+namespace vtr {
+
+namespace profile_detail {
+std::atomic<bool> enabled(false);
+} // namespace profile_detail
+
+namespace {
+
+using clock = std::chrono::steady_clock;
+
+enum class e_profile_event : uint8_t {
+    ZONE,
+    COUNTER
+};
+
+///@brief A recorded zone ([start, end] in ticks) or counter (value at start)
+struct t_profile_event {
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+    int64_t id;
+    double value;
+    e_profile_event type;
+};
+
+///@brief The ring buffer of events recorded by one thread
+struct t_thread_events {
+    int tid = 0;
+    std::vector<t_profile_event> events;
+    uint64_t num_recorded = 0; //Total events recorded this session (may exceed events.size())
+};
+
+///@brief Profiling state shared by all threads
+struct t_profile_registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<t_thread_events>> threads;
+    size_t events_per_thread = DEFAULT_PROFILE_EVENTS_PER_THREAD;
+
+    //Tick/time of the session start, used to convert ticks to microseconds
+    uint64_t base_ticks = 0;
+    clock::time_point base_time;
+};
+
+t_profile_registry& registry() {
+    //Never destroyed, so events may be recorded by threads which outlive main()
+    static t_profile_registry* reg = new t_profile_registry;
+    return *reg;
+}
+
+thread_local t_thread_events* t_events = nullptr;
+
+inline uint64_t now_ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now().time_since_epoch()).count();
+#endif
+}
+
+t_thread_events& thread_events() {
+    if (!t_events) {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.threads.push_back(std::make_unique<t_thread_events>());
+        t_events = reg.threads.back().get();
+        t_events->tid = reg.threads.size() - 1;
+        t_events->events.resize(reg.events_per_thread);
+    }
+    return *t_events;
+}
+
+void record(const t_profile_event& event) {
+    t_thread_events& thread = thread_events();
+    if (thread.events.empty()) return;
+    thread.events[thread.num_recorded % thread.events.size()] = event;
+    ++thread.num_recorded;
+}
+
+void write_json_string(std::string& out, const char* str) {
+    out += '"';
+    for (const char* c = str; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out += '\\';
+            out += *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(*c));
+            out += buf;
+        } else {
+            out += *c;
+        }
+    }
+    out += '"';
+}
+
+void write_event(std::string& out, const t_profile_event& event, int tid, uint64_t base_ticks, double ticks_per_us) {
+    char buf[128];
+    out += "{\"name\":";
+    write_json_string(out, event.name);
+    double ts = (event.start - base_ticks) / ticks_per_us;
+    if (event.type == e_profile_event::ZONE) {
+        double dur = (event.end - event.start) / ticks_per_us;
+        std::snprintf(buf, sizeof(buf), ",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f", tid, ts, dur);
+        out += buf;
+        if (event.id != ProfileZone::NO_ID) {
+            std::snprintf(buf, sizeof(buf), ",\"args\":{\"id\":%lld}", static_cast<long long>(event.id));
+            out += buf;
+        }
+    } else {
+        std::snprintf(buf, sizeof(buf), ",\"ph\":\"C\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"args\":{\"value\":%.17g}", tid, ts, event.value);
+        out += buf;
+    }
+    out += "}";
+}
+
+} // namespace
+
+namespace profile_detail {
+
+void begin_zone(const char* /*name*/, int64_t /*id*/, uint64_t* start) {
+    *start = now_ticks();
+}
+
+void end_zone(const char* name, int64_t id, uint64_t start) {
+    record({name, start, now_ticks(), id, 0., e_profile_event::ZONE});
+}
+
+} // namespace profile_detail
+
+void enable_profiling(size_t events_per_thread) {
+    auto& reg = registry();
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.events_per_thread = events_per_thread;
+        for (auto& thread : reg.threads) {
+            thread->events.assign(events_per_thread, t_profile_event());
+            thread->num_recorded = 0;
+        }
+        reg.base_time = clock::now();
+        reg.base_ticks = now_ticks();
+    }
+    profile_detail::enabled.store(true, std::memory_order_relaxed);
+}
+
+void disable_profiling() {
+    profile_detail::enabled.store(false, std::memory_order_relaxed);
+}
+
+const char* intern_profile_name(const std::string& name) {
+    static std::mutex mutex;
+    static auto* names = new std::unordered_set<std::string>;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return names->insert(name).first->c_str();
+}
+
+void profile_counter(const char* name, double value) {
+    if (!name || !profiling_enabled()) return;
+    uint64_t now = now_ticks();
+    record({name, now, now, ProfileZone::NO_ID, value, e_profile_event::COUNTER});
+}
+
+bool write_profile_trace(const std::string& file) {
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    //Calibrate the tick rate against the steady clock over the whole session
+    double elapsed_us = std::chrono::duration<double, std::micro>(clock::now() - reg.base_time).count();
+    uint64_t elapsed_ticks = now_ticks() - reg.base_ticks;
+    double ticks_per_us = (elapsed_us > 0. && elapsed_ticks > 0) ? elapsed_ticks / elapsed_us : 1.;
+
+    FILE* fp = std::fopen(file.c_str(), "w");
+    if (!fp) return false;
+
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    uint64_t num_dropped = 0;
+    bool ok = true;
+    for (const auto& thread : reg.threads) {
+        if (!first) out += ",\n";
+        first = false;
+        char buf[128];
+        std::snprintf(buf, sizeof(buf), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                      thread->tid, thread->tid);
+        out += buf;
+
+        size_t capacity = thread->events.size();
+        uint64_t begin = 0;
+        if (thread->num_recorded > capacity) {
+            begin = thread->num_recorded - capacity;
+            num_dropped += begin;
+        }
+        for (uint64_t i = begin; i < thread->num_recorded; ++i) {
+            const t_profile_event& event = thread->events[i % capacity];
+            if (event.start < reg.base_ticks) continue; //Started before this session
+
+            out += ",\n";
+            write_event(out, event, thread->tid, reg.base_ticks, ticks_per_us);
+
+            if (out.size() > (1 << 20)) {
+                ok &= std::fwrite(out.data(), 1, out.size(), fp) == out.size();
+                out.clear();
+            }
+        }
+    }
+    out += "\n]}\n";
+    ok &= std::fwrite(out.data(), 1, out.size(), fp) == out.size();
+    ok &= std::fclose(fp) == 0;
+
+    if (num_dropped > 0) {
+        VTR_LOG_WARN("Profile trace '%s' is missing the %zu oldest events (increase the per-thread event limit to keep them)\n",
+                     file.c_str(), size_t(num_dropped));
+    }
+    return ok;
+}
+
+} // namespace vtr
@@ -0,0 +1,119 @@
+#ifndef VTR_PROFILE_H
+#define VTR_PROFILE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @file
+ * @brief Runtime-enabled hierarchical profiling zones and counters.
+ *
+ * A ProfileZone records the interval between its construction and destruction
+ * as a named event on the calling thread. Zones nest naturally with scope, so
+ * the recorded events form a per-thread hierarchy (e.g. route > iteration > net).
+ * Counters record a named value at a point in time (e.g. the placement cost at
+ * each temperature).
+ *
+ * Profiling is off by default. When off, a zone costs a single relaxed atomic
+ * load, so zones may be left in production builds. When on, events are stored
+ * in a fixed-size per-thread ring buffer (the oldest events are overwritten)
+ * with time stamp counter (TSC) based timestamps, so no locks or allocations
+ * are needed on the recording path after a thread's first event.
+ *
+ * The recorded events are exported with write_profile_trace() as Chrome trace
+ * event JSON, which can be viewed with chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Zone and counter names must outlive the profiling session; string literals
+ * can be used directly, while names built at run-time should be interned with
+ * intern_profile_name().
+ *
+ * Example:
+ *
+ *      vtr::enable_profiling();
+ *      {
+ *          vtr::ProfileZone zone("route_net", inet);
+ *          ...
+ *          vtr::profile_counter("overused_nodes", num_overused);
+ *      }
+ *      vtr::write_profile_trace("vpr.trace.json");
+ *
+ * Every vtr::ScopedActionTimer (and hence ScopedStartFinishTimer and
+ * ScopedFinishTimer) is also a profiling zone named after its action.
+ */
+
+namespace vtr {
+
+namespace profile_detail {
+extern std::atomic<bool> enabled;
+
+void begin_zone(const char* name, int64_t id, uint64_t* start);
+void end_zone(const char* name, int64_t id, uint64_t start);
+} // namespace profile_detail
+
+///@brief Default number of events stored per thread
+constexpr size_t DEFAULT_PROFILE_EVENTS_PER_THREAD = 1 << 20;
+
+///@brief Returns true if profiling events are being recorded
+inline bool profiling_enabled() {
+    return profile_detail::enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Starts recording profiling events
+ *
+ * Each thread keeps (at most) the last events_per_thread events it recorded.
+ * Any events recorded by a previous session are discarded.
+ */
+void enable_profiling(size_t events_per_thread = DEFAULT_PROFILE_EVENTS_PER_THREAD);
+
+///@brief Stops recording profiling events (recorded events are kept until the next enable_profiling())
+void disable_profiling();
+
+///@brief Returns a copy of name which lives until the end of the program, suitable as a zone or counter name
+const char* intern_profile_name(const std::string& name);
+
+///@brief Records the value of the named counter at the current time (if profiling is enabled)
+void profile_counter(const char* name, double value);
+
+/**
+ * @brief Writes all recorded events as Chrome trace event JSON to file
+ *
+ * Should be called when no other thread is recording events.
+ * Returns false if the file could not be written.
+ */
+bool write_profile_trace(const std::string& file);
+
+/**
+ * @brief Records a profiling zone covering its lifetime
+ *
+ * The optional id (e.g. a net or iteration number) is exported as an event
+ * argument. A null name disables the zone.
+ */
+class ProfileZone {
+  public:
+    static constexpr int64_t NO_ID = -1;
+
+    explicit ProfileZone(const char* name, int64_t id = NO_ID)
+        : name_(profiling_enabled() ? name : nullptr)
+        , id_(id) {
+        if (name_) profile_detail::begin_zone(name_, id_, &start_);
+    }
+
+    ~ProfileZone() {
+        if (name_) profile_detail::end_zone(name_, id_, start_);
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+  private:
+    const char* name_;
+    int64_t id_;
+    uint64_t start_ = 0;
+};
+
+} // namespace vtr
+
+#endif
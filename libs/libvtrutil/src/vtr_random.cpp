@@ -15,7 +15,8 @@ constexpr size_t IA = 1103515245u;
 constexpr size_t IC = 12345u;
 constexpr size_t IM = 2147483648u;
 
-static RandState random_state = 0;
+//Per thread, so concurrent workers each own an independent (and reproducible) sequence
+static thread_local RandState random_state = 0;
 
 /**
  * @brief The pseudo-random number generator is initialized using the argument passed as seed.
@@ -1,6 +1,8 @@
 #ifndef VTR_RANDOM_H
 #define VTR_RANDOM_H
 #include <algorithm> //For std::swap
+#include <cstddef>
+#include <cstdint>
 
 namespace vtr {
 /*********************** Portable random number generators *******************/
@@ -8,6 +10,9 @@ typedef unsigned RandState;
 
 /**
  * @brief The pseudo-random number generator is initialized using the argument passed as seed.
+ *
+ * The generator state used by srandom(), irand(int) and frand() is per thread
+ * (a new thread starts from seed 0).
  */
 void srandom(int seed);
 
@@ -41,5 +46,143 @@ void shuffle(Iter first, Iter last, RandState& rand_state) {
     }
 }
 
+namespace detail {
+///@brief Returns base^exp (modulo 2^64)
+constexpr uint64_t pow_wrapped(uint64_t base, size_t exp) {
+    uint64_t result = 1;
+    for (size_t i = 0; i < exp; ++i) {
+        result *= base;
+    }
+    return result;
+}
+} // namespace detail
+
+/**
+ * @brief A fast (header inline) pseudo-random number generator with independent streams
+ *
+ * Implements PCG32 (O'Neill, "PCG: A Family of Simple Fast Space-Efficient Statistically
+ * Good Algorithms for Random Number Generation"): a 64-bit LCG whose output is permuted
+ * down to 32 bits. Unlike srandom()/irand()/frand() the state is explicit, and the calls
+ * inline into hot loops (e.g. the placer's move generation).
+ *
+ * The sequence is selected by both a seed and a stream number, and different streams
+ * (e.g. one per thread or placement region) are independent even if they share a seed:
+ *
+ *      vtr::RandomNumberGenerator rng(seed, ithread);
+ *      int i = rng.irand(9);   //[0..9]
+ *      float f = rng.frand();  //[0..1)
+ *
+ * The bulk fill_irand()/fill_frand() draws produce exactly the same values as the
+ * equivalent sequence of single draws, but advance several interleaved copies of the
+ * generator at once, so the loop has no serial dependency and can be vectorized.
+ */
+class RandomNumberGenerator {
+  public:
+    ///@brief Initializes the generator to the specified stream of seed_value
+    explicit RandomNumberGenerator(uint64_t seed_value = 0, uint64_t stream = 0) {
+        seed(seed_value, stream);
+    }
+
+    ///@brief Restarts the generator at the beginning of the specified stream of seed_value
+    void seed(uint64_t seed_value, uint64_t stream = 0) {
+        inc_ = (stream << 1) | 1u; //Must be odd
+        state_ = 0;
+        next();
+        state_ += seed_value;
+        next();
+
+        //Increment to advance by LANES steps at once (the multiplier is LANES_MULT)
+        lanes_inc_ = 0;
+        for (size_t i = 0; i < LANES; ++i) {
+            lanes_inc_ = lanes_inc_ * MULT + inc_;
+        }
+    }
+
+    ///@brief Returns a uniformly distributed 32-bit random number
+    uint32_t operator()() {
+        return next();
+    }
+
+    ///@brief Returns a random integer in [0..imax] (imax must be non-negative)
+    int irand(int imax) {
+        return to_irand(next(), imax);
+    }
+
+    ///@brief Returns a random float in [0..1)
+    float frand() {
+        return to_frand(next());
+    }
+
+    ///@brief Fills out[0..n) with random integers in [0..imax], as if by n calls to irand(imax)
+    void fill_irand(int imax, int* out, size_t n) {
+        fill(out, n, [imax](uint32_t value) { return to_irand(value, imax); });
+    }
+
+    ///@brief Fills out[0..n) with random floats in [0..1), as if by n calls to frand()
+    void fill_frand(float* out, size_t n) {
+        fill(out, n, [](uint32_t value) { return to_frand(value); });
+    }
+
+  private:
+    static constexpr uint64_t MULT = 6364136223846793005u;
+
+    ///@brief Number of interleaved generators advanced by the bulk draws
+    static constexpr size_t LANES = 8;
+
+    static constexpr uint64_t LANES_MULT = detail::pow_wrapped(MULT, LANES);
+
+    ///@brief The PCG XSH-RR output permutation of a state
+    static uint32_t output(uint64_t state) {
+        uint32_t xorshifted = uint32_t(((state >> 18u) ^ state) >> 27u);
+        uint32_t rot = uint32_t(state >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((-rot) & 31u));
+    }
+
+    //Multiply-shift range reduction (Lemire), which avoids a (slow) division. The bias
+    //of at most (imax + 1) / 2^32 is negligible for the ranges VPR draws from.
+    static int to_irand(uint32_t value, int imax) {
+        return int((uint64_t(value) * (uint64_t(imax) + 1u)) >> 32u);
+    }
+
+    static float to_frand(uint32_t value) {
+        return float(value >> 8u) * (1.f / float(1u << 24u)); //24 bits fit exactly in a float
+    }
+
+    uint32_t next() {
+        uint64_t old_state = state_;
+        state_ = old_state * MULT + inc_;
+        return output(old_state);
+    }
+
+    template<typename T, typename F>
+    void fill(T* out, size_t n, F transform) {
+        size_t i = 0;
+        if (n >= LANES) {
+            //Lane j holds the state of draw i + j
+            uint64_t lanes[LANES];
+            lanes[0] = state_;
+            for (size_t j = 1; j < LANES; ++j) {
+                lanes[j] = lanes[j - 1] * MULT + inc_;
+            }
+
+            for (; i + LANES <= n; i += LANES) {
+                for (size_t j = 0; j < LANES; ++j) {
+                    out[i + j] = transform(output(lanes[j]));
+                    lanes[j] = lanes[j] * LANES_MULT + lanes_inc_;
+                }
+            }
+            state_ = lanes[0];
+        }
+
+        for (; i < n; ++i) {
+            out[i] = transform(next());
+        }
+    }
+
+    uint64_t state_ = 0;
+    uint64_t inc_ = 1;
+    uint64_t lanes_inc_ = 0;
+};
+
 } // namespace vtr
 #endif
@@ -31,7 +31,8 @@ float Timer::delta_max_rss_mib() const {
 ///@brief Constructor
 ScopedActionTimer::ScopedActionTimer(std::string action_str)
     : action_(action_str)
-    , depth_(f_timer_depth++) {
+    , depth_(f_timer_depth++)
+    , zone_(profiling_enabled() ? intern_profile_name(action_) : nullptr) {
 }
 
 ///@brief Destructor
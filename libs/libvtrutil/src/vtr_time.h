@@ -3,6 +3,8 @@
 #include <chrono>
 #include <string>
 
+#include "vtr_profile.h"
+
 namespace vtr {
 
 ///@brief Class for tracking time elapsed since construction
@@ -36,7 +38,11 @@ class Timer {
     constexpr static float BYTE_TO_MIB = 1024 * 1024;
 };
 
-///@brief Scoped time class which prints the time elapsed for the specifid action
+/**
+ * @brief Scoped time class which prints the time elapsed for the specifid action
+ *
+ * The timer is also a profiling zone (see vtr_profile.h) named after the action.
+ */
 class ScopedActionTimer : public Timer {
   public:
     ScopedActionTimer(const std::string action);
@@ -54,6 +60,7 @@ class ScopedActionTimer : public Timer {
     const std::string action_;
     bool quiet_ = false;
     int depth_;
+    ProfileZone zone_;
 };
 
 /**
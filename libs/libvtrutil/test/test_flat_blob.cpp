@@ -0,0 +1,190 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_digest.h"
+#include "vtr_flat_blob.h"
+#include "vtr_ndmatrix.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+TEST_CASE("NdMatrixView", "[vtr_ndmatrix/NdMatrixView]") {
+    vtr::NdMatrix<int, 3> matrix({2, 3, 4});
+    for (size_t i = 0; i < matrix.size(); ++i) {
+        matrix.get(i) = i;
+    }
+
+    vtr::NdMatrixView<int, 3> view(matrix);
+    REQUIRE(view.size() == matrix.size());
+    for (size_t dim = 0; dim < 3; ++dim) {
+        REQUIRE(view.dim_size(dim) == matrix.dim_size(dim));
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            for (size_t k = 0; k < 4; ++k) {
+                REQUIRE(view[i][j][k] == matrix[i][j][k]);
+            }
+        }
+    }
+
+    REQUIRE(vtr::NdMatrixView<int, 3>().empty());
+    REQUIRE(vtr::NdMatrixView<int, 3>(vtr::NdMatrix<int, 3>()).empty());
+}
+
+TEST_CASE("NdMatrixTiled", "[vtr_ndmatrix/NdMatrixTiled]") {
+    //Dimensions which are not multiples of the tile size are padded
+    vtr::NdMatrix<int, 3> row_major({2, 11, 6});
+    for (size_t i = 0; i < row_major.size(); ++i) {
+        row_major.get(i) = i;
+    }
+
+    vtr::NdMatrix<int, 3, vtr::NdMatrixTiled<4>> tiled(row_major);
+    REQUIRE(tiled.size() == row_major.size());
+    REQUIRE(tiled.storage_size() == 2 * 12 * 8);
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 11; ++j) {
+            for (size_t k = 0; k < 6; ++k) {
+                REQUIRE(tiled[i][j][k] == row_major[i][j][k]);
+                REQUIRE(tiled.element({i, j, k}) == row_major[i][j][k]);
+            }
+        }
+    }
+
+    //Elements of a tile are contiguous
+    REQUIRE(&tiled[0][1][1] - &tiled[0][0][0] == 4 + 1);
+    REQUIRE(&tiled[0][3][3] - &tiled[0][0][0] == 15);
+    REQUIRE(&tiled[0][0][4] - &tiled[0][0][0] == 16);
+
+    tiled[1][10][5] = -1;
+    REQUIRE(vtr::NdMatrix<int, 3>(tiled)[1][10][5] == -1);
+
+    vtr::NdMatrixView<int, 3, vtr::NdMatrixTiled<4>> view(tiled);
+    REQUIRE(view.storage_size() == tiled.storage_size());
+    REQUIRE(view[1][10][5] == -1);
+    REQUIRE(view[1][2][3] == row_major[1][2][3]);
+
+    vtr::NdMatrix<float, 2, vtr::NdMatrixTiled<8>> matrix({3, 20}, 1.5);
+    REQUIRE(matrix.storage_size() == 8 * 24);
+    REQUIRE(matrix[2][19] == 1.5);
+    REQUIRE(vtr::NdMatrix<float, 2, vtr::NdMatrixTiled<8>>({0, 20}).storage_size() == 0);
+}
+
+TEST_CASE("FlatBlob", "[vtr_flat_blob/FlatBlob]") {
+    const std::string file = "test_flat_blob.blob";
+
+    struct t_entry {
+        float delay;
+        float congestion;
+    };
+
+    vtr::NdMatrix<t_entry, 4> costs({2, 3, 5, 7});
+    for (size_t i = 0; i < costs.size(); ++i) {
+        costs.get(i) = {float(i), -float(i)};
+    }
+    std::vector<int16_t> keys = {3, 1, 4, 1, 5};
+    std::vector<float> empty;
+    std::vector<int32_t> referenced = {2, 7, 1, 8};
+
+    vtr::FlatBlobWriter writer;
+    writer.add_matrix(costs);
+    writer.add_array(keys);
+    writer.add_array(empty);
+    writer.add_array(vtr::array_view<const int32_t>(referenced.data(), referenced.size()));
+    REQUIRE(writer.section_data(3).data() == reinterpret_cast<const char*>(referenced.data()));
+    writer.write(file);
+
+    SECTION("Round trip") {
+        vtr::FlatBlobReader reader(file);
+        REQUIRE(reader.num_sections() == 4);
+
+        auto view = reader.matrix<t_entry, 4>(0);
+        REQUIRE(reinterpret_cast<uintptr_t>(view.data()) % vtr::FLAT_BLOB_ALIGNMENT == 0);
+        REQUIRE(view.size() == costs.size());
+        for (size_t i = 0; i < 2; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                for (size_t k = 0; k < 5; ++k) {
+                    for (size_t l = 0; l < 7; ++l) {
+                        REQUIRE(view[i][j][k][l].delay == costs[i][j][k][l].delay);
+                        REQUIRE(view[i][j][k][l].congestion == costs[i][j][k][l].congestion);
+                    }
+                }
+            }
+        }
+
+        auto read_keys = reader.array<int16_t>(1);
+        REQUIRE(read_keys.size() == keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            REQUIRE(read_keys[i] == keys[i]);
+        }
+
+        REQUIRE(reader.array<float>(2).size() == 0);
+
+        auto read_referenced = reader.array<int32_t>(3);
+        REQUIRE(std::equal(read_referenced.begin(), read_referenced.end(), referenced.begin(), referenced.end()));
+
+        auto raw_keys = reader.section_data(1);
+        REQUIRE(raw_keys.size() == keys.size() * sizeof(int16_t));
+        REQUIRE(std::equal(raw_keys.begin(), raw_keys.end(), writer.section_data(1).begin()));
+        REQUIRE_THROWS_AS(reader.section_data(4), vtr::VtrError);
+    }
+
+    SECTION("Tiled section") {
+        vtr::NdMatrix<float, 3, vtr::NdMatrixTiled<4>> tiled({2, 5, 9});
+        for (size_t i = 0; i < tiled.storage_size(); ++i) {
+            tiled.get(i) = i;
+        }
+        vtr::FlatBlobWriter tiled_writer;
+        tiled_writer.add_matrix(tiled);
+        tiled_writer.write(file);
+
+        vtr::FlatBlobReader reader(file);
+        auto view = reader.matrix<float, 3, vtr::NdMatrixTiled<4>>(0);
+        REQUIRE(reader.section_data(0).size() == tiled.storage_size() * sizeof(float));
+        for (size_t i = 0; i < 2; ++i) {
+            for (size_t j = 0; j < 5; ++j) {
+                for (size_t k = 0; k < 9; ++k) {
+                    REQUIRE(view[i][j][k] == tiled[i][j][k]);
+                }
+            }
+        }
+        REQUIRE_THROWS_AS((reader.matrix<float, 3>(0)), vtr::VtrError);
+        REQUIRE_THROWS_AS((reader.matrix<float, 3, vtr::NdMatrixTiled<8>>(0)), vtr::VtrError);
+    }
+
+    SECTION("Mismatched section") {
+        vtr::FlatBlobReader reader(file);
+        REQUIRE_THROWS_AS((reader.matrix<t_entry, 3>(0)), vtr::VtrError);
+        REQUIRE_THROWS_AS(reader.array<int32_t>(1), vtr::VtrError);
+        REQUIRE_THROWS_AS(reader.array<int16_t>(4), vtr::VtrError);
+    }
+
+    SECTION("Not a blob") {
+        {
+            std::ofstream os(file, std::ios::trunc);
+            os << "This is not a flat blob";
+        }
+        REQUIRE_THROWS_AS(vtr::FlatBlobReader(file), vtr::VtrError);
+    }
+
+    std::remove(file.c_str());
+}
+
+TEST_CASE("DigestBuffers", "[vtr_digest/DigestBuffers]") {
+    //Larger than the chunks the hasher is fed with
+    std::string first(100000, 'a');
+    std::string second = "bcd";
+
+    vtr::array_view<const char> first_view(first.data(), first.size());
+    vtr::array_view<const char> second_view(second.data(), second.size());
+
+    std::stringstream joined(first + second);
+    REQUIRE(vtr::secure_digest_buffers({first_view, second_view}) == vtr::secure_digest_stream(joined));
+    REQUIRE(vtr::secure_digest_buffers({first_view}) != vtr::secure_digest_buffers({second_view}));
+}
+
+} // namespace
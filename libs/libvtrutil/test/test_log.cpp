@@ -0,0 +1,99 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_log.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const char* kLogFile = "test_log.log";
+
+///@brief Returns the contents of the log file, closing it
+std::string read_log() {
+    vtr::set_log_file(nullptr);
+    std::ifstream file(kLogFile);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::remove(kLogFile);
+    return contents.str();
+}
+
+TEST_CASE("ScopedLogBuffer", "[vtr_log]") {
+    vtr::set_log_file(kLogFile);
+
+    //Threads are started in reverse order of their keys
+    std::vector<std::thread> threads;
+    for (int ithread = 3; ithread >= 0; --ithread) {
+        threads.emplace_back([ithread]() {
+            vtr::ScopedLogBuffer log_buffer(ithread);
+            VTR_LOG("thread %d line 0\n", ithread);
+            VTR_LOG_WARN("thread %d line 1\n", ithread);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    VTR_LOG("unbuffered\n");
+    vtr::flush_log_buffers();
+
+    std::string expected = "unbuffered\n";
+    for (int ithread = 0; ithread < 4; ++ithread) {
+        expected += "thread " + std::to_string(ithread) + " line 0\n";
+        expected += "Warning: thread " + std::to_string(ithread) + " line 1\n";
+    }
+
+    //Warning numbers are global, so compare without them
+    std::string log = read_log();
+    std::string stripped;
+    std::istringstream lines(log);
+    for (std::string line; std::getline(lines, line);) {
+        if (line.rfind("Warning ", 0) == 0) {
+            line = "Warning" + line.substr(line.find(':'));
+        }
+        stripped += line + "\n";
+    }
+    REQUIRE(stripped == expected);
+
+    //Nested scopes restore the enclosing key
+    vtr::set_log_file(kLogFile);
+    {
+        vtr::ScopedLogBuffer outer(2);
+        {
+            vtr::ScopedLogBuffer inner(1);
+            VTR_LOG("b\n");
+        }
+        VTR_LOG("c\n");
+    }
+    {
+        vtr::ScopedLogBuffer other(0);
+        VTR_LOG("a\n");
+    }
+    vtr::flush_log_buffers();
+    REQUIRE(read_log() == "a\nb\nc\n");
+}
+
+TEST_CASE("LogRateLimiter", "[vtr_log]") {
+    vtr::set_log_file(kLogFile);
+    for (int i = 0; i < 10; ++i) {
+        VTR_LOG_LIMITED(3, "message %d\n", i);
+    }
+    std::string log = read_log();
+
+    REQUIRE(log.find("message 2\n") != std::string::npos);
+    REQUIRE(log.find("message 3\n") == std::string::npos);
+    REQUIRE(log.find("Suppressing further messages") != std::string::npos);
+
+    vtr::LogRateLimiter limiter(2);
+    REQUIRE(limiter.should_log(__FILE__, __LINE__));
+    REQUIRE(limiter.should_log(__FILE__, __LINE__));
+    REQUIRE(!limiter.should_log(__FILE__, __LINE__));
+    REQUIRE(!limiter.should_log(__FILE__, __LINE__));
+}
+
+} // namespace
@@ -0,0 +1,71 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_mapped_vector.h"
+#include "vtr_memory_usage.h"
+#include "vtr_strong_id.h"
+
+#include <vector>
+
+struct mapped_test_tag;
+typedef vtr::StrongId<mapped_test_tag> MappedTestId;
+
+TEST_CASE("mapped_vector_owned", "[vtr_mapped_vector]") {
+    vtr::mapped_vector<MappedTestId, int> vec;
+    REQUIRE(vec.empty());
+
+    vec.push_back(1);
+    vec.emplace_back(2);
+    vec.resize(3, 3);
+    vec.mut(MappedTestId(0)) = 4;
+
+    REQUIRE(!vec.viewing());
+    REQUIRE(vec.size() == 3);
+    REQUIRE(vec[MappedTestId(0)] == 4);
+    REQUIRE(vec[MappedTestId(1)] == 2);
+    REQUIRE(vec.back() == 3);
+    REQUIRE(std::vector<int>(vec.begin(), vec.end()) == std::vector<int>{4, 2, 3});
+
+    size_t num_keys = 0;
+    for (MappedTestId id : vec.keys()) {
+        REQUIRE(size_t(id) == num_keys);
+        ++num_keys;
+    }
+    REQUIRE(num_keys == 3);
+}
+
+TEST_CASE("mapped_vector_view", "[vtr_mapped_vector]") {
+    const std::vector<int> viewed = {1, 2, 3};
+
+    vtr::mapped_vector<MappedTestId, int> vec;
+    vec.push_back(7);
+    vec.view(viewed.data(), viewed.size());
+    REQUIRE(vec.viewing());
+    REQUIRE(vec.size() == 3);
+    REQUIRE(vec.data() == viewed.data());
+    REQUIRE(vec[MappedTestId(2)] == 3);
+    REQUIRE(vtr::memory_usage(vec) == 0);
+
+    //Copies share the view, and swaps keep it
+    vtr::mapped_vector<MappedTestId, int> copy = vec;
+    REQUIRE(copy.data() == viewed.data());
+    vtr::mapped_vector<MappedTestId, int> other;
+    other.push_back(5);
+    other.swap(copy);
+    REQUIRE(other.data() == viewed.data());
+    REQUIRE(copy.size() == 1);
+    REQUIRE(copy[MappedTestId(0)] == 5);
+
+    //The first modification copies the viewed elements
+    vec.mut(MappedTestId(1)) = 4;
+    REQUIRE(!vec.viewing());
+    REQUIRE(vec.data() != viewed.data());
+    REQUIRE(std::vector<int>(vec.begin(), vec.end()) == std::vector<int>{1, 4, 3});
+    REQUIRE(viewed[1] == 2);
+    REQUIRE(other[MappedTestId(1)] == 2);
+
+    vec.clear();
+    REQUIRE(vec.empty());
+    vec.view(viewed.data(), 0);
+    REQUIRE(!vec.viewing());
+    REQUIRE(vec.empty());
+}
@@ -1,4 +1,6 @@
 #include <limits>
+#include <vector>
+#include <cstdlib>
 
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/catch_approx.hpp"
@@ -56,3 +58,30 @@ TEST_CASE("Is Close", "[vtr_math]") {
     REQUIRE(vtr::isclose(32.2, 32.4, 1e-9, 0.2));
     REQUIRE(!vtr::isclose(32.2, 32.4, 1e-9, 0.1));
 }
+
+TEST_CASE("Hilbert Index", "[vtr_math]") {
+    REQUIRE(vtr::hilbert_index(0, 0, 1) == 0);
+    REQUIRE(vtr::hilbert_index(0, 1, 1) == 1);
+    REQUIRE(vtr::hilbert_index(1, 1, 1) == 2);
+    REQUIRE(vtr::hilbert_index(1, 0, 1) == 3);
+
+    //The curve visits every point of the grid once, moving between adjacent points
+    const int order = 4;
+    const uint32_t size = 1 << order;
+    std::vector<int> xs(size * size, -1);
+    std::vector<int> ys(size * size, -1);
+    for (uint32_t x = 0; x < size; ++x) {
+        for (uint32_t y = 0; y < size; ++y) {
+            uint64_t index = vtr::hilbert_index(x, y, order);
+            REQUIRE(index < size * size);
+            REQUIRE(xs[index] == -1);
+            xs[index] = x;
+            ys[index] = y;
+        }
+    }
+    for (size_t i = 1; i < xs.size(); ++i) {
+        REQUIRE(std::abs(xs[i] - xs[i - 1]) + std::abs(ys[i] - ys[i - 1]) == 1);
+    }
+
+    REQUIRE(vtr::hilbert_index(~uint32_t(0), 0, 32) == ~uint64_t(0));
+}
@@ -0,0 +1,63 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_memory_usage.h"
+#include "vtr_strong_id.h"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct test_tag;
+typedef vtr::StrongId<test_tag> TestId;
+
+TEST_CASE("memory_usage_flat", "[vtr_memory_usage]") {
+    std::vector<int> vec;
+    REQUIRE(vtr::memory_usage(vec) == 0);
+
+    vec.reserve(100);
+    REQUIRE(vtr::memory_usage(vec) == 100 * sizeof(int));
+
+    vtr::vector<TestId, double> ids(10);
+    ids.shrink_to_fit();
+    REQUIRE(vtr::memory_usage(ids) == 10 * sizeof(double));
+
+    std::vector<bool> bits(1024);
+    bits.shrink_to_fit();
+    REQUIRE(vtr::memory_usage(bits) == 1024 / 8);
+
+    vtr::NdMatrix<float, 3> matrix({2, 3, 4});
+    REQUIRE(vtr::memory_usage(matrix) == 2 * 3 * 4 * sizeof(float));
+}
+
+TEST_CASE("memory_usage_nested", "[vtr_memory_usage]") {
+    std::vector<std::vector<int>> nested(10);
+    nested.shrink_to_fit();
+    for (auto& inner : nested) {
+        inner.reserve(100);
+    }
+    REQUIRE(vtr::memory_usage(nested) == 10 * sizeof(std::vector<int>) + 10 * 100 * sizeof(int));
+
+    //Short strings need no allocation
+    std::vector<std::string> strings = {"a", std::string(100, 'b')};
+    strings.shrink_to_fit();
+    REQUIRE(vtr::memory_usage(strings) == 2 * sizeof(std::string) + strings[1].capacity() + 1);
+
+    vtr::NdMatrix<std::vector<int>, 2> matrix({2, 2});
+    matrix[1][1].reserve(8);
+    REQUIRE(vtr::memory_usage(matrix) == 4 * sizeof(std::vector<int>) + 8 * sizeof(int));
+
+    //Maps account for the elements, and whatever they hold
+    std::map<int, std::vector<int>> map;
+    REQUIRE(vtr::memory_usage(map) == 0);
+    map[0].reserve(16);
+    REQUIRE(vtr::memory_usage(map) > sizeof(std::pair<const int, std::vector<int>>) + 16 * sizeof(int));
+
+    std::unordered_map<int, std::vector<int>> hash_map;
+    hash_map[0].reserve(16);
+    REQUIRE(vtr::memory_usage(hash_map) > sizeof(std::pair<const int, std::vector<int>>) + 16 * sizeof(int));
+}
+
+} // namespace
@@ -0,0 +1,120 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_arena.h"
+#include "vtr_object_pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Counted {
+    explicit Counted(int v)
+        : value(v) {
+        ++num_alive;
+    }
+    ~Counted() {
+        --num_alive;
+    }
+
+    int value;
+    static int num_alive;
+};
+int Counted::num_alive = 0;
+
+TEST_CASE("ObjectPool", "[vtr_object_pool]") {
+    vtr::ObjectPool<Counted> pool;
+
+    std::vector<Counted*> objs;
+    for (int i = 0; i < 1000; ++i) {
+        objs.push_back(pool.create(i));
+    }
+    REQUIRE(pool.size() == 1000);
+    REQUIRE(Counted::num_alive == 1000);
+    REQUIRE(pool.memory_usage() >= 1000 * sizeof(Counted));
+
+    //Copies are empty
+    vtr::ObjectPool<Counted> copy(pool);
+    REQUIRE(copy.size() == 0);
+    REQUIRE(copy.memory_usage() == 0);
+    REQUIRE(Counted::num_alive == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(objs[i]->value == i);
+    }
+
+    //Destroyed storage is reused
+    Counted* last = objs.back();
+    pool.destroy(last);
+    REQUIRE(Counted::num_alive == 999);
+    size_t bytes = pool.memory_usage();
+    REQUIRE(pool.create(-1) == last);
+    REQUIRE(pool.memory_usage() == bytes);
+
+    for (Counted* obj : objs) {
+        pool.destroy(obj);
+    }
+    REQUIRE(pool.size() == 0);
+    REQUIRE(Counted::num_alive == 0);
+
+    pool.clear();
+    REQUIRE(pool.memory_usage() == 0);
+    Counted* obj = pool.create(5);
+    REQUIRE(obj->value == 5);
+    pool.destroy(obj);
+}
+
+TEST_CASE("Arena", "[vtr_arena]") {
+    SECTION("size classes") {
+        std::vector<std::pair<void*, size_t>> allocs;
+        std::set<void*> ptrs;
+        for (size_t size : {1, 8, 16, 17, 100, 512, 513, 4096}) {
+            void* ptr = vtr::Arena::allocate(size);
+            REQUIRE(reinterpret_cast<uintptr_t>(ptr) % vtr::Arena::GRANULARITY == 0);
+            REQUIRE(ptrs.insert(ptr).second);
+            std::fill_n(static_cast<char*>(ptr), size, 0x5a);
+            allocs.emplace_back(ptr, size);
+        }
+        for (auto alloc : allocs) {
+            vtr::Arena::deallocate(alloc.first, alloc.second);
+        }
+
+        //Freed storage is reused by allocations of the same size class
+        void* ptr = vtr::Arena::allocate(40);
+        vtr::Arena::deallocate(ptr, 40);
+        REQUIRE(vtr::Arena::allocate(48) == ptr);
+        vtr::Arena::deallocate(ptr, 48);
+    }
+
+    SECTION("cross thread") {
+        //Storage allocated by one thread may be freed by another
+        std::vector<void*> ptrs(10000);
+        std::thread producer([&]() noexcept {
+            for (void*& ptr : ptrs) {
+                ptr = vtr::Arena::allocate(32);
+                *static_cast<size_t*>(ptr) = 0;
+            }
+        });
+        producer.join();
+
+        std::thread consumer([&]() noexcept {
+            for (void* ptr : ptrs) {
+                vtr::Arena::deallocate(ptr, 32);
+            }
+        });
+        consumer.join();
+
+        size_t bytes = vtr::Arena::memory_usage();
+        for (void*& ptr : ptrs) {
+            ptr = vtr::Arena::allocate(32);
+        }
+        REQUIRE(vtr::Arena::memory_usage() == bytes);
+        for (void* ptr : ptrs) {
+            vtr::Arena::deallocate(ptr, 32);
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,69 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_parallel.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+TEST_CASE("parallel_for", "[vtr_parallel]") {
+    std::vector<int> values(1000, 0);
+    vtr::parallel_for(0, values.size(), [&](size_t i) {
+        values[i] = 2 * i;
+    });
+    for (size_t i = 0; i < values.size(); ++i) {
+        REQUIRE(values[i] == int(2 * i));
+    }
+}
+
+TEST_CASE("parallel_reduce_deterministic", "[vtr_parallel]") {
+    //Values whose float sum depends on the summation order
+    std::vector<double> values;
+    for (size_t i = 0; i < 10007; ++i) {
+        values.push_back(1. / (i + 1) + ((i % 3 == 0) ? 1e8 : 0.));
+    }
+    auto chunk_sum = [&](size_t first, size_t last) {
+        double sum = 0.;
+        for (size_t i = first; i < last; ++i) {
+            sum += values[i];
+        }
+        return sum;
+    };
+    auto add = [](double a, double b) { return a + b; };
+
+    SECTION("empty") {
+        REQUIRE(vtr::parallel_reduce_deterministic(5, 5, -1., chunk_sum, add) == -1.);
+    }
+
+    SECTION("pairwise_tree") {
+        const size_t chunk_size = 100;
+        double sum = vtr::parallel_reduce_deterministic(0, values.size(), 0., chunk_sum, add, chunk_size);
+
+        //The same chunks, reduced pairwise level by level
+        std::vector<double> level;
+        for (size_t first = 0; first < values.size(); first += chunk_size) {
+            level.push_back(chunk_sum(first, std::min(first + chunk_size, values.size())));
+        }
+        while (level.size() > 1) {
+            std::vector<double> next;
+            for (size_t i = 0; i < level.size(); i += 2) {
+                next.push_back(i + 1 < level.size() ? level[i] + level[i + 1] : level[i]);
+            }
+            level.swap(next);
+        }
+        REQUIRE(sum == level[0]);
+
+        //And repeatable
+        REQUIRE(vtr::parallel_reduce_deterministic(0, values.size(), 0., chunk_sum, add, chunk_size) == sum);
+    }
+
+    SECTION("partial_chunk") {
+        int count = vtr::parallel_reduce_deterministic(
+            3, 12, 0, [](size_t first, size_t last) { return int(last - first); },
+            [](int a, int b) { return a + b; }, 4);
+        REQUIRE(count == 9);
+    }
+}
+
+} // namespace
@@ -0,0 +1,84 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_profile.h"
+#include "vtr_time.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+static constexpr const char kTraceFile[] = "test_profile.trace.json";
+
+static std::string read_trace() {
+    std::ifstream is(kTraceFile);
+    std::stringstream ss;
+    ss << is.rdbuf();
+    return ss.str();
+}
+
+static size_t count_occurrences(const std::string& str, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+TEST_CASE("profile_zones", "[vtr_profile]") {
+    {
+        vtr::ProfileZone zone("disabled_zone");
+    }
+
+    vtr::enable_profiling(16);
+    REQUIRE(vtr::profiling_enabled());
+    {
+        vtr::ProfileZone outer("outer_zone");
+        for (int i = 0; i < 3; ++i) {
+            vtr::ProfileZone inner("inner_zone", i);
+            vtr::profile_counter("counter", 0.5 * i);
+        }
+        vtr::ScopedFinishTimer timer(std::string("timer \"action\""));
+        timer.quiet(true);
+    }
+    std::thread([] {
+        vtr::ProfileZone zone(vtr::intern_profile_name("thread_zone"));
+    }).join();
+    vtr::disable_profiling();
+    {
+        vtr::ProfileZone zone("disabled_zone");
+    }
+
+    REQUIRE(vtr::write_profile_trace(kTraceFile));
+    std::string trace = read_trace();
+
+    REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(count_occurrences(trace, "\"name\":\"outer_zone\",\"ph\":\"X\"") == 1);
+    REQUIRE(count_occurrences(trace, "\"name\":\"inner_zone\",\"ph\":\"X\"") == 3);
+    REQUIRE(count_occurrences(trace, "\"args\":{\"id\":2}") == 1);
+    REQUIRE(count_occurrences(trace, "\"name\":\"counter\",\"ph\":\"C\"") == 3);
+    REQUIRE(count_occurrences(trace, "\"name\":\"timer \\\"action\\\"\",\"ph\":\"X\"") == 1);
+    REQUIRE(count_occurrences(trace, "\"name\":\"thread_zone\",\"ph\":\"X\"") == 1);
+    REQUIRE(count_occurrences(trace, "\"ph\":\"M\"") == 2);
+    REQUIRE(trace.find("disabled_zone") == std::string::npos);
+
+    //Once the ring buffer is full the oldest events are dropped
+    vtr::enable_profiling(2);
+    for (int i = 0; i < 5; ++i) {
+        vtr::ProfileZone zone("ring_zone", i);
+    }
+    vtr::disable_profiling();
+    REQUIRE(vtr::write_profile_trace(kTraceFile));
+    trace = read_trace();
+    REQUIRE(count_occurrences(trace, "\"name\":\"ring_zone\"") == 2);
+    REQUIRE(trace.find("\"id\":4") != std::string::npos);
+    REQUIRE(trace.find("\"id\":2") == std::string::npos);
+    REQUIRE(trace.find("outer_zone") == std::string::npos);
+
+    std::remove(kTraceFile);
+}
+
+} // namespace
@@ -14,3 +14,69 @@ TEST_CASE("shuffle", "[vtr_random/shuffle]") {
     std::vector<int> numbers_shuffled_1 = {5, 2, 4, 1, 3};
     REQUIRE(numbers == numbers_shuffled_1);
 }
+
+TEST_CASE("RandomNumberGenerator", "[vtr_random/RandomNumberGenerator]") {
+    SECTION("reference sequence") {
+        //From the PCG32 reference implementation (pcg32-demo)
+        vtr::RandomNumberGenerator rng(42, 54);
+        std::vector<uint32_t> expected = {0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e};
+        for (uint32_t value : expected) {
+            REQUIRE(rng() == value);
+        }
+    }
+
+    SECTION("streams") {
+        vtr::RandomNumberGenerator rng_a(1, 0);
+        vtr::RandomNumberGenerator rng_b(1, 0);
+        vtr::RandomNumberGenerator rng_c(1, 1);
+        int num_same = 0;
+        for (int i = 0; i < 100; ++i) {
+            uint32_t a = rng_a();
+            REQUIRE(a == rng_b());
+            num_same += (a == rng_c());
+        }
+        REQUIRE(num_same < 5);
+
+        rng_a.seed(1, 1);
+        REQUIRE(rng_a() == vtr::RandomNumberGenerator(1, 1)());
+    }
+
+    SECTION("ranges") {
+        vtr::RandomNumberGenerator rng(7);
+        std::vector<int> counts(5, 0);
+        for (int i = 0; i < 10000; ++i) {
+            int ival = rng.irand(4);
+            REQUIRE(ival >= 0);
+            REQUIRE(ival <= 4);
+            ++counts[ival];
+
+            float fval = rng.frand();
+            REQUIRE(fval >= 0.);
+            REQUIRE(fval < 1.);
+        }
+        for (int count : counts) {
+            REQUIRE(count > 1500);
+        }
+        REQUIRE(rng.irand(0) == 0);
+    }
+
+    SECTION("bulk draws") {
+        //Bulk draws match single draws, including the tail which does not fill all lanes
+        vtr::RandomNumberGenerator rng_single(3, 2);
+        vtr::RandomNumberGenerator rng_bulk(3, 2);
+        for (size_t n : {3, 8, 37}) {
+            std::vector<int> ivals(n);
+            rng_bulk.fill_irand(1000, ivals.data(), n);
+            for (int ival : ivals) {
+                REQUIRE(ival == rng_single.irand(1000));
+            }
+
+            std::vector<float> fvals(n);
+            rng_bulk.fill_frand(fvals.data(), n);
+            for (float fval : fvals) {
+                REQUIRE(fval == rng_single.frand());
+            }
+        }
+        REQUIRE(rng_bulk() == rng_single());
+    }
+}
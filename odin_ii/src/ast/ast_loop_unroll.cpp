@@ -49,10 +49,16 @@ ast_node_t* unroll_for_loop(ast_node_t* node, ast_node_t* parent, int* num_unrol
     int this_genblk = 0;
     for (i = 0; i < parent->num_children; i++) {
         if (node == parent->children[i]) {
+            /* make room for all the unrolled children at once, in front of the for node */
+            int num_unrolled_children = unrolled_for->num_children;
+            parent->children = (ast_node_t**)vtr::realloc(parent->children, sizeof(ast_node_t*) * (parent->num_children + num_unrolled_children));
+            memmove(parent->children + i + num_unrolled_children, parent->children + i, sizeof(ast_node_t*) * (parent->num_children - i));
+            parent->num_children += num_unrolled_children;
+
             int j;
-            for (j = i; j < (unrolled_for->num_children + i); j++) {
+            for (j = i; j < (num_unrolled_children + i); j++) {
                 ast_node_t* child = unrolled_for->children[j - i];
-                add_child_to_node_at_index(parent, child, j);
+                parent->children[j] = child;
                 unrolled_for->children[j - i] = NULL;
 
                 /* create scopes as necessary */
@@ -324,9 +330,9 @@ post_condition_function resolve_binary_operation(ast_node_t* node) {
             return value;
         };
     } else {
+        post_condition_function left_func = resolve_binary_operation(node->children[0]);
+        post_condition_function right_func = resolve_binary_operation(node->children[1]);
         return [=](long value) {
-            post_condition_function left_func = resolve_binary_operation(node->children[0]);
-            post_condition_function right_func = resolve_binary_operation(node->children[1]);
             switch (node->types.operation.op) {
                 case ADD:
                     return left_func(value) + right_func(value);
@@ -375,39 +381,30 @@ post_condition_function resolve_post_condition(ast_node_t* assignment, ast_node_
     return resolve_binary_operation(node);
 }
 
-ast_node_t* dup_and_fill_body(ast_node_t* body, ast_node_t* pre, ast_node_t** value, int* error_code) {
-    ast_node_t* copy = ast_node_deep_copy(body);
-    for (long i = 0; i < copy->num_children; i++) {
-        ast_node_t* child = copy->children[i];
+/*
+ *  (function: fill_body)
+ *  replaces the iteration symbol by its value in the children of node, in place
+ */
+static void fill_body(ast_node_t* node, ast_node_t* pre, ast_node_t** value) {
+    for (long i = 0; i < node->num_children; i++) {
+        ast_node_t* child = node->children[i];
         if (child) {
-            bool is_unrolled = false;
-
-            if (child->type == IDENTIFIERS) {
-                if (!strcmp(child->types.identifier, pre->children[0]->types.identifier)) {
-                    ast_node_t* new_num = ast_node_copy(*value);
-                    child = free_whole_tree(child);
-                    copy->children[i] = new_num;
-                }
+            if (child->type == IDENTIFIERS && !strcmp(child->types.identifier, pre->children[0]->types.identifier)) {
+                node->children[i] = ast_node_copy(*value);
+                free_whole_tree(child);
             } else if (child->type == MODULE_INSTANCE && child->children[0]->type != MODULE_INSTANCE) {
                 /* find and replace iteration symbol for port connections and parameters */
-                ast_node_t* named_instance = child->children[0];
-                copy->children[i]->children[0] = dup_and_fill_body(named_instance, pre, value, error_code);
-                free_whole_tree(named_instance);
-
-                is_unrolled = true;
-            }
-
-            if (child && child->num_children > 0) {
-                if (!is_unrolled) {
-                    for (int j = 0; j < copy->children[i]->num_children; j++) {
-                        if (copy->children[i]->children[j] != child->children[j]) free_whole_tree(copy->children[i]->children[j]);
-                    }
-
-                    copy->children[i] = dup_and_fill_body(child, pre, value, error_code);
-                    free_whole_tree(child);
-                }
+                fill_body(child->children[0], pre, value);
+            } else if (child->num_children > 0) {
+                fill_body(child, pre, value);
             }
         }
     }
+}
+
+ast_node_t* dup_and_fill_body(ast_node_t* body, ast_node_t* pre, ast_node_t** value, int* /*error_code*/) {
+    /* the body is copied once, and then filled in place */
+    ast_node_t* copy = ast_node_deep_copy(body);
+    fill_body(copy, pre, value);
     return copy;
 }
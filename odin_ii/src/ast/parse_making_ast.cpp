@@ -45,6 +45,7 @@
 #include "vtr_path.h"
 
 #include "scope_util.h"
+#include "file_prefetcher.h"
 
 //for module
 STRING_CACHE* modules_inputs_sc;
@@ -96,22 +97,24 @@ bool is_valid_identifier(char* str);
  * (function: parse_to_ast)
  *-------------------------------------------------------------------------------------------*/
 void parse_to_ast() {
-    extern void push_include(const char* file_name);
-
-    /* read all the files in the configuration file */
-    my_location.file = configuration.list_of_file_names.size() - 1;
-    int parse_counter = my_location.file;
-
-    while (parse_counter >= 0) {
-        push_include(configuration.list_of_file_names[parse_counter].c_str());
-        parse_counter--;
-    }
-
-    my_location.file = 0;
+    extern void begin_parse_files(const std::vector<std::string>& file_names, file_prefetcher* prefetcher);
+    extern void end_parse_files();
+
+    /**
+     * The files of the configuration file are parsed in order, each opened once the previous one
+     * is parsed, while the prefetcher reads the next ones into memory.
+     *
+     * The files can't be parsed independently: `defines carry over from one file to the next,
+     * and the parser builds the module tables as it goes.
+     */
+    file_prefetcher prefetcher(configuration.list_of_file_names);
+    begin_parse_files(configuration.list_of_file_names, &prefetcher);
 
     /* parse all the files */
     yyparse();
 
+    end_parse_files();
+
     /* verify that the parser did not trigger delayed errors */
     verify_delayed_error(PARSER);
 
@@ -585,6 +585,9 @@ class blif {
          * ---------------------------------------------------------------------------------------------
          */
         void define_decoded_mux(nnode_t* node, FILE* out);
+
+        /* stdio buffer of the output file, it must live until the file is closed */
+        char* output_buffer;
     };
 };
 
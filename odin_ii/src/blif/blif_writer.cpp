@@ -25,6 +25,7 @@
 
 #include <cstring>
 #include <cstdio>
+#include <string>
 
 #include "odin_util.h"
 #include "odin_types.h"
@@ -38,14 +39,33 @@
 #include "vtr_util.h"
 #include "vtr_memory.h"
 
+/* size of the stdio buffer of the output blif file */
+#define BLIF_OUTPUT_BUFFER_SIZE (4 * 1024 * 1024)
+
+/* prints " name", the way the names of a .names/.latch line are separated */
+static inline void print_name(FILE* out, const char* name) {
+    fputc(' ', out);
+    fputs(name, out);
+}
+
 blif::writer::writer()
     : generic_writer() {
+    this->output_buffer = NULL;
 }
 
-blif::writer::~writer() = default;
+blif::writer::~writer() {
+    /* close the file here, the generic writer would flush it after its buffer is gone */
+    if (this->output_file) {
+        fclose(this->output_file);
+        this->output_file = NULL;
+    }
+    vtr::free(this->output_buffer);
+}
 
 inline void blif::writer::_write(const netlist_t* netlist) {
     output_blif(this->output_file, netlist);
+    /* the file stays open until the writer goes, but others may read it before (e.g. the synthesis cache) */
+    fflush(this->output_file);
 }
 
 inline void blif::writer::_create_file(const char* file_name, const file_type_e file_type) {
@@ -122,7 +142,7 @@ void blif::writer::print_net_driver(FILE* out, nnode_t* node, nnet_t* net, long
                         "Net %s driving node %s is itself undriven.",
                         net->name, node->name);
 
-        fprintf(out, " %s", "unconn");
+        print_name(out, "unconn");
     } else if (global_args.high_level_block.provenance() == argparse::Provenance::SPECIFIED
                && driver->node->related_ast_node != NULL) {
         fprintf(out, " %s^^%i-%i",
@@ -131,9 +151,9 @@ void blif::writer::print_net_driver(FILE* out, nnode_t* node, nnet_t* net, long
                 driver->node->related_ast_node->high_number);
     } else {
         if (driver->name != NULL && ((driver->node->type == MULTIPLY) || (driver->node->type == HARD_IP) || (driver->node->type == MEMORY) || (driver->node->type == ADD) || (driver->node->type == MINUS))) {
-            fprintf(out, " %s", driver->name);
+            print_name(out, driver->name);
         } else {
-            fprintf(out, " %s", driver->node->name);
+            print_name(out, driver->node->name);
         }
     }
 }
@@ -152,7 +172,7 @@ void blif::writer::print_input_single_driver(FILE* out, nnode_t* node, long pin_
     oassert(pin_idx < node->num_input_pins);
     nnet_t* net = node->input_pins[pin_idx]->net;
     if (warn_undriven(node, net)) {
-        fprintf(out, " unconn");
+        print_name(out, "unconn");
     } else {
         oassert(net->num_driver_pins == 1);
         print_net_driver(out, node, net, 0);
@@ -177,7 +197,7 @@ void blif::writer::print_output_pin(FILE* out, nnode_t* node) {
                 node->related_ast_node->far_tag,
                 node->related_ast_node->high_number);
     else
-        fprintf(out, " %s", node->name);
+        print_name(out, node->name);
 }
 /**
  * ---------------------------------------------------------------------------------------------
@@ -207,11 +227,11 @@ void blif::writer::print_dot_names_header(FILE* out, nnode_t* node) {
     }
 
     // Print the actual header
-    fprintf(out, ".names");
+    fputs(".names", out);
     for (int i = 0; i < node->num_input_pins; i++) {
         if (names[i]) {
             // Use the implicit buffer we created before
-            fprintf(out, " %s", names[i]);
+            print_name(out, names[i]);
             vtr::free(names[i]);
         } else {
             // Directly use the driver
@@ -222,7 +242,7 @@ void blif::writer::print_dot_names_header(FILE* out, nnode_t* node) {
 
     oassert(node->num_output_pins == 1);
     print_output_pin(out, node);
-    fprintf(out, "\n");
+    fputc('\n', out);
 }
 /**
  * ---------------------------------------------------------------------------------------------
@@ -248,6 +268,12 @@ FILE* blif::writer::create_blif(const char* file_name) {
     if (out == NULL) {
         error_message(NETLIST, unknown_location, "Could not open output file %s\n", file_name);
     }
+
+    /* large netlists are written a name at a time, buffer them in big chunks */
+    if (!this->output_buffer)
+        this->output_buffer = (char*)vtr::malloc(BLIF_OUTPUT_BUFFER_SIZE);
+    setvbuf(out, this->output_buffer, _IOFBF, BLIF_OUTPUT_BUFFER_SIZE);
+
     return out;
 }
 
@@ -543,7 +569,9 @@ void blif::writer::output_node(nnode_t* node, short /*traverse_number*/, FILE* f
  */
 void blif::writer::define_logical_function(nnode_t* node, FILE* out) {
     int i, j;
-    char* temp_string;
+    /* each row of the truth table is built in full and written at once */
+    std::string row(node->num_input_pins, '-');
+    row += " 1\n";
 
     print_dot_names_header(out, node);
 
@@ -551,45 +579,33 @@ void blif::writer::define_logical_function(nnode_t* node, FILE* out) {
     switch (node->type) {
         case LOGICAL_AND: {
             /* generates: 111111 1 */
-            for (i = 0; i < node->num_input_pins; i++) {
-                fprintf(out, "1");
-            }
-            fprintf(out, " 1\n");
+            row.replace(0, node->num_input_pins, node->num_input_pins, '1');
+            fputs(row.c_str(), out);
             break;
         }
         case LOGICAL_OR: {
             /* generates: 1----- 1\n-1----- 1\n ... */
             for (i = 0; i < node->num_input_pins; i++) {
-                for (j = 0; j < node->num_input_pins; j++) {
-                    if (i == j)
-                        fprintf(out, "1");
-                    else
-                        fprintf(out, "-");
-                }
-                fprintf(out, " 1\n");
+                row[i] = '1';
+                fputs(row.c_str(), out);
+                row[i] = '-';
             }
             break;
         }
         case LOGICAL_NAND: {
             /* generates: 0----- 1\n-0----- 1\n ... */
             for (i = 0; i < node->num_input_pins; i++) {
-                for (j = 0; j < node->num_input_pins; j++) {
-                    if (i == j)
-                        fprintf(out, "0");
-                    else
-                        fprintf(out, "-");
-                }
-                fprintf(out, " 1\n");
+                row[i] = '0';
+                fputs(row.c_str(), out);
+                row[i] = '-';
             }
             break;
         }
         case LOGICAL_NOT:
         case LOGICAL_NOR: {
             /* generates: 0000000 1 */
-            for (i = 0; i < node->num_input_pins; i++) {
-                fprintf(out, "0");
-            }
-            fprintf(out, " 1\n");
+            row.replace(0, node->num_input_pins, node->num_input_pins, '0');
+            fputs(row.c_str(), out);
             break;
         }
         case LOGICAL_EQUAL:
@@ -598,10 +614,10 @@ void blif::writer::define_logical_function(nnode_t* node, FILE* out) {
             /* generates: a 1 when odd number of 1s */
             for (i = 0; i < my_power(2, node->num_input_pins); i++) {
                 if ((i % 8 == 1) || (i % 8 == 2) || (i % 8 == 4) || (i % 8 == 7)) {
-                    temp_string = convert_long_to_bit_string(i, node->num_input_pins);
-                    fprintf(out, "%s", temp_string);
-                    vtr::free(temp_string);
-                    fprintf(out, " 1\n");
+                    /* msb to lsb */
+                    for (j = 0; j < node->num_input_pins; j++)
+                        row[node->num_input_pins - 1 - j] = ((i >> j) & 1) ? '1' : '0';
+                    fputs(row.c_str(), out);
                 }
             }
             break;
@@ -611,10 +627,10 @@ void blif::writer::define_logical_function(nnode_t* node, FILE* out) {
             oassert(node->num_input_pins <= 3);
             for (i = 0; i < my_power(2, node->num_input_pins); i++) {
                 if ((i % 8 == 0) || (i % 8 == 3) || (i % 8 == 5) || (i % 8 == 6)) {
-                    temp_string = convert_long_to_bit_string(i, node->num_input_pins);
-                    fprintf(out, "%s", temp_string);
-                    vtr::free(temp_string);
-                    fprintf(out, " 1\n");
+                    /* msb to lsb */
+                    for (j = 0; j < node->num_input_pins; j++)
+                        row[node->num_input_pins - 1 - j] = ((i >> j) & 1) ? '1' : '0';
+                    fputs(row.c_str(), out);
                 }
             }
             break;
@@ -624,7 +640,7 @@ void blif::writer::define_logical_function(nnode_t* node, FILE* out) {
             break;
     }
 
-    fprintf(out, "\n");
+    fputc('\n', out);
 }
 
 /** 
@@ -703,7 +719,7 @@ void blif::writer::define_ff(nnode_t* node, FILE* out) {
     print_output_pin(out, node);
 
     /* sensitivity */
-    fprintf(out, " %s", clk_edge_type_str);
+    print_name(out, clk_edge_type_str);
 
     /* clock */
     print_input_single_driver(out, node, 1);
@@ -727,19 +743,21 @@ void blif::writer::define_decoded_mux(nnode_t* node, FILE* out) {
     print_dot_names_header(out, node);
 
     /* generates: 1----- 1\n-1----- 1\n ... */
+    std::string row(node->num_input_pins, '-');
+    row += " 1\n";
     for (long i = 0; i < node->input_port_sizes[0]; i++) {
         for (long j = 0; j < node->num_input_pins; j++) {
             if (i == j)
-                fprintf(out, "1");
+                row[j] = '1';
             else if (i + node->input_port_sizes[0] == j)
-                fprintf(out, "1");
+                row[j] = '1';
             else if (i > node->input_port_sizes[0])
-                fprintf(out, "0");
+                row[j] = '0';
             else
-                fprintf(out, "-");
+                row[j] = '-';
         }
-        fprintf(out, " 1\n");
+        fputs(row.c_str(), out);
     }
 
-    fprintf(out, "\n");
+    fputc('\n', out);
 }
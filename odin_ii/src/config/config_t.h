@@ -68,6 +68,8 @@ struct config_t {
     // defines if the first cin of an adder/subtractor is connected to a global gnd/vdd
     // or generated using a dummy adder with both inputs set to gnd/vdd
     bool adder_cin_global;
+    // merge the structurally equivalent logic after partial mapping
+    bool strash;
 
     // If the memory is smaller than both of these, it will be converted to soft logic.
     int soft_logic_memory_depth_threshold;
@@ -52,6 +52,7 @@
 #include "hard_soft_logic_mixer.h"
 #include "generic_reader.h"
 #include "blif.h"
+#include "synthesis_cache.h"
 
 #include "vtr_error.h"
 #include "vtr_util.h"
@@ -168,6 +169,10 @@ static void techmap() {
         partial_map_top(syn_netlist);
         mixer->perform_optimizations(syn_netlist);
 
+        /* Merge the structurally equivalent logic, the duplicates are then removed as unused logic */
+        if (configuration.strash)
+            merge_equivalent_logic(syn_netlist);
+
         /* Find any unused logic in the netlist and remove it */
         remove_unused_logic(syn_netlist);
     }
@@ -207,12 +212,26 @@ static void output() {
     }
 }
 
-static ODIN_ERROR_CODE synthesize() {
+static ODIN_ERROR_CODE synthesize(int argc, char** argv) {
     double synthesis_time = wall_time();
 
     printf("--------------------------------------------------------------------\n");
     printf("High-level Synthesis Begin\n");
 
+    /* reuse the blif of a previous run if none of its inputs changed (not with -H, which renames the output) */
+    std::string cache_key;
+    if (global_args.synthesis_cache.provenance() == argparse::Provenance::SPECIFIED
+        && configuration.output_file_type == file_type_e::BLIF
+        && global_args.high_level_block.provenance() != argparse::Provenance::SPECIFIED) {
+        cache_key = synthesis_cache_key(argc, argv);
+        if (synthesis_cache_fetch(global_args.synthesis_cache, cache_key, global_args.output_file)) {
+            printf("Synthesis cache hit, the netlist is reused from %s\n", global_args.synthesis_cache.value().c_str());
+            printf("\tBLIF file available at %s\n", global_args.output_file.value().c_str());
+            printf("--------------------------------------------------------------------\n");
+            return SUCCESS;
+        }
+    }
+
     /* Performing elaboration for input digital circuits */
     try {
         elaborate();
@@ -251,6 +270,10 @@ static ODIN_ERROR_CODE synthesize() {
         exit(ERROR_OUTPUT);
     }
 
+    if (!cache_key.empty()) {
+        synthesis_cache_store(global_args.synthesis_cache, cache_key, global_args.output_file);
+    }
+
     printf("\nTotal Synthesis Time: ");
     print_time(synthesis_time);
     printf("\n--------------------------------------------------------------------\n");
@@ -329,7 +352,7 @@ netlist_t* start_odin_ii(int argc, char** argv) {
 
         if (configuration.input_file_type != file_type_e::BLIF) {
             try {
-                error_code = synthesize();
+                error_code = synthesize(argc, argv);
                 printf("odin_ii synthesis has finished with code: %d\n", error_code);
             } catch (vtr::VtrError& vtr_error) {
                 printf("Odin Failed to Synthesis for the file: %s with exit code:%d \n", vtr_error.what(), ERROR_SYNTHESIS);
@@ -522,6 +545,15 @@ void get_options(int argc, char** argv) {
         .default_value("false")
         .action(argparse::Action::STORE_TRUE);
 
+    other_grp.add_argument(global_args.strash, "--strash")
+        .help("Merge the structurally equivalent logic gates (same type, driven by the same nets) after partial mapping")
+        .default_value("false")
+        .action(argparse::Action::STORE_TRUE);
+
+    other_grp.add_argument(global_args.synthesis_cache, "--synthesis_cache")
+        .help("Directory of a cache of the synthesized netlists. The netlist is reused if the command line, the configuration and architecture files and all the verilog files read are unchanged")
+        .metavar("CACHE_DIRECTORY");
+
     other_grp.add_argument(global_args.top_level_module_name, "--top_module")
         .help("Allow to overwrite the top level module that odin would use")
         .metavar("TOP_LEVEL_MODULE_NAME");
@@ -566,6 +598,11 @@ void get_options(int argc, char** argv) {
         .help("File of predefined output vectors to check against simulation")
         .metavar("OUTPUT_VECTOR_FILE");
 
+    vec_sim_grp.add_argument(global_args.sim_binary_vectors, "--binary_vectors")
+        .help("Write the input and output vectors in a packed binary format instead of text (vector files of either format can be read)")
+        .default_value("false")
+        .action(argparse::Action::STORE_TRUE);
+
     auto& other_sim_grp = parser.add_argument_group("other simulation options");
 
     other_sim_grp.add_argument(global_args.parralelized_simulation, "-j")
@@ -708,6 +745,10 @@ void get_options(int argc, char** argv) {
         configuration.adder_cin_global = global_args.adder_cin_global;
     }
 
+    if (global_args.strash.provenance() == argparse::Provenance::SPECIFIED) {
+        configuration.strash = global_args.strash;
+    }
+
     if (global_args.print_parse_tokens.provenance() == argparse::Provenance::SPECIFIED) {
         configuration.print_parse_tokens = global_args.print_parse_tokens;
     }
@@ -761,6 +802,7 @@ void set_default_config() {
     configuration.split_memory_depth = 0;
 
     configuration.adder_cin_global = false;
+    configuration.strash = false;
 
     /*
      * Soft logic cutoffs. If a memory or a memory resulting from a split
@@ -25,9 +25,15 @@
 
 #include <cstdio>
 #include <cmath>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "odin_types.h"
 #include "odin_globals.h"
+#include "netlist_utils.h"
+#include "netlist_cleanup.h"
 
 #include "vtr_util.h"
 #include "vtr_memory.h"
@@ -65,6 +71,7 @@ void calculate_addsub_statistics(node_list_t* addsub);
 void remove_unused_logic(netlist_t* netlist);
 void count_node_type(nnode_t* node);
 void report_removed_nodes(long long* node_list);
+void merge_equivalent_logic(netlist_t* netlist);
 
 node_list_t* insert_node_list(node_list_t* node_list, nnode_t* node) {
     node_list->node = node;
@@ -316,6 +323,163 @@ void report_removed_nodes(long long* node_list) {
     }
 }
 
+/* Structural hashing key of a node: its type, port sizes and the nets driving its inputs */
+typedef std::vector<uintptr_t> strash_key_t;
+
+struct strash_key_hash {
+    size_t operator()(const strash_key_t& key) const {
+        size_t hash = key.size();
+        for (uintptr_t value : key)
+            hash ^= std::hash<uintptr_t>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+/* Returns true if the outputs of this type of node only depend on the values of its inputs,
+ * and sets is_commutative if they do not depend on the order of its inputs either */
+static bool is_strashable_type(operation_list type, bool* is_commutative) {
+    switch (type) {
+        case LOGICAL_AND:   //fallthrough
+        case LOGICAL_OR:    //fallthrough
+        case LOGICAL_NAND:  //fallthrough
+        case LOGICAL_NOR:   //fallthrough
+        case LOGICAL_XOR:   //fallthrough
+        case LOGICAL_XNOR:  //fallthrough
+        case LOGICAL_EQUAL: //fallthrough
+        case NOT_EQUAL:     //fallthrough
+        case ADDER_FUNC:    //fallthrough
+        case CARRY_FUNC:    //fallthrough
+            *is_commutative = true;
+            return true;
+
+        case LOGICAL_NOT: //fallthrough
+        case BITWISE_NOT: //fallthrough
+        case BUF_NODE:    //fallthrough
+        case MUX_2:       //fallthrough
+        case SMUX_2:      //fallthrough
+        case GT:          //fallthrough
+        case LT:          //fallthrough
+            *is_commutative = false;
+            return true;
+
+        default:
+            /* flip-flops, memories and hard blocks have state or attributes of their own */
+            return false;
+    }
+}
+
+/* Builds the structural hashing key of node, returns false if the node can't be merged */
+static bool make_strash_key(nnode_t* node, strash_key_t& key) {
+    bool is_commutative = false;
+    if (!is_strashable_type(node->type, &is_commutative) || node->num_output_pins < 1)
+        return false;
+
+    for (int i = 0; i < node->num_output_pins; i++) {
+        if (!node->output_pins[i] || !node->output_pins[i]->net || node->output_pins[i]->net->num_driver_pins != 1)
+            return false;
+    }
+
+    std::vector<uintptr_t> input_nets;
+    for (int i = 0; i < node->num_input_pins; i++) {
+        npin_t* input_pin = node->input_pins[i];
+        if (!input_pin || !input_pin->net || input_pin->net->num_driver_pins != 1)
+            return false;
+        input_nets.push_back((uintptr_t)input_pin->net);
+    }
+    if (is_commutative)
+        std::sort(input_nets.begin(), input_nets.end());
+
+    key.clear();
+    key.push_back(node->type);
+    key.push_back(node->num_output_pins);
+    key.push_back(node->num_input_port_sizes);
+    for (int i = 0; i < node->num_input_port_sizes; i++)
+        key.push_back(node->input_port_sizes[i]);
+    key.insert(key.end(), input_nets.begin(), input_nets.end());
+    return true;
+}
+
+/* Returns the nodes driving the top level outputs, with the drivers of each node before it */
+static std::vector<nnode_t*> get_nodes_in_topological_order(netlist_t* netlist) {
+    struct frame_t {
+        nnode_t* node;
+        long input_pin;
+        int driver_pin;
+    };
+
+    std::vector<nnode_t*> order;
+    std::unordered_set<nnode_t*> visited;
+    std::vector<frame_t> stack;
+
+    for (int i = 0; i < netlist->num_top_output_nodes; i++) {
+        if (!visited.insert(netlist->top_output_nodes[i]).second)
+            continue;
+
+        stack.push_back({netlist->top_output_nodes[i], 0, 0});
+        while (!stack.empty()) {
+            frame_t& frame = stack.back();
+
+            /* look for the next driver of this node which is yet to be visited */
+            nnode_t* next_node = NULL;
+            while (!next_node && frame.input_pin < frame.node->num_input_pins) {
+                npin_t* input_pin = frame.node->input_pins[frame.input_pin];
+                nnet_t* net = (input_pin) ? input_pin->net : NULL;
+                if (net && frame.driver_pin < net->num_driver_pins) {
+                    npin_t* driver_pin = net->driver_pins[frame.driver_pin++];
+                    if (driver_pin && driver_pin->node && visited.insert(driver_pin->node).second)
+                        next_node = driver_pin->node;
+                } else {
+                    frame.input_pin++;
+                    frame.driver_pin = 0;
+                }
+            }
+
+            if (next_node) {
+                stack.push_back({next_node, 0, 0});
+            } else {
+                order.push_back(frame.node);
+                stack.pop_back();
+            }
+        }
+    }
+
+    return order;
+}
+
+/* Structural hashing: merges the combinational nodes which have the same type and are driven by the same nets,
+ * by moving the fanouts of the duplicates onto the first such node. The duplicates are left without fanout,
+ * for remove_unused_logic to remove. Nodes are visited drivers first, so that merging the drivers of
+ * two nodes makes them merge in turn. */
+void merge_equivalent_logic(netlist_t* netlist) {
+    std::unordered_map<strash_key_t, nnode_t*, strash_key_hash> unique_nodes;
+    strash_key_t key;
+    long num_merged_nodes = 0;
+
+    for (nnode_t* node : get_nodes_in_topological_order(netlist)) {
+        if (!make_strash_key(node, key))
+            continue;
+
+        auto inserted = unique_nodes.emplace(key, node);
+        if (inserted.second)
+            continue;
+
+        nnode_t* equivalent_node = inserted.first->second;
+        for (int i = 0; i < node->num_output_pins; i++) {
+            nnet_t* net = node->output_pins[i]->net;
+            nnet_t* equivalent_net = equivalent_node->output_pins[i]->net;
+            for (int j = 0; j < net->num_fanout_pins; j++) {
+                if (net->fanout_pins[j])
+                    add_fanout_pin_to_net(equivalent_net, net->fanout_pins[j]);
+                net->fanout_pins[j] = NULL;
+            }
+            net->num_fanout_pins = 0;
+        }
+        num_merged_nodes++;
+    }
+
+    printf("Structural hashing merged %ld node(s)\n", num_merged_nodes);
+}
+
 /* Perform the backwards and forward sweeps and remove the unused nodes */
 void remove_unused_logic(netlist_t* netlist) {
     mark_output_dependencies(netlist);
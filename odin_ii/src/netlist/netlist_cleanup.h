@@ -27,5 +27,6 @@
 #define NETLIST_CLEANUP_H
 
 void remove_unused_logic(netlist_t* netlist);
+void merge_equivalent_logic(netlist_t* netlist);
 
 #endif
@@ -25,6 +25,8 @@
 
 #include <cstring>
 #include <cstdlib>
+#include <algorithm>
+#include <vector>
 
 #include "odin_types.h"
 #include "odin_globals.h"
@@ -34,11 +36,69 @@
 #include "vtr_util.h"
 #include "vtr_memory.h"
 
+/*---------------------------------------------------------------------------------------------
+ * (class: netlist_object_pool)
+ * 	Slabs of nodes, pins or nets: objects are handed out zeroed from large blocks, and the freed
+ * 	ones are kept for reuse, instead of going to the allocator one object at a time. The blocks
+ * 	are all released at once when the last netlist is freed.
+ *-------------------------------------------------------------------------------------------*/
+template<typename T>
+class netlist_object_pool {
+  public:
+    T* allocate() {
+        T* object;
+        if (free_objects) {
+            object = (T*)free_objects;
+            free_objects = free_objects->next;
+        } else {
+            if (slabs.empty() || num_used == SLAB_SIZE) {
+                slabs.push_back((T*)vtr::malloc(SLAB_SIZE * sizeof(T)));
+                num_used = 0;
+            }
+            object = &slabs.back()[num_used++];
+        }
+        memset((void*)object, 0, sizeof(T));
+        return (T*)my_mark_struct(object);
+    }
+
+    T* release(T* object) {
+        if (object) {
+            free_object_t* free_object = (free_object_t*)object;
+            free_object->next = free_objects;
+            free_objects = free_object;
+        }
+        return NULL;
+    }
+
+    void release_all() {
+        for (T* slab : slabs)
+            vtr::free(slab);
+        slabs.clear();
+        num_used = 0;
+        free_objects = NULL;
+    }
+
+  private:
+    struct free_object_t {
+        free_object_t* next;
+    };
+    static constexpr size_t SLAB_SIZE = 4096;
+
+    std::vector<T*> slabs;
+    size_t num_used = 0;
+    free_object_t* free_objects = NULL;
+};
+
+static netlist_object_pool<nnode_t> nnode_pool;
+static netlist_object_pool<npin_t> npin_pool;
+static netlist_object_pool<nnet_t> nnet_pool;
+static int num_allocated_netlists = 0;
+
 /*---------------------------------------------------------------------------------------------
  * (function: allocate_nnode)
  *-------------------------------------------------------------------------------------------*/
 nnode_t* allocate_nnode(loc_t loc) {
-    nnode_t* new_node = (nnode_t*)my_malloc_struct(sizeof(nnode_t));
+    nnode_t* new_node = nnode_pool.allocate();
 
     new_node->loc = loc;
     new_node->name = NULL;
@@ -102,7 +162,7 @@ nnode_t* free_nnode(nnode_t* to_free) {
                 vtr::free(to_free->input_pins[i]->name);
                 to_free->input_pins[i]->name = NULL;
             }
-            to_free->input_pins[i] = (npin_t*)vtr::free(to_free->input_pins[i]);
+            to_free->input_pins[i] = npin_pool.release(to_free->input_pins[i]);
         }
 
         to_free->input_pins = (npin_t**)vtr::free(to_free->input_pins);
@@ -112,7 +172,7 @@ nnode_t* free_nnode(nnode_t* to_free) {
                 vtr::free(to_free->output_pins[i]->name);
                 to_free->output_pins[i]->name = NULL;
             }
-            to_free->output_pins[i] = (npin_t*)vtr::free(to_free->output_pins[i]);
+            to_free->output_pins[i] = npin_pool.release(to_free->output_pins[i]);
         }
 
         to_free->output_pins = (npin_t**)vtr::free(to_free->output_pins);
@@ -130,7 +190,7 @@ nnode_t* free_nnode(nnode_t* to_free) {
 
         /* now free the node */
     }
-    return (nnode_t*)vtr::free(to_free);
+    return nnode_pool.release(to_free);
 }
 
 /*-------------------------------------------------------------------------
@@ -195,7 +255,7 @@ void add_input_port_information(nnode_t* node, int port_width) {
 npin_t* allocate_npin() {
     npin_t* new_pin;
 
-    new_pin = (npin_t*)my_malloc_struct(sizeof(npin_t));
+    new_pin = npin_pool.allocate();
 
     new_pin->name = NULL;
     new_pin->type = NO_ID;
@@ -232,7 +292,7 @@ npin_t* free_npin(npin_t* to_free) {
 
         /* now free the pin */
     }
-    return (npin_t*)vtr::free(to_free);
+    return npin_pool.release(to_free);
 }
 
 /*-------------------------------------------------------------------------
@@ -282,7 +342,7 @@ npin_t* copy_input_npin(npin_t* copy_pin) {
  * (function: allocate_nnet)
  *-------------------------------------------------------------------------------------------*/
 nnet_t* allocate_nnet() {
-    nnet_t* new_net = (nnet_t*)my_malloc_struct(sizeof(nnet_t));
+    nnet_t* new_net = nnet_pool.allocate();
 
     new_net->name = NULL;
     new_net->driver_pins = NULL;
@@ -314,7 +374,7 @@ nnet_t* free_nnet(nnet_t* to_free) {
 
         /* now free the net */
     }
-    return (nnet_t*)vtr::free(to_free);
+    return nnet_pool.release(to_free);
 }
 
 /*---------------------------------------------------------------------------
@@ -377,8 +437,10 @@ void add_fanout_pin_to_net(nnet_t* net, npin_t* pin) {
     oassert(net != NULL);
     oassert(pin != NULL);
     oassert(pin->type != OUTPUT);
-    /* assumes the pin spots have been allocated and the pin */
-    net->fanout_pins = (npin_t**)vtr::realloc(net->fanout_pins, sizeof(npin_t*) * (net->num_fanout_pins + 1));
+    /* the fanout list doubles in size whenever it is full, i.e. when its size is a power of 2 (0, 1, 2, 4 ...),
+     * since large nets (clocks, constants, resets) get their fanouts one at a time */
+    if ((net->num_fanout_pins & (net->num_fanout_pins - 1)) == 0)
+        net->fanout_pins = (npin_t**)vtr::realloc(net->fanout_pins, sizeof(npin_t*) * std::max(2 * net->num_fanout_pins, 1));
     net->fanout_pins[net->num_fanout_pins] = pin;
     net->num_fanout_pins++;
     /* record the node and pin spot in the pin */
@@ -1095,6 +1157,7 @@ netlist_t* allocate_netlist() {
     netlist_t* new_netlist;
 
     new_netlist = (netlist_t*)my_malloc_struct(sizeof(netlist_t));
+    num_allocated_netlists++;
 
     new_netlist->gnd_node = NULL;
     new_netlist->vcc_node = NULL;
@@ -1144,6 +1207,14 @@ void free_netlist(netlist_t* to_free) {
     sc_free_string_cache(to_free->nets_sc);
     sc_free_string_cache(to_free->out_pins_sc);
     sc_free_string_cache(to_free->nodes_sc);
+
+    /* the nodes, pins and nets are released in bulk once no netlist uses them */
+    num_allocated_netlists--;
+    if (num_allocated_netlists == 0) {
+        nnode_pool.release_all();
+        npin_pool.release_all();
+        nnet_pool.release_all();
+    }
 }
 
 /*
@@ -30,8 +30,14 @@
 #include <sstream>
 #include <dlfcn.h>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
 
 #include "simulate_blif.h"
+#include "vector_io.h"
 #include "odin_buffer.h"
 #include "odin_util.h"
 
@@ -127,6 +133,9 @@ static int is_node_complete(nnode_t* node, int cycle);
 static bool pin_is_driver(npin_t* pin, nnet_t* net);
 
 static bool compute_and_store_value(nnode_t* node, int cycle);
+static void update_node_coverage(nnode_t* node, operation_list type, int cycle);
+static void compile_stages(stages_t* s);
+static sim_schedule_t* schedule_stages(stages_t* s, int num_workers);
 static void compute_memory_node(nnode_t* node, int cycle);
 static void compute_hard_ip_node(nnode_t* node, int cycle);
 static void compute_generic_node(nnode_t* node, int cycle);
@@ -151,16 +160,13 @@ static char* get_mif_filename(nnode_t* node);
 static void assign_memory_from_mif_file(nnode_t* node, const char* filename, int width, long address_width);
 static int parse_mif_radix(std::string radix);
 
-static int count_test_vectors(FILE* in);
-static int count_empty_test_vectors(FILE* in);
-
-static int is_vector(char* buffer);
-static int get_next_vector(FILE* file, char* buffer);
+static bool read_vector_header(vector_file_reader* in, char* buffer);
+static test_vector* read_test_vector(vector_file_reader* in, char* buffer);
 static test_vector* parse_test_vector(char* buffer);
 static test_vector* generate_random_test_vector(int cycle, sim_data_t* sim_data);
 static int compare_test_vectors(test_vector* v1, test_vector* v2);
 
-static int verify_test_vector_headers(FILE* in, lines_t* l);
+static int verify_test_vector_headers(vector_file_reader* in, lines_t* l);
 static void free_test_vector(test_vector* v);
 
 static line_t* create_line(char* name);
@@ -175,10 +181,8 @@ static void assign_node_to_line(nnode_t* node, lines_t* l, int type, int single_
 static void insert_pin_into_line(npin_t* pin, int pin_number, line_t* line, int type);
 
 static char* generate_vector_header(lines_t* l);
-static void write_vector_headers(FILE* file, lines_t* l);
 
-static void write_vector_to_file(lines_t* l, FILE* file, int cycle);
-static void write_cycle_to_file(lines_t* l, FILE* file, int cycle);
+static void write_cycle_to_file(lines_t* l, vector_file_writer* file, int cycle);
 
 static void write_vector_to_modelsim_file(lines_t* l, FILE* modelsim_out, int cycle);
 static void write_cycle_to_modelsim_file(netlist_t* netlist, lines_t* l, FILE* modelsim_out, int cycle);
@@ -213,7 +217,8 @@ void simulate_netlist(netlist_t* netlist) {
 
     simulate_steps(sim_data, min_coverage);
 
-    fflush(sim_data->out);
+    sim_data->in_out->finish();
+    sim_data->out->finish();
     fprintf(sim_data->modelsim_out, "run %ld\n", sim_data->num_vectors * 100);
 
     printf("\n");
@@ -251,15 +256,15 @@ sim_data_t* init_simulation(netlist_t* netlist) {
     // Open the output vector file.
     char out_vec_file[BUFFER_MAX_SIZE] = {0};
     odin_sprintf(out_vec_file, "%s/%s", global_args.sim_directory.value().c_str(), OUTPUT_VECTOR_FILE_NAME);
-    sim_data->out = fopen(out_vec_file, "w");
-    if (!sim_data->out)
+    sim_data->out = new vector_file_writer(out_vec_file, global_args.sim_binary_vectors);
+    if (!sim_data->out->is_open())
         error_message(SIMULATION, unknown_location, "%s\n", "Could not create output vector file.");
 
     // Open the input vector file.
     char in_vec_file[BUFFER_MAX_SIZE] = {0};
     odin_sprintf(in_vec_file, "%s/%s", global_args.sim_directory.value().c_str(), INPUT_VECTOR_FILE_NAME);
-    sim_data->in_out = fopen(in_vec_file, "w+");
-    if (!sim_data->in_out)
+    sim_data->in_out = new vector_file_writer(in_vec_file, global_args.sim_binary_vectors);
+    if (!sim_data->in_out->is_open())
         error_message(SIMULATION, unknown_location, "%s\n", "Could not create input vector file.");
 
     // Open the activity output file.
@@ -291,13 +296,13 @@ sim_data_t* init_simulation(netlist_t* netlist) {
     // if we expect no lines on input, then don't read the input file and generate as many input test vector as there are output
     // vectors so that simulation can run
     if (global_args.sim_vector_input_file.provenance() == argparse::Provenance::SPECIFIED) {
-        sim_data->in = fopen(global_args.sim_vector_input_file.value().c_str(), "r");
-        if (!sim_data->in)
+        sim_data->in = new vector_file_reader(global_args.sim_vector_input_file.value().c_str());
+        if (!sim_data->in->is_open())
             error_message(SIMULATION, unknown_location, "Could not open vector input file: %s", global_args.sim_vector_input_file.value().c_str());
     }
 
     if (sim_data->in && sim_data->input_lines->count != 0) {
-        sim_data->num_vectors = count_test_vectors(sim_data->in);
+        sim_data->num_vectors = sim_data->in->count_vectors();
 
         // Read the vector headers and check to make sure they match the lines.
         if (!verify_test_vector_headers(sim_data->in, sim_data->input_lines))
@@ -309,7 +314,7 @@ sim_data_t* init_simulation(netlist_t* netlist) {
     // or be randomly generated. Passed via the -g option. it also serve as a fallback when we have an empty input
     else {
         if (sim_data->in) {
-            sim_data->num_vectors = count_empty_test_vectors(sim_data->in);
+            sim_data->num_vectors = sim_data->in->count_lines();
         } else {
             sim_data->num_vectors = global_args.sim_num_test_vectors;
         }
@@ -342,11 +347,10 @@ sim_data_t* terminate_simulation(sim_data_t* sim_data) {
     free_lines(sim_data->input_lines);
 
     fclose(sim_data->modelsim_out);
-    fclose(sim_data->in_out);
-    if (sim_data->in)
-        fclose(sim_data->in);
+    delete sim_data->in_out;
+    delete sim_data->in;
 
-    fclose(sim_data->out);
+    delete sim_data->out;
     vtr::free(sim_data);
     sim_data = NULL;
     return sim_data;
@@ -424,10 +428,9 @@ int single_step(sim_data_t* sim_data, int cycle) {
     if (sim_data->in) {
         char buffer[BUFFER_MAX_SIZE];
 
-        if (!get_next_vector(sim_data->in, buffer))
+        v = read_test_vector(sim_data->in, buffer);
+        if (!v)
             error_message(SIMULATION, unknown_location, "%s\n", "Could not read next vector.");
-
-        v = parse_test_vector(buffer);
     } else {
         v = generate_random_test_vector(cycle, sim_data);
     }
@@ -460,49 +463,444 @@ int single_step(sim_data_t* sim_data, int cycle) {
  * This simulates a single cycle using the stages generated
  * during the first cycle.
  *
- * simulation computes a small number of cycles sequentially and
- * a small number in parallel. The minimum parallel and sequential time is
- * taken for each stage, and that stage is computed in parallel for all subsequent
- * cycles if speedup is observed.
+ * The stages are compiled after the first cycle: the common single bit
+ * logic nodes become instructions with their function resolved once (a
+ * packed truth table for small generic LUTs), and the other nodes are
+ * computed by compute_and_store_value() as before. When parallelized, the
+ * stages are shared between persistent threads which wait at a barrier
+ * between the stages: large stages are split into chunks of similar
+ * estimated cost which the threads take in turn, and runs of small stages
+ * are computed inline by the calling thread.
+ */
+
+enum sim_opcode_t {
+    SIM_OP_NODE, // not compiled, computed by compute_and_store_value()
+    SIM_OP_BUF,
+    SIM_OP_NOT,
+    SIM_OP_AND,
+    SIM_OP_NAND,
+    SIM_OP_OR,
+    SIM_OP_NOR,
+    SIM_OP_XOR,
+    SIM_OP_XNOR,
+    SIM_OP_SUM,
+    SIM_OP_CARRY,
+    SIM_OP_LUT
+};
+
+/* The largest generic node compiled to a truth table, which then fits in 64 bits. */
+#define SIM_MAX_LUT_SIZE 6
+
+/* The estimated cost of the nodes not compiled, relative to compiled ones with the same number of pins. */
+#define SIM_INTERPRETED_NODE_COST 8
+/* Stages with a smaller estimated cost are not worth splitting between threads. */
+#define SIM_MIN_PARALLEL_STAGE_COST 512
+/* The number of chunks each parallel stage is split into, per thread. */
+#define SIM_CHUNKS_PER_WORKER 4
+
+struct sim_instruction_t {
+    sim_opcode_t opcode;
+    nnode_t* node;
+    npin_t** inputs;
+    int num_inputs;
+    npin_t* output;
+    uint64_t truth_table; // SIM_OP_LUT: bit i is the output when input j has the value of bit j of i
+};
+
+/*
+ * Threads started once for the whole simulation. Each cycle runs one job
+ * on all the workers, the calling thread being the last one.
  */
+class sim_worker_pool {
+  public:
+    explicit sim_worker_pool(int num_workers)
+        : num_workers(num_workers) {
+        for (int id = 0; id < num_workers - 1; id++)
+            threads.push_back(std::thread(&sim_worker_pool::worker_loop, this, id));
+    }
 
-static void compute_and_store_part(int start, int end, int current_stage, stages_t* s, int cycle) {
-    for (int j = start; j >= 0 && j <= end && j < s->counts[current_stage]; j++)
-        if (s->stages[current_stage][j])
-            compute_and_store_value(s->stages[current_stage][j], cycle);
+    ~sim_worker_pool() {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+        job_ready.notify_all();
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    int size() const {
+        return num_workers;
+    }
+
+    /* Runs job(id) for every worker id, and returns once they have all finished. */
+    void run(const std::function<void(int)>& new_job) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            job = &new_job;
+            job_generation++;
+            num_running = threads.size();
+        }
+        job_ready.notify_all();
+
+        new_job(num_workers - 1);
+
+        std::unique_lock<std::mutex> guard(lock);
+        job_done.wait(guard, [&] { return num_running == 0; });
+    }
+
+    /* Waits until all the workers of the current job have reached the barrier. */
+    void barrier() {
+        long generation = barrier_generation.load(std::memory_order_acquire);
+        if (barrier_count.fetch_add(1, std::memory_order_acq_rel) + 1 == num_workers) {
+            barrier_count.store(0, std::memory_order_relaxed);
+            barrier_generation.fetch_add(1, std::memory_order_release);
+        } else {
+            while (barrier_generation.load(std::memory_order_acquire) == generation)
+                std::this_thread::yield();
+        }
+    }
+
+  private:
+    void worker_loop(int id) {
+        long seen_generation = 0;
+        while (true) {
+            const std::function<void(int)>* current_job;
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                job_ready.wait(guard, [&] { return stopping || job_generation != seen_generation; });
+                if (stopping)
+                    return;
+                seen_generation = job_generation;
+                current_job = job;
+            }
+
+            (*current_job)(id);
+
+            std::lock_guard<std::mutex> guard(lock);
+            if (--num_running == 0)
+                job_done.notify_one();
+        }
+    }
+
+    int num_workers;
+    std::vector<std::thread> threads;
+
+    std::mutex lock;
+    std::condition_variable job_ready;
+    std::condition_variable job_done;
+    const std::function<void(int)>* job = NULL;
+    long job_generation = 0;
+    int num_running = 0;
+    bool stopping = false;
+
+    std::atomic<int> barrier_count{0};
+    std::atomic<long> barrier_generation{0};
+};
+
+/*
+ * A step of the parallel simulation of a cycle: either a stage split in
+ * chunks, or consecutive small stages computed by a single thread.
+ */
+struct sim_step_t {
+    int first_stage;
+    int end_stage;
+    bool parallel;
+    std::vector<int> chunk_ends; // The end of each chunk of the nodes of first_stage, if parallel
+};
+
+struct sim_schedule_t {
+    std::vector<sim_step_t> steps;
+    std::unique_ptr<std::atomic<int>[]> next_chunks; // The next chunk to be taken, per step
+    bool parallel;                                    // Whether any step is split between the threads
+};
+
+/*
+ * Returns the truth table of a generic node whose inputs are all known.
+ */
+static uint64_t compile_generic_truth_table(nnode_t* node, int lut_size) {
+    uint64_t truth_table = 0;
+    for (int index = 0; index < (1 << lut_size); index++) {
+        bool found = false;
+        for (int i = 0; i < node->bit_map_line_count && !found; i++) {
+            int j;
+            for (j = 0; j < lut_size; j++)
+                if ((node->bit_map[i][j] != '-') && (node->bit_map[i][j] - '0' != ((index >> j) & 1)))
+                    break;
+
+            found = (j == lut_size);
+        }
+
+        if (found == (node->generic_output == BitSpace::_1))
+            truth_table |= (uint64_t)1 << index;
+    }
+    return truth_table;
 }
 
-static void simulate_cycle(int cycle, stages_t* s) {
-    double total_run_time = 0;
+/*
+ * Resolves the function computed by the given node.
+ */
+static sim_instruction_t compile_node(nnode_t* node) {
+    sim_instruction_t instruction;
+    instruction.opcode = SIM_OP_NODE;
+    instruction.node = node;
+    instruction.inputs = node->input_pins;
+    instruction.num_inputs = node->num_input_pins;
+    instruction.output = (node->num_output_pins == 1) ? node->output_pins[0] : NULL;
+    instruction.truth_table = 0;
+
+    // Only single output nodes with inputs are compiled, the others keep their checks and special cases.
+    if (is_clock_node(node) || !instruction.output || node->num_input_pins < 1 || node->num_undriven_pins)
+        return instruction;
+
+    switch (node->type) {
+        case BUF_NODE:
+            instruction.opcode = SIM_OP_BUF;
+            break;
+        case BITWISE_NOT:
+            instruction.opcode = SIM_OP_NOT;
+            break;
+        case LOGICAL_AND:
+            instruction.opcode = SIM_OP_AND;
+            break;
+        case LOGICAL_NAND:
+            instruction.opcode = SIM_OP_NAND;
+            break;
+        case LOGICAL_OR:
+            instruction.opcode = SIM_OP_OR;
+            break;
+        case LOGICAL_NOT:
+        case LOGICAL_NOR:
+            instruction.opcode = SIM_OP_NOR;
+            break;
+        case NOT_EQUAL:
+        case LOGICAL_XOR:
+            instruction.opcode = SIM_OP_XOR;
+            break;
+        case LOGICAL_EQUAL:
+        case LOGICAL_XNOR:
+            instruction.opcode = SIM_OP_XNOR;
+            break;
+        case ADDER_FUNC:
+            if (node->num_input_pins == 3)
+                instruction.opcode = SIM_OP_SUM;
+            break;
+        case CARRY_FUNC:
+            if (node->num_input_pins == 3)
+                instruction.opcode = SIM_OP_CARRY;
+            break;
+        case GENERIC: {
+            int lut_size = 0;
+            while (node->bit_map[0][lut_size] != 0)
+                lut_size++;
+
+            if (lut_size <= SIM_MAX_LUT_SIZE && lut_size <= node->num_input_pins) {
+                instruction.opcode = SIM_OP_LUT;
+                instruction.num_inputs = lut_size;
+                instruction.truth_table = compile_generic_truth_table(node, lut_size);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return instruction;
+}
+
+/*
+ * Estimates the cost of computing an instruction, in pin values read and written.
+ */
+static long estimate_instruction_cost(const sim_instruction_t* instruction) {
+    nnode_t* node = instruction->node;
+    if (!node)
+        return 0;
+
+    if (instruction->opcode == SIM_OP_NODE)
+        return SIM_INTERPRETED_NODE_COST * (1 + node->num_input_pins + node->num_output_pins);
+
+    return 1 + instruction->num_inputs + 1;
+}
+
+/*
+ * Shares the compiled stages between the given number of threads.
+ */
+static sim_schedule_t* schedule_stages(stages_t* s, int num_workers) {
+    sim_schedule_t* schedule = new sim_schedule_t;
+    schedule->parallel = false;
+
     for (int i = 0; i < s->count; i++) {
-        double time = wall_time();
+        long stage_cost = 0;
+        for (int j = 0; j < s->counts[i]; j++)
+            stage_cost += estimate_instruction_cost(&s->programs[i][j]);
 
-        std::vector<std::thread> workers;
-        int previous_end = 0;
+        if (stage_cost < SIM_MIN_PARALLEL_STAGE_COST) {
+            if (schedule->steps.empty() || schedule->steps.back().parallel)
+                schedule->steps.push_back({i, i + 1, false, {}});
+            else
+                schedule->steps.back().end_stage = i + 1;
+            continue;
+        }
+
+        sim_step_t step = {i, i + 1, true, {}};
+        long chunk_cost = std::max(stage_cost / (num_workers * SIM_CHUNKS_PER_WORKER), 1L);
+        long cost = 0;
+        for (int j = 0; j < s->counts[i]; j++) {
+            cost += estimate_instruction_cost(&s->programs[i][j]);
+            if (cost >= chunk_cost) {
+                step.chunk_ends.push_back(j + 1);
+                cost = 0;
+            }
+        }
+        if (step.chunk_ends.empty() || step.chunk_ends.back() != s->counts[i])
+            step.chunk_ends.push_back(s->counts[i]);
 
-        int nodes_per_thread = s->counts[i] / number_of_workers;
-        int remainder_nodes_per_thread = s->counts[i] % number_of_workers;
+        schedule->steps.push_back(step);
+        schedule->parallel = true;
+    }
 
-        for (int id = 0; id < number_of_workers; id++) {
-            int start = previous_end;
-            int end = start + nodes_per_thread + ((remainder_nodes_per_thread > 0) ? 1 : 0);
+    schedule->next_chunks.reset(new std::atomic<int>[schedule->steps.size()]);
+    return schedule;
+}
 
-            remainder_nodes_per_thread -= 1;
-            previous_end = end + 1;
+/*
+ * Compiles the nodes of every stage.
+ */
+static void compile_stages(stages_t* s) {
+    s->programs = (sim_instruction_t**)vtr::calloc(s->count, sizeof(sim_instruction_t*));
 
-            if ((end - start) > 0) {
-                if (id < number_of_workers - 1) // if child threads
-                    workers.push_back(std::thread(compute_and_store_part, start, end, i, s, cycle));
-                else
-                    compute_and_store_part(start, end, i, s, cycle);
+    int num_compiled = 0;
+    for (int i = 0; i < s->count; i++) {
+        s->programs[i] = (sim_instruction_t*)vtr::calloc(s->counts[i] + 1, sizeof(sim_instruction_t));
+        for (int j = 0; j < s->counts[i]; j++) {
+            if (s->stages[i][j]) {
+                s->programs[i][j] = compile_node(s->stages[i][j]);
+                num_compiled += (s->programs[i][j].opcode != SIM_OP_NODE);
+            }
+        }
+    }
+
+    s->num_compiled_nodes = num_compiled;
+
+    if (number_of_workers > 1) {
+        s->schedule = schedule_stages(s, number_of_workers);
+        if (s->schedule->parallel)
+            s->workers = new sim_worker_pool(number_of_workers);
+    }
+}
+
+/*
+ * Reduces the inputs of an instruction with the given operator.
+ */
+static BitSpace::bit_value_t reduce_inputs(const sim_instruction_t* instruction, const BitSpace::bit_value_t lut[4][4], int cycle) {
+    BitSpace::bit_value_t value = get_pin_value(instruction->inputs[instruction->num_inputs - 1], cycle);
+    for (int i = instruction->num_inputs - 2; i >= 0; i--)
+        value = lut[value][get_pin_value(instruction->inputs[i], cycle)];
+    return value;
+}
+
+/*
+ * Computes the given instruction for the given cycle.
+ */
+static void compute_instruction(const sim_instruction_t* instruction, int cycle) {
+    BitSpace::bit_value_t value;
+    switch (instruction->opcode) {
+        case SIM_OP_BUF:
+            value = BitSpace::l_buf[get_pin_value(instruction->inputs[0], cycle)];
+            break;
+        case SIM_OP_NOT:
+            value = BitSpace::l_not[get_pin_value(instruction->inputs[0], cycle)];
+            break;
+        case SIM_OP_AND:
+            value = reduce_inputs(instruction, BitSpace::l_and, cycle);
+            break;
+        case SIM_OP_NAND:
+            value = BitSpace::l_not[reduce_inputs(instruction, BitSpace::l_and, cycle)];
+            break;
+        case SIM_OP_OR:
+            value = reduce_inputs(instruction, BitSpace::l_or, cycle);
+            break;
+        case SIM_OP_NOR:
+            value = BitSpace::l_not[reduce_inputs(instruction, BitSpace::l_or, cycle)];
+            break;
+        case SIM_OP_XOR:
+            value = reduce_inputs(instruction, BitSpace::l_xor, cycle);
+            break;
+        case SIM_OP_XNOR:
+            value = BitSpace::l_not[reduce_inputs(instruction, BitSpace::l_xor, cycle)];
+            break;
+        case SIM_OP_SUM:
+            value = BitSpace::l_sum[get_pin_value(instruction->inputs[0], cycle)]
+                                   [get_pin_value(instruction->inputs[1], cycle)]
+                                   [get_pin_value(instruction->inputs[2], cycle)];
+            break;
+        case SIM_OP_CARRY:
+            value = BitSpace::l_carry[get_pin_value(instruction->inputs[0], cycle)]
+                                     [get_pin_value(instruction->inputs[1], cycle)]
+                                     [get_pin_value(instruction->inputs[2], cycle)];
+            break;
+        case SIM_OP_LUT: {
+            int index = 0;
+            for (int i = 0; i < instruction->num_inputs; i++) {
+                BitSpace::bit_value_t input = get_pin_value(instruction->inputs[i], cycle);
+                // Unknown inputs depend on the order of the bit map lines.
+                if (BitSpace::is_unk[input]) {
+                    compute_and_store_value(instruction->node, cycle);
+                    return;
+                }
+                index |= input << i;
             }
+            value = ((instruction->truth_table >> index) & 1) ? BitSpace::_1 : BitSpace::_0;
+            break;
         }
+        case SIM_OP_NODE:
+        default:
+            compute_and_store_value(instruction->node, cycle);
+            return;
+    }
+
+    update_pin_value(instruction->output, value, cycle);
+    update_node_coverage(instruction->node, instruction->node->type, cycle);
+}
 
-        for (auto& worker : workers)
-            worker.join();
+static void compute_and_store_part(int start, int end, int current_stage, stages_t* s, int cycle) {
+    for (int j = start; j < end; j++)
+        if (s->stages[current_stage][j])
+            compute_instruction(&s->programs[current_stage][j], cycle);
+}
 
-        total_run_time += wall_time() - time;
+static void simulate_cycle(int cycle, stages_t* s) {
+    if (!s->workers) {
+        for (int i = 0; i < s->count; i++)
+            compute_and_store_part(0, s->counts[i], i, s, cycle);
+        return;
     }
+
+    sim_schedule_t* schedule = s->schedule;
+    int num_steps = schedule->steps.size();
+    for (int k = 0; k < num_steps; k++)
+        schedule->next_chunks[k].store(0, std::memory_order_relaxed);
+
+    s->workers->run([&](int id) {
+        for (int k = 0; k < num_steps; k++) {
+            const sim_step_t& step = schedule->steps[k];
+            if (step.parallel) {
+                int num_chunks = step.chunk_ends.size();
+                for (int chunk = schedule->next_chunks[k].fetch_add(1, std::memory_order_relaxed); chunk < num_chunks;
+                     chunk = schedule->next_chunks[k].fetch_add(1, std::memory_order_relaxed)) {
+                    int start = chunk ? step.chunk_ends[chunk - 1] : 0;
+                    compute_and_store_part(start, step.chunk_ends[chunk], step.first_stage, s, cycle);
+                }
+            } else if (id == s->workers->size() - 1) {
+                // Small stages are computed by the calling thread alone.
+                for (int i = step.first_stage; i < step.end_stage; i++)
+                    compute_and_store_part(0, s->counts[i], i, s, cycle);
+            }
+
+            // The next step reads the outputs of this one.
+            if (k < num_steps - 1)
+                s->workers->barrier();
+        }
+    });
 }
 
 /*
@@ -667,6 +1065,8 @@ static stages_t* simulate_first_cycle(netlist_t* netlist, int cycle, lines_t* l)
     stages_t* s = stage_ordered_nodes(ordered_nodes, num_ordered_nodes);
     vtr::free(ordered_nodes);
 
+    compile_stages(s);
+
     return s;
 }
 
@@ -685,6 +1085,10 @@ static stages_t* stage_ordered_nodes(nnode_t** ordered_nodes, int num_ordered_no
     s->worker_const = 1;
     s->worker_temp = 0;
     s->times = __DBL_MAX__;
+    s->programs = NULL;
+    s->workers = NULL;
+    s->schedule = NULL;
+    s->num_compiled_nodes = 0;
 
     // Hash tables index the nodes in the current stage, as well as their children.
     std::unordered_set<nnode_t*> stage_children = std::unordered_set<nnode_t*>();
@@ -1081,6 +1485,18 @@ static bool compute_and_store_value(nnode_t* node, int cycle) {
             break;
     }
 
+    update_node_coverage(node, type, cycle);
+
+    //computation_time = wall_time() - computation_time;
+
+    //printf("Node %s typeof %ld spent %lf\n",node->name,type,computation_time);
+    return true;
+}
+
+/*
+ * Counts the toggles of the outputs of a node for coverage estimation.
+ */
+static void update_node_coverage(nnode_t* node, operation_list type, int cycle) {
     // Count number of ones and toggles for coverage estimation
     bool covered = true;
     bool skip_node_from_coverage = (type == INPUT_NODE || type == CLOCK_NODE || type == GND_NODE || type == VCC_NODE || type == PAD_NODE);
@@ -1100,11 +1516,6 @@ static bool compute_and_store_value(nnode_t* node, int cycle) {
     }
 
     node->covered = (covered || skip_node_from_coverage);
-
-    //computation_time = wall_time() - computation_time;
-
-    //printf("Node %s typeof %ld spent %lf\n",node->name,type,computation_time);
-    return true;
 }
 
 /*
@@ -2112,27 +2523,19 @@ static lines_t* create_lines(netlist_t* netlist, int type) {
  * Creates a vector file header from the given lines,
  * and writes it to the given file.
  */
-static void write_vector_headers(FILE* file, lines_t* l) {
-    char* headers = generate_vector_header(l);
-    fprintf(file, "%s", headers);
-    vtr::free(headers);
-    fflush(file);
-}
-
 /*
  * Parses the first line of the given file and compares it to the
  * given lines for identity. If there is any difference, a warning is printed,
  * and false is returned. If there are no differences, the file pointer is left
  * at the start of the second line, and true is returned.
  */
-static int verify_test_vector_headers(FILE* in, lines_t* l) {
+static int verify_test_vector_headers(vector_file_reader* in, lines_t* l) {
     int current_line = 0;
     int buffer_length = 0;
 
     // Read the header from the vector file.
     char read_buffer[BUFFER_MAX_SIZE];
-    rewind(in);
-    if (!get_next_vector(in, read_buffer))
+    if (!read_vector_header(in, read_buffer))
         error_message(SIMULATION, unknown_location, "%s\n", "Failed to read vector headers.");
 
     // Parse the header, checking each entity against the corresponding line.
@@ -2312,6 +2715,61 @@ static int compare_test_vectors(test_vector* v1, test_vector* v2) {
     return equivalent;
 }
 
+/*
+ * Reads the header line of the given file, from its start.
+ */
+static bool read_vector_header(vector_file_reader* in, char* buffer) {
+    in->rewind();
+    if (!in->is_binary())
+        return in->next_line(buffer, BUFFER_MAX_SIZE);
+
+    odin_sprintf(buffer, "%.*s", BUFFER_MAX_SIZE - 1, in->get_header().c_str());
+    return true;
+}
+
+/*
+ * Reads the next vector of the given file. The line of text
+ * files, or the values of binary ones, is copied to buffer for messages.
+ * Returns NULL if there are no more vectors.
+ */
+static test_vector* read_test_vector(vector_file_reader* in, char* buffer) {
+    if (!in->is_binary()) {
+        if (!in->next_line(buffer, BUFFER_MAX_SIZE))
+            return NULL;
+
+        return parse_test_vector(buffer);
+    }
+
+    std::vector<BitSpace::bit_value_t> values;
+    if (!in->next_record(values))
+        return NULL;
+
+    test_vector* v = (test_vector*)vtr::malloc(sizeof(test_vector));
+    const std::vector<int>& widths = in->get_line_widths();
+    v->count = widths.size();
+    v->values = (BitSpace::bit_value_t**)vtr::malloc(sizeof(BitSpace::bit_value_t*) * (v->count + 1));
+    v->counts = (int*)vtr::malloc(sizeof(int) * (v->count + 1));
+
+    std::string text;
+    size_t offset = 0;
+    for (int i = 0; i < v->count; i++) {
+        v->counts[i] = widths[i];
+        v->values[i] = (BitSpace::bit_value_t*)vtr::malloc(sizeof(BitSpace::bit_value_t) * (widths[i] + 1));
+        for (int j = 0; j < widths[i]; j++)
+            v->values[i][j] = values[offset + j];
+
+        for (int j = widths[i] - 1; j >= 0; j--)
+            text += BitSpace::is_unk[values[offset + j]] ? 'x' : (char)('0' + values[offset + j]);
+        text += ' ';
+
+        offset += widths[i];
+    }
+    text += '\n';
+    odin_sprintf(buffer, "%.*s", BUFFER_MAX_SIZE - 1, text.c_str());
+
+    return v;
+}
+
 /*
  * Parses the given line from a test vector file into a
  * test_vector data structure.
@@ -2474,65 +2932,24 @@ static test_vector* generate_random_test_vector(int cycle, sim_data_t* sim_data)
  * prior to cycle 0.
  *
  */
-static void write_cycle_to_file(lines_t* l, FILE* file, int cycle) {
-    if (!cycle)
-        write_vector_headers(file, l);
-
-    write_vector_to_file(l, file, cycle);
-}
-
-/*
- * Writes all values in the given lines to a line in the given file
- * for the given cycle.
- */
-static void write_vector_to_file(lines_t* l, FILE* file, int cycle) {
-    std::stringstream buffer;
-    int i;
-
-    for (i = 0; i < l->count; i++) {
-        buffer.str(std::string());
-        line_t* line = l->lines[i];
-        int num_pins = line->number_of_pins;
-
-        if (line_has_unknown_pin(line, cycle) || num_pins == 1) {
-            int j;
-            for (j = num_pins - 1; j >= 0; j--) {
-                BitSpace::bit_value_t value = get_line_pin_value(line, j, cycle);
-
-                if (BitSpace::is_unk[value]) {
-                    buffer << "x";
-                } else {
-                    buffer << std::dec << (int)value;
-                }
-            }
-            // If there are no known values, print a single capital X.
-            // (Only for testing. Breaks machine readability.)
-            //if (!known_values && num_pins > 1)
-            //	odin_sprintf(buffer, "X");
-        } else {
-            buffer << "0X";
-
-            int hex_digit = 0;
-            int j;
-            for (j = num_pins - 1; j >= 0; j--) {
-                BitSpace::bit_value_t value = get_line_pin_value(line, j, cycle);
-
-                hex_digit += value << j % 4;
-
-                if (!(j % 4)) {
-                    buffer << std::hex << hex_digit;
-                    hex_digit = 0;
-                }
-            }
+static void write_cycle_to_file(lines_t* l, vector_file_writer* file, int cycle) {
+    if (!cycle) {
+        std::vector<std::string> names;
+        std::vector<int> widths;
+        for (int i = 0; i < l->count; i++) {
+            names.push_back(l->lines[i]->name);
+            widths.push_back(l->lines[i]->number_of_pins);
         }
-        buffer << " ";
-        // Expand the value to fill to space under the header. (Gets ugly sometimes.)
-        //while (strlen(buffer) < strlen(l->lines[i]->name))
-        //	strcat(buffer," ");
-
-        fprintf(file, "%s", buffer.str().c_str());
+        file->write_header(names, widths);
     }
-    fprintf(file, "\n");
+
+    // The values are formatted and written by the writer's thread.
+    std::vector<BitSpace::bit_value_t> values;
+    for (int i = 0; i < l->count; i++)
+        for (int j = 0; j < l->lines[i]->number_of_pins; j++)
+            values.push_back(get_line_pin_value(l->lines[i], j, cycle));
+
+    file->write_vector(std::move(values));
 }
 
 /*
@@ -2618,81 +3035,87 @@ static int verify_output_vectors(const char* output_vector_file, int num_vectors
                         output_vector_file, OUTPUT_VECTOR_FILE_NAME);
     } else {
         // The file being verified against.
-        FILE* existing_out = fopen(output_vector_file, "r");
-        if (!existing_out) error_message(SIMULATION, unknown_location, "Could not open vector output file: %s", output_vector_file);
+        vector_file_reader existing_out(output_vector_file);
+        if (!existing_out.is_open()) error_message(SIMULATION, unknown_location, "Could not open vector output file: %s", output_vector_file);
 
         // Our current output vectors. (Just produced.)
         char out_vec_file[BUFFER_MAX_SIZE] = {0};
         odin_sprintf(out_vec_file, "%s/%s", global_args.sim_directory.value().c_str(), OUTPUT_VECTOR_FILE_NAME);
-        FILE* current_out = fopen(out_vec_file, "r");
-        if (!current_out)
+        vector_file_reader current_out(out_vec_file);
+        if (!current_out.is_open())
             error_message(SIMULATION, unknown_location, "Could not open output vector file: %s", out_vec_file);
 
-        int cycle;
         char buffer1[BUFFER_MAX_SIZE];
         char buffer2[BUFFER_MAX_SIZE];
-        // Start at cycle -1 to check the headers.
-        for (cycle = -1; cycle < num_vectors; cycle++) {
-            if (!get_next_vector(existing_out, buffer1)) {
+        // Check the headers first.
+        if (!read_vector_header(&existing_out, buffer1)) {
+            error = true;
+            warning_message(SIMULATION, unknown_location, "Too few vectors in %s \n", output_vector_file);
+        } else if (!read_vector_header(&current_out, buffer2)) {
+            error = true;
+            warning_message(SIMULATION, unknown_location, "Simulation produced fewer than %d vectors. \n", num_vectors);
+        } else if (!output_vector_headers_equal(buffer1, buffer2)) {
+            error = true;
+            warning_message(SIMULATION, unknown_location,
+                            "Vector headers do not match: \n"
+                            "\t%s"
+                            "in %s does not match\n"
+                            "\t%s"
+                            "in %s.\n\n",
+                            buffer2, OUTPUT_VECTOR_FILE_NAME, buffer1, output_vector_file);
+        }
+
+        int cycle;
+        for (cycle = 0; !error && cycle < num_vectors; cycle++) {
+            // Parse both vectors.
+            test_vector* v1 = read_test_vector(&existing_out, buffer1);
+            if (!v1) {
                 error = true;
                 warning_message(SIMULATION, unknown_location, "Too few vectors in %s \n", output_vector_file);
                 break;
-            } else if (!get_next_vector(current_out, buffer2)) {
+            }
+
+            test_vector* v2 = read_test_vector(&current_out, buffer2);
+            if (!v2) {
+                free_test_vector(v1);
                 error = true;
                 warning_message(SIMULATION, unknown_location, "Simulation produced fewer than %d vectors. \n", num_vectors);
                 break;
             }
-            // The headers differ.
-            else if ((cycle == -1) && !output_vector_headers_equal(buffer1, buffer2)) {
-                error = true;
-                warning_message(SIMULATION, unknown_location,
-                                "Vector headers do not match: \n"
-                                "\t%s"
-                                "in %s does not match\n"
-                                "\t%s"
-                                "in %s.\n\n",
-                                buffer2, OUTPUT_VECTOR_FILE_NAME, buffer1, output_vector_file);
-                break;
-            } else {
-                // Parse both vectors.
-                test_vector* v1 = parse_test_vector(buffer1);
-                test_vector* v2 = parse_test_vector(buffer2);
-
-                int equivalent = compare_test_vectors(v1, v2);
-                // Compare them and print an appropriate message if they differ.
 
-                if (!equivalent) {
-                    trim_string(buffer1, "\n\t");
-                    trim_string(buffer2, "\n\t");
-                    error = true;
-                    warning_message(SIMULATION, unknown_location,
-                                    "Vector %d mismatch:\n"
-                                    "\t%s in %s\n"
-                                    "\t%s in %s\n",
-                                    cycle, buffer2, OUTPUT_VECTOR_FILE_NAME, buffer1, output_vector_file);
-                } else if (equivalent == -1) {
-                    trim_string(buffer1, "\n\t");
-                    trim_string(buffer2, "\n\t");
-                    warning_message(SIMULATION, unknown_location,
-                                    "Vector %d equivalent but output vector has bits set when expecting don't care :\n"
-                                    "\t%s in %s\n"
-                                    "\t%s in %s\n",
-                                    cycle, buffer2, OUTPUT_VECTOR_FILE_NAME, buffer1, output_vector_file);
-                }
+            int equivalent = compare_test_vectors(v1, v2);
+            // Compare them and print an appropriate message if they differ.
 
-                free_test_vector(v1);
-                free_test_vector(v2);
+            if (!equivalent) {
+                trim_string(buffer1, "\n\t");
+                trim_string(buffer2, "\n\t");
+                error = true;
+                warning_message(SIMULATION, unknown_location,
+                                "Vector %d mismatch:\n"
+                                "\t%s in %s\n"
+                                "\t%s in %s\n",
+                                cycle, buffer2, OUTPUT_VECTOR_FILE_NAME, buffer1, output_vector_file);
+            } else if (equivalent == -1) {
+                trim_string(buffer1, "\n\t");
+                trim_string(buffer2, "\n\t");
+                warning_message(SIMULATION, unknown_location,
+                                "Vector %d equivalent but output vector has bits set when expecting don't care :\n"
+                                "\t%s in %s\n"
+                                "\t%s in %s\n",
+                                cycle, buffer2, OUTPUT_VECTOR_FILE_NAME, buffer1, output_vector_file);
             }
+
+            free_test_vector(v1);
+            free_test_vector(v2);
         }
 
         // If the file we're checking against is longer than the current output, print an appropriate warning.
-        if (!error && get_next_vector(existing_out, buffer1)) {
+        test_vector* extra_vector = error ? NULL : read_test_vector(&existing_out, buffer1);
+        if (extra_vector) {
+            free_test_vector(extra_vector);
             error = true;
             warning_message(SIMULATION, unknown_location, "%s contains more than %d vectors.\n", output_vector_file, num_vectors);
         }
-
-        fclose(existing_out);
-        fclose(current_out);
     }
     return !error;
 }
@@ -2812,81 +3235,6 @@ BitSpace::bit_value_t get_line_pin_value(line_t* line, int pin_num, int cycle) {
     return get_pin_value(line->pins[pin_num], cycle);
 }
 
-/*
- * Counts the number of vectors in the given file.
- */
-static int count_test_vectors(FILE* in) {
-    rewind(in);
-
-    int count = 0;
-    char buffer[BUFFER_MAX_SIZE];
-    while (get_next_vector(in, buffer))
-        count++;
-
-    if (count) // Don't count the headers.
-        count--;
-
-    rewind(in);
-
-    return count;
-}
-
-/*
- * Counts the number of vectors in the given file.
- */
-static int count_empty_test_vectors(FILE* in) {
-    rewind(in);
-
-    int count = 0;
-    int buffer;
-    while ((buffer = getc(in)) != EOF)
-        if (((char)buffer) == '\n')
-            count++;
-
-    if (count) // Don't count the headers.
-        count--;
-
-    rewind(in);
-
-    return count;
-}
-
-/*
- * A given line is a vector if it contains one or more
- * non-whitespace characters and does not being with a #.
- */
-static int is_vector(char* buffer) {
-    char* line = vtr::strdup(buffer);
-    trim_string(line, " \t\r\n");
-
-    if (line[0] != '#' && strlen(line)) {
-        vtr::free(line);
-        return true;
-    } else {
-        vtr::free(line);
-        return false;
-    }
-}
-
-/*
- * Gets the next line from the given file that
- * passes the is_vector() test and places it in
- * the buffer. Returns true if a vector was found,
- * and false if no vector was found.
- */
-static int get_next_vector(FILE* file, char* buffer) {
-    oassert(file != NULL
-            && "unable to retrieve file for next test vector");
-    oassert(buffer != NULL
-            && "unable to use buffer for next test vector as it is not initialized");
-
-    while (fgets(buffer, BUFFER_MAX_SIZE, file))
-        if (is_vector(buffer))
-            return true;
-
-    return false;
-}
-
 /*
  * Free each element in lines[] and the array itself
  */
@@ -2916,8 +3264,17 @@ static void free_lines(lines_t* l) {
  */
 static void free_stages(stages_t* s) {
     if (s) {
+        delete s->workers;
+        delete s->schedule;
+
         vtr::free(s->num_children);
 
+        if (s->programs) {
+            for (int i = 0; i < s->count; i++)
+                vtr::free(s->programs[i]);
+            vtr::free(s->programs);
+        }
+
         if (s->stages) {
             while (s->count--) {
                 if (s->stages[s->count])
@@ -2964,6 +3321,7 @@ static void print_netlist_stats(stages_t* stages, int /*num_vectors*/) {
     printf("  Threads:         %d\n", number_of_workers);
     printf("  Degree:          %3.2f\n", stages->num_connections / (float)stages->num_nodes);
     printf("  Stages:          %d\n", stages->count);
+    printf("  Compiled nodes:  %d\n", stages->num_compiled_nodes);
     printf("  Nodes/thread:    %d(%4.2f%%)\n", (stages->num_nodes / number_of_workers), 100.0 / (double)number_of_workers);
     printf("\n");
 }
@@ -71,13 +71,27 @@ struct lines_t {
     int count;
 };
 
+class vector_file_reader;
+class vector_file_writer;
+
+struct sim_instruction_t;
+struct sim_schedule_t;
+class sim_worker_pool;
+
 struct stages_t {
     nnode_t*** stages; // Stages.
     int* counts;       // Number of nodes in each stage.
     int count;         // Number of stages.
 
+    // The compiled stages, one instruction per node, simulated after the first cycle.
+    sim_instruction_t** programs;
+    // The persistent threads simulating the stages when parallelized, and how they share them, or NULL.
+    sim_worker_pool* workers;
+    sim_schedule_t* schedule;
+
     // Statistics.
     int num_nodes;           // The total number of nodes.
+    int num_compiled_nodes;  // The number of nodes compiled to instructions.
     int num_connections;     // The sum of the number of children found under every node.
     int* num_children;       // Number of children per stage.
     double avg_worker_count; // The raio of node to be computed in parallel.
@@ -115,11 +129,11 @@ struct sim_data_t {
     // Create and verify the lines.
     lines_t* input_lines;
     lines_t* output_lines;
-    FILE* out;
-    FILE* in_out;
+    vector_file_writer* out;
+    vector_file_writer* in_out;
     FILE* act_out;
     FILE* modelsim_out;
-    FILE* in = NULL;
+    vector_file_reader* in = NULL;
     long num_vectors;
 
     double total_time;      // Includes I/O
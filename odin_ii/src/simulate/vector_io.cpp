@@ -0,0 +1,385 @@
+/*
+ * Copyright 2023 CAS—Atlantic (University of New Brunswick, CASA)
+ * 
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "vector_io.h"
+#include "simulate_blif.h"
+
+#include <cstring>
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "odin_error.h"
+
+/* The most vectors queued for the formatter before the simulation waits for it. */
+#define MAX_QUEUED_VECTORS 4096
+
+static uint64_t read_little_endian(const char* data, int num_bytes) {
+    uint64_t value = 0;
+    for (int i = num_bytes - 1; i >= 0; i--)
+        value = (value << 8) | (unsigned char)data[i];
+    return value;
+}
+
+static void append_little_endian(std::string& out, uint64_t value, int num_bytes) {
+    for (int i = 0; i < num_bytes; i++)
+        out += (char)((value >> (8 * i)) & 0xFF);
+}
+
+static size_t get_record_size(size_t num_pins) {
+    return (num_pins * 2 + 7) / 8;
+}
+
+vector_file_reader::vector_file_reader(const char* file_name)
+    : data(NULL)
+    , size(0)
+    , position(0)
+    , binary(false)
+    , records_start(0)
+    , record_size(0)
+    , num_pins(0)
+    , num_records(0) {
+    int fd = open(file_name, O_RDONLY);
+    if (fd < 0)
+        return;
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == 0) {
+        size = file_stat.st_size;
+        if (size) {
+            void* mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                data = (const char*)mapped;
+                madvise(mapped, size, MADV_SEQUENTIAL);
+            }
+        } else {
+            // Empty files have nothing to map, but are still open.
+            data = "";
+        }
+    }
+    close(fd);
+
+    if (!data) {
+        size = 0;
+        return;
+    }
+
+    binary = size >= BINARY_VECTOR_MAGIC_SIZE && !memcmp(data, BINARY_VECTOR_MAGIC, BINARY_VECTOR_MAGIC_SIZE);
+    if (binary)
+        parse_binary_header();
+
+    rewind();
+}
+
+vector_file_reader::~vector_file_reader() {
+    if (data && size)
+        munmap((void*)data, size);
+}
+
+bool vector_file_reader::is_open() const {
+    return data != NULL;
+}
+
+bool vector_file_reader::is_binary() const {
+    return binary;
+}
+
+void vector_file_reader::parse_binary_header() {
+    size_t offset = BINARY_VECTOR_MAGIC_SIZE;
+    if (offset + 12 > size)
+        error_message(SIMULATION, unknown_location, "%s", "Truncated binary vector header.");
+
+    size_t num_lines = read_little_endian(data + offset, 4);
+    num_records = read_little_endian(data + offset + 4, 8);
+    offset += 12;
+
+    for (size_t i = 0; i < num_lines; i++) {
+        if (offset + 8 > size)
+            error_message(SIMULATION, unknown_location, "%s", "Truncated binary vector header.");
+
+        int width = read_little_endian(data + offset, 4);
+        size_t name_length = read_little_endian(data + offset + 4, 4);
+        offset += 8;
+
+        if (offset + name_length > size)
+            error_message(SIMULATION, unknown_location, "%s", "Truncated binary vector header.");
+
+        line_names.push_back(std::string(data + offset, name_length));
+        line_widths.push_back(width);
+        num_pins += width;
+        offset += name_length;
+    }
+
+    records_start = offset;
+    record_size = get_record_size(num_pins);
+    if (records_start + num_records * record_size > size)
+        error_message(SIMULATION, unknown_location, "Binary vector file holds fewer than the %ld vectors in its header.", num_records);
+}
+
+void vector_file_reader::rewind() {
+    position = binary ? records_start : 0;
+}
+
+bool vector_file_reader::next_line(char* buffer, size_t buffer_size) {
+    while (position < size) {
+        // Copy up to and including the newline, or as much as fits.
+        const char* line = data + position;
+        const char* newline = (const char*)memchr(line, '\n', size - position);
+        size_t length = newline ? (size_t)(newline - line) + 1 : size - position;
+        if (length > buffer_size - 1)
+            length = buffer_size - 1;
+
+        memcpy(buffer, line, length);
+        buffer[length] = '\0';
+        position += length;
+
+        // Vectors are the lines which are not blank once the end of line is trimmed, and not comments.
+        size_t end = length;
+        while (end && strchr(" \t\r\n", buffer[end - 1]))
+            end--;
+        if (end && buffer[0] != '#')
+            return true;
+    }
+    return false;
+}
+
+long vector_file_reader::count_vectors() {
+    long count = num_records;
+    if (!binary) {
+        rewind();
+
+        char buffer[BUFFER_MAX_SIZE];
+        count = 0;
+        while (next_line(buffer, BUFFER_MAX_SIZE))
+            count++;
+
+        if (count) // Don't count the headers.
+            count--;
+    }
+    rewind();
+    return count;
+}
+
+long vector_file_reader::count_lines() {
+    long count = num_records;
+    if (!binary) {
+        count = 0;
+        for (const char* next = data; (next = (const char*)memchr(next, '\n', size - (next - data))); next++)
+            count++;
+
+        if (count) // Don't count the headers.
+            count--;
+    }
+    rewind();
+    return count;
+}
+
+std::string vector_file_reader::get_header() const {
+    std::string header;
+    for (size_t i = 0; i < line_names.size(); i++) {
+        header += line_names[i];
+        header += (i + 1 < line_names.size()) ? ' ' : '\n';
+    }
+    if (header.empty())
+        header = "\n";
+    return header;
+}
+
+const std::vector<int>& vector_file_reader::get_line_widths() const {
+    return line_widths;
+}
+
+bool vector_file_reader::next_record(std::vector<BitSpace::bit_value_t>& values) {
+    if (!binary || position + record_size > records_start + num_records * record_size)
+        return false;
+
+    values.resize(num_pins);
+    const unsigned char* record = (const unsigned char*)(data + position);
+    for (size_t i = 0; i < num_pins; i++)
+        values[i] = (record[i / 4] >> (2 * (i % 4))) & 0x3;
+
+    position += record_size;
+    return true;
+}
+
+vector_file_writer::vector_file_writer(const char* file_name, bool binary)
+    : file(fopen(file_name, binary ? "wb" : "w"))
+    , binary(binary)
+    , num_vectors(0)
+    , formatting(false)
+    , stopping(false) {
+    if (file)
+        formatter = std::thread(&vector_file_writer::format_loop, this);
+}
+
+vector_file_writer::~vector_file_writer() {
+    if (!file)
+        return;
+
+    finish();
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    queued.notify_one();
+    formatter.join();
+
+    fclose(file);
+}
+
+bool vector_file_writer::is_open() const {
+    return file != NULL;
+}
+
+void vector_file_writer::write_header(const std::vector<std::string>& names, const std::vector<int>& widths) {
+    line_widths = widths;
+
+    std::string header;
+    if (binary) {
+        header.append(BINARY_VECTOR_MAGIC, BINARY_VECTOR_MAGIC_SIZE);
+        append_little_endian(header, names.size(), 4);
+        // The number of vectors is only known once they are all written.
+        append_little_endian(header, 0, 8);
+        for (size_t i = 0; i < names.size(); i++) {
+            append_little_endian(header, widths[i], 4);
+            append_little_endian(header, names[i].size(), 4);
+            header += names[i];
+        }
+    } else {
+        for (size_t i = 0; i < names.size(); i++) {
+            header += names[i];
+            header += (i + 1 < names.size()) ? ' ' : '\n';
+        }
+        if (header.empty())
+            header = "\n";
+    }
+
+    std::lock_guard<std::mutex> guard(lock);
+    oassert(queue.empty() && !formatting && !num_vectors && "vector headers must be written first");
+    fwrite(header.data(), 1, header.size(), file);
+}
+
+void vector_file_writer::write_vector(std::vector<BitSpace::bit_value_t>&& values) {
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        written.wait(guard, [&] { return queue.size() < MAX_QUEUED_VECTORS; });
+        queue.push_back(std::move(values));
+        num_vectors++;
+    }
+    queued.notify_one();
+}
+
+void vector_file_writer::finish() {
+    if (!file)
+        return;
+
+    std::unique_lock<std::mutex> guard(lock);
+    written.wait(guard, [&] { return queue.empty() && !formatting; });
+
+    if (binary) {
+        std::string count;
+        append_little_endian(count, num_vectors, 8);
+        long end = ftell(file);
+        fseek(file, BINARY_VECTOR_MAGIC_SIZE + 4, SEEK_SET);
+        fwrite(count.data(), 1, count.size(), file);
+        fseek(file, end, SEEK_SET);
+    }
+    fflush(file);
+}
+
+void vector_file_writer::format_loop() {
+    std::vector<std::vector<BitSpace::bit_value_t>> batch;
+    std::string out;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            formatting = false;
+            written.notify_all();
+            queued.wait(guard, [&] { return stopping || !queue.empty(); });
+            if (queue.empty())
+                return;
+
+            // Take all the queued vectors at once, and format them without holding the lock.
+            batch.assign(std::make_move_iterator(queue.begin()), std::make_move_iterator(queue.end()));
+            queue.clear();
+            formatting = true;
+        }
+        written.notify_all();
+
+        out.clear();
+        for (const auto& values : batch) {
+            if (binary)
+                format_binary(values, out);
+            else
+                format_text(values, out);
+        }
+        fwrite(out.data(), 1, out.size(), file);
+    }
+}
+
+/*
+ * Lines with unknown values, and single bit lines, are written in binary, the others in hexadecimal.
+ */
+void vector_file_writer::format_text(const std::vector<BitSpace::bit_value_t>& values, std::string& out) const {
+    static const char hex_digits[] = "0123456789abcdef";
+
+    size_t offset = 0;
+    for (int width : line_widths) {
+        const BitSpace::bit_value_t* line = values.data() + offset;
+        offset += width;
+
+        bool unknown = false;
+        for (int j = 0; j < width && !unknown; j++)
+            unknown = BitSpace::is_unk[line[j]];
+
+        if (unknown || width == 1) {
+            for (int j = width - 1; j >= 0; j--)
+                out += BitSpace::is_unk[line[j]] ? 'x' : (char)('0' + line[j]);
+        } else {
+            out += "0X";
+
+            int hex_digit = 0;
+            for (int j = width - 1; j >= 0; j--) {
+                hex_digit += line[j] << j % 4;
+
+                if (!(j % 4)) {
+                    out += hex_digits[hex_digit];
+                    hex_digit = 0;
+                }
+            }
+        }
+        out += ' ';
+    }
+    out += '\n';
+}
+
+void vector_file_writer::format_binary(const std::vector<BitSpace::bit_value_t>& values, std::string& out) const {
+    size_t start = out.size();
+    out.resize(start + get_record_size(values.size()), '\0');
+    for (size_t i = 0; i < values.size(); i++)
+        out[start + i / 4] |= (char)((values[i] & 0x3) << (2 * (i % 4)));
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2023 CAS—Atlantic (University of New Brunswick, CASA)
+ * 
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef VECTOR_IO_H
+#define VECTOR_IO_H
+
+/*
+ * Streaming reads and writes of the simulation vector files.
+ *
+ * The vectors are either text (one line of values per cycle, under a header
+ * line with the names of the lines) or packed binary, in which each pin takes
+ * 2 bits:
+ *
+ *   "ODINVEC1"                          magic
+ *   uint32 number of lines              little endian
+ *   uint64 number of vectors
+ *   per line: uint32 width, uint32 name length, name
+ *   per vector: the values of the pins of all the lines, in line order and from the
+ *               least significant pin, 4 per byte from the low bits up, padded to a byte
+ *
+ * Input files are mapped in memory, and their format is detected from the magic.
+ * Output vectors are formatted and written by a background thread, so the
+ * simulation only copies the values of the lines of each cycle.
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "rtl_int.hpp"
+
+#define BINARY_VECTOR_MAGIC "ODINVEC1"
+#define BINARY_VECTOR_MAGIC_SIZE 8
+
+class vector_file_reader {
+  public:
+    explicit vector_file_reader(const char* file_name);
+    ~vector_file_reader();
+
+    // Whether the file could be opened.
+    bool is_open() const;
+    bool is_binary() const;
+
+    // Goes back to the header of text files, and to the first vector of binary files.
+    void rewind();
+
+    // Text files: copies the next line which is a vector (not blank, and not a comment) to buffer, like fgets.
+    bool next_line(char* buffer, size_t buffer_size);
+    // The number of vectors after the header. Rewinds.
+    long count_vectors();
+    // The number of lines after the header, vectors or not (the number of vectors of binary files). Rewinds.
+    long count_lines();
+
+    // Binary files: the header, as the equivalent text header line.
+    std::string get_header() const;
+    const std::vector<int>& get_line_widths() const;
+    // Binary files: reads the values of all the pins of the next vector.
+    bool next_record(std::vector<BitSpace::bit_value_t>& values);
+
+  private:
+    void parse_binary_header();
+
+    const char* data;
+    size_t size;
+    size_t position;
+    bool binary;
+
+    // Binary files
+    std::vector<std::string> line_names;
+    std::vector<int> line_widths;
+    size_t records_start;
+    size_t record_size;
+    size_t num_pins;
+    long num_records;
+};
+
+class vector_file_writer {
+  public:
+    vector_file_writer(const char* file_name, bool binary);
+    ~vector_file_writer();
+
+    // Whether the file could be created.
+    bool is_open() const;
+
+    // Writes the header. Must be called once, before any vector.
+    void write_header(const std::vector<std::string>& names, const std::vector<int>& widths);
+    // Queues the values of all the pins of a vector, in line order and from the least significant pin.
+    void write_vector(std::vector<BitSpace::bit_value_t>&& values);
+    // Waits until all the queued vectors are written, and flushes the file.
+    void finish();
+
+  private:
+    void format_loop();
+    void format_text(const std::vector<BitSpace::bit_value_t>& values, std::string& out) const;
+    void format_binary(const std::vector<BitSpace::bit_value_t>& values, std::string& out) const;
+
+    FILE* file;
+    bool binary;
+    std::vector<int> line_widths;
+    long num_vectors;
+
+    std::thread formatter;
+    std::mutex lock;
+    std::condition_variable queued;
+    std::condition_variable written;
+    std::deque<std::vector<BitSpace::bit_value_t>> queue;
+    bool formatting;
+    bool stopping;
+};
+
+#endif
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2023 CAS—Atlantic (University of New Brunswick, CASA)
+ * 
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "file_prefetcher.h"
+
+/* the files are mostly read from the same disk, a few readers are enough to keep ahead of the parser */
+constexpr size_t MAX_PREFETCH_THREADS = 4;
+/* how many files the readers may get ahead of the last file opened */
+constexpr size_t MAX_FILES_AHEAD = 16;
+
+file_prefetcher::file_prefetcher(const std::vector<std::string>& file_names)
+    : file_names(file_names)
+    , contents(file_names.size())
+    , status(file_names.size(), FILE_PENDING)
+    , next_file(0)
+    , opened_file(0)
+    , stopping(false) {
+    /* a file listed twice is opened from its first occurrence */
+    for (size_t i = file_names.size(); i-- > 0;)
+        file_index[file_names[i]] = i;
+
+    size_t num_readers = std::min<size_t>(file_names.size(), MAX_PREFETCH_THREADS);
+    num_readers = std::min<size_t>(num_readers, std::max(1u, std::thread::hardware_concurrency()));
+    for (size_t i = 0; i < num_readers; i++)
+        readers.push_back(std::thread(&file_prefetcher::read_loop, this));
+}
+
+file_prefetcher::~file_prefetcher() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    file_opened.notify_all();
+    for (auto& reader : readers)
+        reader.join();
+}
+
+FILE* file_prefetcher::open(const std::string& file_name) {
+    auto it = file_index.find(file_name);
+    if (it == file_index.end())
+        return NULL;
+    size_t i = it->second;
+
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        opened_file = std::max(opened_file, i + 1);
+        file_opened.notify_all();
+        file_read.wait(guard, [&] { return status[i] != FILE_PENDING; });
+    }
+
+    /* the contents are not modified once read, and fmemopen doesn't accept empty buffers */
+    if (status[i] == FILE_FAILED || contents[i].empty())
+        return NULL;
+    return fmemopen(&contents[i][0], contents[i].size(), "r");
+}
+
+void file_prefetcher::read_loop() {
+    while (true) {
+        size_t i;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            file_opened.wait(guard, [&] { return stopping || next_file >= file_names.size() || next_file < opened_file + MAX_FILES_AHEAD; });
+            if (stopping || next_file >= file_names.size())
+                return;
+            i = next_file++;
+        }
+
+        std::ifstream file(file_names[i], std::ios::binary);
+        std::ostringstream text;
+        if (file)
+            text << file.rdbuf();
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (file && !file.bad()) {
+                contents[i] = text.str();
+                status[i] = FILE_READ;
+            } else {
+                status[i] = FILE_FAILED;
+            }
+        }
+        file_read.notify_all();
+    }
+}
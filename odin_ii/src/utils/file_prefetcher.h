@@ -0,0 +1,82 @@
+/*
+ * Copyright 2023 CAS—Atlantic (University of New Brunswick, CASA)
+ * 
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __FILE_PREFETCHER_H__
+#define __FILE_PREFETCHER_H__
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * Reads a list of input files into memory on background threads, in list order,
+ * while they are being parsed: the parser then lexes each file from memory instead
+ * of waiting on the file system, which matters for designs of many (large) files.
+ *
+ * The readers stay at most a few files ahead of the last file opened, so the
+ * memory held is bounded by the size of the files read so far plus the lookahead.
+ */
+class file_prefetcher {
+  public:
+    file_prefetcher(const std::vector<std::string>& file_names);
+    ~file_prefetcher();
+
+    /**
+     * Opens file_name for reading from its prefetched contents, waiting until they
+     * are read. Returns NULL if the file is not one of the prefetched files, or
+     * could not be read (the caller then opens it directly for the error message).
+     * The stream is valid as long as the prefetcher.
+     */
+    FILE* open(const std::string& file_name);
+
+  private:
+    void read_loop();
+
+    enum file_status {
+        FILE_PENDING,
+        FILE_READ,
+        FILE_FAILED
+    };
+
+    std::vector<std::string> file_names;
+    std::unordered_map<std::string, size_t> file_index;
+    std::vector<std::string> contents;
+    std::vector<file_status> status;
+
+    size_t next_file;   // the next file to be read
+    size_t opened_file; // one past the last file opened
+    bool stopping;
+
+    std::vector<std::thread> readers;
+    std::mutex lock;
+    std::condition_variable file_read;
+    std::condition_variable file_opened;
+};
+
+#endif
@@ -35,11 +35,11 @@ void hash_table::destroy_free_items() {
         vtr::free(kv.second);
 }
 
-void hash_table::add(std::string key, void* item) {
+void hash_table::add(const std::string& key, void* item) {
     this->my_map.emplace(key, item);
 }
 
-void* hash_table::remove(std::string key) {
+void* hash_table::remove(const std::string& key) {
     void* value = NULL;
     auto v = this->my_map.find(key);
     if (v != this->my_map.end()) {
@@ -49,7 +49,7 @@ void* hash_table::remove(std::string key) {
     return value;
 }
 
-void* hash_table::get(std::string key) {
+void* hash_table::get(const std::string& key) {
     void* value = NULL;
     auto v = this->my_map.find(key);
     if (v != this->my_map.end())
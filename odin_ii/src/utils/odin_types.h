@@ -107,6 +107,12 @@ struct global_args_t {
     // or generated using a dummy adder with both inputs set to gnd/vdd
     argparse::ArgValue<bool> adder_cin_global;
 
+    // merge the structurally equivalent logic after partial mapping
+    argparse::ArgValue<bool> strash;
+
+    // directory of the cache of the synthesized netlists
+    argparse::ArgValue<std::string> synthesis_cache;
+
     /////////////////////
     // For simulation.
     /////////////////////
@@ -116,6 +122,8 @@ struct global_args_t {
     argparse::ArgValue<std::string> sim_vector_input_file;
     // Existing output vectors to verify against.
     argparse::ArgValue<std::string> sim_vector_output_file;
+    // Write the vectors in the packed binary format instead of text.
+    argparse::ArgValue<bool> sim_binary_vectors;
     // Simulation output Directory
     argparse::ArgValue<std::string> sim_directory;
     // Tells the simulator whether or not to generate random vectors which include the unknown logic value.
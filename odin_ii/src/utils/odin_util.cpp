@@ -672,12 +672,13 @@ std::string make_simple_name(char* input, const char* flatten_string, char flatt
     return input_str;
 }
 
+static long int m_id = 0;
+
 /*-----------------------------------------------------------------------
  * (function: my_malloc_struct )
  *-----------------------------------------------------------------*/
 void* my_malloc_struct(long bytes_to_alloc) {
     void* allocated = vtr::calloc(1, bytes_to_alloc);
-    static long int m_id = 0;
 
     // ways to stop the execution at the point when a specific structure is built...note it needs to be m_id - 1 ... it's unique_id in most data structures
     //oassert(m_id != 193);
@@ -693,6 +694,17 @@ void* my_malloc_struct(long bytes_to_alloc) {
     return allocated;
 }
 
+/*-----------------------------------------------------------------------
+ * (function: my_mark_struct )
+ * 	marks the unique_id of a zeroed structure allocated elsewhere (e.g. from a pool),
+ * 	from the same sequence as my_malloc_struct
+ *-----------------------------------------------------------------*/
+void* my_mark_struct(void* allocated) {
+    *((long int*)allocated) = m_id++;
+
+    return allocated;
+}
+
 /*
  * Changes the given string to upper case.
  */
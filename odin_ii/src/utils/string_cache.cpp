@@ -39,14 +39,13 @@ void generate_sc_hash(STRING_CACHE* sc);
 unsigned long
 string_hash(STRING_CACHE* sc,
             const char* string) {
-    long a, i, mod, mul;
-
-    a = 0;
-    mod = sc->mod;
-    mul = sc->mul;
-    for (i = 0; string[i]; i++)
-        a = (a * mul + (unsigned char)string[i]) % mod;
-    return a;
+    unsigned long a = 0;
+    unsigned long mul = sc->mul;
+
+    /* the hash only wraps around while it is built, rather than taking the modulo at every character */
+    for (long i = 0; string[i]; i++)
+        a = a * mul + (unsigned char)string[i];
+    return a % sc->mod;
 }
 
 void generate_sc_hash(STRING_CACHE* sc) {
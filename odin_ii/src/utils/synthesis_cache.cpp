@@ -0,0 +1,146 @@
+/*
+ * Copyright 2023 CAS—Atlantic (University of New Brunswick, CASA)
+ * 
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+
+#include "synthesis_cache.h"
+#include "odin_globals.h"
+#include "odin_types.h"
+#include "odin_util.h"
+#include "odin_error.h"
+
+#include "vtr_digest.h"
+#include "vtr_error.h"
+
+/* digests are prefixed with their hash type, the hex part is enough for file names */
+static std::string strip_hash_type(const std::string& digest) {
+    size_t loc = digest.find(':');
+    return (loc == std::string::npos) ? digest : digest.substr(loc + 1);
+}
+
+static std::string entry_path(const std::string& cache_dir, const std::string& key, const char* extension) {
+    return cache_dir + "/" + key + extension;
+}
+
+/* returns an empty string if the file can not be read */
+static std::string digest_file_or_empty(const std::string& file_name) {
+    try {
+        return vtr::secure_digest_file(file_name);
+    } catch (vtr::VtrError&) {
+        return "";
+    }
+}
+
+static bool copy_file(const std::string& from, const std::string& to) {
+    std::ifstream in(from, std::ios::binary);
+    if (!in)
+        return false;
+
+    std::ofstream out(to, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+
+    out << in.rdbuf();
+    return bool(out);
+}
+
+std::string synthesis_cache_key(int argc, char** argv) {
+    std::string key_text;
+
+    /* the options change the netlist, as does the order of the input files */
+    for (int i = 0; i < argc; i++) {
+        key_text += argv[i];
+        key_text += '\0';
+    }
+
+    /* the input files may be listed in the configuration file, the hard blocks come from the architecture */
+    if (global_args.config_file.provenance() == argparse::Provenance::SPECIFIED)
+        key_text += digest_file_or_empty(global_args.config_file.value());
+    key_text += '\0';
+    if (global_args.arch_file.provenance() == argparse::Provenance::SPECIFIED)
+        key_text += digest_file_or_empty(global_args.arch_file.value());
+
+    std::vector<vtr::array_view<const char>> buffers = {vtr::array_view<const char>(key_text.data(), key_text.size())};
+    return strip_hash_type(vtr::secure_digest_buffers(buffers));
+}
+
+bool synthesis_cache_fetch(const std::string& cache_dir, const std::string& key, const std::string& output_file) {
+    std::ifstream manifest(entry_path(cache_dir, key, ".manifest"));
+    if (!manifest)
+        return false;
+
+    /* each line is the digest of a file read by the synthesis, followed by its name */
+    std::string line;
+    while (std::getline(manifest, line)) {
+        size_t loc = line.find(' ');
+        if (loc == std::string::npos)
+            return false;
+
+        std::string digest = line.substr(0, loc);
+        std::string file_name = line.substr(loc + 1);
+        if (digest_file_or_empty(file_name) != digest) {
+            printf("Synthesis cache miss, %s has changed\n", file_name.c_str());
+            return false;
+        }
+    }
+
+    return copy_file(entry_path(cache_dir, key, ".blif"), output_file);
+}
+
+void synthesis_cache_store(const std::string& cache_dir, const std::string& key, const std::string& output_file) {
+    create_directory(cache_dir);
+
+    std::ostringstream manifest_text;
+    for (const auto& include_file : include_file_names) {
+        std::string digest = digest_file_or_empty(include_file.first);
+        if (digest.empty()) {
+            warning_message(UTIL, unknown_location, "Could not read %s, the netlist is not cached", include_file.first.c_str());
+            return;
+        }
+        manifest_text << digest << " " << include_file.first << "\n";
+    }
+
+    /* the manifest is written last, so that an entry is never found with a partial netlist */
+    std::string manifest_path = entry_path(cache_dir, key, ".manifest");
+    std::string temp_manifest_path = manifest_path + ".tmp";
+    std::remove(manifest_path.c_str());
+
+    if (!copy_file(output_file, entry_path(cache_dir, key, ".blif"))) {
+        warning_message(UTIL, unknown_location, "Could not copy %s to the synthesis cache", output_file.c_str());
+        return;
+    }
+
+    std::ofstream manifest(temp_manifest_path, std::ios::trunc);
+    manifest << manifest_text.str();
+    manifest.close();
+    if (!manifest || std::rename(temp_manifest_path.c_str(), manifest_path.c_str())) {
+        warning_message(UTIL, unknown_location, "Could not write the synthesis cache manifest %s", manifest_path.c_str());
+        std::remove(temp_manifest_path.c_str());
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2023 CAS—Atlantic (University of New Brunswick, CASA)
+ * 
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __SYNTHESIS_CACHE_H__
+#define __SYNTHESIS_CACHE_H__
+
+#include <string>
+
+/**
+ * A cache of the synthesized netlists on disk (--synthesis_cache).
+ *
+ * An entry is keyed by the digest of the command line and of the content of the
+ * configuration and architecture files. It holds the output netlist, along with a
+ * manifest of the digests of every verilog file read by the synthesis (the input
+ * files and everything they `include). An entry is only a hit if all of these
+ * files are still unchanged, in which case the stored netlist is copied to the
+ * output file instead of synthesizing again.
+ */
+
+/**
+ * (function: synthesis_cache_key)
+ * returns the key of the cache entry of this run of odin
+ */
+std::string synthesis_cache_key(int argc, char** argv);
+
+/**
+ * (function: synthesis_cache_fetch)
+ * copies the netlist of the entry to output_file, returns false on a miss
+ */
+bool synthesis_cache_fetch(const std::string& cache_dir, const std::string& key, const std::string& output_file);
+
+/**
+ * (function: synthesis_cache_store)
+ * stores output_file as the netlist of the entry, along with the manifest of the files read
+ */
+void synthesis_cache_store(const std::string& cache_dir, const std::string& key, const std::string& output_file);
+
+#endif //__SYNTHESIS_CACHE_H__
@@ -17,7 +17,8 @@
  */
 #include "mixing_optimization.h"
 
-#include <stdint.h> // INT_MAX
+#include <algorithm> // std::stable_sort
+#include <stdint.h>  // INT_MAX
 #include <vector>
 
 #include "adder.h"                 // hard_adders
@@ -36,7 +37,7 @@ void MixingOpt::scale_counts()
     this->_blocks_count = this->_blocks_count * this->_ratio;
 }
 
-void MixingOpt::assign_weights(netlist_t * /*netlist*/, std::vector<nnode_t *> /*nodes*/)
+void MixingOpt::assign_weights(netlist_t * /*netlist*/, const std::vector<nnode_t *> & /*nodes*/)
 {
     // compute weights for all noted nodes
     error_message(NETLIST, unknown_location,
@@ -75,7 +76,7 @@ bool MultsOpt::hardenable(nnode_t *node)
     return (hard_multipliers && (mult_size > min_mult));
 }
 
-void MultsOpt::assign_weights(netlist_t *netlist, std::vector<nnode_t *> nodes)
+void MultsOpt::assign_weights(netlist_t *netlist, const std::vector<nnode_t *> &nodes)
 {
     // compute weights for all noted nodes
     for (size_t i = 0; i < nodes.size(); i++) {
@@ -85,41 +86,33 @@ void MultsOpt::assign_weights(netlist_t *netlist, std::vector<nnode_t *> nodes)
 
 void MultsOpt::perform(netlist_t *netlist, std::vector<nnode_t *> &weighted_nodes)
 {
-    size_t nodes_count = weighted_nodes.size();
-
-    // per optimization, instantiate hard logic
-    for (int i = 0; i < this->_blocks_count; i++) {
-        int maximal_cost = -1;
-        int index = -1;
-        for (size_t j = 0; j < nodes_count; j++) {
-            // if found a new maximal cost that is higher than a current maximum AND is not restricted by input
-            // params for minimal "hardenable" multiplier width
-            if (maximal_cost < weighted_nodes[j]->weight && this->hardenable(weighted_nodes[j])) {
-                maximal_cost = weighted_nodes[j]->weight;
-                index = j;
-            }
+    // the candidates are the nodes with a weight that are not restricted by input params for minimal
+    // "hardenable" multiplier width. They are hardened by decreasing weight, and among equal weights
+    // in the order they were noted, which the stable sort keeps, so the choice does not depend on timing
+    std::vector<nnode_t *> candidates;
+    for (nnode_t *node : weighted_nodes) {
+        if (node->weight > -1 && this->hardenable(node)) {
+            candidates.push_back(node);
         }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [](const nnode_t *a, const nnode_t *b) { return a->weight > b->weight; });
 
-        // if there are no suitable nodes left, leave the loop to
-        // implement remaining nodes in soft logic
-        if (index < 0)
-            break;
-
-        // indicate for future iterations the node was hardened
-        weighted_nodes[index]->weight = -1;
+    // per optimization, instantiate hard logic; once there are no suitable nodes left,
+    // the remaining nodes are implemented in soft logic
+    size_t num_hardened = std::min<size_t>(candidates.size(), std::max(this->_blocks_count, 0));
+    for (size_t i = 0; i < num_hardened; i++) {
+        // indicate the node was hardened
+        candidates[i]->weight = -1;
 
         if (hard_multipliers) {
-            instantiate_hard_multiplier(weighted_nodes[index], this->cached_traverse_value, netlist);
+            instantiate_hard_multiplier(candidates[i], this->cached_traverse_value, netlist);
         }
     }
 
-    // From the end of the vector, remove all nodes that were implemented in hard logic. The remaining
+    // remove all nodes that were implemented in hard logic, keeping the order of the others. The remaining
     // nodes will be instantiated in soft_map_remaining_nodes
-    for (int i = nodes_count - 1; i >= 0; i--) {
-        if (weighted_nodes[i]->weight == -1) {
-            weighted_nodes.erase(weighted_nodes.begin() + i);
-        }
-    }
+    weighted_nodes.erase(std::remove_if(weighted_nodes.begin(), weighted_nodes.end(), [](const nnode_t *node) { return node->weight == -1; }),
+                         weighted_nodes.end());
 }
 
 void MixingOpt::set_blocks_needed(int new_count) { this->_blocks_count = new_count; }
@@ -141,7 +134,7 @@ void MultsOpt::set_blocks_needed(int new_count)
 
     this->scale_counts();
 }
-void MixingOpt::instantiate_soft_logic(netlist_t * /*netlist*/, std::vector<nnode_t *> /* nodes*/)
+void MixingOpt::instantiate_soft_logic(netlist_t * /*netlist*/, std::vector<nnode_t *> & /* nodes*/)
 {
     error_message(NETLIST, unknown_location, "Performing instantiate_soft_logic was called for optimization without method provided, for kind  %i\n",
                   this->_kind);
@@ -167,14 +160,13 @@ void MultsOpt::partial_map_node(nnode_t *node, short traverse_value, netlist_t *
     this->cached_traverse_value = traverse_value;
 }
 
-void MultsOpt::instantiate_soft_logic(netlist_t *netlist, std::vector<nnode_t *> nodes)
+void MultsOpt::instantiate_soft_logic(netlist_t *netlist, std::vector<nnode_t *> &nodes)
 {
-    unsigned int size = nodes.size();
-    for (unsigned int j = 0; j < size; j++) {
-        instantiate_simple_soft_multiplier(nodes[j], this->cached_traverse_value, netlist);
+    for (nnode_t *node : nodes) {
+        instantiate_simple_soft_multiplier(node, this->cached_traverse_value, netlist);
     }
-    for (int i = size - 1; i >= 0; i--) {
-        nodes[i] = free_nnode(nodes[i]);
-        nodes.erase(nodes.begin() + i);
+    for (nnode_t *node : nodes) {
+        free_nnode(node);
     }
+    nodes.clear();
 }
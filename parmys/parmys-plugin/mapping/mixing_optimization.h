@@ -59,7 +59,7 @@ class MixingOpt
      *
      * @param nnode_t* pointer to the node
      */
-    virtual void assign_weights(netlist_t *netlist, std::vector<nnode_t *> nodes);
+    virtual void assign_weights(netlist_t *netlist, const std::vector<nnode_t *> &nodes);
 
     /**
      * @brief Checks if the optimization is enabled for this node
@@ -75,7 +75,7 @@ class MixingOpt
      * @param netlist
      * @param nodes
      */
-    virtual void instantiate_soft_logic(netlist_t *netlist, std::vector<nnode_t *> nodes);
+    virtual void instantiate_soft_logic(netlist_t *netlist, std::vector<nnode_t *> &nodes);
 
     /**
      * @brief performs the optimization pass, varies between kinds.
@@ -167,7 +167,7 @@ class MultsOpt : public MixingOpt
      *
      * @param nodes pointer to the vector with mults
      */
-    virtual void assign_weights(netlist_t *netlist, std::vector<nnode_t *> nodes);
+    virtual void assign_weights(netlist_t *netlist, const std::vector<nnode_t *> &nodes);
 
     /**
      * @brief allowing for replacing with dynamic polymorphism for different
@@ -183,7 +183,7 @@ class MultsOpt : public MixingOpt
      * @param netlist
      * @param nodes
      */
-    virtual void instantiate_soft_logic(netlist_t *netlist, std::vector<nnode_t *> nodes);
+    virtual void instantiate_soft_logic(netlist_t *netlist, std::vector<nnode_t *> &nodes);
 
     /**
      * @brief performs the optimization pass, specifically for multipliers.
@@ -0,0 +1,501 @@
+#!/usr/bin/env python3
+"""
+    Runs VPR on a suite of designs and compares its run-time, memory, work and QoR
+    metrics (as written by 'vpr --write_perf_metrics') against a stored baseline.
+
+    The suite file lists one design per line:
+
+        <name> <architecture file> <circuit file> [extra vpr arguments...]
+
+    Paths are relative to the suite file, and lines starting with '#' are ignored, e.g.:
+
+        # name      architecture                                 circuit
+        ch_intrinsics arch/k6_frac_N10_mem32K_40nm.xml blif/ch_intrinsics.blif --route_chan_width 100
+
+    The results (and baseline) files map each design to its metrics:
+
+        {
+          "ch_intrinsics": {
+            "place.wall_sec": {"value": 1.2, "type": "runtime", "higher_is_better": false},
+            "analysis.cpd_ns": {"value": 2.5, "type": "qor", "higher_is_better": false, "tolerance": 0.0},
+            ...
+          }
+        }
+
+    A metric changes significantly if it differs from the baseline by more than the
+    tolerance of its type (or the metric's own "tolerance" in the baseline), and is then
+    reported as 'regressed' or 'improved' in the diff file. The exit code is non-zero if
+    any metric regressed or any design failed to run.
+
+    With -j > 1 the designs are packed onto the machine by their thread and memory needs:
+    a design runs on --vpr_threads threads (passed as --num_workers, unless its suite line
+    sets -j/--num_workers itself), and its memory need is the peak RSS it reached in the
+    previous results and the baseline (--default_memory_mib if it has not been run yet).
+    Designs are only started while the running ones fit in --max_threads and --max_memory_mib.
+"""
+import argparse
+import json
+import os
+import shlex
+import statistics
+import subprocess
+import sys
+import time
+from collections import OrderedDict
+from concurrent.futures import ThreadPoolExecutor, wait, FIRST_COMPLETED
+
+METRICS_FILE = "perf_metrics.json"
+
+PEAK_MEMORY_METRIC = "total.max_rss_mib"
+
+#Predicted peak memory is padded by this fraction, since it varies between runs and code versions
+MEMORY_PREDICTION_MARGIN = 0.1
+
+DEFAULT_TOLERANCES = OrderedDict(
+    [
+        ("runtime", 0.15),
+        ("memory", 0.10),
+        ("work", 0.05),
+        ("qor", 0.02),
+    ]
+)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Runs VPR on a suite of designs and compares its performance metrics against a baseline"
+    )
+
+    parser.add_argument("suite", help="Suite file listing the designs to run")
+    parser.add_argument(
+        "--vpr",
+        default="vpr/vpr",
+        help="VPR executable (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--baseline",
+        help="Baseline results file to compare against",
+    )
+    parser.add_argument(
+        "--output_dir",
+        default="perf_test",
+        help="Directory in which each design is run (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--results",
+        default="perf_results.json",
+        help="File to which the metrics of this run are written (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--diff",
+        default="perf_diff.json",
+        help="File to which the comparison against the baseline is written (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--update_baseline",
+        action="store_true",
+        default=False,
+        help="Overwrite the baseline with the results of this run "
+        "(keeping any per-metric tolerances of the old baseline)",
+    )
+    parser.add_argument(
+        "--repeat",
+        type=int,
+        default=1,
+        metavar="NUM_RUNS",
+        help="How many times to run each design, reporting the median of each metric (default: %(default)s)",
+    )
+    parser.add_argument(
+        "-j",
+        type=int,
+        default=1,
+        metavar="NUM_JOBS",
+        help="How many designs to run in parallel. Note that parallel runs compete for "
+        "cores and memory bandwidth, making run-time metrics noisier (default: %(default)s)",
+    )
+
+    schedule_args = parser.add_argument_group("Scheduling (of parallel runs, see -j)")
+    schedule_args.add_argument(
+        "--vpr_threads",
+        type=int,
+        default=1,
+        metavar="NUM_THREADS",
+        help="Threads given to VPR (as --num_workers) for designs which do not set them (default: %(default)s)",
+    )
+    schedule_args.add_argument(
+        "--max_threads",
+        type=int,
+        default=os.cpu_count() or 1,
+        help="Threads available to the runs (default: the number of cores, %(default)s)",
+    )
+    schedule_args.add_argument(
+        "--max_memory_mib",
+        type=float,
+        default=physical_memory_mib(),
+        help="Memory available to the runs, 0 for no limit (default: the physical memory, %(default).0f)",
+    )
+    schedule_args.add_argument(
+        "--default_memory_mib",
+        type=float,
+        default=1024,
+        help="Predicted peak memory of designs without a previous result (default: %(default)s)",
+    )
+
+    tolerance_args = parser.add_argument_group("Tolerances (relative change before a metric is flagged)")
+    for metric_type, tolerance in DEFAULT_TOLERANCES.items():
+        tolerance_args.add_argument(
+            "--{}_tolerance".format(metric_type),
+            type=float,
+            default=tolerance,
+            help="Tolerance of {} metrics (default: %(default)s)".format(metric_type),
+        )
+
+    return parser.parse_args()
+
+
+def physical_memory_mib():
+    """Returns the physical memory of the machine in MiB (0 if unknown)"""
+    try:
+        return os.sysconf("SC_PAGE_SIZE") * os.sysconf("SC_PHYS_PAGES") / (1024.0 * 1024.0)
+    except (ValueError, OSError, AttributeError):
+        return 0.0
+
+
+def load_suite(suite_file):
+    """Returns a list of (name, vpr arguments) tuples from the suite file"""
+    suite_dir = os.path.dirname(os.path.abspath(suite_file))
+    designs = []
+    with open(suite_file) as f:
+        for line_num, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+
+            fields = shlex.split(line)
+            if len(fields) < 3:
+                raise ValueError(
+                    "{}:{}: expected '<name> <architecture> <circuit> [vpr args...]'".format(
+                        suite_file, line_num
+                    )
+                )
+            name, arch, circuit = fields[:3]
+            vpr_args = [os.path.join(suite_dir, arch), os.path.join(suite_dir, circuit)] + fields[3:]
+            designs.append((name, vpr_args))
+    return designs
+
+
+def design_threads(vpr_args, default_threads):
+    """
+    Returns the number of threads VPR uses for a design, and its VPR arguments
+    (with --num_workers added if the suite line did not set it)
+    """
+    for i, arg in enumerate(vpr_args):
+        if arg in ("-j", "--num_workers") and i + 1 < len(vpr_args):
+            return max(int(vpr_args[i + 1]), 1), vpr_args
+        if arg.startswith("--num_workers="):
+            return max(int(arg.split("=", 1)[1]), 1), vpr_args
+
+    if default_threads > 1:
+        vpr_args = vpr_args + ["--num_workers", str(default_threads)]
+    return default_threads, vpr_args
+
+
+def load_peak_memory(result_files):
+    """Returns the largest peak memory (MiB) of each design in the (existing) results files"""
+    peak_memory = {}
+    for result_file in result_files:
+        if not result_file or not os.path.exists(result_file):
+            continue
+        with open(result_file) as f:
+            results = json.load(f)
+        for design, metrics in results.items():
+            if metrics and PEAK_MEMORY_METRIC in metrics:
+                peak_memory[design] = max(peak_memory.get(design, 0.0), metrics[PEAK_MEMORY_METRIC]["value"])
+    return peak_memory
+
+
+def schedule_designs(jobs, run_job, max_jobs, max_threads, max_memory_mib):
+    """
+    Runs run_job(name, vpr_args) for each job (name, vpr_args, threads, memory_mib), returning
+    the results in job order
+
+    The largest pending job which fits in the free threads and memory is started whenever a job
+    finishes. A job which does not fit even on an idle machine is run alone.
+    """
+    pending = sorted(jobs, key=lambda job: (job[3], job[2]), reverse=True)
+    running = {}
+    results = {}
+
+    start = time.time()
+    last_event = start
+    thread_sec = 0.0
+    memory_mib_sec = 0.0
+    peak_threads = 0
+    peak_memory_mib = 0.0
+
+    with ThreadPoolExecutor(max_workers=max(max_jobs, 1)) as pool:
+        while pending or running:
+            used_threads = sum(job[2] for job in running.values())
+            used_memory_mib = sum(job[3] for job in running.values())
+
+            started = False
+            if len(running) < max_jobs:
+                for job in pending:
+                    fits = used_threads + job[2] <= max_threads and (
+                        max_memory_mib <= 0 or used_memory_mib + job[3] <= max_memory_mib
+                    )
+                    if fits or not running:
+                        if not fits:
+                            print(
+                                "{}: needs {} threads and {:.0f} MiB, more than available; running it alone".format(
+                                    job[0], job[2], job[3]
+                                )
+                            )
+                        pending.remove(job)
+                        running[pool.submit(run_job, job[0], job[1])] = job
+                        started = True
+                        break
+            if started:
+                continue
+
+            done, _ = wait(list(running), return_when=FIRST_COMPLETED)
+
+            now = time.time()
+            thread_sec += used_threads * (now - last_event)
+            memory_mib_sec += used_memory_mib * (now - last_event)
+            peak_threads = max(peak_threads, used_threads)
+            peak_memory_mib = max(peak_memory_mib, used_memory_mib)
+            last_event = now
+
+            for future in done:
+                job = running.pop(future)
+                results[job[0]] = future.result()
+
+    elapsed = max(time.time() - start, 1e-9)
+    if max_jobs > 1:
+        print(
+            "Scheduler: {:.0f}% average thread utilization (peak {} of {} threads), "
+            "{:.0f} MiB average and {:.0f} MiB peak predicted memory{}".format(
+                100 * thread_sec / (elapsed * max_threads),
+                peak_threads,
+                max_threads,
+                memory_mib_sec / elapsed,
+                peak_memory_mib,
+                " (of {:.0f} MiB)".format(max_memory_mib) if max_memory_mib > 0 else "",
+            )
+        )
+
+    return OrderedDict((job[0], results[job[0]]) for job in jobs)
+
+
+def run_design(vpr, output_dir, name, vpr_args, repeat):
+    """Runs VPR on a design, returning its metrics (or None if VPR failed)"""
+    run_dir = os.path.join(output_dir, name)
+    os.makedirs(run_dir, exist_ok=True)
+
+    runs = []
+    for _ in range(repeat):
+        cmd = [vpr] + vpr_args + ["--write_perf_metrics", METRICS_FILE]
+        start = time.time()
+        with open(os.path.join(run_dir, "vpr.out"), "w") as log:
+            result = subprocess.run(cmd, cwd=run_dir, stdout=log, stderr=subprocess.STDOUT)
+        elapsed = time.time() - start
+
+        if result.returncode != 0:
+            print("{}: FAILED (exit code {}, see {})".format(name, result.returncode, log.name))
+            return None
+
+        with open(os.path.join(run_dir, METRICS_FILE)) as f:
+            metrics = json.load(f, object_pairs_hook=OrderedDict)["metrics"]
+        metrics["total.wall_sec"] = OrderedDict(
+            [("value", elapsed), ("type", "runtime"), ("higher_is_better", False)]
+        )
+        runs.append(metrics)
+
+    print("{}: OK".format(name))
+
+    #Median of each metric over the runs
+    metrics = OrderedDict()
+    for metric_name, metric in runs[0].items():
+        values = [run[metric_name]["value"] for run in runs if metric_name in run]
+        metric["value"] = statistics.median(values)
+        metrics[metric_name] = metric
+    return metrics
+
+
+def compare_metric(baseline, metric, tolerances):
+    """Returns the comparison of a metric against its baseline"""
+    tolerance = baseline.get("tolerance", tolerances.get(baseline["type"], 0.0))
+    base_value = baseline["value"]
+    value = metric["value"]
+
+    if base_value != 0:
+        change = (value - base_value) / abs(base_value)
+    else:
+        change = 0.0 if value == 0 else (1.0 if value > 0 else -1.0)
+
+    if baseline.get("higher_is_better", False):
+        improvement = change
+    else:
+        improvement = -change
+
+    if improvement < -tolerance:
+        status = "regressed"
+    elif improvement > tolerance:
+        status = "improved"
+    else:
+        status = "ok"
+
+    return OrderedDict(
+        [
+            ("baseline", base_value),
+            ("value", value),
+            ("change", change),
+            ("tolerance", tolerance),
+            ("status", status),
+        ]
+    )
+
+
+def compare(baseline, results, tolerances):
+    """Returns the diff of the results against the baseline"""
+    diff = OrderedDict()
+    summary = OrderedDict((status, 0) for status in ["ok", "improved", "regressed", "new", "missing", "failed"])
+
+    for design in sorted(set(baseline) | set(results)):
+        design_diff = OrderedDict()
+        base_metrics = baseline.get(design, {})
+        metrics = results.get(design)
+
+        if metrics is None:
+            design_diff["status"] = "failed" if design in results else "missing"
+            summary[design_diff["status"]] += 1
+            diff[design] = design_diff
+            continue
+
+        for name in list(base_metrics) + [name for name in metrics if name not in base_metrics]:
+            if name not in metrics:
+                metric_diff = OrderedDict([("baseline", base_metrics[name]["value"]), ("status", "missing")])
+            elif name not in base_metrics:
+                metric_diff = OrderedDict([("value", metrics[name]["value"]), ("status", "new")])
+            else:
+                metric_diff = compare_metric(base_metrics[name], metrics[name], tolerances)
+            summary[metric_diff["status"]] += 1
+            design_diff[name] = metric_diff
+        diff[design] = design_diff
+
+    return OrderedDict([("summary", summary), ("designs", diff)])
+
+
+def report_changes(diff):
+    """Prints the significantly changed metrics"""
+    for design, design_diff in diff["designs"].items():
+        if design_diff.get("status") in ("failed", "missing"):
+            print("  {}: {}".format(design, design_diff["status"]))
+            continue
+        for name, metric_diff in design_diff.items():
+            if metric_diff["status"] in ("regressed", "improved"):
+                print(
+                    "  {}: {} {} {:+.1f}% ({:g} -> {:g}, tolerance {:.1f}%)".format(
+                        design,
+                        name,
+                        metric_diff["status"],
+                        100 * metric_diff["change"],
+                        metric_diff["baseline"],
+                        metric_diff["value"],
+                        100 * metric_diff["tolerance"],
+                    )
+                )
+
+
+def write_json(file, data):
+    with open(file, "w") as f:
+        json.dump(data, f, indent=2)
+        f.write("\n")
+
+
+def main():
+    args = parse_args()
+    tolerances = {
+        metric_type: getattr(args, "{}_tolerance".format(metric_type)) for metric_type in DEFAULT_TOLERANCES
+    }
+
+    designs = load_suite(args.suite)
+    vpr = os.path.abspath(args.vpr)
+    output_dir = os.path.abspath(args.output_dir)
+
+    peak_memory = load_peak_memory([args.results, args.baseline])
+    jobs = []
+    for name, vpr_args in designs:
+        threads, vpr_args = design_threads(vpr_args, args.vpr_threads)
+        if name in peak_memory:
+            memory_mib = peak_memory[name] * (1 + MEMORY_PREDICTION_MARGIN)
+        else:
+            memory_mib = args.default_memory_mib
+        jobs.append((name, vpr_args, threads, memory_mib))
+
+    results = schedule_designs(
+        jobs,
+        lambda name, vpr_args: run_design(vpr, output_dir, name, vpr_args, args.repeat),
+        args.j,
+        args.max_threads,
+        args.max_memory_mib,
+    )
+
+    #Designs which needed more memory than predicted may have been packed too tightly
+    for name, vpr_args, threads, memory_mib in jobs:
+        metrics = results[name]
+        if metrics and PEAK_MEMORY_METRIC in metrics and metrics[PEAK_MEMORY_METRIC]["value"] > memory_mib:
+            print(
+                "{}: peak memory {:.0f} MiB exceeded its prediction of {:.0f} MiB".format(
+                    name, metrics[PEAK_MEMORY_METRIC]["value"], memory_mib
+                )
+            )
+
+    num_failed = sum(1 for metrics in results.values() if metrics is None)
+    write_json(args.results, OrderedDict((name, metrics) for name, metrics in results.items() if metrics))
+    print("Wrote results to {}".format(args.results))
+
+    num_regressed = 0
+    if args.baseline and os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f, object_pairs_hook=OrderedDict)
+
+        diff = compare(baseline, results, tolerances)
+        write_json(args.diff, diff)
+        num_regressed = diff["summary"]["regressed"]
+        print(
+            "Compared against {}: {} (wrote {})".format(
+                args.baseline,
+                ", ".join("{} {}".format(count, status) for status, count in diff["summary"].items()),
+                args.diff,
+            )
+        )
+        report_changes(diff)
+    else:
+        baseline = OrderedDict()
+        if args.baseline and not args.update_baseline:
+            print("Baseline {} does not exist (use --update_baseline to create it)".format(args.baseline))
+
+    if args.update_baseline and args.baseline:
+        new_baseline = OrderedDict()
+        for design, metrics in results.items():
+            if metrics is None:
+                #Keep the old baseline of designs which failed to run
+                if design in baseline:
+                    new_baseline[design] = baseline[design]
+                continue
+            for name, metric in metrics.items():
+                old_metric = baseline.get(design, {}).get(name, {})
+                if "tolerance" in old_metric:
+                    metric["tolerance"] = old_metric["tolerance"]
+            new_baseline[design] = metrics
+        write_json(args.baseline, new_baseline)
+        print("Updated baseline {}".format(args.baseline))
+
+    if num_failed > 0 or num_regressed > 0:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
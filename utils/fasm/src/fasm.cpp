@@ -5,6 +5,7 @@
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -25,10 +26,14 @@
 
 #include "fasm_utils.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 namespace fasm {
 
 FasmWriterVisitor::FasmWriterVisitor(vtr::string_internment *strings, std::ostream& f, bool is_flat) : strings_(strings), os_(f),
-    pb_graph_pin_lookup_from_index_by_type_(g_vpr_ctx.device().logical_block_types),
+    pb_graph_pin_lookup_from_index_by_type_(std::make_shared<IntraLbPbPinLookup>(g_vpr_ctx.device().logical_block_types)),
     fasm_lut(strings->intern_string(vtr::string_view("fasm_lut"))),
     fasm_features(strings->intern_string(vtr::string_view("fasm_features"))),
     fasm_params(strings->intern_string(vtr::string_view("fasm_params"))),
@@ -39,11 +44,30 @@ FasmWriterVisitor::FasmWriterVisitor(vtr::string_internment *strings, std::ostre
     is_flat_(is_flat){
 }
 
+FasmWriterVisitor::FasmWriterVisitor(FasmWriterVisitor& parent, std::ostream& f) : strings_(parent.strings_), os_(f),
+    shared_(&parent),
+    pb_graph_pin_lookup_from_index_by_type_(parent.pb_graph_pin_lookup_from_index_by_type_),
+    fasm_lut(parent.fasm_lut),
+    fasm_features(parent.fasm_features),
+    fasm_params(parent.fasm_params),
+    fasm_prefix(parent.fasm_prefix),
+    fasm_placeholders(parent.fasm_placeholders),
+    fasm_type(parent.fasm_type),
+    fasm_mux(parent.fasm_mux),
+    is_flat_(parent.is_flat_){
+}
+
 void FasmWriterVisitor::visit_top_impl(const char* top_level_name) {
     (void)top_level_name;
 }
 
 void FasmWriterVisitor::visit_clb_impl(ClusterBlockId blk_id, const t_pb* clb) {
+    if(shared_ == this) {
+      // Walked by a cluster visitor in finish_impl
+      clbs_.push_back(blk_id);
+      return;
+    }
+
     auto& place_ctx = g_vpr_ctx.placement();
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -129,7 +153,7 @@ void FasmWriterVisitor::check_interconnect(const t_pb_routes &pb_routes, int ino
     return;
   }
 
-  const t_pb_graph_pin *prev_pin = pb_graph_pin_lookup_from_index_by_type_.pb_gpin(logical_block_->index, prev_node);
+  const t_pb_graph_pin *prev_pin = pb_graph_pin_lookup_from_index_by_type_->pb_gpin(logical_block_->index, prev_node);
 
   int prev_edge;
   for(prev_edge = 0; prev_edge < prev_pin->num_output_edges; prev_edge++) {
@@ -151,6 +175,24 @@ void FasmWriterVisitor::check_interconnect(const t_pb_routes &pb_routes, int ino
 
 std::string FasmWriterVisitor::handle_fasm_prefix(const t_metadata_dict *meta,
         const t_pb_graph_node *pb_graph_node, const t_pb_type *pb_type) const {
+  auto key = std::make_pair(meta, pb_graph_node);
+  {
+    std::shared_lock<std::shared_mutex> lock(shared_->cache_mutex_);
+    auto iter = shared_->fasm_prefixes_.find(key);
+    if(iter != shared_->fasm_prefixes_.end()) {
+      return iter->second;
+    }
+  }
+
+  std::string prefix = handle_fasm_prefix_uncached(meta, pb_graph_node, pb_type);
+
+  std::unique_lock<std::shared_mutex> lock(shared_->cache_mutex_);
+  shared_->fasm_prefixes_.emplace(key, prefix);
+  return prefix;
+}
+
+std::string FasmWriterVisitor::handle_fasm_prefix_uncached(const t_metadata_dict *meta,
+        const t_pb_graph_node *pb_graph_node, const t_pb_type *pb_type) const {
   bool has_prefix = meta != nullptr && meta->has(fasm_prefix);
   if(!has_prefix) {
       return "";
@@ -262,6 +304,10 @@ void FasmWriterVisitor::check_features(const t_metadata_dict *meta) const {
 }
 
 void FasmWriterVisitor::visit_all_impl(const t_pb_routes &pb_routes, const t_pb* pb) {
+  if(shared_ == this) {
+    return;
+  }
+
   VTR_ASSERT(pb != nullptr);
   VTR_ASSERT(pb->pb_graph_node != nullptr);
 
@@ -334,6 +380,10 @@ void FasmWriterVisitor::visit_all_impl(const t_pb_routes &pb_routes, const t_pb*
 }
 
 void FasmWriterVisitor::visit_route_through_impl(const t_pb* atom) {
+  if(shared_ == this) {
+    return;
+  }
+
   check_for_lut(atom);
   check_for_param(atom);
 }
@@ -458,6 +508,22 @@ const t_metadata_dict *FasmWriterVisitor::get_fasm_type(const t_pb_graph_node* p
 }
 
 const LutOutputDefinition* FasmWriterVisitor::find_lut(const t_pb_graph_node* pb_graph_node) {
+  {
+    std::shared_lock<std::shared_mutex> lock(shared_->cache_mutex_);
+    auto iter = shared_->pb_graph_node_luts_.find(pb_graph_node);
+    if(iter != shared_->pb_graph_node_luts_.end()) {
+      return iter->second;
+    }
+  }
+
+  // The LUT definitions are built by (and stored in) the shared visitor
+  std::unique_lock<std::shared_mutex> lock(shared_->cache_mutex_);
+  const LutOutputDefinition* lut_definition = shared_->find_lut_uncached(pb_graph_node);
+  shared_->pb_graph_node_luts_.emplace(pb_graph_node, lut_definition);
+  return lut_definition;
+}
+
+const LutOutputDefinition* FasmWriterVisitor::find_lut_uncached(const t_pb_graph_node* pb_graph_node) {
   while(pb_graph_node != nullptr) {
     VTR_ASSERT(pb_graph_node->pb_type != nullptr);
 
@@ -543,6 +609,36 @@ static const t_pb_routes &find_pb_route(const t_pb* pb) {
   return pb->pb_route;
 }
 
+const Parameters* FasmWriterVisitor::find_params(const t_pb_type* pb_type, const t_metadata_dict* meta) {
+    {
+        std::shared_lock<std::shared_mutex> lock(shared_->cache_mutex_);
+        auto iter = shared_->parameters_.find(pb_type);
+        if(iter != shared_->parameters_.end()) {
+            return &iter->second;
+        }
+    }
+
+    Parameters params;
+    auto* value = meta->one(fasm_params);
+    VTR_ASSERT(value != nullptr);
+
+    std::string fasm_params_str = value->as_string().get(strings_);
+    for(const auto param : vtr::split(fasm_params_str, "\n")) {
+      auto param_parts = split_fasm_entry(param, "=", "\t ");
+        if(param_parts.size() == 0) {
+            continue;
+        }
+        VTR_ASSERT(param_parts.size() == 2);
+
+        params.AddParameter(param_parts[1], param_parts[0]);
+    }
+
+    // Another cluster visitor may have inserted the same parameters meanwhile
+    std::unique_lock<std::shared_mutex> lock(shared_->cache_mutex_);
+    auto ret = shared_->parameters_.insert(std::make_pair(pb_type, params));
+    return &ret.first->second;
+}
+
 void FasmWriterVisitor::check_for_param(const t_pb *atom) {
     auto& atom_ctx = g_vpr_ctx.atom();
 
@@ -561,36 +657,10 @@ void FasmWriterVisitor::check_for_param(const t_pb *atom) {
         return;
     }
 
-    auto iter = parameters_.find(atom->pb_graph_node->pb_type);
-
-    if(iter == parameters_.end()) {
-        Parameters params;
-        auto* value = meta->one(fasm_params);
-        VTR_ASSERT(value != nullptr);
-
-        std::string fasm_params_str = value->as_string().get(strings_);
-        for(const auto param : vtr::split(fasm_params_str, "\n")) {
-          auto param_parts = split_fasm_entry(param, "=", "\t ");
-            if(param_parts.size() == 0) {
-                continue;
-            }
-            VTR_ASSERT(param_parts.size() == 2);
-
-            params.AddParameter(param_parts[1], param_parts[0]);
-        }
-
-        auto ret = parameters_.insert(std::make_pair(
-                    atom->pb_graph_node->pb_type,
-                    params));
-
-        VTR_ASSERT(ret.second);
-        iter = ret.first;
-    }
-
-    auto &params = iter->second;
+    const Parameters* params = find_params(atom->pb_graph_node->pb_type, meta);
 
     for(auto param : atom_ctx.nlist.block_params(atom_blk_id)) {
-        auto feature = params.EmitFasmFeature(param.first, param.second);
+        auto feature = params->EmitFasmFeature(param.first, param.second);
 
         if(feature.size() > 0) {
             output_fasm_features(feature);
@@ -619,19 +689,54 @@ void FasmWriterVisitor::check_for_lut(const t_pb* atom) {
 }
 
 void FasmWriterVisitor::visit_atom_impl(const t_pb* atom) {
+    if(shared_ == this) {
+      return;
+    }
+
     check_for_lut(atom);
     check_for_param(atom);
 }
 
-void FasmWriterVisitor::walk_route_tree(const RRGraphBuilder& rr_graph_builder, const RouteTreeNode& root) {
+void FasmWriterVisitor::walk_route_tree(const t_rr_graph_storage& rr_nodes,
+                                        const vtr::vector<RREdgeId, const t_metadata_value*>& edge_features,
+                                        const RouteTreeNode& root) {
     for(auto& child: root.child_nodes()){
-        auto* meta = vpr::rr_edge_metadata(rr_graph_builder, size_t(root.inode), size_t(child.inode), size_t(child.parent_switch), fasm_features);
+        const t_metadata_value* meta = nullptr;
+        for(RREdgeId edge : rr_nodes.edge_range(root.inode)) {
+            if(rr_nodes.edge_sink_node(edge) == child.inode && size_t(rr_nodes.edge_switch(edge)) == size_t(child.parent_switch)) {
+                meta = edge_features[edge];
+                break;
+            }
+        }
 
         if(meta != nullptr) {
             output_fasm_features(meta->as_string().get(strings_), "", "");
         }
 
-        walk_route_tree(rr_graph_builder, child);
+        walk_route_tree(rr_nodes, edge_features, child);
+    }
+}
+
+void FasmWriterVisitor::walk_clbs() {
+    std::vector<std::string> clb_fasm(clbs_.size());
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), clbs_.size(), [&](size_t i) {
+#else
+    for (size_t i = 0; i < clbs_.size(); ++i) {
+#endif
+        std::ostringstream os;
+        FasmWriterVisitor visitor(*this, os);
+        NetlistWalker(visitor).walk_clb(clbs_[i]);
+        clb_fasm[i] = os.str();
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+
+    for(const auto &fasm : clb_fasm) {
+        os_ << fasm;
     }
 }
 
@@ -639,14 +744,38 @@ void FasmWriterVisitor::walk_routing() {
     auto& route_ctx = g_vpr_ctx.mutable_routing();
     const auto& device_ctx = g_vpr_ctx.device();
 
-    for(const auto &tree : route_ctx.route_trees) {
-        if (!tree) continue;
-        walk_route_tree(device_ctx.rr_graph_builder, tree.value().root());
+    // The FASM features of all the edges, looked up by the route tree walks instead of the edge metadata
+    const auto& rr_nodes = device_ctx.rr_graph.rr_nodes();
+    auto edge_features = vpr::rr_edge_metadata_table(device_ctx.rr_graph_builder, rr_nodes, fasm_features);
+
+    std::vector<std::string> net_fasm(route_ctx.route_trees.size());
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), route_ctx.route_trees.size(), [&](size_t i) {
+#else
+    for (size_t i = 0; i < route_ctx.route_trees.size(); ++i) {
+#endif
+        const auto &tree = route_ctx.route_trees[ParentNetId(i)];
+        if (tree) {
+            std::ostringstream os;
+            FasmWriterVisitor visitor(*this, os);
+            visitor.walk_route_tree(rr_nodes, edge_features, tree.value().root());
+            net_fasm[i] = os.str();
+        }
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+
+    for(const auto &fasm : net_fasm) {
+        os_ << fasm;
     }
 }
 
 
 void FasmWriterVisitor::finish_impl() {
+    walk_clbs();
     walk_routing();
 }
 
@@ -769,7 +898,7 @@ void FasmWriterVisitor::output_fasm_features(const std::string features, const s
       out_feature += clb_prefix;
       out_feature += feature;
       // Substitute tags
-      os_ << substitute_tags(out_feature, tags_) << std::endl;
+      os_ << substitute_tags(out_feature, tags_) << '\n';
     }
   }
 
@@ -11,11 +11,14 @@
 #include <iostream>
 #include <list>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <set>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "netlist_walker.h"
@@ -47,14 +50,24 @@ namespace fasm {
 // Once the netlist visitor is done, in finish_impl, the routing graph is
 // walked and static features are emitted via the fasm_features tag.
 //
-// Note that FASM features are incrementally written the ostream as they are
-// seen, so the order of FASM output is arbitrary based on the walk order of
-// the netlist and routing graph.
+// The visitor passed to the NetlistWalker only collects the CLBs.  In
+// finish_impl, each CLB is walked by its own cluster visitor writing to a
+// separate buffer (in parallel when VPR is built with TBB), and so is the
+// route tree of each net.  The buffers are then written to the ostream in
+// netlist order, so the FASM output is the same as that of a serial walk of
+// the netlist and routing.
+//
+// The cluster visitors share the FASM prefixes and LUT definitions memoized
+// by the parent visitor.
 class FasmWriterVisitor : public NetlistVisitor {
 
   public:
       FasmWriterVisitor(vtr::string_internment *strings, std::ostream& f, bool is_flat);
 
+  private:
+      // Cluster visitor, sharing the memoized data of parent.
+      FasmWriterVisitor(FasmWriterVisitor& parent, std::ostream& f);
+
   private:
       void visit_top_impl(const char* top_level_name) override;
       void visit_route_through_impl(const t_pb* atom) override;
@@ -72,10 +85,15 @@ class FasmWriterVisitor : public NetlistVisitor {
       void check_interconnect(const t_pb_routes &pb_route, int inode);
       void check_for_lut(const t_pb* atom);
       void output_fasm_mux(std::string fasm_mux, t_interconnect *interconnect, const t_pb_graph_pin *mux_input_pin);
+      void walk_clbs();
       void walk_routing();
-      void walk_route_tree(const RRGraphBuilder& rr_graph_builder, const RouteTreeNode& root);
+      void walk_route_tree(const t_rr_graph_storage& rr_nodes,
+                           const vtr::vector<RREdgeId, const t_metadata_value*>& edge_features,
+                           const RouteTreeNode& root);
       std::string build_clb_prefix(const t_pb *pb, const t_pb_graph_node* pb_graph_node, bool* is_parent_pb_null) const;
       const LutOutputDefinition* find_lut(const t_pb_graph_node* pb_graph_node);
+      const LutOutputDefinition* find_lut_uncached(const t_pb_graph_node* pb_graph_node);
+      const Parameters* find_params(const t_pb_type* pb_type, const t_metadata_dict* meta);
       void check_for_param(const t_pb *atom);
 
       // Walk from node to parents and search for a CLB prefix.
@@ -83,11 +101,18 @@ class FasmWriterVisitor : public NetlistVisitor {
         bool *have_prefix, std::string *clb_prefix) const;
       std::string handle_fasm_prefix(const t_metadata_dict *meta,
         const t_pb_graph_node *pb_graph_node, const t_pb_type *pb_type) const;
+      std::string handle_fasm_prefix_uncached(const t_metadata_dict *meta,
+        const t_pb_graph_node *pb_graph_node, const t_pb_type *pb_type) const;
       const t_metadata_dict *get_fasm_type(const t_pb_graph_node* pb_graph_node, std::string target_type) const;
 
       vtr::string_internment *strings_;
       std::ostream& os_;
 
+      // The visitor holding the memoized data: this one, or the parent of a cluster visitor.
+      FasmWriterVisitor* shared_ = this;
+      // CLBs to walk in finish_impl (parent visitor only).
+      std::vector<ClusterBlockId> clbs_;
+
       t_pb_graph_node *root_clb_ = nullptr;
       bool current_blk_has_prefix_ = false;
       t_physical_tile_type_ptr physical_tile_ = nullptr;
@@ -96,9 +121,14 @@ class FasmWriterVisitor : public NetlistVisitor {
       std::string clb_prefix_;
       std::map<const t_pb_graph_node *, std::string> clb_prefix_map_;
       ClusterBlockId current_blk_id_;
-      IntraLbPbPinLookup pb_graph_pin_lookup_from_index_by_type_;
+      std::shared_ptr<const IntraLbPbPinLookup> pb_graph_pin_lookup_from_index_by_type_;
+
+      // Memoized data, only used in shared_ and guarded by its cache_mutex_.
+      mutable std::shared_mutex cache_mutex_;
       std::map<const t_pb_type*, std::vector<std::pair<std::string, LutOutputDefinition>>> lut_definitions_;
+      std::unordered_map<const t_pb_graph_node*, const LutOutputDefinition*> pb_graph_node_luts_;
       std::map<const t_pb_type*, Parameters> parameters_;
+      mutable std::map<std::pair<const t_metadata_dict*, const t_pb_graph_node*>, std::string> fasm_prefixes_;
 
       std::map<const std::string, std::string> tags_;
 
@@ -10,7 +10,7 @@ void Parameters::AddParameter(const std::string &eblif_parameter, const std::str
     features_.insert(std::make_pair(eblif_parameter, fp));
 }
 
-std::string Parameters::EmitFasmFeature(const std::string &eblif_parameter, const std::string &value) {
+std::string Parameters::EmitFasmFeature(const std::string &eblif_parameter, const std::string &value) const {
     std::ostringstream out;
     auto range = features_.equal_range(eblif_parameter);
     for(auto i = range.first; i != range.second; ++i) {
@@ -13,7 +13,7 @@ class Parameters {
   void AddParameter(const std::string &eblif_parameter, const std::string &fasm_feature);
 
   // Return a FASM feature directive for the given parameter and value.
-  std::string EmitFasmFeature(const std::string &eblif_parameter, const std::string &value);
+  std::string EmitFasmFeature(const std::string &eblif_parameter, const std::string &value) const;
  private:
   struct FeatureParameter {
       size_t width;
@@ -296,7 +296,8 @@ TEST_CASE("fasm_integration_test", "[fasm]") {
                        device_ctx.virtual_clock_network_root_idx,
                        echo_enabled,
                        echo_file_name,
-                       is_flat);
+                       is_flat,
+                       false);
         vpr_free_all(arch, vpr_setup);
     }
 
@@ -7,17 +7,23 @@
 // used.
 //
 // Tool can either perform one route between a source (--source_rr_node) and
-// a sink (--sink_rr_node), or profile a source to all tiles (set
-// --source_rr_node and "--profile_source true").
+// a sink (--sink_rr_node), profile a source to all tiles (set
+// --source_rr_node and "--profile_source true"), or profile a batch of
+// source/sink pairs listed in a file (--profile_pairs).
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
 #include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
 
 #include "vtr_error.h"
 #include "vtr_memory.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
+#include "vtr_random.h"
 
 #include "tatum/error.hpp"
 
@@ -39,11 +45,18 @@
 #include "rr_graph2.h"
 #include "timing_place_lookup.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/enumerable_thread_specific.h>
+#    include <tbb/parallel_for.h>
+#endif
+
 struct t_route_util_options {
     /* Router diag tool Options */
     argparse::ArgValue<int> source_rr_node;
     argparse::ArgValue<int> sink_rr_node;
     argparse::ArgValue<bool> profile_source;
+    argparse::ArgValue<std::string> profile_pairs;
+    argparse::ArgValue<std::string> profile_pairs_csv;
 
     t_options options;
 };
@@ -98,6 +111,7 @@ static void do_one_route(const Netlist<>& net_list,
     RouterStats router_stats;
     auto router_lookahead = make_router_lookahead(det_routing_arch,
                                                   router_opts.lookahead_type,
+                                                  router_opts.base_cost_type,
                                                   router_opts.write_router_lookahead,
                                                   router_opts.read_router_lookahead,
                                                   segment_inf,
@@ -110,7 +124,7 @@ static void do_one_route(const Netlist<>& net_list,
             &device_ctx.rr_graph,
             device_ctx.rr_rc_data,
             device_ctx.rr_graph.rr_switch(),
-            g_vpr_ctx.mutable_routing().rr_node_route_inf,
+            g_vpr_ctx.mutable_routing().rr_node_path_inf,
             is_flat);
     enable_router_debug(router_opts, ParentNetId(), sink_node, 1, &router);
     bool found_path;
@@ -164,6 +178,7 @@ static void profile_source(const Netlist<>& net_list,
 
     auto router_lookahead = make_router_lookahead(det_routing_arch,
                                                   router_opts.lookahead_type,
+                                                  router_opts.base_cost_type,
                                                   router_opts.write_router_lookahead,
                                                   router_opts.read_router_lookahead,
                                                   segment_inf,
@@ -240,6 +255,184 @@ static void profile_source(const Netlist<>& net_list,
     VTR_LOG("\n");
 }
 
+struct t_profile_pair {
+    RRNodeId source;
+    RRNodeId sink;
+};
+
+struct t_profile_pair_result {
+    bool routed = false;
+    float delay = std::numeric_limits<float>::quiet_NaN();
+    size_t heap_pops = 0;
+    size_t heap_pushes = 0;
+};
+
+#ifdef VPR_USE_TBB
+// A delay profiler with its own copy of the path search state, so that each thread can route independently
+struct t_thread_delay_profiler {
+    t_thread_delay_profiler(const Netlist<>& net_list, const RouterLookahead* lookahead, bool is_flat)
+        : rr_node_path_inf(g_vpr_ctx.routing().rr_node_path_inf)
+        , profiler(net_list, lookahead, is_flat, &rr_node_path_inf) {}
+
+    vtr::vector<RRNodeId, t_rr_node_path_inf> rr_node_path_inf;
+    RouterDelayProfiler profiler;
+};
+#endif
+
+// Reads the source/sink pairs to profile. Each line of pairs_file is either
+// '<source_rr_node> <sink_rr_node>', or 'sample <num_pairs> [<seed>]' for
+// num_pairs random pairs of a SOURCE and a SINK of the RR graph. '#' starts a
+// comment.
+static std::vector<t_profile_pair> read_profile_pairs(const std::string& pairs_file) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+
+    std::ifstream is(pairs_file);
+    if (!is) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to open profile pairs file '%s'\n", pairs_file.c_str());
+    }
+
+    //The SOURCEs and SINKs of the RR graph, collected for the first sampling spec
+    std::vector<RRNodeId> sources;
+    std::vector<RRNodeId> sinks;
+
+    std::vector<t_profile_pair> pairs;
+    std::string line;
+    for (int line_num = 1; std::getline(is, line); ++line_num) {
+        std::string content = line.substr(0, line.find('#'));
+        std::istringstream line_is(content);
+
+        std::string first;
+        if (!(line_is >> first)) {
+            continue; //Blank or comment line
+        }
+
+        if (first == "sample") {
+            int num_pairs;
+            if (!(line_is >> num_pairs) || num_pairs < 0) {
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER, "%s:%d: Expected 'sample <num_pairs> [<seed>]'\n", pairs_file.c_str(), line_num);
+            }
+            unsigned seed = 0;
+            line_is >> seed;
+
+            if (sources.empty()) {
+                for (RRNodeId node : rr_graph.nodes()) {
+                    if (rr_graph.node_type(node) == SOURCE) {
+                        sources.push_back(node);
+                    } else if (rr_graph.node_type(node) == SINK) {
+                        sinks.push_back(node);
+                    }
+                }
+            }
+            if (sources.empty() || sinks.empty()) {
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER, "%s:%d: The RR graph has no SOURCE/SINK pairs to sample\n", pairs_file.c_str(), line_num);
+            }
+
+            vtr::RandomNumberGenerator rng(seed);
+            for (int ipair = 0; ipair < num_pairs; ++ipair) {
+                RRNodeId source = sources[rng.irand(sources.size() - 1)];
+                RRNodeId sink = sinks[rng.irand(sinks.size() - 1)];
+                pairs.push_back({source, sink});
+            }
+        } else {
+            std::istringstream pair_is(content);
+            int source_rr_node;
+            int sink_rr_node;
+            if (!(pair_is >> source_rr_node >> sink_rr_node)) {
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER, "%s:%d: Expected '<source_rr_node> <sink_rr_node>'\n", pairs_file.c_str(), line_num);
+            }
+            for (int rr_node : {source_rr_node, sink_rr_node}) {
+                if (rr_node < 0 || size_t(rr_node) >= rr_graph.num_nodes()) {
+                    VPR_FATAL_ERROR(VPR_ERROR_OTHER, "%s:%d: Invalid RR node %d\n", pairs_file.c_str(), line_num, rr_node);
+                }
+            }
+            pairs.push_back({RRNodeId(source_rr_node), RRNodeId(sink_rr_node)});
+        }
+    }
+
+    return pairs;
+}
+
+// Profiles the delay of each pair of pairs_file, and writes it to csv_file with the
+// number of nodes the router pushed to and popped from the heap. The pairs are
+// profiled in parallel when VPR is built with TBB.
+static void profile_pairs(const Netlist<>& net_list,
+                          const t_det_routing_arch& det_routing_arch,
+                          const std::string& pairs_file,
+                          const std::string& csv_file,
+                          const t_router_opts& router_opts,
+                          const std::vector<t_segment_inf>& segment_inf,
+                          bool is_flat) {
+    vtr::ScopedStartFinishTimer timer("Profiling source/sink pairs");
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+
+    std::vector<t_profile_pair> pairs = read_profile_pairs(pairs_file);
+
+    auto router_lookahead = make_router_lookahead(det_routing_arch,
+                                                  router_opts.lookahead_type,
+                                                  router_opts.base_cost_type,
+                                                  router_opts.write_router_lookahead,
+                                                  router_opts.read_router_lookahead,
+                                                  segment_inf,
+                                                  is_flat);
+
+    //Set the base costs up front, so that the concurrent profilers only read them
+    update_rr_base_costs(1);
+
+    std::vector<t_profile_pair_result> results(pairs.size());
+
+#ifdef VPR_USE_TBB
+    tbb::enumerable_thread_specific<std::unique_ptr<t_thread_delay_profiler>> thread_profilers;
+    tbb::parallel_for(size_t(0), pairs.size(), [&](size_t ipair) {
+        auto& thread_profiler = thread_profilers.local();
+        if (!thread_profiler) {
+            thread_profiler = std::make_unique<t_thread_delay_profiler>(net_list, router_lookahead.get(), is_flat);
+        }
+        RouterDelayProfiler& profiler = thread_profiler->profiler;
+#else
+    RouterDelayProfiler profiler(net_list, router_lookahead.get(), is_flat);
+    for (size_t ipair = 0; ipair < pairs.size(); ++ipair) {
+#endif
+        t_profile_pair_result& result = results[ipair];
+        result.routed = profiler.calculate_delay(pairs[ipair].source,
+                                                 pairs[ipair].sink,
+                                                 router_opts,
+                                                 &result.delay,
+                                                 OPEN);
+        result.heap_pops = profiler.router_stats().heap_pops;
+        result.heap_pushes = profiler.router_stats().heap_pushes;
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+
+    std::ofstream os(csv_file);
+    if (!os) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to open profile pairs CSV file '%s'\n", csv_file.c_str());
+    }
+
+    size_t num_routed = 0;
+    os << "source_rr_node,sink_rr_node,source_x,source_y,source_layer,sink_x,sink_y,sink_layer,routed,delay,heap_pops,heap_pushes\n";
+    for (size_t ipair = 0; ipair < pairs.size(); ++ipair) {
+        RRNodeId source = pairs[ipair].source;
+        RRNodeId sink = pairs[ipair].sink;
+        const t_profile_pair_result& result = results[ipair];
+
+        os << size_t(source) << ',' << size_t(sink) << ','
+           << rr_graph.node_xlow(source) << ',' << rr_graph.node_ylow(source) << ',' << rr_graph.node_layer(source) << ','
+           << rr_graph.node_xlow(sink) << ',' << rr_graph.node_ylow(sink) << ',' << rr_graph.node_layer(sink) << ','
+           << result.routed << ',';
+        if (result.routed) {
+            os << vtr::string_fmt("%g", result.delay);
+            ++num_routed;
+        }
+        os << ',' << result.heap_pops << ',' << result.heap_pushes << '\n';
+    }
+
+    VTR_LOG("Routed %zu of %zu source/sink pairs, wrote their delays to '%s'\n",
+            num_routed, pairs.size(), csv_file.c_str());
+}
+
 static t_chan_width setup_chan_width(t_router_opts router_opts,
         t_chan_width_dist chan_width_dist) {
     /*we give plenty of tracks, this increases routability for the */
@@ -287,6 +480,17 @@ t_route_util_options read_route_util_options(int argc, const char** argv) {
             "Profile routes from source to IPINs at all locations."
             "This is similiar to the placer delay matrix construction.")
         .show_in(argparse::ShowIn::HELP_ONLY);
+    route_diag_grp.add_argument(args.profile_pairs, "--profile_pairs")
+        .help(
+            "Profile the delay of each source/sink pair listed in the specified file."
+            " Each line is either '<source_rr_node> <sink_rr_node>', or"
+            " 'sample <num_pairs> [<seed>]' for random SOURCE/SINK pairs ('#' starts a comment)."
+            " The pairs are profiled in parallel when VPR is built with TBB.")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+    route_diag_grp.add_argument(args.profile_pairs_csv, "--profile_pairs_csv")
+        .help("CSV file --profile_pairs writes the delays and router heap pushes/pops of the pairs to.")
+        .default_value("route_diag_pairs.csv")
+        .show_in(argparse::ShowIn::HELP_ONLY);
 
     parser.parse_args(argc, argv);
 
@@ -338,7 +542,15 @@ int main(int argc, const char **argv) {
             Arch.num_directs,
             is_flat);
 
-        if(route_options.profile_source) {
+        if (!route_options.profile_pairs.value().empty()) {
+            profile_pairs(net_list,
+                          vpr_setup.RoutingArch,
+                          route_options.profile_pairs.value(),
+                          route_options.profile_pairs_csv.value(),
+                          vpr_setup.RouterOpts,
+                          vpr_setup.Segments,
+                          is_flat);
+        } else if(route_options.profile_source) {
             profile_source(net_list,
                            vpr_setup.RoutingArch,
                            RRNodeId(route_options.source_rr_node),
@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "route_tree.h"
+#include "vpr_types.h"
+#include "vtr_arena.h"
+
+namespace {
+
+constexpr size_t kNumObjects = 100000;
+
+/*
+ * Mimics the router building and ripping up route trees: allocates kNumObjects
+ * objects of the given size, then frees them in a scrambled order.
+ */
+template<typename Alloc, typename Free>
+size_t alloc_free(size_t size, const std::vector<size_t>& free_order, Alloc alloc, Free free) {
+    std::vector<void*> ptrs(kNumObjects);
+    for (void*& ptr : ptrs) {
+        ptr = alloc(size);
+        *static_cast<char*>(ptr) = 0; //Touch it
+    }
+    for (size_t i : free_order) {
+        free(ptrs[i], size);
+    }
+    return ptrs.size();
+}
+
+//Small object allocation throughput. Run with: vpr_bench "[alloc]"
+TEST_CASE("bench_alloc", "[alloc]") {
+    std::vector<size_t> free_order(kNumObjects);
+    for (size_t i = 0; i < kNumObjects; ++i) {
+        free_order[i] = i;
+    }
+    std::shuffle(free_order.begin(), free_order.end(), std::minstd_rand(1));
+
+    BENCHMARK("operator new (RouteTreeNode sized)") {
+        return alloc_free(
+            sizeof(RouteTreeNode), free_order,
+            [](size_t size) { return ::operator new(size); },
+            [](void* ptr, size_t /*size*/) { ::operator delete(ptr); });
+    };
+
+    BENCHMARK("vtr::Arena (RouteTreeNode sized)") {
+        return alloc_free(
+            sizeof(RouteTreeNode), free_order,
+            [](size_t size) { return vtr::Arena::allocate(size); },
+            [](void* ptr, size_t size) { vtr::Arena::deallocate(ptr, size); });
+    };
+
+    //As the packer allocates child pb arrays
+    std::vector<size_t> pb_free_order(kNumObjects / 10);
+    for (size_t i = 0; i < pb_free_order.size(); ++i) {
+        pb_free_order[i] = i;
+    }
+    std::shuffle(pb_free_order.begin(), pb_free_order.end(), std::minstd_rand(1));
+
+    BENCHMARK("t_pb arrays") {
+        std::vector<t_pb*> pbs(pb_free_order.size());
+        for (t_pb*& pb : pbs) {
+            pb = new t_pb[4];
+        }
+        for (size_t i : pb_free_order) {
+            delete[] pbs[i];
+        }
+        return pbs.size();
+    };
+}
+
+} // namespace
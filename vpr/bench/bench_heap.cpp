@@ -0,0 +1,87 @@
+#include <random>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "binary_heap.h"
+#include "bucket.h"
+#include "four_ary_heap.h"
+#include "device_grid.h"
+
+namespace {
+
+constexpr size_t kNumNodes = 100000;
+constexpr size_t kNumPops = 20000;
+constexpr size_t kFanout = 4;
+
+//Cost increments (in seconds) typical of the delays the router pushes
+std::vector<float> make_cost_deltas(size_t num_deltas) {
+    std::minstd_rand rng(1);
+    std::uniform_real_distribution<float> dist(1e-11, 1e-9);
+    std::vector<float> deltas(num_deltas);
+    for (float& delta : deltas) {
+        delta = dist(rng);
+    }
+    return deltas;
+}
+
+/*
+ * Mimics a router wave expansion: each popped element pushes kFanout
+ * neighbours (pseudo-randomly chosen from kNumNodes) at a slightly higher cost.
+ */
+template<typename Heap>
+size_t wave_expansion(Heap& heap, const DeviceGrid& grid, const std::vector<float>& deltas) {
+    heap.init_heap(grid);
+    heap.set_prune_limit(kNumNodes, kNumNodes * 4);
+
+    t_heap* root = heap.alloc();
+    root->index = RRNodeId(0);
+    root->cost = 0.;
+    heap.add_to_heap(root);
+
+    size_t num_pops = 0;
+    size_t idelta = 0;
+    while (num_pops < kNumPops && !heap.is_empty_heap()) {
+        t_heap* head = heap.get_heap_head();
+        ++num_pops;
+
+        for (size_t i = 0; i < kFanout; ++i) {
+            t_heap* next = heap.alloc();
+            next->index = RRNodeId((size_t(head->index) * kFanout + i + 1) % kNumNodes);
+            next->cost = head->cost + deltas[idelta];
+            idelta = (idelta + 1) % deltas.size();
+            heap.add_to_heap(next);
+        }
+        heap.free(head);
+    }
+    heap.empty_heap();
+    return num_pops;
+}
+
+//Heap push/pop throughput on a router-like workload. Run with: vpr_bench "[heap]"
+TEST_CASE("bench_heap_push_pop", "[heap]") {
+    //The heaps only size themselves from the grid dimensions
+    t_physical_tile_type tile_type;
+    t_grid_tile tile;
+    tile.type = &tile_type;
+    DeviceGrid grid("bench", vtr::NdMatrix<t_grid_tile, 3>({1, 100, 100}, tile));
+    std::vector<float> deltas = make_cost_deltas(1 << 16);
+
+    BinaryHeap binary_heap;
+    BENCHMARK("BinaryHeap") {
+        return wave_expansion(binary_heap, grid, deltas);
+    };
+
+    FourAryHeap four_ary_heap;
+    BENCHMARK("FourAryHeap") {
+        return wave_expansion(four_ary_heap, grid, deltas);
+    };
+
+    Bucket bucket;
+    BENCHMARK("Bucket") {
+        return wave_expansion(bucket, grid, deltas);
+    };
+}
+
+} // namespace
@@ -0,0 +1,116 @@
+/**
+ * @file
+ * @brief A Catch2 reporter which writes benchmark results as JSON
+ *
+ * The VPR microbenchmarks are Catch2 BENCHMARKs, which are all run by:
+ *
+ *      vpr_bench --reporter json --out vpr_bench.json
+ *
+ * (from the vpr/bench directory, as the benchmarks load their inputs from
+ * paths relative to it). A subset is selected with the usual Catch2 test
+ * specifications, e.g. 'vpr_bench "[heap]"'.
+ *
+ * Each benchmark is reported with the mean and standard deviation of its
+ * samples (in nanoseconds), along with the VPR version and build info, so
+ * results from different releases can be compared directly.
+ */
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "catch2/reporters/catch_reporter_registrars.hpp"
+#include "catch2/reporters/catch_reporter_streaming_base.hpp"
+#include "catch2/catch_test_case_info.hpp"
+
+#include "vtr_version.h"
+
+namespace {
+
+std::string json_string(const std::string& str) {
+    std::string escaped = "\"";
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+            escaped += buf;
+        } else {
+            escaped += c;
+        }
+    }
+    escaped += '"';
+    return escaped;
+}
+
+template<typename Duration>
+double to_ns(Duration duration) {
+    return std::chrono::duration<double, std::nano>(duration).count();
+}
+
+class JsonBenchmarkReporter : public Catch::StreamingReporterBase {
+  public:
+    JsonBenchmarkReporter(Catch::ReporterConfig const& config)
+        : StreamingReporterBase(config) {}
+
+    static std::string getDescription() {
+        return "Reports benchmark results as JSON";
+    }
+
+    void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override {
+        char buf[512];
+        std::snprintf(buf, sizeof(buf),
+                      "\"iterations\": %d, \"samples\": %d, \"mean_ns\": %.6g, \"mean_lower_ns\": %.6g, \"mean_upper_ns\": %.6g, "
+                      "\"stddev_ns\": %.6g, \"outlier_variance\": %.6g",
+                      stats.info.iterations, stats.info.samples,
+                      to_ns(stats.mean.point), to_ns(stats.mean.lower_bound), to_ns(stats.mean.upper_bound),
+                      to_ns(stats.standardDeviation.point), stats.outlierVariance);
+        add_result(stats.info.name, buf);
+    }
+
+    void benchmarkFailed(Catch::StringRef error) override {
+        add_result(current_benchmark_, "\"error\": " + json_string(std::string(error)));
+    }
+
+    void benchmarkPreparing(Catch::StringRef name) override {
+        current_benchmark_ = std::string(name);
+    }
+
+    void testRunEnded(Catch::TestRunStats const& stats) override {
+        char date[64] = "";
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+        m_stream << "{\n"
+                 << "  \"context\": {\n"
+                 << "    \"date\": " << json_string(date) << ",\n"
+                 << "    \"vpr_version\": " << json_string(vtr::VERSION) << ",\n"
+                 << "    \"vpr_revision\": " << json_string(vtr::VCS_REVISION) << ",\n"
+                 << "    \"vpr_compiler\": " << json_string(vtr::COMPILER) << ",\n"
+                 << "    \"vpr_build_info\": " << json_string(vtr::BUILD_INFO) << "\n"
+                 << "  },\n"
+                 << "  \"benchmarks\": [";
+        for (size_t i = 0; i < results_.size(); ++i) {
+            m_stream << (i == 0 ? "\n" : ",\n") << "    " << results_[i];
+        }
+        m_stream << "\n  ]\n}\n";
+        StreamingReporterBase::testRunEnded(stats);
+    }
+
+  private:
+    void add_result(const std::string& name, const std::string& fields) {
+        std::string test_case = currentTestCaseInfo ? currentTestCaseInfo->name : "";
+        results_.push_back("{\"name\": " + json_string(test_case + "/" + name) + ", " + fields + "}");
+    }
+
+    std::string current_benchmark_;
+    std::vector<std::string> results_;
+};
+
+} // namespace
+
+CATCH_REGISTER_REPORTER("json", JsonBenchmarkReporter)
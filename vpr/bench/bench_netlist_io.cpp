@@ -0,0 +1,98 @@
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "vpr_api.h"
+#include "vpr_signal_handler.h"
+#include "globals.h"
+#include "read_blif.h"
+#include "read_netlist.h"
+
+namespace {
+
+static constexpr const char kArchFile[] = "../../vtr_flow/arch/timing/k6_frac_N10_mem32K_40nm.xml";
+static constexpr const char kCircuitFile[] = "bench_circuit.blif";
+static constexpr const char kNetFile[] = "bench_circuit.net";
+
+constexpr size_t kNumInputs = 64;
+constexpr size_t kNumLuts = 5000;
+constexpr size_t kLutInputs = 4;
+
+//Writes a deterministic network of kNumLuts 4-LUTs, each driven by earlier signals
+void write_canned_circuit(const char* file) {
+    std::minstd_rand rng(1);
+    std::ofstream os(file);
+
+    os << ".model bench\n.inputs";
+    for (size_t i = 0; i < kNumInputs; ++i) {
+        os << " i" << i;
+    }
+    os << " clk\n.outputs";
+    for (size_t i = 0; i < kNumInputs; ++i) {
+        os << " o" << i;
+    }
+    os << "\n";
+
+    auto signal = [](size_t isig) {
+        return isig < kNumInputs ? "i" + std::to_string(isig) : "n" + std::to_string(isig - kNumInputs);
+    };
+    for (size_t ilut = 0; ilut < kNumLuts; ++ilut) {
+        std::uniform_int_distribution<size_t> dist(0, kNumInputs + ilut - 1);
+        os << ".names";
+        for (size_t iin = 0; iin < kLutInputs; ++iin) {
+            os << " " << signal(dist(rng));
+        }
+        os << " n" << ilut << "\n11-- 1\n--11 1\n";
+    }
+
+    //Register the last LUTs onto the outputs
+    for (size_t i = 0; i < kNumInputs; ++i) {
+        os << ".latch n" << kNumLuts - 1 - i << " o" << i << " re clk 0\n";
+    }
+    os << ".end\n";
+}
+
+//Parsing of the circuit (BLIF) and packed netlist (.net XML) files. Run with: vpr_bench "[netlist_io]"
+TEST_CASE("bench_netlist_io", "[netlist_io]") {
+    write_canned_circuit(kCircuitFile);
+
+    auto options = t_options();
+    auto arch = t_arch();
+    auto vpr_setup = t_vpr_setup();
+
+    vpr_install_signal_handler();
+    vpr_initialize_logging();
+
+    const char* argv[] = {
+        "vpr_bench",
+        kArchFile,
+        kCircuitFile,
+        "--net_file", kNetFile,
+        "--pack"};
+    vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+             &options, &vpr_setup, &arch);
+    REQUIRE(vpr_pack_flow(vpr_setup, arch));
+
+    BENCHMARK("read_blif") {
+        return read_blif(e_circuit_format::BLIF, kCircuitFile, arch.models, arch.model_library).blocks().size();
+    };
+
+    BENCHMARK("read_netlist") {
+        return read_netlist(kNetFile, &arch, false, 0).blocks().size();
+    };
+
+    vpr_free_all(arch, vpr_setup);
+
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+    free_pack_molecules(atom_ctx.list_of_pack_molecules.release());
+    atom_ctx.atom_molecules.clear();
+
+    std::remove(kCircuitFile);
+    std::remove(kNetFile);
+}
+
+} // namespace
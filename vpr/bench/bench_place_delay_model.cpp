@@ -0,0 +1,55 @@
+#include <random>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "place_delay_model.h"
+
+namespace {
+
+constexpr size_t kGridDim = 100;
+constexpr size_t kNumQueries = 1 << 14;
+
+//Random source/sink locations on a kGridDim x kGridDim single layer device
+std::vector<t_physical_tile_loc> make_locs(size_t num_locs) {
+    std::minstd_rand rng(1);
+    std::uniform_int_distribution<int> dist(0, kGridDim - 1);
+    std::vector<t_physical_tile_loc> locs;
+    for (size_t i = 0; i < num_locs; ++i) {
+        locs.emplace_back(dist(rng), dist(rng), 0);
+    }
+    return locs;
+}
+
+//The delay look-ups performed by the placer's timing cost updates. Run with: vpr_bench "[place_delay_model]"
+TEST_CASE("bench_place_delay_model", "[place_delay_model]") {
+    vtr::NdMatrix<float, 3> delays({1, kGridDim, kGridDim});
+    for (size_t x = 0; x < kGridDim; ++x) {
+        for (size_t y = 0; y < kGridDim; ++y) {
+            delays[0][x][y] = 1e-10 * (x + y + 1);
+        }
+    }
+    DeltaDelayModel model(0., std::move(delays), false);
+
+    std::vector<t_physical_tile_loc> from_locs = make_locs(kNumQueries);
+    std::vector<t_physical_tile_loc> to_locs = make_locs(kNumQueries + 1);
+    to_locs.erase(to_locs.begin());
+    std::vector<int> to_pins(kNumQueries, 0);
+
+    BENCHMARK("DeltaDelayModel::delay") {
+        float total = 0.;
+        for (size_t i = 0; i < kNumQueries; ++i) {
+            total += model.delay(from_locs[i], 0, to_locs[i], 0);
+        }
+        return total;
+    };
+
+    std::vector<float> sink_delays;
+    BENCHMARK("DeltaDelayModel::delay (batched sinks)") {
+        model.delay(from_locs[0], 0, to_locs, to_pins, sink_delays);
+        return sink_delays.back();
+    };
+}
+
+} // namespace
@@ -0,0 +1,169 @@
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "rr_graph_fwd.h"
+#include "vpr_api.h"
+#include "vpr_signal_handler.h"
+#include "globals.h"
+#include "place_and_route.h"
+#include "connection_router.h"
+#include "router_lookahead.h"
+#include "binary_heap.h"
+#include "route_timing.h"
+#include "router_delay_profiling.h"
+
+static constexpr const char kArchFile[] = "../../vtr_flow/arch/timing/k6_frac_N10_mem32K_40nm.xml";
+static constexpr int kMaxHops = 10;
+static constexpr size_t kNumLookaheadQueries = 1 << 14;
+
+namespace {
+
+//Finds the source and sink of the longest walk (of up to kMaxHops first edges) through the RR graph
+std::tuple<RRNodeId, RRNodeId> find_source_and_sink() {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+
+    std::tuple<RRNodeId, RRNodeId, int> longest(RRNodeId::INVALID(), RRNodeId::INVALID(), 0);
+    for (size_t id = 0; id < rr_graph.num_nodes(); id++) {
+        RRNodeId source(id), sink = source;
+        for (int hops = 0; hops < kMaxHops; hops++) {
+            auto edge = rr_graph.node_first_edge(sink);
+            if (edge == rr_graph.node_last_edge(sink)) {
+                break;
+            }
+            sink = rr_graph.rr_nodes().edge_sink_node(edge);
+            if (hops > std::get<2>(longest)) {
+                longest = std::make_tuple(source, sink, hops);
+            }
+        }
+    }
+    return std::make_tuple(std::get<0>(longest), std::get<1>(longest));
+}
+
+//Single connection routing and lookahead queries on a fixed architecture. Run with: vpr_bench "[route]"
+TEST_CASE("bench_route", "[route]") {
+    auto options = t_options();
+    auto arch = t_arch();
+    auto vpr_setup = t_vpr_setup();
+
+    vpr_install_signal_handler();
+    vpr_initialize_logging();
+
+    const char* argv[] = {
+        "vpr_bench",
+        kArchFile,
+        "../test/wire.eblif",
+        "--route_chan_width", "100",
+        "--router_lookahead", "map"};
+    vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+             &options, &vpr_setup, &arch);
+
+    vpr_create_device_grid(vpr_setup, arch);
+    vpr_setup_clock_networks(vpr_setup, arch);
+    auto& router_opts = vpr_setup.RouterOpts;
+    auto& det_routing_arch = vpr_setup.RoutingArch;
+    bool is_flat = router_opts.flat_routing;
+
+    t_graph_type graph_directionality = det_routing_arch.directionality == BI_DIRECTIONAL ? GRAPH_BIDIR : GRAPH_UNIDIR;
+    auto chan_width = init_chan(router_opts.fixed_channel_width, arch.Chans, graph_directionality);
+    alloc_routing_structs(chan_width, router_opts, &det_routing_arch, vpr_setup.Segments,
+                          arch.Directs, arch.num_directs, is_flat);
+    update_rr_base_costs(1);
+
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto router_lookahead = make_router_lookahead(det_routing_arch,
+                                                  router_opts.lookahead_type,
+                                                  router_opts.base_cost_type,
+                                                  router_opts.write_router_lookahead,
+                                                  router_opts.read_router_lookahead,
+                                                  vpr_setup.Segments,
+                                                  is_flat);
+
+    t_conn_cost_params cost_params;
+    cost_params.criticality = router_opts.max_criticality;
+    cost_params.astar_fac = router_opts.astar_fac;
+    cost_params.bend_cost = router_opts.bend_cost;
+
+    {
+        ConnectionRouter<BinaryHeap> router(
+            device_ctx.grid,
+            *router_lookahead,
+            rr_graph.rr_nodes(),
+            &rr_graph,
+            device_ctx.rr_rc_data,
+            rr_graph.rr_switch(),
+            g_vpr_ctx.mutable_routing().rr_node_path_inf,
+            is_flat);
+
+        RRNodeId source_node, sink_node;
+        std::tie(source_node, sink_node) = find_source_and_sink();
+        REQUIRE(source_node != sink_node);
+
+        t_bb bounding_box;
+        bounding_box.xmin = 0;
+        bounding_box.xmax = device_ctx.grid.width() + 1;
+        bounding_box.ymin = 0;
+        bounding_box.ymax = device_ctx.grid.height() + 1;
+        bounding_box.layer_min = 0;
+        bounding_box.layer_max = device_ctx.grid.get_num_layers() - 1;
+
+        ConnectionParameters conn_params(ParentNetId::INVALID(),
+                                         -1,
+                                         false,
+                                         std::unordered_map<RRNodeId, int>());
+        RouterStats router_stats;
+        BENCHMARK("ConnectionRouter<BinaryHeap> single connection") {
+            RouteTree tree(source_node);
+            bool found_path = std::get<0>(router.timing_driven_route_connection_from_route_tree(tree.root(),
+                                                                                                sink_node,
+                                                                                                cost_params,
+                                                                                                bounding_box,
+                                                                                                router_stats,
+                                                                                                conn_params,
+                                                                                                true));
+            router.reset_path_costs();
+            return found_path;
+        };
+    }
+
+    //Lookahead queries from wires towards (pseudo-random) sinks
+    std::vector<RRNodeId> wires;
+    std::vector<RRNodeId> sinks;
+    for (size_t id = 0; id < rr_graph.num_nodes(); id++) {
+        RRNodeId node(id);
+        t_rr_type type = rr_graph.node_type(node);
+        if (type == CHANX || type == CHANY) {
+            wires.push_back(node);
+        } else if (type == SINK) {
+            sinks.push_back(node);
+        }
+    }
+    REQUIRE(!wires.empty());
+    REQUIRE(!sinks.empty());
+
+    std::minstd_rand rng(1);
+    std::vector<std::pair<RRNodeId, RRNodeId>> queries;
+    for (size_t i = 0; i < kNumLookaheadQueries; ++i) {
+        queries.emplace_back(wires[rng() % wires.size()], sinks[rng() % sinks.size()]);
+    }
+    BENCHMARK("MapLookahead::get_expected_cost") {
+        float total = 0.;
+        for (const auto& query : queries) {
+            total += router_lookahead->get_expected_cost(query.first, query.second, cost_params, 0.);
+        }
+        return total;
+    };
+
+    free_routing_structs();
+    vpr_free_all(arch, vpr_setup);
+
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+    free_pack_molecules(atom_ctx.list_of_pack_molecules.release());
+    atom_ctx.atom_molecules.clear();
+}
+
+} // namespace
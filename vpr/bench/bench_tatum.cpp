@@ -0,0 +1,107 @@
+#include <random>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/TimingConstraints.hpp"
+#include "tatum/analyzer_factory.hpp"
+#include "tatum/graph_walkers.hpp"
+#include "tatum/delay_calc/FixedDelayCalculator.hpp"
+
+namespace {
+
+constexpr size_t kNumInputs = 256;
+constexpr size_t kLevels = 32;
+constexpr size_t kLutsPerLevel = 1024;
+constexpr size_t kLutInputs = 4;
+constexpr size_t kNumInvalidatedEdges = 100;
+
+///@brief A synthetic levelized LUT network, with I/O constrained on a single (virtual) clock
+struct t_bench_timing_graph {
+    tatum::TimingGraph graph;
+    tatum::TimingConstraints constraints;
+    std::vector<tatum::EdgeId> interconnect_edges;
+};
+
+void make_timing_graph(t_bench_timing_graph& tg) {
+    std::minstd_rand rng(1);
+    tatum::DomainId clk = tg.constraints.create_clock_domain("clk");
+    tg.constraints.set_setup_constraint(clk, clk, tatum::Time(5e-9));
+
+    //Drivers of the previous level (initially the primary inputs)
+    std::vector<tatum::NodeId> drivers;
+    for (size_t i = 0; i < kNumInputs; ++i) {
+        tatum::NodeId source = tg.graph.add_node(tatum::NodeType::SOURCE);
+        tg.constraints.set_input_constraint(source, clk, tatum::DelayType::MAX, tatum::Time(0.));
+        drivers.push_back(source);
+    }
+
+    for (size_t level = 0; level < kLevels; ++level) {
+        std::uniform_int_distribution<size_t> driver_dist(0, drivers.size() - 1);
+        std::vector<tatum::NodeId> outputs;
+        for (size_t ilut = 0; ilut < kLutsPerLevel; ++ilut) {
+            tatum::NodeId opin = tg.graph.add_node(tatum::NodeType::OPIN);
+            for (size_t iin = 0; iin < kLutInputs; ++iin) {
+                tatum::NodeId ipin = tg.graph.add_node(tatum::NodeType::IPIN);
+                tg.interconnect_edges.push_back(tg.graph.add_edge(tatum::EdgeType::INTERCONNECT, drivers[driver_dist(rng)], ipin));
+                tg.graph.add_edge(tatum::EdgeType::PRIMITIVE_COMBINATIONAL, ipin, opin);
+            }
+            outputs.push_back(opin);
+        }
+        drivers = std::move(outputs);
+    }
+
+    for (tatum::NodeId driver : drivers) {
+        tatum::NodeId sink = tg.graph.add_node(tatum::NodeType::SINK);
+        tg.graph.add_edge(tatum::EdgeType::INTERCONNECT, driver, sink);
+        tg.constraints.set_output_constraint(sink, clk, tatum::DelayType::MAX, tatum::Time(0.));
+    }
+
+    tg.graph.levelize();
+}
+
+tatum::FixedDelayCalculator make_delay_calculator(const tatum::TimingGraph& graph) {
+    std::minstd_rand rng(2);
+    std::uniform_real_distribution<double> dist(50e-12, 500e-12);
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> max_delays(graph.edges().size());
+    for (tatum::EdgeId edge : graph.edges()) {
+        max_delays[edge] = tatum::Time(dist(rng));
+    }
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> setup_times(graph.edges().size(), tatum::Time(0.));
+    return tatum::FixedDelayCalculator(max_delays, setup_times);
+}
+
+//Full and incremental setup analysis of a ~160K node timing graph. Run with: vpr_bench "[tatum]"
+TEST_CASE("bench_tatum_setup_analysis", "[tatum]") {
+    t_bench_timing_graph tg;
+    make_timing_graph(tg);
+    tatum::FixedDelayCalculator delay_calc = make_delay_calculator(tg.graph);
+
+    auto serial_analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, tatum::SerialWalker>::make(tg.graph, tg.constraints, delay_calc);
+    BENCHMARK("full serial") {
+        serial_analyzer->update_timing();
+    };
+
+    auto parallel_analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, tatum::ParallelWalker>::make(tg.graph, tg.constraints, delay_calc);
+    BENCHMARK("full parallel") {
+        parallel_analyzer->update_timing();
+    };
+
+    //Small delay changes, as made by a placement move or the rerouting of a few nets
+    auto incr_analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, tatum::SerialIncrWalker>::make(tg.graph, tg.constraints, delay_calc);
+    incr_analyzer->update_timing();
+    std::minstd_rand rng(3);
+    std::uniform_int_distribution<size_t> edge_dist(0, tg.interconnect_edges.size() - 1);
+    BENCHMARK("incremental serial") {
+        for (size_t i = 0; i < kNumInvalidatedEdges; ++i) {
+            tatum::EdgeId edge = tg.interconnect_edges[edge_dist(rng)];
+            delay_calc.set_max_edge_delay(tg.graph, edge, tatum::Time(delay_calc.max_edge_delay(tg.graph, edge).value() * 1.01));
+            incr_analyzer->invalidate_edge(edge);
+        }
+        incr_analyzer->update_timing();
+    };
+}
+
+} // namespace
@@ -1,8 +1,20 @@
 #include "timing_reports.h"
 
+#include <limits>
+#include <memory>
+#include <vector>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 #include "vtr_log.h"
+#include "vtr_time.h"
+
+#include "async_file_writer.h"
 
 #include "tatum/TimingReporter.hpp"
+#include "tatum/analyzer_factory.hpp"
 
 #include "vpr_types.h"
 #include "globals.h"
@@ -11,6 +23,9 @@
 #include "timing_util.h"
 
 #include "VprTimingGraphResolver.h"
+#include "CornerDelayCalculator.h"
+
+static float find_least_hold_slack(const tatum::HoldTimingAnalyzer& hold_analyzer);
 
 void generate_setup_timing_stats(const std::string& prefix, const SetupTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat) {
     auto& timing_ctx = g_vpr_ctx.timing();
@@ -23,13 +38,17 @@ void generate_setup_timing_stats(const std::string& prefix, const SetupTimingInf
 
     tatum::TimingReporter timing_reporter(resolver, *timing_ctx.graph, *timing_ctx.constraints);
 
-    timing_reporter.report_timing_setup(prefix + "report_timing.setup.rpt", *timing_info.setup_analyzer(), analysis_opts.timing_report_npaths);
+    //The reports are formatted here, and written to disk in the background
+    AsyncOutputFile timing_os(prefix + "report_timing.setup.rpt");
+    timing_reporter.report_timing_setup(timing_os, *timing_info.setup_analyzer(), analysis_opts.timing_report_npaths);
 
     if (analysis_opts.timing_report_skew) {
-        timing_reporter.report_skew_setup(prefix + "report_skew.setup.rpt", *timing_info.setup_analyzer(), analysis_opts.timing_report_npaths);
+        AsyncOutputFile skew_os(prefix + "report_skew.setup.rpt");
+        timing_reporter.report_skew_setup(skew_os, *timing_info.setup_analyzer(), analysis_opts.timing_report_npaths);
     }
 
-    timing_reporter.report_unconstrained_setup(prefix + "report_unconstrained_timing.setup.rpt", *timing_info.setup_analyzer());
+    AsyncOutputFile unconstrained_os(prefix + "report_unconstrained_timing.setup.rpt");
+    timing_reporter.report_unconstrained_setup(unconstrained_os, *timing_info.setup_analyzer());
 }
 
 void generate_hold_timing_stats(const std::string& prefix, const HoldTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat) {
@@ -43,11 +62,119 @@ void generate_hold_timing_stats(const std::string& prefix, const HoldTimingInfo&
 
     tatum::TimingReporter timing_reporter(resolver, *timing_ctx.graph, *timing_ctx.constraints);
 
-    timing_reporter.report_timing_hold(prefix + "report_timing.hold.rpt", *timing_info.hold_analyzer(), analysis_opts.timing_report_npaths);
+    //The reports are formatted here, and written to disk in the background
+    AsyncOutputFile timing_os(prefix + "report_timing.hold.rpt");
+    timing_reporter.report_timing_hold(timing_os, *timing_info.hold_analyzer(), analysis_opts.timing_report_npaths);
 
     if (analysis_opts.timing_report_skew) {
-        timing_reporter.report_skew_hold(prefix + "report_skew.hold.rpt", *timing_info.hold_analyzer(), analysis_opts.timing_report_npaths);
+        AsyncOutputFile skew_os(prefix + "report_skew.hold.rpt");
+        timing_reporter.report_skew_hold(skew_os, *timing_info.hold_analyzer(), analysis_opts.timing_report_npaths);
+    }
+
+    AsyncOutputFile unconstrained_os(prefix + "report_unconstrained_timing.hold.rpt");
+    timing_reporter.report_unconstrained_hold(unconstrained_os, *timing_info.hold_analyzer());
+}
+
+void generate_timing_corner_stats(const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat) {
+    const std::vector<t_timing_corner>& corners = analysis_opts.timing_corners;
+    if (corners.empty()) return;
+
+    auto& timing_ctx = g_vpr_ctx.timing();
+    auto& atom_ctx = g_vpr_ctx.atom();
+
+    vtr::ScopedStartFinishTimer timer("Timing Corner Analysis");
+
+    //All the nominal delays were calculated (and cached) by the previous analysis, so are only looked up once here
+    NominalEdgeDelays nominal_delays(*timing_ctx.graph, delay_calc);
+
+    //The corners share the timing graph (and its levelization), the constraints and the nominal
+    //delays, so only their arrival/required times are calculated separately
+    std::vector<std::unique_ptr<CornerDelayCalculator>> corner_delay_calcs;
+    std::vector<std::unique_ptr<tatum::SetupHoldTimingAnalyzer>> analyzers;
+    for (const t_timing_corner& corner : corners) {
+        corner_delay_calcs.push_back(std::make_unique<CornerDelayCalculator>(nominal_delays, corner));
+        analyzers.push_back(tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *corner_delay_calcs.back()));
     }
 
-    timing_reporter.report_unconstrained_hold(prefix + "report_unconstrained_timing.hold.rpt", *timing_info.hold_analyzer());
+    //The corners are independent, so are analyzed concurrently
+    auto analyze_corner = [&](size_t icorner) {
+        analyzers[icorner]->update_timing();
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), corners.size(), analyze_corner);
+#else
+    for (size_t icorner = 0; icorner < corners.size(); ++icorner) {
+        analyze_corner(icorner);
+    }
+#endif
+
+    //Summarize each corner, and find the corners with the least setup and hold slack
+    VTR_LOG("\n");
+    VTR_LOG("Timing corners:\n");
+    VTR_LOG("  %-16s %9s %9s %13s %13s %13s %13s %13s\n", "Corner", "Max Scale", "Min Scale", "CPD (ns)", "sWNS (ns)", "sTNS (ns)", "hWNS (ns)", "hTNS (ns)");
+
+    size_t worst_setup_corner = 0;
+    size_t worst_hold_corner = 0;
+    float worst_setup_slack = std::numeric_limits<float>::infinity();
+    float worst_hold_slack = std::numeric_limits<float>::infinity();
+    for (size_t icorner = 0; icorner < corners.size(); ++icorner) {
+        const tatum::SetupHoldTimingAnalyzer& analyzer = *analyzers[icorner];
+
+        tatum::TimingPathInfo least_slack_cpd = find_least_slack_critical_path_delay(*timing_ctx.constraints, analyzer);
+        VTR_LOG("  %-16s %9g %9g %13g %13g %13g %13g %13g\n",
+                corners[icorner].name.c_str(),
+                corners[icorner].max_delay_scale,
+                corners[icorner].min_delay_scale,
+                sec_to_nanosec(least_slack_cpd.delay()),
+                sec_to_nanosec(find_setup_worst_negative_slack(analyzer)),
+                sec_to_nanosec(find_setup_total_negative_slack(analyzer)),
+                sec_to_nanosec(find_hold_worst_negative_slack(analyzer)),
+                sec_to_nanosec(find_hold_total_negative_slack(analyzer)));
+
+        if (least_slack_cpd.slack() < worst_setup_slack) {
+            worst_setup_slack = least_slack_cpd.slack();
+            worst_setup_corner = icorner;
+        }
+
+        float hold_slack = find_least_hold_slack(analyzer);
+        if (hold_slack < worst_hold_slack) {
+            worst_hold_slack = hold_slack;
+            worst_hold_corner = icorner;
+        }
+    }
+    VTR_LOG("\n");
+
+    const t_timing_corner& setup_corner = corners[worst_setup_corner];
+    const t_timing_corner& hold_corner = corners[worst_hold_corner];
+    VTR_LOG("Worst setup corner: %s\n", setup_corner.name.c_str());
+    VTR_LOG("Worst hold corner: %s\n", hold_corner.name.c_str());
+    VTR_LOG("\n");
+
+    print_setup_timing_summary(*timing_ctx.constraints, *analyzers[worst_setup_corner], "Worst setup corner (" + setup_corner.name + ") ", /*timing_summary_filename=*/"");
+
+    //The resolver would report nominal (not derated) delay breakdowns, which would not sum to
+    //the corner's path delays, so only netlist pins are reported
+    VprTimingGraphResolver resolver(atom_ctx.nlist, atom_ctx.lookup, *timing_ctx.graph, delay_calc, is_flat);
+    resolver.set_detail_level(e_timing_report_detail::NETLIST);
+
+    tatum::TimingReporter timing_reporter(resolver, *timing_ctx.graph, *timing_ctx.constraints);
+
+    AsyncOutputFile setup_os(setup_corner.name + ".report_timing.setup.rpt");
+    timing_reporter.report_timing_setup(setup_os, *analyzers[worst_setup_corner], analysis_opts.timing_report_npaths);
+    AsyncOutputFile hold_os(hold_corner.name + ".report_timing.hold.rpt");
+    timing_reporter.report_timing_hold(hold_os, *analyzers[worst_hold_corner], analysis_opts.timing_report_npaths);
+}
+
+//Returns the least hold slack of any timing endpoint (which unlike
+//find_hold_worst_negative_slack() may be positive)
+static float find_least_hold_slack(const tatum::HoldTimingAnalyzer& hold_analyzer) {
+    auto& timing_ctx = g_vpr_ctx.timing();
+
+    float worst_slack = std::numeric_limits<float>::infinity();
+    for (tatum::NodeId node : timing_ctx.graph->logical_outputs()) {
+        for (tatum::TimingTag tag : hold_analyzer.hold_slacks(node)) {
+            worst_slack = std::min(worst_slack, tag.time().value());
+        }
+    }
+    return worst_slack;
 }
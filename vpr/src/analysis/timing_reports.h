@@ -8,4 +8,8 @@
 void generate_setup_timing_stats(const std::string& prefix, const SetupTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& report_detail, bool is_flat);
 void generate_hold_timing_stats(const std::string& prefix, const HoldTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& report_detail, bool is_flat);
 
+//Analyzes the timing corners of analysis_opts (if any), whose delays are derated from the nominal
+//delays of delay_calc (which must already have been used for a full timing analysis)
+void generate_timing_corner_stats(const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat);
+
 #endif
@@ -22,6 +22,28 @@ void CheckSetup(const t_packer_opts& PackerOpts,
                         "Packing cannot be timing driven without timing analysis enabled\n");
     }
 
+    if (PackerOpts.pack_parallel_routes < 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of parallel cluster routes can not be negative (got %d).\n", PackerOpts.pack_parallel_routes);
+    }
+
+    if (!PackerOpts.pack_stats_file.empty()
+        && !vtr::check_file_name_extension(PackerOpts.pack_stats_file.c_str(), ".json")
+        && !vtr::check_file_name_extension(PackerOpts.pack_stats_file.c_str(), ".csv")) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The packer statistics file must have a .json or .csv extension (got '%s').\n", PackerOpts.pack_stats_file.c_str());
+    }
+
+    if (PackerOpts.pack_stats_interval < 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The packer statistics interval can not be negative (got %g).\n", PackerOpts.pack_stats_interval);
+    }
+
+    if (PackerOpts.pack_timing_update_interval < 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The packer timing update interval can not be negative (got %d).\n", PackerOpts.pack_timing_update_interval);
+    }
+
     if ((GLOBAL == RouterOpts.route_type)
         && (PlacerOpts.place_algorithm.is_timing_driven())) {
         /* Works, but very weird.  Can't optimize timing well, since you're
@@ -53,6 +75,76 @@ void CheckSetup(const t_packer_opts& PackerOpts,
                         "The number of placer non timing move probabilities should equal to the total number of supported moves. %d\n", PlacerOpts.place_static_notiming_move_prob.size());
     }
 
+    if (PlacerOpts.place_parallel_regions < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of parallel placement regions must be at least 1 (got %d).\n", PlacerOpts.place_parallel_regions);
+    }
+
+    if (PlacerOpts.place_speculative_moves < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of speculative placement moves must be at least 1 (got %d).\n", PlacerOpts.place_speculative_moves);
+    }
+
+    if (PlacerOpts.place_num_seeds < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of placement seeds must be at least 1 (got %d).\n", PlacerOpts.place_num_seeds);
+    }
+
+    if (PlacerOpts.seed_sweep < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of seeds to sweep must be at least 1 (got %d).\n", PlacerOpts.seed_sweep);
+    }
+
+    if (PlacerOpts.seed_sweep > 1 && (PlacerOpts.doPlacement != STAGE_DO || RouterOpts.doRouting != STAGE_DO)) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "A seed sweep (--seed_sweep) requires both placement and routing to be run (not loaded or skipped).\n");
+    }
+
+    if (PlacerOpts.place_agent_batch_size < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The placement RL agent batch size must be at least 1 (got %d).\n", PlacerOpts.place_agent_batch_size);
+    }
+
+    if (PlacerOpts.place_checkpoint_interval < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of temperatures between placement checkpoints must be at least 1 (got %d).\n", PlacerOpts.place_checkpoint_interval);
+    }
+
+    if (PlacerOpts.place_greedy_refine_passes < 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of greedy placement refinement passes can not be negative (got %d).\n", PlacerOpts.place_greedy_refine_passes);
+    }
+
+    if (PlacerOpts.place_greedy_refine_replace_quench && PlacerOpts.place_greedy_refine_passes == 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "Replacing the placement quench by the greedy refinement (--place_greedy_refine_replace_quench) requires --place_greedy_refine_passes > 0.\n");
+    }
+
+    if ((!PlacerOpts.place_checkpoint_file.empty() || !PlacerOpts.place_resume.empty()) && PlacerOpts.place_num_seeds > 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "On-disk placement checkpoints (--place_checkpoint_file and --place_resume) require a single placement seed (got %d).\n", PlacerOpts.place_num_seeds);
+    }
+
+    if ((!PlacerOpts.place_checkpoint_file.empty() || !PlacerOpts.place_resume.empty()) && PlacerOpts.seed_sweep > 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "On-disk placement checkpoints (--place_checkpoint_file and --place_resume) can not be used with a seed sweep (got %d seeds).\n", PlacerOpts.seed_sweep);
+    }
+
+    if (!PlacerOpts.eco_place_file.empty() && !PlacerOpts.place_resume.empty()) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "An ECO placement (--eco_place) starts from a new initial placement, so it can not resume an annealing (--place_resume).\n");
+    }
+
+    if (PlacerOpts.eco_place_region < 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The ECO placement region (--eco_place_region) must be non-negative (got %d).\n", PlacerOpts.eco_place_region);
+    }
+
+    if (RouterOpts.sta_skip_epsilon < 0.) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The router timing analysis skipping threshold (--router_sta_skip_epsilon) must be non-negative (got %g).\n", RouterOpts.sta_skip_epsilon);
+    }
+
     if (RouterOpts.doRouting) {
         if (!Timing.timing_analysis_enabled
             && (DEMAND_ONLY != RouterOpts.base_cost_type && DEMAND_ONLY_NORMALIZED_LENGTH != RouterOpts.base_cost_type)) {
@@ -11,10 +11,13 @@
 #include <algorithm>
 #include <regex>
 #include <limits>
+#include <map>
+#include <tuple>
 
 #include "vtr_assert.h"
 #include "vtr_math.h"
 #include "vtr_log.h"
+#include "vtr_cache.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -29,9 +32,27 @@
 using vtr::FormulaParser;
 using vtr::t_formula_data;
 
+///@brief The resources of a device grid, all that is needed to check whether a design fits on it
+struct t_grid_resources {
+    std::vector<size_t> num_instances;  ///<[physical tile type index] DeviceGrid::num_instances() over all layers
+    std::vector<size_t> num_root_tiles; ///<[physical tile type index] number of tiles, i.e. of root locations
+};
+
+/*
+ * Sizing the device builds the grids of the same layouts and sizes repeatedly (e.g. for each packing
+ * attempt, and again for placement), so the resources of each (layout, size) and the last grid built
+ * are cached. They are cleared by free_device_grid_cache() when the architecture is freed.
+ */
+static std::map<std::tuple<std::string, size_t, size_t>, t_grid_resources> grid_resources_cache;
+static vtr::Cache<std::tuple<std::string, size_t, size_t>, DeviceGrid> device_grid_cache;
+
 static DeviceGrid auto_size_device_grid(const std::vector<t_grid_def>& grid_layouts, const std::map<t_logical_block_type_ptr, size_t>& minimum_instance_counts, float maximum_device_utilization);
-static std::vector<t_logical_block_type_ptr> grid_overused_resources(const DeviceGrid& grid, std::map<t_logical_block_type_ptr, size_t> instance_counts);
-static bool grid_satisfies_instance_counts(const DeviceGrid& grid, std::map<t_logical_block_type_ptr, size_t> instance_counts, float maximum_utilization);
+static std::vector<t_logical_block_type_ptr> grid_overused_resources(const t_grid_resources& grid_resources, std::map<t_logical_block_type_ptr, size_t> instance_counts);
+static bool grid_satisfies_instance_counts(const t_grid_resources& grid_resources, std::map<t_logical_block_type_ptr, size_t> instance_counts, float maximum_utilization);
+static float calculate_device_utilization(const t_grid_resources& grid_resources, const std::map<t_logical_block_type_ptr, size_t>& instance_counts);
+static t_grid_resources count_grid_resources(const DeviceGrid& grid);
+static const t_grid_resources& get_grid_resources(const t_grid_def& grid_def, size_t width, size_t height, bool warn_out_of_range);
+static DeviceGrid get_device_grid(const t_grid_def& grid_def, size_t width, size_t height, bool warn_out_of_range = true, std::vector<t_logical_block_type_ptr> limiting_resources = std::vector<t_logical_block_type_ptr>());
 static DeviceGrid build_device_grid(const t_grid_def& grid_def, size_t width, size_t height, bool warn_out_of_range = true, std::vector<t_logical_block_type_ptr> limiting_resources = std::vector<t_logical_block_type_ptr>());
 
 static void CheckGrid(const DeviceGrid& grid);
@@ -73,7 +94,7 @@ DeviceGrid create_device_grid(std::string layout_name, const std::vector<t_grid_
             VPR_FATAL_ERROR(VPR_ERROR_ARCH, "Failed to find grid layout named '%s' (valid grid layouts: %s)\n", layout_name.c_str(), valid_names.c_str());
         }
 
-        return build_device_grid(*iter, iter->width, iter->height);
+        return get_device_grid(*iter, iter->width, iter->height);
     }
 }
 
@@ -84,7 +105,7 @@ DeviceGrid create_device_grid(std::string layout_name, const std::vector<t_grid_
         //Auto-size
         if (grid_layouts[0].grid_type == GridDefType::AUTO) {
             //Auto layout of the specified dimensions
-            return build_device_grid(grid_layouts[0], width, height);
+            return get_device_grid(grid_layouts[0], width, height);
         } else {
             //Find the fixed layout close to the target size
             std::vector<const t_grid_def*> grid_layouts_view;
@@ -113,7 +134,7 @@ DeviceGrid create_device_grid(std::string layout_name, const std::vector<t_grid_
 
             const t_grid_def* layout = *iter;
 
-            return build_device_grid(*layout, layout->width, layout->height);
+            return get_device_grid(*layout, layout->width, layout->height);
         }
     } else {
         //Use the specified device
@@ -134,7 +155,7 @@ DeviceGrid create_device_grid(std::string layout_name, const std::vector<t_grid_
             VPR_FATAL_ERROR(VPR_ERROR_ARCH, "Failed to find grid layout named '%s' (valid grid layouts: %s)\n", layout_name.c_str(), valid_names.c_str());
         }
 
-        return build_device_grid(*iter, iter->width, iter->height);
+        return get_device_grid(*iter, iter->width, iter->height);
     }
 }
 
@@ -147,8 +168,6 @@ DeviceGrid create_device_grid(std::string layout_name, const std::vector<t_grid_
 static DeviceGrid auto_size_device_grid(const std::vector<t_grid_def>& grid_layouts, const std::map<t_logical_block_type_ptr, size_t>& minimum_instance_counts, float maximum_device_utilization) {
     VTR_ASSERT(grid_layouts.size() > 0);
 
-    DeviceGrid grid;
-
     auto is_auto_grid_def = [](const t_grid_def& grid_def) {
         return grid_def.grid_type == GridDefType::AUTO;
     };
@@ -189,19 +208,18 @@ static DeviceGrid auto_size_device_grid(const std::vector<t_grid_def>& grid_layo
             VTR_LOG("Grid size: %zu x %zu (AR: %.2f) \n", width, height, float(width) / height);
 #endif
 
-            //Build the device
+            //Count the resources of the device
             // Don't warn about out-of-range specifications since these can
             // occur (harmlessly) at small device dimensions
-            grid = build_device_grid(grid_def, width, height, false, limiting_resources);
+            const t_grid_resources& grid_resources = get_grid_resources(grid_def, width, height, false);
 
             //Check if it satisfies the block counts
-            if (grid_satisfies_instance_counts(grid, minimum_instance_counts, maximum_device_utilization)) {
-                //Re-build the grid at the final size with out-of-range
-                grid = build_device_grid(grid_def, width, height, false, limiting_resources);
-                return grid;
+            if (grid_satisfies_instance_counts(grid_resources, minimum_instance_counts, maximum_device_utilization)) {
+                //Build the grid at the final size
+                return get_device_grid(grid_def, width, height, false, limiting_resources);
             }
 
-            limiting_resources = grid_overused_resources(grid, minimum_instance_counts);
+            limiting_resources = grid_overused_resources(grid_resources, minimum_instance_counts);
 
             //Determine grid size
             grid_size = width * height;
@@ -241,18 +259,77 @@ static DeviceGrid auto_size_device_grid(const std::vector<t_grid_def>& grid_layo
         std::vector<t_logical_block_type_ptr> limiting_resources;
 
         //Try all the fixed devices in order from smallest to largest
+        // (if none satisfies the block counts, the largest is used)
+        const t_grid_def* device_grid_def = nullptr;
+        std::vector<t_logical_block_type_ptr> device_limiting_resources;
         for (const auto* grid_def : grid_layouts_view) {
-            //Build the grid
-            grid = build_device_grid(*grid_def, grid_def->width, grid_def->height, true, limiting_resources);
+            device_grid_def = grid_def;
+            device_limiting_resources = limiting_resources;
 
-            if (grid_satisfies_instance_counts(grid, minimum_instance_counts, maximum_device_utilization)) {
-                return grid;
+            const t_grid_resources& grid_resources = get_grid_resources(*grid_def, grid_def->width, grid_def->height, true);
+            if (grid_satisfies_instance_counts(grid_resources, minimum_instance_counts, maximum_device_utilization)) {
+                break;
             }
-            limiting_resources = grid_overused_resources(grid, minimum_instance_counts);
+            limiting_resources = grid_overused_resources(grid_resources, minimum_instance_counts);
         }
+
+        VTR_ASSERT(device_grid_def);
+        return get_device_grid(*device_grid_def, device_grid_def->width, device_grid_def->height, true, device_limiting_resources);
+    }
+}
+
+void free_device_grid_cache() {
+    grid_resources_cache.clear();
+    device_grid_cache.clear();
+}
+
+///@brief Returns the resources of the grid_def device of the specified size, building the device if they are not cached
+static const t_grid_resources& get_grid_resources(const t_grid_def& grid_def, size_t width, size_t height, bool warn_out_of_range) {
+    auto key = std::make_tuple(grid_def.name, width, height);
+    auto iter = grid_resources_cache.find(key);
+    if (iter == grid_resources_cache.end()) {
+        DeviceGrid grid = get_device_grid(grid_def, width, height, warn_out_of_range);
+        iter = grid_resources_cache.emplace(key, count_grid_resources(grid)).first;
+    }
+    return iter->second;
+}
+
+///@brief Returns the grid_def device of the specified size, which is only built if it is not the last device built
+static DeviceGrid get_device_grid(const t_grid_def& grid_def, size_t width, size_t height, bool warn_out_of_range, std::vector<t_logical_block_type_ptr> limiting_resources) {
+    auto key = std::make_tuple(grid_def.name, width, height);
+    const DeviceGrid* cached_grid = device_grid_cache.get(key);
+    if (!cached_grid) {
+        cached_grid = device_grid_cache.set(key, std::make_unique<DeviceGrid>(build_device_grid(grid_def, width, height, warn_out_of_range)));
     }
 
-    return grid; //Unreachable
+    DeviceGrid grid = *cached_grid;
+    grid.set_limiting_resources(std::move(limiting_resources));
+    return grid;
+}
+
+///@brief Counts the resources of a device grid
+static t_grid_resources count_grid_resources(const DeviceGrid& grid) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    t_grid_resources grid_resources;
+    grid_resources.num_instances.resize(device_ctx.physical_tile_types.size(), 0);
+    grid_resources.num_root_tiles.resize(device_ctx.physical_tile_types.size(), 0);
+
+    for (const auto& tile_type : device_ctx.physical_tile_types) {
+        grid_resources.num_instances[tile_type.index] = grid.num_instances(&tile_type, -1);
+    }
+
+    for (int layer_num = 0; layer_num < grid.get_num_layers(); ++layer_num) {
+        for (int x = 0; x < (int)grid.width(); ++x) {
+            for (int y = 0; y < (int)grid.height(); ++y) {
+                if (grid.is_root_location({x, y, layer_num})) {
+                    ++grid_resources.num_root_tiles[grid.get_physical_type({x, y, layer_num})->index];
+                }
+            }
+        }
+    }
+
+    return grid_resources;
 }
 
 /**
@@ -262,7 +339,7 @@ static DeviceGrid auto_size_device_grid(const std::vector<t_grid_def>& grid_layo
  * Performs a fast counting based estimate, allocating the least
  * flexible block types (those with the fewestequivalent tiles) first.
  */
-static std::vector<t_logical_block_type_ptr> grid_overused_resources(const DeviceGrid& grid, std::map<t_logical_block_type_ptr, size_t> instance_counts) {
+static std::vector<t_logical_block_type_ptr> grid_overused_resources(const t_grid_resources& grid_resources, std::map<t_logical_block_type_ptr, size_t> instance_counts) {
     auto& device_ctx = g_vpr_ctx.device();
 
     std::vector<t_logical_block_type_ptr> overused_resources;
@@ -276,7 +353,7 @@ static std::vector<t_logical_block_type_ptr> grid_overused_resources(const Devic
     //Initialize available tile counts
     std::unordered_map<t_physical_tile_type_ptr, int> avail_tiles;
     for (auto& tile_type : device_ctx.physical_tile_types) {
-        avail_tiles[&tile_type] = grid.num_instances(&tile_type, -1);
+        avail_tiles[&tile_type] = grid_resources.num_instances[tile_type.index];
     }
 
     //Sort so we allocate logical blocks with the fewest equivalent sites first (least flexible)
@@ -316,16 +393,16 @@ static std::vector<t_logical_block_type_ptr> grid_overused_resources(const Devic
     return overused_resources;
 }
 
-static bool grid_satisfies_instance_counts(const DeviceGrid& grid, std::map<t_logical_block_type_ptr, size_t> instance_counts, float maximum_utilization) {
+static bool grid_satisfies_instance_counts(const t_grid_resources& grid_resources, std::map<t_logical_block_type_ptr, size_t> instance_counts, float maximum_utilization) {
     //Are the resources satisified?
-    auto overused_resources = grid_overused_resources(grid, instance_counts);
+    auto overused_resources = grid_overused_resources(grid_resources, instance_counts);
 
     if (!overused_resources.empty()) {
         return false;
     }
 
     //Is the utilization below the maximum?
-    float utilization = calculate_device_utilization(grid, instance_counts);
+    float utilization = calculate_device_utilization(grid_resources, instance_counts);
 
     if (utilization > maximum_utilization) {
         return false;
@@ -755,28 +832,21 @@ static void CheckGrid(const DeviceGrid& grid) {
 }
 
 float calculate_device_utilization(const DeviceGrid& grid, std::map<t_logical_block_type_ptr, size_t> instance_counts) {
-    //Record the resources of the grid
-    std::map<t_physical_tile_type_ptr, size_t> grid_resources;
-    for (int layer_num = 0; layer_num < grid.get_num_layers(); ++layer_num) {
-        for (int x = 0; x < (int)grid.width(); ++x) {
-            for (int y = 0; y < (int)grid.height(); ++y) {
-                int width_offset = grid.get_width_offset({x, y, layer_num});
-                int height_offset = grid.get_height_offset({x, y, layer_num});
-                if (width_offset == 0 && height_offset == 0) {
-                    const auto& type = grid.get_physical_type({x, y, layer_num});
-                    ++grid_resources[type];
-                }
-            }
-        }
-    }
+    return calculate_device_utilization(count_grid_resources(grid), instance_counts);
+}
+
+static float calculate_device_utilization(const t_grid_resources& grid_resources, const std::map<t_logical_block_type_ptr, size_t>& instance_counts) {
+    auto& device_ctx = g_vpr_ctx.device();
 
     //Determine the area of grid in tile units
     float grid_area = 0.;
-    for (auto& kv : grid_resources) {
-        t_physical_tile_type_ptr type = kv.first;
-        size_t count = kv.second;
+    for (const auto& type : device_ctx.physical_tile_types) {
+        size_t count = grid_resources.num_root_tiles[type.index];
+        if (count == 0) {
+            continue;
+        }
 
-        float type_area = type->width * type->height;
+        float type_area = type.width * type.height;
 
         grid_area += type_area * count;
     }
@@ -35,4 +35,11 @@ float calculate_device_utilization(const DeviceGrid& grid, std::map<t_logical_bl
  */
 size_t count_grid_tiles(const DeviceGrid& grid);
 
+/**
+ * @brief Clears the device grids (and their resources) cached by create_device_grid()
+ *
+ * Must be called when the architecture they were built from is freed.
+ */
+void free_device_grid_cache();
+
 #endif
@@ -9,6 +9,7 @@
 #include "vtr_log.h"
 #include "vtr_memory.h"
 #include "vtr_time.h"
+#include "vtr_digest.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -17,6 +18,8 @@
 #include "globals.h"
 #include "read_xml_arch_file.h"
 #include "read_fpga_interchange_arch.h"
+#include "compiled_arch.h"
+#include "artifact_cache.h"
 #include "SetupVPR.h"
 #include "pb_type_graph.h"
 #include "pack_types.h"
@@ -45,7 +48,13 @@ static void SetupSwitches(const t_arch& Arch,
                           const t_arch_switch_inf* ArchSwitches,
                           int NumArchSwitches);
 static void SetupAnalysisOpts(const t_options& Options, t_analysis_opts& analysis_opts);
+static t_timing_corner parse_timing_corner(const std::string& corner_spec);
 static void SetupPowerOpts(const t_options& Options, t_power_opts* power_opts, t_arch* Arch);
+static void ReadArch(const t_options& Options,
+                     const bool TimingEnabled,
+                     t_arch* Arch,
+                     std::vector<t_physical_tile_type>& PhysicalTileTypes,
+                     std::vector<t_logical_block_type>& LogicalBlockTypes);
 
 /**
  * @brief Identify which switch must be used for *track* to *IPIN* connections based on architecture file specification.
@@ -133,7 +142,9 @@ void SetupVPR(const t_options* Options,
     FileNameOpts->out_file_prefix = Options->out_file_prefix;
     FileNameOpts->read_vpr_constraints_file = Options->read_vpr_constraints_file;
     FileNameOpts->write_vpr_constraints_file = Options->write_vpr_constraints_file;
+    FileNameOpts->write_headless_images = Options->write_headless_images;
     FileNameOpts->write_block_usage = Options->write_block_usage;
+    FileNameOpts->netlist_snapshot = Options->netlist_snapshot;
 
     FileNameOpts->verify_file_digests = Options->verify_file_digests;
 
@@ -147,25 +158,11 @@ void SetupVPR(const t_options* Options,
 
     if (readArchFile == true) {
         vtr::ScopedStartFinishTimer t("Loading Architecture Description");
-        switch (Options->arch_format) {
-            case e_arch_format::VTR:
-                XmlReadArch(Options->ArchFile.value().c_str(),
-                            TimingEnabled,
-                            Arch,
-                            device_ctx.physical_tile_types,
-                            device_ctx.logical_block_types);
-                break;
-            case e_arch_format::FPGAInterchange:
-                VTR_LOG("Use FPGA Interchange device\n");
-                FPGAInterchangeReadArch(Options->ArchFile.value().c_str(),
-                                        TimingEnabled,
-                                        Arch,
-                                        device_ctx.physical_tile_types,
-                                        device_ctx.logical_block_types);
-                break;
-            default:
-                VPR_FATAL_ERROR(VPR_ERROR_ARCH, "Invalid architecture format!");
-        }
+        ReadArch(*Options,
+                 TimingEnabled,
+                 Arch,
+                 device_ctx.physical_tile_types,
+                 device_ctx.logical_block_types);
     }
     VTR_LOG("\n");
 
@@ -227,6 +224,7 @@ void SetupVPR(const t_options* Options,
     SetupPackerOpts(*Options, PackerOpts);
     RoutingArch->write_rr_graph_filename = Options->write_rr_graph_file;
     RoutingArch->read_rr_graph_filename = Options->read_rr_graph_file;
+    RoutingArch->artifact_cache_dir = Options->artifact_cache_dir;
 
     for (auto has_global_routing : Arch->layer_global_routing) {
         device_ctx.inter_cluster_prog_routing_resources.emplace_back(has_global_routing);
@@ -417,6 +415,7 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->max_router_iterations = Options.max_router_iterations;
     RouterOpts->init_wirelength_abort_threshold = Options.router_init_wirelength_abort_threshold;
     RouterOpts->min_incremental_reroute_fanout = Options.min_incremental_reroute_fanout;
+    RouterOpts->incremental_reroute_all_nets_iter = Options.incremental_reroute_all_nets_iter;
     RouterOpts->incr_reroute_delay_ripup = Options.incr_reroute_delay_ripup;
     RouterOpts->pres_fac_mult = Options.pres_fac_mult;
     RouterOpts->route_type = Options.RouteType;
@@ -429,10 +428,12 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->switch_usage_analysis = Options.full_stats;
 
     RouterOpts->verify_binary_search = Options.verify_binary_search;
+    RouterOpts->min_channel_width_warm_start = Options.min_route_chan_width_warm_start;
     RouterOpts->router_algorithm = Options.RouterAlgorithm;
     RouterOpts->fixed_channel_width = Options.RouteChanWidth;
     RouterOpts->min_channel_width_hint = Options.min_route_chan_width_hint;
     RouterOpts->read_rr_edge_metadata = Options.read_rr_edge_metadata;
+    RouterOpts->attach_rr_graph = Options.attach_rr_graph;
     RouterOpts->reorder_rr_graph_nodes_algorithm = Options.reorder_rr_graph_nodes_algorithm;
     RouterOpts->reorder_rr_graph_nodes_threshold = Options.reorder_rr_graph_nodes_threshold;
     RouterOpts->reorder_rr_graph_nodes_seed = Options.reorder_rr_graph_nodes_seed;
@@ -446,14 +447,25 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
         RouterOpts->doRouting = STAGE_DO;
     }
     RouterOpts->routing_failure_predictor = Options.routing_failure_predictor;
+    RouterOpts->predictor_schedule = Options.routing_predictor_schedule;
+    RouterOpts->sta_skip_epsilon = Options.router_sta_skip_epsilon;
     RouterOpts->routing_budgets_algorithm = Options.routing_budgets_algorithm;
     RouterOpts->save_routing_per_iteration = Options.save_routing_per_iteration;
     RouterOpts->congested_routing_iteration_threshold_frac = Options.congested_routing_iteration_threshold_frac;
     RouterOpts->route_bb_update = Options.route_bb_update;
+    RouterOpts->route_bb_prediction = Options.route_bb_prediction;
     RouterOpts->clock_modeling = Options.clock_modeling;
     RouterOpts->two_stage_clock_routing = Options.two_stage_clock_routing;
+    RouterOpts->clock_route_templates = Options.clock_route_templates;
     RouterOpts->high_fanout_threshold = Options.router_high_fanout_threshold;
     RouterOpts->high_fanout_max_slope = Options.router_high_fanout_max_slope;
+    RouterOpts->high_fanout_sink_clustering = Options.router_high_fanout_sink_clustering;
+    RouterOpts->net_locality_order = Options.router_net_locality_order;
+    RouterOpts->batch_max_fanout = Options.router_batch_max_fanout;
+    RouterOpts->speculative_parallel = Options.router_speculative_parallel;
+    RouterOpts->bidir_search_threshold = Options.router_bidir_search_threshold;
+    RouterOpts->hot_edge_layout = Options.router_hot_edge_layout;
+    RouterOpts->compact_rr_edges = Options.router_compact_rr_edges;
     RouterOpts->router_debug_net = Options.router_debug_net;
     RouterOpts->router_debug_sink_rr = Options.router_debug_sink_rr;
     RouterOpts->router_debug_iteration = Options.router_debug_iteration;
@@ -466,6 +478,7 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->strict_checks = Options.strict_checks;
 
     RouterOpts->write_router_lookahead = Options.write_router_lookahead;
+    RouterOpts->write_router_lookahead_profile = Options.write_router_lookahead_profile;
     RouterOpts->read_router_lookahead = Options.read_router_lookahead;
 
     RouterOpts->write_intra_cluster_router_lookahead = Options.write_intra_cluster_router_lookahead;
@@ -481,6 +494,9 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->generate_rr_node_overuse_report = Options.generate_rr_node_overuse_report;
     RouterOpts->flat_routing = Options.flat_routing;
     RouterOpts->has_choking_spot = Options.has_choking_spot;
+    RouterOpts->overlap_route_setup = Options.overlap_route_setup;
+    RouterOpts->partition_tree_report_ranks = Options.partition_tree_report_ranks;
+    RouterOpts->eco_route_file = Options.eco_route_file;
 }
 
 static void SetupAnnealSched(const t_options& Options,
@@ -534,6 +550,12 @@ static void SetupAnnealSched(const t_options& Options,
         VPR_FATAL_ERROR(VPR_ERROR_OTHER, "success_target must be between 0 and 1 exclusive.\n");
     }
 
+    AnnealSched->fast_start = Options.PlaceFastStart;
+    AnnealSched->fast_start_success = Options.PlaceFastStartSuccess;
+    if (AnnealSched->fast_start_success >= 1 || AnnealSched->fast_start_success <= 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "fast_start_success must be between 0 and 1 exclusive.\n");
+    }
+
     AnnealSched->type = Options.anneal_sched_type;
 }
 
@@ -585,6 +607,11 @@ void SetupPackerOpts(const t_options& Options,
     PackerOpts->timing_update_type = Options.timing_update_type;
     PackerOpts->pack_num_moves = Options.pack_num_moves;
     PackerOpts->pack_move_type = Options.pack_move_type;
+    PackerOpts->pack_parallel_routes = Options.pack_parallel_routes;
+    PackerOpts->pack_incremental_intra_lb_route = Options.pack_incremental_intra_lb_route;
+    PackerOpts->pack_stats_file = Options.pack_stats_file;
+    PackerOpts->pack_stats_interval = Options.pack_stats_interval;
+    PackerOpts->pack_timing_update_interval = Options.pack_timing_update_interval;
 }
 
 static void SetupNetlistOpts(const t_options& Options, t_netlist_opts& NetlistOpts) {
@@ -660,6 +687,8 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
     PlacerOpts->effort_scaling = Options.place_effort_scaling;
     PlacerOpts->timing_update_type = Options.timing_update_type;
     PlacerOpts->enable_analytic_placer = Options.enable_analytic_placer;
+    PlacerOpts->analytic_placer_solver_stats = Options.analytic_placer_solver_stats;
+    PlacerOpts->analytic_placer_engine = Options.analytic_placer_engine;
     PlacerOpts->place_static_move_prob = Options.place_static_move_prob;
     PlacerOpts->place_static_notiming_move_prob = Options.place_static_notiming_move_prob;
     PlacerOpts->place_high_fanout_net = Options.place_high_fanout_net;
@@ -667,8 +696,24 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
     PlacerOpts->RL_agent_placement = Options.RL_agent_placement;
     PlacerOpts->place_agent_multistate = Options.place_agent_multistate;
     PlacerOpts->place_checkpointing = Options.place_checkpointing;
+    PlacerOpts->place_parallel_regions = Options.place_parallel_regions;
+    PlacerOpts->place_speculative_moves = Options.place_speculative_moves;
+    PlacerOpts->place_num_seeds = Options.place_num_seeds;
+    PlacerOpts->seed_sweep = Options.seed_sweep;
+    PlacerOpts->place_timing_update_stats = Options.place_timing_update_stats;
     PlacerOpts->place_agent_epsilon = Options.place_agent_epsilon;
     PlacerOpts->place_agent_gamma = Options.place_agent_gamma;
+    PlacerOpts->place_agent_batch_size = Options.place_agent_batch_size;
+    PlacerOpts->place_checkpoint_file = Options.place_checkpoint_file;
+    PlacerOpts->place_checkpoint_interval = Options.place_checkpoint_interval;
+    PlacerOpts->place_resume = Options.place_resume;
+    PlacerOpts->eco_place_file = Options.eco_place_file;
+    PlacerOpts->eco_place_region = Options.eco_place_region;
+    PlacerOpts->place_overlap_timing_analysis = Options.place_overlap_timing_analysis;
+    PlacerOpts->place_greedy_refine_passes = Options.place_greedy_refine_passes;
+    PlacerOpts->place_greedy_refine_replace_quench = Options.place_greedy_refine_replace_quench;
+    PlacerOpts->place_connection_delay_cache = Options.place_connection_delay_cache;
+    PlacerOpts->place_congestion_weight = Options.place_congestion_weight;
     PlacerOpts->place_dm_rlim = Options.place_dm_rlim;
     PlacerOpts->place_agent_space = Options.place_agent_space;
     PlacerOpts->place_reward_fun = Options.place_reward_fun;
@@ -696,6 +741,9 @@ static void SetupAnalysisOpts(const t_options& Options, t_analysis_opts& analysi
     analysis_opts.timing_report_npaths = Options.timing_report_npaths;
     analysis_opts.timing_report_detail = Options.timing_report_detail;
     analysis_opts.timing_report_skew = Options.timing_report_skew;
+    for (const std::string& corner_spec : Options.timing_corners.value()) {
+        analysis_opts.timing_corners.push_back(parse_timing_corner(corner_spec));
+    }
     analysis_opts.echo_dot_timing_graph_node = Options.echo_dot_timing_graph_node;
 
     analysis_opts.post_synth_netlist_unconn_input_handling = Options.post_synth_netlist_unconn_input_handling;
@@ -703,6 +751,26 @@ static void SetupAnalysisOpts(const t_options& Options, t_analysis_opts& analysi
 
     analysis_opts.timing_update_type = Options.timing_update_type;
     analysis_opts.write_timing_summary = Options.write_timing_summary;
+    analysis_opts.write_timing_metrics = Options.write_timing_metrics;
+    analysis_opts.parallel_analysis = Options.parallel_analysis;
+}
+
+//Parses a timing corner specified as 'name:scale' or 'name:max_scale:min_scale'
+static t_timing_corner parse_timing_corner(const std::string& corner_spec) {
+    std::vector<std::string> fields = vtr::split(corner_spec, ":");
+    if (fields.size() != 2 && fields.size() != 3) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Invalid timing corner '%s' (expected 'name:scale' or 'name:max_scale:min_scale')\n", corner_spec.c_str());
+    }
+
+    t_timing_corner corner;
+    corner.name = fields[0];
+    corner.max_delay_scale = vtr::atof(fields[1]);
+    corner.min_delay_scale = (fields.size() == 3) ? vtr::atof(fields[2]) : corner.max_delay_scale;
+
+    if (corner.max_delay_scale <= 0. || corner.min_delay_scale <= 0.) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Timing corner '%s' delay scales must be greater than 0\n", corner.name.c_str());
+    }
+    return corner;
 }
 
 static void SetupPowerOpts(const t_options& Options, t_power_opts* power_opts, t_arch* Arch) {
@@ -725,6 +793,69 @@ static void SetupPowerOpts(const t_options& Options, t_power_opts* power_opts, t
     }
 }
 
+/**
+ * @brief Reads the architecture file (VTR XML or FPGA Interchange device), from its compiled form
+ *        if an up-to-date one is available
+ *
+ * The compiled architecture is the --compiled_arch file if specified, or else an entry of the
+ * artifact cache (if any). If it is missing or stale the architecture file is read, and compiled
+ * for later runs.
+ */
+static void ReadArch(const t_options& Options,
+                     const bool TimingEnabled,
+                     t_arch* Arch,
+                     std::vector<t_physical_tile_type>& PhysicalTileTypes,
+                     std::vector<t_logical_block_type>& LogicalBlockTypes) {
+    const std::string& arch_file = Options.ArchFile.value();
+    e_arch_format arch_format = Options.arch_format;
+    if (arch_format != e_arch_format::VTR && arch_format != e_arch_format::FPGAInterchange) {
+        VPR_FATAL_ERROR(VPR_ERROR_ARCH, "Invalid architecture format!");
+    }
+
+    std::string compiled_file = Options.compiled_arch_file.value();
+    bool cached = false;
+    if (compiled_file.empty() && !Options.artifact_cache_dir.value().empty()) {
+        //The architecture is not loaded yet, so its id (file digest) is computed here
+        ArtifactKey key(Options.artifact_cache_dir.value(), "compiled_arch", ".blob", vtr::secure_digest_file(arch_file));
+        key.add("arch_format", int(arch_format));
+        key.add("timing_enabled", TimingEnabled);
+        key.add("power", Arch->power != nullptr);
+        compiled_file = key.path();
+        cached = true;
+    }
+
+    if (!compiled_file.empty() && artifact_cache_contains(compiled_file)) {
+        if (ReadCompiledArch(compiled_file.c_str(), arch_file.c_str(), TimingEnabled, Arch, PhysicalTileTypes, LogicalBlockTypes)) {
+            VTR_LOG("Loaded compiled architecture '%s'\n", compiled_file.c_str());
+            return;
+        }
+    }
+
+    if (arch_format == e_arch_format::VTR) {
+        XmlReadArch(arch_file.c_str(),
+                    TimingEnabled,
+                    Arch,
+                    PhysicalTileTypes,
+                    LogicalBlockTypes);
+    } else {
+        VTR_LOG("Use FPGA Interchange device\n");
+        FPGAInterchangeReadArch(arch_file.c_str(),
+                                TimingEnabled,
+                                Arch,
+                                PhysicalTileTypes,
+                                LogicalBlockTypes);
+    }
+
+    if (cached) {
+        artifact_cache_store(compiled_file, [&](const std::string& file) {
+            WriteCompiledArch(file.c_str(), *Arch, PhysicalTileTypes, LogicalBlockTypes, TimingEnabled);
+        });
+    } else if (!compiled_file.empty()) {
+        VTR_LOG("Writing compiled architecture '%s'\n", compiled_file.c_str());
+        WriteCompiledArch(compiled_file.c_str(), *Arch, PhysicalTileTypes, LogicalBlockTypes, TimingEnabled);
+    }
+}
+
 /*
  * Go through all the NoC options supplied by the user and store them internally.
  */
@@ -228,6 +228,13 @@ static void ShowAnnealSched(const t_annealing_sched& AnnealSched) {
         VTR_LOG("AnnealSched.success_min: %f\n", AnnealSched.success_min);
         VTR_LOG("AnnealSched.success_target: %f\n", AnnealSched.success_target);
     }
+
+    if (USER_SCHED != AnnealSched.type) {
+        VTR_LOG("AnnealSched.fast_start: %s\n", (AnnealSched.fast_start ? "true" : "false"));
+        if (AnnealSched.fast_start) {
+            VTR_LOG("AnnealSched.fast_start_success: %f\n", AnnealSched.fast_start_success);
+        }
+    }
 }
 
 static void ShowRouterOpts(const t_router_opts& RouterOpts) {
@@ -257,6 +264,9 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
         VTR_LOG("false\n");
     }
 
+    VTR_LOG("RouterOpts.overlap_route_setup: %s\n", RouterOpts.overlap_route_setup ? "on" : "off");
+    VTR_LOG("RouterOpts.eco_route_file: %s\n", RouterOpts.eco_route_file.c_str());
+
     if (DETAILED == RouterOpts.route_type) {
         VTR_LOG("RouterOpts.router_algorithm: ");
         switch (RouterOpts.router_algorithm) {
@@ -327,10 +337,13 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
         VTR_LOG("RouterOpts.pres_fac_mult: %f\n", RouterOpts.pres_fac_mult);
         VTR_LOG("RouterOpts.max_router_iterations: %d\n", RouterOpts.max_router_iterations);
         VTR_LOG("RouterOpts.min_incremental_reroute_fanout: %d\n", RouterOpts.min_incremental_reroute_fanout);
+        VTR_LOG("RouterOpts.incremental_reroute_all_nets_iter: %d\n", RouterOpts.incremental_reroute_all_nets_iter);
         VTR_LOG("RouterOpts.do_check_rr_graph: %s\n", RouterOpts.do_check_rr_graph ? "true" : "false");
         VTR_LOG("RouterOpts.verify_binary_search: %s\n", RouterOpts.verify_binary_search ? "true" : "false");
         VTR_LOG("RouterOpts.min_channel_width_hint: %d\n", RouterOpts.min_channel_width_hint);
+        VTR_LOG("RouterOpts.min_channel_width_warm_start: %s\n", RouterOpts.min_channel_width_warm_start ? "true" : "false");
         VTR_LOG("RouterOpts.read_rr_edge_metadata: %s\n", RouterOpts.read_rr_edge_metadata ? "true" : "false");
+        VTR_LOG("RouterOpts.attach_rr_graph: %s\n", RouterOpts.attach_rr_graph ? "true" : "false");
         VTR_LOG("RouterOpts.exit_after_first_routing_iteration: %s\n", RouterOpts.exit_after_first_routing_iteration ? "true" : "false");
 
         if (TIMING_DRIVEN == RouterOpts.router_algorithm) {
@@ -342,6 +355,12 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
             VTR_LOG("RouterOpts.save_routing_per_iteration: %s\n", RouterOpts.save_routing_per_iteration ? "true" : "false");
             VTR_LOG("RouterOpts.congested_routing_iteration_threshold_frac: %f\n", RouterOpts.congested_routing_iteration_threshold_frac);
             VTR_LOG("RouterOpts.high_fanout_threshold: %d\n", RouterOpts.high_fanout_threshold);
+            VTR_LOG("RouterOpts.high_fanout_sink_clustering: %s\n", RouterOpts.high_fanout_sink_clustering ? "true" : "false");
+            VTR_LOG("RouterOpts.net_locality_order: %s\n", RouterOpts.net_locality_order ? "true" : "false");
+            VTR_LOG("RouterOpts.batch_max_fanout: %d\n", RouterOpts.batch_max_fanout);
+            VTR_LOG("RouterOpts.bidir_search_threshold: %d\n", RouterOpts.bidir_search_threshold);
+            VTR_LOG("RouterOpts.hot_edge_layout: %s\n", RouterOpts.hot_edge_layout ? "true" : "false");
+            VTR_LOG("RouterOpts.compact_rr_edges: %s\n", RouterOpts.compact_rr_edges ? "true" : "false");
             VTR_LOG("RouterOpts.router_debug_net: %d\n", RouterOpts.router_debug_net);
             VTR_LOG("RouterOpts.router_debug_sink_rr: %d\n", RouterOpts.router_debug_sink_rr);
             VTR_LOG("RouterOpts.router_debug_iteration: %d\n", RouterOpts.router_debug_iteration);
@@ -364,6 +383,7 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                 default:
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown route_bb_update\n");
             }
+            VTR_LOG("RouterOpts.route_bb_prediction: %s\n", RouterOpts.route_bb_prediction ? "true" : "false");
 
             VTR_LOG("RouterOpts.lookahead_type: ");
             switch (RouterOpts.lookahead_type) {
@@ -406,6 +426,9 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                 case e_heap_type::BUCKET_HEAP_APPROXIMATION:
                     VTR_LOG("BUCKET_HEAP_APPROXIMATION\n");
                     break;
+                case e_heap_type::FOUR_ARY_HEAP:
+                    VTR_LOG("FOUR_ARY_HEAP\n");
+                    break;
                 default:
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown router_heap\n");
             }
@@ -416,6 +439,8 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
             VTR_LOG("RouterOpts.routing_failure_predictor = AGGRESSIVE\n");
         else if (RouterOpts.routing_failure_predictor == OFF)
             VTR_LOG("RouterOpts.routing_failure_predictor = OFF\n");
+        VTR_LOG("RouterOpts.predictor_schedule: %s\n", RouterOpts.predictor_schedule ? "true" : "false");
+        VTR_LOG("RouterOpts.sta_skip_epsilon: %g\n", RouterOpts.sta_skip_epsilon);
 
         if (RouterOpts.routing_budgets_algorithm == DISABLE) {
             VTR_LOG("RouterOpts.routing_budgets_algorithm = DISABLE\n");
@@ -469,10 +494,13 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
         VTR_LOG("RouterOpts.pres_fac_mult: %f\n", RouterOpts.pres_fac_mult);
         VTR_LOG("RouterOpts.max_router_iterations: %d\n", RouterOpts.max_router_iterations);
         VTR_LOG("RouterOpts.min_incremental_reroute_fanout: %d\n", RouterOpts.min_incremental_reroute_fanout);
+        VTR_LOG("RouterOpts.incremental_reroute_all_nets_iter: %d\n", RouterOpts.incremental_reroute_all_nets_iter);
         VTR_LOG("RouterOpts.do_check_rr_graph: %s\n", RouterOpts.do_check_rr_graph ? "true" : "false");
         VTR_LOG("RouterOpts.verify_binary_search: %s\n", RouterOpts.verify_binary_search ? "true" : "false");
         VTR_LOG("RouterOpts.min_channel_width_hint: %d\n", RouterOpts.min_channel_width_hint);
+        VTR_LOG("RouterOpts.min_channel_width_warm_start: %s\n", RouterOpts.min_channel_width_warm_start ? "true" : "false");
         VTR_LOG("RouterOpts.read_rr_edge_metadata: %s\n", RouterOpts.read_rr_edge_metadata ? "true" : "false");
+        VTR_LOG("RouterOpts.attach_rr_graph: %s\n", RouterOpts.attach_rr_graph ? "true" : "false");
         VTR_LOG("RouterOpts.exit_after_first_routing_iteration: %s\n", RouterOpts.exit_after_first_routing_iteration ? "true" : "false");
         if (TIMING_DRIVEN == RouterOpts.router_algorithm) {
             VTR_LOG("RouterOpts.astar_fac: %f\n", RouterOpts.astar_fac);
@@ -484,6 +512,12 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
             VTR_LOG("RouterOpts.save_routing_per_iteration: %s\n", RouterOpts.save_routing_per_iteration ? "true" : "false");
             VTR_LOG("RouterOpts.congested_routing_iteration_threshold_frac: %f\n", RouterOpts.congested_routing_iteration_threshold_frac);
             VTR_LOG("RouterOpts.high_fanout_threshold: %d\n", RouterOpts.high_fanout_threshold);
+            VTR_LOG("RouterOpts.high_fanout_sink_clustering: %s\n", RouterOpts.high_fanout_sink_clustering ? "true" : "false");
+            VTR_LOG("RouterOpts.net_locality_order: %s\n", RouterOpts.net_locality_order ? "true" : "false");
+            VTR_LOG("RouterOpts.batch_max_fanout: %d\n", RouterOpts.batch_max_fanout);
+            VTR_LOG("RouterOpts.bidir_search_threshold: %d\n", RouterOpts.bidir_search_threshold);
+            VTR_LOG("RouterOpts.hot_edge_layout: %s\n", RouterOpts.hot_edge_layout ? "true" : "false");
+            VTR_LOG("RouterOpts.compact_rr_edges: %s\n", RouterOpts.compact_rr_edges ? "true" : "false");
             VTR_LOG("RouterOpts.router_debug_net: %d\n", RouterOpts.router_debug_net);
             VTR_LOG("RouterOpts.router_debug_sink_rr: %d\n", RouterOpts.router_debug_sink_rr);
             VTR_LOG("RouterOpts.router_debug_iteration: %d\n", RouterOpts.router_debug_iteration);
@@ -503,6 +537,7 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                 default:
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown route_bb_update\n");
             }
+            VTR_LOG("RouterOpts.route_bb_prediction: %s\n", RouterOpts.route_bb_prediction ? "true" : "false");
 
             VTR_LOG("RouterOpts.lookahead_type: ");
             switch (RouterOpts.lookahead_type) {
@@ -545,6 +580,9 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                 case e_heap_type::BUCKET_HEAP_APPROXIMATION:
                     VTR_LOG("BUCKET_HEAP_APPROXIMATION\n");
                     break;
+                case e_heap_type::FOUR_ARY_HEAP:
+                    VTR_LOG("FOUR_ARY_HEAP\n");
+                    break;
                 default:
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown router_heap\n");
             }
@@ -663,6 +701,22 @@ static void ShowPlacerOpts(const t_placer_opts& PlacerOpts,
         }
 
         VTR_LOG("PlaceOpts.seed: %d\n", PlacerOpts.seed);
+        VTR_LOG("PlacerOpts.place_parallel_regions: %d\n", PlacerOpts.place_parallel_regions);
+        VTR_LOG("PlacerOpts.place_speculative_moves: %d\n", PlacerOpts.place_speculative_moves);
+        VTR_LOG("PlacerOpts.place_num_seeds: %d\n", PlacerOpts.place_num_seeds);
+        VTR_LOG("PlacerOpts.seed_sweep: %d\n", PlacerOpts.seed_sweep);
+        VTR_LOG("PlacerOpts.place_timing_update_stats: %s\n", PlacerOpts.place_timing_update_stats ? "true" : "false");
+        VTR_LOG("PlacerOpts.place_agent_batch_size: %d\n", PlacerOpts.place_agent_batch_size);
+        VTR_LOG("PlacerOpts.place_checkpoint_file: %s\n", PlacerOpts.place_checkpoint_file.c_str());
+        VTR_LOG("PlacerOpts.place_checkpoint_interval: %d\n", PlacerOpts.place_checkpoint_interval);
+        VTR_LOG("PlacerOpts.place_resume: %s\n", PlacerOpts.place_resume.c_str());
+        VTR_LOG("PlacerOpts.eco_place_file: %s\n", PlacerOpts.eco_place_file.c_str());
+        VTR_LOG("PlacerOpts.eco_place_region: %d\n", PlacerOpts.eco_place_region);
+        VTR_LOG("PlacerOpts.place_overlap_timing_analysis: %s\n", PlacerOpts.place_overlap_timing_analysis ? "true" : "false");
+        VTR_LOG("PlacerOpts.place_greedy_refine_passes: %d\n", PlacerOpts.place_greedy_refine_passes);
+        VTR_LOG("PlacerOpts.place_greedy_refine_replace_quench: %s\n", PlacerOpts.place_greedy_refine_replace_quench ? "true" : "false");
+        VTR_LOG("PlacerOpts.place_connection_delay_cache: %s\n", PlacerOpts.place_connection_delay_cache ? "true" : "false");
+        VTR_LOG("PlacerOpts.place_congestion_weight: %f\n", PlacerOpts.place_congestion_weight);
 
         ShowAnnealSched(AnnealSched);
     }
@@ -689,7 +743,11 @@ static void ShowAnalysisOpts(const t_analysis_opts& AnalysisOpts) {
     VTR_LOG("AnalysisOpts.gen_post_synthesis_netlist: %s\n", (AnalysisOpts.gen_post_synthesis_netlist) ? "true" : "false");
     VTR_LOG("AnalysisOpts.timing_report_npaths: %d\n", AnalysisOpts.timing_report_npaths);
     VTR_LOG("AnalysisOpts.timing_report_skew: %s\n", AnalysisOpts.timing_report_skew ? "true" : "false");
+    for (const t_timing_corner& corner : AnalysisOpts.timing_corners) {
+        VTR_LOG("AnalysisOpts.timing_corner: %s (max delay scale %g, min delay scale %g)\n", corner.name.c_str(), corner.max_delay_scale, corner.min_delay_scale);
+    }
     VTR_LOG("AnalysisOpts.echo_dot_timing_graph_node: %s\n", AnalysisOpts.echo_dot_timing_graph_node.c_str());
+    VTR_LOG("AnalysisOpts.parallel_analysis: %s\n", AnalysisOpts.parallel_analysis ? "true" : "false");
 
     VTR_LOG("AnalysisOpts.timing_report_detail: ");
     switch (AnalysisOpts.timing_report_detail) {
@@ -779,6 +837,11 @@ static void ShowPackerOpts(const t_packer_opts& PackerOpts) {
     VTR_LOG("PackerOpts.timing_driven: %s", (PackerOpts.timing_driven ? "true\n" : "false\n"));
     VTR_LOG("PackerOpts.target_external_pin_util: %s", vtr::join(PackerOpts.target_external_pin_util, " ").c_str());
     VTR_LOG("\n");
+    VTR_LOG("PackerOpts.pack_parallel_routes: %d\n", PackerOpts.pack_parallel_routes);
+    VTR_LOG("PackerOpts.pack_incremental_intra_lb_route: %s", (PackerOpts.pack_incremental_intra_lb_route ? "true\n" : "false\n"));
+    VTR_LOG("PackerOpts.pack_stats_file: %s\n", PackerOpts.pack_stats_file.c_str());
+    VTR_LOG("PackerOpts.pack_stats_interval: %g\n", PackerOpts.pack_stats_interval);
+    VTR_LOG("PackerOpts.pack_timing_update_interval: %d\n", PackerOpts.pack_timing_update_interval);
     VTR_LOG("\n");
 }
 
@@ -0,0 +1,91 @@
+#include "artifact_cache.h"
+
+#include <atomic>
+#include <filesystem>
+#include <limits>
+#include <system_error>
+
+#include <unistd.h>
+
+#include "vtr_digest.h"
+#include "vtr_log.h"
+#include "vtr_util.h"
+#include "vtr_version.h"
+
+#include "globals.h"
+
+ArtifactKey::ArtifactKey(std::string cache_dir, std::string artifact, std::string extension)
+    : ArtifactKey(std::move(cache_dir), std::move(artifact), std::move(extension), g_vpr_ctx.device().arch->architecture_id) {}
+
+ArtifactKey::ArtifactKey(std::string cache_dir, std::string artifact, std::string extension, const std::string& architecture_id)
+    : cache_dir_(std::move(cache_dir))
+    , artifact_(std::move(artifact))
+    , extension_(std::move(extension)) {
+    //Exact floating point option values
+    key_.precision(std::numeric_limits<double>::max_digits10);
+
+    add("artifact", artifact_);
+    add("vpr_version", vtr::VERSION);
+    add("architecture_id", architecture_id);
+}
+
+ArtifactKey& ArtifactKey::add_device(const DeviceGrid& grid, const t_chan_width& chan_width) {
+    add("grid", grid.name());
+    add("grid_layers", grid.get_num_layers());
+    add("grid_width", grid.width());
+    add("grid_height", grid.height());
+    add("chan_width_max", chan_width.max);
+    add("chan_width_x_max", chan_width.x_max);
+    add("chan_width_y_max", chan_width.y_max);
+    add("chan_width_x_min", chan_width.x_min);
+    add("chan_width_y_min", chan_width.y_min);
+    add("chan_width_x_list", chan_width.x_list);
+    add("chan_width_y_list", chan_width.y_list);
+    return *this;
+}
+
+std::string ArtifactKey::path() const {
+    std::istringstream key(key_.str());
+    std::string digest = vtr::secure_digest_stream(key);
+
+    //Drop the hash type prefix (e.g. 'SHA256:'), which is not valid in all file names
+    digest = digest.substr(digest.find(':') + 1);
+
+    return (std::filesystem::path(cache_dir_) / (artifact_ + "-" + digest + extension_)).string();
+}
+
+bool artifact_cache_contains(const std::string& path) {
+    std::error_code ec;
+    return std::filesystem::is_regular_file(path, ec);
+}
+
+void artifact_cache_store(const std::string& path, const std::function<void(const std::string&)>& write_fn) {
+    static std::atomic<unsigned> num_stored(0);
+
+    std::filesystem::path final_path(path);
+    std::error_code ec;
+    std::filesystem::create_directories(final_path.parent_path(), ec);
+    if (ec) {
+        VTR_LOG_WARN("Failed to create artifact cache directory '%s': %s\n",
+                     final_path.parent_path().string().c_str(), ec.message().c_str());
+        return;
+    }
+
+    //Unique per process (and per store within a process), keeping the extension
+    //since writers pick the file format from it
+    std::filesystem::path tmp_path = final_path;
+    tmp_path.replace_extension(vtr::string_fmt(".tmp%d_%u%s", int(getpid()), num_stored++, final_path.extension().string().c_str()));
+
+    write_fn(tmp_path.string());
+
+    //Atomic within a directory, so concurrent readers see either no file or a complete one.
+    //If another process stored the same entry first it is simply replaced by an identical file.
+    std::filesystem::rename(tmp_path, final_path, ec);
+    if (ec) {
+        VTR_LOG_WARN("Failed to store artifact cache entry '%s': %s\n", path.c_str(), ec.message().c_str());
+        std::filesystem::remove(tmp_path, ec);
+        return;
+    }
+
+    VTR_LOG("Stored artifact cache entry '%s'\n", path.c_str());
+}
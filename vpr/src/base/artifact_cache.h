@@ -0,0 +1,90 @@
+#ifndef ARTIFACT_CACHE_H
+#define ARTIFACT_CACHE_H
+
+/**
+ * @file
+ * @brief A content-addressed on-disk cache of expensive, deterministic VPR
+ *        artifacts (compiled architecture, RR graph, router lookahead, placement delay model
+ *        and power callibration/transistor counts).
+ *
+ * Each artifact is stored as <cache_dir>/<artifact>-<digest><extension>, where the
+ * digest covers the VPR version, the architecture file digest and every option the
+ * artifact depends on (see ArtifactKey). Run to run the same key maps to the same
+ * file, so an artifact computed by one run is reused by all later runs.
+ *
+ * A cache entry is written to a uniquely named temporary file in the cache directory
+ * and then atomically renamed into place. Concurrent runs may therefore race to
+ * produce an entry, but a reader only ever sees a complete file.
+ *
+ * The cache is best-effort: failing to write an entry only produces a warning.
+ */
+
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "device_grid.h"
+#include "rr_graph_type.h"
+
+/**
+ * @brief Builds the cache file path of an artifact from everything it depends on.
+ *
+ * Example:
+ *
+ *      ArtifactKey key(cache_dir, "router_lookahead", ".blob");
+ *      key.add_device(grid, chan_width);
+ *      key.add("lookahead_type", int(router_opts.lookahead_type));
+ *      std::string file = key.path();
+ */
+class ArtifactKey {
+  public:
+    ///@brief The key always covers the VPR version and the architecture file digest
+    ArtifactKey(std::string cache_dir, std::string artifact, std::string extension);
+
+    ///@brief As above, for artifacts needed before the architecture is loaded (architecture_id being its file digest)
+    ArtifactKey(std::string cache_dir, std::string artifact, std::string extension, const std::string& architecture_id);
+
+    ///@brief Adds a named value the artifact depends on
+    template<typename T>
+    ArtifactKey& add(const char* name, const T& value) {
+        key_ << name << '=' << value << '\n';
+        return *this;
+    }
+
+    ///@brief Adds a named list of values the artifact depends on
+    template<typename T>
+    ArtifactKey& add(const char* name, const std::vector<T>& values) {
+        key_ << name << '=';
+        for (const T& value : values) {
+            key_ << value << ',';
+        }
+        key_ << '\n';
+        return *this;
+    }
+
+    ///@brief Adds the device size and channel widths
+    ArtifactKey& add_device(const DeviceGrid& grid, const t_chan_width& chan_width);
+
+    ///@brief Returns the cache file path of the artifact
+    std::string path() const;
+
+  private:
+    std::string cache_dir_;
+    std::string artifact_;
+    std::string extension_;
+    std::ostringstream key_;
+};
+
+///@brief Returns true if the cache file path exists
+bool artifact_cache_contains(const std::string& path);
+
+/**
+ * @brief Stores an artifact at the cache file path.
+ *
+ * write_fn is called with the path of a temporary file (with the same extension
+ * as path) to write the artifact to, which is then atomically renamed to path.
+ */
+void artifact_cache_store(const std::string& path, const std::function<void(const std::string&)>& write_fn);
+
+#endif
@@ -15,12 +15,18 @@ const t_pb* AtomLookup::atom_pb(const AtomBlockId blk_id) const {
 }
 
 AtomBlockId AtomLookup::pb_atom(const t_pb* pb) const {
-    auto iter = atom_to_pb_.find(pb);
-    if (iter == atom_to_pb_.inverse_end()) {
+    //The atom recorded in the pb is only mapped to it if it maps back to the pb
+    //(the mapping of an atom can be removed or changed without touching its old pb,
+    //which may already be freed)
+    if (!pb) {
+        return AtomBlockId::INVALID();
+    }
+    AtomBlockId blk_id = pb->lookup_atom;
+    if (!blk_id || atom_pb(blk_id) != pb) {
         //Not found
         return AtomBlockId::INVALID();
     }
-    return iter->second;
+    return blk_id;
 }
 
 const t_pb_graph_node* AtomLookup::atom_pb_graph_node(const AtomBlockId blk_id) const {
@@ -38,13 +44,22 @@ void AtomLookup::set_atom_pb(const AtomBlockId blk_id, const t_pb* pb) {
 
     if (!blk_id && pb) {
         //Remove
-        atom_to_pb_.erase(pb);
+        AtomBlockId old_blk_id = pb_atom(pb);
+        if (old_blk_id) {
+            atom_to_pb_.erase(old_blk_id);
+        }
+        pb->lookup_atom = AtomBlockId::INVALID();
     } else if (blk_id && !pb) {
         //Remove
         atom_to_pb_.erase(blk_id);
     } else if (blk_id && pb) {
-        //If both are valid store the mapping
-        atom_to_pb_.update(blk_id, pb);
+        //If both are valid store the mapping, replacing any previous mapping of pb
+        AtomBlockId old_blk_id = pb_atom(pb);
+        if (old_blk_id && old_blk_id != blk_id) {
+            atom_to_pb_.erase(old_blk_id);
+        }
+        atom_to_pb_[blk_id] = pb;
+        pb->lookup_atom = blk_id;
     }
 }
 
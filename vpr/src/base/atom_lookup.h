@@ -2,8 +2,6 @@
 #define ATOM_LOOKUP_H
 #include "atom_lookup_fwd.h"
 
-#include <unordered_map>
-
 #include "vtr_bimap.h"
 #include "vtr_vector_map.h"
 #include "vtr_range.h"
@@ -106,7 +104,8 @@ class AtomLookup {
 
   private: //Types
   private:
-    vtr::bimap<AtomBlockId, const t_pb*, vtr::linear_map, std::unordered_map> atom_to_pb_;
+    ///@brief The pb of each atom. Its reverse side is stored in the pbs (see t_pb::lookup_atom)
+    vtr::linear_map<AtomBlockId, const t_pb*> atom_to_pb_;
 
     vtr::vector_map<AtomPinId, const t_pb_graph_pin*> atom_pin_to_pb_graph_pin_;
 
@@ -225,6 +225,144 @@ void AtomNetlist::add_net_alias(const std::string net_name, const std::string al
     net_aliases_map_[net_name].insert(alias_net_name);
 }
 
+void AtomNetlist::write_flat_blob_sections(vtr::FlatBlobWriter& writer) const {
+    Netlist::write_flat_blob_sections(writer);
+
+    //The models are written by name (the INPAD and OUTPAD models first), with the index of each block's model
+    std::vector<std::string> model_names;
+    std::unordered_map<const t_model*, int32_t> model_indices;
+    auto model_index = [&](const t_model* model) {
+        auto result = model_indices.emplace(model, model_names.size());
+        if (result.second) {
+            model_names.push_back(model->name);
+        }
+        return result.first->second;
+    };
+    model_index(inpad_model_);
+    model_index(outpad_model_);
+
+    std::vector<int32_t> block_model_indices;
+    block_model_indices.reserve(blocks().size());
+    for (AtomBlockId blk_id : blocks()) {
+        block_model_indices.push_back(model_index(block_models_[blk_id]));
+    }
+    add_flat_blob_string_sections(writer, model_names);
+    writer.add_array(block_model_indices);
+
+    //The truth tables, as the offsets of each block's rows, the offset of each row's values, and the values
+    std::vector<uint64_t> block_row_offsets = {0};
+    std::vector<uint64_t> row_value_offsets = {0};
+    std::vector<vtr::LogicValue> values;
+    for (AtomBlockId blk_id : blocks()) {
+        for (const std::vector<vtr::LogicValue>& row : block_truth_tables_[blk_id]) {
+            values.insert(values.end(), row.begin(), row.end());
+            row_value_offsets.push_back(values.size());
+        }
+        block_row_offsets.push_back(row_value_offsets.size() - 1);
+    }
+    writer.add_array(block_row_offsets);
+    writer.add_array(row_value_offsets);
+    writer.add_array(values);
+
+    //The net aliases, as (net name, alias) pairs
+    std::vector<std::string> net_aliases;
+    for (const auto& kv : net_aliases_map_) {
+        for (const std::string& alias : kv.second) {
+            net_aliases.push_back(kv.first);
+            net_aliases.push_back(alias);
+        }
+    }
+    add_flat_blob_string_sections(writer, net_aliases);
+
+    //The port models are not written, since they are found by name on each block's model
+}
+
+//Returns the port of model with the specified name, or nullptr if there is none
+static const t_model_ports* find_model_port(const t_model* model, const std::string& name) {
+    for (const t_model_ports* ports : {model->inputs, model->outputs}) {
+        for (const t_model_ports* port = ports; port != nullptr; port = port->next) {
+            if (name == port->name) {
+                return port;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void AtomNetlist::read_flat_blob_sections(const vtr::FlatBlobReader& reader, size_t& isection, const t_model* user_models, const t_model* library_models) {
+    Netlist::read_flat_blob_sections(reader, isection);
+
+    //Models (user models take precedence over library models with the same name, as when reading the BLIF)
+    std::vector<std::string> model_names = read_flat_blob_string_sections(reader, isection);
+    std::vector<const t_model*> models;
+    for (const std::string& model_name : model_names) {
+        const t_model* found_model = nullptr;
+        for (const t_model* arch_models : {user_models, library_models}) {
+            for (const t_model* model = arch_models; model != nullptr && found_model == nullptr; model = model->next) {
+                if (model_name == model->name) {
+                    found_model = model;
+                }
+            }
+        }
+        if (found_model == nullptr) {
+            VPR_FATAL_ERROR(VPR_ERROR_ATOM_NETLIST, "Netlist model '%s' not found in the architecture\n", model_name.c_str());
+        }
+        models.push_back(found_model);
+    }
+    if (models.size() < 2) {
+        throw vtr::VtrError("Missing INPAD and OUTPAD models in flat blob", __FILE__, __LINE__);
+    }
+    set_block_types(models[0], models[1]);
+
+    vtr::array_view<const int32_t> block_model_indices = reader.array<int32_t>(isection++);
+    if (block_model_indices.size() != blocks().size()) {
+        throw vtr::VtrError("Inconsistent number of block models in flat blob", __FILE__, __LINE__);
+    }
+    block_models_.clear();
+    for (int32_t imodel : block_model_indices) {
+        if (imodel < 0 || size_t(imodel) >= models.size()) {
+            throw vtr::VtrError("Invalid block model in flat blob", __FILE__, __LINE__);
+        }
+        block_models_.push_back(models[imodel]);
+    }
+
+    //Truth tables
+    vtr::array_view<const vtr::LogicValue> values = reader.array<vtr::LogicValue>(isection + 2);
+    vtr::array_view<const uint64_t> row_value_offsets = read_flat_blob_offsets(reader, isection + 1, values.size());
+    vtr::array_view<const uint64_t> block_row_offsets = read_flat_blob_offsets(reader, isection, row_value_offsets.size() - 1);
+    isection += 3;
+    if (block_row_offsets.size() != blocks().size() + 1) {
+        throw vtr::VtrError("Inconsistent number of truth tables in flat blob", __FILE__, __LINE__);
+    }
+    block_truth_tables_.clear();
+    block_truth_tables_.resize(blocks().size());
+    for (AtomBlockId blk_id : blocks()) {
+        TruthTable& truth_table = block_truth_tables_[blk_id];
+        for (size_t irow = block_row_offsets[size_t(blk_id)]; irow < block_row_offsets[size_t(blk_id) + 1]; ++irow) {
+            truth_table.emplace_back(values.begin() + row_value_offsets[irow], values.begin() + row_value_offsets[irow + 1]);
+        }
+    }
+
+    //Net aliases
+    std::vector<std::string> net_aliases = read_flat_blob_string_sections(reader, isection);
+    net_aliases_map_.clear();
+    for (size_t i = 0; i + 1 < net_aliases.size(); i += 2) {
+        net_aliases_map_[net_aliases[i]].insert(net_aliases[i + 1]);
+    }
+
+    //Port models
+    port_models_.clear();
+    for (AtomPortId port_id : ports()) {
+        const t_model* model = block_model(port_block(port_id));
+        const t_model_ports* model_port = find_model_port(model, port_name(port_id));
+        if (model_port == nullptr) {
+            VPR_FATAL_ERROR(VPR_ERROR_ATOM_NETLIST, "Port '%s' not found on netlist model '%s'\n",
+                            port_name(port_id).c_str(), model->name);
+        }
+        port_models_.push_back(model_port);
+    }
+}
+
 void AtomNetlist::remove_block_impl(const AtomBlockId /*blk_id*/) {
     //Unused
 }
@@ -292,6 +430,13 @@ void AtomNetlist::shrink_to_fit_impl() {
     port_models_.shrink_to_fit();
 }
 
+size_t AtomNetlist::memory_usage_impl() const {
+    return vtr::memory_usage(block_models_)
+           + vtr::memory_usage(block_truth_tables_)
+           + vtr::memory_usage(port_models_)
+           + vtr::memory_usage(net_aliases_map_);
+}
+
 /*
  *
  * Sanity Checks
@@ -220,6 +220,28 @@ class AtomNetlist : public Netlist<AtomBlockId, AtomPortId, AtomPinId, AtomNetId
      */
     void add_net_alias(const std::string net_name, std::string alias_net_name);
 
+    /*
+     * Snapshots
+     */
+
+    /**
+     * @brief Appends the netlist as the next sections of a flat blob (see netlist_snapshot.h)
+     *
+     * Models are written by name, so the blob can be read back against the models of a
+     * later run. The netlist must be compressed, and must not change until the blob is written.
+     */
+    void write_flat_blob_sections(vtr::FlatBlobWriter& writer) const;
+
+    /**
+     * @brief Replaces the netlist with that written by write_flat_blob_sections()
+     *
+     *   @param reader          The flat blob to read
+     *   @param isection        The first section to read, which is advanced past the sections read
+     *   @param user_models     The user models, used to look up the models of blocks by name
+     *   @param library_models  The library models, used to look up the models of blocks by name
+     */
+    void read_flat_blob_sections(const vtr::FlatBlobReader& reader, size_t& isection, const t_model* user_models, const t_model* library_models);
+
   private: //Private members
     /*
      * Component removal
@@ -247,6 +269,8 @@ class AtomNetlist : public Netlist<AtomBlockId, AtomPortId, AtomPinId, AtomNetId
     ///@brief Shrinks internal data structures to required size to reduce memory consumption
     void shrink_to_fit_impl() override;
 
+    size_t memory_usage_impl() const override;
+
     /*
      * Sanity checks
      */
@@ -8,6 +8,7 @@
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_vector.h"
 
 #include "vpr_error.h"
 #include "vpr_utils.h"
@@ -23,6 +24,9 @@ int infer_and_mark_constant_pins(AtomNetlist& netlist, e_const_gen_inference con
 ///@brief Marks all primtive output pins which have no combinationally connected inputs as constant pins
 int mark_undriven_primitive_outputs_as_constant(AtomNetlist& netlist, int verbosity);
 
+///@brief Marks all primtive output pins of blk which have no combinationally connected inputs as constant pins
+int mark_undriven_block_outputs_as_constant(AtomNetlist& netlist, AtomBlockId blk, int verbosity);
+
 ///@brief Marks all primtive output pins of blk which have only constant inputs as constant pins
 int infer_and_mark_block_pins_constant(AtomNetlist& netlist, AtomBlockId blk, e_const_gen_inference const_gen_inference_method, int verbosity);
 int infer_and_mark_block_combinational_outputs_constant(AtomNetlist& netlist, AtomBlockId blk, e_const_gen_inference const_gen_inference_method, int verbosity);
@@ -443,45 +447,52 @@ int mark_undriven_primitive_outputs_as_constant(AtomNetlist& netlist, int verbos
     for (AtomBlockId blk : netlist.blocks()) {
         if (!blk) continue;
 
-        //Don't mark primary I/Os as constants
-        if (netlist.block_type(blk) != AtomBlockType::BLOCK) continue;
+        num_pins_marked_constant += mark_undriven_block_outputs_as_constant(netlist, blk, verbosity);
+    }
 
-        for (AtomPortId output_port : netlist.block_output_ports(blk)) {
-            const t_model_ports* model_port = netlist.port_model(output_port);
+    return num_pins_marked_constant;
+}
+
+int mark_undriven_block_outputs_as_constant(AtomNetlist& netlist, AtomBlockId blk, int verbosity) {
+    //Don't mark primary I/Os as constants
+    if (netlist.block_type(blk) != AtomBlockType::BLOCK) return 0;
 
-            //Don't mark sequential or clock generator ports as constants
-            if (!model_port->clock.empty() || model_port->is_clock) continue;
+    int num_pins_marked_constant = 0;
+    for (AtomPortId output_port : netlist.block_output_ports(blk)) {
+        const t_model_ports* model_port = netlist.port_model(output_port);
 
-            //Find the upstream combinationally connected ports
-            std::vector<AtomPortId> upstream_ports = find_combinationally_connected_input_ports(netlist, output_port);
+        //Don't mark sequential or clock generator ports as constants
+        if (!model_port->clock.empty() || model_port->is_clock) continue;
 
-            //Check if any of the 'upstream' input pins have connected nets
-            //
-            //Note that we only check to see whether they are *connected* not whether they are non-constant.
-            //Inference of pins as constant generators from upstream *constant nets* is handled elsewhere.
-            bool has_connected_inputs = false;
-            for (AtomPortId input_port : upstream_ports) {
-                for (AtomPinId input_pin : netlist.port_pins(input_port)) {
-                    AtomNetId input_net = netlist.pin_net(input_pin);
-
-                    if (input_net) {
-                        has_connected_inputs = true;
-                        break;
-                    }
+        //Find the upstream combinationally connected ports
+        std::vector<AtomPortId> upstream_ports = find_combinationally_connected_input_ports(netlist, output_port);
+
+        //Check if any of the 'upstream' input pins have connected nets
+        //
+        //Note that we only check to see whether they are *connected* not whether they are non-constant.
+        //Inference of pins as constant generators from upstream *constant nets* is handled elsewhere.
+        bool has_connected_inputs = false;
+        for (AtomPortId input_port : upstream_ports) {
+            for (AtomPinId input_pin : netlist.port_pins(input_port)) {
+                AtomNetId input_net = netlist.pin_net(input_pin);
+
+                if (input_net) {
+                    has_connected_inputs = true;
+                    break;
                 }
             }
+        }
 
-            if (!has_connected_inputs) {
-                //The current output port has no inputs driving the primitive's internal
-                //timing edges. Therefore we treat all its pins as constant generators.
-                for (AtomPinId output_pin : netlist.port_pins(output_port)) {
-                    if (netlist.pin_is_constant(output_pin)) continue;
+        if (!has_connected_inputs) {
+            //The current output port has no inputs driving the primitive's internal
+            //timing edges. Therefore we treat all its pins as constant generators.
+            for (AtomPinId output_pin : netlist.port_pins(output_port)) {
+                if (netlist.pin_is_constant(output_pin)) continue;
 
-                    VTR_LOGV(verbosity > 1, "Marking pin '%s' as constant since it has no combinationally connected inputs\n",
-                             netlist.pin_name(output_pin).c_str());
-                    netlist.set_pin_is_constant(output_pin, true);
-                    ++num_pins_marked_constant;
-                }
+                VTR_LOGV(verbosity > 1, "Marking pin '%s' as constant since it has no combinationally connected inputs\n",
+                         netlist.pin_name(output_pin).c_str());
+                netlist.set_pin_is_constant(output_pin, true);
+                ++num_pins_marked_constant;
             }
         }
     }
@@ -990,13 +1001,11 @@ size_t sweep_constant_primary_outputs(AtomNetlist& netlist, int verbosity) {
     return removed_count;
 }
 
-size_t sweep_iterative(AtomNetlist& netlist,
-                       bool should_sweep_ios,
-                       bool should_sweep_nets,
-                       bool should_sweep_blocks,
-                       bool should_sweep_constant_primary_outputs,
-                       e_const_gen_inference const_gen_inference_method,
-                       int verbosity) {
+///@brief Counts of the work done (and the netlist elements swept) by IterativeSweeper
+struct t_sweep_stats {
+    size_t blocks_visited = 0;
+    size_t nets_visited = 0;
+
     size_t dangling_nets_swept = 0;
     size_t dangling_blocks_swept = 0;
     size_t dangling_inputs_swept = 0;
@@ -1004,70 +1013,296 @@ size_t sweep_iterative(AtomNetlist& netlist,
     size_t constant_outputs_swept = 0;
     size_t constant_generators_marked = 0;
 
-    //We perform multiple passes of sweeping, since sweeping something may
-    //enable more things to be swept afterward.
-    //
-    //We keep sweeping until nothing else is removed
-    size_t pass_dangling_nets_swept;
-    size_t pass_dangling_blocks_swept;
-    size_t pass_dangling_inputs_swept;
-    size_t pass_dangling_outputs_swept;
-    size_t pass_constant_outputs_swept;
-    size_t pass_constant_generators_marked;
-    do {
-        pass_dangling_nets_swept = 0;
-        pass_dangling_blocks_swept = 0;
-        pass_dangling_inputs_swept = 0;
-        pass_dangling_outputs_swept = 0;
-        pass_constant_outputs_swept = 0;
-        pass_constant_generators_marked = 0;
-
-        if (should_sweep_ios) {
-            pass_dangling_inputs_swept += sweep_inputs(netlist, verbosity);
-            pass_dangling_outputs_swept += sweep_outputs(netlist, verbosity);
+    size_t num_swept() const {
+        return dangling_nets_swept
+               + dangling_blocks_swept
+               + dangling_inputs_swept
+               + dangling_outputs_swept
+               + constant_outputs_swept;
+    }
+
+    t_sweep_stats& operator+=(const t_sweep_stats& rhs) {
+        blocks_visited += rhs.blocks_visited;
+        nets_visited += rhs.nets_visited;
+        dangling_nets_swept += rhs.dangling_nets_swept;
+        dangling_blocks_swept += rhs.dangling_blocks_swept;
+        dangling_inputs_swept += rhs.dangling_inputs_swept;
+        dangling_outputs_swept += rhs.dangling_outputs_swept;
+        constant_outputs_swept += rhs.constant_outputs_swept;
+        constant_generators_marked += rhs.constant_generators_marked;
+        return *this;
+    }
+};
+
+/**
+ * @brief Sweeps the netlist to a fixed point using a worklist of the blocks and nets to (re-)visit
+ *
+ * Initially every block and net is queued. Removing a block (or net), or marking a pin constant,
+ * only re-queues the adjacent nets and blocks (which are the only ones whose sweepability may have
+ * changed), so the total work is proportional to the netlist size plus the number of changes,
+ * rather than the number of sweep iterations times the netlist size.
+ *
+ * Elements queued while processing a pass are visited in the next pass. A pass is therefore
+ * equivalent to one iteration of sweeping the whole netlist, restricted to the elements which
+ * may have changed.
+ */
+class IterativeSweeper {
+  public:
+    IterativeSweeper(AtomNetlist& netlist,
+                     bool should_sweep_ios,
+                     bool should_sweep_nets,
+                     bool should_sweep_blocks,
+                     bool should_sweep_constant_primary_outputs,
+                     e_const_gen_inference const_gen_inference_method,
+                     int verbosity)
+        : netlist_(netlist)
+        , should_sweep_ios_(should_sweep_ios)
+        , should_sweep_nets_(should_sweep_nets)
+        , should_sweep_blocks_(should_sweep_blocks)
+        , should_sweep_constant_primary_outputs_(should_sweep_constant_primary_outputs)
+        , const_gen_inference_method_(const_gen_inference_method)
+        , verbosity_(verbosity) {
+        //Elements which were removed before sweeping are treated as already swept
+        block_removed_.resize(netlist_.blocks().size(), true);
+        block_queued_.resize(netlist_.blocks().size(), false);
+        for (AtomBlockId blk : netlist_.blocks()) {
+            if (!blk) continue;
+            block_removed_[blk] = false;
+            enqueue_block(blk);
+        }
+
+        net_removed_.resize(netlist_.nets().size(), true);
+        net_queued_.resize(netlist_.nets().size(), false);
+        for (AtomNetId net : netlist_.nets()) {
+            if (!net) continue;
+            net_removed_[net] = false;
+            enqueue_net(net);
+        }
+    }
+
+    ///@brief Sweeps until the worklist is empty, returning the total statistics over all passes
+    t_sweep_stats sweep() {
+        t_sweep_stats total_stats;
+
+        std::vector<AtomBlockId> pass_blocks;
+        std::vector<AtomNetId> pass_nets;
+        size_t num_passes = 0;
+        while (!queued_blocks_.empty() || !queued_nets_.empty()) {
+            ++num_passes;
+            t_sweep_stats pass_stats;
+
+            pass_blocks.clear();
+            pass_nets.clear();
+            std::swap(pass_blocks, queued_blocks_);
+            std::swap(pass_nets, queued_nets_);
+
+            for (AtomBlockId blk : pass_blocks) {
+                block_queued_[blk] = false;
+                visit_block(blk, pass_stats);
+            }
+
+            for (AtomNetId net : pass_nets) {
+                net_queued_[net] = false;
+                visit_net(net, pass_stats);
+            }
+
+            VTR_LOGV(verbosity_ > 1, "Sweep pass %zu: visited %zu block(s) and %zu net(s), swept %zu input(s), %zu output(s) (%zu dangling, %zu constant), %zu net(s), %zu block(s), marked %zu constant pin(s)\n",
+                     num_passes,
+                     pass_stats.blocks_visited,
+                     pass_stats.nets_visited,
+                     pass_stats.dangling_inputs_swept,
+                     pass_stats.dangling_outputs_swept + pass_stats.constant_outputs_swept,
+                     pass_stats.dangling_outputs_swept,
+                     pass_stats.constant_outputs_swept,
+                     pass_stats.dangling_nets_swept,
+                     pass_stats.dangling_blocks_swept,
+                     pass_stats.constant_generators_marked);
+
+            total_stats += pass_stats;
+        }
+
+        VTR_LOGV(verbosity_ > 0, "Sweep passes        : %zu (visited %zu block(s) and %zu net(s))\n",
+                 num_passes, total_stats.blocks_visited, total_stats.nets_visited);
+
+        return total_stats;
+    }
+
+  private:
+    void visit_block(AtomBlockId blk, t_sweep_stats& stats) {
+        if (block_removed_[blk]) return;
+        ++stats.blocks_visited;
+
+        AtomBlockType type = netlist_.block_type(blk);
+
+        std::string reason;
+        if (should_sweep_ios_ && is_removable_input(netlist_, blk, &reason)) {
+            VTR_LOGV_WARN(verbosity_ > 1, "Primary input '%s' will be swept (%s)\n", netlist_.block_name(blk).c_str(), reason.c_str());
+            remove_block(blk);
+            ++stats.dangling_inputs_swept;
+            return;
+        }
+
+        if (should_sweep_ios_ && is_removable_output(netlist_, blk, &reason)) {
+            VTR_LOGV_WARN(verbosity_ > 1, "Primary output '%s' will be swept (%s)\n", netlist_.block_name(blk).c_str(), reason.c_str());
+            remove_block(blk);
+            ++stats.dangling_outputs_swept;
+            return;
+        }
+
+        //Inpads/outpads are only swept by the I/O sweeps above
+        if (should_sweep_blocks_ && type == AtomBlockType::BLOCK && is_removable_block(netlist_, blk, &reason)) {
+            VTR_LOGV_WARN(verbosity_ > 1, "Block '%s' will be swept (%s)\n", netlist_.block_name(blk).c_str(), reason.c_str());
+            remove_block(blk);
+            ++stats.dangling_blocks_swept;
+            return;
+        }
+
+        if (should_sweep_constant_primary_outputs_ && type == AtomBlockType::OUTPAD && all_inputs_constant(blk)) {
+            VTR_LOGV_WARN(verbosity_ > 2, "Sweeping constant primary output '%s'\n", netlist_.block_name(blk).c_str());
+            remove_block(blk);
+            ++stats.constant_outputs_swept;
+            return;
+        }
+
+        int num_marked = mark_undriven_block_outputs_as_constant(netlist_, blk, verbosity_)
+                         + infer_and_mark_block_pins_constant(netlist_, blk, const_gen_inference_method_, verbosity_);
+        if (num_marked > 0) {
+            stats.constant_generators_marked += num_marked;
+
+            //Newly constant nets may make their sinks constant (or sweepable constant outputs)
+            for (AtomPinId pin : netlist_.block_output_pins(blk)) {
+                AtomNetId net = netlist_.pin_net(pin);
+                if (net && netlist_.pin_is_constant(pin)) {
+                    for (AtomPinId sink : netlist_.net_sinks(net)) {
+                        enqueue_block(netlist_.pin_block(sink));
+                    }
+                }
+            }
+        }
+    }
+
+    void visit_net(AtomNetId net, t_sweep_stats& stats) {
+        if (net_removed_[net]) return;
+        ++stats.nets_visited;
+
+        if (!should_sweep_nets_) return;
+
+        bool remove = false;
+        if (!netlist_.net_driver(net)) {
+            VTR_LOGV_WARN(verbosity_ > 1, "Net '%s' has no driver and will be removed\n", netlist_.net_name(net).c_str());
+            remove = true;
+        }
+        if (netlist_.net_sinks(net).size() == 0) {
+            VTR_LOGV_WARN(verbosity_ > 1, "Net '%s' has no sinks and will be removed\n", netlist_.net_name(net).c_str());
+            remove = true;
         }
 
-        if (should_sweep_blocks) {
-            pass_dangling_blocks_swept += sweep_blocks(netlist, verbosity);
+        if (remove) {
+            remove_net(net);
+            ++stats.dangling_nets_swept;
         }
+    }
 
-        if (should_sweep_nets) {
-            pass_dangling_nets_swept += sweep_nets(netlist, verbosity);
+    bool all_inputs_constant(AtomBlockId blk) const {
+        for (AtomPinId pin : netlist_.block_input_pins(blk)) {
+            AtomNetId net = netlist_.pin_net(pin);
+            if (net && !netlist_.net_is_constant(net)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void remove_block(AtomBlockId blk) {
+        //The block's nets (and the other blocks on them) may become sweepable
+        for (AtomPinId pin : netlist_.block_pins(blk)) {
+            AtomNetId net = netlist_.pin_net(pin);
+            if (!net) continue;
+
+            enqueue_net(net);
+            for (AtomPinId net_pin : netlist_.net_pins(net)) {
+                if (net_pin && net_pin != pin) {
+                    enqueue_block(netlist_.pin_block(net_pin));
+                }
+            }
         }
 
-        if (should_sweep_constant_primary_outputs) {
-            pass_constant_outputs_swept += sweep_constant_primary_outputs(netlist, verbosity);
+        netlist_.remove_block(blk);
+        block_removed_[blk] = true;
+    }
+
+    void remove_net(AtomNetId net) {
+        //The blocks which were connected to the net may become sweepable
+        for (AtomPinId pin : netlist_.net_pins(net)) {
+            if (pin) {
+                enqueue_block(netlist_.pin_block(pin));
+            }
         }
 
-        pass_constant_generators_marked += mark_constant_generators(netlist, const_gen_inference_method, verbosity);
-
-        dangling_nets_swept += pass_dangling_nets_swept;
-        dangling_blocks_swept += pass_dangling_blocks_swept;
-        dangling_inputs_swept += pass_dangling_inputs_swept;
-        dangling_outputs_swept += pass_dangling_outputs_swept;
-        constant_outputs_swept += pass_constant_outputs_swept;
-        constant_generators_marked += pass_constant_generators_marked;
-    } while (pass_dangling_nets_swept != 0
-             || pass_dangling_blocks_swept != 0
-             || pass_dangling_inputs_swept != 0
-             || pass_dangling_outputs_swept != 0
-             || pass_constant_outputs_swept != 0
-             || pass_constant_generators_marked != 0);
-
-    VTR_LOGV(verbosity > 0, "Swept input(s)      : %zu\n", dangling_inputs_swept);
+        netlist_.remove_net(net);
+        net_removed_[net] = true;
+    }
+
+    void enqueue_block(AtomBlockId blk) {
+        if (block_removed_[blk] || block_queued_[blk]) return;
+        block_queued_[blk] = true;
+        queued_blocks_.push_back(blk);
+    }
+
+    void enqueue_net(AtomNetId net) {
+        if (net_removed_[net] || net_queued_[net]) return;
+        net_queued_[net] = true;
+        queued_nets_.push_back(net);
+    }
+
+  private:
+    AtomNetlist& netlist_;
+
+    bool should_sweep_ios_;
+    bool should_sweep_nets_;
+    bool should_sweep_blocks_;
+    bool should_sweep_constant_primary_outputs_;
+    e_const_gen_inference const_gen_inference_method_;
+    int verbosity_;
+
+    std::vector<AtomBlockId> queued_blocks_; ///<Blocks to visit in the next pass
+    std::vector<AtomNetId> queued_nets_;     ///<Nets to visit in the next pass
+
+    vtr::vector<AtomBlockId, bool> block_queued_;
+    vtr::vector<AtomNetId, bool> net_queued_;
+    vtr::vector<AtomBlockId, bool> block_removed_;
+    vtr::vector<AtomNetId, bool> net_removed_;
+};
+
+size_t sweep_iterative(AtomNetlist& netlist,
+                       bool should_sweep_ios,
+                       bool should_sweep_nets,
+                       bool should_sweep_blocks,
+                       bool should_sweep_constant_primary_outputs,
+                       e_const_gen_inference const_gen_inference_method,
+                       int verbosity) {
+    //Sweeping something may enable more things to be swept afterward, so we
+    //keep sweeping (the elements adjacent to those changed) until nothing else
+    //is removed
+    IterativeSweeper sweeper(netlist,
+                             should_sweep_ios,
+                             should_sweep_nets,
+                             should_sweep_blocks,
+                             should_sweep_constant_primary_outputs,
+                             const_gen_inference_method,
+                             verbosity);
+    t_sweep_stats stats = sweeper.sweep();
+
+    VTR_LOGV(verbosity > 0, "Swept input(s)      : %zu\n", stats.dangling_inputs_swept);
     VTR_LOGV(verbosity > 0, "Swept output(s)     : %zu (%zu dangling, %zu constant)\n",
-             dangling_outputs_swept + constant_outputs_swept,
-             dangling_outputs_swept,
-             constant_outputs_swept);
-    VTR_LOGV(verbosity > 0, "Swept net(s)        : %zu\n", dangling_nets_swept);
-    VTR_LOGV(verbosity > 0, "Swept block(s)      : %zu\n", dangling_blocks_swept);
-    VTR_LOGV(verbosity > 0, "Constant Pins Marked: %zu\n", constant_generators_marked);
-
-    return dangling_nets_swept
-           + dangling_blocks_swept
-           + dangling_inputs_swept
-           + dangling_outputs_swept
-           + constant_outputs_swept;
+             stats.dangling_outputs_swept + stats.constant_outputs_swept,
+             stats.dangling_outputs_swept,
+             stats.constant_outputs_swept);
+    VTR_LOGV(verbosity > 0, "Swept net(s)        : %zu\n", stats.dangling_nets_swept);
+    VTR_LOGV(verbosity > 0, "Swept block(s)      : %zu\n", stats.dangling_blocks_swept);
+    VTR_LOGV(verbosity > 0, "Constant Pins Marked: %zu\n", stats.constant_generators_marked);
+
+    return stats.num_swept();
 }
 
 size_t sweep_blocks(AtomNetlist& netlist, int verbosity) {
@@ -28,6 +28,11 @@ void absorb_buffer_luts(AtomNetlist& netlist, int verbosity);
  * @brief Repeatedly sweeps the netlist removing blocks and nets
  *        until nothing more can be swept. If sweep_ios is true also sweeps
  *        primary-inputs and primary-outputs
+ *
+ * Only the blocks and nets adjacent to those removed (or newly marked constant)
+ * are re-visited after the first pass, so the run time is proportional to the
+ * netlist size plus the number of changes. Per-pass statistics are reported
+ * at verbosity > 1.
  */
 size_t sweep_iterative(AtomNetlist& netlist,
                        bool should_sweep_dangling_ios,
@@ -265,6 +265,14 @@ void ClusteredNetlist::shrink_to_fit_impl() {
     //Net data
 }
 
+size_t ClusteredNetlist::memory_usage_impl() const {
+    return vtr::memory_usage(block_pbs_)
+           + vtr::memory_usage(block_types_)
+           + vtr::memory_usage(block_logical_pins_)
+           + vtr::memory_usage(blocks_per_type_)
+           + vtr::memory_usage(pin_logical_index_);
+}
+
 /*
  *
  * Sanity Checks
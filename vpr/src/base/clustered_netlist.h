@@ -299,6 +299,9 @@ class ClusteredNetlist : public Netlist<ClusterBlockId, ClusterPortId, ClusterPi
     ///@brief Shrinks internal data structures to required size to reduce memory consumption
     void shrink_to_fit_impl() override;
 
+    ///@brief Excludes the (separately owned) t_pb hierarchy of each block
+    size_t memory_usage_impl() const override;
+
     /*
      * Component removal
      */
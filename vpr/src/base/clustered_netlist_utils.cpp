@@ -1,5 +1,10 @@
 #include "clustered_netlist_utils.h"
 #include "globals.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 ClusteredPinAtomPinsLookup::ClusteredPinAtomPinsLookup(const ClusteredNetlist& clustered_netlist, const AtomNetlist& atom_netlist, const IntraLbPbPinLookup& pb_gpin_lookup) {
     init_lookup(clustered_netlist, atom_netlist, pb_gpin_lookup);
 }
@@ -16,7 +21,8 @@ ClusterPinId ClusteredPinAtomPinsLookup::connected_clb_pin(AtomPinId atom_pin) c
 }
 
 void ClusteredPinAtomPinsLookup::init_lookup(const ClusteredNetlist& clustered_netlist, const AtomNetlist& atom_netlist, const IntraLbPbPinLookup& pb_gpin_lookup) {
-    auto clustered_pins = clustered_netlist.pins();
+    auto clustered_pin_range = clustered_netlist.pins();
+    std::vector<ClusterPinId> clustered_pins(clustered_pin_range.begin(), clustered_pin_range.end());
 
     clustered_pin_connected_atom_pins_.clear();
     clustered_pin_connected_atom_pins_.resize(clustered_pins.size());
@@ -24,11 +30,24 @@ void ClusteredPinAtomPinsLookup::init_lookup(const ClusteredNetlist& clustered_n
     atom_pin_connected_cluster_pin_.clear();
     atom_pin_connected_cluster_pin_.resize(atom_netlist.pins().size());
 
-    for (ClusterPinId clustered_pin : clustered_pins) {
+    //Tracing the pins through their clusters only reads the clusters, so the pins are traced in parallel...
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), clustered_pins.size(), [&](size_t i) {
+#else
+    for (size_t i = 0; i < clustered_pins.size(); ++i) {
+#endif
+        ClusterPinId clustered_pin = clustered_pins[i];
         auto clustered_block = clustered_netlist.pin_block(clustered_pin);
         int logical_pin_index = clustered_netlist.pin_logical_index(clustered_pin);
         clustered_pin_connected_atom_pins_[clustered_pin] = find_clb_pin_connected_atom_pins(clustered_block, logical_pin_index, pb_gpin_lookup);
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
 
+    //...before the (cheap) inverse lookup is filled in pin order
+    for (ClusterPinId clustered_pin : clustered_pins) {
         for (AtomPinId atom_pin : clustered_pin_connected_atom_pins_[clustered_pin]) {
             atom_pin_connected_cluster_pin_[atom_pin] = clustered_pin;
         }
@@ -1,5 +1,13 @@
 #include "constraints_load.h"
 
+#include <regex>
+
+#include "vpr_error.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 void echo_constraints(char* filename, VprConstraints constraints) {
     FILE* fp;
     fp = vtr::fopen(filename, "w");
@@ -12,3 +20,44 @@ void echo_constraints(char* filename, VprConstraints constraints) {
 
     fclose(fp);
 }
+
+std::vector<AtomBlockId> find_name_pattern_atoms(const AtomNetlist& netlist, const std::string& name_pattern) {
+    AtomBlockId atom_id = netlist.find_block(name_pattern);
+    if (atom_id) {
+        return {atom_id};
+    }
+
+    bool literal = name_pattern.find_first_of("\\^$.|?*+()[]{}") == std::string::npos;
+    std::regex name_regex;
+    if (!literal) {
+        try {
+            name_regex = std::regex(name_pattern);
+        } catch (const std::regex_error& error) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Invalid atom name_pattern '%s': %s\n", name_pattern.c_str(), error.what());
+        }
+    }
+
+    std::vector<AtomBlockId> blocks(netlist.blocks().begin(), netlist.blocks().end());
+    std::vector<char> matches(blocks.size(), false);
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), blocks.size(), [&](size_t i) {
+#else
+    for (size_t i = 0; i < blocks.size(); ++i) {
+#endif
+        const std::string& block_name = netlist.block_name(blocks[i]);
+        matches[i] = literal ? block_name.find(name_pattern) != std::string::npos
+                             : std::regex_search(block_name, name_regex);
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+
+    std::vector<AtomBlockId> atoms;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        if (matches[i]) {
+            atoms.push_back(blocks[i]);
+        }
+    }
+    return atoms;
+}
@@ -1,13 +1,28 @@
 #ifndef CONSTRAINTS_LOAD_H_
 #define CONSTRAINTS_LOAD_H_
 
+#include <string>
+#include <vector>
+
 #include "region.h"
 #include "partition.h"
 #include "partition_region.h"
 #include "vpr_constraints.h"
+#include "atom_netlist.h"
 #include "vtr_vector.h"
 
 ///@brief Used to print vpr's floorplanning constraints to an echo file "vpr_constraints.echo"
 void echo_constraints(char* filename, VprConstraints constraints);
 
+/**
+ * @brief Returns the atoms matched by the name_pattern of an add_atom constraint
+ *
+ * A name_pattern is either the exact name of an atom, which is looked up directly, or else
+ * a regular expression searched for in all atom names. Patterns without any regular expression
+ * special characters are searched for as plain substrings, without going through std::regex.
+ * The atom names are searched in parallel when VPR is built with TBB, and the matches are
+ * returned in netlist order.
+ */
+std::vector<AtomBlockId> find_name_pattern_atoms(const AtomNetlist& netlist, const std::string& name_pattern);
+
 #endif
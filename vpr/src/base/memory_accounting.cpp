@@ -0,0 +1,74 @@
+#include <algorithm>
+
+#include "memory_accounting.h"
+
+#include "vtr_log.h"
+#include "vtr_rusage.h"
+#include "vpr_error.h"
+#include "globals.h"
+
+static constexpr float BYTE_TO_MIB = 1024 * 1024;
+
+static size_t f_memory_budget_mib = 0;
+
+void set_memory_budget(size_t budget_mib) {
+    f_memory_budget_mib = budget_mib;
+}
+
+std::vector<t_memory_usage_entry> context_memory_usage() {
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& atom_ctx = g_vpr_ctx.atom();
+    const auto& cluster_ctx = g_vpr_ctx.clustering();
+    const auto& timing_ctx = g_vpr_ctx.timing();
+    const auto& routing_ctx = g_vpr_ctx.routing();
+
+    std::vector<t_memory_usage_entry> usage;
+    usage.push_back({"RR graph storage", device_ctx.rr_graph.rr_nodes().memory_usage()});
+    usage.push_back({"RR graph spatial lookup", device_ctx.rr_graph.node_lookup().memory_usage()});
+    usage.push_back({"Atom netlist", atom_ctx.nlist.memory_usage()});
+    usage.push_back({"Clustered netlist", cluster_ctx.clb_nlist.memory_usage()});
+    usage.push_back({"Timing graph", timing_ctx.graph ? timing_ctx.graph->memory_usage() : 0});
+
+    const RouterLookahead* router_lookahead = routing_ctx.cached_router_lookahead_.get(routing_ctx.router_lookahead_cache_key_);
+    usage.push_back({"Router lookahead", router_lookahead ? router_lookahead->memory_usage() : 0});
+
+    size_t route_tree_bytes = 0;
+    for (const auto& tree : routing_ctx.route_trees) {
+        if (tree) {
+            route_tree_bytes += tree->memory_usage();
+        }
+    }
+    usage.push_back({"Route trees", route_tree_bytes});
+
+    return usage;
+}
+
+void report_memory_usage(const std::string& stage, const std::vector<t_memory_usage_entry>& stage_usage) {
+    std::vector<t_memory_usage_entry> usage = context_memory_usage();
+    usage.insert(usage.end(), stage_usage.begin(), stage_usage.end());
+
+    float max_rss_mib = vtr::get_max_rss() / BYTE_TO_MIB;
+
+    VTR_LOG("Memory usage after %s (peak RSS %.1f MiB):\n", stage.c_str(), max_rss_mib);
+    size_t total_bytes = 0;
+    for (const t_memory_usage_entry& entry : usage) {
+        if (entry.bytes == 0) {
+            continue; //Not (yet) built
+        }
+        VTR_LOG("  %-32s %10.1f MiB\n", entry.name.c_str(), entry.bytes / BYTE_TO_MIB);
+        total_bytes += entry.bytes;
+    }
+    VTR_LOG("  %-32s %10.1f MiB\n", "Total accounted", total_bytes / BYTE_TO_MIB);
+
+    if (f_memory_budget_mib > 0 && max_rss_mib > f_memory_budget_mib) {
+        auto largest = std::max_element(usage.begin(), usage.end(),
+                                        [](const t_memory_usage_entry& lhs, const t_memory_usage_entry& rhs) {
+                                            return lhs.bytes < rhs.bytes;
+                                        });
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "Peak memory usage (%.1f MiB) after %s exceeds the memory budget of %zu MiB (see --memory_budget)."
+                        " The largest data structure is the %s (%.1f MiB).\n",
+                        max_rss_mib, stage.c_str(), f_memory_budget_mib,
+                        largest->name.c_str(), largest->bytes / BYTE_TO_MIB);
+    }
+}
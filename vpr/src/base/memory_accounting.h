@@ -0,0 +1,46 @@
+#ifndef VPR_MEMORY_ACCOUNTING_H
+#define VPR_MEMORY_ACCOUNTING_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * @brief Per-subsystem memory accounting
+ *
+ * The peak RSS of a run does not tell which data structure is responsible when a job
+ * runs out of memory. Each major data structure (RR graph storage and spatial look-up,
+ * netlists, timing graph and analyzer tags, router lookahead, route trees, placement
+ * delay model) reports its (approximate) heap footprint through a memory_usage() method,
+ * and VPR logs a breakdown after each flow stage, e.g.:
+ *
+ *      Memory usage after Placement (peak RSS 1520.3 MiB):
+ *        RR graph storage                  612.4 MiB
+ *        RR graph spatial lookup            40.1 MiB
+ *        ...
+ *
+ * If a memory budget is set (--memory_budget) VPR exits with an error as soon as the
+ * peak RSS exceeds it after a stage, naming the largest accounted data structure.
+ */
+
+struct t_memory_usage_entry {
+    std::string name;
+    size_t bytes = 0;
+};
+
+///@brief Returns the memory used by the major data structures held in the global VPR context
+std::vector<t_memory_usage_entry> context_memory_usage();
+
+/**
+ * @brief Logs the memory usage breakdown after the specified stage, and enforces the memory budget (if any)
+ *
+ *   @param stage       The name of the stage which just finished (e.g. "Placement")
+ *   @param stage_usage Memory used by data structures local to the stage (e.g. the placement delay model),
+ *                      reported along with those of the global VPR context
+ */
+void report_memory_usage(const std::string& stage, const std::vector<t_memory_usage_entry>& stage_usage = {});
+
+///@brief Sets the peak RSS (in MiB) above which report_memory_usage() exits with an error (0 for no budget)
+void set_memory_budget(size_t budget_mib);
+
+#endif
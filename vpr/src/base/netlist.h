@@ -346,6 +346,10 @@
  * In particular this prevents the (potentially large) strings from begin duplicated multiple times in various look-ups,
  * instead the more space efficient StringId is duplicated.
  *
+ * Block attributes and parameters are likewise stored as (name, value) pairs of StringIds in a per-block
+ * vector, so the names and values shared by many blocks (e.g. source locations or common parameter values
+ * in EBLIF files) are only stored once.
+ *
  * Note that StringId is an internal implementation detail and should not be exposed as part of the public interface.
  * Any public functions should take and return std::string's instead.
  *
@@ -413,7 +417,9 @@
  *    The derived functions based off of the virtual functions have suffix *_impl()
  *
  */
+#include <iterator>
 #include <string>
+#include <utility>
 #include <vector>
 #include <unordered_map>
 #include "vtr_range.h"
@@ -447,8 +453,9 @@ template<typename BlockId = ParentBlockId, typename PortId = ParentPortId, typen
 class Netlist {
   public: //Public Types
     typedef typename vtr::vector_map<BlockId, BlockId>::const_iterator block_iterator;
-    typedef typename std::unordered_map<std::string, std::string>::const_iterator attr_iterator;
-    typedef typename std::unordered_map<std::string, std::string>::const_iterator param_iterator;
+    class string_pair_iterator;
+    typedef string_pair_iterator attr_iterator;
+    typedef string_pair_iterator param_iterator;
     typedef typename vtr::vector_map<NetId, NetId>::const_iterator net_iterator;
     typedef typename vtr::vector_map<PinId, PinId>::const_iterator pin_iterator;
     typedef typename vtr::vector_map<PortId, PortId>::const_iterator port_iterator;
@@ -504,6 +511,9 @@ class Netlist {
     ///@brief Item counts and container info (for debugging)
     void print_stats() const;
 
+    ///@brief Returns the (approximate) heap memory used by the netlist, in bytes
+    size_t memory_usage() const;
+
     /*
      * Blocks
      */
@@ -944,12 +954,74 @@ class Netlist {
      */
     NetId add_net(const std::string name, PinId driver, std::vector<PinId> sinks);
 
+    /**
+     * @brief Appends the netlist's data as the next sections of a flat blob (e.g. a netlist snapshot)
+     *
+     * The netlist must be compressed, and must not change until the blob is written,
+     * since the larger arrays are referenced rather than copied.
+     *
+     * The net ignored/global flags are not written, since they are re-derived from the
+     * clustered netlist after each load.
+     */
+    void write_flat_blob_sections(vtr::FlatBlobWriter& writer) const;
+
+    /**
+     * @brief Replaces the netlist's data with that written by write_flat_blob_sections()
+     *        to the sections of reader from isection onwards
+     *
+     *   @param reader     The flat blob to read
+     *   @param isection   The first section to read, which is advanced past the sections read
+     */
+    void read_flat_blob_sections(const vtr::FlatBlobReader& reader, size_t& isection);
+
   protected: //Protected Base Types
     struct string_id_tag;
 
     ///@brief A unique identifier for a string in the netlist
     typedef vtr::StrongId<string_id_tag> StringId;
 
+    ///@brief The (name, value) pairs of a block's attributes or parameters
+    typedef std::vector<std::pair<StringId, StringId>> StringPairs;
+
+  public: //Public Iterator Types
+    /**
+     * @brief Iterator over the (name, value) pairs of a block's attributes or parameters
+     *
+     * Dereferences to a pair of references to the name and value strings held by the netlist.
+     */
+    class string_pair_iterator {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::pair<const std::string&, const std::string&> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef value_type reference;
+
+        string_pair_iterator(typename StringPairs::const_iterator pair, const vtr::vector_map<StringId, std::string>* strings)
+            : pair_(pair)
+            , strings_(strings) {}
+
+        reference operator*() const { return reference((*strings_)[pair_->first], (*strings_)[pair_->second]); }
+
+        string_pair_iterator& operator++() {
+            ++pair_;
+            return *this;
+        }
+
+        string_pair_iterator operator++(int) {
+            string_pair_iterator prev = *this;
+            ++pair_;
+            return prev;
+        }
+
+        bool operator==(const string_pair_iterator& other) const { return pair_ == other.pair_; }
+        bool operator!=(const string_pair_iterator& other) const { return pair_ != other.pair_; }
+
+      private:
+        typename StringPairs::const_iterator pair_;
+        const vtr::vector_map<StringId, std::string>* strings_;
+    };
+
   protected: //Protected Base Members
     /*
      * Lookups
@@ -987,6 +1059,15 @@ class Netlist {
      */
     StringId create_string(const std::string& str);
 
+    /**
+     * @brief Sets the value of name in the (name, value) pairs, adding it if it is not already present
+     *
+     *   @param pairs   The attributes or parameters of a block
+     *   @param name    The name to set
+     *   @param value   The value to set it to
+     */
+    void set_string_pair(StringPairs& pairs, const std::string& name, const std::string& value);
+
     /**
      * @brief Updates net cross-references for the specified pin
      *
@@ -1081,6 +1162,8 @@ class Netlist {
     //are called from this class in their respective non-impl() functions.
     virtual void shrink_to_fit_impl() {}
 
+    virtual size_t memory_usage_impl() const { return 0; }
+
     virtual bool validate_block_sizes_impl(size_t /*num_blocks*/) const { return true; }
     virtual bool validate_port_sizes_impl(size_t /*num_ports*/) const { return true; }
     virtual bool validate_pin_sizes_impl(size_t /*num_pins*/) const { return true; }
@@ -1124,8 +1207,8 @@ class Netlist {
     vtr::vector_map<BlockId, unsigned> block_num_output_pins_; ///<Number of output pins on each block
     vtr::vector_map<BlockId, unsigned> block_num_clock_pins_;  ///<Number of clock pins on each block
 
-    vtr::vector_map<BlockId, std::unordered_map<std::string, std::string>> block_params_; ///<Parameters of each block
-    vtr::vector_map<BlockId, std::unordered_map<std::string, std::string>> block_attrs_;  ///<Attributes of each block
+    vtr::vector_map<BlockId, StringPairs> block_params_; ///<Parameters of each block
+    vtr::vector_map<BlockId, StringPairs> block_attrs_;  ///<Attributes of each block
 
     //Port data
     vtr::vector_map<PortId, PortId> port_ids_;              ///<Valid port ids
@@ -3,6 +3,7 @@
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_memory_usage.h"
 #include "vpr_error.h"
 /*
  *
@@ -91,6 +92,38 @@ void Netlist<BlockId, PortId, PinId, NetId>::print_stats() const {
     VTR_LOG("Strings %zu capacity/size: %.2f\n", string_ids_.size(), float(string_ids_.capacity()) / string_ids_.size());
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+size_t Netlist<BlockId, PortId, PinId, NetId>::memory_usage() const {
+    size_t bytes = 0;
+
+    //Block data
+    bytes += vtr::memory_usage(block_ids_) + vtr::memory_usage(block_names_);
+    bytes += vtr::memory_usage(block_ports_);
+    bytes += vtr::memory_usage(block_num_input_ports_) + vtr::memory_usage(block_num_output_ports_) + vtr::memory_usage(block_num_clock_ports_);
+    bytes += vtr::memory_usage(block_pins_);
+    bytes += vtr::memory_usage(block_num_input_pins_) + vtr::memory_usage(block_num_output_pins_) + vtr::memory_usage(block_num_clock_pins_);
+    bytes += vtr::memory_usage(block_params_) + vtr::memory_usage(block_attrs_);
+
+    //Port data
+    bytes += vtr::memory_usage(port_ids_) + vtr::memory_usage(port_names_) + vtr::memory_usage(port_blocks_);
+    bytes += vtr::memory_usage(port_pins_) + vtr::memory_usage(port_widths_) + vtr::memory_usage(port_types_);
+
+    //Pin data
+    bytes += vtr::memory_usage(pin_ids_) + vtr::memory_usage(pin_ports_) + vtr::memory_usage(pin_port_bits_);
+    bytes += vtr::memory_usage(pin_nets_) + vtr::memory_usage(pin_net_indices_) + vtr::memory_usage(pin_is_constant_);
+
+    //Net data
+    bytes += vtr::memory_usage(net_ids_) + vtr::memory_usage(net_names_) + vtr::memory_usage(net_pins_);
+    bytes += vtr::memory_usage(net_is_ignored_) + vtr::memory_usage(net_is_global_);
+
+    //String data and fast lookups
+    bytes += vtr::memory_usage(string_ids_) + vtr::memory_usage(strings_);
+    bytes += vtr::memory_usage(block_name_to_block_id_) + vtr::memory_usage(net_name_to_net_id_);
+    bytes += vtr::memory_usage(string_to_string_id_);
+
+    return bytes + memory_usage_impl();
+}
+
 /*
  *
  * Blocks
@@ -113,14 +146,16 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::attr_range Netlist<BlockId, PortId, PinId, NetId>::block_attrs(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    return vtr::make_range(block_attrs_[blk_id].begin(), block_attrs_[blk_id].end());
+    const StringPairs& attrs = block_attrs_[blk_id];
+    return vtr::make_range(attr_iterator(attrs.begin(), &strings_), attr_iterator(attrs.end(), &strings_));
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::param_range Netlist<BlockId, PortId, PinId, NetId>::block_params(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    return vtr::make_range(block_params_[blk_id].begin(), block_params_[blk_id].end());
+    const StringPairs& params = block_params_[blk_id];
+    return vtr::make_range(param_iterator(params.begin(), &strings_), param_iterator(params.end(), &strings_));
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -904,14 +939,14 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::set_block_attr(const BlockId blk_id, const std::string& name, const std::string& value) {
     VTR_ASSERT(valid_block_id(blk_id));
 
-    block_attrs_[blk_id][name] = value;
+    set_string_pair(block_attrs_[blk_id], name, value);
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::set_block_param(const BlockId blk_id, const std::string& name, const std::string& value) {
     VTR_ASSERT(valid_block_id(blk_id));
 
-    block_params_[blk_id][name] = value;
+    set_string_pair(block_params_[blk_id], name, value);
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -1284,26 +1319,36 @@ void Netlist<BlockId, PortId, PinId, NetId>::rebuild_lookups() {
     //We iterate through the reverse-lookups and update the values (i.e. ids)
     //to the new id values
 
+    //Names are unique, so each look-up entry is written at most once
+
     //Blocks
     block_name_to_block_id_.clear();
-    for (auto blk_id : blocks()) {
-        const auto& key = block_names_[blk_id];
-        block_name_to_block_id_.insert(key, blk_id);
-    }
+    block_name_to_block_id_.resize(strings_.size(), BlockId::INVALID());
+    netlist_parallel_for(block_ids_.size(), [&](size_t iblk) {
+        BlockId blk_id = block_ids_[BlockId(iblk)];
+        if (blk_id) {
+            block_name_to_block_id_[block_names_[blk_id]] = blk_id;
+        }
+    });
 
     //Nets
     net_name_to_net_id_.clear();
-    for (auto net_id : nets()) {
-        const auto& key = net_names_[net_id];
-        net_name_to_net_id_.insert(key, net_id);
-    }
+    net_name_to_net_id_.resize(strings_.size(), NetId::INVALID());
+    netlist_parallel_for(net_ids_.size(), [&](size_t inet) {
+        NetId net_id = net_ids_[NetId(inet)];
+        if (net_id) {
+            net_name_to_net_id_[net_names_[net_id]] = net_id;
+        }
+    });
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::rebuild_block_refs(const vtr::vector_map<PinId, PinId>& pin_id_map,
                                                                 const vtr::vector_map<PortId, PortId>& port_id_map) {
-    //Update the pin id references held by blocks
-    for (auto blk_id : blocks()) {
+    //Update the pin id references held by blocks (each block's references are independent)
+    netlist_parallel_for(block_ids_.size(), [&](size_t iblk) {
+        BlockId blk_id = block_ids_[BlockId(iblk)];
+
         //Before update the references, we need to know how many are valid,
         //so we can also update the numbers of input/output/clock pins
 
@@ -1338,7 +1383,7 @@ void Netlist<BlockId, PortId, PinId, NetId>::rebuild_block_refs(const vtr::vecto
 
         VTR_ASSERT_SAFE_MSG(all_valid(blk_ports), "All Ids should be valid");
         VTR_ASSERT(blk_ports.size() == size_t(block_num_input_ports_[blk_id] + block_num_output_ports_[blk_id] + block_num_clock_ports_[blk_id]));
-    }
+    });
 
     rebuild_block_refs_impl(pin_id_map, port_id_map);
 
@@ -1354,10 +1399,11 @@ void Netlist<BlockId, PortId, PinId, NetId>::rebuild_port_refs(const vtr::vector
 
     VTR_ASSERT(port_blocks_.size() == port_ids_.size());
 
-    for (auto& pin_collection : port_pins_) {
+    netlist_parallel_for(port_pins_.size(), [&](size_t iport) {
+        std::vector<PinId>& pin_collection = port_pins_[PortId(iport)];
         pin_collection = update_valid_refs(pin_collection, pin_id_map);
         VTR_ASSERT_SAFE_MSG(all_valid(pin_collection), "All Ids should be valid");
-    }
+    });
 
     rebuild_port_refs_impl(block_id_map, pin_id_map);
 
@@ -1382,13 +1428,19 @@ void Netlist<BlockId, PortId, PinId, NetId>::rebuild_pin_refs(const vtr::vector_
     //were removed)
     //
     //Note that for this to work correctly, the net references must have already been re-built!
-    for (auto net : nets()) {
+    //
+    //Each pin is on a single net, so the nets can be processed in parallel
+    netlist_parallel_for(net_ids_.size(), [&](size_t inet) {
+        NetId net = net_ids_[NetId(inet)];
         int i = 0;
         for (auto pin : net_pins(net)) {
-            pin_net_indices_[pin] = i;
+            //Undriven nets hold an INVALID driver pin, which keeps its slot
+            if (pin) {
+                pin_net_indices_[pin] = i;
+            }
             ++i;
         }
-    }
+    });
 
     rebuild_pin_refs_impl(port_id_map, net_id_map);
 
@@ -1398,13 +1450,16 @@ void Netlist<BlockId, PortId, PinId, NetId>::rebuild_pin_refs(const vtr::vector_
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::rebuild_net_refs(const vtr::vector_map<PinId, PinId>& pin_id_map) {
     //Update pin references held by nets
-    for (auto& pin_collection : net_pins_) {
+    const std::set<size_t> preserved_indices = {NET_DRIVER_INDEX};
+    netlist_parallel_for(net_pins_.size(), [&](size_t inet) {
+        std::vector<PinId>& pin_collection = net_pins_[NetId(inet)];
+
         //We take special care to preserve the driver index, since an INVALID id is used
         //to indicate an undriven net it should not be dropped during the update
-        pin_collection = update_valid_refs(pin_collection, pin_id_map, {NET_DRIVER_INDEX});
+        pin_collection = update_valid_refs(pin_collection, pin_id_map, preserved_indices);
 
         VTR_ASSERT_SAFE_MSG(all_valid(pin_collection), "All sinks should be valid");
-    }
+    });
 
     rebuild_net_refs_impl(pin_id_map);
 
@@ -2011,6 +2066,119 @@ void Netlist<BlockId, PortId, PinId, NetId>::associate_port_with_block(const Por
     }
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::write_flat_blob_sections(vtr::FlatBlobWriter& writer) const {
+    VTR_ASSERT_MSG(is_compressed(), "Only compressed netlists can be written to a flat blob");
+
+    add_flat_blob_string_sections(writer, std::vector<std::string>{netlist_name_, netlist_id_});
+
+    //Block data
+    add_flat_blob_section(writer, block_names_);
+    add_flat_blob_ragged_sections(writer, block_ports_);
+    add_flat_blob_section(writer, block_num_input_ports_);
+    add_flat_blob_section(writer, block_num_output_ports_);
+    add_flat_blob_section(writer, block_num_clock_ports_);
+    add_flat_blob_ragged_sections(writer, block_pins_);
+    add_flat_blob_section(writer, block_num_input_pins_);
+    add_flat_blob_section(writer, block_num_output_pins_);
+    add_flat_blob_section(writer, block_num_clock_pins_);
+    add_flat_blob_string_pair_sections(writer, block_params_);
+    add_flat_blob_string_pair_sections(writer, block_attrs_);
+
+    //Port data
+    add_flat_blob_section(writer, port_names_);
+    add_flat_blob_section(writer, port_blocks_);
+    add_flat_blob_ragged_sections(writer, port_pins_);
+    add_flat_blob_section(writer, port_widths_);
+    add_flat_blob_section(writer, port_types_);
+
+    //Pin data
+    add_flat_blob_section(writer, pin_ports_);
+    add_flat_blob_section(writer, pin_port_bits_);
+    add_flat_blob_section(writer, pin_nets_);
+    add_flat_blob_section(writer, pin_net_indices_);
+    add_flat_blob_section(writer, pin_is_constant_);
+
+    //Net data
+    add_flat_blob_section(writer, net_names_);
+    add_flat_blob_ragged_sections(writer, net_pins_);
+
+    //String data
+    add_flat_blob_string_sections(writer, strings_);
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::read_flat_blob_sections(const vtr::FlatBlobReader& reader, size_t& isection) {
+    std::vector<std::string> name_and_id = read_flat_blob_string_sections(reader, isection);
+    if (name_and_id.size() != 2) {
+        throw vtr::VtrError("Invalid netlist name and id in flat blob", __FILE__, __LINE__);
+    }
+    netlist_name_ = name_and_id[0];
+    netlist_id_ = name_and_id[1];
+    dirty_ = false;
+
+    //Block data
+    read_flat_blob_section(reader, isection, block_names_);
+    read_flat_blob_ragged_sections(reader, isection, block_ports_);
+    read_flat_blob_section(reader, isection, block_num_input_ports_);
+    read_flat_blob_section(reader, isection, block_num_output_ports_);
+    read_flat_blob_section(reader, isection, block_num_clock_ports_);
+    read_flat_blob_ragged_sections(reader, isection, block_pins_);
+    read_flat_blob_section(reader, isection, block_num_input_pins_);
+    read_flat_blob_section(reader, isection, block_num_output_pins_);
+    read_flat_blob_section(reader, isection, block_num_clock_pins_);
+    read_flat_blob_string_pair_sections(reader, isection, block_params_);
+    read_flat_blob_string_pair_sections(reader, isection, block_attrs_);
+    block_ids_ = contiguous_ids<BlockId>(block_names_.size());
+
+    //Port data
+    read_flat_blob_section(reader, isection, port_names_);
+    read_flat_blob_section(reader, isection, port_blocks_);
+    read_flat_blob_ragged_sections(reader, isection, port_pins_);
+    read_flat_blob_section(reader, isection, port_widths_);
+    read_flat_blob_section(reader, isection, port_types_);
+    port_ids_ = contiguous_ids<PortId>(port_names_.size());
+
+    //Pin data
+    read_flat_blob_section(reader, isection, pin_ports_);
+    read_flat_blob_section(reader, isection, pin_port_bits_);
+    read_flat_blob_section(reader, isection, pin_nets_);
+    read_flat_blob_section(reader, isection, pin_net_indices_);
+    read_flat_blob_section(reader, isection, pin_is_constant_);
+    pin_ids_ = contiguous_ids<PinId>(pin_ports_.size());
+
+    //Net data
+    read_flat_blob_section(reader, isection, net_names_);
+    read_flat_blob_ragged_sections(reader, isection, net_pins_);
+    net_ids_ = contiguous_ids<NetId>(net_names_.size());
+    net_is_ignored_.clear();
+    net_is_ignored_.resize(net_ids_.size(), false);
+    net_is_global_.clear();
+    net_is_global_.resize(net_ids_.size(), false);
+
+    //String data
+    std::vector<std::string> strings = read_flat_blob_string_sections(reader, isection);
+    strings_ = vtr::vector_map<StringId, std::string>(std::make_move_iterator(strings.begin()), std::make_move_iterator(strings.end()));
+    string_ids_ = contiguous_ids<StringId>(strings_.size());
+    for (const auto* block_pairs : {&block_params_, &block_attrs_}) {
+        for (const StringPairs& pairs : *block_pairs) {
+            for (const auto& pair : pairs) {
+                if (!valid_string_id(pair.first) || !valid_string_id(pair.second)) {
+                    throw vtr::VtrError("Invalid block attribute or parameter string in flat blob", __FILE__, __LINE__);
+                }
+            }
+        }
+    }
+
+    //Lookups
+    string_to_string_id_.clear();
+    string_to_string_id_.reserve(strings_.size());
+    for (StringId str_id : string_ids_) {
+        string_to_string_id_[strings_[str_id]] = str_id;
+    }
+    rebuild_lookups();
+}
+
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortId, PinId, NetId>::create_string(const std::string& str) {
     StringId str_id = find_string(str);
@@ -2040,6 +2208,21 @@ typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortI
     return str_id;
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::set_string_pair(StringPairs& pairs, const std::string& name, const std::string& value) {
+    StringId name_id = create_string(name);
+    StringId value_id = create_string(value);
+
+    //Blocks have few attributes/parameters, so a linear search is cheapest
+    for (auto& pair : pairs) {
+        if (pair.first == name_id) {
+            pair.second = value_id;
+            return;
+        }
+    }
+    pairs.emplace_back(name_id, value_id);
+}
+
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 NetId Netlist<BlockId, PortId, PinId, NetId>::find_net(const typename Netlist<BlockId, PortId, PinId, NetId>::StringId name_id) const {
     VTR_ASSERT_SAFE(valid_string_id(name_id));
@@ -0,0 +1,487 @@
+#include "netlist_snapshot.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+#include "vtr_assert.h"
+#include "vtr_digest.h"
+#include "vtr_flat_blob.h"
+#include "vtr_flat_map.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+#include "vtr_util.h"
+
+#include "vpr_error.h"
+#include "globals.h"
+#include "atom_netlist.h"
+#include "netlist_utils.h"
+#include "read_netlist.h"
+
+///@brief Bumped whenever the meaning of a section of a netlist snapshot changes
+constexpr int32_t NETLIST_SNAPSHOT_VERSION = 2;
+
+///@brief The sections of a netlist snapshot, in file order
+enum e_netlist_snapshot_section {
+    NETLIST_SNAPSHOT_HEADER = 0,        ///<int32_t: version
+    NETLIST_SNAPSHOT_KEY_OFFSETS,       ///<uint64_t: offset of each key string (see e_netlist_snapshot_key)
+    NETLIST_SNAPSHOT_KEY_CHARS,         ///<char: the key strings
+    NETLIST_SNAPSHOT_BLOCK_TYPES,       ///<int32_t: logical block type index of each clustered block
+    NETLIST_SNAPSHOT_BLOCK_PB_OFFSETS,  ///<uint64_t: offset of each clustered block's first t_pb in PBS
+    NETLIST_SNAPSHOT_PBS,               ///<t_pb_snapshot: the t_pbs of each clustered block, in pre-order
+    NETLIST_SNAPSHOT_PB_NAME_OFFSETS,   ///<uint64_t: offset of each t_pb's name (empty if it has none)
+    NETLIST_SNAPSHOT_PB_NAME_CHARS,     ///<char: the t_pb names
+    NETLIST_SNAPSHOT_BLOCK_ROUTE_OFFSETS, ///<uint64_t: offset of each clustered block's first pb_route entry in ROUTES
+    NETLIST_SNAPSHOT_ROUTES,            ///<t_pb_route_snapshot: the pb_route entries of each clustered block
+    NETLIST_SNAPSHOT_ROUTE_SINK_OFFSETS, ///<uint64_t: offset of each pb_route entry's first sink in ROUTE_SINKS
+    NETLIST_SNAPSHOT_ROUTE_SINKS,       ///<int32_t: the sink pb pins of each pb_route entry
+    NETLIST_SNAPSHOT_PIN_ROTATIONS,     ///<t_pin_rotation_snapshot: the pin rotations of the primitive t_pbs
+    NETLIST_SNAPSHOT_ATOM_NETLIST       ///<The first section of the atom netlist (see AtomNetlist::write_flat_blob_sections())
+};
+
+///@brief The strings identifying what a netlist snapshot was written from
+enum e_netlist_snapshot_key {
+    NETLIST_SNAPSHOT_ATOM_NETLIST_ID = 0,  ///<Atom netlist id (digest of the circuit file)
+    NETLIST_SNAPSHOT_NETLIST_OPTS,         ///<Netlist cleaning options (see netlist_opts_key())
+    NETLIST_SNAPSHOT_CLUSTERED_NETLIST_ID, ///<Clustered netlist id (digest of the packed netlist file)
+    NETLIST_SNAPSHOT_ARCHITECTURE_ID,      ///<Architecture id (digest of the architecture file)
+    NETLIST_SNAPSHOT_NUM_KEYS
+};
+
+///@brief A t_pb of a clustered block, as stored in a netlist snapshot
+struct t_pb_snapshot {
+    int32_t parent;     ///<Index of the parent t_pb among its block's t_pbs, or OPEN for the block's root t_pb
+    int32_t child_type; ///<Index of the t_pb's pb_type among the children of its parent's mode
+    int32_t pb_index;   ///<Index of the t_pb among its parent's children of that pb_type
+    int32_t mode;       ///<Mode of the t_pb
+    int32_t has_name;   ///<Whether the t_pb has a name (unused t_pbs have none)
+    int32_t loaded;     ///<Whether the t_pb's children were loaded (false for unused t_pbs without used outputs)
+};
+
+///@brief An entry of the pb_route of a clustered block, as stored in a netlist snapshot
+struct t_pb_route_snapshot {
+    int32_t pin;              ///<Pin (pin_count_in_cluster) of the entry
+    int32_t driver_pb_pin_id; ///<Pin driving the entry's pin, or OPEN
+    int32_t atom_net;         ///<Atom net using the entry's pin, or OPEN
+};
+
+///@brief A pin rotation of a primitive t_pb, as stored in a netlist snapshot
+struct t_pin_rotation_snapshot {
+    int32_t pb;                 ///<Index of the primitive t_pb among all t_pbs
+    int32_t pin;                ///<Rotated pin (pin_count_in_cluster)
+    int32_t atom_pin_bit_index; ///<Bit index of the atom pin mapped to the rotated pin
+};
+
+static std::string netlist_opts_key(const t_netlist_opts& opts);
+static std::vector<std::string> read_netlist_snapshot_keys(const vtr::FlatBlobReader& reader);
+template<typename F>
+static void for_each_pb_graph_node_pin(const t_pb_graph_node* pb_graph_node, F&& f);
+static void add_pb_snapshots(const t_pb* pb,
+                             t_pb_snapshot pb_snapshot,
+                             int32_t first_block_pb,
+                             std::vector<t_pb_snapshot>& pbs,
+                             std::vector<std::string>& pb_names,
+                             std::vector<t_pin_rotation_snapshot>& pin_rotations);
+static void add_pb_graph_pins(const t_pb_graph_node* pb_graph_node, std::vector<const t_pb_graph_pin*>& pins);
+static void load_clustered_netlist(const vtr::FlatBlobReader& reader, int verbosity, ClusteredNetlist& clb_nlist);
+
+std::string netlist_snapshot_file(const std::string& net_file) {
+    return net_file + ".snapshot";
+}
+
+void write_netlist_snapshot(const std::string& file, const t_vpr_setup& vpr_setup, const t_arch& arch) {
+    vtr::ScopedStartFinishTimer timer("Write netlist snapshot");
+
+    const AtomNetlist& atom_nlist = g_vpr_ctx.atom().nlist;
+    const ClusteredNetlist& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+    if (!atom_nlist.is_compressed()) {
+        VTR_LOG_WARN("Not writing netlist snapshot '%s', since the atom netlist is not compressed\n", file.c_str());
+        return;
+    }
+
+    std::vector<std::string> keys(NETLIST_SNAPSHOT_NUM_KEYS);
+    keys[NETLIST_SNAPSHOT_ATOM_NETLIST_ID] = atom_nlist.netlist_id();
+    keys[NETLIST_SNAPSHOT_NETLIST_OPTS] = netlist_opts_key(vpr_setup.NetlistOpts);
+    keys[NETLIST_SNAPSHOT_CLUSTERED_NETLIST_ID] = clb_nlist.netlist_id();
+    keys[NETLIST_SNAPSHOT_ARCHITECTURE_ID] = arch.architecture_id;
+
+    //The t_pb hierarchy and intra-block routing of each clustered block
+    std::vector<int32_t> block_types;
+    std::vector<uint64_t> block_pb_offsets = {0};
+    std::vector<t_pb_snapshot> pbs;
+    std::vector<std::string> pb_names;
+    std::vector<uint64_t> block_route_offsets = {0};
+    std::vector<t_pb_route_snapshot> routes;
+    std::vector<uint64_t> route_sink_offsets = {0};
+    std::vector<int32_t> route_sinks;
+    std::vector<t_pin_rotation_snapshot> pin_rotations;
+    for (ClusterBlockId blk_id : clb_nlist.blocks()) {
+        const t_pb* pb = clb_nlist.block_pb(blk_id);
+        block_types.push_back(clb_nlist.block_type(blk_id)->index);
+
+        add_pb_snapshots(pb, {OPEN, OPEN, OPEN, 0, 0, true}, pbs.size(), pbs, pb_names, pin_rotations);
+        block_pb_offsets.push_back(pbs.size());
+
+        for (const auto& kv : pb->pb_route) {
+            const t_pb_route& pb_route = kv.second;
+            routes.push_back({kv.first, pb_route.driver_pb_pin_id, pb_route.atom_net_id ? int32_t(size_t(pb_route.atom_net_id)) : OPEN});
+            route_sinks.insert(route_sinks.end(), pb_route.sink_pb_pin_ids.begin(), pb_route.sink_pb_pin_ids.end());
+            route_sink_offsets.push_back(route_sinks.size());
+        }
+        block_route_offsets.push_back(routes.size());
+    }
+
+    vtr::FlatBlobWriter writer;
+    writer.add_array(std::vector<int32_t>{NETLIST_SNAPSHOT_VERSION});
+    add_flat_blob_string_sections(writer, keys);
+    writer.add_array(block_types);
+    writer.add_array(block_pb_offsets);
+    writer.add_array(pbs);
+    add_flat_blob_string_sections(writer, pb_names);
+    writer.add_array(block_route_offsets);
+    writer.add_array(routes);
+    writer.add_array(route_sink_offsets);
+    writer.add_array(route_sinks);
+    writer.add_array(pin_rotations);
+    VTR_ASSERT(writer.num_sections() == NETLIST_SNAPSHOT_ATOM_NETLIST);
+    atom_nlist.write_flat_blob_sections(writer);
+
+    //Replacing any previous snapshot only once the new one is complete, so an interrupted
+    //run never leaves a partial snapshot behind
+    std::string tmp_file = file + ".tmp";
+    try {
+        writer.write(tmp_file);
+    } catch (const vtr::VtrError& e) {
+        VTR_LOG_WARN("Failed to write netlist snapshot: %s\n", e.what());
+        std::remove(tmp_file.c_str());
+        return;
+    }
+    if (std::rename(tmp_file.c_str(), file.c_str()) != 0) {
+        VTR_LOG_WARN("Failed to replace netlist snapshot '%s'\n", file.c_str());
+    }
+}
+
+bool read_atom_netlist_snapshot(const std::string& file, const t_vpr_setup& vpr_setup, AtomNetlist& netlist) {
+    if (!vtr::file_exists(file.c_str())) return false;
+
+    vtr::ScopedStartFinishTimer timer("Load atom netlist snapshot");
+
+    const std::string& circuit_file = vpr_setup.PackerOpts.circuit_file_name;
+    try {
+        vtr::FlatBlobReader reader(file);
+        std::vector<std::string> keys = read_netlist_snapshot_keys(reader);
+
+        if (keys[NETLIST_SNAPSHOT_NETLIST_OPTS] != netlist_opts_key(vpr_setup.NetlistOpts)) {
+            VTR_LOG("Ignoring netlist snapshot '%s', which was written with different netlist options\n", file.c_str());
+            return false;
+        }
+        if (vpr_setup.FileNameOpts.verify_file_digests) {
+            if (keys[NETLIST_SNAPSHOT_ATOM_NETLIST_ID] != vtr::secure_digest_file(circuit_file)) {
+                VTR_LOG("Ignoring netlist snapshot '%s', which was written from a different circuit file than '%s'\n",
+                        file.c_str(), circuit_file.c_str());
+                return false;
+            }
+        } else {
+            VTR_LOG_WARN("Loading netlist snapshot '%s' without checking it matches circuit file '%s' (--verify_file_digests is off)\n",
+                         file.c_str(), circuit_file.c_str());
+        }
+
+        size_t isection = NETLIST_SNAPSHOT_ATOM_NETLIST;
+        netlist.read_flat_blob_sections(reader, isection, vpr_setup.user_models, vpr_setup.library_models);
+        if (isection != reader.num_sections()) {
+            VPR_FATAL_ERROR(VPR_ERROR_ATOM_NETLIST, "Netlist snapshot '%s' is corrupted\n", file.c_str());
+        }
+        netlist.verify();
+    } catch (const vtr::VtrError& e) {
+        VTR_LOG_WARN("Ignoring netlist snapshot '%s' which could not be loaded: %s\n", file.c_str(), e.what());
+        return false;
+    }
+
+    VTR_LOG("Loaded atom netlist from snapshot '%s'\n", file.c_str());
+    return true;
+}
+
+bool read_clustered_netlist_snapshot(const std::string& file, const t_vpr_setup& vpr_setup, const t_arch& arch, ClusteredNetlist& clb_nlist) {
+    if (!vtr::file_exists(file.c_str())) return false;
+
+    vtr::ScopedStartFinishTimer timer("Load clustered netlist snapshot");
+
+    const std::string& net_file = vpr_setup.FileNameOpts.NetFile;
+    try {
+        vtr::FlatBlobReader reader(file);
+        std::vector<std::string> keys = read_netlist_snapshot_keys(reader);
+
+        if (keys[NETLIST_SNAPSHOT_NETLIST_OPTS] != netlist_opts_key(vpr_setup.NetlistOpts)
+            || keys[NETLIST_SNAPSHOT_ATOM_NETLIST_ID] != g_vpr_ctx.atom().nlist.netlist_id()) {
+            VTR_LOG("Ignoring netlist snapshot '%s', which was written for a different atom netlist\n", file.c_str());
+            return false;
+        }
+        if (keys[NETLIST_SNAPSHOT_ARCHITECTURE_ID] != arch.architecture_id) {
+            VTR_LOG("Ignoring netlist snapshot '%s', which was written for a different architecture\n", file.c_str());
+            return false;
+        }
+        if (vpr_setup.FileNameOpts.verify_file_digests) {
+            if (keys[NETLIST_SNAPSHOT_CLUSTERED_NETLIST_ID] != vtr::secure_digest_file(net_file)) {
+                VTR_LOG("Ignoring netlist snapshot '%s', which was written from a different packed netlist file than '%s'\n",
+                        file.c_str(), net_file.c_str());
+                return false;
+            }
+        } else {
+            VTR_LOG_WARN("Loading netlist snapshot '%s' without checking it matches packed netlist file '%s' (--verify_file_digests is off)\n",
+                         file.c_str(), net_file.c_str());
+        }
+
+        clb_nlist = ClusteredNetlist(net_file, keys[NETLIST_SNAPSHOT_CLUSTERED_NETLIST_ID]);
+        load_clustered_netlist(reader, vpr_setup.PackerOpts.pack_verbosity, clb_nlist);
+    } catch (const vtr::VtrError& e) {
+        VTR_LOG_WARN("Ignoring netlist snapshot '%s' which could not be loaded: %s\n", file.c_str(), e.what());
+        return false;
+    }
+
+    VTR_LOG("Loaded packed netlist from snapshot '%s'\n", file.c_str());
+    return true;
+}
+
+//Returns a string identifying the netlist cleaning options, which change the cleaned atom netlist
+static std::string netlist_opts_key(const t_netlist_opts& opts) {
+    return vtr::string_fmt("const_gen_inference=%d absorb_buffer_luts=%d sweep_dangling_primary_ios=%d sweep_dangling_blocks=%d sweep_dangling_nets=%d sweep_constant_primary_outputs=%d",
+                           int(opts.const_gen_inference), opts.absorb_buffer_luts, opts.sweep_dangling_primary_ios,
+                           opts.sweep_dangling_blocks, opts.sweep_dangling_nets, opts.sweep_constant_primary_outputs);
+}
+
+//Returns the keys of the netlist snapshot read by reader, throwing VtrError if it is not a netlist snapshot of the current version
+static std::vector<std::string> read_netlist_snapshot_keys(const vtr::FlatBlobReader& reader) {
+    if (reader.num_sections() < NETLIST_SNAPSHOT_ATOM_NETLIST) {
+        throw vtr::VtrError("Not a netlist snapshot", __FILE__, __LINE__);
+    }
+
+    vtr::array_view<const int32_t> header = reader.array<int32_t>(NETLIST_SNAPSHOT_HEADER);
+    if (header.size() != 1 || header[0] != NETLIST_SNAPSHOT_VERSION) {
+        throw vtr::VtrError("Unsupported netlist snapshot version", __FILE__, __LINE__);
+    }
+
+    size_t isection = NETLIST_SNAPSHOT_KEY_OFFSETS;
+    std::vector<std::string> keys = read_flat_blob_string_sections(reader, isection);
+    if (keys.size() != NETLIST_SNAPSHOT_NUM_KEYS) {
+        throw vtr::VtrError("Invalid netlist snapshot keys", __FILE__, __LINE__);
+    }
+    return keys;
+}
+
+//Calls f for each (input, output and clock) pin of pb_graph_node
+template<typename F>
+static void for_each_pb_graph_node_pin(const t_pb_graph_node* pb_graph_node, F&& f) {
+    for (int iport = 0; iport < pb_graph_node->num_input_ports; ++iport) {
+        for (int ipin = 0; ipin < pb_graph_node->num_input_pins[iport]; ++ipin) {
+            f(&pb_graph_node->input_pins[iport][ipin]);
+        }
+    }
+    for (int iport = 0; iport < pb_graph_node->num_output_ports; ++iport) {
+        for (int ipin = 0; ipin < pb_graph_node->num_output_pins[iport]; ++ipin) {
+            f(&pb_graph_node->output_pins[iport][ipin]);
+        }
+    }
+    for (int iport = 0; iport < pb_graph_node->num_clock_ports; ++iport) {
+        for (int ipin = 0; ipin < pb_graph_node->num_clock_pins[iport]; ++ipin) {
+            f(&pb_graph_node->clock_pins[iport][ipin]);
+        }
+    }
+}
+
+//Appends the snapshots of pb and (recursively) its children to pbs, in pre-order
+static void add_pb_snapshots(const t_pb* pb,
+                             t_pb_snapshot pb_snapshot,
+                             int32_t first_block_pb,
+                             std::vector<t_pb_snapshot>& pbs,
+                             std::vector<std::string>& pb_names,
+                             std::vector<t_pin_rotation_snapshot>& pin_rotations) {
+    int32_t ipb = pbs.size();
+    pb_snapshot.mode = pb->mode;
+    pb_snapshot.has_name = (pb->name != nullptr);
+    pbs.push_back(pb_snapshot);
+    pb_names.emplace_back(pb->name ? pb->name : "");
+
+    if (!pb_snapshot.loaded) return;
+
+    if (pb->is_primitive()) {
+        //Only rotated pins are recorded
+        for_each_pb_graph_node_pin(pb->pb_graph_node, [&](const t_pb_graph_pin* gpin) {
+            BitIndex atom_pin_bit_index = pb->atom_pin_bit_index(gpin);
+            if (atom_pin_bit_index != BitIndex(gpin->pin_number)) {
+                pin_rotations.push_back({ipb, gpin->pin_count_in_cluster, int32_t(atom_pin_bit_index)});
+            }
+        });
+        return;
+    }
+
+    const t_mode& mode = pb->pb_graph_node->pb_type->modes[pb->mode];
+    for (int ichild_type = 0; ichild_type < mode.num_pb_type_children; ++ichild_type) {
+        for (int ichild = 0; ichild < mode.pb_type_children[ichild_type].num_pb; ++ichild) {
+            const t_pb* child_pb = &pb->child_pbs[ichild_type][ichild];
+            if (child_pb->pb_graph_node == nullptr) continue; //Not in the packed netlist
+
+            bool child_loaded = (child_pb->parent_pb != nullptr);
+            add_pb_snapshots(child_pb, {ipb - first_block_pb, ichild_type, ichild, 0, 0, child_loaded}, first_block_pb, pbs, pb_names, pin_rotations);
+        }
+    }
+}
+
+//Records each pin of pb_graph_node and its descendants (in all modes) in pins, indexed by pin_count_in_cluster
+static void add_pb_graph_pins(const t_pb_graph_node* pb_graph_node, std::vector<const t_pb_graph_pin*>& pins) {
+    for_each_pb_graph_node_pin(pb_graph_node, [&](const t_pb_graph_pin* gpin) {
+        VTR_ASSERT(size_t(gpin->pin_count_in_cluster) < pins.size());
+        pins[gpin->pin_count_in_cluster] = gpin;
+    });
+
+    const t_pb_type* pb_type = pb_graph_node->pb_type;
+    for (int imode = 0; imode < pb_type->num_modes; ++imode) {
+        const t_mode& mode = pb_type->modes[imode];
+        for (int ichild_type = 0; ichild_type < mode.num_pb_type_children; ++ichild_type) {
+            for (int ichild = 0; ichild < mode.pb_type_children[ichild_type].num_pb; ++ichild) {
+                add_pb_graph_pins(&pb_graph_node->child_pb_graph_nodes[imode][ichild_type][ichild], pins);
+            }
+        }
+    }
+}
+
+//Rebuilds the (empty) clustered netlist clb_nlist from the snapshot sections of reader, as read_netlist() does from the packed netlist file
+static void load_clustered_netlist(const vtr::FlatBlobReader& reader, int verbosity, ClusteredNetlist& clb_nlist) {
+    const auto& device_ctx = g_vpr_ctx.device();
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+
+    vtr::array_view<const int32_t> block_types = reader.array<int32_t>(NETLIST_SNAPSHOT_BLOCK_TYPES);
+    vtr::array_view<const t_pb_snapshot> pbs = reader.array<t_pb_snapshot>(NETLIST_SNAPSHOT_PBS);
+    vtr::array_view<const uint64_t> block_pb_offsets = read_flat_blob_offsets(reader, NETLIST_SNAPSHOT_BLOCK_PB_OFFSETS, pbs.size());
+    size_t isection = NETLIST_SNAPSHOT_PB_NAME_OFFSETS;
+    std::vector<std::string> pb_names = read_flat_blob_string_sections(reader, isection);
+    vtr::array_view<const t_pb_route_snapshot> routes = reader.array<t_pb_route_snapshot>(NETLIST_SNAPSHOT_ROUTES);
+    vtr::array_view<const uint64_t> block_route_offsets = read_flat_blob_offsets(reader, NETLIST_SNAPSHOT_BLOCK_ROUTE_OFFSETS, routes.size());
+    vtr::array_view<const int32_t> route_sinks = reader.array<int32_t>(NETLIST_SNAPSHOT_ROUTE_SINKS);
+    vtr::array_view<const uint64_t> route_sink_offsets = read_flat_blob_offsets(reader, NETLIST_SNAPSHOT_ROUTE_SINK_OFFSETS, route_sinks.size());
+    vtr::array_view<const t_pin_rotation_snapshot> pin_rotations = reader.array<t_pin_rotation_snapshot>(NETLIST_SNAPSHOT_PIN_ROTATIONS);
+
+    auto check = [](bool valid) {
+        if (!valid) throw vtr::VtrError("Inconsistent clustered netlist in netlist snapshot", __FILE__, __LINE__);
+    };
+    check(block_pb_offsets.size() == block_types.size() + 1
+          && block_route_offsets.size() == block_types.size() + 1
+          && pb_names.size() == pbs.size()
+          && route_sink_offsets.size() == routes.size() + 1);
+
+    //Reset atom/pb mapping (it is reloaded from the snapshot)
+    for (AtomBlockId atom_blk_id : atom_ctx.nlist.blocks()) {
+        atom_ctx.lookup.set_atom_pb(atom_blk_id, nullptr);
+    }
+
+    //The pb graph pin of each pin_count_in_cluster, for each logical block type (built as needed)
+    std::vector<std::vector<const t_pb_graph_pin*>> type_pb_graph_pins(device_ctx.logical_block_types.size());
+
+    std::vector<t_pb*> pbs_by_index(pbs.size(), nullptr);
+    for (size_t iblk = 0; iblk < block_types.size(); ++iblk) {
+        check(block_types[iblk] >= 0 && size_t(block_types[iblk]) < device_ctx.logical_block_types.size());
+        const t_logical_block_type* type = &device_ctx.logical_block_types[block_types[iblk]];
+
+        //t_pb hierarchy
+        size_t first_pb = block_pb_offsets[iblk];
+        check(first_pb < block_pb_offsets[iblk + 1]);
+        ClusterBlockId blk_id;
+        for (size_t ipb = first_pb; ipb < block_pb_offsets[iblk + 1]; ++ipb) {
+            const t_pb_snapshot& pb_snapshot = pbs[ipb];
+
+            t_pb* pb = nullptr;
+            if (ipb == first_pb) {
+                check(pb_snapshot.parent == OPEN && pb_snapshot.has_name && pb_snapshot.loaded);
+                pb = new t_pb;
+                pb->pb_graph_node = type->pb_graph_head;
+            } else {
+                check(pb_snapshot.parent >= 0 && size_t(pb_snapshot.parent) < ipb - first_pb);
+                t_pb* parent_pb = pbs_by_index[first_pb + pb_snapshot.parent];
+                check(parent_pb->child_pbs != nullptr);
+
+                const t_mode& parent_mode = parent_pb->pb_graph_node->pb_type->modes[parent_pb->mode];
+                check(pb_snapshot.child_type >= 0 && pb_snapshot.child_type < parent_mode.num_pb_type_children
+                      && pb_snapshot.pb_index >= 0 && pb_snapshot.pb_index < parent_mode.pb_type_children[pb_snapshot.child_type].num_pb);
+
+                pb = &parent_pb->child_pbs[pb_snapshot.child_type][pb_snapshot.pb_index];
+                check(pb->pb_graph_node == nullptr);
+                pb->pb_graph_node = &parent_pb->pb_graph_node->child_pb_graph_nodes[parent_pb->mode][pb_snapshot.child_type][pb_snapshot.pb_index];
+                if (pb_snapshot.loaded) {
+                    pb->parent_pb = parent_pb;
+                }
+            }
+            pb->name = pb_snapshot.has_name ? vtr::strdup(pb_names[ipb].c_str()) : nullptr;
+            pb->mode = pb_snapshot.mode;
+            pbs_by_index[ipb] = pb;
+
+            if (ipb == first_pb) {
+                blk_id = clb_nlist.create_block(pb->name, pb, type);
+            }
+
+            if (!pb_snapshot.loaded) continue;
+
+            const t_pb_type* pb_type = pb->pb_graph_node->pb_type;
+            if (pb_type->num_modes == 0) {
+                //A primitive
+                check(pb->name != nullptr);
+                AtomBlockId atom_blk_id = atom_ctx.nlist.find_block(pb->name);
+                if (!atom_blk_id) {
+                    VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                                    "Netlist snapshot and .blif file do not match, encountered unknown primitive %s in snapshot.\n",
+                                    pb->name);
+                }
+                atom_ctx.lookup.set_atom_pb(atom_blk_id, pb);
+                atom_ctx.lookup.set_atom_clb(atom_blk_id, blk_id);
+            } else {
+                check(pb->mode >= 0 && pb->mode < pb_type->num_modes);
+                const t_mode& mode = pb_type->modes[pb->mode];
+                pb->child_pbs = new t_pb*[mode.num_pb_type_children];
+                for (int ichild_type = 0; ichild_type < mode.num_pb_type_children; ++ichild_type) {
+                    pb->child_pbs[ichild_type] = new t_pb[mode.pb_type_children[ichild_type].num_pb];
+                }
+            }
+        }
+
+        create_clustered_block_ports(clb_nlist, blk_id);
+
+        //Intra-block routing
+        std::vector<const t_pb_graph_pin*>& pb_graph_pins = type_pb_graph_pins[type->index];
+        if (pb_graph_pins.empty()) {
+            pb_graph_pins.resize(type->pb_graph_head->total_pb_pins, nullptr);
+            add_pb_graph_pins(type->pb_graph_head, pb_graph_pins);
+        }
+
+        std::vector<std::pair<int, t_pb_route>> block_routes;
+        for (size_t iroute = block_route_offsets[iblk]; iroute < block_route_offsets[iblk + 1]; ++iroute) {
+            const t_pb_route_snapshot& route = routes[iroute];
+            check(route.pin >= 0 && size_t(route.pin) < pb_graph_pins.size() && pb_graph_pins[route.pin] != nullptr
+                  && (route.atom_net == OPEN || (route.atom_net >= 0 && size_t(route.atom_net) < atom_ctx.nlist.nets().size())));
+
+            t_pb_route pb_route;
+            pb_route.atom_net_id = (route.atom_net == OPEN) ? AtomNetId::INVALID() : AtomNetId(route.atom_net);
+            pb_route.driver_pb_pin_id = route.driver_pb_pin_id;
+            pb_route.sink_pb_pin_ids.assign(route_sinks.begin() + route_sink_offsets[iroute], route_sinks.begin() + route_sink_offsets[iroute + 1]);
+            pb_route.pb_graph_pin = pb_graph_pins[route.pin];
+            block_routes.emplace_back(route.pin, std::move(pb_route));
+        }
+        pbs_by_index[first_pb]->pb_route = vtr::make_flat_map2(std::move(block_routes));
+    }
+
+    //Pin rotations
+    for (const t_pin_rotation_snapshot& pin_rotation : pin_rotations) {
+        check(pin_rotation.pb >= 0 && size_t(pin_rotation.pb) < pbs_by_index.size());
+        t_pb* pb = pbs_by_index[pin_rotation.pb];
+        check(pb->is_primitive());
+
+        const t_pb_graph_pin* rotated_gpin = nullptr;
+        for_each_pb_graph_node_pin(pb->pb_graph_node, [&](const t_pb_graph_pin* gpin) {
+            if (gpin->pin_count_in_cluster == pin_rotation.pin) {
+                rotated_gpin = gpin;
+            }
+        });
+        check(rotated_gpin != nullptr);
+        pb->set_atom_pin_bit_index(rotated_gpin, pin_rotation.atom_pin_bit_index);
+    }
+
+    load_clustered_netlist_nets(clb_nlist, verbosity);
+}
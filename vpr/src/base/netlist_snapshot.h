@@ -0,0 +1,59 @@
+#ifndef VPR_NETLIST_SNAPSHOT_H
+#define VPR_NETLIST_SNAPSHOT_H
+
+/**
+ * @file
+ * @brief Binary snapshots of the atom and clustered netlists
+ *
+ * Re-running a later stage of the flow (e.g. --place, --route or --analysis)
+ * would otherwise re-parse and clean the circuit (BLIF), and re-parse the
+ * packed netlist (.net XML) before doing any work, which dominates the run
+ * time of those stages on large designs.
+ *
+ * A netlist snapshot is a flat blob (see vtr_flat_blob.h) written after
+ * packing, which holds:
+ *   - the cleaned atom netlist (blocks, ports, pins, nets, strings, block
+ *     parameters/attributes and truth tables), with models stored by name, and
+ *   - the t_pb hierarchy and intra-block routing of each clustered block,
+ *     from which the clustered netlist is rebuilt without any XML.
+ *
+ * Both are memory-mapped and copied into the netlist data structures on load.
+ * Data which is cheap to re-derive (name look-ups, clustered nets, atom to
+ * cluster mappings) is rebuilt rather than stored.
+ *
+ * A snapshot is only used if it was written with the same version, netlist
+ * cleaning options, architecture and atom netlist. When --verify_file_digests
+ * is on, the digests of the circuit and packed netlist files must also match
+ * those the snapshot was written from, otherwise the snapshot is ignored (and
+ * the files parsed as usual).
+ */
+
+#include <string>
+
+#include "vpr_types.h"
+#include "atom_netlist_fwd.h"
+
+///@brief Returns the netlist snapshot file associated with the packed netlist file net_file
+std::string netlist_snapshot_file(const std::string& net_file);
+
+///@brief Writes a snapshot of the current atom and clustered netlists to file (warning on failure)
+void write_netlist_snapshot(const std::string& file, const t_vpr_setup& vpr_setup, const t_arch& arch);
+
+/**
+ * @brief Loads the cleaned atom netlist of vpr_setup's circuit from the snapshot file
+ *
+ * Returns false if the snapshot does not exist or can not be used, in which case netlist
+ * may have been partially loaded and should be read from the circuit file instead.
+ */
+bool read_atom_netlist_snapshot(const std::string& file, const t_vpr_setup& vpr_setup, AtomNetlist& netlist);
+
+/**
+ * @brief Loads the clustered netlist of vpr_setup's packed netlist file from the snapshot file,
+ *        and maps it to the current atom netlist (as read_netlist() does)
+ *
+ * Returns false if the snapshot does not exist or can not be used, in which case clb_nlist
+ * should be read from the packed netlist file instead.
+ */
+bool read_clustered_netlist_snapshot(const std::string& file, const t_vpr_setup& vpr_setup, const t_arch& arch, ClusteredNetlist& clb_nlist);
+
+#endif
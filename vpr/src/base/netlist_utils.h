@@ -2,7 +2,18 @@
 #define NETLIST_UTILS_H
 
 #include "vtr_vector_map.h"
+#include "vtr_flat_blob.h"
+#include <algorithm>
+#include <cstdint>
 #include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/blocked_range.h>
+#    include <tbb/parallel_for.h>
+#endif
 
 /*
  *
@@ -10,6 +21,44 @@
  *
  */
 
+///@brief Number of elements below which the netlist clean-up and rebuild passes are run serially
+constexpr size_t NETLIST_MIN_PARALLEL_ELEMENTS = 16 * 1024;
+
+/**
+ * @brief Calls func(i) for each i in [0, num_elements)
+ *
+ * When built with TBB, and there are enough elements for it to be worthwhile,
+ * the calls are made in parallel (so they must be independent of each other).
+ */
+template<typename Func>
+void netlist_parallel_for(size_t num_elements, const Func& func) {
+#ifdef VPR_USE_TBB
+    if (num_elements >= NETLIST_MIN_PARALLEL_ELEMENTS) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_elements, 1024), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                func(i);
+            }
+        });
+        return;
+    }
+#endif
+    for (size_t i = 0; i < num_elements; ++i) {
+        func(i);
+    }
+}
+
+///@brief Returns the number of elements needed to hold every valid new id of 'id_map'
+template<typename Id>
+size_t num_mapped_ids(const vtr::vector_map<Id, Id>& id_map) {
+    size_t num_ids = 0;
+    for (Id new_id : id_map) {
+        if (new_id) {
+            num_ids = std::max(num_ids, size_t(new_id) + 1);
+        }
+    }
+    return num_ids;
+}
+
 /**
  * @brief Returns true if all elements are contiguously ascending values
  *        (i.e. equal to their index)
@@ -68,17 +117,27 @@ vtr::vector_map<Id, T> clean_and_reorder_values(const vtr::vector_map<Id, T>& va
     VTR_ASSERT(values.size() == id_map.size());
 
     //Allocate space for the values that will not be dropped
-    vtr::vector_map<Id, T> result;
+    vtr::vector_map<Id, T> result(num_mapped_ids(id_map));
 
     //Move over the valid entries to their new locations
-    for (size_t cur_idx = 0; cur_idx < values.size(); ++cur_idx) {
+    auto move_value = [&](size_t cur_idx) {
         Id old_id = Id(cur_idx);
 
         Id new_id = id_map[old_id];
         if (new_id) {
             //There is a valid mapping
-            result.insert(new_id, std::move(values[old_id]));
+            result[new_id] = std::move(values[old_id]);
+        }
+    };
+
+    if (std::is_same<T, bool>::value) {
+        //Elements of std::vector<bool> share storage, so can not be written concurrently
+        for (size_t cur_idx = 0; cur_idx < values.size(); ++cur_idx) {
+            move_value(cur_idx);
         }
+    } else {
+        //New ids are unique, so each entry of result is written at most once
+        netlist_parallel_for(values.size(), move_value);
     }
 
     return result;
@@ -94,17 +153,17 @@ vtr::vector_map<Id, Id> clean_and_reorder_ids(const vtr::vector_map<Id, Id>& id_
     //For IDs, the values are the new id's stored in the map
 
     //Allocate a new vector to store the values that have been not dropped
-    vtr::vector_map<Id, Id> result;
+    vtr::vector_map<Id, Id> result(num_mapped_ids(id_map));
 
     //Move over the valid entries to their new locations
-    for (size_t cur_idx = 0; cur_idx < id_map.size(); ++cur_idx) {
+    netlist_parallel_for(id_map.size(), [&](size_t cur_idx) {
         Id old_id = Id(cur_idx);
 
         Id new_id = id_map[old_id];
         if (new_id) {
-            result.insert(new_id, new_id);
+            result[new_id] = new_id;
         }
-    }
+    });
 
     return result;
 }
@@ -132,14 +191,13 @@ size_t count_valid_refs(R range, const vtr::vector_map<Id, Id>& id_map) {
  */
 template<typename Container, typename ValId>
 Container update_all_refs(const Container& values, const vtr::vector_map<ValId, ValId>& id_map) {
-    Container updated;
+    Container updated(values.size());
 
-    for (ValId orig_val : values) {
-        //The original item was valid
-        ValId new_val = id_map[orig_val];
-        //The original item exists in the new mapping
-        updated.emplace_back(new_val);
-    }
+    auto orig_vals = values.begin();
+    auto new_vals = updated.begin();
+    netlist_parallel_for(values.size(), [&](size_t i) {
+        new_vals[i] = id_map[orig_vals[i]];
+    });
 
     return updated;
 }
@@ -177,4 +235,164 @@ Container update_valid_refs(const Container& values,
     return updated;
 }
 
+/*
+ *
+ * Templated utility functions for writing and reading IdMaps as the
+ * sections of a flat blob (e.g. netlist snapshots)
+ *
+ * The read functions read from section isection onwards, and advance
+ * isection past the sections they read.
+ *
+ */
+
+///@brief Returns the contiguous ids [0..num_ids), as held by a compressed netlist
+template<typename Id>
+vtr::vector_map<Id, Id> contiguous_ids(size_t num_ids) {
+    vtr::vector_map<Id, Id> ids;
+    for (size_t i = 0; i < num_ids; ++i) {
+        ids.push_back(Id(i));
+    }
+    return ids;
+}
+
+/**
+ * @brief Appends 'values' as the next section of 'writer'
+ *
+ * The values are referenced, not copied, so must not change until the blob is written.
+ */
+template<typename Id, typename T>
+void add_flat_blob_section(vtr::FlatBlobWriter& writer, const vtr::vector_map<Id, T>& values) {
+    writer.add_array(vtr::array_view<const T>(values.empty() ? nullptr : &*values.begin(), values.size()));
+}
+
+///@brief Appends 'values' as the next section of 'writer' (bools are stored as bytes)
+template<typename Id>
+void add_flat_blob_section(vtr::FlatBlobWriter& writer, const vtr::vector_map<Id, bool>& values) {
+    writer.add_array(std::vector<uint8_t>(values.begin(), values.end()));
+}
+
+template<typename Id, typename T>
+void read_flat_blob_section(const vtr::FlatBlobReader& reader, size_t& isection, vtr::vector_map<Id, T>& values) {
+    vtr::array_view<const T> view = reader.array<T>(isection++);
+    values = vtr::vector_map<Id, T>(view.begin(), view.end());
+}
+
+template<typename Id>
+void read_flat_blob_section(const vtr::FlatBlobReader& reader, size_t& isection, vtr::vector_map<Id, bool>& values) {
+    vtr::array_view<const uint8_t> view = reader.array<uint8_t>(isection++);
+    values = vtr::vector_map<Id, bool>(view.begin(), view.end());
+}
+
+///@brief Appends the ragged array 'values' as the next two sections of 'writer': the offset of each id's values, and all the values
+template<typename Id, typename T>
+void add_flat_blob_ragged_sections(vtr::FlatBlobWriter& writer, const vtr::vector_map<Id, std::vector<T>>& values) {
+    std::vector<uint64_t> offsets;
+    offsets.reserve(values.size() + 1);
+    std::vector<T> flat_values;
+
+    offsets.push_back(0);
+    for (const std::vector<T>& id_values : values) {
+        flat_values.insert(flat_values.end(), id_values.begin(), id_values.end());
+        offsets.push_back(flat_values.size());
+    }
+    writer.add_array(offsets);
+    writer.add_array(flat_values);
+}
+
+/**
+ * @brief Returns the offsets of a ragged array read from section isection,
+ *        throwing VtrError if they are not consistent with num_values
+ */
+inline vtr::array_view<const uint64_t> read_flat_blob_offsets(const vtr::FlatBlobReader& reader, size_t isection, size_t num_values) {
+    vtr::array_view<const uint64_t> offsets = reader.array<uint64_t>(isection);
+    if (offsets.size() == 0 || offsets[0] != 0 || offsets[offsets.size() - 1] != num_values
+        || !std::is_sorted(offsets.begin(), offsets.end())) {
+        throw vtr::VtrError("Inconsistent ragged array offsets in section " + std::to_string(isection), __FILE__, __LINE__);
+    }
+    return offsets;
+}
+
+template<typename Id, typename T>
+void read_flat_blob_ragged_sections(const vtr::FlatBlobReader& reader, size_t& isection, vtr::vector_map<Id, std::vector<T>>& values) {
+    vtr::array_view<const T> flat_values = reader.array<T>(isection + 1);
+    vtr::array_view<const uint64_t> offsets = read_flat_blob_offsets(reader, isection, flat_values.size());
+    isection += 2;
+
+    values.clear();
+    for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+        values.emplace_back(flat_values.begin() + offsets[i], flat_values.begin() + offsets[i + 1]);
+    }
+}
+
+///@brief Appends 'strings' as the next two sections of 'writer': the offset of each string, and all their characters
+template<typename Range>
+void add_flat_blob_string_sections(vtr::FlatBlobWriter& writer, const Range& strings) {
+    std::vector<uint64_t> offsets;
+    std::vector<char> chars;
+
+    offsets.push_back(0);
+    for (const std::string& str : strings) {
+        chars.insert(chars.end(), str.begin(), str.end());
+        offsets.push_back(chars.size());
+    }
+    writer.add_array(offsets);
+    writer.add_array(chars);
+}
+
+inline std::vector<std::string> read_flat_blob_string_sections(const vtr::FlatBlobReader& reader, size_t& isection) {
+    vtr::array_view<const char> chars = reader.array<char>(isection + 1);
+    vtr::array_view<const uint64_t> offsets = read_flat_blob_offsets(reader, isection, chars.size());
+    isection += 2;
+
+    std::vector<std::string> strings;
+    strings.reserve(offsets.size() - 1);
+    for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+        strings.emplace_back(chars.begin() + offsets[i], chars.begin() + offsets[i + 1]);
+    }
+    return strings;
+}
+
+/**
+ * @brief Appends the (name, value) string id pairs of each id (e.g. block parameters) as the next two
+ *        sections of 'writer': the offset of each id's pairs, and the name and value ids of all the pairs
+ */
+template<typename Id, typename StringId>
+void add_flat_blob_string_pair_sections(vtr::FlatBlobWriter& writer, const vtr::vector_map<Id, std::vector<std::pair<StringId, StringId>>>& values) {
+    std::vector<uint64_t> offsets;
+    offsets.reserve(values.size() + 1);
+    std::vector<StringId> string_ids;
+
+    offsets.push_back(0);
+    for (const auto& id_values : values) {
+        for (const auto& pair : id_values) {
+            string_ids.push_back(pair.first);
+            string_ids.push_back(pair.second);
+        }
+        offsets.push_back(string_ids.size() / 2);
+    }
+    writer.add_array(offsets);
+    writer.add_array(string_ids);
+}
+
+///@brief Reads the string id pairs written by add_flat_blob_string_pair_sections() (the string ids are not checked)
+template<typename Id, typename StringId>
+void read_flat_blob_string_pair_sections(const vtr::FlatBlobReader& reader, size_t& isection, vtr::vector_map<Id, std::vector<std::pair<StringId, StringId>>>& values) {
+    vtr::array_view<const StringId> string_ids = reader.array<StringId>(isection + 1);
+    if (string_ids.size() % 2 != 0) {
+        throw vtr::VtrError("Unpaired string ids in section " + std::to_string(isection + 1), __FILE__, __LINE__);
+    }
+    vtr::array_view<const uint64_t> offsets = read_flat_blob_offsets(reader, isection, string_ids.size() / 2);
+    isection += 2;
+
+    values.clear();
+    values.resize(offsets.size() - 1);
+    for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+        auto& id_values = values[Id(i)];
+        id_values.reserve(offsets[i + 1] - offsets[i]);
+        for (size_t ipair = offsets[i]; ipair < offsets[i + 1]; ++ipair) {
+            id_values.emplace_back(string_ids[2 * ipair], string_ids[2 * ipair + 1]);
+        }
+    }
+}
+
 #endif
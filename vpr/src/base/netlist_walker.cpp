@@ -9,18 +9,24 @@ void NetlistWalker::walk() {
     visitor_.visit_top(atom_ctx.nlist.netlist_name().c_str());
 
     for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
-        const auto* pb = cluster_ctx.clb_nlist.block_pb(blk_id);
-
-        //Visit the top-level block
-        visitor_.visit_clb(blk_id, pb);
-
-        //Visit all the block's primitives
-        walk_blocks(pb->pb_route, pb);
+        walk_clb(blk_id);
     }
 
     visitor_.finish();
 }
 
+void NetlistWalker::walk_clb(ClusterBlockId blk_id) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    const auto* pb = cluster_ctx.clb_nlist.block_pb(blk_id);
+
+    //Visit the top-level block
+    visitor_.visit_clb(blk_id, pb);
+
+    //Visit all the block's primitives
+    walk_blocks(pb->pb_route, pb);
+}
+
 /**
  * @brief Recursively travers this pb calling visitor_.visit_atom() or
  *        visitor_.visit_open() on any of its primitive pb's.
@@ -11,6 +11,9 @@ class NetlistWalker {
 
     void walk();
 
+    ///@brief Visits a single top-level block and all its primitives
+    void walk_clb(ClusterBlockId blk_id);
+
   private:
     void walk_blocks(const t_pb_routes& pb_route, const t_pb* pb);
 
@@ -12,6 +12,11 @@
 #include <cmath>
 #include <regex>
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#    include <tbb/task_arena.h>
+#endif
+
 #include "vtr_assert.h"
 #include "vtr_util.h"
 #include "vtr_log.h"
@@ -76,7 +81,16 @@
  *
  * VPR stores names internally generally following BLIF conventions.  As a result these names need
  * to be escaped when generating Verilog or SDF.  This is handled with escape_verilog_identifier()
- * and escape_sdf_identifier() functions.
+ * and escape_sdf_identifier() functions, which write the escaped identifier directly to the output
+ * stream (rather than building a new string for every name printed).
+ *
+ * Parallel Output
+ * ===============
+ * Printing the cell instances dominates the time to write large netlists.  When VPR is built with
+ * TBB, the instances of large netlists are printed in parallel into per-chunk buffers, which are then
+ * written out in instance order (see NetlistWriterVisitor::print_cell_instances()).  The only state
+ * shared between instances is the numbering of unconnected nets, which is deferred while printing
+ * (see UnconnNetCounter) so the output is identical to printing the instances serially.
  *
  * Primitives
  * ==========
@@ -107,18 +121,38 @@ typedef std::pair<double, std::string> sequential_port_delay_pair;
  * CLOCK
  * };*/
 
+class UnconnNetCounter;
+
+///@brief An identifier which is escaped for Verilog as it is written to a stream (see escape_verilog_identifier())
+struct EscapedVerilogIdentifier {
+    const std::string& id;
+
+    ///@brief Returns the escaped identifier, for when it needs to be stored
+    operator std::string() const;
+};
+
+///@brief An identifier which is escaped for SDF as it is written to a stream (see escape_sdf_identifier())
+struct EscapedSdfIdentifier {
+    const std::string& id;
+
+    ///@brief Returns the escaped identifier, for when it needs to be stored
+    operator std::string() const;
+};
+
 //
 // File local function declarations
 //
 std::string indent(size_t depth);
 double get_delay_ps(double delay_sec);
 
-void print_blif_port(std::ostream& os, size_t& unconn_count, const std::string& port_name, const std::vector<std::string>& nets, int depth);
-void print_verilog_port(std::ostream& os, size_t& unconn_count, const std::string& port_name, const std::vector<std::string>& nets, PortType type, int depth, struct t_analysis_opts& opts);
+void print_blif_port(std::ostream& os, UnconnNetCounter& unconn_count, const std::string& port_name, const std::vector<std::string>& nets, int depth);
+void print_verilog_port(std::ostream& os, UnconnNetCounter& unconn_count, const std::string& port_name, const std::vector<std::string>& nets, PortType type, int depth, struct t_analysis_opts& opts);
 
-std::string create_unconn_net(size_t& unconn_count);
-std::string escape_verilog_identifier(const std::string id);
-std::string escape_sdf_identifier(const std::string id);
+std::string create_unconn_net(UnconnNetCounter& unconn_count);
+EscapedVerilogIdentifier escape_verilog_identifier(const std::string& id);
+EscapedSdfIdentifier escape_sdf_identifier(const std::string& id);
+std::ostream& operator<<(std::ostream& os, const EscapedVerilogIdentifier& escaped);
+std::ostream& operator<<(std::ostream& os, const EscapedSdfIdentifier& escaped);
 bool is_special_sdf_char(char c);
 std::string join_identifier(std::string lhs, std::string rhs);
 
@@ -131,6 +165,58 @@ std::string join_identifier(std::string lhs, std::string rhs);
 // Unconnected net prefix
 const std::string unconn_prefix = "__vpr__unconn";
 
+// Marks where the name of an unconnected net is to be written, when names are deferred
+// (identifiers are null-terminated strings, so can never contain it)
+constexpr char unconn_placeholder = '\0';
+
+/**
+ * @brief Counts (and names) the unconnected nets created while printing instances
+ *
+ * Unconnected nets are numbered in the order they are created, so their names normally
+ * depend on all instances printed before.  When instances are printed in parallel their
+ * counters instead defer naming: each net is written as unconn_placeholder, which
+ * write_unconn_names() replaces with the net's name once the number of nets created by
+ * all previously printed instances is known.
+ */
+class UnconnNetCounter {
+  public:
+    explicit UnconnNetCounter(bool defer_names = false)
+        : defer_names_(defer_names) {}
+
+    ///@brief Returns the name of a new unique unconnected net (or the placeholder for it)
+    std::string create_net() {
+        if (defer_names_) {
+            ++count_;
+            return std::string(1, unconn_placeholder);
+        }
+        return unconn_prefix + std::to_string(count_++);
+    }
+
+    ///@brief Returns the number of unconnected nets created so far
+    size_t count() const { return count_; }
+
+    /**
+     * @brief Writes text (printed with names deferred) to os, naming the unconnected nets it
+     *        contains after those already counted, which are then included in the count
+     */
+    void write_unconn_names(std::ostream& os, const std::string& text, size_t num_nets) {
+        VTR_ASSERT(!defer_names_);
+        size_t pos = 0;
+        for (size_t inet = 0; inet < num_nets; ++inet) {
+            size_t placeholder = text.find(unconn_placeholder, pos);
+            VTR_ASSERT(placeholder != std::string::npos);
+            os.write(text.data() + pos, placeholder - pos);
+            os << unconn_prefix << count_++;
+            pos = placeholder + 1;
+        }
+        os.write(text.data() + pos, text.size() - pos);
+    }
+
+  private:
+    bool defer_names_;
+    size_t count_ = 0;
+};
+
 //A combinational timing arc
 class Arc {
   public:
@@ -184,17 +270,19 @@ class Instance {
      *              BLIF has limitations requiring unconnected nets to be used to
      *              represent unconnected ports. To allow unique naming of these nets
      *              unconn_count is used to uniquify these names. Whenever creating
-     *              an unconnected net (and using unconn_count to uniquify its name
-     *              in the file) unconn_count should be incremented.
+     *              an unconnected net its name should be created with
+     *              create_unconn_net(unconn_count).
+     *              Implementations must only modify the instance itself, as they may be
+     *              printed in parallel (see NetlistWriterVisitor::print_cell_instances()).
      *
      *   @param depth  Current indentation depth.  This is used to figure-out how much indentation
      *                 should be applied. This is purely for cosmetic formatting.  Use indent() for
      *                 generating consistent indentation.
      */
-    virtual void print_blif(std::ostream& os, size_t& unconn_count, int depth = 0) = 0;
+    virtual void print_blif(std::ostream& os, UnconnNetCounter& unconn_count, int depth = 0) = 0;
 
     ///@brief Print the current instanse in Verilog, see print_blif() for argument descriptions
-    virtual void print_verilog(std::ostream& os, size_t& unconn_count, int depth = 0) = 0;
+    virtual void print_verilog(std::ostream& os, UnconnNetCounter& unconn_count, int depth = 0) = 0;
 
     ///@brief Print the current instanse in SDF, see print_blif() for argument descriptions
     virtual void print_sdf(std::ostream& os, int depth = 0) = 0;
@@ -224,7 +312,7 @@ class LutInst : public Instance {
     std::string type() { return type_; }
 
   public: //Instance interface method implementations
-    void print_verilog(std::ostream& os, size_t& unconn_count, int depth) override {
+    void print_verilog(std::ostream& os, UnconnNetCounter& unconn_count, int depth) override {
         //Instantiate the lut
         os << indent(depth) << type_ << " #(\n";
 
@@ -249,7 +337,7 @@ class LutInst : public Instance {
         os << indent(depth) << ");\n\n";
     }
 
-    void print_blif(std::ostream& os, size_t& unconn_count, int depth) override {
+    void print_blif(std::ostream& os, UnconnNetCounter& unconn_count, int depth) override {
         os << indent(depth) << ".names ";
 
         //Input nets
@@ -447,7 +535,7 @@ class LatchInst : public Instance {
         , tsu_(tsu)
         , thld_(thld) {}
 
-    void print_blif(std::ostream& os, size_t& /*unconn_count*/, int depth = 0) override {
+    void print_blif(std::ostream& os, UnconnNetCounter& /*unconn_count*/, int depth = 0) override {
         os << indent(depth) << ".latch"
            << " ";
 
@@ -472,7 +560,7 @@ class LatchInst : public Instance {
         os << "\n";
     }
 
-    void print_verilog(std::ostream& os, size_t& /*unconn_count*/, int depth = 0) override {
+    void print_verilog(std::ostream& os, UnconnNetCounter& /*unconn_count*/, int depth = 0) override {
         //Currently assume a standard DFF
         VTR_ASSERT(type_ == Type::RISING_EDGE);
 
@@ -584,7 +672,7 @@ class BlackBoxInst : public Instance {
         , ports_tcq_(ports_tcq)
         , opts_(opts) {}
 
-    void print_blif(std::ostream& os, size_t& unconn_count, int depth = 0) override {
+    void print_blif(std::ostream& os, UnconnNetCounter& unconn_count, int depth = 0) override {
         os << indent(depth) << ".subckt " << type_name_ << " \\"
            << "\n";
 
@@ -625,7 +713,7 @@ class BlackBoxInst : public Instance {
         os << "\n";
     }
 
-    void print_verilog(std::ostream& os, size_t& unconn_count, int depth = 0) override {
+    void print_verilog(std::ostream& os, UnconnNetCounter& unconn_count, int depth = 0) override {
         //Instance type
         os << indent(depth) << type_name_ << " #(\n";
 
@@ -964,16 +1052,16 @@ class NetlistWriterVisitor : public NetlistVisitor {
         //All the cell instances (to an internal buffer for now)
         std::stringstream instances_ss;
 
-        size_t unconn_count = 0;
-        for (auto& inst : cell_instances_) {
-            inst->print_verilog(instances_ss, unconn_count, depth + 1);
-        }
+        UnconnNetCounter unconn_count;
+        print_cell_instances(instances_ss, unconn_count, [depth](Instance& inst, std::ostream& os, UnconnNetCounter& inst_unconn_count) {
+            inst.print_verilog(os, inst_unconn_count, depth + 1);
+        });
 
         //Unconnected wires declarations
-        if (unconn_count) {
+        if (unconn_count.count()) {
             verilog_os_ << "\n";
             verilog_os_ << indent(depth + 1) << "//Unconnected wires\n";
-            for (size_t i = 0; i < unconn_count; ++i) {
+            for (size_t i = 0; i < unconn_count.count(); ++i) {
                 auto name = unconn_prefix + std::to_string(i);
                 verilog_os_ << indent(depth + 1) << "wire " << escape_verilog_identifier(name) << ";\n";
             }
@@ -1033,10 +1121,10 @@ class NetlistWriterVisitor : public NetlistVisitor {
         //The cells
         blif_os_ << "\n";
         blif_os_ << indent(depth) << "#Cell instances\n";
-        size_t unconn_count = 0;
-        for (auto& inst : cell_instances_) {
-            inst->print_blif(blif_os_, unconn_count);
-        }
+        UnconnNetCounter unconn_count;
+        print_cell_instances(blif_os_, unconn_count, [](Instance& inst, std::ostream& os, UnconnNetCounter& inst_unconn_count) {
+            inst.print_blif(os, inst_unconn_count);
+        });
 
         blif_os_ << "\n";
         blif_os_ << indent(depth) << ".end\n";
@@ -1086,13 +1174,60 @@ class NetlistWriterVisitor : public NetlistVisitor {
         }
 
         //Cells
-        for (const auto& inst : cell_instances_) {
-            inst->print_sdf(sdf_os_, depth + 1);
-        }
+        UnconnNetCounter unconn_count;
+        print_cell_instances(sdf_os_, unconn_count, [depth](Instance& inst, std::ostream& os, UnconnNetCounter& /*inst_unconn_count*/) {
+            inst.print_sdf(os, depth + 1);
+        });
 
         sdf_os_ << indent(depth) << ")\n";
     }
 
+    /**
+     * @brief Prints every cell instance to os in order, with print_inst(inst, os, unconn_count)
+     *
+     * With TBB, the instances of large netlists are printed in parallel: each chunk of instances
+     * is printed to its own buffer (with unconnected net names deferred), and the buffers are
+     * written to os in order, naming their unconnected nets as they would have been serially.
+     * The chunks are printed in batches to bound the memory used by the buffers.
+     */
+    template<typename PrintInst>
+    void print_cell_instances(std::ostream& os, UnconnNetCounter& unconn_count, const PrintInst& print_inst) {
+#ifdef VPR_USE_TBB
+        constexpr size_t MIN_PARALLEL_INSTANCES = 4096;
+        constexpr size_t CHUNK_INSTANCES = 256;
+        size_t num_workers = tbb::this_task_arena::max_concurrency();
+        if (num_workers > 1 && cell_instances_.size() >= MIN_PARALLEL_INSTANCES) {
+            size_t num_chunks = (cell_instances_.size() + CHUNK_INSTANCES - 1) / CHUNK_INSTANCES;
+            size_t batch_chunks = 16 * num_workers;
+
+            std::vector<std::string> chunk_text(std::min(batch_chunks, num_chunks));
+            std::vector<size_t> chunk_unconn_nets(chunk_text.size());
+            for (size_t batch_begin = 0; batch_begin < num_chunks; batch_begin += batch_chunks) {
+                size_t batch_end = std::min(num_chunks, batch_begin + batch_chunks);
+
+                tbb::parallel_for(size_t(batch_begin), batch_end, [&](size_t ichunk) {
+                    std::ostringstream chunk_os;
+                    UnconnNetCounter chunk_unconn_count(/*defer_names=*/true);
+                    size_t inst_end = std::min(cell_instances_.size(), (ichunk + 1) * CHUNK_INSTANCES);
+                    for (size_t iinst = ichunk * CHUNK_INSTANCES; iinst < inst_end; ++iinst) {
+                        print_inst(*cell_instances_[iinst], chunk_os, chunk_unconn_count);
+                    }
+                    chunk_text[ichunk - batch_begin] = chunk_os.str();
+                    chunk_unconn_nets[ichunk - batch_begin] = chunk_unconn_count.count();
+                });
+
+                for (size_t ichunk = batch_begin; ichunk < batch_end; ++ichunk) {
+                    unconn_count.write_unconn_names(os, chunk_text[ichunk - batch_begin], chunk_unconn_nets[ichunk - batch_begin]);
+                }
+            }
+            return;
+        }
+#endif
+        for (auto& inst : cell_instances_) {
+            print_inst(*inst, os, unconn_count);
+        }
+    }
+
     /**
      * @brief Returns the name of a circuit-level Input/Output
      *
@@ -2354,12 +2489,7 @@ void merged_netlist_writer(const std::string basename, std::shared_ptr<const Ana
 
 ///@brief Returns a blank string for indenting the given depth
 std::string indent(size_t depth) {
-    std::string indent_ = "    ";
-    std::string new_indent;
-    for (size_t i = 0; i < depth; ++i) {
-        new_indent += indent_;
-    }
-    return new_indent;
+    return std::string(4 * depth, ' ');
 }
 
 ///@brief Returns the delay in pico-seconds from a floating point delay
@@ -2368,10 +2498,10 @@ double get_delay_ps(double delay_sec) {
 }
 
 ///@brief Returns the name of a unique unconnected net
-std::string create_unconn_net(size_t& unconn_count) {
+std::string create_unconn_net(UnconnNetCounter& unconn_count) {
     //We increment unconn_count by reference so each
     //call generates a unique name
-    return unconn_prefix + std::to_string(unconn_count++);
+    return unconn_count.create_net();
 }
 
 /**
@@ -2379,7 +2509,7 @@ std::string create_unconn_net(size_t& unconn_count) {
  *
  * Handles special cases like multi-bit and disconnected ports
  */
-void print_blif_port(std::ostream& os, size_t& unconn_count, const std::string& port_name, const std::vector<std::string>& nets, int depth) {
+void print_blif_port(std::ostream& os, UnconnNetCounter& unconn_count, const std::string& port_name, const std::vector<std::string>& nets, int depth) {
     if (nets.size() == 1) {
         //If only a single bit port, don't include port indexing
         os << indent(depth) << port_name << "=";
@@ -2413,7 +2543,7 @@ void print_blif_port(std::ostream& os, size_t& unconn_count, const std::string&
  *
  * Handles special cases like multi-bit and disconnected ports
  */
-void print_verilog_port(std::ostream& os, size_t& unconn_count, const std::string& port_name, const std::vector<std::string>& nets, PortType type, int depth, struct t_analysis_opts& opts) {
+void print_verilog_port(std::ostream& os, UnconnNetCounter& unconn_count, const std::string& port_name, const std::vector<std::string>& nets, PortType type, int depth, struct t_analysis_opts& opts) {
     auto unconn_inp_name = [&]() {
         switch (opts.post_synth_netlist_unconn_input_handling) {
             case e_post_synth_netlist_unconn_handling::GND:
@@ -2502,8 +2632,12 @@ void print_verilog_port(std::ostream& os, size_t& unconn_count, const std::strin
     os << ")";
 }
 
-///@brief Escapes the given identifier to be safe for verilog
-std::string escape_verilog_identifier(const std::string identifier) {
+///@brief Escapes the given identifier to be safe for verilog (when written to a stream)
+EscapedVerilogIdentifier escape_verilog_identifier(const std::string& identifier) {
+    return {identifier};
+}
+
+std::ostream& operator<<(std::ostream& os, const EscapedVerilogIdentifier& escaped) {
     //Verilog allows escaped identifiers
     //
     //The escaped identifiers start with a literal back-slash '\'
@@ -2512,10 +2646,18 @@ std::string escape_verilog_identifier(const std::string identifier) {
     //We pre-pend the escape back-slash and append a space to avoid
     //the identifier gobbling up adjacent characters like commas which
     //are not actually part of the identifier
-    std::string prefix = "\\";
-    std::string suffix = " ";
-    std::string escaped_name = prefix + identifier + suffix;
+    os.put('\\');
+    os.write(escaped.id.data(), escaped.id.size());
+    os.put(' ');
+    return os;
+}
 
+EscapedVerilogIdentifier::operator std::string() const {
+    std::string escaped_name;
+    escaped_name.reserve(id.size() + 2);
+    escaped_name += '\\';
+    escaped_name += id;
+    escaped_name += ' ';
     return escaped_name;
 }
 
@@ -2549,22 +2691,39 @@ bool is_special_sdf_char(char c) {
     return false;
 }
 
-///@brief Escapes the given identifier to be safe for sdf
-std::string escape_sdf_identifier(const std::string identifier) {
+///@brief Escapes the given identifier to be safe for sdf (when written to a stream)
+EscapedSdfIdentifier escape_sdf_identifier(const std::string& identifier) {
+    return {identifier};
+}
+
+std::ostream& operator<<(std::ostream& os, const EscapedSdfIdentifier& escaped) {
     //SDF allows escaped characters
     //
     //We look at each character in the string and escape it if it is
-    //a special character
-    std::string escaped_name;
+    //a special character, writing the runs of characters between them as-is
+    const std::string& id = escaped.id;
+    size_t run_begin = 0;
+    for (size_t i = 0; i < id.size(); ++i) {
+        if (is_special_sdf_char(id[i])) {
+            os.write(id.data() + run_begin, i - run_begin);
+            //Escape the special character
+            os.put('\\');
+            run_begin = i;
+        }
+    }
+    os.write(id.data() + run_begin, id.size() - run_begin);
+    return os;
+}
 
-    for (char c : identifier) {
+EscapedSdfIdentifier::operator std::string() const {
+    std::string escaped_name;
+    escaped_name.reserve(id.size());
+    for (char c : id) {
         if (is_special_sdf_char(c)) {
-            //Escape the special character
             escaped_name += '\\';
         }
         escaped_name += c;
     }
-
     return escaped_name;
 }
 
@@ -24,6 +24,27 @@ vtr::optional<RouteTree> TracebackCompat::traceback_to_route_tree(t_trace* head)
     return tree;
 }
 
+/** Build the route tree of net_id from a traceback, whose SINKs hold the net pin indices of net_id.
+ * Unlike the trees built without a net, it tracks its reached sinks, so it can be pruned and
+ * routed incrementally. The traceback must start at the net's SOURCE. */
+vtr::optional<RouteTree> TracebackCompat::traceback_to_route_tree(t_trace* head, ParentNetId net_id) {
+    if (head == nullptr)
+        return vtr::nullopt;
+
+    RouteTree tree(net_id);
+    VTR_ASSERT(tree._root->inode == RRNodeId(head->index));
+
+    if (head->next)
+        traceback_to_route_tree_x(head->next, tree, tree._root, RRSwitchId(head->iswitch));
+
+    for (size_t isink = 1; isink <= tree._num_sinks; isink++) {
+        tree._is_isink_reached[isink] = (tree._isink_to_rt_node[isink - 1] != nullptr);
+    }
+
+    tree.reload_timing();
+    return tree;
+}
+
 /* Add the path indicated by the trace to parent */
 void TracebackCompat::traceback_to_route_tree_x(t_trace* trace, RouteTree& tree, RouteTreeNode* parent, RRSwitchId parent_switch) {
     auto& device_ctx = g_vpr_ctx.device();
@@ -31,8 +52,8 @@ void TracebackCompat::traceback_to_route_tree_x(t_trace* trace, RouteTree& tree,
     RRNodeId inode = RRNodeId(trace->index);
 
     RouteTreeNode* new_node = new RouteTreeNode(inode, parent_switch, parent);
+    new_node->net_pin_index = trace->net_pin_index; //Before add_node, which indexes the SINKs of net-aware trees
     tree.add_node(parent, new_node);
-    new_node->net_pin_index = trace->net_pin_index;
     new_node->R_upstream = std::numeric_limits<float>::quiet_NaN();
     new_node->C_downstream = std::numeric_limits<float>::quiet_NaN();
     new_node->Tdel = std::numeric_limits<float>::quiet_NaN();
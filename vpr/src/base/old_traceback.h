@@ -38,6 +38,7 @@ class TracebackCompat {
   public:
     static t_trace* traceback_from_route_tree(const RouteTree& tree);
     static vtr::optional<RouteTree> traceback_to_route_tree(t_trace* head);
+    static vtr::optional<RouteTree> traceback_to_route_tree(t_trace* head, ParentNetId net_id);
 
   private:
     static void traceback_to_route_tree_x(t_trace* trace, RouteTree& tree, RouteTreeNode* parent, RRSwitchId parent_switch);
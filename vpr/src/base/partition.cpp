@@ -11,7 +11,7 @@ void Partition::set_name(std::string _part_name) {
     name = _part_name;
 }
 
-const PartitionRegion Partition::get_part_region() {
+const PartitionRegion& Partition::get_part_region() const {
     return part_region;
 }
 
@@ -23,7 +23,5 @@ void print_partition(FILE* fp, Partition part) {
     std::string name = part.get_name();
     fprintf(fp, "partition_name: %s\n", name.c_str());
 
-    PartitionRegion pr = part.get_part_region();
-
-    print_partition_region(fp, pr);
+    print_partition_region(fp, part.get_part_region());
 }
@@ -2,26 +2,60 @@
 #include "region.h"
 
 void PartitionRegion::add_to_part_region(Region region) {
+    add_to_bounding_box(region);
     partition_region.push_back(region);
 }
 
-std::vector<Region> PartitionRegion::get_partition_region() {
-    return partition_region;
-}
-
-std::vector<Region> PartitionRegion::get_partition_region() const {
+const std::vector<Region>& PartitionRegion::get_partition_region() const {
     return partition_region;
 }
 
 void PartitionRegion::set_partition_region(std::vector<Region> pr) {
-    partition_region = pr;
+    partition_region = std::move(pr);
+
+    has_bounding_box = false;
+    for (const Region& region : partition_region) {
+        add_to_bounding_box(region);
+    }
 }
 
-bool PartitionRegion::empty() {
+bool PartitionRegion::empty() const {
     return partition_region.size() == 0;
 }
 
-bool PartitionRegion::is_loc_in_part_reg(t_pl_loc loc) {
+void PartitionRegion::add_to_bounding_box(const Region& region) {
+    if (region.empty()) {
+        return;
+    }
+
+    const RegionRectCoord reg_coord = region.get_region_rect();
+    vtr::Rect<int> reg_rect(reg_coord.xmin, reg_coord.ymin, reg_coord.xmax, reg_coord.ymax);
+    if (has_bounding_box) {
+        bounding_box.expand_bounding_box(reg_rect);
+    } else {
+        bounding_box = reg_rect;
+        has_bounding_box = true;
+    }
+}
+
+bool PartitionRegion::bounding_box_overlaps(const PartitionRegion& other) const {
+    if (!has_bounding_box || !other.has_bounding_box) {
+        return false;
+    }
+
+    //The bounding boxes include their top-right edges
+    return bounding_box.xmin() <= other.bounding_box.xmax()
+           && other.bounding_box.xmin() <= bounding_box.xmax()
+           && bounding_box.ymin() <= other.bounding_box.ymax()
+           && other.bounding_box.ymin() <= bounding_box.ymax();
+}
+
+bool PartitionRegion::is_loc_in_part_reg(const t_pl_loc& loc) const {
+    //Locations outside the bounding box are in none of the regions
+    if (!has_bounding_box || !bounding_box.coincident(vtr::Point<int>(loc.x, loc.y))) {
+        return false;
+    }
+
     bool is_in_pr = false;
 
     for (unsigned int i = 0; i < partition_region.size(); i++) {
@@ -41,12 +75,18 @@ PartitionRegion intersection(const PartitionRegion& cluster_pr, const PartitionR
      * Rectangles are not merged even if it would be possible
      */
     PartitionRegion pr;
+
+    //PartitionRegions with disjoint bounding boxes have no intersecting regions
+    if (!cluster_pr.bounding_box_overlaps(new_pr)) {
+        return pr;
+    }
+
     Region intersect_region;
     for (unsigned int i = 0; i < cluster_pr.partition_region.size(); i++) {
         for (unsigned int j = 0; j < new_pr.partition_region.size(); j++) {
             intersect_region = intersection(cluster_pr.partition_region[i], new_pr.partition_region[j]);
             if (!intersect_region.empty()) {
-                pr.partition_region.push_back(intersect_region);
+                pr.add_to_part_region(intersect_region);
             }
         }
     }
@@ -55,21 +95,11 @@ PartitionRegion intersection(const PartitionRegion& cluster_pr, const PartitionR
 }
 
 void update_cluster_part_reg(PartitionRegion& cluster_pr, const PartitionRegion& new_pr) {
-    Region intersect_region;
-    std::vector<Region> int_regions;
-    for (unsigned int i = 0; i < cluster_pr.partition_region.size(); i++) {
-        for (unsigned int j = 0; j < new_pr.partition_region.size(); j++) {
-            intersect_region = intersection(cluster_pr.partition_region[i], new_pr.partition_region[j]);
-            if (!intersect_region.empty()) {
-                int_regions.push_back(intersect_region);
-            }
-        }
-    }
-    cluster_pr.set_partition_region(int_regions);
+    cluster_pr = intersection(cluster_pr, new_pr);
 }
 
-void print_partition_region(FILE* fp, PartitionRegion pr) {
-    std::vector<Region> part_region = pr.get_partition_region();
+void print_partition_region(FILE* fp, const PartitionRegion& pr) {
+    const std::vector<Region>& part_region = pr.get_partition_region();
 
     int pr_size = part_region.size();
 
@@ -11,6 +11,10 @@
  * of regions that a partition can be placed in.
  *
  * For more details on what a region is, see vpr/src/base/region.h
+ *
+ * The PartitionRegion also keeps the bounding box of its regions. Location and intersection
+ * queries first check the bounding boxes, so that the regions are only scanned for locations
+ * (or PartitionRegions) near the partition.
  */
 
 class PartitionRegion {
@@ -25,8 +29,7 @@ class PartitionRegion {
     /**
      * @brief Return the union of regions
      */
-    std::vector<Region> get_partition_region();
-    std::vector<Region> get_partition_region() const;
+    const std::vector<Region>& get_partition_region() const;
 
     /**
      * @brief Set the union of regions
@@ -36,7 +39,7 @@ class PartitionRegion {
     /**
      * @brief Check if the PartitionRegion is empty (meaning there is no constraint on the object the PartitionRegion belongs to)
      */
-    bool empty();
+    bool empty() const;
 
     /**
      * @brief Check if the given location is within the legal bounds of the  PartitionRegion.
@@ -44,7 +47,7 @@ class PartitionRegion {
      *
      *   @param loc       The location to be checked
      */
-    bool is_loc_in_part_reg(t_pl_loc loc);
+    bool is_loc_in_part_reg(const t_pl_loc& loc) const;
 
     /**
      * @brief Global friend function that returns the intersection of two PartitionRegions
@@ -64,10 +67,20 @@ class PartitionRegion {
     friend void update_cluster_part_reg(PartitionRegion& cluster_pr, const PartitionRegion& new_pr);
 
   private:
+    ///@brief Expands the bounding box to cover region
+    void add_to_bounding_box(const Region& region);
+
+    ///@brief Returns true if the bounding boxes of the (non-empty) regions of the PartitionRegions overlap
+    bool bounding_box_overlaps(const PartitionRegion& other) const;
+
     std::vector<Region> partition_region; ///< union of rectangular regions that a partition can be placed in
+
+    ///@brief The bounding box (inclusive, over all layers) of the non-empty regions, only valid if has_bounding_box is set
+    vtr::Rect<int> bounding_box;
+    bool has_bounding_box = false;
 };
 
 ///@brief used to print data from a PartitionRegion
-void print_partition_region(FILE* fp, PartitionRegion pr);
+void print_partition_region(FILE* fp, const PartitionRegion& pr);
 
 #endif /* PARTITION_REGIONS_H */
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <cstdio>
+#include <cmath>
+
+#include "perf_metrics.h"
+
+#include "vtr_assert.h"
+#include "vtr_time.h"
+#include "vtr_version.h"
+
+PerfMetrics& perf_metrics() {
+    static PerfMetrics metrics;
+    return metrics;
+}
+
+const char* perf_metric_type_name(e_perf_metric_type type) {
+    switch (type) {
+        case e_perf_metric_type::RUNTIME:
+            return "runtime";
+        case e_perf_metric_type::MEMORY:
+            return "memory";
+        case e_perf_metric_type::WORK:
+            return "work";
+        case e_perf_metric_type::QOR:
+            return "qor";
+        default:
+            VTR_ASSERT_MSG(false, "Unrecognized perf metric type");
+            return "";
+    }
+}
+
+void PerfMetrics::set(const std::string& name, double value, e_perf_metric_type type, bool higher_is_better) {
+    find_or_create(name, type, higher_is_better).value = value;
+}
+
+void PerfMetrics::add(const std::string& name, double value, e_perf_metric_type type, bool higher_is_better) {
+    find_or_create(name, type, higher_is_better).value += value;
+}
+
+double PerfMetrics::value(const std::string& name) const {
+    for (const t_perf_metric& metric : metrics_) {
+        if (metric.name == name) {
+            return metric.value;
+        }
+    }
+    return 0.;
+}
+
+void PerfMetrics::record_stage(const std::string& stage, const vtr::Timer& timer) {
+    //A stage may run more than once (e.g. routing during a minimum channel width search)
+    add(stage + ".wall_sec", timer.elapsed_sec(), e_perf_metric_type::RUNTIME);
+
+    t_perf_metric& max_rss = find_or_create(stage + ".max_rss_mib", e_perf_metric_type::MEMORY, false);
+    max_rss.value = std::max<double>(max_rss.value, timer.max_rss_mib());
+}
+
+bool PerfMetrics::write_json(const std::string& file) const {
+    FILE* fp = std::fopen(file.c_str(), "w");
+    if (!fp) {
+        return false;
+    }
+
+    std::fprintf(fp, "{\n");
+    std::fprintf(fp, "  \"vpr_version\": \"%s\",\n", vtr::VERSION);
+    std::fprintf(fp, "  \"metrics\": {");
+    for (size_t i = 0; i < metrics_.size(); ++i) {
+        const t_perf_metric& metric = metrics_[i];
+        //JSON has no representation of inf/nan
+        double value = std::isfinite(metric.value) ? metric.value : 0.;
+        std::fprintf(fp, "%s\n    \"%s\": {\"value\": %.9g, \"type\": \"%s\", \"higher_is_better\": %s}",
+                     i == 0 ? "" : ",",
+                     metric.name.c_str(),
+                     value,
+                     perf_metric_type_name(metric.type),
+                     metric.higher_is_better ? "true" : "false");
+    }
+    std::fprintf(fp, "\n  }\n}\n");
+
+    return std::fclose(fp) == 0;
+}
+
+t_perf_metric& PerfMetrics::find_or_create(const std::string& name, e_perf_metric_type type, bool higher_is_better) {
+    for (t_perf_metric& metric : metrics_) {
+        if (metric.name == name) {
+            return metric;
+        }
+    }
+
+    t_perf_metric metric;
+    metric.name = name;
+    metric.type = type;
+    metric.higher_is_better = higher_is_better;
+    metrics_.push_back(metric);
+    return metrics_.back();
+}
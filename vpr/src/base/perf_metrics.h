@@ -0,0 +1,83 @@
+#ifndef VPR_PERF_METRICS_H
+#define VPR_PERF_METRICS_H
+
+#include <string>
+#include <vector>
+
+namespace vtr {
+class Timer;
+}
+
+/**
+ * @file
+ * @brief Machine-readable run-time, memory, work and QoR metrics of a VPR run
+ *
+ * The flow records named metrics (e.g. "place.wall_sec", "route.heap_pushes_per_connection",
+ * "analysis.cpd_ns") as it runs. With --write_perf_metrics they are written as JSON, e.g.:
+ *
+ *      {
+ *        "vpr_version": "9.0.0-dev+...",
+ *        "metrics": {
+ *          "place.wall_sec": {"value": 12.5, "type": "runtime", "higher_is_better": false},
+ *          "place.moves_per_sec": {"value": 1.2e6, "type": "work", "higher_is_better": true},
+ *          ...
+ *        }
+ *      }
+ *
+ * which run_perf_test.py compares against a stored baseline, with a tolerance band
+ * for each metric type, to flag run-time regressions along with QoR changes.
+ *
+ * Recording a metric is cheap (metrics are recorded per stage, not per move or net),
+ * so metrics are always recorded.
+ */
+
+enum class e_perf_metric_type {
+    RUNTIME, ///<Wall-clock time (noisy)
+    MEMORY,  ///<Memory usage
+    WORK,    ///<Algorithmic work or throughput (e.g. heap pushes per connection)
+    QOR      ///<Quality of results (e.g. critical path delay, wirelength)
+};
+
+struct t_perf_metric {
+    std::string name;
+    double value = 0.;
+    e_perf_metric_type type = e_perf_metric_type::RUNTIME;
+    bool higher_is_better = false;
+};
+
+class PerfMetrics {
+  public:
+    ///@brief Sets the named metric (replacing any previous value)
+    void set(const std::string& name, double value, e_perf_metric_type type, bool higher_is_better = false);
+
+    ///@brief Adds value to the named metric (which starts from zero), e.g. to accumulate over several routings
+    void add(const std::string& name, double value, e_perf_metric_type type, bool higher_is_better = false);
+
+    ///@brief Returns the value of the named metric, or zero if it has not been recorded
+    double value(const std::string& name) const;
+
+    ///@brief Records the wall time (accumulated) and peak memory of a flow stage, as <stage>.wall_sec and <stage>.max_rss_mib
+    void record_stage(const std::string& stage, const vtr::Timer& timer);
+
+    ///@brief Returns the recorded metrics, in the order they were first recorded
+    const std::vector<t_perf_metric>& metrics() const { return metrics_; }
+
+    ///@brief Writes the recorded metrics to file as JSON, returning false on failure
+    bool write_json(const std::string& file) const;
+
+    void clear() { metrics_.clear(); }
+
+  private:
+    t_perf_metric& find_or_create(const std::string& name, e_perf_metric_type type, bool higher_is_better);
+
+  private:
+    std::vector<t_perf_metric> metrics_;
+};
+
+///@brief Returns the metrics of the current VPR run
+PerfMetrics& perf_metrics();
+
+///@brief Returns the name of type, as written to the JSON metrics file
+const char* perf_metric_type_name(e_perf_metric_type type);
+
+#endif
@@ -18,6 +18,7 @@
 #include "atom_netlist.h"
 #include "place_and_route.h"
 #include "place.h"
+#include "place_delay_model.h"
 #include "read_place.h"
 #include "read_route.h"
 #include "route_export.h"
@@ -89,6 +90,20 @@ int binary_search_place_and_route(const Netlist<>& placement_net_list,
 
     t_placer_opts placer_opts = placer_opts_ref;
 
+    /* The placement delay model is computed on its own (wide) channels, not the *
+     * channel width being tried, so it is shared by all the placements.         */
+    std::unique_ptr<PlaceDelayModel> place_delay_model;
+
+    /* Routings performed by the search may be abandoned early by the routing
+     * predictor (--routing_predictor_schedule), since a failure only means a
+     * wider channel is tried next. */
+    t_router_opts search_router_opts = router_opts;
+    search_router_opts.min_chan_width_search = true;
+
+    /* Optionally carried from each routing attempt to the next (--min_route_chan_width_warm_start) */
+    t_rr_wire_history warm_start_history;
+    t_rr_wire_history* warm_start = router_opts.min_channel_width_warm_start ? &warm_start_history : nullptr;
+
     /* Allocate the major routing structures. */
 
     if (router_opts.route_type == GLOBAL) {
@@ -189,11 +204,12 @@ int binary_search_place_and_route(const Netlist<>& placement_net_list,
                       segment_inf,
                       arch->Directs,
                       arch->num_directs,
-                      false);
+                      false,
+                      place_delay_model);
         }
         success = try_route(router_net_list,
                             current,
-                            router_opts,
+                            search_router_opts,
                             analysis_opts,
                             det_routing_arch, segment_inf,
                             net_delay,
@@ -203,7 +219,8 @@ int binary_search_place_and_route(const Netlist<>& placement_net_list,
                             arch->Directs,
                             arch->num_directs,
                             (attempt_count == 0) ? ScreenUpdatePriority::MAJOR : ScreenUpdatePriority::MINOR,
-                            is_flat);
+                            is_flat,
+                            warm_start);
 
         attempt_count++;
         fflush(stdout);
@@ -328,12 +345,12 @@ int binary_search_place_and_route(const Netlist<>& placement_net_list,
                 try_place(placement_net_list, placer_opts, annealing_sched, router_opts, analysis_opts, noc_opts,
                           arch->Chans, det_routing_arch, segment_inf,
                           arch->Directs, arch->num_directs,
-                          false);
+                          false, place_delay_model);
             }
 
             success = try_route(router_net_list,
                                 current,
-                                router_opts,
+                                search_router_opts,
                                 analysis_opts,
                                 det_routing_arch, segment_inf,
                                 net_delay,
@@ -343,7 +360,8 @@ int binary_search_place_and_route(const Netlist<>& placement_net_list,
                                 arch->Directs,
                                 arch->num_directs,
                                 ScreenUpdatePriority::MINOR,
-                                is_flat);
+                                is_flat,
+                                warm_start);
 
             if (success && Fc_clipped == false) {
                 final = current;
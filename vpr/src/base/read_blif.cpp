@@ -13,14 +13,30 @@
  * blifparse callback interface.  The callback methods are then called when basic blif
  * primitives are encountered by the parser.  The callback methods then create the associated
  * netlist data structures.
+ *
+ * Large files are parsed in parallel (when built with TBB): the file is memory-mapped and split
+ * into chunks at .names/.subckt lines, each chunk is parsed into a list of BlifStatements, and the
+ * statements are then replayed into the BlifAllocCallback in file order. This builds exactly the
+ * same netlist (with the same IDs) as a serial parse, while only building the netlist is serial.
  */
+#include <algorithm>
+#include <climits>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
+#include <numeric>
 #include <sstream>
 #include <unordered_set>
 #include <cctype> //std::isdigit
 
+#include <sys/stat.h>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#    include <tbb/task_arena.h>
+#    include <tbb/task_group.h>
+#endif
+
 #include "blifparse.hpp"
 #include "atom_netlist.h"
 
@@ -35,6 +51,7 @@
 #include "vpr_error.h"
 #include "globals.h"
 #include "read_blif.h"
+#include "file_contents.h"
 #include "arch_types.h"
 #include "echo_files.h"
 #include "hash.h"
@@ -652,6 +669,310 @@ struct BlifAllocCallback : public blifparse::Callback {
     e_circuit_format blif_format_ = e_circuit_format::BLIF;
 };
 
+#ifdef VPR_USE_TBB
+/**
+ * @brief A statement of a BLIF file, as reported through the blifparse::Callback interface
+ *
+ * Only the fields used by the statement's type are set.
+ */
+struct BlifStatement {
+    enum class Type {
+        BEGIN_MODEL,
+        INPUTS,
+        OUTPUTS,
+        NAMES,
+        LATCH,
+        SUBCKT,
+        BLACKBOX,
+        END_MODEL,
+        CONN,
+        CNAME,
+        ATTR,
+        PARAM
+    };
+
+    Type type;
+    int lineno;
+
+    std::string name;               ///<.model name, .subckt model, .latch input, .conn driver or .cname/.attr/.param name
+    std::string value;              ///<.latch output, .conn sink or .attr/.param value
+    std::string control;            ///<.latch control
+    std::vector<std::string> nets;  ///<.inputs/.outputs/.names/.subckt nets
+    std::vector<std::string> ports; ///<.subckt ports
+    std::vector<std::vector<blifparse::LogicValue>> so_cover;
+    blifparse::LatchType latch_type = blifparse::LatchType::UNSPECIFIED;
+    blifparse::LogicValue latch_init = blifparse::LogicValue::UNKOWN;
+};
+
+/**
+ * @brief Records the statements of (part of) a BLIF file, so they can later be replayed into
+ *        another callback with replay_blif_statements()
+ *
+ * Unlike BlifAllocCallback it does not touch any shared state, so different parts of a file
+ * can be recorded concurrently.
+ */
+struct BlifRecordCallback : public blifparse::Callback {
+  public:
+    BlifRecordCallback(std::vector<BlifStatement>& statements)
+        : statements_(statements) {}
+
+  public: //Callback interface
+    void start_parse() override {}
+    void finish_parse() override {}
+
+    void filename(std::string fname) override { filename_ = fname; }
+    void lineno(int line_num) override { lineno_ = line_num; }
+
+    void begin_model(std::string model_name) override {
+        add_statement(BlifStatement::Type::BEGIN_MODEL).name = std::move(model_name);
+    }
+
+    void inputs(std::vector<std::string> input_names) override {
+        add_statement(BlifStatement::Type::INPUTS).nets = std::move(input_names);
+    }
+
+    void outputs(std::vector<std::string> output_names) override {
+        add_statement(BlifStatement::Type::OUTPUTS).nets = std::move(output_names);
+    }
+
+    void names(std::vector<std::string> nets, std::vector<std::vector<blifparse::LogicValue>> so_cover) override {
+        BlifStatement& statement = add_statement(BlifStatement::Type::NAMES);
+        statement.nets = std::move(nets);
+        statement.so_cover = std::move(so_cover);
+    }
+
+    void latch(std::string input, std::string output, blifparse::LatchType type, std::string control, blifparse::LogicValue init) override {
+        BlifStatement& statement = add_statement(BlifStatement::Type::LATCH);
+        statement.name = std::move(input);
+        statement.value = std::move(output);
+        statement.latch_type = type;
+        statement.control = std::move(control);
+        statement.latch_init = init;
+    }
+
+    void subckt(std::string subckt_model, std::vector<std::string> ports, std::vector<std::string> nets) override {
+        BlifStatement& statement = add_statement(BlifStatement::Type::SUBCKT);
+        statement.name = std::move(subckt_model);
+        statement.ports = std::move(ports);
+        statement.nets = std::move(nets);
+    }
+
+    void blackbox() override { add_statement(BlifStatement::Type::BLACKBOX); }
+
+    void end_model() override { add_statement(BlifStatement::Type::END_MODEL); }
+
+    void conn(std::string src, std::string dst) override {
+        BlifStatement& statement = add_statement(BlifStatement::Type::CONN);
+        statement.name = std::move(src);
+        statement.value = std::move(dst);
+    }
+
+    void cname(std::string cell_name) override {
+        add_statement(BlifStatement::Type::CNAME).name = std::move(cell_name);
+    }
+
+    void attr(std::string name, std::string value) override {
+        BlifStatement& statement = add_statement(BlifStatement::Type::ATTR);
+        statement.name = std::move(name);
+        statement.value = std::move(value);
+    }
+
+    void param(std::string name, std::string value) override {
+        BlifStatement& statement = add_statement(BlifStatement::Type::PARAM);
+        statement.name = std::move(name);
+        statement.value = std::move(value);
+    }
+
+    void parse_error(const int curr_lineno, const std::string& near_text, const std::string& msg) override {
+        vpr_throw(VPR_ERROR_BLIF_F, filename_.c_str(), curr_lineno,
+                  "Error in blif file near '%s': %s\n", near_text.c_str(), msg.c_str());
+    }
+
+  private:
+    BlifStatement& add_statement(BlifStatement::Type type) {
+        statements_.emplace_back();
+        statements_.back().type = type;
+        statements_.back().lineno = lineno_;
+        return statements_.back();
+    }
+
+  private:
+    std::vector<BlifStatement>& statements_;
+    std::string filename_;
+    int lineno_ = -1;
+};
+
+///@brief Makes the callbacks of the recorded statements (in order), consuming them
+static void replay_blif_statements(std::vector<BlifStatement>& statements, blifparse::Callback& callback) {
+    for (BlifStatement& statement : statements) {
+        callback.lineno(statement.lineno);
+
+        switch (statement.type) {
+            case BlifStatement::Type::BEGIN_MODEL:
+                callback.begin_model(std::move(statement.name));
+                break;
+            case BlifStatement::Type::INPUTS:
+                callback.inputs(std::move(statement.nets));
+                break;
+            case BlifStatement::Type::OUTPUTS:
+                callback.outputs(std::move(statement.nets));
+                break;
+            case BlifStatement::Type::NAMES:
+                callback.names(std::move(statement.nets), std::move(statement.so_cover));
+                break;
+            case BlifStatement::Type::LATCH:
+                callback.latch(std::move(statement.name), std::move(statement.value), statement.latch_type,
+                               std::move(statement.control), statement.latch_init);
+                break;
+            case BlifStatement::Type::SUBCKT:
+                callback.subckt(std::move(statement.name), std::move(statement.ports), std::move(statement.nets));
+                break;
+            case BlifStatement::Type::BLACKBOX:
+                callback.blackbox();
+                break;
+            case BlifStatement::Type::END_MODEL:
+                callback.end_model();
+                break;
+            case BlifStatement::Type::CONN:
+                callback.conn(std::move(statement.name), std::move(statement.value));
+                break;
+            case BlifStatement::Type::CNAME:
+                callback.cname(std::move(statement.name));
+                break;
+            case BlifStatement::Type::ATTR:
+                callback.attr(std::move(statement.name), std::move(statement.value));
+                break;
+            case BlifStatement::Type::PARAM:
+                callback.param(std::move(statement.name), std::move(statement.value));
+                break;
+            default:
+                VTR_ASSERT_MSG(false, "Unrecognized BLIF statement type");
+        }
+    }
+    statements.clear();
+}
+
+///@brief Returns true if the line starting at line_start begins with the statement keyword
+static bool blif_line_starts_with(const char* line_start, const char* end, const char* keyword) {
+    size_t keyword_len = std::strlen(keyword);
+    if (size_t(end - line_start) <= keyword_len) return false;
+
+    return std::strncmp(line_start, keyword, keyword_len) == 0
+           && (line_start[keyword_len] == ' ' || line_start[keyword_len] == '\t');
+}
+
+/**
+ * @brief Returns the offset of the first line at or after pos (> 0) from which the rest of the
+ *        file can be parsed independently (size if there is none)
+ *
+ * These are the lines starting a .names or .subckt statement (which are not the continuation
+ * of the previous line). The statements which add to the previous block (.cname, .attr,
+ * .param and .names cover rows) therefore stay with it.
+ */
+static size_t find_blif_split_point(const char* data, size_t size, size_t pos) {
+    VTR_ASSERT(pos > 0 && pos <= size);
+    const char* end = data + size;
+    const char* line_end = static_cast<const char*>(std::memchr(data + pos - 1, '\n', size - pos + 1));
+
+    while (line_end && line_end + 1 < end) {
+        //Does the line ending here continue on the next line?
+        const char* last = line_end - 1;
+        if (last >= data && *last == '\r') --last;
+        bool continued = (last >= data && *last == '\\');
+
+        const char* line_start = line_end + 1;
+        if (!continued
+            && (blif_line_starts_with(line_start, end, ".names") || blif_line_starts_with(line_start, end, ".subckt"))) {
+            return line_start - data;
+        }
+
+        line_end = static_cast<const char*>(std::memchr(line_start, '\n', end - line_start));
+    }
+    return size;
+}
+
+/**
+ * @brief Parses blif_file with the statements of different parts of the file recorded in
+ *        parallel, and replayed into callback in file order
+ *
+ * The parts are processed in batches (to bound the memory used by the recorded statements),
+ * with each batch recorded while the previous one is replayed.
+ */
+static void parallel_blif_parse(const char* blif_file, blifparse::Callback& callback) {
+    FileContents contents(blif_file, VPR_ERROR_BLIF_F);
+    const char* data = contents.data();
+    size_t size = contents.size();
+
+    constexpr size_t MIN_CHUNK_BYTES = 4 * 1024 * 1024;
+    size_t num_workers = tbb::this_task_arena::max_concurrency();
+    size_t target_chunk_bytes = std::max(MIN_CHUNK_BYTES, size / (4 * num_workers));
+
+    std::vector<size_t> chunk_starts = {0};
+    for (size_t pos = target_chunk_bytes; pos < size;) {
+        size_t split = find_blif_split_point(data, size, pos);
+        if (split >= size) break;
+        chunk_starts.push_back(split);
+        pos = split + target_chunk_bytes;
+    }
+    chunk_starts.push_back(size);
+    size_t num_chunks = chunk_starts.size() - 1;
+
+    for (size_t ichunk = 0; ichunk < num_chunks; ++ichunk) {
+        if (chunk_starts[ichunk + 1] - chunk_starts[ichunk] > size_t(INT_MAX)) {
+            //Too large for the lexer to scan as a single buffer
+            blifparse::blif_parse_filename(blif_file, callback);
+            return;
+        }
+    }
+
+    //The line number each chunk starts on
+    std::vector<int> chunk_first_lines(num_chunks + 1, 1);
+    tbb::parallel_for(size_t(0), num_chunks, [&](size_t ichunk) {
+        chunk_first_lines[ichunk + 1] = std::count(data + chunk_starts[ichunk], data + chunk_starts[ichunk + 1], '\n');
+    });
+    std::partial_sum(chunk_first_lines.begin(), chunk_first_lines.end(), chunk_first_lines.begin());
+
+    size_t batch_size = 2 * num_workers;
+    auto record_batch = [&](size_t first_chunk, std::vector<std::vector<BlifStatement>>& batch_statements) {
+        size_t last_chunk = std::min(first_chunk + batch_size, num_chunks);
+        tbb::parallel_for(first_chunk, last_chunk, [&](size_t ichunk) {
+            std::vector<BlifStatement>& statements = batch_statements[ichunk - first_chunk];
+            BlifRecordCallback record_callback(statements);
+            blifparse::blif_parse_buffer(data + chunk_starts[ichunk], chunk_starts[ichunk + 1] - chunk_starts[ichunk],
+                                         record_callback, blif_file, chunk_first_lines[ichunk]);
+        });
+    };
+
+    callback.start_parse();
+    callback.filename(blif_file);
+
+    std::vector<std::vector<BlifStatement>> curr_batch(batch_size);
+    std::vector<std::vector<BlifStatement>> next_batch(batch_size);
+    record_batch(0, curr_batch);
+    for (size_t first_chunk = 0; first_chunk < num_chunks; first_chunk += batch_size) {
+        tbb::task_group next_batch_task;
+        if (first_chunk + batch_size < num_chunks) {
+            next_batch_task.run([&]() { record_batch(first_chunk + batch_size, next_batch); });
+        }
+
+        try {
+            for (std::vector<BlifStatement>& statements : curr_batch) {
+                replay_blif_statements(statements, callback);
+            }
+        } catch (...) {
+            next_batch_task.cancel();
+            next_batch_task.wait();
+            throw;
+        }
+
+        next_batch_task.wait();
+        std::swap(curr_batch, next_batch);
+    }
+
+    callback.finish_parse();
+}
+#endif
+
 vtr::LogicValue to_vtr_logic_value(blifparse::LogicValue val) {
     vtr::LogicValue new_val = vtr::LogicValue::UNKOWN;
     switch (val) {
@@ -745,6 +1066,18 @@ AtomNetlist read_blif(e_circuit_format circuit_format,
     std::string netlist_id = vtr::secure_digest_file(blif_file);
 
     BlifAllocCallback alloc_callback(circuit_format, netlist, netlist_id, user_models, library_models);
+
+#ifdef VPR_USE_TBB
+    //Only large files are worth splitting up
+    constexpr off_t MIN_PARALLEL_PARSE_BYTES = 32 * 1024 * 1024;
+    struct stat st;
+    if (tbb::this_task_arena::max_concurrency() > 1
+        && stat(blif_file, &st) == 0 && st.st_size >= MIN_PARALLEL_PARSE_BYTES) {
+        parallel_blif_parse(blif_file, alloc_callback);
+        return netlist;
+    }
+#endif
+
     blifparse::blif_parse_filename(blif_file, alloc_callback);
 
     return netlist;
@@ -4,6 +4,7 @@
 #include "atom_netlist.h"
 #include "atom_netlist_utils.h"
 #include "echo_files.h"
+#include "netlist_snapshot.h"
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -50,6 +51,18 @@ AtomNetlist read_and_process_circuit(e_circuit_format circuit_format, t_vpr_setu
     }
 
     AtomNetlist netlist;
+
+    //Re-use the cleaned netlist from the snapshot written after packing, if it is still valid
+    if (vpr_setup.FileNameOpts.netlist_snapshot
+        && vpr_setup.PackerOpts.doPacking != STAGE_DO
+        && circuit_format != e_circuit_format::FPGA_INTERCHANGE) {
+        vtr::ScopedStartFinishTimer t("Load circuit from netlist snapshot");
+        if (read_atom_netlist_snapshot(netlist_snapshot_file(vpr_setup.FileNameOpts.NetFile), vpr_setup, netlist)) {
+            show_circuit_stats(netlist);
+            return netlist;
+        }
+    }
+
     {
         vtr::ScopedStartFinishTimer t("Load circuit");
 
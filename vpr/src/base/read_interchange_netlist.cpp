@@ -5,23 +5,27 @@
  * This loader handles loading a post-technology mapping fully flattened (i.e not
  * hierarchical) netlist in FPGA Interchange Format file, and
  * builds a netlist data structure (AtomNetlist) from it.
+ *
+ * The (gzip'ed) file is decompressed straight into a single buffer which the capnp
+ * message is read from in place (see GzipFileContents). The cell instances are then
+ * decoded in parallel (see netlist_parallel_for()), and only added to the netlist
+ * serially, in file order, so the netlist is the same as if they were read serially.
  */
 #include <cmath>
 #include <limits>
-#include <kj/std/iostream.h>
 #include <regex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
-#include <zlib.h>
 #include <iostream>
-#include <sstream>
 
 #include "LogicalNetlist.capnp.h"
 #include "capnp/serialize.h"
 #include "capnp/serialize-packed.h"
 
 #include "atom_netlist.h"
+#include "netlist_utils.h"
+#include "gzip_file_contents.h"
 
 #include "vtr_assert.h"
 #include "vtr_hash.h"
@@ -58,6 +62,7 @@ struct NetlistReader {
         outpad_model_ = find_model(MODEL_OUTPUT);
         main_netlist_.set_block_types(inpad_model_, outpad_model_);
 
+        prepare_cell_decls();
         prepare_port_net_maps();
 
         VTR_LOG("Reading IOs...\n");
@@ -83,10 +88,61 @@ struct NetlistReader {
 
     std::unordered_map<size_t, std::unordered_map<std::pair<size_t, size_t>, std::string, vtr::hash_pair>> port_net_maps_;
 
+    ///@brief The properties of a cell declaration, looked-up once for all of its instances
+    struct t_cell_decl {
+        std::string name;
+        bool is_lut = false;
+        int lut_width = 0;
+        std::string init_param;
+        bool is_vcc = false;
+        bool is_gnd = false;
+    };
+
+    ///@brief The cell declarations, indexed by cell index
+    std::vector<t_cell_decl> cell_decls_;
+
+    ///@brief A LUT instance, decoded before it is added to the netlist
+    struct t_lut_inst {
+        std::string name;
+        AtomNetlist::TruthTable truth_table;
+        bool output_is_const = false;
+        std::vector<std::pair<std::string, LogicalNetlist::Netlist::Direction>> port_nets;
+    };
+
+    ///@brief A connection of a (non-LUT) block instance, decoded before it is added to the netlist
+    struct t_block_conn {
+        const t_model_ports* model_port;
+        size_t port_bit;
+        std::string net_name;
+        PinType pin_type;
+    };
+
+    ///@brief A (non-LUT) block instance, decoded before it is added to the netlist
+    struct t_block_inst {
+        std::string inst_name;  ///<Name of the instance
+        std::string block_name; ///<Name of the block (constant cells are merged into one block)
+        const t_model* model = nullptr;
+        std::vector<t_block_conn> conns;
+    };
+
+    /** @brief Looks-up the name and type of every cell declaration, so they are not re-compared for each instance */
+    void prepare_cell_decls() {
+        auto decl_list = nr_.getCellDecls();
+        auto str_list = nr_.getStrList();
+
+        cell_decls_.resize(decl_list.size());
+        for (size_t icell = 0; icell < decl_list.size(); ++icell) {
+            t_cell_decl& decl = cell_decls_[icell];
+            decl.name = str_list[decl_list[icell].getName()];
+            std::tie(decl.is_lut, decl.lut_width, decl.init_param) = is_lut_cell(decl.name);
+            decl.is_vcc = decl.name == arch_.vcc_cell.first;
+            decl.is_gnd = decl.name == arch_.gnd_cell.first;
+        }
+    }
+
     /** @brief Preprocesses the port net maps, populating the port_net_maps_ hash map to be later accessed for faster lookups */
     void prepare_port_net_maps() {
         auto inst_list = nr_.getInstList();
-        auto decl_list = nr_.getCellDecls();
         auto str_list = nr_.getStrList();
         auto port_list = nr_.getPortList();
         auto top_cell = nr_.getCellList()[nr_.getTopInst().getCell()];
@@ -101,11 +157,11 @@ struct NetlistReader {
                     continue;
 
                 auto port_inst = port.getInst();
-                auto cell = inst_list[port_inst].getCell();
-                if (str_list[decl_list[cell].getName()] == arch_.gnd_cell.first)
+                const t_cell_decl& decl = cell_decls_[inst_list[port_inst].getCell()];
+                if (decl.is_gnd)
                     net_name = arch_.gnd_net;
 
-                if (str_list[decl_list[cell].getName()] == arch_.vcc_cell.first)
+                if (decl.is_vcc)
                     net_name = arch_.vcc_net;
             }
 
@@ -193,150 +249,44 @@ struct NetlistReader {
         blk_model->inputs[0].size = lut_size;
 
         auto top_cell = nr_.getCellList()[nr_.getTopInst().getCell()];
-        auto decl_list = nr_.getCellDecls();
         auto inst_list = nr_.getInstList();
-        auto port_list = nr_.getPortList();
-        auto str_list = nr_.getStrList();
 
-        std::vector<std::tuple<size_t, int, std::string>> insts;
+        std::vector<size_t> insts;
         for (auto cell_inst : top_cell.getInsts()) {
-            auto cell = decl_list[inst_list[cell_inst].getCell()];
-
-            bool is_lut;
-            int width;
-            std::string init_param;
-            std::tie(is_lut, width, init_param) = is_lut_cell(str_list[cell.getName()]);
-
-            if (!is_lut)
-                continue;
-
-            insts.emplace_back(cell_inst, width, init_param);
+            if (cell_decls_[inst_list[cell_inst].getCell()].is_lut)
+                insts.push_back(cell_inst);
         }
 
-        for (auto inst : insts) {
-            size_t inst_idx;
-            int lut_width;
-            std::string init_param;
-            std::tie(inst_idx, lut_width, init_param) = inst;
-
-            std::string inst_name = str_list[inst_list[inst_idx].getName()];
-
-            auto props = inst_list[inst_idx].getPropMap().getEntries();
-            std::vector<bool> init;
-            for (auto entry : props) {
-                if (str_list[entry.getKey()] != init_param)
-                    continue;
-
-                // TODO: export this to a library function to have generic parameter decoding
-                if (entry.which() == LogicalNetlist::Netlist::PropertyMap::Entry::TEXT_VALUE) {
-                    const std::regex vhex_regex("[0-9]+'h([0-9A-Z]+)");
-                    const std::regex vbit_regex("[0-9]+'b([0-9]+)");
-                    const std::regex chex_regex("0x([0-9A-Za-z]+)");
-                    const std::regex cbit_regex("0b([0-9]+)");
-                    const std::regex bit_regex("[0-1]+");
-                    std::string init_str = str_list[entry.getTextValue()];
-                    std::smatch regex_matches;
-
-                    // Fill the init vector
-                    if (std::regex_match(init_str, regex_matches, vhex_regex))
-                        for (const char& c : regex_matches[1].str()) {
-                            int value = std::stoi(std::string(1, c), 0, 16);
-                            for (int bit = 3; bit >= 0; bit--)
-                                init.push_back((value >> bit) & 1);
-                        }
-                    else if (std::regex_match(init_str, regex_matches, chex_regex))
-                        for (const char& c : regex_matches[1].str()) {
-                            int value = std::stoi(std::string(1, c), 0, 16);
-                            for (int bit = 3; bit >= 0; bit--)
-                                init.push_back((value >> bit) & 1);
-                        }
-                    else if (std::regex_match(init_str, regex_matches, vbit_regex))
-                        for (const char& c : regex_matches[1].str())
-                            init.push_back((bool)std::stoi(std::string(1, c), 0, 2));
-                    else if (std::regex_match(init_str, regex_matches, cbit_regex))
-                        for (const char& c : regex_matches[1].str())
-                            init.push_back((bool)std::stoi(std::string(1, c), 0, 2));
-                    else if (std::regex_match(init_str, regex_matches, bit_regex))
-                        for (const char& c : init_str)
-                            init.push_back((bool)std::stoi(std::string(1, c), 0, 2));
-                }
-            }
-
-            // Add proper LUT mapping function here based on LUT size and init value
-            AtomNetlist::TruthTable truth_table;
-            bool is_const = false;
-            for (int bit = 0; bit < (int)init.size(); bit++) {
-                bool bit_set = init[init.size() - bit - 1];
-
-                if (bit_set == 0)
-                    continue;
+        //Decode the instances in parallel, as they are independent
+        std::vector<t_lut_inst> luts(insts.size());
+        netlist_parallel_for(insts.size(), [&](size_t i) {
+            decode_lut_inst(insts[i], luts[i]);
+        });
 
-                is_const = bit == 0;
-
-                truth_table.emplace_back();
-                for (int row_bit = lut_width - 1; row_bit >= 0; row_bit--) {
-                    bool row_bit_set = (bit >> row_bit) & 1;
-                    auto log_value = row_bit_set ? vtr::LogicValue::TRUE : vtr::LogicValue::FALSE;
-
-                    truth_table[truth_table.size() - 1].push_back(log_value);
+        for (t_lut_inst& lut : luts) {
+            if (lut.output_is_const) {
+                if (lut.truth_table.empty()) {
+                    VTR_LOG("Found constant-zero generator '%s'\n", lut.name.c_str());
+                } else {
+                    VTR_LOG("Found constant-one generator '%s'\n", lut.name.c_str());
                 }
-                truth_table[truth_table.size() - 1].push_back(vtr::LogicValue::TRUE);
             }
 
-            //Figure out if the output is a constant generator
-            bool output_is_const = false;
-            if (truth_table.empty()) {
-                //An empty truth table in BLIF corresponds to a constant-zero
-                //  e.g.
-                //
-                //  #gnd is a constant 0 generator
-                //  .names gnd
-                //
-                //An single entry truth table with value '0' also corresponds to a constant-zero
-                //  e.g.
-                //
-                //  #gnd2 is a constant 0 generator
-                //  .names gnd2
-                //  0
-                //
-                output_is_const = true;
-                VTR_LOG("Found constant-zero generator '%s'\n", inst_name.c_str());
-            } else if (truth_table.size() == 1 && is_const) {
-                //A single-entry truth table with value '1' in BLIF corresponds to a constant-one
-                //  e.g.
-                //
-                //  #vcc is a constant 1 generator
-                //  .names vcc
-                //  1
-                //
-                output_is_const = true;
-                VTR_LOG("Found constant-one generator '%s'\n", inst_name.c_str());
-            }
-
-            AtomBlockId blk_id = main_netlist_.create_block(inst_name, blk_model, truth_table);
+            AtomBlockId blk_id = main_netlist_.create_block(lut.name, blk_model, lut.truth_table);
 
             AtomPortId iport_id = main_netlist_.create_port(blk_id, blk_model->inputs);
             AtomPortId oport_id = main_netlist_.create_port(blk_id, blk_model->outputs);
 
-            auto cell_lib = decl_list[inst_list[inst_idx].getCell()];
-            auto port_net_map = port_net_maps_.at(inst_idx);
             int inum = 0;
-            for (auto port : cell_lib.getPorts()) {
-                std::pair<size_t, size_t> pair{port, 0};
-
-                if (port_net_map.find(pair) == port_net_map.end())
-                    continue;
-
-                auto net_name = port_net_map.at(pair);
-                AtomNetId net_id = main_netlist_.create_net(net_name);
+            for (const auto& port_net : lut.port_nets) {
+                AtomNetId net_id = main_netlist_.create_net(port_net.first);
 
-                auto dir = port_list[port].getDir();
-                switch (dir) {
+                switch (port_net.second) {
                     case LogicalNetlist::Netlist::Direction::INPUT:
-                        if (!output_is_const) main_netlist_.create_pin(iport_id, inum++, net_id, PinType::SINK);
+                        if (!lut.output_is_const) main_netlist_.create_pin(iport_id, inum++, net_id, PinType::SINK);
                         break;
                     case LogicalNetlist::Netlist::Direction::OUTPUT:
-                        main_netlist_.create_pin(oport_id, 0, net_id, PinType::DRIVER, output_is_const);
+                        main_netlist_.create_pin(oport_id, 0, net_id, PinType::DRIVER, lut.output_is_const);
                         break;
                     default:
                         VTR_ASSERT(0);
@@ -346,91 +296,178 @@ struct NetlistReader {
         }
     }
 
-    void read_blocks() {
-        auto top_cell = nr_.getCellList()[nr_.getTopInst().getCell()];
-        auto decl_list = nr_.getCellDecls();
+    /** @brief Decodes the LUT instance inst_idx into lut (only reading the netlist, so it may be called in parallel) */
+    void decode_lut_inst(size_t inst_idx, t_lut_inst& lut) {
         auto inst_list = nr_.getInstList();
+        auto decl_list = nr_.getCellDecls();
         auto port_list = nr_.getPortList();
         auto str_list = nr_.getStrList();
 
-        std::vector<std::pair<size_t, size_t>> insts;
-        for (auto cell_inst : top_cell.getInsts()) {
-            auto cell = decl_list[inst_list[cell_inst].getCell()];
+        const t_cell_decl& decl = cell_decls_[inst_list[inst_idx].getCell()];
+        int lut_width = decl.lut_width;
+
+        lut.name = str_list[inst_list[inst_idx].getName()];
 
-            bool is_lut;
-            std::tie(is_lut, std::ignore, std::ignore) = is_lut_cell(str_list[cell.getName()]);
+        std::vector<bool> init;
+        for (auto entry : inst_list[inst_idx].getPropMap().getEntries()) {
+            if (entry.which() != LogicalNetlist::Netlist::PropertyMap::Entry::TEXT_VALUE
+                || str_list[entry.getKey()] != decl.init_param)
+                continue;
 
-            if (!is_lut)
-                insts.emplace_back(cell_inst, inst_list[cell_inst].getCell());
+            decode_init(str_list[entry.getTextValue()], init);
         }
 
-        for (auto inst_pair : insts) {
-            auto inst_idx = inst_pair.first;
-            auto cell_idx = inst_pair.second;
+        // Add proper LUT mapping function here based on LUT size and init value
+        AtomNetlist::TruthTable& truth_table = lut.truth_table;
+        bool is_const = false;
+        for (int bit = 0; bit < (int)init.size(); bit++) {
+            bool bit_set = init[init.size() - bit - 1];
+
+            if (bit_set == 0)
+                continue;
 
-            auto model_name = str_list[decl_list[cell_idx].getName()];
-            const t_model* blk_model = find_model(model_name);
+            is_const = bit == 0;
 
-            std::string inst_name = str_list[inst_list[inst_idx].getName()];
-            VTR_ASSERT(inst_name.empty() == 0);
+            truth_table.emplace_back();
+            for (int row_bit = lut_width - 1; row_bit >= 0; row_bit--) {
+                bool row_bit_set = (bit >> row_bit) & 1;
+                auto log_value = row_bit_set ? vtr::LogicValue::TRUE : vtr::LogicValue::FALSE;
+
+                truth_table[truth_table.size() - 1].push_back(log_value);
+            }
+            truth_table[truth_table.size() - 1].push_back(vtr::LogicValue::TRUE);
+        }
+
+        //Figure out if the output is a constant generator
+        if (truth_table.empty()) {
+            //An empty truth table in BLIF corresponds to a constant-zero
+            //  e.g.
+            //
+            //  #gnd is a constant 0 generator
+            //  .names gnd
+            //
+            //An single entry truth table with value '0' also corresponds to a constant-zero
+            //  e.g.
+            //
+            //  #gnd2 is a constant 0 generator
+            //  .names gnd2
+            //  0
+            //
+            lut.output_is_const = true;
+        } else if (truth_table.size() == 1 && is_const) {
+            //A single-entry truth table with value '1' in BLIF corresponds to a constant-one
+            //  e.g.
+            //
+            //  #vcc is a constant 1 generator
+            //  .names vcc
+            //  1
+            //
+            lut.output_is_const = true;
+        }
+
+        auto cell_lib = decl_list[inst_list[inst_idx].getCell()];
+        const auto& port_net_map = port_net_maps_.at(inst_idx);
+        for (auto port : cell_lib.getPorts()) {
+            std::pair<size_t, size_t> pair{port, 0};
+
+            auto iter = port_net_map.find(pair);
+            if (iter == port_net_map.end())
+                continue;
+
+            lut.port_nets.emplace_back(iter->second, port_list[port].getDir());
+        }
+    }
+
+    /** @brief Appends the bits of the LUT init parameter value init_str to init (MSB first) */
+    static void decode_init(const std::string& init_str, std::vector<bool>& init) {
+        // TODO: export this to a library function to have generic parameter decoding
+        //The regexes are only built once, as that is much more expensive than matching them
+        static const std::regex vhex_regex("[0-9]+'h([0-9A-Z]+)");
+        static const std::regex vbit_regex("[0-9]+'b([0-9]+)");
+        static const std::regex chex_regex("0x([0-9A-Za-z]+)");
+        static const std::regex cbit_regex("0b([0-9]+)");
+        static const std::regex bit_regex("[0-1]+");
+        std::smatch regex_matches;
+
+        // Fill the init vector
+        if (std::regex_match(init_str, regex_matches, vhex_regex))
+            for (const char& c : regex_matches[1].str()) {
+                int value = std::stoi(std::string(1, c), 0, 16);
+                for (int bit = 3; bit >= 0; bit--)
+                    init.push_back((value >> bit) & 1);
+            }
+        else if (std::regex_match(init_str, regex_matches, chex_regex))
+            for (const char& c : regex_matches[1].str()) {
+                int value = std::stoi(std::string(1, c), 0, 16);
+                for (int bit = 3; bit >= 0; bit--)
+                    init.push_back((value >> bit) & 1);
+            }
+        else if (std::regex_match(init_str, regex_matches, vbit_regex))
+            for (const char& c : regex_matches[1].str())
+                init.push_back((bool)std::stoi(std::string(1, c), 0, 2));
+        else if (std::regex_match(init_str, regex_matches, cbit_regex))
+            for (const char& c : regex_matches[1].str())
+                init.push_back((bool)std::stoi(std::string(1, c), 0, 2));
+        else if (std::regex_match(init_str, regex_matches, bit_regex))
+            for (const char& c : init_str)
+                init.push_back((bool)std::stoi(std::string(1, c), 0, 2));
+    }
+
+    void read_blocks() {
+        auto top_cell = nr_.getCellList()[nr_.getTopInst().getCell()];
+        auto inst_list = nr_.getInstList();
+
+        //Look-up the model of each used cell declaration (in instance order, so any missing
+        //model is reported as it would be when reading serially)
+        std::vector<const t_model*> cell_models(cell_decls_.size(), nullptr);
+        std::vector<t_block_inst> blocks;
+        std::vector<size_t> insts;
+        for (auto cell_inst : top_cell.getInsts()) {
+            size_t cell_idx = inst_list[cell_inst].getCell();
+            if (cell_decls_[cell_idx].is_lut)
+                continue;
+
+            if (!cell_models[cell_idx])
+                cell_models[cell_idx] = find_model(cell_decls_[cell_idx].name);
+
+            insts.push_back(cell_inst);
+            blocks.emplace_back();
+            blocks.back().model = cell_models[cell_idx];
+        }
+
+        //Decode the instances in parallel, as they are independent
+        netlist_parallel_for(insts.size(), [&](size_t i) {
+            decode_block_inst(insts[i], blocks[i]);
+        });
+
+        for (const t_block_inst& block : blocks) {
+            const t_model* blk_model = block.model;
 
             //The name for every block should be unique, check that there is no name conflict
-            AtomBlockId blk_id = main_netlist_.find_block(inst_name);
+            AtomBlockId blk_id = main_netlist_.find_block(block.inst_name);
             if (blk_id) {
                 const t_model* conflicting_model = main_netlist_.block_model(blk_id);
                 vpr_throw(VPR_ERROR_IC_NETLIST_F, netlist_file_, -1,
                           "Duplicate blocks named '%s' found in netlist."
                           " Existing block of type '%s' conflicts with subckt of type '%s'.",
-                          inst_name.c_str(), conflicting_model->name, blk_model->name);
+                          block.inst_name.c_str(), conflicting_model->name, blk_model->name);
             }
 
-            auto port_net_map = port_net_maps_.at(inst_idx);
-
-            auto cell = decl_list[inst_list[inst_idx].getCell()];
-            if (str_list[cell.getName()] == arch_.vcc_cell.first)
-                inst_name = arch_.vcc_cell.first;
-            else if (str_list[cell.getName()] == arch_.gnd_cell.first)
-                inst_name = arch_.gnd_cell.first;
-
-            if (main_netlist_.find_block(inst_name))
+            if (main_netlist_.find_block(block.block_name))
                 continue;
 
             //Create the block
-            blk_id = main_netlist_.create_block(inst_name, blk_model);
+            blk_id = main_netlist_.create_block(block.block_name, blk_model);
 
             std::unordered_set<AtomPortId> added_ports;
-            for (auto port_net : port_net_map) {
-                auto port_idx = port_net.first.first;
-                auto port_bit = port_net.first.second;
-
-                auto net_name = port_net.second;
-                if (inst_name == arch_.vcc_cell.first)
-                    net_name = arch_.vcc_net;
-                else if (inst_name == arch_.gnd_cell.first)
-                    net_name = arch_.gnd_net;
-
-                auto port = port_list[port_idx];
-                auto port_name = str_list[port.getName()];
-
-                //Check for consistency between model and ports
-                const t_model_ports* model_port = find_model_port(blk_model, port_name);
-                VTR_ASSERT(model_port);
-
-                //Determine the pin type
-                PinType pin_type = PinType::SINK;
-                if (model_port->dir == OUT_PORT) {
-                    pin_type = PinType::DRIVER;
-                } else {
-                    VTR_ASSERT_MSG(model_port->dir == IN_PORT, "Unexpected port type");
-                }
-
-                AtomPortId port_id = main_netlist_.create_port(blk_id, model_port);
+            for (const t_block_conn& conn : block.conns) {
+                AtomPortId port_id = main_netlist_.create_port(blk_id, conn.model_port);
 
                 //Make the net
-                AtomNetId net_id = main_netlist_.create_net(std::string(net_name));
+                AtomNetId net_id = main_netlist_.create_net(conn.net_name);
 
                 //Make the pin
-                main_netlist_.create_pin(port_id, port_bit, net_id, pin_type);
+                main_netlist_.create_pin(port_id, conn.port_bit, net_id, conn.pin_type);
 
                 added_ports.emplace(port_id);
             }
@@ -458,6 +495,57 @@ struct NetlistReader {
         }
     }
 
+    /**
+     * @brief Decodes the names and connections of block instance inst_idx (whose model is already
+     *        set) into block (only reading the netlist, so it may be called in parallel)
+     */
+    void decode_block_inst(size_t inst_idx, t_block_inst& block) {
+        auto inst_list = nr_.getInstList();
+        auto port_list = nr_.getPortList();
+        auto str_list = nr_.getStrList();
+
+        block.inst_name = str_list[inst_list[inst_idx].getName()];
+        VTR_ASSERT(block.inst_name.empty() == 0);
+
+        const t_cell_decl& decl = cell_decls_[inst_list[inst_idx].getCell()];
+        if (decl.is_vcc)
+            block.block_name = arch_.vcc_cell.first;
+        else if (decl.is_gnd)
+            block.block_name = arch_.gnd_cell.first;
+        else
+            block.block_name = block.inst_name;
+
+        const auto& port_net_map = port_net_maps_.at(inst_idx);
+        block.conns.reserve(port_net_map.size());
+        for (const auto& port_net : port_net_map) {
+            auto port_idx = port_net.first.first;
+            auto port_bit = port_net.first.second;
+
+            std::string net_name = port_net.second;
+            if (block.block_name == arch_.vcc_cell.first)
+                net_name = arch_.vcc_net;
+            else if (block.block_name == arch_.gnd_cell.first)
+                net_name = arch_.gnd_net;
+
+            auto port = port_list[port_idx];
+            std::string port_name = str_list[port.getName()];
+
+            //Check for consistency between model and ports
+            const t_model_ports* model_port = find_model_port(block.model, port_name);
+            VTR_ASSERT(model_port);
+
+            //Determine the pin type
+            PinType pin_type = PinType::SINK;
+            if (model_port->dir == OUT_PORT) {
+                pin_type = PinType::DRIVER;
+            } else {
+                VTR_ASSERT_MSG(model_port->dir == IN_PORT, "Unexpected port type");
+            }
+
+            block.conns.push_back({model_port, port_bit, std::move(net_name), pin_type});
+        }
+    }
+
     //
     // Utilities
     //
@@ -525,39 +613,17 @@ AtomNetlist read_interchange_netlist(const char* ic_netlist_file,
     AtomNetlist netlist;
     std::string netlist_id = vtr::secure_digest_file(ic_netlist_file);
 
-    // Decompress GZipped capnproto device file
-    gzFile file = gzopen(ic_netlist_file, "r");
-    VTR_ASSERT(file != Z_NULL);
-
-    std::vector<uint8_t> output_data;
-    output_data.resize(4096);
-    std::stringstream sstream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
-    while (true) {
-        int ret = gzread(file, output_data.data(), output_data.size());
-        VTR_ASSERT(ret >= 0);
-        if (ret > 0) {
-            sstream.write((const char*)output_data.data(), ret);
-            VTR_ASSERT(sstream);
-        } else {
-            VTR_ASSERT(ret == 0);
-            int error;
-            gzerror(file, &error);
-            VTR_ASSERT(error == Z_OK);
-            break;
-        }
-    }
-
-    VTR_ASSERT(gzclose(file) == Z_OK);
-
-    sstream.seekg(0);
-    kj::std::StdInputStream istream(sstream);
+    // Decompress GZipped capnproto netlist file, which is then read in place
+    GzipFileContents contents(ic_netlist_file, VPR_ERROR_IC_NETLIST_F);
+    kj::ArrayPtr<const capnp::word> words(reinterpret_cast<const capnp::word*>(contents.words().data()),
+                                          contents.words().size());
 
     // Reader options
     capnp::ReaderOptions reader_options;
     reader_options.nestingLimit = std::numeric_limits<int>::max();
     reader_options.traversalLimitInWords = std::numeric_limits<uint64_t>::max();
 
-    capnp::InputStreamMessageReader message_reader(istream, reader_options);
+    capnp::FlatArrayMessageReader message_reader(words, reader_options);
 
     auto netlist_reader = message_reader.getRoot<LogicalNetlist::Netlist>();
 
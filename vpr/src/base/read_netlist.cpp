@@ -4,12 +4,30 @@
  * @date    May 2009
  *
  * @brief Read a circuit netlist in XML format and populate the netlist data structures for VPR
+ *
+ * The packed netlist file is not loaded into a single DOM, which takes far more memory than
+ * the netlist itself on large designs. Instead the memory-mapped file is first scanned for
+ * the extent of each child of the root element (without building a DOM), and each clustered
+ * block is then parsed into its own small document, processed and freed. When built with TBB,
+ * batches of blocks are parsed in parallel while the previous batch is processed (in file
+ * order, so block IDs are unchanged).
  */
 
+#include <algorithm>
+#include <cctype>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#    include <tbb/task_arena.h>
+#    include <tbb/task_group.h>
+#endif
 
 #include "pugixml.hpp"
 #include "pugixml_loc.hpp"
@@ -27,6 +45,7 @@
 #include "vpr_utils.h"
 
 #include "hash.h"
+#include "file_contents.h"
 #include "globals.h"
 #include "atom_netlist.h"
 #include "read_xml_util.h"
@@ -35,6 +54,43 @@
 
 static const char* netlist_file_name = nullptr;
 
+///@brief The extent of an element of the packed netlist file
+struct t_net_file_element {
+    size_t begin = 0;      ///<Offset of the element's start tag
+    size_t end = 0;        ///<Offset just past the element's end tag
+    size_t first_line = 1; ///<Line the element starts on
+    size_t last_line = 1;  ///<Line the element ends on
+    bool is_block = false; ///<Whether it is a <block> element
+};
+
+///@brief The root element of the packed netlist file, and the extent of each of its children
+struct t_net_file_layout {
+    t_net_file_element root;                  ///<The root element's start tag
+    std::string root_name;                    ///<The root element's tag name (empty if there is none)
+    bool root_is_empty = false;               ///<Whether the root element is self-closing
+    std::vector<t_net_file_element> children; ///<The children of the root element, in file order
+};
+
+///@brief A clustered block of the packed netlist file, parsed into its own document
+struct t_parsed_net_block {
+    pugi::xml_document doc;
+    pugiutil::loc_data loc_data;
+};
+
+static t_net_file_layout scan_net_file(const char* data, size_t size, const char* net_file);
+
+static size_t find_xml_markup_end(const char* data, size_t size, size_t begin);
+
+static std::string make_net_file_top_xml(const char* data, const t_net_file_layout& layout);
+
+static void parse_net_block(const char* data, const t_net_file_element& element, const char* net_file, t_parsed_net_block& parsed_block);
+
+static void process_net_blocks(const char* data,
+                               const std::vector<const t_net_file_element*>& block_elements,
+                               const char* net_file,
+                               int* num_primitives,
+                               ClusteredNetlist* clb_nlist);
+
 static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route, const pugiutil::loc_data& loc_data);
 
 static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* pb, t_pb_routes& pb_route, int* num_primitives, const pugiutil::loc_data& loc_data, ClusteredNetlist* clb_nlist);
@@ -61,6 +117,13 @@ static t_pb_routes alloc_pb_route(t_pb_graph_node* pb_graph_node);
 
 static void load_atom_pin_mapping(const ClusteredNetlist& clb_nlist);
 
+static ClusteredNetlist read_netlist_contents(const char* net_file,
+                                              const char* data,
+                                              size_t size,
+                                              const t_arch* arch,
+                                              bool verify_file_digests,
+                                              int verbosity);
+
 /**
  * @brief Initializes the clb_nlist with info from a netlist
  *
@@ -70,6 +133,27 @@ ClusteredNetlist read_netlist(const char* net_file,
                               const t_arch* arch,
                               bool verify_file_digests,
                               int verbosity) {
+    FileContents contents(net_file, VPR_ERROR_NET_F);
+    return read_netlist_contents(net_file, contents.data(), contents.size(), arch, verify_file_digests, verbosity);
+}
+
+ClusteredNetlist read_netlist(const char* net_file,
+                              const std::string& net_file_contents,
+                              const t_arch* arch,
+                              bool verify_file_digests,
+                              int verbosity) {
+    return read_netlist_contents(net_file, net_file_contents.data(), net_file_contents.size(), arch, verify_file_digests, verbosity);
+}
+
+/**
+ * @brief Initializes the clb_nlist from the size bytes of the netlist file net_file at data
+ */
+static ClusteredNetlist read_netlist_contents(const char* net_file,
+                                              const char* data,
+                                              size_t size,
+                                              const t_arch* arch,
+                                              bool verify_file_digests,
+                                              int verbosity) {
     clock_t begin = clock();
     size_t bcount = 0;
     std::vector<std::string> circuit_inputs, circuit_outputs, circuit_clocks;
@@ -82,12 +166,16 @@ ClusteredNetlist read_netlist(const char* net_file,
     VTR_LOG("Begin loading packed FPGA netlist file.\n");
 
     //Save an identifier for the netlist based on it's contents
-    auto clb_nlist = ClusteredNetlist(net_file, vtr::secure_digest_file(net_file));
+    auto clb_nlist = ClusteredNetlist(net_file, vtr::secure_digest_buffers({vtr::array_view<const char>(data, size)}));
 
+    t_net_file_layout layout = scan_net_file(data, size, net_file);
+
+    //The root element with all its children except the clustered blocks
+    std::string top_xml = make_net_file_top_xml(data, layout);
     pugi::xml_document doc;
     pugiutil::loc_data loc_data;
     try {
-        loc_data = pugiutil::load_xml(doc, net_file);
+        loc_data = pugiutil::load_xml(doc, net_file, top_xml.data(), top_xml.size(), layout.root.first_line);
     } catch (pugiutil::XmlError& e) {
         vpr_throw(VPR_ERROR_NET_F, net_file, 0,
                   "Failed to load netlist file '%s' (%s).\n", net_file, e.what());
@@ -181,33 +269,23 @@ ClusteredNetlist read_netlist(const char* net_file,
             atom_ctx.lookup.set_atom_pb(blk_id, nullptr);
 
         //Count the number of blocks for allocation
-        bcount = pugiutil::count_children(top, "block", loc_data, pugiutil::ReqOpt::OPTIONAL);
+        std::vector<const t_net_file_element*> block_elements;
+        for (const t_net_file_element& child : layout.children) {
+            if (child.is_block) {
+                block_elements.push_back(&child);
+            }
+        }
+        bcount = block_elements.size();
         if (bcount == 0)
             VTR_LOG_WARN("Packed netlist contains no clustered blocks\n");
 
         /* Process netlist */
-        unsigned i = 0;
-        for (auto curr_block = top.child("block"); curr_block; curr_block = curr_block.next_sibling("block")) {
-            processComplexBlock(curr_block, ClusterBlockId(i), &num_primitives, loc_data, &clb_nlist);
-            i++;
-        }
-        VTR_ASSERT(bcount == i);
-        VTR_ASSERT(clb_nlist.blocks().size() == i);
+        process_net_blocks(data, block_elements, net_file, &num_primitives, &clb_nlist);
+        VTR_ASSERT(clb_nlist.blocks().size() == bcount);
         VTR_ASSERT(num_primitives >= 0);
         VTR_ASSERT(static_cast<size_t>(num_primitives) == atom_ctx.nlist.blocks().size());
 
-        /* Error check */
-        for (auto blk_id : atom_ctx.nlist.blocks()) {
-            if (atom_ctx.lookup.atom_pb(blk_id) == nullptr) {
-                VPR_FATAL_ERROR(VPR_ERROR_NET_F,
-                                ".blif file and .net file do not match, .net file missing atom %s.\n",
-                                atom_ctx.nlist.block_name(blk_id).c_str());
-            }
-        }
-        /* TODO: Add additional check to make sure net connections match */
-        mark_constant_generators(clb_nlist, verbosity);
-
-        load_external_nets_and_cb(clb_nlist);
+        load_clustered_netlist_nets(clb_nlist, verbosity);
     } catch (pugiutil::XmlError& e) {
         vpr_throw(VPR_ERROR_NET_F, e.filename_c_str(), e.line(),
                   "Error loading post-pack netlist (%s)", e.what());
@@ -216,6 +294,264 @@ ClusteredNetlist read_netlist(const char* net_file,
     /* TODO: create this function later
      * check_top_IO_matches_IO_blocks(circuit_inputs, circuit_outputs, circuit_clocks, blist, bcount); */
 
+    clock_t end = clock();
+
+    VTR_LOG("Finished loading packed FPGA netlist file (took %g seconds).\n", (float)(end - begin) / CLOCKS_PER_SEC);
+
+    return clb_nlist;
+}
+
+/**
+ * @brief Finds the root element of the packed netlist file and the extent of each of its children
+ *
+ * Only the markup is scanned (no DOM is built), so that each child can later be parsed on its own.
+ * Malformed markup within a child is reported when the child is parsed.
+ */
+static t_net_file_layout scan_net_file(const char* data, size_t size, const char* net_file) {
+    t_net_file_layout layout;
+    std::string child_name;
+    size_t depth = 0;
+
+    //Lines are counted incrementally, as offsets are only looked up in increasing order
+    size_t line = 1;
+    size_t line_offset = 0;
+    auto line_of = [&](size_t offset) {
+        line += std::count(data + line_offset, data + offset, '\n');
+        line_offset = offset;
+        return line;
+    };
+
+    size_t pos = 0;
+    while (pos < size) {
+        const char* tag = static_cast<const char*>(std::memchr(data + pos, '<', size - pos));
+        if (tag == nullptr) break;
+
+        size_t tag_begin = tag - data;
+        size_t tag_end = find_xml_markup_end(data, size, tag_begin);
+        if (tag_end == std::string::npos) {
+            vpr_throw(VPR_ERROR_NET_F, net_file, line_of(tag_begin), "Unterminated XML markup.\n");
+        }
+        pos = tag_end;
+
+        if (tag_begin + 1 < size && (data[tag_begin + 1] == '?' || data[tag_begin + 1] == '!')) {
+            continue; //Declaration, comment or CDATA
+        }
+
+        bool is_end_tag = data[tag_begin + 1] == '/';
+        bool is_self_closing = !is_end_tag && data[tag_end - 2] == '/';
+        size_t name_begin = tag_begin + (is_end_tag ? 2 : 1);
+        size_t name_end = name_begin;
+        while (name_end < tag_end && !std::isspace(data[name_end]) && data[name_end] != '/' && data[name_end] != '>') {
+            ++name_end;
+        }
+        std::string name(data + name_begin, name_end - name_begin);
+
+        if (is_end_tag) {
+            if (depth == 0) {
+                vpr_throw(VPR_ERROR_NET_F, net_file, line_of(tag_begin), "Unexpected end tag '</%s>'.\n", name.c_str());
+            }
+            --depth;
+            if (depth == 1) {
+                if (name != child_name) {
+                    vpr_throw(VPR_ERROR_NET_F, net_file, line_of(tag_begin), "Mismatched end tag '</%s>' (expected '</%s>').\n",
+                              name.c_str(), child_name.c_str());
+                }
+                layout.children.back().end = tag_end;
+                layout.children.back().last_line = line_of(tag_end);
+            } else if (depth == 0) {
+                if (name != layout.root_name) {
+                    vpr_throw(VPR_ERROR_NET_F, net_file, line_of(tag_begin), "Mismatched end tag '</%s>' (expected '</%s>').\n",
+                              name.c_str(), layout.root_name.c_str());
+                }
+                break;
+            }
+        } else if (depth == 0) {
+            if (!layout.root_name.empty()) {
+                vpr_throw(VPR_ERROR_NET_F, net_file, line_of(tag_begin), "Unexpected second root element '<%s>'.\n", name.c_str());
+            }
+            layout.root.begin = tag_begin;
+            layout.root.end = tag_end;
+            layout.root.first_line = line_of(tag_begin);
+            layout.root.last_line = line_of(tag_end);
+            layout.root.is_block = (name == "block");
+            layout.root_name = name;
+            layout.root_is_empty = is_self_closing;
+            if (is_self_closing) break;
+            depth = 1;
+        } else {
+            if (depth == 1) {
+                t_net_file_element child;
+                child.begin = tag_begin;
+                child.end = tag_end;
+                child.first_line = line_of(tag_begin);
+                child.last_line = line_of(tag_end);
+                child.is_block = (name == "block");
+                layout.children.push_back(child);
+                child_name = name;
+            }
+            if (!is_self_closing) ++depth;
+        }
+    }
+
+    if (depth != 0) {
+        vpr_throw(VPR_ERROR_NET_F, net_file, line_of(size), "Unterminated element '<%s>'.\n",
+                  depth == 1 ? layout.root_name.c_str() : child_name.c_str());
+    }
+
+    return layout;
+}
+
+///@brief Returns the offset just past the end of the XML markup (tag, comment etc.) starting at begin, or npos if it is unterminated
+static size_t find_xml_markup_end(const char* data, size_t size, size_t begin) {
+    auto starts_with = [&](const char* prefix) {
+        size_t len = std::strlen(prefix);
+        return size - begin >= len && std::memcmp(data + begin, prefix, len) == 0;
+    };
+    auto find_after = [&](size_t from, const char* terminator) {
+        size_t len = std::strlen(terminator);
+        const char* found = std::search(data + std::min(from, size), data + size, terminator, terminator + len);
+        return found == data + size ? std::string::npos : size_t(found - data) + len;
+    };
+
+    if (starts_with("<!--")) {
+        return find_after(begin + 4, "-->");
+    } else if (starts_with("<![CDATA[")) {
+        return find_after(begin + 9, "]]>");
+    } else if (starts_with("<?")) {
+        return find_after(begin + 2, "?>");
+    }
+
+    //Tags end at the first '>' outside of a quoted attribute value
+    char quote = '\0';
+    for (size_t i = begin + 1; i < size; ++i) {
+        char c = data[i];
+        if (quote != '\0') {
+            if (c == quote) quote = '\0';
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '>') {
+            return i + 1;
+        }
+    }
+    return std::string::npos;
+}
+
+/**
+ * @brief Returns the XML of the root element with all its children, except for the clustered blocks
+ *
+ * Each block is replaced by the newlines it spans, so line numbers within the returned XML
+ * (starting from the root element's line) match those of the file.
+ */
+static std::string make_net_file_top_xml(const char* data, const t_net_file_layout& layout) {
+    if (layout.root_name.empty()) {
+        return std::string();
+    }
+
+    std::string xml(data + layout.root.begin, layout.root.end - layout.root.begin);
+    if (layout.root_is_empty) {
+        return xml;
+    }
+
+    size_t prev_end = layout.root.end;
+    for (const t_net_file_element& child : layout.children) {
+        xml.append(data + prev_end, child.begin - prev_end);
+        if (child.is_block) {
+            xml.append(child.last_line - child.first_line, '\n');
+        } else {
+            xml.append(data + child.begin, child.end - child.begin);
+        }
+        prev_end = child.end;
+    }
+    xml += "</" + layout.root_name + ">";
+
+    return xml;
+}
+
+///@brief Parses the clustered block element of the packed netlist file into parsed_block
+static void parse_net_block(const char* data, const t_net_file_element& element, const char* net_file, t_parsed_net_block& parsed_block) {
+    parsed_block.loc_data = pugiutil::load_xml(parsed_block.doc, net_file, data + element.begin, element.end - element.begin, element.first_line);
+}
+
+/**
+ * @brief Parses and processes the clustered block elements of the packed netlist file (in order)
+ *
+ * Only a bounded number of blocks are parsed at a time, and each block's document is freed
+ * once the block has been processed.
+ */
+static void process_net_blocks(const char* data,
+                               const std::vector<const t_net_file_element*>& block_elements,
+                               const char* net_file,
+                               int* num_primitives,
+                               ClusteredNetlist* clb_nlist) {
+    size_t num_blocks = block_elements.size();
+
+    auto process_block = [&](size_t iblk, t_parsed_net_block& parsed_block) {
+        processComplexBlock(parsed_block.doc.child("block"), ClusterBlockId(iblk), num_primitives, parsed_block.loc_data, clb_nlist);
+        parsed_block.doc.reset();
+    };
+
+#ifdef VPR_USE_TBB
+    size_t num_workers = tbb::this_task_arena::max_concurrency();
+    if (num_workers > 1 && num_blocks > 1) {
+        //Each batch is parsed while the previous one is processed
+        size_t batch_size = 16 * num_workers;
+        std::vector<t_parsed_net_block> curr_batch(batch_size);
+        std::vector<t_parsed_net_block> next_batch(batch_size);
+        auto parse_batch = [&](size_t first_blk, std::vector<t_parsed_net_block>& batch) {
+            size_t last_blk = std::min(first_blk + batch_size, num_blocks);
+            tbb::parallel_for(first_blk, last_blk, [&](size_t iblk) {
+                parse_net_block(data, *block_elements[iblk], net_file, batch[iblk - first_blk]);
+            });
+        };
+
+        parse_batch(0, curr_batch);
+        for (size_t first_blk = 0; first_blk < num_blocks; first_blk += batch_size) {
+            tbb::task_group next_batch_task;
+            if (first_blk + batch_size < num_blocks) {
+                next_batch_task.run([&]() { parse_batch(first_blk + batch_size, next_batch); });
+            }
+
+            try {
+                size_t last_blk = std::min(first_blk + batch_size, num_blocks);
+                for (size_t iblk = first_blk; iblk < last_blk; ++iblk) {
+                    process_block(iblk, curr_batch[iblk - first_blk]);
+                }
+            } catch (...) {
+                next_batch_task.cancel();
+                next_batch_task.wait();
+                throw;
+            }
+
+            next_batch_task.wait();
+            std::swap(curr_batch, next_batch);
+        }
+        return;
+    }
+#endif
+
+    t_parsed_net_block parsed_block;
+    for (size_t iblk = 0; iblk < num_blocks; ++iblk) {
+        parse_net_block(data, *block_elements[iblk], net_file, parsed_block);
+        process_block(iblk, parsed_block);
+    }
+}
+
+void load_clustered_netlist_nets(ClusteredNetlist& clb_nlist, int verbosity) {
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+
+    /* Error check */
+    for (auto blk_id : atom_ctx.nlist.blocks()) {
+        if (atom_ctx.lookup.atom_pb(blk_id) == nullptr) {
+            VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                            ".blif file and .net file do not match, .net file missing atom %s.\n",
+                            atom_ctx.nlist.block_name(blk_id).c_str());
+        }
+    }
+    /* TODO: Add additional check to make sure net connections match */
+    mark_constant_generators(clb_nlist, verbosity);
+
+    load_external_nets_and_cb(clb_nlist);
+
     /* load mapping between external nets and all nets */
     for (auto net_id : atom_ctx.nlist.nets()) {
         atom_ctx.lookup.set_atom_clb_net(net_id, ClusterNetId::INVALID());
@@ -232,7 +568,6 @@ ClusteredNetlist read_netlist(const char* net_file,
     /* We have to make set the following variables after the mapping between cluster nets and atom nets
      * is created
      */
-    const AtomNetlist atom_nlist = g_vpr_ctx.atom().nlist;
     for (auto clb_net : clb_nlist.nets()) {
         AtomNetId atom_net = atom_ctx.lookup.atom_net(clb_net);
         VTR_ASSERT(atom_net != AtomNetId::INVALID());
@@ -246,29 +581,6 @@ ClusteredNetlist read_netlist(const char* net_file,
 
     /* load mapping between atom pins and pb_graph_pins */
     load_atom_pin_mapping(clb_nlist);
-
-    clock_t end = clock();
-
-    VTR_LOG("Finished loading packed FPGA netlist file (took %g seconds).\n", (float)(end - begin) / CLOCKS_PER_SEC);
-
-    size_t num_pb_route_used = 0;
-    size_t num_pb_route_alloc = 0;
-    size_t num_pb_pins = 0;
-    for (auto clb : clb_nlist.blocks()) {
-        t_pb* pb = clb_nlist.block_pb(clb);
-
-        for (int ipin = 0; ipin < pb->pb_graph_node->total_pb_pins; ++ipin) {
-            if (pb->pb_route.count(ipin)) {
-                ++num_pb_route_alloc;
-                if (pb->pb_route[ipin].atom_net_id) {
-                    ++num_pb_route_used;
-                }
-            }
-            ++num_pb_pins;
-        }
-    }
-
-    return clb_nlist;
 }
 
 /**
@@ -418,34 +730,6 @@ static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* p
     auto clocks = pugiutil::get_single_child(Parent, "clocks", loc_data);
     processPorts(clocks, pb, pb_route, loc_data);
 
-    int num_in_ports = 0;
-    int begin_out_port;
-    int end_out_port;
-    int begin_clock_port;
-    int end_clock_port;
-
-    {
-        int num_out_ports = 0;
-        int num_clock_ports = 0;
-        for (i = 0; i < pb->pb_graph_node->pb_type->num_ports; i++) {
-            if (pb->pb_graph_node->pb_type->ports[i].is_clock
-                && pb->pb_graph_node->pb_type->ports[i].type == IN_PORT) {
-                num_clock_ports++;
-            } else if (!pb->pb_graph_node->pb_type->ports[i].is_clock
-                       && pb->pb_graph_node->pb_type->ports[i].type == IN_PORT) {
-                num_in_ports++;
-            } else {
-                VTR_ASSERT(pb->pb_graph_node->pb_type->ports[i].type == OUT_PORT);
-                num_out_ports++;
-            }
-        }
-
-        begin_out_port = num_in_ports;
-        end_out_port = begin_out_port + num_out_ports;
-        begin_clock_port = end_out_port;
-        end_clock_port = begin_clock_port + num_clock_ports;
-    }
-
     auto attrs = pugiutil::get_single_child(Parent, "attributes", loc_data, pugiutil::OPTIONAL);
     auto params = pugiutil::get_single_child(Parent, "parameters", loc_data, pugiutil::OPTIONAL);
 
@@ -453,17 +737,7 @@ static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* p
 
     //Create the ports in the clb_nlist for the top-level pb
     if (pb->is_root()) {
-        for (i = 0; i < num_in_ports; i++) {
-            clb_nlist->create_port(index, pb_type->ports[i].name, pb_type->ports[i].num_pins, PortType::INPUT);
-        }
-        for (i = begin_out_port; i < end_out_port; i++) {
-            clb_nlist->create_port(index, pb_type->ports[i].name, pb_type->ports[i].num_pins, PortType::OUTPUT);
-        }
-        for (i = begin_clock_port; i < end_clock_port; i++) {
-            clb_nlist->create_port(index, pb_type->ports[i].name, pb_type->ports[i].num_pins, PortType::CLOCK);
-        }
-
-        VTR_ASSERT(clb_nlist->block_ports(index).size() == (unsigned)pb_type->num_ports);
+        create_clustered_block_ports(*clb_nlist, index);
     }
 
     if (pb_type->num_modes == 0) {
@@ -596,6 +870,50 @@ static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* p
     }
 }
 
+void create_clustered_block_ports(ClusteredNetlist& clb_nlist, const ClusterBlockId blk_id) {
+    const t_pb_type* pb_type = clb_nlist.block_type(blk_id)->pb_type;
+
+    int num_in_ports = 0;
+    int begin_out_port;
+    int end_out_port;
+    int begin_clock_port;
+    int end_clock_port;
+
+    {
+        int num_out_ports = 0;
+        int num_clock_ports = 0;
+        for (int i = 0; i < pb_type->num_ports; i++) {
+            if (pb_type->ports[i].is_clock
+                && pb_type->ports[i].type == IN_PORT) {
+                num_clock_ports++;
+            } else if (!pb_type->ports[i].is_clock
+                       && pb_type->ports[i].type == IN_PORT) {
+                num_in_ports++;
+            } else {
+                VTR_ASSERT(pb_type->ports[i].type == OUT_PORT);
+                num_out_ports++;
+            }
+        }
+
+        begin_out_port = num_in_ports;
+        end_out_port = begin_out_port + num_out_ports;
+        begin_clock_port = end_out_port;
+        end_clock_port = begin_clock_port + num_clock_ports;
+    }
+
+    for (int i = 0; i < num_in_ports; i++) {
+        clb_nlist.create_port(blk_id, pb_type->ports[i].name, pb_type->ports[i].num_pins, PortType::INPUT);
+    }
+    for (int i = begin_out_port; i < end_out_port; i++) {
+        clb_nlist.create_port(blk_id, pb_type->ports[i].name, pb_type->ports[i].num_pins, PortType::OUTPUT);
+    }
+    for (int i = begin_clock_port; i < end_clock_port; i++) {
+        clb_nlist.create_port(blk_id, pb_type->ports[i].name, pb_type->ports[i].num_pins, PortType::CLOCK);
+    }
+
+    VTR_ASSERT(clb_nlist.block_ports(blk_id).size() == (unsigned)pb_type->num_ports);
+}
+
 /**
  * @brief Adds net to hashtable of nets.
  *
@@ -899,11 +1217,72 @@ static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route,
  * @brief This function updates the nets list and the connections between
  *        that list and the complex block
  */
+///@brief An external pin of a clustered block, connected to the atom net atom_net
+struct t_external_pin {
+    ClusterPortId port;
+    BitIndex bit;
+    PinType type;
+    int ipin;
+    AtomNetId atom_net;
+};
+
+/**
+ * @brief Finds the external pins of the clustered block blk_id which are connected to nets
+ *
+ * Only reads the block (and the atom netlist), so that the blocks can be scanned concurrently.
+ */
+static std::vector<t_external_pin> find_external_pins(const ClusteredNetlist& clb_nlist, ClusterBlockId blk_id) {
+    std::vector<t_external_pin> ext_pins;
+
+    t_logical_block_type_ptr block_type = clb_nlist.block_type(blk_id);
+    const t_pb* pb = clb_nlist.block_pb(blk_id);
+
+    VTR_ASSERT(block_type->pb_type->num_input_pins
+                   + block_type->pb_type->num_output_pins
+                   + block_type->pb_type->num_clock_pins
+               == block_type->pb_type->num_pins);
+
+    int num_input_ports = pb->pb_graph_node->num_input_ports;
+    int num_output_ports = pb->pb_graph_node->num_output_ports;
+    int num_clock_ports = pb->pb_graph_node->num_clock_ports;
+
+    /* Assumes that complex block pins are ordered inputs, outputs, globals */
+    int ipin = 0;
+    auto add_port_pins = [&](int iport, t_pb_graph_pin* port_pins, int num_port_pins, PinType type) {
+        ClusterPortId port_id = clb_nlist.find_port(blk_id, block_type->pb_type->ports[iport].name);
+        for (int k = 0; k < num_port_pins; k++) {
+            VTR_ASSERT(port_pins[k].pin_count_in_cluster == ipin);
+
+            auto route_iter = pb->pb_route.find(ipin);
+            if (route_iter != pb->pb_route.end() && route_iter->second.atom_net_id) {
+                ext_pins.push_back({port_id, (BitIndex)k, type, ipin, route_iter->second.atom_net_id});
+            }
+            ipin++;
+        }
+    };
+
+    //The external nets connected to input ports
+    for (int j = 0; j < num_input_ports; j++) {
+        add_port_pins(j, pb->pb_graph_node->input_pins[j], pb->pb_graph_node->num_input_pins[j], PinType::SINK);
+    }
+
+    //The external nets connected to output ports
+    for (int j = 0; j < num_output_ports; j++) {
+        add_port_pins(j + num_input_ports, pb->pb_graph_node->output_pins[j], pb->pb_graph_node->num_output_pins[j], PinType::DRIVER);
+    }
+
+    //The external nets connected to clock ports
+    for (int j = 0; j < num_clock_ports; j++) {
+        add_port_pins(j + num_input_ports + num_output_ports, pb->pb_graph_node->clock_pins[j], pb->pb_graph_node->num_clock_pins[j], PinType::SINK);
+    }
+
+    return ext_pins;
+}
+
 static void load_external_nets_and_cb(ClusteredNetlist& clb_nlist) {
-    int j, k, ipin;
+    int j;
     int ext_ncount = 0;
     t_hash** ext_nhash;
-    t_pb_graph_pin* pb_graph_pin;
     ClusterNetId clb_net_id;
 
     auto& atom_ctx = g_vpr_ctx.atom();
@@ -912,85 +1291,39 @@ static void load_external_nets_and_cb(ClusteredNetlist& clb_nlist) {
 
     t_logical_block_type_ptr block_type;
 
-    /* Assumes that complex block pins are ordered inputs, outputs, globals */
-
     clb_nlist.verify();
 
-    /* Determine the external nets of complex block */
-    for (auto blk_id : clb_nlist.blocks()) {
-        block_type = clb_nlist.block_type(blk_id);
-        const t_pb* pb = clb_nlist.block_pb(blk_id);
-
-        ipin = 0;
-        VTR_ASSERT(block_type->pb_type->num_input_pins
-                       + block_type->pb_type->num_output_pins
-                       + block_type->pb_type->num_clock_pins
-                   == block_type->pb_type->num_pins);
-
-        int num_input_ports = pb->pb_graph_node->num_input_ports;
-        int num_output_ports = pb->pb_graph_node->num_output_ports;
-        int num_clock_ports = pb->pb_graph_node->num_clock_ports;
-
-        //Load the external nets connected to input ports
-        for (j = 0; j < num_input_ports; j++) {
-            ClusterPortId input_port_id = clb_nlist.find_port(blk_id, block_type->pb_type->ports[j].name);
-            for (k = 0; k < pb->pb_graph_node->num_input_pins[j]; k++) {
-                pb_graph_pin = &pb->pb_graph_node->input_pins[j][k];
-                VTR_ASSERT(pb_graph_pin->pin_count_in_cluster == ipin);
-
-                if (pb->pb_route.count(pb_graph_pin->pin_count_in_cluster)) {
-                    AtomNetId atom_net_id = pb->pb_route[pb_graph_pin->pin_count_in_cluster].atom_net_id;
-                    if (atom_net_id) {
-                        add_net_to_hash(ext_nhash, atom_ctx.nlist.net_name(atom_net_id).c_str(), &ext_ncount);
-                        clb_net_id = clb_nlist.create_net(atom_ctx.nlist.net_name(atom_net_id));
-                        clb_nlist.create_pin(input_port_id, (BitIndex)k, clb_net_id, PinType::SINK, ipin);
-                    }
-                }
-                ipin++;
-            }
-        }
-
-        //Load the external nets connected to output ports
-        for (j = 0; j < num_output_ports; j++) {
-            ClusterPortId output_port_id = clb_nlist.find_port(blk_id, block_type->pb_type->ports[j + num_input_ports].name);
-            for (k = 0; k < pb->pb_graph_node->num_output_pins[j]; k++) {
-                pb_graph_pin = &pb->pb_graph_node->output_pins[j][k];
-                VTR_ASSERT(pb_graph_pin->pin_count_in_cluster == ipin);
+    /* Determine the external nets of complex block: the blocks are scanned concurrently,
+     * then the nets and pins are created in block order, as the netlist is not thread safe */
+    std::vector<ClusterBlockId> blocks(clb_nlist.blocks().begin(), clb_nlist.blocks().end());
+    std::vector<std::vector<t_external_pin>> block_ext_pins(blocks.size());
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), blocks.size(), [&](size_t iblk) {
+#else
+    for (size_t iblk = 0; iblk < blocks.size(); iblk++) {
+#endif
+        block_ext_pins[iblk] = find_external_pins(clb_nlist, blocks[iblk]);
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
 
-                if (pb->pb_route.count(pb_graph_pin->pin_count_in_cluster)) {
-                    AtomNetId atom_net_id = pb->pb_route[pb_graph_pin->pin_count_in_cluster].atom_net_id;
-                    if (atom_net_id) {
-                        add_net_to_hash(ext_nhash, atom_ctx.nlist.net_name(atom_net_id).c_str(), &ext_ncount);
-                        clb_net_id = clb_nlist.create_net(atom_ctx.nlist.net_name(atom_net_id));
+    for (size_t iblk = 0; iblk < blocks.size(); iblk++) {
+        for (const t_external_pin& ext_pin : block_ext_pins[iblk]) {
+            const std::string& net_name = atom_ctx.nlist.net_name(ext_pin.atom_net);
+            add_net_to_hash(ext_nhash, net_name.c_str(), &ext_ncount);
+            clb_net_id = clb_nlist.create_net(net_name);
 
-                        AtomPinId atom_net_driver = atom_ctx.nlist.net_driver(atom_net_id);
-                        bool driver_is_constant = atom_ctx.nlist.pin_is_constant(atom_net_driver);
+            if (ext_pin.type == PinType::DRIVER) {
+                AtomPinId atom_net_driver = atom_ctx.nlist.net_driver(ext_pin.atom_net);
+                bool driver_is_constant = atom_ctx.nlist.pin_is_constant(atom_net_driver);
 
-                        clb_nlist.create_pin(output_port_id, (BitIndex)k, clb_net_id, PinType::DRIVER, ipin, driver_is_constant);
+                clb_nlist.create_pin(ext_pin.port, ext_pin.bit, clb_net_id, PinType::DRIVER, ext_pin.ipin, driver_is_constant);
 
-                        VTR_ASSERT(clb_nlist.net_is_constant(clb_net_id) == driver_is_constant);
-                    }
-                }
-                ipin++;
-            }
-        }
-
-        //Load the external nets connected to clock ports
-        for (j = 0; j < num_clock_ports; j++) {
-            ClusterPortId clock_port_id = clb_nlist.find_port(blk_id, block_type->pb_type->ports[j + num_input_ports + num_output_ports].name);
-            for (k = 0; k < pb->pb_graph_node->num_clock_pins[j]; k++) {
-                pb_graph_pin = &pb->pb_graph_node->clock_pins[j][k];
-                VTR_ASSERT(pb_graph_pin->pin_count_in_cluster == ipin);
-
-                if (pb->pb_route.count(pb_graph_pin->pin_count_in_cluster)) {
-                    AtomNetId atom_net_id = pb->pb_route[pb_graph_pin->pin_count_in_cluster].atom_net_id;
-                    if (atom_net_id) {
-                        add_net_to_hash(ext_nhash, atom_ctx.nlist.net_name(atom_net_id).c_str(), &ext_ncount);
-                        clb_net_id = clb_nlist.create_net(atom_ctx.nlist.net_name(atom_net_id));
-                        clb_nlist.create_pin(clock_port_id, (BitIndex)k, clb_net_id, PinType::SINK, ipin);
-                    }
-                }
-                ipin++;
+                VTR_ASSERT(clb_nlist.net_is_constant(clb_net_id) == driver_is_constant);
+            } else {
+                clb_nlist.create_pin(ext_pin.port, ext_pin.bit, clb_net_id, PinType::SINK, ext_pin.ipin);
             }
         }
     }
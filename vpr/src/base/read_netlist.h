@@ -10,6 +10,8 @@
 #ifndef READ_NETLIST_H
 #define READ_NETLIST_H
 
+#include <string>
+
 #include "vpr_types.h"
 
 ClusteredNetlist read_netlist(const char* net_file,
@@ -17,6 +19,30 @@ ClusteredNetlist read_netlist(const char* net_file,
                               bool verify_file_digests,
                               int verbosity);
 
+/**
+ * @brief Loads the packed netlist file net_file from its contents held in memory
+ *        (e.g. as just formatted by the packer), without reading the file
+ */
+ClusteredNetlist read_netlist(const char* net_file,
+                              const std::string& net_file_contents,
+                              const t_arch* arch,
+                              bool verify_file_digests,
+                              int verbosity);
+
+/**
+ * @brief Creates the ports of the clustered block blk_id, from the ports of its (root) pb_type
+ */
+void create_clustered_block_ports(ClusteredNetlist& clb_nlist, const ClusterBlockId blk_id);
+
+/**
+ * @brief Completes loading the packed netlist clb_nlist, whose blocks (with their t_pb
+ *        hierarchies and intra-block routing) have been created and mapped to their atoms
+ *
+ * Creates the nets of clb_nlist, and the mappings between its nets and pins and those
+ * of the atom netlist.
+ */
+void load_clustered_netlist_nets(ClusteredNetlist& clb_nlist, int verbosity);
+
 void set_atom_pin_mapping(const ClusteredNetlist& clb_nlist,
                           const AtomBlockId atom_blk,
                           const AtomPortId atom_port,
@@ -209,6 +209,8 @@ struct ParseNodeReorderAlgorithm {
             conv_value.set_value(DEGREE_BFS);
         else if (str == "random_shuffle")
             conv_value.set_value(RANDOM_SHUFFLE);
+        else if (str == "spatial_hilbert")
+            conv_value.set_value(SPATIAL_HILBERT);
         else {
             std::stringstream msg;
             msg << "Invalid conversion from '" << str << "' to e_rr_node_reorder_algorithm (expected one of: " << argparse::join(default_choices(), ", ") << ")";
@@ -223,9 +225,11 @@ struct ParseNodeReorderAlgorithm {
             conv_value.set_value("none");
         else if (val == DEGREE_BFS)
             conv_value.set_value("degree_bfs");
-        else {
-            VTR_ASSERT(val == RANDOM_SHUFFLE);
+        else if (val == RANDOM_SHUFFLE)
             conv_value.set_value("random_shuffle");
+        else {
+            VTR_ASSERT(val == SPATIAL_HILBERT);
+            conv_value.set_value("spatial_hilbert");
         }
         return conv_value;
     }
@@ -388,6 +392,37 @@ struct ParsePlaceDeltaDelayAlgorithm {
     }
 };
 
+struct ParseAnalyticPlacerEngine {
+    ConvertedValue<e_analytic_placer_engine> from_str(std::string str) {
+        ConvertedValue<e_analytic_placer_engine> conv_value;
+        if (str == "quadratic")
+            conv_value.set_value(e_analytic_placer_engine::QUADRATIC);
+        else if (str == "electrostatic")
+            conv_value.set_value(e_analytic_placer_engine::ELECTROSTATIC);
+        else {
+            std::stringstream msg;
+            msg << "Invalid conversion from '" << str << "' to e_analytic_placer_engine (expected one of: " << argparse::join(default_choices(), ", ") << ")";
+            conv_value.set_error(msg.str());
+        }
+        return conv_value;
+    }
+
+    ConvertedValue<std::string> to_str(e_analytic_placer_engine val) {
+        ConvertedValue<std::string> conv_value;
+        if (val == e_analytic_placer_engine::QUADRATIC)
+            conv_value.set_value("quadratic");
+        else {
+            VTR_ASSERT(val == e_analytic_placer_engine::ELECTROSTATIC);
+            conv_value.set_value("electrostatic");
+        }
+        return conv_value;
+    }
+
+    std::vector<std::string> default_choices() {
+        return {"quadratic", "electrostatic"};
+    }
+};
+
 struct ParsePlaceAlgorithm {
     ConvertedValue<e_place_algorithm> from_str(std::string str) {
         ConvertedValue<e_place_algorithm> conv_value;
@@ -1053,6 +1088,8 @@ struct ParseRouterHeap {
             conv_value.set_value(e_heap_type::BINARY_HEAP);
         else if (str == "bucket")
             conv_value.set_value(e_heap_type::BUCKET_HEAP_APPROXIMATION);
+        else if (str == "four_ary")
+            conv_value.set_value(e_heap_type::FOUR_ARY_HEAP);
         else {
             std::stringstream msg;
             msg << "Invalid conversion from '" << str << "' to e_heap_type (expected one of: " << argparse::join(default_choices(), ", ") << ")";
@@ -1065,15 +1102,17 @@ struct ParseRouterHeap {
         ConvertedValue<std::string> conv_value;
         if (val == e_heap_type::BINARY_HEAP)
             conv_value.set_value("binary");
-        else {
-            VTR_ASSERT(val == e_heap_type::BUCKET_HEAP_APPROXIMATION);
+        else if (val == e_heap_type::BUCKET_HEAP_APPROXIMATION)
             conv_value.set_value("bucket");
+        else {
+            VTR_ASSERT(val == e_heap_type::FOUR_ARY_HEAP);
+            conv_value.set_value("four_ary");
         }
         return conv_value;
     }
 
     std::vector<std::string> default_choices() {
-        return {"binary", "bucket"};
+        return {"binary", "bucket", "four_ary"};
     }
 };
 
@@ -1431,6 +1470,36 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
             "environment variable; otherwise the default is used.")
         .default_value("1");
 
+    gen_grp.add_argument(args.profile_trace_file, "--profile_trace")
+        .help(
+            "Records profiling zones (flow stages, placement temperatures, routing"
+            " iterations and nets, timing analysis) and writes them to the specified"
+            " file as Chrome trace event JSON, viewable with https://ui.perfetto.dev."
+            " Profiling is disabled if no file is specified.")
+        .metavar("FILE")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    gen_grp.add_argument(args.perf_metrics_file, "--write_perf_metrics")
+        .help(
+            "Writes the per-stage wall time and peak memory, algorithmic work"
+            " (e.g. placement moves per second, router heap pushes per connection)"
+            " and QoR of the run to the specified file as JSON, for comparison"
+            " against a baseline by run_perf_test.py.")
+        .metavar("FILE")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    gen_grp.add_argument(args.memory_budget, "--memory_budget")
+        .help(
+            "Peak memory usage (in MiB) which VPR may not exceed. The memory usage of"
+            " the major data structures is logged after each flow stage, and VPR exits"
+            " with an error (naming the largest data structure) after the first stage"
+            " whose peak memory usage exceeds the budget. 0 imposes no budget.")
+        .metavar("MIB")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     gen_grp.add_argument<bool, ParseOnOff>(args.timing_analysis, "--timing_analysis")
         .help("Controls whether timing analysis (and timing driven optimizations) are enabled.")
         .default_value("on");
@@ -1438,7 +1507,7 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
     gen_grp.add_argument<e_timing_update_type, ParseTimingUpdateType>(args.timing_update_type, "--timing_update_type")
         .help(
             "Controls how timing analysis updates are performed:\n"
-            " * auto: VPR decides\n"
+            " * auto: VPR decides (incremental during placement, full otherwise)\n"
             " * full: Full timing updates are performed (may be faster \n"
             "         if circuit timing has changed significantly)\n"
             " * incr: Incremental timing updates are performed (may be \n"
@@ -1498,6 +1567,14 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .action(argparse::Action::STORE_TRUE)
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    gen_grp.add_argument<bool, ParseOnOff>(args.clock_route_templates, "--clock_route_templates")
+        .help(
+            "With two stage clock routing, routes the second stage along paths through the\n"
+            "dedicated clock network precomputed before routing, instead of searching for them.\n"
+            "Sinks whose precomputed path is congested are still routed by search.\n")
+        .default_value("on")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     gen_grp.add_argument<bool, ParseOnOff>(args.exit_before_pack, "--exit_before_pack")
         .help("Causes VPR to exit before packing starts (useful for statistics collection)")
         .default_value("off")
@@ -1558,6 +1635,16 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("vtr")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument(args.compiled_arch_file, "--compiled_arch")
+        .help(
+            "Compiled (binary) form of the architecture file, which loads much faster than the XML"
+            " or FPGA Interchange device."
+            " If the file was compiled from the current architecture file (with the same timing and"
+            " power options) the architecture is loaded from it, otherwise the architecture file is"
+            " read and compiled to it. Without this option the compiled"
+            " architecture is kept in the --artifact_cache_dir, if specified.")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     file_grp.add_argument(args.CircuitFile, "--circuit_file")
         .help("Path to technology mapped circuit")
         .show_in(argparse::ShowIn::HELP_ONLY);
@@ -1581,11 +1668,12 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.PlaceFile, "--place_file")
-        .help("Path to placement file")
+        .help("Path to placement file. Files with a .blob extension use a binary format, which is faster to read and write")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.RouteFile, "--route_file")
-        .help("Path to routing file")
+        .help("Path to routing file. Files with a .blob extension use a binary format, which is faster to read and write"
+              " (but can only be loaded with the same netlist and routing resource graph)")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.SDCFile, "--sdc_file")
@@ -1595,12 +1683,13 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
     file_grp.add_argument(args.read_rr_graph_file, "--read_rr_graph")
         .help(
             "The routing resource graph file to load."
-            " The loaded routing resource graph overrides any routing architecture specified in the architecture file.")
+            " The loaded routing resource graph overrides any routing architecture specified in the architecture file."
+            " The format is selected by the file extension: .xml, .bin (Cap'n Proto) or .blob (native flat binary, fastest to load).")
         .metavar("RR_GRAPH_FILE")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.write_rr_graph_file, "--write_rr_graph")
-        .help("Writes the routing resource graph to the specified file")
+        .help("Writes the routing resource graph to the specified file (.xml, .bin or .blob, see --read_rr_graph)")
         .metavar("RR_GRAPH_FILE")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
@@ -1617,9 +1706,19 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .help("Writes out new floorplanning constraints based on current placement to the specified XML file.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument(args.write_headless_images, "--write_headless_images")
+        .help(
+            "Writes images of the placement, routing utilization and congestion, without needing graphics.\n"
+            "For a file name of e.g. 'run.png', writes run_place.png after placement, and run_routing_util.png\n"
+            "and run_congestion.png after routing. Images are written as SVG for file names ending in '.svg',\n"
+            "and as PNG otherwise.")
+        .metavar("IMAGE_FILE")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     file_grp.add_argument(args.read_router_lookahead, "--read_router_lookahead")
         .help(
-            "Reads the lookahead data from the specified file instead of computing it.")
+            "Reads the lookahead data from the specified file instead of computing it."
+            " Files ending in '.blob' are memory-mapped and queried in place (map lookahead only).")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.read_intra_cluster_router_lookahead, "--read_intra_cluster_router_lookahead")
@@ -1627,7 +1726,14 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.write_router_lookahead, "--write_router_lookahead")
-        .help("Writes the lookahead data to the specified file.")
+        .help("Writes the lookahead data to the specified file."
+              " Files ending in '.blob' are written as a flat binary blob (map lookahead only).")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    file_grp.add_argument(args.write_router_lookahead_profile, "--write_router_lookahead_profile")
+        .help("Writes a profile of the router lookahead to the specified file, after a successful routing."
+              " A sample of the connections is re-routed, and the lookahead estimates are compared to the"
+              " routed delays and costs, per segment type and distance.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.write_intra_cluster_router_lookahead, "--write_intra_cluster_router_lookahead")
@@ -1636,11 +1742,13 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
 
     file_grp.add_argument(args.read_placement_delay_lookup, "--read_placement_delay_lookup")
         .help(
-            "Reads the placement delay lookup from the specified file instead of computing it.")
+            "Reads the placement delay lookup from the specified file instead of computing it."
+            " Files ending in '.blob' are memory-mapped and queried in place.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.write_placement_delay_lookup, "--write_placement_delay_lookup")
-        .help("Writes the placement delay lookup to the specified file.")
+        .help("Writes the placement delay lookup to the specified file."
+              " Files ending in '.blob' are written as a flat binary blob.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.out_file_prefix, "--outfile_prefix")
@@ -1651,6 +1759,23 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .help("Writes the cluster-level block types usage summary to the specified JSON, XML or TXT file.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument<bool, ParseOnOff>(args.netlist_snapshot, "--netlist_snapshot")
+        .help(
+            "Writes a binary snapshot of the cleaned atom netlist and the clustered netlist next to the"
+            " packed netlist file (<net_file>.snapshot) once it has been loaded, and loads both netlists"
+            " from it (instead of parsing the circuit and packed netlist files) when packing is not re-run.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    file_grp.add_argument(args.artifact_cache_dir, "--artifact_cache_dir")
+        .help(
+            "Directory of a cache shared between runs for the compiled architecture, RR graph, router"
+            " lookahead (map lookahead only), placement delay model and power callibration/transistor counts. Each artifact is keyed by a digest of the architecture file,"
+            " the VPR version and the options it depends on. Cached artifacts are reused when present,"
+            " and written when absent. The directory may safely be shared by concurrent runs.")
+        .metavar("DIR")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& netlist_grp = parser.add_argument_group("netlist options");
 
     netlist_grp.add_argument<bool, ParseOnOff>(args.absorb_buffer_luts, "--absorb_buffer_luts")
@@ -1865,6 +1990,49 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("semiDirectedSwap")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    pack_grp.add_argument(args.pack_parallel_routes, "--pack_parallel_routes")
+        .help(
+            "Maximum number of completed clusters whose final intra-cluster route runs on other threads,"
+            " while the packer keeps growing the next clusters as if those routes had succeeded."
+            " When a route fails, the clusters grown after it are undone and it is repacked (routing each atom) as usual."
+            " The clustering only depends on this value, not on the thread timing."
+            " 0 routes each cluster before growing the next one.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    pack_grp.add_argument<bool, ParseOnOff>(args.pack_incremental_intra_lb_route, "--pack_incremental_intra_lb_route")
+        .help(
+            "Whether the intra-cluster router first keeps the last legal routing of the nets unchanged by a candidate molecule,"
+            " and only routes the new nets before falling back to routing the whole cluster."
+            " This may change the clustering.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    pack_grp.add_argument(args.pack_stats_file, "--pack_stats_file")
+        .help(
+            "File to write the clusterer statistics to: the time spent in each phase (seed selection, candidate selection,"
+            " molecule placement, intra-cluster routing and timing analysis) and the molecule placement attempts and failures"
+            " of each block type. The format (JSON or CSV) is given by the .json or .csv extension."
+            " Empty (the default) disables the statistics.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    pack_grp.add_argument(args.pack_stats_interval, "--pack_stats_interval")
+        .help(
+            "Minimum number of seconds between two snapshots of the clusterer statistics written to --pack_stats_file"
+            " while clustering. 0 only writes them when clustering ends.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    pack_grp.add_argument(args.pack_timing_update_interval, "--pack_timing_update_interval")
+        .help(
+            "Number of clusters formed between two updates of the criticalities used by timing-driven clustering."
+            " Each update assumes the connections within the clusters formed so far have no delay, and incrementally"
+            " re-analyzes only the connections whose intra/inter-cluster delay changed since the last one."
+            " 0 (the default) keeps the criticalities computed before clustering.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& place_grp = parser.add_argument_group("placement options");
 
     place_grp.add_argument(args.Seed, "--seed")
@@ -1947,6 +2115,22 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("0.25")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument<bool, ParseOnOff>(args.PlaceFastStart, "--anneal_fast_start")
+        .help(
+            "Skips most of the moves of the early, high temperature annealing."
+            " The starting temperature is estimated from a sample of the trial moves of the initial placement and,"
+            " for the automatic schedule, the temperature drops faster (with fewer moves per temperature)"
+            " while the success ratio stays above --anneal_fast_start_success."
+            " The number of moves saved is reported after the anneal.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.PlaceFastStartSuccess, "--anneal_fast_start_success")
+        .help(
+            "For placement using --anneal_fast_start. Success ratio above which the temperature drops quickly.")
+        .default_value("0.8")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     place_grp.add_argument<e_pad_loc_type, ParseFixPins>(args.pad_loc_type, "--fix_pins")
         .help(
             "Fixes I/O pad locations randomly during placement. Valid options:\n"
@@ -2020,6 +2204,23 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("false")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument<bool, ParseOnOff>(args.analytic_placer_solver_stats, "--analytic_placer_solver_stats")
+        .help(
+            "Reports the number of iterations, residual error and runtime of the analytic placer's"
+            " equation solver for every build-solve iteration.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<e_analytic_placer_engine, ParseAnalyticPlacerEngine>(args.analytic_placer_engine, "--analytic_placer_engine")
+        .help(
+            "Selects the global placement formulation of the analytic placer (see --enable_analytic_placer):\n"
+            " * quadratic: bound2bound quadratic wirelength solved as linear systems (SimPL/HeAP)\n"
+            " * electrostatic: weighted-average wirelength with an electrostatic density penalty per block type,"
+            " optimized by Nesterov's method (ePlace). It spreads the blocks itself, so fewer legalization"
+            " iterations are needed\n")
+        .default_value("quadratic")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     place_grp.add_argument(args.place_static_move_prob, "--place_static_move_prob")
         .help(
             "The percentage probabilities of different moves in Simulated Annealing placement."
@@ -2082,6 +2283,56 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("on")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument(args.place_parallel_regions, "--place_parallel_regions")
+        .help(
+            "Number of regions the device is split into (differently at each temperature) for multi-threaded annealing."
+            " The moves of each region, which only involve the blocks and nets inside it, are evaluated concurrently"
+            " on up to --num_workers threads; the remaining moves are evaluated serially."
+            " The placement only depends on the seed and this value (not on the number of threads)."
+            " A value of 1 disables parallel annealing."
+            " Not supported (and ignored) with NoC placement or the slack timing placer.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_speculative_moves, "--place_speculative_moves")
+        .help(
+            "Number of candidate moves the annealer proposes at a time, whose costs are then evaluated"
+            " concurrently on up to --num_workers threads. Candidates are accepted or rejected in the order"
+            " they were proposed; a candidate touching a block or net of an earlier candidate is aborted."
+            " A value of 1 disables speculative move evaluation."
+            " Not supported (and ignored) with NoC placement or the slack timing placer.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_num_seeds, "--place_num_seeds")
+        .help(
+            "Number of placements to run (one after the other), with seeds --seed, --seed + 1, ..."
+            " The placement delay model is only computed once and shared by all of them."
+            " The best placement is kept: the one with the lowest estimated critical path delay"
+            " if timing-driven (then the lowest wiring cost), otherwise the one with the lowest wiring cost.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.seed_sweep, "--seed_sweep")
+        .help(
+            "Number of seeds to place and route concurrently, each in a process forked once the device"
+            " (RR graph, router lookahead and placement delay model) has been built, so they share it."
+            " Each seed's log, placement and routing are written to files with a .seed<N> suffix;"
+            " the best result is then loaded (and written to the usual files) for analysis."
+            " The best is the one which routed at the lowest channel width, then with the lowest critical"
+            " path delay (if timing-driven), then with the lowest wirelength."
+            " The seeds are --seed, --seed + --place_num_seeds, ..."
+            " Only supported on POSIX systems, and without graphics.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<bool, ParseOnOff>(args.place_timing_update_stats, "--place_timing_update_stats")
+        .help(
+            "Reports, at the end of timing-driven placement, the number of timing analyses and the average"
+            " number of timing graph nodes and connections each of them updated.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     place_grp.add_argument(args.place_agent_epsilon, "--place_agent_epsilon")
         .help(
             "Placement RL agent's epsilon for epsilon-greedy agent."
@@ -2097,6 +2348,96 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("0.05")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument(args.place_agent_batch_size, "--place_agent_batch_size")
+        .help(
+            "Number of move types the placement RL agent chooses at a time."
+            " The move types of a batch are all chosen from the agent's estimates at the start of the batch,"
+            " which reduces the agent overhead per move but makes it react more slowly to move outcomes.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_checkpoint_file, "--place_checkpoint_file")
+        .help(
+            "Periodically writes the annealer state (block locations, temperature, range limit, random number generator"
+            " and move generator state) to this binary file, so an interrupted placement can be continued with --place_resume."
+            " Empty (the default) disables the on-disk checkpoints.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_checkpoint_interval, "--place_checkpoint_interval")
+        .help("Number of temperatures between on-disk placement checkpoints (see --place_checkpoint_file).")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_resume, "--place_resume")
+        .help(
+            "Continues the annealing from an on-disk placement checkpoint written with --place_checkpoint_file,"
+            " instead of starting from the initial placement. The netlist and placer options must be the same as for the checkpointed run.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.eco_place_file, "--eco_place")
+        .help(
+            "ECO (incremental) placement: the text placement file of a previous version of the netlist."
+            " Blocks with the same name are kept at their previous location (if still legal), only the new, changed or"
+            " displaced blocks are placed anew, and the annealer only moves the blocks within --eco_place_region of them."
+            " Empty (the default) places the whole netlist.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.eco_place_region, "--eco_place_region")
+        .help(
+            "Blocks kept at their previous location by --eco_place stay movable if they are within this many tiles"
+            " of a block placed anew; the others are fixed.")
+        .default_value("4")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<bool, ParseOnOff>(args.place_overlap_timing_analysis, "--place_overlap_timing_analysis")
+        .help(
+            "Runs the timing analysis of each temperature on another hardware thread, while the annealer keeps moving blocks"
+            " with the previous criticalities. The new criticalities are applied at the next temperature, so they lag one"
+            " temperature behind. Has no effect if only one hardware thread is available.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_greedy_refine_passes, "--place_greedy_refine_passes")
+        .help(
+            "Maximum number of greedy refinement passes run after the quench. Each pass cuts the device into regions"
+            " (the --place_parallel_regions regions, or 16 if that is 1) which are refined concurrently on up to"
+            " --num_workers threads, by trying each block at the nearby locations of its region and keeping the"
+            " moves which reduce the placement cost. The passes stop once one does not improve the placement."
+            " The placement only depends on the seed and the number of regions (not on the number of threads)."
+            " 0 disables the refinement. Not supported (and ignored) with NoC placement or the slack timing placer.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<bool, ParseOnOff>(args.place_greedy_refine_replace_quench, "--place_greedy_refine_replace_quench")
+        .help(
+            "Runs the greedy refinement passes (see --place_greedy_refine_passes) instead of the quench, rather than after it."
+            " The quench is still run if the refinement does not support the placement costs"
+            " (NoC placement, the slack timing placer or a placement congestion cost).")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<bool, ParseOnOff>(args.place_connection_delay_cache, "--place_connection_delay_cache")
+        .help(
+            "Caches, for each point to point connection, whether its delay depends only on the position of its blocks."
+            " The timing cost of a move then fetches those delays straight from the delta delay table, instead of"
+            " querying the placement delay model. Connections between tiles with delay overrides are still queried.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_congestion_weight, "--place_congestion_weight")
+        .help(
+            "Weight of the routing congestion cost of the annealer, relative to the wiring cost. The routing demand"
+            " of each net is its estimated wirelength spread uniformly over its bounding box (RUDY), and the"
+            " congestion cost is the demand in excess of the channel tracks of each tile, relative to those tracks."
+            " The demand map is updated incrementally as nets move. 0 disables the congestion cost."
+            " Speculative move evaluation, parallel annealing and greedy refinement are disabled when it is on."
+            " Not supported (and ignored) with per-layer bounding boxes.")
+        .default_value("0.0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     place_grp.add_argument(args.place_dm_rlim, "--place_dm_rlim")
         .help(
             "The maximum range limit of any directed move other than the uniform move. "
@@ -2390,6 +2731,15 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_grp.add_argument<bool, ParseOnOff>(args.min_route_chan_width_warm_start, "--min_route_chan_width_warm_start")
+        .help(
+            "Controls whether each routing attempt of the minimum channel width search starts from the previous one:"
+            " the router lookahead is reused instead of being recomputed for each channel width,"
+            " and the congestion history of the previous attempt's wires is carried over"
+            " (tracks are mapped by their relative position in the channel).")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_grp.add_argument<e_router_algorithm, ParseRouterAlgorithm>(args.RouterAlgorithm, "--router_algorithm")
         .help(
             "Specifies the router algorithm to use.\n"
@@ -2404,6 +2754,16 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("16")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_grp.add_argument(args.incremental_reroute_all_nets_iter, "--incremental_reroute_all_nets_iter")
+        .help(
+            "The routing iteration from which nets of any fanout (ignoring --min_incremental_reroute_fanout)"
+            " are re-routed incrementally: only the connections which use overused routing resources are"
+            " ripped up, and the legal part of the net's routing is kept."
+            " This makes late routing iterations much cheaper for slowly converging designs."
+            " Values less than zero disable this.")
+        .default_value("-1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_grp.add_argument<bool, ParseOnOff>(args.exit_after_first_routing_iteration, "--exit_after_first_routing_iteration")
         .help("Causes VPR to exit after the first routing iteration (useful for saving graphics)")
         .default_value("off")
@@ -2424,9 +2784,10 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
             "Specifies the node reordering algorithm to use.\n"
             " * none: don't reorder nodes\n"
             " * degree_bfs: sort by degree and then by BFS\n"
-            " * random_shuffle: a random shuffle\n")
+            " * random_shuffle: a random shuffle\n"
+            " * spatial_hilbert: sort by layer, then along a Hilbert curve over the node locations, then by node type\n")
         .default_value("none")
-        .choices({"none", "degree_bfs", "random_shuffle"})
+        .choices({"none", "degree_bfs", "random_shuffle", "spatial_hilbert"})
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     route_grp.add_argument(args.reorder_rr_graph_nodes_threshold, "--reorder_rr_graph_nodes_threshold")
@@ -2446,6 +2807,35 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("false")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_grp.add_argument<bool, ParseOnOff>(args.overlap_route_setup, "--overlap_route_setup")
+        .help(
+            "Computes the router lookahead on a background thread while the circuit is placed,"
+            " instead of when routing starts. Only applies when the placer does not need the lookahead"
+            " itself (i.e. without timing-driven placement), and the circuit is routed on the RR graph"
+            " used by the placer (--route_chan_width equal to --place_chan_width, without"
+            " --flat_routing). The lookahead's log messages are then interleaved with the placer's.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument(args.partition_tree_report_ranks, "--partition_tree_report_ranks")
+        .help(
+            "With --router_algorithm parallel, reports after each routing iteration how it would split"
+            " if the partition tree were distributed over this many ranks (machines): the nets and"
+            " routing time of each rank and of the coordinator (which routes the nets crossing between"
+            " ranks), and the number of boundary RR nodes whose occupancy the ranks would exchange."
+            " Disabled if less than 2.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument(args.eco_route_file, "--eco_route")
+        .help(
+            "ECO (incremental) routing: the text routing file of a previous version of the netlist (and placement)."
+            " The previous routing of each net with the same name, terminals and RR graph is kept,"
+            " so only the other nets (and the nets congested by them) are routed."
+            " Empty (the default) routes all the nets.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_grp.add_argument(args.has_choking_spot, "--has_choking_spot")
         .help(
             ""
@@ -2512,6 +2902,26 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .choices({"safe", "aggressive", "off"})
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.routing_predictor_schedule, "--routing_predictor_schedule")
+        .help(
+            "Controls whether the routing predictor also adapts the router's schedule:"
+            " pres_fac grows faster while the predicted overuse slope is flat,"
+            " timing analysis is skipped after iterations which re-routed few connections,"
+            " and during the minimum channel width search routings predicted to fail are aborted"
+            " after only a few iterations (unless --routing_failure_predictor is off).")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument(args.router_sta_skip_epsilon, "--router_sta_skip_epsilon")
+        .help(
+            "Skips the timing analysis after a routing iteration if the net delay changes since the last analysis"
+            " are provably too small to move any connection criticality by more than this amount."
+            " The bound follows from the largest and total connection delay changes, so it is mostly met by"
+            " the late iterations, which only re-route a few connections. Legal routings are always analyzed."
+            " 0 disables the skipping.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument<e_routing_budgets_algorithm, RouteBudgetsAlgorithm>(args.routing_budgets_algorithm, "--routing_budgets_algorithm")
         .help(
             "Controls how the routing budgets are created and applied.\n"
@@ -2545,6 +2955,15 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("dynamic")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.route_bb_prediction, "--route_bb_prediction")
+        .help(
+            "Predicts how far each net's bounding box must extend beyond its terminals from the placement congestion"
+            " (the RUDY routing demand of the net bounding boxes, relative to the channel capacity): nets in"
+            " uncongested regions get a single channel of margin, and nets in regions at capacity the full --bb_factor."
+            " A net whose routing had to leave its predicted bounding box is given the --bb_factor one.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument<int>(args.router_high_fanout_threshold, "--router_high_fanout_threshold")
         .help(
             "Specifies the net fanout beyond which a net is considered high fanout."
@@ -2560,6 +2979,71 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("0.1")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.router_high_fanout_sink_clustering, "--router_high_fanout_sink_clustering")
+        .help(
+            "Controls the order in which the sinks of high fanout nets are routed."
+            " If on, the sinks are grouped into geographic clusters (the bins of the net's spatial route tree lookup):"
+            " the most critical sink of every cluster is routed first, forming a trunk to each cluster,"
+            " then the remaining sinks are routed one cluster at a time, branching off the nearby trunk."
+            " If off, the sinks are routed in order of decreasing criticality.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.router_net_locality_order, "--router_net_locality_order")
+        .help(
+            "Controls the order in which the nets are routed in each routing iteration (by the serial router)."
+            " If on, the nets are grouped by fanout (within a factor of two), largest first,"
+            " and the nets of each group are routed in the Z-order of their bounding box centres,"
+            " so that consecutive nets use nearby routing resources (and router data structures)."
+            " If off, the nets are routed in order of decreasing fanout.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument<int>(args.router_batch_max_fanout, "--router_batch_max_fanout")
+        .help(
+            "Fanout up to which the parallel router (--router_algorithm parallel) routes the nets of a partition tree node in batches."
+            " The nets of a batch have pairwise disjoint bounding boxes, so they are routed concurrently;"
+            " higher fanout nets are routed one at a time, first."
+            " Values less than or equal to zero route all the nets of a node one at a time.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.router_speculative_parallel, "--router_speculative_parallel")
+        .help(
+            "Makes the parallel router (--router_algorithm parallel) route all the nets concurrently, instead of"
+            " only the nets the partition tree separates. Nets routed at the same time may use the same routing"
+            " resources without seeing each other's occupancy; the next routing iteration resolves the overuse"
+            " like any other. Each iteration reports its speedup over the partition tree schedule of its nets.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument<int>(args.router_bidir_search_threshold, "--router_bidir_search_threshold")
+        .help(
+            "Specifies the Manhattan distance (in grid tiles) between a connection's source and sink"
+            " beyond which the connection is routed with a bidirectional search, expanding forward"
+            " from the route tree and backward from the sink until the two searches meet."
+            " Values less than zero disable bidirectional search."
+            " Not used with RCV or flat routing.")
+        .default_value("-1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.router_hot_edge_layout, "--router_hot_edge_layout")
+        .help(
+            "Controls whether the router builds a packed copy of the RR graph edges (sink node and switch"
+            " stored together, contiguously per source node) to reduce cache misses when expanding nodes."
+            " Costs 8 bytes of memory per RR edge.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.router_compact_rr_edges, "--router_compact_rr_edges")
+        .help(
+            "Controls whether the router releases the source node stored for each RR graph edge, which is"
+            " instead recomputed from the per node edge ranges (a binary search) when needed."
+            " Saves 4 bytes of memory per RR edge, at a small run-time cost which mostly falls on"
+            " the bidirectional search.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument<e_router_lookahead, ParseRouterLookahead>(args.router_lookahead_type, "--router_lookahead")
         .help(
             "Controls what lookahead the router uses to calculate cost of completing a connection.\n"
@@ -2618,7 +3102,10 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
             " * bucket: A bucket heap approximation is used. The bucket heap\n"
             " *         is faster because it is only a heap approximation.\n"
             " *         Testing has shown the approximation results in\n"
-            " *         similiar QoR with less CPU work.\n")
+            " *         similiar QoR with less CPU work.\n"
+            " * four_ary: A 4-ary heap with decrease-key is used. Each RR\n"
+            " *         node appears in the heap at most once, which keeps\n"
+            " *         the heap small and avoids popping stale entries.\n")
         .default_value("binary")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
@@ -2632,6 +3119,16 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.attach_rr_graph, "--attach_rr_graph")
+        .help(
+            "Attaches a .blob RR graph (from --read_rr_graph or --artifact_cache_dir) in place instead of copying it."
+            " The RR node and edge arrays are then read straight from the read-only memory-mapped file, whose pages are"
+            " shared by all the VPR processes attaching the same file, so they are held in memory once per host."
+            " Arrays which are later modified (e.g. by --reorder_rr_graph_nodes_algorithm) are copied."
+            " The file must not be modified while in use.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument<e_check_route_option, ParseCheckRoute>(args.check_route, "--check_route")
         .help(
             "Options to run check route in three different modes.\n"
@@ -2674,7 +3171,10 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     route_timing_grp.add_argument<bool, ParseOnOff>(args.check_rr_graph, "--check_rr_graph")
-        .help("Controls whether to check the rr graph when reading from disk.")
+        .help(
+            "Controls whether to check the rr graph when reading from disk."
+            " The check is skipped for .blob files written from an already checked graph"
+            " of the same architecture, unless they have since changed.")
         .default_value("on")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
@@ -2719,6 +3219,19 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    analysis_grp.add_argument(args.timing_corners, "--timing_corners")
+        .help(
+            "Additional timing corners to analyze after routing, each specified as:\n"
+            " * name:scale (e.g. 'slow:1.2'): all delays are scaled by 'scale'\n"
+            " * name:max_scale:min_scale (e.g. 'ss:1.2:1.1'): maximum delays and setup\n"
+            "   times (setup analysis) are scaled by 'max_scale', and minimum delays and\n"
+            "   hold times (hold analysis) by 'min_scale'\n"
+            "All corners are analyzed together with the nominal routed delays, and\n"
+            "the results of each are summarized. Timing reports (at 'netlist' detail)\n"
+            "are generated for the worst setup and hold corners, prefixed by their names.\n")
+        .nargs('+')
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     analysis_grp.add_argument(args.echo_dot_timing_graph_node, "--echo_dot_timing_graph_node")
         .help(
             "Controls how the timing graph echo file in DOT/GraphViz format is created when\n"
@@ -2729,6 +3242,19 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("-1")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    analysis_grp.add_argument(args.echo_timing_graph, "--echo_timing_graph")
+        .help(
+            "Writes the timing graph, timing constraints and edge delays (in tatum echo format, see tatum_test)\n"
+            "at each of the specified flow points, even if '--echo_file on' is not set:\n"
+            " * pre_pack: before packing (timing_graph.pre_pack.echo)\n"
+            " * place_initial: after the initial placement (timing_graph.place_initial.echo)\n"
+            " * place_final: after placement (timing_graph.place_final.echo)\n"
+            " * route_final: after routing (timing_graph.route_final.echo)\n"
+            " * analysis: during the final timing analysis (timing_graph.analysis.echo)\n")
+        .nargs('+')
+        .choices({"pre_pack", "place_initial", "place_final", "route_final", "analysis"})
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     analysis_grp.add_argument<e_post_synth_netlist_unconn_handling, ParsePostSynthNetlistUnconnInputHandling>(args.post_synth_netlist_unconn_input_handling, "--post_synth_netlist_unconn_inputs")
         .help(
             "Controls how unconnected input cell ports are handled in the post-synthesis netlist\n"
@@ -2755,6 +3281,20 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .help("Writes implemented design final timing summary to the specified JSON, XML or TXT file.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    analysis_grp.add_argument(args.write_timing_metrics, "--write_timing_metrics")
+        .help(
+            "Writes the setup WNS, TNS and slack histogram after each timing update during placement"
+            " and routing to the specified file (as JSON lines), to monitor timing optimization progress.")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    analysis_grp.add_argument<bool, ParseOnOff>(args.parallel_analysis, "--parallel_analysis")
+        .help(
+            "Once the final timing analysis is done, runs the routing statistics, timing reports,"
+            " post-implementation netlist writers and power estimation concurrently (with up to --num_workers threads)."
+            " The log is printed in the same order as a serial run. Requires VPR to be built with TBB.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& power_grp = parser.add_argument_group("power analysis options");
 
     power_grp.add_argument<bool, ParseOnOff>(args.do_power, "--power")
@@ -21,6 +21,7 @@ struct t_options {
     argparse::ArgValue<std::string> SDCFile;
 
     argparse::ArgValue<e_arch_format> arch_format;
+    argparse::ArgValue<std::string> compiled_arch_file;
     argparse::ArgValue<e_circuit_format> circuit_format;
 
     argparse::ArgValue<std::string> out_file_prefix;
@@ -30,17 +31,22 @@ struct t_options {
     argparse::ArgValue<std::string> write_initial_place_file;
     argparse::ArgValue<std::string> read_vpr_constraints_file;
     argparse::ArgValue<std::string> write_vpr_constraints_file;
+    argparse::ArgValue<std::string> write_headless_images;
 
     argparse::ArgValue<std::string> write_placement_delay_lookup;
     argparse::ArgValue<std::string> read_placement_delay_lookup;
 
     argparse::ArgValue<std::string> write_router_lookahead;
+    argparse::ArgValue<std::string> write_router_lookahead_profile;
     argparse::ArgValue<std::string> read_router_lookahead;
 
     argparse::ArgValue<std::string> write_intra_cluster_router_lookahead;
     argparse::ArgValue<std::string> read_intra_cluster_router_lookahead;
 
     argparse::ArgValue<std::string> write_block_usage;
+    argparse::ArgValue<bool> netlist_snapshot;
+
+    argparse::ArgValue<std::string> artifact_cache_dir;
 
     /* Stage Options */
     argparse::ArgValue<bool> do_packing;
@@ -59,6 +65,9 @@ struct t_options {
     argparse::ArgValue<bool> show_help;
     argparse::ArgValue<bool> show_version;
     argparse::ArgValue<size_t> num_workers;
+    argparse::ArgValue<std::string> profile_trace_file;
+    argparse::ArgValue<std::string> perf_metrics_file;
+    argparse::ArgValue<size_t> memory_budget;
     argparse::ArgValue<bool> timing_analysis;
     argparse::ArgValue<e_timing_update_type> timing_update_type;
     argparse::ArgValue<bool> CreateEchoFile;
@@ -68,6 +77,7 @@ struct t_options {
     argparse::ArgValue<e_constant_net_method> constant_net_method;
     argparse::ArgValue<e_clock_modeling> clock_modeling;
     argparse::ArgValue<bool> two_stage_clock_routing;
+    argparse::ArgValue<bool> clock_route_templates;
     argparse::ArgValue<bool> exit_before_pack;
     argparse::ArgValue<bool> strict_checks;
     argparse::ArgValue<std::string> disable_errors;
@@ -102,6 +112,11 @@ struct t_options {
     argparse::ArgValue<bool> use_attraction_groups;
     argparse::ArgValue<int> pack_num_moves;
     argparse::ArgValue<std::string> pack_move_type;
+    argparse::ArgValue<int> pack_parallel_routes;
+    argparse::ArgValue<bool> pack_incremental_intra_lb_route;
+    argparse::ArgValue<std::string> pack_stats_file;
+    argparse::ArgValue<float> pack_stats_interval;
+    argparse::ArgValue<int> pack_timing_update_interval;
     /* Placement options */
     argparse::ArgValue<int> Seed;
     argparse::ArgValue<bool> ShowPlaceTiming;
@@ -114,6 +129,8 @@ struct t_options {
     argparse::ArgValue<float> PlaceAlphaDecay;
     argparse::ArgValue<float> PlaceSuccessMin;
     argparse::ArgValue<float> PlaceSuccessTarget;
+    argparse::ArgValue<bool> PlaceFastStart;
+    argparse::ArgValue<float> PlaceFastStartSuccess;
     argparse::ArgValue<sched_type> anneal_sched_type;
     argparse::ArgValue<e_place_algorithm> PlaceAlgorithm;
     argparse::ArgValue<e_place_algorithm> PlaceQuenchAlgorithm;
@@ -125,6 +142,8 @@ struct t_options {
     argparse::ArgValue<e_place_effort_scaling> place_effort_scaling;
     argparse::ArgValue<e_place_delta_delay_algorithm> place_delta_delay_matrix_calculation_method;
     argparse::ArgValue<bool> enable_analytic_placer;
+    argparse::ArgValue<bool> analytic_placer_solver_stats;
+    argparse::ArgValue<e_analytic_placer_engine> analytic_placer_engine;
     argparse::ArgValue<std::vector<float>> place_static_move_prob;
     argparse::ArgValue<std::vector<float>> place_static_notiming_move_prob;
     argparse::ArgValue<int> place_high_fanout_net;
@@ -133,8 +152,24 @@ struct t_options {
     argparse::ArgValue<bool> RL_agent_placement;
     argparse::ArgValue<bool> place_agent_multistate;
     argparse::ArgValue<bool> place_checkpointing;
+    argparse::ArgValue<int> place_parallel_regions;
+    argparse::ArgValue<int> place_speculative_moves;
+    argparse::ArgValue<int> place_num_seeds;
+    argparse::ArgValue<int> seed_sweep;
+    argparse::ArgValue<bool> place_timing_update_stats;
     argparse::ArgValue<float> place_agent_epsilon;
     argparse::ArgValue<float> place_agent_gamma;
+    argparse::ArgValue<int> place_agent_batch_size;
+    argparse::ArgValue<std::string> place_checkpoint_file;
+    argparse::ArgValue<int> place_checkpoint_interval;
+    argparse::ArgValue<std::string> place_resume;
+    argparse::ArgValue<std::string> eco_place_file;
+    argparse::ArgValue<int> eco_place_region;
+    argparse::ArgValue<bool> place_overlap_timing_analysis;
+    argparse::ArgValue<int> place_greedy_refine_passes;
+    argparse::ArgValue<bool> place_greedy_refine_replace_quench;
+    argparse::ArgValue<bool> place_connection_delay_cache;
+    argparse::ArgValue<float> place_congestion_weight;
     argparse::ArgValue<float> place_dm_rlim;
     argparse::ArgValue<e_agent_space> place_agent_space;
     argparse::ArgValue<e_agent_algorithm> place_agent_algorithm;
@@ -189,9 +224,12 @@ struct t_options {
     argparse::ArgValue<int> RouteChanWidth;
     argparse::ArgValue<int> min_route_chan_width_hint; ///<Hint to binary search router about what the min chan width is
     argparse::ArgValue<bool> verify_binary_search;
+    argparse::ArgValue<bool> min_route_chan_width_warm_start;
     argparse::ArgValue<e_router_algorithm> RouterAlgorithm;
     argparse::ArgValue<int> min_incremental_reroute_fanout;
+    argparse::ArgValue<int> incremental_reroute_all_nets_iter;
     argparse::ArgValue<bool> read_rr_edge_metadata;
+    argparse::ArgValue<bool> attach_rr_graph;
     argparse::ArgValue<bool> exit_after_first_routing_iteration;
     argparse::ArgValue<e_check_route_option> check_route;
     argparse::ArgValue<size_t> max_logged_overused_rr_nodes;
@@ -201,6 +239,9 @@ struct t_options {
     argparse::ArgValue<int> reorder_rr_graph_nodes_seed;
     argparse::ArgValue<bool> flat_routing;
     argparse::ArgValue<bool> has_choking_spot;
+    argparse::ArgValue<bool> overlap_route_setup;
+    argparse::ArgValue<int> partition_tree_report_ranks;
+    argparse::ArgValue<std::string> eco_route_file;
 
     /* Timing-driven router options only */
     argparse::ArgValue<float> astar_fac;
@@ -210,12 +251,22 @@ struct t_options {
     argparse::ArgValue<float> router_init_wirelength_abort_threshold;
     argparse::ArgValue<e_incr_reroute_delay_ripup> incr_reroute_delay_ripup;
     argparse::ArgValue<e_routing_failure_predictor> routing_failure_predictor;
+    argparse::ArgValue<bool> routing_predictor_schedule;
+    argparse::ArgValue<float> router_sta_skip_epsilon;
     argparse::ArgValue<e_routing_budgets_algorithm> routing_budgets_algorithm;
     argparse::ArgValue<bool> save_routing_per_iteration;
     argparse::ArgValue<float> congested_routing_iteration_threshold_frac;
     argparse::ArgValue<e_route_bb_update> route_bb_update;
+    argparse::ArgValue<bool> route_bb_prediction;
     argparse::ArgValue<int> router_high_fanout_threshold;
     argparse::ArgValue<float> router_high_fanout_max_slope;
+    argparse::ArgValue<bool> router_high_fanout_sink_clustering;
+    argparse::ArgValue<bool> router_net_locality_order;
+    argparse::ArgValue<int> router_batch_max_fanout;
+    argparse::ArgValue<bool> router_speculative_parallel;
+    argparse::ArgValue<int> router_bidir_search_threshold;
+    argparse::ArgValue<bool> router_hot_edge_layout;
+    argparse::ArgValue<bool> router_compact_rr_edges;
     argparse::ArgValue<int> router_debug_net;
     argparse::ArgValue<int> router_debug_sink_rr;
     argparse::ArgValue<int> router_debug_iteration;
@@ -234,10 +285,14 @@ struct t_options {
     argparse::ArgValue<int> timing_report_npaths;
     argparse::ArgValue<e_timing_report_detail> timing_report_detail;
     argparse::ArgValue<bool> timing_report_skew;
+    argparse::ArgValue<std::vector<std::string>> timing_corners;
     argparse::ArgValue<std::string> echo_dot_timing_graph_node;
+    argparse::ArgValue<std::vector<std::string>> echo_timing_graph;
     argparse::ArgValue<e_post_synth_netlist_unconn_handling> post_synth_netlist_unconn_input_handling;
     argparse::ArgValue<e_post_synth_netlist_unconn_handling> post_synth_netlist_unconn_output_handling;
     argparse::ArgValue<std::string> write_timing_summary;
+    argparse::ArgValue<std::string> write_timing_metrics;
+    argparse::ArgValue<bool> parallel_analysis;
 };
 
 argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& args);
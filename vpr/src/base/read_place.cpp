@@ -7,6 +7,7 @@
 #include "vtr_util.h"
 #include "vtr_log.h"
 #include "vtr_digest.h"
+#include "vtr_flat_blob.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -16,6 +17,36 @@
 #include "read_place.h"
 #include "read_xml_arch_file.h"
 #include "place_util.h"
+#include "netlist_utils.h"
+#include "buffered_file_writer.h"
+
+///@brief Bumped whenever the layout of a binary placement file changes
+constexpr int32_t PLACE_BLOB_VERSION = 1;
+
+///@brief The sections of a binary (.blob) placement file, in file order
+enum e_place_blob_section {
+    PLACE_BLOB_HEADER = 0,  ///<int32_t: version
+    PLACE_BLOB_KEY_OFFSETS, ///<uint64_t: offset of each key string (see e_place_blob_key)
+    PLACE_BLOB_KEY_CHARS,   ///<char: the key strings
+    PLACE_BLOB_GRID_SIZE,   ///<uint64_t: width and height of the device grid
+    PLACE_BLOB_BLOCK_LOCS,  ///<t_place_blob_loc: location of each clustered block, indexed by ClusterBlockId
+    PLACE_BLOB_NUM_SECTIONS
+};
+
+///@brief The strings identifying what a binary placement file was written for
+enum e_place_blob_key {
+    PLACE_BLOB_NETLIST_FILE = 0, ///<Packed netlist file
+    PLACE_BLOB_NETLIST_ID,       ///<Clustered netlist id (digest of the packed netlist file)
+    PLACE_BLOB_NUM_KEYS
+};
+
+///@brief The location of a clustered block, as stored in a binary placement file
+struct t_place_blob_loc {
+    int32_t x;
+    int32_t y;
+    int32_t sub_tile;
+    int32_t layer;
+};
 
 void read_place_header(
     std::ifstream& placement_file,
@@ -29,11 +60,26 @@ void read_place_body(
     const char* place_file,
     bool is_place_file);
 
+static bool parse_place_body_line(const std::vector<std::string>& tokens, std::string& block_name, t_pl_loc& loc);
+
+static void read_place_blob(const char* net_file,
+                            const char* place_file,
+                            bool verify_file_digests,
+                            const DeviceGrid& grid);
+static void print_place_blob(const char* net_file,
+                             const char* net_id,
+                             const char* place_file);
+
 void read_place(
     const char* net_file,
     const char* place_file,
     bool verify_file_digests,
     const DeviceGrid& grid) {
+    if (vtr::check_file_name_extension(place_file, ".blob")) {
+        read_place_blob(net_file, place_file, verify_file_digests, grid);
+        return;
+    }
+
     std::ifstream fstream(place_file);
     if (!fstream) {
         VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
@@ -72,6 +118,98 @@ void read_constraints(const char* constraints_file) {
     VTR_LOG("\n");
 }
 
+vtr::vector_map<ClusterBlockId, t_pl_loc> read_eco_place(const char* net_file,
+                                                         const char* place_file,
+                                                         const DeviceGrid& grid) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    if (vtr::check_file_name_extension(place_file, ".blob")) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
+                        "'%s' - ECO placement requires a text placement file (binary placement files do not record block names).\n",
+                        place_file);
+    }
+
+    std::ifstream fstream(place_file);
+    if (!fstream) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
+                        "'%s' - Cannot open place file.\n",
+                        place_file);
+    }
+
+    VTR_LOG("Reading ECO placement %s.\n", place_file);
+    VTR_LOG("\n");
+
+    //The netlist is expected to have changed, so a different netlist id is only a warning
+    read_place_header(fstream, net_file, place_file, /*verify_file_digests=*/false, grid);
+
+    vtr::vector_map<ClusterBlockId, t_pl_loc> block_locs;
+    block_locs.resize(cluster_ctx.clb_nlist.blocks().size());
+
+    size_t num_skipped_blocks = 0;
+    std::string line;
+    int lineno = 0;
+    while (std::getline(fstream, line)) {
+        ++lineno;
+
+        std::vector<std::string> tokens = vtr::split(line);
+        if (tokens.empty() || tokens[0][0] == '#') {
+            continue; //Skip blank and commented lines
+        }
+
+        std::string block_name;
+        t_pl_loc loc;
+        if (!parse_place_body_line(tokens, block_name, loc)) {
+            vpr_throw(VPR_ERROR_PLACE_F, place_file, lineno,
+                      "Invalid line '%s' in file",
+                      line.c_str());
+        }
+
+        ClusterBlockId blk_id = cluster_ctx.clb_nlist.find_block(block_name);
+        if (!blk_id) {
+            //Removed (or renamed) by the netlist change
+            ++num_skipped_blocks;
+            continue;
+        }
+
+        if (block_locs[blk_id].x != OPEN) {
+            vpr_throw(VPR_ERROR_PLACE_F, place_file, lineno,
+                      "Block %s is listed multiple times",
+                      block_name.c_str());
+        }
+        block_locs[blk_id] = loc;
+    }
+
+    VTR_LOG("Read the previous locations of %zu blocks of %s (%zu blocks are no longer in the netlist).\n",
+            size_t(std::count_if(block_locs.begin(), block_locs.end(), [](const t_pl_loc& loc) { return loc.x != OPEN; })),
+            place_file, num_skipped_blocks);
+    VTR_LOG("\n");
+
+    return block_locs;
+}
+
+/**
+ * Parses the tokens of a block location line of a placement (or constraints) file:
+ * block name, x, y, sub tile and optionally layer (for 3D architectures), possibly followed by a comment.
+ * Returns false if the tokens are not a block location.
+ */
+static bool parse_place_body_line(const std::vector<std::string>& tokens, std::string& block_name, t_pl_loc& loc) {
+    // If the place file corresponds to a 3D architecture, it should contain 5 tokens of actual data, with an optional 6th (commented) token indicating VPR's internal block number.
+    // If it belongs to 2D architecture file, supported for backward compatability, We should have 4 tokens of actual data, with an optional 5th (commented) token indicating VPR's
+    //internal block number
+    bool is_2d = tokens.size() == 4 || (tokens.size() > 4 && tokens[4][0] == '#');
+    bool is_3d = tokens.size() == 5 || (tokens.size() > 5 && tokens[5][0] == '#');
+    if (!is_2d && !is_3d) {
+        return false;
+    }
+
+    block_name = tokens[0];
+    loc.x = vtr::atoi(tokens[1]);
+    loc.y = vtr::atoi(tokens[2]);
+    loc.sub_tile = vtr::atoi(tokens[3]);
+    loc.layer = is_2d ? 0 : vtr::atoi(tokens[4]);
+    return true;
+}
+
 /**
  * This function reads the header (first two lines) of a placement file.
  * The header consists of two lines that specify the netlist file and grid size that were used when generating placement.
@@ -193,6 +331,8 @@ void read_place_body(std::ifstream& placement_file,
         ++lineno;
 
         std::vector<std::string> tokens = vtr::split(line);
+        std::string block_name;
+        t_pl_loc file_loc;
 
         if (tokens.empty()) {
             continue; //Skip blank lines
@@ -200,36 +340,12 @@ void read_place_body(std::ifstream& placement_file,
         } else if (tokens[0][0] == '#') {
             continue; //Skip commented lines
 
-        } else if ((tokens.size() == 4 || (tokens.size() > 4 && tokens[4][0] == '#')) || (tokens.size() == 5 || (tokens.size() > 5 && tokens[5][0] == '#'))) {
+        } else if (parse_place_body_line(tokens, block_name, file_loc)) {
             //Load the block location
-            //
-            // If the place file corresponds to a 3D architecture, it should contain 5 tokens of actual data, with an optional 6th (commented) token indicating VPR's internal block number.
-            // If it belongs to 2D architecture file, supported for backward compatability, We should have 4 tokens of actual data, with an optional 5th (commented) token indicating VPR's
-            //internal block number
-            int block_name_index = 0;
-            int block_x_index = 1;
-            int block_y_index = 2;
-            int sub_tile_index_index = 3;
-            int block_layer_index;
-            if (tokens.size() == 4 || (tokens.size() > 4 && tokens[4][0] == '#')) {
-                //2D architecture
-                block_layer_index = -1;
-
-            } else {
-                // 3D architecture
-                block_layer_index = 4;
-            }
-
-            std::string block_name = tokens[block_name_index];
-            int block_x = vtr::atoi(tokens[block_x_index]);
-            int block_y = vtr::atoi(tokens[block_y_index]);
-            int sub_tile_index = vtr::atoi(tokens[sub_tile_index_index]);
-            int block_layer;
-            if (block_layer_index != -1) {
-                block_layer = vtr::atoi(tokens[block_layer_index]);
-            } else {
-                block_layer = 0;
-            }
+            int block_x = file_loc.x;
+            int block_y = file_loc.y;
+            int sub_tile_index = file_loc.sub_tile;
+            int block_layer = file_loc.layer;
 
             //c-style block name needed for printing block name in error messages
             char const* c_block_name = block_name.c_str();
@@ -310,36 +426,156 @@ void read_place_body(std::ifstream& placement_file,
 void print_place(const char* net_file,
                  const char* net_id,
                  const char* place_file) {
-    FILE* fp;
+    if (vtr::check_file_name_extension(place_file, ".blob")) {
+        print_place_blob(net_file, net_id, place_file);
+        return;
+    }
 
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.mutable_placement();
 
-    fp = fopen(place_file, "w");
+    BufferedFileWriter out(place_file, VPR_ERROR_PLACE_F);
 
-    fprintf(fp, "Netlist_File: %s Netlist_ID: %s\n",
-            net_file,
-            net_id);
-    fprintf(fp, "Array size: %zu x %zu logic blocks\n\n", device_ctx.grid.width(), device_ctx.grid.height());
-    fprintf(fp, "#block name\tx\ty\tsubblk\tlayer\tblock number\n");
-    fprintf(fp, "#----------\t--\t--\t------\t-----\t------------\n");
+    out << "Netlist_File: " << net_file << " Netlist_ID: " << net_id << '\n';
+    out << "Array size: " << device_ctx.grid.width() << " x " << device_ctx.grid.height() << " logic blocks\n\n";
+    out << "#block name\tx\ty\tsubblk\tlayer\tblock number\n";
+    out << "#----------\t--\t--\t------\t-----\t------------\n";
 
     if (!place_ctx.block_locs.empty()) { //Only if placement exists
         for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
-            fprintf(fp, "%s\t", cluster_ctx.clb_nlist.block_name(blk_id).c_str());
-            if (strlen(cluster_ctx.clb_nlist.block_name(blk_id).c_str()) < 8)
-                fprintf(fp, "\t");
-
-            fprintf(fp, "%d\t%d\t%d\t%d",
-                    place_ctx.block_locs[blk_id].loc.x,
-                    place_ctx.block_locs[blk_id].loc.y,
-                    place_ctx.block_locs[blk_id].loc.sub_tile,
-                    place_ctx.block_locs[blk_id].loc.layer);
-            fprintf(fp, "\t#%zu\n", size_t(blk_id));
+            const std::string& block_name = cluster_ctx.clb_nlist.block_name(blk_id);
+            out << block_name << '\t';
+            if (block_name.size() < 8)
+                out << '\t';
+
+            const t_pl_loc& loc = place_ctx.block_locs[blk_id].loc;
+            out << loc.x << '\t' << loc.y << '\t' << loc.sub_tile << '\t' << loc.layer;
+            out << "\t#" << size_t(blk_id) << '\n';
+        }
+    }
+    out.close();
+
+    //Calculate the ID of the placement
+    place_ctx.placement_id = vtr::secure_digest_file(place_file);
+}
+
+/**
+ * @brief Reads a binary (.blob) placement file written by print_place()
+ *
+ * Blocks are stored by ClusterBlockId rather than by name, so no name look-ups are needed.
+ * The packed netlist and grid size are checked as for a text placement file, and the
+ * number of blocks must match the current clustered netlist.
+ */
+static void read_place_blob(const char* net_file,
+                            const char* place_file,
+                            bool verify_file_digests,
+                            const DeviceGrid& grid) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    VTR_LOG("Reading %s.\n", place_file);
+    VTR_LOG("\n");
+
+    std::vector<std::string> keys;
+    size_t grid_width = 0;
+    size_t grid_height = 0;
+    std::vector<t_place_blob_loc> locs;
+    try {
+        vtr::FlatBlobReader reader(place_file);
+        if (reader.num_sections() != PLACE_BLOB_NUM_SECTIONS) {
+            throw vtr::VtrError("Not a placement file", __FILE__, __LINE__);
         }
+
+        vtr::array_view<const int32_t> header = reader.array<int32_t>(PLACE_BLOB_HEADER);
+        if (header.size() != 1 || header[0] != PLACE_BLOB_VERSION) {
+            throw vtr::VtrError("Unsupported placement file version", __FILE__, __LINE__);
+        }
+
+        size_t isection = PLACE_BLOB_KEY_OFFSETS;
+        keys = read_flat_blob_string_sections(reader, isection);
+        vtr::array_view<const uint64_t> grid_size = reader.array<uint64_t>(PLACE_BLOB_GRID_SIZE);
+        if (keys.size() != PLACE_BLOB_NUM_KEYS || grid_size.size() != 2) {
+            throw vtr::VtrError("Invalid placement file header", __FILE__, __LINE__);
+        }
+        grid_width = grid_size[0];
+        grid_height = grid_size[1];
+
+        vtr::array_view<const t_place_blob_loc> blob_locs = reader.array<t_place_blob_loc>(PLACE_BLOB_BLOCK_LOCS);
+        locs.assign(blob_locs.begin(), blob_locs.end());
+    } catch (const vtr::VtrError& e) {
+        vpr_throw(VPR_ERROR_PLACE_F, place_file, 0, "Failed to read binary placement file: %s", e.what());
+    }
+
+    if (keys[PLACE_BLOB_NETLIST_ID] != cluster_ctx.clb_nlist.netlist_id()) {
+        auto msg = vtr::string_fmt(
+            "The packed netlist file that generated placement (File: '%s' ID: '%s')"
+            " does not match current netlist (File: '%s' ID: '%s')",
+            keys[PLACE_BLOB_NETLIST_FILE].c_str(), keys[PLACE_BLOB_NETLIST_ID].c_str(),
+            net_file, cluster_ctx.clb_nlist.netlist_id().c_str());
+        if (verify_file_digests) {
+            vpr_throw(VPR_ERROR_PLACE_F, place_file, 0, msg.c_str());
+        } else {
+            VTR_LOGF_WARN(place_file, 0, "%s\n", msg.c_str());
+        }
+    }
+
+    if (grid.width() != grid_width || grid.height() != grid_height) {
+        vpr_throw(VPR_ERROR_PLACE_F, place_file, 0,
+                  "Current FPGA size (%d x %d) is different from size when placement generated (%d x %d)",
+                  grid.width(), grid.height(), grid_width, grid_height);
+    }
+
+    //Block ids are only meaningful for the netlist the placement was written from
+    if (locs.size() != cluster_ctx.clb_nlist.blocks().size()) {
+        vpr_throw(VPR_ERROR_PLACE_F, place_file, 0,
+                  "Placement has %zu blocks, but the packed netlist has %zu blocks",
+                  locs.size(), cluster_ctx.clb_nlist.blocks().size());
+    }
+
+    for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+        const t_place_blob_loc& loc = locs[size_t(blk_id)];
+        set_block_location(blk_id, t_pl_loc(loc.x, loc.y, loc.sub_tile, loc.layer));
+    }
+
+    place_ctx.placement_id = vtr::secure_digest_file(place_file);
+
+    VTR_LOG("Successfully read %s.\n", place_file);
+    VTR_LOG("\n");
+}
+
+///@brief Writes the placement as a binary (.blob) placement file (see read_place_blob())
+static void print_place_blob(const char* net_file,
+                             const char* net_id,
+                             const char* place_file) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    std::vector<std::string> keys(PLACE_BLOB_NUM_KEYS);
+    keys[PLACE_BLOB_NETLIST_FILE] = net_file ? net_file : "";
+    keys[PLACE_BLOB_NETLIST_ID] = net_id ? net_id : "";
+
+    std::vector<t_place_blob_loc> locs;
+    if (!place_ctx.block_locs.empty()) { //Only if placement exists
+        locs.reserve(cluster_ctx.clb_nlist.blocks().size());
+        for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+            const t_pl_loc& loc = place_ctx.block_locs[blk_id].loc;
+            locs.push_back({loc.x, loc.y, loc.sub_tile, loc.layer});
+        }
+    }
+
+    vtr::FlatBlobWriter writer;
+    writer.add_array(std::vector<int32_t>{PLACE_BLOB_VERSION});
+    add_flat_blob_string_sections(writer, keys);
+    writer.add_array(std::vector<uint64_t>{device_ctx.grid.width(), device_ctx.grid.height()});
+    writer.add_array(locs);
+    VTR_ASSERT(writer.num_sections() == PLACE_BLOB_NUM_SECTIONS);
+    try {
+        writer.write(place_file);
+    } catch (const vtr::VtrError& e) {
+        vpr_throw(VPR_ERROR_PLACE_F, place_file, 0, "Failed to write binary placement file: %s", e.what());
     }
-    fclose(fp);
 
     //Calculate the ID of the placement
     place_ctx.placement_id = vtr::secure_digest_file(place_file);
@@ -1,6 +1,9 @@
 #ifndef READ_PLACE_H
 #define READ_PLACE_H
 
+#include "vtr_vector_map.h"
+#include "vpr_types.h"
+
 /**
  * This function is for reading a place file when placement is skipped.
  * It takes in the current netlist file and grid dimensions to check that they match those that were used when placement was generated.
@@ -17,6 +20,18 @@ void read_place(
  */
 void read_constraints(const char* constraints_file);
 
+/**
+ * @brief Reads the block locations of a previous placement, for an ECO (incremental) placement
+ *
+ * Blocks are matched by name, so the placement may come from an earlier version of the current netlist:
+ * blocks missing from the current netlist are skipped, and the current blocks missing from the file are
+ * left at an invalid (OPEN) location. The grid size must not have changed. Only text placement files
+ * are supported, since binary ones identify blocks by id.
+ */
+vtr::vector_map<ClusterBlockId, t_pl_loc> read_eco_place(const char* net_file,
+                                                         const char* place_file,
+                                                         const DeviceGrid& grid);
+
 void print_place(const char* net_file,
                  const char* net_id,
                  const char* place_file);
@@ -11,8 +11,12 @@
  * in (x,y) format. Appropriate error messages are displayed when
  * formats are incorrect or when the routing file does not match
  * other file's information
+ *
+ * Routings can also be saved to (and loaded from) binary .blob files, which store
+ * the RR node ids of each net's routing directly (see read_route_blob()).
  */
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <cstdio>
@@ -20,13 +24,16 @@
 #include <ctime>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "atom_netlist.h"
 #include "atom_netlist_utils.h"
 #include "rr_graph.h"
 #include "vtr_assert.h"
 #include "vtr_digest.h"
+#include "vtr_flat_blob.h"
 #include "vtr_util.h"
 #include "tatum/echo_writer.hpp"
 #include "vtr_log.h"
@@ -47,9 +54,48 @@
 #include "route_tree.h"
 #include "read_route.h"
 #include "binary_heap.h"
+#include "netlist_utils.h"
+#include "buffered_file_writer.h"
 
 #include "old_traceback.h"
 
+///@brief Bumped whenever the layout of a binary routing file changes
+constexpr int32_t ROUTE_BLOB_VERSION = 1;
+
+///@brief The sections of a binary (.blob) routing file, in file order
+enum e_route_blob_section {
+    ROUTE_BLOB_HEADER = 0,  ///<int32_t: version, and whether the routing is flat
+    ROUTE_BLOB_KEY_OFFSETS, ///<uint64_t: offset of each key string (see e_route_blob_key)
+    ROUTE_BLOB_KEY_CHARS,   ///<char: the key strings
+    ROUTE_BLOB_GRID_SIZE,   ///<uint64_t: width and height of the device grid
+    ROUTE_BLOB_NET_TYPES,   ///<int8_t: e_route_blob_net_type of each net, indexed by net id
+    ROUTE_BLOB_NET_OFFSETS, ///<uint64_t: offset of each net's first trace element in TRACES (one more than the number of nets)
+    ROUTE_BLOB_TRACES,      ///<t_route_blob_trace: the traceback of each routed net
+    ROUTE_BLOB_NUM_SECTIONS
+};
+
+///@brief The strings identifying what a binary routing file was written for
+enum e_route_blob_key {
+    ROUTE_BLOB_PLACEMENT_FILE = 0, ///<Placement file
+    ROUTE_BLOB_PLACEMENT_ID,       ///<Placement id (digest of the placement file)
+    ROUTE_BLOB_NETLIST_ID,         ///<Id of the netlist which was routed
+    ROUTE_BLOB_RR_GRAPH_ID,        ///<Digest of the RR graph (see rr_graph_digest())
+    ROUTE_BLOB_NUM_KEYS
+};
+
+///@brief How a net is stored in a binary routing file
+enum e_route_blob_net_type : int8_t {
+    ROUTE_BLOB_ROUTED_NET = 0, ///<Routed (or unrouted, if it has an empty traceback)
+    ROUTE_BLOB_GLOBAL_NET      ///<Global (ignored) net, which is never routed
+};
+
+///@brief An element of a net's traceback, as stored in a binary routing file
+struct t_route_blob_trace {
+    int32_t node;
+    int32_t iswitch;
+    int32_t net_pin_index;
+};
+
 /*************Functions local to this module*************/
 static void process_route(const Netlist<>& net_list, std::ifstream& fp, const char* filename, int& lineno, bool is_flat);
 static void process_nodes(const Netlist<>& net_list, std::ifstream& fp, ClusterNetId inet, const char* filename, int& lineno);
@@ -59,7 +105,20 @@ static void format_coordinates(int& layer_num, int& x, int& y, std::string coord
 static void format_pin_info(std::string& pb_name, std::string& port_name, int& pb_pin_num, std::string input);
 static std::string format_name(std::string name);
 static bool check_rr_graph_connectivity(RRNodeId prev_node, RRNodeId node);
-void print_route(const Netlist<>& net_list, FILE* fp, bool is_flat);
+static const Netlist<>& init_read_route_structs(const t_router_opts& router_opts);
+static bool finish_read_route(const Netlist<>& router_net_list, const t_router_opts& router_opts);
+static std::string rr_graph_digest(const RRGraphView& rr_graph);
+static bool read_route_blob(const char* route_file, const t_router_opts& router_opts, bool verify_file_digests, bool is_flat);
+static void print_route_blob(const Netlist<>& net_list, const char* placement_file, const char* route_file, bool is_flat);
+static void print_route(const Netlist<>& net_list, BufferedFileWriter& out, bool is_flat);
+
+///@brief A node of the routing of a net read from a previous .route file, see read_eco_route()
+struct t_eco_route_node {
+    RRNodeId node;
+    int iswitch;
+};
+
+static bool load_eco_net_route(const Netlist<>& net_list, ParentNetId net_id, const std::vector<t_eco_route_node>& nodes);
 
 /*************Global Functions****************************/
 
@@ -70,9 +129,12 @@ void print_route(const Netlist<>& net_list, FILE* fp, bool is_flat);
  * placement, and routing files match
  */
 bool read_route(const char* route_file, const t_router_opts& router_opts, bool verify_file_digests, bool is_flat) {
+    if (vtr::check_file_name_extension(route_file, ".blob")) {
+        return read_route_blob(route_file, router_opts, verify_file_digests, is_flat);
+    }
+
     auto& device_ctx = g_vpr_ctx.mutable_device();
     auto& place_ctx = g_vpr_ctx.placement();
-    bool flat_router = router_opts.flat_routing;
     /* Begin parsing the file */
     VTR_LOG("Begin loading FPGA routing file.\n");
 
@@ -105,12 +167,7 @@ bool read_route(const char* route_file, const t_router_opts& router_opts, bool v
     }
 
     /*Allocate necessary routing structures*/
-    alloc_and_load_rr_node_route_structs();
-    const Netlist<>& router_net_list = (flat_router) ? (const Netlist<>&)g_vpr_ctx.atom().nlist : (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
-    init_route_structs(router_net_list,
-                       router_opts.bb_factor,
-                       router_opts.has_choking_spot,
-                       flat_router);
+    const Netlist<>& router_net_list = init_read_route_structs(router_opts);
 
     /*Check dimensions*/
     std::getline(fp, header_str);
@@ -128,6 +185,194 @@ bool read_route(const char* route_file, const t_router_opts& router_opts, bool v
 
     fp.close();
 
+    return finish_read_route(router_net_list, router_opts);
+}
+
+size_t read_eco_route(const char* route_file, const Netlist<>& net_list) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+
+    if (vtr::check_file_name_extension(route_file, ".blob")) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                        "'%s' - ECO routing requires a text routing file (binary routing files do not record net names).\n",
+                        route_file);
+    }
+
+    std::ifstream fp(route_file);
+    if (!fp.is_open()) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                  "Cannot open %s routing file", route_file);
+    }
+
+    size_t num_prev_nets = 0;
+    size_t num_kept_nets = 0;
+
+    //The net being read, and its nodes so far (cleared once it can not be kept)
+    ParentNetId net_id = ParentNetId::INVALID();
+    std::vector<t_eco_route_node> nodes;
+
+    auto finish_net = [&]() {
+        if (net_id && !nodes.empty() && load_eco_net_route(net_list, net_id, nodes)) {
+            ++num_kept_nets;
+        }
+        net_id = ParentNetId::INVALID();
+        nodes.clear();
+    };
+
+    std::string input;
+    while (std::getline(fp, input)) {
+        std::vector<std::string> tokens = vtr::split(input);
+        if (tokens.empty() || tokens[0][0] == '#') {
+            continue;
+        }
+
+        if (tokens[0] == "Net" && tokens.size() >= 3) {
+            finish_net();
+            ++num_prev_nets;
+
+            if (tokens.size() > 3 && tokens[3] == "global") {
+                continue; //Global nets are never routed
+            }
+
+            net_id = net_list.find_net(format_name(tokens[2]));
+            if (net_id && (net_list.net_is_ignored(net_id) || g_vpr_ctx.routing().route_trees[net_id])) {
+                net_id = ParentNetId::INVALID();
+            }
+
+        } else if (tokens[0] == "Node:" && net_id && tokens.size() >= 3) {
+            //Only the RR node, its type and the switch to the next node are needed: the RR graph
+            //checks of load_eco_net_route() cover the coordinates, ptcs and pins
+            int inode = vtr::atoi(tokens[1]);
+            if (inode < 0 || size_t(inode) >= rr_graph.num_nodes() || tokens[2] != rr_graph.node_type_string(RRNodeId(inode))) {
+                net_id = ParentNetId::INVALID(); //Not the same RR graph, can not be kept
+                continue;
+            }
+
+            auto switch_token = std::find(tokens.begin(), tokens.end(), "Switch:");
+            if (switch_token == tokens.end() || switch_token + 1 == tokens.end()) {
+                net_id = ParentNetId::INVALID();
+                continue;
+            }
+
+            nodes.push_back({RRNodeId(inode), vtr::atoi(*(switch_token + 1))});
+        }
+    }
+    finish_net();
+
+    VTR_LOG("ECO routing: kept the routing of %zu of the %zu nets of %s\n",
+            num_kept_nets, num_prev_nets, route_file);
+
+    return num_kept_nets;
+}
+
+/**
+ * @brief Checks that the (traceback order) nodes of a previous routing are a legal routing of net_id,
+ *        and if so loads it as the route tree of net_id and adds its occupancy
+ *
+ * The net pin indices of the SINKs are re-assigned from the current net, since they can change with the netlist.
+ * Returns true if the routing was loaded.
+ */
+static bool load_eco_net_route(const Netlist<>& net_list, ParentNetId net_id, const std::vector<t_eco_route_node>& nodes) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    const auto& terminals = route_ctx.net_rr_terminals[net_id];
+    if (nodes[0].node != RRNodeId(terminals[0])) {
+        return false; //The net is driven from elsewhere
+    }
+
+    //The net pins still to be reached at each SINK (a SINK may be reached once per pin of a net sharing it)
+    std::unordered_map<RRNodeId, std::vector<int>> sink_net_pins;
+    for (size_t ipin = net_list.net_pins(net_id).size() - 1; ipin > 0; --ipin) {
+        sink_net_pins[RRNodeId(terminals[ipin])].push_back(ipin);
+    }
+
+    std::vector<int> net_pin_indices(nodes.size(), OPEN);
+    std::unordered_set<RRNodeId> seen_nodes{nodes[0].node};
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        RRNodeId prev_node = nodes[i - 1].node;
+        RRNodeId node = nodes[i].node;
+
+        if (rr_graph.node_type(prev_node) == SINK) {
+            //A new branch, from a node of the routing so far
+            if (!seen_nodes.count(node)) {
+                return false;
+            }
+            continue;
+        }
+
+        bool edge_exists = false;
+        for (RREdgeId edge : rr_graph.edge_range(prev_node)) {
+            if (rr_graph.rr_nodes().edge_sink_node(edge) == node && rr_graph.rr_nodes().edge_switch(edge) == nodes[i - 1].iswitch) {
+                edge_exists = true;
+                break;
+            }
+        }
+        //Only SINKs may be reached more than once (by the different net pins sharing them)
+        if (!edge_exists || (!seen_nodes.insert(node).second && rr_graph.node_type(node) != SINK)) {
+            return false;
+        }
+
+        if (rr_graph.node_type(node) == SINK) {
+            auto pins = sink_net_pins.find(node);
+            if (pins == sink_net_pins.end() || pins->second.empty()) {
+                return false; //No longer a sink of the net (or reached more often than the net has pins there)
+            }
+            net_pin_indices[i] = pins->second.back();
+            pins->second.pop_back();
+        }
+    }
+
+    //The routing must end at a SINK and reach all the sinks of the current net
+    if (rr_graph.node_type(nodes.back().node) != SINK) {
+        return false;
+    }
+    for (const auto& pins : sink_net_pins) {
+        if (!pins.second.empty()) {
+            return false;
+        }
+    }
+
+    t_trace* head_ptr = nullptr;
+    t_trace* tptr = nullptr;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        t_trace* trace = alloc_trace_data();
+        trace->index = size_t(nodes[i].node);
+        trace->net_pin_index = net_pin_indices[i];
+        trace->iswitch = nodes[i].iswitch;
+        trace->next = nullptr;
+        if (tptr) {
+            tptr->next = trace;
+        } else {
+            head_ptr = trace;
+        }
+        tptr = trace;
+    }
+
+    route_ctx.route_trees[net_id] = TracebackCompat::traceback_to_route_tree(head_ptr, net_id);
+    free_traceback(head_ptr);
+
+    pathfinder_update_cost_from_route_tree(route_ctx.route_trees[net_id]->root(), 1);
+    return true;
+}
+
+///@brief Allocates the routing structures filled in by read_route(), returning the netlist being routed
+static const Netlist<>& init_read_route_structs(const t_router_opts& router_opts) {
+    bool flat_router = router_opts.flat_routing;
+
+    alloc_and_load_rr_node_route_structs();
+    const Netlist<>& router_net_list = (flat_router) ? (const Netlist<>&)g_vpr_ctx.atom().nlist : (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
+    init_route_structs(router_net_list,
+                       router_opts.bb_factor,
+                       router_opts.has_choking_spot,
+                       flat_router);
+    return router_net_list;
+}
+
+///@brief Re-computes the routing occupancy once the route trees are loaded, returning true if the routing is feasible
+static bool finish_read_route(const Netlist<>& router_net_list, const t_router_opts& router_opts) {
+    auto& device_ctx = g_vpr_ctx.device();
+    bool flat_router = router_opts.flat_routing;
+
     /*Correctly set up the clb opins*/
     BinaryHeap small_heap;
     small_heap.init_heap(device_ctx.grid);
@@ -566,9 +811,9 @@ static bool check_rr_graph_connectivity(RRNodeId prev_node, RRNodeId node) {
     return false;
 }
 
-void print_route(const Netlist<>& net_list,
-                 FILE* fp,
-                 bool is_flat) {
+static void print_route(const Netlist<>& net_list,
+                        BufferedFileWriter& out,
+                        bool is_flat) {
     auto& place_ctx = g_vpr_ctx.placement();
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
@@ -579,9 +824,9 @@ void print_route(const Netlist<>& net_list,
 
     for (auto net_id : net_list.nets()) {
         if (!net_list.net_is_ignored(net_id)) {
-            fprintf(fp, "\n\nNet %zu (%s)\n\n", size_t(net_id), net_list.net_name(net_id).c_str());
+            out << "\n\nNet " << size_t(net_id) << " (" << net_list.net_name(net_id) << ")\n\n";
             if (net_list.net_sinks(net_id).size() == false) {
-                fprintf(fp, "\n\nUsed in local cluster only, reserved one CLB pin\n\n");
+                out << "\n\nUsed in local cluster only, reserved one CLB pin\n\n";
             } else {
                 if (!route_ctx.route_trees[net_id])
                     continue;
@@ -596,35 +841,35 @@ void print_route(const Netlist<>& net_list,
                     int jlow = rr_graph.node_ylow(inode);
                     int layer_num = rr_graph.node_layer(inode);
 
-                    fprintf(fp, "Node:\t%zu\t%6s (%d,%d,%d) ", size_t(inode),
-                            rr_graph.node_type_string(inode), layer_num, ilow, jlow);
+                    out << "Node:\t" << size_t(inode) << '\t';
+                    out.write_right_aligned(rr_graph.node_type_string(inode), 6);
+                    out << " (" << layer_num << ',' << ilow << ',' << jlow << ") ";
 
                     if ((ilow != rr_graph.node_xhigh(inode))
                         || (jlow != rr_graph.node_yhigh(inode)))
-                        fprintf(fp, "to (%d,%d) ", rr_graph.node_xhigh(inode),
-                                rr_graph.node_yhigh(inode));
+                        out << "to (" << rr_graph.node_xhigh(inode) << ',' << rr_graph.node_yhigh(inode) << ") ";
 
                     switch (rr_type) {
                         case IPIN:
                         case OPIN:
                             if (is_io_type(device_ctx.grid.get_physical_type({ilow, jlow, layer_num}))) {
-                                fprintf(fp, " Pad: ");
+                                out << " Pad: ";
                             } else { /* IO Pad. */
-                                fprintf(fp, " Pin: ");
+                                out << " Pin: ";
                             }
                             break;
 
                         case CHANX:
                         case CHANY:
-                            fprintf(fp, " Track: ");
+                            out << " Track: ";
                             break;
 
                         case SOURCE:
                         case SINK:
                             if (is_io_type(device_ctx.grid.get_physical_type({ilow, jlow, layer_num}))) {
-                                fprintf(fp, " Pad: ");
+                                out << " Pad: ";
                             } else { /* IO Pad. */
-                                fprintf(fp, " Class: ");
+                                out << " Class: ";
                             }
                             break;
 
@@ -635,7 +880,7 @@ void print_route(const Netlist<>& net_list,
                             break;
                     }
 
-                    fprintf(fp, "%d  ", rr_graph.node_ptc_num(inode));
+                    out << rr_graph.node_ptc_num(inode) << "  ";
 
                     auto physical_tile = device_ctx.grid.get_physical_type({ilow, jlow, layer_num});
                     if (!is_io_type(physical_tile) && (rr_type == IPIN || rr_type == OPIN)) {
@@ -657,19 +902,19 @@ void print_route(const Netlist<>& net_list,
                             pb_pin = get_pb_pin_from_pin_physical_num(physical_tile, pin_num);
                         }
                         const t_pb_type* pb_type = pb_pin->parent_node->pb_type;
-                        fprintf(fp, " %s.%s[%d] ", pb_type->name, pb_pin->port->name, pb_pin->pin_number);
+                        out << ' ' << pb_type->name << '.' << pb_pin->port->name << '[' << pb_pin->pin_number << "] ";
                     }
 
                     /* Uncomment line below if you're debugging and want to see the switch types *
                      * used in the routing.                                                      */
-                    fprintf(fp, "Switch: %d", int(tptr->iswitch));
+                    out << "Switch: " << int(tptr->iswitch);
 
                     //Save net pin index for sinks
                     if (rr_type == SINK) {
-                        fprintf(fp, " Net_pin_index: %d", tptr->net_pin_index);
+                        out << " Net_pin_index: " << tptr->net_pin_index;
                     }
 
-                    fprintf(fp, "\n");
+                    out << '\n';
 
                     tptr = tptr->next;
                 }
@@ -677,20 +922,15 @@ void print_route(const Netlist<>& net_list,
                 free_traceback(head);
             }
         } else { /* Global net.  Never routed. */
-            fprintf(fp, "\n\nNet %zu (%s): global net connecting:\n\n", size_t(net_id),
-                    net_list.net_name(net_id).c_str());
+            out << "\n\nNet " << size_t(net_id) << " (" << net_list.net_name(net_id) << "): global net connecting:\n\n";
 
             for (auto pin_id : net_list.net_pins(net_id)) {
                 ParentBlockId block_id = net_list.pin_block(pin_id);
                 int iclass = get_block_pin_class_num(block_id, pin_id, is_flat);
                 t_block_loc blk_loc;
                 blk_loc = get_block_loc(block_id, is_flat);
-                fprintf(fp, "Block %s (#%zu) at (%d,%d), Pin class %d.\n",
-                        net_list.block_name(block_id).c_str(),
-                        size_t(block_id),
-                        blk_loc.loc.x,
-                        blk_loc.loc.y,
-                        iclass);
+                out << "Block " << net_list.block_name(block_id) << " (#" << size_t(block_id) << ") at ("
+                    << blk_loc.loc.x << ',' << blk_loc.loc.y << "), Pin class " << iclass << ".\n";
             }
         }
     }
@@ -701,22 +941,243 @@ void print_route(const Netlist<>& net_list,
                  const char* placement_file,
                  const char* route_file,
                  bool is_flat) {
-    FILE* fp;
-
-    fp = fopen(route_file, "w");
+    if (vtr::check_file_name_extension(route_file, ".blob")) {
+        print_route_blob(net_list, placement_file, route_file, is_flat);
+        return;
+    }
 
     auto& place_ctx = g_vpr_ctx.placement();
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    fprintf(fp, "Placement_File: %s Placement_ID: %s\n", placement_file, place_ctx.placement_id.c_str());
+    BufferedFileWriter out(route_file, VPR_ERROR_ROUTE);
+
+    out << "Placement_File: " << placement_file << " Placement_ID: " << place_ctx.placement_id << '\n';
+
+    out << "Array size: " << device_ctx.grid.width() << " x " << device_ctx.grid.height() << " logic blocks.\n";
+    out << "\nRouting:";
 
-    fprintf(fp, "Array size: %zu x %zu logic blocks.\n", device_ctx.grid.width(), device_ctx.grid.height());
-    fprintf(fp, "\nRouting:");
+    print_route(net_list, out, is_flat);
 
-    print_route(net_list, fp, is_flat);
+    out.close();
 
-    fclose(fp);
+    //Save the digest of the route file
+    route_ctx.routing_id = vtr::secure_digest_file(route_file);
+}
+
+/**
+ * @brief Returns a digest identifying the RR graph's nodes
+ *
+ * Binary routing files refer to RR nodes by id, so they may only be loaded with an RR graph
+ * whose nodes (type, coordinates, ptc and layer) are identical to those the routing was
+ * written with. The edges are represented only by their count, since hashing them would
+ * cost as much as the text parsing the binary format avoids.
+ */
+static std::string rr_graph_digest(const RRGraphView& rr_graph) {
+    //The node fields are copied out, as the padding of the node storage is not initialized
+    std::vector<int16_t> nodes;
+    nodes.reserve(7 * rr_graph.num_nodes());
+    for (size_t i = 0; i < rr_graph.num_nodes(); ++i) {
+        RRNodeId inode = RRNodeId(i);
+        nodes.push_back(rr_graph.node_type(inode));
+        nodes.push_back(rr_graph.node_xlow(inode));
+        nodes.push_back(rr_graph.node_ylow(inode));
+        nodes.push_back(rr_graph.node_xhigh(inode));
+        nodes.push_back(rr_graph.node_yhigh(inode));
+        nodes.push_back(rr_graph.node_ptc_num(inode));
+        nodes.push_back(rr_graph.node_layer(inode));
+    }
+    std::string num_edges = std::to_string(rr_graph.rr_nodes().edge_src_node_data().size());
+
+    return vtr::secure_digest_buffers({vtr::array_view<const char>(reinterpret_cast<const char*>(nodes.data()), nodes.size() * sizeof(int16_t)),
+                                       vtr::array_view<const char>(num_edges.data(), num_edges.size())});
+}
+
+/**
+ * @brief Reads a binary (.blob) routing file written by print_route()
+ *
+ * The routing of each net is stored as its traceback of RR node ids, so nothing needs
+ * to be parsed or looked-up by name. As those ids are only meaningful for the netlist and
+ * RR graph the routing was written with, loading fails unless their digests match. The
+ * placement is checked as for a text routing file.
+ */
+static bool read_route_blob(const char* route_file, const t_router_opts& router_opts, bool verify_file_digests, bool is_flat) {
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    VTR_LOG("Begin loading FPGA routing file.\n");
+
+    const Netlist<>& router_net_list = init_read_route_structs(router_opts);
+
+    try {
+        vtr::FlatBlobReader reader(route_file);
+        if (reader.num_sections() != ROUTE_BLOB_NUM_SECTIONS) {
+            throw vtr::VtrError("Not a routing file", __FILE__, __LINE__);
+        }
+
+        vtr::array_view<const int32_t> header = reader.array<int32_t>(ROUTE_BLOB_HEADER);
+        if (header.size() != 2 || header[0] != ROUTE_BLOB_VERSION) {
+            throw vtr::VtrError("Unsupported routing file version", __FILE__, __LINE__);
+        }
+
+        size_t isection = ROUTE_BLOB_KEY_OFFSETS;
+        std::vector<std::string> keys = read_flat_blob_string_sections(reader, isection);
+        vtr::array_view<const uint64_t> grid_size = reader.array<uint64_t>(ROUTE_BLOB_GRID_SIZE);
+        if (keys.size() != ROUTE_BLOB_NUM_KEYS || grid_size.size() != 2) {
+            throw vtr::VtrError("Invalid routing file header", __FILE__, __LINE__);
+        }
+
+        if (keys[ROUTE_BLOB_PLACEMENT_ID] != place_ctx.placement_id) {
+            auto msg = vtr::string_fmt(
+                "Placement file %s specified in the routing file"
+                " does not match the loaded placement (ID %s != %s)",
+                keys[ROUTE_BLOB_PLACEMENT_FILE].c_str(), keys[ROUTE_BLOB_PLACEMENT_ID].c_str(), place_ctx.placement_id.c_str());
+            if (verify_file_digests) {
+                vpr_throw(VPR_ERROR_ROUTE, route_file, 0, msg.c_str());
+            } else {
+                VTR_LOGF_WARN(route_file, 0, "%s\n", msg.c_str());
+            }
+        }
+
+        if (grid_size[0] != device_ctx.grid.width() || grid_size[1] != device_ctx.grid.height()) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                      "Device dimensions %zux%zu specified in the routing file does not match given %zux%zu",
+                      size_t(grid_size[0]), size_t(grid_size[1]), device_ctx.grid.width(), device_ctx.grid.height());
+        }
+
+        if (bool(header[1]) != is_flat) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                      "The routing file was written %s flat routing; re-run vpr %s the --flat_routing option",
+                      header[1] ? "with" : "without", header[1] ? "with" : "without");
+        }
+
+        vtr::array_view<const int8_t> net_types = reader.array<int8_t>(ROUTE_BLOB_NET_TYPES);
+        vtr::array_view<const uint64_t> net_offsets = reader.array<uint64_t>(ROUTE_BLOB_NET_OFFSETS);
+        vtr::array_view<const t_route_blob_trace> traces = reader.array<t_route_blob_trace>(ROUTE_BLOB_TRACES);
+        if (keys[ROUTE_BLOB_NETLIST_ID] != router_net_list.netlist_id()
+            || net_types.size() != router_net_list.nets().size()) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                      "The routing file was written for a different netlist (ID %s != %s)",
+                      keys[ROUTE_BLOB_NETLIST_ID].c_str(), router_net_list.netlist_id().c_str());
+        }
+        if (keys[ROUTE_BLOB_RR_GRAPH_ID] != rr_graph_digest(rr_graph)) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                      "The routing file was written for a different routing resource graph");
+        }
+        if (net_offsets.size() != net_types.size() + 1 || net_offsets[net_types.size()] != traces.size()) {
+            throw vtr::VtrError("Inconsistent net offsets", __FILE__, __LINE__);
+        }
+
+        size_t num_nodes = rr_graph.num_nodes();
+        size_t num_switches = rr_graph.num_rr_switches();
+        for (ParentNetId net_id : router_net_list.nets()) {
+            size_t inet = size_t(net_id);
+            if (net_types[inet] == ROUTE_BLOB_GLOBAL_NET) {
+                if (!router_net_list.net_is_ignored(net_id)) {
+                    vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                              "Net %zu should be a global net", inet);
+                }
+                continue;
+            }
+            if (router_net_list.net_is_ignored(net_id)) {
+                VTR_LOG_WARN("Net %zu (%s) is marked as global in the netlist, but is non-global in the .route file\n", inet, router_net_list.net_name(net_id).c_str());
+            }
+
+            //Rebuild the traceback, which is then converted to a route tree (as for text routing files)
+            t_trace* head_ptr = nullptr;
+            t_trace* tptr = nullptr;
+            for (size_t itrace = net_offsets[inet]; itrace < net_offsets[inet + 1]; ++itrace) {
+                const t_route_blob_trace& trace = traces[itrace];
+                if (trace.node < 0 || size_t(trace.node) >= num_nodes
+                    || trace.iswitch < OPEN || trace.iswitch >= int32_t(num_switches)) {
+                    free_traceback(head_ptr);
+                    vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                              "Net %zu has an invalid RR node or switch in the routing file", inet);
+                }
+
+                t_trace* new_trace = alloc_trace_data();
+                new_trace->index = trace.node;
+                new_trace->net_pin_index = trace.net_pin_index;
+                new_trace->iswitch = trace.iswitch;
+                new_trace->next = nullptr;
+                if (tptr) {
+                    tptr->next = new_trace;
+                } else {
+                    head_ptr = new_trace;
+                }
+                tptr = new_trace;
+            }
+
+            if (head_ptr && rr_graph.node_type(RRNodeId(head_ptr->index)) != SOURCE) {
+                free_traceback(head_ptr);
+                vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                          "First node in routing of net %zu has to be a source type", inet);
+            }
+
+            VTR_ASSERT(validate_traceback(head_ptr));
+            route_ctx.route_trees[net_id] = TracebackCompat::traceback_to_route_tree(head_ptr);
+            free_traceback(head_ptr);
+        }
+    } catch (const vtr::VtrError& e) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0, "Failed to read binary routing file: %s", e.what());
+    }
+
+    return finish_read_route(router_net_list, router_opts);
+}
+
+///@brief Writes the routing as a binary (.blob) routing file (see read_route_blob())
+static void print_route_blob(const Netlist<>& net_list,
+                             const char* placement_file,
+                             const char* route_file,
+                             bool is_flat) {
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    std::vector<std::string> keys(ROUTE_BLOB_NUM_KEYS);
+    keys[ROUTE_BLOB_PLACEMENT_FILE] = placement_file ? placement_file : "";
+    keys[ROUTE_BLOB_PLACEMENT_ID] = place_ctx.placement_id;
+    keys[ROUTE_BLOB_NETLIST_ID] = net_list.netlist_id();
+    keys[ROUTE_BLOB_RR_GRAPH_ID] = rr_graph_digest(device_ctx.rr_graph);
+
+    std::vector<int8_t> net_types;
+    std::vector<uint64_t> net_offsets = {0};
+    std::vector<t_route_blob_trace> traces;
+    net_types.reserve(net_list.nets().size());
+    net_offsets.reserve(net_list.nets().size() + 1);
+    for (ParentNetId net_id : net_list.nets()) {
+        if (net_list.net_is_ignored(net_id)) {
+            net_types.push_back(ROUTE_BLOB_GLOBAL_NET);
+        } else {
+            net_types.push_back(ROUTE_BLOB_ROUTED_NET);
+
+            //Nets used in their cluster only (without sinks) have no routing, as in text routing files
+            if (!route_ctx.route_trees.empty() && net_list.net_sinks(net_id).size() != 0 && route_ctx.route_trees[net_id]) {
+                t_trace* head = TracebackCompat::traceback_from_route_tree(route_ctx.route_trees[net_id].value());
+                for (const t_trace* tptr = head; tptr != nullptr; tptr = tptr->next) {
+                    traces.push_back({tptr->index, tptr->iswitch, tptr->net_pin_index});
+                }
+                free_traceback(head);
+            }
+        }
+        net_offsets.push_back(traces.size());
+    }
+
+    vtr::FlatBlobWriter writer;
+    writer.add_array(std::vector<int32_t>{ROUTE_BLOB_VERSION, is_flat});
+    add_flat_blob_string_sections(writer, keys);
+    writer.add_array(std::vector<uint64_t>{device_ctx.grid.width(), device_ctx.grid.height()});
+    writer.add_array(net_types);
+    writer.add_array(net_offsets);
+    writer.add_array(traces);
+    VTR_ASSERT(writer.num_sections() == ROUTE_BLOB_NUM_SECTIONS);
+    try {
+        writer.write(route_file);
+    } catch (const vtr::VtrError& e) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0, "Failed to write binary routing file: %s", e.what());
+    }
 
     //Save the digest of the route file
     route_ctx.routing_id = vtr::secure_digest_file(route_file);
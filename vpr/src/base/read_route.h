@@ -14,4 +14,15 @@
 bool read_route(const char* route_file, const t_router_opts& RouterOpts, bool verify_file_digests, bool is_flat);
 void print_route(const Netlist<>& net_list, const char* placement_file, const char* route_file, bool is_flat);
 
+/**
+ * @brief Loads the routing of a previous (text) .route file as the starting point of an ECO (incremental) routing
+ *
+ * Nets are matched by name. A previous net routing is kept only if it is still a legal
+ * routing of the current net: the same SOURCE and SINK RR nodes, and RR nodes and switches which
+ * exist in the current RR graph. Its route tree is loaded and its occupancy added, so the router
+ * only routes the other nets (and those congested by them). The route structures must have been
+ * initialized (init_route_structs()). Returns the number of nets whose routing was kept.
+ */
+size_t read_eco_route(const char* route_file, const Netlist<>& net_list);
+
 #endif /* READ_ROUTE_H */
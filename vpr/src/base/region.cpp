@@ -36,13 +36,13 @@ void Region::set_sub_tile(int _sub_tile) {
     sub_tile = _sub_tile;
 }
 
-bool Region::empty() {
+bool Region::empty() const {
     return (region_bounds.xmax() < region_bounds.xmin()
             || region_bounds.ymax() < region_bounds.ymin()
             || layer_num < 0);
 }
 
-bool Region::is_loc_in_reg(t_pl_loc loc) {
+bool Region::is_loc_in_reg(const t_pl_loc& loc) const {
     bool is_loc_in_reg = false;
     int loc_layer_num = loc.layer;
 
@@ -96,7 +96,7 @@ class Region {
      * @brief Return whether the region is empty (i. e. the region bounds rectangle
      * covers no area)
      */
-    bool empty();
+    bool empty() const;
 
     /**
      * @brief Check if the location is in the region (at a valid x, y, subtile location within the region bounds, inclusive)
@@ -105,7 +105,7 @@ class Region {
      *
      *   @param loc     The location to be checked
      */
-    bool is_loc_in_reg(t_pl_loc loc);
+    bool is_loc_in_reg(const t_pl_loc& loc) const;
 
     bool operator==(const Region& reg) const {
         return (reg.get_region_rect() == this->get_region_rect()
@@ -0,0 +1,312 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vtr_log.h"
+#include "vtr_random.h"
+#include "vtr_time.h"
+
+#include "tatum/error.hpp"
+
+#include "seed_sweep.h"
+#include "vpr_api.h"
+#include "vpr_error.h"
+#include "vpr_exit_codes.h"
+#include "vpr_tatum_error.h"
+#include "vpr_utils.h"
+#include "globals.h"
+#include "place_and_route.h"
+#include "place_delay_model.h"
+#include "stats.h"
+#include "net_delay.h"
+#include "AnalysisDelayCalculator.h"
+#include "concrete_timing_info.h"
+#include "async_file_writer.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <sys/wait.h>
+#    include <unistd.h>
+#    define VPR_SEED_SWEEP_SUPPORTED
+#endif
+
+#ifdef VPR_USE_TBB
+#    include <tbb/global_control.h>
+#endif
+
+#ifdef VPR_SEED_SWEEP_SUPPORTED
+
+namespace {
+
+///@brief The result of a seed, sent by its process through a pipe
+struct t_seed_result {
+    int seed = 0;
+    bool routed = false;
+    int chan_width = 0;
+    double cpd = std::numeric_limits<double>::quiet_NaN(); ///<Post-routing critical path delay (NaN without timing analysis)
+    double wirelength = 0.;
+};
+
+///@brief A forked seed process
+struct t_seed_process {
+    int seed = 0;
+    pid_t pid = -1;
+    int result_fd = -1; ///<Read end of the result pipe
+};
+
+///@brief Returns file with .seed<seed> inserted before its extension (which is replaced by extension, if given)
+std::string seed_file_name(const std::string& file, int seed, const std::string& extension = "") {
+    std::filesystem::path path(file);
+    std::string seed_extension = extension.empty() ? path.extension().string() : extension;
+    return (path.parent_path() / (path.stem().string() + ".seed" + std::to_string(seed) + seed_extension)).string();
+}
+
+///@brief Returns true if lhs is strictly better than rhs
+bool is_better_result(const t_seed_result& lhs, const t_seed_result& rhs) {
+    if (lhs.routed != rhs.routed) {
+        return lhs.routed;
+    }
+    if (lhs.chan_width != rhs.chan_width) {
+        return lhs.chan_width < rhs.chan_width;
+    }
+    if (!std::isnan(lhs.cpd) && !std::isnan(rhs.cpd) && lhs.cpd != rhs.cpd) {
+        return lhs.cpd < rhs.cpd;
+    }
+    return lhs.wirelength < rhs.wirelength;
+}
+
+///@brief Places and routes the circuit (in a seed process), returning the result
+t_seed_result place_and_route(t_vpr_setup& vpr_setup, const t_arch& arch, std::unique_ptr<PlaceDelayModel>& place_delay_model) {
+    const auto& placement_net_list = (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
+    vpr_place(placement_net_list, vpr_setup, arch, place_delay_model);
+    sync_grid_to_blocks();
+    post_place_sync();
+
+    bool is_flat = vpr_setup.RouterOpts.flat_routing;
+    const Netlist<>& router_net_list = is_flat ? (const Netlist<>&)g_vpr_ctx.atom().nlist : (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
+    RouteStatus route_status = vpr_route_flow(router_net_list, vpr_setup, arch, is_flat);
+
+    t_seed_result result;
+    result.seed = vpr_setup.PlacerOpts.seed;
+    result.routed = route_status.success();
+    result.chan_width = route_status.chan_width();
+    if (!result.routed) {
+        return result;
+    }
+
+    for (ParentNetId net_id : router_net_list.nets()) {
+        if (!router_net_list.net_is_ignored(net_id) && router_net_list.net_sinks(net_id).size() != 0) {
+            int bends, length, segments;
+            bool is_absorbed;
+            get_num_bends_and_length(net_id, &bends, &length, &segments, &is_absorbed);
+            result.wirelength += length;
+        }
+    }
+
+    if (vpr_setup.TimingEnabled) {
+        const auto& atom_ctx = g_vpr_ctx.atom();
+        NetPinsMatrix<float> net_delay = make_net_pins_matrix<float>(router_net_list);
+        load_net_delay_from_routing(router_net_list, net_delay);
+
+        auto delay_calc = std::make_shared<AnalysisDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, net_delay, is_flat);
+        auto timing_info = make_setup_timing_info(delay_calc, vpr_setup.AnalysisOpts.timing_update_type);
+        timing_info->update();
+        result.cpd = timing_info->least_slack_critical_path().delay();
+    }
+
+    return result;
+}
+
+///@brief Runs a seed in the forked process, writing its result to result_fd
+[[noreturn]] void run_seed_process(t_vpr_setup& vpr_setup,
+                                   const t_arch& arch,
+                                   std::unique_ptr<PlaceDelayModel>& place_delay_model,
+                                   int seed,
+                                   int result_fd) {
+    async_file_writer().reset_after_fork();
+
+    auto& filename_opts = vpr_setup.FileNameOpts;
+    std::string log_file = seed_file_name(filename_opts.PlaceFile, seed, ".log");
+    int log_fd = open(log_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (log_fd >= 0) {
+        dup2(log_fd, STDOUT_FILENO);
+        dup2(log_fd, STDERR_FILENO);
+        close(log_fd);
+    }
+    vtr::set_log_file(nullptr); //The output now goes to log_file
+
+    int exit_code = ERROR_EXIT_CODE;
+    try {
+        vpr_setup.PlacerOpts.seed = seed;
+        vtr::srandom(seed);
+        filename_opts.PlaceFile = seed_file_name(filename_opts.PlaceFile, seed);
+        filename_opts.RouteFile = seed_file_name(filename_opts.RouteFile, seed);
+        VTR_LOG("Placing and routing with seed %d\n", seed);
+
+        t_seed_result result = place_and_route(vpr_setup, arch, place_delay_model);
+        if (write(result_fd, &result, sizeof(result)) == sizeof(result)) {
+            exit_code = SUCCESS_EXIT_CODE;
+        }
+    } catch (const tatum::Error& tatum_error) {
+        VTR_LOG_ERROR("%s\n", format_tatum_error(tatum_error).c_str());
+    } catch (const VprError& vpr_error) {
+        vpr_print_error(vpr_error);
+    } catch (const vtr::VtrError& vtr_error) {
+        VTR_LOG_ERROR("%s:%d %s\n", vtr_error.filename_c_str(), vtr_error.line(), vtr_error.what());
+    }
+
+    for (const std::string& file : async_file_writer().wait()) {
+        VTR_LOG_WARN("Failed to write file '%s'\n", file.c_str());
+    }
+    std::fflush(nullptr);
+
+    //Skip the clean-up of the (copied) device data, which would only touch the shared pages
+    std::_Exit(exit_code);
+}
+
+///@brief Reads the result of a seed process and waits for it to exit, returning false if it failed
+bool wait_seed_process(const t_seed_process& process, t_seed_result& result) {
+    size_t num_read = 0;
+    char* data = reinterpret_cast<char*>(&result);
+    while (num_read < sizeof(result)) {
+        ssize_t ret = read(process.result_fd, data + num_read, sizeof(result) - num_read);
+        if (ret <= 0) {
+            break;
+        }
+        num_read += ret;
+    }
+    close(process.result_fd);
+
+    int status = 0;
+    waitpid(process.pid, &status, 0);
+    return num_read == sizeof(result) && WIFEXITED(status) && WEXITSTATUS(status) == SUCCESS_EXIT_CODE;
+}
+
+///@brief Stops the threads which would not be inherited by the forked processes
+void prepare_fork() {
+    for (const std::string& file : async_file_writer().wait()) {
+        VTR_LOG_WARN("Failed to write file '%s'\n", file.c_str());
+    }
+
+#ifdef VPR_USE_TBB
+    //A forked process only has the forking thread, so TBB's worker threads are stopped
+    //(a new pool is started by the next parallel algorithm)
+    tbb::task_scheduler_handle handle(tbb::attach{});
+    if (!tbb::finalize(handle, std::nothrow)) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to stop the TBB worker threads before forking the seed sweep processes\n");
+    }
+#endif
+
+    std::fflush(nullptr);
+}
+
+} // namespace
+
+bool vpr_seed_sweep(t_vpr_setup& vpr_setup, const t_arch& arch) {
+    auto& placer_opts = vpr_setup.PlacerOpts;
+    auto& router_opts = vpr_setup.RouterOpts;
+    auto& filename_opts = vpr_setup.FileNameOpts;
+
+    if (vpr_setup.ShowGraphics) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "A seed sweep (--seed_sweep) can not be run with graphics\n");
+    }
+
+    vtr::ScopedStartFinishTimer timer("Seed Sweep");
+
+    //Shared by all the seeds
+    const auto& placement_net_list = (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
+    std::unique_ptr<PlaceDelayModel> place_delay_model = vpr_alloc_place_delay_model(placement_net_list, vpr_setup, arch);
+
+    prepare_fork();
+
+    std::vector<t_seed_process> processes;
+    for (int iseed = 0; iseed < placer_opts.seed_sweep; ++iseed) {
+        t_seed_process process;
+        process.seed = placer_opts.seed + iseed * placer_opts.place_num_seeds;
+
+        int fds[2];
+        if (pipe(fds) != 0) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to create the result pipe of seed %d\n", process.seed);
+        }
+
+        process.pid = fork();
+        if (process.pid == 0) {
+            close(fds[0]);
+            for (const t_seed_process& other : processes) {
+                close(other.result_fd);
+            }
+            run_seed_process(vpr_setup, arch, place_delay_model, process.seed, fds[1]);
+        } else if (process.pid < 0) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to fork the process of seed %d\n", process.seed);
+        }
+
+        close(fds[1]);
+        process.result_fd = fds[0];
+        processes.push_back(process);
+        VTR_LOG("Started seed %d (pid %d), logging to '%s'\n",
+                process.seed, int(process.pid), seed_file_name(filename_opts.PlaceFile, process.seed, ".log").c_str());
+    }
+
+    bool found_best = false;
+    t_seed_result best;
+    for (const t_seed_process& process : processes) {
+        t_seed_result result;
+        if (!wait_seed_process(process, result)) {
+            VTR_LOG_WARN("Seed %d failed (see its log)\n", process.seed);
+            continue;
+        }
+
+        if (result.routed) {
+            VTR_LOG("Seed %d: routed with a channel width factor of %d, wirelength %g", result.seed, result.chan_width, result.wirelength);
+            if (!std::isnan(result.cpd)) {
+                VTR_LOG(", critical path delay %g ns", 1e9 * result.cpd);
+            }
+            VTR_LOG("\n");
+        } else {
+            VTR_LOG("Seed %d: unroutable with a channel width factor of %d\n", result.seed, result.chan_width);
+        }
+
+        if (!found_best || is_better_result(result, best)) {
+            best = result;
+            found_best = true;
+        }
+    }
+
+    if (!found_best || !best.routed) {
+        VTR_LOG("No seed could be routed\n");
+        return false;
+    }
+    VTR_LOG("Keeping the placement and routing of seed %d\n", best.seed);
+
+    //The rest of the flow loads the best result from the usual files
+    for (std::string* file : {&filename_opts.PlaceFile, &filename_opts.RouteFile}) {
+        std::string seed_file = seed_file_name(*file, best.seed);
+        if (std::rename(seed_file.c_str(), file->c_str()) != 0) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to rename '%s' to '%s'\n", seed_file.c_str(), file->c_str());
+        }
+    }
+
+    placer_opts.seed = best.seed;
+    placer_opts.doPlacement = STAGE_LOAD;
+    router_opts.doRouting = STAGE_LOAD;
+    router_opts.fixed_channel_width = best.chan_width;
+    if (!router_opts.flat_routing && placer_opts.place_chan_width != best.chan_width) {
+        //Loading the routing needs the RR graph of its channel width (the flat RR graph is built when loading)
+        vpr_create_rr_graph(vpr_setup, arch, best.chan_width, false);
+    }
+
+    return true;
+}
+
+#else
+
+bool vpr_seed_sweep(t_vpr_setup& /*vpr_setup*/, const t_arch& /*arch*/) {
+    VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Seed sweeps (--seed_sweep) are only supported on POSIX systems\n");
+}
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef VPR_SEED_SWEEP_H
+#define VPR_SEED_SWEEP_H
+
+/**
+ * @file
+ * @brief Placement and routing with several seeds, in processes forked from the loaded device
+ *
+ * With --seed_sweep N, once the device is built (grid, RR graph, and the router lookahead
+ * and placement delay model for timing-driven placement), N processes are forked which
+ * each place and route with a different seed: --seed, --seed + --place_num_seeds, ...
+ * They share the device data (copy on write) instead of each building it again.
+ *
+ * Each seed writes its log, placement and routing to files with a .seed<N> suffix, e.g.
+ * tseng.seed3.log, tseng.seed3.place and tseng.seed3.route. The best seed's placement and
+ * routing are then renamed to the usual files and loaded, so the rest of the flow (e.g.
+ * analysis) runs on the best result. The best seed is the one which routed at the lowest
+ * channel width, then with the lowest critical path delay (if timing analysis is enabled),
+ * then with the lowest wirelength.
+ *
+ * Only supported on POSIX systems.
+ */
+
+#include "physical_types.h"
+#include "vpr_types.h"
+
+/**
+ * @brief Places and routes with each seed of the sweep (see above), then sets up vpr_setup to load the best result
+ *
+ * Returns false if no seed could be routed.
+ */
+bool vpr_seed_sweep(t_vpr_setup& vpr_setup, const t_arch& arch);
+
+#endif
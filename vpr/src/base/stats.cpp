@@ -8,6 +8,7 @@
 #include "vtr_log.h"
 #include "vtr_math.h"
 #include "vtr_ndmatrix.h"
+#include "vtr_parallel.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -27,16 +28,39 @@
 
 #include "timing_util.h"
 #include "tatum/TimingReporter.hpp"
+#include "perf_metrics.h"
 
 /********************** Subroutines local to this module *********************/
 
-static void load_channel_occupancies(const Netlist<>& net_list,
-                                     vtr::Matrix<int>& chanx_occ,
-                                     vtr::Matrix<int>& chany_occ);
+/**
+ * @brief Statistics of the routing of the nets of a netlist
+ *
+ * They are all gathered in a single pass over the route trees (see get_net_routing_stats()).
+ */
+struct t_net_routing_stats {
+    int total_bends = 0;
+    int max_bends = 0;
+    int total_length = 0;
+    int max_length = 0;
+    int total_segments = 0;
+    int max_segments = 0;
+    int num_global_nets = 0;
+    int num_clb_opins_reserved = 0;
+    int num_absorbed_nets = 0;
+
+    vtr::Matrix<int> chanx_occ; //[0 .. device_ctx.grid.width() - 1][0 .. device_ctx.grid.height() - 2]
+    vtr::Matrix<int> chany_occ; //[0 .. device_ctx.grid.width() - 2][0 .. device_ctx.grid.height() - 1]
+};
+
+static t_net_routing_stats get_net_routing_stats(const Netlist<>& net_list, bool is_flat);
+
+static void add_net_routing_stats(const Netlist<>& net_list, ParentNetId net_id, bool is_flat, t_net_routing_stats& stats);
 
-static void length_and_bends_stats(const Netlist<>& net_list, bool is_flat);
+static void merge_net_routing_stats(t_net_routing_stats& stats, const t_net_routing_stats& other);
 
-static void get_channel_occupancy_stats(const Netlist<>& net_list, bool /***/);
+static void print_length_and_bends_stats(const Netlist<>& net_list, const t_net_routing_stats& stats);
+
+static void print_channel_occupancy_stats(const t_net_routing_stats& stats);
 
 /************************* Subroutine definitions ****************************/
 
@@ -63,9 +87,10 @@ void routing_stats(const Netlist<>& net_list,
 
     int num_rr_switch = rr_graph.num_rr_switches();
 
-    length_and_bends_stats(net_list, is_flat);
+    t_net_routing_stats net_stats = get_net_routing_stats(net_list, is_flat);
+    print_length_and_bends_stats(net_list, net_stats);
     print_channel_stats(is_flat);
-    get_channel_occupancy_stats(net_list, is_flat);
+    print_channel_occupancy_stats(net_stats);
 
     VTR_LOG("Logic area (in minimum width transistor areas, excludes I/Os and empty grid tiles)...\n");
 
@@ -116,90 +141,153 @@ void routing_stats(const Netlist<>& net_list,
 }
 
 /**
- * @brief Figures out maximum, minimum and average number of bends
- *        and net length in the routing.
+ * @brief Gathers the bends, wirelength and channel occupancy statistics of all nets.
+ *
+ * The nets are independent, so they are visited in parallel (when VPR is built with TBB),
+ * in fixed chunks whose statistics are merged by vtr::parallel_reduce_deterministic().
  */
-void length_and_bends_stats(const Netlist<>& net_list, bool is_flat) {
-    int bends, total_bends, max_bends;
-    int length, total_length, max_length;
-    int segments, total_segments, max_segments;
-    float av_bends, av_length, av_segments;
-    int num_global_nets, num_clb_opins_reserved, num_absorbed_nets;
+static t_net_routing_stats get_net_routing_stats(const Netlist<>& net_list, bool is_flat) {
+    auto& device_ctx = g_vpr_ctx.device();
 
-    bool is_absorbed;
+    t_net_routing_stats stats;
+    stats.chanx_occ = vtr::Matrix<int>({{
+                                           device_ctx.grid.width(),     //[0 .. device_ctx.grid.width() - 1] (length of x channel)
+                                           device_ctx.grid.height() - 1 //[0 .. device_ctx.grid.height() - 2] (# x channels)
+                                       }},
+                                       0);
+    stats.chany_occ = vtr::Matrix<int>({{
+                                           device_ctx.grid.width() - 1, //[0 .. device_ctx.grid.width() - 2] (# y channels)
+                                           device_ctx.grid.height()     //[0 .. device_ctx.grid.height() - 1] (length of y channel)
+                                       }},
+                                       0);
+
+    /* Each chunk of nets starts from the (empty) stats */
+    auto nets = net_list.nets();
+    return vtr::parallel_reduce_deterministic(
+        0, nets.size(), stats,
+        [&](size_t first, size_t last) {
+            t_net_routing_stats chunk_stats = stats;
+            for (size_t inet = first; inet < last; ++inet) {
+                add_net_routing_stats(net_list, *(nets.begin() + inet), is_flat, chunk_stats);
+            }
+            return chunk_stats;
+        },
+        [](t_net_routing_stats lhs, const t_net_routing_stats& rhs) {
+            merge_net_routing_stats(lhs, rhs);
+            return lhs;
+        });
+}
 
-    max_bends = 0;
-    total_bends = 0;
-    max_length = 0;
-    total_length = 0;
-    max_segments = 0;
-    total_segments = 0;
-    num_global_nets = 0;
-    num_clb_opins_reserved = 0;
-    num_absorbed_nets = 0;
+///@brief Adds the bends, wirelength and tracks used by the routing of net_id to stats
+static void add_net_routing_stats(const Netlist<>& net_list, ParentNetId net_id, bool is_flat, t_net_routing_stats& stats) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    auto& route_ctx = g_vpr_ctx.routing();
 
-    for (auto net_id : net_list.nets()) {
-        if (!net_list.net_is_ignored(net_id) && net_list.net_sinks(net_id).size() != 0) { /* Globals don't count. */
-            get_num_bends_and_length(net_id, &bends, &length, &segments, &is_absorbed);
+    if (!net_list.net_is_ignored(net_id) && net_list.net_sinks(net_id).size() != 0) { /* Globals don't count. */
+        int bends, length, segments;
+        bool is_absorbed;
+        get_num_bends_and_length(net_id, &bends, &length, &segments, &is_absorbed);
 
-            total_bends += bends;
-            max_bends = std::max(bends, max_bends);
+        stats.total_bends += bends;
+        stats.max_bends = std::max(bends, stats.max_bends);
 
-            total_length += length;
-            max_length = std::max(length, max_length);
+        stats.total_length += length;
+        stats.max_length = std::max(length, stats.max_length);
 
-            total_segments += segments;
-            max_segments = std::max(segments, max_segments);
+        stats.total_segments += segments;
+        stats.max_segments = std::max(segments, stats.max_segments);
 
-            if (is_absorbed) {
-                num_absorbed_nets++;
-            }
-        } else if (net_list.net_is_ignored(net_id)) {
-            num_global_nets++;
-        } else if (!is_flat) {
-            /* If flat_routing is enabled, we don't need to count the number of reserved opins*/
-            num_clb_opins_reserved++;
+        if (is_absorbed) {
+            stats.num_absorbed_nets++;
         }
+    } else if (net_list.net_is_ignored(net_id)) {
+        stats.num_global_nets++;
+    } else if (!is_flat) {
+        /* If flat_routing is enabled, we don't need to count the number of reserved opins*/
+        stats.num_clb_opins_reserved++;
     }
 
-    av_bends = (float)total_bends / (float)((int)net_list.nets().size() - num_global_nets);
+    /* Count the tracks used by the net, skipping global and empty nets. */
+    if (net_list.net_is_ignored(net_id) && net_list.net_sinks(net_id).size() != 0)
+        return;
+
+    auto& tree = route_ctx.route_trees[net_id];
+    if (!tree)
+        return;
+
+    for (auto& rt_node : tree.value().all_nodes()) {
+        RRNodeId inode = rt_node.inode;
+        t_rr_type rr_type = rr_graph.node_type(inode);
+
+        if (rr_type == CHANX) {
+            int j = rr_graph.node_ylow(inode);
+            for (int i = rr_graph.node_xlow(inode); i <= rr_graph.node_xhigh(inode); i++)
+                stats.chanx_occ[i][j]++;
+        } else if (rr_type == CHANY) {
+            int i = rr_graph.node_xlow(inode);
+            for (int j = rr_graph.node_ylow(inode); j <= rr_graph.node_yhigh(inode); j++)
+                stats.chany_occ[i][j]++;
+        }
+    }
+}
+
+///@brief Merges the statistics of other (e.g. gathered from another chunk of nets) into stats
+static void merge_net_routing_stats(t_net_routing_stats& stats, const t_net_routing_stats& other) {
+    stats.total_bends += other.total_bends;
+    stats.max_bends = std::max(other.max_bends, stats.max_bends);
+    stats.total_length += other.total_length;
+    stats.max_length = std::max(other.max_length, stats.max_length);
+    stats.total_segments += other.total_segments;
+    stats.max_segments = std::max(other.max_segments, stats.max_segments);
+    stats.num_global_nets += other.num_global_nets;
+    stats.num_clb_opins_reserved += other.num_clb_opins_reserved;
+    stats.num_absorbed_nets += other.num_absorbed_nets;
+
+    VTR_ASSERT(stats.chanx_occ.storage_size() == other.chanx_occ.storage_size());
+    for (size_t i = 0; i < stats.chanx_occ.storage_size(); ++i) {
+        stats.chanx_occ.get(i) += other.chanx_occ.get(i);
+    }
+    VTR_ASSERT(stats.chany_occ.storage_size() == other.chany_occ.storage_size());
+    for (size_t i = 0; i < stats.chany_occ.storage_size(); ++i) {
+        stats.chany_occ.get(i) += other.chany_occ.get(i);
+    }
+}
+
+/**
+ * @brief Prints the maximum and average number of bends
+ *        and net length in the routing.
+ */
+static void print_length_and_bends_stats(const Netlist<>& net_list, const t_net_routing_stats& stats) {
+    int num_routed_nets = (int)net_list.nets().size() - stats.num_global_nets;
+
+    float av_bends = (float)stats.total_bends / (float)num_routed_nets;
     VTR_LOG("\n");
-    VTR_LOG("Average number of bends per net: %#g  Maximum # of bends: %d\n", av_bends, max_bends);
+    VTR_LOG("Average number of bends per net: %#g  Maximum # of bends: %d\n", av_bends, stats.max_bends);
     VTR_LOG("\n");
 
-    av_length = (float)total_length / (float)((int)net_list.nets().size() - num_global_nets);
-    VTR_LOG("Number of global nets: %d\n", num_global_nets);
-    VTR_LOG("Number of routed nets (nonglobal): %d\n", (int)net_list.nets().size() - num_global_nets);
+    float av_length = (float)stats.total_length / (float)num_routed_nets;
+    VTR_LOG("Number of global nets: %d\n", stats.num_global_nets);
+    VTR_LOG("Number of routed nets (nonglobal): %d\n", num_routed_nets);
     VTR_LOG("Wire length results (in units of 1 clb segments)...\n");
-    VTR_LOG("\tTotal wirelength: %d, average net length: %#g\n", total_length, av_length);
-    VTR_LOG("\tMaximum net length: %d\n", max_length);
+    VTR_LOG("\tTotal wirelength: %d, average net length: %#g\n", stats.total_length, av_length);
+    VTR_LOG("\tMaximum net length: %d\n", stats.max_length);
     VTR_LOG("\n");
+    perf_metrics().set("route.total_wirelength", stats.total_length, e_perf_metric_type::QOR);
 
-    av_segments = (float)total_segments / (float)((int)net_list.nets().size() - num_global_nets);
+    float av_segments = (float)stats.total_segments / (float)num_routed_nets;
     VTR_LOG("Wire length results in terms of physical segments...\n");
-    VTR_LOG("\tTotal wiring segments used: %d, average wire segments per net: %#g\n", total_segments, av_segments);
-    VTR_LOG("\tMaximum segments used by a net: %d\n", max_segments);
-    VTR_LOG("\tTotal local nets with reserved CLB opins: %d\n", num_clb_opins_reserved);
+    VTR_LOG("\tTotal wiring segments used: %d, average wire segments per net: %#g\n", stats.total_segments, av_segments);
+    VTR_LOG("\tMaximum segments used by a net: %d\n", stats.max_segments);
+    VTR_LOG("\tTotal local nets with reserved CLB opins: %d\n", stats.num_clb_opins_reserved);
 
-    VTR_LOG("Total number of nets absorbed: %d\n", num_absorbed_nets);
+    VTR_LOG("Total number of nets absorbed: %d\n", stats.num_absorbed_nets);
 }
 
-///@brief Determines how many tracks are used in each channel.
-static void get_channel_occupancy_stats(const Netlist<>& net_list, bool /***/) {
+///@brief Prints how many tracks are used in each channel.
+static void print_channel_occupancy_stats(const t_net_routing_stats& stats) {
     auto& device_ctx = g_vpr_ctx.device();
-
-    auto chanx_occ = vtr::Matrix<int>({{
-                                          device_ctx.grid.width(),     //[0 .. device_ctx.grid.width() - 1] (length of x channel)
-                                          device_ctx.grid.height() - 1 //[0 .. device_ctx.grid.height() - 2] (# x channels)
-                                      }},
-                                      0);
-
-    auto chany_occ = vtr::Matrix<int>({{
-                                          device_ctx.grid.width() - 1, //[0 .. device_ctx.grid.width() - 2] (# y channels)
-                                          device_ctx.grid.height()     //[0 .. device_ctx.grid.height() - 1] (length of y channel)
-                                      }},
-                                      0);
-    load_channel_occupancies(net_list, chanx_occ, chany_occ);
+    const vtr::Matrix<int>& chanx_occ = stats.chanx_occ;
+    const vtr::Matrix<int>& chany_occ = stats.chany_occ;
 
     VTR_LOG("\n");
     VTR_LOG("X - Directed channels:   j max occ ave occ capacity\n");
@@ -241,48 +329,6 @@ static void get_channel_occupancy_stats(const Netlist<>& net_list, bool /***/) {
     VTR_LOG("\n");
 }
 
-/**
- * @brief Loads the two arrays passed in with the total occupancy at each of the
- *        channel segments in the FPGA.
- */
-static void load_channel_occupancies(const Netlist<>& net_list,
-                                     vtr::Matrix<int>& chanx_occ,
-                                     vtr::Matrix<int>& chany_occ) {
-    auto& device_ctx = g_vpr_ctx.device();
-    const auto& rr_graph = device_ctx.rr_graph;
-    auto& route_ctx = g_vpr_ctx.routing();
-
-    /* First set the occupancy of everything to zero. */
-    chanx_occ.fill(0);
-    chany_occ.fill(0);
-
-    /* Now go through each net and count the tracks and pins used everywhere */
-    for (auto net_id : net_list.nets()) {
-        /* Skip global and empty nets. */
-        if (net_list.net_is_ignored(net_id) && net_list.net_sinks(net_id).size() != 0)
-            continue;
-
-        auto& tree = route_ctx.route_trees[net_id];
-        if (!tree)
-            continue;
-
-        for (auto& rt_node : tree.value().all_nodes()) {
-            RRNodeId inode = rt_node.inode;
-            t_rr_type rr_type = rr_graph.node_type(inode);
-
-            if (rr_type == CHANX) {
-                int j = rr_graph.node_ylow(inode);
-                for (int i = rr_graph.node_xlow(inode); i <= rr_graph.node_xhigh(inode); i++)
-                    chanx_occ[i][j]++;
-            } else if (rr_type == CHANY) {
-                int i = rr_graph.node_xlow(inode);
-                for (int j = rr_graph.node_ylow(inode); j <= rr_graph.node_yhigh(inode); j++)
-                    chany_occ[i][j]++;
-            }
-        }
-    }
-}
-
 /**
  * @brief Counts and returns the number of bends, wirelength, and number of routing
  *        resource segments in net inet's routing.
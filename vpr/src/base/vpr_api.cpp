@@ -17,30 +17,41 @@
 #include <chrono>
 #include <cmath>
 #include <sstream>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <future>
 
 #include "vtr_assert.h"
 #include "vtr_math.h"
 #include "vtr_log.h"
 #include "vtr_version.h"
 #include "vtr_time.h"
+#include "vtr_rusage.h"
+#include "vtr_profile.h"
 #include "vtr_path.h"
+#include "vtr_random.h"
 
 #include "vpr_types.h"
 #include "vpr_utils.h"
 #include "globals.h"
 #include "atom_netlist.h"
 #include "read_netlist.h"
+#include "netlist_snapshot.h"
 #include "check_netlist.h"
 #include "read_blif.h"
 #include "draw.h"
+#include "headless_images.h"
 #include "place_and_route.h"
 #include "pack.h"
 #include "place.h"
+#include "place_delay_model.h"
 #include "SetupGrid.h"
 #include "setup_clocks.h"
 #include "setup_noc.h"
 #include "read_xml_noc_traffic_flows_file.h"
 #include "noc_routing_algorithm_creator.h"
+#include "noc_route_table.h"
 #include "stats.h"
 #include "read_options.h"
 #include "echo_files.h"
@@ -54,11 +65,13 @@
 #include "route_common.h"
 #include "timing_place_lookup.h"
 #include "route_export.h"
+#include "router_delay_profiling.h"
 #include "vpr_api.h"
 #include "read_sdc.h"
 #include "power.h"
 #include "pack_types.h"
 #include "lb_type_rr_graph.h"
+#include "cluster_router.h"
 #include "read_activity.h"
 #include "net_delay.h"
 #include "AnalysisDelayCalculator.h"
@@ -91,6 +104,10 @@
 #include "arch_util.h"
 
 #include "post_routing_pb_pin_fixup.h"
+#include "async_file_writer.h"
+#include "perf_metrics.h"
+#include "memory_accounting.h"
+#include "seed_sweep.h"
 
 #include "log.h"
 #include "iostream"
@@ -99,6 +116,7 @@
 #    define TBB_PREVIEW_GLOBAL_CONTROL 1 /* Needed for compatibility with old TBB versions */
 #    include <tbb/task_arena.h>
 #    include <tbb/global_control.h>
+#    include <tbb/task_group.h>
 #endif
 
 /* Local subroutines */
@@ -107,12 +125,27 @@ static void free_complex_block_types();
 static void free_device(const t_det_routing_arch& routing_arch);
 static void free_circuit();
 
+static void enable_timing_graph_echo_files(const std::vector<std::string>& flow_points);
+
+static void run_analysis_tasks(const std::vector<std::function<void()>>& tasks, bool parallel);
+
 static void get_intercluster_switch_fanin_estimates(const t_vpr_setup& vpr_setup,
                                                     const t_arch& arch,
                                                     const int wire_segment_length,
                                                     int* opin_switch_fanin,
                                                     int* wire_switch_fanin,
                                                     int* ipin_switch_fanin);
+
+static bool is_better_placement(const t_place_result& result, const t_place_result& best_result);
+
+static std::future<void> start_route_setup(const t_vpr_setup& vpr_setup);
+
+static bool use_preloaded_arch(const t_options& options, t_arch* arch);
+
+/* The architecture read by vpr_preload_arch(), if any */
+static t_arch* f_preloaded_arch = nullptr;
+static std::filesystem::path f_preloaded_arch_file;
+static std::filesystem::file_time_type f_preloaded_arch_write_time;
 /* Local subroutines end */
 
 ///@brief Display general VPR information
@@ -238,6 +271,13 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
     vpr_setup->exit_before_pack = options->exit_before_pack;
     vpr_setup->num_workers = num_workers;
 
+    vpr_setup->profile_trace_file = options->profile_trace_file;
+    if (!vpr_setup->profile_trace_file.empty()) {
+        vtr::enable_profiling();
+    }
+    vpr_setup->perf_metrics_file = options->perf_metrics_file;
+    set_memory_budget(options->memory_budget);
+
     VTR_LOG("\n");
     VTR_LOG("Architecture file: %s\n", options->ArchFile.value().c_str());
     VTR_LOG("Circuit name: %s\n", options->CircuitName.value().c_str());
@@ -245,6 +285,7 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
 
     /* Determine whether echo is on or off */
     setEchoEnabled(options->CreateEchoFile);
+    enable_timing_graph_echo_files(options->echo_timing_graph.value());
 
     /*
      * Initialize the functions names for which VPR_ERRORs
@@ -278,7 +319,7 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
     /* Read in arch and circuit */
     SetupVPR(options,
              vpr_setup->TimingEnabled,
-             true,
+             !use_preloaded_arch(*options, arch),
              &vpr_setup->FileNameOpts,
              arch,
              &vpr_setup->user_models,
@@ -344,6 +385,9 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
         {
             set_terminate_if_timing_fails(options->terminate_if_timing_fails);
         }
+        if (!vpr_setup->AnalysisOpts.write_timing_metrics.empty()) {
+            timing_ctx.metrics_log = std::make_shared<TimingMetricsLog>(vpr_setup->AnalysisOpts.write_timing_metrics);
+        }
     }
 
     //Initialize vpr floorplanning constraints
@@ -360,6 +404,54 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
     device_ctx.pad_loc_type = vpr_setup->PlacerOpts.pad_loc_type;
 }
 
+void vpr_preload_arch(const std::string& arch_file) {
+    vtr::ScopedStartFinishTimer t("Preloading Architecture Description");
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+
+    //Its contents are moved into the run which uses it
+    f_preloaded_arch = new t_arch();
+    XmlReadArch(arch_file.c_str(),
+                /*timing_enabled=*/true,
+                f_preloaded_arch,
+                device_ctx.physical_tile_types,
+                device_ctx.logical_block_types);
+
+    f_preloaded_arch_file = std::filesystem::weakly_canonical(arch_file);
+    f_preloaded_arch_write_time = std::filesystem::last_write_time(f_preloaded_arch_file);
+}
+
+/**
+ * @brief Returns true (and moves the preloaded architecture to arch) if the architecture
+ *        of options was preloaded by vpr_preload_arch() and has not changed since
+ *
+ * Otherwise the preloaded architecture is discarded, so the run reads its own. Either
+ * way a preloaded architecture is used by a single run.
+ */
+static bool use_preloaded_arch(const t_options& options, t_arch* arch) {
+    if (!f_preloaded_arch) {
+        return false;
+    }
+
+    std::error_code ec;
+    bool same_file = std::filesystem::weakly_canonical(options.ArchFile.value(), ec) == f_preloaded_arch_file
+                     && std::filesystem::last_write_time(f_preloaded_arch_file, ec) == f_preloaded_arch_write_time
+                     && !ec;
+    //The preloaded architecture was read with timing
+    bool use_preloaded = same_file && options.arch_format.value() == e_arch_format::VTR && options.timing_analysis;
+    if (use_preloaded) {
+        VTR_LOG("Using the preloaded architecture description\n");
+        *arch = std::move(*f_preloaded_arch);
+    } else {
+        //Only the (forked) server jobs see a preloaded architecture, so its block types are
+        //dropped without freeing them: they are released when the job exits
+        auto& device_ctx = g_vpr_ctx.mutable_device();
+        device_ctx.physical_tile_types.clear();
+        device_ctx.logical_block_types.clear();
+    }
+    f_preloaded_arch = nullptr; //Never freed, as only the moved-from object is left
+    return use_preloaded;
+}
+
 bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch) {
     if (vpr_setup.exit_before_pack) {
         VTR_LOG_WARN("Exiting before packing as requested.\n");
@@ -374,7 +466,10 @@ bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch) {
 #endif
 
     { //Pack
+        vtr::Timer timer;
         bool pack_success = vpr_pack_flow(vpr_setup, arch);
+        perf_metrics().record_stage("pack", timer);
+        report_memory_usage("Packing");
 
         if (!pack_success) {
             return false; //Unimplementable
@@ -383,13 +478,34 @@ bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch) {
 
     // For the time being, we decided to create the flat graph after placement is done. Thus, the is_flat parameter for this function
     //, since it is called before routing, should be false.
-    vpr_create_device(vpr_setup, arch, false);
+    {
+        vtr::Timer timer;
+        vpr_create_device(vpr_setup, arch, false);
+        perf_metrics().record_stage("create_device", timer);
+        report_memory_usage("Create Device");
+    }
 
     // TODO: Placer still assumes that cluster net list is used - graphics can not work with flat routing yet
     vpr_init_graphics(vpr_setup, arch, false);
+    if (vpr_setup.PlacerOpts.seed_sweep > 1) {
+        //Places and routes each seed in a forked process, then sets up the stages below to load the best
+        vtr::Timer timer;
+        bool sweep_success = vpr_seed_sweep(vpr_setup, arch);
+        perf_metrics().record_stage("seed_sweep", timer);
+
+        if (!sweep_success) {
+            return false; //Unimplementable
+        }
+    }
+
+    //Started after the seed sweep, which forks
+    std::future<void> route_setup = start_route_setup(vpr_setup);
+
     { //Place
         const auto& placement_net_list = (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
+        vtr::Timer timer;
         bool place_success = vpr_place_flow(placement_net_list, vpr_setup, arch);
+        perf_metrics().record_stage("place", timer);
 
         if (!place_success) {
             std::cout << "failed placement" << std::endl;
@@ -399,11 +515,20 @@ bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch) {
     bool is_flat = vpr_setup.RouterOpts.flat_routing;
     const Netlist<>& router_net_list = is_flat ? (const Netlist<>&)g_vpr_ctx.atom().nlist : (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
     RouteStatus route_status;
+    if (route_setup.valid()) {
+        vtr::ScopedStartFinishTimer timer("Waiting for Router Lookahead");
+        route_setup.get(); //Rethrows any error of the computation
+    }
     { //Route
+        vtr::Timer timer;
         route_status = vpr_route_flow(router_net_list, vpr_setup, arch, is_flat);
+        perf_metrics().record_stage("route", timer);
+        report_memory_usage("Routing");
     }
     { //Analysis
+        vtr::Timer timer;
         vpr_analysis_flow(router_net_list, vpr_setup, arch, route_status, is_flat);
+        perf_metrics().record_stage("analysis", timer);
     }
 
     //close the graphics
@@ -564,7 +689,11 @@ void vpr_setup_noc_routing_algorithm(std::string noc_routing_algorithm_name) {
     // newly created routing algorithm to it
     auto& noc_ctx = g_vpr_ctx.mutable_noc();
 
-    noc_ctx.noc_flows_router = NocRoutingAlgorithmCreator().create_routing_algorithm(noc_routing_algorithm_name);
+    // The routes only depend on the NoC topology, so they are all found up-front and then looked up
+    std::unique_ptr<NocRouting> routing_algorithm(NocRoutingAlgorithmCreator().create_routing_algorithm(noc_routing_algorithm_name));
+    NocRouteTable* route_table = new NocRouteTable(std::move(routing_algorithm));
+    route_table->build(noc_ctx.noc_model);
+    noc_ctx.noc_flows_router = route_table;
     return;
 }
 
@@ -676,10 +805,32 @@ void vpr_load_packing(t_vpr_setup& vpr_setup, const t_arch& arch) {
     cluster_ctx.post_routing_clb_pin_nets.clear();
     cluster_ctx.pre_routing_net_pin_mapping.clear();
 
-    cluster_ctx.clb_nlist = read_netlist(vpr_setup.FileNameOpts.NetFile.c_str(),
-                                         &arch,
-                                         vpr_setup.FileNameOpts.verify_file_digests,
-                                         vpr_setup.PackerOpts.pack_verbosity);
+    const std::string snapshot_file = netlist_snapshot_file(vpr_setup.FileNameOpts.NetFile);
+    bool loaded_snapshot = false;
+    if (vpr_setup.FileNameOpts.netlist_snapshot && vpr_setup.PackerOpts.doPacking != STAGE_DO) {
+        loaded_snapshot = read_clustered_netlist_snapshot(snapshot_file, vpr_setup, arch, cluster_ctx.clb_nlist);
+    }
+
+    if (!loaded_snapshot) {
+        if (!cluster_ctx.packed_netlist_contents.empty()) {
+            //Packed in this run: load the packing from memory, while the file is still being written
+            cluster_ctx.clb_nlist = read_netlist(vpr_setup.FileNameOpts.NetFile.c_str(),
+                                                 cluster_ctx.packed_netlist_contents,
+                                                 &arch,
+                                                 vpr_setup.FileNameOpts.verify_file_digests,
+                                                 vpr_setup.PackerOpts.pack_verbosity);
+            std::string().swap(cluster_ctx.packed_netlist_contents);
+        } else {
+            cluster_ctx.clb_nlist = read_netlist(vpr_setup.FileNameOpts.NetFile.c_str(),
+                                                 &arch,
+                                                 vpr_setup.FileNameOpts.verify_file_digests,
+                                                 vpr_setup.PackerOpts.pack_verbosity);
+        }
+
+        if (vpr_setup.FileNameOpts.netlist_snapshot) {
+            write_netlist_snapshot(snapshot_file, vpr_setup, arch);
+        }
+    }
 
     process_constant_nets(g_vpr_ctx.mutable_atom().nlist,
                           g_vpr_ctx.atom().lookup,
@@ -688,7 +839,7 @@ void vpr_load_packing(t_vpr_setup& vpr_setup, const t_arch& arch) {
                           vpr_setup.PackerOpts.pack_verbosity);
 
     {
-        std::ofstream ofs("packing_pin_util.rpt");
+        AsyncOutputFile ofs("packing_pin_util.rpt");
         report_packing_pin_usage(ofs, g_vpr_ctx);
     }
 }
@@ -713,6 +864,10 @@ bool vpr_place_flow(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_a
 
         sync_grid_to_blocks();
         post_place_sync();
+
+        if (!filename_opts.write_headless_images.empty()) {
+            write_headless_placement_image(get_headless_image_file_name(filename_opts.write_headless_images, "place"));
+        }
     }
 
     //Write out a vpr floorplanning constraints file if the option is specified
@@ -725,6 +880,12 @@ bool vpr_place_flow(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_a
 }
 
 void vpr_place(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_arch& arch) {
+    //Shared by the placements of all the seeds
+    std::unique_ptr<PlaceDelayModel> place_delay_model;
+    vpr_place(net_list, vpr_setup, arch, place_delay_model);
+}
+
+void vpr_place(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_arch& arch, std::unique_ptr<PlaceDelayModel>& place_delay_model) {
     bool is_flat = false;
     if (placer_needs_lookahead(vpr_setup)) {
         // Prime lookahead cache to avoid adding lookahead computation cost to
@@ -733,24 +894,70 @@ void vpr_place(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_arch&
         get_cached_router_lookahead(
             vpr_setup.RoutingArch,
             vpr_setup.RouterOpts.lookahead_type,
+            vpr_setup.RouterOpts.base_cost_type,
             vpr_setup.RouterOpts.write_router_lookahead,
             vpr_setup.RouterOpts.read_router_lookahead,
             vpr_setup.Segments,
             is_flat);
     }
 
-    try_place(net_list,
-              vpr_setup.PlacerOpts,
-              vpr_setup.AnnealSched,
-              vpr_setup.RouterOpts,
-              vpr_setup.AnalysisOpts,
-              vpr_setup.NocOpts,
-              arch.Chans,
-              &vpr_setup.RoutingArch,
-              vpr_setup.Segments,
-              arch.Directs,
-              arch.num_directs,
-              is_flat);
+    t_placer_opts placer_opts = vpr_setup.PlacerOpts;
+    int num_seeds = placer_opts.place_num_seeds;
+
+    t_place_result best_result;
+    int best_seed = placer_opts.seed;
+    vtr::vector_map<ClusterBlockId, t_block_loc> best_block_locs;
+
+    for (int iseed = 0; iseed < num_seeds; ++iseed) {
+        if (iseed > 0) {
+            //The first placement keeps the random number sequence it would have had on its own
+            placer_opts.seed = vpr_setup.PlacerOpts.seed + iseed;
+            vtr::srandom(placer_opts.seed);
+            VTR_LOG("\nPlacing with seed %d (%d of %d)\n", placer_opts.seed, iseed + 1, num_seeds);
+        }
+
+        t_place_result result = try_place(net_list,
+                                          placer_opts,
+                                          vpr_setup.AnnealSched,
+                                          vpr_setup.RouterOpts,
+                                          vpr_setup.AnalysisOpts,
+                                          vpr_setup.NocOpts,
+                                          arch.Chans,
+                                          &vpr_setup.RoutingArch,
+                                          vpr_setup.Segments,
+                                          arch.Directs,
+                                          arch.num_directs,
+                                          is_flat,
+                                          place_delay_model);
+
+        if (num_seeds == 1) {
+            break;
+        }
+
+        if (iseed == 0 || is_better_placement(result, best_result)) {
+            best_result = result;
+            best_seed = placer_opts.seed;
+            best_block_locs = g_vpr_ctx.placement().block_locs;
+        }
+    }
+
+    if (num_seeds > 1) {
+        VTR_LOG("\nKeeping the placement of seed %d: bb_cost %g", best_seed, best_result.bb_cost);
+        if (!std::isnan(best_result.cpd)) {
+            VTR_LOG(", estimated CPD %g ns", 1e9 * best_result.cpd);
+        }
+        VTR_LOG("\n");
+
+        load_placement_and_analyze(net_list,
+                                   best_block_locs,
+                                   placer_opts,
+                                   vpr_setup.AnalysisOpts,
+                                   vpr_setup.NocOpts,
+                                   arch.Directs,
+                                   arch.num_directs,
+                                   place_delay_model.get(),
+                                   is_flat);
+    }
 
     auto& filename_opts = vpr_setup.FileNameOpts;
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -760,6 +967,36 @@ void vpr_place(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_arch&
                 filename_opts.PlaceFile.c_str());
 }
 
+std::unique_ptr<PlaceDelayModel> vpr_alloc_place_delay_model(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_arch& arch) {
+    const auto& placer_opts = vpr_setup.PlacerOpts;
+    if (placer_opts.doPlacement != STAGE_DO || !placer_opts.place_algorithm.is_timing_driven()) {
+        return nullptr;
+    }
+
+    bool is_flat = false;
+    if (placer_needs_lookahead(vpr_setup)) {
+        get_cached_router_lookahead(
+            vpr_setup.RoutingArch,
+            vpr_setup.RouterOpts.lookahead_type,
+            vpr_setup.RouterOpts.base_cost_type,
+            vpr_setup.RouterOpts.write_router_lookahead,
+            vpr_setup.RouterOpts.read_router_lookahead,
+            vpr_setup.Segments,
+            is_flat);
+    }
+
+    return alloc_lookups_and_delay_model(net_list,
+                                         g_vpr_ctx.device().arch_switch_inf,
+                                         arch.Chans,
+                                         placer_opts,
+                                         vpr_setup.RouterOpts,
+                                         &vpr_setup.RoutingArch,
+                                         vpr_setup.Segments,
+                                         arch.Directs,
+                                         arch.num_directs,
+                                         is_flat);
+}
+
 void vpr_load_placement(t_vpr_setup& vpr_setup, const t_arch& arch) {
     vtr::ScopedStartFinishTimer timer("Load Placement");
 
@@ -855,8 +1092,24 @@ RouteStatus vpr_route_flow(const Netlist<>& net_list,
                         is_flat);
             get_serial_num(net_list);
 
+            if (!router_opts.write_router_lookahead_profile.empty()) {
+                profile_router_lookahead(net_list,
+                                         get_cached_router_lookahead(vpr_setup.RoutingArch,
+                                                                     router_opts.lookahead_type,
+                                                                     router_opts.base_cost_type,
+                                                                     router_opts.write_router_lookahead,
+                                                                     router_opts.read_router_lookahead,
+                                                                     vpr_setup.Segments,
+                                                                     is_flat),
+                                         router_opts,
+                                         vpr_setup.Segments,
+                                         router_opts.write_router_lookahead_profile,
+                                         is_flat);
+            }
+
             //Update status
             VTR_LOG("Circuit successfully routed with a channel width factor of %d.\n", route_status.chan_width());
+            perf_metrics().set("route.channel_width", route_status.chan_width(), e_perf_metric_type::QOR);
             graphics_msg = vtr::string_fmt("Routing succeeded with a channel width factor of %d.\n", route_status.chan_width());
         } else {
             //Update status
@@ -893,6 +1146,11 @@ RouteStatus vpr_route_flow(const Netlist<>& net_list,
             print_switch_usage();
         }
 
+        if (!filename_opts.write_headless_images.empty()) {
+            write_headless_routing_util_image(get_headless_image_file_name(filename_opts.write_headless_images, "routing_util"));
+            write_headless_congestion_image(get_headless_image_file_name(filename_opts.write_headless_images, "congestion"));
+        }
+
         //Update interactive graphics
         update_screen(ScreenUpdatePriority::MAJOR, graphics_msg.c_str(), ROUTING, timing_info);
     }
@@ -911,6 +1169,7 @@ RouteStatus vpr_route_fixed_W(const Netlist<>& net_list,
     get_cached_router_lookahead(
         vpr_setup.RoutingArch,
         vpr_setup.RouterOpts.lookahead_type,
+        vpr_setup.RouterOpts.base_cost_type,
         vpr_setup.RouterOpts.write_router_lookahead,
         vpr_setup.RouterOpts.read_router_lookahead,
         vpr_setup.Segments,
@@ -1160,6 +1419,8 @@ void free_device(const t_det_routing_arch& /*routing_arch*/) {
 
     device_ctx.all_sw_inf.clear();
 
+    free_device_grid_cache();
+
     free_complex_block_types();
 }
 
@@ -1171,6 +1432,25 @@ static void free_complex_block_types() {
     free_pb_graph_edges();
 }
 
+/* Enables the timing graph echo files of the --echo_timing_graph flow points */
+static void enable_timing_graph_echo_files(const std::vector<std::string>& flow_points) {
+    const std::map<std::string, e_echo_files> flow_point_echo_files = {
+        {"pre_pack", E_ECHO_PRE_PACKING_TIMING_GRAPH},
+        {"place_initial", E_ECHO_INITIAL_PLACEMENT_TIMING_GRAPH},
+        {"place_final", E_ECHO_FINAL_PLACEMENT_TIMING_GRAPH},
+        {"route_final", E_ECHO_FINAL_ROUTING_TIMING_GRAPH},
+        {"analysis", E_ECHO_ANALYSIS_TIMING_GRAPH}};
+
+    for (const std::string& flow_point : flow_points) {
+        auto it = flow_point_echo_files.find(flow_point);
+        if (it == flow_point_echo_files.end()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Unknown timing graph echo flow point '%s'\n", flow_point.c_str());
+        }
+        setEchoFileEnabled(it->second, true);
+        VTR_LOG("Writing the timing graph at flow point '%s' to %s\n", flow_point.c_str(), getEchoFileName(it->second));
+    }
+}
+
 void free_circuit() {
     //Free new net structures
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
@@ -1200,6 +1480,9 @@ static void free_routing() {
     routing_ctx.rr_blk_source.clear();
     routing_ctx.rr_blk_source.clear();
     routing_ctx.rr_node_route_inf.clear();
+    routing_ctx.rr_node_path_inf.clear();
+    routing_ctx.overuse_candidates.clear();
+    routing_ctx.is_overuse_candidate.clear();
     routing_ctx.net_status.clear();
     routing_ctx.route_bb.clear();
 }
@@ -1214,6 +1497,7 @@ static void free_noc() {
 
 void vpr_free_vpr_data_structures(t_arch& Arch,
                                   t_vpr_setup& vpr_setup) {
+    free_router_data_pool();
     free_all_lb_type_rr_graph(vpr_setup.PackerRRGraph);
     free_circuit();
     free_arch(&Arch);
@@ -1227,6 +1511,29 @@ void vpr_free_vpr_data_structures(t_arch& Arch,
 
 void vpr_free_all(t_arch& Arch,
                   t_vpr_setup& vpr_setup) {
+    //Finish writing the reports queued during the flow
+    for (const std::string& file : async_file_writer().wait()) {
+        VTR_LOG_WARN("Failed to write file '%s'\n", file.c_str());
+    }
+
+    if (!vpr_setup.profile_trace_file.empty()) {
+        vtr::disable_profiling();
+        if (!vtr::write_profile_trace(vpr_setup.profile_trace_file)) {
+            VTR_LOG_WARN("Failed to write profile trace '%s'\n", vpr_setup.profile_trace_file.c_str());
+        }
+    }
+
+    if (!vpr_setup.perf_metrics_file.empty()) {
+        const auto& timing_stats = g_vpr_ctx.timing().stats;
+        PerfMetrics& metrics = perf_metrics();
+        metrics.set("sta.wall_sec", timing_stats.timing_analysis_wallclock_time(), e_perf_metric_type::RUNTIME);
+        metrics.set("sta.num_full_updates", timing_stats.num_full_updates(), e_perf_metric_type::WORK);
+        metrics.set("total.max_rss_mib", vtr::get_max_rss() / (1024. * 1024.), e_perf_metric_type::MEMORY);
+        if (!metrics.write_json(vpr_setup.perf_metrics_file)) {
+            VTR_LOG_WARN("Failed to write perf metrics '%s'\n", vpr_setup.perf_metrics_file.c_str());
+        }
+    }
+
     free_rr_graph();
     if (vpr_setup.RouterOpts.doRouting) {
         free_route_structs();
@@ -1388,17 +1695,25 @@ void vpr_analysis(const Netlist<>& net_list,
         VPR_FATAL_ERROR(VPR_ERROR_ANALYSIS, "No routing loaded -- can not perform post-routing analysis");
     }
 
-    routing_stats(net_list,
-                  vpr_setup.RouterOpts.full_stats,
-                  vpr_setup.RouterOpts.route_type,
-                  vpr_setup.Segments,
-                  vpr_setup.RoutingArch.R_minW_nmos,
-                  vpr_setup.RoutingArch.R_minW_pmos,
-                  Arch.grid_logic_tile_area,
-                  vpr_setup.RoutingArch.directionality,
-                  vpr_setup.RoutingArch.wire_to_rr_ipin_switch,
-                  is_flat);
-
+    //The statistics, reports, netlist writers and power estimation only read the implementation
+    //and the timing results, so are independent tasks once the timing analysis is done
+    std::vector<std::function<void()>> analysis_tasks;
+    analysis_tasks.push_back([&]() {
+        routing_stats(net_list,
+                      vpr_setup.RouterOpts.full_stats,
+                      vpr_setup.RouterOpts.route_type,
+                      vpr_setup.Segments,
+                      vpr_setup.RoutingArch.R_minW_nmos,
+                      vpr_setup.RoutingArch.R_minW_pmos,
+                      Arch.grid_logic_tile_area,
+                      vpr_setup.RoutingArch.directionality,
+                      vpr_setup.RoutingArch.wire_to_rr_ipin_switch,
+                      is_flat);
+    });
+
+    std::vector<t_memory_usage_entry> analysis_memory_usage;
+    std::shared_ptr<AnalysisDelayCalculator> analysis_delay_calc;
+    std::shared_ptr<SetupHoldTimingInfo> timing_info;
     if (vpr_setup.TimingEnabled) {
         //Load the net delays
 
@@ -1407,10 +1722,16 @@ void vpr_analysis(const Netlist<>& net_list,
                                     net_delay);
 
         //Do final timing analysis
-        auto analysis_delay_calc = std::make_shared<AnalysisDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, net_delay, vpr_setup.RouterOpts.flat_routing);
-        auto timing_info = make_setup_hold_timing_info(analysis_delay_calc, vpr_setup.AnalysisOpts.timing_update_type);
+        analysis_delay_calc = std::make_shared<AnalysisDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, net_delay, vpr_setup.RouterOpts.flat_routing);
+        timing_info = make_setup_hold_timing_info(analysis_delay_calc, vpr_setup.AnalysisOpts.timing_update_type);
         timing_info->update();
 
+        PerfMetrics& metrics = perf_metrics();
+        metrics.set("analysis.cpd_ns", 1e9 * timing_info->least_slack_critical_path().delay(), e_perf_metric_type::QOR);
+        metrics.set("analysis.setup_wns_ns", 1e9 * timing_info->setup_worst_negative_slack(), e_perf_metric_type::QOR, true);
+        metrics.set("analysis.setup_tns_ns", 1e9 * timing_info->setup_total_negative_slack(), e_perf_metric_type::QOR, true);
+        analysis_memory_usage.push_back({"Analysis timing tags", timing_info->analyzer()->memory_usage()});
+
         if (isEchoFileEnabled(E_ECHO_ANALYSIS_TIMING_GRAPH)) {
             auto& timing_ctx = g_vpr_ctx.timing();
             tatum::write_echo(getEchoFileName(E_ECHO_ANALYSIS_TIMING_GRAPH),
@@ -1418,28 +1739,76 @@ void vpr_analysis(const Netlist<>& net_list,
         }
 
         //Timing stats
-        VTR_LOG("\n");
-        generate_hold_timing_stats(/*prefix=*/"", *timing_info,
-                                   *analysis_delay_calc, vpr_setup.AnalysisOpts, vpr_setup.RouterOpts.flat_routing);
-        generate_setup_timing_stats(/*prefix=*/"", *timing_info,
-                                    *analysis_delay_calc, vpr_setup.AnalysisOpts, vpr_setup.RouterOpts.flat_routing);
+        analysis_tasks.push_back([&]() {
+            VTR_LOG("\n");
+            generate_hold_timing_stats(/*prefix=*/"", *timing_info,
+                                       *analysis_delay_calc, vpr_setup.AnalysisOpts, vpr_setup.RouterOpts.flat_routing);
+        });
+        analysis_tasks.push_back([&]() {
+            generate_setup_timing_stats(/*prefix=*/"", *timing_info,
+                                        *analysis_delay_calc, vpr_setup.AnalysisOpts, vpr_setup.RouterOpts.flat_routing);
+        });
+        analysis_tasks.push_back([&]() {
+            generate_timing_corner_stats(*analysis_delay_calc, vpr_setup.AnalysisOpts, vpr_setup.RouterOpts.flat_routing);
+        });
 
         //Write the post-syntesis netlist
         if (vpr_setup.AnalysisOpts.gen_post_synthesis_netlist) {
-            netlist_writer(atom_ctx.nlist.netlist_name().c_str(), analysis_delay_calc,
-                           vpr_setup.AnalysisOpts);
+            analysis_tasks.push_back([&]() {
+                netlist_writer(atom_ctx.nlist.netlist_name().c_str(), analysis_delay_calc,
+                               vpr_setup.AnalysisOpts);
+            });
         }
 
         //Write the post-implementation merged netlist
         if (vpr_setup.AnalysisOpts.gen_post_implementation_merged_netlist) {
-            merged_netlist_writer(atom_ctx.nlist.netlist_name().c_str(), analysis_delay_calc, vpr_setup.AnalysisOpts);
+            analysis_tasks.push_back([&]() {
+                merged_netlist_writer(atom_ctx.nlist.netlist_name().c_str(), analysis_delay_calc, vpr_setup.AnalysisOpts);
+            });
         }
 
         //Do power analysis
         // TODO: Still assumes that cluster net list is used
         if (vpr_setup.PowerOpts.do_power) {
-            vpr_power_estimation(vpr_setup, Arch, *timing_info, route_status);
+            analysis_tasks.push_back([&]() {
+                vpr_power_estimation(vpr_setup, Arch, *timing_info, route_status);
+            });
+        }
+    }
+
+    run_analysis_tasks(analysis_tasks, vpr_setup.AnalysisOpts.parallel_analysis);
+
+    report_memory_usage("Analysis", analysis_memory_usage);
+}
+
+/* Runs the post-routing analysis tasks in order, or with parallel (and TBB) concurrently.
+ * Their log messages are buffered and printed in task order, so the log matches a serial run.
+ * The tasks may share the analysis delay calculator: the timing analysis already calculated
+ * (and cached) all its delays, so the tasks only look them up. */
+static void run_analysis_tasks(const std::vector<std::function<void()>>& tasks, bool parallel) {
+#ifdef VPR_USE_TBB
+    if (parallel && tasks.size() > 1) {
+        tbb::task_group task_group;
+        for (size_t itask = 0; itask < tasks.size(); ++itask) {
+            task_group.run([&tasks, itask]() {
+                vtr::ScopedLogBuffer log_buffer(itask);
+                tasks[itask]();
+            });
         }
+        try {
+            task_group.wait();
+        } catch (...) {
+            vtr::flush_log_buffers();
+            throw;
+        }
+        vtr::flush_log_buffers();
+        return;
+    }
+#else
+    (void)parallel;
+#endif
+    for (const auto& task : tasks) {
+        task();
     }
 }
 
@@ -1585,3 +1954,44 @@ void vpr_print_error(const VprError& vpr_error) {
                   error_type, filename.c_str(), vpr_error.line(),
                   msg.c_str());
 }
+
+/**
+ * @brief Starts computing the router lookahead in the background, if --overlap_route_setup allows it
+ *
+ * The lookahead only reads the device (the RR graph built for --place_chan_width), so it can be
+ * computed while the circuit is placed, as long as the placer does not need it itself
+ * (timing-driven placement) and the router uses the same RR graph (same fixed channel width,
+ * no flat routing). Returns an empty future if the lookahead is left to the router.
+ */
+static std::future<void> start_route_setup(const t_vpr_setup& vpr_setup) {
+    const t_router_opts& router_opts = vpr_setup.RouterOpts;
+    const t_placer_opts& placer_opts = vpr_setup.PlacerOpts;
+    if (!router_opts.overlap_route_setup
+        || router_opts.doRouting != STAGE_DO
+        || router_opts.flat_routing
+        || placer_opts.place_chan_width == NO_FIXED_CHANNEL_WIDTH
+        || router_opts.fixed_channel_width != placer_opts.place_chan_width
+        || (placer_opts.doPlacement == STAGE_DO && placer_needs_lookahead(vpr_setup))
+        || g_vpr_ctx.device().rr_graph.num_nodes() == 0) {
+        return std::future<void>();
+    }
+
+    VTR_LOG("Computing the router lookahead in the background during placement\n");
+    return std::async(std::launch::async, [&vpr_setup]() {
+        get_cached_router_lookahead(vpr_setup.RoutingArch,
+                                    vpr_setup.RouterOpts.lookahead_type,
+                                    vpr_setup.RouterOpts.base_cost_type,
+                                    vpr_setup.RouterOpts.write_router_lookahead,
+                                    vpr_setup.RouterOpts.read_router_lookahead,
+                                    vpr_setup.Segments,
+                                    false);
+    });
+}
+
+///@brief Returns true if result is better than best_result: by critical path delay first (if timing-driven), then by wiring cost
+static bool is_better_placement(const t_place_result& result, const t_place_result& best_result) {
+    if (!std::isnan(result.cpd) && result.cpd != best_result.cpd) {
+        return result.cpd < best_result.cpd;
+    }
+    return result.bb_cost < best_result.bb_cost;
+}
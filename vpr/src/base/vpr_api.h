@@ -27,6 +27,7 @@
 #ifndef VPR_API_H
 #define VPR_API_H
 
+#include <memory>
 #include <vector>
 #include "physical_types.h"
 #include "vpr_types.h"
@@ -41,6 +42,8 @@
 
 #include "vpr_error.h"
 
+class PlaceDelayModel;
+
 /*
  * Main VPR Operations
  */
@@ -48,6 +51,15 @@ void vpr_init(const int argc, const char** argv, t_options* options, t_vpr_setup
 void vpr_initialize_logging();
 void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_arch* arch);
 
+/**
+ * @brief Reads the (VTR format) architecture file once, so that vpr_init_with_options()
+ *        can skip re-reading it when it is the architecture of the run
+ *
+ * Used by the server mode (see vpr_server.h), which preloads the architecture before
+ * forking a process for each job.
+ */
+void vpr_preload_arch(const std::string& arch_file);
+
 bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch); //Run the VPR CAD flow
 
 /*
@@ -73,6 +85,17 @@ bool vpr_place_flow(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_a
 ///@brief Perform placement
 void vpr_place(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_arch& arch);
 
+/**
+ * @brief Perform placement with the placement delay model place_delay_model
+ *
+ * The delay model is computed (and kept in place_delay_model) if it is null and the
+ * placement is timing-driven, so it can be shared by several placements.
+ */
+void vpr_place(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_arch& arch, std::unique_ptr<PlaceDelayModel>& place_delay_model);
+
+///@brief Computes the placement delay model (or returns null if the placement is not timing-driven)
+std::unique_ptr<PlaceDelayModel> vpr_alloc_place_delay_model(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_arch& arch);
+
 ///@brief Loads a previous placement
 void vpr_load_placement(t_vpr_setup& vpr_setup, const t_arch& arch);
 
@@ -52,10 +52,8 @@ int VprConstraints::get_num_partitions() {
     return partitions.size();
 }
 
-PartitionRegion VprConstraints::get_partition_pr(PartitionId part_id) {
-    PartitionRegion pr;
-    pr = partitions[part_id].get_part_region();
-    return pr;
+const PartitionRegion& VprConstraints::get_partition_pr(PartitionId part_id) const {
+    return partitions[part_id].get_part_region();
 }
 
 void print_constraints(FILE* fp, VprConstraints constraints) {
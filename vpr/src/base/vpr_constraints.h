@@ -85,7 +85,7 @@ class VprConstraints {
      *
      *   @param part_id The id of the partition whose PartitionRegion is needed
      */
-    PartitionRegion get_partition_pr(PartitionId part_id);
+    const PartitionRegion& get_partition_pr(PartitionId part_id) const;
 
   private:
     /**
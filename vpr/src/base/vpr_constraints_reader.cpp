@@ -33,11 +33,9 @@ void load_vpr_constraints_file(const char* read_vpr_constraints_name) {
 
     //Update the floorplanning constraints in the floorplanning constraints context
     auto& floorplanning_ctx = g_vpr_ctx.mutable_floorplanning();
-    floorplanning_ctx.constraints = reader.constraints_;
-
-    VprConstraints ctx_constraints = floorplanning_ctx.constraints;
+    floorplanning_ctx.constraints = std::move(reader.constraints_);
 
     if (getEchoEnabled() && isEchoFileEnabled(E_ECHO_VPR_CONSTRAINTS)) {
-        echo_constraints(getEchoFileName(E_ECHO_VPR_CONSTRAINTS), ctx_constraints);
+        echo_constraints(getEchoFileName(E_ECHO_VPR_CONSTRAINTS), floorplanning_ctx.constraints);
     }
 }
@@ -117,34 +117,12 @@ class VprConstraintsSerializer final : public uxsd::VprConstraintsBase<VprConstr
 
     virtual inline void set_add_atom_name_pattern(const char* name_pattern, void*& /*ctx*/) final {
         auto& atom_ctx = g_vpr_ctx.atom();
-        std::string atom_name = name_pattern;
-
-        auto atom_name_regex = std::regex(atom_name);
-
-        atoms_.clear();
-
-        atom_id_ = atom_ctx.nlist.find_block(name_pattern);
 
         /* The constraints file may either provide a specific atom name or a regex.
-         * If the a valid atom ID is found for the atom name, then a specific atom name
-         * must have been read in from the file. The if condition checks for this case.
-         * The else statement checks for atoms that may match a regex.
-         * This code may get slow if many regexes are given in the file.
+         * Specific atom names are looked up directly, and only other patterns are
+         * searched for in all the atom names.
          */
-        if (atom_id_ != AtomBlockId::INVALID()) {
-            atoms_.push_back(atom_id_);
-        } else {
-            /*If the atom name returns an invalid ID, it might be a regular expression, so loop through the atoms blocks
-             * and see if any block names match atom_name_regex.
-             */
-            for (auto block_id : atom_ctx.nlist.blocks()) {
-                auto block_name = atom_ctx.nlist.block_name(block_id);
-
-                if (std::regex_search(block_name, atom_name_regex)) {
-                    atoms_.push_back(block_id);
-                }
-            }
-        }
+        atoms_ = find_name_pattern_atoms(atom_ctx.nlist, name_pattern);
 
         /*If the atoms_ vector is empty by this point, no atoms were found that matched the name,
          * so the name is invalid.
@@ -250,14 +228,10 @@ class VprConstraintsSerializer final : public uxsd::VprConstraintsBase<VprConstr
     }
 
     virtual inline size_t num_partition_add_region(partition_info& part_info) final {
-        PartitionRegion pr = part_info.part.get_part_region();
-        std::vector<Region> regions = pr.get_partition_region();
-        return regions.size();
+        return part_info.part.get_part_region().get_partition_region().size();
     }
     virtual inline Region get_partition_add_region(int n, partition_info& part_info) final {
-        PartitionRegion pr = part_info.part.get_part_region();
-        std::vector<Region> regions = pr.get_partition_region();
-        return regions[n];
+        return part_info.part.get_part_region().get_partition_region()[n];
     }
 
     /** Generated for complex type "partition_list":
@@ -363,7 +337,6 @@ class VprConstraintsSerializer final : public uxsd::VprConstraintsBase<VprConstr
     int num_partitions_ = 0;
 
     //used when reading in atom names and regular expressions for atoms
-    AtomBlockId atom_id_;
     std::vector<AtomBlockId> atoms_;
 };
 
@@ -18,12 +18,14 @@
 #include "rr_rc_data.h"
 #include "tatum/TimingGraph.hpp"
 #include "tatum/TimingConstraints.hpp"
+#include "timing_metrics.h"
 #include "power.h"
 #include "power_components.h"
 #include "device_grid.h"
 #include "clock_network_builders.h"
 #include "clock_connection_builders.h"
 #include "route_tree.h"
+#include "clock_route_templates.h"
 #include "router_lookahead.h"
 #include "place_macro.h"
 #include "compressed_grid.h"
@@ -32,6 +34,7 @@
 #include "noc_storage.h"
 #include "noc_traffic_flows.h"
 #include "noc_routing.h"
+#include "pack_stats.h"
 
 /**
  * @brief A Context is collection of state relating to a particular part of VPR
@@ -117,6 +120,13 @@ struct TimingContext : public Context {
 
     t_timing_analysis_profile_info stats;
 
+    /**
+     * @brief Log of the timing after each timing update in the placer and router (see --write_timing_metrics).
+     *
+     * Null if no timing metrics are being written.
+     */
+    std::shared_ptr<TimingMetricsLog> metrics_log;
+
     /* Represents whether or not VPR should fail if timing constraints aren't met. */
     bool terminate_if_timing_fails = false;
 };
@@ -310,6 +320,9 @@ struct ClusteringContext : public Context {
      */
     std::map<ClusterBlockId, std::map<int, ClusterNetId>> post_routing_clb_pin_nets;
     std::map<ClusterBlockId, std::map<int, int>> pre_routing_net_pin_mapping;
+
+    ///@brief The contents of the packed netlist file just written by the packer, until they are loaded
+    std::string packed_netlist_contents;
 };
 
 /**
@@ -335,6 +348,25 @@ struct ClusteringHelperContext : public Context {
     bool enable_pin_feasibility_filter;
     int feasible_block_array_size;
 
+    // whether intra-cluster routes first keep the last legal routing of the unchanged nets
+    bool incremental_intra_lb_route = false;
+
+    // For each high fanout net explored for candidates, the index of its first pin which may be on an atom
+    // outside the closed clusters (all the pins before are on atoms of closed clusters, and are skipped).
+    // Cleared whenever a closed cluster is undone, as its atoms are unclustered again
+    std::unordered_map<AtomNetId, size_t> high_fanout_net_first_open_pin;
+
+    // Work done updating the gains of the open cluster, reported at the end of clustering.
+    // The pins visited are used as a measure of the time spent, as timing each update would cost more than the update
+    size_t num_gain_updates = 0;                          // gain updates of the low fanout nets
+    size_t num_gain_update_pins = 0;                      // pins visited by those updates
+    size_t num_high_fanout_gain_updates = 0;              // gain updates skipped on high fanout nets
+    size_t num_high_fanout_candidate_pins = 0;            // pins visited looking for candidates on high fanout nets
+    vtr::vector<AtomNetId, size_t> net_gain_update_pins;  // pins visited by the gain updates and candidate searches of each net
+
+    // Per-phase timing and per-type counters of the clusterer (see --pack_stats_file)
+    PackStats pack_stats;
+
     // total number of CLBs
     int total_clb_num;
 
@@ -390,6 +422,14 @@ struct PlacementContext : public Context {
      */
     t_compressed_block_grids compressed_block_grids;
 
+    /**
+     * @brief The compressed locations within the floorplan region of each block
+     *
+     * Index of the block's entry in compressed_block_grids[block type].region_locs,
+     * or OPEN if the block is not floorplan constrained. See load_block_region_locs().
+     */
+    vtr::vector<ClusterBlockId, int> block_region_locs;
+
     /**
      * @brief SHA256 digest of the .place file
      *
@@ -430,6 +470,12 @@ struct RoutingContext : public Context {
 
     vtr::vector<RRNodeId, t_rr_node_route_inf> rr_node_route_inf; /* [0..device_ctx.num_rr_nodes-1] */
 
+    ///@brief Several threads may update the occupancy of the same rr_node at once (see --router_speculative_parallel)
+    bool concurrent_occupancy_updates = false;
+
+    ///@brief The path search state of the routers which do not search their own copy
+    vtr::vector<RRNodeId, t_rr_node_path_inf> rr_node_path_inf; /* [0..device_ctx.num_rr_nodes-1] */
+
     vtr::vector<ParentNetId, std::vector<std::vector<int>>> net_terminal_groups;
 
     vtr::vector<ParentNetId, std::vector<int>> net_terminal_group_num;
@@ -445,6 +491,30 @@ struct RoutingContext : public Context {
      */
     vtr::dynamic_bitset<RRNodeId> non_configurable_bitset; /*[0...device_ctx.num_rr_nodes] */
 
+    /**
+     * @brief The RR nodes which may be overused
+     *
+     * A node is added when its occupancy grows over its capacity, and dropped when the
+     * pathfinder acc_cost update finds it no longer overused. Since occupancy only
+     * decreases otherwise, every overused node is in the list, and the congestion
+     * updates visit these nodes instead of the whole RR graph.
+     * is_overuse_candidate flags the nodes in the list [0...device_ctx.num_rr_nodes-1].
+     * The parallel router claims the flags with an atomic exchange, since nets routed
+     * concurrently may share nodes (see --router_speculative_parallel).
+     */
+    std::vector<RRNodeId> overuse_candidates;
+    vtr::vector<RRNodeId, uint8_t> is_overuse_candidate;
+    ///@brief Guards overuse_candidates, the parallel router updates occupancies from several threads
+    std::mutex overuse_candidates_mutex;
+
+    /**
+     * @brief Paths from the clock network drive points to the clock network sinks
+     *
+     * Built before routing when clock nets are routed in two stages, and used by the
+     * second stage. Empty otherwise.
+     */
+    ClockRouteTemplates clock_route_templates;
+
     ///@brief Information about current routing status of each net
     t_net_routing_status net_status;
 
@@ -0,0 +1,580 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "vtr_log.h"
+#include "vtr_error.h"
+
+#include "argparse.hpp"
+
+#include "vpr_server.h"
+#include "vpr_api.h"
+#include "vpr_error.h"
+#include "vpr_exit_codes.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <fcntl.h>
+#    include <sys/wait.h>
+#    include <unistd.h>
+#    define VPR_SERVER_SUPPORTED
+#endif
+
+#ifdef VPR_SERVER_SUPPORTED
+
+namespace {
+
+///@brief A parsed JSON value
+struct t_json_value {
+    enum class e_type {
+        NUL,
+        BOOL,
+        NUMBER,
+        STRING,
+        ARRAY,
+        OBJECT
+    };
+
+    e_type type = e_type::NUL;
+    std::string text; //Contents of a string, or the literal text of a number or bool
+    std::vector<t_json_value> items;
+    std::vector<std::pair<std::string, t_json_value>> members;
+};
+
+///@brief Parses (just enough of) JSON for the server requests
+class JsonParser {
+  public:
+    explicit JsonParser(const std::string& text)
+        : text_(text) {}
+
+    t_json_value parse() {
+        t_json_value value = parse_value();
+        skip_space();
+        if (pos_ != text_.size()) {
+            error("unexpected trailing characters");
+        }
+        return value;
+    }
+
+  private:
+    t_json_value parse_value() {
+        skip_space();
+        t_json_value value;
+        char c = peek();
+        if (c == '{') {
+            value.type = t_json_value::e_type::OBJECT;
+            ++pos_;
+            if (!consume('}')) {
+                do {
+                    skip_space();
+                    std::string name = parse_string();
+                    skip_space();
+                    expect(':');
+                    value.members.emplace_back(std::move(name), parse_value());
+                    skip_space();
+                } while (consume(','));
+                expect('}');
+            }
+        } else if (c == '[') {
+            value.type = t_json_value::e_type::ARRAY;
+            ++pos_;
+            if (!consume(']')) {
+                do {
+                    value.items.push_back(parse_value());
+                    skip_space();
+                } while (consume(','));
+                expect(']');
+            }
+        } else if (c == '"') {
+            value.type = t_json_value::e_type::STRING;
+            value.text = parse_string();
+        } else {
+            size_t start = pos_;
+            while (pos_ < text_.size() && (std::isalnum(text_[pos_]) || text_[pos_] == '-' || text_[pos_] == '+' || text_[pos_] == '.')) {
+                ++pos_;
+            }
+            value.text = text_.substr(start, pos_ - start);
+            if (value.text == "null") {
+                value.type = t_json_value::e_type::NUL;
+            } else if (value.text == "true" || value.text == "false") {
+                value.type = t_json_value::e_type::BOOL;
+            } else if (is_number(value.text)) {
+                value.type = t_json_value::e_type::NUMBER;
+            } else {
+                error("expected a value");
+            }
+        }
+        return value;
+    }
+
+    std::string parse_string() {
+        expect('"');
+        std::string str;
+        while (true) {
+            if (pos_ >= text_.size()) {
+                error("unterminated string");
+            }
+            char c = text_[pos_++];
+            if (c == '"') {
+                break;
+            } else if (c != '\\') {
+                str += c;
+                continue;
+            }
+
+            if (pos_ >= text_.size()) {
+                error("unterminated string");
+            }
+            char escaped = text_[pos_++];
+            switch (escaped) {
+                case '"':
+                case '\\':
+                case '/':
+                    str += escaped;
+                    break;
+                case 'b':
+                    str += '\b';
+                    break;
+                case 'f':
+                    str += '\f';
+                    break;
+                case 'n':
+                    str += '\n';
+                    break;
+                case 'r':
+                    str += '\r';
+                    break;
+                case 't':
+                    str += '\t';
+                    break;
+                case 'u':
+                    append_utf8(str, parse_hex4());
+                    break;
+                default:
+                    error("invalid escape sequence");
+            }
+        }
+        return str;
+    }
+
+    unsigned parse_hex4() {
+        if (pos_ + 4 > text_.size()) {
+            error("invalid unicode escape");
+        }
+        unsigned code = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = text_[pos_++];
+            code <<= 4;
+            if (c >= '0' && c <= '9') {
+                code |= c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                code |= c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                code |= c - 'A' + 10;
+            } else {
+                error("invalid unicode escape");
+            }
+        }
+        return code;
+    }
+
+    ///@brief Returns true if text is a JSON number: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    static bool is_number(const std::string& text) {
+        size_t i = 0;
+        auto digits = [&]() {
+            size_t start = i;
+            while (i < text.size() && std::isdigit(text[i])) {
+                ++i;
+            }
+            return i - start;
+        };
+
+        if (i < text.size() && text[i] == '-') {
+            ++i;
+        }
+        if (i < text.size() && text[i] == '0') {
+            ++i;
+        } else if (digits() == 0) {
+            return false;
+        }
+        if (i < text.size() && text[i] == '.') {
+            ++i;
+            if (digits() == 0) {
+                return false;
+            }
+        }
+        if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+            ++i;
+            if (i < text.size() && (text[i] == '+' || text[i] == '-')) {
+                ++i;
+            }
+            if (digits() == 0) {
+                return false;
+            }
+        }
+        return i == text.size();
+    }
+
+    ///@brief Appends a basic multilingual plane code point (file names rarely need more)
+    static void append_utf8(std::string& str, unsigned code) {
+        if (code < 0x80) {
+            str += char(code);
+        } else if (code < 0x800) {
+            str += char(0xC0 | (code >> 6));
+            str += char(0x80 | (code & 0x3F));
+        } else {
+            str += char(0xE0 | (code >> 12));
+            str += char(0x80 | ((code >> 6) & 0x3F));
+            str += char(0x80 | (code & 0x3F));
+        }
+    }
+
+    void skip_space() {
+        while (pos_ < text_.size() && std::isspace(text_[pos_])) {
+            ++pos_;
+        }
+    }
+
+    char peek() const {
+        return pos_ < text_.size() ? text_[pos_] : '\0';
+    }
+
+    bool consume(char c) {
+        skip_space();
+        if (peek() == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!consume(c)) {
+            error(std::string("expected '") + c + "'");
+        }
+    }
+
+    [[noreturn]] void error(const std::string& msg) const {
+        VPR_THROW(VPR_ERROR_OTHER, "Invalid JSON at character %zu: %s", pos_, msg.c_str());
+    }
+
+    const std::string& text_;
+    size_t pos_ = 0;
+};
+
+///@brief Returns str as a (quoted and escaped) JSON string
+std::string json_string(const std::string& str) {
+    std::string escaped = "\"";
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            escaped += buf;
+        } else {
+            escaped += c;
+        }
+    }
+    escaped += '"';
+    return escaped;
+}
+
+struct t_job_request {
+    std::string id; //As JSON
+    std::vector<std::string> args;
+    std::string cwd;
+    std::string log_file = "vpr_stdout.log";
+};
+
+t_job_request parse_job_request(const std::string& line) {
+    t_json_value request = JsonParser(line).parse();
+    if (request.type != t_json_value::e_type::OBJECT) {
+        VPR_THROW(VPR_ERROR_OTHER, "The request must be a JSON object");
+    }
+
+    t_job_request job;
+    for (const auto& member : request.members) {
+        const t_json_value& value = member.second;
+        if (member.first == "id") {
+            //Echoed back in the responses, so only strings and (validated) numbers are accepted
+            if (value.type == t_json_value::e_type::STRING) {
+                job.id = json_string(value.text);
+            } else if (value.type == t_json_value::e_type::NUMBER) {
+                job.id = value.text;
+            } else {
+                VPR_THROW(VPR_ERROR_OTHER, "The id of a request must be a string or a number");
+            }
+        } else if (member.first == "args" && value.type == t_json_value::e_type::ARRAY) {
+            for (const t_json_value& arg : value.items) {
+                if (arg.type != t_json_value::e_type::STRING) {
+                    VPR_THROW(VPR_ERROR_OTHER, "The args of a request must be strings");
+                }
+                job.args.push_back(arg.text);
+            }
+        } else if (member.first == "cwd" && value.type == t_json_value::e_type::STRING) {
+            job.cwd = value.text;
+        } else if (member.first == "log_file" && value.type == t_json_value::e_type::STRING) {
+            job.log_file = value.text;
+        } else {
+            VPR_THROW(VPR_ERROR_OTHER, "Unexpected request member '%s'", member.first.c_str());
+        }
+    }
+
+    if (job.args.empty()) {
+        VPR_THROW(VPR_ERROR_OTHER, "The request has no args");
+    }
+    return job;
+}
+
+const char* exit_status_name(int exit_code) {
+    switch (exit_code) {
+        case SUCCESS_EXIT_CODE:
+            return "success";
+        case UNIMPLEMENTABLE_EXIT_CODE:
+            return "unimplementable";
+        case INTERRUPTED_EXIT_CODE:
+            return "interrupted";
+        default:
+            return "error";
+    }
+}
+
+///@brief Forks a process for each job, and responds once each finishes
+class JobServer {
+  public:
+    JobServer(FILE* responses, size_t max_jobs, std::string artifact_cache_dir, const t_vpr_job_runner& run_job)
+        : responses_(responses)
+        , max_jobs_(std::max<size_t>(max_jobs, 1))
+        , artifact_cache_dir_(std::move(artifact_cache_dir))
+        , run_job_(run_job)
+        , reaper_([this]() { reap(); }) {}
+
+    ///@brief Starts the job of a request line, waiting while the maximum number of jobs are running
+    void submit(const std::string& line) {
+        ++num_requests_;
+
+        t_job_request job;
+        try {
+            job = parse_job_request(line);
+        } catch (const VprError& error) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            respond(std::to_string(num_requests_), "error", ERROR_EXIT_CODE, 0., error.what());
+            return;
+        }
+        if (job.id.empty()) {
+            job.id = std::to_string(num_requests_);
+        }
+
+        //Share the device artifacts of all jobs
+        if (!artifact_cache_dir_.empty()
+            && std::find(job.args.begin(), job.args.end(), "--artifact_cache_dir") == job.args.end()) {
+            job.args.push_back("--artifact_cache_dir");
+            job.args.push_back(artifact_cache_dir_);
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        running_changed_.wait(lock, [&]() { return running_.size() < max_jobs_; });
+
+        //Nothing buffered may be inherited (and so written again) by the job
+        fflush(stdout);
+        fflush(stderr);
+
+        pid_t pid = fork();
+        if (pid == 0) {
+            run_job_process(job);
+        } else if (pid < 0) {
+            respond(job.id, "error", ERROR_EXIT_CODE, 0., "Failed to fork the job process");
+            return;
+        }
+
+        VTR_LOG("Started job %s (pid %d)\n", job.id.c_str(), int(pid));
+        running_[pid] = {job.id, std::chrono::steady_clock::now()};
+        running_changed_.notify_all();
+    }
+
+    ///@brief Waits for all the jobs to finish
+    void wait() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            input_done_ = true;
+            running_changed_.notify_all();
+        }
+        reaper_.join();
+    }
+
+  private:
+    struct t_running_job {
+        std::string id;
+        std::chrono::steady_clock::time_point start_time;
+    };
+
+    ///@brief Runs a job in the forked process
+    [[noreturn]] void run_job_process(const t_job_request& job) {
+        close(fileno(responses_));
+
+        if (!job.cwd.empty() && chdir(job.cwd.c_str()) != 0) {
+            std::fprintf(stderr, "Job %s: failed to change to directory '%s'\n", job.id.c_str(), job.cwd.c_str());
+            std::_Exit(ERROR_EXIT_CODE);
+        }
+
+        int log_fd = open(job.log_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (log_fd < 0) {
+            std::fprintf(stderr, "Job %s: failed to open log file '%s'\n", job.id.c_str(), job.log_file.c_str());
+            std::_Exit(ERROR_EXIT_CODE);
+        }
+        dup2(log_fd, STDOUT_FILENO);
+        dup2(log_fd, STDERR_FILENO);
+        close(log_fd);
+
+        //All the output already goes to the log file
+        setenv("VPR_LOG_FILE", "", 1);
+
+        std::vector<const char*> argv = {"vpr"};
+        for (const std::string& arg : job.args) {
+            argv.push_back(arg.c_str());
+        }
+        int exit_code = run_job_(int(argv.size()), argv.data());
+
+        std::exit(exit_code);
+    }
+
+    ///@brief Responds to the jobs as they finish, until all requested jobs are done
+    void reap() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                running_changed_.wait(lock, [&]() { return !running_.empty() || input_done_; });
+                if (running_.empty()) {
+                    return; //No more input
+                }
+            }
+
+            int status = 0;
+            pid_t pid = waitpid(-1, &status, 0);
+            if (pid < 0) {
+                continue; //Interrupted
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto iter = running_.find(pid);
+            if (iter == running_.end()) {
+                continue;
+            }
+
+            std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - iter->second.start_time;
+            float wall_sec = elapsed.count();
+            if (WIFEXITED(status)) {
+                int exit_code = WEXITSTATUS(status);
+                respond(iter->second.id, exit_status_name(exit_code), exit_code, wall_sec, "");
+            } else {
+                std::string message = "Terminated by signal " + std::to_string(WIFSIGNALED(status) ? WTERMSIG(status) : 0);
+                respond(iter->second.id, "crashed", ERROR_EXIT_CODE, wall_sec, message);
+            }
+            VTR_LOG("Finished job %s in %.2f seconds\n", iter->second.id.c_str(), wall_sec);
+
+            running_.erase(iter);
+            running_changed_.notify_all();
+        }
+    }
+
+    ///@brief Writes the response of a job, with mutex_ locked
+    void respond(const std::string& id, const char* status, int exit_code, float wall_sec, const std::string& message) {
+        std::fprintf(responses_, "{\"id\": %s, \"status\": \"%s\", \"exit_code\": %d, \"wall_sec\": %.3f",
+                     id.c_str(), status, exit_code, wall_sec);
+        if (!message.empty()) {
+            std::fprintf(responses_, ", \"message\": %s", json_string(message).c_str());
+        }
+        std::fprintf(responses_, "}\n");
+        std::fflush(responses_);
+    }
+
+    FILE* responses_;
+    size_t max_jobs_;
+    std::string artifact_cache_dir_;
+    const t_vpr_job_runner& run_job_;
+
+    size_t num_requests_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable running_changed_;
+    std::map<pid_t, t_running_job> running_;
+    bool input_done_ = false;
+
+    std::thread reaper_; //Last, so it starts once the rest is initialized
+};
+
+} // namespace
+
+int vpr_server(int argc, const char** argv, const t_vpr_job_runner& run_job) {
+    argparse::ArgValue<std::string> arch_file;
+    argparse::ArgValue<size_t> max_jobs;
+    argparse::ArgValue<std::string> artifact_cache_dir;
+
+    auto parser = argparse::ArgumentParser("vpr --server",
+                                           "Runs the VPR jobs requested (one JSON object per line) on stdin,"
+                                           " writing a JSON response line for each to stdout.");
+    parser.add_argument(arch_file, "--arch")
+        .help("Architecture file read once, and used by all the jobs which use it")
+        .default_value("");
+    parser.add_argument<size_t>(max_jobs, "--jobs")
+        .help("Maximum number of jobs run concurrently")
+        .default_value("1");
+    parser.add_argument(artifact_cache_dir, "--artifact_cache_dir")
+        .help("Artifact cache directory added to the jobs which do not specify one (see vpr --artifact_cache_dir)")
+        .default_value("");
+    parser.parse_args(argc, argv);
+
+    //Keep stdout for the responses, and send the server's own messages to stderr
+    std::fflush(stdout);
+    FILE* responses = fdopen(dup(STDOUT_FILENO), "w");
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+    vtr::set_log_file(nullptr);
+
+    std::string cache_dir = artifact_cache_dir.value();
+    if (!cache_dir.empty()) {
+        //Jobs may run in other directories
+        cache_dir = std::filesystem::absolute(cache_dir).string();
+    }
+
+    try {
+        if (!arch_file.value().empty()) {
+            vpr_preload_arch(arch_file.value());
+        }
+    } catch (const vtr::VtrError& error) {
+        VTR_LOG_ERROR("%s:%d %s\n", error.filename_c_str(), error.line(), error.what());
+        return ERROR_EXIT_CODE;
+    }
+
+    JobServer server(responses, max_jobs.value(), cache_dir, run_job);
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        server.submit(line);
+    }
+    server.wait();
+
+    std::fclose(responses);
+    return SUCCESS_EXIT_CODE;
+}
+
+#else
+
+int vpr_server(int /*argc*/, const char** /*argv*/, const t_vpr_job_runner& /*run_job*/) {
+    VTR_LOG_ERROR("The VPR server mode is only supported on POSIX systems\n");
+    return ERROR_EXIT_CODE;
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef VPR_SERVER_H
+#define VPR_SERVER_H
+
+/**
+ * @file
+ * @brief A long-running VPR server, which runs a stream of jobs without re-reading the architecture for each
+ *
+ * Started with:
+ *
+ *      vpr --server [--arch <arch_file>] [--jobs <N>] [--artifact_cache_dir <dir>]
+ *
+ * the server reads one JSON request per line from stdin, e.g.:
+ *
+ *      {"id": 1, "args": ["k6_frac_N10_40nm.xml", "tseng.blif", "--route_chan_width", "100"], "cwd": "run1"}
+ *
+ * where args are the VPR command-line arguments of the job, and the optional cwd and
+ * log_file (default vpr_stdout.log, relative to cwd) members give the directory the job
+ * runs in and the file its output is written to. Once the job finishes the server writes
+ * one JSON response line to stdout, e.g.:
+ *
+ *      {"id": 1, "status": "success", "exit_code": 0, "wall_sec": 12.5}
+ *
+ * with status one of success, unimplementable, error, interrupted or crashed (matching
+ * the VPR exit codes). Responses are written in the order the jobs finish. The server
+ * exits once stdin is closed and all jobs have finished.
+ *
+ * Each job runs in a process forked from the server, so the jobs are fully isolated
+ * from each other (VPR keeps its state in the global g_vpr_ctx), and up to --jobs of
+ * them run concurrently. The state the server prepares before forking is shared (copy
+ * on write) by all the jobs:
+ *  - The --arch architecture is read once, and is used by all the jobs run with that
+ *    (unmodified) architecture file and timing analysis enabled.
+ *  - The device artifacts (RR graph, router lookahead and placement delay model) are
+ *    shared through the artifact cache: --artifact_cache_dir is added to the jobs which
+ *    do not specify one, so after the first job of a device the others memory-map them.
+ *
+ * Only available on POSIX systems.
+ */
+
+#include <functional>
+
+///@brief Runs a VPR job from its command-line, returning its exit code
+typedef std::function<int(int argc, const char** argv)> t_vpr_job_runner;
+
+/**
+ * @brief Runs the server (see above) with its command-line arguments (argv[0] being --server),
+ *        calling run_job for each job, and returns the exit code of the server
+ */
+int vpr_server(int argc, const char** argv, const t_vpr_job_runner& run_job);
+
+#endif
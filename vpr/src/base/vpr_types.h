@@ -35,6 +35,7 @@
 #include "clock_modeling.h"
 #include "heap_type.h"
 
+#include "vtr_arena.h"
 #include "vtr_assert.h"
 #include "vtr_ndmatrix.h"
 #include "vtr_vector.h"
@@ -285,6 +286,19 @@ class t_pb {
 
     int clock_net = 0; ///<Records clock net driving a flip-flop, valid only for lowest-level, flip-flop PBs
 
+    /**
+     * @brief The atom block last mapped to this pb, only written by AtomLookup::set_atom_pb()
+     *
+     * This is the reverse side of the atom <-> pb mapping, read in O(1) by AtomLookup::pb_atom()
+     * (instead of hashing the pb pointer). It is only valid if the atom maps back to this pb. */
+    mutable AtomBlockId lookup_atom = AtomBlockId::INVALID();
+
+    ///@brief Allocated from vtr::Arena, since the packer creates and frees many pbs (and child pb arrays)
+    static void* operator new(size_t size) { return vtr::Arena::allocate(size); }
+    static void* operator new[](size_t size) { return vtr::Arena::allocate(size); }
+    static void operator delete(void* ptr, size_t size) { vtr::Arena::deallocate(ptr, size); }
+    static void operator delete[](void* ptr, size_t size) { vtr::Arena::deallocate(ptr, size); }
+
     // Member functions
 
     ///@brief Returns true if this block has not parent pb block
@@ -428,6 +442,9 @@ struct t_chain_info {
     t_pack_molecule* first_packed_molecule = nullptr;
 };
 
+///@brief A set of primitive pb_types of a cluster, as a bitset indexed by t_cluster_placement_primitive::pb_type_index
+typedef uint64_t t_pb_type_signature;
+
 /**
  * @brief Stats keeper for placement information during packing
  *
@@ -439,6 +456,12 @@ class t_cluster_placement_stats {
     bool has_long_chain;                  ///<specifies if this cluster has a molecule placed in it that belongs to a long chain (a chain that spans more than one cluster)
     const t_pack_molecule* curr_molecule; ///<current molecule being considered for packing
 
+    // Signatures of the primitives left in the cluster, which quickly reject molecules that can not fit (see molecule_fits_free_primitives())
+    std::vector<const t_pb_type*> primitive_pb_types;                     ///<The primitive pb_types inside complex block, indexed by t_cluster_placement_primitive::pb_type_index
+    std::vector<int> num_free_primitives;                                 ///<Number of primitives of each pb_type not committed to the current cluster
+    t_pb_type_signature free_pb_types;                                    ///<The pb_types with free primitives
+    vtr::vector<AtomBlockId, t_pb_type_signature> atom_feasible_pb_types; ///<The pb_types each atom is feasible in, computed on first use
+
     // Vector of size num_pb_types [0.. num_pb_types-1]. Each element is an unordered_map of the cluster_placement_primitives that are of this pb_type
     // Each cluster_placement_primitive is associated with and index (key of the map) for easier lookup, insertion and deletion.
     std::vector<std::unordered_map<int, t_cluster_placement_primitive*>> valid_primitives;
@@ -898,7 +921,9 @@ struct t_file_name_opts {
     std::string out_file_prefix;
     std::string read_vpr_constraints_file;
     std::string write_vpr_constraints_file;
+    std::string write_headless_images;
     std::string write_block_usage;
+    bool netlist_snapshot;
     bool verify_file_digests;
 };
 
@@ -962,6 +987,11 @@ struct t_packer_opts {
     bool use_attraction_groups;
     int pack_num_moves;
     std::string pack_move_type;
+    int pack_parallel_routes; ///<Maximum number of cluster routes run concurrently with the growth of the next clusters
+    bool pack_incremental_intra_lb_route; ///<Whether intra-cluster routes first keep the last legal routing of the unchanged nets
+    std::string pack_stats_file;          ///<File (.json or .csv) the clusterer statistics are written to (empty if disabled)
+    float pack_stats_interval;            ///<Minimum number of seconds between two snapshots of the clusterer statistics (0 for only the last)
+    int pack_timing_update_interval;      ///<Number of clusters formed between two incremental timing updates (0 if disabled)
 };
 
 /**
@@ -990,6 +1020,13 @@ struct t_annealing_sched {
     float alpha_decay;
     float success_min;
     float success_target;
+
+    /* Fast anneal start (AUTO_SCHED and DUSTY_SCHED)                     *
+     * `fast_start` estimates the starting temperature from a sample of   *
+     * the trial moves and, for AUTO_SCHED, cools faster with fewer moves *
+     * while the success ratio stays above `fast_start_success`.          */
+    bool fast_start;
+    float fast_start_success;
 };
 
 /******************************************************************
@@ -1137,6 +1174,12 @@ enum class e_place_delta_delay_algorithm {
     DIJKSTRA_EXPANSION,
 };
 
+///@brief The global placement formulation of the analytic placer
+enum class e_analytic_placer_engine {
+    QUADRATIC,     ///<Bound2bound quadratic wirelength, solved as linear systems (SimPL/HeAP)
+    ELECTROSTATIC, ///<Weighted-average wirelength and electrostatic density, optimized by Nesterov's method (ePlace)
+};
+
 /**
  * @brief Various options for the placer.
  *
@@ -1194,6 +1237,52 @@ enum class e_place_delta_delay_algorithm {
  *   @param place_constraint_subtile
  *              True if subtiles should be specified when printing floorplan
  *              constraints. False if not.
+ *   @param place_parallel_regions
+ *              Number of regions whose moves are annealed concurrently
+ *              (1 for serial annealing).
+ *   @param place_speculative_moves
+ *              Number of candidate moves whose costs are evaluated
+ *              concurrently (1 for one move at a time).
+ *   @param place_num_seeds
+ *              Number of placements (with consecutive seeds) to run,
+ *              keeping the best.
+ *   @param seed_sweep
+ *              Number of seeds placed and routed concurrently (in forked
+ *              processes), keeping the best result.
+ *   @param place_timing_update_stats
+ *              True if the amount of work done by the placer timing
+ *              updates should be reported.
+ *   @param place_agent_batch_size
+ *              Number of move types the RL agent chooses at a time.
+ *   @param place_checkpoint_file
+ *              File the annealer state is periodically written to, to resume
+ *              an interrupted placement. Empty string means no checkpoints.
+ *   @param place_checkpoint_interval
+ *              Number of temperatures between on-disk checkpoints.
+ *   @param place_resume
+ *              Checkpoint file to resume the annealing from. Empty string
+ *              means the annealing starts from the initial placement.
+ *   @param eco_place_file
+ *              Placement of a previous version of the netlist, whose
+ *              unchanged blocks are kept in place. Empty string means
+ *              no ECO placement.
+ *   @param eco_place_region
+ *              Distance (in tiles) from the blocks placed anew within
+ *              which the kept blocks of an ECO placement stay movable.
+ *   @param place_overlap_timing_analysis
+ *              True if the timing analysis at each temperature runs on
+ *              another thread, overlapped with the annealing moves.
+ *   @param place_greedy_refine_passes
+ *              Maximum number of parallel greedy refinement passes after
+ *              the quench. 0 means no refinement.
+ *   @param place_greedy_refine_replace_quench
+ *              True if the greedy refinement runs instead of the quench.
+ *   @param place_connection_delay_cache
+ *              True if the connection delays are fetched from a per
+ *              connection cache of the delta delay table look-ups.
+ *   @param place_congestion_weight
+ *              Weight of the RUDY routing congestion cost, relative to
+ *              the wiring cost. 0 disables the congestion cost.
  *
  *
  */
@@ -1240,11 +1329,27 @@ struct t_placer_opts {
     bool RL_agent_placement;
     bool place_agent_multistate;
     bool place_checkpointing;
+    int place_parallel_regions;
+    int place_speculative_moves;
+    int place_num_seeds;
+    int seed_sweep;
+    bool place_timing_update_stats;
     int place_high_fanout_net;
     e_place_bounding_box_mode place_bounding_box_mode;
     e_agent_algorithm place_agent_algorithm;
     float place_agent_epsilon;
     float place_agent_gamma;
+    int place_agent_batch_size;
+    std::string place_checkpoint_file;
+    int place_checkpoint_interval;
+    std::string place_resume;
+    std::string eco_place_file;
+    int eco_place_region;
+    bool place_overlap_timing_analysis;
+    int place_greedy_refine_passes;
+    bool place_greedy_refine_replace_quench;
+    bool place_connection_delay_cache;
+    float place_congestion_weight;
     float place_dm_rlim;
     e_agent_space place_agent_space;
     //int place_timing_cost_func;
@@ -1275,6 +1380,12 @@ struct t_placer_opts {
      * of the annealing placer for local improvement
      */
     bool enable_analytic_placer;
+
+    ///@brief Reports the convergence and runtime of the analytic placer's solver
+    bool analytic_placer_solver_stats;
+
+    ///@brief The global placement formulation used by the analytic placer
+    e_analytic_placer_engine analytic_placer_engine;
 };
 
 /* All the parameters controlling the router's operation are in this        *
@@ -1293,6 +1404,9 @@ struct t_placer_opts {
  * min_incremental_reroute_fanout: Minimum fanout a net needs to have       *
  *              for incremental reroute to be applied to it through route   *
  *              tree pruning. Larger circuits should get larger thresholds  *
+ * incremental_reroute_all_nets_iter: Routing iteration from which nets of  *
+ *              any fanout are rerouted incrementally, i.e. only the        *
+ *              connections using overused nodes are ripped up (<0 never)   *
  * bb_factor:  Linear distance a route can go outside the net bounding      *
  *             box.                                                         *
  * route_type:  GLOBAL or DETAILED.                                         *
@@ -1322,6 +1436,11 @@ struct t_placer_opts {
  * routing_failure_predictor: sets the configuration to be used by the      *
  * routing failure predictor, how aggressive the threshold used to judge    *
  * and abort routings deemed unroutable                                     *
+ * predictor_schedule: if true the routing predictor also adapts pres_fac   *
+ * growth and the timing analysis frequency                                 *
+ * sta_skip_epsilon: timing analysis is skipped after routing iterations    *
+ * whose net delay changes can not move any criticality by more than this   *
+ * (0 disables)                                                             *
  * write_rr_graph_name: stores the file name of the output rr graph         *
  * read_rr_graph_name:  stores the file name of the rr graph to be read by vpr */
 
@@ -1384,6 +1503,7 @@ constexpr int NO_FIXED_CHANNEL_WIDTH = -1;
 
 struct t_router_opts {
     bool read_rr_edge_metadata = false;
+    bool attach_rr_graph = false;
     bool do_check_rr_graph = true;
     float first_iter_pres_fac;
     float initial_pres_fac;
@@ -1392,6 +1512,7 @@ struct t_router_opts {
     float bend_cost;
     int max_router_iterations;
     int min_incremental_reroute_fanout;
+    int incremental_reroute_all_nets_iter;
     e_incr_reroute_delay_ripup incr_reroute_delay_ripup;
     int bb_factor;
     enum e_route_type route_type;
@@ -1405,20 +1526,33 @@ struct t_router_opts {
     float criticality_exp;
     float init_wirelength_abort_threshold;
     bool verify_binary_search;
+    bool min_channel_width_warm_start; ///<Start each routing of the min channel width search from the previous one
     bool full_stats;
     bool congestion_analysis;
     bool fanout_analysis;
     bool switch_usage_analysis;
     e_stage_action doRouting;
     enum e_routing_failure_predictor routing_failure_predictor;
+    bool predictor_schedule;            ///<Use the routing predictor to adapt pres_fac growth and timing analysis frequency
+    float sta_skip_epsilon;
+    bool min_chan_width_search = false; ///<Set internally while routing as part of the minimum channel width search
     enum e_routing_budgets_algorithm routing_budgets_algorithm;
     bool save_routing_per_iteration;
     float congested_routing_iteration_threshold_frac;
     e_route_bb_update route_bb_update;
+    bool route_bb_prediction; ///<Size each net's bounding box margin from the predicted placement congestion, rather than using bb_factor for all nets
     enum e_clock_modeling clock_modeling; ///<How clock pins and nets should be handled
     bool two_stage_clock_routing;         ///<How clock nets on dedicated networks should be routed
+    bool clock_route_templates;           ///<Whether the second clock routing stage follows precomputed clock network paths
     int high_fanout_threshold;
     float high_fanout_max_slope;
+    bool high_fanout_sink_clustering; ///<Route the sinks of high fanout nets one geographic cluster at a time, after a trunk to each cluster
+    bool net_locality_order;          ///<Route the nets of similar fanout in the (Morton) order of their bounding box centres
+    int batch_max_fanout;             ///<Fanout up to which the parallel router routes nets with disjoint bounding boxes concurrently (<=0 disables)
+    bool speculative_parallel;  ///<The parallel router routes all the nets concurrently, whether or not their bounding boxes overlap
+    int bidir_search_threshold; ///<Source to sink Manhattan distance above which connections use bidirectional search (<0 disables)
+    bool hot_edge_layout;       ///<Build the packed RR edge array used when expanding nodes
+    bool compact_rr_edges;      ///<Release the RR edge source node array, recomputing edge sources on demand
     int router_debug_net;
     int router_debug_sink_rr;
     int router_debug_iteration;
@@ -1433,6 +1567,7 @@ struct t_router_opts {
 
     std::string write_router_lookahead;
     std::string read_router_lookahead;
+    std::string write_router_lookahead_profile;
 
     std::string write_intra_cluster_router_lookahead;
     std::string read_intra_cluster_router_lookahead;
@@ -1449,12 +1584,32 @@ struct t_router_opts {
     bool flat_routing;
     bool has_choking_spot;
 
+    ///@brief Compute the router lookahead in the background during placement, where possible
+    bool overlap_route_setup = false;
+
+    ///@brief Report how each parallel routing iteration would split over this many ranks (if > 1)
+    int partition_tree_report_ranks = 0;
+
+    ///@brief Routing of a previous version of the netlist whose still legal net routings are kept (if not empty)
+    std::string eco_route_file;
+
     // Options related to rr_node reordering, for testing and possible cache optimization
     e_rr_node_reorder_algorithm reorder_rr_graph_nodes_algorithm = DONT_REORDER;
     int reorder_rr_graph_nodes_threshold = 0;
     int reorder_rr_graph_nodes_seed = 1;
 };
 
+/**
+ * @brief A timing corner analyzed in addition to the nominal delays.
+ *
+ * The corner's delays are the nominal delays scaled by its derating factors.
+ */
+struct t_timing_corner {
+    std::string name;
+    float max_delay_scale; ///<Scales maximum delays and setup times (used by setup analysis)
+    float min_delay_scale; ///<Scales minimum delays and hold times (used by hold analysis)
+};
+
 struct t_analysis_opts {
     e_stage_action doAnalysis;
 
@@ -1466,10 +1621,14 @@ struct t_analysis_opts {
     int timing_report_npaths;
     e_timing_report_detail timing_report_detail;
     bool timing_report_skew;
+    std::vector<t_timing_corner> timing_corners;
     std::string echo_dot_timing_graph_node;
     std::string write_timing_summary;
+    std::string write_timing_metrics;
 
     e_timing_update_type timing_update_type;
+
+    bool parallel_analysis; ///<Run the independent post-routing analysis tasks concurrently
 };
 
 // used to store NoC specific options, when supplied as an input by the user
@@ -1523,6 +1682,8 @@ struct t_noc_opts {
  *   @param read_rr_graph_filename  File to read the RR graph from (overrides
  *             architecture)
  *   @param write_rr_graph_filename  File to write the RR graph to after generation
+ *   @param artifact_cache_dir  Directory of the artifact cache used to reuse RR graphs,
+ *             router lookaheads, placement delay models and power setup across runs (empty if disabled)
  */
 struct t_det_routing_arch {
     enum e_directionality directionality; /* UDSD by AY */
@@ -1541,6 +1702,7 @@ struct t_det_routing_arch {
 
     std::string read_rr_graph_filename;
     std::string write_rr_graph_filename;
+    std::string artifact_cache_dir;
 };
 
 /**
@@ -1691,8 +1853,12 @@ constexpr bool is_chan(e_rr_type type) { return (type == CHANX || type == CHANY)
 constexpr bool is_src_sink(e_rr_type type) { return (type == SOURCE || type == SINK); }
 
 /**
- * @brief Extra information about each rr_node needed only during routing
- *        (i.e. during the maze expansion).
+ * @brief The path search state of each rr_node, read and written on every
+ *        expansion of the maze router.
+ *
+ * Kept apart from the congestion state (t_rr_node_route_inf), so that the
+ * expansions only touch these 32 bytes per node, and so that each routing
+ * thread can search its own copy (see ConnectionRouter).
  *
  *   @param prev_node  Index of the previous node (on the lowest cost path known
  *                     to reach this node); used to generate the traceback.
@@ -1700,7 +1866,6 @@ constexpr bool is_src_sink(e_rr_type type) { return (type == SOURCE || type == S
  *   @param prev_edge  Index of the edge (from 0 to num_edges-1 of prev_node)
  *                     that was used to reach this node from the previous node.
  *                     If there is no predecessor, prev_edge = NO_PREVIOUS.
- *   @param acc_cost   Accumulated cost term from previous Pathfinder iterations.
  *   @param path_cost  Total cost of the path up to and including this node +
  *                     the expected cost to the target if the timing_driven router
  *                     is being used.
@@ -1708,23 +1873,44 @@ constexpr bool is_src_sink(e_rr_type type) { return (type == SOURCE || type == S
  *                     node.
  *   @param target_flag  Is this node a target (sink) for the current routing?
  *                     Number of times this node must be reached to fully route.
- *   @param occ        The current occupancy of the associated rr node
+ *                     Set for the net being routed, so each thread marks its own.
  */
-struct t_rr_node_route_inf {
+struct t_rr_node_path_inf {
+    /* The path search fields are only valid for the path search whose epoch they  *
+     * were stamped with: a ConnectionRouter treats the fields of any other epoch  *
+     * as reset (i.e. no path and infinite costs), see new_path_search_epoch().    */
+    uint64_t path_epoch = 0;
     RRNodeId prev_node;
     RREdgeId prev_edge;
-
-    float acc_cost;
     float path_cost;
     float backward_path_cost;
 
     short target_flag;
+};
+
+/**
+ * @brief The congestion state of each rr_node, shared by all the routing threads.
+ *
+ *   @param acc_cost   Accumulated cost term from previous Pathfinder iterations.
+ *   @param occ        The current occupancy of the associated rr node
+ *
+ * The speculative parallel router (--router_speculative_parallel) routes nets which
+ * may share rr_nodes at the same time, and then updates occ with add_occ_concurrent().
+ * occ is therefore read and written with relaxed atomic accesses, which compile to
+ * plain loads and stores, and the fields stay plain otherwise. acc_cost is only
+ * updated between the routing iterations.
+ */
+struct t_rr_node_route_inf {
+    float acc_cost;
 
   public: //Accessors
-    short occ() const { return occ_; }
+    short occ() const { return __atomic_load_n(&occ_, __ATOMIC_RELAXED); }
 
   public: //Mutators
-    void set_occ(int new_occ) { occ_ = new_occ; }
+    void set_occ(int new_occ) { __atomic_store_n(&occ_, static_cast<short>(new_occ), __ATOMIC_RELAXED); }
+
+    ///@brief Adds delta to the occupancy atomically, and returns the new occupancy
+    int add_occ_concurrent(int delta) { return __atomic_add_fetch(&occ_, static_cast<short>(delta), __ATOMIC_RELAXED); }
 
   private: //Data
     short occ_ = 0;
@@ -1850,6 +2036,8 @@ struct t_vpr_setup {
     bool two_stage_clock_routing;              ///<How clocks should be routed in the presence of a dedicated clock network
     bool exit_before_pack;                     ///<Exits early before starting packing (useful for collecting statistics without running/loading any stages)
     unsigned int num_workers;                  ///Maximum number of worker threads (determined from an env var or cmdline option)
+    std::string profile_trace_file;            ///<File to which profiling zones are written (profiling is disabled if empty)
+    std::string perf_metrics_file;             ///<File to which the run-time, memory, work and QoR metrics of the run are written (if not empty)
 };
 
 class RouteStatus {
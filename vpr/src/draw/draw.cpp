@@ -103,7 +103,7 @@ void act_on_mouse_move(ezgl::application* app, GdkEventButton* event, double x,
 
 static void highlight_blocks(double x, double y);
 
-static float get_router_expansion_cost(const t_rr_node_route_inf node_inf,
+static float get_router_expansion_cost(const t_rr_node_path_inf node_inf,
                                        e_draw_router_expansion_cost draw_router_expansion_cost);
 static void draw_router_expansion_costs(ezgl::renderer* g);
 
@@ -583,6 +583,7 @@ void init_draw_coords(float width_val) {
             draw_state->draw_rr_node[inode].node_highlighted = false;
         }
     }
+    draw_state->rr_node_bins.clear();
     draw_coords->tile_width = width_val;
     draw_coords->pin_size = 0.3;
     for (const auto& type : device_ctx.physical_tile_types) {
@@ -911,7 +912,7 @@ ezgl::color to_ezgl_color(vtr::Color<float> color) {
     return ezgl::color(color.r * 255, color.g * 255, color.b * 255);
 }
 
-static float get_router_expansion_cost(const t_rr_node_route_inf node_inf,
+static float get_router_expansion_cost(const t_rr_node_path_inf node_inf,
                                        e_draw_router_expansion_cost draw_router_expansion_cost) {
     if (draw_router_expansion_cost == DRAW_ROUTER_EXPANSION_COST_TOTAL
         || draw_router_expansion_cost
@@ -940,11 +941,20 @@ static void draw_router_expansion_costs(ezgl::renderer* g) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& routing_ctx = g_vpr_ctx.routing();
 
-    vtr::vector<RRNodeId, float> rr_costs(device_ctx.rr_graph.num_nodes());
+    vtr::vector<RRNodeId, float> rr_costs(device_ctx.rr_graph.num_nodes(), std::numeric_limits<float>::infinity());
 
+    //Only the costs of the latest path search are valid, the others have been reset
+    uint64_t latest_path_epoch = 0;
     for (RRNodeId inode : device_ctx.rr_graph.nodes()) {
+        latest_path_epoch = std::max(latest_path_epoch, routing_ctx.rr_node_path_inf[inode].path_epoch);
+    }
+
+    for (RRNodeId inode : device_ctx.rr_graph.nodes()) {
+        if (routing_ctx.rr_node_path_inf[inode].path_epoch != latest_path_epoch) {
+            continue;
+        }
         float cost = get_router_expansion_cost(
-            routing_ctx.rr_node_route_inf[inode],
+            routing_ctx.rr_node_path_inf[inode],
             draw_state->show_router_expansion_cost);
         rr_costs[inode] = cost;
     }
@@ -337,10 +337,10 @@ void draw_congestion(ezgl::renderer* g) {
     std::sort(congested_rr_nodes.begin(), congested_rr_nodes.end(), cmp_ascending_acc_cost);
 
     if (draw_state->show_congestion == DRAW_CONGESTED_WITH_NETS) {
-        auto rr_node_nets = collect_rr_node_nets();
+        auto rr_node_nets = collect_rr_node_nets(congested_rr_nodes);
 
         for (RRNodeId inode : congested_rr_nodes) {
-            for (ClusterNetId net : rr_node_nets[inode]) {
+            for (ClusterNetId net : rr_node_nets.at(inode)) {
                 ezgl::color color = kelly_max_contrast_colors[size_t(net) % kelly_max_contrast_colors.size()];
                 draw_state->net_color[net] = color;
             }
@@ -350,7 +350,7 @@ void draw_congestion(ezgl::renderer* g) {
 
         //Reset colors
         for (RRNodeId inode : congested_rr_nodes) {
-            for (ClusterNetId net : rr_node_nets[inode]) {
+            for (ClusterNetId net : rr_node_nets.at(inode)) {
                 draw_state->net_color[net] = DEFAULT_RR_NODE_COLOR;
             }
         }
@@ -63,6 +63,17 @@
 constexpr float SB_EDGE_TURN_ARROW_POSITION = 0.2;
 constexpr float SB_EDGE_STRAIGHT_ARROW_POSITION = 0.95;
 
+//Width and height, in grid tiles, of the bins of the routing resource spatial index
+constexpr int RR_NODE_BIN_TILES = 4;
+
+//Below this many screen pixels per drawing unit (roughly one track), the edges between
+//routing resources blur together, so only those of highlighted nodes are drawn
+constexpr float MIN_RR_EDGE_PIXELS_PER_UNIT = 1.;
+
+static void build_rr_node_bins();
+static std::vector<RRNodeId> get_visible_rr_nodes(ezgl::renderer* g);
+static bool draw_rr_edges_at_zoom(ezgl::renderer* g);
+
 /* Draws the routing resources that exist in the FPGA, if the user wants
  * them drawn.
  */
@@ -80,8 +91,9 @@ void draw_rr(ezgl::renderer* g) {
 
     g->set_line_dash(ezgl::line_dash::none);
 
+    /* Colour all the nodes, as the colours of the nodes out of view decide how
+     * the edges to them are drawn. */
     for (const RRNodeId inode : device_ctx.rr_graph.nodes()) {
-        int layer_num = rr_graph.node_layer(inode);
         int transparency_factor = get_rr_node_transparency(inode);
         if (!draw_state->draw_rr_node[inode].node_highlighted) {
             /* If not highlighted node, assign color based on type. */
@@ -108,38 +120,45 @@ void draw_rr(ezgl::renderer* g) {
         }
 
         draw_state->draw_rr_node[inode].color.alpha = transparency_factor;
+    }
+
+    bool all_edges = draw_rr_edges_at_zoom(g);
 
+    /* Now call drawing routines to draw the nodes in view. */
+    for (const RRNodeId inode : get_visible_rr_nodes(g)) {
+        int layer_num = rr_graph.node_layer(inode);
         if (!draw_state->draw_layer_display[layer_num].visible)
             continue; // skip drawing if layer is not visible
 
-        /* Now call drawing routines to draw the node. */
+        bool with_edges = all_edges || draw_state->draw_rr_node[inode].node_highlighted;
+
         switch (rr_graph.node_type(inode)) {
             case SINK:
                 draw_rr_src_sink(inode, draw_state->draw_rr_node[inode].color, g);
                 break;
             case SOURCE:
-                draw_rr_edges(inode, g);
+                if (with_edges) draw_rr_edges(inode, g);
                 draw_rr_src_sink(inode, draw_state->draw_rr_node[inode].color, g);
                 break;
 
             case CHANX:
                 draw_rr_chan(inode, draw_state->draw_rr_node[inode].color, g);
-                draw_rr_edges(inode, g);
+                if (with_edges) draw_rr_edges(inode, g);
                 break;
 
             case CHANY:
                 draw_rr_chan(inode, draw_state->draw_rr_node[inode].color, g);
-                draw_rr_edges(inode, g);
+                if (with_edges) draw_rr_edges(inode, g);
                 break;
 
             case IPIN:
                 draw_rr_pin(inode, draw_state->draw_rr_node[inode].color, g);
-                draw_rr_edges(inode, g);
+                if (with_edges) draw_rr_edges(inode, g);
                 break;
 
             case OPIN:
                 draw_rr_pin(inode, draw_state->draw_rr_node[inode].color, g);
-                draw_rr_edges(inode, g);
+                if (with_edges) draw_rr_edges(inode, g);
                 break;
 
             default:
@@ -151,6 +170,85 @@ void draw_rr(ezgl::renderer* g) {
     drawroute(HIGHLIGHTED, g);
 }
 
+/* Returns the span of inode in bins of the routing resource spatial index */
+static std::array<int, 4> get_rr_node_bin_span(RRNodeId inode, const vtr::Matrix<std::vector<RRNodeId>>& bins) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+
+    int max_bin_x = int(bins.dim_size(0)) - 1;
+    int max_bin_y = int(bins.dim_size(1)) - 1;
+    return {std::clamp(rr_graph.node_xlow(inode) / RR_NODE_BIN_TILES, 0, max_bin_x),
+            std::clamp(rr_graph.node_ylow(inode) / RR_NODE_BIN_TILES, 0, max_bin_y),
+            std::clamp(rr_graph.node_xhigh(inode) / RR_NODE_BIN_TILES, 0, max_bin_x),
+            std::clamp(rr_graph.node_yhigh(inode) / RR_NODE_BIN_TILES, 0, max_bin_y)};
+}
+
+static void build_rr_node_bins() {
+    t_draw_state* draw_state = get_draw_state_vars();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    size_t num_bins_x = (device_ctx.grid.width() + RR_NODE_BIN_TILES - 1) / RR_NODE_BIN_TILES;
+    size_t num_bins_y = (device_ctx.grid.height() + RR_NODE_BIN_TILES - 1) / RR_NODE_BIN_TILES;
+    auto& bins = draw_state->rr_node_bins;
+    bins.resize({num_bins_x, num_bins_y});
+
+    for (const RRNodeId inode : device_ctx.rr_graph.nodes()) {
+        std::array<int, 4> span = get_rr_node_bin_span(inode, bins);
+        for (int bin_x = span[0]; bin_x <= span[2]; ++bin_x) {
+            for (int bin_y = span[1]; bin_y <= span[3]; ++bin_y) {
+                bins[bin_x][bin_y].push_back(inode);
+            }
+        }
+    }
+}
+
+/* Returns the index of the grid tile which world coordinate coord falls in,
+ * given the lower coordinates of the tiles along that axis */
+static int get_tile_at_coord(float coord, const float* tile_coords, size_t num_tiles) {
+    int tile = int(std::upper_bound(tile_coords, tile_coords + num_tiles, coord) - tile_coords) - 1;
+    return std::clamp(tile, 0, int(num_tiles) - 1);
+}
+
+/* Returns the rr_nodes overlapping the visible world, each once. The view is
+ * extended by one bin, so that the edges from the nodes just out of view are drawn. */
+static std::vector<RRNodeId> get_visible_rr_nodes(ezgl::renderer* g) {
+    t_draw_state* draw_state = get_draw_state_vars();
+    t_draw_coords* draw_coords = get_draw_coords_vars();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    auto& bins = draw_state->rr_node_bins;
+    if (bins.empty()) {
+        build_rr_node_bins();
+    }
+
+    ezgl::rectangle view = g->get_visible_world();
+    int max_bin_x = int(bins.dim_size(0)) - 1;
+    int max_bin_y = int(bins.dim_size(1)) - 1;
+    int view_xlow = std::clamp(get_tile_at_coord(view.left(), draw_coords->tile_x, device_ctx.grid.width()) / RR_NODE_BIN_TILES - 1, 0, max_bin_x);
+    int view_ylow = std::clamp(get_tile_at_coord(view.bottom(), draw_coords->tile_y, device_ctx.grid.height()) / RR_NODE_BIN_TILES - 1, 0, max_bin_y);
+    int view_xhigh = std::clamp(get_tile_at_coord(view.right(), draw_coords->tile_x, device_ctx.grid.width()) / RR_NODE_BIN_TILES + 1, 0, max_bin_x);
+    int view_yhigh = std::clamp(get_tile_at_coord(view.top(), draw_coords->tile_y, device_ctx.grid.height()) / RR_NODE_BIN_TILES + 1, 0, max_bin_y);
+
+    std::vector<RRNodeId> nodes;
+    for (int bin_x = view_xlow; bin_x <= view_xhigh; ++bin_x) {
+        for (int bin_y = view_ylow; bin_y <= view_yhigh; ++bin_y) {
+            for (RRNodeId inode : bins[bin_x][bin_y]) {
+                //A node spanning several bins is only taken from the lowest one in view
+                std::array<int, 4> span = get_rr_node_bin_span(inode, bins);
+                if (std::max(span[0], view_xlow) == bin_x && std::max(span[1], view_ylow) == bin_y) {
+                    nodes.push_back(inode);
+                }
+            }
+        }
+    }
+    return nodes;
+}
+
+/* Returns true if the view is zoomed in enough for the edges between all the
+ * routing resources to be told apart */
+static bool draw_rr_edges_at_zoom(ezgl::renderer* g) {
+    return g->get_visible_screen().width() / g->get_visible_world().width() >= MIN_RR_EDGE_PIXELS_PER_UNIT;
+}
+
 void draw_rr_chan(RRNodeId inode, const ezgl::color color, ezgl::renderer* g) {
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
@@ -807,9 +905,9 @@ void draw_rr_costs(ezgl::renderer* g, const vtr::vector<RRNodeId, float>& rr_cos
     if (max_cost == -std::numeric_limits<float>::infinity()) max_cost = 0;
     std::unique_ptr<vtr::ColorMap> cmap = std::make_unique<vtr::PlasmaColorMap>(min_cost, max_cost);
 
-    //Draw the nodes in ascending order of value, this ensures high valued nodes
+    //Draw the nodes in view in ascending order of value, this ensures high valued nodes
     //are not overdrawn by lower value ones (e.g-> when zoomed-out far)
-    std::vector<RRNodeId> nodes(device_ctx.rr_graph.nodes().begin(), device_ctx.rr_graph.nodes().end());
+    std::vector<RRNodeId> nodes = get_visible_rr_nodes(g);
     auto cmp_ascending_cost = [&](RRNodeId lhs_node, RRNodeId rhs_node) {
         if (lowest_cost_first) {
             return rr_costs[lhs_node] > rr_costs[rhs_node];
@@ -28,6 +28,7 @@
 #    include "vpr_types.h"
 #    include "vtr_color_map.h"
 #    include "vtr_vector.h"
+#    include "vtr_ndmatrix.h"
 #    include "breakpoint.h"
 #    include "manual_moves.h"
 
@@ -249,6 +250,15 @@ struct t_draw_state {
      */
     vtr::vector<RRNodeId, t_draw_rr_node> draw_rr_node;
 
+    /**
+     * @brief Spatial index over the routing resources, used to only draw those in view.
+     *
+     * A uniform grid of bins of a few grid tiles each, listing the rr_nodes which
+     * overlap each bin. Built the first time routing resources are drawn after
+     * init_draw_coords(), which clears it.
+     */
+    vtr::Matrix<std::vector<RRNodeId>> rr_node_bins;
+
     std::shared_ptr<const SetupTimingInfo> setup_timing_info;
 
     ///@brief pointer to architecture info. const
@@ -0,0 +1,441 @@
+#include "headless_images.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+#include "vtr_assert.h"
+#include "vtr_color_map.h"
+#include "vtr_ndmatrix.h"
+#include "vtr_path.h"
+#include "vtr_time.h"
+
+#include "vpr_error.h"
+#include "vpr_utils.h"
+#include "globals.h"
+#include "buffered_file_writer.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+namespace {
+
+///@brief Largest width or height of a PNG, in pixels (unless MIN_PIXELS_PER_TILE needs more)
+constexpr int MAX_IMAGE_PIXELS = 2048;
+constexpr int MIN_PIXELS_PER_TILE = 4;
+
+///@brief Number of pixel rows rasterized per task
+constexpr int RASTER_BAND_ROWS = 32;
+
+///@brief SVG coordinates are integers, in 1/SVG_UNITS_PER_TILE of a tile
+constexpr int SVG_UNITS_PER_TILE = 100;
+
+///@brief Half the width of a channel, in tiles. Tiles are drawn inset by this much.
+constexpr float CHAN_HALF_WIDTH = 0.12;
+
+struct t_rgb {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+
+constexpr t_rgb TILE_GREY = {225, 225, 225};
+constexpr t_rgb UNCONGESTED_GREY = {190, 190, 190};
+
+//Colours of the tile types, in order of type index
+constexpr std::array<t_rgb, 8> TILE_TYPE_COLORS = {{{110, 160, 230},
+                                                    {120, 200, 120},
+                                                    {240, 170, 90},
+                                                    {180, 140, 220},
+                                                    {230, 210, 100},
+                                                    {230, 130, 170},
+                                                    {100, 200, 200},
+                                                    {200, 160, 120}}};
+
+///@brief An axis-aligned rectangle, in tile units with y increasing upwards
+struct t_rect {
+    float xlow;
+    float ylow;
+    float xhigh;
+    float yhigh;
+    t_rgb color;
+};
+
+///@brief Rectangles drawn in order over a white device of width x height tiles
+struct t_scene {
+    int width;
+    int height;
+    std::vector<t_rect> rects;
+};
+
+t_rgb to_rgb(vtr::Color<float> color) {
+    return {uint8_t(color.r * 255), uint8_t(color.g * 255), uint8_t(color.b * 255)};
+}
+
+t_rgb lighten(t_rgb color, float frac) {
+    auto mix = [frac](uint8_t c) { return uint8_t(c + (255 - c) * frac); };
+    return {mix(color.r), mix(color.g), mix(color.b)};
+}
+
+/*
+ * PNG encoding
+ */
+
+uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc = 0) {
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> t;
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : (c >> 1);
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    crc = ~crc;
+    for (size_t i = 0; i < len; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+uint32_t adler32(const std::vector<uint8_t>& data) {
+    //Largest number of bytes which can be summed before the sums must be reduced
+    constexpr size_t NMAX = 5552;
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (size_t start = 0; start < data.size(); start += NMAX) {
+        size_t end = std::min(data.size(), start + NMAX);
+        for (size_t i = start; i < end; ++i) {
+            a += data[i];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+void append_u32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(value >> 24);
+    out.push_back(value >> 16);
+    out.push_back(value >> 8);
+    out.push_back(value);
+}
+
+void append_png_chunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data) {
+    append_u32(out, data.size());
+    size_t type_start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    append_u32(out, crc32(out.data() + type_start, out.size() - type_start));
+}
+
+/* Returns the zlib stream of scanlines, made of stored (uncompressed) deflate blocks:
+ * the images are mostly flat colours, but are written on every run where compressing
+ * them would cost more time than the disk space saved is worth. */
+std::vector<uint8_t> zlib_store(const std::vector<uint8_t>& scanlines) {
+    constexpr size_t MAX_STORED_BLOCK = 65535;
+
+    std::vector<uint8_t> out = {0x78, 0x01};
+    out.reserve(scanlines.size() + 5 * (scanlines.size() / MAX_STORED_BLOCK + 1) + 6);
+    size_t start = 0;
+    do {
+        size_t len = std::min(MAX_STORED_BLOCK, scanlines.size() - start);
+        bool final_block = (start + len == scanlines.size());
+        out.push_back(final_block ? 1 : 0);
+        out.push_back(len & 0xFF);
+        out.push_back(len >> 8);
+        out.push_back(~len & 0xFF);
+        out.push_back((~len >> 8) & 0xFF);
+        out.insert(out.end(), scanlines.begin() + start, scanlines.begin() + start + len);
+        start += len;
+    } while (start < scanlines.size());
+    append_u32(out, adler32(scanlines));
+    return out;
+}
+
+void write_png(const t_scene& scene, const std::string& file_name) {
+    int pixels_per_tile = std::max(MIN_PIXELS_PER_TILE, MAX_IMAGE_PIXELS / std::max({scene.width, scene.height, 1}));
+    int width = scene.width * pixels_per_tile;
+    int height = scene.height * pixels_per_tile;
+    size_t row_bytes = 1 + 3 * size_t(width); //Filter type byte (0: none), then RGB
+
+    //Scanlines, from the top of the device down
+    std::vector<uint8_t> scanlines(row_bytes * height, 255);
+    for (int row = 0; row < height; ++row) {
+        scanlines[row * row_bytes] = 0;
+    }
+
+    //Pixel bounds of each rectangle (rows counted from the top), and the rectangles in each band
+    std::vector<std::array<int, 4>> rect_pixels(scene.rects.size());
+    int num_bands = (height + RASTER_BAND_ROWS - 1) / RASTER_BAND_ROWS;
+    std::vector<std::vector<size_t>> band_rects(num_bands);
+    for (size_t irect = 0; irect < scene.rects.size(); ++irect) {
+        const t_rect& rect = scene.rects[irect];
+        std::array<int, 4>& pixels = rect_pixels[irect];
+        pixels[0] = std::clamp(int(std::lround(rect.xlow * pixels_per_tile)), 0, width);
+        pixels[1] = std::clamp(int(std::lround((scene.height - rect.yhigh) * pixels_per_tile)), 0, height);
+        pixels[2] = std::clamp(int(std::lround(rect.xhigh * pixels_per_tile)), 0, width);
+        pixels[3] = std::clamp(int(std::lround((scene.height - rect.ylow) * pixels_per_tile)), 0, height);
+        if (pixels[0] >= pixels[2] || pixels[1] >= pixels[3]) continue;
+
+        for (int band = pixels[1] / RASTER_BAND_ROWS; band <= (pixels[3] - 1) / RASTER_BAND_ROWS; ++band) {
+            band_rects[band].push_back(irect);
+        }
+    }
+
+    //Each band is painted in rectangle order, and bands don't overlap
+    auto raster_band = [&](size_t band) {
+        int band_top = band * RASTER_BAND_ROWS;
+        int band_bottom = std::min(height, band_top + RASTER_BAND_ROWS);
+        for (size_t irect : band_rects[band]) {
+            const std::array<int, 4>& pixels = rect_pixels[irect];
+            t_rgb color = scene.rects[irect].color;
+            for (int row = std::max(band_top, pixels[1]); row < std::min(band_bottom, pixels[3]); ++row) {
+                uint8_t* pixel = &scanlines[row * row_bytes + 1 + 3 * size_t(pixels[0])];
+                for (int col = pixels[0]; col < pixels[2]; ++col) {
+                    *pixel++ = color.r;
+                    *pixel++ = color.g;
+                    *pixel++ = color.b;
+                }
+            }
+        }
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), size_t(num_bands), raster_band);
+#else
+    for (size_t band = 0; band < size_t(num_bands); ++band) {
+        raster_band(band);
+    }
+#endif
+
+    std::vector<uint8_t> header;
+    append_u32(header, width);
+    append_u32(header, height);
+    header.insert(header.end(), {8, 2, 0, 0, 0}); //8-bit RGB, no interlacing
+
+    const uint8_t signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    std::vector<uint8_t> png(std::begin(signature), std::end(signature));
+    append_png_chunk(png, "IHDR", header);
+    append_png_chunk(png, "IDAT", zlib_store(scanlines));
+    append_png_chunk(png, "IEND", {});
+
+    std::ofstream file(file_name, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(png.data()), png.size());
+    if (!file) {
+        VPR_FATAL_ERROR(VPR_ERROR_DRAW, "Failed to write image '%s'\n", file_name.c_str());
+    }
+}
+
+/*
+ * SVG encoding
+ */
+
+void write_svg_color(BufferedFileWriter& out, t_rgb color) {
+    constexpr char HEX[] = "0123456789abcdef";
+    out << '#';
+    for (uint8_t c : {color.r, color.g, color.b}) {
+        out << HEX[c >> 4] << HEX[c & 0xF];
+    }
+}
+
+void write_svg(const t_scene& scene, const std::string& file_name) {
+    auto to_svg = [](float coord) { return int(std::lround(coord * SVG_UNITS_PER_TILE)); };
+
+    BufferedFileWriter out(file_name.c_str(), VPR_ERROR_DRAW);
+    out << "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"0 0 "
+        << scene.width * SVG_UNITS_PER_TILE << ' ' << scene.height * SVG_UNITS_PER_TILE << "\">\n";
+    out << "<rect width=\"100%\" height=\"100%\" fill=\"white\"/>\n";
+    for (const t_rect& rect : scene.rects) {
+        int x = to_svg(rect.xlow);
+        int y = to_svg(scene.height - rect.yhigh);
+        out << "<rect x=\"" << x << "\" y=\"" << y
+            << "\" width=\"" << to_svg(rect.xhigh) - x << "\" height=\"" << to_svg(scene.height - rect.ylow) - y
+            << "\" fill=\"";
+        write_svg_color(out, rect.color);
+        out << "\"/>\n";
+    }
+    out << "</svg>\n";
+    out.close();
+}
+
+void write_scene(const t_scene& scene, const std::string& file_name) {
+    vtr::ScopedStartFinishTimer timer("Writing headless image '" + file_name + "'");
+
+    if (vtr::split_ext(file_name)[1] == ".svg") {
+        write_svg(scene, file_name);
+    } else {
+        write_png(scene, file_name);
+    }
+}
+
+/*
+ * Scenes
+ */
+
+t_scene make_device_scene() {
+    const auto& grid = g_vpr_ctx.device().grid;
+
+    t_scene scene;
+    scene.width = grid.width();
+    scene.height = grid.height();
+    return scene;
+}
+
+/* Adds the tiles (of the first layer), with the colours returned by tile_color(tile type, tile location) */
+template<typename TileColor>
+void add_tiles(t_scene& scene, TileColor tile_color) {
+    const auto& grid = g_vpr_ctx.device().grid;
+
+    for (int x = 0; x < int(grid.width()); ++x) {
+        for (int y = 0; y < int(grid.height()); ++y) {
+            t_physical_tile_loc loc(x, y, 0);
+            t_physical_tile_type_ptr type = grid.get_physical_type(loc);
+            if (grid.get_width_offset(loc) != 0 || grid.get_height_offset(loc) != 0 || is_empty_type(type)) {
+                continue;
+            }
+
+            scene.rects.push_back({x + CHAN_HALF_WIDTH, y + CHAN_HALF_WIDTH,
+                                   x + type->width - CHAN_HALF_WIDTH, y + type->height - CHAN_HALF_WIDTH,
+                                   tile_color(type, loc)});
+        }
+    }
+}
+
+///@brief Totals over the wires of each channel location
+struct t_chan_totals {
+    vtr::Matrix<float> chanx;
+    vtr::Matrix<float> chany;
+};
+
+/* Returns the total of wire_value(wire) over the wires of each channel location (of all layers) */
+template<typename WireValue>
+t_chan_totals total_chan_wires(WireValue wire_value) {
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+
+    t_chan_totals totals;
+    totals.chanx.resize({device_ctx.grid.width(), device_ctx.grid.height()}, 0.);
+    totals.chany.resize({device_ctx.grid.width(), device_ctx.grid.height()}, 0.);
+    for (size_t inode = 0; inode < rr_graph.num_nodes(); ++inode) {
+        RRNodeId node(inode);
+        e_rr_type type = rr_graph.node_type(node);
+        if (type != CHANX && type != CHANY) continue;
+
+        float value = wire_value(node);
+        auto& chan = (type == CHANX) ? totals.chanx : totals.chany;
+        for (int x = rr_graph.node_xlow(node); x <= rr_graph.node_xhigh(node); ++x) {
+            for (int y = rr_graph.node_ylow(node); y <= rr_graph.node_yhigh(node); ++y) {
+                chan[x][y] += value;
+            }
+        }
+    }
+    return totals;
+}
+
+/* Adds the channel strips, with the colours returned by chan_color(chan type, x, y),
+ * which skips the strips it returns no colour for */
+template<typename ChanColor>
+void add_chans(t_scene& scene, ChanColor chan_color) {
+    for (int x = 0; x < scene.width; ++x) {
+        for (int y = 0; y < scene.height; ++y) {
+            t_rgb color;
+            if (chan_color(CHANX, x, y, color)) {
+                scene.rects.push_back({x + CHAN_HALF_WIDTH, y + 1 - CHAN_HALF_WIDTH,
+                                       x + 1 - CHAN_HALF_WIDTH, y + 1 + CHAN_HALF_WIDTH, color});
+            }
+            if (chan_color(CHANY, x, y, color)) {
+                scene.rects.push_back({x + 1 - CHAN_HALF_WIDTH, y + CHAN_HALF_WIDTH,
+                                       x + 1 + CHAN_HALF_WIDTH, y + 1 - CHAN_HALF_WIDTH, color});
+            }
+        }
+    }
+}
+
+bool routing_is_loaded() {
+    return g_vpr_ctx.routing().rr_node_route_inf.size() == g_vpr_ctx.device().rr_graph.num_nodes();
+}
+
+} // namespace
+
+void write_headless_placement_image(const std::string& file_name) {
+    const auto& place_ctx = g_vpr_ctx.placement();
+
+    t_scene scene = make_device_scene();
+    add_tiles(scene, [&](t_physical_tile_type_ptr type, const t_physical_tile_loc& loc) {
+        t_rgb color = TILE_TYPE_COLORS[type->index % TILE_TYPE_COLORS.size()];
+        return (place_ctx.grid_blocks.get_usage(loc) > 0) ? color : lighten(color, 0.7);
+    });
+
+    write_scene(scene, file_name);
+}
+
+void write_headless_routing_util_image(const std::string& file_name) {
+    if (!routing_is_loaded()) return;
+
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    t_chan_totals occ = total_chan_wires([&](RRNodeId node) { return route_ctx.rr_node_route_inf[node].occ(); });
+    t_chan_totals capacity = total_chan_wires([&](RRNodeId node) { return rr_graph.node_capacity(node); });
+    vtr::PlasmaColorMap cmap(0., 1.);
+
+    t_scene scene = make_device_scene();
+    add_tiles(scene, [](t_physical_tile_type_ptr, const t_physical_tile_loc&) { return TILE_GREY; });
+    add_chans(scene, [&](e_rr_type type, int x, int y, t_rgb& color) {
+        float chan_capacity = (type == CHANX) ? capacity.chanx[x][y] : capacity.chany[x][y];
+        if (chan_capacity <= 0) return false;
+        float chan_occ = (type == CHANX) ? occ.chanx[x][y] : occ.chany[x][y];
+        color = to_rgb(cmap.color(std::min(1.f, chan_occ / chan_capacity)));
+        return true;
+    });
+
+    write_scene(scene, file_name);
+}
+
+void write_headless_congestion_image(const std::string& file_name) {
+    if (!routing_is_loaded()) return;
+
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    t_chan_totals capacity = total_chan_wires([&](RRNodeId node) { return rr_graph.node_capacity(node); });
+    t_chan_totals overuse = total_chan_wires([&](RRNodeId node) {
+        return std::max(0, route_ctx.rr_node_route_inf[node].occ() - rr_graph.node_capacity(node));
+    });
+    float max_overuse = 0.;
+    for (size_t x = 0; x < overuse.chanx.dim_size(0); ++x) {
+        for (size_t y = 0; y < overuse.chanx.dim_size(1); ++y) {
+            max_overuse = std::max({max_overuse, overuse.chanx[x][y], overuse.chany[x][y]});
+        }
+    }
+    vtr::InfernoColorMap cmap(0., std::max(1.f, max_overuse));
+
+    t_scene scene = make_device_scene();
+    add_tiles(scene, [](t_physical_tile_type_ptr, const t_physical_tile_loc&) { return TILE_GREY; });
+    add_chans(scene, [&](e_rr_type type, int x, int y, t_rgb& color) {
+        float chan_capacity = (type == CHANX) ? capacity.chanx[x][y] : capacity.chany[x][y];
+        if (chan_capacity <= 0) return false;
+        float chan_overuse = (type == CHANX) ? overuse.chanx[x][y] : overuse.chany[x][y];
+        color = (chan_overuse > 0) ? to_rgb(cmap.color(chan_overuse)) : UNCONGESTED_GREY;
+        return true;
+    });
+
+    write_scene(scene, file_name);
+}
+
+std::string get_headless_image_file_name(const std::string& base_file_name, const std::string& stage) {
+    auto name_ext = vtr::split_ext(base_file_name);
+    if (name_ext[1].empty()) {
+        name_ext[1] = ".png";
+    }
+    return name_ext[0] + "_" + stage + name_ext[1];
+}
@@ -0,0 +1,36 @@
+#ifndef HEADLESS_IMAGES_H
+#define HEADLESS_IMAGES_H
+
+/**
+ * @file headless_images.h
+ * @brief Images of the implementation drawn straight from the VPR contexts
+ *
+ * Unlike save_graphics(), these images need no graphics session (nor GTK or X11),
+ * so they are also written by VPR builds without graphics, e.g. for regression runs.
+ * They show a fixed, simplified view of the device: one square per grid tile, with
+ * the horizontal and vertical channels of a tile drawn as strips along its top and
+ * right sides.
+ *
+ * Images are written as SVG if the file name ends in ".svg", and as PNG otherwise.
+ * PNGs are rasterized in bands of rows, in parallel when VPR is built with TBB.
+ */
+
+#include <string>
+
+///@brief Writes the placement: the tiles coloured by type, and lighter when unused
+void write_headless_placement_image(const std::string& file_name);
+
+///@brief Writes the utilization (total occupancy over total capacity) of each channel
+void write_headless_routing_util_image(const std::string& file_name);
+
+///@brief Writes the congestion (total overuse of the wires) of each channel
+void write_headless_congestion_image(const std::string& file_name);
+
+/**
+ * @brief Returns the file name of the image of a stage, given the name passed to --write_headless_images
+ *
+ * e.g. ("images/run.png", "place") -> "images/run_place.png"
+ */
+std::string get_headless_image_file_name(const std::string& base_file_name, const std::string& stage);
+
+#endif
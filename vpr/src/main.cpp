@@ -24,6 +24,7 @@
 #include "vpr_exit_codes.h"
 #include "vpr_error.h"
 #include "vpr_api.h"
+#include "vpr_server.h"
 #include "vpr_signal_handler.h"
 #include "vpr_tatum_error.h"
 
@@ -41,7 +42,7 @@
  * 3.  Place-and-route and timing analysis
  * 4.  Clean up
  */
-int main(int argc, const char** argv) {
+static int run_vpr(int argc, const char** argv) {
     vtr::ScopedFinishTimer t("The entire flow of VPR");
 
     t_options Options = t_options();
@@ -98,3 +99,10 @@ int main(int argc, const char** argv) {
     /* Signal success to scripts */
     return SUCCESS_EXIT_CODE;
 }
+
+int main(int argc, const char** argv) {
+    if (argc > 1 && std::strcmp(argv[1], "--server") == 0) {
+        return vpr_server(argc - 1, argv + 1, run_vpr);
+    }
+    return run_vpr(argc, argv);
+}
@@ -1,5 +1,7 @@
 #
 
+#include <algorithm>
+
 #include "bfs_routing.h"
 
 BFSRouting::~BFSRouting() {}
@@ -11,6 +13,9 @@ void BFSRouting::route_flow(NocRouterId src_router_id, NocRouterId sink_router_i
     // destroy any previously stored route
     flow_route.clear();
 
+    // Router ids are dense, so the per router search state is stored in vectors indexed by router id
+    size_t num_routers = noc_model.get_noc_routers().size();
+
     /**
      * Keeps track of which routers have been reached already
      * while traversing the NoC. This variable will help prevent 
@@ -18,17 +23,17 @@ void BFSRouting::route_flow(NocRouterId src_router_id, NocRouterId sink_router_i
      * jave already been visited.
      * 
      */
-    std::unordered_set<NocRouterId> visited_routers;
+    vtr::vector<NocRouterId, bool> visited_routers(num_routers, false);
 
     /*
      * As the routing goes through the NoC, each router visited has a
      * corresponding link that was used to reach the router. This
      * datastructure stores the link that was used to visit each router in 
-     * the NoC.
+     * the NoC (an invalid id for the routers without a parent link).
      * Once the destination router has been found. This datastructure can be used to
      * trace the path back to the source router.
      */
-    std::unordered_map<NocRouterId, NocLinkId> router_parent_link;
+    vtr::vector<NocRouterId, NocLinkId> router_parent_link(num_routers, NocLinkId::INVALID());
 
     std::queue<NocRouterId> routers_to_process;
 
@@ -38,7 +43,7 @@ void BFSRouting::route_flow(NocRouterId src_router_id, NocRouterId sink_router_i
 
     // Start by processing the source router of the flow
     routers_to_process.push(src_router_id);
-    visited_routers.insert(src_router_id);
+    visited_routers[src_router_id] = true;
 
     //handle case where the source and sink router of the flow are the same
     if (src_router_id == sink_router_id) {
@@ -61,14 +66,14 @@ void BFSRouting::route_flow(NocRouterId src_router_id, NocRouterId sink_router_i
             NocRouterId connected_router = noc_model.get_single_noc_link(link).get_sink_router();
 
             // check if we already explored the router we are visiting
-            if (visited_routers.find(connected_router) == visited_routers.end()) {
+            if (!visited_routers[connected_router]) {
                 // if we are here then this is the first time visiting this router //
                 // mark this router as visited and add send the router to be processed
-                visited_routers.insert(connected_router);
+                visited_routers[connected_router] = true;
                 routers_to_process.push(connected_router);
 
                 // set the parent link of this router (link used to visit the router) as the current outgoing link
-                router_parent_link.insert(std::pair<NocRouterId, NocLinkId>(connected_router, link));
+                router_parent_link[connected_router] = link;
 
                 // check if the router visited is the destination router
                 if (connected_router == sink_router_id) {
@@ -94,31 +99,27 @@ void BFSRouting::route_flow(NocRouterId src_router_id, NocRouterId sink_router_i
     return;
 }
 
-void BFSRouting::generate_route(NocRouterId start_router_id, std::vector<NocLinkId>& flow_route, const NocStorage& noc_model, const std::unordered_map<NocRouterId, NocLinkId>& router_parent_link) {
+void BFSRouting::generate_route(NocRouterId start_router_id, std::vector<NocLinkId>& flow_route, const NocStorage& noc_model, const vtr::vector<NocRouterId, NocLinkId>& router_parent_link) {
     // The intermediate router being visited while tracing the path back from the destination router to the starting router in the flow.
     // Initially this is set to the router at the end of the path (destination router)
     NocRouterId curr_intermediate_router = start_router_id;
 
-    // get a reference to the beginning of the vector that stores the found route of the flow
-    // need this since each link we find in the path will be added to the beginning of the vector
-    auto route_beginning = flow_route.begin();
-
     // get the parent link of the start router
-    std::unordered_map<NocRouterId, NocLinkId>::const_iterator curr_intermediate_router_parent_link = router_parent_link.find(curr_intermediate_router);
+    NocLinkId curr_intermediate_router_parent_link = router_parent_link[curr_intermediate_router];
 
     // keep tracking baackwards from each router in the path until a router doesn't have a parent link (this means we reached the starting router in the flow)
-    while (curr_intermediate_router_parent_link != router_parent_link.end()) {
-        // add the parent link to the path. Since we are tracing backwards we need to store the links in fron of the last link.
-        flow_route.emplace(route_beginning, curr_intermediate_router_parent_link->second);
-
-        // update the reference to the beginning of the route
-        route_beginning = flow_route.begin();
+    while (curr_intermediate_router_parent_link) {
+        // add the parent link to the path. The links are found from the end of the path, so the path is reversed once complete.
+        flow_route.push_back(curr_intermediate_router_parent_link);
 
         // now move to the next intermediate router in the path. This will be the source router of the parent link
-        curr_intermediate_router = noc_model.get_single_noc_link(curr_intermediate_router_parent_link->second).get_source_router();
+        curr_intermediate_router = noc_model.get_single_noc_link(curr_intermediate_router_parent_link).get_source_router();
         // now get the parent of the router we moved to
-        curr_intermediate_router_parent_link = router_parent_link.find(curr_intermediate_router);
+        curr_intermediate_router_parent_link = router_parent_link[curr_intermediate_router];
     }
 
+    // put the links in order from the starting router to the destination router
+    std::reverse(flow_route.begin(), flow_route.end());
+
     return;
 }
\ No newline at end of file
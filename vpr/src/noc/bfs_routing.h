@@ -19,9 +19,10 @@
  */
 
 #include <vector>
-#include <unordered_map>
 #include <queue>
 
+#include "vtr_vector.h"
+
 #include "noc_routing.h"
 
 class BFSRouting : public NocRouting {
@@ -74,9 +75,10 @@ class BFSRouting : public NocRouting {
      * NoC and find a route between the two routers.
      * @param router_parent_link Contains the parent link associated to each
      * router in the NoC (parent link is the link used to visit the router during
-     * the BFS routing algorithm).
+     * the BFS routing algorithm). Routers without a parent link (the starting
+     * router, and routers that were not visited) have an invalid id.
      */
-    void generate_route(NocRouterId sink_router_id, std::vector<NocLinkId>& flow_route, const NocStorage& noc_model, const std::unordered_map<NocRouterId, NocLinkId>& router_parent_link);
+    void generate_route(NocRouterId sink_router_id, std::vector<NocLinkId>& flow_route, const NocStorage& noc_model, const vtr::vector<NocRouterId, NocLinkId>& router_parent_link);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "noc_route_table.h"
+
+#include "vtr_assert.h"
+
+#include "vpr_error.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+NocRouteTable::NocRouteTable(std::unique_ptr<NocRouting> routing_algorithm)
+    : routing_algorithm_(std::move(routing_algorithm)) {
+    VTR_ASSERT(routing_algorithm_);
+}
+
+NocRouteTable::~NocRouteTable() {}
+
+void NocRouteTable::alloc_table(const NocStorage& noc_model) {
+    size_t num_routers = noc_model.get_number_of_noc_routers();
+    if (is_routed_.dim_size(0) != num_routers) {
+        routes_.resize({num_routers, num_routers});
+        is_routed_.resize({num_routers, num_routers}, false);
+        is_routed_.fill(false);
+    }
+}
+
+void NocRouteTable::build(const NocStorage& noc_model) {
+    alloc_table(noc_model);
+
+    size_t num_routers = noc_model.get_number_of_noc_routers();
+
+    // each source router only writes its own row of the table
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_routers, [&](size_t src) {
+#else
+    for (size_t src = 0; src < num_routers; ++src) {
+#endif
+        for (size_t sink = 0; sink < num_routers; ++sink) {
+            if (is_routed_[src][sink]) {
+                continue;
+            }
+            try {
+                routing_algorithm_->route_flow(NocRouterId(src), NocRouterId(sink), routes_[src][sink], noc_model);
+                is_routed_[src][sink] = true;
+            } catch (const VprError&) {
+                // no route between the pair, route_flow() reports the error if a traffic flow requests it
+                routes_[src][sink].clear();
+            }
+        }
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+}
+
+void NocRouteTable::route_flow(NocRouterId src_router_id, NocRouterId sink_router_id, std::vector<NocLinkId>& flow_route, const NocStorage& noc_model) {
+    // allocate the table for the NoC on first use
+    alloc_table(noc_model);
+
+    size_t num_routers = noc_model.get_number_of_noc_routers();
+    size_t src = size_t(src_router_id);
+    size_t sink = size_t(sink_router_id);
+    VTR_ASSERT_SAFE(src < num_routers && sink < num_routers);
+
+    if (!is_routed_[src][sink]) {
+        // route the pair once, the routing algorithm throws an error if there is no route
+        routing_algorithm_->route_flow(src_router_id, sink_router_id, routes_[src][sink], noc_model);
+        is_routed_[src][sink] = true;
+    }
+
+    // replace any previously stored path, re-using its storage
+    const std::vector<NocLinkId>& route = routes_[src][sink];
+    flow_route.assign(route.begin(), route.end());
+}
@@ -0,0 +1,81 @@
+#ifndef NOC_ROUTE_TABLE_H
+#define NOC_ROUTE_TABLE_H
+
+/**
+ * @file
+ * @brief This file defines the NocRouteTable class, which caches the routes
+ * found by another NoC routing algorithm.
+ *
+ * Overview
+ * ========
+ * The routing algorithms (XY and BFS routing) only depend on the NoC topology,
+ * so the route between a pair of routers never changes. The placer however
+ * re-routes every traffic flow of a moved router block for each proposed move
+ * (and again if the move is reverted), repeating the same searches many times.
+ *
+ * NocRouteTable wraps a routing algorithm and stores the route it finds for each
+ * (source, sink) router pair. Requests for a routed pair are a table look-up and a
+ * copy of the stored route, so re-routing the traffic flows of a moved router costs
+ * about as much as a regular placement move.
+ *
+ * The routes of all pairs can be found up-front with build(), in parallel across
+ * the source routers. Pairs are otherwise routed the first time they are requested.
+ * A routing algorithm may fail (with an error) on pairs that no traffic flow ever
+ * uses, so build() leaves failing pairs unrouted, and the error is only reported
+ * if a traffic flow requests the pair.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "vtr_ndmatrix.h"
+
+#include "noc_routing.h"
+
+class NocRouteTable : public NocRouting {
+  public:
+    /**
+     * @brief Creates a table of the routes found by routing_algorithm.
+     *
+     * @param routing_algorithm The NoC routing algorithm whose routes are stored.
+     */
+    explicit NocRouteTable(std::unique_ptr<NocRouting> routing_algorithm);
+
+    ~NocRouteTable() override;
+
+    /**
+     * @brief Finds the routes between all pairs of routers of noc_model, in parallel
+     * across the source routers when VPR is built with TBB.
+     *
+     * The wrapped routing algorithm must support concurrent route_flow() calls (the
+     * XY and BFS routing keep no state between calls). Pairs the routing algorithm
+     * fails on are left unrouted.
+     *
+     * @param noc_model A model of the NoC, whose topology all later calls must use.
+     */
+    void build(const NocStorage& noc_model);
+
+    /**
+     * @brief Returns (in flow_route) the route between the two routers found by
+     * the wrapped routing algorithm, routing the pair only if it was not routed before.
+     *
+     * @param src_router_id The source router of a traffic flow.
+     * @param sink_router_id The destination router of a traffic flow.
+     * @param flow_route Stores the path, replacing any previously stored path.
+     * @param noc_model A model of the NoC. All calls must be made with the same
+     * (unchanged) NoC topology.
+     */
+    void route_flow(NocRouterId src_router_id, NocRouterId sink_router_id, std::vector<NocLinkId>& flow_route, const NocStorage& noc_model) override;
+
+  private:
+    // size the table for the routers of noc_model, if not already done
+    void alloc_table(const NocStorage& noc_model);
+
+    std::unique_ptr<NocRouting> routing_algorithm_;
+
+    // [src_router_id][sink_router_id] -> the route between the routers, valid if is_routed_ is set
+    vtr::Matrix<std::vector<NocLinkId>> routes_;
+    vtr::Matrix<bool> is_routed_;
+};
+
+#endif
@@ -40,6 +40,7 @@
 #include <map>
 #include <algorithm>
 #include <fstream>
+#include <deque>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -151,9 +152,13 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
 
     helper_ctx.enable_pin_feasibility_filter = packer_opts.enable_pin_feasibility_filter;
     helper_ctx.feasible_block_array_size = packer_opts.feasible_block_array_size;
+    helper_ctx.incremental_intra_lb_route = packer_opts.pack_incremental_intra_lb_route;
+    reset_gain_update_stats();
+    helper_ctx.pack_stats.init(packer_opts.pack_stats_file, packer_opts.pack_stats_interval);
 
     std::shared_ptr<PreClusterDelayCalculator> clustering_delay_calc;
     std::shared_ptr<SetupTimingInfo> timing_info;
+    t_packing_timing_update_stats timing_update_stats;
 
     // this data structure tracks the number of Logic Elements (LEs) used. It is
     // populated only for architectures which has LEs. The architecture is assumed
@@ -230,14 +235,28 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
 
     print_pack_status_header();
 
+    /* Clusters whose route at end runs on other threads while the next clusters are grown (see --pack_parallel_routes).
+     * When one fails, its seed is repacked starting from restart_detailed_routing_stage */
+    std::deque<t_pending_cluster_route> pending_routes;
+    int restart_detailed_routing_stage = (int)E_DETAILED_ROUTE_AT_END_ONLY;
+
     /****************************************************************
      * Clustering
      *****************************************************************/
 
     while (istart != nullptr) {
+        if (packer_opts.timing_driven && packer_opts.pack_timing_update_interval > 0
+            && cluster_stats.clusters_since_last_analysis >= packer_opts.pack_timing_update_interval) {
+            //Refresh the criticalities used by the timing gains of the next clusters
+            update_packing_timing(*clustering_delay_calc, *timing_info, timing_update_stats);
+            cluster_stats.clusters_since_last_analysis = 0;
+        }
+
         is_cluster_legal = false;
         savedseedindex = seedindex;
-        for (detailed_routing_stage = (int)E_DETAILED_ROUTE_AT_END_ONLY; !is_cluster_legal && detailed_routing_stage != (int)E_DETAILED_ROUTE_INVALID; detailed_routing_stage++) {
+        int first_detailed_routing_stage = restart_detailed_routing_stage;
+        restart_detailed_routing_stage = (int)E_DETAILED_ROUTE_AT_END_ONLY;
+        for (detailed_routing_stage = first_detailed_routing_stage; !is_cluster_legal && detailed_routing_stage != (int)E_DETAILED_ROUTE_INVALID; detailed_routing_stage++) {
             ClusterBlockId clb_index(helper_ctx.total_clb_num);
 
             VTR_LOGV(verbosity > 2, "Complex block %d:\n", helper_ctx.total_clb_num);
@@ -272,6 +291,7 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
                               device_ctx.grid.width(),
                               device_ctx.grid.height(),
                               attraction_groups);
+            helper_ctx.pack_stats.snapshot(helper_ctx.total_clb_num, cluster_stats.num_molecules_processed, cluster_stats.num_molecules, false);
 
             VTR_LOGV(verbosity > 2,
                      "Complex block %d: '%s' (%s) ", helper_ctx.total_clb_num,
@@ -365,11 +385,36 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
                                  primitive_candidate_block_types);
             }
 
+            if (packer_opts.pack_parallel_routes > 0 && detailed_routing_stage == (int)E_DETAILED_ROUTE_AT_END_ONLY) {
+                //Route the cluster in the background, and carry on as if it were legal
+                start_pending_cluster_route(pending_routes, packer_opts, clb_index, istart, savedseedindex, router_data,
+                                            logic_block_type, le_pb_type, le_count, clb_inter_blk_nets);
+                router_data = nullptr;
+                is_cluster_legal = true;
+                cluster_stats.clusters_since_last_analysis++;
+
+                istart = get_highest_gain_seed_molecule(&seedindex, seed_atoms);
+                if (packer_opts.timing_driven && num_blocks_hill_added > 0) {
+                    cluster_stats.blocks_since_last_analysis += num_blocks_hill_added;
+                }
+
+                //Bound the routes in flight, and drain them once there are no seeds left
+                while (pending_routes.size() > size_t(packer_opts.pack_parallel_routes) || (istart == nullptr && !pending_routes.empty())) {
+                    if (!finish_oldest_cluster_route(pending_routes, clustering_data.intra_lb_routing, verbosity)) {
+                        istart = undo_pending_clusters(pending_routes, num_used_type_instances, helper_ctx.total_clb_num,
+                                                       seedindex, le_count, clb_inter_blk_nets);
+                        restart_detailed_routing_stage = (int)E_DETAILED_ROUTE_AT_END_ONLY + 1;
+                    }
+                }
+                continue;
+            }
+
             is_cluster_legal = check_cluster_legality(verbosity, detailed_routing_stage, router_data);
 
             if (is_cluster_legal) {
                 istart = save_cluster_routing_and_pick_new_seed(packer_opts, helper_ctx.total_clb_num, seed_atoms, num_blocks_hill_added, clustering_data.intra_lb_routing, seedindex, cluster_stats, router_data);
                 store_cluster_info_and_free(packer_opts, clb_index, logic_block_type, le_pb_type, le_count, clb_inter_blk_nets);
+                cluster_stats.clusters_since_last_analysis++;
             } else {
                 free_data_and_requeue_used_mols_if_illegal(clb_index, savedseedindex, num_used_type_instances, helper_ctx.total_clb_num, seedindex);
             }
@@ -377,6 +422,14 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
             router_data = nullptr;
         }
     }
+    VTR_ASSERT(pending_routes.empty());
+    report_and_clear_intra_lb_route_cache();
+    print_gain_update_stats(verbosity);
+    if (timing_update_stats.num_updates > 0) {
+        VTR_LOG("Packing timing updates: %zu (%zu edges invalidated), took %g seconds\n",
+                timing_update_stats.num_updates, timing_update_stats.num_invalidated_edges, timing_update_stats.time);
+    }
+    helper_ctx.pack_stats.snapshot(helper_ctx.total_clb_num, cluster_stats.num_molecules_processed, cluster_stats.num_molecules, true);
 
     // if this architecture has LE physical block, report its usage
     if (le_pb_type) {
@@ -17,6 +17,8 @@
  * November 17, 2022
  */
 
+#include <algorithm>
+
 #include "vtr_assert.h"
 #include "vtr_memory.h"
 
@@ -26,11 +28,18 @@
 #include "hash.h"
 #include "cluster_placement.h"
 
+/* The last bit of an atom signature marks it as computed, so the signatures hold up to 63 pb_types */
+static constexpr size_t MAX_SIGNATURE_PB_TYPES = 63;
+static constexpr t_pb_type_signature SIGNATURE_COMPUTED = t_pb_type_signature(1) << MAX_SIGNATURE_PB_TYPES;
+
 /****************************************/
 /*Local Function Declaration			*/
 /****************************************/
 static void load_cluster_placement_stats_for_pb_graph_node(t_cluster_placement_stats* cluster_placement_stats,
                                                            t_pb_graph_node* pb_graph_node);
+static void load_free_pb_types(t_cluster_placement_stats* cluster_placement_stats);
+static t_pb_type_signature get_atom_feasible_pb_types(t_cluster_placement_stats* cluster_placement_stats,
+                                                      const AtomBlockId blk_id);
 static void update_primitive_cost_or_status(const t_pb_graph_node* pb_graph_node,
                                             float incremental_cost,
                                             bool valid);
@@ -67,6 +76,7 @@ t_cluster_placement_stats* alloc_and_load_cluster_placement_stats() {
             cluster_placement_stats_list[type.index].curr_molecule = nullptr;
             load_cluster_placement_stats_for_pb_graph_node(&cluster_placement_stats_list[type.index],
                                                            type.pb_graph_head);
+            load_free_pb_types(&cluster_placement_stats_list[type.index]);
         }
     }
     return cluster_placement_stats_list;
@@ -184,12 +194,15 @@ void reset_cluster_placement_stats(t_cluster_placement_stats* cluster_placement_
     cluster_placement_stats->flush_invalid_queue();
 
     /* reset flags and cost */
+    std::fill(cluster_placement_stats->num_free_primitives.begin(), cluster_placement_stats->num_free_primitives.end(), 0);
     for (i = 0; i < cluster_placement_stats->num_pb_types; i++) {
         for (auto& primitive : cluster_placement_stats->valid_primitives[i]) {
             primitive.second->incremental_cost = 0;
             primitive.second->valid = true;
+            cluster_placement_stats->num_free_primitives[primitive.second->pb_type_index]++;
         }
     }
+    load_free_pb_types(cluster_placement_stats);
     cluster_placement_stats->curr_molecule = nullptr;
     cluster_placement_stats->has_long_chain = false;
 }
@@ -211,6 +224,15 @@ static void load_cluster_placement_stats_for_pb_graph_node(t_cluster_placement_s
         pb_graph_node->cluster_placement_primitive = placement_primitive;
         placement_primitive->base_cost = compute_primitive_base_cost(pb_graph_node);
 
+        auto& pb_types = cluster_placement_stats->primitive_pb_types;
+        auto pb_type_iter = std::find(pb_types.begin(), pb_types.end(), pb_type);
+        if (pb_type_iter == pb_types.end()) {
+            pb_type_iter = pb_types.insert(pb_types.end(), pb_type);
+            cluster_placement_stats->num_free_primitives.push_back(0);
+        }
+        placement_primitive->pb_type_index = pb_type_iter - pb_types.begin();
+        cluster_placement_stats->num_free_primitives[placement_primitive->pb_type_index]++;
+
         bool success = false;
         /**
          * Insert the cluster_placement_primitive in the corresponding valid_primitives location based on its pb_type
@@ -275,6 +297,9 @@ void commit_primitive(t_cluster_placement_stats* cluster_placement_stats,
     VTR_ASSERT(cur->valid == true);
 
     cur->valid = false;
+    if (--cluster_placement_stats->num_free_primitives[cur->pb_type_index] == 0) {
+        load_free_pb_types(cluster_placement_stats);
+    }
     incr_cost = -0.01; /* cost of using a node drops as its neighbours are used, this drop should be small compared to scarcity values */
 
     pb_graph_node = cur->pb_graph_node;
@@ -564,6 +589,75 @@ int get_array_size_of_molecule(const t_pack_molecule* molecule) {
     }
 }
 
+/**
+ * Cheap necessary condition for the molecule to fit in the cluster, checked with the pb_type signatures
+ * before searching for its primitives: each atom must be feasible in a pb_type with free primitives, and
+ * those pb_types must have at least as many free primitives as the molecule has atoms.
+ *
+ * Primitives invalidated by the modes selected in the cluster are still counted as free, so a molecule
+ * passing this check may still not fit.
+ */
+bool molecule_fits_free_primitives(t_cluster_placement_stats* cluster_placement_stats,
+                                   const t_pack_molecule* molecule) {
+    if (cluster_placement_stats->primitive_pb_types.size() > MAX_SIGNATURE_PB_TYPES) {
+        //Too many pb_types for the signatures, leave it to the primitive search
+        return true;
+    }
+
+    t_pb_type_signature molecule_pb_types = 0;
+    int num_atoms = 0;
+    for (auto blk_id : molecule->atom_block_ids) {
+        if (!blk_id) {
+            continue;
+        }
+
+        t_pb_type_signature atom_pb_types = get_atom_feasible_pb_types(cluster_placement_stats, blk_id) & cluster_placement_stats->free_pb_types;
+        if (!atom_pb_types) {
+            return false;
+        }
+        molecule_pb_types |= atom_pb_types;
+        num_atoms++;
+    }
+
+    int num_free_primitives = 0;
+    for (size_t i = 0; i < cluster_placement_stats->primitive_pb_types.size() && num_free_primitives < num_atoms; i++) {
+        if (molecule_pb_types & (t_pb_type_signature(1) << i)) {
+            num_free_primitives += cluster_placement_stats->num_free_primitives[i];
+        }
+    }
+    return num_free_primitives >= num_atoms;
+}
+
+/* Updates the pb_types with free primitives from the free primitive counts */
+static void load_free_pb_types(t_cluster_placement_stats* cluster_placement_stats) {
+    cluster_placement_stats->free_pb_types = 0;
+    for (size_t i = 0; i < cluster_placement_stats->primitive_pb_types.size() && i < MAX_SIGNATURE_PB_TYPES; i++) {
+        if (cluster_placement_stats->num_free_primitives[i] > 0) {
+            cluster_placement_stats->free_pb_types |= t_pb_type_signature(1) << i;
+        }
+    }
+}
+
+/* Returns the pb_types the atom is feasible in, computing them on first use */
+static t_pb_type_signature get_atom_feasible_pb_types(t_cluster_placement_stats* cluster_placement_stats,
+                                                      const AtomBlockId blk_id) {
+    auto& atom_feasible_pb_types = cluster_placement_stats->atom_feasible_pb_types;
+    if (atom_feasible_pb_types.size() <= size_t(blk_id)) {
+        atom_feasible_pb_types.resize(g_vpr_ctx.atom().nlist.blocks().size(), 0);
+    }
+
+    t_pb_type_signature& atom_pb_types = atom_feasible_pb_types[blk_id];
+    if (!(atom_pb_types & SIGNATURE_COMPUTED)) {
+        atom_pb_types = SIGNATURE_COMPUTED;
+        for (size_t i = 0; i < cluster_placement_stats->primitive_pb_types.size(); i++) {
+            if (primitive_type_feasible(blk_id, cluster_placement_stats->primitive_pb_types[i])) {
+                atom_pb_types |= t_pb_type_signature(1) << i;
+            }
+        }
+    }
+    return atom_pb_types & ~SIGNATURE_COMPUTED;
+}
+
 /* Given atom block, determines if a free primitive exists for it */
 bool exists_free_primitive_for_atom_block(t_cluster_placement_stats* cluster_placement_stats,
                                           const AtomBlockId blk_id) {
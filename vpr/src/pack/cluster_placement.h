@@ -20,6 +20,9 @@ void reset_cluster_placement_stats(
     t_cluster_placement_stats* cluster_placement_stats);
 
 int get_array_size_of_molecule(const t_pack_molecule* molecule);
+bool molecule_fits_free_primitives(
+    t_cluster_placement_stats* cluster_placement_stats,
+    const t_pack_molecule* molecule);
 bool exists_free_primitive_for_atom_block(
     t_cluster_placement_stats* cluster_placement_stats,
     const AtomBlockId blk_id);
@@ -18,8 +18,11 @@
 #include <map>
 #include <queue>
 #include <cmath>
+#include <mutex>
+#include <unordered_set>
 
 #include "vtr_assert.h"
+#include "vtr_hash.h"
 #include "vtr_log.h"
 
 #include "vpr_error.h"
@@ -69,9 +72,61 @@ class reservable_pq : public std::priority_queue<T, U, V> {
     size_type cur_cap;
 };
 
+/* Bound on the number of configurations remembered by the route failure cache, which is emptied when full */
+constexpr size_t MAX_INTRA_LB_ROUTE_CACHE_SIZE = 1 << 16;
+
+/* Hashes the key of an intra-logic block routing configuration (see intra_lb_route_key()) */
+struct intra_lb_route_key_hash {
+    size_t operator()(const std::vector<int>& key) const {
+        size_t hash = key.size();
+        for (int value : key) {
+            vtr::hash_combine(hash, value);
+        }
+        return hash;
+    }
+};
+
+/* The routing configurations which failed to route from scratch, shared by all clusters (and threads).
+ *
+ * The outcome of routing from scratch only depends on the logic block type, the terminals of each net
+ * (in order, since Pathfinder is order dependent) and the modes of the rr nodes, so identical
+ * configurations (e.g. the same candidate retried, or the same candidate for identical clusters)
+ * are answered without routing. Successes are not remembered, as their routing must be kept. */
+struct t_intra_lb_route_cache {
+    std::mutex mutex;
+    std::unordered_set<std::vector<int>, intra_lb_route_key_hash> failed_configurations;
+    size_t num_lookups = 0;
+    size_t num_hits = 0;
+};
+static t_intra_lb_route_cache intra_lb_route_cache;
+
+/* The node tables of freed router data, reset to their defaults, for reuse by the next cluster of the same type.
+ * Allocating (and constructing) the tables of the whole lb type graph for each cluster would otherwise cost as much
+ * as the routes of small clusters */
+struct t_lb_router_tables {
+    t_lb_rr_node_stats* lb_rr_node_stats;
+    t_explored_node_tb* explored_node_tb;
+    std::vector<int> touched_nodes;
+    std::vector<char> is_node_touched;
+};
+struct t_lb_router_data_pool {
+    std::mutex mutex;
+    std::map<const std::vector<t_lb_type_rr_node>*, std::vector<t_lb_router_tables>> free_tables; /* Keyed by lb type graph */
+};
+static t_lb_router_data_pool lb_router_data_pool;
+
 /*****************************************************************************************
  * Internal functions declarations
  ******************************************************************************************/
+static bool route_intra_lb_nets(t_lb_router_data* router_data,
+                                int verbosity,
+                                t_mode_selection_status* mode_status,
+                                int max_iterations,
+                                bool reuse_saved_routes);
+static std::vector<int> intra_lb_route_key(const t_lb_router_data* router_data);
+static bool is_route_tree_expandable(const t_lb_trace& rt, const t_lb_router_data* router_data);
+static void mark_lb_rr_node_touched(t_lb_router_data* router_data, int inode);
+static void reset_touched_lb_rr_nodes(t_lb_router_data* router_data, bool reset_modes);
 static void free_lb_net_rt(t_lb_trace* lb_trace);
 static void free_lb_trace(t_lb_trace* lb_trace);
 static void add_pin_to_rt_terminals(t_lb_router_data* router_data, const AtomPinId pin_id);
@@ -105,7 +160,6 @@ static void expand_node_all_modes(t_lb_router_data* router_data, t_expansion_nod
 static bool add_to_rt(t_lb_trace* rt, int node_index, t_lb_router_data* router_data, int irt_net);
 static bool is_route_success(t_lb_router_data* router_data);
 static t_lb_trace* find_node_in_rt(t_lb_trace* rt, int rt_index);
-static void reset_explored_node_tb(t_lb_router_data* router_data);
 static void save_and_reset_lb_route(t_lb_router_data* router_data);
 static void load_trace_to_pb_route(t_pb_routes& pb_route, const int total_pins, const AtomNetId net_id, const int prev_pin_id, const t_lb_trace* trace);
 
@@ -139,8 +193,27 @@ t_lb_router_data* alloc_and_load_router_data(std::vector<t_lb_type_rr_node>* lb_
 
     router_data->lb_type_graph = lb_type_graph;
     size = router_data->lb_type_graph->size();
-    router_data->lb_rr_node_stats = new t_lb_rr_node_stats[size];
-    router_data->explored_node_tb = new t_explored_node_tb[size];
+
+    /* Reuse the tables of a previous cluster of this type if there are some */
+    {
+        std::lock_guard<std::mutex> lock(lb_router_data_pool.mutex);
+        auto free_tables_iter = lb_router_data_pool.free_tables.find(lb_type_graph);
+        if (free_tables_iter != lb_router_data_pool.free_tables.end() && !free_tables_iter->second.empty()) {
+            t_lb_router_tables& tables = free_tables_iter->second.back();
+            router_data->lb_rr_node_stats = tables.lb_rr_node_stats;
+            router_data->explored_node_tb = tables.explored_node_tb;
+            router_data->touched_nodes = std::move(tables.touched_nodes);
+            router_data->is_node_touched = std::move(tables.is_node_touched);
+            free_tables_iter->second.pop_back();
+        }
+    }
+    if (router_data->lb_rr_node_stats == nullptr) {
+        router_data->lb_rr_node_stats = new t_lb_rr_node_stats[size];
+        router_data->explored_node_tb = new t_explored_node_tb[size];
+        router_data->is_node_touched.resize(size, false);
+    }
+    VTR_ASSERT(router_data->touched_nodes.empty());
+
     router_data->intra_lb_nets = new std::vector<t_intra_lb_net>;
     router_data->atoms_added = new std::map<AtomBlockId, bool>;
     router_data->lb_type = type;
@@ -151,9 +224,16 @@ t_lb_router_data* alloc_and_load_router_data(std::vector<t_lb_type_rr_node>* lb_
 /* free data used by router */
 void free_router_data(t_lb_router_data* router_data) {
     if (router_data != nullptr && router_data->lb_type_graph != nullptr) {
-        delete[] router_data->lb_rr_node_stats;
+        /* Return the node tables, reset to their defaults, to the pool */
+        reset_touched_lb_rr_nodes(router_data, true);
+        {
+            std::lock_guard<std::mutex> lock(lb_router_data_pool.mutex);
+            lb_router_data_pool.free_tables[router_data->lb_type_graph].push_back({router_data->lb_rr_node_stats,
+                                                                                     router_data->explored_node_tb,
+                                                                                     std::move(router_data->touched_nodes),
+                                                                                     std::move(router_data->is_node_touched)});
+        }
         router_data->lb_rr_node_stats = nullptr;
-        delete[] router_data->explored_node_tb;
         router_data->explored_node_tb = nullptr;
         router_data->lb_type_graph = nullptr;
         delete router_data->atoms_added;
@@ -165,6 +245,18 @@ void free_router_data(t_lb_router_data* router_data) {
     }
 }
 
+/* Frees the node tables kept for reuse (must be called before the lb type graphs are freed) */
+void free_router_data_pool() {
+    std::lock_guard<std::mutex> lock(lb_router_data_pool.mutex);
+    for (auto& graph_tables : lb_router_data_pool.free_tables) {
+        for (t_lb_router_tables& tables : graph_tables.second) {
+            delete[] tables.lb_rr_node_stats;
+            delete[] tables.explored_node_tb;
+        }
+    }
+    lb_router_data_pool.free_tables.clear();
+}
+
 static bool route_has_conflict(t_lb_trace* rt, t_lb_router_data* router_data) {
     std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
 
@@ -311,12 +403,14 @@ void set_reset_pb_modes(t_lb_router_data* router_data, const t_pb* pb, const boo
     for (int iport = 0; iport < pb_graph_node->num_input_ports; iport++) {
         for (int ipin = 0; ipin < pb_graph_node->num_input_pins[iport]; ipin++) {
             inode = pb_graph_node->input_pins[iport][ipin].pin_count_in_cluster;
+            mark_lb_rr_node_touched(router_data, inode);
             router_data->lb_rr_node_stats[inode].mode = (set == true) ? mode : -1;
         }
     }
     for (int iport = 0; iport < pb_graph_node->num_clock_ports; iport++) {
         for (int ipin = 0; ipin < pb_graph_node->num_clock_pins[iport]; ipin++) {
             inode = pb_graph_node->clock_pins[iport][ipin].pin_count_in_cluster;
+            mark_lb_rr_node_touched(router_data, inode);
             router_data->lb_rr_node_stats[inode].mode = (set == true) ? mode : -1;
         }
     }
@@ -331,6 +425,7 @@ void set_reset_pb_modes(t_lb_router_data* router_data, const t_pb* pb, const boo
                 for (int iport = 0; iport < child_pb_graph_node->num_output_ports; iport++) {
                     for (int ipin = 0; ipin < child_pb_graph_node->num_output_pins[iport]; ipin++) {
                         inode = child_pb_graph_node->output_pins[iport][ipin].pin_count_in_cluster;
+                        mark_lb_rr_node_touched(router_data, inode);
                         router_data->lb_rr_node_stats[inode].mode = (set == true) ? mode : -1;
                     }
                 }
@@ -403,6 +498,67 @@ static bool try_expand_nodes(t_lb_router_data* router_data,
 bool try_intra_lb_route(t_lb_router_data* router_data,
                         int verbosity,
                         t_mode_selection_status* mode_status) {
+    ScopedPackPhaseTimer phase_timer(g_vpr_ctx.mutable_cl_helper().pack_stats, PACK_PHASE_INTRA_LB_ROUTE);
+
+    /* First keep the last legal routing of the unchanged nets, and route the others in a single pass.
+     * If that fails, the cluster is routed from scratch as usual */
+    if (g_vpr_ctx.cl_helper().incremental_intra_lb_route && router_data->saved_lb_nets != nullptr && !mode_status->expand_all_modes) {
+        t_mode_selection_status initial_mode_status = *mode_status;
+        if (route_intra_lb_nets(router_data, verbosity, mode_status, 1, true)) {
+            return true;
+        }
+        *mode_status = initial_mode_status;
+    }
+
+    /* Routing with all modes also depends on the illegal modes found so far, so is not cached */
+    bool is_cacheable = !mode_status->expand_all_modes;
+    std::vector<int> key;
+    if (is_cacheable) {
+        key = intra_lb_route_key(router_data);
+
+        std::lock_guard<std::mutex> lock(intra_lb_route_cache.mutex);
+        ++intra_lb_route_cache.num_lookups;
+        if (intra_lb_route_cache.failed_configurations.count(key)) {
+            ++intra_lb_route_cache.num_hits;
+            mode_status->is_mode_conflict = false;
+            mode_status->try_expand_all_modes = false;
+            return false;
+        }
+    }
+
+    bool is_routed = route_intra_lb_nets(router_data, verbosity, mode_status, router_data->params.max_iterations, false);
+
+    /* Mode issues make the caller retry the same configuration differently, so are not cached */
+    if (!is_routed && is_cacheable && !mode_status->is_mode_issue()) {
+        std::lock_guard<std::mutex> lock(intra_lb_route_cache.mutex);
+        if (intra_lb_route_cache.failed_configurations.size() >= MAX_INTRA_LB_ROUTE_CACHE_SIZE) {
+            intra_lb_route_cache.failed_configurations.clear();
+        }
+        intra_lb_route_cache.failed_configurations.insert(std::move(key));
+    }
+
+    return is_routed;
+}
+
+/* Reports how many routes were answered by the route failure cache, and empties it */
+void report_and_clear_intra_lb_route_cache() {
+    std::lock_guard<std::mutex> lock(intra_lb_route_cache.mutex);
+    if (intra_lb_route_cache.num_lookups > 0) {
+        VTR_LOG("Intra-cluster routing: %zu of %zu routes from scratch answered by the route failure cache\n",
+                intra_lb_route_cache.num_hits, intra_lb_route_cache.num_lookups);
+    }
+    intra_lb_route_cache.failed_configurations.clear();
+    intra_lb_route_cache.num_lookups = 0;
+    intra_lb_route_cache.num_hits = 0;
+}
+
+/* Pathfinder routing of the cluster nets, for at most max_iterations.
+ * If reuse_saved_routes is true, the nets whose terminals are unchanged since the last legal routing start from their saved route */
+static bool route_intra_lb_nets(t_lb_router_data* router_data,
+                                int verbosity,
+                                t_mode_selection_status* mode_status,
+                                int max_iterations,
+                                bool reuse_saved_routes) {
     std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
     std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
     bool is_routed = false;
@@ -416,24 +572,35 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
     /* Stores state info during route */
     reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node> pq;
 
-    reset_explored_node_tb(router_data);
-
-    /* Reset current routing */
+    /* Reset current routing (only the touched nodes can differ from their defaults) */
     for (unsigned int inet = 0; inet < lb_nets.size(); inet++) {
         free_lb_net_rt(lb_nets[inet].rt_tree);
         lb_nets[inet].rt_tree = nullptr;
     }
-    for (unsigned int inode = 0; inode < lb_type_graph.size(); inode++) {
-        router_data->lb_rr_node_stats[inode].historical_usage = 0;
-        router_data->lb_rr_node_stats[inode].occ = 0;
-    }
+    reset_touched_lb_rr_nodes(router_data, false);
 
     std::unordered_map<const t_pb_graph_node*, const t_mode*> mode_map;
 
+    if (reuse_saved_routes) {
+        /* Uncongested reused routes are skipped by the first iteration, which then only routes the other nets */
+        const std::vector<t_intra_lb_net>& saved_lb_nets = *router_data->saved_lb_nets;
+        for (unsigned int inet = 0; inet < lb_nets.size() && inet < saved_lb_nets.size(); inet++) {
+            const t_intra_lb_net& saved_lb_net = saved_lb_nets[inet];
+            if (saved_lb_net.rt_tree == nullptr
+                || saved_lb_net.atom_net_id != lb_nets[inet].atom_net_id
+                || saved_lb_net.terminals != lb_nets[inet].terminals
+                || !is_route_tree_expandable(*saved_lb_net.rt_tree, router_data)) {
+                continue;
+            }
+            lb_nets[inet].rt_tree = new t_lb_trace(*saved_lb_net.rt_tree);
+            commit_remove_rt(lb_nets[inet].rt_tree, router_data, RT_COMMIT, &mode_map, mode_status);
+        }
+    }
+
     /*	Iteratively remove congestion until a successful route is found.
      * Cap the total number of iterations tried so that if a solution does not exist, then the router won't run indefinitely */
     router_data->pres_con_fac = router_data->params.pres_fac;
-    for (int iter = 0; iter < router_data->params.max_iterations && !is_routed && !is_impossible; iter++) {
+    for (int iter = 0; iter < max_iterations && !is_routed && !is_impossible; iter++) {
         unsigned int inet;
         /* Iterate across all nets internal to logic block */
         for (inet = 0; inet < lb_nets.size() && !is_impossible; inet++) {
@@ -538,6 +705,51 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
     return is_routed;
 }
 
+/* Returns the key under which the current routing configuration is cached: the logic block type,
+ * the terminals of each net, and the mode of each rr node with a mode set */
+static std::vector<int> intra_lb_route_key(const t_lb_router_data* router_data) {
+    std::vector<int> key;
+    key.push_back(router_data->lb_type->index);
+
+    for (const t_intra_lb_net& lb_net : *router_data->intra_lb_nets) {
+        key.push_back(lb_net.terminals.size());
+        key.insert(key.end(), lb_net.terminals.begin(), lb_net.terminals.end());
+    }
+
+    /* Net sizes are positive, so this separates the nets from the modes */
+    key.push_back(OPEN);
+    for (unsigned int inode = 0; inode < router_data->lb_type_graph->size(); inode++) {
+        if (router_data->lb_rr_node_stats[inode].mode != -1) {
+            key.push_back(inode);
+            key.push_back(router_data->lb_rr_node_stats[inode].mode);
+        }
+    }
+    return key;
+}
+
+/* Returns true if every edge of the route tree could be expanded by the router with the current rr node modes
+ * (see expand_node()), so the route is still valid */
+static bool is_route_tree_expandable(const t_lb_trace& rt, const t_lb_router_data* router_data) {
+    const std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
+    const t_lb_type_rr_node& node = lb_type_graph[rt.current_node];
+
+    int mode = router_data->lb_rr_node_stats[rt.current_node].mode;
+    if (mode == -1) {
+        mode = 0;
+    }
+
+    for (const t_lb_trace& next : rt.next_nodes) {
+        bool has_edge = false;
+        for (int iedge = 0; iedge < node.num_fanout[mode] && !has_edge; iedge++) {
+            has_edge = (node.outedges[mode][iedge].node_index == next.current_node);
+        }
+        if (!has_edge || !is_route_tree_expandable(next, router_data)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /*****************************************************************************************
  * Accessor Functions
  ******************************************************************************************/
@@ -987,6 +1199,7 @@ static void commit_remove_rt(t_lb_trace* rt, t_lb_router_data* router_data, e_co
     }
 
     inode = rt->current_node;
+    mark_lb_rr_node_touched(router_data, inode);
 
     /* Determine if node is being used or removed */
     if (op == RT_COMMIT) {
@@ -1059,6 +1272,7 @@ static void add_source_to_rt(t_lb_router_data* router_data, int inet) {
     VTR_ASSERT((*router_data->intra_lb_nets)[inet].rt_tree == nullptr);
     (*router_data->intra_lb_nets)[inet].rt_tree = new t_lb_trace;
     (*router_data->intra_lb_nets)[inet].rt_tree->current_node = (*router_data->intra_lb_nets)[inet].terminals[0];
+    mark_lb_rr_node_touched(router_data, (*router_data->intra_lb_nets)[inet].terminals[0]);
 }
 
 /* Expand all nodes found in route tree into priority queue */
@@ -1141,6 +1355,7 @@ static void expand_edges(t_lb_router_data* router_data,
                 pq.push(enode);
             }
         } else {
+            mark_lb_rr_node_touched(router_data, enode.node_index);
             router_data->explored_node_tb[enode.node_index].enqueue_id = router_data->explore_id_index;
             router_data->explored_node_tb[enode.node_index].enqueue_cost = enode.cost;
             pq.push(enode);
@@ -1317,14 +1532,28 @@ static void print_trace(FILE* fp, t_lb_trace* trace, t_lb_router_data* router_da
     }
 }
 
-static void reset_explored_node_tb(t_lb_router_data* router_data) {
-    std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
-    for (unsigned int inode = 0; inode < lb_type_graph.size(); inode++) {
-        router_data->explored_node_tb[inode].prev_index = OPEN;
-        router_data->explored_node_tb[inode].explored_id = OPEN;
-        router_data->explored_node_tb[inode].inet = OPEN;
-        router_data->explored_node_tb[inode].enqueue_id = OPEN;
-        router_data->explored_node_tb[inode].enqueue_cost = 0;
+/* Records that the stats or exploration info of inode may differ from their defaults */
+static void mark_lb_rr_node_touched(t_lb_router_data* router_data, int inode) {
+    if (!router_data->is_node_touched[inode]) {
+        router_data->is_node_touched[inode] = true;
+        router_data->touched_nodes.push_back(inode);
+    }
+}
+
+/* Resets the exploration info, occupancy and historical usage of the touched nodes, and their modes if reset_modes is true.
+ * The modes are set by the atoms in the cluster, so are kept between routes, along with the touched nodes */
+static void reset_touched_lb_rr_nodes(t_lb_router_data* router_data, bool reset_modes) {
+    for (int inode : router_data->touched_nodes) {
+        router_data->explored_node_tb[inode] = t_explored_node_tb();
+        router_data->lb_rr_node_stats[inode].historical_usage = 0;
+        router_data->lb_rr_node_stats[inode].occ = 0;
+        if (reset_modes) {
+            router_data->lb_rr_node_stats[inode].mode = -1;
+            router_data->is_node_touched[inode] = false;
+        }
+    }
+    if (reset_modes) {
+        router_data->touched_nodes.clear();
     }
 }
 
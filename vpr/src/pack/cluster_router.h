@@ -13,6 +13,7 @@
 /* Constructors/Destructors */
 t_lb_router_data* alloc_and_load_router_data(std::vector<t_lb_type_rr_node>* lb_type_graph, t_logical_block_type_ptr type);
 void free_router_data(t_lb_router_data* router_data);
+void free_router_data_pool();
 void free_intra_lb_nets(std::vector<t_intra_lb_net>* intra_lb_nets);
 
 /* Routing Functions */
@@ -20,6 +21,7 @@ void add_atom_as_target(t_lb_router_data* router_data, const AtomBlockId blk_id)
 void remove_atom_from_target(t_lb_router_data* router_data, const AtomBlockId blk_id);
 void set_reset_pb_modes(t_lb_router_data* router_data, const t_pb* pb, const bool set);
 bool try_intra_lb_route(t_lb_router_data* router_data, int verbosity, t_mode_selection_status* mode_status);
+void report_and_clear_intra_lb_route_cache();
 void reset_intra_lb_route(t_lb_router_data* router_data);
 
 /* Accessor Functions */
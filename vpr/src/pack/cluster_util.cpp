@@ -1,11 +1,15 @@
 #include "cluster_util.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "cluster_router.h"
 #include "cluster_placement.h"
 #include "output_clustering.h"
 
 #include "vtr_math.h"
 #include "SetupGrid.h"
+#include "async_file_writer.h"
 
 /**********************************/
 /* Global variables in clustering */
@@ -94,7 +98,7 @@ static void echo_clusters(char* filename) {
     auto& floorplanning_ctx = g_vpr_ctx.mutable_floorplanning();
 
     for (ClusterBlockId clb_id : cluster_ctx.clb_nlist.blocks()) {
-        std::vector<Region> reg = floorplanning_ctx.cluster_constraints[clb_id].get_partition_region();
+        const std::vector<Region>& reg = floorplanning_ctx.cluster_constraints[clb_id].get_partition_region();
         if (reg.size() != 0) {
             fprintf(fp, "\nRegions in Cluster %zu:\n", size_t(clb_id));
             for (unsigned int i = 0; i < reg.size(); i++) {
@@ -181,12 +185,20 @@ void calc_init_packing_timing(const t_packer_opts& packer_opts,
                               std::shared_ptr<SetupTimingInfo>& timing_info,
                               vtr::vector<AtomBlockId, float>& atom_criticality) {
     auto& atom_ctx = g_vpr_ctx.atom();
+    ScopedPackPhaseTimer phase_timer(g_vpr_ctx.mutable_cl_helper().pack_stats, PACK_PHASE_TIMING_ANALYSIS);
 
     /*
      * Initialize the timing analyzer
      */
     clustering_delay_calc = std::make_shared<PreClusterDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, packer_opts.inter_cluster_net_delay, expected_lowest_cost_pb_gnode);
-    timing_info = make_setup_timing_info(clustering_delay_calc, packer_opts.timing_update_type);
+
+    //Periodic timing updates while clustering only change the delays of a few connections,
+    //so incremental timing updates are used by default
+    e_timing_update_type timing_update_type = packer_opts.timing_update_type;
+    if (packer_opts.pack_timing_update_interval > 0 && timing_update_type == e_timing_update_type::AUTO) {
+        timing_update_type = e_timing_update_type::INCREMENTAL;
+    }
+    timing_info = make_setup_timing_info(clustering_delay_calc, timing_update_type);
 
     //Calculate the initial timing
     timing_info->update();
@@ -210,8 +222,9 @@ void calc_init_packing_timing(const t_packer_opts& packer_opts,
         tatum::TimingReporter timing_reporter(resolver, *timing_ctx.graph,
                                               *timing_ctx.constraints);
 
+        AsyncOutputFile os("pre_pack.report_timing.setup.rpt");
         timing_reporter.report_timing_setup(
-            "pre_pack.report_timing.setup.rpt",
+            os,
             *timing_info->setup_analyzer(),
             analysis_opts.timing_report_npaths);
     }
@@ -226,6 +239,78 @@ void calc_init_packing_timing(const t_packer_opts& packer_opts,
     }
 }
 
+void update_packing_timing(PreClusterDelayCalculator& clustering_delay_calc,
+                           SetupTimingInfo& timing_info,
+                           t_packing_timing_update_stats& update_stats) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+    auto& timing_ctx = g_vpr_ctx.timing();
+    const tatum::TimingGraph& tg = *timing_ctx.graph;
+    ScopedPackPhaseTimer phase_timer(g_vpr_ctx.mutable_cl_helper().pack_stats, PACK_PHASE_TIMING_ANALYSIS);
+    auto start_time = std::chrono::steady_clock::now();
+
+    //Find the atoms whose cluster changed since the last update, and the interconnect edges
+    //of their connections, with whether each edge was within a cluster before
+    std::vector<AtomBlockId> changed_blocks;
+    for (AtomBlockId blk : atom_ctx.nlist.blocks()) {
+        if (atom_ctx.lookup.atom_clb(blk) != clustering_delay_calc.atom_clb(blk)) {
+            changed_blocks.push_back(blk);
+        }
+    }
+
+    std::vector<std::pair<tatum::EdgeId, bool>> candidate_edges;
+    auto add_sink_edges = [&](AtomPinId sink_pin) {
+        tatum::NodeId sink_tnode = atom_ctx.lookup.atom_pin_tnode(sink_pin);
+        if (!sink_tnode) return;
+
+        for (tatum::EdgeId edge : tg.node_in_edges(sink_tnode)) {
+            if (tg.edge_type(edge) != tatum::EdgeType::INTERCONNECT) continue;
+
+            bool was_intra_cluster = clustering_delay_calc.is_intra_cluster_edge(tg.edge_src_node(edge), sink_tnode);
+            candidate_edges.emplace_back(edge, was_intra_cluster);
+        }
+    };
+    for (AtomBlockId blk : changed_blocks) {
+        //The connections driven by the block, and those it is a sink of
+        for (AtomPinId out_pin : atom_ctx.nlist.block_output_pins(blk)) {
+            AtomNetId net = atom_ctx.nlist.pin_net(out_pin);
+            if (!net) continue;
+            for (AtomPinId sink_pin : atom_ctx.nlist.net_sinks(net)) {
+                add_sink_edges(sink_pin);
+            }
+        }
+        for (AtomPinId in_pin : atom_ctx.nlist.block_input_pins(blk)) {
+            add_sink_edges(in_pin);
+        }
+        for (AtomPinId clock_pin : atom_ctx.nlist.block_clock_pins(blk)) {
+            add_sink_edges(clock_pin);
+        }
+    }
+
+    //An edge between two changed atoms is found from both of them
+    std::sort(candidate_edges.begin(), candidate_edges.end());
+    candidate_edges.erase(std::unique(candidate_edges.begin(), candidate_edges.end()), candidate_edges.end());
+
+    for (AtomBlockId blk : changed_blocks) {
+        clustering_delay_calc.set_atom_clb(blk, atom_ctx.lookup.atom_clb(blk));
+    }
+
+    //Only invalidate the edges whose delay changed
+    for (const auto& candidate_edge : candidate_edges) {
+        tatum::EdgeId edge = candidate_edge.first;
+        bool is_intra_cluster = clustering_delay_calc.is_intra_cluster_edge(tg.edge_src_node(edge), tg.edge_sink_node(edge));
+        if (is_intra_cluster != candidate_edge.second) {
+            timing_info.invalidate_delay(edge);
+            update_stats.num_invalidated_edges++;
+        }
+    }
+
+    timing_info.update();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    update_stats.time += elapsed.count();
+    update_stats.num_updates++;
+}
+
 //Free the clustering data structures
 void free_clustering_data(const t_packer_opts& packer_opts,
                           t_clustering_data& clustering_data) {
@@ -263,7 +348,7 @@ void check_and_output_clustering(const t_packer_opts& packer_opts,
         echo_clusters(getEchoFileName(E_ECHO_CLUSTERS));
     }
 
-    output_clustering(intra_lb_routing, packer_opts.global_clocks, is_clock, arch->architecture_id, packer_opts.output_file.c_str(), false);
+    cluster_ctx.packed_netlist_contents = output_clustering(intra_lb_routing, packer_opts.global_clocks, is_clock, arch->architecture_id, packer_opts.output_file.c_str(), false);
 
     VTR_ASSERT(cluster_ctx.clb_nlist.blocks().size() == intra_lb_routing.size());
 }
@@ -418,20 +503,20 @@ void remove_molecule_from_pb_stats_candidates(t_pack_molecule* molecule,
         return;
     }
 
-    //Otherwise, shift the molecules while removing the specified molecule
+    //Otherwise, shift the molecules (and their gains) while removing the specified molecule
     for (int j = molecule_index; j < pb->pb_stats->num_feasible_blocks - 1; j++) {
         pb->pb_stats->feasible_blocks[j] = pb->pb_stats->feasible_blocks[j + 1];
+        pb->pb_stats->feasible_block_gains[j] = pb->pb_stats->feasible_block_gains[j + 1];
     }
     pb->pb_stats->num_feasible_blocks--;
 }
 
 /* Add blk to list of feasible blocks sorted according to gain */
 void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
-                                         std::map<AtomBlockId, float>& gain,
+                                         std::unordered_map<AtomBlockId, float>& gain,
                                          t_pb* pb,
                                          int max_queue_size,
                                          AttractionInfo& attraction_groups) {
-    int i, j;
     int num_molecule_failures = 0;
 
     AttractGroupId cluster_att_grp = pb->pb_stats->attraction_grp_id;
@@ -454,41 +539,34 @@ void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
         }
     }
 
-    for (i = 0; i < pb->pb_stats->num_feasible_blocks; i++) {
-        if (pb->pb_stats->feasible_blocks[i] == molecule) {
-            return; // already in queue, do nothing
-        }
+    t_pack_molecule** feasible_blocks = pb->pb_stats->feasible_blocks;
+    float* feasible_block_gains = pb->pb_stats->feasible_block_gains;
+    int num_feasible_blocks = pb->pb_stats->num_feasible_blocks;
+
+    if (std::find(feasible_blocks, feasible_blocks + num_feasible_blocks, molecule) != feasible_blocks + num_feasible_blocks) {
+        return; // already in queue, do nothing
     }
 
-    if (pb->pb_stats->num_feasible_blocks >= max_queue_size - 1) {
-        /* maximum size for array, remove smallest gain element and sort */
-        if (get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures) > get_molecule_gain(pb->pb_stats->feasible_blocks[0], gain, cluster_att_grp, attraction_groups, num_molecule_failures)) {
-            /* single loop insertion sort */
-            for (j = 0; j < pb->pb_stats->num_feasible_blocks - 1; j++) {
-                if (get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures) <= get_molecule_gain(pb->pb_stats->feasible_blocks[j + 1], gain, cluster_att_grp, attraction_groups, num_molecule_failures)) {
-                    pb->pb_stats->feasible_blocks[j] = molecule;
-                    break;
-                } else {
-                    pb->pb_stats->feasible_blocks[j] = pb->pb_stats->feasible_blocks[j + 1];
-                }
-            }
-            if (j == pb->pb_stats->num_feasible_blocks - 1) {
-                pb->pb_stats->feasible_blocks[j] = molecule;
-            }
+    /* The gains do not change while the array is filled, so the gain of each feasible block is
+     * computed once, and the insertion point is found by binary search on the ascending gains */
+    float molecule_gain = get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures);
+
+    if (num_feasible_blocks >= max_queue_size - 1) {
+        /* maximum size for array, remove smallest gain element and insert before the blocks of equal or higher gain */
+        if (molecule_gain > feasible_block_gains[0]) {
+            int insert_index = std::lower_bound(feasible_block_gains + 1, feasible_block_gains + num_feasible_blocks, molecule_gain) - feasible_block_gains - 1;
+            std::move(feasible_blocks + 1, feasible_blocks + insert_index + 1, feasible_blocks);
+            std::move(feasible_block_gains + 1, feasible_block_gains + insert_index + 1, feasible_block_gains);
+            feasible_blocks[insert_index] = molecule;
+            feasible_block_gains[insert_index] = molecule_gain;
         }
     } else {
-        /* Expand array and single loop insertion sort */
-        for (j = pb->pb_stats->num_feasible_blocks - 1; j >= 0; j--) {
-            if (get_molecule_gain(pb->pb_stats->feasible_blocks[j], gain, cluster_att_grp, attraction_groups, num_molecule_failures) > get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures)) {
-                pb->pb_stats->feasible_blocks[j + 1] = pb->pb_stats->feasible_blocks[j];
-            } else {
-                pb->pb_stats->feasible_blocks[j + 1] = molecule;
-                break;
-            }
-        }
-        if (j < 0) {
-            pb->pb_stats->feasible_blocks[0] = molecule;
-        }
+        /* Expand array and insert after the blocks of equal or lower gain */
+        int insert_index = std::upper_bound(feasible_block_gains, feasible_block_gains + num_feasible_blocks, molecule_gain) - feasible_block_gains;
+        std::move_backward(feasible_blocks + insert_index, feasible_blocks + num_feasible_blocks, feasible_blocks + num_feasible_blocks + 1);
+        std::move_backward(feasible_block_gains + insert_index, feasible_block_gains + num_feasible_blocks, feasible_block_gains + num_feasible_blocks + 1);
+        feasible_blocks[insert_index] = molecule;
+        feasible_block_gains[insert_index] = molecule_gain;
         pb->pb_stats->num_feasible_blocks++;
     }
 }
@@ -815,9 +893,12 @@ void alloc_and_load_pb_stats(t_pb* pb, const int feasible_block_array_size) {
     pb->pb_stats->lookahead_output_pins_used = std::vector<std::vector<AtomNetId>>(pb->pb_graph_node->num_output_pin_class);
     pb->pb_stats->num_feasible_blocks = NOT_VALID;
     pb->pb_stats->feasible_blocks = new t_pack_molecule*[feasible_block_array_size];
+    pb->pb_stats->feasible_block_gains = new float[feasible_block_array_size];
 
-    for (int i = 0; i < feasible_block_array_size; i++)
+    for (int i = 0; i < feasible_block_array_size; i++) {
         pb->pb_stats->feasible_blocks[i] = nullptr;
+        pb->pb_stats->feasible_block_gains[i] = 0.;
+    }
 
     pb->pb_stats->tie_break_high_fanout_net = AtomNetId::INVALID();
 
@@ -941,6 +1022,7 @@ enum e_block_pack_status try_pack_molecule(t_cluster_placement_stats* cluster_pl
 
     auto& atom_ctx = g_vpr_ctx.atom();
     auto& floorplanning_ctx = g_vpr_ctx.mutable_floorplanning();
+    ScopedPackPhaseTimer phase_timer(g_vpr_ctx.mutable_cl_helper().pack_stats, PACK_PHASE_TRY_PACK_MOLECULE);
     parent = nullptr;
 
     block_pack_status = BLK_STATUS_UNDEFINED;
@@ -972,6 +1054,13 @@ enum e_block_pack_status try_pack_molecule(t_cluster_placement_stats* cluster_pl
         return BLK_FAILED_FEASIBLE;
     }
 
+    if (!molecule_fits_free_primitives(cluster_placement_stats_ptr, molecule)) {
+        VTR_LOGV(verbosity > 4, "\t\t\tFAILED Placement Feasibility Filter: Not enough free primitives\n");
+        //Record the failure of this molecule in the current pb stats
+        record_molecule_failure(molecule, pb);
+        return BLK_FAILED_FEASIBLE;
+    }
+
     bool cluster_pr_needs_update = false;
     bool cluster_pr_update_check = false;
 
@@ -1318,9 +1407,6 @@ enum e_block_pack_status atom_cluster_floorplanning_check(const AtomBlockId blk_
     PartitionId partid;
     partid = floorplanning_ctx.constraints.get_atom_partition(blk_id);
 
-    PartitionRegion atom_pr;
-    PartitionRegion cluster_pr;
-
     //if the atom does not belong to a partition, it can be put in the cluster
     //regardless of what the cluster's PartitionRegion is because it has no constraints
     if (partid == PartitionId::INVALID()) {
@@ -1331,24 +1417,23 @@ enum e_block_pack_status atom_cluster_floorplanning_check(const AtomBlockId blk_
         return BLK_PASSED;
     } else {
         //get pr of that partition
-        atom_pr = floorplanning_ctx.constraints.get_partition_pr(partid);
+        const PartitionRegion& atom_pr = floorplanning_ctx.constraints.get_partition_pr(partid);
 
         //intersect it with the pr of the current cluster
-        cluster_pr = floorplanning_ctx.cluster_constraints[clb_index];
+        const PartitionRegion& cur_cluster_pr = floorplanning_ctx.cluster_constraints[clb_index];
 
-        if (cluster_pr.empty() == true) {
+        if (cur_cluster_pr.empty() == true) {
             temp_cluster_pr = atom_pr;
             cluster_pr_needs_update = true;
             if (verbosity > 3) {
                 VTR_LOG("\t\t\t Intersect: Atom block %d has floorplanning constraints, passed cluster %d which has empty PR\n", blk_id, clb_index);
             }
             return BLK_PASSED;
-        } else {
-            //update cluster_pr with the intersection of the cluster's PartitionRegion
-            //and the atom's PartitionRegion
-            update_cluster_part_reg(cluster_pr, atom_pr);
         }
 
+        //the intersection of the cluster's PartitionRegion and the atom's PartitionRegion
+        PartitionRegion cluster_pr = intersection(cur_cluster_pr, atom_pr);
+
         if (cluster_pr.empty() == true) {
             if (verbosity > 3) {
                 VTR_LOG("\t\t\t Intersect: Atom block %d failed floorplanning check for cluster %d \n", blk_id, clb_index);
@@ -1357,7 +1442,7 @@ enum e_block_pack_status atom_cluster_floorplanning_check(const AtomBlockId blk_
             return BLK_FAILED_FLOORPLANNING;
         } else {
             //update the cluster's PartitionRegion with the intersecting PartitionRegion
-            temp_cluster_pr = cluster_pr;
+            temp_cluster_pr = std::move(cluster_pr);
             cluster_pr_needs_update = true;
             if (verbosity > 3) {
                 VTR_LOG("\t\t\t Intersect: Atom block %d passed cluster %d, cluster PR was updated with intersection result \n", blk_id, clb_index);
@@ -1415,6 +1500,15 @@ void revert_place_atom_block(const AtomBlockId blk_id, t_lb_router_data* router_
     atom_ctx.lookup.set_atom_pb(blk_id, nullptr);
 }
 
+/* Adds the pins visited by a gain update or candidate search of net_id to its total */
+static void record_net_gain_update_pins(const AtomNetId net_id, size_t num_pins) {
+    auto& helper_ctx = g_vpr_ctx.mutable_cl_helper();
+    if (size_t(net_id) >= helper_ctx.net_gain_update_pins.size()) {
+        helper_ctx.net_gain_update_pins.resize(g_vpr_ctx.atom().nlist.nets().size(), 0);
+    }
+    helper_ctx.net_gain_update_pins[net_id] += num_pins;
+}
+
 void update_connection_gain_values(const AtomNetId net_id, const AtomBlockId clustered_blk_id, t_pb* cur_pb, enum e_net_relation_to_clustered_block net_relation_to_clustered_block) {
     /*This function is called when the connectiongain values on the net net_id*
      *require updating.   */
@@ -1524,6 +1618,7 @@ void try_fill_cluster(const t_packer_opts& packer_opts,
                                           packer_opts.feasible_block_array_size,
                                           target_ext_pin_util,
                                           temp_cluster_pr);
+    g_vpr_ctx.mutable_cl_helper().pack_stats.record_pack_attempt(cluster_ctx.clb_nlist.block_type(clb_index), block_pack_status == BLK_PASSED);
 
     auto blk_id = next_molecule->atom_block_ids[next_molecule->root];
     VTR_ASSERT(blk_id);
@@ -1687,12 +1782,105 @@ void free_data_and_requeue_used_mols_if_illegal(const ClusterBlockId& clb_index,
 
     num_used_type_instances[cluster_ctx.clb_nlist.block_type(clb_index)]--;
     revalid_molecules(cluster_ctx.clb_nlist.block_pb(clb_index));
+
+    //The atoms of the cluster are candidates again
+    g_vpr_ctx.mutable_cl_helper().high_fanout_net_first_open_pin.clear();
     cluster_ctx.clb_nlist.remove_block(clb_index);
     cluster_ctx.clb_nlist.compress();
     num_clb--;
     seedindex = savedseedindex;
 }
 
+/* Starts the route at end of a filled cluster on another thread, and stores the cluster as if it were legal */
+void start_pending_cluster_route(std::deque<t_pending_cluster_route>& pending_routes,
+                                 const t_packer_opts& packer_opts,
+                                 const ClusterBlockId clb_index,
+                                 t_pack_molecule* seed_molecule,
+                                 const int savedseedindex,
+                                 t_lb_router_data* router_data,
+                                 const t_logical_block_type_ptr logic_block_type,
+                                 const t_pb_type* le_pb_type,
+                                 std::vector<int>& le_count,
+                                 vtr::vector<ClusterBlockId, std::vector<AtomNetId>>& clb_inter_blk_nets) {
+    t_pending_cluster_route pending_route;
+    pending_route.clb_index = clb_index;
+    pending_route.seed_molecule = seed_molecule;
+    pending_route.savedseedindex = savedseedindex;
+    pending_route.router_data = router_data;
+    pending_route.le_count = le_count;
+
+    //The route only reads its own router data and the atom netlist, which growing the next clusters does not modify
+    int verbosity = packer_opts.pack_verbosity;
+    pending_route.is_routed = std::async(std::launch::async, [router_data, verbosity]() {
+        t_mode_selection_status mode_status;
+        return try_intra_lb_route(router_data, verbosity, &mode_status);
+    });
+
+    //Neither needs the routing, so the cluster stats are released now as for a legal cluster
+    store_cluster_info_and_free(packer_opts, clb_index, logic_block_type, le_pb_type, le_count, clb_inter_blk_nets);
+
+    pending_routes.push_back(std::move(pending_route));
+}
+
+/* Waits for the route of the oldest pending cluster. Returns true, and saves its intra-cluster routing,
+ * if the cluster is legal. Otherwise returns false, leaving it pending for undo_pending_clusters() */
+bool finish_oldest_cluster_route(std::deque<t_pending_cluster_route>& pending_routes,
+                                 vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing,
+                                 const int verbosity) {
+    VTR_ASSERT(!pending_routes.empty());
+    t_pending_cluster_route& oldest = pending_routes.front();
+
+    if (!oldest.is_routed.get()) {
+        VTR_LOGV(verbosity > 0, "Failed route at end, repack cluster trying detailed routing at each stage.\n");
+        return false;
+    }
+    VTR_LOGV(verbosity > 2, "\tPassed route at end.\n");
+
+    //Clusters are finished in order, so their routing is saved at their index
+    VTR_ASSERT(size_t(oldest.clb_index) == intra_lb_routing.size());
+    intra_lb_routing.push_back(oldest.router_data->saved_lb_nets);
+    oldest.router_data->saved_lb_nets = nullptr;
+    free_router_data(oldest.router_data);
+
+    pending_routes.pop_front();
+    return true;
+}
+
+/* Undoes all the pending clusters, most recent first, after the oldest failed its route.
+ * Returns the seed molecule of the oldest, which is to be repacked with detailed routing at each stage */
+t_pack_molecule* undo_pending_clusters(std::deque<t_pending_cluster_route>& pending_routes,
+                                       std::map<t_logical_block_type_ptr, size_t>& num_used_type_instances,
+                                       int& num_clb,
+                                       int& seedindex,
+                                       std::vector<int>& le_count,
+                                       vtr::vector<ClusterBlockId, std::vector<AtomNetId>>& clb_inter_blk_nets) {
+    auto& floorplanning_ctx = g_vpr_ctx.mutable_floorplanning();
+
+    VTR_ASSERT(!pending_routes.empty());
+    t_pack_molecule* seed_molecule = nullptr;
+    while (!pending_routes.empty()) {
+        t_pending_cluster_route& newest = pending_routes.back();
+
+        //The router data must outlive the route
+        if (newest.is_routed.valid()) {
+            newest.is_routed.wait();
+        }
+
+        clb_inter_blk_nets[newest.clb_index].clear();
+        le_count = newest.le_count;
+        free_data_and_requeue_used_mols_if_illegal(newest.clb_index, newest.savedseedindex, num_used_type_instances, num_clb, seedindex);
+        free_router_data(newest.router_data);
+
+        seed_molecule = newest.seed_molecule;
+        pending_routes.pop_back();
+    }
+
+    //Drop the floorplan constraints of the undone clusters, so the repacked ones start unconstrained
+    floorplanning_ctx.cluster_constraints.resize(num_clb);
+
+    return seed_molecule;
+}
+
 /*****************************************/
 void update_timing_gain_values(const AtomNetId net_id,
                                t_pb* cur_pb,
@@ -1784,6 +1972,7 @@ void mark_and_update_partial_gain(const AtomNetId net_id,
                 cur_pb->pb_stats->tie_break_high_fanout_net = net_id;
             }
         }
+        g_vpr_ctx.mutable_cl_helper().num_high_fanout_gain_updates++;
         return;
     }
 
@@ -1805,6 +1994,11 @@ void mark_and_update_partial_gain(const AtomNetId net_id,
             //(i.e. the net loops back to the block only once)
             pins = atom_ctx.nlist.net_sinks(net_id);
 
+        //Each of the sharing, connection and timing updates below walks the pins of the net once
+        g_vpr_ctx.mutable_cl_helper().num_gain_updates++;
+        g_vpr_ctx.mutable_cl_helper().num_gain_update_pins += pins.size();
+        record_net_gain_update_pins(net_id, pins.size());
+
         if (cur_pb->pb_stats->num_pins_of_net_in_pb.count(net_id) == 0) {
             for (auto pin_id : pins) {
                 auto blk_id = atom_ctx.nlist.pin_block(pin_id);
@@ -2132,6 +2326,7 @@ void start_new_cluster(t_cluster_placement_stats* cluster_placement_stats,
                                             temp_cluster_pr);
 
             success = (pack_result == BLK_PASSED);
+            g_vpr_ctx.mutable_cl_helper().pack_stats.record_pack_attempt(type, success);
         }
 
         if (success) {
@@ -2229,12 +2424,12 @@ t_pack_molecule* get_highest_gain_molecule(t_pb* cur_pb,
 
         // 3. Find unpacked molecules based on weak connectedness (connected by high fanout nets) with current cluster
         if (cur_pb->pb_stats->num_feasible_blocks == 0 && cur_pb->pb_stats->tie_break_high_fanout_net) {
-            add_cluster_molecule_candidates_by_highfanout_connectivity(cur_pb, cluster_placement_stats_ptr, feasible_block_array_size, attraction_groups);
+            add_cluster_molecule_candidates_by_highfanout_connectivity(cur_pb, cluster_placement_stats_ptr, cluster_index, feasible_block_array_size, attraction_groups);
         }
     } else { //Reverse order
         // 3. Find unpacked molecules based on weak connectedness (connected by high fanout nets) with current cluster
         if (cur_pb->pb_stats->num_feasible_blocks == 0 && cur_pb->pb_stats->tie_break_high_fanout_net) {
-            add_cluster_molecule_candidates_by_highfanout_connectivity(cur_pb, cluster_placement_stats_ptr, feasible_block_array_size, attraction_groups);
+            add_cluster_molecule_candidates_by_highfanout_connectivity(cur_pb, cluster_placement_stats_ptr, cluster_index, feasible_block_array_size, attraction_groups);
         }
 
         // 2. Find unpacked molecules based on transitive connections (eg. 2 hops away) with current cluster
@@ -2294,6 +2489,7 @@ void add_cluster_molecule_candidates_by_connectivity_and_timing(t_pb* cur_pb,
 /* Add molecules based on weak connectedness (connected by high fanout nets) with current cluster */
 void add_cluster_molecule_candidates_by_highfanout_connectivity(t_pb* cur_pb,
                                                                 t_cluster_placement_stats* cluster_placement_stats_ptr,
+                                                                const ClusterBlockId cluster_index,
                                                                 const int feasible_block_array_size,
                                                                 AttractionInfo& attraction_groups) {
     /* Because the packer ignores high fanout nets when marking what blocks
@@ -2304,14 +2500,29 @@ void add_cluster_molecule_candidates_by_highfanout_connectivity(t_pb* cur_pb,
     AtomNetId net_id = cur_pb->pb_stats->tie_break_high_fanout_net;
 
     auto& atom_ctx = g_vpr_ctx.atom();
+    auto& helper_ctx = g_vpr_ctx.mutable_cl_helper();
+
+    /* The same high fanout nets (e.g. resets and clock enables) are explored for many clusters, and their
+     * first pins end up on atoms of closed clusters, which are never candidates. Resume from the first pin
+     * which may not be, rather than walking those pins again for each cluster */
+    size_t& first_open_pin = helper_ctx.high_fanout_net_first_open_pin[net_id];
+    auto net_pins = atom_ctx.nlist.net_pins(net_id);
 
     int count = 0;
-    for (auto pin_id : atom_ctx.nlist.net_pins(net_id)) {
+    size_t num_pins_visited = 0;
+    for (size_t ipin = first_open_pin; ipin < net_pins.size(); ipin++) {
         if (count >= AAPACK_MAX_HIGH_FANOUT_EXPLORE) {
             break;
         }
+        num_pins_visited++;
+
+        AtomBlockId blk_id = atom_ctx.nlist.pin_block(*(net_pins.begin() + ipin));
 
-        AtomBlockId blk_id = atom_ctx.nlist.pin_block(pin_id);
+        /* Atoms of the open cluster may still be removed from it, so only closed clusters advance the first open pin */
+        ClusterBlockId blk_clb = atom_ctx.lookup.atom_clb(blk_id);
+        if (ipin == first_open_pin && blk_clb != ClusterBlockId::INVALID() && blk_clb != cluster_index) {
+            first_open_pin++;
+        }
 
         if (atom_ctx.lookup.atom_clb(blk_id) == ClusterBlockId::INVALID()) {
             auto rng = atom_ctx.atom_molecules.equal_range(blk_id);
@@ -2328,6 +2539,9 @@ void add_cluster_molecule_candidates_by_highfanout_connectivity(t_pb* cur_pb,
             }
         }
     }
+    helper_ctx.num_high_fanout_candidate_pins += num_pins_visited;
+    record_net_gain_update_pins(net_id, num_pins_visited);
+
     cur_pb->pb_stats->tie_break_high_fanout_net = AtomNetId::INVALID(); /* Mark off that this high fanout net has been considered */
 }
 
@@ -2487,6 +2701,11 @@ bool check_free_primitives_for_molecule_atoms(t_pack_molecule* molecule, t_clust
     auto& atom_ctx = g_vpr_ctx.atom();
     bool success = true;
 
+    //Cheap signature check first, which rejects most molecules that do not fit
+    if (!molecule_fits_free_primitives(cluster_placement_stats_ptr, molecule)) {
+        return false;
+    }
+
     for (int i_atom = 0; i_atom < get_array_size_of_molecule(molecule); i_atom++) {
         if (molecule->atom_block_ids[i_atom]) {
             VTR_ASSERT(atom_ctx.lookup.atom_clb(molecule->atom_block_ids[i_atom]) == ClusterBlockId::INVALID());
@@ -2524,6 +2743,7 @@ t_pack_molecule* get_molecule_for_cluster(t_pb* cur_pb,
      */
 
     VTR_ASSERT(cur_pb->is_root());
+    ScopedPackPhaseTimer phase_timer(g_vpr_ctx.mutable_cl_helper().pack_stats, PACK_PHASE_CANDIDATE_SELECTION);
 
     /* If cannot pack into primitive, try packing into cluster */
 
@@ -2825,6 +3045,7 @@ std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_type,
 
 t_pack_molecule* get_highest_gain_seed_molecule(int* seedindex, const std::vector<AtomBlockId> seed_atoms) {
     auto& atom_ctx = g_vpr_ctx.atom();
+    ScopedPackPhaseTimer phase_timer(g_vpr_ctx.mutable_cl_helper().pack_stats, PACK_PHASE_SEED_SELECTION);
 
     while (*seedindex < static_cast<int>(seed_atoms.size())) {
         AtomBlockId blk_id = seed_atoms[(*seedindex)++];
@@ -2856,7 +3077,7 @@ t_pack_molecule* get_highest_gain_seed_molecule(int* seedindex, const std::vecto
  * + molecule_base_gain*some_factor
  * - introduced_input_nets_of_unrelated_blocks_pulled_in_by_molecule*some_other_factor
  */
-float get_molecule_gain(t_pack_molecule* molecule, std::map<AtomBlockId, float>& blk_gain, AttractGroupId cluster_attraction_group_id, AttractionInfo& attraction_groups, int num_molecule_failures) {
+float get_molecule_gain(t_pack_molecule* molecule, std::unordered_map<AtomBlockId, float>& blk_gain, AttractGroupId cluster_attraction_group_id, AttractionInfo& attraction_groups, int num_molecule_failures) {
     float gain;
     int i;
     int num_introduced_inputs_of_indirectly_related_block;
@@ -2869,8 +3090,9 @@ float get_molecule_gain(t_pack_molecule* molecule, std::map<AtomBlockId, float>&
     for (i = 0; i < get_array_size_of_molecule(molecule); i++) {
         auto blk_id = molecule->atom_block_ids[i];
         if (blk_id) {
-            if (blk_gain.count(blk_id) > 0) {
-                gain += blk_gain[blk_id];
+            auto blk_gain_iter = blk_gain.find(blk_id);
+            if (blk_gain_iter != blk_gain.end()) {
+                gain += blk_gain_iter->second;
             } else {
                 /* This block has no connection with current cluster, penalize molecule for having this block
                  */
@@ -3659,6 +3881,46 @@ void print_le_count(std::vector<int>& le_count, const t_pb_type* le_pb_type) {
     VTR_LOG("  LEs used for registers only         : %d\n\n", le_count[2]);
 }
 
+void reset_gain_update_stats() {
+    auto& helper_ctx = g_vpr_ctx.mutable_cl_helper();
+    helper_ctx.high_fanout_net_first_open_pin.clear();
+    helper_ctx.num_gain_updates = 0;
+    helper_ctx.num_gain_update_pins = 0;
+    helper_ctx.num_high_fanout_gain_updates = 0;
+    helper_ctx.num_high_fanout_candidate_pins = 0;
+    helper_ctx.net_gain_update_pins.clear();
+}
+
+/* Reports the work done updating gains, and at higher verbosity the nets which cost the most */
+void print_gain_update_stats(int verbosity) {
+    constexpr size_t NUM_NETS_REPORTED = 10;
+
+    const auto& helper_ctx = g_vpr_ctx.cl_helper();
+    const auto& atom_ctx = g_vpr_ctx.atom();
+
+    VTR_LOG("Gain updates: %zu (%zu pins visited), %zu skipped on high fanout nets, %zu pins visited for high fanout candidates\n",
+            helper_ctx.num_gain_updates, helper_ctx.num_gain_update_pins,
+            helper_ctx.num_high_fanout_gain_updates, helper_ctx.num_high_fanout_candidate_pins);
+
+    if (verbosity > 2) {
+        std::vector<AtomNetId> nets;
+        for (AtomNetId net_id : helper_ctx.net_gain_update_pins.keys()) {
+            if (helper_ctx.net_gain_update_pins[net_id] > 0) {
+                nets.push_back(net_id);
+            }
+        }
+        size_t num_reported = std::min(nets.size(), NUM_NETS_REPORTED);
+        std::partial_sort(nets.begin(), nets.begin() + num_reported, nets.end(), [&](AtomNetId lhs, AtomNetId rhs) {
+            return helper_ctx.net_gain_update_pins[lhs] > helper_ctx.net_gain_update_pins[rhs];
+        });
+        for (size_t inet = 0; inet < num_reported; inet++) {
+            VTR_LOG("  Net '%s' (%zu sinks): %zu pins visited\n",
+                    atom_ctx.nlist.net_name(nets[inet]).c_str(), atom_ctx.nlist.net_sinks(nets[inet]).size(),
+                    helper_ctx.net_gain_update_pins[nets[inet]]);
+        }
+    }
+}
+
 /**
  * Given a pointer to a pb in a cluster, this routine returns
  * a pointer to the top-level pb of the given pb.
@@ -1,6 +1,9 @@
 #ifndef CLUSTER_UTIL_H
 #define CLUSTER_UTIL_H
 
+#include <deque>
+#include <future>
+
 #include "globals.h"
 #include "atom_netlist.h"
 #include "pack_types.h"
@@ -76,9 +79,17 @@ struct t_cluster_progress_stats {
     int num_molecules_processed = 0;
     int mols_since_last_print = 0;
     int blocks_since_last_analysis = 0;
+    int clusters_since_last_analysis = 0;
     int num_unrelated_clustering_attempts = 0;
 };
 
+///@brief Statistics of the incremental timing updates run while clustering (see --pack_timing_update_interval)
+struct t_packing_timing_update_stats {
+    size_t num_updates = 0;
+    size_t num_invalidated_edges = 0; ///<Number of timing graph edges whose delay changed, over all updates
+    double time = 0.;                 ///<Seconds spent in the updates
+};
+
 /* Useful data structures for creating or modifying clusters */
 struct t_clustering_data {
     vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*> intra_lb_routing;
@@ -104,6 +115,22 @@ struct t_clustering_data {
     std::unordered_map<AtomNetId, int> net_output_feeds_driving_block_input;
 };
 
+/**
+ * @brief A cluster whose route at end (E_DETAILED_ROUTE_AT_END_ONLY) runs on another thread,
+ *        while the next clusters are grown as if it were legal (see --pack_parallel_routes).
+ *
+ * If the route fails, this cluster and all the clusters grown after it are undone, and it
+ * is repacked with detailed routing at each stage, as by the serial packer.
+ */
+struct t_pending_cluster_route {
+    ClusterBlockId clb_index;
+    t_pack_molecule* seed_molecule;
+    int savedseedindex;             ///<The seed index when the cluster was started
+    t_lb_router_data* router_data;  ///<Owned until the route is finished or the cluster undone
+    std::vector<int> le_count;      ///<The LE counts before the cluster was stored
+    std::future<bool> is_routed;    ///<The result of the route, until it is retrieved
+};
+
 /***********************************/
 /*   Clustering helper functions   */
 /***********************************/
@@ -118,6 +145,17 @@ void calc_init_packing_timing(const t_packer_opts& packer_opts,
                               std::shared_ptr<SetupTimingInfo>& timing_info,
                               vtr::vector<AtomBlockId, float>& atom_criticality);
 
+/**
+ * @brief Incrementally updates the packing timing analysis with the clusters formed since the last update
+ *
+ * The connections between atoms newly packed in the same cluster get the intra-cluster delay, and those whose
+ * atoms were unpacked get the inter-cluster delay back. Only the timing graph edges of these connections are
+ * invalidated, so the (incremental) analyzer does not re-analyze the whole netlist.
+ */
+void update_packing_timing(PreClusterDelayCalculator& clustering_delay_calc,
+                           SetupTimingInfo& timing_info,
+                           t_packing_timing_update_stats& update_stats);
+
 //free the clustering data structures
 void free_clustering_data(const t_packer_opts& packer_opts,
                           t_clustering_data& clustering_data);
@@ -139,7 +177,7 @@ bool check_cluster_legality(const int& verbosity,
 bool is_atom_blk_in_pb(const AtomBlockId blk_id, const t_pb* pb);
 
 void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
-                                         std::map<AtomBlockId, float>& gain,
+                                         std::unordered_map<AtomBlockId, float>& gain,
                                          t_pb* pb,
                                          int max_queue_size,
                                          AttractionInfo& attraction_groups);
@@ -264,6 +302,28 @@ void free_data_and_requeue_used_mols_if_illegal(const ClusterBlockId& clb_index,
                                                 int& num_clb,
                                                 int& seedindex);
 
+void start_pending_cluster_route(std::deque<t_pending_cluster_route>& pending_routes,
+                                 const t_packer_opts& packer_opts,
+                                 const ClusterBlockId clb_index,
+                                 t_pack_molecule* seed_molecule,
+                                 const int savedseedindex,
+                                 t_lb_router_data* router_data,
+                                 const t_logical_block_type_ptr logic_block_type,
+                                 const t_pb_type* le_pb_type,
+                                 std::vector<int>& le_count,
+                                 vtr::vector<ClusterBlockId, std::vector<AtomNetId>>& clb_inter_blk_nets);
+
+bool finish_oldest_cluster_route(std::deque<t_pending_cluster_route>& pending_routes,
+                                 vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing,
+                                 const int verbosity);
+
+t_pack_molecule* undo_pending_clusters(std::deque<t_pending_cluster_route>& pending_routes,
+                                       std::map<t_logical_block_type_ptr, size_t>& num_used_type_instances,
+                                       int& num_clb,
+                                       int& seedindex,
+                                       std::vector<int>& le_count,
+                                       vtr::vector<ClusterBlockId, std::vector<AtomNetId>>& clb_inter_blk_nets);
+
 enum e_block_pack_status try_place_atom_block_rec(const t_pb_graph_node* pb_graph_node,
                                                   const AtomBlockId blk_id,
                                                   t_pb* cb,
@@ -360,6 +420,7 @@ void add_cluster_molecule_candidates_by_connectivity_and_timing(t_pb* cur_pb,
 
 void add_cluster_molecule_candidates_by_highfanout_connectivity(t_pb* cur_pb,
                                                                 t_cluster_placement_stats* cluster_placement_stats_ptr,
+                                                                const ClusterBlockId cluster_index,
                                                                 const int feasible_block_array_size,
                                                                 AttractionInfo& attraction_groups);
 
@@ -409,7 +470,7 @@ std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_type,
 
 t_pack_molecule* get_highest_gain_seed_molecule(int* seedindex, const std::vector<AtomBlockId> seed_atoms);
 
-float get_molecule_gain(t_pack_molecule* molecule, std::map<AtomBlockId, float>& blk_gain, AttractGroupId cluster_attraction_group_id, AttractionInfo& attraction_groups, int num_molecule_failures);
+float get_molecule_gain(t_pack_molecule* molecule, std::unordered_map<AtomBlockId, float>& blk_gain, AttractGroupId cluster_attraction_group_id, AttractionInfo& attraction_groups, int num_molecule_failures);
 
 int compare_molecule_gain(const void* a, const void* b);
 int net_sinks_reachable_in_cluster(const t_pb_graph_pin* driver_pb_gpin, const int depth, const AtomNetId net_id);
@@ -445,6 +506,10 @@ bool pb_used_for_blif_model(const t_pb* pb, std::string blif_model_name);
 
 void print_le_count(std::vector<int>& le_count, const t_pb_type* le_pb_type);
 
+void reset_gain_update_stats();
+
+void print_gain_update_stats(int verbosity);
+
 t_pb* get_top_level_pb(t_pb* pb);
 
 bool cleanup_pb(t_pb* pb);
@@ -33,6 +33,10 @@
 #include "pack_types.h"
 #include "lb_type_rr_graph.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 /*****************************************************************************************
  * Internal functions declarations
  ******************************************************************************************/
@@ -56,8 +60,14 @@ std::vector<t_lb_type_rr_node>* alloc_and_load_all_lb_type_rr_graph() {
 
     lb_type_rr_graphs = new std::vector<t_lb_type_rr_node>[device_ctx.logical_block_types.size()];
 
-    for (const auto& type : device_ctx.logical_block_types) {
-        int itype = type.index;
+    /* Each type only reads its own pb graph and writes its own lb_type_rr_graph, so the types are built in parallel */
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), device_ctx.logical_block_types.size(), [&](size_t itype) {
+#else
+    for (size_t itype = 0; itype < device_ctx.logical_block_types.size(); ++itype) {
+#endif
+        const auto& type = device_ctx.logical_block_types[itype];
+        VTR_ASSERT(type.index == (int)itype);
         if (&type != device_ctx.EMPTY_LOGICAL_BLOCK_TYPE) {
             alloc_and_load_lb_type_rr_graph_for_type(&type, lb_type_rr_graphs[itype]);
 
@@ -65,7 +75,11 @@ std::vector<t_lb_type_rr_node>* alloc_and_load_all_lb_type_rr_graph() {
             /* I should be using shrinktofit() but as of 2013, C++ 11 is yet not well supported so I can't call this function in gcc */
             std::vector<t_lb_type_rr_node>(lb_type_rr_graphs[itype]).swap(lb_type_rr_graphs[itype]);
         }
+#ifdef VPR_USE_TBB
+    });
+#else
     }
+#endif
     return lb_type_rr_graphs;
 }
 
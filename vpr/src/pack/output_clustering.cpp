@@ -6,6 +6,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <sstream>
 #include <vector>
 
 #include "vtr_assert.h"
@@ -27,6 +29,7 @@
 #include "read_xml_arch_file.h"
 #include "vpr_utils.h"
 #include "pack.h"
+#include "async_file_writer.h"
 
 #define LINELENGTH 1024
 #define TAB_LENGTH 4
@@ -562,7 +565,7 @@ static void clustering_xml_block(pugi::xml_node parent_node, t_logical_block_typ
 /* This routine dumps out the output netlist in a format suitable for  *
  * input to vpr. This routine also dumps out the internal structure of *
  * the cluster, in essentially a graph based format.                   */
-void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing, bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname, bool skip_clustering) {
+std::string output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing, bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname, bool skip_clustering) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& atom_ctx = g_vpr_ctx.atom();
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
@@ -637,7 +640,17 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
         }
     }
 
-    out_xml.save_file(out_fname);
+    std::ostringstream out_os;
+    out_xml.save(out_os);
+    std::string contents = out_os.str();
+
+    //The contents are loaded from memory rather than read back, so the file can be written in
+    //the background (except for ".gz" names, which the background writer would compress)
+    if (vtr::check_file_name_extension(out_fname, ".gz")) {
+        std::ofstream(out_fname, std::ios::binary) << contents;
+    } else {
+        async_file_writer().write(out_fname, contents);
+    }
 
     print_stats();
 
@@ -646,6 +659,8 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
             cluster_ctx.clb_nlist.block_pb(blk_id)->pb_route.clear();
         }
     }
+
+    return contents;
 }
 
 /********************************************************************
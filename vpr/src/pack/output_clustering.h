@@ -1,11 +1,17 @@
 #ifndef OUTPUT_CLUSTERING_H
 #define OUTPUT_CLUSTERING_H
+#include <string>
 #include <vector>
 #include <unordered_set>
 #include "vpr_types.h"
 #include "pack_types.h"
 
-void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing, bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname, bool skip_clustering);
+/**
+ * @brief Writes the packed netlist file out_fname (in the background), returning its contents
+ *
+ * The returned contents can be loaded without reading the file back (see read_netlist()).
+ */
+std::string output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing, bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname, bool skip_clustering);
 
 void write_packing_results_to_xml(const bool& global_clocks, const std::string& architecture_id, const char* out_fname);
 
@@ -0,0 +1,163 @@
+#include "pack_stats.h"
+
+#include <fstream>
+
+#include "vtr_util.h"
+
+#include "vpr_error.h"
+#include "globals.h"
+#include "vpr_utils.h"
+
+static const char* PACK_PHASE_NAMES[NUM_PACK_PHASES] = {
+    "seed_selection",
+    "candidate_selection",
+    "try_pack_molecule",
+    "intra_lb_route",
+    "timing_analysis"};
+
+void PackStats::init(const std::string& filename, float interval) {
+    filename_ = filename;
+    interval_ = interval;
+    start_ = std::chrono::steady_clock::now();
+
+    phase_times_.fill(0.);
+    phase_runs_.fill(0);
+
+    size_t num_types = g_vpr_ctx.device().logical_block_types.size();
+    num_pack_attempts_.assign(num_types, 0);
+    num_pack_failures_.assign(num_types, 0);
+
+    snapshots_.clear();
+}
+
+void PackStats::add_phase_time(e_pack_phase phase, double seconds) {
+    std::lock_guard<std::mutex> lock(phase_mutex_);
+    phase_times_[phase] += seconds;
+    phase_runs_[phase]++;
+}
+
+void PackStats::record_pack_attempt(t_logical_block_type_ptr type, bool success) {
+    if (!enabled()) {
+        return;
+    }
+
+    num_pack_attempts_[type->index]++;
+    if (!success) {
+        num_pack_failures_[type->index]++;
+    }
+}
+
+void PackStats::snapshot(int num_clusters, int num_molecules_processed, int num_molecules, bool is_last) {
+    if (!enabled()) {
+        return;
+    }
+
+    double time = elapsed_sec();
+    if (!is_last) {
+        double last_time = snapshots_.empty() ? 0. : snapshots_.back().time;
+        if (interval_ <= 0. || time - last_time < interval_) {
+            return;
+        }
+    }
+
+    t_snapshot snapshot;
+    snapshot.time = time;
+    snapshot.num_clusters = num_clusters;
+    snapshot.num_molecules_processed = num_molecules_processed;
+    snapshot.num_molecules = num_molecules;
+    {
+        std::lock_guard<std::mutex> lock(phase_mutex_);
+        snapshot.phase_times = phase_times_;
+        snapshot.phase_runs = phase_runs_;
+    }
+    snapshot.num_pack_attempts = num_pack_attempts_;
+    snapshot.num_pack_failures = num_pack_failures_;
+    snapshots_.push_back(std::move(snapshot));
+
+    //Rewrite the whole file, so it is complete even if packing does not finish
+    if (vtr::check_file_name_extension(filename_.c_str(), ".csv")) {
+        write_csv();
+    } else {
+        write_json();
+    }
+}
+
+double PackStats::elapsed_sec() const {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+    return elapsed.count();
+}
+
+void PackStats::write_json() const {
+    std::ofstream os(filename_);
+    if (!os) {
+        VPR_FATAL_ERROR(VPR_ERROR_PACK, "Failed to open packer statistics file '%s' for writing\n", filename_.c_str());
+    }
+
+    const auto& block_types = g_vpr_ctx.device().logical_block_types;
+
+    os << "{\n";
+    os << "  \"snapshots\": [";
+    for (size_t isnapshot = 0; isnapshot < snapshots_.size(); isnapshot++) {
+        const t_snapshot& snapshot = snapshots_[isnapshot];
+        os << (isnapshot > 0 ? ",\n" : "\n");
+        os << "    {\n";
+        os << "      \"time\": " << snapshot.time << ",\n";
+        os << "      \"clusters\": " << snapshot.num_clusters << ",\n";
+        os << "      \"molecules_processed\": " << snapshot.num_molecules_processed << ",\n";
+        os << "      \"molecules\": " << snapshot.num_molecules << ",\n";
+        os << "      \"phases\": {";
+        for (int iphase = 0; iphase < NUM_PACK_PHASES; iphase++) {
+            os << (iphase > 0 ? ",\n" : "\n");
+            os << "        \"" << PACK_PHASE_NAMES[iphase] << "\": {\"time\": " << snapshot.phase_times[iphase]
+               << ", \"runs\": " << snapshot.phase_runs[iphase] << "}";
+        }
+        os << "\n      },\n";
+        os << "      \"block_types\": {";
+        bool first_type = true;
+        for (const auto& type : block_types) {
+            if (is_empty_type(&type)) continue;
+
+            os << (first_type ? "\n" : ",\n");
+            first_type = false;
+            os << "        \"" << type.name << "\": {\"pack_attempts\": " << snapshot.num_pack_attempts[type.index]
+               << ", \"pack_failures\": " << snapshot.num_pack_failures[type.index] << "}";
+        }
+        os << "\n      }\n";
+        os << "    }";
+    }
+    os << "\n  ]\n";
+    os << "}\n";
+}
+
+void PackStats::write_csv() const {
+    std::ofstream os(filename_);
+    if (!os) {
+        VPR_FATAL_ERROR(VPR_ERROR_PACK, "Failed to open packer statistics file '%s' for writing\n", filename_.c_str());
+    }
+
+    const auto& block_types = g_vpr_ctx.device().logical_block_types;
+
+    os << "time,clusters,molecules_processed,molecules";
+    for (int iphase = 0; iphase < NUM_PACK_PHASES; iphase++) {
+        os << "," << PACK_PHASE_NAMES[iphase] << "_time," << PACK_PHASE_NAMES[iphase] << "_runs";
+    }
+    for (const auto& type : block_types) {
+        if (is_empty_type(&type)) continue;
+
+        os << "," << type.name << "_pack_attempts," << type.name << "_pack_failures";
+    }
+    os << "\n";
+
+    for (const t_snapshot& snapshot : snapshots_) {
+        os << snapshot.time << "," << snapshot.num_clusters << "," << snapshot.num_molecules_processed << "," << snapshot.num_molecules;
+        for (int iphase = 0; iphase < NUM_PACK_PHASES; iphase++) {
+            os << "," << snapshot.phase_times[iphase] << "," << snapshot.phase_runs[iphase];
+        }
+        for (const auto& type : block_types) {
+            if (is_empty_type(&type)) continue;
+
+            os << "," << snapshot.num_pack_attempts[type.index] << "," << snapshot.num_pack_failures[type.index];
+        }
+        os << "\n";
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Statistics of the clusterer (see --pack_stats_file).
+ *
+ * The time spent in each phase of do_clustering and the molecule placement attempts and failures of each
+ * logical block type are accumulated while clustering, and snapshots of them are written to a JSON or CSV
+ * file at a configurable interval, to find where the packer spends its time without a profiler.
+ */
+#ifndef PACK_STATS_H
+#define PACK_STATS_H
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "physical_types.h"
+
+///@brief The timed phases of clustering (they may nest, e.g. the intra-cluster routes run by try_pack_molecule())
+enum e_pack_phase {
+    PACK_PHASE_SEED_SELECTION = 0,   ///<Picking the seed molecule of each cluster
+    PACK_PHASE_CANDIDATE_SELECTION,  ///<Gathering and ranking the candidate molecules of the open cluster
+    PACK_PHASE_TRY_PACK_MOLECULE,    ///<Placing molecules in the open cluster (try_pack_molecule())
+    PACK_PHASE_INTRA_LB_ROUTE,       ///<Routing clusters, including the routes run on other threads (see --pack_parallel_routes)
+    PACK_PHASE_TIMING_ANALYSIS,      ///<Analysing the timing of the netlist (calc_init_packing_timing())
+    NUM_PACK_PHASES
+};
+
+///@brief Accumulates the statistics of the clusterer, and writes snapshots of them
+class PackStats {
+  public:
+    /**
+     * @brief Starts collecting statistics, which are written to filename (.json or .csv)
+     *
+     * Snapshots are taken at least interval seconds apart while clustering (see snapshot()).
+     * An empty filename disables the statistics.
+     */
+    void init(const std::string& filename, float interval);
+
+    ///@brief Whether statistics are collected
+    bool enabled() const { return !filename_.empty(); }
+
+    ///@brief Adds the time spent in one run of phase. Thread safe
+    void add_phase_time(e_pack_phase phase, double seconds);
+
+    ///@brief Records an attempt to place a molecule in a cluster of the given type
+    void record_pack_attempt(t_logical_block_type_ptr type, bool success);
+
+    /**
+     * @brief Takes a snapshot of the statistics and rewrites the statistics file, if the interval has elapsed since the last one
+     *
+     * The last snapshot (is_last) is always taken.
+     */
+    void snapshot(int num_clusters, int num_molecules_processed, int num_molecules, bool is_last);
+
+  private:
+    struct t_snapshot {
+        double time;
+        int num_clusters;
+        int num_molecules_processed;
+        int num_molecules;
+        std::array<double, NUM_PACK_PHASES> phase_times;
+        std::array<size_t, NUM_PACK_PHASES> phase_runs;
+        std::vector<size_t> num_pack_attempts;
+        std::vector<size_t> num_pack_failures;
+    };
+
+    double elapsed_sec() const;
+    void write_json() const;
+    void write_csv() const;
+
+    std::string filename_;
+    float interval_ = 0.;
+    std::chrono::steady_clock::time_point start_;
+
+    std::mutex phase_mutex_; //Protects the phase times, which are added to by the cluster routing threads
+    std::array<double, NUM_PACK_PHASES> phase_times_;
+    std::array<size_t, NUM_PACK_PHASES> phase_runs_;
+
+    std::vector<size_t> num_pack_attempts_; //Indexed by logical block type index
+    std::vector<size_t> num_pack_failures_;
+
+    std::vector<t_snapshot> snapshots_;
+};
+
+///@brief Adds the time spent in the scope to a phase of the clusterer statistics (nothing if they are disabled)
+class ScopedPackPhaseTimer {
+  public:
+    ScopedPackPhaseTimer(PackStats& stats, e_pack_phase phase)
+        : stats_(stats)
+        , phase_(phase) {
+        if (stats_.enabled()) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedPackPhaseTimer() {
+        if (stats_.enabled()) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+            stats_.add_phase_time(phase_, elapsed.count());
+        }
+    }
+
+  private:
+    PackStats& stats_;
+    e_pack_phase phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#endif
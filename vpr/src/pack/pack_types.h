@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "arch_types.h"
+#include "vtr_arena.h"
 #include "atom_netlist_fwd.h"
 #include "attraction_groups.h"
 
@@ -35,14 +36,15 @@ const std::vector<const char*> lb_rr_type_str{
 /* Stores statistical information for a physical cluster_ctx.blocks such as costs and usages */
 struct t_pb_stats {
     /* Packing statistics */
-    std::map<AtomBlockId, float> gain; /* Attraction (inverse of cost) function */
+    /* The gains are only looked up by block (never iterated over), so are kept in hash maps */
+    std::unordered_map<AtomBlockId, float> gain; /* Attraction (inverse of cost) function */
 
-    std::map<AtomBlockId, float> timinggain;     /* The timing criticality score of this atom cluster_ctx.blocks.
+    std::unordered_map<AtomBlockId, float> timinggain;     /* The timing criticality score of this atom cluster_ctx.blocks.
                                                   * Determined by the most critical atom net
                                                   * between this atom cluster_ctx.blocks and any atom cluster_ctx.blocks in
                                                   * the current pb */
-    std::map<AtomBlockId, float> connectiongain; /* Weighted sum of connections to attraction function */
-    std::map<AtomBlockId, float> sharinggain;    /* How many nets on an atom cluster_ctx.blocks are already in the pb under consideration */
+    std::unordered_map<AtomBlockId, float> connectiongain; /* Weighted sum of connections to attraction function */
+    std::unordered_map<AtomBlockId, float> sharinggain;    /* How many nets on an atom cluster_ctx.blocks are already in the pb under consideration */
 
     /* This is the gain used for hill-climbing. It stores*
      * the reduction in the number of pins that adding this atom cluster_ctx.blocks to the the*
@@ -50,13 +52,13 @@ struct t_pb_stats {
      * addition of an atom cluster_ctx.blocks to a pb may reduce the number of inputs     *
      * required if it shares inputs with all other BLEs and it's output is  *
      * used by all other child pbs in this parent pb.                               */
-    std::map<AtomBlockId, float> hillgain;
+    std::unordered_map<AtomBlockId, float> hillgain;
 
     /*
      * stores the number of times atoms have failed to be packed into the cluster
      * key: root block id of the molecule, value: number of times the molecule has failed to be packed into the cluster
      */
-    std::map<AtomBlockId, int> atom_failures;
+    std::unordered_map<AtomBlockId, int> atom_failures;
 
     int pulled_from_atom_groups;
     int num_att_group_atoms_used;
@@ -76,7 +78,7 @@ struct t_pb_stats {
 
     /* How many pins of each atom net are contained in the *
      * currently open pb?                                  */
-    std::map<AtomNetId, int> num_pins_of_net_in_pb;
+    std::unordered_map<AtomNetId, int> num_pins_of_net_in_pb;
 
     /* Record of pins of class used */
     std::vector<std::unordered_map<size_t, AtomNetId>> input_pins_used;  /* [0..pb_graph_node->num_pin_classes-1] nets using this input pin class */
@@ -94,7 +96,8 @@ struct t_pb_stats {
      * Sorted in ascending gain order so that the last cluster_ctx.blocks is the most desirable (this makes it easy to pop blocks off the list
      */
     t_pack_molecule** feasible_blocks;
-    int num_feasible_blocks; /* [0..num_marked_models-1] */
+    float* feasible_block_gains; /* [0..max_array_size-1] Gain of each feasible block when it was added (the gains are fixed until the array is rebuilt) */
+    int num_feasible_blocks;     /* [0..num_marked_models-1] */
 };
 
 /**************************************************************************
@@ -170,6 +173,10 @@ struct t_lb_rr_node_stats {
 struct t_lb_trace {
     int current_node;                   /* current t_lb_type_rr_node used by net */
     std::vector<t_lb_trace> next_nodes; /* index of previous edge that drives current node */
+
+    /* Route tree heads are allocated from vtr::Arena, since the cluster router creates and frees them for each net it routes */
+    static void* operator new(size_t size) { return vtr::Arena::allocate(size); }
+    static void operator delete(void* ptr, size_t size) { vtr::Arena::deallocate(ptr, size); }
 };
 
 /* Represents a net used inside a logic cluster_ctx.blocks and the physical nodes used by the net */
@@ -256,6 +263,11 @@ struct t_lb_router_data {
     t_explored_node_tb* explored_node_tb; /* [0..lb_type_graph->size()-1] Stores mode exploration and lb_traceback info for nodes */
     int explore_id_index;                 /* used in conjunction with node_traceback to determine whether or not a location has been explored.  By using a unique identifier every route, I don't have to clear the previous route exploration */
 
+    /* Nodes whose lb_rr_node_stats or explored_node_tb entries may differ from their defaults, so that resetting
+     * them (before each route, and when the data is reused for another cluster) only visits the nodes touched */
+    std::vector<int> touched_nodes;
+    std::vector<char> is_node_touched; /* [0..lb_type_graph->size()-1] */
+
     /* Current type */
     t_logical_block_type_ptr lb_type;
 
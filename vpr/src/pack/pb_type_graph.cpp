@@ -15,6 +15,8 @@
 #include <cstring>
 #include <cinttypes>
 #include <queue>
+#include <mutex>
+#include <vector>
 
 #include "vtr_util.h"
 #include "vtr_assert.h"
@@ -35,9 +37,24 @@
 #include "power.h"
 #include "read_xml_arch_file.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 /* variable global to this section that indexes each pb graph pin within a cluster */
 static vtr::t_linked_vptr* edges_head;
 static vtr::t_linked_vptr* num_edges_head;
+/* the pb graphs (and the subtrees below their roots) are built in parallel, so the edge lists are locked */
+static std::mutex edges_mutex;
+
+/* a child pb_graph_node of a parent, the pin_count_in_cluster of its first pin and the number of pins in its subtree */
+struct t_pb_graph_child {
+    int mode;
+    int child;
+    int index;
+    int first_pin_count_in_cluster;
+    int num_pins;
+};
 
 /* TODO: Software engineering decision needed: Move this file to libarch?
  *
@@ -51,6 +68,12 @@ static void alloc_and_load_pb_graph(t_pb_graph_node* pb_graph_node,
                                     bool load_power_structures,
                                     int& pin_count_in_cluster);
 
+static void alloc_and_load_pb_graph_head(t_logical_block_type& type, bool load_power_structures, bool is_flat);
+
+static int count_pb_graph_pins(const t_pb_type* pb_type);
+
+static void record_pb_graph_edges(t_pb_graph_edge* edges, int num_edges);
+
 static void alloc_and_load_pb_graph_pin_sinks(t_pb_graph_node* pb_graph_node);
 
 /* Assign a unique id to each IPIN/OPIN pin at logical block level (i.e. fill pin_logical_num_to_pb_pin_mapping in logical_block)*/
@@ -142,42 +165,107 @@ void alloc_and_load_all_pb_graphs(bool load_power_structures, bool is_flat) {
     edges_head = nullptr;
     num_edges_head = nullptr;
     auto& device_ctx = g_vpr_ctx.mutable_device();
-
-    for (auto& type : device_ctx.logical_block_types) {
+    auto& logical_block_types = device_ctx.logical_block_types;
+
+    /* The pb graphs of the types are independent, so they are built in parallel */
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), logical_block_types.size(), [&](size_t itype) {
+#else
+    for (size_t itype = 0; itype < logical_block_types.size(); ++itype) {
+#endif
+        // buffer the messages of the type, so they are logged in type order
+        vtr::ScopedLogBuffer log_buffer(itype);
+
+        t_logical_block_type& type = logical_block_types[itype];
         if (type.pb_type) {
-            type.pb_graph_head = new t_pb_graph_node();
-            int pin_count_in_cluster = 0;
-            alloc_and_load_pb_graph(type.pb_graph_head,
-                                    nullptr,
-                                    type.pb_type,
-                                    0,
-                                    load_power_structures,
-                                    pin_count_in_cluster);
-            type.pb_graph_head->total_pb_pins = pin_count_in_cluster;
-            load_pin_classes_in_pb_graph_head(type.pb_graph_head);
-            if (is_flat) {
-                alloc_and_load_pb_graph_pin_sinks(type.pb_graph_head);
-                set_pins_logical_num(&type);
-                add_primitive_logical_classes(&type);
-            }
+            alloc_and_load_pb_graph_head(type, load_power_structures, is_flat);
         } else {
             type.pb_graph_head = nullptr;
             VTR_ASSERT(&type == device_ctx.EMPTY_LOGICAL_BLOCK_TYPE);
         }
+#ifdef VPR_USE_TBB
+    });
+#else
     }
+#endif
+    vtr::flush_log_buffers();
 
     errors = check_pb_graph();
     if (errors > 0) {
         VTR_LOG_ERROR("in pb graph");
         exit(1);
     }
-    for (auto& type : device_ctx.logical_block_types) {
-        if (type.pb_type) {
-            load_pb_graph_pin_to_pin_annotations(type.pb_graph_head);
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), logical_block_types.size(), [&](size_t itype) {
+#else
+    for (size_t itype = 0; itype < logical_block_types.size(); ++itype) {
+#endif
+        if (logical_block_types[itype].pb_type) {
+            load_pb_graph_pin_to_pin_annotations(logical_block_types[itype].pb_graph_head);
         }
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+}
+
+/**
+ * Allocate and load the pb graph of a (non-empty) logical block type
+ */
+static void alloc_and_load_pb_graph_head(t_logical_block_type& type, bool load_power_structures, bool is_flat) {
+    type.pb_graph_head = new t_pb_graph_node();
+    int pin_count_in_cluster = 0;
+    alloc_and_load_pb_graph(type.pb_graph_head,
+                            nullptr,
+                            type.pb_type,
+                            0,
+                            load_power_structures,
+                            pin_count_in_cluster);
+    type.pb_graph_head->total_pb_pins = pin_count_in_cluster;
+    load_pin_classes_in_pb_graph_head(type.pb_graph_head);
+    if (is_flat) {
+        alloc_and_load_pb_graph_pin_sinks(type.pb_graph_head);
+        set_pins_logical_num(&type);
+        add_primitive_logical_classes(&type);
     }
 }
 
+/**
+ * Returns the number of pins in the pb graph of a pb_type, i.e. its own pins and the pins
+ * of all the pb_types (in all modes) below it
+ */
+static int count_pb_graph_pins(const t_pb_type* pb_type) {
+    int num_pins = 0;
+    for (int iport = 0; iport < pb_type->num_ports; iport++) {
+        num_pins += pb_type->ports[iport].num_pins;
+    }
+    for (int imode = 0; imode < pb_type->num_modes; imode++) {
+        const t_mode& mode = pb_type->modes[imode];
+        for (int ichild = 0; ichild < mode.num_pb_type_children; ichild++) {
+            num_pins += mode.pb_type_children[ichild].num_pb * count_pb_graph_pins(&mode.pb_type_children[ichild]);
+        }
+    }
+    return num_pins;
+}
+
+/**
+ * Records an array of edges, so free_pb_graph_edges() frees them
+ */
+static void record_pb_graph_edges(t_pb_graph_edge* edges, int num_edges) {
+    std::lock_guard<std::mutex> lock(edges_mutex);
+
+    vtr::t_linked_vptr* cur = new vtr::t_linked_vptr;
+    cur->next = edges_head;
+    edges_head = cur;
+    cur->data_vptr = (void*)edges;
+    cur = new vtr::t_linked_vptr;
+    cur->next = num_edges_head;
+    num_edges_head = cur;
+    cur->data_vptr = (void*)((intptr_t)num_edges);
+}
+
 /**
  * Print out the pb_type graph
  */
@@ -341,7 +429,10 @@ static void alloc_and_load_pb_graph(t_pb_graph_node* pb_graph_node,
         pb_graph_node->pb_node_power->transistor_cnt_pb_children = 0.;
     }
 
-    /* Allocate and load child nodes for each mode and create interconnect in each mode */
+    /* Allocate and load child nodes for each mode and create interconnect in each mode.
+     * The pins of each child subtree are counted up front, so the subtrees below the root can
+     * be built in parallel while keeping the (sequential) pin_count_in_cluster numbering. */
+    std::vector<t_pb_graph_child> children;
 
     pb_graph_node->child_pb_graph_nodes = (t_pb_graph_node***)vtr::calloc(pb_type->num_modes, sizeof(t_pb_graph_node**));
     for (i = 0; i < pb_type->num_modes; i++) {
@@ -349,17 +440,40 @@ static void alloc_and_load_pb_graph(t_pb_graph_node* pb_graph_node,
                                                                                 sizeof(t_pb_graph_node*));
         for (j = 0; j < pb_type->modes[i].num_pb_type_children; j++) {
             pb_graph_node->child_pb_graph_nodes[i][j] = (t_pb_graph_node*)vtr::calloc(pb_type->modes[i].pb_type_children[j].num_pb, sizeof(t_pb_graph_node));
+            int child_num_pins = count_pb_graph_pins(&pb_type->modes[i].pb_type_children[j]);
             for (k = 0; k < pb_type->modes[i].pb_type_children[j].num_pb; k++) {
-                alloc_and_load_pb_graph(&pb_graph_node->child_pb_graph_nodes[i][j][k],
-                                        pb_graph_node,
-                                        &pb_type->modes[i].pb_type_children[j],
-                                        k,
-                                        load_power_structures,
-                                        pin_count_in_cluster);
+                children.push_back({i, j, k, pin_count_in_cluster, child_num_pins});
+                pin_count_in_cluster += child_num_pins;
             }
         }
     }
 
+    auto load_child = [&](size_t ichild) {
+        const t_pb_graph_child& child = children[ichild];
+        int child_pin_count_in_cluster = child.first_pin_count_in_cluster;
+        alloc_and_load_pb_graph(&pb_graph_node->child_pb_graph_nodes[child.mode][child.child][child.index],
+                                pb_graph_node,
+                                &pb_type->modes[child.mode].pb_type_children[child.child],
+                                child.index,
+                                load_power_structures,
+                                child_pin_count_in_cluster);
+        VTR_ASSERT(child_pin_count_in_cluster == child.first_pin_count_in_cluster + child.num_pins);
+    };
+
+#ifdef VPR_USE_TBB
+    /* Only the subtrees of the root are built in parallel, which splits large types over all
+     * their modes and child instances. With power estimation, the instances of a pb_type
+     * initialize its (shared) interconnect power data, so they are built serially instead. */
+    if (pb_graph_node->is_root() && !load_power_structures) {
+        tbb::parallel_for(size_t(0), children.size(), load_child);
+    } else
+#endif
+    {
+        for (size_t ichild = 0; ichild < children.size(); ichild++) {
+            load_child(ichild);
+        }
+    }
+
     pb_graph_node->interconnect_pins = new t_interconnect_pins*[pb_type->num_modes];
 
     for (i = 0; i < pb_type->num_modes; i++) {
@@ -998,7 +1112,6 @@ static void alloc_and_load_complete_interc_edges(t_interconnect* interconnect,
     int in_count, out_count;
     t_pb_graph_edge* edges;
     int i_edge;
-    vtr::t_linked_vptr* cur;
 
     VTR_ASSERT(interconnect->infer_annotations == false);
 
@@ -1015,14 +1128,7 @@ static void alloc_and_load_complete_interc_edges(t_interconnect* interconnect,
     edges = new t_pb_graph_edge[in_count * out_count];
     for (int i = 0; i < (in_count * out_count); i++)
         edges[i] = t_pb_graph_edge();
-    cur = new vtr::t_linked_vptr;
-    cur->next = edges_head;
-    edges_head = cur;
-    cur->data_vptr = (void*)edges;
-    cur = new vtr::t_linked_vptr;
-    cur->next = num_edges_head;
-    num_edges_head = cur;
-    cur->data_vptr = (void*)((intptr_t)in_count * out_count);
+    record_pb_graph_edges(edges, in_count * out_count);
 
     for (i_inset = 0; i_inset < num_input_sets; i_inset++) {
         for (i_inpin = 0; i_inpin < num_input_ptrs[i_inset]; i_inpin++) {
@@ -1097,14 +1203,7 @@ static void alloc_and_load_direct_interc_edges(t_interconnect* interconnect,
     t_pb_graph_edge* edges = new t_pb_graph_edge[pins_per_set * num_output_sets];
     for (int i = 0; i < (pins_per_set * num_output_sets); i++)
         edges[i] = t_pb_graph_edge();
-    vtr::t_linked_vptr* cur = new vtr::t_linked_vptr;
-    cur->next = edges_head;
-    edges_head = cur;
-    cur->data_vptr = (void*)edges;
-    cur = new vtr::t_linked_vptr;
-    cur->next = num_edges_head;
-    num_edges_head = cur;
-    cur->data_vptr = (void*)((intptr_t)num_input_ptrs[0]);
+    record_pb_graph_edges(edges, num_input_ptrs[0]);
 
     /* Reallocate memory for pins and load connections between pins and record these updates in the edges */
     for (int ipin = 0; ipin < pins_per_set; ++ipin) {
@@ -1168,7 +1267,6 @@ static void alloc_and_load_mux_interc_edges(t_interconnect* interconnect,
                                             const int* num_output_ptrs) {
     int i_inset, i_inpin, i_outpin;
     t_pb_graph_edge* edges;
-    vtr::t_linked_vptr* cur;
 
     VTR_ASSERT(interconnect->infer_annotations == false);
 
@@ -1181,14 +1279,7 @@ static void alloc_and_load_mux_interc_edges(t_interconnect* interconnect,
     edges = new t_pb_graph_edge[num_input_sets];
     for (int i = 0; i < (num_input_sets); i++)
         edges[i] = t_pb_graph_edge();
-    cur = new vtr::t_linked_vptr;
-    cur->next = edges_head;
-    edges_head = cur;
-    cur->data_vptr = (void*)edges;
-    cur = new vtr::t_linked_vptr;
-    cur->next = num_edges_head;
-    num_edges_head = cur;
-    cur->data_vptr = (void*)((intptr_t)num_input_sets);
+    record_pb_graph_edges(edges, num_input_sets);
 
     for (i_inset = 0; i_inset < num_input_sets; i_inset++) {
         for (i_inpin = 0; i_inpin < num_input_ptrs[i_inset]; i_inpin++) {
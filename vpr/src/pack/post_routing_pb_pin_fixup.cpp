@@ -2,6 +2,10 @@
  * This file includes functions to fix up the pb pin mapping results 
  * after routing optimization
  *******************************************************************/
+#include <algorithm>
+#include <map>
+#include <vector>
+
 /* Headers from vtrutil library */
 #include "vtr_time.h"
 #include "vtr_assert.h"
@@ -18,6 +22,24 @@
 /* Include global variables of VPR */
 #include "globals.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+/********************************************************************
+ * The post-routing fix-up results of a clustered block
+ * Clustered blocks are fixed up independently of each other, and
+ * their results are merged into the clustering context afterwards:
+ * - post_routing_pin_nets: post_routing_clb_pin_nets of the block
+ * - pre_routing_pin_mapping: pre_routing_net_pin_mapping of the block
+ *******************************************************************/
+struct t_cluster_pin_fixup {
+    std::map<int, ClusterNetId> post_routing_pin_nets;
+    std::map<int, int> pre_routing_pin_mapping;
+    size_t num_mismatches = 0;
+    size_t num_fixup = 0;
+};
+
 /********************************************************************
  * Give a given pin index, find the side where this pin is located 
  * on the physical tile
@@ -50,10 +72,11 @@ static std::vector<e_side> find_physical_tile_pin_side(t_physical_tile_type_ptr
 static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_list,
                                                          const AtomContext& atom_ctx,
                                                          const DeviceContext& device_ctx,
-                                                         ClusteringContext& clustering_ctx,
+                                                         const ClusteringContext& clustering_ctx,
                                                          const vtr::vector<RRNodeId, ParentNetId>& rr_node_nets,
                                                          const t_pl_loc& grid_coord,
                                                          const ClusterBlockId& blk_id,
+                                                         std::map<int, ClusterNetId>& post_routing_pin_nets,
                                                          size_t& num_mismatches,
                                                          const bool& verbose,
                                                          bool is_flat) {
@@ -227,8 +250,8 @@ static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_li
             continue;
         }
 
-        /* Update the clustering context with net modification */
-        clustering_ctx.post_routing_clb_pin_nets[blk_id][pb_graph_pin->pin_count_in_cluster] = cluster_equivalent_net_id;
+        /* Record the net modification */
+        post_routing_pin_nets[pb_graph_pin->pin_count_in_cluster] = cluster_equivalent_net_id;
 
         std::string routing_net_name("unmapped");
         if (clustering_ctx.clb_nlist.valid_net_id(cluster_equivalent_net_id)) {
@@ -265,6 +288,7 @@ static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_li
  *******************************************************************/
 static int find_target_pb_route_from_equivalent_pins(const AtomContext& atom_ctx,
                                                      const ClusteringContext& clustering_ctx,
+                                                     const std::map<int, ClusterNetId>& post_routing_pin_nets,
                                                      const ClusterBlockId& blk_id,
                                                      t_pb* pb,
                                                      const t_pb_graph_pin* source_pb_graph_pin,
@@ -301,10 +325,10 @@ static int find_target_pb_route_from_equivalent_pins(const AtomContext& atom_ctx
             continue;
         }
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pin);
+        auto remapped_result = post_routing_pin_nets.find(pin);
 
         /* Skip this pin if it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (remapped_result == post_routing_pin_nets.end()) {
             continue;
         }
 
@@ -471,6 +495,8 @@ static AtomPinId find_mapped_atom_pin(const AtomContext& atom_ctx,
 /********************************************************************
  * Cache the mapping from atom pin to pb_graph pin for remapped nets
  * in current routing traces
+ * The cache is indexed by the pb_route id (pin_count_in_cluster);
+ * pins without a cached mapping have an invalid atom pin
  *
  * Note: 
  *   - The pb_route_id is the routing trace id for top-level pins ONLY!
@@ -488,13 +514,14 @@ static AtomPinId find_mapped_atom_pin(const AtomContext& atom_ctx,
  *     
  *     Anything violates the assumption will be NOT be cached!!!
  *******************************************************************/
-static std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> cache_atom_pin_to_pb_pin_mapping(const AtomContext& atom_ctx,
-                                                                                                   const IntraLbPbPinLookup& intra_lb_pb_pin_lookup,
-                                                                                                   const ClusteringContext& clustering_ctx,
-                                                                                                   const ClusterBlockId& blk_id,
-                                                                                                   t_pb* pb,
-                                                                                                   t_logical_block_type_ptr logical_block) {
-    std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> atom_pin_to_pb_pin_mapping;
+static std::vector<std::pair<AtomPinId, const t_pb_graph_pin*>> cache_atom_pin_to_pb_pin_mapping(const AtomContext& atom_ctx,
+                                                                                                  const IntraLbPbPinLookup& intra_lb_pb_pin_lookup,
+                                                                                                  const std::map<int, ClusterNetId>& post_routing_pin_nets,
+                                                                                                  const ClusterBlockId& blk_id,
+                                                                                                  t_pb* pb,
+                                                                                                  t_logical_block_type_ptr logical_block) {
+    std::vector<std::pair<AtomPinId, const t_pb_graph_pin*>> atom_pin_to_pb_pin_mapping(pb->pb_graph_node->total_pb_pins,
+                                                                                        std::make_pair(AtomPinId::INVALID(), nullptr));
     for (int pb_type_pin = 0; pb_type_pin < logical_block->pb_type->num_pins; ++pb_type_pin) {
         /* Skip non-equivalent ports, no need to do fix-up */
         const t_pb_graph_pin* pb_graph_pin = get_pb_graph_node_pin_from_block_pin(blk_id, pb_type_pin);
@@ -510,10 +537,10 @@ static std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> cache_atom_pin
         VTR_ASSERT(pb_graph_pin->parent_node == pb->pb_graph_node);
         VTR_ASSERT(pb_graph_pin->parent_node->is_root());
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pb_graph_pin->pin_count_in_cluster);
+        auto remapped_result = post_routing_pin_nets.find(pb_graph_pin->pin_count_in_cluster);
 
         /* Skip this pin: it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (remapped_result == post_routing_pin_nets.end()) {
             continue;
         }
 
@@ -594,9 +621,11 @@ static void rec_remove_downstream_pb_routes(t_pb_routes& curr_pb_routes,
  *    which should be handled in another function!!!
  *******************************************************************/
 static void update_cluster_regular_routing_traces_with_post_routing_results(AtomContext& atom_ctx,
-                                                                            const std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>>& previous_atom_pin_to_pb_pin_mapping,
-                                                                            ClusteringContext& clustering_ctx,
+                                                                            const std::vector<std::pair<AtomPinId, const t_pb_graph_pin*>>& previous_atom_pin_to_pb_pin_mapping,
+                                                                            const ClusteringContext& clustering_ctx,
                                                                             const ClusterBlockId& blk_id,
+                                                                            const std::map<int, ClusterNetId>& post_routing_pin_nets,
+                                                                            std::map<int, int>& pre_routing_pin_mapping,
                                                                             t_pb* pb,
                                                                             t_logical_block_type_ptr logical_block,
                                                                             t_pb_routes& new_pb_routes,
@@ -625,15 +654,15 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
         VTR_ASSERT(pb_graph_pin->parent_node == pb->pb_graph_node);
         VTR_ASSERT(pb_graph_pin->parent_node->is_root());
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pb_graph_pin->pin_count_in_cluster);
+        auto remapped_result = post_routing_pin_nets.find(pb_graph_pin->pin_count_in_cluster);
 
         /* Skip this pin: it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (remapped_result == post_routing_pin_nets.end()) {
             continue;
         }
 
         /* Update only when there is a remapping! */
-        VTR_ASSERT_SAFE(remapped_result != clustering_ctx.post_routing_clb_pin_nets[blk_id].end());
+        VTR_ASSERT_SAFE(remapped_result != post_routing_pin_nets.end());
 
         /* Cache the remapped net id */
         AtomNetId remapped_net = atom_ctx.lookup.atom_net(remapped_result->second);
@@ -671,6 +700,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
          */
         int pb_route_id = find_target_pb_route_from_equivalent_pins(atom_ctx,
                                                                     clustering_ctx,
+                                                                    post_routing_pin_nets,
                                                                     blk_id,
                                                                     pb,
                                                                     pb_graph_pin,
@@ -678,7 +708,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                                                                     verbose);
 
         /* Record the previous pin mapping for finding the correct pin index during timing analysis */
-        clustering_ctx.pre_routing_net_pin_mapping[blk_id][pb_graph_pin->pin_count_in_cluster] = pb_route_id;
+        pre_routing_pin_mapping[pb_graph_pin->pin_count_in_cluster] = pb_route_id;
 
         /* Remove the old pb_route and insert the new one */
         new_pb_routes.insert(std::make_pair(pb_graph_pin->pin_count_in_cluster, t_pb_route()));
@@ -719,12 +749,12 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
          *     Anything violates the assumption will be errored out!
          */
         new_pb_route.sink_pb_pin_ids.clear();
-        std::map<int, bool> sink_pb_pin_accessibility;
+        std::vector<int> accessible_sink_pb_pins;
         t_pb_graph_pin* sink_pb_pin_to_add = nullptr;
 
         for (int iedge = 0; iedge < pb_graph_pin->num_output_edges; ++iedge) {
             for (int ipin = 0; ipin < pb_graph_pin->output_edges[iedge]->num_output_pins; ++ipin) {
-                sink_pb_pin_accessibility[pb_graph_pin->output_edges[iedge]->output_pins[ipin]->pin_count_in_cluster] = true;
+                accessible_sink_pb_pins.push_back(pb_graph_pin->output_edges[iedge]->output_pins[ipin]->pin_count_in_cluster);
             }
         }
 
@@ -733,7 +763,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
         }
 
         for (const int& sink_pb_route : pb->pb_route.at(pb_route_id).sink_pb_pin_ids) {
-            if (0 < sink_pb_pin_accessibility.count(sink_pb_route)) {
+            if (accessible_sink_pb_pins.end() != std::find(accessible_sink_pb_pins.begin(), accessible_sink_pb_pins.end(), sink_pb_route)) {
                 new_pb_route.sink_pb_pin_ids.push_back(sink_pb_route);
             }
         }
@@ -799,7 +829,8 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                  * Fix the atom net lookup 
                  */
                 VTR_ASSERT(1 == pb->pb_route.at(pb_route_id).sink_pb_pin_ids.size());
-                const AtomPinId& orig_mapped_atom_pin = previous_atom_pin_to_pb_pin_mapping.at(pb_route_id).first;
+                const AtomPinId& orig_mapped_atom_pin = previous_atom_pin_to_pb_pin_mapping[pb_route_id].first;
+                VTR_ASSERT(orig_mapped_atom_pin);
 
                 /* Print verbose outputs */
                 VTR_LOGV(verbose,
@@ -845,7 +876,8 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                          */
                         const t_pb_graph_pin* orig_mapped_top_level_pb_pin = find_mapped_equivalent_pb_pin_by_net(pb, pb_graph_pin, remapped_net);
                         VTR_ASSERT(orig_mapped_top_level_pb_pin);
-                        const AtomPinId& orig_mapped_atom_pin = previous_atom_pin_to_pb_pin_mapping.at(orig_mapped_top_level_pb_pin->pin_count_in_cluster).first;
+                        const AtomPinId& orig_mapped_atom_pin = previous_atom_pin_to_pb_pin_mapping[orig_mapped_top_level_pb_pin->pin_count_in_cluster].first;
+                        VTR_ASSERT(orig_mapped_atom_pin);
 
                         /* Print verbose outputs */
                         VTR_LOGV(verbose,
@@ -887,8 +919,10 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
  *    which should be handled in another function!!!
  *******************************************************************/
 static void update_cluster_global_routing_traces_with_post_routing_results(const AtomContext& atom_ctx,
-                                                                           ClusteringContext& clustering_ctx,
+                                                                           const ClusteringContext& clustering_ctx,
                                                                            const ClusterBlockId& blk_id,
+                                                                           std::map<int, ClusterNetId>& post_routing_pin_nets,
+                                                                           std::map<int, int>& pre_routing_pin_mapping,
                                                                            t_pb* pb,
                                                                            t_logical_block_type_ptr logical_block,
                                                                            t_pb_routes& new_pb_routes,
@@ -925,15 +959,15 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
 
         AtomNetId global_atom_net_id = atom_ctx.lookup.atom_net(global_net_id);
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pb_graph_pin->pin_count_in_cluster);
+        auto remapped_result = post_routing_pin_nets.find(pb_graph_pin->pin_count_in_cluster);
 
         /* Skip this pin: it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (remapped_result == post_routing_pin_nets.end()) {
             continue;
         }
 
         /* Update only when there is a remapping! */
-        VTR_ASSERT_SAFE(remapped_result != clustering_ctx.post_routing_clb_pin_nets[blk_id].end());
+        VTR_ASSERT_SAFE(remapped_result != post_routing_pin_nets.end());
 
         VTR_LOGV(verbose,
                  "Remapping clustered block '%s' global net '%s' to unused pin as %s\r",
@@ -963,8 +997,8 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
         }
 
         /* Update the remapping nets for this global net */
-        clustering_ctx.post_routing_clb_pin_nets[blk_id][unused_pb_graph_pin->pin_count_in_cluster] = global_net_id;
-        clustering_ctx.pre_routing_net_pin_mapping[blk_id][unused_pb_graph_pin->pin_count_in_cluster] = pb_route_id;
+        post_routing_pin_nets[unused_pb_graph_pin->pin_count_in_cluster] = global_net_id;
+        pre_routing_pin_mapping[unused_pb_graph_pin->pin_count_in_cluster] = pb_route_id;
 
         VTR_LOGV(verbose,
                  "Remap clustered block '%s' global net '%s' to pin '%s'\n",
@@ -988,12 +1022,12 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
  *******************************************************************/
 static void update_cluster_routing_traces_with_post_routing_results(AtomContext& atom_ctx,
                                                                     const IntraLbPbPinLookup& intra_lb_pb_pin_lookup,
-                                                                    ClusteringContext& clustering_ctx,
+                                                                    const ClusteringContext& clustering_ctx,
                                                                     const ClusterBlockId& blk_id,
-                                                                    size_t& num_fixup,
+                                                                    t_cluster_pin_fixup& fixup,
                                                                     const bool& verbose) {
     /* Skip block where no remapping is applied */
-    if (clustering_ctx.post_routing_clb_pin_nets.find(blk_id) == clustering_ctx.post_routing_clb_pin_nets.end()) {
+    if (fixup.post_routing_pin_nets.empty()) {
         return;
     }
 
@@ -1004,25 +1038,29 @@ static void update_cluster_routing_traces_with_post_routing_results(AtomContext&
     t_pb_routes new_pb_routes = pb->pb_route;
 
     /* Cache the current mapping between atom pin to pb_graph pin in this block */
-    std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> previous_atom_pin_to_pb_pin_mapping = cache_atom_pin_to_pb_pin_mapping(const_cast<const AtomContext&>(atom_ctx), intra_lb_pb_pin_lookup, const_cast<const ClusteringContext&>(clustering_ctx), blk_id, pb, logical_block);
+    std::vector<std::pair<AtomPinId, const t_pb_graph_pin*>> previous_atom_pin_to_pb_pin_mapping = cache_atom_pin_to_pb_pin_mapping(const_cast<const AtomContext&>(atom_ctx), intra_lb_pb_pin_lookup, fixup.post_routing_pin_nets, blk_id, pb, logical_block);
 
     update_cluster_regular_routing_traces_with_post_routing_results(atom_ctx,
                                                                     previous_atom_pin_to_pb_pin_mapping,
                                                                     clustering_ctx,
                                                                     blk_id,
+                                                                    fixup.post_routing_pin_nets,
+                                                                    fixup.pre_routing_pin_mapping,
                                                                     pb,
                                                                     logical_block,
                                                                     new_pb_routes,
-                                                                    num_fixup,
+                                                                    fixup.num_fixup,
                                                                     verbose);
 
     update_cluster_global_routing_traces_with_post_routing_results(const_cast<const AtomContext&>(atom_ctx),
                                                                    clustering_ctx,
                                                                    blk_id,
+                                                                   fixup.post_routing_pin_nets,
+                                                                   fixup.pre_routing_pin_mapping,
                                                                    pb,
                                                                    logical_block,
                                                                    new_pb_routes,
-                                                                   num_fixup,
+                                                                   fixup.num_fixup,
                                                                    verbose);
 
     /* Replace old pb_routes with the new one */
@@ -1042,6 +1080,9 @@ static void update_cluster_routing_traces_with_post_routing_results(AtomContext&
  *
  * Note:
  *   - This function SHOULD be run ONLY when routing is finished!!!
+ *   - Clustered blocks are fixed up in parallel (when VPR is built
+ *     with TBB): each block only rewrites its own pb routes and the
+ *     atom pins mapped inside it
  *******************************************************************/
 void sync_netlists_to_routing(const Netlist<>& net_list,
                               const DeviceContext& device_ctx,
@@ -1067,10 +1108,8 @@ void sync_netlists_to_routing(const Netlist<>& net_list,
 
     IntraLbPbPinLookup intra_lb_pb_pin_lookup(device_ctx.logical_block_types);
 
-    /* Count the number of mismatches and fix-up */
-    size_t num_mismatches = 0;
-    size_t num_fixup = 0;
-
+    /* Collect the clustered blocks to fix up, in the order they are first seen */
+    std::vector<ClusterBlockId> clb_blk_ids;
     std::unordered_set<ClusterBlockId> seen_block_ids;
     seen_block_ids.reserve(clustering_ctx.clb_nlist.blocks().size());
     /* Update the core logic (center blocks of the FPGA) */
@@ -1085,24 +1124,61 @@ void sync_netlists_to_routing(const Netlist<>& net_list,
         VTR_ASSERT(clb_blk_id != ClusterBlockId::INVALID());
 
         if (seen_block_ids.insert(clb_blk_id).second) {
-            update_cluster_pin_with_post_routing_results(net_list,
-                                                         atom_ctx,
-                                                         device_ctx,
-                                                         clustering_ctx,
-                                                         rr_node_nets,
-                                                         placement_ctx.block_locs[clb_blk_id].loc,
-                                                         clb_blk_id,
-                                                         num_mismatches,
-                                                         verbose,
-                                                         is_flat);
-
-            update_cluster_routing_traces_with_post_routing_results(atom_ctx,
-                                                                    intra_lb_pb_pin_lookup,
-                                                                    clustering_ctx,
-                                                                    clb_blk_id,
-                                                                    num_fixup,
-                                                                    verbose);
+            clb_blk_ids.push_back(clb_blk_id);
+        }
+    }
+
+    /* We know the entrance to grid info and mapping results, do the fix-up for each block */
+    std::vector<t_cluster_pin_fixup> cluster_fixups(clb_blk_ids.size());
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), clb_blk_ids.size(), [&](size_t iblk) {
+#else
+    for (size_t iblk = 0; iblk < clb_blk_ids.size(); ++iblk) {
+#endif
+        // buffer the messages of the block, so they are logged in block order
+        vtr::ScopedLogBuffer log_buffer(iblk);
+
+        const ClusterBlockId& clb_blk_id = clb_blk_ids[iblk];
+        t_cluster_pin_fixup& fixup = cluster_fixups[iblk];
+
+        update_cluster_pin_with_post_routing_results(net_list,
+                                                     atom_ctx,
+                                                     device_ctx,
+                                                     clustering_ctx,
+                                                     rr_node_nets,
+                                                     placement_ctx.block_locs[clb_blk_id].loc,
+                                                     clb_blk_id,
+                                                     fixup.post_routing_pin_nets,
+                                                     fixup.num_mismatches,
+                                                     verbose,
+                                                     is_flat);
+
+        update_cluster_routing_traces_with_post_routing_results(atom_ctx,
+                                                                intra_lb_pb_pin_lookup,
+                                                                clustering_ctx,
+                                                                clb_blk_id,
+                                                                fixup,
+                                                                verbose);
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+    vtr::flush_log_buffers();
+
+    /* Merge the fix-ups into the clustering context, and count the number of mismatches and fix-up */
+    size_t num_mismatches = 0;
+    size_t num_fixup = 0;
+    for (size_t iblk = 0; iblk < clb_blk_ids.size(); ++iblk) {
+        t_cluster_pin_fixup& fixup = cluster_fixups[iblk];
+        if (!fixup.post_routing_pin_nets.empty()) {
+            clustering_ctx.post_routing_clb_pin_nets.emplace(clb_blk_ids[iblk], std::move(fixup.post_routing_pin_nets));
+        }
+        if (!fixup.pre_routing_pin_mapping.empty()) {
+            clustering_ctx.pre_routing_net_pin_mapping.emplace(clb_blk_ids[iblk], std::move(fixup.pre_routing_pin_mapping));
         }
+        num_mismatches += fixup.num_mismatches;
+        num_fixup += fixup.num_fixup;
     }
 
     /* Print a short summary */
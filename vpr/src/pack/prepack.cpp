@@ -14,6 +14,7 @@
 #include <cstring>
 #include <map>
 #include <queue>
+#include <unordered_set>
 #include <utility>
 
 #include "vtr_util.h"
@@ -31,6 +32,23 @@
 #include "echo_files.h"
 #include "attraction_groups.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+/**
+ * @brief The atoms matched by a pack pattern from an atom (see try_match_molecule()).
+ *
+ * The match only depends on the netlist and on whether the atoms of checked_blocks already belong to a molecule,
+ * so it can be computed ahead of time, and remains correct as long as none of checked_blocks is added to a molecule.
+ */
+struct t_molecule_match {
+    bool is_matched = false;
+    AtomBlockId root_blk_id;                  ///<The atom the pattern root was matched to
+    std::vector<AtomBlockId> atom_block_ids;  ///<The atom matched to each pattern block (invalid if none)
+    std::vector<AtomBlockId> checked_blocks;  ///<The atoms looked up in atom_molecules while matching
+};
+
 /*****************************************/
 /*Local Function Declaration			 */
 /*****************************************/
@@ -63,12 +81,17 @@ static int compare_pack_pattern(const t_pack_patterns* pattern_a, const t_pack_p
 
 static void free_pack_pattern_block(t_pack_pattern_block* pattern_block, t_pack_pattern_block** pattern_block_list);
 
-static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patterns,
-                                            const int pack_pattern_index,
-                                            AtomBlockId blk_id);
+static void try_match_molecule(const t_pack_patterns* pack_pattern,
+                               AtomBlockId blk_id,
+                               t_molecule_match& match);
 
-static bool try_expand_molecule(t_pack_molecule* molecule,
-                                const AtomBlockId blk_id);
+static t_pack_molecule* create_matched_molecule(t_pack_patterns* pack_pattern,
+                                                const t_molecule_match& match);
+
+static bool try_expand_molecule(const t_pack_patterns* pack_pattern,
+                                std::vector<AtomBlockId>& atom_block_ids,
+                                const AtomBlockId blk_id,
+                                std::vector<AtomBlockId>& checked_blocks);
 
 static void print_pack_molecules(const char* fname,
                                  const t_pack_patterns* list_of_pack_patterns,
@@ -79,7 +102,7 @@ static t_pb_graph_node* get_expected_lowest_cost_primitive_for_atom_block(const
 
 static t_pb_graph_node* get_expected_lowest_cost_primitive_for_atom_block_in_pb_graph_node(const AtomBlockId blk_id, t_pb_graph_node* curr_pb_graph_node, float* cost);
 
-static AtomBlockId find_new_root_atom_for_chain(const AtomBlockId blk_id, const t_pack_patterns* list_of_pack_pattern);
+static AtomBlockId find_new_root_atom_for_chain(const AtomBlockId blk_id, const t_pack_patterns* list_of_pack_pattern, std::vector<AtomBlockId>& checked_blocks);
 
 static std::vector<t_pb_graph_pin*> find_end_of_path(t_pb_graph_pin* input_pin, int pattern_index);
 
@@ -814,11 +837,43 @@ t_pack_molecule* alloc_and_load_pack_molecules(t_pack_patterns* list_of_pack_pat
         is_used[best_pattern] = true;
 
         auto blocks = atom_ctx.nlist.blocks();
+
+        /* Match the pattern from every atom in parallel, against the molecules of the previous patterns.
+         * The molecules are then created in atom order: a match which checked an atom added to a molecule
+         * of this pattern since is redone, so the molecules are the same as matching each atom in turn */
+        std::vector<t_molecule_match> matches(blocks.size());
+        auto match_block = [&](size_t iblk) {
+            try_match_molecule(&list_of_pack_patterns[best_pattern], *(blocks.begin() + iblk), matches[iblk]);
+        };
+#ifdef VPR_USE_TBB
+        tbb::parallel_for(size_t(0), blocks.size(), match_block);
+#else
+        for (size_t iblk = 0; iblk < blocks.size(); iblk++) {
+            match_block(iblk);
+        }
+#endif
+        std::unordered_set<AtomBlockId> blocks_in_new_molecules;
+
         for (auto blk_iter = blocks.begin(); blk_iter != blocks.end(); ++blk_iter) {
             auto blk_id = *blk_iter;
 
-            cur_molecule = try_create_molecule(list_of_pack_patterns, best_pattern, blk_id);
+            t_molecule_match& match = matches[blk_iter - blocks.begin()];
+            for (AtomBlockId checked_blk_id : match.checked_blocks) {
+                if (blocks_in_new_molecules.count(checked_blk_id)) {
+                    match = t_molecule_match();
+                    try_match_molecule(&list_of_pack_patterns[best_pattern], blk_id, match);
+                    break;
+                }
+            }
+
+            cur_molecule = match.is_matched ? create_matched_molecule(&list_of_pack_patterns[best_pattern], match) : nullptr;
             if (cur_molecule != nullptr) {
+                for (AtomBlockId molecule_blk_id : cur_molecule->atom_block_ids) {
+                    if (molecule_blk_id) {
+                        blocks_in_new_molecules.insert(molecule_blk_id);
+                    }
+                }
+
                 cur_molecule->next = list_of_molecules_head;
                 /* In the event of multiple molecules with the same atom block pattern,
                  * bias to use the molecule with less costly physical resources first */
@@ -852,8 +907,22 @@ t_pack_molecule* alloc_and_load_pack_molecules(t_pack_patterns* list_of_pack_pat
      * If a block belongs to a molecule, then carrying the single atoms around can make the packing problem
      * more difficult because now it needs to consider splitting molecules.
      */
-    for (auto blk_id : atom_ctx.nlist.blocks()) {
-        t_pb_graph_node* best = get_expected_lowest_cost_primitive_for_atom_block(blk_id);
+    auto blocks = atom_ctx.nlist.blocks();
+    std::vector<t_pb_graph_node*> best_primitives(blocks.size());
+    auto find_best_primitive = [&](size_t iblk) {
+        best_primitives[iblk] = get_expected_lowest_cost_primitive_for_atom_block(*(blocks.begin() + iblk));
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), blocks.size(), find_best_primitive);
+#else
+    for (size_t iblk = 0; iblk < blocks.size(); iblk++) {
+        find_best_primitive(iblk);
+    }
+#endif
+
+    for (auto blk_iter = blocks.begin(); blk_iter != blocks.end(); ++blk_iter) {
+        auto blk_id = *blk_iter;
+        t_pb_graph_node* best = best_primitives[blk_iter - blocks.begin()];
         if (!best) {
             /* Free the molecules in the linked list to avoid memory leakage */
             cur_molecule = list_of_molecules_head;
@@ -921,7 +990,8 @@ static void free_pack_pattern_block(t_pack_pattern_block* pattern_block, t_pack_
 /**
  * Given a pattern and an atom block to serve as the root block, determine if
  * the candidate atom block serving as the root node matches the pattern.
- * If yes, return the molecule with this atom block as the root, if not, return NULL
+ * If yes, match holds the atoms of the molecule with this atom block as the root
+ * (see create_matched_molecule()).
  *
  * Limitations: Currently assumes that forced pack nets must be single-fanout as
  *              this covers all the reasonable architectures we wanted. More complicated
@@ -929,59 +999,59 @@ static void free_pack_pattern_block(t_pack_pattern_block* pattern_block, t_pack_
  *              or upstream (in tech mapping).
  *              If this limitation is too constraining, code is designed so that this limitation can be removed
  *
- * Side Effect: If successful, link atom to molecule
+ * The molecules are not changed, so this is safe to call concurrently as long as no molecule is being created.
  */
-static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patterns,
-                                            const int pack_pattern_index,
-                                            AtomBlockId blk_id) {
-    t_pack_molecule* molecule;
-
-    auto& atom_mutable_ctx = g_vpr_ctx.mutable_atom();
-
-    auto pack_pattern = &list_of_pack_patterns[pack_pattern_index];
+static void try_match_molecule(const t_pack_patterns* pack_pattern,
+                               AtomBlockId blk_id,
+                               t_molecule_match& match) {
+    match.is_matched = false;
 
     // Check pack pattern validity
     if (pack_pattern == nullptr || pack_pattern->num_blocks == 0 || pack_pattern->root_block == nullptr) {
-        return nullptr;
+        return;
     }
 
     // If a chain pattern extends beyond a single logic block, we must find
     // the furthest blk_id up the chain that is not mapped to a molecule yet.
     if (pack_pattern->is_chain) {
-        blk_id = find_new_root_atom_for_chain(blk_id, pack_pattern);
-        if (!blk_id) return nullptr;
+        blk_id = find_new_root_atom_for_chain(blk_id, pack_pattern, match.checked_blocks);
+        if (!blk_id) return;
     }
 
-    molecule = new t_pack_molecule;
+    match.root_blk_id = blk_id;
+    match.atom_block_ids = std::vector<AtomBlockId>(pack_pattern->num_blocks); //Initializes invalid
+    match.is_matched = try_expand_molecule(pack_pattern, match.atom_block_ids, blk_id, match.checked_blocks);
+}
+
+/* Creates the molecule of a successful match, and links its atoms to it */
+static t_pack_molecule* create_matched_molecule(t_pack_patterns* pack_pattern,
+                                                const t_molecule_match& match) {
+    VTR_ASSERT(match.is_matched);
+
+    auto& atom_mutable_ctx = g_vpr_ctx.mutable_atom();
+
+    t_pack_molecule* molecule = new t_pack_molecule;
     molecule->valid = true;
     molecule->type = MOLECULE_FORCED_PACK;
     molecule->pack_pattern = pack_pattern;
-    molecule->atom_block_ids = std::vector<AtomBlockId>(pack_pattern->num_blocks); //Initializes invalid
+    molecule->atom_block_ids = match.atom_block_ids;
     molecule->num_blocks = pack_pattern->num_blocks;
     molecule->root = pack_pattern->root_block->block_id;
 
-    if (try_expand_molecule(molecule, blk_id)) {
-        // Success! commit molecule
+    // update chain info for chain molecules
+    if (molecule->pack_pattern->is_chain) {
+        init_molecule_chain_info(match.root_blk_id, molecule);
+    }
 
-        // update chain info for chain molecules
-        if (molecule->pack_pattern->is_chain) {
-            init_molecule_chain_info(blk_id, molecule);
+    // update the atom_molcules with the atoms that are mapped to this molecule
+    for (int i = 0; i < molecule->pack_pattern->num_blocks; i++) {
+        auto blk_id2 = molecule->atom_block_ids[i];
+        if (!blk_id2) {
+            VTR_ASSERT(molecule->pack_pattern->is_block_optional[i]);
+            continue;
         }
 
-        // update the atom_molcules with the atoms that are mapped to this molecule
-        for (int i = 0; i < molecule->pack_pattern->num_blocks; i++) {
-            auto blk_id2 = molecule->atom_block_ids[i];
-            if (!blk_id2) {
-                VTR_ASSERT(molecule->pack_pattern->is_block_optional[i]);
-                continue;
-            }
-
-            atom_mutable_ctx.atom_molecules.insert({blk_id2, molecule});
-        }
-    } else {
-        // Failed to create molecule
-        delete molecule;
-        return nullptr;
+        atom_mutable_ctx.atom_molecules.insert({blk_id2, molecule});
     }
 
     return molecule;
@@ -996,19 +1066,22 @@ static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patter
  * of the packing pattern, this function tries to fill all the available positions
  * in the packing pattern. If all the non-optional primitive positions in the
  * pattern are filled return true, return false otherwise.
- *      molecule       : the molecule we are trying to expand
- *      atom_molecules : map of atom block ids that are assigned a molecule and a pointer to this molecule
+ *      pack_pattern   : the pattern the molecule is being matched to
+ *      atom_block_ids : the atom block occupying each position of the pattern, filled as the code expands
  *      blk_id         : chosen to be the root of this molecule and the code is expanding from
+ *      checked_blocks : the atom blocks looked up in atom_molecules (which the result depends on) are appended to it
  */
-static bool try_expand_molecule(t_pack_molecule* molecule,
-                                const AtomBlockId blk_id) {
+static bool try_expand_molecule(const t_pack_patterns* pack_pattern,
+                                std::vector<AtomBlockId>& atom_block_ids,
+                                const AtomBlockId blk_id,
+                                std::vector<AtomBlockId>& checked_blocks) {
     auto& atom_ctx = g_vpr_ctx.atom();
 
     // root block of the pack pattern, which is the starting point of this pattern
-    const auto pattern_root_block = molecule->pack_pattern->root_block;
+    const auto pattern_root_block = pack_pattern->root_block;
     // bool array indicating whether a position in a pack pattern is optional or should
     // be filled with an atom for legality
-    const auto is_block_optional = molecule->pack_pattern->is_block_optional;
+    const auto is_block_optional = pack_pattern->is_block_optional;
 
     // create a queue of pattern block and atom block id suggested for this block
     std::queue<std::pair<t_pack_pattern_block*, AtomBlockId>> pattern_block_queue;
@@ -1027,7 +1100,7 @@ static bool try_expand_molecule(t_pack_molecule* molecule,
         pattern_block_queue.pop();
 
         // get the atom block id of the atom occupying this primitive position in this molecule
-        auto molecule_atom_block_id = molecule->atom_block_ids[pattern_block->block_id];
+        auto molecule_atom_block_id = atom_block_ids[pattern_block->block_id];
 
         // if this primitive position in this molecule is already visited and
         // matches block in the atom netlist go to the next node in the queue
@@ -1035,7 +1108,11 @@ static bool try_expand_molecule(t_pack_molecule* molecule,
             continue;
         }
 
-        if (!block_id || !primitive_type_feasible(block_id, pattern_block->pb_type) || (molecule_atom_block_id && molecule_atom_block_id != block_id) || atom_ctx.atom_molecules.find(block_id) != atom_ctx.atom_molecules.end()) {
+        bool is_checked = block_id && primitive_type_feasible(block_id, pattern_block->pb_type) && !(molecule_atom_block_id && molecule_atom_block_id != block_id);
+        if (is_checked) {
+            checked_blocks.push_back(block_id);
+        }
+        if (!is_checked || atom_ctx.atom_molecules.find(block_id) != atom_ctx.atom_molecules.end()) {
             // Stopping conditions, if:
             // 1) this is an invalid atom block (nothing)
             // 2) this atom block cannot fit in this primitive type
@@ -1051,7 +1128,7 @@ static bool try_expand_molecule(t_pack_molecule* molecule,
         }
 
         // set this node in the molecule as visited
-        molecule->atom_block_ids[pattern_block->block_id] = block_id;
+        atom_block_ids[pattern_block->block_id] = block_id;
 
         // starting from the first connections, add all the connections of this block to the queue
         auto block_connection = pattern_block->connections;
@@ -1300,8 +1377,9 @@ static int compare_pack_pattern(const t_pack_patterns* pattern_a, const t_pack_p
  * Assumes that the root of a chain is the primitive that starts the chain or is driven from outside the logic block
  * block_index: index of current atom
  * list_of_pack_pattern: ptr to current chain pattern
+ * checked_blocks: the atoms looked up in atom_molecules (which the result depends on) are appended to it
  */
-static AtomBlockId find_new_root_atom_for_chain(const AtomBlockId blk_id, const t_pack_patterns* list_of_pack_pattern) {
+static AtomBlockId find_new_root_atom_for_chain(const AtomBlockId blk_id, const t_pack_patterns* list_of_pack_pattern, std::vector<AtomBlockId>& checked_blocks) {
     AtomBlockId new_root_blk_id;
     t_pb_graph_pin* root_ipin;
     t_pb_graph_node* root_pb_graph_node;
@@ -1330,6 +1408,7 @@ static AtomBlockId find_new_root_atom_for_chain(const AtomBlockId blk_id, const
         return blk_id;
     }
     // check if driver atom is already packed
+    checked_blocks.push_back(driver_blk_id);
     auto rng = atom_ctx.atom_molecules.equal_range(driver_blk_id);
     bool rng_empty = (rng.first == rng.second);
     if (!rng_empty) {
@@ -1338,7 +1417,7 @@ static AtomBlockId find_new_root_atom_for_chain(const AtomBlockId blk_id, const
     }
 
     // didn't find furthest atom up the chain, keep searching further up the chain
-    new_root_blk_id = find_new_root_atom_for_chain(driver_blk_id, list_of_pack_pattern);
+    new_root_blk_id = find_new_root_atom_for_chain(driver_blk_id, list_of_pack_pattern, checked_blocks);
 
     if (!new_root_blk_id) {
         return blk_id;
@@ -4,6 +4,20 @@
 #include "cluster_placement.h"
 #include "cluster_router.h"
 
+#include <algorithm>
+
+/* Nets with more pins (e.g. clocks and resets) are not looked at to find the clusters a molecule connects to */
+static constexpr size_t REPACK_MAX_NET_PINS = 64;
+
+/* Maximum number of existing clusters a molecule is tried in, before starting a new cluster for it */
+static constexpr size_t REPACK_MAX_CANDIDATE_CLUSTERS = 16;
+
+static std::vector<ClusterBlockId> find_connected_clusters(const t_pack_molecule* molecule);
+static bool pack_mol_in_new_cluster(t_pack_molecule* molecule,
+                                    int verbosity,
+                                    t_clustering_data& clustering_data,
+                                    const std::map<const t_model*, std::vector<t_logical_block_type_ptr>>& primitive_candidate_block_types);
+
 bool move_mol_to_new_cluster(t_pack_molecule* molecule,
                              bool during_packing,
                              int verbosity,
@@ -245,3 +259,181 @@ bool swap_two_molecules(t_pack_molecule* molecule_1,
     return true;
 }
 #endif
+
+bool unpack_molecule(t_pack_molecule* molecule,
+                     int verbosity,
+                     t_clustering_data& clustering_data) {
+    AtomBlockId root_atom_id = molecule->atom_block_ids[molecule->root];
+    int molecule_size = get_array_size_of_molecule(molecule);
+    t_lb_router_data* old_router_data = nullptr;
+
+    ClusterBlockId old_clb = atom_to_cluster(root_atom_id);
+    if (!old_clb) {
+        VTR_LOGV(verbosity > 4, "Atom: %zu unpack failed. It is not clustered.\n", size_t(root_atom_id));
+        return false;
+    }
+
+    //remove the molecule from its cluster
+    std::unordered_set<AtomBlockId>* old_clb_atoms = cluster_to_atoms(old_clb);
+    size_t num_molecule_atoms = std::count_if(molecule->atom_block_ids.begin(), molecule->atom_block_ids.end(),
+                                              [](AtomBlockId blk_id) { return bool(blk_id); });
+    if (old_clb_atoms->size() <= num_molecule_atoms) {
+        VTR_LOGV(verbosity > 4, "Atom: %zu unpack failed. These are the last atoms in their cluster.\n", size_t(root_atom_id));
+        return false;
+    }
+    remove_mol_from_cluster(molecule, molecule_size, old_clb, old_clb_atoms, false, old_router_data);
+
+    //check old cluster legality after removing the molecule
+    bool is_removed = is_cluster_legal(old_router_data);
+
+    //if the cluster is legal, commit the molecule removal. Otherwise, put the molecule back
+    if (is_removed) {
+        commit_mol_removal(molecule, molecule_size, old_clb, true, old_router_data, clustering_data);
+        free_router_data(old_router_data);
+        old_router_data = nullptr;
+        VTR_LOGV(verbosity > 4, "Atom: %zu is unpacked\n", size_t(root_atom_id));
+    } else {
+        revert_mol_removal(molecule, molecule_size, old_clb, old_clb_atoms, old_router_data);
+        VTR_LOGV(verbosity > 4, "Atom: %zu unpack failed. Can't remove it from its cluster\n", size_t(root_atom_id));
+    }
+
+    return is_removed;
+}
+
+int repack_molecules(const std::vector<t_pack_molecule*>& molecules,
+                     int verbosity,
+                     t_clustering_data& clustering_data) {
+    auto primitive_candidate_block_types = identify_primitive_candidate_block_types();
+
+    int num_unpacked = 0;
+    for (t_pack_molecule* molecule : molecules) {
+        AtomBlockId root_atom_id = molecule->atom_block_ids[molecule->root];
+        int molecule_size = get_array_size_of_molecule(molecule);
+        VTR_ASSERT(!atom_to_cluster(root_atom_id));
+
+        bool is_added = false;
+        for (ClusterBlockId clb : find_connected_clusters(molecule)) {
+            t_lb_router_data* router_data = nullptr;
+            is_added = pack_mol_in_existing_cluster(molecule, molecule_size, clb, cluster_to_atoms(clb), true, false, clustering_data, router_data);
+            if (is_added) {
+                VTR_LOGV(verbosity > 4, "Atom: %zu is packed in the existing cluster %zu\n", size_t(root_atom_id), size_t(clb));
+                break;
+            }
+        }
+
+        if (!is_added) {
+            is_added = pack_mol_in_new_cluster(molecule, verbosity, clustering_data, primitive_candidate_block_types);
+        }
+
+        if (!is_added) {
+            VTR_LOGV(verbosity > 2, "Atom: %zu could not be re-packed\n", size_t(root_atom_id));
+            num_unpacked++;
+        }
+    }
+
+    return num_unpacked;
+}
+
+/* Returns the clusters the molecule shares low fanout nets with, from the most to the least connected */
+static std::vector<ClusterBlockId> find_connected_clusters(const t_pack_molecule* molecule) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+
+    std::map<ClusterBlockId, int> num_connections;
+    for (auto blk_id : molecule->atom_block_ids) {
+        if (!blk_id) continue;
+
+        for (auto pin_id : atom_ctx.nlist.block_pins(blk_id)) {
+            AtomNetId net_id = atom_ctx.nlist.pin_net(pin_id);
+            if (atom_ctx.nlist.net_pins(net_id).size() > REPACK_MAX_NET_PINS) continue;
+
+            for (auto net_pin_id : atom_ctx.nlist.net_pins(net_id)) {
+                ClusterBlockId clb = atom_to_cluster(atom_ctx.nlist.pin_block(net_pin_id));
+                if (clb) {
+                    num_connections[clb]++;
+                }
+            }
+        }
+    }
+
+    std::vector<ClusterBlockId> clusters;
+    for (const auto& kv : num_connections) {
+        clusters.push_back(kv.first);
+    }
+    //Most connected first, ties by cluster id so the result does not depend on the map order
+    std::stable_sort(clusters.begin(), clusters.end(), [&](ClusterBlockId lhs, ClusterBlockId rhs) {
+        return num_connections[lhs] > num_connections[rhs];
+    });
+    if (clusters.size() > REPACK_MAX_CANDIDATE_CLUSTERS) {
+        clusters.resize(REPACK_MAX_CANDIDATE_CLUSTERS);
+    }
+    return clusters;
+}
+
+/* Packs the molecule in a new cluster of the first candidate type (and mode) with room for it */
+static bool pack_mol_in_new_cluster(t_pack_molecule* molecule,
+                                    int verbosity,
+                                    t_clustering_data& clustering_data,
+                                    const std::map<const t_model*, std::vector<t_logical_block_type_ptr>>& primitive_candidate_block_types) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& helper_ctx = g_vpr_ctx.mutable_cl_helper();
+    auto& floorplanning_ctx = g_vpr_ctx.mutable_floorplanning();
+
+    AtomBlockId root_atom_id = molecule->atom_block_ids[molecule->root];
+    auto itr = primitive_candidate_block_types.find(atom_ctx.nlist.block_model(root_atom_id));
+    if (itr == primitive_candidate_block_types.end()) {
+        return false;
+    }
+
+    for (t_logical_block_type_ptr block_type : itr->second) {
+        //Check that there is a place for a new cluster of this type
+        unsigned int num_instances = 0;
+        for (auto equivalent_tile : block_type->equivalent_tiles) {
+            num_instances += device_ctx.grid.num_instances(equivalent_tile, -1);
+        }
+        if (helper_ctx.num_used_type_instances[block_type] >= num_instances) {
+            VTR_LOGV(verbosity > 4, "The utilization of block_type %s is 100%%. No space for new clusters\n", block_type->name);
+            continue;
+        }
+
+        for (int mode = 0; mode < block_type->pb_graph_head->pb_type->num_modes; mode++) {
+            ClusterBlockId new_clb(helper_ctx.total_clb_num);
+            PartitionRegion temp_cluster_pr;
+            t_lb_router_data* router_data = nullptr;
+            bool is_created = start_new_cluster_for_mol(molecule,
+                                                        block_type,
+                                                        mode,
+                                                        helper_ctx.feasible_block_array_size,
+                                                        helper_ctx.enable_pin_feasibility_filter,
+                                                        new_clb,
+                                                        true,
+                                                        verbosity,
+                                                        clustering_data,
+                                                        &router_data,
+                                                        temp_cluster_pr);
+            if (!is_created) {
+                //Drop the constraints start_new_cluster_for_mol() added for the cluster
+                floorplanning_ctx.cluster_constraints.pop_back();
+                continue;
+            }
+
+            floorplanning_ctx.cluster_constraints[new_clb] = temp_cluster_pr;
+            helper_ctx.num_used_type_instances[block_type]++;
+
+            //Keep the atoms lookup of the re-clustering API in sync
+            if (!helper_ctx.atoms_lookup.empty()) {
+                helper_ctx.atoms_lookup.resize(helper_ctx.total_clb_num);
+                for (auto blk_id : molecule->atom_block_ids) {
+                    if (blk_id) {
+                        helper_ctx.atoms_lookup[new_clb].insert(blk_id);
+                    }
+                }
+            }
+
+            VTR_LOGV(verbosity > 4, "Atom: %zu is packed in the new cluster %zu\n", size_t(root_atom_id), size_t(new_clb));
+            return true;
+        }
+    }
+
+    return false;
+}
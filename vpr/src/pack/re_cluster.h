@@ -57,4 +57,37 @@ bool swap_two_molecules(t_pack_molecule* molecule_1,
                         bool during_packing,
                         int verbosity,
                         t_clustering_data& clustering_data);
+
+/**
+ * @brief This function moves a molecule out of its cluster, and leaves its atoms unclustered.
+ *
+ * Together with repack_molecules(), this lets an engineering change order (ECO) re-pack only the atoms it
+ * removes or changes, keeping all the other clusters:
+ *   - The molecules of the removed or changed atoms are unpacked.
+ *   - The molecules of the changed or added atoms are then re-packed.
+ *
+ * It fails (and changes nothing) if the molecule holds the last atoms of its cluster, or if the cluster is
+ * no longer legal without it.
+ *
+ * @note Like the other functions of this API with during_packing set, it must be called before the clustered
+ *       netlist nets are built (i.e. during packing).
+ */
+bool unpack_molecule(t_pack_molecule* molecule,
+                     int verbosity,
+                     t_clustering_data& clustering_data);
+
+/**
+ * @brief This function packs unclustered molecules (e.g. the atoms added or changed by an ECO) without re-packing the other clusters.
+ *
+ * Each molecule is first tried in the existing clusters it connects to, in decreasing number of connections.
+ * If no existing cluster can hold it, it is packed in a new cluster.
+ *
+ * @return The number of molecules that could not be packed (they are left unclustered).
+ *
+ * @note Like the other functions of this API with during_packing set, it must be called before the clustered
+ *       netlist nets are built (i.e. during packing).
+ */
+int repack_molecules(const std::vector<t_pack_molecule*>& molecules,
+                     int verbosity,
+                     t_clustering_data& clustering_data);
 #endif
@@ -651,6 +651,22 @@ bool is_cluster_legal(t_lb_router_data*& router_data) {
     return (check_cluster_legality(0, E_DETAILED_ROUTE_AT_END_ONLY, router_data));
 }
 
+void revert_mol_removal(const t_pack_molecule* molecule,
+                        int molecule_size,
+                        const ClusterBlockId& old_clb,
+                        std::unordered_set<AtomBlockId>* old_clb_atoms,
+                        t_lb_router_data*& router_data) {
+    for (int i_atom = 0; i_atom < molecule_size; i_atom++) {
+        if (molecule->atom_block_ids[i_atom]) {
+            old_clb_atoms->insert(molecule->atom_block_ids[i_atom]);
+        }
+    }
+    update_cluster_pb_stats(molecule, molecule_size, old_clb, true);
+
+    free_router_data(router_data);
+    router_data = nullptr;
+}
+
 void commit_mol_removal(const t_pack_molecule* molecule,
                         const int& molecule_size,
                         const ClusterBlockId& old_clb,
@@ -141,6 +141,17 @@ void revert_mol_move(const ClusterBlockId& old_clb,
 
 bool is_cluster_legal(t_lb_router_data*& router_data);
 
+/**
+ * @brief A function that puts back a molecule removed by remove_mol_from_cluster(), when the removal is not committed
+ *
+ * It restores old_clb_atoms and the cluster pb stats, and frees the router data.
+ */
+void revert_mol_removal(const t_pack_molecule* molecule,
+                        int molecule_size,
+                        const ClusterBlockId& old_clb,
+                        std::unordered_set<AtomBlockId>* old_clb_atoms,
+                        t_lb_router_data*& router_data);
+
 void commit_mol_removal(const t_pack_molecule* molecule,
                         const int& molecule_size,
                         const ClusterBlockId& old_clb,
@@ -15,6 +15,14 @@
 #    include "cut_spreader.h"
 #    include "vpr_utils.h"
 #    include "place_util.h"
+#    include "electrostatic_density.h"
+#    include "vtr_parallel.h"
+
+#    ifdef VPR_USE_TBB
+#        include <tbb/blocked_range.h>
+#        include <tbb/parallel_for.h>
+#        include <tbb/parallel_reduce.h>
+#    endif
 
 // Templated struct for constructing and solving matrix equations in analytic placer
 template<typename T>
@@ -70,7 +78,7 @@ struct EquationSystem {
     // (x must be of correct size, A and rhs must have their entries filled in)
     // tolerance is residual error from solver: |Ax-b|/|b|, 1e-5 works well,
     // can be tuned in ap_cfg in AnalyticPlacer constructor
-    void solve(std::vector<T>& x, float tolerance) {
+    EquationSolveStats solve(std::vector<T>& x, float tolerance) {
         using namespace Eigen;
 
         VTR_ASSERT(x.size() == A.size());
@@ -101,7 +109,112 @@ struct EquationSystem {
         VectorXd x_res = solver.compute(mat).solveWithGuess(vec_rhs, vec_x_guess);
         for (int i_row = 0; i_row < int(x.size()); i_row++)
             x.at(i_row) = x_res[i_row];
+
+        EquationSolveStats stats;
+        stats.iterations = int(solver.iterations());
+        stats.error = solver.error();
+        return stats;
+    }
+
+#    ifdef VPR_USE_TBB
+    // Same as solve(), but the sparse matrix-vector products and vector operations of the solver
+    // are split across the TBB worker threads.
+    //
+    // This is the algorithm of Eigen's ConjugateGradient with its default diagonal (Jacobi)
+    // preconditioner and iteration limit. A is symmetric, so each of its columns is also a row
+    // and it can be used as is. The dot products are deterministic reductions, so the solution
+    // does not depend on the thread scheduling.
+    EquationSolveStats solve_parallel(std::vector<T>& x, float tolerance) const {
+        VTR_ASSERT(x.size() == A.size());
+
+        const size_t n = A.size();
+        const int max_iterations = 2 * int(n);
+        // Rows per task, large enough to amortize the scheduling overhead
+        constexpr size_t GRAIN_SIZE = 1024;
+        const tbb::blocked_range<size_t> rows(0, n, GRAIN_SIZE);
+
+        auto parallel_rows = [&](auto&& row_fn) {
+            tbb::parallel_for(rows, [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t row = range.begin(); row < range.end(); ++row)
+                    row_fn(row);
+            });
+        };
+        auto dot = [&](const std::vector<T>& a, const std::vector<T>& b) {
+            return tbb::parallel_deterministic_reduce(
+                rows, T(),
+                [&](const tbb::blocked_range<size_t>& range, T sum) {
+                    for (size_t row = range.begin(); row < range.end(); ++row)
+                        sum += a[row] * b[row];
+                    return sum;
+                },
+                std::plus<T>());
+        };
+        // out = A * v
+        auto mat_vec = [&](const std::vector<T>& v, std::vector<T>& out) {
+            parallel_rows([&](size_t row) {
+                T sum = T();
+                for (const auto& entry : A[row])
+                    sum += entry.second * v[entry.first];
+                out[row] = sum;
+            });
+        };
+
+        EquationSolveStats stats;
+
+        T rhs_norm2 = dot(rhs, rhs);
+        if (rhs_norm2 == 0) {
+            std::fill(x.begin(), x.end(), T());
+            return stats;
+        }
+        const T threshold = std::max(T(tolerance) * T(tolerance) * rhs_norm2, std::numeric_limits<T>::min());
+
+        std::vector<T> inv_diag(n, T(1));
+        parallel_rows([&](size_t row) {
+            for (const auto& entry : A[row]) {
+                if (size_t(entry.first) == row && entry.second != 0)
+                    inv_diag[row] = T(1) / entry.second;
+            }
+        });
+
+        std::vector<T> residual(n), p(n), z(n), tmp(n);
+        mat_vec(x, tmp);
+        parallel_rows([&](size_t row) { residual[row] = rhs[row] - tmp[row]; });
+
+        T residual_norm2 = dot(residual, residual);
+        if (residual_norm2 < threshold) {
+            stats.error = std::sqrt(residual_norm2 / rhs_norm2);
+            return stats;
+        }
+
+        parallel_rows([&](size_t row) { p[row] = inv_diag[row] * residual[row]; });
+        T abs_new = dot(residual, p);
+
+        int i = 0;
+        while (i < max_iterations) {
+            mat_vec(p, tmp);
+            T alpha = abs_new / dot(p, tmp);
+            parallel_rows([&](size_t row) {
+                x[row] += alpha * p[row];
+                residual[row] -= alpha * tmp[row];
+            });
+
+            residual_norm2 = dot(residual, residual);
+            if (residual_norm2 < threshold)
+                break;
+
+            parallel_rows([&](size_t row) { z[row] = inv_diag[row] * residual[row]; });
+            T abs_old = abs_new;
+            abs_new = dot(residual, z);
+            T beta = abs_new / abs_old;
+            parallel_rows([&](size_t row) { p[row] = z[row] + beta * p[row]; });
+            i++;
+        }
+
+        stats.iterations = i;
+        stats.error = std::sqrt(residual_norm2 / rhs_norm2);
+        return stats;
     }
+#    endif
 };
 
 // helper function to find the index of macro that contains blk
@@ -123,12 +236,19 @@ ClusterBlockId macro_head(ClusterBlockId blk) {
 // Stop optimizing once this many iterations of solve-legalize lead to negligible wirelength improvement
 constexpr int HEAP_STALLED_ITERATIONS_STOP = 15;
 
+// The electrostatic lower-bound placement is already spread out, so legalizing it converges in fewer iterations
+constexpr int ELECTROSTATIC_STALLED_ITERATIONS_STOP = 3;
+
+// Stop the Nesterov iterations of the electrostatic engine once the blocks overflow the capacity by less than this
+// fraction; the cut-spreader and legalizer resolve the remaining overlaps
+constexpr double ELECTROSTATIC_TARGET_OVERFLOW = 0.1;
+
 /*
  * AnalyticPlacer constructor
  * Currently only initializing AP configuration parameters
  * Placement & device info is accessed via g_vpr_ctx
  */
-AnalyticPlacer::AnalyticPlacer() {
+AnalyticPlacer::AnalyticPlacer(bool report_solver_stats, e_analytic_placer_engine engine) {
     //Eigen::initParallel();
 
     // TODO: PlacerHeapCfg should be externally configured & supplied
@@ -144,6 +264,15 @@ AnalyticPlacer::AnalyticPlacer() {
 
     ap_cfg.solverTolerance = 1e-5; // solver parameter, refers to residual error from solver, defined as |Ax-b|/|b|
 
+#    ifdef VPR_USE_TBB
+    ap_cfg.parallelSolver = true; // solve with the multi-threaded conjugate gradient solver instead of Eigen's
+                                  // (single-threaded) one, see EquationSystem::solve_parallel()
+#    else
+    ap_cfg.parallelSolver = false;
+#    endif
+
+    ap_cfg.reportSolverStats = report_solver_stats; // log the convergence and runtime of each build-solve iteration
+
     ap_cfg.buildSolveIter = 5; // number of build-solve iteration when calculating placement, used in
                                // build_solve_direction()
                                // for each build-solve iteration, the solution from previous build-solve iteration
@@ -159,6 +288,14 @@ AnalyticPlacer::AnalyticPlacer() {
     // see comment in add_pin_to_pin_connection() for usage
     ap_cfg.criticalityExponent = 1;
     ap_cfg.timingWeight = 10;
+
+    ap_cfg.engine = engine;
+    ap_cfg.stalledIterationsStop = (engine == e_analytic_placer_engine::ELECTROSTATIC) ? ELECTROSTATIC_STALLED_ITERATIONS_STOP
+                                                                                      : HEAP_STALLED_ITERATIONS_STOP;
+
+    // following two parameters are used by the electrostatic engine, see electrostatic_solve()
+    ap_cfg.nesterovMaxIter = 1000;     // upper bound on the Nesterov iterations of one lower-bound placement
+    ap_cfg.densityWeightGrowth = 1.05; // the density weight grows geometrically, until the blocks are spread out
 }
 
 /*
@@ -198,9 +335,12 @@ void AnalyticPlacer::ap_place() {
     // setup and solve matrix multiple times for all logic block types before main loop
     // this helps eliminating randomness from initial placement (when placing one block type, the random placement
     // of the other types may have residual effect on the result, since not all blocks are solved at the same time)
-    for (int i = 0; i < 1; i++) { // can tune number of iterations
-        for (auto run : ap_runs) {
-            build_solve_type(run, -1);
+    // (the electrostatic engine does not depend on the initial placement as much, as the density spreads the blocks out)
+    if (ap_cfg.engine == e_analytic_placer_engine::QUADRATIC) {
+        for (int i = 0; i < 1; i++) { // can tune number of iterations
+            for (auto run : ap_runs) {
+                build_solve_type(run, -1);
+            }
         }
     }
 
@@ -212,8 +352,8 @@ void AnalyticPlacer::ap_place() {
     print_AP_status_header();
 
     // main loop for AP
-    // stopping criteria: stop after HEAP_STALLED_ITERATIONS_STOP iterations of no improvement
-    while (stalled < HEAP_STALLED_ITERATIONS_STOP) {
+    // stopping criteria: stop after ap_cfg.stalledIterationsStop iterations of no improvement
+    while (stalled < ap_cfg.stalledIterationsStop) {
         // TODO: investigate better stopping criteria
         iter_start = timer.elapsed_sec();
         for (auto blk_type : ap_runs) { // for each type of logic blocks
@@ -281,10 +421,15 @@ void AnalyticPlacer::ap_place() {
 // macro member positions are updated after solving
 void AnalyticPlacer::build_solve_type(t_logical_block_type_ptr run, int iter) {
     setup_solve_blks(run);
-    // build and solve matrix equation for both x, y
-    // passing -1 as iter to build_solve_direction() signals build_equation() not to add pseudo-connections
-    build_solve_direction(false, (iter == 0) ? -1 : iter, ap_cfg.buildSolveIter);
-    build_solve_direction(true, (iter == 0) ? -1 : iter, ap_cfg.buildSolveIter);
+    if (ap_cfg.engine == e_analytic_placer_engine::ELECTROSTATIC) {
+        // the density penalty replaces the pseudo-connections to the legal locations
+        electrostatic_solve();
+    } else {
+        // build and solve matrix equation for both x, y
+        // passing -1 as iter to build_solve_direction() signals build_equation() not to add pseudo-connections
+        build_solve_direction(false, (iter == 0) ? -1 : iter, ap_cfg.buildSolveIter);
+        build_solve_direction(true, (iter == 0) ? -1 : iter, ap_cfg.buildSolveIter);
+    }
     update_macros(); // update macro member locations, since only macro head is solved
 }
 
@@ -449,9 +594,19 @@ void AnalyticPlacer::update_macros() {
  */
 void AnalyticPlacer::build_solve_direction(bool yaxis, int iter, int build_solve_iter) {
     for (int i = 0; i < build_solve_iter; i++) {
+        vtr::Timer build_timer;
         EquationSystem<double> esx(solve_blks.size(), solve_blks.size());
         build_equations(esx, yaxis, iter);
-        solve_equations(esx, yaxis);
+        float build_t = build_timer.elapsed_sec();
+
+        vtr::Timer solve_timer;
+        EquationSolveStats solve_stats = solve_equations(esx, yaxis);
+        float solve_t = solve_timer.elapsed_sec();
+
+        if (ap_cfg.reportSolverStats) {
+            VTR_LOG("  %c build-solve %d: %zu variables, %d solver iterations, error %.3g, build %.3f sec, solve %.3f sec\n",
+                    yaxis ? 'y' : 'x', i, solve_blks.size(), solve_stats.iterations, solve_stats.error, build_t, solve_t);
+        }
     }
 }
 
@@ -670,7 +825,7 @@ void AnalyticPlacer::build_equations(EquationSystem<double>& es, bool yaxis, int
  * yaxis represents if it's x-directed or y-directed location problem
  * Solved solution is moved to loc, rawx, rawy in blk_locs for each block
  */
-void AnalyticPlacer::solve_equations(EquationSystem<double>& es, bool yaxis) {
+EquationSolveStats AnalyticPlacer::solve_equations(EquationSystem<double>& es, bool yaxis) {
     int max_x = g_vpr_ctx.device().grid.width();
     int max_y = g_vpr_ctx.device().grid.height();
 
@@ -678,7 +833,13 @@ void AnalyticPlacer::solve_equations(EquationSystem<double>& es, bool yaxis) {
     std::vector<double> solve_blks_pos; // each row of solve_blks_pos is a free variable (movable block of the right type to be placed)
     // put current location of solve_blks into solve_blks_pos as guess for iterative solver
     std::transform(solve_blks.begin(), solve_blks.end(), std::back_inserter(solve_blks_pos), blk_pos);
-    es.solve(solve_blks_pos, ap_cfg.solverTolerance);
+    EquationSolveStats solve_stats;
+#    ifdef VPR_USE_TBB
+    if (ap_cfg.parallelSolver)
+        solve_stats = es.solve_parallel(solve_blks_pos, ap_cfg.solverTolerance);
+    else
+#    endif
+        solve_stats = es.solve(solve_blks_pos, ap_cfg.solverTolerance);
 
     // move solved locations of solve_blks from solve_blks_pos into blk_locs
     // ensure that new location is strictly within [0, grid.width/height - 1];
@@ -690,6 +851,320 @@ void AnalyticPlacer::solve_equations(EquationSystem<double>& es, bool yaxis) {
             blk_locs[solve_blks.at(i_row)].rawx = std::max(0.0, solve_blks_pos.at(i_row));
             blk_locs[solve_blks.at(i_row)].loc.x = std::min(max_x - 1, std::max(0, int(solve_blks_pos.at(i_row) + 0.5)));
         }
+
+    return solve_stats;
+}
+
+/*
+ * Electrostatic (ePlace) lower-bound placement of the blocks in solve_blks
+ *
+ * The objective is f = W + lambda * D, where:
+ *  * W is the weighted-average (WA) wirelength, a smooth approximation of HPWL: in each direction, the extent of a net
+ *    is approximated by the difference of the exp(x / gamma) and exp(-x / gamma) weighted mean pin locations. The
+ *    smoothing gamma shrinks with the overflow, so the approximation tightens as the blocks spread out.
+ *  * D is the electrostatic density penalty of the blocks against the capacity of their compatible sub-tiles
+ *    (@see ElectrostaticDensity). Its gradient for a block is minus its charge (1 per macro member) times the field.
+ *
+ * lambda starts by balancing the gradients of W and D, and grows by ap_cfg.densityWeightGrowth every iteration.
+ *
+ * f is minimized with Nesterov's accelerated gradient method; the step length is the inverse of the Lipschitz
+ * constant of the gradient estimated from the last two iterations, and the gradient is preconditioned by the number
+ * of pins and the charge of each block. Only the macro heads are variables, as for the quadratic formulation.
+ *
+ * The wirelength gradient is found net by net in parallel into per-pin gradients, which are then summed block by block,
+ * so the result does not depend on the number of threads.
+ */
+void AnalyticPlacer::electrostatic_solve() {
+    const ClusteredNetlist& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+    PlacementContext& place_ctx = g_vpr_ctx.mutable_placement();
+    const int max_x = g_vpr_ctx.device().grid.width();
+    const int max_y = g_vpr_ctx.device().grid.height();
+
+    const size_t num_vars = solve_blks.size();
+    if (num_vars == 0) {
+        return;
+    }
+    t_logical_block_type_ptr blk_type = clb_nlist.block_type(solve_blks[0]);
+
+    // the capacity of each location is its number of compatible sub-tiles (as in CutSpreader)
+    ElectrostaticDensity density(max_x, max_y);
+    vtr::Matrix<double> capacity({size_t(max_x), size_t(max_y)}, 0.);
+    for (auto& tile : blk_type->equivalent_tiles) {
+        for (auto& sub_tile : tile->sub_tiles) {
+            auto result = std::find(sub_tile.equivalent_sites.begin(), sub_tile.equivalent_sites.end(), blk_type);
+            if (result != sub_tile.equivalent_sites.end()) {
+                for (auto loc : legal_pos.at(tile->index).at(sub_tile.index)) {
+                    capacity[loc.x][loc.y] += 1.;
+                }
+            }
+        }
+    }
+    for (int x = 0; x < max_x; ++x) {
+        for (int y = 0; y < max_y; ++y) {
+            density.set_capacity(x, y, capacity[x][y]);
+        }
+    }
+
+    // the blocks moved by each variable (a block, or the members of a macro), with their offset from the macro head,
+    // and the range of head locations keeping all of them on the device
+    std::vector<std::vector<std::pair<ClusterBlockId, t_pl_offset>>> var_blks(num_vars);
+    vtr::vector_map<ClusterBlockId, t_pl_offset> blk_offset;
+    for (auto blk_id : clb_nlist.blocks()) {
+        blk_offset.insert(blk_id, t_pl_offset());
+    }
+    std::vector<double> min_x(num_vars), max_xs(num_vars), min_y(num_vars), max_ys(num_vars);
+    for (size_t row = 0; row < num_vars; ++row) {
+        ClusterBlockId head = solve_blks[row];
+        if (imacro(head) != NO_MACRO) {
+            for (auto& member : place_ctx.pl_macros[imacro(head)].members) {
+                var_blks[row].emplace_back(member.blk_index, member.offset);
+                blk_offset[member.blk_index] = member.offset;
+            }
+        } else {
+            var_blks[row].emplace_back(head, t_pl_offset());
+        }
+
+        int min_dx = 0, max_dx = 0, min_dy = 0, max_dy = 0;
+        for (auto& var_blk : var_blks[row]) {
+            min_dx = std::min(min_dx, var_blk.second.x);
+            max_dx = std::max(max_dx, var_blk.second.x);
+            min_dy = std::min(min_dy, var_blk.second.y);
+            max_dy = std::max(max_dy, var_blk.second.y);
+        }
+        min_x[row] = -min_dx;
+        max_xs[row] = std::max<double>(min_x[row], max_x - 1 - max_dx);
+        min_y[row] = -min_dy;
+        max_ys[row] = std::max<double>(min_y[row], max_y - 1 - max_dy);
+    }
+
+    // the nets connected to the variables, and the number of their pins on each variable
+    std::vector<ClusterNetId> nets;
+    std::vector<double> num_var_pins(num_vars, 0.);
+    vtr::vector_map<ClusterNetId, char> net_used;
+    for (auto net_id : clb_nlist.nets()) {
+        net_used.insert(net_id, false);
+    }
+    for (size_t row = 0; row < num_vars; ++row) {
+        for (auto& var_blk : var_blks[row]) {
+            for (auto pin_id : clb_nlist.block_pins(var_blk.first)) {
+                ClusterNetId net_id = clb_nlist.pin_net(pin_id);
+                if (net_id == ClusterNetId::INVALID()
+                    || clb_nlist.net_is_ignored(net_id)
+                    || clb_nlist.net_driver(net_id) == ClusterPinId::INVALID()
+                    || clb_nlist.net_sinks(net_id).empty()) {
+                    continue;
+                }
+                num_var_pins[row] += 1.;
+                if (!net_used[net_id]) {
+                    net_used[net_id] = true;
+                    nets.push_back(net_id);
+                }
+            }
+        }
+    }
+    std::sort(nets.begin(), nets.end());
+
+    // variable locations: u is the main solution, v the Nesterov reference (look-ahead) solution
+    std::vector<double> ux(num_vars), uy(num_vars);
+    for (size_t row = 0; row < num_vars; ++row) {
+        ux[row] = blk_locs[solve_blks[row]].loc.x;
+        uy[row] = blk_locs[solve_blks[row]].loc.y;
+    }
+    std::vector<double> vx = ux, vy = uy;
+
+    // location of a block: from the variables if it is solved, otherwise its current location
+    auto blk_pos = [&](ClusterBlockId blk_id, bool yaxis, const std::vector<double>& pos) {
+        int row = row_num[blk_id];
+        if (row == DONT_SOLVE) {
+            return double(yaxis ? blk_locs[blk_id].loc.y : blk_locs[blk_id].loc.x);
+        }
+        return pos[row] + (yaxis ? blk_offset[blk_id].y : blk_offset[blk_id].x);
+    };
+
+    double gamma = 0.;
+    std::vector<double> pin_grad(clb_nlist.pins().size(), 0.);
+    // WA wirelength gradient of the variables in one direction, into grad
+    auto wirelength_gradient = [&](bool yaxis, const std::vector<double>& pos, std::vector<double>& grad) {
+        vtr::parallel_for(0, nets.size(), [&](size_t inet) {
+            ClusterNetId net_id = nets[inet];
+            double pos_max = -std::numeric_limits<double>::infinity();
+            double pos_min = std::numeric_limits<double>::infinity();
+            for (auto pin_id : clb_nlist.net_pins(net_id)) {
+                double p = blk_pos(clb_nlist.pin_block(pin_id), yaxis, pos);
+                pos_max = std::max(pos_max, p);
+                pos_min = std::min(pos_min, p);
+            }
+            // the exponentials are taken relative to the extreme locations, so they do not overflow
+            double sum_max = 0., sum_max_pos = 0., sum_min = 0., sum_min_pos = 0.;
+            for (auto pin_id : clb_nlist.net_pins(net_id)) {
+                double p = blk_pos(clb_nlist.pin_block(pin_id), yaxis, pos);
+                double e_max = std::exp((p - pos_max) / gamma);
+                double e_min = std::exp((pos_min - p) / gamma);
+                sum_max += e_max;
+                sum_max_pos += p * e_max;
+                sum_min += e_min;
+                sum_min_pos += p * e_min;
+            }
+            double wa_max = sum_max_pos / sum_max;
+            double wa_min = sum_min_pos / sum_min;
+            for (auto pin_id : clb_nlist.net_pins(net_id)) {
+                double p = blk_pos(clb_nlist.pin_block(pin_id), yaxis, pos);
+                double e_max = std::exp((p - pos_max) / gamma);
+                double e_min = std::exp((pos_min - p) / gamma);
+                pin_grad[size_t(pin_id)] = e_max / sum_max * (1. + (p - wa_max) / gamma)
+                                           - e_min / sum_min * (1. - (p - wa_min) / gamma);
+            }
+        });
+        vtr::parallel_for(0, num_vars, [&](size_t row) {
+            double sum = 0.;
+            for (auto& var_blk : var_blks[row]) {
+                for (auto pin_id : clb_nlist.block_pins(var_blk.first)) {
+                    ClusterNetId net_id = clb_nlist.pin_net(pin_id);
+                    if (net_id != ClusterNetId::INVALID() && net_used[net_id]) {
+                        sum += pin_grad[size_t(pin_id)];
+                    }
+                }
+            }
+            grad[row] = sum;
+        });
+    };
+
+    std::vector<double> wl_gx(num_vars), wl_gy(num_vars), den_gx(num_vars), den_gy(num_vars);
+    // evaluates the wirelength and density gradients at (px, py), returns the overflow
+    auto evaluate = [&](const std::vector<double>& px, const std::vector<double>& py) {
+        density.clear_charges();
+        for (size_t row = 0; row < num_vars; ++row) {
+            for (auto& var_blk : var_blks[row]) {
+                density.add_charge(px[row] + var_blk.second.x, py[row] + var_blk.second.y, 1.);
+            }
+        }
+        density.solve();
+        vtr::parallel_for(0, num_vars, [&](size_t row) {
+            double gx = 0., gy = 0.;
+            for (auto& var_blk : var_blks[row]) {
+                gx -= density.field_x(px[row] + var_blk.second.x, py[row] + var_blk.second.y);
+                gy -= density.field_y(px[row] + var_blk.second.x, py[row] + var_blk.second.y);
+            }
+            den_gx[row] = gx;
+            den_gy[row] = gy;
+        });
+
+        wirelength_gradient(false, px, wl_gx);
+        wirelength_gradient(true, py, wl_gy);
+        return density.overflow();
+    };
+
+    // WA smoothing, from the (DREAMPlace) overflow schedule: from 40 tiles when fully overlapping to 0.4 at 10% overflow
+    auto wa_gamma = [](double overflow) {
+        return 4. * std::pow(10., 20. / 9. * overflow - 11. / 9.);
+    };
+
+    double lambda = 0.;
+    std::vector<double> gx(num_vars), gy(num_vars);
+    // the preconditioned gradient of the objective, from the last evaluate()
+    auto combine_gradient = [&]() {
+        for (size_t row = 0; row < num_vars; ++row) {
+            double precond = std::max(1., num_var_pins[row] + lambda * var_blks[row].size());
+            gx[row] = (wl_gx[row] + lambda * den_gx[row]) / precond;
+            gy[row] = (wl_gy[row] + lambda * den_gy[row]) / precond;
+        }
+    };
+    auto clamp_vars = [&](std::vector<double>& px, std::vector<double>& py) {
+        for (size_t row = 0; row < num_vars; ++row) {
+            px[row] = std::min(std::max(px[row], min_x[row]), max_xs[row]);
+            py[row] = std::min(std::max(py[row], min_y[row]), max_ys[row]);
+        }
+    };
+    auto max_abs = [](const std::vector<double>& a, const std::vector<double>& b) {
+        double m = 0.;
+        for (size_t i = 0; i < a.size(); ++i) {
+            m = std::max(m, std::max(std::abs(a[i]), std::abs(b[i])));
+        }
+        return m;
+    };
+
+    // no variable moves by more than this many tiles per iteration
+    const double max_move = std::max(1., 0.05 * std::max(max_x, max_y));
+
+    gamma = wa_gamma(1.);
+    double overflow = evaluate(vx, vy);
+    gamma = wa_gamma(overflow);
+
+    double wl_norm = 0., den_norm = 0.;
+    for (size_t row = 0; row < num_vars; ++row) {
+        wl_norm += std::abs(wl_gx[row]) + std::abs(wl_gy[row]);
+        den_norm += std::abs(den_gx[row]) + std::abs(den_gy[row]);
+    }
+    lambda = (den_norm > 0.) ? wl_norm / den_norm : 1.;
+    combine_gradient();
+
+    double step = 1. / std::max(1e-12, max_abs(gx, gy));
+    double a = 1.;
+    std::vector<double> prev_vx, prev_vy, prev_gx, prev_gy;
+    int iter = 0;
+    for (; iter < ap_cfg.nesterovMaxIter && overflow > ELECTROSTATIC_TARGET_OVERFLOW; ++iter) {
+        step = std::min(step, max_move / std::max(1e-12, max_abs(gx, gy)));
+
+        // u_{k+1} = v_k - step * grad(v_k)
+        std::vector<double> next_ux(num_vars), next_uy(num_vars);
+        for (size_t row = 0; row < num_vars; ++row) {
+            next_ux[row] = vx[row] - step * gx[row];
+            next_uy[row] = vy[row] - step * gy[row];
+        }
+        clamp_vars(next_ux, next_uy);
+
+        // v_{k+1} = u_{k+1} + (a_k - 1) / a_{k+1} * (u_{k+1} - u_k)
+        double next_a = (1. + std::sqrt(4. * a * a + 1.)) / 2.;
+        double momentum = (a - 1.) / next_a;
+        prev_vx.swap(vx);
+        prev_vy.swap(vy);
+        vx.resize(num_vars);
+        vy.resize(num_vars);
+        for (size_t row = 0; row < num_vars; ++row) {
+            vx[row] = next_ux[row] + momentum * (next_ux[row] - ux[row]);
+            vy[row] = next_uy[row] + momentum * (next_uy[row] - uy[row]);
+        }
+        clamp_vars(vx, vy);
+        ux.swap(next_ux);
+        uy.swap(next_uy);
+        a = next_a;
+
+        prev_gx = gx;
+        prev_gy = gy;
+        overflow = evaluate(vx, vy);
+        gamma = wa_gamma(overflow);
+        lambda *= ap_cfg.densityWeightGrowth;
+        combine_gradient();
+
+        // step = 1 / L, with the Lipschitz constant L estimated as |v_{k+1} - v_k| / |g_{k+1} - g_k|
+        double dv = 0., dg = 0.;
+        for (size_t row = 0; row < num_vars; ++row) {
+            dv += (vx[row] - prev_vx[row]) * (vx[row] - prev_vx[row]) + (vy[row] - prev_vy[row]) * (vy[row] - prev_vy[row]);
+            dg += (gx[row] - prev_gx[row]) * (gx[row] - prev_gx[row]) + (gy[row] - prev_gy[row]) * (gy[row] - prev_gy[row]);
+        }
+        if (dv > 0. && dg > 0.) {
+            step = std::sqrt(dv / dg);
+        }
+
+        if (ap_cfg.reportSolverStats && iter % 50 == 0) {
+            VTR_LOG("  electrostatic %s iteration %d: overflow %.3f, density weight %.3g, wirelength smoothing %.3g\n",
+                    blk_type->name, iter, overflow, lambda, gamma);
+        }
+    }
+
+    if (ap_cfg.reportSolverStats) {
+        VTR_LOG("  electrostatic %s: %zu variables, %zu nets, %d Nesterov iterations, overflow %.3f\n",
+                blk_type->name, num_vars, nets.size(), iter, overflow);
+    }
+
+    // move the solution into blk_locs, within [0, grid.width/height - 1] (as solve_equations())
+    for (size_t row = 0; row < num_vars; ++row) {
+        BlockLocation& bl = blk_locs[solve_blks[row]];
+        bl.rawx = std::max(0.0, ux[row]);
+        bl.rawy = std::max(0.0, uy[row]);
+        bl.loc.x = std::min(max_x - 1, std::max(0, int(ux[row] + 0.5)));
+        bl.loc.y = std::min(max_y - 1, std::max(0, int(uy[row] + 0.5)));
+    }
 }
 
 // Debug use, finds # of blocks on each tile location
@@ -49,6 +49,20 @@
  * This process of formulating the system, solving, and legalizing is repeated until sufficiently good placement is
  * acquired. Currently the stopping criterion is HEAP_STALLED_ITERATIONS_STOP iterations without improvement in total_hpwl.
  *
+ * Electrostatic engine
+ * ====================
+ * With --analytic_placer_engine electrostatic, the lower-bound placement is instead the (nonlinear) global placement
+ * of ePlace: the weighted-average (WA) smooth approximation of HPWL plus a density penalty, minimized by Nesterov's
+ * accelerated gradient method (see electrostatic_solve()). The density penalty is the electrostatic energy of the
+ * blocks of the type being placed, against the capacity of their compatible sub-tiles (@see electrostatic_density.h).
+ * Its weight grows every Nesterov iteration, until the overflow of the blocks over the capacity falls below
+ * ELECTROSTATIC_TARGET_OVERFLOW. The result is already mostly spread out, so it is cut-spread and legalized as above,
+ * and fewer iterations are needed before the placement stalls (ELECTROSTATIC_STALLED_ITERATIONS_STOP).
+ *
+ * @cite ePlace
+ * ePlace: Electrostatics Based Placement Using Fast Fourier Transform and Nesterov's Method, Jingwei Lu et al.
+ * https://doi.org/10.1145/2699873
+ *
  *
  * Parameters to tweak & things to try out
  * =======================================
@@ -88,11 +102,21 @@
 
 /*
  * @brief Templated struct for constructing and solving matrix equations in analytic placer
- * Eigen library is used in EquationSystem::solve()
+ * Eigen library is used in EquationSystem::solve(), or a multi-threaded conjugate gradient solver
+ * in EquationSystem::solve_parallel() when VPR is built with TBB
  */
 template<typename T>
 struct EquationSystem;
 
+/*
+ * @brief Convergence of solving an EquationSystem: number of solver iterations and
+ * final residual error |Ax-b|/|b|
+ */
+struct EquationSolveStats {
+    int iterations = 0;
+    double error = 0.;
+};
+
 // sentinel for blks not solved in current iteration
 extern int DONT_SOLVE;
 
@@ -121,8 +145,11 @@ class AnalyticPlacer {
     /*
      * @brief Constructor of AnalyticPlacer, currently initializes AnalyticPlacerCfg for the analytic placer
      * To tune these parameters, change directly in constructor
+     * report_solver_stats logs the convergence and runtime of every build-solve iteration
+     * engine selects the lower-bound placement formulation (quadratic or electrostatic)
      */
-    AnalyticPlacer();
+    explicit AnalyticPlacer(bool report_solver_stats = false,
+                            e_analytic_placer_engine engine = e_analytic_placer_engine::QUADRATIC);
 
     /*
      * @brief main function of analytic placement
@@ -146,8 +173,14 @@ class AnalyticPlacer {
         int criticalityExponent;            // not currently used, @see build_equations()
         int timingWeight;                   // not currently used, @see build_equations()
         float solverTolerance;              // parameter of the solver
+        bool parallelSolver;                // use the multi-threaded solver (only available with TBB)
+        bool reportSolverStats;             // log solver convergence and runtime per build-solve iteration
         int buildSolveIter;                 // build_solve iterations for iterative solver
         int spread_scale_x, spread_scale_y; // see CutSpreader::expand_regions()
+        e_analytic_placer_engine engine;    // lower-bound placement formulation
+        int stalledIterationsStop;          // stop after this many AP iterations without an HPWL improvement
+        int nesterovMaxIter;                // maximum Nesterov iterations of an electrostatic_solve()
+        double densityWeightGrowth;         // growth of the density penalty weight per Nesterov iteration
     };
 
     AnalyticPlacerCfg ap_cfg; // TODO: PlacerHeapCfg should be externally configured & supplied
@@ -254,6 +287,13 @@ class AnalyticPlacer {
      */
     void build_solve_direction(bool yaxis, int iter, int build_solve_iter);
 
+    /*
+     * Electrostatic engine: places the blocks of solve_blks by minimizing the WA wirelength plus their
+     * electrostatic density penalty with Nesterov's method, from their current location.
+     * Like solve_equations(), the solution is written back to blk_locs[blk].rawx/rawy, and rounded into loc
+     */
+    void electrostatic_solve();
+
     /*
      * Stamp 1 weight for 1 connection on matrix or rhs vector
      * if var is movable objects, weight is added on matrix
@@ -292,8 +332,9 @@ class AnalyticPlacer {
      * this current location is provided to iterative solver as a guess
      * the solved location is written back to blk_locs, and is used as guess for the next
      * iteration of solving (@see build_solve_direct())
+     * returns the convergence of the solver
      */
-    void solve_equations(EquationSystem<double>& es, bool yaxis);
+    EquationSolveStats solve_equations(EquationSystem<double>& es, bool yaxis);
 
     /*
      * Debug use
@@ -141,6 +141,55 @@ t_compressed_block_grid create_compressed_block_grid(const std::vector<std::vect
     return compressed_grid;
 }
 
+int find_compressed_region_locs(t_compressed_block_grid& compressed_block_grid, const std::vector<Region>& regions) {
+    for (size_t i = 0; i < compressed_block_grid.region_locs.size(); ++i) {
+        if (compressed_block_grid.region_locs[i].regions == regions) {
+            return i;
+        }
+    }
+
+    auto& grid = g_vpr_ctx.device().grid;
+
+    t_compressed_region_locs region_locs;
+    region_locs.regions = regions;
+    region_locs.column_rows.resize(compressed_block_grid.grid.size());
+    for (size_t layer_num = 0; layer_num < compressed_block_grid.grid.size(); ++layer_num) {
+        const auto& layer_compressed_grid = compressed_block_grid.grid[layer_num];
+        region_locs.column_rows[layer_num].resize(layer_compressed_grid.size());
+
+        for (size_t cx = 0; cx < layer_compressed_grid.size(); ++cx) {
+            //The flat map is sorted by compressed y, so the rows are found in order
+            for (const auto& row : layer_compressed_grid[cx]) {
+                const t_physical_tile_loc& tile_loc = row.second;
+                const auto& compatible_sub_tiles = compressed_block_grid.compatible_sub_tile_num(grid.get_physical_type(tile_loc)->index);
+
+                //A tile is within the regions if one of them contains it, and allows one of its compatible sub tiles
+                bool in_regions = false;
+                for (const Region& region : regions) {
+                    const auto rect = region.get_region_rect();
+                    if (rect.layer_num != tile_loc.layer_num
+                        || tile_loc.x < rect.xmin || tile_loc.x > rect.xmax
+                        || tile_loc.y < rect.ymin || tile_loc.y > rect.ymax) {
+                        continue;
+                    }
+                    if (region.get_sub_tile() == NO_SUBTILE
+                        || std::find(compatible_sub_tiles.begin(), compatible_sub_tiles.end(), region.get_sub_tile()) != compatible_sub_tiles.end()) {
+                        in_regions = true;
+                        break;
+                    }
+                }
+
+                if (in_regions) {
+                    region_locs.column_rows[layer_num][cx].push_back(row.first);
+                }
+            }
+        }
+    }
+
+    compressed_block_grid.region_locs.push_back(std::move(region_locs));
+    return compressed_block_grid.region_locs.size() - 1;
+}
+
 /*Print the contents of the compressed grids to an echo file*/
 void echo_compressed_grids(char* filename, const std::vector<t_compressed_block_grid>& comp_grids) {
     FILE* fp;
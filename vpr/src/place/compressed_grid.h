@@ -2,10 +2,25 @@
 #define VPR_COMPRESSED_GRID_H
 
 #include "physical_types.h"
+#include "region.h"
 
 #include "vtr_geometry.h"
 #include "vtr_flat_map.h"
 
+/**
+ * @brief The compressed locations of a block type which lie within a floorplan region.
+ *
+ * Floorplan constrained blocks can only be placed at a few of the locations of their type, so the
+ * move generators pick among these locations instead of retrying random locations of the compressed
+ * grid, most of which would be outside the region.
+ */
+struct t_compressed_region_locs {
+    std::vector<Region> regions; ///<The union of regions (as in a PartitionRegion) the locations are within
+
+    ///@brief [0...num_layers-1][0...num_columns-1] -> sorted compressed y of the locations within the regions
+    std::vector<std::vector<std::vector<int>>> column_rows;
+};
+
 struct t_compressed_block_grid {
     // The compressed grid of a block type stores only the coordinates that are occupied by that particular block type.
     // For instance, if a DSP block exists only in the 2nd, 3rd, and 5th columns, the compressed grid of X axis will solely store the values 2, 3, and 5.
@@ -31,6 +46,10 @@ struct t_compressed_block_grid {
     //  - value: vector of compatible sub tiles for the physical tile/logical block pair
     std::unordered_map<int, std::vector<int>> compatible_sub_tiles_for_tile;
 
+    //The compressed locations within each of the floorplan regions constraining blocks of this type,
+    //shared by all the blocks with the same region (see find_compressed_region_locs())
+    std::vector<t_compressed_region_locs> region_locs;
+
     inline size_t get_num_columns(int layer_num) const {
         return compressed_to_grid_x[layer_num].size();
     }
@@ -113,6 +132,12 @@ std::vector<t_compressed_block_grid> create_compressed_block_grids();
 
 t_compressed_block_grid create_compressed_block_grid(const std::vector<std::vector<vtr::Point<int>>>& locations, int num_layers);
 
+/**
+ * @brief Returns the index in compressed_block_grid.region_locs of the locations within regions,
+ *        finding them first if no other block of the type has the same regions
+ */
+int find_compressed_region_locs(t_compressed_block_grid& compressed_block_grid, const std::vector<Region>& regions);
+
 /**
  * @brief  print the contents of the compressed grids to an echo file
  *
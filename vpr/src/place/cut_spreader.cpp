@@ -13,11 +13,9 @@
 #    include "vtr_log.h"
 #    include "place_util.h"
 
-// sentinel for base case in CutSpreader (i.e. only 1 block left in region)
-constexpr std::pair<int, int> BASE_CASE = {-2, -2};
-
-// sentinel for cut-spreading fail, the other direction is run next
-constexpr std::pair<int, int> CUT_FAIL = {-1, -1};
+#    ifdef VPR_USE_TBB
+#        include <tbb/parallel_for.h>
+#    endif
 
 // sentinel for a grid location that is not covered by any regions, for reg_id_at_grid data member
 constexpr int AP_NO_REGION = -1;
@@ -63,48 +61,73 @@ void CutSpreader::cutSpread() {
     expand_regions();        // expand overused regions until they have enough sub_tiles to accommodate their logic blks
 
     /*
-     * workqueue is a FIFO queue used to recursively cut-spread.
+     * wave is the list of regions (and their cut direction) to cut-spread next, used to
+     * recursively cut-spread one level of the cut tree at a time.
      *
      * In the region vector, the regions not in merged_regions (not absorbed in expansion process)
-     * are the initial regions placed in workqueue to cut-spread.
+     * are the initial regions placed in wave to cut-spread.
      *
-     * After each of these initial regions are cut and spread, their child sub-regions
-     * (left and right) are placed at the back of workqueue, with alternated cut direction.
-     * This process continues until base case of region with only 1 block is reached,
-     * indicated by BASE_CASE return value.
+     * After all regions of a wave are cut and spread, their child sub-regions (left and right)
+     * form the next wave, in order and with alternated cut direction. This process continues
+     * until base case of region with only 1 block is reached, indicated by BASE_CASE result.
+     * Processing the waves in order is the same as processing a FIFO queue of regions.
      *
-     * Return value of CUT_FAIL indicates that cutting is unsuccessful. This usually happens
+     * Result of CUT_FAIL indicates that cutting is unsuccessful. This usually happens
      * when regions are quite small: for example, region only has 1 column so a vertical cut
      * is impossible. In this case cut in the other direction is attempted.
+     *
+     * The regions of a wave are disjoint and cut_region() only modifies blocks and locations
+     * within the region it cuts, so the regions of a wave are cut in parallel. The sub-regions
+     * are only given their IDs once the wave is done, in wave order, so the result is identical
+     * to cutting the regions serially.
      */
-    std::queue<std::pair<int, bool>> workqueue;
+    std::vector<std::pair<int, bool>> wave;
 
-    // put initial regions into workqueue
+    // put initial regions into wave
     for (auto& r : regions) {
         if (!merged_regions.count(r.id))
-            workqueue.emplace(r.id, false);
+            wave.emplace_back(r.id, false);
     }
 
-    while (!workqueue.empty()) {
-        auto front = workqueue.front();
-        workqueue.pop();
-        auto& r = regions.at(front.first);
-
-        auto res = cut_region(r, front.second);
-        if (res == BASE_CASE) // only 1 block left, base case
-            continue;
-        if (res != CUT_FAIL) { // cut-spread successful
-                               // place children regions in workqueue
-            workqueue.emplace(res.first, !front.second);
-            workqueue.emplace(res.second, !front.second);
-        } else {                                      // cut-spread unsuccessful
-            auto res2 = cut_region(r, !front.second); // try other direction
-            if (res2 != CUT_FAIL) {
-                // place children regions in workqueue
-                workqueue.emplace(res2.first, front.second);
-                workqueue.emplace(res2.second, front.second);
+    struct t_wave_cut {
+        e_cut_result res;
+        bool dir; // direction region was cut in
+        SpreaderRegion rl, rr;
+    };
+    std::vector<t_wave_cut> cuts;
+
+    while (!wave.empty()) {
+        cuts.resize(wave.size());
+
+        auto cut_wave_region = [&](size_t i) {
+            auto& r = regions[wave[i].first];
+            auto& cut = cuts[i];
+            cut.dir = wave[i].second;
+            cut.res = cut_region(r, cut.dir, cut.rl, cut.rr);
+            if (cut.res == e_cut_result::CUT_FAIL) { // cut-spread unsuccessful
+                cut.dir = !cut.dir;                  // try other direction
+                cut.res = cut_region(r, cut.dir, cut.rl, cut.rr);
             }
+        };
+#    ifdef VPR_USE_TBB
+        tbb::parallel_for(size_t(0), wave.size(), cut_wave_region);
+#    else
+        for (size_t i = 0; i < wave.size(); i++) {
+            cut_wave_region(i);
+        }
+#    endif
+
+        // place children regions of successful cuts in the next wave
+        std::vector<std::pair<int, bool>> next_wave;
+        for (auto& cut : cuts) {
+            if (cut.res != e_cut_result::CUT) // base case, or cut unsuccessful in both directions
+                continue;
+            add_sub_region(cut.rl);
+            add_sub_region(cut.rr);
+            next_wave.emplace_back(cut.rl.id, !cut.dir);
+            next_wave.emplace_back(cut.rr.id, !cut.dir);
         }
+        wave = std::move(next_wave);
     }
 }
 
@@ -398,14 +421,17 @@ void CutSpreader::expand_regions() {
  *  @param r	region to cut & spread
  *  @param dir	direction, true for y, false for x
  *
- *  @return		a pair of sub-region IDs created from cutting region r.
+ *  @param rl	returns the left sub-region if region r is cut
+ *  @param rr	returns the right sub-region if region r is cut
+ *
+ *  @return		CUT if region r is cut into sub-regions rl and rr.
  *  			BASE_CASE if base case is reached
  *  			CUT_FAIL if cut unsuccessful, need to cut in the other direction
  */
-std::pair<int, int> CutSpreader::cut_region(SpreaderRegion& r, bool dir) {
+CutSpreader::e_cut_result CutSpreader::cut_region(SpreaderRegion& r, bool dir, SpreaderRegion& rl, SpreaderRegion& rr) {
     const DeviceContext& device_ctx = g_vpr_ctx.device();
     const ClusteredNetlist& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
-    PlacementContext& place_ctx = g_vpr_ctx.mutable_placement();
+    const PlacementContext& place_ctx = g_vpr_ctx.placement();
 
     // TODO: CutSpreader is not compatible with 3D FPGA
     VTR_ASSERT(device_ctx.grid.get_num_layers() == 1);
@@ -438,11 +464,11 @@ std::pair<int, int> CutSpreader::cut_region(SpreaderRegion& r, bool dir) {
                         ap->blk_locs[blk].loc.y = y;
                         blks_at_location[x][y].push_back(blk);
                         blks_at_location[loc.x][loc.y].clear();
-                        return BASE_CASE;
+                        return e_cut_result::BASE_CASE;
                     }
                 }
         }
-        return BASE_CASE;
+        return e_cut_result::BASE_CASE;
     }
 
     // sort blks based on raw location
@@ -470,30 +496,22 @@ std::pair<int, int> CutSpreader::cut_region(SpreaderRegion& r, bool dir) {
     int best_tgt_cut = initial_target_cut(r, cut_blks, pivot, dir, trimmed_l, trimmed_r,
                                           clearance_l, clearance_r, left_blks_n, right_blks_n, left_tiles_n, right_tiles_n);
     if (best_tgt_cut == -1) // target cut fails clearance requirement for macros
-        return CUT_FAIL;
+        return e_cut_result::CUT_FAIL;
 
     // Once target_cut is acquired, define left and right subareas
     // The boundaries are defined using the trimmed edges and best target cut
     // The n_tiles will be final while n_blks may change by perturbing the source cut to eliminate
     // overutilization in subareas
-    SpreaderRegion rl, rr;
-    rl.id = int(regions.size());
+    rl.id = AP_NO_REGION; // assigned by add_sub_region()
     rl.bb = dir ? vtr::Rect<int>{r.bb.xmin(), trimmed_l, r.bb.xmax(), best_tgt_cut}
                 : vtr::Rect<int>{trimmed_l, r.bb.ymin(), best_tgt_cut, r.bb.ymax()};
     rl.n_blks = left_blks_n;
     rl.n_tiles = left_tiles_n;
-    rr.id = int(regions.size()) + 1;
+    rr.id = AP_NO_REGION;
     rr.bb = dir ? vtr::Rect<int>{r.bb.xmin(), best_tgt_cut + 1, r.bb.xmax(), trimmed_r}
                 : vtr::Rect<int>{best_tgt_cut + 1, r.bb.ymin(), trimmed_r, r.bb.ymax()};
     rr.n_blks = right_blks_n;
     rr.n_tiles = right_tiles_n;
-    // change the region IDs in each subarea's grid location to subarea's id
-    for (int x = rl.bb.xmin(); x <= rl.bb.xmax(); x++)
-        for (int y = rl.bb.ymin(); y <= rl.bb.ymax(); y++)
-            reg_id_at_grid[x][y] = rl.id;
-    for (int x = rr.bb.xmin(); x <= rr.bb.xmax(); x++)
-        for (int y = rr.bb.ymin(); y <= rr.bb.ymax(); y++)
-            reg_id_at_grid[x][y] = rr.id;
 
     /*
      * Perturb source cut to eliminate over-utilization
@@ -521,11 +539,20 @@ std::pair<int, int> CutSpreader::cut_region(SpreaderRegion& r, bool dir) {
     linear_spread_subarea(cut_blks, dir, 0, pivot + 1, rl);
     linear_spread_subarea(cut_blks, dir, pivot + 1, cut_blks.size(), rr);
 
-    // push subareas back to regions so that they can be accessed by their IDs later
-    regions.push_back(rl);
-    regions.push_back(rr);
+    return e_cut_result::CUT;
+}
+
+// assign the next region ID to sub_region and add it to regions
+void CutSpreader::add_sub_region(SpreaderRegion& sub_region) {
+    sub_region.id = int(regions.size());
+
+    // change the region IDs in the subarea's grid location to subarea's id
+    for (int x = sub_region.bb.xmin(); x <= sub_region.bb.xmax(); x++)
+        for (int y = sub_region.bb.ymin(); y <= sub_region.bb.ymax(); y++)
+            reg_id_at_grid[x][y] = sub_region.id;
 
-    return std::make_pair(rl.id, rr.id);
+    // push subarea back to regions so that it can be accessed by its ID later
+    regions.push_back(sub_region);
 }
 
 // copy all logic blocks to cut into cut_blks
@@ -617,7 +644,7 @@ int CutSpreader::initial_source_cut(SpreaderRegion& r,
                                     bool dir,
                                     int& clearance_l,
                                     int& clearance_r) {
-    PlacementContext& place_ctx = g_vpr_ctx.mutable_placement();
+    const PlacementContext& place_ctx = g_vpr_ctx.placement();
 
     // pivot is the midpoint of cut_blks in terms of total block size (counting macro members)
     // this ensures the initial partitions have similar number of blocks
@@ -670,7 +697,7 @@ int CutSpreader::initial_target_cut(SpreaderRegion& r,
                                     int& right_blks_n,
                                     int& left_tiles_n,
                                     int& right_tiles_n) {
-    PlacementContext& place_ctx = g_vpr_ctx.mutable_placement();
+    const PlacementContext& place_ctx = g_vpr_ctx.placement();
 
     // To achieve smallest difference in utilization, first move all tiles to right partition
     left_blks_n = 0, right_blks_n = 0;
@@ -301,18 +301,29 @@ class CutSpreader {
                                int blks_end,
                                SpreaderRegion& sub_area);
 
+    // result of cut_region()
+    enum class e_cut_result {
+        CUT,       // region is cut into 2 sub-regions
+        BASE_CASE, // base case is reached (only 1 block left in region)
+        CUT_FAIL   // cut unsuccessful, need to cut in the other direction
+    };
+
     /*
      * Recursive cut-based spreading in HeAP paper
      * "left" denotes "-x, -y", "right" denotes "+x, +y" depending on dir
      *
+     * Only modifies blocks and locations within r.bb, so disjoint regions can be cut concurrently.
+     * The sub-regions are returned without an ID, see add_sub_region().
+     *
      *  @param r	region to cut & spread
      *  @param dir	direction, true for y, false for x
-     *
-     *  @return		a pair of sub-region IDs created from cutting region r.
-     *  			BASE_CASE if base case is reached
-     *  			CUT_FAIL if cut unsuccessful, need to cut in the other direction
+     *  @param rl	returns the left sub-region if region r is cut
+     *  @param rr	returns the right sub-region if region r is cut
      */
-    std::pair<int, int> cut_region(SpreaderRegion& r, bool dir);
+    e_cut_result cut_region(SpreaderRegion& r, bool dir, SpreaderRegion& rl, SpreaderRegion& rr);
+
+    // Assign the next region ID to sub_region (created by cut_region()) and add it to regions
+    void add_sub_region(SpreaderRegion& sub_region);
 
     /*
      * Helper function in strict_legalize()
@@ -0,0 +1,171 @@
+#include "electrostatic_density.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "vtr_assert.h"
+#include "vtr_math.h"
+#include "vtr_parallel.h"
+
+namespace {
+
+///@brief The bilinear interpolation of x over the [0, size - 1] bins: bins x0 and x1, with weight (1 - frac) and frac
+struct t_interp {
+    size_t x0;
+    size_t x1;
+    double frac;
+};
+
+t_interp interp_bins(double x, size_t size) {
+    x = std::min(std::max(x, 0.), double(size - 1));
+    t_interp interp;
+    interp.x0 = size_t(x);
+    interp.x1 = std::min(interp.x0 + 1, size - 1);
+    interp.frac = x - double(interp.x0);
+    return interp;
+}
+
+void fill_tables(size_t size, vtr::Matrix<double>& cos_table, vtr::Matrix<double>& sin_table, std::vector<double>& freqs) {
+    cos_table.resize({size, size});
+    sin_table.resize({size, size});
+    freqs.resize(size);
+    for (size_t u = 0; u < size; ++u) {
+        freqs[u] = M_PI * double(u) / double(size);
+        for (size_t x = 0; x < size; ++x) {
+            cos_table[u][x] = std::cos(freqs[u] * (double(x) + 0.5));
+            sin_table[u][x] = std::sin(freqs[u] * (double(x) + 0.5));
+        }
+    }
+}
+
+} // namespace
+
+ElectrostaticDensity::ElectrostaticDensity(size_t width, size_t height)
+    : width_(width)
+    , height_(height)
+    , capacity_({width, height}, 0.)
+    , demand_({width, height}, 0.)
+    , field_x_({width, height}, 0.)
+    , field_y_({width, height}, 0.) {
+    VTR_ASSERT(width > 0 && height > 0);
+    fill_tables(width, cos_x_, sin_x_, freq_x_);
+    fill_tables(height, cos_y_, sin_y_, freq_y_);
+}
+
+void ElectrostaticDensity::set_capacity(size_t x, size_t y, double capacity) {
+    capacity_[x][y] = capacity;
+}
+
+void ElectrostaticDensity::clear_charges() {
+    demand_.fill(0.);
+}
+
+void ElectrostaticDensity::add_charge(double x, double y, double charge) {
+    t_interp ix = interp_bins(x, width_);
+    t_interp iy = interp_bins(y, height_);
+    demand_[ix.x0][iy.x0] += charge * (1. - ix.frac) * (1. - iy.frac);
+    demand_[ix.x1][iy.x0] += charge * ix.frac * (1. - iy.frac);
+    demand_[ix.x0][iy.x1] += charge * (1. - ix.frac) * iy.frac;
+    demand_[ix.x1][iy.x1] += charge * ix.frac * iy.frac;
+}
+
+void ElectrostaticDensity::solve() {
+    double total_demand = 0.;
+    double total_capacity = 0.;
+    for (size_t x = 0; x < width_; ++x) {
+        for (size_t y = 0; y < height_; ++y) {
+            total_demand += demand_[x][y];
+            total_capacity += capacity_[x][y];
+        }
+    }
+    double background_scale = (total_capacity > 0.) ? total_demand / total_capacity : 0.;
+
+    //Cosine coefficients of the net charge density: first along y...
+    vtr::Matrix<double> partial({width_, height_}, 0.);
+    vtr::parallel_for(0, width_, [&](size_t x) {
+        for (size_t v = 0; v < height_; ++v) {
+            double sum = 0.;
+            for (size_t y = 0; y < height_; ++y) {
+                sum += (demand_[x][y] - background_scale * capacity_[x][y]) * cos_y_[v][y];
+            }
+            partial[x][v] = sum;
+        }
+    });
+
+    //...then along x, giving the coefficients of the field in both directions. The potential of
+    //cos(w_u x) cos(w_v y) is that term divided by (w_u^2 + w_v^2), and the field is minus its gradient
+    vtr::Matrix<double> coeff_x({width_, height_}, 0.);
+    vtr::Matrix<double> coeff_y({width_, height_}, 0.);
+    vtr::parallel_for(0, width_, [&](size_t u) {
+        for (size_t v = 0; v < height_; ++v) {
+            if (u == 0 && v == 0) continue; //The net charge is 0
+
+            double sum = 0.;
+            for (size_t x = 0; x < width_; ++x) {
+                sum += cos_x_[u][x] * partial[x][v];
+            }
+            double norm = ((u == 0) ? 1. : 2.) * ((v == 0) ? 1. : 2.) / double(width_ * height_);
+            double coeff = norm * sum / (freq_x_[u] * freq_x_[u] + freq_y_[v] * freq_y_[v]);
+            coeff_x[u][v] = coeff * freq_x_[u];
+            coeff_y[u][v] = coeff * freq_y_[v];
+        }
+    });
+
+    //Evaluate the fields at the bin centers: E_x = sum coeff_x sin(w_u x) cos(w_v y), and
+    //E_y = sum coeff_y cos(w_u x) sin(w_v y)
+    vtr::Matrix<double> partial_x({width_, height_}, 0.);
+    vtr::Matrix<double> partial_y({width_, height_}, 0.);
+    vtr::parallel_for(0, width_, [&](size_t u) {
+        for (size_t y = 0; y < height_; ++y) {
+            double sum_x = 0.;
+            double sum_y = 0.;
+            for (size_t v = 0; v < height_; ++v) {
+                sum_x += coeff_x[u][v] * cos_y_[v][y];
+                sum_y += coeff_y[u][v] * sin_y_[v][y];
+            }
+            partial_x[u][y] = sum_x;
+            partial_y[u][y] = sum_y;
+        }
+    });
+    vtr::parallel_for(0, width_, [&](size_t x) {
+        for (size_t y = 0; y < height_; ++y) {
+            double sum_x = 0.;
+            double sum_y = 0.;
+            for (size_t u = 0; u < width_; ++u) {
+                sum_x += sin_x_[u][x] * partial_x[u][y];
+                sum_y += cos_x_[u][x] * partial_y[u][y];
+            }
+            field_x_[x][y] = sum_x;
+            field_y_[x][y] = sum_y;
+        }
+    });
+}
+
+double ElectrostaticDensity::overflow() const {
+    double total_demand = 0.;
+    double total_overflow = 0.;
+    for (size_t x = 0; x < width_; ++x) {
+        for (size_t y = 0; y < height_; ++y) {
+            total_demand += demand_[x][y];
+            total_overflow += std::max(0., demand_[x][y] - capacity_[x][y]);
+        }
+    }
+    return vtr::safe_ratio(total_overflow, total_demand);
+}
+
+double ElectrostaticDensity::field_x(double x, double y) const {
+    return interpolate(field_x_, x, y);
+}
+
+double ElectrostaticDensity::field_y(double x, double y) const {
+    return interpolate(field_y_, x, y);
+}
+
+double ElectrostaticDensity::interpolate(const vtr::Matrix<double>& values, double x, double y) const {
+    t_interp ix = interp_bins(x, width_);
+    t_interp iy = interp_bins(y, height_);
+    return values[ix.x0][iy.x0] * (1. - ix.frac) * (1. - iy.frac)
+           + values[ix.x1][iy.x0] * ix.frac * (1. - iy.frac)
+           + values[ix.x0][iy.x1] * (1. - ix.frac) * iy.frac
+           + values[ix.x1][iy.x1] * ix.frac * iy.frac;
+}
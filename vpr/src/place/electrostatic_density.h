@@ -0,0 +1,96 @@
+#ifndef VPR_ELECTROSTATIC_DENSITY_H
+#define VPR_ELECTROSTATIC_DENSITY_H
+
+/**
+ * @file
+ * @brief The electrostatic density model of the ePlace global placer (used by the electrostatic
+ *        engine of the analytic placer, @see analytic_placer.h)
+ *
+ * Blocks are modelled as positive charges, and the placement capacity as a uniform negative
+ * background charge matching the total block charge. The density penalty is the potential energy
+ * of this charge distribution, whose gradient w.r.t. a block location is minus its charge times
+ * the electric field there: the field pushes the blocks out of the over-utilized regions, towards
+ * the under-utilized ones.
+ *
+ * The bins are the grid tiles: bin (x, y) covers [x - 0.5, x + 0.5] x [y - 0.5, y + 0.5], like a
+ * block of unit size placed at (x, y). The potential is found by solving Poisson's equation with
+ * Neumann boundary conditions (no field leaves the device) spectrally: the charge density is
+ * expanded in cosines, whose potential and field are known in closed form.
+ *
+ * The cosine transforms are computed as separable sums over precomputed tables, which costs
+ * O(W * H * (W + H)) per solve on a W x H grid; the rows (and columns) are transformed in parallel.
+ *
+ * @cite ePlace
+ * ePlace: Electrostatics Based Placement Using Fast Fourier Transform and Nesterov's Method,
+ * Jingwei Lu, Pengwen Chen, Chin-Chih Chang, Lu Sha, Dennis Jen-Hsin Huang, Chin-Chi Teng and Chung-Kuan Cheng
+ */
+
+#include <vector>
+
+#include "vtr_ndmatrix.h"
+
+class ElectrostaticDensity {
+  public:
+    ElectrostaticDensity(size_t width, size_t height);
+
+    size_t width() const { return width_; }
+    size_t height() const { return height_; }
+
+    ///@brief Sets the number of blocks bin (x, y) can hold
+    void set_capacity(size_t x, size_t y, double capacity);
+
+    ///@brief Removes all the charges
+    void clear_charges();
+
+    /**
+     * @brief Adds a block of the given charge (area) at (x, y)
+     *
+     * The block (a unit square centered on (x, y)) overlaps up to 4 bins, whose overlap areas are
+     * the bilinear interpolation weights of (x, y). Locations are clamped to the grid.
+     */
+    void add_charge(double x, double y, double charge);
+
+    /**
+     * @brief Computes the electric field of the current charges
+     *
+     * The background charge of each bin is its capacity scaled to the total block charge, so
+     * heterogeneous devices attract each block type to the tiles which can hold it.
+     */
+    void solve();
+
+    /**
+     * @brief Returns the charge overflow: the fraction of the block charge in excess of the
+     *        bin capacities (0 when no bin is over-utilized)
+     */
+    double overflow() const;
+
+    /**
+     * @brief Returns the (interpolated) electric field at (x, y), found by the last solve()
+     *
+     * This is minus the gradient of the density penalty w.r.t. the location of a unit charge.
+     */
+    double field_x(double x, double y) const;
+    double field_y(double x, double y) const;
+
+  private:
+    double interpolate(const vtr::Matrix<double>& values, double x, double y) const;
+
+    size_t width_;
+    size_t height_;
+
+    vtr::Matrix<double> capacity_; ///<[x][y] the number of blocks bin (x, y) can hold
+    vtr::Matrix<double> demand_;   ///<[x][y] the block charge in bin (x, y)
+    vtr::Matrix<double> field_x_;  ///<[x][y] the electric field at the center of bin (x, y)
+    vtr::Matrix<double> field_y_;
+
+    //Cosine transform tables: cos(w_u * (x + 0.5)) and sin(w_u * (x + 0.5)) with w_u = pi * u / width,
+    //indexed [u][x] (and similarly in y with height)
+    vtr::Matrix<double> cos_x_;
+    vtr::Matrix<double> sin_x_;
+    vtr::Matrix<double> cos_y_;
+    vtr::Matrix<double> sin_y_;
+    std::vector<double> freq_x_; ///<[u] w_u
+    std::vector<double> freq_y_; ///<[v] w_v
+};
+
+#endif
@@ -15,6 +15,9 @@
 
 #include "echo_files.h"
 
+#include "vtr_ndmatrix.h"
+
+#include <algorithm>
 #include <chrono>
 #include <time.h>
 
@@ -73,10 +76,11 @@ static bool try_place_macro(t_pl_macro pl_macro, t_pl_loc head_pos);
  *   @param pad_loc_type Used to check whether an io block needs to be marked as fixed.
  *   @param blk_types_empty_locs_in_grid First location (lowest y) and number of remaining blocks in each column for the blk_id type.
  *   @param block_scores The block_scores (ranking of what to place next) for unplaced blocks connected to this macro should be updated.
+ *   @param exhaustive_search_index Where exhaustive searches resume, NULL to always search whole regions.
  * 
  * @return true if macro was placed, false if not.
  */
-static bool place_macro(int macros_max_num_tries, t_pl_macro pl_macro, enum e_pad_loc_type pad_loc_type, std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid, vtr::vector<ClusterBlockId, t_block_score>& block_scores);
+static bool place_macro(int macros_max_num_tries, t_pl_macro pl_macro, enum e_pad_loc_type pad_loc_type, std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid, vtr::vector<ClusterBlockId, t_block_score>& block_scores, t_exhaustive_search_index* exhaustive_search_index);
 
 /*
  * Assign scores to each block based on macro size and floorplanning constraints.
@@ -203,10 +207,11 @@ static bool try_random_placement(t_pl_macro pl_macro, PartitionRegion& pr, t_log
  *   constrained.
  *   @param block_type Logical block type of the macro blocks.
  *   @param pad_loc_type Used to check whether an io block needs to be marked as fixed.
+ *   @param exhaustive_search_index Where the search resumes in each region, updated by the search. NULL to search whole regions.
  *
  * @return true if the macro gets placed, false if not.
  */
-static bool try_exhaustive_placement(t_pl_macro pl_macro, PartitionRegion& pr, t_logical_block_type_ptr block_type, enum e_pad_loc_type pad_loc_type);
+static bool try_exhaustive_placement(t_pl_macro pl_macro, PartitionRegion& pr, t_logical_block_type_ptr block_type, enum e_pad_loc_type pad_loc_type, t_exhaustive_search_index* exhaustive_search_index);
 
 /**
  * @brief Looks for a valid placement location for macro in second iteration, tries to place as many macros as possible in one column 
@@ -228,8 +233,31 @@ static bool try_dense_placement(t_pl_macro pl_macro, PartitionRegion& pr, t_logi
  *   
  *   @param pad_loc_type Used to check whether an io block needs to be marked as fixed.
  *   @param constraints_file Used to read block locations if any constraints is available.
+ *   @param eco_block_locs The previous locations of the blocks for an ECO placement (empty otherwise).
+ */
+static void place_all_blocks(const t_placer_opts& placer_opts, vtr::vector<ClusterBlockId, t_block_score>& block_scores, enum e_pad_loc_type pad_loc_type, const char* constraints_file, const vtr::vector_map<ClusterBlockId, t_pl_loc>& eco_block_locs);
+
+/**
+ * @brief Checks that a block can be placed back at its previous (ECO) location:
+ * a legal, compatible sub tile at the root of its tile and within the block's floorplan region.
  */
-static void place_all_blocks(const t_placer_opts& placer_opts, vtr::vector<ClusterBlockId, t_block_score>& block_scores, enum e_pad_loc_type pad_loc_type, const char* constraints_file);
+static bool is_eco_loc_legal(ClusterBlockId blk_id, const t_pl_loc& loc);
+
+/**
+ * @brief Places the blocks whose previous (ECO) location is still legal and free back at that location
+ *
+ * A macro is only placed back if all its members were previously placed with the offsets of the macro.
+ * The other blocks (new, changed or displaced ones) are left to the normal initial placement.
+ */
+static void place_eco_blocks(const vtr::vector_map<ClusterBlockId, t_pl_loc>& eco_block_locs);
+
+/**
+ * @brief Fixes the blocks placed back at their ECO location which are farther than eco_place_region tiles
+ * from every block placed anew, so the annealer only optimizes around the netlist changes.
+ *
+ * A macro is only fixed if all its members are.
+ */
+static void fix_distant_eco_blocks(const vtr::vector_map<ClusterBlockId, t_pl_loc>& eco_block_locs, int eco_place_region);
 
 /**
  * @brief If any blocks remain unplaced after all initial placement iterations, this routine
@@ -265,12 +293,145 @@ static bool is_block_placed(ClusterBlockId blk_id) {
     return (!(place_ctx.block_locs[blk_id].loc.x == INVALID_X));
 }
 
+static bool is_eco_loc_legal(ClusterBlockId blk_id, const t_pl_loc& loc) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    const auto& grid = g_vpr_ctx.device().grid;
+
+    t_physical_tile_loc tile_loc(loc.x, loc.y, loc.layer);
+    if (!is_loc_on_chip(tile_loc)) {
+        return false;
+    }
+
+    //Blocks are placed at the root of their (possibly multi-grid-location) tile
+    if (grid.get_width_offset(tile_loc) != 0 || grid.get_height_offset(tile_loc) != 0) {
+        return false;
+    }
+
+    auto physical_tile = grid.get_physical_type(tile_loc);
+    if (loc.sub_tile < 0 || loc.sub_tile >= physical_tile->capacity) {
+        return false;
+    }
+
+    return is_sub_tile_compatible(physical_tile, cluster_ctx.clb_nlist.block_type(blk_id), loc.sub_tile)
+           && cluster_floorplanning_legal(blk_id, loc);
+}
+
+static void place_eco_blocks(const vtr::vector_map<ClusterBlockId, t_pl_loc>& eco_block_locs) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    auto place_eco_macro = [&](const t_pl_macro& pl_macro) {
+        ClusterBlockId head_blk = pl_macro.members[0].blk_index;
+        if (is_block_placed(head_blk)) {
+            return; //Already placed (e.g. by the constraints file, or in a previous initial placement iteration)
+        }
+
+        const t_pl_loc& head_pos = eco_block_locs[head_blk];
+        for (const t_pl_macro_member& member : pl_macro.members) {
+            const t_pl_loc& member_pos = eco_block_locs[member.blk_index];
+            if (member_pos.x == OPEN || !(member_pos == head_pos + member.offset) || !is_eco_loc_legal(member.blk_index, member_pos)) {
+                return;
+            }
+        }
+
+        try_place_macro(pl_macro, head_pos);
+    };
+
+    for (const t_pl_macro& pl_macro : place_ctx.pl_macros) {
+        place_eco_macro(pl_macro);
+    }
+
+    for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+        int imacro;
+        get_imacro_from_iblk(&imacro, blk_id, place_ctx.pl_macros);
+        if (imacro != -1) {
+            continue;
+        }
+
+        t_pl_macro pl_macro;
+        t_pl_macro_member macro_member;
+        macro_member.blk_index = blk_id;
+        macro_member.offset = t_pl_offset(0, 0, 0, 0);
+        pl_macro.members.push_back(macro_member);
+        place_eco_macro(pl_macro);
+    }
+}
+
+static void fix_distant_eco_blocks(const vtr::vector_map<ClusterBlockId, t_pl_loc>& eco_block_locs, int eco_place_region) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+    const auto& grid = g_vpr_ctx.device().grid;
+
+    int width = grid.width();
+    int height = grid.height();
+
+    //Prefix sums of the number of blocks placed anew at each grid location, so the number of
+    //them within eco_place_region of a kept block is found in constant time (regardless of the region size)
+    vtr::NdMatrix<int, 2> num_new_blocks_below({size_t(width) + 1, size_t(height) + 1}, 0);
+    size_t num_new_blocks = 0;
+    for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+        const t_pl_loc& loc = place_ctx.block_locs[blk_id].loc;
+        if (!(loc == eco_block_locs[blk_id])) {
+            num_new_blocks_below[loc.x + 1][loc.y + 1]++;
+            ++num_new_blocks;
+        }
+    }
+    for (int x = 1; x <= width; ++x) {
+        for (int y = 1; y <= height; ++y) {
+            num_new_blocks_below[x][y] += num_new_blocks_below[x - 1][y] + num_new_blocks_below[x][y - 1] - num_new_blocks_below[x - 1][y - 1];
+        }
+    }
+
+    vtr::vector<ClusterBlockId, bool> fix_block(cluster_ctx.clb_nlist.blocks().size(), false);
+    for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+        const t_pl_loc& loc = place_ctx.block_locs[blk_id].loc;
+        if (place_ctx.block_locs[blk_id].is_fixed || !(loc == eco_block_locs[blk_id])) {
+            continue;
+        }
+
+        int xlow = std::max(loc.x - eco_place_region, 0);
+        int ylow = std::max(loc.y - eco_place_region, 0);
+        int xhigh = std::min(loc.x + eco_place_region, width - 1) + 1;
+        int yhigh = std::min(loc.y + eco_place_region, height - 1) + 1;
+        int num_near_new_blocks = num_new_blocks_below[xhigh][yhigh] - num_new_blocks_below[xlow][yhigh]
+                                  - num_new_blocks_below[xhigh][ylow] + num_new_blocks_below[xlow][ylow];
+        fix_block[blk_id] = (num_near_new_blocks == 0);
+    }
+
+    //Macros move as a unit, so they stay movable if any of their members is near a new block
+    for (const t_pl_macro& pl_macro : place_ctx.pl_macros) {
+        bool fix_macro = std::all_of(pl_macro.members.begin(), pl_macro.members.end(), [&](const t_pl_macro_member& member) {
+            return fix_block[member.blk_index];
+        });
+        if (!fix_macro) {
+            for (const t_pl_macro_member& member : pl_macro.members) {
+                fix_block[member.blk_index] = false;
+            }
+        }
+    }
+
+    size_t num_kept_blocks = 0;
+    size_t num_fixed_blocks = 0;
+    for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+        if (place_ctx.block_locs[blk_id].loc == eco_block_locs[blk_id]) {
+            ++num_kept_blocks;
+        }
+        if (fix_block[blk_id]) {
+            place_ctx.block_locs[blk_id].is_fixed = true;
+            ++num_fixed_blocks;
+        }
+    }
+
+    VTR_LOG("ECO placement: %zu blocks placed anew, %zu blocks kept at their previous location (%zu of them fixed, farther than %d tiles from the new blocks)\n",
+            num_new_blocks, num_kept_blocks, num_fixed_blocks, eco_place_region);
+}
+
 static bool is_loc_legal(t_pl_loc& loc, PartitionRegion& pr, t_logical_block_type_ptr block_type) {
     const auto& grid = g_vpr_ctx.device().grid;
     bool legal = false;
 
     //Check if the location is within its constraint region
-    for (auto reg : pr.get_partition_region()) {
+    for (const auto& reg : pr.get_partition_region()) {
         const auto reg_coord = reg.get_region_rect();
         vtr::Rect<int> reg_rect(reg_coord.xmin, reg_coord.ymin, reg_coord.xmax, reg_coord.ymax);
         if (reg_coord.layer_num != loc.layer) continue;
@@ -613,7 +774,7 @@ static bool try_random_placement(t_pl_macro pl_macro, PartitionRegion& pr, t_log
 
     //If the block has more than one floorplan region, pick a random region to get the min/max x and y values
     int region_index;
-    std::vector<Region> regions = pr.get_partition_region();
+    const std::vector<Region>& regions = pr.get_partition_region();
     if (regions.size() > 1) {
         region_index = vtr::irand(regions.size() - 1);
     } else {
@@ -665,11 +826,11 @@ static bool try_random_placement(t_pl_macro pl_macro, PartitionRegion& pr, t_log
     return legal;
 }
 
-static bool try_exhaustive_placement(t_pl_macro pl_macro, PartitionRegion& pr, t_logical_block_type_ptr block_type, enum e_pad_loc_type pad_loc_type) {
+static bool try_exhaustive_placement(t_pl_macro pl_macro, PartitionRegion& pr, t_logical_block_type_ptr block_type, enum e_pad_loc_type pad_loc_type, t_exhaustive_search_index* exhaustive_search_index) {
     const auto& compressed_block_grid = g_vpr_ctx.placement().compressed_block_grids[block_type->index];
     auto& place_ctx = g_vpr_ctx.mutable_placement();
 
-    std::vector<Region> regions = pr.get_partition_region();
+    const std::vector<Region>& regions = pr.get_partition_region();
 
     bool placed = false;
 
@@ -688,7 +849,17 @@ static bool try_exhaustive_placement(t_pl_macro pl_macro, PartitionRegion& pr, t
             continue;
         }
 
-        for (int cx = min_cx; cx <= max_cx && placed == false; cx++) {
+        //Skip the positions a previous search of this region found fully occupied
+        std::pair<int, int> start_pos(min_cx, 0);
+        std::pair<int, int>* resume_pos = nullptr;
+        if (exhaustive_search_index) {
+            auto key = std::make_tuple(block_type->index, layer_num, min_cx, max_cx, regions[reg].get_sub_tile());
+            resume_pos = &exhaustive_search_index->emplace(key, start_pos).first->second;
+            start_pos = *resume_pos;
+        }
+        bool found_free_pos = false;
+
+        for (int cx = start_pos.first; cx <= max_cx && placed == false; cx++) {
             const auto& block_rows = compressed_block_grid.get_column_block_map(cx, layer_num);
             auto y_lower_iter = block_rows.begin();
             auto y_upper_iter = block_rows.end();
@@ -697,7 +868,7 @@ static bool try_exhaustive_placement(t_pl_macro pl_macro, PartitionRegion& pr, t
 
             VTR_ASSERT(y_range >= 0);
 
-            for (int dy = 0; dy < y_range && placed == false; dy++) {
+            for (int dy = (cx == start_pos.first) ? start_pos.second : 0; dy < y_range && placed == false; dy++) {
                 int cy = (y_lower_iter + dy)->first;
 
                 auto grid_loc = compressed_block_grid.compressed_loc_to_grid_loc({cx, cy, layer_num});
@@ -713,6 +884,7 @@ static bool try_exhaustive_placement(t_pl_macro pl_macro, PartitionRegion& pr, t
 
                     to_loc.sub_tile = subtile;
                     if (place_ctx.grid_blocks.block_at_location(to_loc) == EMPTY_BLOCK_ID) {
+                        found_free_pos = true;
                         placed = try_place_macro(pl_macro, to_loc);
 
                         if (placed) {
@@ -728,6 +900,7 @@ static bool try_exhaustive_placement(t_pl_macro pl_macro, PartitionRegion& pr, t
                             for (int st = st_low; st <= st_high && placed == false; st++) {
                                 to_loc.sub_tile = st;
                                 if (place_ctx.grid_blocks.block_at_location(to_loc) == EMPTY_BLOCK_ID) {
+                                    found_free_pos = true;
                                     placed = try_place_macro(pl_macro, to_loc);
                                     if (placed) {
                                         fix_IO_block_types(pl_macro, to_loc, pad_loc_type);
@@ -741,6 +914,11 @@ static bool try_exhaustive_placement(t_pl_macro pl_macro, PartitionRegion& pr, t
                         }
                     }
                 }
+
+                //All positions up to the first with a free head sub-tile stay occupied
+                if (resume_pos && !found_free_pos) {
+                    *resume_pos = (dy + 1 < y_range) ? std::make_pair(cx, dy + 1) : std::make_pair(cx + 1, 0);
+                }
             }
         }
     }
@@ -812,7 +990,7 @@ static bool try_place_macro(t_pl_macro pl_macro, t_pl_loc head_pos) {
     return (macro_placed);
 }
 
-static bool place_macro(int macros_max_num_tries, t_pl_macro pl_macro, enum e_pad_loc_type pad_loc_type, std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid, vtr::vector<ClusterBlockId, t_block_score>& block_scores) {
+static bool place_macro(int macros_max_num_tries, t_pl_macro pl_macro, enum e_pad_loc_type pad_loc_type, std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid, vtr::vector<ClusterBlockId, t_block_score>& block_scores, t_exhaustive_search_index* exhaustive_search_index) {
     ClusterBlockId blk_id;
     blk_id = pl_macro.members[0].blk_index;
     VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\t\tHead of the macro is Block %d\n", size_t(blk_id));
@@ -877,7 +1055,7 @@ static bool place_macro(int macros_max_num_tries, t_pl_macro pl_macro, enum e_pa
 
         // Exhaustive placement of carry macros
         VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\t\t\tTry exhaustive placement\n");
-        macro_placed = try_exhaustive_placement(pl_macro, pr, block_type, pad_loc_type);
+        macro_placed = try_exhaustive_placement(pl_macro, pr, block_type, pad_loc_type, exhaustive_search_index);
     }
     return macro_placed;
 }
@@ -909,7 +1087,7 @@ static vtr::vector<ClusterBlockId, t_block_score> assign_block_scores() {
     for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
         block_scores[blk_id].number_of_placed_connections = 0;
         if (is_cluster_constrained(blk_id)) {
-            PartitionRegion pr = floorplan_ctx.cluster_constraints[blk_id];
+            const PartitionRegion& pr = floorplan_ctx.cluster_constraints[blk_id];
             auto block_type = cluster_ctx.clb_nlist.block_type(blk_id);
             double floorplan_score = get_floorplan_score(blk_id, pr, block_type, grid_tiles);
             block_scores[blk_id].tiles_outside_of_floorplan_constraints = floorplan_score;
@@ -928,9 +1106,9 @@ static vtr::vector<ClusterBlockId, t_block_score> assign_block_scores() {
 }
 
 #ifdef VTR_ENABLE_DEBUG_LOGGING
-static void place_all_blocks(const t_placer_opts& placer_opts, vtr::vector<ClusterBlockId, t_block_score>& block_scores, enum e_pad_loc_type pad_loc_type, const char* constraints_file) {
+static void place_all_blocks(const t_placer_opts& placer_opts, vtr::vector<ClusterBlockId, t_block_score>& block_scores, enum e_pad_loc_type pad_loc_type, const char* constraints_file, const vtr::vector_map<ClusterBlockId, t_pl_loc>& eco_block_locs) {
 #else
-static void place_all_blocks(const t_placer_opts& /* placer_opts */, vtr::vector<ClusterBlockId, t_block_score>& block_scores, enum e_pad_loc_type pad_loc_type, const char* constraints_file) {
+static void place_all_blocks(const t_placer_opts& /* placer_opts */, vtr::vector<ClusterBlockId, t_block_score>& block_scores, enum e_pad_loc_type pad_loc_type, const char* constraints_file, const vtr::vector_map<ClusterBlockId, t_pl_loc>& eco_block_locs) {
 #endif
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.placement();
@@ -952,16 +1130,25 @@ static void place_all_blocks(const t_placer_opts& /* placer_opts */, vtr::vector
     //[0..device_ctx.logical_block_types.size()-1][0..num_of_grid_columns_containing_this_block_type-1]
     std::vector<std::vector<t_grid_empty_locs_block_type>> blk_types_empty_locs_in_grid;
 
+    // Where the exhaustive searches resume, only valid while no placed block is removed
+    t_exhaustive_search_index exhaustive_search_index;
+
     for (auto iter_no = 0; iter_no < MAX_INIT_PLACE_ATTEMPTS; iter_no++) {
         //clear grid for a new placement iteration
         clear_block_type_grid_locs(unplaced_blk_type_in_curr_itr);
         unplaced_blk_type_in_curr_itr.clear();
+        exhaustive_search_index.clear();
 
         //Check whether the constraint file is NULL, if not, read in the block locations from the constraints file here
         if (strlen(constraints_file) != 0) {
             read_constraints(constraints_file);
         }
 
+        //Place the unchanged blocks of an ECO placement back where they were (if still legal)
+        if (!eco_block_locs.empty()) {
+            place_eco_blocks(eco_block_locs);
+        }
+
         //resize the vector to store unplaced block types empty locations
         blk_types_empty_locs_in_grid.resize(device_ctx.logical_block_types.size());
 
@@ -989,7 +1176,7 @@ static void place_all_blocks(const t_placer_opts& /* placer_opts */, vtr::vector
 
             blocks_placed_since_heap_update++;
 
-            bool block_placed = place_one_block(blk_id, pad_loc_type, &blk_types_empty_locs_in_grid[blk_id_type->index], &block_scores);
+            bool block_placed = place_one_block(blk_id, pad_loc_type, &blk_types_empty_locs_in_grid[blk_id_type->index], &block_scores, &exhaustive_search_index);
 
             //update heap based on update_heap_freq calculated above
             if (blocks_placed_since_heap_update % (update_heap_freq) == 0) {
@@ -1074,7 +1261,8 @@ static void clear_block_type_grid_locs(std::unordered_set<int> unplaced_blk_type
 bool place_one_block(const ClusterBlockId& blk_id,
                      enum e_pad_loc_type pad_loc_type,
                      std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid,
-                     vtr::vector<ClusterBlockId, t_block_score>* block_scores) {
+                     vtr::vector<ClusterBlockId, t_block_score>* block_scores,
+                     t_exhaustive_search_index* exhaustive_search_index) {
     auto& place_ctx = g_vpr_ctx.placement();
 
     //Check if block has already been placed
@@ -1092,7 +1280,7 @@ bool place_one_block(const ClusterBlockId& blk_id,
     if (imacro != -1) { //If the block belongs to a macro, pass that macro to the placement routines
         VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\tBelongs to a macro %d\n", imacro);
         pl_macro = place_ctx.pl_macros[imacro];
-        placed_macro = place_macro(MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY, pl_macro, pad_loc_type, blk_types_empty_locs_in_grid, (*block_scores));
+        placed_macro = place_macro(MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY, pl_macro, pad_loc_type, blk_types_empty_locs_in_grid, (*block_scores), exhaustive_search_index);
     } else {
         //If it does not belong to a macro, create a macro with the one block and then pass to the placement routines
         //This is done so that the initial placement flow can be the same whether the block belongs to a macro or not
@@ -1102,7 +1290,7 @@ bool place_one_block(const ClusterBlockId& blk_id,
         macro_member.blk_index = blk_id;
         macro_member.offset = block_offset;
         pl_macro.members.push_back(macro_member);
-        placed_macro = place_macro(MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY, pl_macro, pad_loc_type, blk_types_empty_locs_in_grid, (*block_scores));
+        placed_macro = place_macro(MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY, pl_macro, pad_loc_type, blk_types_empty_locs_in_grid, (*block_scores), exhaustive_search_index);
     }
 
     return placed_macro;
@@ -1119,6 +1307,9 @@ void initial_placement(const t_placer_opts& placer_opts,
      */
     propagate_place_constraints();
 
+    //Cache the locations within the (now final) floorplan region of each constrained block for the move generators
+    load_block_region_locs();
+
     /*Mark the blocks that have already been locked to one spot via floorplan constraints
      * as fixed so they do not get moved during initial placement or later during the simulated annealing stage of placement*/
     mark_fixed_blocks();
@@ -1126,12 +1317,24 @@ void initial_placement(const t_placer_opts& placer_opts,
     //Assign scores to blocks and placement macros according to how difficult they are to place
     vtr::vector<ClusterBlockId, t_block_score> block_scores = assign_block_scores();
 
+    //Read the previous block locations of an ECO placement
+    vtr::vector_map<ClusterBlockId, t_pl_loc> eco_block_locs;
+    if (!placer_opts.eco_place_file.empty()) {
+        //The packed netlist is named after its .net file
+        eco_block_locs = read_eco_place(g_vpr_ctx.clustering().clb_nlist.netlist_name().c_str(), placer_opts.eco_place_file.c_str(), g_vpr_ctx.device().grid);
+    }
+
     //Place all blocks
-    place_all_blocks(placer_opts, block_scores, pad_loc_type, constraints_file);
+    place_all_blocks(placer_opts, block_scores, pad_loc_type, constraints_file, eco_block_locs);
 
     //if any blocks remain unplaced, print an error
     check_initial_placement_legality();
 
+    //Only anneal the neighbourhood of the netlist changes of an ECO placement
+    if (!eco_block_locs.empty()) {
+        fix_distant_eco_blocks(eco_block_locs, placer_opts.eco_place_region);
+    }
+
     // route all the traffic flows in the NoC now that all the router cluster block have been placed  (this is done only if the noc optimization is enabled by the user)
     if (noc_enabled) {
         initial_noc_routing();
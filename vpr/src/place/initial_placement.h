@@ -1,6 +1,9 @@
 #ifndef VPR_INITIAL_PLACEMENT_H
 #define VPR_INITIAL_PLACEMENT_H
 
+#include <map>
+#include <tuple>
+
 #include "vpr_types.h"
 
 /**
@@ -38,6 +41,21 @@ struct t_grid_empty_locs_block_type {
     int num_of_empty_locs_in_y_axis;
 };
 
+/**
+ * @brief Where the exhaustive search for a macro location should resume in a region, for each block type.
+ *
+ * The exhaustive search visits the locations of a region in a fixed order. While placing all blocks,
+ * placed blocks are not removed, so locations whose head sub-tiles were all found occupied stay occupied:
+ * the next search of the same region resumes at the first (compressed x, row) position that had a free one.
+ * This turns the search of heavily constrained regions, which fill up one macro at a time, from
+ * quadratic to linear in the size of the region.
+ *
+ * Keyed by logical block type index, layer, compressed x range and sub-tile constraint of the region.
+ * Holds the compressed x and the row index (into the compressed column) the search resumes at.
+ * Must be cleared whenever placed blocks are removed from the grid.
+ */
+typedef std::map<std::tuple<int, int, int, int, int>, std::pair<int, int>> t_exhaustive_search_index;
+
 /**
  * @brief Tries to find an initial placement location for each block considering floorplanning constraints
  * and throws an error out if it fails after max number of attempts.
@@ -63,9 +81,10 @@ void initial_placement(const t_placer_opts& placer_opts,
  *   @param blk_id The block that should be placed.
  *   @param pad_loc_type Used to check whether an io block needs to be marked as fixed.
  *   @param blk_types_empty_locs_in_grid First location (lowest y) and number of remaining blocks in each column for the blk_id type
+ *   @param exhaustive_search_index Where exhaustive searches resume, NULL to always search whole regions.
  *   
  * 
  * @return true if the block gets placed, false if not.
  */
-bool place_one_block(const ClusterBlockId& blk_id, enum e_pad_loc_type pad_loc_type, std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid, vtr::vector<ClusterBlockId, t_block_score>* block_scores);
+bool place_one_block(const ClusterBlockId& blk_id, enum e_pad_loc_type pad_loc_type, std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid, vtr::vector<ClusterBlockId, t_block_score>* block_scores, t_exhaustive_search_index* exhaustive_search_index = NULL);
 #endif
@@ -4,6 +4,8 @@
 #include "place_constraints.h"
 #include "placer_globals.h"
 #include "move_utils.h"
+#include "place_util.h"
+#include "net_bb_util.h"
 
 static bool get_bb_incrementally(ClusterNetId net_id, t_bb& bb_coord_new, int xold, int yold, int xnew, int ynew);
 
@@ -74,7 +76,7 @@ e_create_move MedianMoveGenerator::propose_move(t_pl_blocks_to_be_moved& blocks_
             t_bb union_bb;
             const bool& cube_bb = g_vpr_ctx.placement().cube_bb;
             if (!cube_bb) {
-                union_bb = union_2d_bb(place_move_ctx.layer_bb_coords[net_id]);
+                union_bb = union_2d_bb(place_move_ctx.layer_bb_coords[size_t(net_id)]);
             }
 
             const auto& net_bb_coords = cube_bb ? place_move_ctx.bb_coords[net_id] : union_bb;
@@ -187,77 +189,40 @@ e_create_move MedianMoveGenerator::propose_move(t_pl_blocks_to_be_moved& blocks_
 static void get_bb_from_scratch_excluding_block(ClusterNetId net_id, t_bb& bb_coord_new, ClusterBlockId block_id, bool& skip_net) {
     //TODO: account for multiple physical pin instances per logical pin
 
-    skip_net = true;
-
-    int xmin = OPEN;
-    int xmax = OPEN;
-    int ymin = OPEN;
-    int ymax = OPEN;
-
-    int pnum;
-
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
-    auto& device_ctx = g_vpr_ctx.device();
-
-    ClusterBlockId bnum = cluster_ctx.clb_nlist.net_driver_block(net_id);
-    bool first_block = false;
 
-    if (bnum != block_id) {
-        skip_net = false;
-        pnum = net_pin_to_tile_pin_index(net_id, 0);
-        int src_x = place_ctx.block_locs[bnum].loc.x + physical_tile_type(bnum)->pin_width_offset[pnum];
-        int src_y = place_ctx.block_locs[bnum].loc.y + physical_tile_type(bnum)->pin_height_offset[pnum];
+    /* The pin coordinates are clipped to the channels (see                *
+     * load_net_pin_coords()), so their extent is the bounding box.        */
+    static thread_local t_net_pin_coords pin_coords;
+    load_net_pin_coords(net_id, pin_coords);
+    size_t num_pins = pin_coords.size();
 
-        xmin = src_x;
-        ymin = src_y;
-        xmax = src_x;
-        ymax = src_y;
-        first_block = true;
+    //Find the first pin of another block
+    size_t ikept = 0;
+    while (ikept < num_pins && cluster_ctx.clb_nlist.pin_block(cluster_ctx.clb_nlist.net_pin(net_id, ikept)) == block_id) {
+        ++ikept;
     }
 
-    for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
-        bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
-        pnum = tile_pin_index(pin_id);
-        if (bnum == block_id)
-            continue;
-        skip_net = false;
-        const auto& block_loc = place_ctx.block_locs[bnum].loc;
-        int x = block_loc.x + physical_tile_type(bnum)->pin_width_offset[pnum];
-        int y = block_loc.y + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-        if (!first_block) {
-            xmin = x;
-            ymin = y;
-            xmax = x;
-            ymax = y;
-            first_block = true;
-            continue;
-        }
-        if (x < xmin) {
-            xmin = x;
-        } else if (x > xmax) {
-            xmax = x;
-        }
+    skip_net = (ikept == num_pins);
+    if (skip_net) {
+        return;
+    }
 
-        if (y < ymin) {
-            ymin = y;
-        } else if (y > ymax) {
-            ymax = y;
+    //The later pins of the moving block take the location of that pin, so they don't extend the bounding box
+    for (size_t ipin = ikept + 1; ipin < num_pins; ++ipin) {
+        if (cluster_ctx.clb_nlist.pin_block(cluster_ctx.clb_nlist.net_pin(net_id, ipin)) == block_id) {
+            pin_coords.x[ipin] = pin_coords.x[ikept];
+            pin_coords.y[ipin] = pin_coords.y[ikept];
         }
     }
 
-    /* Now I've found the coordinates of the bounding box.  There are no *
-     * channels beyond device_ctx.grid.width()-2 and                     *
-     * device_ctx.grid.height() - 2, so I want to clip to that.  As well,*
-     * since I'll always include the channel immediately below and the   *
-     * channel immediately to the left of the bounding box, I want to    *
-     * clip to 1 in both directions as well (since minimum channel index *
-     * is 0).  See route_common.cpp for a channel diagram.               */
-    bb_coord_new.xmin = std::max(std::min<int>(xmin, device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-    bb_coord_new.ymin = std::max(std::min<int>(ymin, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
-    bb_coord_new.xmax = std::max(std::min<int>(xmax, device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-    bb_coord_new.ymax = std::max(std::min<int>(ymax, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
+    t_coord_extent x_extent = coord_min_max(pin_coords.x.data() + ikept, num_pins - ikept);
+    t_coord_extent y_extent = coord_min_max(pin_coords.y.data() + ikept, num_pins - ikept);
+
+    bb_coord_new.xmin = x_extent.min;
+    bb_coord_new.ymin = y_extent.min;
+    bb_coord_new.xmax = x_extent.max;
+    bb_coord_new.ymax = y_extent.max;
 }
 
 /*
@@ -288,8 +253,8 @@ static bool get_bb_incrementally(ClusterNetId net_id, t_bb& bb_coord_new, int xo
     t_bb union_bb;
     const bool& cube_bb = g_vpr_ctx.placement().cube_bb;
     if (!cube_bb) {
-        std::tie(union_bb_edge, union_bb) = union_2d_bb_incr(place_move_ctx.layer_bb_num_on_edges[net_id],
-                                                             place_move_ctx.layer_bb_coords[net_id]);
+        std::tie(union_bb_edge, union_bb) = union_2d_bb_incr(place_move_ctx.layer_bb_num_on_edges[size_t(net_id)],
+                                                             place_move_ctx.layer_bb_coords[size_t(net_id)]);
     }
 
     /* In this move, we use a 3D bounding box. Thus, if per-layer BB is used by placer, we need to take a union of BBs and use that for the rest of
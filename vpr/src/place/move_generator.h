@@ -26,12 +26,16 @@ struct MoveOutcomeStats {
  * blk_type_moves: the block type index of each proposed move (e.g. [0..NUM_PL_MOVE_TYPES * (agent_available_types.size()-1)])
  * accepted_moves: the number of accepted moves of each move and block type (e.g. [0..NUM_PL_MOVE_TYPES * (agent_available_types.size()-1)] )
  * rejected_moves: the number of rejected moves of each move and block type (e.g. [0..NUM_PL_MOVE_TYPES * (agent_available_types.size()-1)] )
+ * propose_time: the time (in seconds) spent proposing the moves of each move and block type
+ * evaluate_time: the time (in seconds) spent evaluating, then committing or reverting, the moves of each move and block type
  *
  */
 struct MoveTypeStat {
     std::vector<int> blk_type_moves;
     std::vector<int> accepted_moves;
     std::vector<int> rejected_moves;
+    std::vector<double> propose_time;
+    std::vector<double> evaluate_time;
 };
 
 /**
@@ -70,6 +74,21 @@ class MoveGenerator {
      *  @param reward_fun: the name of the reward function used
      */
     virtual void process_outcome(double /*reward*/, e_reward_function /*reward_fun*/) {}
+
+    /**
+     * @brief Appends what the move generator has learned so far (e.g. the RL agent estimates) to state
+     *
+     * This is saved in the on-disk placement checkpoints, see write_anneal_checkpoint()
+     */
+    virtual void save_state(std::vector<double>& /*state*/) const {}
+
+    /**
+     * @brief Restores the state appended by save_state()
+     *
+     *  @param state: the saved state, starting at state[istate]
+     *  @param istate: advanced past the restored state
+     */
+    virtual void restore_state(const std::vector<double>& /*state*/, size_t& /*istate*/) {}
 };
 
 #endif
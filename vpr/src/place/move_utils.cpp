@@ -1,5 +1,7 @@
 #include "move_utils.h"
 
+#include <mutex>
+
 #include "place_util.h"
 #include "globals.h"
 
@@ -17,8 +19,11 @@ bool f_placer_breakpoint_reached = false;
 
 //Records counts of reasons for aborted moves
 static std::map<std::string, size_t> f_move_abort_reasons;
+//Moves may be proposed concurrently by the parallel annealer
+static std::mutex f_move_abort_reasons_mutex;
 
 void log_move_abort(const std::string& reason) {
+    std::lock_guard<std::mutex> lock(f_move_abort_reasons_mutex);
     ++f_move_abort_reasons[reason];
 }
 
@@ -772,25 +777,15 @@ bool find_to_loc_uniform(t_logical_block_type_ptr type,
     t_physical_tile_loc to_compressed_loc;
     bool legal = false;
 
-    //TODO: constraints should be adapted to 3D architecture
-    if (is_cluster_constrained(b_from)) {
-        bool intersect = intersect_range_limit_with_floorplan_constraints(type,
-                                                                          b_from,
-                                                                          search_range,
-                                                                          delta_cx,
-                                                                          to_layer_num);
-        if (!intersect) {
-            return false;
-        }
-    }
     //TODO: For now, we only move the blocks on the same tile
-    legal = find_compatible_compressed_loc_in_range(type,
-                                                    delta_cx,
-                                                    compressed_locs[to_layer_num],
-                                                    search_range,
-                                                    to_compressed_loc,
-                                                    false,
-                                                    to_layer_num);
+    legal = find_compatible_compressed_loc_for_block(type,
+                                                     b_from,
+                                                     delta_cx,
+                                                     compressed_locs[to_layer_num],
+                                                     search_range,
+                                                     to_compressed_loc,
+                                                     false,
+                                                     to_layer_num);
 
     if (!legal) {
         //No valid position found
@@ -870,24 +865,14 @@ bool find_to_loc_median(t_logical_block_type_ptr blk_type,
     t_physical_tile_loc to_compressed_loc;
     bool legal = false;
 
-    if (is_cluster_constrained(b_from)) {
-        bool intersect = intersect_range_limit_with_floorplan_constraints(blk_type,
-                                                                          b_from,
-                                                                          search_range,
-                                                                          delta_cx,
-                                                                          to_layer_num);
-        if (!intersect) {
-            return false;
-        }
-    }
-
-    legal = find_compatible_compressed_loc_in_range(blk_type,
-                                                    delta_cx,
-                                                    from_compressed_locs[to_layer_num],
-                                                    search_range,
-                                                    to_compressed_loc,
-                                                    true,
-                                                    to_layer_num);
+    legal = find_compatible_compressed_loc_for_block(blk_type,
+                                                     b_from,
+                                                     delta_cx,
+                                                     from_compressed_locs[to_layer_num],
+                                                     search_range,
+                                                     to_compressed_loc,
+                                                     true,
+                                                     to_layer_num);
 
     if (!legal) {
         //No valid position found
@@ -955,25 +940,15 @@ bool find_to_loc_centroid(t_logical_block_type_ptr blk_type,
     t_physical_tile_loc to_compressed_loc;
     bool legal = false;
 
-    if (is_cluster_constrained(b_from)) {
-        bool intersect = intersect_range_limit_with_floorplan_constraints(blk_type,
-                                                                          b_from,
-                                                                          search_range,
-                                                                          delta_cx,
-                                                                          to_layer_num);
-        if (!intersect) {
-            return false;
-        }
-    }
-
     //TODO: For now, we only move the blocks on the same tile
-    legal = find_compatible_compressed_loc_in_range(blk_type,
-                                                    delta_cx,
-                                                    from_compressed_loc[to_layer_num],
-                                                    search_range,
-                                                    to_compressed_loc,
-                                                    false,
-                                                    to_layer_num);
+    legal = find_compatible_compressed_loc_for_block(blk_type,
+                                                     b_from,
+                                                     delta_cx,
+                                                     from_compressed_loc[to_layer_num],
+                                                     search_range,
+                                                     to_compressed_loc,
+                                                     false,
+                                                     to_layer_num);
 
     if (!legal) {
         //No valid position found
@@ -1131,6 +1106,96 @@ bool find_compatible_compressed_loc_in_range(t_logical_block_type_ptr type,
     return legal;
 }
 
+bool find_compatible_compressed_loc_in_region(const t_compressed_region_locs& region_locs,
+                                              const t_physical_tile_loc& from_loc,
+                                              const t_bb& search_range,
+                                              t_physical_tile_loc& to_loc) {
+    const int layer_num = search_range.layer_min;
+    const auto& column_rows = region_locs.column_rows[layer_num];
+    VTR_ASSERT(search_range.xmin >= 0 && search_range.xmax < (int)column_rows.size());
+
+    //Count the locations within the search range, and find the index of the from location among them
+    int num_locs = 0;
+    int from_index = OPEN;
+    for (int cx = search_range.xmin; cx <= search_range.xmax; ++cx) {
+        const std::vector<int>& rows = column_rows[cx];
+        auto lower_iter = std::lower_bound(rows.begin(), rows.end(), search_range.ymin);
+        auto upper_iter = std::upper_bound(lower_iter, rows.end(), search_range.ymax);
+
+        if (cx == from_loc.x && layer_num == from_loc.layer_num) {
+            auto from_iter = std::lower_bound(lower_iter, upper_iter, from_loc.y);
+            if (from_iter != upper_iter && *from_iter == from_loc.y) {
+                from_index = num_locs + std::distance(lower_iter, from_iter);
+            }
+        }
+        num_locs += std::distance(lower_iter, upper_iter);
+    }
+
+    int num_candidates = num_locs - (from_index != OPEN ? 1 : 0);
+    if (num_candidates <= 0) {
+        VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\tCouldn't find any legal position within the floorplan region in the given search range\n");
+        return false;
+    }
+
+    //Pick one of the locations uniformly, skipping over the from location
+    int index = vtr::irand(num_candidates - 1);
+    if (from_index != OPEN && index >= from_index) {
+        ++index;
+    }
+
+    for (int cx = search_range.xmin; cx <= search_range.xmax; ++cx) {
+        const std::vector<int>& rows = column_rows[cx];
+        auto lower_iter = std::lower_bound(rows.begin(), rows.end(), search_range.ymin);
+        auto upper_iter = std::upper_bound(lower_iter, rows.end(), search_range.ymax);
+
+        int num_column_locs = std::distance(lower_iter, upper_iter);
+        if (index < num_column_locs) {
+            to_loc = t_physical_tile_loc(cx, *(lower_iter + index), layer_num);
+            return true;
+        }
+        index -= num_column_locs;
+    }
+
+    VTR_ASSERT_MSG(false, "Picked location must be within the search range");
+    return false;
+}
+
+bool find_compatible_compressed_loc_for_block(t_logical_block_type_ptr type,
+                                              ClusterBlockId b_from,
+                                              int delta_cx,
+                                              const t_physical_tile_loc& from_loc,
+                                              t_bb search_range,
+                                              t_physical_tile_loc& to_loc,
+                                              bool is_median,
+                                              int to_layer_num) {
+    const t_compressed_region_locs* region_locs = get_block_region_locs(b_from);
+    if (region_locs) {
+        //Only pick among the locations within the floorplan region
+        return find_compatible_compressed_loc_in_region(*region_locs, from_loc, search_range, to_loc);
+    }
+
+    //TODO: constraints should be adapted to 3D architecture
+    if (is_cluster_constrained(b_from)) {
+        //The locations within the region have not been loaded, narrow the range to the region instead
+        bool intersect = intersect_range_limit_with_floorplan_constraints(type,
+                                                                          b_from,
+                                                                          search_range,
+                                                                          delta_cx,
+                                                                          to_layer_num);
+        if (!intersect) {
+            return false;
+        }
+    }
+
+    return find_compatible_compressed_loc_in_range(type,
+                                                   delta_cx,
+                                                   from_loc,
+                                                   search_range,
+                                                   to_loc,
+                                                   is_median,
+                                                   to_layer_num);
+}
+
 std::vector<t_physical_tile_loc> get_compressed_loc(const t_compressed_block_grid& compressed_block_grid,
                                                     t_pl_loc grid_loc,
                                                     int num_layers) {
@@ -1250,11 +1315,7 @@ bool intersect_range_limit_with_floorplan_constraints(t_logical_block_type_ptr t
 
     auto& floorplanning_ctx = g_vpr_ctx.floorplanning();
 
-    PartitionRegion pr = floorplanning_ctx.cluster_constraints[b_from];
-    std::vector<Region> regions;
-    if (!pr.empty()) {
-        regions = pr.get_partition_region();
-    }
+    const std::vector<Region>& regions = floorplanning_ctx.cluster_constraints[b_from].get_partition_region();
     Region intersect_reg;
     /*
      * If region size is greater than 1, the block is constrained to more than one rectangular region.
@@ -1330,12 +1391,14 @@ int get_random_layer(t_logical_block_type_ptr logical_block) {
     return layer_num;
 }
 
-t_bb union_2d_bb(const std::vector<t_2D_bb>& bb_vec) {
+t_bb union_2d_bb(const vtr::NdMatrixProxy<t_2D_bb, 1> bb_vec) {
     t_bb merged_bb;
+    const int num_layers = g_vpr_ctx.device().grid.get_num_layers();
 
     // Not all 2d_bbs are valid. Thus, if one of the coordinates in the 2D_bb is not valid (equal to OPEN),
     // we need to skip it.
-    for (const auto& layer_bb : bb_vec) {
+    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
+        const t_2D_bb& layer_bb = bb_vec[layer_num];
         if (layer_bb.xmin == OPEN) {
             VTR_ASSERT_SAFE(layer_bb.xmax == OPEN);
             VTR_ASSERT_SAFE(layer_bb.ymin == OPEN);
@@ -1366,12 +1429,14 @@ t_bb union_2d_bb(const std::vector<t_2D_bb>& bb_vec) {
     return merged_bb;
 }
 
-std::pair<t_bb, t_bb> union_2d_bb_incr(const std::vector<t_2D_bb>& num_edge_vec,
-                                       const std::vector<t_2D_bb>& bb_vec) {
+std::pair<t_bb, t_bb> union_2d_bb_incr(const vtr::NdMatrixProxy<t_2D_bb, 1> num_edge_vec,
+                                       const vtr::NdMatrixProxy<t_2D_bb, 1> bb_vec) {
     t_bb merged_num_edge;
     t_bb merged_bb;
+    const int num_layers = g_vpr_ctx.device().grid.get_num_layers();
 
-    for (const auto& layer_bb : bb_vec) {
+    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
+        const t_2D_bb& layer_bb = bb_vec[layer_num];
         if (layer_bb.xmin == OPEN) {
             VTR_ASSERT_SAFE(layer_bb.xmax == OPEN);
             VTR_ASSERT_SAFE(layer_bb.ymin == OPEN);
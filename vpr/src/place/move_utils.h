@@ -241,6 +241,37 @@ bool find_compatible_compressed_loc_in_range(t_logical_block_type_ptr type,
                                              bool is_median,
                                              int to_layer_num);
 
+/**
+ * @brief find a compressed location within the search range, among the locations within a floorplan region
+ *
+ * All the locations of region_locs within search_range, except from_loc, are equally likely to be picked,
+ * so a single random draw finds a location whenever one exists.
+ *
+ * region_locs: the compressed locations within the floorplan region of the moving block
+ * from_loc: the compressed location of the moving block
+ * search_range: the compressed range (on one layer) to pick the new location in
+ * to_loc: the new compressed location (returned in reference)
+ */
+bool find_compatible_compressed_loc_in_region(const t_compressed_region_locs& region_locs,
+                                              const t_physical_tile_loc& from_loc,
+                                              const t_bb& search_range,
+                                              t_physical_tile_loc& to_loc);
+
+/**
+ * @brief find a compressed location for block b_from, within its floorplan region if it has one
+ *
+ * Floorplan constrained blocks pick among their cached region locations (see find_compatible_compressed_loc_in_region()),
+ * others are handled by find_compatible_compressed_loc_in_range(), which is passed the remaining arguments.
+ */
+bool find_compatible_compressed_loc_for_block(t_logical_block_type_ptr type,
+                                              ClusterBlockId b_from,
+                                              int delta_cx,
+                                              const t_physical_tile_loc& from_loc,
+                                              t_bb search_range,
+                                              t_physical_tile_loc& to_loc,
+                                              bool is_median,
+                                              int to_layer_num);
+
 /**
  * @brief Get the the compressed loc from the uncompressed loc (grid_loc)
  * @note This assumes the grid_loc corresponds to a location of the block type that compressed_block_grid stores its
@@ -343,7 +374,7 @@ int get_random_layer(t_logical_block_type_ptr logical_block);
  * @param tbb_vec
  * @return 3D bounding box
  */
-t_bb union_2d_bb(const std::vector<t_2D_bb>& tbb_vec);
+t_bb union_2d_bb(const vtr::NdMatrixProxy<t_2D_bb, 1> tbb_vec);
 
 /**
  * @brief Iterate over all layers and get the maximum x and y over that layers that have a valid value. Create the "num_edge" in a similar way. This data structure
@@ -352,8 +383,8 @@ t_bb union_2d_bb(const std::vector<t_2D_bb>& tbb_vec);
  * @param bb_vec
  * @return num_edge, 3D bb
  */
-std::pair<t_bb, t_bb> union_2d_bb_incr(const std::vector<t_2D_bb>& num_edge_vec,
-                                       const std::vector<t_2D_bb>& bb_vec);
+std::pair<t_bb, t_bb> union_2d_bb_incr(const vtr::NdMatrixProxy<t_2D_bb, 1> num_edge_vec,
+                                       const vtr::NdMatrixProxy<t_2D_bb, 1> bb_vec);
 
 #ifdef VTR_ENABLE_DEBUG_LOGGING
 /**
@@ -0,0 +1,102 @@
+/**
+ * @file net_bb_util.h
+ * @brief Kernels computing net bounding boxes from the coordinates of the net pins.
+ *
+ * The placer gathers the coordinates of the pins of a net into a t_net_pin_coords
+ * structure-of-arrays, so the bounding box reductions below are simple loops over
+ * contiguous ints, without branches, which the compiler vectorizes.
+ */
+
+#ifndef NET_BB_UTIL_H
+#define NET_BB_UTIL_H
+
+#include <algorithm>
+#include <vector>
+
+#include "vtr_assert.h"
+
+/**
+ * @brief The location of each pin of a net, as a structure-of-arrays.
+ *
+ *   @param x The x coordinate of each pin (driver first).
+ *   @param y The y coordinate of each pin (driver first).
+ *   @param layer The layer of each pin (driver first).
+ */
+struct t_net_pin_coords {
+    std::vector<int> x;
+    std::vector<int> y;
+    std::vector<int> layer;
+
+    void resize(size_t num_pins) {
+        x.resize(num_pins);
+        y.resize(num_pins);
+        layer.resize(num_pins);
+    }
+
+    size_t size() const {
+        return x.size();
+    }
+};
+
+///@brief The extent of a set of coordinates along one axis, and how many are on each edge
+struct t_coord_extent {
+    int min;
+    int max;
+    int num_on_min;
+    int num_on_max;
+};
+
+///@brief Returns the extent of the num_coords (> 0) coordinates, without the edge counts
+inline t_coord_extent coord_min_max(const int* coords, size_t num_coords) {
+    VTR_ASSERT_SAFE(num_coords > 0);
+
+    int min = coords[0];
+    int max = coords[0];
+    for (size_t i = 1; i < num_coords; ++i) {
+        min = std::min(min, coords[i]);
+        max = std::max(max, coords[i]);
+    }
+    return {min, max, 0, 0};
+}
+
+///@brief Returns the extent of the num_coords (> 0) coordinates, including the number of coordinates on each edge
+inline t_coord_extent coord_extent(const int* coords, size_t num_coords) {
+    t_coord_extent extent = coord_min_max(coords, num_coords);
+
+    //A second pass is cheaper than the data dependent branches of counting while reducing
+    int num_on_min = 0;
+    int num_on_max = 0;
+    for (size_t i = 0; i < num_coords; ++i) {
+        num_on_min += (coords[i] == extent.min);
+        num_on_max += (coords[i] == extent.max);
+    }
+    extent.num_on_min = num_on_min;
+    extent.num_on_max = num_on_max;
+    return extent;
+}
+
+///@brief The extent of a set of coordinates along one axis, and the index of the first coordinate on each edge
+struct t_coord_extent_pins {
+    int min;
+    int max;
+    size_t first_on_min;
+    size_t first_on_max;
+};
+
+///@brief Returns the extent of the num_coords (> 0) coordinates, and the first coordinate on each edge
+inline t_coord_extent_pins coord_extent_first_pins(const int* coords, size_t num_coords) {
+    t_coord_extent min_max = coord_min_max(coords, num_coords);
+
+    //Both edges are reached, so the searches stop within the coordinates
+    size_t first_on_min = 0;
+    while (coords[first_on_min] != min_max.min) {
+        ++first_on_min;
+    }
+    size_t first_on_max = 0;
+    while (coords[first_on_max] != min_max.max) {
+        ++first_on_max;
+    }
+    return {min_max.min, min_max.max, first_on_min, first_on_max};
+}
+
+#endif
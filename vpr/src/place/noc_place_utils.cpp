@@ -7,8 +7,14 @@ static vtr::vector<NocTrafficFlowId, TrafficFlowPlaceCost> traffic_flow_costs, p
 
 /* Keeps track of traffic flows that have been updated at each attempted placement move*/
 static std::vector<NocTrafficFlowId> affected_traffic_flows;
+
+/* The route of the traffic flow being re-routed, before it is re-routed (re-used across re-routes) */
+static std::vector<NocLinkId> prev_traffic_flow_route;
 /*********************************************************** *****************************/
 
+/* Adds bandwidth_delta to the bandwidth usage of the links [first_link, last_link) of a traffic flow route */
+static void update_link_usage(std::vector<NocLinkId>::const_iterator first_link, std::vector<NocLinkId>::const_iterator last_link, NocStorage& noc_model, double bandwidth_delta);
+
 void initial_noc_routing(void) {
     // need to get placement information about where the router cluster blocks are placed on the device
     const auto& place_ctx = g_vpr_ctx.placement();
@@ -126,19 +132,25 @@ std::vector<NocLinkId>& get_traffic_flow_route(NocTrafficFlowId traffic_flow_id,
 }
 
 void update_traffic_flow_link_usage(const std::vector<NocLinkId>& traffic_flow_route, NocStorage& noc_model, int inc_or_dec, double traffic_flow_bandwidth) {
-    // go through the links within the traffic flow route and update their bandwidth usage
-    for (auto& link_in_route_id : traffic_flow_route) {
-        // get the link to update and its current bandwidth
-        NocLink& curr_link = noc_model.get_single_mutable_noc_link(link_in_route_id);
-        double curr_link_bandwidth = curr_link.get_bandwidth_usage();
+    update_link_usage(traffic_flow_route.begin(), traffic_flow_route.end(), noc_model, inc_or_dec * traffic_flow_bandwidth);
 
-        curr_link.set_bandwidth_usage(curr_link_bandwidth + inc_or_dec * traffic_flow_bandwidth);
+    return;
+}
+
+static void update_link_usage(std::vector<NocLinkId>::const_iterator first_link, std::vector<NocLinkId>::const_iterator last_link, NocStorage& noc_model, double bandwidth_delta) {
+    // the links are stored contiguously, so go through them directly rather than looking each one up
+    vtr::vector<NocLinkId, NocLink>& noc_links = noc_model.get_mutable_noc_links();
+
+    // go through the links within the traffic flow route and update their bandwidth usage
+    for (auto link_in_route = first_link; link_in_route != last_link; ++link_in_route) {
+        NocLink& curr_link = noc_links[*link_in_route];
+        double new_link_bandwidth = curr_link.get_bandwidth_usage() + bandwidth_delta;
 
         // check that the bandwidth never goes to negative
-        VTR_ASSERT(curr_link.get_bandwidth_usage() >= 0.0);
-    }
+        VTR_ASSERT(new_link_bandwidth >= 0.0);
 
-    return;
+        curr_link.set_bandwidth_usage(new_link_bandwidth);
+    }
 }
 
 void re_route_associated_traffic_flows(ClusterBlockId moved_block_router_id, NocTrafficFlows& noc_traffic_flows_storage, NocStorage& noc_model, NocRouting& noc_flows_router, const vtr::vector_map<ClusterBlockId, t_block_loc>& placed_cluster_block_locations, std::unordered_set<NocTrafficFlowId>& updated_traffic_flows) {
@@ -212,17 +224,33 @@ void re_route_traffic_flow(NocTrafficFlowId traffic_flow_id, NocTrafficFlows& no
     // get the current traffic flow info
     const t_noc_traffic_flow& curr_traffic_flow = noc_traffic_flows_storage.get_single_noc_traffic_flow(traffic_flow_id);
 
-    /*  since the current traffic flow route will be 
-     * changed, first we need to decrement the bandwidth
-     * usage of all links that are part of
-     * the existing traffic flow route
-     */
+    // keep the existing traffic flow route, since re-routing replaces it
     const std::vector<NocLinkId>& curr_traffic_flow_route = noc_traffic_flows_storage.get_traffic_flow_route(traffic_flow_id);
-    update_traffic_flow_link_usage(curr_traffic_flow_route, noc_model, -1, curr_traffic_flow.traffic_flow_bandwidth);
+    prev_traffic_flow_route.assign(curr_traffic_flow_route.begin(), curr_traffic_flow_route.end());
+
+    // now get the re-routed traffic flow route
+    const std::vector<NocLinkId>& re_routed_traffic_flow_route = get_traffic_flow_route(traffic_flow_id, noc_model, noc_traffic_flows_storage, noc_flows_router, placed_cluster_block_locations);
+
+    /* Moving one end of a traffic flow often leaves the beginning or the end of its
+     * route unchanged (e.g. with XY routing). The bandwidth usage of these shared
+     * links does not change, so only the links in between are updated: the links
+     * of the existing route are decremented and the links of the new route are incremented.
+     */
+    auto prev_first = prev_traffic_flow_route.cbegin();
+    auto prev_last = prev_traffic_flow_route.cend();
+    auto new_first = re_routed_traffic_flow_route.cbegin();
+    auto new_last = re_routed_traffic_flow_route.cend();
+    while (prev_first != prev_last && new_first != new_last && *prev_first == *new_first) {
+        ++prev_first;
+        ++new_first;
+    }
+    while (prev_first != prev_last && new_first != new_last && *(prev_last - 1) == *(new_last - 1)) {
+        --prev_last;
+        --new_last;
+    }
 
-    // now get the re-routed traffic flow route and increment all the link usages with this reverted route
-    std::vector<NocLinkId>& re_routed_traffic_flow_route = get_traffic_flow_route(traffic_flow_id, noc_model, noc_traffic_flows_storage, noc_flows_router, placed_cluster_block_locations);
-    update_traffic_flow_link_usage(re_routed_traffic_flow_route, noc_model, 1, curr_traffic_flow.traffic_flow_bandwidth);
+    update_link_usage(prev_first, prev_last, noc_model, -curr_traffic_flow.traffic_flow_bandwidth);
+    update_link_usage(new_first, new_last, noc_model, curr_traffic_flow.traffic_flow_bandwidth);
 
     return;
 }
@@ -216,6 +216,9 @@ void revert_noc_traffic_flow_routes(const t_pl_blocks_to_be_moved& blocks_affect
  * a new route for the traffic flow and updates the links in the new route to
  * indicate that the traffic flow uses them.
  * 
+ * Only the links that are not shared by the beginning or the end of both routes are
+ * updated, since the bandwidth usage of the shared links does not change.
+ * 
  * @param traffic_flow_id The traffic flow to re-route.
  * @param noc_traffic_flows_storage Contains all the traffic flow information
  * within the NoC. Used to get the current traffic flow information.
@@ -7,6 +7,8 @@
 #include <chrono>
 #include <vtr_ndmatrix.h>
 #include <optional>
+#include <deque>
+#include <thread>
 
 #include "NetPinTimingInvalidator.h"
 #include "vtr_assert.h"
@@ -15,6 +17,8 @@
 #include "vtr_random.h"
 #include "vtr_geometry.h"
 #include "vtr_time.h"
+#include "vtr_profile.h"
+#include "vtr_parallel.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -68,6 +72,14 @@
 #include "cluster_placement.h"
 
 #include "noc_place_utils.h"
+#include "net_bb_util.h"
+#include "async_file_writer.h"
+#include "perf_metrics.h"
+#include "memory_accounting.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
 
 /*  define the RL agent's reward function factor constant. This factor controls the weight of bb cost *
  *  compared to the timing cost in the agent's reward function. The reward is calculated as           *
@@ -114,52 +126,105 @@ enum e_cost_methods {
 };
 
 constexpr float INVALID_DELAY = std::numeric_limits<float>::quiet_NaN();
+
+///@brief With --anneal_fast_start, the starting temperature is estimated from 1/FAST_START_INIT_T_MOVE_DIVISOR of the trial moves...
+constexpr int FAST_START_INIT_T_MOVE_DIVISOR = 8;
+///@brief ...but from at least FAST_START_MIN_INIT_T_MOVES of them
+constexpr int FAST_START_MIN_INIT_T_MOVES = 100;
 constexpr float INVALID_COST = std::numeric_limits<double>::quiet_NaN();
 
-/********************** Variables local to place.c ***************************/
-
-/* Cost of a net, and a temporary cost of a net used during move assessment. */
-static vtr::vector<ClusterNetId, double> net_cost, proposed_net_cost;
-
-/* [0...cluster_ctx.clb_nlist.nets().size()-1]                                               *
- * A flag array to indicate whether the specific bounding box has been updated   *
- * in this particular swap or not. If it has been updated before, the code       *
- * must use the updated data, instead of the out-of-date data passed into the    *
- * subroutine, particularly used in try_swap(). The value NOT_UPDATED_YET        *
- * indicates that the net has not been updated before, UPDATED_ONCE indicated    *
- * that the net has been updated once, if it is going to be updated again, the   *
- * values from the previous update must be used. GOT_FROM_SCRATCH is only        *
- * applicable for nets larger than SMALL_NETS and it indicates that the          *
- * particular bounding box cannot be updated incrementally before, hence the     *
- * bounding box is got from scratch, so the bounding box would definitely be     *
- * right, DO NOT update again.                                                   */
-static vtr::vector<ClusterNetId, char> bb_updated_before;
-
-/* The arrays below are used to precompute the inverse of the average   *
- * number of tracks per channel between [subhigh] and [sublow].  Access *
- * them as chan?_place_cost_fac[subhigh][sublow].  They are used to     *
- * speed up the computation of the cost function that takes the length  *
- * of the net bounding box in each dimension, divided by the average    *
- * number of tracks in that direction; for other cost functions they    *
- * will never be used.                                                  *
- */
-static vtr::NdMatrix<float, 2> chanx_place_cost_fac({0, 0}); //[0...device_ctx.grid.width()-2]
-static vtr::NdMatrix<float, 2> chany_place_cost_fac({0, 0}); //[0...device_ctx.grid.height()-2]
-
-/* The following arrays are used by the try_swap function for speed.   */
-/* [0...cluster_ctx.clb_nlist.nets().size()-1] */
-static vtr::vector<ClusterNetId, t_bb> ts_bb_edge_new, ts_bb_coord_new;
-static vtr::vector<ClusterNetId, std::vector<t_2D_bb>> layer_ts_bb_edge_new, layer_ts_bb_coord_new;
-static vtr::Matrix<int> ts_layer_sink_pin_count;
-static std::vector<ClusterNetId> ts_nets_to_update;
-
-/* These file-scoped variables keep track of the number of swaps       *
- * rejected, accepted or aborted. The total number of swap attempts    *
- * is the sum of the three number.                                     */
-static int num_swap_rejected = 0;
-static int num_swap_accepted = 0;
-static int num_swap_aborted = 0;
-static int num_ts_called = 0;
+///@brief The greedy refinement tries each block at the locations up to this distance in x and y
+constexpr int GREEDY_REFINE_WINDOW = 2;
+
+///@brief The number of regions refined concurrently by the greedy refinement, unless --place_parallel_regions is set
+constexpr int GREEDY_REFINE_REGIONS = 16;
+
+/* State of one region of the parallel annealer (see placement_parallel_moves()). */
+struct t_anneal_region {
+    explicit t_anneal_region(size_t num_nets)
+        : blocks_affected(2) //Only single (non-macro) block swaps are made in a region
+        , nets_to_update(num_nets, ClusterNetId::INVALID()) {}
+
+    std::vector<ClusterBlockId> movable_blocks; //Blocks in the region which are neither fixed nor part of a macro
+    t_pl_blocks_to_be_moved blocks_affected;
+    std::vector<ClusterNetId> nets_to_update;   //The region's ts_nets_to_update
+    std::vector<ClusterPinId> invalidated_pins; //Connections whose timing must be invalidated (not thread safe, so done after the moves)
+
+    int num_moves = 0;                //Number of moves to attempt
+    vtr::RandomNumberGenerator rng;   //The region's random number stream
+    std::vector<int> block_draws;     //The index (in movable_blocks) of the block moved by each of the moves
+    vtr::RandState rand_state = 0;    //Seed of the sequence used by the move generation routines (see vtr::irand())
+
+    //Outcome of the region's moves
+    t_placer_costs costs; //Costs at the start of the moves plus the changes due to the region's accepted moves
+    t_placer_statistics stats;
+    int num_accepted = 0;
+    int num_rejected = 0;
+    int num_aborted = 0;
+    int num_deferred = 0; //Moves which leave the region, left to the serial annealer
+};
+
+/* State of the parallel annealer.                                            *
+ * Before each batch of parallel moves the device is cut into num_x * num_y   *
+ * regions, at a random offset so the region boundaries change each time. A   *
+ * region owns the blocks placed inside it and the nets whose pins are all on *
+ * its blocks. A move is only made in a region if all the blocks and nets it  *
+ * affects are owned by the region, so moves in different regions never touch *
+ * the same placement or cost data and can be evaluated concurrently. Each    *
+ * region uses its own random number sequence, so the placement only depends  *
+ * on the seed and the number of regions.                                     */
+struct t_parallel_anneal_state {
+    int num_x = 1;
+    int num_y = 1;
+    int region_width = 1;  //The last region of each row also gets the remaining columns
+    int region_height = 1; //The last region of each column also gets the remaining rows
+    int offset_x = 0;
+    int offset_y = 0;
+
+    std::vector<t_anneal_region> regions;
+    vtr::vector<ClusterNetId, int> net_region; //The region owning each net, or OPEN if none does
+
+    int region_of(const t_pl_loc& loc) const {
+        int rx = std::min(num_x - 1, (loc.x + offset_x) / region_width);
+        int ry = std::min(num_y - 1, (loc.y + offset_y) / region_height);
+        return ry * num_x + rx;
+    }
+};
+
+/* A candidate move of the speculative annealer (see placement_speculative_moves()). */
+struct t_speculative_move {
+    t_speculative_move(size_t max_blocks, size_t num_nets)
+        : blocks_affected(max_blocks)
+        , nets_to_update(num_nets, ClusterNetId::INVALID()) {}
+
+    t_pl_blocks_to_be_moved blocks_affected;
+    std::vector<ClusterNetId> nets_to_update; //The candidate's ts_nets_to_update
+    t_propose_action proposed_action{e_move_type::UNIFORM, -1};
+    e_create_move create_move_outcome = e_create_move::ABORT;
+    bool conflicting = false; //Touches a block, location or net of an earlier candidate of the batch
+
+    //Delta costs, found concurrently with the other candidates
+    int num_nets_affected = 0;
+    double bb_delta_c = 0;
+    double timing_delta_c = 0;
+    double evaluate_time = 0; //Time (in seconds) spent finding the delta costs
+};
+
+/* State of the speculative annealer.                                          *
+ * A batch of candidate moves is proposed serially on the current placement.   *
+ * The candidates which share no block, location or net with an earlier one of *
+ * the batch are applied together and their delta costs evaluated             *
+ * concurrently. Since they are independent, each delta cost is the same as if *
+ * the moves had been made one after the other, and the candidates are then    *
+ * accepted or rejected in the order they were proposed.                       */
+struct t_speculative_moves {
+    std::vector<t_speculative_move> moves;
+    vtr::vector<ClusterNetId, int> net_batch; //Last batch with a candidate affecting each net
+    int batch = 0;
+    std::vector<t_pl_loc> batch_locs; //Locations vacated or filled by the candidates of the batch
+
+    std::deque<e_move_result> outcomes; //Outcomes of the batch not yet consumed by placement_inner_loop()
+};
 
 /* Expected crossing counts for nets with different #'s of pins.  From *
  * ICCAD 94 pp. 690 - 695 (with linear interpolation applied by me).   *
@@ -267,25 +332,36 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
                                              const t_placer_opts& placer_opts,
                                              const t_noc_opts& noc_opts,
                                              t_direct_inf* directs,
-                                             int num_directs);
+                                             int num_directs,
+                                             PlacerContext& placer_ctx);
+
+static void alloc_and_load_try_swap_structs(const bool cube_bb, PlacerContext& placer_ctx);
+static void free_try_swap_structs(PlacerContext& placer_ctx);
 
-static void alloc_and_load_try_swap_structs(const bool cube_bb);
-static void free_try_swap_structs();
+static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc_opts& noc_opts, PlacerContext& placer_ctx);
 
-static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc_opts& noc_opts);
+static void alloc_and_load_for_fast_cost_update(float place_cost_exp, PlacerContext& placer_ctx);
 
-static void alloc_and_load_for_fast_cost_update(float place_cost_exp);
+static void alloc_and_load_congestion_map(const t_placer_opts& placer_opts, PlacerContext& placer_ctx);
 
-static void free_fast_cost_update();
+static double comp_congestion_cost(PlacerContext& placer_ctx);
 
-static double comp_bb_cost(e_cost_methods method);
+static void stage_net_routing_demand(ClusterNetId net_id, const t_bb& old_bb, const t_bb& new_bb, PlacerContext& placer_ctx);
 
-static double comp_layer_bb_cost(e_cost_methods method);
+static void free_fast_cost_update(PlacerContext& placer_ctx);
+
+static double comp_bb_cost(e_cost_methods method, PlacerContext& placer_ctx);
+
+static double comp_layer_bb_cost(e_cost_methods method, PlacerContext& placer_ctx);
 
 static void update_move_nets(int num_nets_affected,
-                             const bool cube_bb);
+                             const bool cube_bb,
+                             const std::vector<ClusterNetId>& nets_to_update,
+                             PlacerContext& placer_ctx);
 
-static void reset_move_nets(int num_nets_affected);
+static void reset_move_nets(int num_nets_affected,
+                            const std::vector<ClusterNetId>& nets_to_update,
+                            PlacerContext& placer_ctx);
 
 static e_move_result try_swap(const t_annealing_state* state,
                               t_placer_costs* costs,
@@ -302,24 +378,27 @@ static e_move_result try_swap(const t_annealing_state* state,
                               MoveTypeStat& move_type_stat,
                               const t_place_algorithm& place_algorithm,
                               float timing_bb_factor,
-                              bool manual_move_enabled);
+                              bool manual_move_enabled,
+                              PlacerContext& placer_ctx);
 
 static void check_place(const t_placer_costs& costs,
                         const PlaceDelayModel* delay_model,
                         const PlacerCriticalities* criticalities,
                         const t_place_algorithm& place_algorithm,
-                        const t_noc_opts& noc_opts);
+                        const t_noc_opts& noc_opts,
+                        PlacerContext& placer_ctx);
 
 static int check_placement_costs(const t_placer_costs& costs,
                                  const PlaceDelayModel* delay_model,
                                  const PlacerCriticalities* criticalities,
-                                 const t_place_algorithm& place_algorithm);
+                                 const t_place_algorithm& place_algorithm,
+                                 PlacerContext& placer_ctx);
 
 static int check_placement_consistency();
 static int check_block_placement_consistency();
 static int check_macro_placement_consistency();
 
-static float starting_t(const t_annealing_state* state,
+static float starting_t(t_annealing_state* state,
                         t_placer_costs* costs,
                         t_annealing_sched annealing_sched,
                         const PlaceDelayModel* delay_model,
@@ -332,25 +411,23 @@ static float starting_t(const t_annealing_state* state,
                         t_pl_blocks_to_be_moved& blocks_affected,
                         const t_placer_opts& placer_opts,
                         const t_noc_opts& noc_opts,
-                        MoveTypeStat& move_type_stat);
+                        MoveTypeStat& move_type_stat,
+                        PlacerContext& placer_ctx);
 
 static int count_connections();
 
-static double recompute_bb_cost();
+static double recompute_bb_cost(PlacerContext& placer_ctx);
 
-static void commit_td_cost(const t_pl_blocks_to_be_moved& blocks_affected);
+static void commit_td_cost(const t_pl_blocks_to_be_moved& blocks_affected, PlacerContext& placer_ctx);
 
-static void revert_td_cost(const t_pl_blocks_to_be_moved& blocks_affected);
+static void revert_td_cost(const t_pl_blocks_to_be_moved& blocks_affected, PlacerContext& placer_ctx);
 
-static void invalidate_affected_connections(
-    const t_pl_blocks_to_be_moved& blocks_affected,
-    NetPinTimingInvalidator* pin_tedges_invalidator,
-    TimingInfo* timing_info);
+static void invalidate_affected_connections(const t_pl_blocks_to_be_moved& blocks_affected);
 
 static bool driven_by_moved_block(const ClusterNetId net,
                                   const t_pl_blocks_to_be_moved& blocks_affected);
 
-static float analyze_setup_slack_cost(const PlacerSetupSlacks* setup_slacks);
+static float analyze_setup_slack_cost(const PlacerSetupSlacks* setup_slacks, const PlacerContext& placer_ctx);
 
 static e_move_result assess_swap(double delta_c, double t);
 
@@ -359,7 +436,7 @@ static void get_non_updateable_bb(ClusterNetId net_id,
                                   vtr::NdMatrixProxy<int, 1> num_sink_pin_layer);
 
 static void get_non_updateable_layer_bb(ClusterNetId net_id,
-                                        std::vector<t_2D_bb>& bb_coord_new,
+                                        vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
                                         vtr::NdMatrixProxy<int, 1> num_sink_layer);
 
 static void update_bb(ClusterNetId net_id,
@@ -368,33 +445,37 @@ static void update_bb(ClusterNetId net_id,
                       vtr::NdMatrixProxy<int, 1> num_sink_pin_layer_new,
                       t_physical_tile_loc pin_old_loc,
                       t_physical_tile_loc pin_new_loc,
-                      bool src_pin);
+                      bool src_pin,
+                      PlacerContext& placer_ctx);
 
 static void update_layer_bb(ClusterNetId net_id,
-                            std::vector<t_2D_bb>& bb_edge_new,
-                            std::vector<t_2D_bb>& bb_coord_new,
+                            vtr::NdMatrixProxy<t_2D_bb, 1> bb_edge_new,
+                            vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
                             vtr::NdMatrixProxy<int, 1> bb_pin_sink_count_new,
                             t_physical_tile_loc pin_old_loc,
                             t_physical_tile_loc pin_new_loc,
-                            bool is_output_pin);
+                            bool is_output_pin,
+                            PlacerContext& placer_ctx);
 
 static inline void update_bb_same_layer(ClusterNetId net_id,
                                         const t_physical_tile_loc& pin_old_loc,
                                         const t_physical_tile_loc& pin_new_loc,
-                                        const std::vector<t_2D_bb>& curr_bb_edge,
-                                        const std::vector<t_2D_bb>& curr_bb_coord,
+                                        const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_edge,
+                                        const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_coord,
                                         vtr::NdMatrixProxy<int, 1> bb_pin_sink_count_new,
-                                        std::vector<t_2D_bb>& bb_edge_new,
-                                        std::vector<t_2D_bb>& bb_coord_new);
+                                        vtr::NdMatrixProxy<t_2D_bb, 1> bb_edge_new,
+                                        vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
+                                        PlacerContext& placer_ctx);
 
 static inline void update_bb_layer_changed(ClusterNetId net_id,
                                            const t_physical_tile_loc& pin_old_loc,
                                            const t_physical_tile_loc& pin_new_loc,
-                                           const std::vector<t_2D_bb>& curr_bb_edge,
-                                           const std::vector<t_2D_bb>& curr_bb_coord,
+                                           const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_edge,
+                                           const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_coord,
                                            vtr::NdMatrixProxy<int, 1> bb_pin_sink_count_new,
-                                           std::vector<t_2D_bb>& bb_edge_new,
-                                           std::vector<t_2D_bb>& bb_coord_new);
+                                           vtr::NdMatrixProxy<t_2D_bb, 1> bb_edge_new,
+                                           vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
+                                           PlacerContext& placer_ctx);
 
 static void update_bb_pin_sink_count(ClusterNetId net_id,
                                      const t_physical_tile_loc& pin_old_loc,
@@ -404,13 +485,14 @@ static void update_bb_pin_sink_count(ClusterNetId net_id,
                                      bool is_output_pin);
 
 static inline void update_bb_edge(ClusterNetId net_id,
-                                  std::vector<t_2D_bb>& bb_edge_new,
-                                  std::vector<t_2D_bb>& bb_coord_new,
+                                  vtr::NdMatrixProxy<t_2D_bb, 1> bb_edge_new,
+                                  vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
                                   vtr::NdMatrixProxy<int, 1> bb_layer_pin_sink_count,
                                   const int& old_num_block_on_edge,
                                   const int& old_edge_coord,
                                   int& new_num_block_on_edge,
-                                  int& new_edge_coord);
+                                  int& new_edge_coord,
+                                  PlacerContext& placer_ctx);
 
 static void add_block_to_bb(const t_physical_tile_loc& new_pin_loc,
                             const t_2D_bb& bb_edge_old,
@@ -424,38 +506,48 @@ static int find_affected_nets_and_update_costs(
     const PlacerCriticalities* criticalities,
     t_pl_blocks_to_be_moved& blocks_affected,
     double& bb_delta_c,
-    double& timing_delta_c);
+    double& timing_delta_c,
+    std::vector<ClusterNetId>& nets_to_update,
+    PlacerContext& placer_ctx);
 
-static void record_affected_net(const ClusterNetId net, int& num_affected_nets);
+static void record_affected_net(const ClusterNetId net,
+                                int& num_affected_nets,
+                                std::vector<ClusterNetId>& nets_to_update,
+                                PlacerContext& placer_ctx);
 
 static void update_net_bb(const ClusterNetId net,
                           const t_pl_blocks_to_be_moved& blocks_affected,
                           int iblk,
                           const ClusterBlockId blk,
-                          const ClusterPinId blk_pin);
+                          const ClusterPinId blk_pin,
+                          PlacerContext& placer_ctx);
 
 static void update_net_layer_bb(const ClusterNetId net,
                                 const t_pl_blocks_to_be_moved& blocks_affected,
                                 int iblk,
                                 const ClusterBlockId blk,
-                                const ClusterPinId blk_pin);
+                                const ClusterPinId blk_pin,
+                                PlacerContext& placer_ctx);
 
 static void update_td_delta_costs(const PlaceDelayModel* delay_model,
                                   const PlacerCriticalities& criticalities,
                                   const ClusterNetId net,
                                   const ClusterPinId pin,
                                   t_pl_blocks_to_be_moved& blocks_affected,
-                                  double& delta_timing_cost);
+                                  double& delta_timing_cost,
+                                  PlacerContext& placer_ctx);
 
-static void update_placement_cost_normalization_factors(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts);
+static void update_placement_cost_normalization_factors(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts, const PlacerContext& placer_ctx);
 
-static double get_total_cost(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts);
+static double get_total_cost(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts, const PlacerContext& placer_ctx);
 
-static double get_net_cost(ClusterNetId net_id, const t_bb& bbptr);
+static double get_net_cost(ClusterNetId net_id, const t_bb& bbptr, PlacerContext& placer_ctx);
 
 static double get_net_layer_cost(ClusterNetId /* net_id */,
-                                 const std::vector<t_2D_bb>& bbptr,
-                                 const vtr::NdMatrixProxy<int, 1> layer_pin_sink_count);
+                                 const vtr::NdMatrixProxy<t_2D_bb, 1> bbptr,
+                                 const vtr::NdMatrixProxy<int, 1> layer_pin_sink_count,
+                                 PlacerContext& placer_ctx);
+
 
 static void get_bb_from_scratch(ClusterNetId net_id,
                                 t_bb& coords,
@@ -463,19 +555,19 @@ static void get_bb_from_scratch(ClusterNetId net_id,
                                 vtr::NdMatrixProxy<int, 1> num_sink_pin_layer);
 
 static void get_layer_bb_from_scratch(ClusterNetId net_id,
-                                      std::vector<t_2D_bb>& num_on_edges,
-                                      std::vector<t_2D_bb>& coords,
+                                      vtr::NdMatrixProxy<t_2D_bb, 1> num_on_edges,
+                                      vtr::NdMatrixProxy<t_2D_bb, 1> coords,
                                       vtr::NdMatrixProxy<int, 1> layer_pin_sink_count);
 
 static double get_net_wirelength_estimate(ClusterNetId net_id, const t_bb& bbptr);
 
 static double get_net_layer_wirelength_estimate(ClusterNetId /* net_id */,
-                                                const std::vector<t_2D_bb>& bbptr,
+                                                const vtr::NdMatrixProxy<t_2D_bb, 1> bbptr,
                                                 const vtr::NdMatrixProxy<int, 1> layer_pin_sink_count);
 
 static void free_try_swap_arrays();
 
-static void outer_loop_update_timing_info(const t_placer_opts& placer_opts,
+static bool outer_loop_update_timing_info(const t_placer_opts& placer_opts,
                                           const t_noc_opts& noc_opts,
                                           t_placer_costs* costs,
                                           int num_connections,
@@ -485,7 +577,29 @@ static void outer_loop_update_timing_info(const t_placer_opts& placer_opts,
                                           PlacerCriticalities* criticalities,
                                           PlacerSetupSlacks* setup_slacks,
                                           NetPinTimingInvalidator* pin_timing_invalidator,
-                                          SetupTimingInfo* timing_info);
+                                          SetupTimingInfo* timing_info,
+                                          bool defer_timing_analysis,
+                                          const PlacerContext& placer_ctx);
+
+static void save_anneal_checkpoint(const std::string& file,
+                                   const t_annealing_state& state,
+                                   int tot_iter,
+                                   int moves_since_cost_recompute,
+                                   int outer_crit_iter_count,
+                                   e_agent_state agent_state,
+                                   const MoveGenerator& move_generator,
+                                   const MoveGenerator& move_generator2);
+
+static void load_checkpoint_block_locs(const t_anneal_checkpoint& checkpoint);
+
+static void restore_anneal_checkpoint(const t_anneal_checkpoint& checkpoint,
+                                      t_annealing_state& state,
+                                      int& tot_iter,
+                                      int& moves_since_cost_recompute,
+                                      int& outer_crit_iter_count,
+                                      e_agent_state& agent_state,
+                                      MoveGenerator& move_generator,
+                                      MoveGenerator& move_generator2);
 
 static void placement_inner_loop(const t_annealing_state* state,
                                  const t_placer_opts& placer_opts,
@@ -504,13 +618,121 @@ static void placement_inner_loop(const t_annealing_state* state,
                                  SetupTimingInfo* timing_info,
                                  const t_place_algorithm& place_algorithm,
                                  MoveTypeStat& move_type_stat,
-                                 float timing_bb_factor);
+                                 float timing_bb_factor,
+                                 t_parallel_anneal_state* parallel_anneal_state,
+                                 t_speculative_moves* speculative_moves,
+                                 PlacerContext& placer_ctx);
+
+static std::unique_ptr<t_parallel_anneal_state> alloc_parallel_anneal_state(const t_placer_opts& placer_opts,
+                                                                           const t_noc_opts& noc_opts);
+
+static std::unique_ptr<t_parallel_anneal_state> alloc_anneal_regions(int num_regions);
+
+static int placement_parallel_moves(const t_annealing_state* state,
+                                    const t_placer_opts& placer_opts,
+                                    int num_moves,
+                                    t_placer_statistics* stats,
+                                    t_placer_costs* costs,
+                                    const PlaceDelayModel* delay_model,
+                                    const PlacerCriticalities* criticalities,
+                                    const t_place_algorithm& place_algorithm,
+                                    t_parallel_anneal_state& anneal_state,
+                                    PlacerContext& placer_ctx);
+
+static void partition_anneal_regions(t_parallel_anneal_state& anneal_state);
+
+static void reset_anneal_regions(t_parallel_anneal_state& anneal_state, const t_placer_costs& costs);
+
+static int merge_anneal_regions(const t_parallel_anneal_state& anneal_state,
+                                t_placer_statistics* stats,
+                                t_placer_costs* costs,
+                                const t_place_algorithm& place_algorithm,
+                                PlacerContext& placer_ctx);
+
+static void anneal_region(const t_annealing_state* state,
+                          const t_placer_opts& placer_opts,
+                          const PlaceDelayModel* delay_model,
+                          const PlacerCriticalities* criticalities,
+                          const t_place_algorithm& place_algorithm,
+                          const t_parallel_anneal_state& anneal_state,
+                          int iregion,
+                          t_anneal_region& region,
+                          PlacerContext& placer_ctx);
+
+static e_move_result try_region_swap(const t_annealing_state* state,
+                                     const t_placer_opts& placer_opts,
+                                     const PlaceDelayModel* delay_model,
+                                     const PlacerCriticalities* criticalities,
+                                     const t_place_algorithm& place_algorithm,
+                                     const t_parallel_anneal_state& anneal_state,
+                                     int iregion,
+                                     t_anneal_region& region,
+                                     ClusterBlockId b_from,
+                                     bool& deferred,
+                                     PlacerContext& placer_ctx);
+
+template<typename AcceptFunc>
+static e_move_result try_region_move(const t_placer_opts& placer_opts,
+                                     const PlaceDelayModel* delay_model,
+                                     const PlacerCriticalities* criticalities,
+                                     const t_place_algorithm& place_algorithm,
+                                     const t_parallel_anneal_state& anneal_state,
+                                     int iregion,
+                                     t_anneal_region& region,
+                                     ClusterBlockId b_from,
+                                     const t_pl_loc& to,
+                                     const AcceptFunc& accept,
+                                     bool& deferred,
+                                     PlacerContext& placer_ctx);
+
+static bool greedy_refine_supported(const t_placer_opts& placer_opts, const t_noc_opts& noc_opts);
+
+static void placement_greedy_refine(const t_placer_opts& placer_opts,
+                                    const t_noc_opts& noc_opts,
+                                    const PlaceCritParams& crit_params,
+                                    t_placer_costs* costs,
+                                    const PlaceDelayModel* delay_model,
+                                    PlacerCriticalities* criticalities,
+                                    PlacerSetupSlacks* setup_slacks,
+                                    NetPinTimingInvalidator* pin_timing_invalidator,
+                                    SetupTimingInfo* timing_info,
+                                    PlacerContext& placer_ctx);
+
+static void greedy_refine_region(const t_placer_opts& placer_opts,
+                                 const PlaceDelayModel* delay_model,
+                                 const PlacerCriticalities* criticalities,
+                                 const t_place_algorithm& place_algorithm,
+                                 const t_parallel_anneal_state& anneal_state,
+                                 int iregion,
+                                 t_anneal_region& region,
+                                 PlacerContext& placer_ctx);
+
+static std::unique_ptr<t_speculative_moves> alloc_speculative_moves(const t_placer_opts& placer_opts,
+                                                                   const t_noc_opts& noc_opts);
+
+static void placement_speculative_moves(const t_annealing_state* state,
+                                        t_placer_statistics* stats,
+                                        t_placer_costs* costs,
+                                        MoveGenerator& move_generator,
+                                        const PlaceDelayModel* delay_model,
+                                        PlacerCriticalities* criticalities,
+                                        const t_placer_opts& placer_opts,
+                                        MoveTypeStat& move_type_stat,
+                                        const t_place_algorithm& place_algorithm,
+                                        float timing_bb_factor,
+                                        int num_moves,
+                                        t_speculative_moves& speculative_moves,
+                                        PlacerContext& placer_ctx);
+
+static bool speculative_move_conflicts(const t_pl_blocks_to_be_moved& blocks_affected,
+                                       t_speculative_moves& speculative_moves);
 
 static void recompute_costs_from_scratch(const t_placer_opts& placer_opts,
                                          const t_noc_opts& noc_opts,
                                          const PlaceDelayModel* delay_model,
                                          const PlacerCriticalities* criticalities,
-                                         t_placer_costs* costs);
+                                         t_placer_costs* costs,
+                                         PlacerContext& placer_ctx);
 
 static void generate_post_place_timing_reports(const t_placer_opts& placer_opts,
                                                const t_analysis_opts& analysis_opts,
@@ -518,6 +740,12 @@ static void generate_post_place_timing_reports(const t_placer_opts& placer_opts,
                                                const PlacementDelayCalculator& delay_calc,
                                                bool is_flat);
 
+static void report_final_placement_timing(const t_placer_opts& placer_opts,
+                                          const t_analysis_opts& analysis_opts,
+                                          SetupTimingInfo& timing_info,
+                                          const PlacementDelayCalculator& delay_calc,
+                                          bool is_flat);
+
 //calculate the agent's reward and the total process outcome
 static void calculate_reward_and_process_outcome(
     const t_placer_opts& placer_opts,
@@ -538,24 +766,25 @@ static void print_place_status(const t_annealing_state& state,
 
 static void print_resources_utilization();
 
-static void print_placement_swaps_stats(const t_annealing_state& state);
+static void print_placement_swaps_stats(const t_annealing_state& state, PlacerContext& placer_ctx);
 
 static void print_placement_move_types_stats(
     const MoveTypeStat& move_type_stat);
 
 /*****************************************************************************/
-void try_place(const Netlist<>& net_list,
-               const t_placer_opts& placer_opts,
-               t_annealing_sched annealing_sched,
-               const t_router_opts& router_opts,
-               const t_analysis_opts& analysis_opts,
-               const t_noc_opts& noc_opts,
-               t_chan_width_dist chan_width_dist,
-               t_det_routing_arch* det_routing_arch,
-               std::vector<t_segment_inf>& segment_inf,
-               t_direct_inf* directs,
-               int num_directs,
-               bool is_flat) {
+t_place_result try_place(const Netlist<>& net_list,
+                         const t_placer_opts& placer_opts,
+                         t_annealing_sched annealing_sched,
+                         const t_router_opts& router_opts,
+                         const t_analysis_opts& analysis_opts,
+                         const t_noc_opts& noc_opts,
+                         t_chan_width_dist chan_width_dist,
+                         t_det_routing_arch* det_routing_arch,
+                         std::vector<t_segment_inf>& segment_inf,
+                         t_direct_inf* directs,
+                         int num_directs,
+                         bool is_flat,
+                         std::unique_ptr<PlaceDelayModel>& place_delay_model) {
     /* Does almost all the work of placing a circuit.  Width_fac gives the   *
      * width of the widest channel.  Place_cost_exp says what exponent the   *
      * width should be taken to when calculating costs.  This allows a       *
@@ -570,10 +799,14 @@ void try_place(const Netlist<>& net_list,
     auto& device_ctx = g_vpr_ctx.device();
     auto& atom_ctx = g_vpr_ctx.atom();
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_move_ctx = g_placer_ctx.mutable_move();
 
-    const auto& p_timing_ctx = g_placer_ctx.timing();
-    const auto& p_runtime_ctx = g_placer_ctx.runtime();
+    //The placer state is looked up once here and handed down explicitly to
+    //the annealer, the move evaluation and the cost functions below
+    PlacerContext& placer_ctx = g_placer_ctx;
+    auto& place_move_ctx = placer_ctx.mutable_move();
+
+    const auto& p_timing_ctx = placer_ctx.timing();
+    auto& p_runtime_ctx = placer_ctx.mutable_runtime();
 
     auto& timing_ctx = g_vpr_ctx.timing();
     auto pre_place_timing_stats = timing_ctx.stats;
@@ -596,7 +829,6 @@ void try_place(const Netlist<>& net_list,
 
     std::shared_ptr<SetupTimingInfo> timing_info;
     std::shared_ptr<PlacementDelayCalculator> placement_delay_calc;
-    std::unique_ptr<PlaceDelayModel> place_delay_model;
     std::unique_ptr<MoveGenerator> move_generator;
     std::unique_ptr<MoveGenerator> move_generator2;
     std::unique_ptr<ManualMoveGenerator> manual_move_generator;
@@ -610,13 +842,19 @@ void try_place(const Netlist<>& net_list,
     t_pl_blocks_to_be_moved blocks_affected(
         net_list.blocks().size());
 
-    /* init file scope variables */
-    num_swap_rejected = 0;
-    num_swap_accepted = 0;
-    num_swap_aborted = 0;
-    num_ts_called = 0;
+    std::unique_ptr<t_parallel_anneal_state> parallel_anneal_state = alloc_parallel_anneal_state(placer_opts, noc_opts);
+    std::unique_ptr<t_speculative_moves> speculative_moves = alloc_speculative_moves(placer_opts, noc_opts);
 
-    if (placer_opts.place_algorithm.is_timing_driven()) {
+    /* init file scope variables */
+    p_runtime_ctx.num_swap_rejected = 0;
+    p_runtime_ctx.num_swap_accepted = 0;
+    p_runtime_ctx.num_swap_aborted = 0;
+    p_runtime_ctx.num_ts_called = 0;
+    p_runtime_ctx.num_timing_updates = 0;
+    p_runtime_ctx.num_timing_nodes_updated = 0;
+    p_runtime_ctx.num_timing_connections_invalidated = 0;
+
+    if (placer_opts.place_algorithm.is_timing_driven() && !place_delay_model) {
         /*do this before the initial placement to avoid messing up the initial placement */
         place_delay_model = alloc_lookups_and_delay_model(net_list,
                                                           device_ctx.arch_switch_inf,
@@ -660,7 +898,7 @@ void try_place(const Netlist<>& net_list,
 
     init_chan(width_fac, chan_width_dist, graph_directionality);
 
-    alloc_and_load_placement_structs(placer_opts.place_cost_exp, placer_opts, noc_opts, directs, num_directs);
+    alloc_and_load_placement_structs(placer_opts.place_cost_exp, placer_opts, noc_opts, directs, num_directs, placer_ctx);
 
     vtr::ScopedStartFinishTimer timer("Placement");
 
@@ -668,6 +906,7 @@ void try_place(const Netlist<>& net_list,
                       placer_opts.pad_loc_type,
                       placer_opts.constraints_file.c_str(),
                       noc_opts.noc);
+    float initial_placement_elapsed_sec = timer.elapsed_sec();
 
     if (!placer_opts.write_initial_place_file.empty()) {
         print_place(nullptr,
@@ -683,11 +922,20 @@ void try_place(const Netlist<>& net_list,
      *  Most of anneal is disabled later by setting initial temperature to 0 and only further optimizes in quench
      */
     if (placer_opts.enable_analytic_placer) {
-        AnalyticPlacer{}.ap_place();
+        AnalyticPlacer{placer_opts.analytic_placer_solver_stats, placer_opts.analytic_placer_engine}.ap_place();
     }
 
 #endif /* ENABLE_ANALYTIC_PLACE */
 
+    //Continue an interrupted placement from its on-disk checkpoint, instead of the initial placement
+    std::optional<t_anneal_checkpoint> resume_checkpoint;
+    if (!placer_opts.place_resume.empty()) {
+        resume_checkpoint = read_anneal_checkpoint(placer_opts.place_resume);
+        load_checkpoint_block_locs(*resume_checkpoint);
+        VTR_LOG("Resuming placement from checkpoint '%s' (after %d temperatures)\n",
+                placer_opts.place_resume.c_str(), resume_checkpoint->num_temps);
+    }
+
     // Update physical pin values
     for (auto block_id : cluster_ctx.clb_nlist.blocks()) {
         place_sync_external_block_connections(block_id);
@@ -705,10 +953,10 @@ void try_place(const Netlist<>& net_list,
 
     if (placer_opts.place_algorithm.is_timing_driven()) {
         if (cube_bb) {
-            costs.bb_cost = comp_bb_cost(NORMAL);
+            costs.bb_cost = comp_bb_cost(NORMAL, placer_ctx);
         } else {
             VTR_ASSERT_SAFE(!cube_bb);
-            costs.bb_cost = comp_layer_bb_cost(NORMAL);
+            costs.bb_cost = comp_layer_bb_cost(NORMAL, placer_ctx);
         }
 
         first_crit_exponent = placer_opts.td_place_exp_first; /*this will be modified when rlim starts to change */
@@ -719,6 +967,14 @@ void try_place(const Netlist<>& net_list,
                 num_connections);
         VTR_LOG("\n");
 
+        if (placer_opts.place_connection_delay_cache) {
+            auto& connection_delay_cache = placer_ctx.mutable_timing().connection_delay_cache;
+            connection_delay_cache = ConnectionDelayCache(place_delay_model.get());
+            VTR_LOG("Cached the delay table look-ups of %zu of the %d point to point connections.\n",
+                    connection_delay_cache.num_cached_connections(), num_connections);
+            VTR_LOG("\n");
+        }
+
         //Update the point-to-point delays from the initial placement
         comp_td_connection_delays(place_delay_model.get());
 
@@ -728,15 +984,22 @@ void try_place(const Netlist<>& net_list,
         // For placement, we don't use flat-routing
         placement_delay_calc = std::make_shared<PlacementDelayCalculator>(atom_ctx.nlist,
                                                                           atom_ctx.lookup,
-                                                                          p_timing_ctx.connection_delay,
+                                                                          p_timing_ctx.analyzed_connection_delay,
                                                                           is_flat);
         placement_delay_calc->set_tsu_margin_relative(
             placer_opts.tsu_rel_margin);
         placement_delay_calc->set_tsu_margin_absolute(
             placer_opts.tsu_abs_margin);
 
+        //Each temperature only moves a fraction of the connections, so incremental
+        //timing updates are used by default
+        e_timing_update_type timing_update_type = placer_opts.timing_update_type;
+        if (timing_update_type == e_timing_update_type::AUTO) {
+            timing_update_type = e_timing_update_type::INCREMENTAL;
+        }
+
         timing_info = make_setup_timing_info(placement_delay_calc,
-                                             placer_opts.timing_update_type);
+                                             timing_update_type);
 
         placer_setup_slacks = std::make_unique<PlacerSetupSlacks>(
             cluster_ctx.clb_nlist, netlist_pin_lookup);
@@ -745,13 +1008,14 @@ void try_place(const Netlist<>& net_list,
             cluster_ctx.clb_nlist, netlist_pin_lookup);
 
         pin_timing_invalidator = make_net_pin_timing_invalidator(
-            placer_opts.timing_update_type,
+            timing_update_type,
             net_list,
             netlist_pin_lookup,
             atom_ctx.nlist,
             atom_ctx.lookup,
             *timing_info->timing_graph(),
-            is_flat);
+            is_flat,
+            placement_delay_calc.get());
 
         //First time compute timing and costs, compute from scratch
         PlaceCritParams crit_params;
@@ -790,10 +1054,10 @@ void try_place(const Netlist<>& net_list,
 
         /* Total cost is the same as wirelength cost normalized*/
         if (cube_bb) {
-            costs.bb_cost = comp_bb_cost(NORMAL);
+            costs.bb_cost = comp_bb_cost(NORMAL, placer_ctx);
         } else {
             VTR_ASSERT_SAFE(!cube_bb);
-            costs.bb_cost = comp_layer_bb_cost(NORMAL);
+            costs.bb_cost = comp_layer_bb_cost(NORMAL, placer_ctx);
         }
         costs.bb_cost_norm = 1 / costs.bb_cost;
 
@@ -807,6 +1071,9 @@ void try_place(const Netlist<>& net_list,
         first_crit_exponent = 0;
     }
 
+    /* Loads the routing demand of the (now up-to-date) net bounding boxes. */
+    costs.congestion_cost = comp_congestion_cost(placer_ctx);
+
     if (noc_opts.noc) {
         // get the costs associated with the NoC
         costs.noc_aggregate_bandwidth_cost = comp_noc_aggregate_bandwidth_cost();
@@ -817,18 +1084,22 @@ void try_place(const Netlist<>& net_list,
     }
 
     // set the starting total placement cost
-    costs.cost = get_total_cost(&costs, placer_opts, noc_opts);
+    costs.cost = get_total_cost(&costs, placer_opts, noc_opts, placer_ctx);
 
     //Sanity check that initial placement is legal
     check_place(costs,
                 place_delay_model.get(),
                 placer_criticalities.get(),
                 placer_opts.place_algorithm,
-                noc_opts);
+                noc_opts,
+                placer_ctx);
 
     //Initial pacement statistics
     VTR_LOG("Initial placement cost: %g bb_cost: %g td_cost: %g\n", costs.cost,
             costs.bb_cost, costs.timing_cost);
+    if (!placer_ctx.cost().congestion_map.empty()) {
+        VTR_LOG("Initial placement congestion_cost: %g\n", costs.congestion_cost);
+    }
     if (noc_opts.noc) {
         VTR_LOG("Initial noc placement costs. noc_aggregate_bandwidth_cost: %g, noc_latency_cost: %g, \n", costs.noc_aggregate_bandwidth_cost, costs.noc_latency_cost);
     }
@@ -907,6 +1178,8 @@ void try_place(const Netlist<>& net_list,
     move_type_stat.blk_type_moves.resize(device_ctx.logical_block_types.size() * placer_opts.place_static_move_prob.size(), 0);
     move_type_stat.accepted_moves.resize(device_ctx.logical_block_types.size() * placer_opts.place_static_move_prob.size(), 0);
     move_type_stat.rejected_moves.resize(device_ctx.logical_block_types.size() * placer_opts.place_static_move_prob.size(), 0);
+    move_type_stat.propose_time.resize(device_ctx.logical_block_types.size() * placer_opts.place_static_move_prob.size(), 0.);
+    move_type_stat.evaluate_time.resize(device_ctx.logical_block_types.size() * placer_opts.place_static_move_prob.size(), 0.);
 
     /* Get the first range limiter */
     first_rlim = (float)max(device_ctx.grid.width() - 1,
@@ -923,12 +1196,15 @@ void try_place(const Netlist<>& net_list,
                             first_crit_exponent,
                             device_ctx.grid.get_num_layers());
 
-    /* Update the starting temperature for placement annealing to a more appropriate value */
-    state.t = starting_t(&state, &costs, annealing_sched,
-                         place_delay_model.get(), placer_criticalities.get(),
-                         placer_setup_slacks.get(), timing_info.get(), *move_generator,
-                         *manual_move_generator, pin_timing_invalidator.get(),
-                         blocks_affected, placer_opts, noc_opts, move_type_stat);
+    /* Update the starting temperature for placement annealing to a more appropriate value *
+     * (a resumed placement continues at the checkpointed temperature instead)            */
+    if (!resume_checkpoint) {
+        state.t = starting_t(&state, &costs, annealing_sched,
+                             place_delay_model.get(), placer_criticalities.get(),
+                             placer_setup_slacks.get(), timing_info.get(), *move_generator,
+                             *manual_move_generator, pin_timing_invalidator.get(),
+                             blocks_affected, placer_opts, noc_opts, move_type_stat, placer_ctx);
+    }
 
     if (!placer_opts.move_stats_file.empty()) {
         f_move_stats_file = std::unique_ptr<FILE, decltype(&vtr::fclose)>(
@@ -957,6 +1233,30 @@ void try_place(const Netlist<>& net_list,
     //Define the timing bb weight factor for the agent's reward function
     float timing_bb_factor = REWARD_BB_TIMING_RELATIVE_WEIGHT;
 
+    if (resume_checkpoint) {
+        restore_anneal_checkpoint(*resume_checkpoint, state, tot_iter, moves_since_cost_recompute,
+                                  outer_crit_iter_count, agent_state, *move_generator, *move_generator2);
+
+        //The criticalities depend on the checkpointed criticality exponent
+        if (placer_opts.place_algorithm.is_timing_driven()) {
+            PlaceCritParams crit_params;
+            crit_params.crit_exponent = state.crit_exponent;
+            crit_params.crit_limit = placer_opts.place_crit_limit;
+            perform_full_timing_update(crit_params, place_delay_model.get(), placer_criticalities.get(),
+                                       placer_setup_slacks.get(), pin_timing_invalidator.get(),
+                                       timing_info.get(), &costs);
+        }
+        resume_checkpoint.reset();
+    }
+
+    //Overlapping the timing analysis with the moves needs a second hardware thread to pay off
+    bool overlap_timing_analysis = placer_opts.place_overlap_timing_analysis
+                                   && placer_opts.place_algorithm.is_timing_driven();
+    if (overlap_timing_analysis && std::thread::hardware_concurrency() < 2) {
+        VTR_LOG("Only one hardware thread is available, the placement timing analysis will not be overlapped with the annealing\n");
+        overlap_timing_analysis = false;
+    }
+
     if (skip_anneal == false) {
         //Table header
         VTR_LOG("\n");
@@ -965,27 +1265,43 @@ void try_place(const Netlist<>& net_list,
         /* Outer loop of the simulated annealing begins */
         do {
             vtr::Timer temperature_timer;
+            vtr::ProfileZone temperature_zone("place_temperature", state.num_temps);
+
+            if (!placer_opts.place_checkpoint_file.empty()
+                && state.num_temps > 0
+                && state.num_temps % placer_opts.place_checkpoint_interval == 0) {
+                save_anneal_checkpoint(placer_opts.place_checkpoint_file, state, tot_iter, moves_since_cost_recompute,
+                                       outer_crit_iter_count, agent_state, *move_generator, *move_generator2);
+            }
 
-            outer_loop_update_timing_info(placer_opts, noc_opts, &costs, num_connections,
-                                          state.crit_exponent, &outer_crit_iter_count,
-                                          place_delay_model.get(), placer_criticalities.get(),
-                                          placer_setup_slacks.get(), pin_timing_invalidator.get(),
-                                          timing_info.get());
+            bool timing_analysis_deferred = outer_loop_update_timing_info(placer_opts, noc_opts, &costs, num_connections,
+                                                                          state.crit_exponent, &outer_crit_iter_count,
+                                                                          place_delay_model.get(), placer_criticalities.get(),
+                                                                          placer_setup_slacks.get(), pin_timing_invalidator.get(),
+                                                                          timing_info.get(), overlap_timing_analysis, placer_ctx);
 
             if (placer_opts.place_algorithm.is_timing_driven()) {
                 critical_path = timing_info->least_slack_critical_path();
                 sTNS = timing_info->setup_total_negative_slack();
                 sWNS = timing_info->setup_worst_negative_slack();
 
-                //see if we should save the current placement solution as a checkpoint
+                //see if we should save the current placement solution as a checkpoint.
+                //A deferred timing analysis has not analyzed the current placement yet,
+                //so its critical path delay is stale
 
                 if (placer_opts.place_checkpointing
-                    && agent_state == LATE_IN_THE_ANNEAL) {
+                    && agent_state == LATE_IN_THE_ANNEAL
+                    && !timing_analysis_deferred) {
                     save_placement_checkpoint_if_needed(placement_checkpoint,
                                                         timing_info, costs, critical_path.delay());
                 }
             }
 
+            //Anneal this temperature with the current criticalities while its timing analysis runs
+            if (timing_analysis_deferred) {
+                start_background_timing_update(timing_info.get(), pin_timing_invalidator.get());
+            }
+
             //move the appropoiate move_generator to be the current used move generator
             assign_current_move_generator(move_generator, move_generator2,
                                           agent_state, placer_opts, false, current_move_generator);
@@ -999,7 +1315,9 @@ void try_place(const Netlist<>& net_list,
                                  *current_move_generator, *manual_move_generator,
                                  blocks_affected, timing_info.get(),
                                  placer_opts.place_algorithm, move_type_stat,
-                                 timing_bb_factor);
+                                 timing_bb_factor, parallel_anneal_state.get(),
+                                 speculative_moves.get(),
+                                 placer_ctx);
 
             //move the update used move_generator to its original variable
             update_move_generator(move_generator, move_generator2, agent_state,
@@ -1010,6 +1328,9 @@ void try_place(const Netlist<>& net_list,
 
             print_place_status(state, stats, temperature_timer.elapsed_sec(),
                                critical_path.delay(), sTNS, sWNS, tot_iter);
+            vtr::profile_counter("place_cost", costs.cost);
+            vtr::profile_counter("place_temperature", state.t);
+            vtr::profile_counter("place_success_rate", stats.success_rate);
 
             if (placer_opts.place_algorithm.is_timing_driven()
                 && placer_opts.place_agent_multistate
@@ -1022,8 +1343,9 @@ void try_place(const Netlist<>& net_list,
 
             sprintf(msg, "Cost: %g  BB Cost %g  TD Cost %g  Temperature: %g",
                     costs.cost, costs.bb_cost, costs.timing_cost, state.t);
+            //The timing info may not be read while it is being analyzed
             update_screen(ScreenUpdatePriority::MINOR, msg, PLACEMENT,
-                          timing_info);
+                          background_timing_update_pending() ? std::shared_ptr<SetupTimingInfo>() : timing_info);
 
             //#ifdef VERBOSE
             //            if (getEchoEnabled()) {
@@ -1033,12 +1355,23 @@ void try_place(const Netlist<>& net_list,
         } while (state.outer_loop_update(stats.success_rate, costs, placer_opts,
                                          annealing_sched));
         /* Outer loop of the simmulated annealing ends */
+
+        if (annealing_sched.fast_start) {
+            size_t default_moves = tot_iter + state.fast_start_moves_saved;
+            VTR_LOG("Fast anneal start saved %zu of the %zu moves of the default move limits (%.1f%%)\n",
+                    state.fast_start_moves_saved, default_moves,
+                    100. * state.fast_start_moves_saved / std::max<size_t>(default_moves, 1));
+            perf_metrics().set("place.fast_start_moves_saved", state.fast_start_moves_saved, e_perf_metric_type::WORK);
+        }
     } //skip_anneal ends
 
     /* Start Quench */
     state.t = 0;                         //Freeze out: only accept solutions that improve placement.
     state.move_lim = state.move_lim_max; //Revert the move limit to initial value.
 
+    //Checked (and warned about) once, as it also decides whether the quench runs
+    bool greedy_refine = placer_opts.place_greedy_refine_passes > 0 && greedy_refine_supported(placer_opts, noc_opts);
+
     auto pre_quench_timing_stats = timing_ctx.stats;
     { /* Quench */
 
@@ -1048,39 +1381,61 @@ void try_place(const Netlist<>& net_list,
                                       state.crit_exponent, &outer_crit_iter_count,
                                       place_delay_model.get(), placer_criticalities.get(),
                                       placer_setup_slacks.get(), pin_timing_invalidator.get(),
-                                      timing_info.get());
-
-        //move the appropoiate move_generator to be the current used move generator
-        assign_current_move_generator(move_generator, move_generator2,
-                                      agent_state, placer_opts, true, current_move_generator);
-
-        /* Run inner loop again with temperature = 0 so as to accept only swaps
-         * which reduce the cost of the placement */
-        placement_inner_loop(&state, placer_opts, noc_opts,
-                             quench_recompute_limit,
-                             &stats, &costs, &moves_since_cost_recompute,
-                             pin_timing_invalidator.get(), place_delay_model.get(),
-                             placer_criticalities.get(), placer_setup_slacks.get(),
-                             *current_move_generator, *manual_move_generator,
-                             blocks_affected, timing_info.get(),
-                             placer_opts.place_quench_algorithm, move_type_stat,
-                             timing_bb_factor);
-
-        //move the update used move_generator to its original variable
-        update_move_generator(move_generator, move_generator2, agent_state,
-                              placer_opts, true, current_move_generator);
-
-        tot_iter += state.move_lim;
-        ++state.num_temps;
+                                      timing_info.get(), false, placer_ctx);
+
+        if (!(greedy_refine && placer_opts.place_greedy_refine_replace_quench)) {
+            //move the appropoiate move_generator to be the current used move generator
+            assign_current_move_generator(move_generator, move_generator2,
+                                          agent_state, placer_opts, true, current_move_generator);
+
+            /* Run inner loop again with temperature = 0 so as to accept only swaps
+             * which reduce the cost of the placement */
+            placement_inner_loop(&state, placer_opts, noc_opts,
+                                 quench_recompute_limit,
+                                 &stats, &costs, &moves_since_cost_recompute,
+                                 pin_timing_invalidator.get(), place_delay_model.get(),
+                                 placer_criticalities.get(), placer_setup_slacks.get(),
+                                 *current_move_generator, *manual_move_generator,
+                                 blocks_affected, timing_info.get(),
+                                 placer_opts.place_quench_algorithm, move_type_stat,
+                                 timing_bb_factor, parallel_anneal_state.get(),
+                                 speculative_moves.get(),
+                                 placer_ctx);
+
+            //move the update used move_generator to its original variable
+            update_move_generator(move_generator, move_generator2, agent_state,
+                                  placer_opts, true, current_move_generator);
+
+            tot_iter += state.move_lim;
+            ++state.num_temps;
+
+            if (placer_opts.place_quench_algorithm.is_timing_driven()) {
+                critical_path = timing_info->least_slack_critical_path();
+                sTNS = timing_info->setup_total_negative_slack();
+                sWNS = timing_info->setup_worst_negative_slack();
+            }
+
+            print_place_status(state, stats, temperature_timer.elapsed_sec(),
+                               critical_path.delay(), sTNS, sWNS, tot_iter);
+        }
+    }
+
+    if (greedy_refine) {
+        PlaceCritParams refine_crit_params;
+        refine_crit_params.crit_exponent = state.crit_exponent;
+        refine_crit_params.crit_limit = placer_opts.place_crit_limit;
+
+        placement_greedy_refine(placer_opts, noc_opts, refine_crit_params, &costs,
+                                place_delay_model.get(), placer_criticalities.get(),
+                                placer_setup_slacks.get(), pin_timing_invalidator.get(),
+                                timing_info.get(),
+                                placer_ctx);
 
         if (placer_opts.place_quench_algorithm.is_timing_driven()) {
             critical_path = timing_info->least_slack_critical_path();
             sTNS = timing_info->setup_total_negative_slack();
             sWNS = timing_info->setup_worst_negative_slack();
         }
-
-        print_place_status(state, stats, temperature_timer.elapsed_sec(),
-                           critical_path.delay(), sTNS, sWNS, tot_iter);
     }
     auto post_quench_timing_stats = timing_ctx.stats;
 
@@ -1128,11 +1483,12 @@ void try_place(const Netlist<>& net_list,
                 place_delay_model.get(),
                 placer_criticalities.get(),
                 placer_opts.place_algorithm,
-                noc_opts);
+                noc_opts,
+                placer_ctx);
 
     //Some stats
     VTR_LOG("\n");
-    VTR_LOG("Swaps called: %d\n", num_ts_called);
+    VTR_LOG("Swaps called: %d\n", p_runtime_ctx.num_ts_called);
     report_aborted_moves();
 
     if (placer_opts.place_algorithm.is_timing_driven()) {
@@ -1141,27 +1497,8 @@ void try_place(const Netlist<>& net_list,
 
         critical_path = timing_info->least_slack_critical_path();
 
-        if (isEchoFileEnabled(E_ECHO_FINAL_PLACEMENT_TIMING_GRAPH)) {
-            tatum::write_echo(
-                getEchoFileName(E_ECHO_FINAL_PLACEMENT_TIMING_GRAPH),
-                *timing_ctx.graph, *timing_ctx.constraints,
-                *placement_delay_calc, timing_info->analyzer());
-
-            tatum::NodeId debug_tnode = id_or_pin_name_to_tnode(
-                analysis_opts.echo_dot_timing_graph_node);
-            write_setup_timing_graph_dot(
-                getEchoFileName(E_ECHO_FINAL_PLACEMENT_TIMING_GRAPH)
-                    + std::string(".dot"),
-                *timing_info, debug_tnode);
-        }
-
-        generate_post_place_timing_reports(placer_opts, analysis_opts,
-                                           *timing_info, *placement_delay_calc, is_flat);
-
-        /* Print critical path delay metrics */
-        VTR_LOG("\n");
-        print_setup_timing_summary(*timing_ctx.constraints,
-                                   *timing_info->setup_analyzer(), "Placement estimated ", "");
+        report_final_placement_timing(placer_opts, analysis_opts,
+                                      *timing_info, *placement_delay_calc, is_flat);
     }
 
     sprintf(msg,
@@ -1169,6 +1506,9 @@ void try_place(const Netlist<>& net_list,
             costs.cost, costs.bb_cost, costs.timing_cost, width_fac);
     VTR_LOG("Placement cost: %g, bb_cost: %g, td_cost: %g, \n", costs.cost,
             costs.bb_cost, costs.timing_cost);
+    if (!placer_ctx.cost().congestion_map.empty()) {
+        VTR_LOG("Placement congestion_cost: %g\n", costs.congestion_cost);
+    }
     // print the noc costs info
     if (noc_opts.noc) {
         sprintf(msg,
@@ -1179,15 +1519,31 @@ void try_place(const Netlist<>& net_list,
     // Print out swap statistics
     print_resources_utilization();
 
-    print_placement_swaps_stats(state);
+    print_placement_swaps_stats(state, placer_ctx);
+
+    size_t total_swap_attempts = p_runtime_ctx.num_swap_rejected + p_runtime_ctx.num_swap_accepted + p_runtime_ctx.num_swap_aborted;
+    perf_metrics().set("place.moves_per_sec", total_swap_attempts / std::max(timer.elapsed_sec(), 1e-6f), e_perf_metric_type::WORK, true);
+    perf_metrics().set("place.bb_cost", costs.bb_cost, e_perf_metric_type::QOR);
+    if (placer_opts.place_algorithm.is_timing_driven()) {
+        perf_metrics().set("place.cpd_ns", 1e9 * critical_path.delay(), e_perf_metric_type::QOR);
+    }
 
     print_placement_move_types_stats(move_type_stat);
 
+    std::vector<t_memory_usage_entry> placement_memory_usage;
+    if (place_delay_model) {
+        placement_memory_usage.push_back({"Placement delay model", place_delay_model->memory_usage()});
+    }
+    if (timing_info) {
+        placement_memory_usage.push_back({"Placement timing tags", timing_info->analyzer()->memory_usage()});
+    }
+    report_memory_usage("Placement", placement_memory_usage);
+
     if (noc_opts.noc) {
         write_noc_placement_file(noc_opts.noc_placement_file_name);
     }
 
-    free_placement_structs(placer_opts, noc_opts);
+    free_placement_structs(placer_opts, noc_opts, placer_ctx);
     free_try_swap_arrays();
 
     print_timing_stats("Placement Quench", post_quench_timing_stats,
@@ -1195,15 +1551,129 @@ void try_place(const Netlist<>& net_list,
     print_timing_stats("Placement Total ", timing_ctx.stats,
                        pre_place_timing_stats);
 
+    VTR_LOG("Initial placement took %g seconds (%.1f%% of placement)\n",
+            initial_placement_elapsed_sec, 100 * initial_placement_elapsed_sec / std::max(timer.elapsed_sec(), 1e-6f));
+
     VTR_LOG("update_td_costs: connections %g nets %g sum_nets %g total %g\n",
             p_runtime_ctx.f_update_td_costs_connections_elapsed_sec,
             p_runtime_ctx.f_update_td_costs_nets_elapsed_sec,
             p_runtime_ctx.f_update_td_costs_sum_nets_elapsed_sec,
             p_runtime_ctx.f_update_td_costs_total_elapsed_sec);
+
+    if (placer_opts.place_timing_update_stats && placer_opts.place_algorithm.is_timing_driven()) {
+        size_t num_timing_nodes = timing_info->timing_graph()->nodes().size();
+        size_t num_timing_updates = std::max<size_t>(p_runtime_ctx.num_timing_updates, 1);
+        VTR_LOG("Placement timing updates: %zu, nodes updated per update: %.1f (%.2f%% of %zu), connections invalidated per update: %.1f\n",
+                p_runtime_ctx.num_timing_updates,
+                double(p_runtime_ctx.num_timing_nodes_updated) / num_timing_updates,
+                100. * p_runtime_ctx.num_timing_nodes_updated / (double(num_timing_updates) * std::max<size_t>(num_timing_nodes, 1)),
+                num_timing_nodes,
+                double(p_runtime_ctx.num_timing_connections_invalidated) / num_timing_updates);
+    }
+
+    t_place_result result;
+    result.bb_cost = costs.bb_cost;
+    if (placer_opts.place_algorithm.is_timing_driven()) {
+        result.cpd = critical_path.delay();
+    }
+    return result;
+}
+
+t_place_result load_placement_and_analyze(const Netlist<>& net_list,
+                                          const vtr::vector_map<ClusterBlockId, t_block_loc>& block_locs,
+                                          const t_placer_opts& placer_opts,
+                                          const t_analysis_opts& analysis_opts,
+                                          const t_noc_opts& noc_opts,
+                                          t_direct_inf* directs,
+                                          int num_directs,
+                                          const PlaceDelayModel* place_delay_model,
+                                          bool is_flat) {
+    VTR_ASSERT(!is_flat);
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& atom_ctx = g_vpr_ctx.atom();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+    PlacerContext& placer_ctx = g_placer_ctx;
+    const auto& p_timing_ctx = placer_ctx.timing();
+
+    //Resets the block locations, so they are loaded afterwards
+    alloc_and_load_placement_structs(placer_opts.place_cost_exp, placer_opts, noc_opts, directs, num_directs, placer_ctx);
+
+    place_ctx.block_locs = block_locs;
+    load_grid_blocks_from_block_locs();
+    for (auto block_id : cluster_ctx.clb_nlist.blocks()) {
+        place_sync_external_block_connections(block_id);
+    }
+
+    t_placer_costs costs(placer_opts.place_algorithm);
+    costs.bb_cost = place_ctx.cube_bb ? comp_bb_cost(NORMAL, placer_ctx) : comp_layer_bb_cost(NORMAL, placer_ctx);
+
+    t_place_result result;
+    result.bb_cost = costs.bb_cost;
+    perf_metrics().set("place.bb_cost", costs.bb_cost, e_perf_metric_type::QOR);
+
+    if (placer_opts.place_algorithm.is_timing_driven()) {
+        VTR_ASSERT(place_delay_model);
+        comp_td_connection_delays(place_delay_model);
+
+        IntraLbPbPinLookup pb_gpin_lookup(device_ctx.logical_block_types);
+        ClusteredPinAtomPinsLookup netlist_pin_lookup(cluster_ctx.clb_nlist,
+                                                      atom_ctx.nlist, pb_gpin_lookup);
+
+        auto placement_delay_calc = std::make_shared<PlacementDelayCalculator>(atom_ctx.nlist,
+                                                                               atom_ctx.lookup,
+                                                                               p_timing_ctx.analyzed_connection_delay,
+                                                                               is_flat);
+        placement_delay_calc->set_tsu_margin_relative(placer_opts.tsu_rel_margin);
+        placement_delay_calc->set_tsu_margin_absolute(placer_opts.tsu_abs_margin);
+
+        //A single analysis of the whole placement
+        std::shared_ptr<SetupTimingInfo> timing_info = make_setup_timing_info(placement_delay_calc,
+                                                                              e_timing_update_type::FULL);
+        PlacerSetupSlacks placer_setup_slacks(cluster_ctx.clb_nlist, netlist_pin_lookup);
+        PlacerCriticalities placer_criticalities(cluster_ctx.clb_nlist, netlist_pin_lookup);
+        std::unique_ptr<NetPinTimingInvalidator> pin_timing_invalidator = make_net_pin_timing_invalidator(
+            e_timing_update_type::FULL,
+            net_list,
+            netlist_pin_lookup,
+            atom_ctx.nlist,
+            atom_ctx.lookup,
+            *timing_info->timing_graph(),
+            is_flat,
+            placement_delay_calc.get());
+
+        PlaceCritParams crit_params;
+        crit_params.crit_exponent = placer_opts.td_place_exp_last;
+        crit_params.crit_limit = placer_opts.place_crit_limit;
+
+        initialize_timing_info(crit_params, place_delay_model, &placer_criticalities, &placer_setup_slacks,
+                               pin_timing_invalidator.get(), timing_info.get(), &costs);
+
+        report_final_placement_timing(placer_opts, analysis_opts,
+                                      *timing_info, *placement_delay_calc, is_flat);
+
+        result.cpd = timing_info->least_slack_critical_path().delay();
+        perf_metrics().set("place.cpd_ns", 1e9 * result.cpd, e_perf_metric_type::QOR);
+    }
+
+    if (noc_opts.noc) {
+        //The traffic flows are still routed for the last placement
+        reinitialize_noc_routing(noc_opts, costs);
+        VTR_LOG("NoC Placement Costs. noc_aggregate_bandwidth_cost: %g, noc_latency_cost: %g, noc_latency_constraints_cost: %d, \n",
+                costs.noc_aggregate_bandwidth_cost, costs.noc_latency_cost, get_number_of_traffic_flows_with_latency_cons_met());
+        write_noc_placement_file(noc_opts.noc_placement_file_name);
+    }
+
+    free_placement_structs(placer_opts, noc_opts, placer_ctx);
+
+    return result;
 }
 
-/* Function to update the setup slacks and criticalities before the inner loop of the annealing/quench */
-static void outer_loop_update_timing_info(const t_placer_opts& placer_opts,
+/* Function to update the setup slacks and criticalities before the inner loop of the annealing/quench. *
+ * If defer_timing_analysis is true, a due timing analysis is not run; true is returned instead, and   *
+ * the caller starts it in the background with start_background_timing_update(). The results of a     *
+ * previously started background analysis are applied first in any case.                              */
+static bool outer_loop_update_timing_info(const t_placer_opts& placer_opts,
                                           const t_noc_opts& noc_opts,
                                           t_placer_costs* costs,
                                           int num_connections,
@@ -1213,8 +1683,21 @@ static void outer_loop_update_timing_info(const t_placer_opts& placer_opts,
                                           PlacerCriticalities* criticalities,
                                           PlacerSetupSlacks* setup_slacks,
                                           NetPinTimingInvalidator* pin_timing_invalidator,
-                                          SetupTimingInfo* timing_info) {
+                                          SetupTimingInfo* timing_info,
+                                          bool defer_timing_analysis,
+                                          const PlacerContext& placer_ctx) {
+    bool timing_analysis_deferred = false;
     if (placer_opts.place_algorithm.is_timing_driven()) {
+        PlaceCritParams crit_params;
+        crit_params.crit_exponent = crit_exponent;
+        crit_params.crit_limit = placer_opts.place_crit_limit;
+
+        //The analysis started at the previous temperature
+        if (background_timing_update_pending()) {
+            finish_background_timing_update(crit_params, delay_model, criticalities,
+                                            setup_slacks, pin_timing_invalidator, timing_info, costs);
+        }
+
         /*at each temperature change we update these values to be used     */
         /*for normalizing the tradeoff between timing and wirelength (bb)  */
         if (*outer_crit_iter_count >= placer_opts.recompute_crit_iter
@@ -1225,13 +1708,13 @@ static void outer_loop_update_timing_info(const t_placer_opts& placer_opts,
             num_connections = std::max(num_connections, 1); //Avoid division by zero
             VTR_ASSERT(num_connections > 0);
 
-            PlaceCritParams crit_params;
-            crit_params.crit_exponent = crit_exponent;
-            crit_params.crit_limit = placer_opts.place_crit_limit;
-
-            //Update all timing related classes
-            perform_full_timing_update(crit_params, delay_model, criticalities,
-                                       setup_slacks, pin_timing_invalidator, timing_info, costs);
+            if (defer_timing_analysis) {
+                timing_analysis_deferred = true;
+            } else {
+                //Update all timing related classes
+                perform_full_timing_update(crit_params, delay_model, criticalities,
+                                           setup_slacks, pin_timing_invalidator, timing_info, costs);
+            }
 
             *outer_crit_iter_count = 0;
         }
@@ -1239,7 +1722,92 @@ static void outer_loop_update_timing_info(const t_placer_opts& placer_opts,
     }
 
     /* Update the cost normalization factors */
-    update_placement_cost_normalization_factors(costs, placer_opts, noc_opts);
+    update_placement_cost_normalization_factors(costs, placer_opts, noc_opts, placer_ctx);
+
+    return timing_analysis_deferred;
+}
+
+/* Writes the annealer state at the start of a temperature to an on-disk *
+ * checkpoint, which --place_resume continues from.                      */
+static void save_anneal_checkpoint(const std::string& file,
+                                   const t_annealing_state& state,
+                                   int tot_iter,
+                                   int moves_since_cost_recompute,
+                                   int outer_crit_iter_count,
+                                   e_agent_state agent_state,
+                                   const MoveGenerator& move_generator,
+                                   const MoveGenerator& move_generator2) {
+    vtr::Timer timer;
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    t_anneal_checkpoint checkpoint;
+    checkpoint.t = state.t;
+    checkpoint.restart_t = state.restart_t;
+    checkpoint.alpha = state.alpha;
+    checkpoint.rlim = state.rlim;
+    checkpoint.crit_exponent = state.crit_exponent;
+    checkpoint.num_temps = state.num_temps;
+    checkpoint.move_lim = state.move_lim;
+    checkpoint.move_lim_max = state.move_lim_max;
+
+    checkpoint.tot_iter = tot_iter;
+    checkpoint.moves_since_cost_recompute = moves_since_cost_recompute;
+    checkpoint.outer_crit_iter_count = outer_crit_iter_count;
+    checkpoint.agent_state = agent_state;
+    checkpoint.rand_state = vtr::get_random_state();
+
+    checkpoint.block_locs.reserve(cluster_ctx.clb_nlist.blocks().size());
+    for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+        checkpoint.block_locs.push_back(place_ctx.block_locs[blk_id].loc);
+    }
+    move_generator.save_state(checkpoint.move_generator_state);
+    move_generator2.save_state(checkpoint.move_generator2_state);
+
+    write_anneal_checkpoint(file, checkpoint);
+    VTR_LOG("Placement checkpoint written to '%s' (took %g seconds)\n", file.c_str(), timer.elapsed_sec());
+}
+
+/* Moves the blocks to their checkpointed locations */
+static void load_checkpoint_block_locs(const t_anneal_checkpoint& checkpoint) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    size_t iblk = 0;
+    for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+        place_ctx.block_locs[blk_id].loc = checkpoint.block_locs[iblk++];
+    }
+    load_grid_blocks_from_block_locs();
+}
+
+/* Restores the annealer state saved by save_anneal_checkpoint() */
+static void restore_anneal_checkpoint(const t_anneal_checkpoint& checkpoint,
+                                      t_annealing_state& state,
+                                      int& tot_iter,
+                                      int& moves_since_cost_recompute,
+                                      int& outer_crit_iter_count,
+                                      e_agent_state& agent_state,
+                                      MoveGenerator& move_generator,
+                                      MoveGenerator& move_generator2) {
+    state.t = checkpoint.t;
+    state.restart_t = checkpoint.restart_t;
+    state.alpha = checkpoint.alpha;
+    state.rlim = checkpoint.rlim;
+    state.crit_exponent = checkpoint.crit_exponent;
+    state.num_temps = checkpoint.num_temps;
+    state.move_lim = checkpoint.move_lim;
+    state.move_lim_max = checkpoint.move_lim_max;
+
+    tot_iter = checkpoint.tot_iter;
+    moves_since_cost_recompute = checkpoint.moves_since_cost_recompute;
+    outer_crit_iter_count = checkpoint.outer_crit_iter_count;
+    agent_state = e_agent_state(checkpoint.agent_state);
+    vtr::srandom(checkpoint.rand_state);
+
+    size_t istate = 0;
+    move_generator.restore_state(checkpoint.move_generator_state, istate);
+    istate = 0;
+    move_generator2.restore_state(checkpoint.move_generator2_state, istate);
 }
 
 /* Function which contains the inner loop of the simulated annealing */
@@ -1260,105 +1828,999 @@ static void placement_inner_loop(const t_annealing_state* state,
                                  SetupTimingInfo* timing_info,
                                  const t_place_algorithm& place_algorithm,
                                  MoveTypeStat& move_type_stat,
-                                 float timing_bb_factor) {
+                                 float timing_bb_factor,
+                                 t_parallel_anneal_state* parallel_anneal_state,
+                                 t_speculative_moves* speculative_moves,
+                                 PlacerContext& placer_ctx) {
+    auto& p_runtime_ctx = placer_ctx.mutable_runtime();
     int inner_crit_iter_count, inner_iter;
 
-    int inner_placement_save_count = 0; //How many times have we dumped placement to a file this temperature?
+    int inner_placement_save_count = 0; //How many times have we dumped placement to a file this temperature?
+
+    stats->reset();
+
+    inner_crit_iter_count = 1;
+
+    bool manual_move_enabled = false;
+
+    //Moves which can be confined to a region of the parallel annealer are made first, concurrently.
+    //The others are made by the serial loop below.
+    int num_serial_moves = state->move_lim;
+    //(Setup slack analysis updates the timing graph on every move, so can not be done concurrently.)
+    if (parallel_anneal_state && place_algorithm != SLACK_TIMING_PLACE) {
+        num_serial_moves = 0;
+        int moves_left = state->move_lim;
+        while (moves_left > 0) {
+            //As in the serial loop, criticalities are only updated every inner_recompute_limit moves
+            int num_moves = moves_left;
+            if (place_algorithm.is_timing_driven()) {
+                num_moves = std::min(moves_left, std::max(inner_recompute_limit, 1));
+            }
+
+            int num_deferred = placement_parallel_moves(state, placer_opts, num_moves, stats, costs,
+                                                        delay_model, criticalities,
+                                                        place_algorithm, *parallel_anneal_state, placer_ctx);
+            num_serial_moves += num_deferred;
+            moves_left -= num_moves;
+
+            if (place_algorithm.is_timing_driven() && moves_left > 0) {
+                PlaceCritParams crit_params;
+                crit_params.crit_exponent = state->crit_exponent;
+                crit_params.crit_limit = placer_opts.place_crit_limit;
+
+                perform_full_timing_update(crit_params, delay_model,
+                                           criticalities, setup_slacks, pin_timing_invalidator,
+                                           timing_info, costs);
+            }
+
+            *moves_since_cost_recompute += num_moves - num_deferred;
+            if (*moves_since_cost_recompute > MAX_MOVES_BEFORE_RECOMPUTE) {
+                recompute_costs_from_scratch(placer_opts, noc_opts, delay_model,
+                                             criticalities, costs, placer_ctx);
+                *moves_since_cost_recompute = 0;
+            }
+        }
+    }
+
+    //Setup slack analysis updates the timing graph on every move, so can not be speculative either
+    if (place_algorithm == SLACK_TIMING_PLACE) {
+        speculative_moves = nullptr;
+    }
+
+    /* Inner loop begins */
+    for (inner_iter = 0; inner_iter < num_serial_moves; inner_iter++) {
+        e_move_result swap_result;
+        if (speculative_moves) {
+            if (speculative_moves->outcomes.empty()) {
+                //A batch must not span a criticality update, since the candidates are evaluated up front
+                int num_moves = std::min<int>(speculative_moves->moves.size(), num_serial_moves - inner_iter);
+                if (place_algorithm.is_timing_driven()) {
+                    num_moves = std::min(num_moves, std::max(1, inner_recompute_limit - inner_crit_iter_count + 1));
+                }
+
+                placement_speculative_moves(state, stats, costs, move_generator,
+                                            delay_model, criticalities,
+                                            placer_opts, move_type_stat, place_algorithm,
+                                            timing_bb_factor, num_moves, *speculative_moves, placer_ctx);
+            }
+            swap_result = speculative_moves->outcomes.front();
+            speculative_moves->outcomes.pop_front();
+        } else {
+            swap_result = try_swap(state, costs, move_generator,
+                                   manual_move_generator, timing_info, pin_timing_invalidator,
+                                   blocks_affected, delay_model, criticalities, setup_slacks,
+                                   placer_opts, noc_opts, move_type_stat, place_algorithm,
+                                   timing_bb_factor, manual_move_enabled, placer_ctx);
+        }
+
+        if (swap_result == ACCEPTED) {
+            /* Move was accepted.  Update statistics that are useful for the annealing schedule. */
+            //(The statistics of speculative moves are updated as the batch is accepted, since
+            //costs already includes the whole batch.)
+            if (!speculative_moves) {
+                stats->single_swap_update(*costs);
+            }
+            p_runtime_ctx.num_swap_accepted++;
+        } else if (swap_result == ABORTED) {
+            p_runtime_ctx.num_swap_aborted++;
+        } else { // swap_result == REJECTED
+            p_runtime_ctx.num_swap_rejected++;
+        }
+
+        if (place_algorithm.is_timing_driven()) {
+            /* Do we want to re-timing analyze the circuit to get updated slack and criticality values?
+             * We do this only once in a while, since it is expensive.
+             */
+            if (inner_crit_iter_count >= inner_recompute_limit
+                && inner_iter != num_serial_moves - 1) { /*on last iteration don't recompute */
+
+                inner_crit_iter_count = 0;
+#ifdef VERBOSE
+                VTR_LOG("Inner loop recompute criticalities\n");
+#endif
+
+                PlaceCritParams crit_params;
+                crit_params.crit_exponent = state->crit_exponent;
+                crit_params.crit_limit = placer_opts.place_crit_limit;
+
+                //Update all timing related classes
+                perform_full_timing_update(crit_params, delay_model,
+                                           criticalities, setup_slacks, pin_timing_invalidator,
+                                           timing_info, costs);
+            }
+            inner_crit_iter_count++;
+        }
+#ifdef VERBOSE
+        VTR_LOG("t = %g  cost = %g   bb_cost = %g timing_cost = %g move = %d\n",
+                state->t, costs->cost, costs->bb_cost, costs->timing_cost, inner_iter);
+        if (fabs((costs->bb_cost) - comp_bb_cost(CHECK, placer_ctx)) > (costs->bb_cost) * ERROR_TOL)
+            VPR_ERROR(VPR_ERROR_PLACE, "bb_cost is %g, comp_bb_cost is %g\n", costs->bb_cost, comp_bb_cost(CHECK, placer_ctx));
+            //"fabs((*bb_cost) - comp_bb_cost(CHECK)) > (*bb_cost) * ERROR_TOL");
+#endif
+
+        /* Lines below prevent too much round-off error from accumulating
+         * in the cost over many iterations (due to incremental updates).
+         * This round-off can lead to error checks failing because the cost
+         * is different from what you get when you recompute from scratch.
+         */
+        ++(*moves_since_cost_recompute);
+        if (*moves_since_cost_recompute > MAX_MOVES_BEFORE_RECOMPUTE) {
+            //VTR_LOG("recomputing costs from scratch, old bb_cost is %g\n", costs->bb_cost);
+            recompute_costs_from_scratch(placer_opts, noc_opts, delay_model,
+                                         criticalities, costs, placer_ctx);
+            //VTR_LOG("new_bb_cost is %g\n", costs->bb_cost);
+            *moves_since_cost_recompute = 0;
+        }
+
+        if (placer_opts.placement_saves_per_temperature >= 1 && inner_iter > 0
+            && (inner_iter + 1)
+                       % (state->move_lim
+                          / placer_opts.placement_saves_per_temperature)
+                   == 0) {
+            std::string filename = vtr::string_fmt("placement_%03d_%03d.place",
+                                                   state->num_temps + 1, inner_placement_save_count);
+            VTR_LOG(
+                "Saving placement to file at temperature move %d / %d: %s\n",
+                inner_iter, state->move_lim, filename.c_str());
+            print_place(nullptr, nullptr, filename.c_str());
+            ++inner_placement_save_count;
+        }
+    }
+
+    /* Calculate the success_rate and std_dev of the costs. */
+    stats->calc_iteration_stats(*costs, state->move_lim);
+}
+
+/**
+ * @brief Returns the state of the parallel annealer, or nullptr if annealing is serial.
+ *
+ * The regions are laid out as close to square as the number of regions allows.
+ */
+static std::unique_ptr<t_parallel_anneal_state> alloc_parallel_anneal_state(const t_placer_opts& placer_opts,
+                                                                           const t_noc_opts& noc_opts) {
+    int num_regions = placer_opts.place_parallel_regions;
+    if (num_regions <= 1) {
+        return nullptr;
+    }
+
+    if (noc_opts.noc) {
+        //The NoC costs are shared by all the router blocks, wherever they are placed
+        VTR_LOG_WARN("Parallel annealing is not supported with NoC placement, annealing serially\n");
+        return nullptr;
+    }
+
+    if (placer_opts.place_congestion_weight > 0.) {
+        //The routing demand map is shared by all the nets, whichever region they are in
+        VTR_LOG_WARN("Parallel annealing is not supported with the placement congestion cost, annealing serially\n");
+        return nullptr;
+    }
+
+    auto anneal_state = alloc_anneal_regions(num_regions);
+
+    VTR_LOG("Annealing with %d (%d x %d) parallel regions\n", num_regions, anneal_state->num_x, anneal_state->num_y);
+
+    return anneal_state;
+}
+
+///@brief Returns a parallel annealer state with num_regions regions, laid out as close to square as possible.
+static std::unique_ptr<t_parallel_anneal_state> alloc_anneal_regions(int num_regions) {
+    auto anneal_state = std::make_unique<t_parallel_anneal_state>();
+
+    anneal_state->num_x = 1;
+    for (int num_x = 1; num_x * num_x <= num_regions; ++num_x) {
+        if (num_regions % num_x == 0) {
+            anneal_state->num_x = num_x;
+        }
+    }
+    anneal_state->num_y = num_regions / anneal_state->num_x;
+
+    const auto& grid = g_vpr_ctx.device().grid;
+    anneal_state->region_width = std::max<int>(1, grid.width() / anneal_state->num_x);
+    anneal_state->region_height = std::max<int>(1, grid.height() / anneal_state->num_y);
+
+    size_t num_nets = g_vpr_ctx.clustering().clb_nlist.nets().size();
+    anneal_state->regions.reserve(num_regions);
+    for (int iregion = 0; iregion < num_regions; ++iregion) {
+        anneal_state->regions.emplace_back(num_nets);
+    }
+    anneal_state->net_region.resize(num_nets, OPEN);
+
+    return anneal_state;
+}
+
+/**
+ * @brief Makes num_moves moves, concurrently in the regions of anneal_state.
+ *
+ * The moves are shared out between the regions in proportion to their number
+ * of movable blocks. The region costs, statistics and timing invalidations are
+ * merged (in region order) once all the regions are done.
+ *
+ * @return The number of moves which left their region and so were not made,
+ *         to be made by the serial annealer instead.
+ */
+static int placement_parallel_moves(const t_annealing_state* state,
+                                    const t_placer_opts& placer_opts,
+                                    int num_moves,
+                                    t_placer_statistics* stats,
+                                    t_placer_costs* costs,
+                                    const PlaceDelayModel* delay_model,
+                                    const PlacerCriticalities* criticalities,
+                                    const t_place_algorithm& place_algorithm,
+                                    t_parallel_anneal_state& anneal_state,
+                                    PlacerContext& placer_ctx) {
+    partition_anneal_regions(anneal_state);
+
+    size_t num_movable_blocks = 0;
+    for (const t_anneal_region& region : anneal_state.regions) {
+        num_movable_blocks += region.movable_blocks.size();
+    }
+    if (num_movable_blocks == 0) {
+        return num_moves;
+    }
+
+    int num_moves_left = num_moves;
+    for (t_anneal_region& region : anneal_state.regions) {
+        region.num_moves = size_t(num_moves) * region.movable_blocks.size() / num_movable_blocks;
+        num_moves_left -= region.num_moves;
+    }
+    //Share out the rounding remainder
+    for (size_t iregion = 0; num_moves_left > 0; iregion = (iregion + 1) % anneal_state.regions.size()) {
+        t_anneal_region& region = anneal_state.regions[iregion];
+        if (!region.movable_blocks.empty()) {
+            ++region.num_moves;
+            --num_moves_left;
+        }
+    }
+
+    reset_anneal_regions(anneal_state, *costs);
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), anneal_state.regions.size(), [&](size_t iregion) {
+        anneal_region(state, placer_opts, delay_model, criticalities, place_algorithm,
+                      anneal_state, iregion, anneal_state.regions[iregion], placer_ctx);
+    });
+#else
+    for (size_t iregion = 0; iregion < anneal_state.regions.size(); ++iregion) {
+        anneal_region(state, placer_opts, delay_model, criticalities, place_algorithm,
+                      anneal_state, iregion, anneal_state.regions[iregion], placer_ctx);
+    }
+#endif
+
+    return merge_anneal_regions(anneal_state, stats, costs, place_algorithm, placer_ctx);
+}
+
+///@brief Prepares the regions for a batch of moves starting from costs.
+static void reset_anneal_regions(t_parallel_anneal_state& anneal_state, const t_placer_costs& costs) {
+    //Seeded from the main random number sequence, so the result does not depend on the thread scheduling.
+    //Each region draws from its own stream, so the regions' sequences are independent.
+    for (size_t iregion = 0; iregion < anneal_state.regions.size(); ++iregion) {
+        t_anneal_region& region = anneal_state.regions[iregion];
+        region.rng.seed(vtr::irand(std::numeric_limits<int>::max() - 1), iregion);
+        region.rand_state = region.rng();
+        region.costs = costs;
+        region.stats.reset();
+        region.num_accepted = 0;
+        region.num_rejected = 0;
+        region.num_aborted = 0;
+        region.num_deferred = 0;
+        region.invalidated_pins.clear();
+    }
+}
+
+/**
+ * @brief Merges the costs, statistics and timing invalidations of the regions' moves (in region order).
+ *
+ * @return The number of moves deferred by the regions.
+ */
+static int merge_anneal_regions(const t_parallel_anneal_state& anneal_state,
+                                t_placer_statistics* stats,
+                                t_placer_costs* costs,
+                                const t_place_algorithm& place_algorithm,
+                                PlacerContext& placer_ctx) {
+    auto& p_runtime_ctx = placer_ctx.mutable_runtime();
+
+    int num_deferred = 0;
+    t_placer_costs start_costs = *costs;
+    for (const t_anneal_region& region : anneal_state.regions) {
+        costs->cost += region.costs.cost - start_costs.cost;
+        costs->bb_cost += region.costs.bb_cost - start_costs.bb_cost;
+        costs->timing_cost += region.costs.timing_cost - start_costs.timing_cost;
+        stats->merge(region.stats);
+
+        p_runtime_ctx.num_swap_accepted += region.num_accepted;
+        p_runtime_ctx.num_swap_rejected += region.num_rejected;
+        p_runtime_ctx.num_swap_aborted += region.num_aborted;
+        p_runtime_ctx.num_ts_called += region.num_accepted + region.num_rejected + region.num_aborted;
+        num_deferred += region.num_deferred;
+
+        if (place_algorithm.is_timing_driven()) {
+            for (ClusterPinId pin : region.invalidated_pins) {
+                invalidate_connection_delay(pin);
+            }
+        }
+    }
+
+    return num_deferred;
+}
+
+///@brief Cuts the device into regions at a new random offset, and finds the blocks and nets each region owns.
+static void partition_anneal_regions(t_parallel_anneal_state& anneal_state) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    anneal_state.offset_x = vtr::irand(anneal_state.region_width - 1);
+    anneal_state.offset_y = vtr::irand(anneal_state.region_height - 1);
+
+    for (t_anneal_region& region : anneal_state.regions) {
+        region.movable_blocks.clear();
+    }
+    for (ClusterBlockId blk : cluster_ctx.clb_nlist.blocks()) {
+        if (place_ctx.block_locs[blk].is_fixed) {
+            continue;
+        }
+        int imacro;
+        get_imacro_from_iblk(&imacro, blk, place_ctx.pl_macros);
+        if (imacro != -1) {
+            continue;
+        }
+        anneal_state.regions[anneal_state.region_of(place_ctx.block_locs[blk].loc)].movable_blocks.push_back(blk);
+    }
+
+    for (ClusterNetId net : cluster_ctx.clb_nlist.nets()) {
+        int net_region = OPEN;
+        for (ClusterPinId pin : cluster_ctx.clb_nlist.net_pins(net)) {
+            ClusterBlockId blk = cluster_ctx.clb_nlist.pin_block(pin);
+            int blk_region = anneal_state.region_of(place_ctx.block_locs[blk].loc);
+            if (net_region == OPEN) {
+                net_region = blk_region;
+            } else if (net_region != blk_region) {
+                net_region = OPEN;
+                break;
+            }
+        }
+        anneal_state.net_region[net] = net_region;
+    }
+}
+
+/**
+ * @brief Makes the moves of a region.
+ *
+ * Only touches the blocks and nets owned by the region (and the region itself),
+ * so may run concurrently with the other regions.
+ */
+static void anneal_region(const t_annealing_state* state,
+                          const t_placer_opts& placer_opts,
+                          const PlaceDelayModel* delay_model,
+                          const PlacerCriticalities* criticalities,
+                          const t_place_algorithm& place_algorithm,
+                          const t_parallel_anneal_state& anneal_state,
+                          int iregion,
+                          t_anneal_region& region,
+                          PlacerContext& placer_ctx) {
+    //The move generation routines use this thread's random number sequence
+    vtr::RandState thread_rand_state = vtr::get_random_state();
+    vtr::srandom(region.rand_state);
+
+    //The blocks to move are drawn up front, in bulk
+    if (region.num_moves > 0) {
+        region.block_draws.resize(region.num_moves);
+        region.rng.fill_irand(region.movable_blocks.size() - 1, region.block_draws.data(), region.num_moves);
+    }
+
+    for (int imove = 0; imove < region.num_moves; ++imove) {
+        bool deferred = false;
+        ClusterBlockId b_from = region.movable_blocks[region.block_draws[imove]];
+        e_move_result swap_result = try_region_swap(state, placer_opts, delay_model, criticalities,
+                                                    place_algorithm, anneal_state, iregion, region, b_from, deferred, placer_ctx);
+        if (deferred) {
+            ++region.num_deferred;
+        } else if (swap_result == ACCEPTED) {
+            region.stats.single_swap_update(region.costs);
+            ++region.num_accepted;
+        } else if (swap_result == ABORTED) {
+            ++region.num_aborted;
+        } else {
+            ++region.num_rejected;
+        }
+    }
+
+    vtr::srandom(thread_rand_state);
+}
+
+/**
+ * @brief Like try_swap(), but only for uniform single block moves (of b_from, one of the region's
+ *        movable blocks) which stay in the region.
+ *
+ * A move which would move a macro, change the tile type of a block or affect a net the
+ * region does not own is not made, and deferred is set. The location to is only chosen
+ * in the floorplan region of b_from, so the block swapped back from to is checked by
+ * try_region_move().
+ */
+static e_move_result try_region_swap(const t_annealing_state* state,
+                                     const t_placer_opts& placer_opts,
+                                     const PlaceDelayModel* delay_model,
+                                     const PlacerCriticalities* criticalities,
+                                     const t_place_algorithm& place_algorithm,
+                                     const t_parallel_anneal_state& anneal_state,
+                                     int iregion,
+                                     t_anneal_region& region,
+                                     ClusterBlockId b_from,
+                                     bool& deferred,
+                                     PlacerContext& placer_ctx) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    deferred = false;
+
+    t_pl_loc from = place_ctx.block_locs[b_from].loc;
+    t_pl_loc to;
+    if (!find_to_loc_uniform(cluster_ctx.clb_nlist.block_type(b_from), state->rlim, from, to, b_from)) {
+        return ABORTED;
+    }
+
+    return try_region_move(placer_opts, delay_model, criticalities, place_algorithm,
+                           anneal_state, iregion, region, b_from, to,
+                           [&](double delta_c) { return assess_swap(delta_c, state->t); },
+                           deferred,
+                           placer_ctx);
+}
+
+/**
+ * @brief Moves b_from (of the region) to the location to (swapping it with the block there, if any),
+ *        and keeps the move if accept(delta cost) returns ACCEPTED.
+ *
+ * A move which would move a macro, change the tile type of a block or affect a net the
+ * region does not own is not made, and deferred is set. A move which would take either
+ * block out of its floorplan region is aborted.
+ */
+template<typename AcceptFunc>
+static e_move_result try_region_move(const t_placer_opts& placer_opts,
+                                     const PlaceDelayModel* delay_model,
+                                     const PlacerCriticalities* criticalities,
+                                     const t_place_algorithm& place_algorithm,
+                                     const t_parallel_anneal_state& anneal_state,
+                                     int iregion,
+                                     t_anneal_region& region,
+                                     ClusterBlockId b_from,
+                                     const t_pl_loc& to,
+                                     const AcceptFunc& accept,
+                                     bool& deferred,
+                                     PlacerContext& placer_ctx) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& grid = g_vpr_ctx.device().grid;
+    t_pl_blocks_to_be_moved& blocks_affected = region.blocks_affected;
+    t_pl_loc from = place_ctx.block_locs[b_from].loc;
+
+    deferred = false;
+
+    //The other regions may be changing grid_blocks outside this region, so check the
+    //location is inside the region before looking at the block there
+    if (anneal_state.region_of(to) != iregion
+        || grid.get_physical_type({to.x, to.y, to.layer}) != grid.get_physical_type({from.x, from.y, from.layer})) {
+        deferred = true;
+        return ABORTED;
+    }
+
+    int imacro_to;
+    get_imacro_from_iblk(&imacro_to, place_ctx.grid_blocks.block_at_location(to), place_ctx.pl_macros);
+    if (imacro_to != -1) {
+        deferred = true;
+        return ABORTED;
+    }
+
+    e_create_move create_move_outcome = create_move(blocks_affected, b_from, to);
+    //Both b_from and the block it is swapped with must stay in their floorplan regions. Another
+    //parallel region would not make this move legal, so it is aborted rather than deferred
+    if (create_move_outcome == e_create_move::VALID && !floorplan_legal(blocks_affected)) {
+        create_move_outcome = e_create_move::ABORT;
+    }
+    if (create_move_outcome != e_create_move::VALID) {
+        clear_move_blocks(blocks_affected);
+        return ABORTED;
+    }
+
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks && !deferred; iblk++) {
+        for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(blocks_affected.moved_blocks[iblk].block_num)) {
+            ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(blk_pin);
+            if (!cluster_ctx.clb_nlist.net_is_ignored(net_id) && anneal_state.net_region[net_id] != iregion) {
+                deferred = true;
+                break;
+            }
+        }
+    }
+
+    e_move_result move_outcome = ABORTED;
+    if (blocks_affected.num_moved_blocks > 0 && !deferred) {
+        apply_move_blocks(blocks_affected);
+
+        double bb_delta_c = 0;
+        double timing_delta_c = 0;
+        int num_nets_affected = find_affected_nets_and_update_costs(
+            place_algorithm, delay_model, criticalities, blocks_affected,
+            bb_delta_c, timing_delta_c, region.nets_to_update, placer_ctx);
+
+        double delta_c;
+        if (place_algorithm == CRITICALITY_TIMING_PLACE) {
+            delta_c = (1 - placer_opts.timing_tradeoff) * bb_delta_c * region.costs.bb_cost_norm
+                      + placer_opts.timing_tradeoff * timing_delta_c * region.costs.timing_cost_norm;
+        } else {
+            VTR_ASSERT_SAFE(place_algorithm == BOUNDING_BOX_PLACE);
+            delta_c = bb_delta_c * region.costs.bb_cost_norm;
+        }
+
+        move_outcome = accept(delta_c);
+
+        if (move_outcome == ACCEPTED) {
+            region.costs.cost += delta_c;
+            region.costs.bb_cost += bb_delta_c;
+
+            if (place_algorithm == CRITICALITY_TIMING_PLACE) {
+                region.costs.timing_cost += timing_delta_c;
+
+                region.invalidated_pins.insert(region.invalidated_pins.end(),
+                                               blocks_affected.affected_pins.begin(),
+                                               blocks_affected.affected_pins.end());
+                commit_td_cost(blocks_affected, placer_ctx);
+            }
+
+            update_move_nets(num_nets_affected, place_ctx.cube_bb, region.nets_to_update, placer_ctx);
+            commit_move_blocks(blocks_affected);
+        } else {
+            reset_move_nets(num_nets_affected, region.nets_to_update, placer_ctx);
+            revert_move_blocks(blocks_affected);
+
+            if (place_algorithm == CRITICALITY_TIMING_PLACE) {
+                revert_td_cost(blocks_affected, placer_ctx);
+            }
+        }
+    }
+
+    clear_move_blocks(blocks_affected);
+    return move_outcome;
+}
+
+/* Returns true if the greedy refinement supports the placement costs. Otherwise warns that it is *
+ * skipped (or that the quench is run, if the refinement was to replace it) and returns false.   */
+static bool greedy_refine_supported(const t_placer_opts& placer_opts, const t_noc_opts& noc_opts) {
+    const char* unsupported = nullptr;
+    if (noc_opts.noc) {
+        //The NoC costs are shared by all the router blocks, wherever they are placed
+        unsupported = "NoC placement";
+    } else if (placer_opts.place_quench_algorithm == SLACK_TIMING_PLACE) {
+        unsupported = "the slack timing placer";
+    } else if (placer_opts.place_congestion_weight > 0.) {
+        unsupported = "the placement congestion cost";
+    }
+
+    if (unsupported) {
+        VTR_LOG_WARN("Greedy placement refinement is not supported with %s, %s\n", unsupported,
+                     placer_opts.place_greedy_refine_replace_quench ? "running the quench instead" : "skipping it");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Greedily refines the placement with --place_greedy_refine_passes passes of windowed swaps.
+ *
+ * Each pass cuts the device into regions, as the parallel annealer does (at a new random
+ * offset each pass), and refines the regions concurrently: every movable block of a region
+ * is tried at each location of the window around it, and the first move which reduces the
+ * cost is kept. The criticalities are updated after each pass. Stops early once a pass
+ * improves nothing, and reports the wirelength and critical path delay gained per second.
+ */
+static void placement_greedy_refine(const t_placer_opts& placer_opts,
+                                    const t_noc_opts& noc_opts,
+                                    const PlaceCritParams& crit_params,
+                                    t_placer_costs* costs,
+                                    const PlaceDelayModel* delay_model,
+                                    PlacerCriticalities* criticalities,
+                                    PlacerSetupSlacks* setup_slacks,
+                                    NetPinTimingInvalidator* pin_timing_invalidator,
+                                    SetupTimingInfo* timing_info,
+                                    PlacerContext& placer_ctx) {
+    const t_place_algorithm& place_algorithm = placer_opts.place_quench_algorithm;
+    //Only called if greedy_refine_supported(), noc_opts.noc is therefore off
+    VTR_ASSERT_SAFE(!noc_opts.noc);
+
+    vtr::ScopedStartFinishTimer timer("Greedy placement refinement");
+
+    int num_regions = placer_opts.place_parallel_regions > 1 ? placer_opts.place_parallel_regions : GREEDY_REFINE_REGIONS;
+    std::unique_ptr<t_parallel_anneal_state> anneal_state = alloc_anneal_regions(num_regions);
+
+    bool timing_driven = place_algorithm.is_timing_driven();
+    double start_bb_cost = costs->bb_cost;
+    double start_cpd = timing_driven ? timing_info->least_slack_critical_path().delay() : 0.;
+
+    for (int ipass = 0; ipass < placer_opts.place_greedy_refine_passes; ++ipass) {
+        partition_anneal_regions(*anneal_state);
+        reset_anneal_regions(*anneal_state, *costs);
+
+#ifdef VPR_USE_TBB
+        tbb::parallel_for(size_t(0), anneal_state->regions.size(), [&](size_t iregion) {
+            greedy_refine_region(placer_opts, delay_model, criticalities, place_algorithm,
+                                 *anneal_state, iregion, anneal_state->regions[iregion], placer_ctx);
+        });
+#else
+        for (size_t iregion = 0; iregion < anneal_state->regions.size(); ++iregion) {
+            greedy_refine_region(placer_opts, delay_model, criticalities, place_algorithm,
+                                 *anneal_state, iregion, anneal_state->regions[iregion], placer_ctx);
+        }
+#endif
+
+        t_placer_statistics stats;
+        stats.reset();
+        merge_anneal_regions(*anneal_state, &stats, costs, place_algorithm, placer_ctx);
+
+        int num_accepted = 0;
+        for (const t_anneal_region& region : anneal_state->regions) {
+            num_accepted += region.num_accepted;
+        }
+
+        if (timing_driven) {
+            perform_full_timing_update(crit_params, delay_model, criticalities, setup_slacks,
+                                       pin_timing_invalidator, timing_info, costs);
+        }
+        recompute_costs_from_scratch(placer_opts, noc_opts, delay_model, criticalities, costs, placer_ctx);
+
+        VTR_LOG("Greedy refinement pass %d: %d moves accepted, BB cost %g", ipass + 1, num_accepted, costs->bb_cost);
+        if (timing_driven) {
+            VTR_LOG(", CPD %g ns", 1e9 * timing_info->least_slack_critical_path().delay());
+        }
+        VTR_LOG("\n");
+
+        if (num_accepted == 0) {
+            break;
+        }
+    }
+
+    float elapsed_sec = std::max(timer.elapsed_sec(), 1e-6f);
+    double bb_gain = 100. * (start_bb_cost - costs->bb_cost) / std::max(start_bb_cost, 1e-12);
+    VTR_LOG("Greedy refinement improved the BB cost by %.3f%% (%.3f%% per second)", bb_gain, bb_gain / elapsed_sec);
+    if (timing_driven) {
+        double cpd_gain = 100. * (start_cpd - timing_info->least_slack_critical_path().delay()) / std::max(start_cpd, 1e-30);
+        VTR_LOG(" and the CPD by %.3f%% (%.3f%% per second)", cpd_gain, cpd_gain / elapsed_sec);
+    }
+    VTR_LOG("\n");
+}
+
+/**
+ * @brief Makes the greedy refinement moves of a region (see placement_greedy_refine()).
+ *
+ * The blocks and the locations of their windows are tried in a fixed order, so the
+ * outcome does not depend on the thread scheduling. Only touches the blocks and nets
+ * owned by the region, so may run concurrently with the other regions.
+ */
+static void greedy_refine_region(const t_placer_opts& placer_opts,
+                                 const PlaceDelayModel* delay_model,
+                                 const PlacerCriticalities* criticalities,
+                                 const t_place_algorithm& place_algorithm,
+                                 const t_parallel_anneal_state& anneal_state,
+                                 int iregion,
+                                 t_anneal_region& region,
+                                 PlacerContext& placer_ctx) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& grid = g_vpr_ctx.device().grid;
+
+    //Only strict improvements, so a block does not settle on the first equivalent location
+    auto improves = [](double delta_c) {
+        return delta_c < 0 ? ACCEPTED : REJECTED;
+    };
+
+    for (ClusterBlockId blk : region.movable_blocks) {
+        t_pl_loc from = place_ctx.block_locs[blk].loc;
+        t_physical_tile_type_ptr from_type = grid.get_physical_type({from.x, from.y, from.layer});
+        t_logical_block_type_ptr blk_type = cluster_ctx.clb_nlist.block_type(blk);
+
+        bool moved = false;
+        for (int dx = -GREEDY_REFINE_WINDOW; dx <= GREEDY_REFINE_WINDOW && !moved; ++dx) {
+            for (int dy = -GREEDY_REFINE_WINDOW; dy <= GREEDY_REFINE_WINDOW && !moved; ++dy) {
+                t_pl_loc to(from.x + dx, from.y + dy, 0, from.layer);
+                if (to.x < 0 || to.x >= int(grid.width()) || to.y < 0 || to.y >= int(grid.height())) {
+                    continue;
+                }
+
+                //Only look at the locations of this region, the other regions may be changing theirs
+                t_physical_tile_loc tile_loc(to.x, to.y, to.layer);
+                if (anneal_state.region_of(to) != iregion
+                    || grid.get_physical_type(tile_loc) != from_type
+                    || grid.get_width_offset(tile_loc) != 0
+                    || grid.get_height_offset(tile_loc) != 0) {
+                    continue;
+                }
+
+                for (to.sub_tile = 0; to.sub_tile < from_type->capacity && !moved; ++to.sub_tile) {
+                    if (to == from || !is_sub_tile_compatible(from_type, blk_type, to.sub_tile)) {
+                        continue;
+                    }
+
+                    bool deferred = false;
+                    e_move_result swap_result = try_region_move(placer_opts, delay_model, criticalities, place_algorithm,
+                                                                anneal_state, iregion, region, blk, to, improves, deferred, placer_ctx);
+                    if (deferred) {
+                        ++region.num_deferred;
+                    } else if (swap_result == ACCEPTED) {
+                        region.stats.single_swap_update(region.costs);
+                        ++region.num_accepted;
+                        moved = true;
+                    } else if (swap_result == ABORTED) {
+                        ++region.num_aborted;
+                    } else {
+                        ++region.num_rejected;
+                    }
+                }
+            }
+        }
+    }
+}
+
+///@brief Returns the state of the speculative annealer, or nullptr if moves are evaluated one at a time.
+static std::unique_ptr<t_speculative_moves> alloc_speculative_moves(const t_placer_opts& placer_opts,
+                                                                   const t_noc_opts& noc_opts) {
+    int num_candidates = placer_opts.place_speculative_moves;
+    if (num_candidates <= 1) {
+        return nullptr;
+    }
+
+    if (noc_opts.noc) {
+        //The NoC costs are shared by all the router blocks, so NoC moves are never independent
+        VTR_LOG_WARN("Speculative move evaluation is not supported with NoC placement, evaluating moves serially\n");
+        return nullptr;
+    }
+
+    if (placer_opts.place_congestion_weight > 0.) {
+        //Overlapping net bounding boxes share the tiles of the routing demand map
+        VTR_LOG_WARN("Speculative move evaluation is not supported with the placement congestion cost, evaluating moves serially\n");
+        return nullptr;
+    }
+
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    size_t num_blocks = cluster_ctx.clb_nlist.blocks().size();
+    size_t num_nets = cluster_ctx.clb_nlist.nets().size();
+
+    auto speculative_moves = std::make_unique<t_speculative_moves>();
+    speculative_moves->moves.reserve(num_candidates);
+    for (int imove = 0; imove < num_candidates; ++imove) {
+        speculative_moves->moves.emplace_back(num_blocks, num_nets);
+    }
+    speculative_moves->net_batch.resize(num_nets, 0);
+
+    VTR_LOG("Evaluating up to %d candidate moves concurrently\n", num_candidates);
+
+    return speculative_moves;
+}
+
+/**
+ * @brief Proposes, evaluates and accepts or rejects a batch of num_moves moves, like num_moves calls to try_swap().
+ *
+ * The outcome of each move is appended to speculative_moves.outcomes, and
+ * the statistics of the accepted moves are added to stats.
+ */
+static void placement_speculative_moves(const t_annealing_state* state,
+                                        t_placer_statistics* stats,
+                                        t_placer_costs* costs,
+                                        MoveGenerator& move_generator,
+                                        const PlaceDelayModel* delay_model,
+                                        PlacerCriticalities* criticalities,
+                                        const t_placer_opts& placer_opts,
+                                        MoveTypeStat& move_type_stat,
+                                        const t_place_algorithm& place_algorithm,
+                                        float timing_bb_factor,
+                                        int num_moves,
+                                        t_speculative_moves& speculative_moves,
+                                        PlacerContext& placer_ctx) {
+    auto& p_runtime_ctx = placer_ctx.mutable_runtime();
+    VTR_ASSERT(num_moves <= (int)speculative_moves.moves.size());
+
+    ++speculative_moves.batch;
+    speculative_moves.batch_locs.clear();
+
+    //Propose the candidates on the current placement
+    for (int imove = 0; imove < num_moves; ++imove) {
+        t_speculative_move& move = speculative_moves.moves[imove];
+        p_runtime_ctx.num_ts_called++;
+
+        float rlim;
+        if (placer_opts.rlim_escape_fraction > 0. && vtr::frand() < placer_opts.rlim_escape_fraction) {
+            rlim = std::numeric_limits<float>::infinity();
+        } else {
+            rlim = state->rlim;
+        }
+
+        auto propose_start = std::chrono::steady_clock::now();
+        move.proposed_action = {e_move_type::UNIFORM, -1};
+        move.create_move_outcome = move_generator.propose_move(move.blocks_affected, move.proposed_action, rlim, placer_opts, criticalities);
+        move.evaluate_time = 0;
+
+        if (move.proposed_action.logical_blk_type_index != -1) { //if the agent proposed the block type, then collect the block type stat
+            ++move_type_stat.blk_type_moves[(move.proposed_action.logical_blk_type_index * (placer_opts.place_static_move_prob.size())) + (int)move.proposed_action.move_type];
+            move_type_stat.propose_time[(move.proposed_action.logical_blk_type_index * (placer_opts.place_static_move_prob.size())) + (int)move.proposed_action.move_type] += std::chrono::duration<double>(std::chrono::steady_clock::now() - propose_start).count();
+        }
+
+        move.conflicting = move.create_move_outcome == e_create_move::VALID
+                           && speculative_move_conflicts(move.blocks_affected, speculative_moves);
+    }
+
+    //The independent candidates are all applied, so each sees the placement it would have
+    //been evaluated on if the earlier candidates had been made first
+    std::vector<int> independent_moves;
+    for (int imove = 0; imove < num_moves; ++imove) {
+        t_speculative_move& move = speculative_moves.moves[imove];
+        if (move.create_move_outcome == e_create_move::VALID && !move.conflicting) {
+            apply_move_blocks(move.blocks_affected);
+            independent_moves.push_back(imove);
+        }
+    }
+
+    auto evaluate_move = [&](int imove) {
+        t_speculative_move& move = speculative_moves.moves[imove];
+        auto evaluate_start = std::chrono::steady_clock::now();
+        move.bb_delta_c = 0;
+        move.timing_delta_c = 0;
+        move.num_nets_affected = find_affected_nets_and_update_costs(
+            place_algorithm, delay_model, criticalities, move.blocks_affected,
+            move.bb_delta_c, move.timing_delta_c, move.nets_to_update, placer_ctx);
+        move.evaluate_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - evaluate_start).count();
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), independent_moves.size(), [&](size_t i) {
+        evaluate_move(independent_moves[i]);
+    });
+#else
+    for (int imove : independent_moves) {
+        evaluate_move(imove);
+    }
+#endif
+
+    //Accept or reject the candidates in order
+    for (int imove = 0; imove < num_moves; ++imove) {
+        t_speculative_move& move = speculative_moves.moves[imove];
+        t_pl_blocks_to_be_moved& blocks_affected = move.blocks_affected;
+
+        MoveOutcomeStats move_outcome_stats;
+        e_move_result move_outcome = ABORTED;
+        double delta_c = 0;
+        auto commit_start = std::chrono::steady_clock::now();
+
+        if (move.create_move_outcome == e_create_move::VALID && !move.conflicting) {
+            if (place_algorithm == CRITICALITY_TIMING_PLACE) {
+                delta_c = (1 - placer_opts.timing_tradeoff) * move.bb_delta_c * costs->bb_cost_norm
+                          + placer_opts.timing_tradeoff * move.timing_delta_c * costs->timing_cost_norm;
+            } else {
+                VTR_ASSERT_SAFE(place_algorithm == BOUNDING_BOX_PLACE);
+                delta_c = move.bb_delta_c * costs->bb_cost_norm;
+            }
+
+            move_outcome = assess_swap(delta_c, state->t);
 
-    stats->reset();
+            if (move_outcome == ACCEPTED) {
+                costs->cost += delta_c;
+                costs->bb_cost += move.bb_delta_c;
 
-    inner_crit_iter_count = 1;
+                if (place_algorithm == CRITICALITY_TIMING_PLACE) {
+                    costs->timing_cost += move.timing_delta_c;
 
-    bool manual_move_enabled = false;
+                    invalidate_affected_connections(blocks_affected);
+                    commit_td_cost(blocks_affected, placer_ctx);
+                }
 
-    /* Inner loop begins */
-    for (inner_iter = 0; inner_iter < state->move_lim; inner_iter++) {
-        e_move_result swap_result = try_swap(state, costs, move_generator,
-                                             manual_move_generator, timing_info, pin_timing_invalidator,
-                                             blocks_affected, delay_model, criticalities, setup_slacks,
-                                             placer_opts, noc_opts, move_type_stat, place_algorithm,
-                                             timing_bb_factor, manual_move_enabled);
+                update_move_nets(move.num_nets_affected,
+                                 g_vpr_ctx.placement().cube_bb,
+                                 move.nets_to_update,
+                                 placer_ctx);
+                commit_move_blocks(blocks_affected);
 
-        if (swap_result == ACCEPTED) {
-            /* Move was accepted.  Update statistics that are useful for the annealing schedule. */
-            stats->single_swap_update(*costs);
-            num_swap_accepted++;
-        } else if (swap_result == ABORTED) {
-            num_swap_aborted++;
-        } else { // swap_result == REJECTED
-            num_swap_rejected++;
+                if (move.proposed_action.logical_blk_type_index != -1) {
+                    ++move_type_stat.accepted_moves[(move.proposed_action.logical_blk_type_index * (placer_opts.place_static_move_prob.size())) + (int)move.proposed_action.move_type];
+                }
+
+                stats->single_swap_update(*costs);
+            } else {
+                reset_move_nets(move.num_nets_affected, move.nets_to_update, placer_ctx);
+                revert_move_blocks(blocks_affected);
+
+                if (place_algorithm == CRITICALITY_TIMING_PLACE) {
+                    revert_td_cost(blocks_affected, placer_ctx);
+                }
+
+                if (move.proposed_action.logical_blk_type_index != -1) {
+                    ++move_type_stat.rejected_moves[(move.proposed_action.logical_blk_type_index * (placer_opts.place_static_move_prob.size())) + (int)move.proposed_action.move_type];
+                }
+            }
+
+            move_outcome_stats.delta_cost_norm = delta_c;
+            move_outcome_stats.delta_bb_cost_norm = move.bb_delta_c * costs->bb_cost_norm;
+            move_outcome_stats.delta_timing_cost_norm = move.timing_delta_c * costs->timing_cost_norm;
+            move_outcome_stats.delta_bb_cost_abs = move.bb_delta_c;
+            move_outcome_stats.delta_timing_cost_abs = move.timing_delta_c;
         }
+        move_outcome_stats.outcome = move_outcome;
 
-        if (place_algorithm.is_timing_driven()) {
-            /* Do we want to re-timing analyze the circuit to get updated slack and criticality values?
-             * We do this only once in a while, since it is expensive.
-             */
-            if (inner_crit_iter_count >= inner_recompute_limit
-                && inner_iter != state->move_lim - 1) { /*on last iteration don't recompute */
+        if (move.proposed_action.logical_blk_type_index != -1) {
+            move.evaluate_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - commit_start).count();
+            move_type_stat.evaluate_time[(move.proposed_action.logical_blk_type_index * (placer_opts.place_static_move_prob.size())) + (int)move.proposed_action.move_type] += move.evaluate_time;
+        }
 
-                inner_crit_iter_count = 0;
-#ifdef VERBOSE
-                VTR_LOG("Inner loop recompute criticalities\n");
-#endif
+        //Conflicting candidates are rewarded like aborted moves
+        calculate_reward_and_process_outcome(placer_opts, move_outcome_stats,
+                                             delta_c, timing_bb_factor, move_generator);
 
-                PlaceCritParams crit_params;
-                crit_params.crit_exponent = state->crit_exponent;
-                crit_params.crit_limit = placer_opts.place_crit_limit;
+        clear_move_blocks(blocks_affected);
+        speculative_moves.outcomes.push_back(move_outcome);
+    }
+}
 
-                //Update all timing related classes
-                perform_full_timing_update(crit_params, delay_model,
-                                           criticalities, setup_slacks, pin_timing_invalidator,
-                                           timing_info, costs);
+/**
+ * @brief Returns true if a candidate move touches a block, location or net of an earlier candidate of the batch.
+ *
+ * Otherwise records the locations and nets of the candidate.
+ */
+static bool speculative_move_conflicts(const t_pl_blocks_to_be_moved& blocks_affected,
+                                       t_speculative_moves& speculative_moves) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    //A block moved by two candidates vacates the same location in both
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; iblk++) {
+        const t_pl_moved_block& moved_block = blocks_affected.moved_blocks[iblk];
+        for (const t_pl_loc& loc : speculative_moves.batch_locs) {
+            if (loc == moved_block.old_loc || loc == moved_block.new_loc) {
+                return true;
             }
-            inner_crit_iter_count++;
         }
-#ifdef VERBOSE
-        VTR_LOG("t = %g  cost = %g   bb_cost = %g timing_cost = %g move = %d\n",
-                state->t, costs->cost, costs->bb_cost, costs->timing_cost, inner_iter);
-        if (fabs((costs->bb_cost) - comp_bb_cost(CHECK)) > (costs->bb_cost) * ERROR_TOL)
-            VPR_ERROR(VPR_ERROR_PLACE, "bb_cost is %g, comp_bb_cost is %g\n", costs->bb_cost, comp_bb_cost(CHECK));
-            //"fabs((*bb_cost) - comp_bb_cost(CHECK)) > (*bb_cost) * ERROR_TOL");
-#endif
+    }
 
-        /* Lines below prevent too much round-off error from accumulating
-         * in the cost over many iterations (due to incremental updates).
-         * This round-off can lead to error checks failing because the cost
-         * is different from what you get when you recompute from scratch.
-         */
-        ++(*moves_since_cost_recompute);
-        if (*moves_since_cost_recompute > MAX_MOVES_BEFORE_RECOMPUTE) {
-            //VTR_LOG("recomputing costs from scratch, old bb_cost is %g\n", costs->bb_cost);
-            recompute_costs_from_scratch(placer_opts, noc_opts, delay_model,
-                                         criticalities, costs);
-            //VTR_LOG("new_bb_cost is %g\n", costs->bb_cost);
-            *moves_since_cost_recompute = 0;
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; iblk++) {
+        for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(blocks_affected.moved_blocks[iblk].block_num)) {
+            ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(blk_pin);
+            if (!cluster_ctx.clb_nlist.net_is_ignored(net_id) && speculative_moves.net_batch[net_id] == speculative_moves.batch) {
+                return true;
+            }
         }
+    }
 
-        if (placer_opts.placement_saves_per_temperature >= 1 && inner_iter > 0
-            && (inner_iter + 1)
-                       % (state->move_lim
-                          / placer_opts.placement_saves_per_temperature)
-                   == 0) {
-            std::string filename = vtr::string_fmt("placement_%03d_%03d.place",
-                                                   state->num_temps + 1, inner_placement_save_count);
-            VTR_LOG(
-                "Saving placement to file at temperature move %d / %d: %s\n",
-                inner_iter, state->move_lim, filename.c_str());
-            print_place(nullptr, nullptr, filename.c_str());
-            ++inner_placement_save_count;
+    //Independent, so record what this candidate touches
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; iblk++) {
+        const t_pl_moved_block& moved_block = blocks_affected.moved_blocks[iblk];
+        speculative_moves.batch_locs.push_back(moved_block.old_loc);
+        speculative_moves.batch_locs.push_back(moved_block.new_loc);
+
+        for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(moved_block.block_num)) {
+            speculative_moves.net_batch[cluster_ctx.clb_nlist.pin_net(blk_pin)] = speculative_moves.batch;
         }
     }
 
-    /* Calculate the success_rate and std_dev of the costs. */
-    stats->calc_iteration_stats(*costs, state->move_lim);
+    return false;
 }
 
 static void recompute_costs_from_scratch(const t_placer_opts& placer_opts,
                                          const t_noc_opts& noc_opts,
                                          const PlaceDelayModel* delay_model,
                                          const PlacerCriticalities* criticalities,
-                                         t_placer_costs* costs) {
-    double new_bb_cost = recompute_bb_cost();
+                                         t_placer_costs* costs,
+                                         PlacerContext& placer_ctx) {
+    double new_bb_cost = recompute_bb_cost(placer_ctx);
     if (fabs(new_bb_cost - costs->bb_cost) > costs->bb_cost * ERROR_TOL) {
         std::string msg = vtr::string_fmt(
             "in recompute_costs_from_scratch: new_bb_cost = %g, old bb_cost = %g\n",
@@ -1386,6 +2848,22 @@ static void recompute_costs_from_scratch(const t_placer_opts& placer_opts,
         costs->cost = new_bb_cost * costs->bb_cost_norm;
     }
 
+    if (!placer_ctx.cost().congestion_map.empty()) {
+        double new_congestion_cost = comp_congestion_cost(placer_ctx);
+        //The congestion cost is often 0 (no overflow), where a relative tolerance would flag float round-off
+        if (fabs(new_congestion_cost - costs->congestion_cost) > std::max(costs->congestion_cost, 1.) * ERROR_TOL) {
+            std::string msg = vtr::string_fmt(
+                "in recompute_costs_from_scratch: new_congestion_cost = %g, old congestion_cost = %g, ERROR_TOL = %g\n",
+                new_congestion_cost, costs->congestion_cost, ERROR_TOL);
+            VPR_ERROR(VPR_ERROR_PLACE, msg.c_str());
+        }
+        costs->congestion_cost = new_congestion_cost;
+
+        if (placer_opts.place_algorithm == BOUNDING_BOX_PLACE) {
+            costs->cost += placer_opts.place_congestion_weight * new_congestion_cost * costs->bb_cost_norm;
+        }
+    }
+
     if (noc_opts.noc) {
         double new_noc_aggregate_bandwidth_cost = 0.;
         double new_noc_latency_cost = 0.;
@@ -1435,7 +2913,7 @@ static int count_connections() {
 }
 
 ///@brief Find the starting temperature for the annealing loop.
-static float starting_t(const t_annealing_state* state,
+static float starting_t(t_annealing_state* state,
                         t_placer_costs* costs,
                         t_annealing_sched annealing_sched,
                         const PlaceDelayModel* delay_model,
@@ -1448,7 +2926,9 @@ static float starting_t(const t_annealing_state* state,
                         t_pl_blocks_to_be_moved& blocks_affected,
                         const t_placer_opts& placer_opts,
                         const t_noc_opts& noc_opts,
-                        MoveTypeStat& move_type_stat) {
+                        MoveTypeStat& move_type_stat,
+                        PlacerContext& placer_ctx) {
+    auto& p_runtime_ctx = placer_ctx.mutable_runtime();
     if (annealing_sched.type == USER_SCHED) {
         return (annealing_sched.init_t);
     }
@@ -1465,6 +2945,15 @@ static float starting_t(const t_annealing_state* state,
     int move_lim = std::min(state->move_lim_max,
                             (int)cluster_ctx.clb_nlist.blocks().size());
 
+    /* The standard deviation of the cost of the initial placement's neighbours *
+     * is estimated well by far fewer moves than one per block.                 */
+    if (annealing_sched.fast_start) {
+        int sampled_move_lim = std::min(move_lim, std::max(FAST_START_MIN_INIT_T_MOVES,
+                                                           move_lim / FAST_START_INIT_T_MOVE_DIVISOR));
+        state->fast_start_moves_saved += move_lim - sampled_move_lim;
+        move_lim = sampled_move_lim;
+    }
+
     bool manual_move_enabled = false;
 
     for (int i = 0; i < move_lim; i++) {
@@ -1481,17 +2970,17 @@ static float starting_t(const t_annealing_state* state,
                                              manual_move_generator, timing_info, pin_timing_invalidator,
                                              blocks_affected, delay_model, criticalities, setup_slacks,
                                              placer_opts, noc_opts, move_type_stat, placer_opts.place_algorithm,
-                                             REWARD_BB_TIMING_RELATIVE_WEIGHT, manual_move_enabled);
+                                             REWARD_BB_TIMING_RELATIVE_WEIGHT, manual_move_enabled, placer_ctx);
 
         if (swap_result == ACCEPTED) {
             num_accepted++;
             av += costs->cost;
             sum_of_squares += costs->cost * costs->cost;
-            num_swap_accepted++;
+            p_runtime_ctx.num_swap_accepted++;
         } else if (swap_result == ABORTED) {
-            num_swap_aborted++;
+            p_runtime_ctx.num_swap_aborted++;
         } else {
-            num_swap_rejected++;
+            p_runtime_ctx.num_swap_rejected++;
         }
     }
 
@@ -1527,48 +3016,55 @@ static float starting_t(const t_annealing_state* state,
 }
 
 static void update_move_nets(int num_nets_affected,
-                             const bool cube_bb) {
+                             const bool cube_bb,
+                             const std::vector<ClusterNetId>& nets_to_update,
+                             PlacerContext& placer_ctx) {
     /* update net cost functions and reset flags. */
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_move_ctx = g_placer_ctx.mutable_move();
+    auto& place_move_ctx = placer_ctx.mutable_move();
 
     for (int inet_affected = 0; inet_affected < num_nets_affected;
          inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
+
+        bool is_large_net = cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET;
 
         if (cube_bb) {
-            place_move_ctx.bb_coords[net_id] = ts_bb_coord_new[net_id];
-        } else {
-            place_move_ctx.layer_bb_coords[net_id] = layer_ts_bb_coord_new[net_id];
+            place_move_ctx.bb_coords[net_id] = p_cost_ctx.ts_bb_coord_new[net_id];
+            if (is_large_net) {
+                place_move_ctx.bb_num_on_edges[net_id] = p_cost_ctx.ts_bb_edge_new[net_id];
+            }
         }
 
         for (int layer_num = 0; layer_num < g_vpr_ctx.device().grid.get_num_layers(); layer_num++) {
-            place_move_ctx.num_sink_pin_layer[size_t(net_id)][layer_num] = ts_layer_sink_pin_count[size_t(net_id)][layer_num];
-        }
-
-        if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET) {
-            if (cube_bb) {
-                place_move_ctx.bb_num_on_edges[net_id] = ts_bb_edge_new[net_id];
-            } else {
-                place_move_ctx.layer_bb_num_on_edges[net_id] = layer_ts_bb_edge_new[net_id];
+            place_move_ctx.num_sink_pin_layer[size_t(net_id)][layer_num] = p_cost_ctx.ts_layer_sink_pin_count[size_t(net_id)][layer_num];
+            if (!cube_bb) {
+                place_move_ctx.layer_bb_coords[size_t(net_id)][layer_num] = p_cost_ctx.layer_ts_bb_coord_new[size_t(net_id)][layer_num];
+                if (is_large_net) {
+                    place_move_ctx.layer_bb_num_on_edges[size_t(net_id)][layer_num] = p_cost_ctx.layer_ts_bb_edge_new[size_t(net_id)][layer_num];
+                }
             }
         }
 
-        net_cost[net_id] = proposed_net_cost[net_id];
+        p_cost_ctx.net_cost[net_id] = p_cost_ctx.proposed_net_cost[net_id];
 
         /* negative proposed_net_cost value is acting as a flag. */
-        proposed_net_cost[net_id] = -1;
-        bb_updated_before[net_id] = NOT_UPDATED_YET;
+        p_cost_ctx.proposed_net_cost[net_id] = -1;
+        p_cost_ctx.bb_updated_before[net_id] = NOT_UPDATED_YET;
     }
 }
 
-static void reset_move_nets(int num_nets_affected) {
+static void reset_move_nets(int num_nets_affected,
+                            const std::vector<ClusterNetId>& nets_to_update,
+                            PlacerContext& placer_ctx) {
     /* Reset the net cost function flags first. */
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     for (int inet_affected = 0; inet_affected < num_nets_affected;
          inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
-        proposed_net_cost[net_id] = -1;
-        bb_updated_before[net_id] = NOT_UPDATED_YET;
+        ClusterNetId net_id = nets_to_update[inet_affected];
+        p_cost_ctx.proposed_net_cost[net_id] = -1;
+        p_cost_ctx.bb_updated_before[net_id] = NOT_UPDATED_YET;
     }
 }
 
@@ -1603,12 +3099,15 @@ static e_move_result try_swap(const t_annealing_state* state,
                               MoveTypeStat& move_type_stat,
                               const t_place_algorithm& place_algorithm,
                               float timing_bb_factor,
-                              bool manual_move_enabled) {
+                              bool manual_move_enabled,
+                              PlacerContext& placer_ctx) {
     /* Picks some block and moves it to another spot.  If this spot is   *
      * occupied, switch the blocks.  Assess the change in cost function. *
      * rlim is the range limiter.                                        *
      * Returns whether the swap is accepted, rejected or aborted.        *
      * Passes back the new value of the cost functions.                  */
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
+    auto& p_runtime_ctx = placer_ctx.mutable_runtime();
 
     float rlim_escape_fraction = placer_opts.rlim_escape_fraction;
     float timing_tradeoff = placer_opts.timing_tradeoff;
@@ -1621,7 +3120,7 @@ static e_move_result try_swap(const t_annealing_state* state,
     // move type and block type chosen by the agent
     t_propose_action proposed_action{e_move_type::UNIFORM, -1};
 
-    num_ts_called++;
+    p_runtime_ctx.num_ts_called++;
 
     MoveOutcomeStats move_outcome_stats;
 
@@ -1649,6 +3148,8 @@ static e_move_result try_swap(const t_annealing_state* state,
 
     e_create_move create_move_outcome = e_create_move::ABORT;
 
+    auto propose_start = std::chrono::steady_clock::now();
+
     //When manual move toggle button is active, the manual move window asks the user for input.
     if (manual_move_enabled) {
 #ifndef NO_GRAPHICS
@@ -1663,8 +3164,11 @@ static e_move_result try_swap(const t_annealing_state* state,
         create_move_outcome = move_generator.propose_move(blocks_affected, proposed_action, rlim, placer_opts, criticalities);
     }
 
+    auto evaluate_start = std::chrono::steady_clock::now();
+
     if (proposed_action.logical_blk_type_index != -1) { //if the agent proposed the block type, then collect the block type stat
         ++move_type_stat.blk_type_moves[(proposed_action.logical_blk_type_index * (placer_opts.place_static_move_prob.size())) + (int)proposed_action.move_type];
+        move_type_stat.propose_time[(proposed_action.logical_blk_type_index * (placer_opts.place_static_move_prob.size())) + (int)proposed_action.move_type] += std::chrono::duration<double>(evaluate_start - propose_start).count();
     }
     LOG_MOVE_STATS_PROPOSED(t, blocks_affected);
 
@@ -1705,7 +3209,7 @@ static e_move_result try_swap(const t_annealing_state* state,
         //delays and timing costs and store them in proposed_* data structures.
         int num_nets_affected = find_affected_nets_and_update_costs(
             place_algorithm, delay_model, criticalities, blocks_affected,
-            bb_delta_c, timing_delta_c);
+            bb_delta_c, timing_delta_c, p_cost_ctx.ts_nets_to_update, placer_ctx);
 
         //For setup slack analysis, we first do a timing analysis to get the newest
         //slack values resulted from the proposed block moves. If the move turns out
@@ -1713,12 +3217,11 @@ static e_move_result try_swap(const t_annealing_state* state,
         //If rejected, we reject the proposed block moves and revert this timing analysis.
         if (place_algorithm == SLACK_TIMING_PLACE) {
             /* Invalidates timing of modified connections for incremental timing updates. */
-            invalidate_affected_connections(blocks_affected,
-                                            pin_timing_invalidator, timing_info);
+            invalidate_affected_connections(blocks_affected);
 
             /* Update the connection_timing_cost and connection_delay *
              * values from the temporary values.                      */
-            commit_td_cost(blocks_affected);
+            commit_td_cost(blocks_affected, placer_ctx);
 
             /* Update timing information. Since we are analyzing setup slacks,   *
              * we only update those values and keep the criticalities stale      *
@@ -1735,7 +3238,7 @@ static e_move_result try_swap(const t_annealing_state* state,
 
             /* Get the setup slack analysis cost */
             //TODO: calculate a weighted average of the slack cost and wiring cost
-            delta_c = analyze_setup_slack_cost(setup_slacks) * costs->timing_cost_norm;
+            delta_c = analyze_setup_slack_cost(setup_slacks, placer_ctx) * costs->timing_cost_norm;
         } else if (place_algorithm == CRITICALITY_TIMING_PLACE) {
             /* Take delta_c as a combination of timing and wiring cost. In
              * addition to `timing_tradeoff`, we normalize the cost values */
@@ -1760,6 +3263,13 @@ static e_move_result try_swap(const t_annealing_state* state,
             delta_c = bb_delta_c * costs->bb_cost_norm;
         }
 
+        double congestion_delta_c = 0; // change in the routing congestion cost
+        if (!p_cost_ctx.congestion_map.empty()) {
+            //The routing demand of the affected nets was staged by find_affected_nets_and_update_costs()
+            congestion_delta_c = p_cost_ctx.congestion_map.proposed_delta_cost();
+            delta_c += placer_opts.place_congestion_weight * congestion_delta_c * costs->bb_cost_norm;
+        }
+
         double noc_aggregate_bandwidth_delta_c = 0; // change in the NoC aggregate bandwidth cost
         double noc_latency_delta_c = 0;             // change in the NoC latency cost
         /* Update the NoC datastructure and costs*/
@@ -1799,17 +3309,23 @@ static e_move_result try_swap(const t_annealing_state* state,
                 /* Invalidates timing of modified connections for incremental *
                  * timing updates. These invalidations are accumulated for a  *
                  * big timing update in the outer loop.                       */
-                invalidate_affected_connections(blocks_affected,
-                                                pin_timing_invalidator, timing_info);
+                invalidate_affected_connections(blocks_affected);
 
                 /* Update the connection_timing_cost and connection_delay *
                  * values from the temporary values.                      */
-                commit_td_cost(blocks_affected);
+                commit_td_cost(blocks_affected, placer_ctx);
             }
 
             /* Update net cost functions and reset flags. */
             update_move_nets(num_nets_affected,
-                             g_vpr_ctx.placement().cube_bb);
+                             g_vpr_ctx.placement().cube_bb,
+                             p_cost_ctx.ts_nets_to_update,
+                             placer_ctx);
+
+            if (!p_cost_ctx.congestion_map.empty()) {
+                p_cost_ctx.congestion_map.commit_proposed();
+                costs->congestion_cost += congestion_delta_c;
+            }
 
             /* Update clb data structures since we kept the move. */
             commit_move_blocks(blocks_affected);
@@ -1835,7 +3351,11 @@ static e_move_result try_swap(const t_annealing_state* state,
             VTR_ASSERT_SAFE(move_outcome == REJECTED);
 
             /* Reset the net cost function flags first. */
-            reset_move_nets(num_nets_affected);
+            reset_move_nets(num_nets_affected, p_cost_ctx.ts_nets_to_update, placer_ctx);
+
+            if (!p_cost_ctx.congestion_map.empty()) {
+                p_cost_ctx.congestion_map.revert_proposed();
+            }
 
             /* Restore the place_ctx.block_locs data structures to their state before the move. */
             revert_move_blocks(blocks_affected);
@@ -1850,8 +3370,7 @@ static e_move_result try_swap(const t_annealing_state* state,
                 /* Re-invalidate the affected sink pins since the proposed *
                  * move is rejected, and the same blocks are reverted to   *
                  * their original positions.                               */
-                invalidate_affected_connections(blocks_affected,
-                                                pin_timing_invalidator, timing_info);
+                invalidate_affected_connections(blocks_affected);
 
                 /* Revert the timing update */
                 update_timing_classes(crit_params, timing_info, criticalities,
@@ -1864,7 +3383,7 @@ static e_move_result try_swap(const t_annealing_state* state,
 
             if (place_algorithm == CRITICALITY_TIMING_PLACE) {
                 /* Unstage the values stored in proposed_* data structures */
-                revert_td_cost(blocks_affected);
+                revert_td_cost(blocks_affected, placer_ctx);
             }
 
             if (proposed_action.logical_blk_type_index != -1) { //if the agent proposed the block type, then collect the block type stat
@@ -1890,11 +3409,15 @@ static e_move_result try_swap(const t_annealing_state* state,
     }
     move_outcome_stats.outcome = move_outcome;
 
-    // If we force a router block move then it was not proposed by the
-    // move generator so we should not calculate the reward and update
-    // the move generators status since this outcome is not a direct
-    // consequence of the move generator
-    if (!router_block_move) {
+    if (proposed_action.logical_blk_type_index != -1) {
+        move_type_stat.evaluate_time[(proposed_action.logical_blk_type_index * (placer_opts.place_static_move_prob.size())) + (int)proposed_action.move_type] += std::chrono::duration<double>(std::chrono::steady_clock::now() - evaluate_start).count();
+    }
+
+    // If we force a router block move, or the move was made manually in the
+    // graphics, then it was not proposed by the move generator so we should
+    // not calculate the reward and update the move generators status since
+    // this outcome is not a direct consequence of the move generator
+    if (!router_block_move && !manual_move_enabled) {
         calculate_reward_and_process_outcome(placer_opts, move_outcome_stats,
                                              delta_c, timing_bb_factor, move_generator);
     }
@@ -1912,7 +3435,7 @@ static e_move_result try_swap(const t_annealing_state* state,
 #if 0
     // Check that each accepted swap yields a valid placement. This will
     // greatly slow the placer, but can debug some issues.
-    check_place(*costs, delay_model, criticalities, place_algorithm, noc_opts);
+    check_place(*costs, delay_model, criticalities, place_algorithm, noc_opts, placer_ctx);
 #endif
     VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\t\tAfter move Place cost %f, bb_cost %f, timing cost %f\n", costs->cost, costs->bb_cost, costs->timing_cost);
     return move_outcome;
@@ -1977,7 +3500,10 @@ static int find_affected_nets_and_update_costs(
     const PlacerCriticalities* criticalities,
     t_pl_blocks_to_be_moved& blocks_affected,
     double& bb_delta_c,
-    double& timing_delta_c) {
+    double& timing_delta_c,
+    std::vector<ClusterNetId>& nets_to_update,
+    PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     VTR_ASSERT_SAFE(bb_delta_c == 0.);
     VTR_ASSERT_SAFE(timing_delta_c == 0.);
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -2002,19 +3528,19 @@ static int find_affected_nets_and_update_costs(
                 continue;
 
             /* Record effected nets */
-            record_affected_net(net_id, num_affected_nets);
+            record_affected_net(net_id, num_affected_nets, nets_to_update, placer_ctx);
 
             /* Update the net bounding boxes. */
             if (cube_bb) {
-                update_net_bb(net_id, blocks_affected, iblk, blk, blk_pin);
+                update_net_bb(net_id, blocks_affected, iblk, blk, blk_pin, placer_ctx);
             } else {
-                update_net_layer_bb(net_id, blocks_affected, iblk, blk, blk_pin);
+                update_net_layer_bb(net_id, blocks_affected, iblk, blk, blk_pin, placer_ctx);
             }
 
             if (place_algorithm.is_timing_driven()) {
                 /* Determine the change in connection delay and timing cost. */
                 update_td_delta_costs(delay_model, *criticalities, net_id,
-                                      blk_pin, blocks_affected, timing_delta_c);
+                                      blk_pin, blocks_affected, timing_delta_c, placer_ctx);
             }
         }
     }
@@ -2023,18 +3549,24 @@ static int find_affected_nets_and_update_costs(
      * boxes are up-to-date). The cost is only updated once per net. */
     for (int inet_affected = 0; inet_affected < num_affected_nets;
          inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
 
         if (cube_bb) {
-            proposed_net_cost[net_id] = get_net_cost(net_id,
-                                                     ts_bb_coord_new[net_id]);
+            p_cost_ctx.proposed_net_cost[net_id] = get_net_cost(net_id,
+                                                                p_cost_ctx.ts_bb_coord_new[net_id],
+                                                                placer_ctx);
         } else {
-            proposed_net_cost[net_id] = get_net_layer_cost(net_id,
-                                                           layer_ts_bb_coord_new[net_id],
-                                                           ts_layer_sink_pin_count[size_t(net_id)]);
+            p_cost_ctx.proposed_net_cost[net_id] = get_net_layer_cost(net_id,
+                                                                      p_cost_ctx.layer_ts_bb_coord_new[size_t(net_id)],
+                                                                      p_cost_ctx.ts_layer_sink_pin_count[size_t(net_id)],
+                                                                      placer_ctx);
         }
 
-        bb_delta_c += proposed_net_cost[net_id] - net_cost[net_id];
+        bb_delta_c += p_cost_ctx.proposed_net_cost[net_id] - p_cost_ctx.net_cost[net_id];
+
+        if (!p_cost_ctx.congestion_map.empty()) {
+            stage_net_routing_demand(net_id, placer_ctx.move().bb_coords[net_id], p_cost_ctx.ts_bb_coord_new[net_id], placer_ctx);
+        }
     }
 
     return num_affected_nets;
@@ -2042,15 +3574,18 @@ static int find_affected_nets_and_update_costs(
 
 ///@brief Record effected nets.
 static void record_affected_net(const ClusterNetId net,
-                                int& num_affected_nets) {
+                                int& num_affected_nets,
+                                std::vector<ClusterNetId>& nets_to_update,
+                                PlacerContext& placer_ctx) {
     /* Record effected nets. */
-    if (proposed_net_cost[net] < 0.) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
+    if (p_cost_ctx.proposed_net_cost[net] < 0.) {
         /* Net not marked yet. */
-        ts_nets_to_update[num_affected_nets] = net;
+        nets_to_update[num_affected_nets] = net;
         num_affected_nets++;
 
         /* Flag to say we've marked this net. */
-        proposed_net_cost[net] = 1.;
+        p_cost_ctx.proposed_net_cost[net] = 1.;
     }
 }
 
@@ -2064,16 +3599,18 @@ static void update_net_bb(const ClusterNetId net,
                           const t_pl_blocks_to_be_moved& blocks_affected,
                           int iblk,
                           const ClusterBlockId blk,
-                          const ClusterPinId blk_pin) {
+                          const ClusterPinId blk_pin,
+                          PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     if (cluster_ctx.clb_nlist.net_sinks(net).size() < SMALL_NET) {
         //For small nets brute-force bounding box update is faster
 
-        if (bb_updated_before[net] == NOT_UPDATED_YET) { //Only once per-net
+        if (p_cost_ctx.bb_updated_before[net] == NOT_UPDATED_YET) { //Only once per-net
             get_non_updateable_bb(net,
-                                  ts_bb_coord_new[net],
-                                  ts_layer_sink_pin_count[size_t(net)]);
+                                  p_cost_ctx.ts_bb_coord_new[net],
+                                  p_cost_ctx.ts_layer_sink_pin_count[size_t(net)]);
         }
     } else {
         //For large nets, update bounding box incrementally
@@ -2094,12 +3631,13 @@ static void update_net_bb(const ClusterNetId net,
             blocks_affected.moved_blocks[iblk].new_loc.y + pin_height_offset,
             blocks_affected.moved_blocks[iblk].new_loc.layer);
         update_bb(net,
-                  ts_bb_edge_new[net],
-                  ts_bb_coord_new[net],
-                  ts_layer_sink_pin_count[size_t(net)],
+                  p_cost_ctx.ts_bb_edge_new[net],
+                  p_cost_ctx.ts_bb_coord_new[net],
+                  p_cost_ctx.ts_layer_sink_pin_count[size_t(net)],
                   pin_old_loc,
                   pin_new_loc,
-                  src_pin);
+                  src_pin,
+                  placer_ctx);
     }
 }
 
@@ -2107,16 +3645,18 @@ static void update_net_layer_bb(const ClusterNetId net,
                                 const t_pl_blocks_to_be_moved& blocks_affected,
                                 int iblk,
                                 const ClusterBlockId blk,
-                                const ClusterPinId blk_pin) {
+                                const ClusterPinId blk_pin,
+                                PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     if (cluster_ctx.clb_nlist.net_sinks(net).size() < SMALL_NET) {
         //For small nets brute-force bounding box update is faster
 
-        if (bb_updated_before[net] == NOT_UPDATED_YET) { //Only once per-net
+        if (p_cost_ctx.bb_updated_before[net] == NOT_UPDATED_YET) { //Only once per-net
             get_non_updateable_layer_bb(net,
-                                        layer_ts_bb_coord_new[net],
-                                        ts_layer_sink_pin_count[size_t(net)]);
+                                        p_cost_ctx.layer_ts_bb_coord_new[size_t(net)],
+                                        p_cost_ctx.ts_layer_sink_pin_count[size_t(net)]);
         }
     } else {
         //For large nets, update bounding box incrementally
@@ -2137,12 +3677,13 @@ static void update_net_layer_bb(const ClusterNetId net,
             blocks_affected.moved_blocks[iblk].new_loc.layer);
         auto pin_dir = get_pin_type_from_pin_physical_num(blk_type, iblk_pin);
         update_layer_bb(net,
-                        layer_ts_bb_edge_new[net],
-                        layer_ts_bb_coord_new[net],
-                        ts_layer_sink_pin_count[size_t(net)],
+                        p_cost_ctx.layer_ts_bb_edge_new[size_t(net)],
+                        p_cost_ctx.layer_ts_bb_coord_new[size_t(net)],
+                        p_cost_ctx.ts_layer_sink_pin_count[size_t(net)],
                         pin_old_loc,
                         pin_new_loc,
-                        pin_dir == e_pin_type::DRIVER);
+                        pin_dir == e_pin_type::DRIVER,
+                        placer_ctx);
     }
 }
 
@@ -2180,21 +3721,29 @@ static void update_td_delta_costs(const PlaceDelayModel* delay_model,
                                   const ClusterNetId net,
                                   const ClusterPinId pin,
                                   t_pl_blocks_to_be_moved& blocks_affected,
-                                  double& delta_timing_cost) {
+                                  double& delta_timing_cost,
+                                  PlacerContext& placer_ctx) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
+    const auto& block_locs = g_vpr_ctx.placement().block_locs;
 
-    const auto& connection_delay = g_placer_ctx.timing().connection_delay;
-    auto& connection_timing_cost = g_placer_ctx.mutable_timing().connection_timing_cost;
-    auto& proposed_connection_delay = g_placer_ctx.mutable_timing().proposed_connection_delay;
-    auto& proposed_connection_timing_cost = g_placer_ctx.mutable_timing().proposed_connection_timing_cost;
+    const auto& connection_delay = placer_ctx.timing().connection_delay;
+    const auto& connection_delay_cache = placer_ctx.timing().connection_delay_cache;
+    auto& connection_timing_cost = placer_ctx.mutable_timing().connection_timing_cost;
+    auto& proposed_connection_delay = placer_ctx.mutable_timing().proposed_connection_delay;
+    auto& proposed_connection_timing_cost = placer_ctx.mutable_timing().proposed_connection_timing_cost;
 
     if (cluster_ctx.clb_nlist.pin_type(pin) == PinType::DRIVER) {
         /* This pin is a net driver on a moved block. */
         /* Recompute all point to point connection delays for the net sinks. */
+        static thread_local std::vector<float> net_delays;
+        if (connection_delay_cache.empty()) {
+            comp_td_net_connection_delays(delay_model, net, net_delays);
+        }
         for (size_t ipin = 1; ipin < cluster_ctx.clb_nlist.net_pins(net).size();
              ipin++) {
-            float temp_delay = comp_td_single_connection_delay(delay_model, net,
-                                                               ipin);
+            float temp_delay = connection_delay_cache.empty()
+                                   ? net_delays[ipin]
+                                   : comp_td_cached_connection_delay(delay_model, connection_delay_cache, block_locs, net, ipin);
             /* If the delay hasn't changed, do not mark this pin as affected */
             if (temp_delay == connection_delay[net][ipin]) {
                 continue;
@@ -2220,8 +3769,7 @@ static void update_td_delta_costs(const PlaceDelayModel* delay_model,
             /* Get the sink pin index in the net */
             int ipin = cluster_ctx.clb_nlist.pin_net_index(pin);
 
-            float temp_delay = comp_td_single_connection_delay(delay_model, net,
-                                                               ipin);
+            float temp_delay = comp_td_cached_connection_delay(delay_model, connection_delay_cache, block_locs, net, ipin);
             /* If the delay hasn't changed, do not mark this pin as affected */
             if (temp_delay == connection_delay[net][ipin]) {
                 return;
@@ -2252,7 +3800,7 @@ static void update_td_delta_costs(const PlaceDelayModel* delay_model,
  * @param placer_opts Determines the placement mode
  * @param noc_opts Determines if placement includes the NoC
  */
-static void update_placement_cost_normalization_factors(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts) {
+static void update_placement_cost_normalization_factors(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts, const PlacerContext& placer_ctx) {
     /* Update the cost normalization factors */
     costs->update_norm_factors();
 
@@ -2262,7 +3810,7 @@ static void update_placement_cost_normalization_factors(t_placer_costs* costs, c
     }
 
     // update the current total placement cost
-    costs->cost = get_total_cost(costs, placer_opts, noc_opts);
+    costs->cost = get_total_cost(costs, placer_opts, noc_opts, placer_ctx);
 
     return;
 }
@@ -2277,7 +3825,7 @@ static void update_placement_cost_normalization_factors(t_placer_costs* costs, c
  * @param noc_opts Determines if placement includes the NoC
  * @return double The computed total cost of the current placement
  */
-static double get_total_cost(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts) {
+static double get_total_cost(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts, const PlacerContext& placer_ctx) {
     double total_cost = 0.0;
 
     if (placer_opts.place_algorithm == BOUNDING_BOX_PLACE) {
@@ -2288,6 +3836,11 @@ static double get_total_cost(t_placer_costs* costs, const t_placer_opts& placer_
         total_cost = (1 - placer_opts.timing_tradeoff) * (costs->bb_cost * costs->bb_cost_norm) + (placer_opts.timing_tradeoff) * (costs->timing_cost * costs->timing_cost_norm);
     }
 
+    if (!placer_ctx.cost().congestion_map.empty()) {
+        // the congestion cost is normalized like the wiring cost
+        total_cost += placer_opts.place_congestion_weight * costs->congestion_cost * costs->bb_cost_norm;
+    }
+
     if (noc_opts.noc) {
         // in noc mode we include noc agggregate bandwidth and noc latency
         total_cost += (noc_opts.noc_placement_weighting) * ((costs->noc_aggregate_bandwidth_cost * costs->noc_aggregate_bandwidth_cost_norm) + (costs->noc_latency_cost * costs->noc_latency_cost_norm));
@@ -2314,11 +3867,11 @@ static double get_total_cost(t_placer_costs* costs, const t_placer_opts& placer_
  * value suddenly got very good due to the block move, while a good slack value
  * got very bad, perhaps even worse than the original worse slack value.
  */
-static float analyze_setup_slack_cost(const PlacerSetupSlacks* setup_slacks) {
+static float analyze_setup_slack_cost(const PlacerSetupSlacks* setup_slacks, const PlacerContext& placer_ctx) {
     const auto& cluster_ctx = g_vpr_ctx.clustering();
     const auto& clb_nlist = cluster_ctx.clb_nlist;
 
-    const auto& p_timing_ctx = g_placer_ctx.timing();
+    const auto& p_timing_ctx = placer_ctx.timing();
     const auto& connection_setup_slack = p_timing_ctx.connection_setup_slack;
 
     //Find the original/proposed setup slacks of pins with modified values
@@ -2377,10 +3930,11 @@ static e_move_result assess_swap(double delta_c, double t) {
     return REJECTED;
 }
 
-static double recompute_bb_cost() {
+static double recompute_bb_cost(PlacerContext& placer_ctx) {
     /* Recomputes the cost to eliminate roundoff that may have accrued.  *
      * This routine does as little work as possible to compute this new  *
      * cost.                                                             */
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
 
     double cost = 0;
 
@@ -2389,7 +3943,7 @@ static double recompute_bb_cost() {
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {       /* for each net ... */
         if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
             /* Bounding boxes don't have to be recomputed; they're correct. */
-            cost += net_cost[net_id];
+            cost += p_cost_ctx.net_cost[net_id];
         }
     }
 
@@ -2403,11 +3957,11 @@ static double recompute_bb_cost() {
  * All the connections have already been gathered by blocks_affected.affected_pins
  * after running the routine find_affected_nets_and_update_costs() in try_swap().
  */
-static void commit_td_cost(const t_pl_blocks_to_be_moved& blocks_affected) {
+static void commit_td_cost(const t_pl_blocks_to_be_moved& blocks_affected, PlacerContext& placer_ctx) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& clb_nlist = cluster_ctx.clb_nlist;
 
-    auto& p_timing_ctx = g_placer_ctx.mutable_timing();
+    auto& p_timing_ctx = placer_ctx.mutable_timing();
     auto& connection_delay = p_timing_ctx.connection_delay;
     auto& proposed_connection_delay = p_timing_ctx.proposed_connection_delay;
     auto& connection_timing_cost = p_timing_ctx.connection_timing_cost;
@@ -2428,16 +3982,17 @@ static void commit_td_cost(const t_pl_blocks_to_be_moved& blocks_affected) {
 
 //Reverts modifications to proposed_connection_delay and proposed_connection_timing_cost based on
 //the move proposed in blocks_affected
-static void revert_td_cost(const t_pl_blocks_to_be_moved& blocks_affected) {
+static void revert_td_cost(const t_pl_blocks_to_be_moved& blocks_affected, PlacerContext& placer_ctx) {
 #ifndef VTR_ASSERT_SAFE_ENABLED
     static_cast<void>(blocks_affected);
+    static_cast<void>(placer_ctx);
 #else
     //Invalidate temp delay & timing cost values to match sanity checks in
     //comp_td_connection_cost()
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& clb_nlist = cluster_ctx.clb_nlist;
 
-    auto& p_timing_ctx = g_placer_ctx.mutable_timing();
+    auto& p_timing_ctx = placer_ctx.mutable_timing();
     auto& proposed_connection_delay = p_timing_ctx.proposed_connection_delay;
     auto& proposed_connection_timing_cost = p_timing_ctx.proposed_connection_timing_cost;
 
@@ -2456,19 +4011,14 @@ static void revert_td_cost(const t_pl_blocks_to_be_moved& blocks_affected) {
  * All the connections recorded in blocks_affected.affected_pins have different
  * values for `proposed_connection_delay` and `connection_delay`.
  *
- * Invalidate all the timing graph edges associated with these connections via
- * the NetPinTimingInvalidator class.
+ * The timing graph edges associated with these connections are invalidated via
+ * the NetPinTimingInvalidator class at the next timing update, if their delay
+ * then differs from the last timing analysis (see invalidate_connection_delay()).
  */
-static void invalidate_affected_connections(
-    const t_pl_blocks_to_be_moved& blocks_affected,
-    NetPinTimingInvalidator* pin_tedges_invalidator,
-    TimingInfo* timing_info) {
-    VTR_ASSERT_SAFE(timing_info);
-    VTR_ASSERT_SAFE(pin_tedges_invalidator);
-
+static void invalidate_affected_connections(const t_pl_blocks_to_be_moved& blocks_affected) {
     /* Invalidate timing graph edges affected by the move */
     for (ClusterPinId pin : blocks_affected.affected_pins) {
-        pin_tedges_invalidator->invalidate_connection(pin, timing_info);
+        invalidate_connection_delay(pin);
     }
 }
 
@@ -2495,34 +4045,55 @@ static bool driven_by_moved_block(const ClusterNetId net,
  * are found via the non_updateable_bb routine, to provide a    *
  * cost which can be used to check the correctness of the       *
  * other routine.                                               */
-static double comp_bb_cost(e_cost_methods method) {
-    double cost = 0;
-    double expected_wirelength = 0.0;
+static double comp_bb_cost(e_cost_methods method, PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_move_ctx = g_placer_ctx.mutable_move();
+    auto& place_move_ctx = placer_ctx.mutable_move();
+    auto nets = cluster_ctx.clb_nlist.nets();
+
+    /* Each net only writes its own bounding box and cost, so the nets are *
+     * independent of each other.                                          */
+    auto comp_net_bb_cost = [&](ClusterNetId net_id) {
+        /* Small nets don't use incremental updating on their bounding boxes, *
+         * so they can use a fast bounding box calculator.                    */
+        if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET
+            && method == NORMAL) {
+            get_bb_from_scratch(net_id,
+                                place_move_ctx.bb_coords[net_id],
+                                place_move_ctx.bb_num_on_edges[net_id],
+                                place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
+        } else {
+            get_non_updateable_bb(net_id,
+                                  place_move_ctx.bb_coords[net_id],
+                                  place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
+        }
 
-    for (auto net_id : cluster_ctx.clb_nlist.nets()) {       /* for each net ... */
-        if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
-            /* Small nets don't use incremental updating on their bounding boxes, *
-             * so they can use a fast bounding box calculator.                    */
-            if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET
-                && method == NORMAL) {
-                get_bb_from_scratch(net_id,
-                                    place_move_ctx.bb_coords[net_id],
-                                    place_move_ctx.bb_num_on_edges[net_id],
-                                    place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
-            } else {
-                get_non_updateable_bb(net_id,
-                                      place_move_ctx.bb_coords[net_id],
-                                      place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
+        p_cost_ctx.net_cost[net_id] = get_net_cost(net_id, place_move_ctx.bb_coords[net_id], placer_ctx);
+    };
+
+    /* The [cost, expected wirelength] of the nets, summed in a fixed order so  *
+     * that the cost does not depend on the number of threads.                  */
+    auto sums = vtr::parallel_reduce_deterministic(
+        0, nets.size(), std::make_pair(0., 0.),
+        [&](size_t first, size_t last) {
+            std::pair<double, double> chunk_sums(0., 0.);
+            for (size_t inet = first; inet < last; ++inet) {
+                ClusterNetId net_id = *(nets.begin() + inet);
+                if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
+                    continue;
+                }
+                comp_net_bb_cost(net_id);
+                chunk_sums.first += p_cost_ctx.net_cost[net_id];
+                if (method == CHECK)
+                    chunk_sums.second += get_net_wirelength_estimate(net_id, place_move_ctx.bb_coords[net_id]);
             }
-
-            net_cost[net_id] = get_net_cost(net_id, place_move_ctx.bb_coords[net_id]);
-            cost += net_cost[net_id];
-            if (method == CHECK)
-                expected_wirelength += get_net_wirelength_estimate(net_id, place_move_ctx.bb_coords[net_id]);
-        }
-    }
+            return chunk_sums;
+        },
+        [](std::pair<double, double> lhs, const std::pair<double, double>& rhs) {
+            return std::make_pair(lhs.first + rhs.first, lhs.second + rhs.second);
+        });
+    double cost = sums.first;
+    double expected_wirelength = sums.second;
 
     if (method == CHECK) {
         VTR_LOG("\n");
@@ -2532,11 +4103,12 @@ static double comp_bb_cost(e_cost_methods method) {
     return cost;
 }
 
-static double comp_layer_bb_cost(e_cost_methods method) {
+static double comp_layer_bb_cost(e_cost_methods method, PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     double cost = 0;
     double expected_wirelength = 0.0;
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_move_ctx = g_placer_ctx.mutable_move();
+    auto& place_move_ctx = placer_ctx.mutable_move();
 
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {       /* for each net ... */
         if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
@@ -2545,22 +4117,23 @@ static double comp_layer_bb_cost(e_cost_methods method) {
             if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET
                 && method == NORMAL) {
                 get_layer_bb_from_scratch(net_id,
-                                          place_move_ctx.layer_bb_num_on_edges[net_id],
-                                          place_move_ctx.layer_bb_coords[net_id],
+                                          place_move_ctx.layer_bb_num_on_edges[size_t(net_id)],
+                                          place_move_ctx.layer_bb_coords[size_t(net_id)],
                                           place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
             } else {
                 get_non_updateable_layer_bb(net_id,
-                                            place_move_ctx.layer_bb_coords[net_id],
+                                            place_move_ctx.layer_bb_coords[size_t(net_id)],
                                             place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
             }
 
-            net_cost[net_id] = get_net_layer_cost(net_id,
-                                                  place_move_ctx.layer_bb_coords[net_id],
-                                                  place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
-            cost += net_cost[net_id];
+            p_cost_ctx.net_cost[net_id] = get_net_layer_cost(net_id,
+                                                             place_move_ctx.layer_bb_coords[size_t(net_id)],
+                                                             place_move_ctx.num_sink_pin_layer[size_t(net_id)],
+                                                             placer_ctx);
+            cost += p_cost_ctx.net_cost[net_id];
             if (method == CHECK)
                 expected_wirelength += get_net_layer_wirelength_estimate(net_id,
-                                                                         place_move_ctx.layer_bb_coords[net_id],
+                                                                         place_move_ctx.layer_bb_coords[size_t(net_id)],
                                                                          place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
         }
     }
@@ -2579,7 +4152,9 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
                                              const t_placer_opts& placer_opts,
                                              const t_noc_opts& noc_opts,
                                              t_direct_inf* directs,
-                                             int num_directs) {
+                                             int num_directs,
+                                             PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     int max_pins_per_clb;
     unsigned int ipin;
 
@@ -2589,8 +4164,8 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
 
     const auto& cube_bb = place_ctx.cube_bb;
 
-    auto& p_timing_ctx = g_placer_ctx.mutable_timing();
-    auto& place_move_ctx = g_placer_ctx.mutable_move();
+    auto& p_timing_ctx = placer_ctx.mutable_timing();
+    auto& place_move_ctx = placer_ctx.mutable_move();
 
     size_t num_nets = cluster_ctx.clb_nlist.nets().size();
 
@@ -2607,10 +4182,12 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
         /* Allocate structures associated with timing driven placement */
         /* [0..cluster_ctx.clb_nlist.nets().size()-1][1..num_pins-1]  */
 
-        p_timing_ctx.connection_delay = make_net_pins_matrix<float>(
-            (const Netlist<>&)cluster_ctx.clb_nlist, 0.f);
+        p_timing_ctx.connection_delay = make_net_pins_matrix<float, ParentNetId>(
+            cluster_ctx.clb_nlist, 0.f);
         p_timing_ctx.proposed_connection_delay = make_net_pins_matrix<float>(
             cluster_ctx.clb_nlist, 0.f);
+        p_timing_ctx.analyzed_connection_delay = make_net_pins_matrix<float, ParentNetId>(
+            cluster_ctx.clb_nlist, std::numeric_limits<float>::quiet_NaN());
 
         p_timing_ctx.connection_setup_slack = make_net_pins_matrix<float>(
             cluster_ctx.clb_nlist, std::numeric_limits<float>::infinity());
@@ -2637,32 +4214,34 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
         }
     }
 
-    net_cost.resize(num_nets, -1.);
-    proposed_net_cost.resize(num_nets, -1.);
+    p_cost_ctx.net_cost.resize(num_nets, -1.);
+    p_cost_ctx.proposed_net_cost.resize(num_nets, -1.);
 
     if (cube_bb) {
         place_move_ctx.bb_coords.resize(num_nets, t_bb());
         place_move_ctx.bb_num_on_edges.resize(num_nets, t_bb());
     } else {
         VTR_ASSERT_SAFE(!cube_bb);
-        place_move_ctx.layer_bb_num_on_edges.resize(num_nets, std::vector<t_2D_bb>(num_layers, t_2D_bb()));
-        place_move_ctx.layer_bb_coords.resize(num_nets, std::vector<t_2D_bb>(num_layers, t_2D_bb()));
+        place_move_ctx.layer_bb_num_on_edges.resize({num_nets, size_t(num_layers)}, t_2D_bb());
+        place_move_ctx.layer_bb_coords.resize({num_nets, size_t(num_layers)}, t_2D_bb());
     }
 
     place_move_ctx.num_sink_pin_layer.resize({num_nets, size_t(num_layers)});
-    for (size_t flat_idx = 0; flat_idx < ts_layer_sink_pin_count.size(); flat_idx++) {
-        auto& elem = ts_layer_sink_pin_count.get(flat_idx);
+    for (size_t flat_idx = 0; flat_idx < p_cost_ctx.ts_layer_sink_pin_count.size(); flat_idx++) {
+        auto& elem = p_cost_ctx.ts_layer_sink_pin_count.get(flat_idx);
         elem = OPEN;
     }
 
     /* Used to store costs for moves not yet made and to indicate when a net's   *
      * cost has been recomputed. proposed_net_cost[inet] < 0 means net's cost hasn't *
      * been recomputed.                                                          */
-    bb_updated_before.resize(num_nets, NOT_UPDATED_YET);
+    p_cost_ctx.bb_updated_before.resize(num_nets, NOT_UPDATED_YET);
+
+    alloc_and_load_for_fast_cost_update(place_cost_exp, placer_ctx);
 
-    alloc_and_load_for_fast_cost_update(place_cost_exp);
+    alloc_and_load_congestion_map(placer_opts, placer_ctx);
 
-    alloc_and_load_try_swap_structs(cube_bb);
+    alloc_and_load_try_swap_structs(cube_bb, placer_ctx);
 
     place_ctx.pl_macros = alloc_and_load_placement_macros(directs, num_directs);
 
@@ -2673,46 +4252,53 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
 
 /* Frees the major structures needed by the placer (and not needed       *
  * elsewhere).   */
-static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc_opts& noc_opts) {
-    auto& place_move_ctx = g_placer_ctx.mutable_move();
+static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc_opts& noc_opts, PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
+    auto& place_move_ctx = placer_ctx.mutable_move();
 
     if (placer_opts.place_algorithm.is_timing_driven()) {
-        auto& p_timing_ctx = g_placer_ctx.mutable_timing();
+        auto& p_timing_ctx = placer_ctx.mutable_timing();
 
         vtr::release_memory(p_timing_ctx.connection_timing_cost);
         vtr::release_memory(p_timing_ctx.connection_delay);
         vtr::release_memory(p_timing_ctx.connection_setup_slack);
         vtr::release_memory(p_timing_ctx.proposed_connection_timing_cost);
         vtr::release_memory(p_timing_ctx.proposed_connection_delay);
+        vtr::release_memory(p_timing_ctx.analyzed_connection_delay);
+        p_timing_ctx.connection_delay_cache = ConnectionDelayCache();
+        vtr::release_memory(p_timing_ctx.pending_invalidated_pins);
         vtr::release_memory(p_timing_ctx.net_timing_cost);
     }
 
     free_placement_macros_structs();
 
-    vtr::release_memory(net_cost);
-    vtr::release_memory(proposed_net_cost);
+    vtr::release_memory(p_cost_ctx.net_cost);
+    vtr::release_memory(p_cost_ctx.proposed_net_cost);
     vtr::release_memory(place_move_ctx.bb_num_on_edges);
     vtr::release_memory(place_move_ctx.bb_coords);
 
-    vtr::release_memory(place_move_ctx.layer_bb_num_on_edges);
-    vtr::release_memory(place_move_ctx.layer_bb_coords);
+    place_move_ctx.layer_bb_num_on_edges.clear();
+    place_move_ctx.layer_bb_coords.clear();
 
     place_move_ctx.num_sink_pin_layer.clear();
 
-    vtr::release_memory(bb_updated_before);
+    vtr::release_memory(p_cost_ctx.bb_updated_before);
 
-    free_fast_cost_update();
+    free_fast_cost_update(placer_ctx);
 
-    free_try_swap_structs();
+    p_cost_ctx.congestion_map = PlacerCongestionMap();
+
+    free_try_swap_structs(placer_ctx);
 
     if (noc_opts.noc) {
         free_noc_placement_structs();
     }
 }
 
-static void alloc_and_load_try_swap_structs(const bool cube_bb) {
+static void alloc_and_load_try_swap_structs(const bool cube_bb, PlacerContext& placer_ctx) {
     /* Allocate the local bb_coordinate storage, etc. only once. */
     /* Allocate with size cluster_ctx.clb_nlist.nets().size() for any number of nets affected. */
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     size_t num_nets = cluster_ctx.clb_nlist.nets().size();
@@ -2720,33 +4306,34 @@ static void alloc_and_load_try_swap_structs(const bool cube_bb) {
     const int num_layers = g_vpr_ctx.device().grid.get_num_layers();
 
     if (cube_bb) {
-        ts_bb_edge_new.resize(num_nets, t_bb());
-        ts_bb_coord_new.resize(num_nets, t_bb());
+        p_cost_ctx.ts_bb_edge_new.resize(num_nets, t_bb());
+        p_cost_ctx.ts_bb_coord_new.resize(num_nets, t_bb());
     } else {
         VTR_ASSERT_SAFE(!cube_bb);
-        layer_ts_bb_edge_new.resize(num_nets, std::vector<t_2D_bb>(num_layers, t_2D_bb()));
-        layer_ts_bb_coord_new.resize(num_nets, std::vector<t_2D_bb>(num_layers, t_2D_bb()));
+        p_cost_ctx.layer_ts_bb_edge_new.resize({num_nets, size_t(num_layers)}, t_2D_bb());
+        p_cost_ctx.layer_ts_bb_coord_new.resize({num_nets, size_t(num_layers)}, t_2D_bb());
     }
 
-    ts_layer_sink_pin_count.resize({num_nets, size_t(num_layers)});
-    for (size_t flat_idx = 0; flat_idx < ts_layer_sink_pin_count.size(); flat_idx++) {
-        auto& elem = ts_layer_sink_pin_count.get(flat_idx);
+    p_cost_ctx.ts_layer_sink_pin_count.resize({num_nets, size_t(num_layers)});
+    for (size_t flat_idx = 0; flat_idx < p_cost_ctx.ts_layer_sink_pin_count.size(); flat_idx++) {
+        auto& elem = p_cost_ctx.ts_layer_sink_pin_count.get(flat_idx);
         elem = OPEN;
     }
 
-    ts_nets_to_update.resize(num_nets, ClusterNetId::INVALID());
+    p_cost_ctx.ts_nets_to_update.resize(num_nets, ClusterNetId::INVALID());
 
     auto& place_ctx = g_vpr_ctx.mutable_placement();
     place_ctx.compressed_block_grids = create_compressed_block_grids();
 }
 
-static void free_try_swap_structs() {
-    vtr::release_memory(ts_bb_edge_new);
-    vtr::release_memory(ts_bb_coord_new);
-    vtr::release_memory(layer_ts_bb_edge_new);
-    vtr::release_memory(layer_ts_bb_coord_new);
-    ts_layer_sink_pin_count.clear();
-    vtr::release_memory(ts_nets_to_update);
+static void free_try_swap_structs(PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
+    vtr::release_memory(p_cost_ctx.ts_bb_edge_new);
+    vtr::release_memory(p_cost_ctx.ts_bb_coord_new);
+    p_cost_ctx.layer_ts_bb_edge_new.clear();
+    p_cost_ctx.layer_ts_bb_coord_new.clear();
+    p_cost_ctx.ts_layer_sink_pin_count.clear();
+    vtr::release_memory(p_cost_ctx.ts_nets_to_update);
 
     auto& place_ctx = g_vpr_ctx.mutable_placement();
     vtr::release_memory(place_ctx.compressed_block_grids);
@@ -2760,97 +4347,31 @@ static void get_bb_from_scratch(ClusterNetId net_id,
                                 t_bb& coords,
                                 t_bb& num_on_edges,
                                 vtr::NdMatrixProxy<int, 1> num_sink_pin_layer) {
-    int pnum, x, y, pin_layer, xmin, xmax, ymin, ymax;
-    int xmin_edge, xmax_edge, ymin_edge, ymax_edge;
+    static thread_local t_net_pin_coords pin_coords;
+    load_net_pin_coords(net_id, pin_coords);
+    size_t num_pins = pin_coords.size();
 
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
-    auto& device_ctx = g_vpr_ctx.device();
-    auto& grid = device_ctx.grid;
-
-    ClusterBlockId bnum = cluster_ctx.clb_nlist.net_driver_block(net_id);
-    pnum = net_pin_to_tile_pin_index(net_id, 0);
-    VTR_ASSERT(pnum >= 0);
-    x = place_ctx.block_locs[bnum].loc.x
-        + physical_tile_type(bnum)->pin_width_offset[pnum];
-    y = place_ctx.block_locs[bnum].loc.y
-        + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-    x = max(min<int>(x, grid.width() - 2), 1);
-    y = max(min<int>(y, grid.height() - 2), 1);
-
-    xmin = x;
-    ymin = y;
-    xmax = x;
-    ymax = y;
-    xmin_edge = 1;
-    ymin_edge = 1;
-    xmax_edge = 1;
-    ymax_edge = 1;
-
-    for (int layer_num = 0; layer_num < grid.get_num_layers(); layer_num++) {
+    t_coord_extent x_extent = coord_extent(pin_coords.x.data(), num_pins);
+    t_coord_extent y_extent = coord_extent(pin_coords.y.data(), num_pins);
+
+    for (int layer_num = 0; layer_num < g_vpr_ctx.device().grid.get_num_layers(); layer_num++) {
         num_sink_pin_layer[layer_num] = 0;
     }
-
-    for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
-        bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
-        pnum = tile_pin_index(pin_id);
-        x = place_ctx.block_locs[bnum].loc.x
-            + physical_tile_type(bnum)->pin_width_offset[pnum];
-        y = place_ctx.block_locs[bnum].loc.y
-            + physical_tile_type(bnum)->pin_height_offset[pnum];
-        pin_layer = place_ctx.block_locs[bnum].loc.layer;
-
-        /* Code below counts IO blocks as being within the 1..grid.width()-2, 1..grid.height()-2 clb array. *
-         * This is because channels do not go out of the 0..grid.width()-2, 0..grid.height()-2 range, and   *
-         * I always take all channels impinging on the bounding box to be within   *
-         * that bounding box.  Hence, this "movement" of IO blocks does not affect *
-         * the which channels are included within the bounding box, and it         *
-         * simplifies the code a lot.                                              */
-
-        x = max(min<int>(x, grid.width() - 2), 1);  //-2 for no perim channels
-        y = max(min<int>(y, grid.height() - 2), 1); //-2 for no perim channels
-
-        if (x == xmin) {
-            xmin_edge++;
-        }
-        if (x == xmax) { /* Recall that xmin could equal xmax -- don't use else */
-            xmax_edge++;
-        } else if (x < xmin) {
-            xmin = x;
-            xmin_edge = 1;
-        } else if (x > xmax) {
-            xmax = x;
-            xmax_edge = 1;
-        }
-
-        if (y == ymin) {
-            ymin_edge++;
-        }
-        if (y == ymax) {
-            ymax_edge++;
-        } else if (y < ymin) {
-            ymin = y;
-            ymin_edge = 1;
-        } else if (y > ymax) {
-            ymax = y;
-            ymax_edge = 1;
-        }
-
-        num_sink_pin_layer[pin_layer]++;
+    for (size_t ipin = 1; ipin < num_pins; ++ipin) {
+        num_sink_pin_layer[pin_coords.layer[ipin]]++;
     }
 
     /* Copy the coordinates and number on edges information into the proper   *
      * structures.                                                            */
-    coords.xmin = xmin;
-    coords.xmax = xmax;
-    coords.ymin = ymin;
-    coords.ymax = ymax;
-
-    num_on_edges.xmin = xmin_edge;
-    num_on_edges.xmax = xmax_edge;
-    num_on_edges.ymin = ymin_edge;
-    num_on_edges.ymax = ymax_edge;
+    coords.xmin = x_extent.min;
+    coords.xmax = x_extent.max;
+    coords.ymin = y_extent.min;
+    coords.ymax = y_extent.max;
+
+    num_on_edges.xmin = x_extent.num_on_min;
+    num_on_edges.xmax = x_extent.num_on_max;
+    num_on_edges.ymin = y_extent.num_on_min;
+    num_on_edges.ymax = y_extent.num_on_max;
 }
 
 /* This routine finds the bounding box of each net from scratch when the bounding box is of type per-layer (i.e.   *
@@ -2858,112 +4379,61 @@ static void get_bb_from_scratch(ClusterNetId net_id,
  * coordinate, number of pins on each edge information, and the number of sinks on each layer.  It           *
  * should only be called when the bounding box information is not valid. */
 static void get_layer_bb_from_scratch(ClusterNetId net_id,
-                                      std::vector<t_2D_bb>& num_on_edges,
-                                      std::vector<t_2D_bb>& coords,
+                                      vtr::NdMatrixProxy<t_2D_bb, 1> num_on_edges,
+                                      vtr::NdMatrixProxy<t_2D_bb, 1> coords,
                                       vtr::NdMatrixProxy<int, 1> layer_pin_sink_count) {
-    auto& device_ctx = g_vpr_ctx.device();
-    const int num_layers = device_ctx.grid.get_num_layers();
-    std::vector<int> xmin(num_layers, OPEN);
-    std::vector<int> xmax(num_layers, OPEN);
-    std::vector<int> ymin(num_layers, OPEN);
-    std::vector<int> ymax(num_layers, OPEN);
-    std::vector<int> xmin_edge(num_layers, OPEN);
-    std::vector<int> xmax_edge(num_layers, OPEN);
-    std::vector<int> ymin_edge(num_layers, OPEN);
-    std::vector<int> ymax_edge(num_layers, OPEN);
-
-    std::vector<int> num_sink_pin_layer(num_layers, 0);
+    static thread_local t_net_pin_coords pin_coords;
+    load_net_pin_coords(net_id, pin_coords);
+    size_t num_pins = pin_coords.size();
+    const int num_layers = g_vpr_ctx.device().grid.get_num_layers();
 
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
-    auto& grid = device_ctx.grid;
+    /* The bounding box on every layer starts from the driver, which is *
+     * counted on each of its edges. The pin coordinates are already     *
+     * clipped to the channels (see load_net_pin_coords()).              */
+    int x_src = pin_coords.x[0];
+    int y_src = pin_coords.y[0];
+    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
+        layer_pin_sink_count[layer_num] = 0;
+        coords[layer_num] = t_2D_bb(x_src, x_src, y_src, y_src, layer_num);
+        num_on_edges[layer_num] = t_2D_bb(1, 1, 1, 1, layer_num);
+    }
 
-    ClusterBlockId bnum = cluster_ctx.clb_nlist.net_driver_block(net_id);
-    int pnum_src = net_pin_to_tile_pin_index(net_id, 0);
-    VTR_ASSERT(pnum_src >= 0);
-    int x_src = place_ctx.block_locs[bnum].loc.x
-                + physical_tile_type(bnum)->pin_width_offset[pnum_src];
-    int y_src = place_ctx.block_locs[bnum].loc.y
-                + physical_tile_type(bnum)->pin_height_offset[pnum_src];
+    for (size_t ipin = 1; ipin < num_pins; ++ipin) {
+        int layer = pin_coords.layer[ipin];
+        VTR_ASSERT(layer >= 0 && layer < num_layers);
+        layer_pin_sink_count[layer]++;
 
-    x_src = max(min<int>(x_src, grid.width() - 2), 1);
-    y_src = max(min<int>(y_src, grid.height() - 2), 1);
+        int x = pin_coords.x[ipin];
+        int y = pin_coords.y[ipin];
+        t_2D_bb& bb = coords[layer];
+        t_2D_bb& edges = num_on_edges[layer];
 
-    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
-        xmin[layer_num] = x_src;
-        ymin[layer_num] = y_src;
-        xmax[layer_num] = x_src;
-        ymax[layer_num] = y_src;
-        xmin_edge[layer_num] = 1;
-        ymin_edge[layer_num] = 1;
-        xmax_edge[layer_num] = 1;
-        ymax_edge[layer_num] = 1;
-    }
-
-    for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
-        bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
-        int pnum = tile_pin_index(pin_id);
-        int layer = place_ctx.block_locs[bnum].loc.layer;
-        VTR_ASSERT(layer >= 0 && layer < num_layers);
-        num_sink_pin_layer[layer]++;
-        int x = place_ctx.block_locs[bnum].loc.x
-                + physical_tile_type(bnum)->pin_width_offset[pnum];
-        int y = place_ctx.block_locs[bnum].loc.y
-                + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-        /* Code below counts IO blocks as being within the 1..grid.width()-2, 1..grid.height()-2 clb array. *
-         * This is because channels do not go out of the 0..grid.width()-2, 0..grid.height()-2 range, and   *
-         * I always take all channels impinging on the bounding box to be within   *
-         * that bounding box.  Hence, this "movement" of IO blocks does not affect *
-         * the which channels are included within the bounding box, and it         *
-         * simplifies the code a lot.                                              */
-
-        x = max(min<int>(x, grid.width() - 2), 1);  //-2 for no perim channels
-        y = max(min<int>(y, grid.height() - 2), 1); //-2 for no perim channels
-
-        if (x == xmin[layer]) {
-            xmin_edge[layer]++;
+        if (x == bb.xmin) {
+            edges.xmin++;
         }
-        if (x == xmax[layer]) { /* Recall that xmin could equal xmax -- don't use else */
-            xmax_edge[layer]++;
-        } else if (x < xmin[layer]) {
-            xmin[layer] = x;
-            xmin_edge[layer] = 1;
-        } else if (x > xmax[layer]) {
-            xmax[layer] = x;
-            xmax_edge[layer] = 1;
+        if (x == bb.xmax) { /* Recall that xmin could equal xmax -- don't use else */
+            edges.xmax++;
+        } else if (x < bb.xmin) {
+            bb.xmin = x;
+            edges.xmin = 1;
+        } else if (x > bb.xmax) {
+            bb.xmax = x;
+            edges.xmax = 1;
         }
 
-        if (y == ymin[layer]) {
-            ymin_edge[layer]++;
+        if (y == bb.ymin) {
+            edges.ymin++;
         }
-        if (y == ymax[layer]) {
-            ymax_edge[layer]++;
-        } else if (y < ymin[layer]) {
-            ymin[layer] = y;
-            ymin_edge[layer] = 1;
-        } else if (y > ymax[layer]) {
-            ymax[layer] = y;
-            ymax_edge[layer] = 1;
+        if (y == bb.ymax) {
+            edges.ymax++;
+        } else if (y < bb.ymin) {
+            bb.ymin = y;
+            edges.ymin = 1;
+        } else if (y > bb.ymax) {
+            bb.ymax = y;
+            edges.ymax = 1;
         }
     }
-
-    /* Copy the coordinates and number on edges information into the proper   *
-     * structures.                                                            */
-    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
-        layer_pin_sink_count[layer_num] = num_sink_pin_layer[layer_num];
-        coords[layer_num].xmin = xmin[layer_num];
-        coords[layer_num].xmax = xmax[layer_num];
-        coords[layer_num].ymin = ymin[layer_num];
-        coords[layer_num].ymax = ymax[layer_num];
-        coords[layer_num].layer_num = layer_num;
-
-        num_on_edges[layer_num].xmin = xmin_edge[layer_num];
-        num_on_edges[layer_num].xmax = xmax_edge[layer_num];
-        num_on_edges[layer_num].ymin = ymin_edge[layer_num];
-        num_on_edges[layer_num].ymax = ymax_edge[layer_num];
-        num_on_edges[layer_num].layer_num = layer_num;
-    }
 }
 
 static double wirelength_crossing_count(size_t fanout) {
@@ -3001,8 +4471,73 @@ static double get_net_wirelength_estimate(ClusterNetId net_id, const t_bb& bbptr
     return (ncost);
 }
 
+///@brief The tiles of a net bounding box in the routing demand map
+static vtr::Rect<int> congestion_map_bb(const t_bb& bb) {
+    return vtr::Rect<int>(bb.xmin, bb.ymin, bb.xmax, bb.ymax);
+}
+
+/**
+ * @brief Allocates the routing demand map of the congestion cost, whose tile capacities are
+ *        the tracks of the channels through them, if --place_congestion_weight is set.
+ *
+ * The demand is the (2D) projection of the net bounding boxes, so it is only supported with
+ * cube bounding boxes.
+ */
+static void alloc_and_load_congestion_map(const t_placer_opts& placer_opts, PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
+    p_cost_ctx.congestion_map = PlacerCongestionMap();
+
+    if (placer_opts.place_congestion_weight <= 0.) {
+        return;
+    }
+    if (!g_vpr_ctx.placement().cube_bb) {
+        VTR_LOG_WARN("The placement congestion cost is not supported with per-layer bounding boxes, ignoring it\n");
+        return;
+    }
+
+    const auto& device_ctx = g_vpr_ctx.device();
+    p_cost_ctx.congestion_map = PlacerCongestionMap(device_ctx.grid.width(), device_ctx.grid.height());
+    for (size_t x = 0; x < device_ctx.grid.width(); ++x) {
+        for (size_t y = 0; y < device_ctx.grid.height(); ++y) {
+            p_cost_ctx.congestion_map.set_capacity(x, y, device_ctx.chan_width.x_list[y] + device_ctx.chan_width.y_list[x]);
+        }
+    }
+}
+
+/**
+ * @brief Reloads the routing demand map from the committed net bounding boxes, and returns
+ *        its congestion cost (0 if the congestion cost is disabled).
+ *
+ * Global nets are assumed to span the whole chip, and do not affect the congestion cost.
+ */
+static double comp_congestion_cost(PlacerContext& placer_ctx) {
+    auto& congestion_map = placer_ctx.mutable_cost().congestion_map;
+    if (congestion_map.empty()) {
+        return 0.;
+    }
+
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_move_ctx = placer_ctx.move();
+
+    congestion_map.clear_demand();
+    for (ClusterNetId net_id : cluster_ctx.clb_nlist.nets()) {
+        if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+            continue;
+        }
+        const t_bb& bb = place_move_ctx.bb_coords[net_id];
+        congestion_map.add_net(congestion_map_bb(bb), get_net_wirelength_estimate(net_id, bb));
+    }
+    return congestion_map.cost();
+}
+
+///@brief Stages moving the routing demand of a net from its committed bounding box to its proposed one
+static void stage_net_routing_demand(ClusterNetId net_id, const t_bb& old_bb, const t_bb& new_bb, PlacerContext& placer_ctx) {
+    placer_ctx.mutable_cost().congestion_map.propose_net(congestion_map_bb(old_bb), get_net_wirelength_estimate(net_id, old_bb),
+                                                           congestion_map_bb(new_bb), get_net_wirelength_estimate(net_id, new_bb));
+}
+
 static double get_net_layer_wirelength_estimate(ClusterNetId /* net_id */,
-                                                const std::vector<t_2D_bb>& bbptr,
+                                                const vtr::NdMatrixProxy<t_2D_bb, 1> bbptr,
                                                 const vtr::NdMatrixProxy<int, 1> layer_pin_sink_count) {
     /* WMF: Finds the estimate of wirelength due to one net by looking at   *
      * its coordinate bounding box.                                         */
@@ -3033,9 +4568,10 @@ static double get_net_layer_wirelength_estimate(ClusterNetId /* net_id */,
     return (ncost);
 }
 
-static double get_net_cost(ClusterNetId net_id, const t_bb& bbptr) {
+static double get_net_cost(ClusterNetId net_id, const t_bb& bbptr, PlacerContext& placer_ctx) {
     /* Finds the cost due to one net by looking at its coordinate bounding  *
      * box.                                                                 */
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
 
     double ncost, crossing;
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -3051,19 +4587,21 @@ static double get_net_cost(ClusterNetId net_id, const t_bb& bbptr) {
      * channel capacity.   Do this for x, then y direction and add.  */
 
     ncost = (bbptr.xmax - bbptr.xmin + 1) * crossing
-            * chanx_place_cost_fac[bbptr.ymax][bbptr.ymin - 1];
+            * p_cost_ctx.chanx_place_cost_fac[bbptr.ymax][bbptr.ymin - 1];
 
     ncost += (bbptr.ymax - bbptr.ymin + 1) * crossing
-             * chany_place_cost_fac[bbptr.xmax][bbptr.xmin - 1];
+             * p_cost_ctx.chany_place_cost_fac[bbptr.xmax][bbptr.xmin - 1];
 
     return (ncost);
 }
 
 static double get_net_layer_cost(ClusterNetId /* net_id */,
-                                 const std::vector<t_2D_bb>& bbptr,
-                                 const vtr::NdMatrixProxy<int, 1> layer_pin_sink_count) {
+                                 const vtr::NdMatrixProxy<t_2D_bb, 1> bbptr,
+                                 const vtr::NdMatrixProxy<int, 1> layer_pin_sink_count,
+                                 PlacerContext& placer_ctx) {
     /* Finds the cost due to one net by looking at its coordinate bounding  *
      * box.                                                                 */
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
 
     double ncost = 0.;
     double crossing = 0.;
@@ -3084,10 +4622,10 @@ static double get_net_layer_cost(ClusterNetId /* net_id */,
          * channel capacity.   Do this for x, then y direction and add.  */
 
         ncost += (bbptr[layer_num].xmax - bbptr[layer_num].xmin + 1) * crossing
-                 * chanx_place_cost_fac[bbptr[layer_num].ymax][bbptr[layer_num].ymin - 1];
+                 * p_cost_ctx.chanx_place_cost_fac[bbptr[layer_num].ymax][bbptr[layer_num].ymin - 1];
 
         ncost += (bbptr[layer_num].ymax - bbptr[layer_num].ymin + 1) * crossing
-                 * chany_place_cost_fac[bbptr[layer_num].xmax][bbptr[layer_num].xmin - 1];
+                 * p_cost_ctx.chany_place_cost_fac[bbptr[layer_num].xmax][bbptr[layer_num].xmin - 1];
     }
 
     return (ncost);
@@ -3105,133 +4643,57 @@ static void get_non_updateable_bb(ClusterNetId net_id,
                                   vtr::NdMatrixProxy<int, 1> num_sink_pin_layer) {
     //TODO: account for multiple physical pin instances per logical pin
 
-    int xmax, ymax, xmin, ymin, x, y, layer;
-    int pnum;
-
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
-    auto& device_ctx = g_vpr_ctx.device();
-
-    ClusterBlockId bnum = cluster_ctx.clb_nlist.net_driver_block(net_id);
-    pnum = net_pin_to_tile_pin_index(net_id, 0);
-
-    x = place_ctx.block_locs[bnum].loc.x
-        + physical_tile_type(bnum)->pin_width_offset[pnum];
-    y = place_ctx.block_locs[bnum].loc.y
-        + physical_tile_type(bnum)->pin_height_offset[pnum];
+    static thread_local t_net_pin_coords pin_coords;
+    load_net_pin_coords(net_id, pin_coords);
+    size_t num_pins = pin_coords.size();
 
-    xmin = x;
-    ymin = y;
-    xmax = x;
-    ymax = y;
-
-    for (int layer_num = 0; layer_num < device_ctx.grid.get_num_layers(); layer_num++) {
+    for (int layer_num = 0; layer_num < g_vpr_ctx.device().grid.get_num_layers(); layer_num++) {
         num_sink_pin_layer[layer_num] = 0;
     }
-
-    for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
-        bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
-        pnum = tile_pin_index(pin_id);
-        x = place_ctx.block_locs[bnum].loc.x
-            + physical_tile_type(bnum)->pin_width_offset[pnum];
-        y = place_ctx.block_locs[bnum].loc.y
-            + physical_tile_type(bnum)->pin_height_offset[pnum];
-        layer = place_ctx.block_locs[bnum].loc.layer;
-
-        if (x < xmin) {
-            xmin = x;
-        } else if (x > xmax) {
-            xmax = x;
-        }
-
-        if (y < ymin) {
-            ymin = y;
-        } else if (y > ymax) {
-            ymax = y;
-        }
-
-        num_sink_pin_layer[layer]++;
+    for (size_t ipin = 1; ipin < num_pins; ++ipin) {
+        num_sink_pin_layer[pin_coords.layer[ipin]]++;
     }
 
-    /* Now I've found the coordinates of the bounding box.  There are no *
-     * channels beyond device_ctx.grid.width()-2 and                     *
-     * device_ctx.grid.height() - 2, so I want to clip to that.  As well,*
-     * since I'll always include the channel immediately below and the   *
-     * channel immediately to the left of the bounding box, I want to    *
-     * clip to 1 in both directions as well (since minimum channel index *
-     * is 0).  See route_common.cpp for a channel diagram.               */
+    /* The pin coordinates are already clipped to the channels (see        *
+     * load_net_pin_coords()), so their extent is the bounding box.        */
+    t_coord_extent x_extent = coord_min_max(pin_coords.x.data(), num_pins);
+    t_coord_extent y_extent = coord_min_max(pin_coords.y.data(), num_pins);
 
-    bb_coord_new.xmin = max(min<int>(xmin, device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-    bb_coord_new.ymin = max(min<int>(ymin, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
-    bb_coord_new.xmax = max(min<int>(xmax, device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-    bb_coord_new.ymax = max(min<int>(ymax, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
+    bb_coord_new.xmin = x_extent.min;
+    bb_coord_new.ymin = y_extent.min;
+    bb_coord_new.xmax = x_extent.max;
+    bb_coord_new.ymax = y_extent.max;
 }
 
 static void get_non_updateable_layer_bb(ClusterNetId net_id,
-                                        std::vector<t_2D_bb>& bb_coord_new,
+                                        vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
                                         vtr::NdMatrixProxy<int, 1> num_sink_layer) {
     //TODO: account for multiple physical pin instances per logical pin
 
-    auto& device_ctx = g_vpr_ctx.device();
-    int num_layers = device_ctx.grid.get_num_layers();
-    for (int layer_num = 0; layer_num < device_ctx.grid.get_num_layers(); layer_num++) {
+    static thread_local t_net_pin_coords pin_coords;
+    load_net_pin_coords(net_id, pin_coords);
+    size_t num_pins = pin_coords.size();
+    const int num_layers = g_vpr_ctx.device().grid.get_num_layers();
+
+    /* The bounding box on every layer includes the driver. The pin        *
+     * coordinates are already clipped to the channels (see               *
+     * load_net_pin_coords()), so their extent is the bounding box.        */
+    int src_x = pin_coords.x[0];
+    int src_y = pin_coords.y[0];
+    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
         num_sink_layer[layer_num] = 0;
+        bb_coord_new[layer_num] = t_2D_bb(src_x, src_x, src_y, src_y, layer_num);
     }
 
-    int pnum;
-
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
-
-    ClusterBlockId bnum = cluster_ctx.clb_nlist.net_driver_block(net_id);
-    pnum = net_pin_to_tile_pin_index(net_id, 0);
-
-    int src_x = place_ctx.block_locs[bnum].loc.x
-                + physical_tile_type(bnum)->pin_width_offset[pnum];
-    int src_y = place_ctx.block_locs[bnum].loc.y
-                + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-    std::vector<int> xmin(num_layers, src_x);
-    std::vector<int> ymin(num_layers, src_y);
-    std::vector<int> xmax(num_layers, src_x);
-    std::vector<int> ymax(num_layers, src_y);
-
-    for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
-        bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
-        pnum = tile_pin_index(pin_id);
-        int x = place_ctx.block_locs[bnum].loc.x
-                + physical_tile_type(bnum)->pin_width_offset[pnum];
-        int y = place_ctx.block_locs[bnum].loc.y
-                + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-        int layer_num = place_ctx.block_locs[bnum].loc.layer;
+    for (size_t ipin = 1; ipin < num_pins; ++ipin) {
+        int layer_num = pin_coords.layer[ipin];
         num_sink_layer[layer_num]++;
-        if (x < xmin[layer_num]) {
-            xmin[layer_num] = x;
-        } else if (x > xmax[layer_num]) {
-            xmax[layer_num] = x;
-        }
-
-        if (y < ymin[layer_num]) {
-            ymin[layer_num] = y;
-        } else if (y > ymax[layer_num]) {
-            ymax[layer_num] = y;
-        }
-    }
 
-    /* Now I've found the coordinates of the bounding box.  There are no *
-     * channels beyond device_ctx.grid.width()-2 and                     *
-     * device_ctx.grid.height() - 2, so I want to clip to that.  As well,*
-     * since I'll always include the channel immediately below and the   *
-     * channel immediately to the left of the bounding box, I want to    *
-     * clip to 1 in both directions as well (since minimum channel index *
-     * is 0).  See route_common.cpp for a channel diagram.               */
-    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
-        bb_coord_new[layer_num].layer_num = layer_num;
-        bb_coord_new[layer_num].xmin = max(min<int>(xmin[layer_num], device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-        bb_coord_new[layer_num].ymin = max(min<int>(ymin[layer_num], device_ctx.grid.height() - 2), 1); //-2 for no perim channels
-        bb_coord_new[layer_num].xmax = max(min<int>(xmax[layer_num], device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-        bb_coord_new[layer_num].ymax = max(min<int>(ymax[layer_num], device_ctx.grid.height() - 2), 1); //-2 for no perim channels
+        t_2D_bb& bb = bb_coord_new[layer_num];
+        bb.xmin = std::min(bb.xmin, pin_coords.x[ipin]);
+        bb.xmax = std::max(bb.xmax, pin_coords.x[ipin]);
+        bb.ymin = std::min(bb.ymin, pin_coords.y[ipin]);
+        bb.ymax = std::max(bb.ymax, pin_coords.y[ipin]);
     }
 }
 
@@ -3241,7 +4703,8 @@ static void update_bb(ClusterNetId net_id,
                       vtr::NdMatrixProxy<int, 1> num_sink_pin_layer_new,
                       t_physical_tile_loc pin_old_loc,
                       t_physical_tile_loc pin_new_loc,
-                      bool src_pin) {
+                      bool src_pin,
+                      PlacerContext& placer_ctx) {
     /* Updates the bounding box of a net by storing its coordinates in    *
      * the bb_coord_new data structure and the number of blocks on each   *
      * edge in the bb_edge_new data structure.  This routine should only  *
@@ -3255,10 +4718,11 @@ static void update_bb(ClusterNetId net_id,
      * The x and y coordinates are the pin's x and y coordinates.         */
     /* IO blocks are considered to be one cell in for simplicity.         */
     //TODO: account for multiple physical pin instances per logical pin
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     const t_bb *curr_bb_edge, *curr_bb_coord;
 
     auto& device_ctx = g_vpr_ctx.device();
-    auto& place_move_ctx = g_placer_ctx.move();
+    auto& place_move_ctx = placer_ctx.move();
 
     const int num_layers = device_ctx.grid.get_num_layers();
 
@@ -3268,18 +4732,18 @@ static void update_bb(ClusterNetId net_id,
     pin_old_loc.y = max(min<int>(pin_old_loc.y, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
 
     /* Check if the net had been updated before. */
-    if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+    if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
         /* The net had been updated from scratch, DO NOT update again! */
         return;
     }
 
-    vtr::NdMatrixProxy<int, 1> curr_num_sink_pin_layer = (bb_updated_before[net_id] == NOT_UPDATED_YET) ? place_move_ctx.num_sink_pin_layer[size_t(net_id)] : num_sink_pin_layer_new;
+    vtr::NdMatrixProxy<int, 1> curr_num_sink_pin_layer = (p_cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) ? place_move_ctx.num_sink_pin_layer[size_t(net_id)] : num_sink_pin_layer_new;
 
-    if (bb_updated_before[net_id] == NOT_UPDATED_YET) {
+    if (p_cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) {
         /* The net had NOT been updated before, could use the old values */
         curr_bb_edge = &place_move_ctx.bb_num_on_edges[net_id];
         curr_bb_coord = &place_move_ctx.bb_coords[net_id];
-        bb_updated_before[net_id] = UPDATED_ONCE;
+        p_cost_ctx.bb_updated_before[net_id] = UPDATED_ONCE;
     } else {
         /* The net had been updated before, must use the new values */
         curr_bb_coord = &bb_coord_new;
@@ -3295,7 +4759,7 @@ static void update_bb(ClusterNetId net_id,
         if (pin_old_loc.x == curr_bb_coord->xmax) { /* Old position at xmax. */
             if (curr_bb_edge->xmax == 1) {
                 get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                p_cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                 return;
             } else {
                 bb_edge_new.xmax = curr_bb_edge->xmax - 1;
@@ -3327,7 +4791,7 @@ static void update_bb(ClusterNetId net_id,
         if (pin_old_loc.x == curr_bb_coord->xmin) { /* Old position at xmin. */
             if (curr_bb_edge->xmin == 1) {
                 get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                p_cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                 return;
             } else {
                 bb_edge_new.xmin = curr_bb_edge->xmin - 1;
@@ -3368,7 +4832,7 @@ static void update_bb(ClusterNetId net_id,
         if (pin_old_loc.y == curr_bb_coord->ymax) { /* Old position at ymax. */
             if (curr_bb_edge->ymax == 1) {
                 get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                p_cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                 return;
             } else {
                 bb_edge_new.ymax = curr_bb_edge->ymax - 1;
@@ -3400,7 +4864,7 @@ static void update_bb(ClusterNetId net_id,
         if (pin_old_loc.y == curr_bb_coord->ymin) { /* Old position at ymin. */
             if (curr_bb_edge->ymin == 1) {
                 get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                p_cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                 return;
             } else {
                 bb_edge_new.ymin = curr_bb_edge->ymin - 1;
@@ -3447,18 +4911,19 @@ static void update_bb(ClusterNetId net_id,
         }
     }
 
-    if (bb_updated_before[net_id] == NOT_UPDATED_YET) {
-        bb_updated_before[net_id] = UPDATED_ONCE;
+    if (p_cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) {
+        p_cost_ctx.bb_updated_before[net_id] = UPDATED_ONCE;
     }
 }
 
 static void update_layer_bb(ClusterNetId net_id,
-                            std::vector<t_2D_bb>& bb_edge_new,
-                            std::vector<t_2D_bb>& bb_coord_new,
+                            vtr::NdMatrixProxy<t_2D_bb, 1> bb_edge_new,
+                            vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
                             vtr::NdMatrixProxy<int, 1> bb_pin_sink_count_new,
                             t_physical_tile_loc pin_old_loc,
                             t_physical_tile_loc pin_new_loc,
-                            bool is_output_pin) {
+                            bool is_output_pin,
+                            PlacerContext& placer_ctx) {
     /* Updates the bounding box of a net by storing its coordinates in    *
      * the bb_coord_new data structure and the number of blocks on each   *
      * edge in the bb_edge_new data structure.  This routine should only  *
@@ -3472,10 +4937,10 @@ static void update_layer_bb(ClusterNetId net_id,
      * The x and y coordinates are the pin's x and y coordinates.         */
     /* IO blocks are considered to be one cell in for simplicity.         */
     //TODO: account for multiple physical pin instances per logical pin
-    const std::vector<t_2D_bb>*curr_bb_edge, *curr_bb_coord;
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
 
     auto& device_ctx = g_vpr_ctx.device();
-    auto& place_move_ctx = g_placer_ctx.move();
+    auto& place_move_ctx = placer_ctx.move();
 
     pin_new_loc.x = max(min<int>(pin_new_loc.x, device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
     pin_new_loc.y = max(min<int>(pin_new_loc.y, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
@@ -3483,22 +4948,19 @@ static void update_layer_bb(ClusterNetId net_id,
     pin_old_loc.y = max(min<int>(pin_old_loc.y, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
 
     /* Check if the net had been updated before. */
-    if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+    if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
         /* The net had been updated from scratch, DO NOT update again! */
         return;
     }
 
-    const vtr::NdMatrixProxy<int, 1> curr_layer_pin_sink_count = (bb_updated_before[net_id] == NOT_UPDATED_YET) ? place_move_ctx.num_sink_pin_layer[size_t(net_id)] : bb_pin_sink_count_new;
-
-    if (bb_updated_before[net_id] == NOT_UPDATED_YET) {
-        /* The net had NOT been updated before, could use the old values */
-        curr_bb_edge = &place_move_ctx.layer_bb_num_on_edges[net_id];
-        curr_bb_coord = &place_move_ctx.layer_bb_coords[net_id];
-        bb_updated_before[net_id] = UPDATED_ONCE;
-    } else {
-        /* The net had been updated before, must use the new values */
-        curr_bb_edge = &bb_edge_new;
-        curr_bb_coord = &bb_coord_new;
+    /* If the net had NOT been updated before, use the old values. Otherwise, *
+     * it had been updated before, and the new values must be used.          */
+    bool not_updated_yet = (p_cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET);
+    const vtr::NdMatrixProxy<int, 1> curr_layer_pin_sink_count = not_updated_yet ? place_move_ctx.num_sink_pin_layer[size_t(net_id)] : bb_pin_sink_count_new;
+    const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_edge = not_updated_yet ? place_move_ctx.layer_bb_num_on_edges[size_t(net_id)] : bb_edge_new;
+    const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_coord = not_updated_yet ? place_move_ctx.layer_bb_coords[size_t(net_id)] : bb_coord_new;
+    if (not_updated_yet) {
+        p_cost_ctx.bb_updated_before[net_id] = UPDATED_ONCE;
     }
 
     /* Check if I can update the bounding box incrementally. */
@@ -3514,42 +4976,48 @@ static void update_layer_bb(ClusterNetId net_id,
     int layer_new = pin_new_loc.layer_num;
     bool layer_changed = (layer_old != layer_new);
 
-    bb_edge_new = *curr_bb_edge;
-    bb_coord_new = *curr_bb_coord;
+    for (int layer_num = 0; layer_num < device_ctx.grid.get_num_layers(); layer_num++) {
+        bb_edge_new[layer_num] = curr_bb_edge[layer_num];
+        bb_coord_new[layer_num] = curr_bb_coord[layer_num];
+    }
 
     if (layer_changed) {
         update_bb_layer_changed(net_id,
                                 pin_old_loc,
                                 pin_new_loc,
-                                *curr_bb_edge,
-                                *curr_bb_coord,
+                                curr_bb_edge,
+                                curr_bb_coord,
                                 bb_pin_sink_count_new,
                                 bb_edge_new,
-                                bb_coord_new);
+                                bb_coord_new,
+                                placer_ctx);
     } else {
         update_bb_same_layer(net_id,
                              pin_old_loc,
                              pin_new_loc,
-                             *curr_bb_edge,
-                             *curr_bb_coord,
+                             curr_bb_edge,
+                             curr_bb_coord,
                              bb_pin_sink_count_new,
                              bb_edge_new,
-                             bb_coord_new);
+                             bb_coord_new,
+                             placer_ctx);
     }
 
-    if (bb_updated_before[net_id] == NOT_UPDATED_YET) {
-        bb_updated_before[net_id] = UPDATED_ONCE;
+    if (p_cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) {
+        p_cost_ctx.bb_updated_before[net_id] = UPDATED_ONCE;
     }
 }
 
 static inline void update_bb_same_layer(ClusterNetId net_id,
                                         const t_physical_tile_loc& pin_old_loc,
                                         const t_physical_tile_loc& pin_new_loc,
-                                        const std::vector<t_2D_bb>& curr_bb_edge,
-                                        const std::vector<t_2D_bb>& curr_bb_coord,
+                                        const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_edge,
+                                        const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_coord,
                                         vtr::NdMatrixProxy<int, 1> bb_pin_sink_count_new,
-                                        std::vector<t_2D_bb>& bb_edge_new,
-                                        std::vector<t_2D_bb>& bb_coord_new) {
+                                        vtr::NdMatrixProxy<t_2D_bb, 1> bb_edge_new,
+                                        vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
+                                        PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     int x_old = pin_old_loc.x;
     int x_new = pin_new_loc.x;
 
@@ -3568,8 +5036,9 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
                            curr_bb_edge[layer_num].xmax,
                            curr_bb_coord[layer_num].xmax,
                            bb_edge_new[layer_num].xmax,
-                           bb_coord_new[layer_num].xmax);
-            if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+                           bb_coord_new[layer_num].xmax,
+                           placer_ctx);
+            if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
                 return;
             }
         }
@@ -3591,8 +5060,9 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
                            curr_bb_edge[layer_num].xmin,
                            curr_bb_coord[layer_num].xmin,
                            bb_edge_new[layer_num].xmin,
-                           bb_coord_new[layer_num].xmin);
-            if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+                           bb_coord_new[layer_num].xmin,
+                           placer_ctx);
+            if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
                 return;
             }
         }
@@ -3615,8 +5085,9 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
                            curr_bb_edge[layer_num].ymax,
                            curr_bb_coord[layer_num].ymax,
                            bb_edge_new[layer_num].ymax,
-                           bb_coord_new[layer_num].ymax);
-            if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+                           bb_coord_new[layer_num].ymax,
+                           placer_ctx);
+            if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
                 return;
             }
         }
@@ -3638,8 +5109,9 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
                            curr_bb_edge[layer_num].ymin,
                            curr_bb_coord[layer_num].ymin,
                            bb_edge_new[layer_num].ymin,
-                           bb_coord_new[layer_num].ymin);
-            if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+                           bb_coord_new[layer_num].ymin,
+                           placer_ctx);
+            if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
                 return;
             }
         }
@@ -3657,11 +5129,13 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
 static inline void update_bb_layer_changed(ClusterNetId net_id,
                                            const t_physical_tile_loc& pin_old_loc,
                                            const t_physical_tile_loc& pin_new_loc,
-                                           const std::vector<t_2D_bb>& curr_bb_edge,
-                                           const std::vector<t_2D_bb>& curr_bb_coord,
+                                           const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_edge,
+                                           const vtr::NdMatrixProxy<t_2D_bb, 1> curr_bb_coord,
                                            vtr::NdMatrixProxy<int, 1> bb_pin_sink_count_new,
-                                           std::vector<t_2D_bb>& bb_edge_new,
-                                           std::vector<t_2D_bb>& bb_coord_new) {
+                                           vtr::NdMatrixProxy<t_2D_bb, 1> bb_edge_new,
+                                           vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
+                                           PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     int x_old = pin_old_loc.x;
 
     int y_old = pin_old_loc.y;
@@ -3678,8 +5152,9 @@ static inline void update_bb_layer_changed(ClusterNetId net_id,
                        curr_bb_edge[old_layer_num].xmax,
                        curr_bb_coord[old_layer_num].xmax,
                        bb_edge_new[old_layer_num].xmax,
-                       bb_coord_new[old_layer_num].xmax);
-        if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+                       bb_coord_new[old_layer_num].xmax,
+                       placer_ctx);
+        if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
             return;
         }
     } else if (x_old == curr_bb_coord[old_layer_num].xmin) {
@@ -3690,8 +5165,9 @@ static inline void update_bb_layer_changed(ClusterNetId net_id,
                        curr_bb_edge[old_layer_num].xmin,
                        curr_bb_coord[old_layer_num].xmin,
                        bb_edge_new[old_layer_num].xmin,
-                       bb_coord_new[old_layer_num].xmin);
-        if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+                       bb_coord_new[old_layer_num].xmin,
+                       placer_ctx);
+        if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
             return;
         }
     }
@@ -3704,8 +5180,9 @@ static inline void update_bb_layer_changed(ClusterNetId net_id,
                        curr_bb_edge[old_layer_num].ymax,
                        curr_bb_coord[old_layer_num].ymax,
                        bb_edge_new[old_layer_num].ymax,
-                       bb_coord_new[old_layer_num].ymax);
-        if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+                       bb_coord_new[old_layer_num].ymax,
+                       placer_ctx);
+        if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
             return;
         }
     } else if (y_old == curr_bb_coord[old_layer_num].ymin) {
@@ -3716,8 +5193,9 @@ static inline void update_bb_layer_changed(ClusterNetId net_id,
                        curr_bb_edge[old_layer_num].ymin,
                        curr_bb_coord[old_layer_num].ymin,
                        bb_edge_new[old_layer_num].ymin,
-                       bb_coord_new[old_layer_num].ymin);
-        if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+                       bb_coord_new[old_layer_num].ymin,
+                       placer_ctx);
+        if (p_cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
             return;
         }
     }
@@ -3746,19 +5224,21 @@ static void update_bb_pin_sink_count(ClusterNetId /* net_id */,
 }
 
 static inline void update_bb_edge(ClusterNetId net_id,
-                                  std::vector<t_2D_bb>& bb_edge_new,
-                                  std::vector<t_2D_bb>& bb_coord_new,
+                                  vtr::NdMatrixProxy<t_2D_bb, 1> bb_edge_new,
+                                  vtr::NdMatrixProxy<t_2D_bb, 1> bb_coord_new,
                                   vtr::NdMatrixProxy<int, 1> bb_layer_pin_sink_count,
                                   const int& old_num_block_on_edge,
                                   const int& old_edge_coord,
                                   int& new_num_block_on_edge,
-                                  int& new_edge_coord) {
+                                  int& new_edge_coord,
+                                  PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
     if (old_num_block_on_edge == 1) {
         get_layer_bb_from_scratch(net_id,
                                   bb_edge_new,
                                   bb_coord_new,
                                   bb_layer_pin_sink_count);
-        bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+        p_cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
         return;
     } else {
         new_num_block_on_edge = old_num_block_on_edge - 1;
@@ -3803,12 +5283,13 @@ static void add_block_to_bb(const t_physical_tile_loc& new_pin_loc,
     }
 }
 
-static void free_fast_cost_update() {
-    chanx_place_cost_fac.clear();
-    chany_place_cost_fac.clear();
+static void free_fast_cost_update(PlacerContext& placer_ctx) {
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
+    p_cost_ctx.chanx_place_cost_fac.clear();
+    p_cost_ctx.chany_place_cost_fac.clear();
 }
 
-static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
+static void alloc_and_load_for_fast_cost_update(float place_cost_exp, PlacerContext& placer_ctx) {
     /* Allocates and loads the chanx_place_cost_fac and chany_place_cost_fac *
      * arrays with the inverse of the average number of tracks per channel   *
      * between [subhigh] and [sublow].  This is only useful for the cost     *
@@ -3820,6 +5301,7 @@ static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
      * you do any placement cost determination.  The place_cost_exp factor   *
      * specifies to what power the width of the channel should be taken --   *
      * larger numbers make narrower channels more expensive.                 */
+    auto& p_cost_ctx = placer_ctx.mutable_cost();
 
     auto& device_ctx = g_vpr_ctx.device();
 
@@ -3835,18 +5317,18 @@ static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
     //for (size_t i = 0; i < device_ctx.grid.width(); i++)
     //    chany_place_cost_fac[i] = new float[(i + 1)];
 
-    chanx_place_cost_fac.resize({device_ctx.grid.height(), device_ctx.grid.height() + 1});
-    chany_place_cost_fac.resize({device_ctx.grid.width(), device_ctx.grid.width() + 1});
+    p_cost_ctx.chanx_place_cost_fac.resize({device_ctx.grid.height(), device_ctx.grid.height() + 1});
+    p_cost_ctx.chany_place_cost_fac.resize({device_ctx.grid.width(), device_ctx.grid.width() + 1});
 
     /* First compute the number of tracks between channel high and channel *
      * low, inclusive, in an efficient manner.                             */
 
-    chanx_place_cost_fac[0][0] = device_ctx.chan_width.x_list[0];
+    p_cost_ctx.chanx_place_cost_fac[0][0] = device_ctx.chan_width.x_list[0];
 
     for (size_t high = 1; high < device_ctx.grid.height(); high++) {
-        chanx_place_cost_fac[high][high] = device_ctx.chan_width.x_list[high];
+        p_cost_ctx.chanx_place_cost_fac[high][high] = device_ctx.chan_width.x_list[high];
         for (size_t low = 0; low < high; low++) {
-            chanx_place_cost_fac[high][low] = chanx_place_cost_fac[high - 1][low]
+            p_cost_ctx.chanx_place_cost_fac[high][low] = p_cost_ctx.chanx_place_cost_fac[high - 1][low]
                                               + device_ctx.chan_width.x_list[high];
         }
     }
@@ -3866,27 +5348,27 @@ static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
              * will result in infinite wiring capacity normalization       *
              * factor, and extremely bad placer behaviour. Hence we change *
              * this to a small (1 track) channel capacity instead.         */
-            if (chanx_place_cost_fac[high][low] == 0.0f) {
+            if (p_cost_ctx.chanx_place_cost_fac[high][low] == 0.0f) {
                 VTR_LOG_WARN("CHANX place cost fac is 0 at %d %d\n", high, low);
-                chanx_place_cost_fac[high][low] = 1.0f;
+                p_cost_ctx.chanx_place_cost_fac[high][low] = 1.0f;
             }
 
-            chanx_place_cost_fac[high][low] = (high - low + 1.)
-                                              / chanx_place_cost_fac[high][low];
-            chanx_place_cost_fac[high][low] = pow(
-                (double)chanx_place_cost_fac[high][low],
+            p_cost_ctx.chanx_place_cost_fac[high][low] = (high - low + 1.)
+                                              / p_cost_ctx.chanx_place_cost_fac[high][low];
+            p_cost_ctx.chanx_place_cost_fac[high][low] = pow(
+                (double)p_cost_ctx.chanx_place_cost_fac[high][low],
                 (double)place_cost_exp);
         }
 
     /* Now do the same thing for the y-directed channels.  First get the  *
      * number of tracks between channel high and channel low, inclusive.  */
 
-    chany_place_cost_fac[0][0] = device_ctx.chan_width.y_list[0];
+    p_cost_ctx.chany_place_cost_fac[0][0] = device_ctx.chan_width.y_list[0];
 
     for (size_t high = 1; high < device_ctx.grid.width(); high++) {
-        chany_place_cost_fac[high][high] = device_ctx.chan_width.y_list[high];
+        p_cost_ctx.chany_place_cost_fac[high][high] = device_ctx.chan_width.y_list[high];
         for (size_t low = 0; low < high; low++) {
-            chany_place_cost_fac[high][low] = chany_place_cost_fac[high - 1][low]
+            p_cost_ctx.chany_place_cost_fac[high][low] = p_cost_ctx.chany_place_cost_fac[high - 1][low]
                                               + device_ctx.chan_width.y_list[high];
         }
     }
@@ -3901,15 +5383,15 @@ static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
              * will result in infinite wiring capacity normalization       *
              * factor, and extremely bad placer behaviour. Hence we change *
              * this to a small (1 track) channel capacity instead.         */
-            if (chany_place_cost_fac[high][low] == 0.0f) {
+            if (p_cost_ctx.chany_place_cost_fac[high][low] == 0.0f) {
                 VTR_LOG_WARN("CHANY place cost fac is 0 at %d %d\n", high, low);
-                chany_place_cost_fac[high][low] = 1.0f;
+                p_cost_ctx.chany_place_cost_fac[high][low] = 1.0f;
             }
 
-            chany_place_cost_fac[high][low] = (high - low + 1.)
-                                              / chany_place_cost_fac[high][low];
-            chany_place_cost_fac[high][low] = pow(
-                (double)chany_place_cost_fac[high][low],
+            p_cost_ctx.chany_place_cost_fac[high][low] = (high - low + 1.)
+                                              / p_cost_ctx.chany_place_cost_fac[high][low];
+            p_cost_ctx.chany_place_cost_fac[high][low] = pow(
+                (double)p_cost_ctx.chany_place_cost_fac[high][low],
                 (double)place_cost_exp);
         }
 }
@@ -3918,7 +5400,8 @@ static void check_place(const t_placer_costs& costs,
                         const PlaceDelayModel* delay_model,
                         const PlacerCriticalities* criticalities,
                         const t_place_algorithm& place_algorithm,
-                        const t_noc_opts& noc_opts) {
+                        const t_noc_opts& noc_opts,
+                        PlacerContext& placer_ctx) {
     /* Checks that the placement has not confused our data structures. *
      * i.e. the clb and block structures agree about the locations of  *
      * every block, blocks are in legal spots, etc.  Also recomputes   *
@@ -3929,7 +5412,8 @@ static void check_place(const t_placer_costs& costs,
 
     error += check_placement_consistency();
     error += check_placement_costs(costs, delay_model, criticalities,
-                                   place_algorithm);
+                                   place_algorithm,
+                                   placer_ctx);
     error += check_placement_floorplanning();
 
     // check the NoC costs during placement if the user is using the NoC supported flow
@@ -3952,7 +5436,8 @@ static void check_place(const t_placer_costs& costs,
 static int check_placement_costs(const t_placer_costs& costs,
                                  const PlaceDelayModel* delay_model,
                                  const PlacerCriticalities* criticalities,
-                                 const t_place_algorithm& place_algorithm) {
+                                 const t_place_algorithm& place_algorithm,
+                                 PlacerContext& placer_ctx) {
     int error = 0;
     double bb_cost_check;
     double timing_cost_check;
@@ -3960,10 +5445,10 @@ static int check_placement_costs(const t_placer_costs& costs,
     const auto& cube_bb = g_vpr_ctx.placement().cube_bb;
 
     if (cube_bb) {
-        bb_cost_check = comp_bb_cost(CHECK);
+        bb_cost_check = comp_bb_cost(CHECK, placer_ctx);
     } else {
         VTR_ASSERT_SAFE(!cube_bb);
-        bb_cost_check = comp_layer_bb_cost(CHECK);
+        bb_cost_check = comp_layer_bb_cost(CHECK, placer_ctx);
     }
 
     if (fabs(bb_cost_check - costs.bb_cost) > costs.bb_cost * ERROR_TOL) {
@@ -4118,25 +5603,24 @@ int check_macro_placement_consistency() {
 
 #ifdef VERBOSE
 void print_clb_placement(const char* fname) {
-    /* Prints out the clb placements to a file.  */
-    FILE* fp;
+    /* Prints out the clb placements to a file (written in the background).  */
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.placement();
 
-    fp = vtr::fopen(fname, "w");
-    fprintf(fp, "Complex block placements:\n\n");
+    AsyncOutputFile os(fname);
+    os << "Complex block placements:\n\n";
 
-    fprintf(fp, "Block #\tName\t(X, Y, Z).\n");
+    os << "Block #\tName\t(X, Y, Z).\n";
     for (auto i : cluster_ctx.clb_nlist.blocks()) {
-        fprintf(fp, "#%d\t%s\t(%d, %d, %d).\n", i, cluster_ctx.clb_nlist.block_name(i).c_str(), place_ctx.block_locs[i].loc.x, place_ctx.block_locs[i].loc.y, place_ctx.block_locs[i].loc.sub_tile);
+        os << "#" << size_t(i) << "\t" << cluster_ctx.clb_nlist.block_name(i) << "\t(" << place_ctx.block_locs[i].loc.x << ", "
+           << place_ctx.block_locs[i].loc.y << ", " << place_ctx.block_locs[i].loc.sub_tile << ").\n";
     }
-
-    fclose(fp);
 }
 #endif
 
 static void free_try_swap_arrays() {
     g_vpr_ctx.mutable_placement().compressed_block_grids.clear();
+    g_vpr_ctx.mutable_placement().block_region_locs.clear();
 }
 
 static void generate_post_place_timing_reports(const t_placer_opts& placer_opts,
@@ -4154,9 +5638,40 @@ static void generate_post_place_timing_reports(const t_placer_opts& placer_opts,
     tatum::TimingReporter timing_reporter(resolver, *timing_ctx.graph,
                                           *timing_ctx.constraints);
 
+    AsyncOutputFile os(placer_opts.post_place_timing_report_file);
     timing_reporter.report_timing_setup(
-        placer_opts.post_place_timing_report_file,
-        *timing_info.setup_analyzer(), analysis_opts.timing_report_npaths);
+        os, *timing_info.setup_analyzer(), analysis_opts.timing_report_npaths);
+}
+
+/* Writes the final placement timing echo files and reports, and prints the timing summary */
+static void report_final_placement_timing(const t_placer_opts& placer_opts,
+                                          const t_analysis_opts& analysis_opts,
+                                          SetupTimingInfo& timing_info,
+                                          const PlacementDelayCalculator& delay_calc,
+                                          bool is_flat) {
+    auto& timing_ctx = g_vpr_ctx.timing();
+
+    if (isEchoFileEnabled(E_ECHO_FINAL_PLACEMENT_TIMING_GRAPH)) {
+        tatum::write_echo(
+            getEchoFileName(E_ECHO_FINAL_PLACEMENT_TIMING_GRAPH),
+            *timing_ctx.graph, *timing_ctx.constraints,
+            delay_calc, timing_info.analyzer());
+
+        tatum::NodeId debug_tnode = id_or_pin_name_to_tnode(
+            analysis_opts.echo_dot_timing_graph_node);
+        write_setup_timing_graph_dot(
+            getEchoFileName(E_ECHO_FINAL_PLACEMENT_TIMING_GRAPH)
+                + std::string(".dot"),
+            timing_info, debug_tnode);
+    }
+
+    generate_post_place_timing_reports(placer_opts, analysis_opts,
+                                       timing_info, delay_calc, is_flat);
+
+    /* Print critical path delay metrics */
+    VTR_LOG("\n");
+    print_setup_timing_summary(*timing_ctx.constraints,
+                               *timing_info.setup_analyzer(), "Placement estimated ", "");
 }
 
 #if 0
@@ -4247,44 +5762,52 @@ static void print_resources_utilization() {
     VTR_LOG("\n");
 }
 
-static void print_placement_swaps_stats(const t_annealing_state& state) {
-    size_t total_swap_attempts = num_swap_rejected + num_swap_accepted
-                                 + num_swap_aborted;
+static void print_placement_swaps_stats(const t_annealing_state& state, PlacerContext& placer_ctx) {
+    auto& p_runtime_ctx = placer_ctx.mutable_runtime();
+    size_t total_swap_attempts = p_runtime_ctx.num_swap_rejected + p_runtime_ctx.num_swap_accepted
+                                 + p_runtime_ctx.num_swap_aborted;
     VTR_ASSERT(total_swap_attempts > 0);
 
     size_t num_swap_print_digits = ceil(log10(total_swap_attempts));
-    float reject_rate = (float)num_swap_rejected / total_swap_attempts;
-    float accept_rate = (float)num_swap_accepted / total_swap_attempts;
-    float abort_rate = (float)num_swap_aborted / total_swap_attempts;
+    float reject_rate = (float)p_runtime_ctx.num_swap_rejected / total_swap_attempts;
+    float accept_rate = (float)p_runtime_ctx.num_swap_accepted / total_swap_attempts;
+    float abort_rate = (float)p_runtime_ctx.num_swap_aborted / total_swap_attempts;
     VTR_LOG("Placement number of temperatures: %d\n", state.num_temps);
     VTR_LOG("Placement total # of swap attempts: %*d\n", num_swap_print_digits,
             total_swap_attempts);
     VTR_LOG("\tSwaps accepted: %*d (%4.1f %%)\n", num_swap_print_digits,
-            num_swap_accepted, 100 * accept_rate);
+            p_runtime_ctx.num_swap_accepted, 100 * accept_rate);
     VTR_LOG("\tSwaps rejected: %*d (%4.1f %%)\n", num_swap_print_digits,
-            num_swap_rejected, 100 * reject_rate);
+            p_runtime_ctx.num_swap_rejected, 100 * reject_rate);
     VTR_LOG("\tSwaps aborted: %*d (%4.1f %%)\n", num_swap_print_digits,
-            num_swap_aborted, 100 * abort_rate);
+            p_runtime_ctx.num_swap_aborted, 100 * abort_rate);
 }
 
 static void print_placement_move_types_stats(
     const MoveTypeStat& move_type_stat) {
     float moves, accepted, rejected, aborted;
+    double propose_time, evaluate_time;
 
     VTR_LOG("\n\nPlacement perturbation distribution by block and move type: \n");
 
     VTR_LOG(
-        "------------------ ----------------- ---------------- ---------------- --------------- ------------ \n");
+        "------------------ ----------------- ---------------- ---------------- --------------- ------------ ----------- ------------ ----------- \n");
     VTR_LOG(
-        "    Block Type         Move Type       (%%) of Total      Accepted(%%)     Rejected(%%)    Aborted(%%)\n");
+        "    Block Type         Move Type       (%%) of Total      Accepted(%%)     Rejected(%%)    Aborted(%%)  Propose(us) Evaluate(us)  (%%) of Time\n");
     VTR_LOG(
-        "------------------ ----------------- ---------------- ---------------- --------------- ------------ \n");
+        "------------------ ----------------- ---------------- ---------------- --------------- ------------ ----------- ------------ ----------- \n");
 
     float total_moves = 0;
     for (int blk_type_move : move_type_stat.blk_type_moves) {
         total_moves += blk_type_move;
     }
 
+    //The time spent proposing and evaluating the moves of all types
+    double total_time = 0.;
+    for (size_t i = 0; i < move_type_stat.blk_type_moves.size(); i++) {
+        total_time += move_type_stat.propose_time[i] + move_type_stat.evaluate_time[i];
+    }
+
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
     int count = 0;
@@ -4306,16 +5829,20 @@ static void print_placement_move_types_stats(
                 accepted = move_type_stat.accepted_moves[itype.index * num_of_avail_moves + imove];
                 rejected = move_type_stat.rejected_moves[itype.index * num_of_avail_moves + imove];
                 aborted = moves - (accepted + rejected);
+                propose_time = move_type_stat.propose_time[itype.index * num_of_avail_moves + imove];
+                evaluate_time = move_type_stat.evaluate_time[itype.index * num_of_avail_moves + imove];
                 if (count == 0) {
                     VTR_LOG("%-18.20s", itype.name);
                 } else {
                     VTR_LOG("                  ");
                 }
                 VTR_LOG(
-                    " %-22.20s %-16.2f %-15.2f %-14.2f %-13.2f\n",
+                    " %-22.20s %-16.2f %-15.2f %-14.2f %-10.2f %11.3f %12.3f %11.2f\n",
                     move_name.c_str(), 100 * moves / total_moves,
                     100 * accepted / moves, 100 * rejected / moves,
-                    100 * aborted / moves);
+                    100 * aborted / moves,
+                    1e6 * propose_time / moves, 1e6 * evaluate_time / moves,
+                    (total_time > 0.) ? 100 * (propose_time + evaluate_time) / total_time : 0.);
             }
             count++;
         }
@@ -1,20 +1,55 @@
 #ifndef VPR_PLACE_H
 #define VPR_PLACE_H
 
+#include <limits>
+#include <memory>
+
 #include "vpr_types.h"
 
-void try_place(const Netlist<>& net_list,
-               const t_placer_opts& placer_opts,
-               t_annealing_sched annealing_sched,
-               const t_router_opts& router_opts,
-               const t_analysis_opts& analysis_opts,
-               const t_noc_opts& noc_opts,
-               t_chan_width_dist chan_width_dist,
-               t_det_routing_arch* det_routing_arch,
-               std::vector<t_segment_inf>& segment_inf,
-               t_direct_inf* directs,
-               int num_directs,
-               bool is_flat);
+class PlaceDelayModel;
+
+///@brief The quality of a placement produced by try_place()
+struct t_place_result {
+    double bb_cost = 0.;
+    float cpd = std::numeric_limits<float>::quiet_NaN(); ///<Estimated critical path delay (NaN if not timing-driven)
+};
+
+/**
+ * @brief Places the clustered netlist.
+ *
+ * place_delay_model is computed if the placement is timing-driven and it is null,
+ * and is otherwise reused (e.g. by later placements with other seeds).
+ */
+t_place_result try_place(const Netlist<>& net_list,
+                         const t_placer_opts& placer_opts,
+                         t_annealing_sched annealing_sched,
+                         const t_router_opts& router_opts,
+                         const t_analysis_opts& analysis_opts,
+                         const t_noc_opts& noc_opts,
+                         t_chan_width_dist chan_width_dist,
+                         t_det_routing_arch* det_routing_arch,
+                         std::vector<t_segment_inf>& segment_inf,
+                         t_direct_inf* directs,
+                         int num_directs,
+                         bool is_flat,
+                         std::unique_ptr<PlaceDelayModel>& place_delay_model);
+
+/**
+ * @brief Loads block_locs as the placement, and re-runs the final analysis of try_place() on it.
+ *
+ * For a placement which is not the last one try_place() produced (e.g. the best of several seeds,
+ * see --place_num_seeds): the final timing analysis, timing reports and NoC traffic flow routing
+ * (and NoC placement file) of the last placement are replaced by those of block_locs.
+ */
+t_place_result load_placement_and_analyze(const Netlist<>& net_list,
+                                          const vtr::vector_map<ClusterBlockId, t_block_loc>& block_locs,
+                                          const t_placer_opts& placer_opts,
+                                          const t_analysis_opts& analysis_opts,
+                                          const t_noc_opts& noc_opts,
+                                          t_direct_inf* directs,
+                                          int num_directs,
+                                          const PlaceDelayModel* place_delay_model,
+                                          bool is_flat);
 
 bool placer_needs_lookahead(const t_vpr_setup& vpr_setup);
 
@@ -1,6 +1,27 @@
 #include "place_checkpoint.h"
 #include "noc_place_utils.h"
 
+#include <cstdint>
+#include <cstdio>
+
+#include "vtr_flat_blob.h"
+#include "vpr_error.h"
+
+///@brief Bumped whenever the meaning of a section of an on-disk placement checkpoint changes
+constexpr int32_t ANNEAL_CHECKPOINT_VERSION = 1;
+
+///@brief The sections of an on-disk placement checkpoint, in file order
+enum e_anneal_checkpoint_section {
+    ANNEAL_CHECKPOINT_HEADER = 0,          ///<int32_t: version, number of blocks
+    ANNEAL_CHECKPOINT_NETLIST_ID,          ///<char: the clustered netlist id
+    ANNEAL_CHECKPOINT_ANNEALING_STATE,     ///<float: t, restart_t, alpha, rlim, crit_exponent
+    ANNEAL_CHECKPOINT_COUNTERS,            ///<int64_t: num_temps, move_lim, move_lim_max, tot_iter, moves_since_cost_recompute, outer_crit_iter_count, agent_state, rand_state
+    ANNEAL_CHECKPOINT_BLOCK_LOCS,          ///<t_pl_loc: per block
+    ANNEAL_CHECKPOINT_MOVE_GENERATOR,      ///<double: MoveGenerator::save_state() of the first move generator
+    ANNEAL_CHECKPOINT_MOVE_GENERATOR2,     ///<double: MoveGenerator::save_state() of the second move generator
+    ANNEAL_CHECKPOINT_NUM_SECTIONS
+};
+
 float t_placement_checkpoint::get_cp_cpd() { return cpd; }
 double t_placement_checkpoint::get_cp_bb_cost() { return costs.bb_cost; }
 bool t_placement_checkpoint::cp_is_valid() { return valid; }
@@ -36,6 +57,7 @@ void restore_best_placement(t_placement_checkpoint& placement_checkpoint, std::s
         placer_criticalities.get()->set_recompute_required();
         placer_setup_slacks.get()->set_recompute_required();
         comp_td_connection_delays(place_delay_model.get());
+        invalidate_all_connection_delays();
         perform_full_timing_update(crit_params,
                                    place_delay_model.get(),
                                    placer_criticalities.get(),
@@ -56,3 +78,90 @@ void restore_best_placement(t_placement_checkpoint& placement_checkpoint, std::s
         VTR_LOG("\nCheckpoint restored\n");
     }
 }
+
+void write_anneal_checkpoint(const std::string& file, const t_anneal_checkpoint& checkpoint) {
+    const std::string& netlist_id = g_vpr_ctx.clustering().clb_nlist.netlist_id();
+
+    vtr::FlatBlobWriter writer;
+    writer.add_array(std::vector<int32_t>{ANNEAL_CHECKPOINT_VERSION, int32_t(checkpoint.block_locs.size())});
+    writer.add_array(std::vector<char>(netlist_id.begin(), netlist_id.end()));
+    writer.add_array(std::vector<float>{checkpoint.t, checkpoint.restart_t, checkpoint.alpha, checkpoint.rlim, checkpoint.crit_exponent});
+    writer.add_array(std::vector<int64_t>{checkpoint.num_temps, checkpoint.move_lim, checkpoint.move_lim_max,
+                                          checkpoint.tot_iter, checkpoint.moves_since_cost_recompute, checkpoint.outer_crit_iter_count,
+                                          checkpoint.agent_state, checkpoint.rand_state});
+    //Referenced, not copied: the block locations are the bulk of the checkpoint
+    writer.add_array(vtr::array_view<const t_pl_loc>(checkpoint.block_locs.data(), checkpoint.block_locs.size()));
+    writer.add_array(checkpoint.move_generator_state);
+    writer.add_array(checkpoint.move_generator2_state);
+    VTR_ASSERT(writer.num_sections() == ANNEAL_CHECKPOINT_NUM_SECTIONS);
+
+    //Replacing the previous checkpoint only once the new one is complete, since the
+    //process may be killed at any time
+    std::string tmp_file = file + ".tmp";
+    try {
+        writer.write(tmp_file);
+    } catch (const vtr::VtrError& e) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Failed to write placement checkpoint: %s\n", e.what());
+    }
+    if (std::rename(tmp_file.c_str(), file.c_str()) != 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Failed to replace placement checkpoint '%s'\n", file.c_str());
+    }
+}
+
+t_anneal_checkpoint read_anneal_checkpoint(const std::string& file) {
+    const auto& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+
+    t_anneal_checkpoint checkpoint;
+    try {
+        vtr::FlatBlobReader reader(file);
+        if (reader.num_sections() != ANNEAL_CHECKPOINT_NUM_SECTIONS) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "'%s' is not a placement checkpoint\n", file.c_str());
+        }
+
+        auto header = reader.array<int32_t>(ANNEAL_CHECKPOINT_HEADER);
+        if (header.size() != 2 || header[0] != ANNEAL_CHECKPOINT_VERSION) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' has an unsupported version\n", file.c_str());
+        }
+
+        auto netlist_id = reader.array<char>(ANNEAL_CHECKPOINT_NETLIST_ID);
+        if (std::string(netlist_id.begin(), netlist_id.end()) != clb_nlist.netlist_id()
+            || size_t(header[1]) != clb_nlist.blocks().size()) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' was written for a different clustered netlist\n", file.c_str());
+        }
+
+        auto annealing_state = reader.array<float>(ANNEAL_CHECKPOINT_ANNEALING_STATE);
+        auto counters = reader.array<int64_t>(ANNEAL_CHECKPOINT_COUNTERS);
+        auto block_locs = reader.array<t_pl_loc>(ANNEAL_CHECKPOINT_BLOCK_LOCS);
+        if (annealing_state.size() != 5 || counters.size() != 8 || block_locs.size() != clb_nlist.blocks().size()) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' is corrupted\n", file.c_str());
+        }
+
+        checkpoint.t = annealing_state[0];
+        checkpoint.restart_t = annealing_state[1];
+        checkpoint.alpha = annealing_state[2];
+        checkpoint.rlim = annealing_state[3];
+        checkpoint.crit_exponent = annealing_state[4];
+
+        checkpoint.num_temps = counters[0];
+        checkpoint.move_lim = counters[1];
+        checkpoint.move_lim_max = counters[2];
+        checkpoint.tot_iter = counters[3];
+        checkpoint.moves_since_cost_recompute = counters[4];
+        checkpoint.outer_crit_iter_count = counters[5];
+        checkpoint.agent_state = counters[6];
+        checkpoint.rand_state = counters[7];
+
+        checkpoint.block_locs.assign(block_locs.begin(), block_locs.end());
+
+        auto move_generator_state = reader.array<double>(ANNEAL_CHECKPOINT_MOVE_GENERATOR);
+        checkpoint.move_generator_state.assign(move_generator_state.begin(), move_generator_state.end());
+        auto move_generator2_state = reader.array<double>(ANNEAL_CHECKPOINT_MOVE_GENERATOR2);
+        checkpoint.move_generator2_state.assign(move_generator2_state.begin(), move_generator2_state.end());
+    } catch (const VprError&) {
+        throw;
+    } catch (const vtr::VtrError& e) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Failed to read placement checkpoint: %s\n", e.what());
+    }
+
+    return checkpoint;
+}
@@ -10,6 +10,11 @@
 
 #include "place_delay_model.h"
 #include "place_timing_update.h"
+
+#include <string>
+#include <vector>
+
+#include "vtr_random.h"
 //Placement checkpoint
 /**
  * @brief Data structure that stores the placement state and saves it as a checkpoint.
@@ -51,4 +56,45 @@ void save_placement_checkpoint_if_needed(t_placement_checkpoint& placement_check
 
 //restore the checkpoint if it's better than the latest placement solution
 void restore_best_placement(t_placement_checkpoint& placement_checkpoint, std::shared_ptr<SetupTimingInfo>& timing_info, t_placer_costs& costs, std::unique_ptr<PlacerCriticalities>& placer_criticalities, std::unique_ptr<PlacerSetupSlacks>& placer_setup_slacks, std::unique_ptr<PlaceDelayModel>& place_delay_model, std::unique_ptr<NetPinTimingInvalidator>& pin_timing_invalidator, PlaceCritParams crit_params, const t_noc_opts& noc_opts);
+
+//On-disk placement checkpoint
+/**
+ * @brief The annealer state saved in an on-disk checkpoint, to resume an interrupted placement.
+ *
+ * Placement checkpoints (--place_checkpoint_file) are written between temperatures; together with the
+ * (unchanged) placer options they hold everything needed to continue the annealing from there (--place_resume).
+ *
+ *   @param t, restart_t, alpha, rlim, crit_exponent, num_temps, move_lim, move_lim_max The t_annealing_state
+ *   @param tot_iter, moves_since_cost_recompute, outer_crit_iter_count The annealer loop counters
+ *   @param agent_state The RL agent state (e_agent_state)
+ *   @param rand_state The random number generator state
+ *   @param block_locs The location of each block
+ *   @param move_generator_state, move_generator2_state See MoveGenerator::save_state()
+ */
+struct t_anneal_checkpoint {
+    float t = 0.;
+    float restart_t = 0.;
+    float alpha = 0.;
+    float rlim = 0.;
+    float crit_exponent = 0.;
+    int num_temps = 0;
+    int move_lim = 0;
+    int move_lim_max = 0;
+
+    int tot_iter = 0;
+    int moves_since_cost_recompute = 0;
+    int outer_crit_iter_count = 0;
+    int agent_state = 0;
+    vtr::RandState rand_state = 0;
+
+    std::vector<t_pl_loc> block_locs;
+    std::vector<double> move_generator_state;
+    std::vector<double> move_generator2_state;
+};
+
+///@brief Writes checkpoint to file (atomically, so an interrupted write leaves any previous checkpoint intact)
+void write_anneal_checkpoint(const std::string& file, const t_anneal_checkpoint& checkpoint);
+
+///@brief Reads a checkpoint written by write_anneal_checkpoint() for the current clustered netlist
+t_anneal_checkpoint read_anneal_checkpoint(const std::string& file);
 #endif
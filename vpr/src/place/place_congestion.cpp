@@ -0,0 +1,101 @@
+#include "place_congestion.h"
+
+#include <algorithm>
+
+#include "vtr_assert.h"
+
+PlacerCongestionMap::PlacerCongestionMap(size_t width, size_t height)
+    : width_(width)
+    , height_(height)
+    , capacity_({width, height}, 0.)
+    , demand_({width, height}, 0.)
+    , proposed_({width, height}, 0.)
+    , is_staged_({width, height}, false) {
+    VTR_ASSERT(width > 0 && height > 0);
+}
+
+void PlacerCongestionMap::set_capacity(size_t x, size_t y, double capacity) {
+    capacity_[x][y] = capacity;
+}
+
+void PlacerCongestionMap::clear_demand() {
+    revert_proposed();
+    demand_.fill(0.);
+}
+
+void PlacerCongestionMap::add_net(const vtr::Rect<int>& bb, double wirelength) {
+    VTR_ASSERT_SAFE(bb.xmin() >= 0 && size_t(bb.xmax()) < width_);
+    VTR_ASSERT_SAFE(bb.ymin() >= 0 && size_t(bb.ymax()) < height_);
+
+    double density = wirelength / (double(bb.xmax() - bb.xmin() + 1) * double(bb.ymax() - bb.ymin() + 1));
+    for (int x = bb.xmin(); x <= bb.xmax(); ++x) {
+        for (int y = bb.ymin(); y <= bb.ymax(); ++y) {
+            demand_[x][y] += density;
+        }
+    }
+}
+
+void PlacerCongestionMap::propose_net(const vtr::Rect<int>& old_bb, double old_wirelength, const vtr::Rect<int>& new_bb, double new_wirelength) {
+    if (old_bb == new_bb && old_wirelength == new_wirelength) {
+        return; //Same demand
+    }
+    stage(old_bb, -old_wirelength);
+    stage(new_bb, new_wirelength);
+}
+
+double PlacerCongestionMap::proposed_delta_cost() const {
+    double delta_cost = 0.;
+    for (const auto& tile : staged_tiles_) {
+        double demand = demand_[tile.x()][tile.y()];
+        delta_cost += tile_cost(tile.x(), tile.y(), demand + proposed_[tile.x()][tile.y()])
+                      - tile_cost(tile.x(), tile.y(), demand);
+    }
+    return delta_cost;
+}
+
+void PlacerCongestionMap::commit_proposed() {
+    for (const auto& tile : staged_tiles_) {
+        demand_[tile.x()][tile.y()] += proposed_[tile.x()][tile.y()];
+    }
+    revert_proposed();
+}
+
+void PlacerCongestionMap::revert_proposed() {
+    for (const auto& tile : staged_tiles_) {
+        proposed_[tile.x()][tile.y()] = 0.;
+        is_staged_[tile.x()][tile.y()] = false;
+    }
+    staged_tiles_.clear();
+}
+
+double PlacerCongestionMap::cost() const {
+    double total_cost = 0.;
+    for (size_t x = 0; x < width_; ++x) {
+        for (size_t y = 0; y < height_; ++y) {
+            total_cost += tile_cost(x, y, demand_[x][y]);
+        }
+    }
+    return total_cost;
+}
+
+void PlacerCongestionMap::stage(const vtr::Rect<int>& bb, double wirelength) {
+    VTR_ASSERT_SAFE(bb.xmin() >= 0 && size_t(bb.xmax()) < width_);
+    VTR_ASSERT_SAFE(bb.ymin() >= 0 && size_t(bb.ymax()) < height_);
+
+    double density = wirelength / (double(bb.xmax() - bb.xmin() + 1) * double(bb.ymax() - bb.ymin() + 1));
+    for (int x = bb.xmin(); x <= bb.xmax(); ++x) {
+        for (int y = bb.ymin(); y <= bb.ymax(); ++y) {
+            if (!is_staged_[x][y]) {
+                is_staged_[x][y] = true;
+                staged_tiles_.emplace_back(x, y);
+            }
+            proposed_[x][y] += density;
+        }
+    }
+}
+
+double PlacerCongestionMap::tile_cost(size_t x, size_t y, double demand) const {
+    //Tiles without routing tracks are priced like single track tiles
+    double capacity = capacity_[x][y];
+    return std::max(0., demand - capacity) / std::max(capacity, 1.);
+}
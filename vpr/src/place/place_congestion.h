@@ -0,0 +1,91 @@
+#ifndef VPR_PLACE_CONGESTION_H
+#define VPR_PLACE_CONGESTION_H
+
+/**
+ * @file
+ * @brief An incrementally maintained RUDY (Rectangular Uniform wire DensitY) routing demand map,
+ *        used by the optional congestion cost of the annealer (see --place_congestion_weight)
+ *
+ * Each net spreads its estimated wirelength uniformly over the tiles of its bounding box: a net
+ * of wirelength L whose bounding box covers w x h tiles adds L / (w * h) tracks of demand to each
+ * of them. The congestion cost is the routing demand in excess of the tile track capacities,
+ * relative to those capacities, summed over the tiles.
+ *
+ * Moving a net costs O(area of its old and new bounding boxes). The moves are staged: the demand
+ * changes of all the nets of a move are accumulated by propose_net(), priced by
+ * proposed_delta_cost() and then either applied by commit_proposed() or dropped by
+ * revert_proposed(). Nets of the same move sharing tiles are therefore priced exactly.
+ *
+ * @cite RUDY
+ * Fast and Accurate Routing Demand Estimation for Efficient Routability-driven Placement,
+ * Peter Spindler and Frank M. Johannes
+ */
+
+#include <vector>
+
+#include "vtr_geometry.h"
+#include "vtr_ndmatrix.h"
+
+class PlacerCongestionMap {
+  public:
+    ///@brief An empty map (the congestion cost is disabled)
+    PlacerCongestionMap() = default;
+
+    ///@brief A map of width x height tiles, with no demand and no capacity
+    PlacerCongestionMap(size_t width, size_t height);
+
+    bool empty() const { return width_ == 0; }
+
+    ///@brief Sets the number of routing tracks of tile (x, y)
+    void set_capacity(size_t x, size_t y, double capacity);
+
+    ///@brief Removes the demand of all the nets (and any proposed change)
+    void clear_demand();
+
+    /**
+     * @brief Adds the demand of a net of the given wirelength whose bounding box covers the tiles
+     *        [xmin..xmax] x [ymin..ymax] of bb (negative wirelengths remove it)
+     */
+    void add_net(const vtr::Rect<int>& bb, double wirelength);
+
+    /**
+     * @brief Stages moving a net from old_bb to new_bb, both with the given wirelengths
+     *
+     * The committed demand is not changed until commit_proposed().
+     */
+    void propose_net(const vtr::Rect<int>& old_bb, double old_wirelength, const vtr::Rect<int>& new_bb, double new_wirelength);
+
+    ///@brief Returns the change of cost() the staged net moves would make
+    double proposed_delta_cost() const;
+
+    ///@brief Applies the staged net moves to the demand
+    void commit_proposed();
+
+    ///@brief Drops the staged net moves
+    void revert_proposed();
+
+    ///@brief Returns the congestion cost of the committed demand
+    double cost() const;
+
+    ///@brief Returns the routing demand of tile (x, y), in tracks
+    double demand(size_t x, size_t y) const { return demand_[x][y]; }
+
+    ///@brief Returns the routing tracks of tile (x, y)
+    double capacity(size_t x, size_t y) const { return capacity_[x][y]; }
+
+  private:
+    void stage(const vtr::Rect<int>& bb, double wirelength);
+    double tile_cost(size_t x, size_t y, double demand) const;
+
+    size_t width_ = 0;
+    size_t height_ = 0;
+
+    vtr::Matrix<double> capacity_; ///<[x][y] the routing tracks of tile (x, y)
+    vtr::Matrix<double> demand_;   ///<[x][y] the committed routing demand of tile (x, y)
+    vtr::Matrix<double> proposed_; ///<[x][y] the staged change of the demand of tile (x, y)
+
+    vtr::Matrix<char> is_staged_;               ///<[x][y] true if tile (x, y) is in staged_tiles_
+    std::vector<vtr::Point<size_t>> staged_tiles_; ///<The tiles with a staged demand change
+};
+
+#endif
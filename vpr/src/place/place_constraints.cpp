@@ -38,6 +38,50 @@ bool is_cluster_constrained(ClusterBlockId blk_id) {
     return (!pr.empty());
 }
 
+void update_block_region_locs(ClusterBlockId blk_id) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+    auto& floorplanning_ctx = g_vpr_ctx.floorplanning();
+
+    place_ctx.block_region_locs.resize(cluster_ctx.clb_nlist.blocks().size(), OPEN);
+
+    const PartitionRegion& pr = floorplanning_ctx.cluster_constraints[blk_id];
+    const std::vector<Region>& regions = pr.get_partition_region();
+    if (regions.empty()) {
+        place_ctx.block_region_locs[blk_id] = OPEN;
+        return;
+    }
+
+    auto& compressed_block_grid = place_ctx.compressed_block_grids[cluster_ctx.clb_nlist.block_type(blk_id)->index];
+    place_ctx.block_region_locs[blk_id] = find_compressed_region_locs(compressed_block_grid, regions);
+}
+
+void load_block_region_locs() {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    place_ctx.block_region_locs.clear();
+    for (auto& compressed_block_grid : place_ctx.compressed_block_grids) {
+        compressed_block_grid.region_locs.clear();
+    }
+
+    for (ClusterBlockId blk_id : cluster_ctx.clb_nlist.blocks()) {
+        update_block_region_locs(blk_id);
+    }
+}
+
+const t_compressed_region_locs* get_block_region_locs(ClusterBlockId blk_id) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    if (size_t(blk_id) >= place_ctx.block_region_locs.size() || place_ctx.block_region_locs[blk_id] == OPEN) {
+        return nullptr;
+    }
+
+    const auto& compressed_block_grid = place_ctx.compressed_block_grids[cluster_ctx.clb_nlist.block_type(blk_id)->index];
+    return &compressed_block_grid.region_locs[place_ctx.block_region_locs[blk_id]];
+}
+
 bool is_macro_constrained(const t_pl_macro& pl_macro) {
     bool is_macro_constrained = false;
     bool is_member_constrained = false;
@@ -74,7 +118,7 @@ PartitionRegion update_macro_head_pr(const t_pl_macro& pl_macro, const Partition
             PartitionRegion modified_pr;
 
             block_pr = floorplanning_ctx.cluster_constraints[iblk];
-            std::vector<Region> block_regions = block_pr.get_partition_region();
+            const std::vector<Region>& block_regions = block_pr.get_partition_region();
 
             for (unsigned int i = 0; i < block_regions.size(); i++) {
                 Region modified_reg;
@@ -115,8 +159,8 @@ PartitionRegion update_macro_head_pr(const t_pl_macro& pl_macro, const Partition
     return macro_head_pr;
 }
 
-PartitionRegion update_macro_member_pr(PartitionRegion& head_pr, const t_pl_offset& offset, const PartitionRegion& grid_pr, const t_pl_macro& pl_macro) {
-    std::vector<Region> block_regions = head_pr.get_partition_region();
+PartitionRegion update_macro_member_pr(const PartitionRegion& head_pr, const t_pl_offset& offset, const PartitionRegion& grid_pr, const t_pl_macro& pl_macro) {
+    const std::vector<Region>& block_regions = head_pr.get_partition_region();
     PartitionRegion macro_pr;
 
     for (unsigned int i = 0; i < block_regions.size(); i++) {
@@ -221,7 +265,7 @@ bool cluster_floorplanning_legal(ClusterBlockId blk_id, const t_pl_loc& loc) {
         //not constrained so will not have floorplanning issues
         floorplanning_good = true;
     } else {
-        PartitionRegion pr = floorplanning_ctx.cluster_constraints[blk_id];
+        const PartitionRegion& pr = floorplanning_ctx.cluster_constraints[blk_id];
         bool in_pr = pr.is_loc_in_part_reg(loc);
 
         //if location is in partitionregion, floorplanning is respected
@@ -256,7 +300,7 @@ void load_cluster_constraints() {
             PartitionId partid = floorplanning_ctx.constraints.get_atom_partition(atom);
 
             if (partid != PartitionId::INVALID()) {
-                PartitionRegion pr = floorplanning_ctx.constraints.get_partition_pr(partid);
+                const PartitionRegion& pr = floorplanning_ctx.constraints.get_partition_pr(partid);
                 if (floorplanning_ctx.cluster_constraints[cluster_id].empty()) {
                     floorplanning_ctx.cluster_constraints[cluster_id] = pr;
                 } else {
@@ -281,7 +325,7 @@ void mark_fixed_blocks() {
         if (!is_cluster_constrained(blk_id)) {
             continue;
         }
-        PartitionRegion pr = floorplanning_ctx.cluster_constraints[blk_id];
+        const PartitionRegion& pr = floorplanning_ctx.cluster_constraints[blk_id];
         auto block_type = cluster_ctx.clb_nlist.block_type(blk_id);
         t_pl_loc loc;
 
@@ -378,9 +422,9 @@ int region_tile_cover(const Region& reg, t_logical_block_type_ptr block_type, t_
  * PartitionRegion covers more than one tile, there is no need to check further regions
  * and the routine will return false.
  */
-bool is_pr_size_one(PartitionRegion& pr, t_logical_block_type_ptr block_type, t_pl_loc& loc) {
+bool is_pr_size_one(const PartitionRegion& pr, t_logical_block_type_ptr block_type, t_pl_loc& loc) {
     auto& device_ctx = g_vpr_ctx.device();
-    std::vector<Region> regions = pr.get_partition_region();
+    const std::vector<Region>& regions = pr.get_partition_region();
     bool pr_size_one;
     int pr_size = 0;
     int reg_size;
@@ -438,8 +482,8 @@ bool is_pr_size_one(PartitionRegion& pr, t_logical_block_type_ptr block_type, t_
     return pr_size_one;
 }
 
-int get_part_reg_size(PartitionRegion& pr, t_logical_block_type_ptr block_type, GridTileLookup& grid_tiles) {
-    std::vector<Region> part_reg = pr.get_partition_region();
+int get_part_reg_size(const PartitionRegion& pr, t_logical_block_type_ptr block_type, GridTileLookup& grid_tiles) {
+    const std::vector<Region>& part_reg = pr.get_partition_region();
     int num_tiles = 0;
 
     for (unsigned int i_reg = 0; i_reg < part_reg.size(); i_reg++) {
@@ -449,7 +493,7 @@ int get_part_reg_size(PartitionRegion& pr, t_logical_block_type_ptr block_type,
     return num_tiles;
 }
 
-double get_floorplan_score(ClusterBlockId blk_id, PartitionRegion& pr, t_logical_block_type_ptr block_type, GridTileLookup& grid_tiles) {
+double get_floorplan_score(ClusterBlockId blk_id, const PartitionRegion& pr, t_logical_block_type_ptr block_type, GridTileLookup& grid_tiles) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     int num_pr_tiles = get_part_reg_size(pr, block_type, grid_tiles);
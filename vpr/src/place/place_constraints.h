@@ -26,6 +26,23 @@ int check_placement_floorplanning();
  */
 bool is_cluster_constrained(ClusterBlockId blk_id);
 
+/*
+ * Updates the compressed locations within the floorplan region of the block (place_ctx.block_region_locs),
+ * after its floorplan constraints changed
+ */
+void update_block_region_locs(ClusterBlockId blk_id);
+
+/*
+ * Finds the compressed locations within the floorplan region of every block (see update_block_region_locs())
+ */
+void load_block_region_locs();
+
+/*
+ * Returns the compressed locations within the floorplan region of the block,
+ * or nullptr if it is unconstrained (or they have not been loaded)
+ */
+const t_compressed_region_locs* get_block_region_locs(ClusterBlockId blk_id);
+
 /*
  * Check if the placement location would respect floorplan constraints of the block, if it has any
  */
@@ -52,7 +69,7 @@ PartitionRegion update_macro_head_pr(const t_pl_macro& pl_macro, const Partition
  * For each macro member, the updated constraint is essentially the head constraint
  * with the member's offset applied.
  */
-PartitionRegion update_macro_member_pr(PartitionRegion& head_pr, const t_pl_offset& offset, const PartitionRegion& grid_pr, const t_pl_macro& pl_macro);
+PartitionRegion update_macro_member_pr(const PartitionRegion& head_pr, const t_pl_offset& offset, const PartitionRegion& grid_pr, const t_pl_macro& pl_macro);
 
 /*
  * Updates the floorplan constraints information for all constrained macros.
@@ -112,7 +129,7 @@ int region_tile_cover(const Region& reg, t_logical_block_type_ptr block_type, t_
  * block_type is used to determine whether the PartitionRegion is compatible with the cluster block type
  * and loc is updated with the location covered by the PartitionRegion
  */
-bool is_pr_size_one(PartitionRegion& pr, t_logical_block_type_ptr block_type, t_pl_loc& loc);
+bool is_pr_size_one(const PartitionRegion& pr, t_logical_block_type_ptr block_type, t_pl_loc& loc);
 
 /*
  * Returns the number of grid tiles that are covered by the partition region and
@@ -120,7 +137,7 @@ bool is_pr_size_one(PartitionRegion& pr, t_logical_block_type_ptr block_type, t_
  * Used prior to initial placement to help sort blocks based on how difficult they
  * are to place.
  */
-int get_part_reg_size(PartitionRegion& pr, t_logical_block_type_ptr block_type, GridTileLookup& grid_tiles);
+int get_part_reg_size(const PartitionRegion& pr, t_logical_block_type_ptr block_type, GridTileLookup& grid_tiles);
 
 /*
  * Return the floorplan score that will be used for sorting blocks during initial placement. This score is the
@@ -128,6 +145,6 @@ int get_part_reg_size(PartitionRegion& pr, t_logical_block_type_ptr block_type,
  * The resulting number is the number of tiles outside the block's floorplan region, meaning the higher
  * it is, the more difficult the block is to place.
  */
-double get_floorplan_score(ClusterBlockId blk_id, PartitionRegion& pr, t_logical_block_type_ptr block_type, GridTileLookup& grid_tiles);
+double get_floorplan_score(ClusterBlockId blk_id, const PartitionRegion& pr, t_logical_block_type_ptr block_type, GridTileLookup& grid_tiles);
 
 #endif /* VPR_SRC_PLACE_PLACE_CONSTRAINTS_H_ */
@@ -14,6 +14,9 @@
 
 #include "vtr_log.h"
 #include "vtr_math.h"
+#include "vtr_memory_usage.h"
+#include "vtr_time.h"
+#include "vtr_util.h"
 #include "vpr_error.h"
 
 #include "placer_globals.h"
@@ -26,7 +29,67 @@
 #    include "serdes_utils.h"
 #endif /* VTR_ENABLE_CAPNPROTO */
 
+///@brief Flat blob section indices of the serialized delay models
+enum e_delay_model_blob_section {
+    DELAY_MODEL_BLOB_DELAYS = 0,
+    DELAY_MODEL_BLOB_OVERRIDE_KEYS,
+    DELAY_MODEL_BLOB_OVERRIDE_DELAYS
+};
+
+///@brief Returns true if file should be read/written as a memory-mapped flat blob rather than a capnp message
+static bool is_flat_blob_file(const std::string& file) {
+    return vtr::check_file_name_extension(file, ".blob");
+}
+
+///@brief Returns a copy of the (possibly memory-mapped) delays
+static t_delta_delay_matrix copy_delays(const t_delta_delay_table& delays) {
+    t_delta_delay_matrix copy({delays.dim_size(0), delays.dim_size(1), delays.dim_size(2)});
+    if (!copy.empty()) {
+        std::copy(delays.data(), delays.data() + delays.storage_size(), &copy.get(0));
+    }
+    return copy;
+}
+
+///@brief Maps the flat blob file, exiting with an error if it is not valid
+static std::shared_ptr<const vtr::FlatBlobReader> map_delay_model_blob(const std::string& file) {
+    try {
+        return std::make_shared<const vtr::FlatBlobReader>(file);
+    } catch (const vtr::VtrError& e) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Failed to load placement delay model blob: %s\n", e.what());
+    }
+}
+
+///@brief Writes the flat blob file, exiting with an error on failure
+static void write_delay_model_blob(const vtr::FlatBlobWriter& writer, const std::string& file) {
+    try {
+        writer.write(file);
+    } catch (const vtr::VtrError& e) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Failed to write placement delay model blob: %s\n", e.what());
+    }
+}
+
+///@brief PlaceDelayModel methods.
+void PlaceDelayModel::delay(const t_physical_tile_loc& from_loc,
+                            int from_pin,
+                            const std::vector<t_physical_tile_loc>& to_locs,
+                            const std::vector<int>& to_pins,
+                            std::vector<float>& delays) const {
+    VTR_ASSERT_SAFE(to_locs.size() == to_pins.size());
+    delays.resize(to_locs.size());
+    for (size_t i = 0; i < to_locs.size(); ++i) {
+        delays[i] = delay(from_loc, from_pin, to_locs[i], to_pins[i]);
+    }
+}
+
 ///@brief DeltaDelayModel methods.
+size_t DeltaDelayModel::memory_usage() const {
+    //The delays are either owned, or memory-mapped from a flat blob
+    if (delays_blob_) {
+        return delays_view_.storage_size() * sizeof(float);
+    }
+    return vtr::memory_usage(delays_);
+}
+
 float DeltaDelayModel::delay(const t_physical_tile_loc& from_loc, int /*from_pin*/, const t_physical_tile_loc& to_loc, int /*to_pin*/) const {
     int delta_x = std::abs(from_loc.x - to_loc.x);
     int delta_y = std::abs(from_loc.y - to_loc.y);
@@ -40,23 +103,41 @@ float DeltaDelayModel::delay(const t_physical_tile_loc& from_loc, int /*from_pin
         VTR_ASSERT(std::isfinite(cross_layer_delay_));
         cross_layer_td = cross_layer_delay_;
     }
-    return delays_[to_loc.layer_num][delta_x][delta_y] + cross_layer_td;
+    return delays_view_[to_loc.layer_num][delta_x][delta_y] + cross_layer_td;
+}
+
+void DeltaDelayModel::delay(const t_physical_tile_loc& from_loc,
+                            int from_pin,
+                            const std::vector<t_physical_tile_loc>& to_locs,
+                            const std::vector<int>& to_pins,
+                            std::vector<float>& delays) const {
+    VTR_ASSERT_SAFE(to_locs.size() == to_pins.size());
+    delays.resize(to_locs.size());
+    for (size_t i = 0; i < to_locs.size(); ++i) {
+        delays[i] = DeltaDelayModel::delay(from_loc, from_pin, to_locs[i], to_pins[i]);
+    }
+}
+
+void DeltaDelayModel::set_delays(const vtr::NdMatrix<float, 3>& delays) {
+    delays_ = t_delta_delay_matrix(delays);
+    delays_view_ = t_delta_delay_table(delays_);
+    delays_blob_.reset();
 }
 
 void DeltaDelayModel::dump_echo(std::string filepath) const {
     FILE* f = vtr::fopen(filepath.c_str(), "w");
     fprintf(f, "         ");
-    for (size_t layer_num = 0; layer_num < delays_.dim_size(0); ++layer_num) {
+    for (size_t layer_num = 0; layer_num < delays_view_.dim_size(0); ++layer_num) {
         fprintf(f, " %9zu", layer_num);
         fprintf(f, "\n");
-        for (size_t dx = 0; dx < delays_.dim_size(1); ++dx) {
+        for (size_t dx = 0; dx < delays_view_.dim_size(1); ++dx) {
             fprintf(f, " %9zu", dx);
         }
         fprintf(f, "\n");
-        for (size_t dy = 0; dy < delays_.dim_size(2); ++dy) {
+        for (size_t dy = 0; dy < delays_view_.dim_size(2); ++dy) {
             fprintf(f, "%9zu", dy);
-            for (size_t dx = 0; dx < delays_.dim_size(1); ++dx) {
-                fprintf(f, " %9.2e", delays_[layer_num][dx][dy]);
+            for (size_t dx = 0; dx < delays_view_.dim_size(1); ++dx) {
+                fprintf(f, " %9.2e", delays_view_[layer_num][dx][dy]);
             }
             fprintf(f, "\n");
         }
@@ -77,28 +158,90 @@ float OverrideDelayModel::delay(const t_physical_tile_loc& from_loc, int from_pi
     t_physical_tile_type_ptr from_type_ptr = grid.get_physical_type(from_loc);
     t_physical_tile_type_ptr to_type_ptr = grid.get_physical_type(to_loc);
 
+    if (has_delay_overrides(from_type_ptr->index, to_type_ptr->index)) {
+        t_override override_key;
+        override_key.from_type = from_type_ptr->index;
+        override_key.from_class = from_type_ptr->pin_class[from_pin];
+        override_key.to_type = to_type_ptr->index;
+        override_key.to_class = to_type_ptr->pin_class[to_pin];
+
+        //Delay overrides may be different for +/- delta so do not use
+        //an absolute delta for the look-up
+        override_key.delta_x = to_loc.x - from_loc.x;
+        override_key.delta_y = to_loc.y - from_loc.y;
+
+        auto override_iter = delay_overrides_.find(override_key);
+        if (override_iter != delay_overrides_.end()) {
+            //Found an override
+            return override_iter->second;
+        }
+    }
+
+    //Fall back to the base delay model if no override was found
+    return base_delay_model_->delay(from_loc, from_pin, to_loc, to_pin);
+}
+
+const t_delta_delay_table* OverrideDelayModel::delta_delay_table(int from_type, int to_type) const {
+    if (has_delay_overrides(from_type, to_type)) {
+        return nullptr;
+    }
+    return base_delay_model_->delta_delay_table(from_type, to_type);
+}
+
+float OverrideDelayModel::cross_layer_delay() const {
+    return base_delay_model_->cross_layer_delay();
+}
+
+size_t OverrideDelayModel::memory_usage() const {
+    return base_delay_model_->memory_usage()
+           + delay_overrides_.size() * sizeof(std::pair<t_override, float>)
+           + vtr::memory_usage(type_has_overrides_);
+}
+
+void OverrideDelayModel::delay(const t_physical_tile_loc& from_loc,
+                               int from_pin,
+                               const std::vector<t_physical_tile_loc>& to_locs,
+                               const std::vector<int>& to_pins,
+                               std::vector<float>& delays) const {
+    auto& grid = g_vpr_ctx.device().grid;
+
+    base_delay_model_->delay(from_loc, from_pin, to_locs, to_pins, delays);
+
+    //The source half of the override key is shared by all the destinations
+    t_physical_tile_type_ptr from_type_ptr = grid.get_physical_type(from_loc);
     t_override override_key;
     override_key.from_type = from_type_ptr->index;
     override_key.from_class = from_type_ptr->pin_class[from_pin];
-    override_key.to_type = to_type_ptr->index;
-    override_key.to_class = to_type_ptr->pin_class[to_pin];
-
-    //Delay overrides may be different for +/- delta so do not use
-    //an absolute delta for the look-up
-    override_key.delta_x = to_loc.x - from_loc.x;
-    override_key.delta_y = to_loc.y - from_loc.y;
-
-    float delay_val = std::numeric_limits<float>::quiet_NaN();
-    auto override_iter = delay_overrides_.find(override_key);
-    if (override_iter != delay_overrides_.end()) {
-        //Found an override
-        delay_val = override_iter->second;
-    } else {
-        //Fall back to the base delay model if no override was found
-        delay_val = base_delay_model_->delay(from_loc, from_pin, to_loc, to_pin);
+
+    for (size_t i = 0; i < to_locs.size(); ++i) {
+        t_physical_tile_type_ptr to_type_ptr = grid.get_physical_type(to_locs[i]);
+        if (!has_delay_overrides(from_type_ptr->index, to_type_ptr->index)) {
+            continue;
+        }
+
+        override_key.to_type = to_type_ptr->index;
+        override_key.to_class = to_type_ptr->pin_class[to_pins[i]];
+        override_key.delta_x = to_locs[i].x - from_loc.x;
+        override_key.delta_y = to_locs[i].y - from_loc.y;
+
+        auto override_iter = delay_overrides_.find(override_key);
+        if (override_iter != delay_overrides_.end()) {
+            delays[i] = override_iter->second;
+        }
+    }
+}
+
+void OverrideDelayModel::index_delay_overrides() {
+    size_t num_types = g_vpr_ctx.device().physical_tile_types.size();
+    for (const auto& kv : delay_overrides_) {
+        num_types = std::max({num_types, size_t(kv.first.from_type) + 1, size_t(kv.first.to_type) + 1});
     }
 
-    return delay_val;
+    type_has_overrides_.resize({num_types, num_types}, false);
+    type_has_overrides_.fill(false);
+    for (const auto& kv : delay_overrides_) {
+        type_has_overrides_[kv.first.from_type][kv.first.to_type] = true;
+    }
 }
 
 void OverrideDelayModel::set_delay_override(int from_type, int from_class, int to_type, int to_class, int delta_x, int delta_y, float delay_val) {
@@ -114,6 +257,12 @@ void OverrideDelayModel::set_delay_override(int from_type, int from_class, int t
     if (!res.second) {                 //Key already exists
         res.first->second = delay_val; //Overwrite existing delay
     }
+
+    if (size_t(from_type) < type_has_overrides_.dim_size(0) && size_t(to_type) < type_has_overrides_.dim_size(1)) {
+        type_has_overrides_[from_type][to_type] = true;
+    } else {
+        index_delay_overrides();
+    }
 }
 
 void OverrideDelayModel::dump_echo(std::string filepath) const {
@@ -170,19 +319,35 @@ void OverrideDelayModel::set_base_delay_model(std::unique_ptr<DeltaDelayModel> b
         "is disable because VTR_ENABLE_CAPNPROTO=OFF." \
         "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
 
-void DeltaDelayModel::read(const std::string& /*file*/) {
+void DeltaDelayModel::read(const std::string& file) {
+    if (is_flat_blob_file(file)) {
+        read_blob(file);
+        return;
+    }
     VPR_THROW(VPR_ERROR_PLACE, "DeltaDelayModel::read " DISABLE_ERROR);
 }
 
-void DeltaDelayModel::write(const std::string& /*file*/) const {
+void DeltaDelayModel::write(const std::string& file) const {
+    if (is_flat_blob_file(file)) {
+        write_blob(file);
+        return;
+    }
     VPR_THROW(VPR_ERROR_PLACE, "DeltaDelayModel::write " DISABLE_ERROR);
 }
 
-void OverrideDelayModel::read(const std::string& /*file*/) {
+void OverrideDelayModel::read(const std::string& file) {
+    if (is_flat_blob_file(file)) {
+        read_blob(file);
+        return;
+    }
     VPR_THROW(VPR_ERROR_PLACE, "OverrideDelayModel::read " DISABLE_ERROR);
 }
 
-void OverrideDelayModel::write(const std::string& /*file*/) const {
+void OverrideDelayModel::write(const std::string& file) const {
+    if (is_flat_blob_file(file)) {
+        write_blob(file);
+        return;
+    }
     VPR_THROW(VPR_ERROR_PLACE, "OverrideDelayModel::write " DISABLE_ERROR);
 }
 
@@ -199,6 +364,11 @@ static void FromFloat(VprFloatEntry::Builder* out, const float& in) {
 }
 
 void DeltaDelayModel::read(const std::string& file) {
+    if (is_flat_blob_file(file)) {
+        read_blob(file);
+        return;
+    }
+
     // MmapFile object creates an mmap of the specified path, and will munmap
     // when the object leaves scope.
     MmapFile f(file);
@@ -234,10 +404,17 @@ void DeltaDelayModel::read(const std::string& file) {
     //
     // The second argument should be of type Matrix<X>::Reader where X is the
     // capnproto element type.
-    ToNdMatrix<3, VprFloatEntry, float>(&delays_, model.getDelays(), ToFloat);
+    vtr::NdMatrix<float, 3> delays;
+    ToNdMatrix<3, VprFloatEntry, float>(&delays, model.getDelays(), ToFloat);
+    set_delays(delays);
 }
 
 void DeltaDelayModel::write(const std::string& file) const {
+    if (is_flat_blob_file(file)) {
+        write_blob(file);
+        return;
+    }
+
     // MallocMessageBuilder object is the generate capnproto message builder,
     // using malloc for buffer allocation.
     ::capnp::MallocMessageBuilder builder;
@@ -250,13 +427,19 @@ void DeltaDelayModel::write(const std::string& file) const {
     // Matrix message.  It is the mirror function of ToNdMatrix described in
     // read above.
     auto delay_values = model.getDelays();
-    FromNdMatrix<3, VprFloatEntry, float>(&delay_values, delays_, FromFloat);
+    //The file holds the delays in row-major order
+    FromNdMatrix<3, VprFloatEntry, float>(&delay_values, vtr::NdMatrix<float, 3>(copy_delays(delays_view_)), FromFloat);
 
     // writeMessageToFile writes message to the specified file.
     writeMessageToFile(file, &builder);
 }
 
 void OverrideDelayModel::read(const std::string& file) {
+    if (is_flat_blob_file(file)) {
+        read_blob(file);
+        return;
+    }
+
     MmapFile f(file);
 
     /* Increase reader limit to 1G words to allow for large files. */
@@ -286,14 +469,20 @@ void OverrideDelayModel::read(const std::string& file) {
     }
 
     delay_overrides_ = vtr::make_flat_map2(std::move(overrides_arr));
+    index_delay_overrides();
 }
 
 void OverrideDelayModel::write(const std::string& file) const {
+    if (is_flat_blob_file(file)) {
+        write_blob(file);
+        return;
+    }
+
     ::capnp::MallocMessageBuilder builder;
     auto model = builder.initRoot<VprOverrideDelayModel>();
 
     auto delays = model.getDelays();
-    FromNdMatrix<3, VprFloatEntry, float>(&delays, base_delay_model_->delays(), FromFloat);
+    FromNdMatrix<3, VprFloatEntry, float>(&delays, vtr::NdMatrix<float, 3>(copy_delays(base_delay_model_->delays())), FromFloat);
 
     // Non-scalar capnproto fields should be first initialized with
     // init<field  name>(count), and then accessed from the returned
@@ -317,6 +506,62 @@ void OverrideDelayModel::write(const std::string& file) const {
 
 #endif
 
+void DeltaDelayModel::read_blob(const std::string& file) {
+    vtr::ScopedStartFinishTimer timer("Mapping placement delay model blob");
+
+    delays_blob_ = map_delay_model_blob(file);
+    delays_.clear();
+    delays_view_ = delays_blob_->matrix<float, 3, t_delta_delay_layout>(DELAY_MODEL_BLOB_DELAYS);
+}
+
+void DeltaDelayModel::write_blob(const std::string& file) const {
+    vtr::FlatBlobWriter writer;
+    writer.add_matrix(copy_delays(delays_view_));
+    write_delay_model_blob(writer, file);
+}
+
+void OverrideDelayModel::read_blob(const std::string& file) {
+    vtr::ScopedStartFinishTimer timer("Mapping placement delay model blob");
+
+    std::shared_ptr<const vtr::FlatBlobReader> blob = map_delay_model_blob(file);
+
+    //The base delays are queried in place from the mapped file
+    base_delay_model_ = std::make_unique<DeltaDelayModel>(cross_layer_delay_,
+                                                          blob->matrix<float, 3, t_delta_delay_layout>(DELAY_MODEL_BLOB_DELAYS),
+                                                          blob,
+                                                          is_flat_);
+
+    //The overrides are few, and are copied into the (sorted) override map
+    auto keys = blob->array<t_override>(DELAY_MODEL_BLOB_OVERRIDE_KEYS);
+    auto delays = blob->array<float>(DELAY_MODEL_BLOB_OVERRIDE_DELAYS);
+    if (keys.size() != delays.size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement delay model blob '%s' has %zu delay overrides but %zu override delays\n",
+                        file.c_str(), keys.size(), delays.size());
+    }
+
+    std::vector<std::pair<t_override, float>> overrides_arr(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        overrides_arr[i] = std::make_pair(keys[i], delays[i]);
+    }
+    delay_overrides_ = vtr::make_flat_map2(std::move(overrides_arr));
+    index_delay_overrides();
+}
+
+void OverrideDelayModel::write_blob(const std::string& file) const {
+    std::vector<t_override> keys;
+    std::vector<float> delays;
+    for (const auto& elem : delay_overrides_) {
+        keys.push_back(elem.first);
+        delays.push_back(elem.second);
+    }
+
+    vtr::FlatBlobWriter writer;
+    writer.add_matrix(copy_delays(base_delay_model_->delays()));
+    writer.add_array(keys);
+    writer.add_array(delays);
+    write_delay_model_blob(writer, file);
+}
+
 ///@brief Initialize the placer delay model.
 std::unique_ptr<PlaceDelayModel> alloc_lookups_and_delay_model(const Netlist<>& net_list,
                                                                const std::vector<t_arch_switch_inf>& arch_switch_inf,
@@ -395,15 +640,117 @@ float comp_td_single_connection_delay(const PlaceDelayModel* delay_model, Cluste
     return (delay_source_to_sink);
 }
 
+///@brief Computes the delays of all point to point connections of a net into delays[1..num_pins-1], with a single batch query.
+void comp_td_net_connection_delays(const PlaceDelayModel* delay_model, ClusterNetId net_id, std::vector<float>& delays) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    size_t num_pins = cluster_ctx.clb_nlist.net_pins(net_id).size();
+    delays.assign(num_pins, 0.);
+    if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+        return;
+    }
+
+    //Scratch space, re-used across calls (and not shared between threads)
+    static thread_local std::vector<t_physical_tile_loc> sink_locs;
+    static thread_local std::vector<int> sink_block_ipins;
+    static thread_local std::vector<float> sink_delays;
+    sink_locs.clear();
+    sink_block_ipins.clear();
+
+    ClusterPinId source_pin = cluster_ctx.clb_nlist.net_driver(net_id);
+    const t_pl_loc& source_loc = place_ctx.block_locs[cluster_ctx.clb_nlist.pin_block(source_pin)].loc;
+    int source_block_ipin = cluster_ctx.clb_nlist.pin_logical_index(source_pin);
+
+    for (size_t ipin = 1; ipin < num_pins; ++ipin) {
+        ClusterPinId sink_pin = cluster_ctx.clb_nlist.net_pin(net_id, ipin);
+        const t_pl_loc& sink_loc = place_ctx.block_locs[cluster_ctx.clb_nlist.pin_block(sink_pin)].loc;
+        sink_locs.push_back({sink_loc.x, sink_loc.y, sink_loc.layer});
+        sink_block_ipins.push_back(cluster_ctx.clb_nlist.pin_logical_index(sink_pin));
+    }
+
+    delay_model->delay({source_loc.x, source_loc.y, source_loc.layer},
+                       source_block_ipin,
+                       sink_locs,
+                       sink_block_ipins,
+                       sink_delays);
+
+    for (size_t ipin = 1; ipin < num_pins; ++ipin) {
+        delays[ipin] = sink_delays[ipin - 1];
+        if (delays[ipin] < 0) {
+            //Re-query the single connection, which reports the bad delay
+            delays[ipin] = comp_td_single_connection_delay(delay_model, net_id, ipin);
+        }
+    }
+}
+
 ///@brief Recompute all point to point delays, updating `connection_delay` matrix.
 void comp_td_connection_delays(const PlaceDelayModel* delay_model) {
     const auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& p_timing_ctx = g_placer_ctx.mutable_timing();
     auto& connection_delay = p_timing_ctx.connection_delay;
 
+    std::vector<float> net_delays;
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+        comp_td_net_connection_delays(delay_model, net_id, net_delays);
         for (size_t ipin = 1; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ++ipin) {
-            connection_delay[net_id][ipin] = comp_td_single_connection_delay(delay_model, net_id, ipin);
+            connection_delay[net_id][ipin] = net_delays[ipin];
+        }
+    }
+}
+
+/**
+ * @brief Returns the delta delay table shared by all the physical tile types the from_type and to_type
+ *        blocks may be placed in, or nullptr if there is none.
+ */
+static const t_delta_delay_table* common_delta_delay_table(const PlaceDelayModel* delay_model,
+                                                           t_logical_block_type_ptr from_type,
+                                                           t_logical_block_type_ptr to_type) {
+    const t_delta_delay_table* common_table = nullptr;
+    for (t_physical_tile_type_ptr from_tile : from_type->equivalent_tiles) {
+        for (t_physical_tile_type_ptr to_tile : to_type->equivalent_tiles) {
+            const t_delta_delay_table* table = delay_model->delta_delay_table(from_tile->index, to_tile->index);
+            if (!table || (common_table && table != common_table)) {
+                return nullptr;
+            }
+            common_table = table;
+        }
+    }
+    return common_table;
+}
+
+ConnectionDelayCache::ConnectionDelayCache(const PlaceDelayModel* delay_model) {
+    const auto& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+
+    net_source_blocks_.resize(clb_nlist.nets().size(), ClusterBlockId::INVALID());
+    sink_blocks_ = make_net_pins_matrix<ClusterBlockId>(clb_nlist, ClusterBlockId::INVALID());
+
+    //Without a finite cross-layer delay the delay model rejects connections between layers
+    cross_layer_delay_ = delay_model->cross_layer_delay();
+    if (!std::isfinite(cross_layer_delay_) && g_vpr_ctx.device().grid.get_num_layers() > 1) {
+        return;
+    }
+
+    for (ClusterNetId net_id : clb_nlist.nets()) {
+        if (clb_nlist.net_is_ignored(net_id)) {
+            continue;
+        }
+
+        ClusterBlockId source_block = clb_nlist.net_driver_block(net_id);
+        for (size_t ipin = 1; ipin < clb_nlist.net_pins(net_id).size(); ++ipin) {
+            ClusterBlockId sink_block = clb_nlist.net_pin_block(net_id, ipin);
+            const t_delta_delay_table* table = common_delta_delay_table(delay_model,
+                                                                        clb_nlist.block_type(source_block),
+                                                                        clb_nlist.block_type(sink_block));
+            //All models return their single base table, but keep to one in case some do not
+            if (!table || (delta_delays_ && table != delta_delays_)) {
+                continue;
+            }
+
+            delta_delays_ = table;
+            net_source_blocks_[net_id] = source_block;
+            sink_blocks_[net_id][ipin] = sink_block;
+            ++num_cached_connections_;
         }
     }
 }
@@ -5,9 +5,15 @@
  */
 
 #pragma once
+#include <cmath>
+#include <limits>
+
 #include "vtr_ndmatrix.h"
+#include "vtr_vector_map.h"
 #include "vtr_flat_map.h"
+#include "vtr_flat_blob.h"
 #include "vpr_types.h"
+#include "vpr_net_pins_matrix.h"
 #include "router_delay_profiling.h"
 
 #ifndef __has_attribute
@@ -27,6 +33,16 @@
 ///@brief Forward declarations.
 class PlaceDelayModel;
 
+/**
+ * @brief Storage layout of the [layer][|delta_x|][|delta_y|] delay tables.
+ *
+ * Tiled over the deltas, since the moves of the placer (and the connections of a block)
+ * query nearby deltas.
+ */
+typedef vtr::NdMatrixTiled<> t_delta_delay_layout;
+typedef vtr::NdMatrix<float, 3, t_delta_delay_layout> t_delta_delay_matrix;
+typedef vtr::NdMatrixView<float, 3, t_delta_delay_layout> t_delta_delay_table;
+
 ///@brief Initialize the placer delay model.
 std::unique_ptr<PlaceDelayModel> alloc_lookups_and_delay_model(const Netlist<>& net_list,
                                                                const std::vector<t_arch_switch_inf>& arch_switch_inf,
@@ -42,6 +58,9 @@ std::unique_ptr<PlaceDelayModel> alloc_lookups_and_delay_model(const Netlist<>&
 ///@brief Returns the delay of one point to point connection.
 float comp_td_single_connection_delay(const PlaceDelayModel* delay_model, ClusterNetId net_id, int ipin);
 
+///@brief Computes the delays of all point to point connections of a net into delays[1..num_pins-1], with a single batch query.
+void comp_td_net_connection_delays(const PlaceDelayModel* delay_model, ClusterNetId net_id, std::vector<float>& delays);
+
 ///@brief Recompute all point to point delays, updating `connection_delay` matrix.
 void comp_td_connection_delays(const PlaceDelayModel* delay_model);
 
@@ -65,6 +84,18 @@ class PlaceDelayModel {
      */
     virtual float delay(const t_physical_tile_loc& from_loc, int from_pin, const t_physical_tile_loc& to_loc, int to_pin) const = 0;
 
+    /**
+     * @brief Returns (in delays) the delay estimates from the specified block pin to each of the to_locs/to_pins block pins.
+     *
+     * Identical to calling delay() for each destination, but models can share the look-ups
+     * which depend only on the source.
+     */
+    virtual void delay(const t_physical_tile_loc& from_loc,
+                       int from_pin,
+                       const std::vector<t_physical_tile_loc>& to_locs,
+                       const std::vector<int>& to_pins,
+                       std::vector<float>& delays) const;
+
     ///@brief Dumps the delay model to an echo file.
     virtual void dump_echo(std::string filename) const = 0;
 
@@ -81,6 +112,23 @@ class PlaceDelayModel {
      * May be unimplemented, in which case method should throw an exception.
      */
     virtual void read(const std::string& file) = 0;
+
+    /**
+     * @brief Returns the [to_layer][|delta_x|][|delta_y|] table giving the delay between any pins of
+     *        physical tile types from_type and to_type, or nullptr if those delays are not a function
+     *        of the position deltas alone. Connections between layers also incur cross_layer_delay().
+     */
+    virtual const t_delta_delay_table* delta_delay_table(int /*from_type*/, int /*to_type*/) const {
+        return nullptr;
+    }
+
+    ///@brief Returns the delay added to the delta_delay_table() delays of connections between layers
+    virtual float cross_layer_delay() const {
+        return std::numeric_limits<float>::infinity();
+    }
+
+    ///@brief Returns the (approximate) heap memory used by the delay model, in bytes
+    virtual size_t memory_usage() const = 0;
 };
 
 ///@brief A simple delay model based on the distance (delta) between block locations.
@@ -91,11 +139,25 @@ class DeltaDelayModel : public PlaceDelayModel {
         : cross_layer_delay_(min_cross_layer_delay)
         , is_flat_(is_flat) {}
     DeltaDelayModel(float min_cross_layer_delay,
-                    vtr::NdMatrix<float, 3> delta_delays,
+                    const vtr::NdMatrix<float, 3>& delta_delays,
                     bool is_flat)
-        : delays_(std::move(delta_delays))
+        : delays_(delta_delays)
+        , delays_view_(delays_)
         , cross_layer_delay_(min_cross_layer_delay)
         , is_flat_(is_flat) {}
+    ///@brief Queries delta_delays in place; they refer to the memory-mapped blob, which is kept alive by the model
+    DeltaDelayModel(float min_cross_layer_delay,
+                    t_delta_delay_table delta_delays,
+                    std::shared_ptr<const vtr::FlatBlobReader> blob,
+                    bool is_flat)
+        : delays_view_(delta_delays)
+        , delays_blob_(std::move(blob))
+        , cross_layer_delay_(min_cross_layer_delay)
+        , is_flat_(is_flat) {}
+
+    //delays_view_ may refer to delays_, so the model is not copyable
+    DeltaDelayModel(const DeltaDelayModel&) = delete;
+    DeltaDelayModel& operator=(const DeltaDelayModel&) = delete;
 
     void compute(
         RouterDelayProfiler& router,
@@ -103,16 +165,41 @@ class DeltaDelayModel : public PlaceDelayModel {
         const t_router_opts& router_opts,
         int longest_length) override;
     float delay(const t_physical_tile_loc& from_loc, int /*from_pin*/, const t_physical_tile_loc& to_loc, int /*to_pin*/) const override;
+    void delay(const t_physical_tile_loc& from_loc,
+               int from_pin,
+               const std::vector<t_physical_tile_loc>& to_locs,
+               const std::vector<int>& to_pins,
+               std::vector<float>& delays) const override;
     void dump_echo(std::string filepath) const override;
 
+    /**
+     * @brief Reads/writes the model as a capnp message, or as a flat blob
+     *        (files ending in .blob) which is memory-mapped and queried in
+     *        place without deserialization.
+     */
     void read(const std::string& file) override;
     void write(const std::string& file) const override;
-    const vtr::NdMatrix<float, 3>& delays() const {
-        return delays_;
+    ///@brief Returns the delay table, which may refer to a memory-mapped file
+    const t_delta_delay_table& delays() const {
+        return delays_view_;
+    }
+    const t_delta_delay_table* delta_delay_table(int /*from_type*/, int /*to_type*/) const override {
+        return &delays_view_;
+    }
+    float cross_layer_delay() const override {
+        return cross_layer_delay_;
     }
+    size_t memory_usage() const override;
 
   private:
-    vtr::NdMatrix<float, 3> delays_; // [0..num_layers-1][0..max_dx][0..max_dy]
+    ///@brief Stores (a tiled copy of) delays, and releases any memory-mapped delays
+    void set_delays(const vtr::NdMatrix<float, 3>& delays);
+    void read_blob(const std::string& file);
+    void write_blob(const std::string& file) const;
+
+    t_delta_delay_matrix delays_;                            // Storage for computed (or capnp loaded) delays
+    t_delta_delay_table delays_view_;                        // [0..num_layers-1][0..max_dx][0..max_dy], refers to delays_ or delays_blob_
+    std::shared_ptr<const vtr::FlatBlobReader> delays_blob_; // Memory-mapped flat blob, if loaded from one
     float cross_layer_delay_;
     bool is_flat_;
 };
@@ -131,10 +218,23 @@ class OverrideDelayModel : public PlaceDelayModel {
     // returns delay from the specified (x,y) to the specified (x,y) with both endpoints on layer_num and the
     // specified from and to pins
     float delay(const t_physical_tile_loc& from_loc, int from_pin, const t_physical_tile_loc& to_loc, int to_pin) const override;
+    void delay(const t_physical_tile_loc& from_loc,
+               int from_pin,
+               const std::vector<t_physical_tile_loc>& to_locs,
+               const std::vector<int>& to_pins,
+               std::vector<float>& delays) const override;
     void dump_echo(std::string filepath) const override;
 
+    /**
+     * @brief Reads/writes the model as a capnp message, or as a flat blob
+     *        (files ending in .blob). When read from a flat blob the base delay
+     *        table is queried in place from the memory-mapped file.
+     */
     void read(const std::string& file) override;
     void write(const std::string& file) const override;
+    const t_delta_delay_table* delta_delay_table(int from_type, int to_type) const override;
+    float cross_layer_delay() const override;
+    size_t memory_usage() const override;
 
   public: //Mutators
     void set_base_delay_model(std::unique_ptr<DeltaDelayModel> base_delay_model);
@@ -143,6 +243,18 @@ class OverrideDelayModel : public PlaceDelayModel {
     void set_delay_override(int from_type, int from_class, int to_type, int to_class, int delta_x, int delta_y, float delay);
 
   private:
+    void read_blob(const std::string& file);
+    void write_blob(const std::string& file) const;
+
+    ///@brief Returns true if there may be delay overrides from physical tile type from_type to to_type
+    bool has_delay_overrides(int from_type, int to_type) const {
+        return size_t(from_type) < type_has_overrides_.dim_size(0)
+               && size_t(to_type) < type_has_overrides_.dim_size(1)
+               && type_has_overrides_[from_type][to_type];
+    }
+    ///@brief Rebuilds type_has_overrides_ from delay_overrides_
+    void index_delay_overrides();
+
     std::unique_ptr<DeltaDelayModel> base_delay_model_;
     /* Minimum delay of cross-layer connections */
     float cross_layer_delay_;
@@ -204,6 +316,14 @@ class OverrideDelayModel : public PlaceDelayModel {
      */
     vtr::flat_map2<t_override, float> delay_overrides_;
 
+    /**
+     * @brief Whether any delay override exists from each physical tile type to each other, [from_type][to_type].
+     *
+     * Overrides are normally only between the few tile pairs with direct connections, so most
+     * queries are resolved by this table alone, without searching delay_overrides_.
+     */
+    vtr::Matrix<bool> type_has_overrides_;
+
     /**
      * operator< treats memory layout of t_override as an array of short.
      * This requires all members of t_override are shorts and there is no
@@ -217,3 +337,67 @@ class OverrideDelayModel : public PlaceDelayModel {
     static_assert(sizeof(t_override::delta_x) == sizeof(short), "Expect all t_override data members to be shorts");
     static_assert(sizeof(t_override::delta_y) == sizeof(short), "Expect all t_override data members to be shorts");
 };
+
+/**
+ * @brief Per connection cache of the placement delay model look-ups.
+ *
+ * The delay of a connection whose blocks may only be placed in physical tile types whose
+ * delays depend on the position deltas alone (see PlaceDelayModel::delta_delay_table()) is
+ * fetched straight from the delta delay table, without resolving the tile types, pin classes
+ * and delay overrides of a delay model query. The other connections (e.g. between tiles with
+ * direct connections) are not cached.
+ */
+class ConnectionDelayCache {
+  public:
+    ConnectionDelayCache() = default;
+
+    ///@brief Builds the cache of the clustered netlist connections
+    explicit ConnectionDelayCache(const PlaceDelayModel* delay_model);
+
+    ///@brief Returns true if no connection is cached
+    bool empty() const {
+        return num_cached_connections_ == 0;
+    }
+
+    size_t num_cached_connections() const {
+        return num_cached_connections_;
+    }
+
+    ///@brief Returns the delay of connection ipin of net_id with its blocks at block_locs, or a negative value if it is not cached
+    float delay(const vtr::vector_map<ClusterBlockId, t_block_loc>& block_locs, ClusterNetId net_id, int ipin) const {
+        ClusterBlockId sink_block = sink_blocks_[net_id][ipin];
+        if (!sink_block) {
+            return -1.;
+        }
+
+        const t_pl_loc& source_loc = block_locs[net_source_blocks_[net_id]].loc;
+        const t_pl_loc& sink_loc = block_locs[sink_block].loc;
+        float cross_layer_delay = (source_loc.layer != sink_loc.layer) ? cross_layer_delay_ : 0.;
+        return (*delta_delays_)[sink_loc.layer][std::abs(sink_loc.x - source_loc.x)][std::abs(sink_loc.y - source_loc.y)] + cross_layer_delay;
+    }
+
+  private:
+    const t_delta_delay_table* delta_delays_ = nullptr;
+    float cross_layer_delay_ = 0.;
+    size_t num_cached_connections_ = 0;
+
+    vtr::vector<ClusterNetId, ClusterBlockId> net_source_blocks_; //Driver block of each net with cached connections
+    ClbNetPinsMatrix<ClusterBlockId> sink_blocks_;                //Sink block of each cached connection, invalid if not cached
+};
+
+///@brief Returns the delay of one point to point connection, from connection_delay_cache if it is cached there.
+inline float comp_td_cached_connection_delay(const PlaceDelayModel* delay_model,
+                                             const ConnectionDelayCache& connection_delay_cache,
+                                             const vtr::vector_map<ClusterBlockId, t_block_loc>& block_locs,
+                                             ClusterNetId net_id,
+                                             int ipin) {
+    if (!connection_delay_cache.empty()) {
+        float delay = connection_delay_cache.delay(block_locs, net_id, ipin);
+        if (delay >= 0.) {
+            return delay;
+        }
+    }
+
+    //Not cached (or a bad delay, which the delay model query reports)
+    return comp_td_single_connection_delay(delay_model, net_id, ipin);
+}
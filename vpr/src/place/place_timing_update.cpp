@@ -7,6 +7,7 @@
 
 #include "placer_globals.h"
 #include "place_timing_update.h"
+#include "timing_metrics.h"
 
 /* Routines local to place_timing_update.cpp */
 static double comp_td_connection_cost(const PlaceDelayModel* delay_model,
@@ -15,6 +16,10 @@ static double comp_td_connection_cost(const PlaceDelayModel* delay_model,
                                       int ipin);
 static double sum_td_net_cost(ClusterNetId net);
 static double sum_td_costs();
+static void apply_connection_invalidations(NetPinTimingInvalidator* pin_timing_invalidator,
+                                           SetupTimingInfo* timing_info);
+static bool wait_for_background_timing_update(SetupTimingInfo* timing_info,
+                                              NetPinTimingInvalidator* pin_timing_invalidator);
 
 ///@brief Use an incremental approach to updating timing costs after re-computing criticalities
 static constexpr bool INCR_COMP_TD_COSTS = true;
@@ -38,11 +43,15 @@ void initialize_timing_info(const PlaceCritParams& crit_params,
     //As a safety measure, for the first time update,
     //invalidate all timing edges via the pin invalidator
     //by passing in all the clb sink pins
+    auto& p_timing_ctx = g_placer_ctx.mutable_timing();
     for (ClusterNetId net_id : clb_nlist.nets()) {
         for (ClusterPinId pin_id : clb_nlist.net_sinks(net_id)) {
             pin_timing_invalidator->invalidate_connection(pin_id, timing_info);
+            size_t ipin = clb_nlist.pin_net_index(pin_id);
+            p_timing_ctx.analyzed_connection_delay[net_id][ipin] = p_timing_ctx.connection_delay[net_id][ipin];
         }
     }
+    p_timing_ctx.pending_invalidated_pins.clear();
 
     //Perform first time update for all timing related classes
     perform_full_timing_update(crit_params,
@@ -119,18 +128,37 @@ void perform_full_timing_update(const PlaceCritParams& crit_params,
  * expect to revert the current timing update in the near future, or if
  * we wish to compare the new slack values to the original ones.
  *
- * All the pins with changed connection delays have already been added into
- * the NetPinTimingInvalidator to allow incremental STA update. These
- * changed connection delays are a direct result of moved blocks in try_swap().
+ * All the pins with possibly changed connection delays have already been
+ * recorded with invalidate_connection_delay(). These changed connection
+ * delays are a direct result of moved blocks in try_swap(). Only the ones
+ * whose delay differs from the last STA are invalidated in the
+ * NetPinTimingInvalidator, to keep the incremental STA update small.
  */
 void update_timing_classes(const PlaceCritParams& crit_params,
                            SetupTimingInfo* timing_info,
                            PlacerCriticalities* criticalities,
                            PlacerSetupSlacks* setup_slacks,
                            NetPinTimingInvalidator* pin_timing_invalidator) {
+    auto& p_runtime_ctx = g_placer_ctx.mutable_runtime();
+
+    /* A background analysis must not race with this one. Its changes to the  *
+     * timing graph are not seen by the incremental criticality/slack updates *
+     * below, so these are recomputed from scratch.                           */
+    if (wait_for_background_timing_update(timing_info, pin_timing_invalidator)) {
+        criticalities->set_recompute_required();
+        setup_slacks->set_recompute_required();
+    }
+
+    /* Invalidate the connections whose delay changed since the last STA. */
+    apply_connection_invalidations(pin_timing_invalidator, timing_info);
+
     /* Run STA to update slacks and adjusted/relaxed criticalities. */
     timing_info->update();
 
+    p_runtime_ctx.num_timing_updates++;
+    p_runtime_ctx.num_timing_nodes_updated += timing_info->analyzer()->modified_nodes().size();
+    record_timing_metrics("place", p_runtime_ctx.num_timing_updates, *timing_info);
+
     /* Update the placer's criticalities (e.g. sharpen with crit_exponent). */
     criticalities->update_criticalities(timing_info, crit_params);
 
@@ -141,6 +169,121 @@ void update_timing_classes(const PlaceCritParams& crit_params,
     pin_timing_invalidator->reset();
 }
 
+/**
+ * @brief Starts a timing analysis of the current connection delays on another thread.
+ *
+ * The connections are invalidated here, on the calling thread. The STA then only reads
+ * analyzed_connection_delay (through the placement delay calculator), which is not
+ * written again until the analysis is finished, so the annealer may keep moving blocks
+ * and updating connection_delay meanwhile.
+ */
+void start_background_timing_update(SetupTimingInfo* timing_info,
+                                    NetPinTimingInvalidator* pin_timing_invalidator) {
+    VTR_ASSERT(!background_timing_update_pending());
+
+    apply_connection_invalidations(pin_timing_invalidator, timing_info);
+
+    g_placer_ctx.mutable_timing().background_timing_update = std::async(std::launch::async, [timing_info]() {
+        timing_info->update();
+    });
+}
+
+bool background_timing_update_pending() {
+    return g_placer_ctx.timing().background_timing_update.valid();
+}
+
+/**
+ * @brief Waits for the background timing analysis and updates every timing related class from it.
+ *
+ * Updates: PlacerCriticalities, PlacerSetupSlacks, timing_cost, connection_setup_slack.
+ */
+void finish_background_timing_update(const PlaceCritParams& crit_params,
+                                     const PlaceDelayModel* delay_model,
+                                     PlacerCriticalities* criticalities,
+                                     PlacerSetupSlacks* setup_slacks,
+                                     NetPinTimingInvalidator* pin_timing_invalidator,
+                                     SetupTimingInfo* timing_info,
+                                     t_placer_costs* costs) {
+    wait_for_background_timing_update(timing_info, pin_timing_invalidator);
+
+    criticalities->enable_update();
+    setup_slacks->enable_update();
+    criticalities->update_criticalities(timing_info, crit_params);
+    setup_slacks->update_setup_slacks(timing_info);
+
+    update_timing_cost(delay_model, criticalities, &costs->timing_cost);
+    commit_setup_slacks(setup_slacks);
+}
+
+///@brief Waits for the background timing analysis, if any. Returns true if there was one.
+static bool wait_for_background_timing_update(SetupTimingInfo* timing_info,
+                                              NetPinTimingInvalidator* pin_timing_invalidator) {
+    auto& p_timing_ctx = g_placer_ctx.mutable_timing();
+    if (!p_timing_ctx.background_timing_update.valid()) {
+        return false;
+    }
+
+    //Rethrows any error raised by the analysis
+    p_timing_ctx.background_timing_update.get();
+
+    auto& p_runtime_ctx = g_placer_ctx.mutable_runtime();
+    p_runtime_ctx.num_timing_updates++;
+    p_runtime_ctx.num_timing_nodes_updated += timing_info->analyzer()->modified_nodes().size();
+    record_timing_metrics("place", p_runtime_ctx.num_timing_updates, *timing_info);
+
+    pin_timing_invalidator->reset();
+    return true;
+}
+
+/**
+ * @brief Records that the delay of the connection driving the sink pin may have changed.
+ *
+ * The connection is invalidated for the next incremental STA by update_timing_classes(),
+ * if its delay then differs from the delay seen by the last STA. A connection moved
+ * and moved back between two timing updates is therefore not re-analyzed.
+ */
+void invalidate_connection_delay(ClusterPinId pin) {
+    g_placer_ctx.mutable_timing().pending_invalidated_pins.push_back(pin);
+}
+
+///@brief Records that the delay of every connection may have changed (e.g. when a placement is restored).
+void invalidate_all_connection_delays() {
+    const auto& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+
+    for (ClusterNetId net_id : clb_nlist.nets()) {
+        for (ClusterPinId pin_id : clb_nlist.net_sinks(net_id)) {
+            invalidate_connection_delay(pin_id);
+        }
+    }
+}
+
+/**
+ * @brief Invalidates the recorded connections whose delay differs from the last STA.
+ *
+ * A pin may have been recorded several times; only its first occurrence can differ.
+ */
+static void apply_connection_invalidations(NetPinTimingInvalidator* pin_timing_invalidator,
+                                           SetupTimingInfo* timing_info) {
+    const auto& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+    auto& p_timing_ctx = g_placer_ctx.mutable_timing();
+    auto& p_runtime_ctx = g_placer_ctx.mutable_runtime();
+
+    for (ClusterPinId pin_id : p_timing_ctx.pending_invalidated_pins) {
+        ClusterNetId net_id = clb_nlist.pin_net(pin_id);
+        size_t ipin = clb_nlist.pin_net_index(pin_id);
+
+        float delay = p_timing_ctx.connection_delay[net_id][ipin];
+        if (delay == p_timing_ctx.analyzed_connection_delay[net_id][ipin]) {
+            continue;
+        }
+
+        pin_timing_invalidator->invalidate_connection(pin_id, timing_info);
+        p_timing_ctx.analyzed_connection_delay[net_id][ipin] = delay;
+        p_runtime_ctx.num_timing_connections_invalidated++;
+    }
+    p_timing_ctx.pending_invalidated_pins.clear();
+}
+
 /**
  * @brief Update the timing driven (td) costs.
  *
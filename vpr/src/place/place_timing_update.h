@@ -32,6 +32,33 @@ void update_timing_classes(const PlaceCritParams& crit_params,
                            PlacerSetupSlacks* setup_slacks,
                            NetPinTimingInvalidator* pin_timing_invalidator);
 
+/**
+ * @brief Starts a timing analysis of the current connection delays on another thread.
+ *
+ * The annealer may keep moving blocks meanwhile, with the previous criticalities.
+ * The results are applied by finish_background_timing_update().
+ */
+void start_background_timing_update(SetupTimingInfo* timing_info,
+                                    NetPinTimingInvalidator* pin_timing_invalidator);
+
+///@brief Returns true if a timing analysis started by start_background_timing_update() has not been finished yet.
+bool background_timing_update_pending();
+
+///@brief Waits for the background timing analysis and updates every timing related class from it, as perform_full_timing_update().
+void finish_background_timing_update(const PlaceCritParams& crit_params,
+                                     const PlaceDelayModel* delay_model,
+                                     PlacerCriticalities* criticalities,
+                                     PlacerSetupSlacks* setup_slacks,
+                                     NetPinTimingInvalidator* pin_timing_invalidator,
+                                     SetupTimingInfo* timing_info,
+                                     t_placer_costs* costs);
+
+///@brief Records that the delay of the connection driving the sink pin may have changed since the last timing update.
+void invalidate_connection_delay(ClusterPinId pin);
+
+///@brief Records that the delay of every connection may have changed since the last timing update.
+void invalidate_all_connection_delays();
+
 ///@brief Updates the timing driven (td) costs.
 void update_timing_cost(const PlaceDelayModel* delay_model,
                         const PlacerCriticalities* criticalities,
@@ -9,6 +9,14 @@
 #include "draw_global.h"
 #include "place_constraints.h"
 
+#include <algorithm>
+
+/* The temperature decay factor of the fast anneal start */
+static constexpr float FAST_START_ALPHA = 0.5;
+
+/* The smallest fraction of move_lim_max the fast anneal start runs per temperature */
+static constexpr float FAST_START_MIN_MOVE_FRACTION = 0.1;
+
 /* File-scope routines */
 static GridBlock init_grid_blocks();
 
@@ -87,6 +95,8 @@ t_annealing_state::t_annealing_state(const t_annealing_sched& annealing_sched,
     rlim = first_rlim;
     move_lim_max = first_move_lim;
     crit_exponent = first_crit_exponent;
+    fast_start = annealing_sched.fast_start && annealing_sched.type == AUTO_SCHED;
+    fast_start_moves_saved = 0;
 
     /* Determine the current move_lim based on the schedule type */
     if (annealing_sched.type == DUSTY_SCHED) {
@@ -126,6 +136,14 @@ int get_initial_move_lim(const t_placer_opts& placer_opts, const t_annealing_sch
     float device_size = device_ctx.grid.width() * device_ctx.grid.height();
     size_t num_blocks = cluster_ctx.clb_nlist.blocks().size();
 
+    //An ECO placement only anneals the blocks around the netlist changes, the others are fixed
+    if (!placer_opts.eco_place_file.empty()) {
+        const auto& place_ctx = g_vpr_ctx.placement();
+        num_blocks = std::count_if(cluster_ctx.clb_nlist.blocks().begin(), cluster_ctx.clb_nlist.blocks().end(), [&](ClusterBlockId blk_id) {
+            return !place_ctx.block_locs[blk_id].is_fixed;
+        });
+    }
+
     int move_lim;
     if (placer_opts.effort_scaling == e_place_effort_scaling::CIRCUIT) {
         move_lim = int(annealing_sched.inner_num * pow(num_blocks, 1.3333));
@@ -147,6 +165,8 @@ int get_initial_move_lim(const t_placer_opts& placer_opts, const t_annealing_sch
  *
  *   USER_SCHED:  A manual fixed schedule with fixed alpha and exit criteria.
  *   AUTO_SCHED:  A more sophisticated schedule where alpha varies based on success ratio.
+ *                With --anneal_fast_start, the first temperatures are left faster and
+ *                with fewer moves while the success ratio is high, see update_fast_start().
  *   DUSTY_SCHED: This schedule jumps backward and slows down in response to success ratio.
  *                See doc/src/vpr/dusty_sa.rst for more details.
  *
@@ -205,6 +225,12 @@ bool t_annealing_state::outer_loop_update(float success_rate,
 
         /* Update move lim. */
         update_move_lim(annealing_sched.success_target, success_rate);
+    } else if (update_fast_start(success_rate, annealing_sched)) {
+        /* Cool quickly through the temperatures that accept almost every move. */
+        t *= alpha;
+        if (t < t_exit || std::isnan(t_exit)) {
+            return false;
+        }
     } else {
         VTR_ASSERT_SAFE(annealing_sched.type == AUTO_SCHED);
         /* Automatically adjust alpha according to success rate. */
@@ -284,6 +310,39 @@ void t_annealing_state::update_move_lim(float success_target, float success_rate
     move_lim = std::max(move_lim, 1);
 }
 
+/**
+ * @brief Update the fast anneal start of AUTO_SCHED.
+ *
+ * At the first temperatures nearly every move is accepted, so the moves are
+ * close to a random walk which the later temperatures undo. While the success
+ * rate stays above fast_start_success, the temperature drops by FAST_START_ALPHA
+ * and the move limit shrinks with the rejection rate (down to a fraction
+ * FAST_START_MIN_MOVE_FRACTION of move_lim_max). The fast start ends for good,
+ * restoring move_lim_max, the first time the success rate falls to the target.
+ *
+ * @return True if the fast start continues at the next temperature.
+ */
+bool t_annealing_state::update_fast_start(float success_rate, const t_annealing_sched& annealing_sched) {
+    if (!fast_start) {
+        return false;
+    }
+
+    if (success_rate <= annealing_sched.fast_start_success) {
+        fast_start = false;
+        move_lim = move_lim_max;
+        return false;
+    }
+
+    alpha = FAST_START_ALPHA;
+
+    float move_fraction = (1. - success_rate) / (1. - annealing_sched.fast_start_success);
+    move_fraction = std::max(move_fraction, FAST_START_MIN_MOVE_FRACTION);
+    move_lim = std::max(1, (int)(move_lim_max * move_fraction));
+    fast_start_moves_saved += move_lim_max - move_lim;
+
+    return true;
+}
+
 ///@brief Clear all data fields.
 void t_placer_statistics::reset() {
     av_cost = 0.;
@@ -304,6 +363,14 @@ void t_placer_statistics::single_swap_update(const t_placer_costs& costs) {
     sum_of_squares += (costs.cost) * (costs.cost);
 }
 
+void t_placer_statistics::merge(const t_placer_statistics& other) {
+    success_sum += other.success_sum;
+    av_cost += other.av_cost;
+    av_bb_cost += other.av_bb_cost;
+    av_timing_cost += other.av_timing_cost;
+    sum_of_squares += other.sum_of_squares;
+}
+
 ///@brief Update stats when a single swap move has been accepted.
 void t_placer_statistics::calc_iteration_stats(const t_placer_costs& costs, int move_lim) {
     if (success_sum == 0) {
@@ -547,3 +614,28 @@ bool macro_can_be_placed(t_pl_macro pl_macro, t_pl_loc head_pos, bool check_all_
 
     return (mac_can_be_placed);
 }
+
+void load_net_pin_coords(ClusterNetId net_id, t_net_pin_coords& pin_coords) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& grid = g_vpr_ctx.device().grid;
+    const int max_x = grid.width() - 2;  //-2 for no perim channels
+    const int max_y = grid.height() - 2; //-2 for no perim channels
+
+    auto net_pins = cluster_ctx.clb_nlist.net_pins(net_id);
+    pin_coords.resize(net_pins.size());
+
+    size_t ipin = 0;
+    for (auto pin_id : net_pins) {
+        ClusterBlockId bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
+        int pnum = tile_pin_index(pin_id);
+        VTR_ASSERT_SAFE(pnum >= 0);
+        const t_pl_loc& loc = place_ctx.block_locs[bnum].loc;
+        t_physical_tile_type_ptr type = physical_tile_type(bnum);
+
+        pin_coords.x[ipin] = std::max(std::min<int>(loc.x + type->pin_width_offset[pnum], max_x), 1);
+        pin_coords.y[ipin] = std::max(std::min<int>(loc.y + type->pin_height_offset[pnum], max_y), 1);
+        pin_coords.layer[ipin] = loc.layer;
+        ++ipin;
+    }
+}
@@ -11,6 +11,7 @@
 #include "vtr_util.h"
 #include "vtr_vector_map.h"
 #include "globals.h"
+#include "net_bb_util.h"
 
 /**
  * @brief Data structure that stores different cost values in the placer.
@@ -29,6 +30,8 @@
  *   @param cost The weighted average of the wiring cost and the timing cost.
  *   @param bb_cost The bounding box cost, aka the wiring cost.
  *   @param timing_cost The timing cost, which is connection delay * criticality.
+ *   @param congestion_cost The RUDY routing congestion cost (see place_congestion.h),
+ *              normalized like the wiring cost. 0 unless --place_congestion_weight is set.
  *
  *   @param bb_cost_norm The normalization factor for the wiring cost.
  *   @param timing_cost_norm The normalization factor for the timing cost, which
@@ -49,6 +52,7 @@ class t_placer_costs {
     double cost = 0.;
     double bb_cost = 0.;
     double timing_cost = 0.;
+    double congestion_cost = 0.;
     double bb_cost_norm = 0.;
     double timing_cost_norm = 0.;
     double noc_aggregate_bandwidth_cost = 0.;
@@ -101,6 +105,14 @@ class t_placer_costs {
  *              Currently only updated by DUSTY_SCHED.
  *   @param move_lim_max
  *              Maximum block move limit.
+ *   @param fast_start
+ *              True while the fast anneal start (--anneal_fast_start) is active:
+ *              the acceptance rate has stayed above the fast start target since
+ *              the first temperature. Only used by AUTO_SCHED.
+ *   @param fast_start_moves_saved
+ *              The number of moves the fast anneal start skipped, compared to
+ *              running its temperatures (and the starting temperature trial
+ *              moves) with the default move limits.
  *
  * Private members:
  *   @param UPPER_RLIM
@@ -129,6 +141,9 @@ class t_annealing_state {
     int move_lim;
     int move_lim_max;
 
+    bool fast_start;
+    size_t fast_start_moves_saved;
+
   private:
     float UPPER_RLIM;
     float FINAL_RLIM = 1.;
@@ -153,6 +168,7 @@ class t_annealing_state {
     inline void update_rlim(float success_rate);
     inline void update_crit_exponent(const t_placer_opts& placer_opts);
     inline void update_move_lim(float success_target, float success_rate);
+    inline bool update_fast_start(float success_rate, const t_annealing_sched& annealing_sched);
 };
 
 /**
@@ -207,6 +223,9 @@ class t_placer_statistics {
 
     ///@brief Calculate placer success rate and cost std_dev for this iteration.
     void single_swap_update(const t_placer_costs& costs);
+
+    ///@brief Add the swaps accumulated by other (e.g. by a parallel annealing region), before calc_iteration_stats().
+    void merge(const t_placer_statistics& other);
 };
 
 ///@brief Initialize the placer's block-grid dual direction mapping.
@@ -230,6 +249,14 @@ void alloc_and_load_legal_placement_locations(std::vector<std::vector<std::vecto
 ///@brief Performs error checking to see if location is legal for block type, and sets the location and grid usage of the block if it is legal.
 void set_block_location(ClusterBlockId blk_id, const t_pl_loc& location);
 
+/**
+ * @brief Gathers the location of each pin of the net (driver first, in net pin order) into pin_coords.
+ *
+ * The x and y coordinates are clipped to 1..grid.width()-2 and 1..grid.height()-2,
+ * as for the net bounding boxes.
+ */
+void load_net_pin_coords(ClusterNetId net_id, t_net_pin_coords& pin_coords);
+
 /// @brief check if a specified location is within the device grid
 inline bool is_loc_on_chip(t_physical_tile_loc loc) {
     const auto& grid = g_vpr_ctx.device().grid;
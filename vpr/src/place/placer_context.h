@@ -8,9 +8,12 @@
  */
 
 #pragma once
+#include <future>
+
 #include "vpr_context.h"
 #include "vpr_net_pins_matrix.h"
 #include "timing_place.h"
+#include "place_congestion.h"
 
 /**
  * @brief State relating to the timing driven data.
@@ -39,6 +42,34 @@ struct PlacerTimingContext : public Context {
      */
     ClbNetPinsMatrix<float> proposed_connection_delay;
 
+    /**
+     * @brief Net connection delays seen by the last timing analysis.
+     *
+     * This is what the placement delay calculator reads, so a timing analysis
+     * running in the background (see start_background_timing_update()) is not
+     * affected by the moves committed meanwhile.
+     *
+     * Index ranges: [0..cluster_ctx.clb_nlist.nets().size()-1][1..num_pins-1]
+     */
+    NetPinsMatrix<float> analyzed_connection_delay;
+
+    /**
+     * @brief Per connection look-ups of the delta delay table, which replace the delay model
+     *        queries of the cached connections. Empty unless --place_connection_delay_cache is on.
+     */
+    ConnectionDelayCache connection_delay_cache;
+
+    /**
+     * @brief Sink pins whose connection delay may have changed since the last timing analysis.
+     *
+     * The ones whose delay differs from analyzed_connection_delay are invalidated
+     * before the next incremental timing analysis. May contain duplicates.
+     */
+    std::vector<ClusterPinId> pending_invalidated_pins;
+
+    ///@brief The timing analysis running in the background, if any (see start_background_timing_update())
+    std::future<void> background_timing_update;
+
     /**
      * @brief Net connection setup slacks based on most recently updated timing graph.
      *
@@ -84,6 +115,80 @@ struct PlacerRuntimeContext : public Context {
     float f_update_td_costs_nets_elapsed_sec;
     float f_update_td_costs_sum_nets_elapsed_sec;
     float f_update_td_costs_total_elapsed_sec;
+
+    /* The number of swaps rejected, accepted or aborted. The total number *
+     * of swap attempts (num_ts_called) is the sum of the three numbers.   */
+    int num_swap_rejected = 0;
+    int num_swap_accepted = 0;
+    int num_swap_aborted = 0;
+    int num_ts_called = 0;
+
+    /* The number of timing analyses, the total number of timing graph nodes *
+     * they updated, and the total number of connections they re-analyzed.   */
+    size_t num_timing_updates = 0;
+    size_t num_timing_nodes_updated = 0;
+    size_t num_timing_connections_invalidated = 0;
+};
+
+/**
+ * @brief State relating to the bounding box cost of the nets.
+ *
+ * The ts_* (try_swap) data structures hold the bounding boxes of the nets
+ * affected by the move being evaluated.
+ */
+struct PlacerCostContext : public Context {
+    /**
+     * @brief Cost of each net, and a temporary cost of a net used during move assessment.
+     *
+     * A negative proposed_net_cost flags a net not yet affected by the move.
+     *
+     * Index range: [0..cluster_ctx.clb_nlist.nets().size()-1]
+     */
+    vtr::vector<ClusterNetId, double> net_cost;
+    vtr::vector<ClusterNetId, double> proposed_net_cost;
+
+    /**
+     * @brief Whether the bounding box of each net has been updated in the move being evaluated.
+     *
+     * If it has been updated before, the updated data must be used instead of the out-of-date
+     * data. NOT_UPDATED_YET indicates that the net has not been updated before, UPDATED_ONCE that
+     * the net has been updated once (if it is going to be updated again, the values from the
+     * previous update must be used). GOT_FROM_SCRATCH is only applicable for nets larger than
+     * SMALL_NETS and indicates that the bounding box could not be updated incrementally, and so
+     * was computed from scratch (and is definitely right, so must not be updated again).
+     *
+     * Index range: [0..cluster_ctx.clb_nlist.nets().size()-1]
+     */
+    vtr::vector<ClusterNetId, char> bb_updated_before;
+
+    /**
+     * @brief The inverse of the average number of tracks per channel between [subhigh] and [sublow].
+     *
+     * Accessed as chan?_place_cost_fac[subhigh][sublow]. They speed up the computation of the
+     * cost function that takes the length of the net bounding box in each dimension, divided by
+     * the average number of tracks in that direction; other cost functions never use them.
+     *
+     * Index ranges: [0..device_ctx.grid.width()-2] and [0..device_ctx.grid.height()-2]
+     */
+    vtr::NdMatrix<float, 2> chanx_place_cost_fac{{0, 0}};
+    vtr::NdMatrix<float, 2> chany_place_cost_fac{{0, 0}};
+
+    ///@brief [0..cluster_ctx.clb_nlist.nets().size()-1]. The proposed bounding box (edge counts and coordinates) of each net
+    vtr::vector<ClusterNetId, t_bb> ts_bb_edge_new;
+    vtr::vector<ClusterNetId, t_bb> ts_bb_coord_new;
+
+    ///@brief [0..cluster_ctx.clb_nlist.nets().size()-1][0..num_layers-1]. The proposed per-layer bounding box of each net
+    vtr::NdMatrix<t_2D_bb, 2> layer_ts_bb_edge_new;
+    vtr::NdMatrix<t_2D_bb, 2> layer_ts_bb_coord_new;
+
+    ///@brief [0..cluster_ctx.clb_nlist.nets().size()-1][0..num_layers-1]. The proposed number of sinks of each net on each layer
+    vtr::Matrix<int> ts_layer_sink_pin_count;
+
+    ///@brief The nets affected by the move being evaluated
+    std::vector<ClusterNetId> ts_nets_to_update;
+
+    ///@brief The routing demand of the net bounding boxes. Empty unless --place_congestion_weight is set.
+    PlacerCongestionMap congestion_map;
 };
 
 /**
@@ -97,11 +202,11 @@ struct PlacerMoveContext : public Context {
     // [0..cluster_ctx.clb_nlist.nets().size()-1]. Store the bounding box coordinates of a net's bounding box
     vtr::vector<ClusterNetId, t_bb> bb_coords;
 
-    // [0..cluster_ctx.clb_nlist.nets().size()-1]. Store the number of blocks on each of a net's bounding box (to allow efficient updates)
-    vtr::vector<ClusterNetId, std::vector<t_2D_bb>> layer_bb_num_on_edges;
+    // [0..cluster_ctx.clb_nlist.nets().size()-1][0..num_layers-1]. Store the number of blocks on each edge of a net's bounding box on each layer (to allow efficient updates)
+    vtr::NdMatrix<t_2D_bb, 2> layer_bb_num_on_edges;
 
-    // [0..cluster_ctx.clb_nlist.nets().size()-1]. Store the bounding box coordinates of a net's bounding box
-    vtr::vector<ClusterNetId, std::vector<t_2D_bb>> layer_bb_coords;
+    // [0..cluster_ctx.clb_nlist.nets().size()-1][0..num_layers-1]. Store the coordinates of a net's bounding box on each layer
+    vtr::NdMatrix<t_2D_bb, 2> layer_bb_coords;
 
     // [0..cluster_ctx.clb_nlist.nets().size()-1]. Store the number of blocks on each layer ()
     vtr::Matrix<int> num_sink_pin_layer;
@@ -142,8 +247,12 @@ class PlacerContext : public Context {
     const PlacerMoveContext& move() const { return move_; }
     PlacerMoveContext& mutable_move() { return move_; }
 
+    const PlacerCostContext& cost() const { return cost_; }
+    PlacerCostContext& mutable_cost() { return cost_; }
+
   private:
     PlacerTimingContext timing_;
     PlacerRuntimeContext runtime_;
     PlacerMoveContext move_;
+    PlacerCostContext cost_;
 };
@@ -19,6 +19,14 @@ e_create_move SimpleRLMoveGenerator::propose_move(t_pl_blocks_to_be_moved& block
     return avail_moves[(int)proposed_action.move_type]->propose_move(blocks_affected, proposed_action, rlim, placer_opts, criticalities);
 }
 
+void SimpleRLMoveGenerator::save_state(std::vector<double>& state) const {
+    karmed_bandit_agent->save_state(state);
+}
+
+void SimpleRLMoveGenerator::restore_state(const std::vector<double>& state, size_t& istate) {
+    karmed_bandit_agent->restore_state(state, istate);
+}
+
 void SimpleRLMoveGenerator::process_outcome(double reward, e_reward_function reward_fun) {
     karmed_bandit_agent->process_outcome(reward, reward_fun);
 }
@@ -70,6 +78,27 @@ e_move_type KArmedBanditAgent::action_to_move_type_(const size_t action_idx) {
     return move_type;
 }
 
+t_propose_action KArmedBanditAgent::propose_action() {
+    if (next_batch_action_ == action_batch_.size()) {
+        //Choose the next batch of actions
+        action_batch_.clear();
+        next_batch_action_ = 0;
+        choose_actions_(batch_size_, action_batch_);
+    }
+
+    //Mark the q_table location that agent used to update its value after processing the move outcome
+    last_action_ = action_batch_[next_batch_action_++];
+    pending_actions_.push_back(last_action_);
+
+    t_propose_action proposed_action{action_to_move_type_(last_action_),
+                                     action_to_blk_type_(last_action_)};
+
+    //Check the move type to be a valid move
+    VTR_ASSERT((size_t)proposed_action.move_type < num_available_moves_);
+
+    return proposed_action;
+}
+
 int KArmedBanditAgent::action_to_blk_type_(const size_t action_idx) {
     if (propose_blk_type_) {
         return action_logical_blk_type_.at(action_idx / num_available_moves_);
@@ -100,6 +129,10 @@ std::vector<int> KArmedBanditAgent::get_available_logical_blk_types_() {
 }
 
 void KArmedBanditAgent::process_outcome(double reward, e_reward_function reward_fun) {
+    VTR_ASSERT(!pending_actions_.empty());
+    last_action_ = pending_actions_.front();
+    pending_actions_.pop_front();
+
     ++num_action_chosen_[last_action_];
     if (reward_fun == RUNTIME_AWARE || reward_fun == WL_BIASED_RUNTIME_AWARE)
         reward /= time_elapsed_[last_action_ % num_available_moves_];
@@ -166,6 +199,55 @@ void KArmedBanditAgent::set_step(float gamma, int move_lim) {
     }
 }
 
+void KArmedBanditAgent::set_batch_size(size_t batch_size) {
+    VTR_ASSERT(batch_size > 0);
+    batch_size_ = batch_size;
+}
+
+void KArmedBanditAgent::save_state(std::vector<double>& state) const {
+    //Each variable length array is preceded by its size
+    state.push_back(num_available_actions_);
+    state.insert(state.end(), q_.begin(), q_.end());
+    state.insert(state.end(), num_action_chosen_.begin(), num_action_chosen_.end());
+
+    state.push_back(pending_actions_.size());
+    state.insert(state.end(), pending_actions_.begin(), pending_actions_.end());
+
+    state.push_back(action_batch_.size());
+    state.insert(state.end(), action_batch_.begin(), action_batch_.end());
+    state.push_back(next_batch_action_);
+}
+
+void KArmedBanditAgent::restore_state(const std::vector<double>& state, size_t& istate) {
+    auto next = [&]() {
+        if (istate >= state.size()) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "The saved placement RL agent state is truncated\n");
+        }
+        return state[istate++];
+    };
+
+    if (size_t(next()) != num_available_actions_) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "The saved placement RL agent state has a different number of actions\n");
+    }
+    for (float& q : q_) {
+        q = next();
+    }
+    for (size_t& num_chosen : num_action_chosen_) {
+        num_chosen = next();
+    }
+
+    pending_actions_.resize(size_t(next()));
+    for (size_t& action : pending_actions_) {
+        action = next();
+    }
+
+    action_batch_.resize(size_t(next()));
+    for (size_t& action : action_batch_) {
+        action = next();
+    }
+    next_batch_action_ = next();
+}
+
 int KArmedBanditAgent::agent_to_phy_blk_type(const int idx) {
     return action_logical_blk_type_.at(idx);
 }
@@ -199,33 +281,26 @@ void EpsilonGreedyAgent::init_q_scores_() {
     set_epsilon_action_prob();
 }
 
-t_propose_action EpsilonGreedyAgent::propose_action() {
-    if (vtr::frand() < epsilon_) {
-        /* Explore
-         * With probability epsilon, choose randomly amongst all move types */
-        float p = vtr::frand();
-        auto itr = std::lower_bound(cumm_epsilon_action_prob_.begin(), cumm_epsilon_action_prob_.end(), p);
-        auto action_type_q_pos = itr - cumm_epsilon_action_prob_.begin();
-        //Mark the q_table location that agent used to update its value after processing the move outcome
-        last_action_ = action_type_q_pos;
-
-    } else {
-        /* Greedy (Exploit)
-         * For probability 1-epsilon, choose the greedy move_type */
-        auto itr = std::max_element(q_.begin(), q_.end());
-        VTR_ASSERT(itr != q_.end());
-        auto action_type_q_pos = itr - q_.begin();
-        //Mark the q_table location that agent used to update its value after processing the move outcome
-        last_action_ = action_type_q_pos;
-    }
+void EpsilonGreedyAgent::choose_actions_(size_t num_actions, std::vector<size_t>& actions) {
+    //The greedy action only depends on the Q-table, so it is the same for the whole batch
+    auto greedy_itr = std::max_element(q_.begin(), q_.end());
+    VTR_ASSERT(greedy_itr != q_.end());
+    size_t greedy_action = greedy_itr - q_.begin();
 
-    t_propose_action proposed_action{action_to_move_type_(last_action_),
-                                     action_to_blk_type_(last_action_)};
-
-    //Check the move type to be a valid move
-    VTR_ASSERT((size_t)proposed_action.move_type < num_available_moves_);
+    for (size_t iaction = 0; iaction < num_actions; ++iaction) {
+        if (vtr::frand() < epsilon_) {
+            /* Explore
+             * With probability epsilon, choose randomly amongst all move types */
+            float p = vtr::frand();
+            auto itr = std::lower_bound(cumm_epsilon_action_prob_.begin(), cumm_epsilon_action_prob_.end(), p);
+            actions.push_back(itr - cumm_epsilon_action_prob_.begin());
 
-    return proposed_action;
+        } else {
+            /* Greedy (Exploit)
+             * For probability 1-epsilon, choose the greedy move_type */
+            actions.push_back(greedy_action);
+        }
+    }
 }
 
 void EpsilonGreedyAgent::set_epsilon(float epsilon) {
@@ -284,22 +359,17 @@ void SoftmaxAgent::init_q_scores_() {
     set_action_prob_();
 }
 
-t_propose_action SoftmaxAgent::propose_action() {
+void SoftmaxAgent::choose_actions_(size_t num_actions, std::vector<size_t>& actions) {
+    //The action probabilities only depend on the Q-table, so they are the same for the whole batch
     set_action_prob_();
 
-    float p = vtr::frand();
-    auto itr = std::lower_bound(cumm_action_prob_.begin(), cumm_action_prob_.end(), p);
-    auto action_type_q_pos = itr - cumm_action_prob_.begin();
-    //To take care that the last element in cumm_action_prob_ might be less than 1 by a small value
-    last_action_ = std::min((size_t)action_type_q_pos, num_available_actions_ - 1);
-
-    t_propose_action proposed_action{action_to_move_type_(last_action_),
-                                     action_to_blk_type_(last_action_)};
-
-    //Check the move type to be a valid move
-    VTR_ASSERT((size_t)proposed_action.move_type < num_available_moves_);
-
-    return proposed_action;
+    for (size_t iaction = 0; iaction < num_actions; ++iaction) {
+        float p = vtr::frand();
+        auto itr = std::lower_bound(cumm_action_prob_.begin(), cumm_action_prob_.end(), p);
+        auto action_type_q_pos = itr - cumm_action_prob_.begin();
+        //To take care that the last element in cumm_action_prob_ might be less than 1 by a small value
+        actions.push_back(std::min((size_t)action_type_q_pos, num_available_actions_ - 1));
+    }
 }
 
 void SoftmaxAgent::set_block_ratio_() {
@@ -1,5 +1,7 @@
 #ifndef VPR_SIMPLERL_MOVE_GEN_H
 #define VPR_SIMPLERL_MOVE_GEN_H
+#include <deque>
+
 #include "move_generator.h"
 #include "median_move_generator.h"
 #include "weighted_median_move_generator.h"
@@ -20,14 +22,19 @@ class KArmedBanditAgent {
     /**
      * @brief Choose a move type to perform and a block type that move should be performed with based on Q-table
      *
+     * The actions are chosen a batch at a time (see set_batch_size()), then proposed one by one.
+     *
      * @return A move type and a block type as a "t_propose_action" struct
      * If the agent is set to only propose move type, then block type index in the struct will be set to -1
      */
-    virtual t_propose_action propose_action() = 0;
+    t_propose_action propose_action();
 
     /**
      * @brief Update the agent Q-table based on the reward received by the SA algorithm
      *
+     * Several actions may be proposed before their outcomes are processed (e.g. for speculative
+     * move evaluation), in which case the outcomes must be processed in the order the actions were proposed.
+     *
      *   @param reward A double value calculated in "place.cpp" file showing how placement cost was affected by the prior action taken
      *   @param reward_func The reward function used by the agent, detail explanation can be found on "directed_moves_util.h" file
      */
@@ -50,7 +57,32 @@ class KArmedBanditAgent {
      */
     void set_step(float gamma, int move_lim);
 
+    /**
+     * @brief Set the number of actions chosen at a time
+     *
+     * All the actions of a batch are chosen from the Q-table as it was at the start of the batch,
+     * so the action probabilities are only recomputed once per batch.
+     *
+     *   @param batch_size Number of actions per batch, can be specified by the command-line option "--place_agent_batch_size"
+     *   Batch size default value is 1.
+     */
+    void set_batch_size(size_t batch_size);
+
+    ///@brief Appends the Q-table, the number of times each action was chosen and the pending actions to state
+    void save_state(std::vector<double>& state) const;
+
+    ///@brief Restores the state appended by save_state() from state[istate...], advancing istate past it
+    void restore_state(const std::vector<double>& state, size_t& istate);
+
   protected:
+    /**
+     * @brief Choose the next num_actions actions to propose from the current Q-table
+     *
+     *   @param num_actions Number of actions to choose
+     *   @param actions The chosen action indices are appended to this vector, in proposal order
+     */
+    virtual void choose_actions_(size_t num_actions, std::vector<size_t>& actions) = 0;
+
     /**
      * @brief Converts an action index to a move type.
      *
@@ -92,6 +124,10 @@ class KArmedBanditAgent {
     std::vector<size_t> num_action_chosen_; //Number of times each arm has been pulled (n)
     std::vector<float> q_;                  //Estimated value of each arm (Q)
     size_t last_action_;                    //type of the last action (move type) proposed
+    std::deque<size_t> pending_actions_;    //proposed actions whose outcome has not been processed yet, oldest first
+    size_t batch_size_ = 1;                 //Number of actions chosen at a time
+    std::vector<size_t> action_batch_;      //Actions of the current batch
+    size_t next_batch_action_ = 0;          //Index in action_batch_ of the next action to propose
     /* Ratios of the average runtime to calculate each move type              */
     /* These ratios are useful for different reward functions                 *
      * The vector is calculated by averaging many runs on different circuits  */
@@ -124,8 +160,6 @@ class EpsilonGreedyAgent : public KArmedBanditAgent {
     EpsilonGreedyAgent(size_t num_moves, e_agent_space agent_space, float epsilon);
     ~EpsilonGreedyAgent() override;
 
-    t_propose_action propose_action() override; //Returns the type of the next action as well as the block type the agent wishes to perform
-
   public:
     /**
      * @brief Set the user-specified epsilon for the E-greedy agent
@@ -140,6 +174,9 @@ class EpsilonGreedyAgent : public KArmedBanditAgent {
      */
     void set_epsilon_action_prob();
 
+  protected:
+    void choose_actions_(size_t num_actions, std::vector<size_t>& actions) override; //Chooses the next actions (move and block types) the agent wishes to perform
+
   private:
     /**
      * @brief Initialize agent's Q-table and internal variable to zero (RL-agent learns everything throughout the placement run and has no prior knowledge)
@@ -164,7 +201,9 @@ class SoftmaxAgent : public KArmedBanditAgent {
     ~SoftmaxAgent() override;
 
     //void process_outcome(double reward, std::string reward_fun) override; //Updates the agent based on the reward of the last proposed action
-    t_propose_action propose_action() override; //Returns the type of the next action as well as the block type the agent wishes to perform
+
+  protected:
+    void choose_actions_(size_t num_actions, std::vector<size_t>& actions) override; //Chooses the next actions (move and block types) the agent wishes to perform
 
   private:
     /**
@@ -223,6 +262,10 @@ class SimpleRLMoveGenerator : public MoveGenerator {
 
     // Receives feedback about the outcome of the previously proposed move
     void process_outcome(double reward, e_reward_function reward_fun) override;
+
+    // Saves and restores the agent state for the on-disk placement checkpoints
+    void save_state(std::vector<double>& state) const override;
+    void restore_state(const std::vector<double>& state, size_t& istate) override;
 };
 
 template<class T, class>
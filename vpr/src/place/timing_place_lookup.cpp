@@ -3,6 +3,13 @@
 #include <cmath>
 #include <time.h>
 #include <limits>
+#include <algorithm>
+#include <map>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/enumerable_thread_specific.h>
+#    include <tbb/parallel_for.h>
+#endif
 
 #include "rr_graph_fwd.h"
 #include "vtr_assert.h"
@@ -13,6 +20,7 @@
 #include "vtr_memory.h"
 #include "vtr_time.h"
 #include "vtr_geometry.h"
+#include "vtr_parallel.h"
 
 #include "arch_util.h"
 
@@ -33,6 +41,7 @@
 #include "route_profiling.h"
 #include "router_delay_profiling.h"
 #include "place_delay_model.h"
+#include "artifact_cache.h"
 
 /*To compute delay between blocks we calculate the delay between */
 /*different nodes in the FPGA.  From this procedure we generate
@@ -64,6 +73,29 @@ struct t_profile_info {
     int max_delta_y;
 };
 
+///@brief A source location, and the region of sink locations the delays from it are sampled at
+struct t_delay_sample {
+    t_delay_sample(const char* sample_name, int src_x, int src_y, int min_x, int min_y, int max_x, int max_y)
+        : name(sample_name)
+        , source_x(src_x)
+        , source_y(src_y)
+        , start_x(min_x)
+        , start_y(min_y)
+        , end_x(max_x)
+        , end_y(max_y) {}
+
+    const char* name;
+    int source_x;
+    int source_y;
+    int start_x;
+    int start_y;
+    int end_x;
+    int end_y;
+};
+
+///@brief The delays from a source RR node to all RR nodes (see calculate_all_path_delays_from_rr_node()), by source RR node
+typedef std::map<RRNodeId, vtr::vector<RRNodeId, float>> t_source_path_delays;
+
 /*** Function Prototypes *****/
 static t_chan_width setup_chan_width(const t_router_opts& router_opts,
                                      t_chan_width_dist chan_width_dist);
@@ -92,7 +124,8 @@ typedef std::function<void(
     const t_router_opts&,
     bool,
     const std::set<std::string>&,
-    bool)>
+    bool,
+    const t_source_path_delays&)>
     t_compute_delta_delay_matrix;
 
 static void generic_compute_matrix_iterative_astar(
@@ -108,7 +141,8 @@ static void generic_compute_matrix_iterative_astar(
     const t_router_opts& router_opts,
     bool measure_directconnect,
     const std::set<std::string>& allowed_types,
-    bool /***/);
+    bool /***/,
+    const t_source_path_delays& /*source_path_delays*/);
 
 static void generic_compute_matrix_dijkstra_expansion(
     RouterDelayProfiler& route_profiler,
@@ -123,7 +157,16 @@ static void generic_compute_matrix_dijkstra_expansion(
     const t_router_opts& router_opts,
     bool measure_directconnect,
     const std::set<std::string>& allowed_types,
-    bool is_flat);
+    bool is_flat,
+    const t_source_path_delays& source_path_delays);
+
+#ifdef VPR_USE_TBB
+static t_source_path_delays compute_source_path_delays(const std::vector<t_delay_sample>& samples,
+                                                       int layer_num,
+                                                       const std::set<std::string>& allowed_types,
+                                                       const t_router_opts& router_opts,
+                                                       bool is_flat);
+#endif
 
 static vtr::NdMatrix<float, 3> compute_delta_delays(
     RouterDelayProfiler& route_profiler,
@@ -162,6 +205,11 @@ static void fix_uninitialized_coordinates(vtr::NdMatrix<float, 3>& delta_delays)
 
 static float find_neightboring_average(vtr::NdMatrix<float, 3>& matrix, t_physical_tile_loc tile_loc, int max_distance);
 
+static std::string get_place_delay_model_cache_file(const t_placer_opts& placer_opts,
+                                                    const t_router_opts& router_opts,
+                                                    const t_det_routing_arch& det_routing_arch,
+                                                    bool is_flat);
+
 /******* Globally Accessible Functions **********/
 
 std::unique_ptr<PlaceDelayModel> compute_place_delay_model(const t_placer_opts& placer_opts,
@@ -185,6 +233,7 @@ std::unique_ptr<PlaceDelayModel> compute_place_delay_model(const t_placer_opts&
 
     const RouterLookahead* router_lookahead = get_cached_router_lookahead(*det_routing_arch,
                                                                           router_opts.lookahead_type,
+                                                                          router_opts.base_cost_type,
                                                                           router_opts.write_router_lookahead,
                                                                           router_opts.read_router_lookahead,
                                                                           segment_inf,
@@ -206,8 +255,22 @@ std::unique_ptr<PlaceDelayModel> compute_place_delay_model(const t_placer_opts&
         VTR_ASSERT_MSG(false, "Invalid placer delay model");
     }
 
+    std::string cache_file;
     if (placer_opts.read_placement_delay_lookup.empty()) {
+        cache_file = get_place_delay_model_cache_file(placer_opts, router_opts, *det_routing_arch, is_flat);
+    }
+
+    if (!cache_file.empty() && artifact_cache_contains(cache_file)) {
+        VTR_LOG("Loading placement delay model from artifact cache '%s'\n", cache_file.c_str());
+        place_delay_model->read(cache_file);
+    } else if (placer_opts.read_placement_delay_lookup.empty()) {
         place_delay_model->compute(route_profiler, placer_opts, router_opts, longest_length);
+
+        if (!cache_file.empty()) {
+            artifact_cache_store(cache_file, [&](const std::string& file) {
+                place_delay_model->write(file);
+            });
+        }
     } else {
         place_delay_model->read(placer_opts.read_placement_delay_lookup);
     }
@@ -227,11 +290,11 @@ void DeltaDelayModel::compute(
     const t_placer_opts& placer_opts,
     const t_router_opts& router_opts,
     int longest_length) {
-    delays_ = compute_delta_delay_model(
+    set_delays(compute_delta_delay_model(
         route_profiler,
         placer_opts, router_opts, /*measure_directconnect=*/true,
         longest_length,
-        is_flat_);
+        is_flat_));
 }
 
 void OverrideDelayModel::compute(
@@ -310,6 +373,33 @@ std::vector<int> get_best_classes(enum e_pin_type pintype, t_physical_tile_type_
     return best_classes;
 }
 
+static std::string get_place_delay_model_cache_file(const t_placer_opts& placer_opts,
+                                                    const t_router_opts& router_opts,
+                                                    const t_det_routing_arch& det_routing_arch,
+                                                    bool is_flat) {
+    if (det_routing_arch.artifact_cache_dir.empty()) {
+        return std::string();
+    }
+
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    ArtifactKey key(det_routing_arch.artifact_cache_dir, "place_delay_model", ".blob");
+    key.add_device(device_ctx.grid, device_ctx.chan_width)
+        .add("delay_model_type", int(placer_opts.delay_model_type))
+        .add("delay_model_reducer", int(placer_opts.delay_model_reducer))
+        .add("place_delta_delay_matrix_calculation_method", int(placer_opts.place_delta_delay_matrix_calculation_method))
+        .add("allowed_tiles_for_delay_model", placer_opts.allowed_tiles_for_delay_model)
+        .add("route_type", int(router_opts.route_type))
+        .add("lookahead_type", int(router_opts.lookahead_type))
+        .add("read_router_lookahead", router_opts.read_router_lookahead)
+        .add("base_cost_type", int(router_opts.base_cost_type))
+        .add("astar_fac", router_opts.astar_fac)
+        .add("router_profiler_astar_fac", router_opts.router_profiler_astar_fac)
+        .add("bend_cost", router_opts.bend_cost)
+        .add("is_flat", is_flat);
+    return key.path();
+}
+
 static int get_longest_segment_length(std::vector<t_segment_inf>& segment_inf) {
     int length;
 
@@ -437,7 +527,8 @@ static void generic_compute_matrix_dijkstra_expansion(
     const t_router_opts& router_opts,
     bool measure_directconnect,
     const std::set<std::string>& allowed_types,
-    bool is_flat) {
+    bool is_flat,
+    const t_source_path_delays& source_path_delays) {
     auto& device_ctx = g_vpr_ctx.device();
 
     t_physical_tile_type_ptr src_type = device_ctx.grid.get_physical_type({source_x, source_y, layer_num});
@@ -473,7 +564,14 @@ static void generic_compute_matrix_dijkstra_expansion(
         RRNodeId source_rr_node = device_ctx.rr_graph.node_lookup().find_node(layer_num, source_x, source_y, SOURCE, driver_ptc);
 
         VTR_ASSERT(source_rr_node != RRNodeId::INVALID());
-        auto delays = calculate_all_path_delays_from_rr_node(source_rr_node, router_opts, is_flat);
+
+        //Re-use the delays if they were already found (see compute_source_path_delays())
+        auto found_delays = source_path_delays.find(source_rr_node);
+        vtr::vector<RRNodeId, float> computed_delays;
+        if (found_delays == source_path_delays.end()) {
+            computed_delays = calculate_all_path_delays_from_rr_node(source_rr_node, router_opts, is_flat);
+        }
+        const auto& delays = (found_delays != source_path_delays.end()) ? found_delays->second : computed_delays;
 
         bool path_to_all_sinks = true;
         for (int sink_x = start_x; sink_x <= end_x; sink_x++) {
@@ -571,7 +669,8 @@ static void generic_compute_matrix_iterative_astar(
     const t_router_opts& router_opts,
     bool measure_directconnect,
     const std::set<std::string>& allowed_types,
-    bool /***/) {
+    bool /***/,
+    const t_source_path_delays& /*source_path_delays*/) {
     //vtr::ScopedStartFinishTimer t(vtr::string_fmt("Profiling from (%d,%d)", source_x, source_y));
 
     int delta_x, delta_y;
@@ -628,6 +727,56 @@ static void generic_compute_matrix_iterative_astar(
     }
 }
 
+#ifdef VPR_USE_TBB
+/**
+ * @brief Finds, concurrently, the delays from the source RR node of the first best driver class of each sample
+ *
+ * These expansions dominate the run-time of the Dijkstra delta delay calculation, and are independent
+ * once each has its own copy of the routing state. Merging the delays into the delta delay matrix
+ * depends on the order of the samples, so is still done serially (in generic_compute_matrix_dijkstra_expansion()).
+ */
+static t_source_path_delays compute_source_path_delays(const std::vector<t_delay_sample>& samples,
+                                                       int layer_num,
+                                                       const std::set<std::string>& allowed_types,
+                                                       const t_router_opts& router_opts,
+                                                       bool is_flat) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    std::vector<RRNodeId> source_rr_nodes;
+    for (const t_delay_sample& sample : samples) {
+        t_physical_tile_type_ptr src_type = device_ctx.grid.get_physical_type({sample.source_x, sample.source_y, layer_num});
+        bool is_allowed_type = allowed_types.empty() || allowed_types.find(src_type->name) != allowed_types.end();
+        if (src_type == device_ctx.EMPTY_PHYSICAL_TILE_TYPE || !is_allowed_type) {
+            continue;
+        }
+
+        //Later driver classes are only expanded if the first does not reach all sinks, so are left to the serial pass
+        auto best_driver_ptcs = get_best_classes(DRIVER, src_type);
+        if (best_driver_ptcs.empty()) {
+            continue;
+        }
+        RRNodeId source_rr_node = device_ctx.rr_graph.node_lookup().find_node(layer_num, sample.source_x, sample.source_y, SOURCE, best_driver_ptcs[0]);
+        if (source_rr_node != RRNodeId::INVALID()
+            && std::find(source_rr_nodes.begin(), source_rr_nodes.end(), source_rr_node) == source_rr_nodes.end()) {
+            source_rr_nodes.push_back(source_rr_node);
+        }
+    }
+
+    std::vector<vtr::vector<RRNodeId, float>> delays(source_rr_nodes.size());
+    tbb::enumerable_thread_specific<vtr::vector<RRNodeId, t_rr_node_path_inf>> rr_node_path_infs(route_ctx.rr_node_path_inf);
+    tbb::parallel_for(size_t(0), source_rr_nodes.size(), [&](size_t i) {
+        delays[i] = calculate_all_path_delays_from_rr_node(source_rr_nodes[i], router_opts, is_flat, &rr_node_path_infs.local());
+    });
+
+    t_source_path_delays source_path_delays;
+    for (size_t i = 0; i < source_rr_nodes.size(); ++i) {
+        source_path_delays.emplace(source_rr_nodes[i], std::move(delays[i]));
+    }
+    return source_path_delays;
+}
+#endif
+
 static vtr::NdMatrix<float, 3> compute_delta_delays(
     RouterDelayProfiler& route_profiler,
     const t_placer_opts& placer_opts,
@@ -695,6 +844,9 @@ static vtr::NdMatrix<float, 3> compute_delta_delays(
         //   \ = (low_x, high_y)
         //   + = device edge
 
+        //The samples, in the order their delays are merged into sampled_delta_delays
+        std::vector<t_delay_sample> samples;
+
         //Find the lowest y location on the left edge with a non-empty block
         int y = 0;
         int x = 0;
@@ -717,29 +869,7 @@ static vtr::NdMatrix<float, 3> compute_delta_delays(
         }
         VTR_ASSERT(src_type != nullptr);
 
-        t_compute_delta_delay_matrix generic_compute_matrix;
-        switch (placer_opts.place_delta_delay_matrix_calculation_method) {
-            case e_place_delta_delay_algorithm::ASTAR_ROUTE:
-                generic_compute_matrix = generic_compute_matrix_iterative_astar;
-                break;
-            case e_place_delta_delay_algorithm::DIJKSTRA_EXPANSION:
-                generic_compute_matrix = generic_compute_matrix_dijkstra_expansion;
-                break;
-            default:
-                VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Unknown place_delta_delay_matrix_calculation_method %d", placer_opts.place_delta_delay_matrix_calculation_method);
-        }
-
-#ifdef VERBOSE
-        VTR_LOG("Computing from lower left edge (%d,%d):\n", x, y);
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               x, y,
-                               x, y,
-                               grid.width() - 1, grid.height() - 1,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+        samples.emplace_back("lower left edge", x, y, x, y, grid.width() - 1, grid.height() - 1);
 
         //Find the lowest x location on the bottom edge with a non-empty block
         src_type = nullptr;
@@ -760,73 +890,58 @@ static vtr::NdMatrix<float, 3> compute_delta_delays(
             }
         }
         VTR_ASSERT(src_type != nullptr);
-#ifdef VERBOSE
-        VTR_LOG("Computing from left bottom edge (%d,%d):\n", x, y);
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               x, y,
-                               x, y,
-                               grid.width() - 1, grid.height() - 1,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+        samples.emplace_back("left bottom edge", x, y, x, y, grid.width() - 1, grid.height() - 1);
 
         //Since the other delta delay values may have suffered from edge effects,
         //we recalculate deltas within regions B, C, E, F
-#ifdef VERBOSE
-        VTR_LOG("Computing from low/low:\n");
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               low_x, low_y,
-                               low_x, low_y,
-                               grid.width() - 1, grid.height() - 1,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+        samples.emplace_back("low/low", low_x, low_y, low_x, low_y, grid.width() - 1, grid.height() - 1);
 
         //Since the other delta delay values may have suffered from edge effects,
         //we recalculate deltas within regions D, E, G, H
-#ifdef VERBOSE
-        VTR_LOG("Computing from high/high:\n");
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               high_x, high_y,
-                               0, 0,
-                               high_x, high_y,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+        samples.emplace_back("high/high", high_x, high_y, 0, 0, high_x, high_y);
 
         //Since the other delta delay values may have suffered from edge effects,
         //we recalculate deltas within regions A, B, D, E
-#ifdef VERBOSE
-        VTR_LOG("Computing from high/low:\n");
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               high_x, low_y,
-                               0, low_y,
-                               high_x, grid.height() - 1,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+        samples.emplace_back("high/low", high_x, low_y, 0, low_y, high_x, grid.height() - 1);
 
         //Since the other delta delay values may have suffered from edge effects,
         //we recalculate deltas within regions E, F, H, I
+        samples.emplace_back("low/high", low_x, high_y, low_x, 0, grid.width() - 1, high_y);
+
+        t_compute_delta_delay_matrix generic_compute_matrix;
+        switch (placer_opts.place_delta_delay_matrix_calculation_method) {
+            case e_place_delta_delay_algorithm::ASTAR_ROUTE:
+                generic_compute_matrix = generic_compute_matrix_iterative_astar;
+                break;
+            case e_place_delta_delay_algorithm::DIJKSTRA_EXPANSION:
+                generic_compute_matrix = generic_compute_matrix_dijkstra_expansion;
+                break;
+            default:
+                VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Unknown place_delta_delay_matrix_calculation_method %d", placer_opts.place_delta_delay_matrix_calculation_method);
+        }
+
+        //The Dijkstra expansions of the samples are independent, and found concurrently up-front.
+        //The A* router profiler updates global routing state, so its samples are routed serially.
+        t_source_path_delays source_path_delays;
+#ifdef VPR_USE_TBB
+        if (placer_opts.place_delta_delay_matrix_calculation_method == e_place_delta_delay_algorithm::DIJKSTRA_EXPANSION) {
+            source_path_delays = compute_source_path_delays(samples, layer_num, allowed_types, router_opts, is_flat);
+        }
+#endif
+
+        for (const t_delay_sample& sample : samples) {
 #ifdef VERBOSE
-        VTR_LOG("Computing from low/high:\n");
+            VTR_LOG("Computing from %s (%d,%d):\n", sample.name, sample.source_x, sample.source_y);
 #endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               low_x, high_y,
-                               low_x, 0,
-                               grid.width() - 1, high_y,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+            generic_compute_matrix(route_profiler, sampled_delta_delays,
+                                   layer_num,
+                                   sample.source_x, sample.source_y,
+                                   sample.start_x, sample.start_y,
+                                   sample.end_x, sample.end_y,
+                                   router_opts,
+                                   measure_directconnect, allowed_types,
+                                   is_flat, source_path_delays);
+        }
 
         for (size_t dx = 0; dx < sampled_delta_delays.dim_size(0); ++dx) {
             for (size_t dy = 0; dy < sampled_delta_delays.dim_size(1); ++dy) {
@@ -1166,10 +1281,17 @@ void OverrideDelayModel::compute_override_delay_model(
         //However, if the from/to ports are equivalent we could end up sampling the same RR SOURCE/SINK
         //paths multiple times (wasting CPU time) -- we avoid this by recording the sampled paths in
         //sampled_rr_pairs and skipping them if they occur multiple times.
-        int missing_instances = 0;
-        int missing_paths = 0;
-        std::set<std::pair<RRNodeId, RRNodeId>> sampled_rr_pairs;
-        for (int iconn = 0; iconn < num_conns; ++iconn) {
+        //
+        //Each connection's sample locations are found by a scan of the device grid, which dominates the
+        //run-time on large devices with wide directs. The scans only read the device context, so are done
+        //concurrently up-front; the delays are then routed serially (the router profiler updates the global
+        //RR base costs), in connection order so the results do not depend on the number of threads.
+        std::vector<int> from_pin_classes(num_conns, OPEN);
+        std::vector<int> to_pin_classes(num_conns, OPEN);
+        std::vector<RRNodeId> src_rrs(num_conns, RRNodeId::INVALID());
+        std::vector<RRNodeId> sink_rrs(num_conns, RRNodeId::INVALID());
+        std::vector<char> found_sample_points(num_conns, false);
+        vtr::parallel_for(0, num_conns, [&](size_t iconn) {
             //Find the associated pins
             int from_pin = find_pin(from_type, from_port.port_name(), from_port.port_low_index() + iconn);
             int to_pin = find_pin(to_type, to_port.port_name(), to_port.port_low_index() + iconn);
@@ -1183,11 +1305,21 @@ void OverrideDelayModel::compute_override_delay_model(
             int to_pin_class = find_pin_class(to_type, to_port.port_name(), to_port.port_low_index() + iconn, RECEIVER);
             VTR_ASSERT(to_pin_class != OPEN);
 
-            bool found_sample_points;
-            RRNodeId src_rr, sink_rr;
-            found_sample_points = find_direct_connect_sample_locations(direct, from_type, from_pin, from_pin_class, to_type, to_pin, to_pin_class, src_rr, sink_rr);
+            from_pin_classes[iconn] = from_pin_class;
+            to_pin_classes[iconn] = to_pin_class;
+            found_sample_points[iconn] = find_direct_connect_sample_locations(direct, from_type, from_pin, from_pin_class, to_type, to_pin, to_pin_class, src_rrs[iconn], sink_rrs[iconn]);
+        });
+
+        int missing_instances = 0;
+        int missing_paths = 0;
+        std::set<std::pair<RRNodeId, RRNodeId>> sampled_rr_pairs;
+        for (int iconn = 0; iconn < num_conns; ++iconn) {
+            int from_pin_class = from_pin_classes[iconn];
+            int to_pin_class = to_pin_classes[iconn];
+            RRNodeId src_rr = src_rrs[iconn];
+            RRNodeId sink_rr = sink_rrs[iconn];
 
-            if (!found_sample_points) {
+            if (!found_sample_points[iconn]) {
                 ++missing_instances;
                 continue;
             }
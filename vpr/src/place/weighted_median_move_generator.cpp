@@ -4,6 +4,8 @@
 #include "math.h"
 #include "place_constraints.h"
 #include "move_utils.h"
+#include "place_util.h"
+#include "net_bb_util.h"
 
 #define CRIT_MULT_FOR_W_MEDIAN 10
 
@@ -162,88 +164,53 @@ e_create_move WeightedMedianMoveGenerator::propose_move(t_pl_blocks_to_be_moved&
  *      - criticalities: the timing criticalities of all connections
  */
 static void get_bb_cost_for_net_excluding_block(ClusterNetId net_id, ClusterBlockId, ClusterPinId moving_pin_id, const PlacerCriticalities* criticalities, t_bb_cost* coords, bool& skip_net) {
-    int pnum, x, y, xmin, xmax, ymin, ymax;
-    float xmin_cost, xmax_cost, ymin_cost, ymax_cost, cost;
-
-    skip_net = true;
+    auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    xmin = 0;
-    xmax = 0;
-    ymin = 0;
-    ymax = 0;
-    cost = 0.0;
-    xmin_cost = 0.0;
-    xmax_cost = 0.0;
-    ymin_cost = 0.0;
-    ymax_cost = 0.0;
+    /* The pin coordinates are clipped to the channels (see                *
+     * load_net_pin_coords()), so their extent is the bounding box.        */
+    static thread_local t_net_pin_coords pin_coords;
+    load_net_pin_coords(net_id, pin_coords);
+    size_t num_pins = pin_coords.size();
+
+    //The first pin other than the moving pin, which takes its location so it doesn't extend the bounding box
+    size_t imoving = cluster_ctx.clb_nlist.pin_net_index(moving_pin_id);
+    size_t ikept = (imoving == 0) ? 1 : 0;
+
+    skip_net = (ikept >= num_pins);
+    if (skip_net) {
+        coords->xmin = {0, 0.};
+        coords->xmax = {0, 0.};
+        coords->ymin = {0, 0.};
+        coords->ymax = {0, 0.};
+        return;
+    }
 
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
-    auto& device_ctx = g_vpr_ctx.device();
-    auto& grid = device_ctx.grid;
-
-    ClusterBlockId bnum;
-    bool is_first_block = true;
-    int ipin;
-    for (auto pin_id : cluster_ctx.clb_nlist.net_pins(net_id)) {
-        bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
-
-        if (pin_id != moving_pin_id) {
-            skip_net = false;
-            pnum = tile_pin_index(pin_id);
-            /**
-             * Calculates the pin index of the correct pin to calculate the required connection
-             *
-             * if the current pin is the driver, we only care about one sink (the moving pin)
-             * else if the current pin is a sink, calculate the criticality of itself
-             */
-            if (cluster_ctx.clb_nlist.pin_type(pin_id) == PinType::DRIVER) {
-                ipin = cluster_ctx.clb_nlist.pin_net_index(moving_pin_id);
-            } else {
-                ipin = cluster_ctx.clb_nlist.pin_net_index(pin_id);
-            }
-            cost = criticalities->criticality(net_id, ipin);
-
-            VTR_ASSERT(pnum >= 0);
-            x = place_ctx.block_locs[bnum].loc.x + physical_tile_type(bnum)->pin_width_offset[pnum];
-            y = place_ctx.block_locs[bnum].loc.y + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-            x = std::max(std::min(x, (int)grid.width() - 2), 1);  //-2 for no perim channels
-            y = std::max(std::min(y, (int)grid.height() - 2), 1); //-2 for no perim channels
-
-            if (is_first_block) {
-                xmin = x;
-                xmin_cost = cost;
-                ymin = y;
-                ymin_cost = cost;
-                xmax = x;
-                xmax_cost = cost;
-                ymax = y;
-                ymax_cost = cost;
-                is_first_block = false;
-            } else {
-                if (x < xmin) {
-                    xmin = x;
-                    xmin_cost = cost;
-                } else if (x > xmax) {
-                    xmax = x;
-                    xmax_cost = cost;
-                }
-
-                if (y < ymin) {
-                    ymin = y;
-                    ymin_cost = cost;
-                } else if (y > ymax) {
-                    ymax = y;
-                    ymax_cost = cost;
-                }
-            }
+    pin_coords.x[imoving] = pin_coords.x[ikept];
+    pin_coords.y[imoving] = pin_coords.y[ikept];
+
+    t_coord_extent_pins x_extent = coord_extent_first_pins(pin_coords.x.data() + ikept, num_pins - ikept);
+    t_coord_extent_pins y_extent = coord_extent_first_pins(pin_coords.y.data() + ikept, num_pins - ikept);
+
+    /**
+     * The cost of an edge is the criticality of the connection of the first pin on it
+     *
+     * if that pin is the driver, we only care about one sink (the moving pin)
+     * else if that pin is a sink, it is the criticality of itself
+     */
+    auto edge_cost = [&](size_t ipin) {
+        ipin += ikept;
+        //The moving pin is a copy of the earlier pin ikept, so it is never the first on an edge
+        VTR_ASSERT_SAFE(ipin != imoving);
+        ClusterPinId pin_id = cluster_ctx.clb_nlist.net_pin(net_id, ipin);
+        if (cluster_ctx.clb_nlist.pin_type(pin_id) == PinType::DRIVER) {
+            ipin = imoving;
         }
-    }
+        return criticalities->criticality(net_id, ipin);
+    };
 
     // Copy the bounding box edges and corresponding criticalities into the proper structure
-    coords->xmin = {xmin, xmin_cost};
-    coords->xmax = {xmax, xmax_cost};
-    coords->ymin = {ymin, ymin_cost};
-    coords->ymax = {ymax, ymax_cost};
+    coords->xmin = {x_extent.min, edge_cost(x_extent.first_on_min)};
+    coords->xmax = {x_extent.max, edge_cost(x_extent.first_on_max)};
+    coords->ymin = {y_extent.min, edge_cost(y_extent.first_on_min)};
+    coords->ymax = {y_extent.max, edge_cost(y_extent.first_on_max)};
 }
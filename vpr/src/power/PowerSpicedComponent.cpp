@@ -249,6 +249,55 @@ bool PowerSpicedComponent::is_done_callibration() {
     return done_callibration;
 }
 
+void PowerSpicedComponent::write_callibration(std::ostream& os) {
+    VTR_ASSERT(done_callibration);
+
+    /* Enough digits for the sizes to compare equal when read back */
+    os.precision(std::numeric_limits<float>::max_digits10);
+    os << name << " " << entries.size() << "\n";
+    for (PowerCallibInputs* inputs : entries) {
+        os << inputs->num_inputs << " " << inputs->entries.size() << "\n";
+        for (PowerCallibSize* size : inputs->entries) {
+            os << size->transistor_size << " " << size->factor << "\n";
+        }
+    }
+}
+
+bool PowerSpicedComponent::read_callibration(std::istream& is) {
+    std::string file_name;
+    size_t num_entries;
+
+    sort_me();
+
+    if (!(is >> file_name >> num_entries) || file_name != name
+        || num_entries != entries.size()) {
+        return false;
+    }
+
+    for (PowerCallibInputs* inputs : entries) {
+        int num_inputs;
+        size_t num_sizes;
+        if (!(is >> num_inputs >> num_sizes) || num_inputs != inputs->num_inputs
+            || num_sizes != inputs->entries.size()) {
+            return false;
+        }
+
+        for (PowerCallibSize* size : inputs->entries) {
+            float transistor_size;
+            if (!(is >> transistor_size >> size->factor)
+                || transistor_size != size->transistor_size) {
+                return false;
+            }
+        }
+    }
+
+    for (PowerCallibInputs* inputs : entries) {
+        inputs->done_callibration = true;
+    }
+    done_callibration = true;
+    return true;
+}
+
 void PowerSpicedComponent::print(FILE* fp) {
     fprintf(fp, "%s\n", name.c_str());
     for (std::vector<PowerCallibInputs*>::iterator it = entries.begin() + 1;
@@ -20,6 +20,7 @@
 
 #include <vector>
 #include <string>
+#include <iostream>
 
 /************************* STRUCTS **********************************/
 class PowerSpicedComponent;
@@ -84,6 +85,12 @@ class PowerSpicedComponent {
     void callibrate();
     bool is_done_callibration();
     void print(FILE* fp);
+
+    /* Saves/restores the callibrated factors of all entries.
+     * read_callibration() returns false (without marking the component
+     * as callibrated) if the data points do not match the saved ones. */
+    void write_callibration(std::ostream& os);
+    bool read_callibration(std::istream& is);
 };
 
 #endif
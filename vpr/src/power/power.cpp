@@ -27,12 +27,16 @@
 #include <ctime>
 #include <cmath>
 #include <ctype.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
 
 #include "vtr_util.h"
 #include "vtr_path.h"
 #include "vtr_log.h"
 #include "vtr_assert.h"
 #include "vtr_memory.h"
+#include "vtr_digest.h"
 
 #include "power.h"
 #include "power_components.h"
@@ -46,11 +50,19 @@
 #include "globals.h"
 #include "rr_graph.h"
 #include "vpr_utils.h"
+#include "artifact_cache.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
 
 /************************* DEFINES **********************************/
 #define CONVERT_NM_PER_M 1000000000
 #define CONVERT_UM_PER_M 1000000
 
+/* Number of blocks (or routing resources) estimated together, as one parallel task */
+#define POWER_CHUNK_SIZE 256
+
 /************************* ENUMS ************************************/
 typedef enum {
     POWER_BREAKDOWN_ENTRY_TYPE_TITLE = 0,
@@ -61,8 +73,28 @@ typedef enum {
     POWER_BREAKDOWN_ENTRY_TYPE_BUFS_WIRES
 } e_power_breakdown_entry_type;
 
+/************************* STRUCTS **********************************/
+/* The power of a chunk of blocks or routing resources, which are estimated in parallel */
+struct t_power_chunk_usage {
+    t_power_usage power_usage;
+    t_power_shared_updates updates;
+
+    /* Routing buffer statistics */
+    int num_sb_buffers = 0;
+    float total_sb_buffer_size = 0.;
+    int num_cb_buffers = 0;
+    float total_cb_buffer_size = 0.;
+};
+
+/* The power of an unused pb (see power_init_unused_pb_usage) */
+struct t_unused_pb_usage {
+    t_power_usage power_usage;
+    t_power_shared_updates updates;
+};
+
 /************************* File Scope **********************************/
 static t_rr_node_power* rr_node_power;
+static std::unordered_map<const t_pb_graph_node*, t_unused_pb_usage> unused_pb_usage;
 
 /************************* Function Declarations ********************/
 /* Routing */
@@ -73,6 +105,7 @@ static void power_usage_routing(t_power_usage* power_usage,
 /* Tiles */
 static void power_usage_blocks(t_power_usage* power_usage);
 static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node* pb_node, ClusterBlockId iblk);
+static void power_init_unused_pb_usage(t_pb_graph_node* pb_node);
 static void power_usage_primitive(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node* pb_graph_node, ClusterBlockId iblk);
 static void power_reset_tile_usage();
 static void power_reset_pb_type(t_pb_type* pb_type);
@@ -326,6 +359,15 @@ static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node
 
     auto& power_ctx = g_vpr_ctx.power();
 
+    if (!pb) {
+        auto unused_usage = unused_pb_usage.find(pb_node);
+        if (unused_usage != unused_pb_usage.end()) {
+            *power_usage = unused_usage->second.power_usage;
+            power_apply_shared_updates(unused_usage->second.updates);
+            return;
+        }
+    }
+
     power_zero_usage(power_usage);
 
     t_pb_type* pb_type = pb_node->pb_type;
@@ -492,8 +534,8 @@ static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node
                                                 pb_node, iblk);
             power_component_add_usage(&power_usage_bufs_wires,
                                       POWER_COMPONENT_PB_BUFS_WIRE);
-            power_add_usage(&pb_node->pb_type->pb_type_power->power_usage_bufs_wires,
-                            &power_usage_bufs_wires);
+            power_add_shared_usage(&pb_node->pb_type->pb_type_power->power_usage_bufs_wires,
+                                   &power_usage_bufs_wires);
             power_add_usage(power_usage, &power_usage_bufs_wires);
         }
 
@@ -515,8 +557,8 @@ static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node
                                       POWER_COMPONENT_PB_INTERC_MUXES);
 
             // Add to power of this mode
-            power_add_usage(&pb_node->pb_type->modes[pb_mode].mode_power->power_usage,
-                            &power_usage_local_muxes);
+            power_add_shared_usage(&pb_node->pb_type->modes[pb_mode].mode_power->power_usage,
+                                   &power_usage_local_muxes);
         }
 
         /* Add power for children */
@@ -548,12 +590,42 @@ static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node
             power_add_usage(power_usage, &power_usage_children);
 
             // Add to power of this mode
-            power_add_usage(&pb_node->pb_type->modes[pb_mode].mode_power->power_usage,
-                            &power_usage_children);
+            power_add_shared_usage(&pb_node->pb_type->modes[pb_mode].mode_power->power_usage,
+                                   &power_usage_children);
         }
     }
 
-    power_add_usage(&pb_node->pb_type->pb_type_power->power_usage, power_usage);
+    power_add_shared_usage(&pb_node->pb_type->pb_type_power->power_usage, power_usage);
+}
+
+/**
+ * Memoizes the power of an unused pb of pb_node (and of the unused pbs of all its
+ * descendants, in all modes), so it is only estimated once rather than for every
+ * unused instance, e.g. every empty tile or unused BLE.
+ * An unused pb is always in its default mode, with unused children, so its power
+ * (and shared power updates) only depend on its pb_graph_node.
+ */
+static void power_init_unused_pb_usage(t_pb_graph_node* pb_node) {
+    if (unused_pb_usage.count(pb_node)) {
+        return;
+    }
+
+    t_pb_type* pb_type = pb_node->pb_type;
+    for (int mode_idx = 0; mode_idx < pb_type->num_modes; mode_idx++) {
+        for (int pb_type_idx = 0; pb_type_idx < pb_type->modes[mode_idx].num_pb_type_children; pb_type_idx++) {
+            for (int pb_idx = 0; pb_idx < pb_type->modes[mode_idx].pb_type_children[pb_type_idx].num_pb; pb_idx++) {
+                power_init_unused_pb_usage(&pb_node->child_pb_graph_nodes[mode_idx][pb_type_idx][pb_idx]);
+            }
+        }
+    }
+
+    /* The children are memoized, so this only estimates pb_node itself */
+    t_unused_pb_usage usage;
+    {
+        PowerSharedUpdatesRecorder recorder(usage.updates);
+        power_usage_pb(&usage.power_usage, nullptr, pb_node, ClusterBlockId::INVALID());
+    }
+    unused_pb_usage.emplace(pb_node, std::move(usage));
 }
 
 /* Resets the power stats for all physical blocks */
@@ -606,7 +678,19 @@ static void power_usage_blocks(t_power_usage* power_usage) {
 
     power_reset_tile_usage();
 
-    t_logical_block_type_ptr logical_block;
+    unused_pb_usage.clear();
+    for (const auto& type : device_ctx.logical_block_types) {
+        if (type.pb_graph_head) {
+            power_init_unused_pb_usage(type.pb_graph_head);
+        }
+    }
+
+    struct t_tile_block {
+        t_pb* pb;
+        t_logical_block_type_ptr logical_block;
+        ClusterBlockId iblk;
+    };
+    std::vector<t_tile_block> blocks;
 
     /* Loop through all grid locations */
     for (int layer_num = 0; layer_num < device_ctx.grid.get_num_layers(); layer_num++) {
@@ -623,26 +707,53 @@ static void power_usage_blocks(t_power_usage* power_usage) {
                 }
 
                 for (int z = 0; z < physical_tile->capacity; z++) {
-                    t_pb* pb = nullptr;
-                    t_power_usage pb_power;
-
-                    ClusterBlockId iblk = place_ctx.grid_blocks.block_at_location({x, y, z, layer_num});
+                    t_tile_block block = {nullptr, nullptr, place_ctx.grid_blocks.block_at_location({x, y, z, layer_num})};
 
-                    if (iblk != EMPTY_BLOCK_ID && iblk != INVALID_BLOCK_ID) {
-                        pb = cluster_ctx.clb_nlist.block_pb(iblk);
-                        logical_block = cluster_ctx.clb_nlist.block_type(iblk);
+                    if (block.iblk != EMPTY_BLOCK_ID && block.iblk != INVALID_BLOCK_ID) {
+                        block.pb = cluster_ctx.clb_nlist.block_pb(block.iblk);
+                        block.logical_block = cluster_ctx.clb_nlist.block_type(block.iblk);
                     } else {
-                        logical_block = pick_logical_type(physical_tile);
+                        block.logical_block = pick_logical_type(physical_tile);
                     }
-
-                    /* Calculate power of this CLB */
-                    power_usage_pb(&pb_power, pb, logical_block->pb_graph_head, iblk);
-                    power_add_usage(power_usage, &pb_power);
+                    blocks.push_back(block);
                 }
             }
         }
     }
-    return;
+
+    /* Calculate power of the CLBs, by chunk. The shared power updates of each chunk are
+     * applied in chunk order, so the result does not depend on the number of threads. */
+    size_t num_chunks = (blocks.size() + POWER_CHUNK_SIZE - 1) / POWER_CHUNK_SIZE;
+    std::vector<t_power_chunk_usage> chunk_usages(num_chunks);
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_chunks, [&](size_t ichunk) {
+#else
+    for (size_t ichunk = 0; ichunk < num_chunks; ichunk++) {
+#endif
+        t_power_chunk_usage& chunk_usage = chunk_usages[ichunk];
+        PowerSharedUpdatesRecorder recorder(chunk_usage.updates);
+
+        power_zero_usage(&chunk_usage.power_usage);
+        size_t end = std::min(blocks.size(), (ichunk + 1) * POWER_CHUNK_SIZE);
+        for (size_t iblock = ichunk * POWER_CHUNK_SIZE; iblock < end; iblock++) {
+            const t_tile_block& block = blocks[iblock];
+            t_power_usage pb_power;
+
+            power_usage_pb(&pb_power, block.pb, block.logical_block->pb_graph_head, block.iblk);
+            power_add_usage(&chunk_usage.power_usage, &pb_power);
+        }
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+
+    for (const t_power_chunk_usage& chunk_usage : chunk_usages) {
+        power_add_usage(power_usage, &chunk_usage.power_usage);
+        power_apply_shared_updates(chunk_usage.updates);
+    }
+
+    unused_pb_usage.clear();
 }
 
 /**
@@ -866,175 +977,203 @@ static void power_usage_routing(t_power_usage* power_usage,
         }
     }
 
-    /* Calculate power of all routing entities */
-    for (const RRNodeId& rr_id : device_ctx.rr_graph.nodes()) {
-        t_power_usage sub_power_usage;
-        t_rr_node_power* node_power = &rr_node_power[(size_t)rr_id];
-        float C_wire;
-        float buffer_size;
-        int connectionbox_fanout;
-        int switchbox_fanout;
-        //float C_per_seg_split;
-        int wire_length;
-        const t_edge_size node_fan_in = rr_graph.node_fan_in(rr_id);
-
-        switch (rr_graph.node_type(rr_id)) {
-            case SOURCE:
-            case SINK:
-            case OPIN:
-                /* No power usage for these types */
-                break;
-            case IPIN:
-                /* This is part of the connectionbox.  The connection box is comprised of:
-                 *  - Driver (accounted for at end of CHANX/Y - see below)
-                 *  - Multiplexor */
-
-                if (node_fan_in) {
+    /* Calculate power of all routing entities, by chunk (as for power_usage_blocks) */
+    size_t num_chunks = (rr_graph.num_nodes() + POWER_CHUNK_SIZE - 1) / POWER_CHUNK_SIZE;
+    std::vector<t_power_chunk_usage> chunk_usages(num_chunks);
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_chunks, [&](size_t ichunk) {
+#else
+    for (size_t ichunk = 0; ichunk < num_chunks; ichunk++) {
+#endif
+        t_power_chunk_usage& chunk_usage = chunk_usages[ichunk];
+        PowerSharedUpdatesRecorder recorder(chunk_usage.updates);
+
+        power_zero_usage(&chunk_usage.power_usage);
+        size_t end = std::min(rr_graph.num_nodes(), (ichunk + 1) * POWER_CHUNK_SIZE);
+        for (size_t inode = ichunk * POWER_CHUNK_SIZE; inode < end; inode++) {
+            RRNodeId rr_id(inode);
+            t_power_usage sub_power_usage;
+            t_rr_node_power* node_power = &rr_node_power[(size_t)rr_id];
+            float C_wire;
+            float buffer_size;
+            int connectionbox_fanout;
+            int switchbox_fanout;
+            //float C_per_seg_split;
+            int wire_length;
+            const t_edge_size node_fan_in = rr_graph.node_fan_in(rr_id);
+
+            switch (rr_graph.node_type(rr_id)) {
+                case SOURCE:
+                case SINK:
+                case OPIN:
+                    /* No power usage for these types */
+                    break;
+                case IPIN:
+                    /* This is part of the connectionbox.  The connection box is comprised of:
+                     *  - Driver (accounted for at end of CHANX/Y - see below)
+                     *  - Multiplexor */
+
+                    if (node_fan_in) {
+                        VTR_ASSERT(node_power->in_dens);
+                        VTR_ASSERT(node_power->in_prob);
+
+                        /* Multiplexor */
+                        power_usage_mux_multilevel(&sub_power_usage,
+                                                   power_get_mux_arch(node_fan_in,
+                                                                      power_ctx.arch->mux_transistor_size),
+                                                   node_power->in_prob, node_power->in_dens,
+                                                   node_power->selected_input, true,
+                                                   power_ctx.solution_inf.T_crit);
+                        power_add_usage(&chunk_usage.power_usage, &sub_power_usage);
+                        power_component_add_usage(&sub_power_usage,
+                                                  POWER_COMPONENT_ROUTE_CB);
+                    }
+                    break;
+                case CHANX:
+                case CHANY: {
+                    /* This is a wire driven by a switchbox, which includes:
+                     * 	- The Multiplexor at the beginning of the wire
+                     * 	- A buffer, after the mux to drive the wire
+                     * 	- The wire itself
+                     * 	- A buffer at the end of the wire, going to switchbox/connectionbox */
                     VTR_ASSERT(node_power->in_dens);
                     VTR_ASSERT(node_power->in_prob);
 
+                    wire_length = 0;
+                    if (rr_graph.node_type(rr_id) == CHANX) {
+                        wire_length = rr_graph.node_xhigh(rr_id) - rr_graph.node_xlow(rr_id) + 1;
+                    } else if (rr_graph.node_type(rr_id) == CHANY) {
+                        wire_length = rr_graph.node_yhigh(rr_id) - rr_graph.node_ylow(rr_id) + 1;
+                    }
+                    int seg_index = device_ctx.rr_indexed_data[rr_graph.node_cost_index(rr_id)].seg_index;
+                    C_wire = wire_length * rr_graph.rr_segments(RRSegmentId(seg_index)).Cmetal;
+                    //(double)power_ctx.commonly_used->tile_length);
+                    VTR_ASSERT(node_power->selected_input < node_fan_in);
+
                     /* Multiplexor */
                     power_usage_mux_multilevel(&sub_power_usage,
                                                power_get_mux_arch(node_fan_in,
                                                                   power_ctx.arch->mux_transistor_size),
                                                node_power->in_prob, node_power->in_dens,
-                                               node_power->selected_input, true,
-                                               power_ctx.solution_inf.T_crit);
-                    power_add_usage(power_usage, &sub_power_usage);
+                                               node_power->selected_input, true, power_ctx.solution_inf.T_crit);
+                    power_add_usage(&chunk_usage.power_usage, &sub_power_usage);
                     power_component_add_usage(&sub_power_usage,
-                                              POWER_COMPONENT_ROUTE_CB);
-                }
-                break;
-            case CHANX:
-            case CHANY: {
-                /* This is a wire driven by a switchbox, which includes:
-                 * 	- The Multiplexor at the beginning of the wire
-                 * 	- A buffer, after the mux to drive the wire
-                 * 	- The wire itself
-                 * 	- A buffer at the end of the wire, going to switchbox/connectionbox */
-                VTR_ASSERT(node_power->in_dens);
-                VTR_ASSERT(node_power->in_prob);
-
-                wire_length = 0;
-                if (rr_graph.node_type(rr_id) == CHANX) {
-                    wire_length = rr_graph.node_xhigh(rr_id) - rr_graph.node_xlow(rr_id) + 1;
-                } else if (rr_graph.node_type(rr_id) == CHANY) {
-                    wire_length = rr_graph.node_yhigh(rr_id) - rr_graph.node_ylow(rr_id) + 1;
-                }
-                int seg_index = device_ctx.rr_indexed_data[rr_graph.node_cost_index(rr_id)].seg_index;
-                C_wire = wire_length * rr_graph.rr_segments(RRSegmentId(seg_index)).Cmetal;
-                //(double)power_ctx.commonly_used->tile_length);
-                VTR_ASSERT(node_power->selected_input < node_fan_in);
-
-                /* Multiplexor */
-                power_usage_mux_multilevel(&sub_power_usage,
-                                           power_get_mux_arch(node_fan_in,
-                                                              power_ctx.arch->mux_transistor_size),
-                                           node_power->in_prob, node_power->in_dens,
-                                           node_power->selected_input, true, power_ctx.solution_inf.T_crit);
-                power_add_usage(power_usage, &sub_power_usage);
-                power_component_add_usage(&sub_power_usage,
-                                          POWER_COMPONENT_ROUTE_SB);
-
-                /* Buffer Size */
-                switch (rr_graph.rr_switch_inf(RRSwitchId(node_power->driver_switch_type)).power_buffer_type) {
-                    case POWER_BUFFER_TYPE_AUTO:
-                        /*
-                         * C_per_seg_split = ((float) node->num_edges
-                         * power_ctx.commonly_used->INV_1X_C_in + C_wire);
-                         * // / (float) power_ctx.arch->seg_buffer_split;
-                         * buffer_size = power_buffer_size_from_logical_effort(
-                         * C_per_seg_split);
-                         * buffer_size = std::max(buffer_size, 1.0F);
-                         */
-                        buffer_size = power_calc_buffer_size_from_Cout(rr_graph.rr_switch_inf(RRSwitchId(node_power->driver_switch_type)).Cout);
-                        break;
-                    case POWER_BUFFER_TYPE_ABSOLUTE_SIZE:
-                        buffer_size = rr_graph.rr_switch_inf(RRSwitchId(node_power->driver_switch_type)).power_buffer_size;
-                        buffer_size = std::max(buffer_size, 1.0F);
-                        break;
-                    case POWER_BUFFER_TYPE_NONE:
-                        buffer_size = 0.;
-                        break;
-                    default:
-                        buffer_size = 0.;
-                        VTR_ASSERT(0);
-                        break;
-                }
+                                              POWER_COMPONENT_ROUTE_SB);
 
-                power_ctx.commonly_used->num_sb_buffers++;
-                power_ctx.commonly_used->total_sb_buffer_size += buffer_size;
-
-                /*
-                 * power_ctx.commonly_used->num_sb_buffers +=
-                 * power_ctx.arch->seg_buffer_split;
-                 * power_ctx.commonly_used->total_sb_buffer_size += buffer_size
-                 * power_ctx.arch->seg_buffer_split;
-                 */
-
-                /* Buffer */
-                power_usage_buffer(&sub_power_usage, buffer_size,
-                                   node_power->in_prob[node_power->selected_input],
-                                   node_power->in_dens[node_power->selected_input], true,
-                                   power_ctx.solution_inf.T_crit);
-                power_add_usage(power_usage, &sub_power_usage);
-                power_component_add_usage(&sub_power_usage,
-                                          POWER_COMPONENT_ROUTE_SB);
-
-                /* Wire Capacitance */
-                power_usage_wire(&sub_power_usage, C_wire,
-                                 clb_net_density(node_power->net_num), power_ctx.solution_inf.T_crit);
-                power_add_usage(power_usage, &sub_power_usage);
-                power_component_add_usage(&sub_power_usage,
-                                          POWER_COMPONENT_ROUTE_GLB_WIRE);
-
-                /* Determine types of switches that this wire drives */
-                connectionbox_fanout = 0;
-                switchbox_fanout = 0;
-                for (t_edge_size iedge = 0; iedge < rr_graph.num_edges(rr_id); iedge++) {
-                    if (rr_graph.edge_switch(rr_id, iedge) == routing_arch->wire_to_rr_ipin_switch) {
-                        connectionbox_fanout++;
-                    } else if (rr_graph.edge_switch(rr_id, iedge) == routing_arch->delayless_switch) {
-                        /* Do nothing */
-                    } else {
-                        switchbox_fanout++;
+                    /* Buffer Size */
+                    switch (rr_graph.rr_switch_inf(RRSwitchId(node_power->driver_switch_type)).power_buffer_type) {
+                        case POWER_BUFFER_TYPE_AUTO:
+                            /*
+                             * C_per_seg_split = ((float) node->num_edges
+                             * power_ctx.commonly_used->INV_1X_C_in + C_wire);
+                             * // / (float) power_ctx.arch->seg_buffer_split;
+                             * buffer_size = power_buffer_size_from_logical_effort(
+                             * C_per_seg_split);
+                             * buffer_size = std::max(buffer_size, 1.0F);
+                             */
+                            buffer_size = power_calc_buffer_size_from_Cout(rr_graph.rr_switch_inf(RRSwitchId(node_power->driver_switch_type)).Cout);
+                            break;
+                        case POWER_BUFFER_TYPE_ABSOLUTE_SIZE:
+                            buffer_size = rr_graph.rr_switch_inf(RRSwitchId(node_power->driver_switch_type)).power_buffer_size;
+                            buffer_size = std::max(buffer_size, 1.0F);
+                            break;
+                        case POWER_BUFFER_TYPE_NONE:
+                            buffer_size = 0.;
+                            break;
+                        default:
+                            buffer_size = 0.;
+                            VTR_ASSERT(0);
+                            break;
                     }
-                }
 
-                /* Buffer to next Switchbox */
-                if (switchbox_fanout) {
-                    buffer_size = power_buffer_size_from_logical_effort(switchbox_fanout * power_ctx.commonly_used->NMOS_1X_C_d);
+                    chunk_usage.num_sb_buffers++;
+                    chunk_usage.total_sb_buffer_size += buffer_size;
+
+                    /*
+                     * power_ctx.commonly_used->num_sb_buffers +=
+                     * power_ctx.arch->seg_buffer_split;
+                     * power_ctx.commonly_used->total_sb_buffer_size += buffer_size
+                     * power_ctx.arch->seg_buffer_split;
+                     */
+
+                    /* Buffer */
                     power_usage_buffer(&sub_power_usage, buffer_size,
-                                       1 - node_power->in_prob[node_power->selected_input],
-                                       node_power->in_dens[node_power->selected_input], false,
+                                       node_power->in_prob[node_power->selected_input],
+                                       node_power->in_dens[node_power->selected_input], true,
                                        power_ctx.solution_inf.T_crit);
-                    power_add_usage(power_usage, &sub_power_usage);
+                    power_add_usage(&chunk_usage.power_usage, &sub_power_usage);
                     power_component_add_usage(&sub_power_usage,
                                               POWER_COMPONENT_ROUTE_SB);
-                }
 
-                /* Driver for ConnectionBox */
-                if (connectionbox_fanout) {
-                    buffer_size = power_buffer_size_from_logical_effort(connectionbox_fanout * power_ctx.commonly_used->NMOS_1X_C_d);
-
-                    power_usage_buffer(&sub_power_usage, buffer_size,
-                                       1 - node_power->in_prob[node_power->selected_input],
-                                       node_power->in_dens[node_power->selected_input],
-                                       false, power_ctx.solution_inf.T_crit);
-                    power_add_usage(power_usage, &sub_power_usage);
+                    /* Wire Capacitance */
+                    power_usage_wire(&sub_power_usage, C_wire,
+                                     clb_net_density(node_power->net_num), power_ctx.solution_inf.T_crit);
+                    power_add_usage(&chunk_usage.power_usage, &sub_power_usage);
                     power_component_add_usage(&sub_power_usage,
-                                              POWER_COMPONENT_ROUTE_CB);
+                                              POWER_COMPONENT_ROUTE_GLB_WIRE);
+
+                    /* Determine types of switches that this wire drives */
+                    connectionbox_fanout = 0;
+                    switchbox_fanout = 0;
+                    for (t_edge_size iedge = 0; iedge < rr_graph.num_edges(rr_id); iedge++) {
+                        if (rr_graph.edge_switch(rr_id, iedge) == routing_arch->wire_to_rr_ipin_switch) {
+                            connectionbox_fanout++;
+                        } else if (rr_graph.edge_switch(rr_id, iedge) == routing_arch->delayless_switch) {
+                            /* Do nothing */
+                        } else {
+                            switchbox_fanout++;
+                        }
+                    }
+
+                    /* Buffer to next Switchbox */
+                    if (switchbox_fanout) {
+                        buffer_size = power_buffer_size_from_logical_effort(switchbox_fanout * power_ctx.commonly_used->NMOS_1X_C_d);
+                        power_usage_buffer(&sub_power_usage, buffer_size,
+                                           1 - node_power->in_prob[node_power->selected_input],
+                                           node_power->in_dens[node_power->selected_input], false,
+                                           power_ctx.solution_inf.T_crit);
+                        power_add_usage(&chunk_usage.power_usage, &sub_power_usage);
+                        power_component_add_usage(&sub_power_usage,
+                                                  POWER_COMPONENT_ROUTE_SB);
+                    }
+
+                    /* Driver for ConnectionBox */
+                    if (connectionbox_fanout) {
+                        buffer_size = power_buffer_size_from_logical_effort(connectionbox_fanout * power_ctx.commonly_used->NMOS_1X_C_d);
+
+                        power_usage_buffer(&sub_power_usage, buffer_size,
+                                           1 - node_power->in_prob[node_power->selected_input],
+                                           node_power->in_dens[node_power->selected_input],
+                                           false, power_ctx.solution_inf.T_crit);
+                        power_add_usage(&chunk_usage.power_usage, &sub_power_usage);
+                        power_component_add_usage(&sub_power_usage,
+                                                  POWER_COMPONENT_ROUTE_CB);
 
-                    power_ctx.commonly_used->num_cb_buffers++;
-                    power_ctx.commonly_used->total_cb_buffer_size += buffer_size;
+                        chunk_usage.num_cb_buffers++;
+                        chunk_usage.total_cb_buffer_size += buffer_size;
+                    }
+                    break;
                 }
-                break;
+                default:
+                    power_log_msg(POWER_LOG_WARNING,
+                                  "The global routing-resource graph contains an unknown node type.");
+                    break;
             }
-            default:
-                power_log_msg(POWER_LOG_WARNING,
-                              "The global routing-resource graph contains an unknown node type.");
-                break;
         }
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+
+    for (const t_power_chunk_usage& chunk_usage : chunk_usages) {
+        power_add_usage(power_usage, &chunk_usage.power_usage);
+        power_apply_shared_updates(chunk_usage.updates);
+
+        power_ctx.commonly_used->num_sb_buffers += chunk_usage.num_sb_buffers;
+        power_ctx.commonly_used->total_sb_buffer_size += chunk_usage.total_sb_buffer_size;
+        power_ctx.commonly_used->num_cb_buffers += chunk_usage.num_cb_buffers;
+        power_ctx.commonly_used->total_cb_buffer_size += chunk_usage.total_cb_buffer_size;
     }
 }
 
@@ -1302,6 +1441,23 @@ void power_routing_init(const t_det_routing_arch* routing_arch) {
     power_ctx.commonly_used->max_seg_fanout = max_seg_fanout;
 }
 
+/**
+ * Returns the artifact cache file of a power setup artifact, which depends
+ * only on the architecture and the CMOS technology file (or an empty string
+ * if the artifact cache is disabled)
+ */
+static std::string get_power_cache_file(const t_det_routing_arch* routing_arch,
+                                        const char* artifact,
+                                        const char* cmos_tech_behavior_filepath) {
+    if (routing_arch->artifact_cache_dir.empty()) {
+        return std::string();
+    }
+
+    ArtifactKey key(routing_arch->artifact_cache_dir, artifact, ".txt");
+    key.add("cmos_tech", vtr::secure_digest_file(cmos_tech_behavior_filepath));
+    return key.path();
+}
+
 /**
  * Initialization for all power-related functions
  */
@@ -1345,7 +1501,7 @@ bool power_init(const char* power_out_filepath,
     power_components_init();
 
     /* Perform callibration */
-    power_callibrate();
+    power_callibrate(get_power_cache_file(routing_arch, "power_callibration", cmos_tech_behavior_filepath));
 
     /* Initialize routing information */
     power_routing_init(routing_arch);
@@ -1354,7 +1510,7 @@ bool power_init(const char* power_out_filepath,
     power_pb_pins_init();
 
     /* Size all components */
-    power_sizing_init();
+    power_sizing_init(get_power_cache_file(routing_arch, "power_transistor_counts", cmos_tech_behavior_filepath));
 
     //power_print_spice_comparison();
     //	power_print_callibration();
@@ -21,9 +21,11 @@
 
 /************************* INCLUDES *********************************/
 #include <iostream>
+#include <fstream>
 
 #include "vtr_assert.h"
 #include "vtr_memory.h"
+#include "vtr_log.h"
 
 #include "power_callibrate.h"
 #include "power_components.h"
@@ -31,6 +33,7 @@
 #include "power_util.h"
 #include "power_cmos_tech.h"
 #include "globals.h"
+#include "artifact_cache.h"
 
 /************************* FUNCTION DECLARATIONS ********************/
 static char binary_not(char c);
@@ -402,15 +405,53 @@ float power_usage_ff_for_callibration(int num_inputs, float transistor_size) {
     return power_sum_usage(&power_usage);
 }
 
-void power_callibrate() {
-    /* Buffers and Mux must be done before LUT/FF */
+/* Restores the callibration of all components from cache_file.
+ * Returns false if any component does not match its cached data. */
+static bool power_read_callibration(const std::string& cache_file) {
+    auto& power_ctx = g_vpr_ctx.power();
+
+    std::ifstream is(cache_file);
+    for (int i = 0; i < POWER_CALLIB_COMPONENT_MAX; i++) {
+        if (!power_ctx.commonly_used->component_callibration[i]->read_callibration(is)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void power_write_callibration(const std::string& file) {
+    auto& power_ctx = g_vpr_ctx.power();
+
+    std::ofstream os(file);
+    for (int i = 0; i < POWER_CALLIB_COMPONENT_MAX; i++) {
+        power_ctx.commonly_used->component_callibration[i]->write_callibration(os);
+    }
+}
+
+/* Callibrates all components against their SPICE data points.
+ * If cache_file is not empty the callibration is loaded from, or
+ * stored to, the artifact cache. */
+void power_callibrate(const std::string& cache_file) {
     auto& power_ctx = g_vpr_ctx.power();
 
+    if (!cache_file.empty() && artifact_cache_contains(cache_file)) {
+        VTR_LOG("Loading power callibration from artifact cache '%s'\n", cache_file.c_str());
+        if (power_read_callibration(cache_file)) {
+            return;
+        }
+        VTR_LOG_WARN("Power callibration in artifact cache '%s' does not match the technology file, recomputing\n", cache_file.c_str());
+    }
+
+    /* Buffers and Mux must be done before LUT/FF */
     power_ctx.commonly_used->component_callibration[POWER_CALLIB_COMPONENT_BUFFER]->callibrate();
     power_ctx.commonly_used->component_callibration[POWER_CALLIB_COMPONENT_BUFFER_WITH_LEVR]->callibrate();
     power_ctx.commonly_used->component_callibration[POWER_CALLIB_COMPONENT_MUX]->callibrate();
     power_ctx.commonly_used->component_callibration[POWER_CALLIB_COMPONENT_LUT]->callibrate();
     power_ctx.commonly_used->component_callibration[POWER_CALLIB_COMPONENT_FF]->callibrate();
+
+    if (!cache_file.empty()) {
+        artifact_cache_store(cache_file, power_write_callibration);
+    }
 }
 
 void power_print_callibration() {
@@ -41,7 +41,7 @@ typedef enum {
 
 /************************* FUNCTION DECLARATIONS ********************/
 void power_print_spice_comparison();
-void power_callibrate();
+void power_callibrate(const std::string& cache_file);
 float power_usage_buf_for_callibration(int num_inputs, float transistor_size);
 float power_usage_buf_levr_for_callibration(int num_inputs,
                                             float transistor_size);
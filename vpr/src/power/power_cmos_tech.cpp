@@ -44,10 +44,11 @@
 #include "power_callibrate.h"
 
 /************************* FILE SCOPE **********************************/
-static t_transistor_inf* f_transistor_last_searched;
-static t_power_buffer_strength_inf* f_buffer_strength_last_searched;
-static t_power_mux_volt_inf* f_mux_volt_last_searched;
-static t_power_nmos_leakage_inf* f_power_searching_nmos_leakage_info;
+/* Thread local, since the power of blocks and routing may be estimated in parallel */
+static thread_local t_transistor_inf* f_transistor_last_searched;
+static thread_local t_power_buffer_strength_inf* f_buffer_strength_last_searched;
+static thread_local t_power_mux_volt_inf* f_mux_volt_last_searched;
+static thread_local t_power_nmos_leakage_inf* f_power_searching_nmos_leakage_info;
 
 /************************* FUNCTION DECLARATIONS ********************/
 
@@ -71,8 +71,8 @@ void power_components_uninit() {
 void power_component_add_usage(t_power_usage* power_usage,
                                e_power_component_type component_idx) {
     auto& power_ctx = g_vpr_ctx.power();
-    power_add_usage(&power_ctx.by_component.components[component_idx],
-                    power_usage);
+    power_add_shared_usage(&power_ctx.by_component.components[component_idx],
+                           power_usage);
 }
 
 /**
@@ -514,8 +514,8 @@ void power_usage_local_interc_mux(t_power_usage* power_usage, t_pb* pb, t_interc
             VTR_ASSERT(0);
     }
 
-    power_add_usage(&interc_pins->interconnect->interconnect_power->power_usage,
-                    power_usage);
+    power_add_shared_usage(&interc_pins->interconnect->interconnect_power->power_usage,
+                           power_usage);
 }
 
 /**
@@ -23,16 +23,44 @@
 /************************* INCLUDES *********************************/
 #include <cstring>
 #include <cmath>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
 
 #include "vtr_util.h"
 #include "vtr_assert.h"
 #include "vtr_memory.h"
+#include "vtr_log.h"
 
 #include "power_sizing.h"
 #include "power.h"
 #include "globals.h"
 #include "power_util.h"
 #include "vpr_utils.h"
+#include "artifact_cache.h"
+
+/************************ STRUCTS ***********************************/
+
+/* The transistor counts of a pb_graph_node, and of the
+ * interconnect of its modes */
+struct t_pb_node_transistor_cnts {
+    std::string pb_type_name;
+    int placement_index;
+    double interc;
+    double pb_children;
+    std::vector<double> interconnect;
+};
+
+/* The transistor counts of all sized pb_graph_nodes, in the order
+ * they are sized. While cached, the counts of the next node are
+ * restored rather than counted. */
+struct t_pb_transistor_cnts {
+    bool cached = false;
+    size_t next = 0;
+    std::vector<t_pb_node_transistor_cnts> nodes;
+};
+
 /************************ FILE SCOPE *********************************/
 static double f_MTA_area;
 
@@ -58,8 +86,17 @@ static void power_size_pin_buffers_and_wires(t_pb_graph_pin* pin,
                                              bool pin_is_an_input);
 static double power_transistors_for_pb_node(t_pb_graph_node* pb_node);
 static double power_transistors_per_tile();
-static void power_size_pb();
-static void power_size_pb_rec(t_pb_graph_node* pb_node);
+static void power_size_pb(t_pb_transistor_cnts& pb_cnts);
+static void power_size_pb_rec(t_pb_graph_node* pb_node,
+                              t_pb_transistor_cnts& pb_cnts);
+static void power_record_transistors_pb_node(t_pb_graph_node* pb_node,
+                                             t_pb_transistor_cnts& pb_cnts);
+static bool power_restore_transistors_pb_node(t_pb_graph_node* pb_node,
+                                              t_pb_transistor_cnts& pb_cnts);
+static bool power_read_transistor_cnts(const std::string& file,
+                                       std::vector<t_pb_node_transistor_cnts>& nodes);
+static void power_write_transistor_cnts(const std::string& file,
+                                        const std::vector<t_pb_node_transistor_cnts>& nodes);
 static void power_size_pin_to_interconnect(t_interconnect* interc,
                                            int* fanout,
                                            float* wirelength);
@@ -247,16 +284,44 @@ static double power_count_transistors_interc(t_interconnect* interc) {
     return transistor_cnt;
 }
 
-void power_sizing_init() {
+/**
+ * Sizes all components, and the tiles of the FPGA.
+ * If cache_file is not empty the transistor counts of the pb_graph_nodes
+ * are loaded from, or stored to, the artifact cache.
+ */
+void power_sizing_init(const std::string& cache_file) {
     float transistors_per_tile;
+    t_pb_transistor_cnts pb_cnts;
+    bool loaded = false;
 
     auto& power_ctx = g_vpr_ctx.power();
 
     // tech size = 2 lambda, so lambda^2/4.0 = tech^2
     f_MTA_area = ((POWER_MTA_L * POWER_MTA_W) / 4.0) * pow(power_ctx.tech->tech_size, (float)2.0);
 
+    if (!cache_file.empty() && artifact_cache_contains(cache_file)) {
+        VTR_LOG("Loading power transistor counts from artifact cache '%s'\n", cache_file.c_str());
+        loaded = power_read_transistor_cnts(cache_file, pb_cnts.nodes);
+        pb_cnts.cached = loaded;
+    }
+
     // Determines physical size of different PBs
-    power_size_pb();
+    power_size_pb(pb_cnts);
+
+    if (pb_cnts.cached && pb_cnts.next != pb_cnts.nodes.size()) {
+        /* Left over counts of nodes which no longer exist */
+        pb_cnts.cached = false;
+        pb_cnts.nodes.resize(pb_cnts.next);
+    }
+
+    if (!cache_file.empty() && !pb_cnts.cached) {
+        if (loaded) {
+            VTR_LOG_WARN("Power transistor counts in artifact cache '%s' do not match the architecture, recounted\n", cache_file.c_str());
+        }
+        artifact_cache_store(cache_file, [&](const std::string& file) {
+            power_write_transistor_cnts(file, pb_cnts.nodes);
+        });
+    }
 
     /* Find # of transistors in each tile type */
     transistors_per_tile = power_transistors_per_tile();
@@ -532,17 +597,18 @@ static double power_MTAs_L(float L_size) {
     return 1 + (L_size - 1) * (POWER_DRC_MIN_L / POWER_MTA_L);
 }
 
-static void power_size_pb() {
+static void power_size_pb(t_pb_transistor_cnts& pb_cnts) {
     auto& device_ctx = g_vpr_ctx.device();
 
     for (const auto& type : device_ctx.logical_block_types) {
         if (type.pb_graph_head) {
-            power_size_pb_rec(type.pb_graph_head);
+            power_size_pb_rec(type.pb_graph_head, pb_cnts);
         }
     }
 }
 
-static void power_size_pb_rec(t_pb_graph_node* pb_node) {
+static void power_size_pb_rec(t_pb_graph_node* pb_node,
+                              t_pb_transistor_cnts& pb_cnts) {
     int port_idx, pin_idx;
     int mode_idx, type_idx, pb_idx;
     bool size_buffers_and_wires = true;
@@ -568,13 +634,16 @@ static void power_size_pb_rec(t_pb_graph_node* pb_node) {
             int num_pb = mode->pb_type_children[type_idx].num_pb;
 
             for (pb_idx = 0; pb_idx < num_pb; pb_idx++) {
-                power_size_pb_rec(&pb_node->child_pb_graph_nodes[mode_idx][type_idx][pb_idx]);
+                power_size_pb_rec(&pb_node->child_pb_graph_nodes[mode_idx][type_idx][pb_idx], pb_cnts);
             }
         }
     }
 
     /* Determine # of transistors for this node */
-    power_count_transistors_pb_node(pb_node);
+    if (!power_restore_transistors_pb_node(pb_node, pb_cnts)) {
+        power_count_transistors_pb_node(pb_node);
+        power_record_transistors_pb_node(pb_node, pb_cnts);
+    }
 
     if (pb_node->pb_type->class_type == LUT_CLASS) {
         /* LUTs will have a child node that is used for routing purposes
@@ -613,6 +682,121 @@ static void power_size_pb_rec(t_pb_graph_node* pb_node) {
     }
 }
 
+/* Records the transistor counts of pb_node (and its interconnect) as the next sized node */
+static void power_record_transistors_pb_node(t_pb_graph_node* pb_node,
+                                             t_pb_transistor_cnts& pb_cnts) {
+    t_pb_type* pb_type = pb_node->pb_type;
+    t_pb_node_transistor_cnts node_cnts;
+
+    node_cnts.pb_type_name = pb_type->name;
+    node_cnts.placement_index = pb_node->placement_index;
+    node_cnts.interc = pb_node->pb_node_power->transistor_cnt_interc;
+    node_cnts.pb_children = pb_node->pb_node_power->transistor_cnt_pb_children;
+
+    /* The interconnect of LUTs is not counted (see power_count_transistors_pb_node) */
+    if (pb_type->class_type != LUT_CLASS) {
+        for (int mode_idx = 0; mode_idx < pb_type->num_modes; mode_idx++) {
+            t_mode* mode = &pb_type->modes[mode_idx];
+            for (int interc = 0; interc < mode->num_interconnect; interc++) {
+                node_cnts.interconnect.push_back(mode->interconnect[interc].interconnect_power->transistor_cnt);
+            }
+        }
+    }
+
+    pb_cnts.nodes.push_back(node_cnts);
+    pb_cnts.next = pb_cnts.nodes.size();
+}
+
+/* Restores the cached transistor counts of pb_node (and its interconnect).
+ * Returns false if they are not cached, in which case the counts of pb_node
+ * and all later nodes are to be counted. */
+static bool power_restore_transistors_pb_node(t_pb_graph_node* pb_node,
+                                              t_pb_transistor_cnts& pb_cnts) {
+    t_pb_type* pb_type = pb_node->pb_type;
+
+    if (!pb_cnts.cached) {
+        return false;
+    }
+
+    size_t num_interconnect = 0;
+    if (pb_type->class_type != LUT_CLASS) {
+        for (int mode_idx = 0; mode_idx < pb_type->num_modes; mode_idx++) {
+            num_interconnect += pb_type->modes[mode_idx].num_interconnect;
+        }
+    }
+
+    if (pb_cnts.next >= pb_cnts.nodes.size()
+        || pb_cnts.nodes[pb_cnts.next].pb_type_name != pb_type->name
+        || pb_cnts.nodes[pb_cnts.next].placement_index != pb_node->placement_index
+        || pb_cnts.nodes[pb_cnts.next].interconnect.size() != num_interconnect) {
+        /* Stale cache, keep the counts of the nodes restored so far */
+        pb_cnts.cached = false;
+        pb_cnts.nodes.resize(pb_cnts.next);
+        return false;
+    }
+
+    const t_pb_node_transistor_cnts& node_cnts = pb_cnts.nodes[pb_cnts.next];
+    pb_node->pb_node_power->transistor_cnt_interc = node_cnts.interc;
+    pb_node->pb_node_power->transistor_cnt_pb_children = node_cnts.pb_children;
+
+    size_t interc_idx = 0;
+    if (pb_type->class_type != LUT_CLASS) {
+        for (int mode_idx = 0; mode_idx < pb_type->num_modes; mode_idx++) {
+            t_mode* mode = &pb_type->modes[mode_idx];
+            for (int interc = 0; interc < mode->num_interconnect; interc++) {
+                mode->interconnect[interc].interconnect_power->transistor_cnt = node_cnts.interconnect[interc_idx++];
+            }
+        }
+    }
+
+    pb_cnts.next++;
+    return true;
+}
+
+static bool power_read_transistor_cnts(const std::string& file,
+                                       std::vector<t_pb_node_transistor_cnts>& nodes) {
+    std::ifstream is(file);
+    size_t num_nodes;
+
+    if (!(is >> num_nodes)) {
+        return false;
+    }
+
+    nodes.resize(num_nodes);
+    for (t_pb_node_transistor_cnts& node_cnts : nodes) {
+        size_t num_interconnect;
+        if (!(is >> node_cnts.pb_type_name >> node_cnts.placement_index
+              >> node_cnts.interc >> node_cnts.pb_children >> num_interconnect)) {
+            return false;
+        }
+
+        node_cnts.interconnect.resize(num_interconnect);
+        for (double& transistor_cnt : node_cnts.interconnect) {
+            if (!(is >> transistor_cnt)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void power_write_transistor_cnts(const std::string& file,
+                                        const std::vector<t_pb_node_transistor_cnts>& nodes) {
+    std::ofstream os(file);
+    os.precision(std::numeric_limits<double>::max_digits10);
+
+    os << nodes.size() << "\n";
+    for (const t_pb_node_transistor_cnts& node_cnts : nodes) {
+        os << node_cnts.pb_type_name << " " << node_cnts.placement_index << " "
+           << node_cnts.interc << " " << node_cnts.pb_children << " "
+           << node_cnts.interconnect.size();
+        for (double transistor_cnt : node_cnts.interconnect) {
+            os << " " << transistor_cnt;
+        }
+        os << "\n";
+    }
+}
+
 /* Provides statistics about the connection between the pin and interconnect */
 static void power_size_pin_to_interconnect(t_interconnect* interc,
                                            int* fanout,
@@ -24,6 +24,8 @@
 #define __POWER_TRANSISTOR_CNT_H__
 
 /************************* INCLUDES *********************************/
+#include <string>
+
 #include "physical_types.h"
 
 /************************* DEFINES **********************************/
@@ -39,7 +41,7 @@
 #define POWER_MTA_L (POWER_DRC_MIN_L + 2 * POWER_DRC_MIN_DIFF_L + POWER_DRC_SPACING)
 
 /************************* FUNCTION DECLARATION *********************/
-void power_sizing_init();
+void power_sizing_init(const std::string& cache_file);
 double power_count_transistors_buffer(float buffer_size);
 double power_transistor_area(double num_transistors);
 #endif
@@ -33,6 +33,8 @@
 #include "atom_netlist_utils.h"
 
 /************************* GLOBALS **********************************/
+/* Where the shared power updates of this thread are recorded, if anywhere (see PowerSharedUpdatesRecorder) */
+static thread_local t_power_shared_updates* f_shared_updates = nullptr;
 
 /************************* FUNCTION DECLARATIONS*********************/
 static void log_msg(t_log* log_ptr, const char* msg);
@@ -59,6 +61,46 @@ void power_scale_usage(t_power_usage* power_usage, float scale_factor) {
     power_usage->leakage *= scale_factor;
 }
 
+/**
+ * Adds src to an accumulator shared by the whole design (e.g. the power of a pb_type),
+ * or records the addition if a PowerSharedUpdatesRecorder is active on this thread.
+ */
+void power_add_shared_usage(t_power_usage* dest, const t_power_usage* src) {
+    if (!f_shared_updates) {
+        power_add_usage(dest, src);
+        return;
+    }
+
+    auto result = f_shared_updates->usage_index.emplace(dest, f_shared_updates->usages.size());
+    if (result.second) {
+        f_shared_updates->usages.emplace_back(dest, *src);
+    } else {
+        power_add_usage(&f_shared_updates->usages[result.first->second].second, src);
+    }
+}
+
+/**
+ * Applies recorded shared power updates (or records them again, if a
+ * PowerSharedUpdatesRecorder is active on this thread)
+ */
+void power_apply_shared_updates(const t_power_shared_updates& updates) {
+    for (const auto& usage : updates.usages) {
+        power_add_shared_usage(usage.first, &usage.second);
+    }
+    for (const auto& log : updates.logs) {
+        power_log_msg(log.first, log.second.c_str());
+    }
+}
+
+PowerSharedUpdatesRecorder::PowerSharedUpdatesRecorder(t_power_shared_updates& updates)
+    : prev_updates_(f_shared_updates) {
+    f_shared_updates = &updates;
+}
+
+PowerSharedUpdatesRecorder::~PowerSharedUpdatesRecorder() {
+    f_shared_updates = prev_updates_;
+}
+
 float power_sum_usage(t_power_usage* power_usage) {
     return power_usage->dynamic + power_usage->leakage;
 }
@@ -68,6 +110,11 @@ float power_perc_dynamic(t_power_usage* power_usage) {
 }
 
 void power_log_msg(e_power_log_type log_type, const char* msg) {
+    if (f_shared_updates) {
+        f_shared_updates->logs.emplace_back(log_type, msg);
+        return;
+    }
+
     auto& power_ctx = g_vpr_ctx.power();
     log_msg(&power_ctx.output->logs[log_type], msg);
 }
@@ -86,12 +133,13 @@ float pin_dens(t_pb* pb, t_pb_graph_pin* pin, ClusterBlockId iblk) {
     float density = 0.;
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& power_ctx = g_vpr_ctx.mutable_power();
+    auto& power_ctx = g_vpr_ctx.power();
 
     if (pb) {
         if (cluster_ctx.clb_nlist.block_pb(iblk)->pb_route.count(pin->pin_count_in_cluster)) {
             AtomNetId net_id = cluster_ctx.clb_nlist.block_pb(iblk)->pb_route[pin->pin_count_in_cluster].atom_net_id;
-            density = power_ctx.atom_net_power[net_id].density;
+            auto net_power = power_ctx.atom_net_power.find(net_id);
+            density = (net_power != power_ctx.atom_net_power.end()) ? net_power->second.density : 0.;
         }
     }
 
@@ -103,12 +151,13 @@ float pin_prob(t_pb* pb, t_pb_graph_pin* pin, ClusterBlockId iblk) {
     float prob = 1.;
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& power_ctx = g_vpr_ctx.mutable_power();
+    auto& power_ctx = g_vpr_ctx.power();
 
     if (pb) {
         if (cluster_ctx.clb_nlist.block_pb(iblk)->pb_route.count(pin->pin_count_in_cluster)) {
             AtomNetId net_id = cluster_ctx.clb_nlist.block_pb(iblk)->pb_route[pin->pin_count_in_cluster].atom_net_id;
-            prob = power_ctx.atom_net_power[net_id].probability;
+            auto net_power = power_ctx.atom_net_power.find(net_id);
+            prob = (net_power != power_ctx.atom_net_power.end()) ? net_power->second.probability : 0.;
         }
     }
 
@@ -23,11 +23,50 @@
 #define __POWER_UTIL_H__
 
 /************************* INCLUDES *********************************/
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "power.h"
 #include "power_components.h"
 #include "atom_netlist.h"
 #include "clustered_netlist.h"
 
+/************************* STRUCTS **********************************/
+
+/**
+ * Updates to the power state shared by the whole design (the power breakdown by
+ * component, the power of each pb_type, mode and interconnect, and the power logs),
+ * deferred so they can be applied later with power_apply_shared_updates().
+ *
+ * While a PowerSharedUpdatesRecorder is alive, the updates made by the calling thread
+ * are recorded instead of applied. This lets independent parts of the design be
+ * estimated in parallel (and their updates applied in a deterministic order), and
+ * lets the updates of a memoized estimate be replayed.
+ */
+struct t_power_shared_updates {
+    ///@brief Usage added to each shared accumulator, in order of the first addition
+    std::vector<std::pair<t_power_usage*, t_power_usage>> usages;
+    std::unordered_map<t_power_usage*, size_t> usage_index;
+
+    ///@brief Messages logged, in order
+    std::vector<std::pair<e_power_log_type, std::string>> logs;
+};
+
+///@brief Records the shared power updates of the calling thread into updates during its lifetime
+class PowerSharedUpdatesRecorder {
+  public:
+    PowerSharedUpdatesRecorder(t_power_shared_updates& updates);
+    ~PowerSharedUpdatesRecorder();
+
+    PowerSharedUpdatesRecorder(const PowerSharedUpdatesRecorder&) = delete;
+    PowerSharedUpdatesRecorder& operator=(const PowerSharedUpdatesRecorder&) = delete;
+
+  private:
+    t_power_shared_updates* prev_updates_;
+};
+
 /************************* FUNCTION DECLARATIONS ********************/
 
 /* Pins */
@@ -42,6 +81,8 @@ void pb_foreach_pin(t_pb_graph_node* pb_node,
 void power_zero_usage(t_power_usage* power_usage);
 void power_add_usage(t_power_usage* dest, const t_power_usage* src);
 void power_scale_usage(t_power_usage* power_usage, float scale_factor);
+void power_add_shared_usage(t_power_usage* dest, const t_power_usage* src);
+void power_apply_shared_updates(const t_power_shared_updates& updates);
 float power_sum_usage(t_power_usage* power_usage);
 float power_perc_dynamic(t_power_usage* power_usage);
 
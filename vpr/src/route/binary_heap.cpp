@@ -50,6 +50,32 @@ void BinaryHeap::add_to_heap(t_heap* hptr) {
     }
 }
 
+// Heapifying the whole heap is O(n + k), k sift ups are O(k lg n): the batch
+// is appended and heapified once it is at least as large as the heap.
+void BinaryHeap::add_batch_to_heap(t_heap* const* hptrs, size_t num_items) {
+    if (num_items >= size()) {
+        for (size_t i = 0; i < num_items; ++i) {
+            expand_heap_if_full();
+            heap_[heap_tail_] = hptrs[i];
+            ++heap_tail_;
+        }
+        check_prune_limit();
+        build_heap();
+        return;
+    }
+
+    for (size_t i = 0; i < num_items; ++i) {
+        expand_heap_if_full();
+        ++heap_tail_;
+        sift_up(heap_tail_ - 1, hptrs[i]);
+    }
+
+    // If we have pruned, rebuild the heap now.
+    if (check_prune_limit()) {
+        build_heap();
+    }
+}
+
 bool BinaryHeap::is_empty_heap() const {
     return (bool)(heap_tail_ == 1);
 }
@@ -181,6 +207,18 @@ void BinaryHeap::free_all_memory() {
     storage_.free_all_memory();
 }
 
+void BinaryHeap::reset_item_pool() {
+    storage_.reset();
+}
+
+size_t BinaryHeap::item_high_water_mark() const {
+    return storage_.high_water_mark();
+}
+
+size_t BinaryHeap::item_pool_size() const {
+    return storage_.pool_size();
+}
+
 bool BinaryHeap::check_prune_limit() {
     if (heap_tail_ > prune_limit_) {
         prune_heap();
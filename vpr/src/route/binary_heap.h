@@ -14,6 +14,7 @@ class BinaryHeap : public HeapInterface {
 
     void init_heap(const DeviceGrid& grid) final;
     void add_to_heap(t_heap* hptr) final;
+    void add_batch_to_heap(t_heap* const* hptrs, size_t num_items) final;
     void push_back(t_heap* const hptr) final;
     bool is_empty_heap() const final;
     bool is_valid() const final;
@@ -24,6 +25,15 @@ class BinaryHeap : public HeapInterface {
 
     void free_all_memory() final;
 
+    void reset_item_pool() final;
+    size_t item_high_water_mark() const final;
+    size_t item_pool_size() const final;
+
+    // Item costs do not affect the heap layout: nothing to tune or rescale.
+    void set_cost_scale_hint(float /*cost_scale*/) final {}
+    size_t num_rescales() const final { return 0; }
+    size_t num_expansions() const final { return 0; }
+
   private:
     size_t size() const;
     void sift_up(size_t leaf, t_heap* const node);
@@ -13,6 +13,11 @@
  *  bucket index = cost * conv_factor_
  *
  * The default conv_factor_ is 1e12, e.g. each bucket is 1 picosecond wide.
+ * If the cost scale (typical largest cost) of the path searches is known
+ * (set_cost_scale_hint, sampled from the router lookahead), each search
+ * instead starts with kInitialDivisionScaling buckets below that cost, which
+ * avoids most of the rescaling when the costs are far from picoseconds (e.g.
+ * congested iterations).
  *
  * There two reasons to change conv_factor_:
  *  - The maximum cost item in the bucket would require too many buckets in
@@ -86,8 +91,12 @@ static constexpr ssize_t kMaxMaxBuckets = 16000000;
 BucketItems::BucketItems() noexcept
     : alloced_items_(0)
     , num_heap_allocated_(0)
+    , max_heap_allocated_(0)
     , heap_free_head_(nullptr) {}
 
+BucketItems::BucketItems(const BucketItems& /*other*/) noexcept
+    : BucketItems() {}
+
 Bucket::Bucket() noexcept
     : outstanding_items_(0)
     , seed_(1231)
@@ -96,6 +105,7 @@ Bucket::Bucket() noexcept
     , heap_head_(std::numeric_limits<size_t>::max())
     , heap_tail_(0)
     , conv_factor_(0.f)
+    , initial_conv_factor_(kDefaultConvFactor)
     , division_scaling_(kInitialDivisionScaling)
     , max_buckets_(kInitialMaxBuckets)
     , min_cost_(0.f)
@@ -104,7 +114,9 @@ Bucket::Bucket() noexcept
     , max_index_(std::numeric_limits<size_t>::max())
     , prune_limit_(std::numeric_limits<size_t>::max())
     , prune_count_(0)
-    , front_head_(std::numeric_limits<size_t>::max()) {}
+    , front_head_(std::numeric_limits<size_t>::max())
+    , num_rescales_(0)
+    , num_expansions_(0) {}
 
 Bucket::~Bucket() {
     free_all_memory();
@@ -126,7 +138,7 @@ void Bucket::init_heap(const DeviceGrid& grid) {
     num_items_ = 0;
     prune_count_ = 0;
 
-    conv_factor_ = kDefaultConvFactor;
+    conv_factor_ = initial_conv_factor_;
     division_scaling_ = kInitialDivisionScaling;
     max_buckets_ = kInitialMaxBuckets;
 
@@ -134,6 +146,19 @@ void Bucket::init_heap(const DeviceGrid& grid) {
     max_cost_ = std::numeric_limits<float>::min();
 }
 
+void Bucket::set_cost_scale_hint(float cost_scale) {
+    // Costs up to kInitialMaxBuckets / kInitialDivisionScaling (i.e. 20) times
+    // the hint then fit without rescaling
+    if (cost_scale > 0.f && std::isfinite(cost_scale)) {
+        initial_conv_factor_ = kInitialDivisionScaling / cost_scale;
+    } else {
+        initial_conv_factor_ = kDefaultConvFactor;
+    }
+    if (heap_head_ == std::numeric_limits<size_t>::max()) {
+        conv_factor_ = initial_conv_factor_;
+    }
+}
+
 void Bucket::free_all_memory() {
     delete[] heap_;
     heap_ = nullptr;
@@ -142,6 +167,7 @@ void Bucket::free_all_memory() {
 }
 
 void Bucket::expand(size_t required_number_of_buckets) {
+    num_expansions_ += 1;
     auto old_size = heap_size_;
     heap_size_ = required_number_of_buckets * 2;
     size_t i;
@@ -186,7 +212,7 @@ void Bucket::empty_heap() {
     // Quickly reset all items to being free'd
     items_.clear();
 
-    conv_factor_ = kDefaultConvFactor;
+    conv_factor_ = initial_conv_factor_;
     division_scaling_ = kInitialDivisionScaling;
     max_buckets_ = kInitialMaxBuckets;
 
@@ -239,6 +265,7 @@ void Bucket::check_scaling() {
 }
 
 void Bucket::rescale() {
+    num_rescales_ += 1;
     conv_factor_ = rescale_func();
     check_conv_factor();
     front_head_ = std::numeric_limits<size_t>::max();
@@ -503,6 +530,7 @@ void Bucket::prune_heap() {
     }
 
     // Rescale heap after pruning.
+    num_rescales_ += 1;
     conv_factor_ = rescale_func();
     check_conv_factor();
 
@@ -5,6 +5,7 @@
 
 #include "heap_type.h"
 #include "vtr_log.h"
+#include "vtr_object_pool.h"
 
 struct BucketItem {
     t_heap item;
@@ -17,7 +18,7 @@ struct BucketItem {
 // pool and a free list.
 //
 // The object pool maintained in heap_items_.  Whenever a new object is
-// created from the chunk allocator heap_ch_ it is added to heap_items_.
+// created from the object pool heap_pool_ it is added to heap_items_.
 //
 // When a client of BucketItems requests an objet, BucketItems first checks
 // if there are any objects in the object pool that have not been allocated
@@ -26,7 +27,7 @@ struct BucketItem {
 //
 // Once all objects from the object pool have been released, future allocations
 // come from the free list (maintained in heap_free_head_).  When the free list
-// is empty, only then is a new item allocated from the chunk allocator.
+// is empty, only then is a new item allocated from the object pool.
 //
 // BucketItems::clear provides a fast way to reset the object pool under the
 // assumption that no live references exists.  It does this by mark the free
@@ -44,6 +45,11 @@ class BucketItems {
   public:
     BucketItems() noexcept;
 
+    // Constructs an empty set of items: the items of other are owned by its
+    // pool, so they are not shared with (or free'd by) the copy.
+    BucketItems(const BucketItems& other) noexcept;
+    BucketItems& operator=(const BucketItems&) = delete;
+
     // Returns all allocated items to be available for allocation.
     //
     // This operation is only safe if all outstanding references are discarded.
@@ -69,12 +75,12 @@ class BucketItems {
     void free() {
         // Free each individual heap item.
         for (auto* item : heap_items_) {
-            vtr::chunk_delete(item, &heap_ch_);
+            heap_pool_.destroy(item);
         }
         heap_items_.clear();
 
-        /*free the memory chunks that were used by heap and linked f pointer */
-        free_chunk_memory(&heap_ch_);
+        /*free the storage that was used by the heap items */
+        heap_pool_.clear();
     }
 
     // Allocate an item.  This may cause a dynamic allocation if no previously
@@ -86,7 +92,7 @@ class BucketItems {
             temp_ptr = heap_items_[alloced_items_++];
         } else {
             if (heap_free_head_ == nullptr) { /* No elements on the free list */
-                heap_free_head_ = vtr::chunk_new<BucketItem>(&heap_ch_);
+                heap_free_head_ = heap_pool_.create();
                 heap_free_head_->next_bucket = nullptr;
                 heap_items_.push_back(heap_free_head_);
                 alloced_items_ += 1;
@@ -97,6 +103,9 @@ class BucketItems {
         }
 
         num_heap_allocated_++;
+        if (num_heap_allocated_ > max_heap_allocated_) {
+            max_heap_allocated_ = num_heap_allocated_;
+        }
 
         return temp_ptr;
     }
@@ -113,6 +122,21 @@ class BucketItems {
         return num_heap_allocated_;
     }
 
+    // Peak number of outstanding allocations since the last
+    // reset_high_water_mark.  Unlike the allocation count, this survives
+    // clear.
+    int max_heap_allocated() const {
+        return max_heap_allocated_;
+    }
+    void reset_high_water_mark() {
+        max_heap_allocated_ = num_heap_allocated_;
+    }
+
+    // Number of items in the object pool.
+    size_t pool_size() const {
+        return heap_items_.size();
+    }
+
   private:
     /* Vector of all items ever allocated. Used for full item iteration and
      * for reuse after a `clear` invocation. */
@@ -124,11 +148,14 @@ class BucketItems {
     /* Number of outstanding allocated items. */
     int num_heap_allocated_;
 
+    /* Peak of num_heap_allocated_ since the last reset_high_water_mark. */
+    int max_heap_allocated_;
+
     /* For managing my own list of currently free heap data structures. */
     BucketItem* heap_free_head_;
 
-    /* For keeping track of the sudo malloc memory for the heap*/
-    vtr::t_chunk heap_ch_;
+    /* Storage of the heap items */
+    vtr::ObjectPool<BucketItem> heap_pool_;
 };
 
 // Prority queue approximation using cost buckets and randomization.
@@ -194,11 +221,43 @@ class Bucket : public HeapInterface {
         push_back(hptr);
     }
 
+    void add_batch_to_heap(t_heap* const* hptrs, size_t num_items) final {
+        for (size_t i = 0; i < num_items; ++i) {
+            push_back(hptrs[i]);
+        }
+    }
+
     void build_heap() final {
     }
 
     void set_prune_limit(size_t max_index, size_t prune_limit) final;
 
+    // Items are already returned to the pool by empty_heap, so this only
+    // restarts the high-water mark.
+    void reset_item_pool() final {
+        VTR_ASSERT(outstanding_items_ == 0);
+        items_.reset_high_water_mark();
+        num_rescales_ = 0;
+        num_expansions_ = 0;
+    }
+    size_t item_high_water_mark() const final {
+        return items_.max_heap_allocated();
+    }
+    size_t item_pool_size() const final {
+        return items_.pool_size();
+    }
+
+    // Each search starts with a conversion factor fitting kInitialDivisionScaling
+    // buckets below cost_scale, rather than with kDefaultConvFactor.
+    void set_cost_scale_hint(float cost_scale) final;
+
+    size_t num_rescales() const final {
+        return num_rescales_;
+    }
+    size_t num_expansions() const final {
+        return num_expansions_;
+    }
+
     // Pop an item from the cheapest non-empty bucket.
     //
     // Returns nullptr if empty.
@@ -269,6 +328,10 @@ class Bucket : public HeapInterface {
                               * bucket index = cost * conv_factor_
                               *
                               */
+    float initial_conv_factor_; /* conv_factor_ at the start of each search:
+                                 * kDefaultConvFactor, or derived from the
+                                 * cost scale hint.
+                                 */
     float division_scaling_; /* Scaling factor used during rescaling.
                               * Larger division scaling results in larger
                               * conversion factor.
@@ -302,6 +365,9 @@ class Bucket : public HeapInterface {
      * */
     size_t front_head_;
     std::vector<BucketItem*> front_list_;
+
+    size_t num_rescales_;   /* Rescales since the last reset_item_pool */
+    size_t num_expansions_; /* Expansions since the last reset_item_pool */
 };
 
 #endif /* _BUCKET_H */
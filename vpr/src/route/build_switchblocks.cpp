@@ -134,6 +134,7 @@
 #include "vtr_memory.h"
 #include "vtr_log.h"
 #include "vtr_string_view.h"
+#include "vtr_hash.h"
 
 #include "vpr_error.h"
 
@@ -142,6 +143,11 @@
 #include "parse_switchblocks.h"
 #include "vtr_expr_eval.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#    include <tbb/enumerable_thread_specific.h>
+#endif
+
 using vtr::FormulaParser;
 using vtr::t_formula_data;
 
@@ -180,9 +186,33 @@ struct t_wire_switchpoint {
     int switchpoint; //Switchpoint of the wire
 };
 
+/* a switchblock formula (owned by its switchblock) and the values of its two variables */
+struct t_formula_key {
+    const std::string* formula;
+    int var1;
+    int var2;
+
+    bool operator==(const t_formula_key& other) const {
+        return formula == other.formula && var1 == other.var1 && var2 == other.var2;
+    }
+};
+
+struct t_hash_formula_key {
+    size_t operator()(const t_formula_key& key) const noexcept {
+        size_t result = std::hash<const std::string*>()(key.formula);
+        vtr::hash_combine(result, key.var1);
+        vtr::hash_combine(result, key.var2);
+        return result;
+    }
+};
+
 struct t_wireconn_scratchpad {
     FormulaParser formula_parser;
     t_formula_data formula_data;
+    /* The results of the formulas evaluated so far. The formulas only depend on the sizes of the
+     * wire sets (and the index of the source wire), not on the location, so they are the same at
+     * most switch blocks. */
+    std::unordered_map<t_formula_key, int, t_hash_formula_key> formula_results;
     std::vector<t_wire_switchpoint> potential_src_wires;
     std::vector<t_wire_switchpoint> potential_dest_wires;
     std::vector<t_wire_switchpoint> scratch_wires;
@@ -235,7 +265,15 @@ static void compute_wireconn_connections(
     vtr::RandState& rand_state,
     t_wireconn_scratchpad* scratchpad);
 
-static int evaluate_num_conns_formula(t_wireconn_scratchpad* scratchpad, std::string num_conns_formula, int from_wire_count, int to_wire_count);
+static int evaluate_num_conns_formula(t_wireconn_scratchpad* scratchpad, const std::string& num_conns_formula, int from_wire_count, int to_wire_count);
+
+/* Returns the result of the permutation function 'permutation' for the source wire src_wire_ind
+ * and a destination set of dest_W wires */
+static int evaluate_permutation_formula(t_wireconn_scratchpad* scratchpad, const std::string& permutation, int dest_W, int src_wire_ind);
+
+/* Returns true if the connections of the switchblock depend on rand_state, i.e. can only be computed
+ * serially (in a fixed order of locations) */
+static bool is_switchblock_random(const t_switchblock_inf& sb);
 
 /* returns the wire indices belonging to the types in 'wire_type_vec' and switchpoints in 'points' at the given channel segment */
 static void get_switchpoint_wires(
@@ -292,7 +330,11 @@ t_sb_connection_map* alloc_and_load_switchblock_permutations(const t_chan_detail
                                                              e_directionality directionality,
                                                              vtr::RandState& rand_state) {
     /* Holds temporary memory for parsing. */
+#ifdef VPR_USE_TBB
+    tbb::enumerable_thread_specific<t_wireconn_scratchpad> scratchpads;
+#else
     t_wireconn_scratchpad scratchpad;
+#endif
 
     t_sb_connection_map* sb_conns = new t_sb_connection_map;
 
@@ -318,16 +360,18 @@ t_sb_connection_map* alloc_and_load_switchblock_permutations(const t_chan_detail
     /******** slow switch block computation method; computes switchblocks at each coordinate ********/
     /* iterate over all the switchblocks specified in the architecture */
     for (int i_sb = 0; i_sb < (int)switchblocks.size(); i_sb++) {
-        t_switchblock_inf sb = switchblocks[i_sb];
+        /* the formulas are memoized by their address, so they are used in place */
+        t_switchblock_inf* sb = &switchblocks[i_sb];
 
         /* verify that switchblock type matches specified directionality -- currently we have to stay consistent */
-        if (directionality != sb.directionality) {
-            VPR_FATAL_ERROR(VPR_ERROR_ARCH, "alloc_and_load_switchblock_connections: Switchblock %s does not match directionality of architecture\n", sb.name.c_str());
+        if (directionality != sb->directionality) {
+            VPR_FATAL_ERROR(VPR_ERROR_ARCH, "alloc_and_load_switchblock_connections: Switchblock %s does not match directionality of architecture\n", sb->name.c_str());
         }
-        /* Iterate over the x,y coordinates spanning the FPGA. */
-        for (size_t x_coord = 0; x_coord < grid.width(); x_coord++) {
+
+        /* Computes the connections of the switch blocks in column x_coord into column_sb_conns */
+        auto compute_column_connections = [&](size_t x_coord, t_sb_connection_map* column_sb_conns, t_wireconn_scratchpad* column_scratchpad) {
             for (size_t y_coord = 0; y_coord <= grid.height(); y_coord++) {
-                if (sb_not_here(grid, x_coord, y_coord, sb.location)) {
+                if (sb_not_here(grid, x_coord, y_coord, sb->location)) {
                     continue;
                 }
                 /* now we iterate over all the potential side1->side2 connections */
@@ -336,11 +380,35 @@ t_sb_connection_map* alloc_and_load_switchblock_permutations(const t_chan_detail
                         /* Fill appropriate entry of the sb_conns map with vector specifying the wires
                          * the current wire will connect to */
                         compute_wire_connections(x_coord, y_coord, from_side, to_side,
-                                                 chan_details_x, chan_details_y, &sb, grid,
-                                                 &wire_type_sizes_x, &wire_type_sizes_y, directionality, sb_conns, rand_state, &scratchpad);
+                                                 chan_details_x, chan_details_y, sb, grid,
+                                                 &wire_type_sizes_x, &wire_type_sizes_y, directionality, column_sb_conns, rand_state, column_scratchpad);
                     }
                 }
             }
+        };
+
+        /* Iterate over the x,y coordinates spanning the FPGA. */
+#ifdef VPR_USE_TBB
+        if (!is_switchblock_random(*sb)) {
+            /* The connections of each switch block only use its own sb_conns entries, so the columns
+             * are computed in parallel and then added in column order (as if computed serially) */
+            std::vector<t_sb_connection_map> column_sb_conns(grid.width());
+            tbb::parallel_for(size_t(0), grid.width(), [&](size_t x_coord) {
+                compute_column_connections(x_coord, &column_sb_conns[x_coord], &scratchpads.local());
+            });
+
+            for (t_sb_connection_map& column_conns : column_sb_conns) {
+                for (auto& conns : column_conns) {
+                    std::vector<t_switchblock_edge>& edges = (*sb_conns)[conns.first];
+                    edges.insert(edges.end(), conns.second.begin(), conns.second.end());
+                }
+            }
+            continue;
+        }
+        t_wireconn_scratchpad& scratchpad = scratchpads.local();
+#endif
+        for (size_t x_coord = 0; x_coord < grid.width(); x_coord++) {
+            compute_column_connections(x_coord, sb_conns, &scratchpad);
         }
     }
 
@@ -362,6 +430,16 @@ void free_switchblock_permutations(t_sb_connection_map* sb_conns) {
 }
 
 /* returns true if the coordinates x/y do not correspond to the location specified by 'location' */
+static bool is_switchblock_random(const t_switchblock_inf& sb) {
+    for (const t_wireconn_inf& wireconn : sb.wireconns) {
+        if (wireconn.from_switchpoint_order == SwitchPointOrder::SHUFFLED
+            || wireconn.to_switchpoint_order == SwitchPointOrder::SHUFFLED) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static bool sb_not_here(const DeviceGrid& grid, int x, int y, e_sb_location location) {
     bool sb_not_here = true;
 
@@ -739,11 +817,7 @@ static void compute_wireconn_connections(
         const std::vector<std::string>& permutations_ref = iter->second;
         for (int iperm = 0; iperm < (int)permutations_ref.size(); iperm++) {
             /* Convert the symbolic permutation formula to a number */
-            t_formula_data& formula_data = scratchpad->formula_data;
-            formula_data.clear();
-            formula_data.set_var_value("W", dest_W);
-            formula_data.set_var_value("t", src_wire_ind);
-            int raw_dest_wire_ind = get_sb_formula_raw_result(scratchpad->formula_parser, permutations_ref[iperm].c_str(), formula_data);
+            int raw_dest_wire_ind = evaluate_permutation_formula(scratchpad, permutations_ref[iperm], dest_W, src_wire_ind);
             int dest_wire_ind = adjust_formula_result(raw_dest_wire_ind, src_W, dest_W, iconn);
 
             if (dest_wire_ind < 0) {
@@ -784,14 +858,31 @@ static void compute_wireconn_connections(
     }
 }
 
-static int evaluate_num_conns_formula(t_wireconn_scratchpad* scratchpad, std::string num_conns_formula, int from_wire_count, int to_wire_count) {
-    t_formula_data& vars = scratchpad->formula_data;
-    vars.clear();
+static int evaluate_num_conns_formula(t_wireconn_scratchpad* scratchpad, const std::string& num_conns_formula, int from_wire_count, int to_wire_count) {
+    auto result = scratchpad->formula_results.emplace(t_formula_key{&num_conns_formula, from_wire_count, to_wire_count}, 0);
+    if (result.second) {
+        t_formula_data& vars = scratchpad->formula_data;
+        vars.clear();
+
+        vars.set_var_value("from", from_wire_count);
+        vars.set_var_value("to", to_wire_count);
 
-    vars.set_var_value("from", from_wire_count);
-    vars.set_var_value("to", to_wire_count);
+        result.first->second = scratchpad->formula_parser.parse_formula(num_conns_formula, vars);
+    }
+    return result.first->second;
+}
 
-    return scratchpad->formula_parser.parse_formula(num_conns_formula, vars);
+static int evaluate_permutation_formula(t_wireconn_scratchpad* scratchpad, const std::string& permutation, int dest_W, int src_wire_ind) {
+    auto result = scratchpad->formula_results.emplace(t_formula_key{&permutation, dest_W, src_wire_ind}, 0);
+    if (result.second) {
+        t_formula_data& formula_data = scratchpad->formula_data;
+        formula_data.clear();
+        formula_data.set_var_value("W", dest_W);
+        formula_data.set_var_value("t", src_wire_ind);
+
+        result.first->second = get_sb_formula_raw_result(scratchpad->formula_parser, permutation.c_str(), formula_data);
+    }
+    return result.first->second;
 }
 
 /* Here we find the correct channel (x or y), and the coordinates to index into it based on the
@@ -5,6 +5,7 @@
 #include "vtr_log.h"
 #include "vtr_memory.h"
 #include "vtr_time.h"
+#include "vtr_parallel.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -17,6 +18,10 @@
 #include "read_xml_arch_file.h"
 #include "route_tree.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 /******************** Subroutines local to this module **********************/
 static void check_node_and_range(RRNodeId inode,
                                  enum e_route_type route_type,
@@ -31,6 +36,11 @@ static void check_sink(const Netlist<>& net_list,
                        ParentNetId net_id,
                        bool* pin_done);
 
+static void check_net_route(const Netlist<>& net_list,
+                            ParentNetId net_id,
+                            enum e_route_type route_type,
+                            size_t num_switches,
+                            bool is_flat);
 static void check_switch(const RouteTreeNode& rt_node, size_t num_switch);
 static bool check_adjacent(RRNodeId from_node, RRNodeId to_node, bool is_flat);
 static int chanx_chany_adjacent(RRNodeId chanx_node, RRNodeId chany_node);
@@ -65,9 +75,7 @@ void check_route(const Netlist<>& net_list,
         return;
     }
 
-    int max_pins;
-    unsigned int ipin;
-    bool valid, connects;
+    bool valid;
 
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
@@ -95,83 +103,100 @@ void check_route(const Netlist<>& net_list,
                                      is_flat);
     }
 
-    max_pins = 0;
-    for (auto net_id : net_list.nets())
-        max_pins = std::max(max_pins, (int)net_list.net_pins(net_id).size());
-
-    auto pin_done = std::make_unique<bool[]>(max_pins);
+    /* Now check that all nets are indeed connected. The nets are checked   *
+     * independently, in parallel when VPR is built with TBB (the first      *
+     * error found is then reported).                                        */
+    auto nets = net_list.nets();
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), nets.size(), [&](size_t inet) {
+        check_net_route(net_list, *(nets.begin() + inet), route_type, num_switches, is_flat);
+    });
+#else
+    for (auto net_id : nets) {
+        check_net_route(net_list, net_id, route_type, num_switches, is_flat);
+    }
+#endif
 
-    /* Now check that all nets are indeed connected. */
-    for (auto net_id : net_list.nets()) {
-        if (net_list.net_is_ignored(net_id) || net_list.net_sinks(net_id).size() == 0) /* Skip ignored nets. */
-            continue;
+    if (check_route_option == e_check_route_option::FULL) {
+        check_all_non_configurable_edges(net_list, is_flat);
+    } else {
+        VTR_ASSERT(check_route_option == e_check_route_option::QUICK);
+    }
 
-        std::fill_n(pin_done.get(), net_list.net_pins(net_id).size(), false);
+    VTR_LOG("Completed routing consistency check successfully.\n");
+    VTR_LOG("\n");
+}
 
-        if (!route_ctx.route_trees[net_id]) {
-            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                            "in check_route: net %d has no routing.\n", size_t(net_id));
-        }
+/* Checks that the route tree of net_id is a properly connected path from  *
+ * its SOURCE to each of its sinks, without stubs.                          */
+static void check_net_route(const Netlist<>& net_list,
+                            ParentNetId net_id,
+                            enum e_route_type route_type,
+                            size_t num_switches,
+                            bool is_flat) {
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto& route_ctx = g_vpr_ctx.routing();
 
-        /* Check the SOURCE of the net. */
-        RRNodeId source_inode = route_ctx.route_trees[net_id].value().root().inode;
-        check_node_and_range(source_inode, route_type, is_flat);
-        check_source(net_list, source_inode, net_id, is_flat);
+    if (net_list.net_is_ignored(net_id) || net_list.net_sinks(net_id).size() == 0) /* Skip ignored nets. */
+        return;
 
-        pin_done[0] = true;
+    auto pin_done = std::make_unique<bool[]>(net_list.net_pins(net_id).size()); /* all false */
 
-        /* Check the rest of the net */
-        size_t num_sinks = 0;
-        for (auto& rt_node : route_ctx.route_trees[net_id].value().all_nodes()) {
-            RRNodeId inode = rt_node.inode;
-            int net_pin_index = rt_node.net_pin_index;
-            check_node_and_range(inode, route_type, is_flat);
-            check_switch(rt_node, num_switches);
-
-            if (rt_node.parent()) {
-                connects = check_adjacent(rt_node.parent()->inode, rt_node.inode, is_flat);
-                if (!connects) {
-                    VPR_ERROR(VPR_ERROR_ROUTE,
-                              "in check_route: found non-adjacent segments in traceback while checking net %d:\n"
-                              "  %s\n"
-                              "  %s\n",
-                              size_t(net_id),
-                              describe_rr_node(rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, rt_node.parent()->inode, is_flat).c_str(),
-                              describe_rr_node(rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat).c_str());
-                }
-            }
+    if (!route_ctx.route_trees[net_id]) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                        "in check_route: net %d has no routing.\n", size_t(net_id));
+    }
 
-            if (rr_graph.node_type(inode) == SINK) {
-                check_sink(net_list, inode, net_pin_index, net_id, pin_done.get());
-                num_sinks += 1;
+    /* Check the SOURCE of the net. */
+    RRNodeId source_inode = route_ctx.route_trees[net_id].value().root().inode;
+    check_node_and_range(source_inode, route_type, is_flat);
+    check_source(net_list, source_inode, net_id, is_flat);
+
+    pin_done[0] = true;
+
+    /* Check the rest of the net */
+    size_t num_sinks = 0;
+    for (auto& rt_node : route_ctx.route_trees[net_id].value().all_nodes()) {
+        RRNodeId inode = rt_node.inode;
+        int net_pin_index = rt_node.net_pin_index;
+        check_node_and_range(inode, route_type, is_flat);
+        check_switch(rt_node, num_switches);
+
+        if (rt_node.parent()) {
+            bool connects = check_adjacent(rt_node.parent()->inode, rt_node.inode, is_flat);
+            if (!connects) {
+                VPR_ERROR(VPR_ERROR_ROUTE,
+                          "in check_route: found non-adjacent segments in traceback while checking net %d:\n"
+                          "  %s\n"
+                          "  %s\n",
+                          size_t(net_id),
+                          describe_rr_node(rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, rt_node.parent()->inode, is_flat).c_str(),
+                          describe_rr_node(rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat).c_str());
             }
         }
 
-        if (num_sinks != net_list.net_sinks(net_id).size()) {
-            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                            "in check_route: net %zu (%s) has %zu SINKs (expected %zu).\n",
-                            size_t(net_id), net_list.net_name(net_id).c_str(),
-                            num_sinks, net_list.net_sinks(net_id).size());
-        }
-
-        for (ipin = 0; ipin < net_list.net_pins(net_id).size(); ipin++) {
-            if (pin_done[ipin] == false) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                                "in check_route: net %zu does not connect to pin %d.\n", size_t(net_id), ipin);
-            }
+        if (rr_graph.node_type(inode) == SINK) {
+            check_sink(net_list, inode, net_pin_index, net_id, pin_done.get());
+            num_sinks += 1;
         }
+    }
 
-        check_net_for_stubs(net_list, net_id, is_flat);
-    } /* End for each net */
+    if (num_sinks != net_list.net_sinks(net_id).size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                        "in check_route: net %zu (%s) has %zu SINKs (expected %zu).\n",
+                        size_t(net_id), net_list.net_name(net_id).c_str(),
+                        num_sinks, net_list.net_sinks(net_id).size());
+    }
 
-    if (check_route_option == e_check_route_option::FULL) {
-        check_all_non_configurable_edges(net_list, is_flat);
-    } else {
-        VTR_ASSERT(check_route_option == e_check_route_option::QUICK);
+    for (size_t ipin = 0; ipin < net_list.net_pins(net_id).size(); ipin++) {
+        if (!pin_done[ipin]) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "in check_route: net %zu does not connect to pin %zu.\n", size_t(net_id), ipin);
+        }
     }
 
-    VTR_LOG("Completed routing consistency check successfully.\n");
-    VTR_LOG("\n");
+    check_net_for_stubs(net_list, net_id, is_flat);
 }
 
 /* Checks that this SINK node is one of the terminals of inet, and marks   *
@@ -479,10 +504,10 @@ void recompute_occupancy_from_scratch(const Netlist<>& net_list, bool is_flat) {
     auto& device_ctx = g_vpr_ctx.device();
 
     /* First set the occupancy of everything to zero. */
-    for (RRNodeId inode : device_ctx.rr_graph.nodes())
-        route_ctx.rr_node_route_inf[inode].set_occ(0);
+    pathfinder_reset_occupancy();
 
-    /* Now go through each net and count the tracks and pins used everywhere */
+    /* Now go through each net and count the tracks and pins used everywhere. *
+     * Congested nets share nodes, so this stays serial.                     */
 
     for (auto net_id : net_list.nets()) {
         if (!route_ctx.route_trees[net_id])
@@ -492,8 +517,7 @@ void recompute_occupancy_from_scratch(const Netlist<>& net_list, bool is_flat) {
             continue;
 
         for (auto& rt_node : route_ctx.route_trees[net_id].value().all_nodes()) {
-            RRNodeId inode = rt_node.inode;
-            route_ctx.rr_node_route_inf[inode].set_occ(route_ctx.rr_node_route_inf[inode].occ() + 1);
+            pathfinder_update_single_node_occupancy(rt_node.inode, 1);
         }
     }
 
@@ -501,19 +525,21 @@ void recompute_occupancy_from_scratch(const Netlist<>& net_list, bool is_flat) {
     if (!is_flat) {
         /* Now update the occupancy of each of the "locally used" OPINs on each CLB *
          * (CLB outputs used up by being directly wired to subblocks used only      *
-         * locally).                                                                */
-        for (auto blk_id : net_list.blocks()) {
-            auto cluster_blk_id = convert_to_cluster_block_id(blk_id);
+         * locally). The OPINs of different blocks are different nodes, so the     *
+         * blocks are independent.                                                  */
+        auto blocks = net_list.blocks();
+        vtr::parallel_for(0, blocks.size(), [&](size_t iblk) {
+            auto cluster_blk_id = convert_to_cluster_block_id(*(blocks.begin() + iblk));
             for (int iclass = 0; iclass < (int)physical_tile_type(cluster_blk_id)->class_inf.size(); iclass++) {
                 int num_local_opins = route_ctx.clb_opins_used_locally[cluster_blk_id][iclass].size();
                 /* Will always be 0 for pads or SINK classes. */
                 for (int ipin = 0; ipin < num_local_opins; ipin++) {
                     RRNodeId inode = route_ctx.clb_opins_used_locally[cluster_blk_id][iclass][ipin];
                     VTR_ASSERT(inode && size_t(inode) < device_ctx.rr_graph.num_nodes());
-                    route_ctx.rr_node_route_inf[inode].set_occ(route_ctx.rr_node_route_inf[inode].occ() + 1);
+                    pathfinder_update_single_node_occupancy(inode, 1);
                 }
             }
-        }
+        });
     }
 }
 
@@ -588,12 +614,22 @@ static void check_all_non_configurable_edges(const Netlist<>& net_list, bool is_
     vtr::ScopedStartFinishTimer timer("Checking to ensure non-configurable edges are legal");
     auto non_configurable_rr_sets = identify_non_configurable_rr_sets();
 
-    for (auto net_id : net_list.nets()) {
+    auto nets = net_list.nets();
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), nets.size(), [&](size_t inet) {
+        check_non_configurable_edges(net_list,
+                                     *(nets.begin() + inet),
+                                     non_configurable_rr_sets,
+                                     is_flat);
+    });
+#else
+    for (auto net_id : nets) {
         check_non_configurable_edges(net_list,
                                      net_id,
                                      non_configurable_rr_sets,
                                      is_flat);
     }
+#endif
 }
 
 // Checks that the specified routing is legal with respect to non-configurable edges
@@ -0,0 +1,124 @@
+#include "clock_route_templates.h"
+
+#include <queue>
+
+#include "vtr_log.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+/* Returns the template of drive_point: a breadth-first search tree over the clock
+ * network. The dedicated clock networks only connect clock wires to other clock wires
+ * and to IPINs, so the search stays within the clock network without having to know which
+ * wires belong to it. */
+static std::unordered_map<RRNodeId, ClockRouteTemplates::t_template_edge> build_drive_point_template(const RRGraphView& rr_graph,
+                                                                                                      RRNodeId drive_point,
+                                                                                                      RRNodeId virtual_root) {
+    const auto& rr_nodes = rr_graph.rr_nodes();
+
+    std::unordered_map<RRNodeId, ClockRouteTemplates::t_template_edge> node_edges;
+    node_edges[drive_point] = {RRNodeId::INVALID(), RREdgeId::INVALID()};
+
+    std::queue<RRNodeId> to_expand;
+    to_expand.push(drive_point);
+    while (!to_expand.empty()) {
+        RRNodeId node = to_expand.front();
+        to_expand.pop();
+
+        e_rr_type node_type = rr_graph.node_type(node);
+        if (node_type == SINK) {
+            continue;
+        }
+
+        for (RREdgeId edge : rr_nodes.edge_range(node)) {
+            RRNodeId to_node = rr_nodes.edge_sink_node(edge);
+            e_rr_type to_type = rr_graph.node_type(to_node);
+            if (to_node == virtual_root || to_type == SOURCE || to_type == OPIN) {
+                continue;
+            }
+            //IPINs are only left towards their SINKs, not through intra-cluster routing
+            if (node_type == IPIN && to_type != SINK) {
+                continue;
+            }
+
+            if (node_edges.emplace(to_node, ClockRouteTemplates::t_template_edge{node, edge}).second) {
+                to_expand.push(to_node);
+            }
+        }
+    }
+
+    node_edges.erase(drive_point);
+    return node_edges;
+}
+
+void ClockRouteTemplates::build(const RRGraphView& rr_graph, RRNodeId virtual_root) {
+    clear();
+
+    if (!virtual_root || size_t(virtual_root) >= rr_graph.num_nodes() || rr_graph.node_type(virtual_root) != SINK) {
+        return;
+    }
+
+    const auto& rr_nodes = rr_graph.rr_nodes();
+
+    std::vector<RRNodeId> drive_points;
+    for (size_t inode = 0; inode < rr_graph.num_nodes(); ++inode) {
+        RRNodeId node(inode);
+        e_rr_type node_type = rr_graph.node_type(node);
+        if (node_type != CHANX && node_type != CHANY) {
+            continue;
+        }
+        for (RREdgeId edge : rr_nodes.edge_range(node)) {
+            if (rr_nodes.edge_sink_node(edge) == virtual_root) {
+                drive_points.push_back(node);
+                break;
+            }
+        }
+    }
+
+    //The clock network instances hanging off each drive point are searched independently
+    templates_.resize(drive_points.size());
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), drive_points.size(), [&](size_t i) {
+#else
+    for (size_t i = 0; i < drive_points.size(); ++i) {
+#endif
+        templates_[i] = build_drive_point_template(rr_graph, drive_points[i], virtual_root);
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+
+    size_t num_template_nodes = 0;
+    for (size_t i = 0; i < drive_points.size(); ++i) {
+        drive_point_templates_[drive_points[i]] = i;
+        num_template_nodes += templates_[i].size();
+    }
+
+    VTR_LOG("Built clock routing templates for %zu clock network drive points (%zu nodes)\n",
+            drive_points.size(), num_template_nodes);
+}
+
+void ClockRouteTemplates::clear() {
+    drive_point_templates_.clear();
+    templates_.clear();
+}
+
+bool ClockRouteTemplates::is_drive_point(RRNodeId node) const {
+    return drive_point_templates_.count(node);
+}
+
+const ClockRouteTemplates::t_template_edge* ClockRouteTemplates::template_edge(RRNodeId drive_point, RRNodeId node) const {
+    auto drive_itr = drive_point_templates_.find(drive_point);
+    if (drive_itr == drive_point_templates_.end()) {
+        return nullptr;
+    }
+
+    const auto& node_edges = templates_[drive_itr->second];
+    auto itr = node_edges.find(node);
+    if (itr == node_edges.end()) {
+        return nullptr;
+    }
+    return &itr->second;
+}
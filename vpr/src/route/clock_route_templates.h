@@ -0,0 +1,57 @@
+#ifndef CLOCK_ROUTE_TEMPLATES_H
+#define CLOCK_ROUTE_TEMPLATES_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "rr_graph_view.h"
+
+/**
+ * @brief Precomputed routes through the dedicated clock networks
+ *
+ * The dedicated clock networks (spines, ribs and H-trees) form trees hanging off the
+ * drive points which feed the virtual clock network root. For every drive point, a
+ * template records how the fewest-hops path from the drive point enters each clock
+ * wire, IPIN and SINK reachable from it through the clock network.
+ *
+ * With two stage clock routing, the second stage (from the drive point reached by the
+ * first stage to the net sinks) then reduces to copying template paths into the route
+ * tree, instead of searching the clock network once per sink.
+ */
+class ClockRouteTemplates {
+  public:
+    ///@brief The edge by which a template path enters a node
+    struct t_template_edge {
+        RRNodeId prev_node;
+        RREdgeId prev_edge;
+    };
+
+    /**
+     * @brief Builds the templates of all the drive points of virtual_root
+     *
+     * Drive points are the wires with an edge to virtual_root. Nothing is built if
+     * virtual_root is not a SINK of rr_graph (e.g. without a dedicated clock network).
+     */
+    void build(const RRGraphView& rr_graph, RRNodeId virtual_root);
+
+    void clear();
+
+    bool empty() const { return templates_.empty(); }
+
+    ///@brief Returns true if node is a drive point with a template
+    bool is_drive_point(RRNodeId node) const;
+
+    /**
+     * @brief Returns the edge by which the template path from drive_point enters node
+     *
+     * Returns nullptr if node is drive_point itself, or is not reachable from
+     * drive_point through the clock network.
+     */
+    const t_template_edge* template_edge(RRNodeId drive_point, RRNodeId node) const;
+
+  private:
+    std::unordered_map<RRNodeId, size_t> drive_point_templates_;
+    std::vector<std::unordered_map<RRNodeId, t_template_edge>> templates_;
+};
+
+#endif
@@ -1,6 +1,6 @@
 #pragma once
+#include <limits>
 #include <vector>
-#include <unordered_map>
 #include "route_tree_fwd.h"
 #include "vpr_types.h"
 #include "timing_info.h"
@@ -29,18 +29,25 @@ class Connection_based_routing_resources {
     const Netlist<>& net_list_;
     const vtr::vector<ParentNetId, std::vector<RRNodeId>>& net_terminals_;
     bool is_flat_;
-    // whether or not a connection should be forcibly rerouted the next iteration
-    // takes [inet][sink_rr_node_index] and returns whether that connection should be rerouted or not
-    /* reroute connection if all of the following are true:
-     * 1. current critical path delay grew from the last stable critical path delay significantly
-     * 2. the connection is critical enough
-     * 3. the connection is suboptimal, in comparison to lower_bound_connection_delay
-     */
-    vtr::vector<ParentNetId, std::unordered_map<RRNodeId, bool>> forcible_reroute_connection_flag;
-
-    // the optimal delay for a connection [inet][ipin] ([0...num_net][1...num_pin])
-    // determined after the first routing iteration when only optimizing for timing delay
-    vtr::vector<ParentNetId, std::vector<float>> lower_bound_connection_delay;
+
+    // the targeted reroute state of a connection
+    struct t_connection_state {
+        // the optimal delay for the connection, determined after the first routing
+        // iteration when only optimizing for timing delay
+        float lower_bound_delay = std::numeric_limits<float>::infinity();
+
+        // whether or not the connection should be forcibly rerouted the next iteration
+        /* reroute connection if all of the following are true:
+         * 1. current critical path delay grew from the last stable critical path delay significantly
+         * 2. the connection is critical enough
+         * 3. the connection is suboptimal, in comparison to lower_bound_delay
+         */
+        bool force_reroute = false;
+    };
+
+    // the state of each connection [inet][ipin] ([0...num_net][1...num_pin]), laid out
+    // flat so that the per-connection loops walk one buffer
+    NetPinsMatrix<t_connection_state> connection_state_;
 
     // the most recent stable critical path delay
     // compared against the current iteration's critical path delay
@@ -72,19 +79,17 @@ class Connection_based_routing_resources {
     // for updating the last stable path delay
     void set_stable_critical_path_delay(float stable_critical_path_delay) { last_stable_critical_path_delay = stable_critical_path_delay; }
 
-    // get whether the connection to rr_sink_node of net_id should be forcibly rerouted (can either assign or just read)
-    bool should_force_reroute_connection(ParentNetId net_id, RRNodeId rr_sink_node) const {
-        auto itr = forcible_reroute_connection_flag[net_id].find(rr_sink_node);
-
-        if (itr == forcible_reroute_connection_flag[net_id].end()) {
+    // get whether the connection to net pin ipin of net_id should be forcibly rerouted
+    bool should_force_reroute_connection(ParentNetId net_id, int ipin) const {
+        if (ipin <= 0) {
             return false; //A non-SINK end of a branch
         }
-        return itr->second;
+        return connection_state_[net_id][ipin].force_reroute;
     }
-    void clear_force_reroute_for_connection(ParentNetId net_id, RRNodeId rr_sink_node);
+    void clear_force_reroute_for_connection(ParentNetId net_id, int ipin);
     void clear_force_reroute_for_net(ParentNetId net_id);
 
-    // check each connection of each net to see if any satisfy the criteria described above (for the forcible_reroute_connection_flag data structure)
+    // check each connection of each net to see if any satisfy the criteria described above (for t_connection_state::force_reroute)
     // and if so, mark them to be rerouted
     bool forcibly_reroute_connections(float max_criticality,
                                       std::shared_ptr<const SetupTimingInfo> timing_info,
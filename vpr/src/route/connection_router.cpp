@@ -1,10 +1,16 @@
 #include "connection_router.h"
 #include "rr_graph.h"
 
+#include <unordered_set>
+
 #include "binary_heap.h"
 #include "bucket.h"
+#include "four_ary_heap.h"
 #include "rr_graph_fwd.h"
 
+/* Maximum number of each of the (per connection) retry warnings, which congested routings may otherwise log by the thousand */
+static constexpr size_t MAX_LOGGED_RETRY_WARNINGS = 100;
+
 /**
  * @brief This function is relevant when the architecture is 3D. If inter-layer connections are only from OPINs (determine by is_inter_layer_opin_connection),
  * then nodes (other that OPINs) which are on the other layer than sink's layer, don't need to be pushed back to the heap.
@@ -31,9 +37,13 @@ static void update_router_stats(const DeviceContext& device_ctx,
                                 RRNodeId rr_node_id,
                                 bool is_push);
 
+#ifdef VTR_ASSERT_SAFE_ENABLED
+static bool same_non_config_node_set(RRNodeId from_node, RRNodeId to_node);
+#endif
+
 /** return tuple <found_path, retry_with_full_bb, cheapest> */
-template<typename Heap>
-std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_connection_from_route_tree(
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+std::tuple<bool, bool, t_heap> ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_route_connection_from_route_tree(
     const RouteTreeNode& rt_root,
     RRNodeId sink_node,
     const t_conn_cost_params cost_params,
@@ -58,15 +68,14 @@ std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_conne
         return std::make_tuple(true, /*retry=*/false, out);
     } else {
         reset_path_costs();
-        modified_rr_node_inf_.clear();
         heap_.empty_heap();
         return std::make_tuple(false, retry, t_heap());
     }
 }
 
 /** Return <retry with full bb?, cheapest> */
-template<typename Heap>
-std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection_common_setup(
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+std::tuple<bool, t_heap*> ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_route_connection_common_setup(
     const RouteTreeNode& rt_root,
     RRNodeId sink_node,
     const t_conn_cost_params cost_params,
@@ -81,7 +90,7 @@ std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection
     RRNodeId source_node = rt_root.inode;
 
     if (heap_.is_empty_heap()) {
-        VTR_LOG("No source in route tree: %s\n", describe_unrouteable_connection(source_node, sink_node, is_flat_).c_str());
+        VTR_LOG("No source in route tree: %s\n", describe_unrouteable_connection(source_node, sink_node, is_flat()).c_str());
         return std::make_tuple(false, nullptr);
     }
 
@@ -89,9 +98,16 @@ std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection
                    bounding_box.layer_min, bounding_box.xmin, bounding_box.ymin,
                    bounding_box.layer_max, bounding_box.xmax, bounding_box.ymax);
 
-    t_heap* cheapest = timing_driven_route_connection_from_heap(sink_node,
+    t_heap* cheapest = nullptr;
+    if (use_bidirectional_search(source_node, sink_node)) {
+        cheapest = timing_driven_route_connection_bidirectional(sink_node,
                                                                 cost_params,
                                                                 bounding_box);
+    } else {
+        cheapest = timing_driven_route_connection_from_heap(sink_node,
+                                                            cost_params,
+                                                            bounding_box);
+    }
 
     if (cheapest == nullptr) {
         // No path found within the current bounding box.
@@ -101,7 +117,7 @@ std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection
             && bounding_box.ymin == 0
             && bounding_box.xmax == (int)(grid_.width() - 1)
             && bounding_box.ymax == (int)(grid_.height() - 1)) {
-            VTR_LOG("%s\n", describe_unrouteable_connection(source_node, sink_node, is_flat_).c_str());
+            VTR_LOG("%s\n", describe_unrouteable_connection(source_node, sink_node, is_flat()).c_str());
             return std::make_tuple(false, nullptr);
         }
 
@@ -109,7 +125,7 @@ std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection
         // to retry this net with a full-device bounding box. If we are already at full device extents,
         // just fail
         if (!can_grow_bb) {
-            VTR_LOG_WARN("No routing path for connection to sink_rr %d, leaving unrouted to retry on next iteration\n", sink_node);
+            VTR_LOG_WARN_LIMITED(MAX_LOGGED_RETRY_WARNINGS, "No routing path for connection to sink_rr %d, leaving unrouted to retry on next iteration\n", sink_node);
             return std::make_tuple(true, nullptr);
         }
 
@@ -118,7 +134,7 @@ std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection
         // Note that the additional run-time overhead of re-trying only occurs
         // when we were otherwise going to give up -- the typical case (route
         // found with the bounding box) remains fast and never re-tries .
-        VTR_LOG_WARN("No routing path for connection to sink_rr %d, retrying with full device bounding box\n", sink_node);
+        VTR_LOG_WARN_LIMITED(MAX_LOGGED_RETRY_WARNINGS, "No routing path for connection to sink_rr %d, retrying with full device bounding box\n", sink_node);
 
         t_bb full_device_bounding_box;
         full_device_bounding_box.xmin = 0;
@@ -142,7 +158,6 @@ std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection
         //add_route_tree_to_heap() the nodes in the route tree actually
         //make it back into the heap.
         reset_path_costs();
-        modified_rr_node_inf_.clear();
         heap_.empty_heap();
 
         //Re-initialize the heap since it was emptied by the previous call to
@@ -157,7 +172,7 @@ std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection
     }
 
     if (cheapest == nullptr) {
-        VTR_LOG("%s\n", describe_unrouteable_connection(source_node, sink_node, is_flat_).c_str());
+        VTR_LOG("%s\n", describe_unrouteable_connection(source_node, sink_node, is_flat()).c_str());
         return std::make_tuple(false, nullptr);
     }
 
@@ -169,8 +184,8 @@ std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection
 // Unlike timing_driven_route_connection_from_route_tree(), only part of the route tree
 // which is spatially close to the sink is added to the heap.
 // Returns a  tuple of <found_path?, retry_with_full_bb?, cheapest> */
-template<typename Heap>
-std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_connection_from_route_tree_high_fanout(
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+std::tuple<bool, bool, t_heap> ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_route_connection_from_route_tree_high_fanout(
     const RouteTreeNode& rt_root,
     RRNodeId sink_node,
     const t_conn_cost_params cost_params,
@@ -191,7 +206,7 @@ std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_conne
     RRNodeId source_node = rt_root.inode;
 
     if (heap_.is_empty_heap()) {
-        VTR_LOG("No source in route tree: %s\n", describe_unrouteable_connection(source_node, sink_node, is_flat_).c_str());
+        VTR_LOG("No source in route tree: %s\n", describe_unrouteable_connection(source_node, sink_node, is_flat()).c_str());
         return std::make_tuple(false, false, t_heap());
     }
 
@@ -208,12 +223,11 @@ std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_conne
     if (cheapest == nullptr) {
         //Found no path, that may be due to an unlucky choice of existing route tree sub-set,
         //try again with the full route tree to be sure this is not an artifact of high-fanout routing
-        VTR_LOG_WARN("No routing path found in high-fanout mode for net connection (to sink_rr %d), retrying with full route tree\n", sink_node);
+        VTR_LOG_WARN_LIMITED(MAX_LOGGED_RETRY_WARNINGS, "No routing path found in high-fanout mode for net connection (to sink_rr %d), retrying with full route tree\n", sink_node);
 
         //Reset any previously recorded node costs so timing_driven_route_connection()
         //starts over from scratch.
         reset_path_costs();
-        modified_rr_node_inf_.clear();
 
         std::tie(retry_with_full_bb, cheapest) = timing_driven_route_connection_common_setup(rt_root,
                                                                                              sink_node,
@@ -223,7 +237,7 @@ std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_conne
     }
 
     if (cheapest == nullptr) {
-        VTR_LOG("%s\n", describe_unrouteable_connection(source_node, sink_node, is_flat_).c_str());
+        VTR_LOG("%s\n", describe_unrouteable_connection(source_node, sink_node, is_flat()).c_str());
 
         heap_.empty_heap();
         rcv_path_manager.empty_heap();
@@ -246,10 +260,10 @@ std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_conne
 // This is the core maze routing routine.
 //
 // Returns either the last element of the path, or nullptr if no path is found
-template<typename Heap>
-t_heap* ConnectionRouter<Heap>::timing_driven_route_connection_from_heap(RRNodeId sink_node,
-                                                                         const t_conn_cost_params cost_params,
-                                                                         t_bb bounding_box) {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+t_heap* ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_route_connection_from_heap(RRNodeId sink_node,
+                                                                                                  const t_conn_cost_params cost_params,
+                                                                                                  t_bb bounding_box) {
     VTR_ASSERT_SAFE(heap_.is_valid());
     //std::cout << "using this: " << (void *)this << "\n";
     //std::cout << "using heap: " << heap_.get_ptr() << "\n";
@@ -259,7 +273,6 @@ t_heap* ConnectionRouter<Heap>::timing_driven_route_connection_from_heap(RRNodeI
     }
 
     const auto& device_ctx = g_vpr_ctx.device();
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     t_heap* cheapest = nullptr;
     while (!heap_.is_empty_heap()) {
@@ -280,10 +293,10 @@ t_heap* ConnectionRouter<Heap>::timing_driven_route_connection_from_heap(RRNodeI
             // If we're running RCV, the path will be stored in the path_data->path_rr vector
             // This is then placed into the traceback so that the correct path is returned
             // TODO: This can be eliminated by modifying the actual traceback function in route_timing
-            if (rcv_path_manager.is_enabled()) {
-                rcv_path_manager.insert_backwards_path_into_traceback(cheapest->path_data, cheapest->cost, cheapest->backward_path_cost, route_ctx);
+            if (rcv_enabled()) {
+                rcv_path_manager.insert_backwards_path_into_traceback(cheapest->path_data, cheapest->cost, cheapest->backward_path_cost, rr_node_path_inf_);
             }
-            VTR_LOGV_DEBUG(router_debug_, "  Found target %8d (%s)\n", inode, describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat_).c_str());
+            VTR_LOGV_DEBUG(router_debug_, "  Found target %8d (%s)\n", inode, describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat()).c_str());
             break;
         }
 
@@ -312,8 +325,8 @@ t_heap* ConnectionRouter<Heap>::timing_driven_route_connection_from_heap(RRNodeI
 }
 
 // Find shortest paths from specified route tree to all nodes in the RR graph
-template<typename Heap>
-vtr::vector<RRNodeId, t_heap> ConnectionRouter<Heap>::timing_driven_find_all_shortest_paths_from_route_tree(
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+vtr::vector<RRNodeId, t_heap> ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_find_all_shortest_paths_from_route_tree(
     const RouteTreeNode& rt_root,
     const t_conn_cost_params cost_params,
     t_bb bounding_box,
@@ -340,8 +353,8 @@ vtr::vector<RRNodeId, t_heap> ConnectionRouter<Heap>::timing_driven_find_all_sho
 //
 // Note that to re-use code used for the regular A*-based router we use a
 // no-operation lookahead which always returns zero.
-template<typename Heap>
-vtr::vector<RRNodeId, t_heap> ConnectionRouter<Heap>::timing_driven_find_all_shortest_paths_from_heap(
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+vtr::vector<RRNodeId, t_heap> ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_find_all_shortest_paths_from_heap(
     const t_conn_cost_params cost_params,
     t_bb bounding_box) {
     vtr::vector<RRNodeId, t_heap> cheapest_paths(rr_nodes_.size());
@@ -391,16 +404,16 @@ vtr::vector<RRNodeId, t_heap> ConnectionRouter<Heap>::timing_driven_find_all_sho
     return cheapest_paths;
 }
 
-template<typename Heap>
-void ConnectionRouter<Heap>::timing_driven_expand_cheapest(t_heap* cheapest,
-                                                           RRNodeId target_node,
-                                                           const t_conn_cost_params cost_params,
-                                                           t_bb bounding_box) {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_expand_cheapest(t_heap* cheapest,
+                                                                                    RRNodeId target_node,
+                                                                                    const t_conn_cost_params cost_params,
+                                                                                    t_bb bounding_box) {
     RRNodeId inode = cheapest->index;
 
-    t_rr_node_route_inf* route_inf = &rr_node_route_inf_[inode];
-    float best_total_cost = route_inf->path_cost;
-    float best_back_cost = route_inf->backward_path_cost;
+    t_rr_node_path_inf* path_inf = &rr_node_path_inf_[inode];
+    float best_total_cost = path_cost(*path_inf);
+    float best_back_cost = backward_path_cost(*path_inf);
 
     float new_total_cost = cheapest->cost;
     float new_back_cost = cheapest->backward_path_cost;
@@ -413,7 +426,7 @@ void ConnectionRouter<Heap>::timing_driven_expand_cheapest(t_heap* cheapest,
      * than one with higher cost.  Test whether or not I should disallow   *
      * re-expansion based on a higher total cost.                          */
 
-    if (best_total_cost > new_total_cost && ((rcv_path_manager.is_enabled()) || best_back_cost > new_back_cost)) {
+    if (best_total_cost > new_total_cost && ((rcv_enabled()) || best_back_cost > new_back_cost)) {
         // Explore from this node, since the current/new partial path has the best cost
         // found so far
         VTR_LOGV_DEBUG(router_debug_, "    Better cost to %d\n", inode);
@@ -424,7 +437,7 @@ void ConnectionRouter<Heap>::timing_driven_expand_cheapest(t_heap* cheapest,
                        cheapest->prev_node(),
                        size_t(cheapest->prev_edge()));
 
-        update_cheapest(cheapest, route_inf);
+        update_cheapest(cheapest, path_inf);
 
         timing_driven_expand_neighbours(cheapest, cost_params, bounding_box,
                                         target_node);
@@ -439,11 +452,11 @@ void ConnectionRouter<Heap>::timing_driven_expand_cheapest(t_heap* cheapest,
     }
 }
 
-template<typename Heap>
-void ConnectionRouter<Heap>::timing_driven_expand_neighbours(t_heap* current,
-                                                             const t_conn_cost_params cost_params,
-                                                             t_bb bounding_box,
-                                                             RRNodeId target_node) {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_expand_neighbours(t_heap* current,
+                                                                                      const t_conn_cost_params cost_params,
+                                                                                      t_bb bounding_box,
+                                                                                      RRNodeId target_node) {
     /* Puts all the rr_nodes adjacent to current on the heap. */
 
     t_bb target_bb;
@@ -459,6 +472,7 @@ void ConnectionRouter<Heap>::timing_driven_expand_neighbours(t_heap* current,
     // For each node associated with the current heap element, expand all of it's neighbors
     RRNodeId from_node = current->index;
     auto edges = rr_nodes_.edge_range(from_node);
+    rr_nodes_.prefetch_edges(from_node);
 
     // This is a simple prefetch that prefetches:
     //  - RR node data reachable from this node
@@ -477,16 +491,30 @@ void ConnectionRouter<Heap>::timing_driven_expand_neighbours(t_heap* current,
     //  - directrf_stratixiv_arch_timing.blif
     //  - gsm_switch_stratixiv_arch_timing.blif
     //
+    // The switch data is read from router_switch_inf_, which is small
+    // enough to stay in cache, so only the sink nodes are prefetched, with
+    // their congestion (route inf) and best path costs (path inf).
+    const auto& rr_node_route_inf = g_vpr_ctx.routing().rr_node_route_inf;
     for (RREdgeId from_edge : edges) {
-        RRNodeId to_node = rr_nodes_.edge_sink_node(from_edge);
+        RRNodeId to_node = rr_nodes_.edge_hot(from_edge).dest_node;
         rr_nodes_.prefetch_node(to_node);
+        VTR_PREFETCH(&rr_node_route_inf[to_node], 0, 0);
+        VTR_PREFETCH(&rr_node_path_inf_[to_node], 0, 0);
+    }
 
-        int switch_idx = rr_nodes_.edge_switch(from_edge);
-        VTR_PREFETCH(&rr_switch_inf_[switch_idx], 0, 0);
+    if (!rcv_enabled() && !is_flat() && !router_debug_) {
+        timing_driven_expand_neighbours_batched(current,
+                                                from_node,
+                                                edges,
+                                                cost_params,
+                                                bounding_box,
+                                                target_node,
+                                                target_bb);
+        return;
     }
 
     for (RREdgeId from_edge : edges) {
-        RRNodeId to_node = rr_nodes_.edge_sink_node(from_edge);
+        RRNodeId to_node = rr_nodes_.edge_hot(from_edge).dest_node;
         timing_driven_expand_neighbour(current,
                                        from_node,
                                        from_edge,
@@ -498,18 +526,171 @@ void ConnectionRouter<Heap>::timing_driven_expand_neighbours(t_heap* current,
     }
 }
 
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_expand_neighbours_batched(const t_heap* current,
+                                                                                              RRNodeId from_node,
+                                                                                              vtr::StrongIdRange<RREdgeId> edges,
+                                                                                              const t_conn_cost_params& cost_params,
+                                                                                              const t_bb& bounding_box,
+                                                                                              RRNodeId target_node,
+                                                                                              const t_bb& target_bb) {
+    const auto& device_ctx = g_vpr_ctx.device();
+    VTR_ASSERT(bounding_box.layer_max < device_ctx.grid.get_num_layers());
+
+    // Per edge data of the current batch, for the edges which survived pruning
+    RREdgeId batch_edge[kExpansionBatchSize];
+    RRNodeId batch_node[kExpansionBatchSize];
+    float batch_switch_R[kExpansionBatchSize];
+    float batch_switch_Tdel[kExpansionBatchSize];
+    float batch_switch_Cinternal[kExpansionBatchSize];
+    bool batch_switch_buffered[kExpansionBatchSize];
+    float batch_node_R[kExpansionBatchSize];
+    float batch_node_C[kExpansionBatchSize];
+    float batch_cong_cost[kExpansionBatchSize];
+    float batch_bend_cost[kExpansionBatchSize];
+
+    // Evaluated costs of the current batch
+    float batch_R_upstream[kExpansionBatchSize];
+    float batch_backward_cost[kExpansionBatchSize];
+
+    const float from_node_R = rr_rc_data_[rr_graph_->node_rc_index(from_node)].R;
+    const t_rr_type from_type = rr_graph_->node_type(from_node);
+
+    auto edge_itr = edges.begin();
+    while (edge_itr != edges.end()) {
+        // Gather the edges of this batch which survive BB and IPIN pruning,
+        // using the same criteria as timing_driven_expand_neighbour
+        size_t num_edges = 0;
+        for (; edge_itr != edges.end() && num_edges < kExpansionBatchSize; ++edge_itr) {
+            RREdgeId from_edge = *edge_itr;
+            t_rr_hot_edge edge = rr_nodes_.edge_hot(from_edge);
+            RRNodeId to_node = edge.dest_node;
+
+            int to_xlow = rr_graph_->node_xlow(to_node);
+            int to_ylow = rr_graph_->node_ylow(to_node);
+            int to_xhigh = rr_graph_->node_xhigh(to_node);
+            int to_yhigh = rr_graph_->node_yhigh(to_node);
+            int to_layer = rr_graph_->node_layer(to_node);
+            if (to_xhigh < bounding_box.xmin
+                || to_xlow > bounding_box.xmax
+                || to_yhigh < bounding_box.ymin
+                || to_ylow > bounding_box.ymax
+                || to_layer < bounding_box.layer_min
+                || to_layer > bounding_box.layer_max) {
+                continue;
+            }
+
+            t_rr_type to_type = rr_graph_->node_type(to_node);
+            if (target_node != RRNodeId::INVALID() && to_type == IPIN
+                && (to_xlow < target_bb.xmin
+                    || to_ylow < target_bb.ymin
+                    || to_xhigh > target_bb.xmax
+                    || to_yhigh > target_bb.ymax
+                    || to_layer < target_bb.layer_min
+                    || to_layer > target_bb.layer_max)) {
+                continue;
+            }
+
+            const t_router_switch_inf& switch_inf = router_switch_inf_[edge.switch_id];
+            auto rc_index = rr_graph_->node_rc_index(to_node);
+
+            batch_edge[num_edges] = from_edge;
+            batch_node[num_edges] = to_node;
+            batch_switch_R[num_edges] = switch_inf.R;
+            batch_switch_Tdel[num_edges] = switch_inf.Tdel;
+            batch_switch_Cinternal[num_edges] = switch_inf.Cinternal;
+            batch_switch_buffered[num_edges] = switch_inf.buffered;
+            batch_node_R[num_edges] = rr_rc_data_[rc_index].R;
+            batch_node_C[num_edges] = rr_rc_data_[rc_index].C;
+
+            if (switch_inf.configurable) {
+                batch_cong_cost[num_edges] = get_rr_cong_cost(to_node, cost_params.pres_fac);
+            } else {
+                //Reached by a non-configurable edge, the congestion cost of the
+                //node set has already been accounted for
+#ifdef VTR_ASSERT_SAFE_ENABLED
+                VTR_ASSERT_SAFE_MSG(same_non_config_node_set(from_node, to_node),
+                                    "Non-configurably connected edges should be part of the same node set");
+#endif
+                batch_cong_cost[num_edges] = 0.;
+            }
+
+            bool is_bend = (from_type == CHANX && to_type == CHANY) || (from_type == CHANY && to_type == CHANX);
+            batch_bend_cost[num_edges] = is_bend ? cost_params.bend_cost : 0.f;
+
+            ++num_edges;
+        }
+
+        // Evaluate the delay and backward cost of each gathered edge. This
+        // is the arithmetic of evaluate_timing_driven_node_costs, kept in
+        // the same order so the results are bit-identical.
+        for (size_t i = 0; i < num_edges; ++i) {
+            float R_upstream = batch_switch_buffered[i] ? 0.f : current->R_upstream;
+            R_upstream += batch_switch_R[i];
+            R_upstream += batch_node_R[i];
+
+            float Rdel = R_upstream - 0.5 * batch_node_R[i];
+            float Tdel = batch_switch_Tdel[i] + Rdel * batch_node_C[i];
+            float Rdel_adjust = R_upstream - 0.5 * from_node_R;
+            Tdel += Rdel_adjust * batch_switch_Cinternal[i];
+
+            float backward_cost = current->backward_path_cost;
+            backward_cost += (1. - cost_params.criticality) * batch_cong_cost[i];
+            backward_cost += cost_params.criticality * Tdel;
+            backward_cost += batch_bend_cost[i];
+
+            batch_R_upstream[i] = R_upstream;
+            batch_backward_cost[i] = backward_cost;
+        }
+
+        // Add the edges to the heap (in edge order) if they improve on the
+        // best known costs
+        t_heap* batch_items[kExpansionBatchSize];
+        size_t num_items = 0;
+        for (size_t i = 0; i < num_edges; ++i) {
+            RRNodeId to_node = batch_node[i];
+            float expected_cost = router_lookahead_.get_expected_cost(to_node,
+                                                                      target_node,
+                                                                      cost_params,
+                                                                      batch_R_upstream[i]);
+            float total_cost = 0.;
+            total_cost += batch_backward_cost[i] + cost_params.astar_fac * expected_cost;
+
+            const t_rr_node_path_inf& to_path_inf = rr_node_path_inf_[to_node];
+            if (total_cost < path_cost(to_path_inf)
+                && batch_backward_cost[i] < backward_path_cost(to_path_inf)) {
+                t_heap* next_ptr = heap_.alloc();
+                next_ptr->cost = total_cost;
+                next_ptr->R_upstream = batch_R_upstream[i];
+                next_ptr->backward_path_cost = batch_backward_cost[i];
+                next_ptr->index = to_node;
+                next_ptr->set_prev_edge(batch_edge[i]);
+                next_ptr->set_prev_node(from_node);
+
+                batch_items[num_items++] = next_ptr;
+                update_router_stats(device_ctx,
+                                    rr_graph_,
+                                    router_stats_,
+                                    to_node,
+                                    true);
+            }
+        }
+        heap_.add_batch_to_heap(batch_items, num_items);
+    }
+}
+
 // Conditionally adds to_node to the router heap (via path from from_node via from_edge).
 // RR nodes outside the expanded bounding box specified in bounding_box are not added
 // to the heap.
-template<typename Heap>
-void ConnectionRouter<Heap>::timing_driven_expand_neighbour(t_heap* current,
-                                                            RRNodeId from_node,
-                                                            RREdgeId from_edge,
-                                                            RRNodeId to_node,
-                                                            const t_conn_cost_params cost_params,
-                                                            const t_bb bounding_box,
-                                                            RRNodeId target_node,
-                                                            const t_bb target_bb) {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_expand_neighbour(t_heap* current,
+                                                                                     RRNodeId from_node,
+                                                                                     RREdgeId from_edge,
+                                                                                     RRNodeId to_node,
+                                                                                     const t_conn_cost_params cost_params,
+                                                                                     const t_bb bounding_box,
+                                                                                     RRNodeId target_node,
+                                                                                     const t_bb target_bb) {
     int to_xlow = rr_graph_->node_xlow(to_node);
     int to_ylow = rr_graph_->node_ylow(to_node);
     int to_xhigh = rr_graph_->node_xhigh(to_node);
@@ -527,7 +708,7 @@ void ConnectionRouter<Heap>::timing_driven_expand_neighbour(t_heap* current,
          || to_ylow > bounding_box.ymax
          || to_layer < bounding_box.layer_min
          || to_layer > bounding_box.layer_max) // Strictly above BB top-edge
-        && !rcv_path_manager.is_enabled()) {
+        && !rcv_enabled()) {
         VTR_LOGV_DEBUG(router_debug_,
                        "      Pruned expansion of node %d edge %zu -> %d"
                        " (to node location %d,%d,%d x %d,%d,%d outside of expanded"
@@ -575,12 +756,12 @@ void ConnectionRouter<Heap>::timing_driven_expand_neighbour(t_heap* current,
     // Check if the node exists in the route tree when RCV is enabled
     // Other pruning methods have been disabled when RCV is on, so this method is required to prevent "loops" from being created
     bool node_exists = false;
-    if (rcv_path_manager.is_enabled()) {
+    if (rcv_enabled()) {
         node_exists = rcv_path_manager.node_exists_in_tree(current->path_data,
                                                            to_node);
     }
 
-    if (!node_exists || !rcv_path_manager.is_enabled()) {
+    if (!node_exists || !rcv_enabled()) {
         timing_driven_add_to_heap(cost_params,
                                   current,
                                   from_node,
@@ -591,13 +772,13 @@ void ConnectionRouter<Heap>::timing_driven_expand_neighbour(t_heap* current,
 }
 
 // Add to_node to the heap, and also add any nodes which are connected by non-configurable edges
-template<typename Heap>
-void ConnectionRouter<Heap>::timing_driven_add_to_heap(const t_conn_cost_params cost_params,
-                                                       const t_heap* current,
-                                                       RRNodeId from_node,
-                                                       RRNodeId to_node,
-                                                       const RREdgeId from_edge,
-                                                       RRNodeId target_node) {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_add_to_heap(const t_conn_cost_params cost_params,
+                                                                                const t_heap* current,
+                                                                                RRNodeId from_node,
+                                                                                RRNodeId to_node,
+                                                                                const RREdgeId from_edge,
+                                                                                RRNodeId target_node) {
     const auto& device_ctx = g_vpr_ctx.device();
     t_heap next;
 
@@ -609,7 +790,7 @@ void ConnectionRouter<Heap>::timing_driven_add_to_heap(const t_conn_cost_params
     next.backward_path_cost = current->backward_path_cost;
 
     // path_data variables are initialized to current values
-    if (rcv_path_manager.is_enabled() && current->path_data) {
+    if (rcv_enabled() && current->path_data) {
         next.path_data->backward_cong = current->path_data->backward_cong;
         next.path_data->backward_delay = current->path_data->backward_delay;
     }
@@ -623,19 +804,19 @@ void ConnectionRouter<Heap>::timing_driven_add_to_heap(const t_conn_cost_params
                                       from_edge,
                                       target_node);
 
-    float best_total_cost = rr_node_route_inf_[to_node].path_cost;
-    float best_back_cost = rr_node_route_inf_[to_node].backward_path_cost;
+    float best_total_cost = path_cost(rr_node_path_inf_[to_node]);
+    float best_back_cost = backward_path_cost(rr_node_path_inf_[to_node]);
 
     float new_total_cost = next.cost;
     float new_back_cost = next.backward_path_cost;
 
-    if (new_total_cost < best_total_cost && ((rcv_path_manager.is_enabled()) || (new_back_cost < best_back_cost))) {
+    if (new_total_cost < best_total_cost && ((rcv_enabled()) || (new_back_cost < best_back_cost))) {
         VTR_LOGV_DEBUG(router_debug_, "      Expanding to node %d (%s)\n", to_node,
                        describe_rr_node(device_ctx.rr_graph,
                                         device_ctx.grid,
                                         device_ctx.rr_indexed_data,
                                         to_node,
-                                        is_flat_)
+                                        is_flat())
                            .c_str());
         VTR_LOGV_DEBUG(router_debug_, "        New Total Cost %g New back Cost %g\n", new_total_cost, new_back_cost);
         //Add node to the heap only if the cost via the current partial path is less than the
@@ -646,7 +827,7 @@ void ConnectionRouter<Heap>::timing_driven_add_to_heap(const t_conn_cost_params
         t_heap* next_ptr = heap_.alloc();
 
         // Use the already created next path structure pointer when RCV is enabled
-        if (rcv_path_manager.is_enabled()) rcv_path_manager.move(next_ptr->path_data, next.path_data);
+        if (rcv_enabled()) rcv_path_manager.move(next_ptr->path_data, next.path_data);
 
         //Record how we reached this node
         next_ptr->cost = next.cost;
@@ -656,7 +837,7 @@ void ConnectionRouter<Heap>::timing_driven_add_to_heap(const t_conn_cost_params
         next_ptr->set_prev_edge(from_edge);
         next_ptr->set_prev_node(from_node);
 
-        if (rcv_path_manager.is_enabled() && current->path_data) {
+        if (rcv_enabled() && current->path_data) {
             next_ptr->path_data->path_rr = current->path_data->path_rr;
             next_ptr->path_data->edge = current->path_data->edge;
             next_ptr->path_data->path_rr.emplace_back(from_node);
@@ -671,12 +852,12 @@ void ConnectionRouter<Heap>::timing_driven_add_to_heap(const t_conn_cost_params
                             true);
 
     } else {
-        VTR_LOGV_DEBUG(router_debug_, "      Didn't expand to %d (%s)\n", to_node, describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, to_node, is_flat_).c_str());
+        VTR_LOGV_DEBUG(router_debug_, "      Didn't expand to %d (%s)\n", to_node, describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, to_node, is_flat()).c_str());
         VTR_LOGV_DEBUG(router_debug_, "        Prev Total Cost %g Prev back Cost %g \n", best_total_cost, best_back_cost);
         VTR_LOGV_DEBUG(router_debug_, "        New Total Cost %g New back Cost %g \n", new_total_cost, new_back_cost);
     }
 
-    if (rcv_path_manager.is_enabled() && next.path_data != nullptr) {
+    if (rcv_enabled() && next.path_data != nullptr) {
         rcv_path_manager.free_path_struct(next.path_data);
     }
 }
@@ -700,19 +881,19 @@ static bool same_non_config_node_set(RRNodeId from_node, RRNodeId to_node) {
 
 #endif
 
-template<typename Heap>
-float ConnectionRouter<Heap>::compute_node_cost_using_rcv(const t_conn_cost_params cost_params,
-                                                          RRNodeId to_node,
-                                                          RRNodeId target_node,
-                                                          float backwards_delay,
-                                                          float backwards_cong,
-                                                          float R_upstream) {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+float ConnectionRouter<Heap, Lookahead, kAllFeatures>::compute_node_cost_using_rcv(const t_conn_cost_params cost_params,
+                                                                                   RRNodeId to_node,
+                                                                                   RRNodeId target_node,
+                                                                                   float backwards_delay,
+                                                                                   float backwards_cong,
+                                                                                   float R_upstream) {
     float expected_delay;
     float expected_cong;
 
     const t_conn_delay_budget* delay_budget = cost_params.delay_budget;
     // TODO: This function is not tested for is_flat == true
-    VTR_ASSERT(is_flat_ != true);
+    VTR_ASSERT(is_flat() != true);
     std::tie(expected_delay, expected_cong) = router_lookahead_.get_expected_delay_and_cong(to_node, target_node, cost_params, R_upstream);
 
     float expected_total_delay_cost;
@@ -740,26 +921,327 @@ float ConnectionRouter<Heap>::compute_node_cost_using_rcv(const t_conn_cost_para
     return total_cost;
 }
 
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::set_bidirectional_search_threshold(int threshold) {
+    bidir_search_threshold_ = threshold;
+
+    if (bidir_search_threshold_ >= 0) {
+        VTR_ASSERT_MSG(rr_graph_->has_fan_in_edges(),
+                       "Bidirectional search requires the RR graph fan-in edges to be initialized");
+        bwd_path_cost_.resize(rr_nodes_.size(), std::numeric_limits<float>::infinity());
+        bwd_next_edge_.resize(rr_nodes_.size(), RREdgeId::INVALID());
+    } else {
+        // Release the backward search state
+        bwd_path_cost_ = vtr::vector<RRNodeId, float>();
+        bwd_next_edge_ = vtr::vector<RRNodeId, RREdgeId>();
+        bwd_modified_nodes_ = std::vector<RRNodeId>();
+    }
+}
+
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+bool ConnectionRouter<Heap, Lookahead, kAllFeatures>::use_bidirectional_search(RRNodeId source_node, RRNodeId sink_node) {
+    // The backward search does not model RCV's path based costs, nor the
+    // intra-cluster resources used by the flat router
+    if (bidir_search_threshold_ < 0 || rcv_enabled() || is_flat()) {
+        return false;
+    }
+
+    int dx = std::abs(rr_graph_->node_xlow(sink_node) - rr_graph_->node_xlow(source_node));
+    int dy = std::abs(rr_graph_->node_ylow(sink_node) - rr_graph_->node_ylow(source_node));
+    return dx + dy > bidir_search_threshold_;
+}
+
+// Finds a path to sink_node by alternating between expanding the forward
+// search (from the route tree elements in the heap) and the backward search
+// (from the sink).
+//
+// A node settled by one search and reached by the other is a meeting point;
+// the path through it costs its forward cost plus its backward cost. The
+// search stops once the cheapest unexpanded forward element costs at least as
+// much as the best meeting point, or the forward search reaches the sink.
+//
+// Note that the forward heap is ordered by the A* total cost (known cost plus
+// astar_fac times the lookahead estimate), while the meeting cost is a known
+// path cost. The stop test is therefore only exact when the lookahead is
+// admissible (astar_fac <= 1 and the lookahead never over-estimates); otherwise
+// it may stop before finding the cheapest meeting point. This is the same
+// optimality trade-off the forward A* search already makes, and the backward
+// search (which has no lookahead) does not tighten or loosen it.
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+t_heap* ConnectionRouter<Heap, Lookahead, kAllFeatures>::timing_driven_route_connection_bidirectional(RRNodeId sink_node,
+                                                                                                      const t_conn_cost_params cost_params,
+                                                                                                      t_bb bounding_box) {
+    VTR_ASSERT_SAFE(heap_.is_valid());
+    VTR_ASSERT(!rcv_enabled());
+
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    // Seed the backward search with the sink
+    bwd_path_cost_[sink_node] = 0.;
+    bwd_modified_nodes_.push_back(sink_node);
+    t_heap* sink_item = bwd_heap_.alloc();
+    sink_item->index = sink_node;
+    sink_item->cost = 0.;
+    sink_item->backward_path_cost = 0.;
+    bwd_heap_.add_to_heap(sink_item);
+
+    RRNodeId best_meet_node = RRNodeId::INVALID();
+    float best_meet_cost = std::numeric_limits<float>::infinity();
+
+    t_heap* cheapest = nullptr;
+    while (!heap_.is_empty_heap()) {
+        cheapest = heap_.get_heap_head();
+        update_router_stats(device_ctx,
+                            rr_graph_,
+                            router_stats_,
+                            cheapest->index,
+                            false);
+
+        RRNodeId inode = cheapest->index;
+        VTR_LOGV_DEBUG(router_debug_, "  Popping node %d (cost: %g)\n",
+                       inode, cheapest->cost);
+
+        if (inode == sink_node || cheapest->cost >= best_meet_cost) {
+            break;
+        }
+
+        timing_driven_expand_cheapest(cheapest,
+                                      sink_node,
+                                      cost_params,
+                                      bounding_box);
+
+        // Has the forward search settled a node already reached backwards?
+        float meet_cost = backward_path_cost(rr_node_path_inf_[inode]) + bwd_path_cost_[inode];
+        if (meet_cost < best_meet_cost) {
+            best_meet_node = inode;
+            best_meet_cost = meet_cost;
+        }
+
+        heap_.free(cheapest);
+        cheapest = nullptr;
+
+        if (!bwd_heap_.is_empty_heap()) {
+            bidirectional_expand_backward(cost_params, bounding_box, best_meet_node, best_meet_cost);
+        }
+    }
+
+    if (cheapest != nullptr && cheapest->index == sink_node && cheapest->backward_path_cost <= best_meet_cost) {
+        // The forward search reached the sink on its own
+        VTR_LOGV_DEBUG(router_debug_, "  Found target %8d (%s)\n", sink_node, describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, sink_node, is_flat()).c_str());
+        reset_bidirectional_search();
+        return cheapest;
+    }
+
+    // The forward element the search stopped on (if any) is still part of
+    // the forward frontier; it is only released once the path is committed.
+    t_heap* frontier = cheapest;
+    cheapest = nullptr;
+
+    if (best_meet_node.is_valid()) {
+        VTR_LOGV_DEBUG(router_debug_, "  Forward and backward search met at node %d (cost: %g)\n",
+                       best_meet_node, best_meet_cost);
+        cheapest = commit_bidirectional_path(best_meet_node, best_meet_cost, sink_node);
+    }
+
+    reset_bidirectional_search();
+
+    if (cheapest != nullptr) {
+        if (frontier != nullptr) {
+            heap_.free(frontier);
+        }
+        return cheapest;
+    }
+
+    if (best_meet_node.is_valid()) {
+        // The two halves of the path could not be joined, fall back to a
+        // regular search from the remaining forward heap elements (including
+        // the one the bidirectional search stopped on).
+        VTR_LOGV_DEBUG(router_debug_, "  Bidirectional search failed, continuing with forward search\n");
+        if (frontier != nullptr) {
+            heap_.add_to_heap(frontier);
+        }
+        return timing_driven_route_connection_from_heap(sink_node, cost_params, bounding_box);
+    }
+
+    if (frontier != nullptr) {
+        heap_.free(frontier);
+    }
+
+    VTR_LOGV_DEBUG(router_debug_, "  Empty heap (no path found)\n");
+
+    return nullptr;
+}
+
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::bidirectional_expand_backward(const t_conn_cost_params cost_params,
+                                                                                    t_bb bounding_box,
+                                                                                    RRNodeId& best_meet_node,
+                                                                                    float& best_meet_cost) {
+    t_heap* cheapest = bwd_heap_.get_heap_head();
+    RRNodeId to_node = cheapest->index;
+    float to_cost = cheapest->backward_path_cost;
+    bwd_heap_.free(cheapest);
+
+    if (to_cost > bwd_path_cost_[to_node] || to_cost >= best_meet_cost) {
+        // Stale entry, or can not lead to a cheaper meeting point
+        return;
+    }
+
+    for (RREdgeId from_edge : rr_graph_->node_fan_in_edges(to_node)) {
+        RRNodeId from_node = rr_graph_->edge_src_node(from_edge);
+
+        int from_layer = rr_graph_->node_layer(from_node);
+        if (rr_graph_->node_xhigh(from_node) < bounding_box.xmin
+            || rr_graph_->node_xlow(from_node) > bounding_box.xmax
+            || rr_graph_->node_yhigh(from_node) < bounding_box.ymin
+            || rr_graph_->node_ylow(from_node) > bounding_box.ymax
+            || from_layer < bounding_box.layer_min
+            || from_layer > bounding_box.layer_max) {
+            continue; /* Node is outside (expanded) bounding box. */
+        }
+
+        float from_cost = to_cost + backward_edge_cost(cost_params, from_node, from_edge, to_node);
+        if (from_cost >= bwd_path_cost_[from_node]) {
+            continue;
+        }
+
+        if (std::isinf(bwd_path_cost_[from_node])) {
+            bwd_modified_nodes_.push_back(from_node);
+        }
+        bwd_path_cost_[from_node] = from_cost;
+        bwd_next_edge_[from_node] = from_edge;
+
+        // Has the backward search reached a node already settled forwards?
+        float meet_cost = backward_path_cost(rr_node_path_inf_[from_node]) + from_cost;
+        if (meet_cost < best_meet_cost) {
+            best_meet_node = from_node;
+            best_meet_cost = meet_cost;
+        }
+
+        t_heap* next = bwd_heap_.alloc();
+        next->index = from_node;
+        next->cost = from_cost;
+        next->backward_path_cost = from_cost;
+        bwd_heap_.add_to_heap(next);
+    }
+}
+
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+float ConnectionRouter<Heap, Lookahead, kAllFeatures>::backward_edge_cost(const t_conn_cost_params cost_params,
+                                                                          RRNodeId from_node,
+                                                                          RREdgeId from_edge,
+                                                                          RRNodeId to_node) const {
+    int iswitch = rr_nodes_.edge_switch(from_edge);
+    const t_rr_switch_inf& switch_inf = rr_switch_inf_[iswitch];
+
+    float node_C = rr_rc_data_[rr_graph_->node_rc_index(to_node)].C;
+    float node_R = rr_rc_data_[rr_graph_->node_rc_index(to_node)].R;
+    float from_node_R = rr_rc_data_[rr_graph_->node_rc_index(from_node)].R;
+
+    // Same delay model as evaluate_timing_driven_node_costs, assuming that
+    // from_node is driven through a buffer (i.e. no upstream resistance)
+    float R_upstream = switch_inf.R + node_R;
+    float Tdel = switch_inf.Tdel + (R_upstream - 0.5 * node_R) * node_C;
+    Tdel += (R_upstream - 0.5 * from_node_R) * switch_inf.Cinternal;
+
+    float cong_cost = 0.;
+    if (switch_inf.configurable()) {
+        cong_cost = get_rr_cong_cost(to_node, cost_params.pres_fac);
+    }
+
+    float cost = (1. - cost_params.criticality) * cong_cost + cost_params.criticality * Tdel;
+
+    if (cost_params.bend_cost != 0.) {
+        t_rr_type from_type = rr_graph_->node_type(from_node);
+        t_rr_type to_type = rr_graph_->node_type(to_node);
+        if ((from_type == CHANX && to_type == CHANY) || (from_type == CHANY && to_type == CHANX)) {
+            cost += cost_params.bend_cost;
+        }
+    }
+
+    return cost;
+}
+
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+t_heap* ConnectionRouter<Heap, Lookahead, kAllFeatures>::commit_bidirectional_path(RRNodeId meet_node,
+                                                                                   float meet_cost,
+                                                                                   RRNodeId sink_node) {
+    // Collect the forward half of the path (meet_node back to the route tree)
+    std::unordered_set<RRNodeId> forward_path;
+    for (RRNodeId inode = meet_node; inode.is_valid(); inode = rr_node_path_inf_[inode].prev_node) {
+        if (!forward_path.insert(inode).second || forward_path.size() > rr_nodes_.size()) {
+            return nullptr;
+        }
+    }
+
+    // Make sure the backward half does not revisit the forward half
+    for (RRNodeId inode = meet_node; inode != sink_node;) {
+        inode = rr_nodes_.edge_sink_node(bwd_next_edge_[inode]);
+        if (inode != sink_node && forward_path.count(inode)) {
+            return nullptr;
+        }
+    }
+
+    // Record the backward half as if it had been found by the forward search
+    float forward_cost = backward_path_cost(rr_node_path_inf_[meet_node]);
+    RRNodeId prev_node = meet_node;
+    RREdgeId prev_edge = bwd_next_edge_[meet_node];
+    RRNodeId inode = rr_nodes_.edge_sink_node(prev_edge);
+    while (inode != sink_node) {
+        set_path(&rr_node_path_inf_[inode],
+                 prev_node,
+                 prev_edge,
+                 meet_cost,
+                 forward_cost + (bwd_path_cost_[meet_node] - bwd_path_cost_[inode]));
+
+        prev_node = inode;
+        prev_edge = bwd_next_edge_[inode];
+        inode = rr_nodes_.edge_sink_node(prev_edge);
+    }
+
+    t_heap* cheapest = heap_.alloc();
+    cheapest->index = sink_node;
+    cheapest->cost = meet_cost;
+    cheapest->backward_path_cost = meet_cost;
+    cheapest->R_upstream = 0.;
+    cheapest->set_prev_node(prev_node);
+    cheapest->set_prev_edge(prev_edge);
+
+    return cheapest;
+}
+
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::reset_bidirectional_search() {
+    for (RRNodeId inode : bwd_modified_nodes_) {
+        bwd_path_cost_[inode] = std::numeric_limits<float>::infinity();
+        bwd_next_edge_[inode] = RREdgeId::INVALID();
+    }
+    bwd_modified_nodes_.clear();
+    bwd_heap_.empty_heap();
+}
+
 // Empty the route tree set node, use this after each net is routed
-template<typename Heap>
-void ConnectionRouter<Heap>::empty_rcv_route_tree_set() {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::empty_rcv_route_tree_set() {
     rcv_path_manager.empty_route_tree_nodes();
 }
 
 // Enable or disable RCV
-template<typename Heap>
-void ConnectionRouter<Heap>::set_rcv_enabled(bool enable) {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::set_rcv_enabled(bool enable) {
+    //RCV is compiled out of the common case routers, see use_common_case_connection_router()
+    VTR_ASSERT(kAllFeatures || !enable);
     rcv_path_manager.set_enabled(enable);
 }
 
 //Calculates the cost of reaching to_node
-template<typename Heap>
-void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
-                                                               const t_conn_cost_params cost_params,
-                                                               RRNodeId from_node,
-                                                               RRNodeId to_node,
-                                                               RREdgeId from_edge,
-                                                               RRNodeId target_node) {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::evaluate_timing_driven_node_costs(t_heap* to,
+                                                                                        const t_conn_cost_params cost_params,
+                                                                                        RRNodeId from_node,
+                                                                                        RRNodeId to_node,
+                                                                                        RREdgeId from_edge,
+                                                                                        RRNodeId target_node) {
     /* new_costs.backward_cost: is the "known" part of the cost to this node -- the
      * congestion cost of all the routing resources back to the existing route
      * plus the known delay of the total path back to the source.
@@ -770,12 +1252,12 @@ void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
      */
 
     //Info for the switch connecting from_node to_node
-    int iswitch = rr_nodes_.edge_switch(from_edge);
-    bool switch_buffered = rr_switch_inf_[iswitch].buffered();
-    bool reached_configurably = rr_switch_inf_[iswitch].configurable();
-    float switch_R = rr_switch_inf_[iswitch].R;
-    float switch_Tdel = rr_switch_inf_[iswitch].Tdel;
-    float switch_Cinternal = rr_switch_inf_[iswitch].Cinternal;
+    const t_router_switch_inf& switch_inf = router_switch_inf_[rr_nodes_.edge_hot(from_edge).switch_id];
+    bool switch_buffered = switch_inf.buffered;
+    bool reached_configurably = switch_inf.configurable;
+    float switch_R = switch_inf.R;
+    float switch_Tdel = switch_inf.Tdel;
+    float switch_Cinternal = switch_inf.Cinternal;
 
     //To node info
     auto rc_index = rr_graph_->node_rc_index(to_node);
@@ -831,7 +1313,7 @@ void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
         //cost.
         cong_cost = 0.;
     }
-    if (conn_params_->has_choking_spot_ && is_flat_ && rr_graph_->node_type(to_node) == IPIN) {
+    if (conn_params_->has_choking_spot_ && is_flat() && rr_graph_->node_type(to_node) == IPIN) {
         auto find_res = conn_params_->connection_choking_spots_.find(to_node);
         if (find_res != conn_params_->connection_choking_spots_.end()) {
             cong_cost = cong_cost / pow(2, (float)find_res->second);
@@ -852,7 +1334,7 @@ void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
 
     float total_cost = 0.;
 
-    if (rcv_path_manager.is_enabled() && to->path_data != nullptr) {
+    if (rcv_enabled() && to->path_data != nullptr) {
         to->path_data->backward_delay += cost_params.criticality * Tdel;
         to->path_data->backward_cong += (1. - cost_params.criticality) * get_rr_cong_cost(to_node, cost_params.pres_fac);
 
@@ -866,18 +1348,18 @@ void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
                                                                   to->R_upstream);
         VTR_LOGV_DEBUG(router_debug_ && !std::isfinite(expected_cost),
                        "        Lookahead from %s (%s) to %s (%s) is non-finite, expected_cost = %f, to->R_upstream = %f\n",
-                       rr_node_arch_name(to_node, is_flat_).c_str(),
-                       describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, to_node, is_flat_).c_str(),
-                       rr_node_arch_name(target_node, is_flat_).c_str(),
-                       describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, target_node, is_flat_).c_str(),
+                       rr_node_arch_name(to_node, is_flat()).c_str(),
+                       describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, to_node, is_flat()).c_str(),
+                       rr_node_arch_name(target_node, is_flat()).c_str(),
+                       describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, target_node, is_flat()).c_str(),
                        expected_cost, to->R_upstream);
         total_cost += to->backward_path_cost + cost_params.astar_fac * expected_cost;
     }
     to->cost = total_cost;
 }
 
-template<typename Heap>
-void ConnectionRouter<Heap>::empty_heap_annotating_node_route_inf() {
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::empty_heap_annotating_node_route_inf() {
     //Pop any remaining nodes in the heap and annotate their costs
     //
     //Useful for visualizing router expansion in graphics, as it shows
@@ -887,9 +1369,14 @@ void ConnectionRouter<Heap>::empty_heap_annotating_node_route_inf() {
     while (!heap_.is_empty_heap()) {
         t_heap* tmp = heap_.get_heap_head();
 
-        rr_node_route_inf_[tmp->index].path_cost = tmp->cost;
-        rr_node_route_inf_[tmp->index].backward_path_cost = tmp->backward_path_cost;
-        modified_rr_node_inf_.push_back(tmp->index);
+        t_rr_node_path_inf* path_inf = &rr_node_path_inf_[tmp->index];
+        if (path_inf->path_epoch == path_epoch_) {
+            //Keep the path to nodes already reached
+            path_inf->path_cost = tmp->cost;
+            path_inf->backward_path_cost = tmp->backward_path_cost;
+        } else {
+            set_path(path_inf, RRNodeId::INVALID(), RREdgeId::INVALID(), tmp->cost, tmp->backward_path_cost);
+        }
 
         rcv_path_manager.free_path_struct(tmp->path_data);
         heap_.free(tmp);
@@ -898,8 +1385,8 @@ void ConnectionRouter<Heap>::empty_heap_annotating_node_route_inf() {
 
 //Adds the route tree rooted at rt_node to the heap, preparing it to be
 //used as branch-points for further routing.
-template<typename Heap>
-void ConnectionRouter<Heap>::add_route_tree_to_heap(
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::add_route_tree_to_heap(
     const RouteTreeNode& rt_node,
     RRNodeId target_node,
     const t_conn_cost_params cost_params,
@@ -917,7 +1404,7 @@ void ConnectionRouter<Heap>::add_route_tree_to_heap(
     /* Pre-order depth-first traversal */
     // IPINs and SINKS are not re_expanded
     if (rt_node.re_expand) {
-        if (target_node.is_valid() && !has_path_to_sink(rr_nodes_, rr_graph_, RRNodeId(rt_node.inode), RRNodeId(target_node), only_opin_inter_layer)) {
+        if (target_node.is_valid() && !has_path_to_sink(rr_nodes_, rr_graph_, RRNodeId(rt_node.inode), RRNodeId(target_node), only_opin_inter_layer())) {
             return;
         }
         add_route_tree_node_to_heap(rt_node,
@@ -927,7 +1414,7 @@ void ConnectionRouter<Heap>::add_route_tree_to_heap(
     }
 
     for (const RouteTreeNode& child_node : rt_node.child_nodes()) {
-        if (is_flat_) {
+        if (is_flat()) {
             if (relevant_node_to_target(rr_graph_,
                                         child_node.inode,
                                         target_node)) {
@@ -949,8 +1436,8 @@ void ConnectionRouter<Heap>::add_route_tree_to_heap(
 //
 //Note that if you want to respect rt_node.re_expand that is the caller's
 //responsibility.
-template<typename Heap>
-void ConnectionRouter<Heap>::add_route_tree_node_to_heap(
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+void ConnectionRouter<Heap, Lookahead, kAllFeatures>::add_route_tree_node_to_heap(
     const RouteTreeNode& rt_node,
     RRNodeId target_node,
     const t_conn_cost_params cost_params,
@@ -966,7 +1453,7 @@ void ConnectionRouter<Heap>::add_route_tree_node_to_heap(
      * Integrated Circuits and Systems, vol. 27, no. 4, pp. 686-697, April 2008.*/
     // float expected_cost = router_lookahead_.get_expected_cost(inode, target_node, cost_params, R_upstream);
 
-    if (!rcv_path_manager.is_enabled()) {
+    if (!rcv_enabled()) {
         // tot_cost = backward_path_cost + cost_params.astar_fac * expected_cost;
         float tot_cost = backward_path_cost
                          + cost_params.astar_fac
@@ -977,9 +1464,9 @@ void ConnectionRouter<Heap>::add_route_tree_node_to_heap(
         VTR_LOGV_DEBUG(router_debug_, "  Adding node %8d to heap from init route tree with cost %g (%s)\n",
                        inode,
                        tot_cost,
-                       describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat_).c_str());
+                       describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat()).c_str());
 
-        push_back_node(&heap_, rr_node_route_inf_,
+        push_back_node(&heap_, path_cost(rr_node_path_inf_[inode]),
                        inode, tot_cost, RRNodeId::INVALID(), RREdgeId::INVALID(),
                        backward_path_cost, R_upstream);
     } else {
@@ -1018,8 +1505,8 @@ static t_bb adjust_highfanout_bounding_box(t_bb highfanout_bb) {
     return bb;
 }
 
-template<typename Heap>
-t_bb ConnectionRouter<Heap>::add_high_fanout_route_tree_to_heap(
+template<typename Heap, typename Lookahead, bool kAllFeatures>
+t_bb ConnectionRouter<Heap, Lookahead, kAllFeatures>::add_high_fanout_route_tree_to_heap(
     const RouteTreeNode& rt_root,
     RRNodeId target_node,
     const t_conn_cost_params cost_params,
@@ -1068,12 +1555,12 @@ t_bb ConnectionRouter<Heap>::add_high_fanout_route_tree_to_heap(
                 if (!rt_node.re_expand) continue; //Some nodes (like IPINs) shouldn't be re-expanded
                 RRNodeId rr_node_to_add = rt_node.inode;
 
-                if (is_flat_) {
+                if (is_flat()) {
                     if (!relevant_node_to_target(rr_graph_, rr_node_to_add, target_node))
                         continue;
                 }
 
-                if (!has_path_to_sink(rr_nodes_, rr_graph_, RRNodeId(rt_node.inode), target_node, only_opin_inter_layer)) {
+                if (!has_path_to_sink(rr_nodes_, rr_graph_, RRNodeId(rt_node.inode), target_node, only_opin_inter_layer())) {
                     continue;
                 }
                 // Put the node onto the heap
@@ -1086,7 +1573,7 @@ t_bb ConnectionRouter<Heap>::add_high_fanout_route_tree_to_heap(
                 highfanout_bb.ymax = std::max<int>(highfanout_bb.ymax, rr_graph_->node_yhigh(rr_node_to_add));
                 highfanout_bb.layer_min = std::min<int>(highfanout_bb.layer_min, rr_graph_->node_layer(rr_node_to_add));
                 highfanout_bb.layer_max = std::max<int>(highfanout_bb.layer_max, rr_graph_->node_layer(rr_node_to_add));
-                if (is_flat_) {
+                if (is_flat()) {
                     if (rr_graph_->node_type(rr_node_to_add) == CHANY || rr_graph_->node_type(rr_node_to_add) == CHANX) {
                         chan_nodes_added++;
                     }
@@ -1207,7 +1694,7 @@ std::unique_ptr<ConnectionRouterInterface> make_connection_router(e_heap_type he
                                                                   const RRGraphView* rr_graph,
                                                                   const std::vector<t_rr_rc_data>& rr_rc_data,
                                                                   const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switch_inf,
-                                                                  vtr::vector<RRNodeId, t_rr_node_route_inf>& rr_node_route_inf,
+                                                                  vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf,
                                                                   bool is_flat) {
     switch (heap_type) {
         case e_heap_type::BINARY_HEAP:
@@ -1218,7 +1705,7 @@ std::unique_ptr<ConnectionRouterInterface> make_connection_router(e_heap_type he
                 rr_graph,
                 rr_rc_data,
                 rr_switch_inf,
-                rr_node_route_inf,
+                rr_node_path_inf,
                 is_flat);
         case e_heap_type::BUCKET_HEAP_APPROXIMATION:
             return std::make_unique<ConnectionRouter<Bucket>>(
@@ -1228,10 +1715,35 @@ std::unique_ptr<ConnectionRouterInterface> make_connection_router(e_heap_type he
                 rr_graph,
                 rr_rc_data,
                 rr_switch_inf,
-                rr_node_route_inf,
+                rr_node_path_inf,
+                is_flat);
+        case e_heap_type::FOUR_ARY_HEAP:
+            return std::make_unique<ConnectionRouter<FourAryHeap>>(
+                grid,
+                router_lookahead,
+                rr_nodes,
+                rr_graph,
+                rr_rc_data,
+                rr_switch_inf,
+                rr_node_path_inf,
                 is_flat);
         default:
             VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Unknown heap_type %d",
                             heap_type);
     }
-}
\ No newline at end of file
+}
+
+bool use_common_case_connection_router(const t_router_opts& router_opts,
+                                       const DeviceGrid& grid,
+                                       bool is_flat) {
+    return router_opts.lookahead_type == e_router_lookahead::MAP
+           && router_opts.routing_budgets_algorithm != YOYO
+           && grid.get_num_layers() == 1
+           && !is_flat;
+}
+
+// The common case routers are only named by the routers which dispatch to them
+// (see use_common_case_connection_router), so they are instantiated here.
+template class ConnectionRouter<BinaryHeap, MapLookahead, false>;
+template class ConnectionRouter<Bucket, MapLookahead, false>;
+template class ConnectionRouter<FourAryHeap, MapLookahead, false>;
@@ -5,6 +5,7 @@
 #include "rr_graph_storage.h"
 #include "route_common.h"
 #include "router_lookahead.h"
+#include "router_lookahead_map.h"
 #include "route_tree.h"
 #include "rr_rc_data.h"
 #include "router_stats.h"
@@ -13,15 +14,40 @@
 // Prune the heap when it contains 4x the number of nodes in the RR graph.
 constexpr size_t kHeapPruneFactor = 4;
 
+// Compact copy of the t_rr_switch_inf fields read when expanding an edge.
+// t_rr_switch_inf also holds the switch name and power data, and its
+// buffered() and configurable() are out-of-line calls, so the router keeps
+// its own 16 byte record per switch.
+struct t_router_switch_inf {
+    float R;
+    float Tdel;
+    float Cinternal;
+    bool buffered;
+    bool configurable;
+};
+
+// Number of out-going edges of a node whose costs are evaluated together by
+// ConnectionRouter::timing_driven_expand_neighbours_batched.
+constexpr size_t kExpansionBatchSize = 16;
+
 // This class encapsolates the timing driven connection router. This class
 // routes from some initial set of sources (via the input rt tree) to a
 // particular sink.
 //
 // When the ConnectionRouter is used, it mutates the provided
-// rr_node_route_inf.  The routed path can be found by tracing from the sink
-// node (which is returned) through the rr_node_route_inf.  See
+// rr_node_path_inf.  The routed path can be found by tracing from the sink
+// node (which is returned) through the rr_node_path_inf.  See
 // update_traceback as an example of this tracing.
-template<typename HeapImplementation>
+//
+// Besides the heap, the router can be specialized at compile time on:
+//  - LookaheadImplementation: the concrete type of the router lookahead (whose
+//    get_expected_cost must then be final), so that the lookahead calls of the
+//    expansion loop are direct (and inlinable) calls rather than virtual ones.
+//  - kAllFeatures: if false, RCV, flat routing and the 3D inter-layer pruning
+//    are compiled out of the expansion loop, instead of being tested at runtime.
+// Routers are specialized for the common case with CommonCaseConnectionRouter,
+// see use_common_case_connection_router().
+template<typename HeapImplementation, typename LookaheadImplementation = RouterLookahead, bool kAllFeatures = true>
 class ConnectionRouter : public ConnectionRouterInterface {
   public:
     ConnectionRouter(
@@ -31,34 +57,50 @@ class ConnectionRouter : public ConnectionRouterInterface {
         const RRGraphView* rr_graph,
         const std::vector<t_rr_rc_data>& rr_rc_data,
         const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switch_inf,
-        vtr::vector<RRNodeId, t_rr_node_route_inf>& rr_node_route_inf,
+        vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf,
         bool is_flat)
         : grid_(grid)
-        , router_lookahead_(router_lookahead)
+        , router_lookahead_(static_cast<const LookaheadImplementation&>(router_lookahead))
         , rr_nodes_(rr_nodes.view())
         , rr_graph_(rr_graph)
         , rr_rc_data_(rr_rc_data.data(), rr_rc_data.size())
         , rr_switch_inf_(rr_switch_inf.data(), rr_switch_inf.size())
         , net_terminal_groups(g_vpr_ctx.routing().net_terminal_groups)
         , net_terminal_group_num(g_vpr_ctx.routing().net_terminal_group_num)
-        , rr_node_route_inf_(rr_node_route_inf)
+        , rr_node_path_inf_(rr_node_path_inf)
+        , path_epoch_(new_path_search_epoch())
         , is_flat_(is_flat)
         , router_stats_(nullptr)
-        , router_debug_(false) {
+        , router_debug_(false)
+        , bidir_search_threshold_(-1) {
         heap_.init_heap(grid);
         heap_.set_prune_limit(rr_nodes_.size(), kHeapPruneFactor * rr_nodes_.size());
-        only_opin_inter_layer = (grid.get_num_layers() > 1) && inter_layer_connections_limited_to_opin(*rr_graph);
+        heap_.set_cost_scale_hint(router_lookahead.cost_scale());
+        bwd_heap_.init_heap(grid);
+        bwd_heap_.set_prune_limit(rr_nodes_.size(), kHeapPruneFactor * rr_nodes_.size());
+        bwd_heap_.set_cost_scale_hint(router_lookahead.cost_scale());
+        only_opin_inter_layer_ = (grid.get_num_layers() > 1) && inter_layer_connections_limited_to_opin(*rr_graph);
+
+        VTR_ASSERT_SAFE(dynamic_cast<const LookaheadImplementation*>(&router_lookahead));
+        VTR_ASSERT(kAllFeatures || (!is_flat_ && !only_opin_inter_layer_));
+
+        router_switch_inf_.reserve(rr_switch_inf_.size());
+        for (const t_rr_switch_inf& switch_inf : rr_switch_inf_) {
+            router_switch_inf_.push_back({switch_inf.R,
+                                          switch_inf.Tdel,
+                                          switch_inf.Cinternal,
+                                          switch_inf.buffered(),
+                                          switch_inf.configurable()});
+        }
     }
 
-    // Clear's the modified list.  Should be called after reset_path_costs
-    // have been called.
-    void clear_modified_rr_node_info() final {
-        modified_rr_node_inf_.clear();
-    }
+    // Nothing to clear: the path costs are reset by reset_path_costs() alone.
+    void clear_modified_rr_node_info() final {}
 
-    // Reset modified data in rr_node_route_inf based on modified_rr_node_inf.
+    // Reset the path costs of all the nodes, by starting a new path search epoch:
+    // the costs stamped by the previous searches are then ignored.
     void reset_path_costs() final {
-        ::reset_path_costs(modified_rr_node_inf_);
+        path_epoch_ = new_path_search_epoch();
     }
 
     /** Finds a path from the route tree rooted at rt_root to sink_node.
@@ -129,28 +171,66 @@ class ConnectionRouter : public ConnectionRouterInterface {
     // Ensure route budgets have been calculated before enabling this
     void set_rcv_enabled(bool enable) final;
 
+    // Set the minimum Manhattan distance between source and sink above which
+    // connections are routed with a bidirectional search.
+    //
+    // Negative values disable bidirectional search. Requires the RR graph's
+    // fan-in edge lists (RRGraphBuilder::init_fan_in_edges).
+    void set_bidirectional_search_threshold(int threshold) final;
+
+    void reset_heap_item_pools(RouterStats& router_stats) final {
+        size_t high_water = heap_.item_high_water_mark() + bwd_heap_.item_high_water_mark();
+        router_stats.heap_item_high_water = std::max(router_stats.heap_item_high_water, high_water);
+        router_stats.heap_item_pool_size += heap_.item_pool_size() + bwd_heap_.item_pool_size();
+        router_stats.heap_rescales += heap_.num_rescales() + bwd_heap_.num_rescales();
+        router_stats.heap_expansions += heap_.num_expansions() + bwd_heap_.num_expansions();
+
+        heap_.reset_item_pool();
+        bwd_heap_.reset_item_pool();
+    }
+
+    const vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf() const final {
+        return rr_node_path_inf_;
+    }
+
+    vtr::vector<RRNodeId, t_rr_node_path_inf>& mutable_rr_node_path_inf() final {
+        return rr_node_path_inf_;
+    }
+
   private:
-    // Mark that data associated with rr_node "inode" has been modified, and
-    // needs to be reset in reset_path_costs.
-    void add_to_mod_list(RRNodeId inode) {
-        if (std::isinf(rr_node_route_inf_[inode].path_cost)) {
-            modified_rr_node_inf_.push_back(inode);
-        }
+    // The runtime feature flags, which are constant false without kAllFeatures
+    inline bool is_flat() const { return kAllFeatures && is_flat_; }
+    inline bool rcv_enabled() const { return kAllFeatures && rcv_path_manager.is_enabled(); }
+    inline bool only_opin_inter_layer() const { return kAllFeatures && only_opin_inter_layer_; }
+
+    // The best known costs of the path to a node in the current path search.
+    // They are infinite if the search has not reached the node (i.e. the path
+    // costs of the node were stamped by another search, see path_epoch_).
+    inline float path_cost(const t_rr_node_path_inf& path_inf) const {
+        return path_inf.path_epoch == path_epoch_ ? path_inf.path_cost : std::numeric_limits<float>::infinity();
+    }
+
+    inline float backward_path_cost(const t_rr_node_path_inf& path_inf) const {
+        return path_inf.path_epoch == path_epoch_ ? path_inf.backward_path_cost : std::numeric_limits<float>::infinity();
+    }
+
+    // Record the best known path to a node in the current path search
+    inline void set_path(t_rr_node_path_inf* path_inf, RRNodeId prev_node, RREdgeId prev_edge, float cost, float backward_cost) {
+        path_inf->path_epoch = path_epoch_;
+        path_inf->prev_node = prev_node;
+        path_inf->prev_edge = prev_edge;
+        path_inf->path_cost = cost;
+        path_inf->backward_path_cost = backward_cost;
     }
 
     // Update the route path to the node pointed to by cheapest.
     inline void update_cheapest(t_heap* cheapest) {
-        update_cheapest(cheapest, &rr_node_route_inf_[cheapest->index]);
+        update_cheapest(cheapest, &rr_node_path_inf_[cheapest->index]);
     }
 
-    inline void update_cheapest(t_heap* cheapest, t_rr_node_route_inf* route_inf) {
+    inline void update_cheapest(t_heap* cheapest, t_rr_node_path_inf* path_inf) {
         //Record final link to target
-        add_to_mod_list(cheapest->index);
-
-        route_inf->prev_node = cheapest->prev_node();
-        route_inf->prev_edge = cheapest->prev_edge();
-        route_inf->path_cost = cheapest->cost;
-        route_inf->backward_path_cost = cheapest->backward_path_cost;
+        set_path(path_inf, cheapest->prev_node(), cheapest->prev_edge(), cheapest->cost, cheapest->backward_path_cost);
     }
 
     /** Common logic from timing_driven_route_connection_from_route_tree and
@@ -198,6 +278,22 @@ class ConnectionRouter : public ConnectionRouterInterface {
         t_bb bounding_box,
         RRNodeId target_node);
 
+    // Expands the neighbours of from_node kExpansionBatchSize edges at a
+    // time, for the common case of no RCV, no flat routing and no router
+    // debug output. Produces the same heap pushes as
+    // timing_driven_expand_neighbour, but first gathers the edges which
+    // survive pruning into small arrays and evaluates their delay and
+    // backward costs in a single branch-free loop (which the compiler can
+    // vectorize), before the lookahead and heap push of each survivor.
+    void timing_driven_expand_neighbours_batched(
+        const t_heap* current,
+        RRNodeId from_node,
+        vtr::StrongIdRange<RREdgeId> edges,
+        const t_conn_cost_params& cost_params,
+        const t_bb& bounding_box,
+        RRNodeId target_node,
+        const t_bb& target_bb);
+
     // Conditionally adds to_node to the router heap (via path from from_node
     // via from_edge).
     //
@@ -232,6 +328,57 @@ class ConnectionRouter : public ConnectionRouterInterface {
         RREdgeId from_edge,
         RRNodeId target_node);
 
+    // Should the connection from source_node to sink_node be routed with
+    // timing_driven_route_connection_bidirectional?
+    bool use_bidirectional_search(RRNodeId source_node, RRNodeId sink_node);
+
+    // Finds a path to sink_node with a bidirectional search: the forward
+    // search starts from the elements currently in the heap (as in
+    // timing_driven_route_connection_from_heap), while a backward search
+    // expands from sink_node over fan-in edges, until the two meet.
+    //
+    // The backward search does not know the upstream resistance, so its
+    // delays assume the path is driven by a buffered switch. Route tree
+    // timing is recomputed from the actual path once it is committed.
+    //
+    // Returns the sink element of the path (with the path recorded in
+    // rr_node_path_inf), or nullptr if no path is found
+    t_heap* timing_driven_route_connection_bidirectional(
+        RRNodeId sink_node,
+        const t_conn_cost_params cost_params,
+        t_bb bounding_box);
+
+    // Expands the cheapest node of the backward search over its fan-in edges.
+    //
+    // Updates best_meet_node/best_meet_cost if a cheaper meeting point with
+    // the forward search is found.
+    void bidirectional_expand_backward(
+        const t_conn_cost_params cost_params,
+        t_bb bounding_box,
+        RRNodeId& best_meet_node,
+        float& best_meet_cost);
+
+    // Cost of entering to_node through from_edge, as seen by the backward
+    // search (congestion + delay, without upstream resistance).
+    float backward_edge_cost(
+        const t_conn_cost_params cost_params,
+        RRNodeId from_node,
+        RREdgeId from_edge,
+        RRNodeId to_node) const;
+
+    // Records the backward half of the path (meet_node -> sink_node) in
+    // rr_node_path_inf, so that it can be traced back like a regular path.
+    //
+    // Returns nullptr if the two halves of the path share a node (rather
+    // than creating a loop in the traceback).
+    t_heap* commit_bidirectional_path(
+        RRNodeId meet_node,
+        float meet_cost,
+        RRNodeId sink_node);
+
+    // Resets the state of the backward search
+    void reset_bidirectional_search();
+
     // Find paths from current heap to all nodes in the RR graph
     vtr::vector<RRNodeId, t_heap> timing_driven_find_all_shortest_paths_from_heap(
         const t_conn_cost_params cost_params,
@@ -272,27 +419,52 @@ class ConnectionRouter : public ConnectionRouterInterface {
         t_bb net_bounding_box);
 
     const DeviceGrid& grid_;
-    const RouterLookahead& router_lookahead_;
+    const LookaheadImplementation& router_lookahead_;
     const t_rr_graph_view rr_nodes_;
     const RRGraphView* rr_graph_;
     vtr::array_view<const t_rr_rc_data> rr_rc_data_;
     vtr::array_view<const t_rr_switch_inf> rr_switch_inf_;
+    std::vector<t_router_switch_inf> router_switch_inf_; /* Indexed by switch id, see t_router_switch_inf */
     const vtr::vector<ParentNetId, std::vector<std::vector<int>>>& net_terminal_groups;
     const vtr::vector<ParentNetId, std::vector<int>>& net_terminal_group_num;
-    vtr::vector<RRNodeId, t_rr_node_route_inf>& rr_node_route_inf_;
+    vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf_;
+    // Epoch of the current path search: the path costs of the nodes in rr_node_path_inf_
+    // stamped with another epoch are stale, so that a reset just starts a new epoch,
+    // instead of resetting every node reached by the search.
+    uint64_t path_epoch_;
     bool is_flat_;
-    std::vector<RRNodeId> modified_rr_node_inf_;
     RouterStats* router_stats_;
     const ConnectionParameters* conn_params_;
     HeapImplementation heap_;
     bool router_debug_;
 
-    bool only_opin_inter_layer;
+    bool only_opin_inter_layer_;
 
     // The path manager for RCV, keeps track of the route tree as a set, also manages the allocation of the heap types
     PathManager rcv_path_manager;
+
+    // Bidirectional search state (see timing_driven_route_connection_bidirectional).
+    // bwd_path_cost_[inode] is the best known cost from inode to the sink and
+    // bwd_next_edge_[inode] is the edge leaving inode on that path. Both are
+    // only allocated once bidirectional search is enabled.
+    int bidir_search_threshold_;
+    HeapImplementation bwd_heap_;
+    vtr::vector<RRNodeId, float> bwd_path_cost_;
+    vtr::vector<RRNodeId, RREdgeId> bwd_next_edge_;
+    std::vector<RRNodeId> bwd_modified_nodes_;
 };
 
+/** The connection router specialized for the common case: the map lookahead,
+ * no RCV, a single layer and no flat routing. */
+template<typename HeapImplementation>
+using CommonCaseConnectionRouter = ConnectionRouter<HeapImplementation, MapLookahead, false>;
+
+/** Returns true if the routing with router_opts can use a CommonCaseConnectionRouter
+ * (with the lookahead made for router_opts) instead of the general ConnectionRouter. */
+bool use_common_case_connection_router(const t_router_opts& router_opts,
+                                       const DeviceGrid& grid,
+                                       bool is_flat);
+
 /** Construct a connection router that uses the specified heap type.
  * This function is not used, but removing it will result in "undefined reference"
  * errors since heap type specializations won't get emitted from connection_router.cpp
@@ -306,7 +478,7 @@ std::unique_ptr<ConnectionRouterInterface> make_connection_router(
     const RRGraphView* rr_graph,
     const std::vector<t_rr_rc_data>& rr_rc_data,
     const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switch_inf,
-    vtr::vector<RRNodeId, t_rr_node_route_inf>& rr_node_route_inf,
+    vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf,
     bool is_flat);
 
 #endif /* _CONNECTION_ROUTER_H */
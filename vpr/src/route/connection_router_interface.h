@@ -41,7 +41,7 @@ class ConnectionRouterInterface {
     // have been called.
     virtual void clear_modified_rr_node_info() = 0;
 
-    // Reset modified data in rr_node_route_inf based on modified_rr_node_inf.
+    // Reset the path costs recorded in rr_node_path_inf by the path searches.
     virtual void reset_path_costs() = 0;
 
     /** Finds a path from the route tree rooted at rt_root to sink_node.
@@ -113,6 +113,21 @@ class ConnectionRouterInterface {
     //
     // Ensure route budgets have been calculated before enabling this
     virtual void set_rcv_enabled(bool enable) = 0;
+
+    // Set the minimum source to sink Manhattan distance above which connections
+    // are routed with a bidirectional (forward from the route tree, backward
+    // from the sink) search. Negative values disable bidirectional search.
+    virtual void set_bidirectional_search_threshold(int threshold) = 0;
+
+    // Record the heap item pool high-water marks (and the heap rescaling
+    // counts) into router_stats and rewind the pools. Should be called once per routing iteration, when
+    // no heap items are outstanding.
+    virtual void reset_heap_item_pools(RouterStats& router_stats) = 0;
+
+    // The path search state of this router, from which the routed paths are
+    // traced back (see RouteTree::update_from_heap).
+    virtual const vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf() const = 0;
+    virtual vtr::vector<RRNodeId, t_rr_node_path_inf>& mutable_rr_node_path_inf() = 0;
 };
 
 #endif /* _CONNECTION_ROUTER_INTERFACE_H */
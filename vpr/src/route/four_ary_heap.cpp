@@ -0,0 +1,219 @@
+#include "four_ary_heap.h"
+#include "rr_graph_fwd.h"
+#include "vtr_log.h"
+
+// parent and first child indices of a 0-indexed 4-ary heap
+static size_t parent(size_t i) { return (i - 1) >> 2; }
+static size_t first_child(size_t i) { return (i << 2) + 1; }
+
+FourAryHeap::FourAryHeap()
+    : heap_()
+    , node_slot_() {}
+
+FourAryHeap::~FourAryHeap() {
+    free_all_memory();
+}
+
+t_heap* FourAryHeap::alloc() {
+    return storage_.alloc();
+}
+void FourAryHeap::free(t_heap* hptr) {
+    storage_.free(hptr);
+}
+
+void FourAryHeap::init_heap(const DeviceGrid& grid) {
+    size_t target_heap_size = (grid.width() - 1) * (grid.height() - 1);
+    if (heap_.capacity() < target_heap_size) {
+        heap_.reserve(target_heap_size);
+    }
+    empty_heap();
+}
+
+void FourAryHeap::set_prune_limit(size_t max_index, size_t /*prune_limit*/) {
+    if (max_index != std::numeric_limits<size_t>::max() && node_slot_.size() < max_index) {
+        VTR_ASSERT(max_index < kNotInHeap);
+        node_slot_.resize(max_index, kNotInHeap);
+    }
+}
+
+uint32_t& FourAryHeap::slot_of(RRNodeId inode) {
+    size_t idx = size_t(inode);
+    if (idx >= node_slot_.size()) {
+        VTR_ASSERT(idx < kNotInHeap);
+        node_slot_.resize(idx + 1, kNotInHeap);
+    }
+    return node_slot_[idx];
+}
+
+bool FourAryHeap::replace_if_cheaper(size_t slot, t_heap* const hptr) {
+    t_heap* existing = heap_[slot];
+    VTR_ASSERT_SAFE(existing->index == hptr->index);
+
+    if (hptr->cost < existing->cost) {
+        free(existing);
+        heap_[slot] = hptr;
+        return true;
+    }
+
+    free(hptr);
+    return false;
+}
+
+void FourAryHeap::add_to_heap(t_heap* hptr) {
+    if (!hptr->index.is_valid()) {
+        // Invalid entries are never returned from the heap, drop it now
+        free(hptr);
+        return;
+    }
+
+    uint32_t slot = slot_of(hptr->index);
+    if (slot == kNotInHeap) {
+        heap_.push_back(hptr);
+        sift_up(heap_.size() - 1, hptr);
+    } else if (replace_if_cheaper(slot, hptr)) {
+        // decrease-key, the entry can only move towards the root
+        sift_up(slot, hptr);
+    }
+}
+
+// As for BinaryHeap, a batch at least as large as the heap is appended (with
+// the same decrease-key handling) and heapified once instead of sifted up.
+void FourAryHeap::add_batch_to_heap(t_heap* const* hptrs, size_t num_items) {
+    if (num_items >= heap_.size()) {
+        for (size_t i = 0; i < num_items; ++i) {
+            push_back(hptrs[i]);
+        }
+        build_heap();
+    } else {
+        for (size_t i = 0; i < num_items; ++i) {
+            add_to_heap(hptrs[i]);
+        }
+    }
+}
+
+void FourAryHeap::push_back(t_heap* const hptr) {
+    if (!hptr->index.is_valid()) {
+        free(hptr);
+        return;
+    }
+
+    uint32_t slot = slot_of(hptr->index);
+    if (slot == kNotInHeap) {
+        heap_.push_back(hptr);
+        place(heap_.size() - 1, hptr);
+    } else {
+        // Heap property is not maintained here, build_heap will restore it
+        replace_if_cheaper(slot, hptr);
+    }
+}
+
+bool FourAryHeap::is_empty_heap() const {
+    return heap_.empty();
+}
+
+t_heap* FourAryHeap::get_heap_head() {
+    /* Returns a pointer to the smallest element on the heap, or NULL if the     *
+     * heap is empty.                                                            */
+    if (heap_.empty()) {
+        VTR_LOG_WARN("Empty heap occurred in get_heap_head.\n");
+        return nullptr;
+    }
+
+    t_heap* cheapest = heap_[0];
+    node_slot_[size_t(cheapest->index)] = kNotInHeap;
+
+    t_heap* last = heap_.back();
+    heap_.pop_back();
+    if (!heap_.empty()) {
+        place(0, last);
+        sift_down(0);
+    }
+
+    return cheapest;
+}
+
+void FourAryHeap::empty_heap() {
+    for (t_heap* hptr : heap_) {
+        node_slot_[size_t(hptr->index)] = kNotInHeap;
+        free(hptr);
+    }
+
+    heap_.clear();
+}
+
+// O(lgn) sifting up to maintain heap property after insertion or decrease-key
+void FourAryHeap::sift_up(size_t hole, t_heap* const node) {
+    while (hole > 0 && node->cost < heap_[parent(hole)]->cost) {
+        // sift hole up
+        place(hole, heap_[parent(hole)]);
+        hole = parent(hole);
+    }
+    place(hole, node);
+}
+
+// make a heap rooted at index hole by **sifting down** in O(lgn) time
+void FourAryHeap::sift_down(size_t hole) {
+    t_heap* head = heap_[hole];
+    size_t size = heap_.size();
+    size_t child = first_child(hole);
+    while (child < size) {
+        // find the cheapest of (up to) kArity contiguous children
+        size_t cheapest_child = child;
+        size_t last_child = std::min(child + kArity, size);
+        for (size_t i = child + 1; i < last_child; ++i) {
+            if (heap_[i]->cost < heap_[cheapest_child]->cost) {
+                cheapest_child = i;
+            }
+        }
+
+        if (heap_[cheapest_child]->cost < head->cost) {
+            place(hole, heap_[cheapest_child]);
+            hole = cheapest_child;
+            child = first_child(hole);
+        } else {
+            break;
+        }
+    }
+    place(hole, head);
+}
+
+// runs in O(n) time by sifting down from the last internal node
+void FourAryHeap::build_heap() {
+    if (heap_.size() < 2) {
+        return;
+    }
+
+    for (size_t i = parent(heap_.size() - 1) + 1; i != 0; --i) {
+        sift_down(i - 1);
+    }
+}
+
+bool FourAryHeap::is_valid() const {
+    for (size_t i = 0; i < heap_.size(); ++i) {
+        if (node_slot_[size_t(heap_[i]->index)] != i) return false;
+        if (i > 0 && heap_[i]->cost < heap_[parent(i)]->cost) return false;
+    }
+    return true;
+}
+
+void FourAryHeap::free_all_memory() {
+    empty_heap();
+
+    heap_.shrink_to_fit();
+    node_slot_.clear();
+    node_slot_.shrink_to_fit();
+
+    storage_.free_all_memory();
+}
+
+void FourAryHeap::reset_item_pool() {
+    storage_.reset();
+}
+
+size_t FourAryHeap::item_high_water_mark() const {
+    return storage_.high_water_mark();
+}
+
+size_t FourAryHeap::item_pool_size() const {
+    return storage_.pool_size();
+}
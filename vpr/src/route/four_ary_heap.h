@@ -0,0 +1,89 @@
+#ifndef _FOUR_ARY_HEAP_H
+#define _FOUR_ARY_HEAP_H
+
+#include "heap_type.h"
+#include <limits>
+#include <vector>
+
+// A 4-ary min-heap with decrease-key support.
+//
+// Unlike BinaryHeap, which tolerates duplicate entries for the same RR node
+// (and prunes them once the heap grows too large), FourAryHeap keeps an
+// RRNodeId -> heap slot index so that each RR node appears in the heap at
+// most once:
+//  - If a node is added while already in the heap with a higher cost, the
+//    existing entry is replaced by the new one and sifted up (decrease-key).
+//  - If a node is added while already in the heap with a lower (or equal)
+//    cost, the new entry is dropped (and freed) immediately.
+//
+// Only the cheapest total cost is kept per node, so a stale entry with a
+// higher total but lower backward cost is discarded rather than popped and
+// then rejected by the router's post-heap pruning.
+//
+// A 4-ary layout halves the tree depth compared to a binary heap, and the
+// four children of a slot are contiguous in memory, which makes sift_down
+// (the dominant cost of get_heap_head) more cache friendly.
+class FourAryHeap : public HeapInterface {
+  public:
+    FourAryHeap();
+    ~FourAryHeap();
+
+    t_heap* alloc() final;
+    void free(t_heap* hptr) final;
+
+    void init_heap(const DeviceGrid& grid) final;
+    void add_to_heap(t_heap* hptr) final;
+    void add_batch_to_heap(t_heap* const* hptrs, size_t num_items) final;
+    void push_back(t_heap* const hptr) final;
+    bool is_empty_heap() const final;
+    bool is_valid() const final;
+    void empty_heap() final;
+    t_heap* get_heap_head() final;
+    void build_heap() final;
+
+    // Since each RR node is in the heap at most once the heap can never
+    // exceed max_index entries, so no pruning is required. max_index is
+    // only used to size the RRNodeId -> slot lookup.
+    void set_prune_limit(size_t max_index, size_t prune_limit) final;
+
+    void free_all_memory() final;
+
+    void reset_item_pool() final;
+    size_t item_high_water_mark() const final;
+    size_t item_pool_size() const final;
+
+    // Item costs do not affect the heap layout: nothing to tune or rescale.
+    void set_cost_scale_hint(float /*cost_scale*/) final {}
+    size_t num_rescales() const final { return 0; }
+    size_t num_expansions() const final { return 0; }
+
+  private:
+    static constexpr size_t kArity = 4;
+    static constexpr uint32_t kNotInHeap = std::numeric_limits<uint32_t>::max();
+
+    // Sift node up from slot hole to restore the heap property
+    void sift_up(size_t hole, t_heap* const node);
+    // Sift the node held in slot hole down to restore the heap property
+    void sift_down(size_t hole);
+
+    // Stores node in slot, keeping the RRNodeId -> slot lookup in sync
+    inline void place(size_t slot, t_heap* const node) {
+        heap_[slot] = node;
+        node_slot_[size_t(node->index)] = slot;
+    }
+
+    // Returns the slot holding inode (or kNotInHeap), growing the lookup if
+    // inode is beyond its current size.
+    uint32_t& slot_of(RRNodeId inode);
+
+    // Handles an entry for a node already in the heap. Returns true if the
+    // new entry replaced the existing one (which is freed), otherwise the new
+    // entry is freed and false is returned.
+    bool replace_if_cheaper(size_t slot, t_heap* const hptr);
+
+    HeapStorage storage_;
+    std::vector<t_heap*> heap_;       /* Indexed from [0..size) */
+    std::vector<uint32_t> node_slot_; /* Heap slot of each RR node, or kNotInHeap */
+};
+
+#endif /* _FOUR_ARY_HEAP_H */
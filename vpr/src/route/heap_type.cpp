@@ -1,26 +1,41 @@
 #include "heap_type.h"
 
+#include <algorithm>
+
 #include "binary_heap.h"
 #include "bucket.h"
+#include "four_ary_heap.h"
 #include "rr_graph_fwd.h"
 #include "vpr_error.h"
 #include "vpr_types.h"
 
 HeapStorage::HeapStorage()
-    : heap_free_head_(nullptr)
-    , num_heap_allocated_(0) {}
+    : alloced_items_(0)
+    , heap_free_head_(nullptr)
+    , num_heap_allocated_(0)
+    , max_heap_allocated_(0) {}
+
+HeapStorage::HeapStorage(const HeapStorage& /*other*/)
+    : HeapStorage() {}
 
 t_heap*
 HeapStorage::alloc() {
-    if (heap_free_head_ == nullptr) { /* No elements on the free list */
-        heap_free_head_ = vtr::chunk_new<t_heap>(&heap_ch_);
+    t_heap* temp_ptr;
+    if (heap_free_head_ != nullptr) {
+        //Extract the head of the free list
+        temp_ptr = heap_free_head_;
+        heap_free_head_ = heap_free_head_->next_heap_item();
+    } else if (alloced_items_ < heap_items_.size()) {
+        //Use the next item of the pool
+        temp_ptr = heap_items_[alloced_items_++];
+    } else {
+        temp_ptr = heap_pool_.create();
+        heap_items_.push_back(temp_ptr);
+        alloced_items_++;
     }
 
-    //Extract the head
-    t_heap* temp_ptr = heap_free_head_;
-    heap_free_head_ = heap_free_head_->next_heap_item();
-
     num_heap_allocated_++;
+    max_heap_allocated_ = std::max(max_heap_allocated_, num_heap_allocated_);
 
     //Reset
     temp_ptr->set_next_heap_item(nullptr);
@@ -40,23 +55,27 @@ void HeapStorage::free(t_heap* hptr) {
     num_heap_allocated_--;
 }
 
-void HeapStorage::free_all_memory() {
+void HeapStorage::reset() {
     VTR_ASSERT(num_heap_allocated_ == 0);
 
-    if (heap_free_head_ != nullptr) {
-        t_heap* curr = heap_free_head_;
-        while (curr) {
-            t_heap* tmp = curr;
-            curr = curr->next_heap_item();
+    heap_free_head_ = nullptr;
+    alloced_items_ = 0;
+    max_heap_allocated_ = 0;
+}
 
-            vtr::chunk_delete(tmp, &heap_ch_);
-        }
+void HeapStorage::free_all_memory() {
+    VTR_ASSERT(num_heap_allocated_ == 0);
 
-        heap_free_head_ = nullptr;
+    for (t_heap* item : heap_items_) {
+        heap_pool_.destroy(item);
     }
+    heap_items_.clear();
+    alloced_items_ = 0;
+    heap_free_head_ = nullptr;
+    max_heap_allocated_ = 0;
 
-    /*free the memory chunks that were used by heap and linked f pointer */
-    free_chunk_memory(&heap_ch_);
+    /*free the storage that was used by the heap items */
+    heap_pool_.clear();
 }
 
 std::unique_ptr<HeapInterface> make_heap(e_heap_type heap_type) {
@@ -65,6 +84,8 @@ std::unique_ptr<HeapInterface> make_heap(e_heap_type heap_type) {
             return std::make_unique<BinaryHeap>();
         case e_heap_type::BUCKET_HEAP_APPROXIMATION:
             return std::make_unique<Bucket>();
+        case e_heap_type::FOUR_ARY_HEAP:
+            return std::make_unique<FourAryHeap>();
         default:
             VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Unknown heap_type %d", heap_type);
     }
@@ -1,9 +1,12 @@
 #ifndef _HEAP_TYPE_H
 #define _HEAP_TYPE_H
 
+#include <vector>
+
 #include "physical_types.h"
 #include "device_grid.h"
 #include "vtr_memory.h"
+#include "vtr_object_pool.h"
 #include "vtr_array_view.h"
 #include "rr_graph_fwd.h"
 #include "route_path_manager.h"
@@ -91,23 +94,61 @@ struct t_heap {
 
 // t_heap object pool, useful for implementing heaps that conform to
 // HeapInterface.
+//
+// Items are created by the object pool heap_pool_ and recorded in
+// heap_items_ in the order they were created.  Free'd items go onto a free
+// list and are reused first, otherwise the next never handed out item of
+// heap_items_ is used, and only then is a new item taken from heap_pool_.
+//
+// reset() rewinds the pool (as BucketItems::clear does) once every item has
+// been free'd, so that the next routing iteration hands out items in their
+// original, contiguous order rather than in whatever order the free list
+// ended up in.  Each router owns its heaps, so in the parallel router each
+// thread allocates from its own pool.
 class HeapStorage {
   public:
     HeapStorage();
 
+    // Constructs an empty storage: the items of other are owned by its pool,
+    // so they are not shared with (or free'd by) the copy.
+    HeapStorage(const HeapStorage& other);
+    HeapStorage& operator=(const HeapStorage&) = delete;
+
     // Allocate a heap item.
     t_heap* alloc();
 
     // Free a heap item.
     void free(t_heap* hptr);
+
+    // Return every item to the pool and restart the high-water mark.
+    //
+    // Only invoke this method if all allocated items have been free'd.
+    void reset();
+
     void free_all_memory();
 
+    // Peak number of outstanding items since the last reset()
+    size_t high_water_mark() const {
+        return max_heap_allocated_;
+    }
+
+    // Number of items ever created, i.e. the size of the pool
+    size_t pool_size() const {
+        return heap_items_.size();
+    }
+
   private:
-    /* For keeping track of the sudo malloc memory for the heap*/
-    vtr::t_chunk heap_ch_;
+    /* Storage of the heap items */
+    vtr::ObjectPool<t_heap> heap_pool_;
+
+    /* All items ever created, in creation order */
+    std::vector<t_heap*> heap_items_;
+    /* Number of items of heap_items_ handed out since the last reset() */
+    size_t alloced_items_;
 
     t_heap* heap_free_head_;
     size_t num_heap_allocated_;
+    size_t max_heap_allocated_;
 };
 
 // Interface to heap used for router optimization.
@@ -154,6 +195,17 @@ class HeapInterface {
     // called.
     virtual void add_to_heap(t_heap* hptr) = 0;
 
+    // Add the num_items t_heap's of hptrs to heap, preserving heap property.
+    //
+    // This adds the same items as HeapInterface::add_to_heap on each of
+    // them, but lets the heap pick how: e.g. when the batch is large compared
+    // to the heap, appending them all and restoring the heap property once
+    // is cheaper than sifting up each of them.
+    //
+    // This transfers ownership of the t_heap objects to HeapInterface from the
+    // caller.
+    virtual void add_batch_to_heap(t_heap* const* hptrs, size_t num_items) = 0;
+
     // Add t_heap to heap, however does not preserve heap property.
     //
     // This is useful if multiple t_heap's are being added in bulk.  Once
@@ -221,12 +273,39 @@ class HeapInterface {
     // prune_limit should be ~2-4x the max_index to prevent excess pruning
     // when not required.
     virtual void set_prune_limit(size_t max_index, size_t prune_limit) = 0;
+
+    // Return all items to the item pool, so that the following allocations
+    // reuse them in their original order, and restart the high-water mark.
+    // Intended to be called once per routing iteration.
+    //
+    // Note: Only invoke this method if all objects returned from this
+    // HeapInterface instace have been free'd.
+    virtual void reset_item_pool() = 0;
+
+    // Peak number of outstanding items since the last reset_item_pool().
+    virtual size_t item_high_water_mark() const = 0;
+
+    // Number of items held by the item pool (outstanding or not).
+    virtual size_t item_pool_size() const = 0;
+
+    // Hint the typical largest cost of the items of a path search (see
+    // RouterLookahead::cost_scale). Heaps whose layout depends on the cost
+    // range (i.e. Bucket) size themselves from it instead of rescaling on the
+    // fly, the others ignore it. A non-positive hint is ignored.
+    virtual void set_cost_scale_hint(float cost_scale) = 0;
+
+    // Number of times the heap re-laid out its items to fit their costs (e.g.
+    // the Bucket rescales), and grew its layout (e.g. the Bucket bucket array
+    // expansions), since the last reset_item_pool().
+    virtual size_t num_rescales() const = 0;
+    virtual size_t num_expansions() const = 0;
 };
 
 enum class e_heap_type {
     INVALID_HEAP = 0,
     BINARY_HEAP,
     BUCKET_HEAP_APPROXIMATION,
+    FOUR_ARY_HEAP,
 };
 
 // Heap factory.
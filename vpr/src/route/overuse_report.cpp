@@ -1,7 +1,14 @@
 #include "overuse_report.h"
 
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 #include "vtr_log.h"
+#include "async_file_writer.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
 
 /**
  * @brief Definitions of global and helper routines related to printing RR node overuse info.
@@ -10,11 +17,29 @@
  * The helper routines that are called by the global routine should stay local to this file.
  * They provide subroutine hierarchy to allow easier customization of the logfile/report format.
  */
-static void generate_node_to_net_lookup(const Netlist<>& net_list,
-                                        std::map<RRNodeId, std::set<ParentNetId>>& rr_node_to_net_map);
+
+/* The (node, net) pairs of the IPINs and OPINs used by the routing, sorted by node then net */
+typedef std::vector<std::pair<RRNodeId, ParentNetId>> t_pin_node_nets;
+
+///@brief Compares the (node, net) pairs of t_pin_node_nets by node only
+struct t_pin_node_net_cmp {
+    bool operator()(const std::pair<RRNodeId, ParentNetId>& lhs, RRNodeId rhs) const { return lhs.first < rhs; }
+    bool operator()(RRNodeId lhs, const std::pair<RRNodeId, ParentNetId>& rhs) const { return lhs < rhs.first; }
+};
+
+static void generate_pin_node_to_net_lookup(const Netlist<>& net_list,
+                                            t_pin_node_nets& pin_node_nets);
+static void report_overused_node(const Netlist<>& net_list,
+                                 const RRGraphView& rr_graph,
+                                 std::ostream& os,
+                                 size_t inode,
+                                 RRNodeId node_id,
+                                 const std::set<ParentNetId>& congested_nets,
+                                 const t_pin_node_nets& pin_node_nets,
+                                 bool is_flat);
 static void report_overused_ipin_opin(std::ostream& os,
                                       RRNodeId node_id,
-                                      const std::map<RRNodeId, std::set<ParentNetId>>& rr_node_to_net_map);
+                                      const t_pin_node_nets& pin_node_nets);
 static void report_overused_chanx_chany(std::ostream& os, RRNodeId node_id);
 static void report_overused_source_sink(std::ostream& os, RRNodeId node_id);
 static void report_congested_nets(const Netlist<>& net_list,
@@ -35,7 +60,7 @@ void print_block_pins_nets(std::ostream& os,
                            int root_x,
                            int root_y,
                            int pin_physical_num,
-                           const std::map<RRNodeId, std::set<ParentNetId>>& rr_node_to_net_map);
+                           const t_pin_node_nets& pin_node_nets);
 /**
  * @brief Print out RR node overuse info in the VPR logfile.
  *
@@ -78,84 +103,119 @@ void log_overused_nodes_status(int max_logged_overused_rr_nodes) {
 void report_overused_nodes(const Netlist<>& net_list,
                            const RRGraphView& rr_graph,
                            bool is_flat) {
-    const auto& route_ctx = g_vpr_ctx.routing();
-
     /* Generate overuse info lookup table */
     std::map<RRNodeId, std::set<ParentNetId>> over_used_nodes_to_nets_lookup;
-    std::map<RRNodeId, std::set<ParentNetId>> rr_node_to_net_map;
+    t_pin_node_nets pin_node_nets;
     generate_overused_nodes_to_congested_net_lookup(net_list,
                                                     over_used_nodes_to_nets_lookup);
-    generate_node_to_net_lookup(net_list, rr_node_to_net_map);
+    generate_pin_node_to_net_lookup(net_list, pin_node_nets);
+
+    std::vector<std::pair<RRNodeId, const std::set<ParentNetId>*>> over_used_nodes;
+    over_used_nodes.reserve(over_used_nodes_to_nets_lookup.size());
+    for (const auto& lookup_pair : over_used_nodes_to_nets_lookup) {
+        over_used_nodes.emplace_back(lookup_pair.first, &lookup_pair.second);
+    }
+
+    /* The entries of the overused nodes are independent, so they are formatted  *
+     * in parallel (when VPR is built with TBB) and then written in node order.  */
+    std::vector<std::string> node_reports(over_used_nodes.size());
+    auto format_node_report = [&](size_t inode) {
+        std::ostringstream node_os;
+        report_overused_node(net_list,
+                             rr_graph,
+                             node_os,
+                             inode,
+                             over_used_nodes[inode].first,
+                             *over_used_nodes[inode].second,
+                             pin_node_nets,
+                             is_flat);
+        node_reports[inode] = node_os.str();
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), over_used_nodes.size(), format_node_report);
+#else
+    for (size_t inode = 0; inode < over_used_nodes.size(); ++inode) {
+        format_node_report(inode);
+    }
+#endif
 
     /* Open the report file and print header info */
-    std::ofstream os("report_overused_nodes.rpt");
+    AsyncOutputFile os("report_overused_nodes.rpt");
     os << "Overused nodes information report on the final failed routing attempt" << '\n';
     os << "Total number of overused nodes = " << over_used_nodes_to_nets_lookup.size() << '\n';
 
     /* Go through each rr node and the nets that pass through it */
-    size_t inode = 0;
-    for (const auto& lookup_pair : over_used_nodes_to_nets_lookup) {
-        const RRNodeId node_id = lookup_pair.first;
-        const auto& congested_nets = lookup_pair.second;
-
-        os << "************************************************\n\n"; //Separation line
-
-        /* Report basic rr node info */
-        os << "Overused RR node #" << inode << '\n';
-        os << "Node id = " << size_t(node_id) << '\n';
-        os << "Occupancy = " << route_ctx.rr_node_route_inf[node_id].occ() << '\n';
-        os << "Capacity = " << rr_graph.node_capacity(node_id) << "\n\n";
-
-        /* Report selective info based on the rr node type */
-        auto node_type = rr_graph.node_type(node_id);
-        os << "Node type = " << rr_graph.node_type_string(node_id) << '\n';
-        bool report_sinks = false;
-        int x = rr_graph.node_xlow(node_id);
-        int y = rr_graph.node_ylow(node_id);
-        int layer_num = rr_graph.node_layer(node_id);
-        switch (node_type) {
-            case IPIN:
-            case OPIN:
-                report_overused_ipin_opin(os,
-                                          node_id,
-                                          rr_node_to_net_map);
-                report_sinks = true;
-                x -= g_vpr_ctx.device().grid.get_physical_type({x, y, layer_num})->width;
-                y -= g_vpr_ctx.device().grid.get_physical_type({x, y, layer_num})->width;
-                break;
-            case CHANX:
-            case CHANY:
-                report_overused_chanx_chany(os, node_id);
-                break;
-            case SOURCE:
-            case SINK:
-                report_overused_source_sink(os, node_id);
-                report_sinks = true;
-                break;
-
-            default:
-                break;
-        }
-
-        /* Finished printing the node info. Now print out the  *
-         * info on the nets passing through this overused node */
-        os << "-----------------------------\n"; //Separation line
-        report_congested_nets(net_list,
-                              g_vpr_ctx.atom().lookup,
-                              os,
-                              congested_nets,
-                              is_flat,
-                              layer_num,
-                              x,
-                              y,
-                              report_sinks);
-
-        ++inode;
+    for (const std::string& node_report : node_reports) {
+        os << node_report;
     }
 
     os.close();
 }
 
+///@brief Print out the entry of the inode-th overused rr node, and of the nets passing through it
+static void report_overused_node(const Netlist<>& net_list,
+                                 const RRGraphView& rr_graph,
+                                 std::ostream& os,
+                                 size_t inode,
+                                 RRNodeId node_id,
+                                 const std::set<ParentNetId>& congested_nets,
+                                 const t_pin_node_nets& pin_node_nets,
+                                 bool is_flat) {
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    os << "************************************************\n\n"; //Separation line
+
+    /* Report basic rr node info */
+    os << "Overused RR node #" << inode << '\n';
+    os << "Node id = " << size_t(node_id) << '\n';
+    os << "Occupancy = " << route_ctx.rr_node_route_inf[node_id].occ() << '\n';
+    os << "Capacity = " << rr_graph.node_capacity(node_id) << "\n\n";
+
+    /* Report selective info based on the rr node type */
+    auto node_type = rr_graph.node_type(node_id);
+    os << "Node type = " << rr_graph.node_type_string(node_id) << '\n';
+    bool report_sinks = false;
+    int x = rr_graph.node_xlow(node_id);
+    int y = rr_graph.node_ylow(node_id);
+    int layer_num = rr_graph.node_layer(node_id);
+    switch (node_type) {
+        case IPIN:
+        case OPIN:
+            report_overused_ipin_opin(os,
+                                      node_id,
+                                      pin_node_nets);
+            report_sinks = true;
+            x -= g_vpr_ctx.device().grid.get_physical_type({x, y, layer_num})->width;
+            y -= g_vpr_ctx.device().grid.get_physical_type({x, y, layer_num})->width;
+            break;
+        case CHANX:
+        case CHANY:
+            report_overused_chanx_chany(os, node_id);
+            break;
+        case SOURCE:
+        case SINK:
+            report_overused_source_sink(os, node_id);
+            report_sinks = true;
+            break;
+
+        default:
+            break;
+    }
+
+    /* Finished printing the node info. Now print out the  *
+     * info on the nets passing through this overused node */
+    os << "-----------------------------\n"; //Separation line
+    report_congested_nets(net_list,
+                          g_vpr_ctx.atom().lookup,
+                          os,
+                          congested_nets,
+                          is_flat,
+                          layer_num,
+                          x,
+                          y,
+                          report_sinks);
+}
+
 /**
  * @brief Generate a overused RR nodes to congested nets lookup table.
  *
@@ -187,26 +247,38 @@ void generate_overused_nodes_to_congested_net_lookup(const Netlist<>& net_list,
     }
 }
 
-static void generate_node_to_net_lookup(const Netlist<>& net_list,
-                                        std::map<RRNodeId, std::set<ParentNetId>>& rr_node_to_net_map) {
+/**
+ * @brief Generate the lookup of the nets using each IPIN/OPIN rr node.
+ *
+ * Only the pins are looked up by the report (to list the nets of the pins of the blocks
+ * with overused pins), so the wires, which make up most of the routing, are not recorded.
+ */
+static void generate_pin_node_to_net_lookup(const Netlist<>& net_list,
+                                            t_pin_node_nets& pin_node_nets) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
     const auto& route_ctx = g_vpr_ctx.routing();
 
-    //Create overused nodes to congested nets look up by
-    //traversing through the net trace backs linked lists
+    pin_node_nets.clear();
     for (ParentNetId net_id : net_list.nets()) {
         if (!route_ctx.route_trees[net_id])
             continue;
 
         for (const RouteTreeNode& rt_node : route_ctx.route_trees[net_id].value().all_nodes()) {
-            rr_node_to_net_map[rt_node.inode].insert(net_id);
+            t_rr_type rr_type = rr_graph.node_type(rt_node.inode);
+            if (rr_type == IPIN || rr_type == OPIN) {
+                pin_node_nets.emplace_back(rt_node.inode, net_id);
+            }
         }
     }
+
+    std::sort(pin_node_nets.begin(), pin_node_nets.end());
+    pin_node_nets.erase(std::unique(pin_node_nets.begin(), pin_node_nets.end()), pin_node_nets.end());
 }
 
 ///@brief Print out information specific to IPIN/OPIN type rr nodes
 static void report_overused_ipin_opin(std::ostream& os,
                                       RRNodeId node_id,
-                                      const std::map<RRNodeId, std::set<ParentNetId>>& rr_node_to_net_map) {
+                                      const t_pin_node_nets& pin_node_nets) {
     const auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
     const auto& place_ctx = g_vpr_ctx.placement();
@@ -239,7 +311,7 @@ static void report_overused_ipin_opin(std::ostream& os,
                           grid_x - device_ctx.grid.get_width_offset({grid_x, grid_y, grid_layer}),
                           grid_y - device_ctx.grid.get_height_offset({grid_x, grid_y, grid_layer}),
                           rr_graph.node_ptc_num(node_id),
-                          rr_node_to_net_map);
+                          pin_node_nets);
     os << "Side = " << rr_graph.node_side_string(node_id) << "\n\n";
 
     //Add block type for IPINs/OPINs in overused rr-node report
@@ -445,7 +517,7 @@ void print_block_pins_nets(std::ostream& os,
                            int root_x,
                            int root_y,
                            int pin_physical_num,
-                           const std::map<RRNodeId, std::set<ParentNetId>>& rr_node_to_net_map) {
+                           const t_pin_node_nets& pin_node_nets) {
     const auto& rr_graph = g_vpr_ctx.device().rr_graph;
 
     t_pin_range pin_num_range;
@@ -472,7 +544,7 @@ void print_block_pins_nets(std::ostream& os,
         t_rr_type rr_type = (get_pin_type_from_pin_physical_num(physical_type, pin) == DRIVER) ? t_rr_type::OPIN : t_rr_type::IPIN;
         RRNodeId node_id = get_pin_rr_node_id(rr_graph.node_lookup(), physical_type, layer, root_x, root_y, pin);
         VTR_ASSERT(node_id != RRNodeId::INVALID());
-        auto search_result = rr_node_to_net_map.find(node_id);
+        auto node_nets = std::equal_range(pin_node_nets.begin(), pin_node_nets.end(), node_id, t_pin_node_net_cmp());
         if (rr_type == t_rr_type::OPIN) {
             os << "  OPIN - ";
         } else {
@@ -481,10 +553,9 @@ void print_block_pins_nets(std::ostream& os,
         }
         os << "RRNodeId: " << size_t(node_id) << " - Physical Num: " << pin << "\n";
         os << "  ";
-        if (search_result != rr_node_to_net_map.end()) {
-            auto nets = search_result->second;
-            for (auto net : nets) {
-                os << "  " << size_t(net);
+        if (node_nets.first != node_nets.second) {
+            for (auto itr = node_nets.first; itr != node_nets.second; ++itr) {
+                os << "  " << size_t(itr->second);
             }
         } else {
             os << "  -1";
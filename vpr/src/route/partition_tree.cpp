@@ -2,13 +2,20 @@
 #include <cmath>
 #include <memory>
 
-PartitionTree::PartitionTree(const Netlist<>& netlist) {
+PartitionTree::PartitionTree(const Netlist<>& netlist, const vtr::vector<ParentNetId, size_t>* net_effort)
+    : _net_effort(net_effort) {
     const auto& device_ctx = g_vpr_ctx.device();
 
     auto all_nets = std::vector<ParentNetId>(netlist.nets().begin(), netlist.nets().end());
     _root = build_helper(netlist, all_nets, 0, 0, device_ctx.grid.width() - 1, device_ctx.grid.height() - 1);
 }
 
+size_t PartitionTree::net_weight(const Netlist<>& netlist, ParentNetId net_id) const {
+    if (_net_effort && (*_net_effort)[net_id] > 0)
+        return (*_net_effort)[net_id];
+    return netlist.net_sinks(net_id).size();
+}
+
 std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>& netlist, const std::vector<ParentNetId>& nets, int x1, int y1, int x2, int y2) {
     if (nets.empty())
         return nullptr;
@@ -30,12 +37,12 @@ std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>&
      * For instance, x_total_before[0] assumes a cutline at x=0.5, so fanouts at x=0 are included but not
      * x=1. It's similar for x_total_after[0], which excludes fanouts at x=0 and includes x=1.
      * Note that we have W-1 possible cutlines for a W-wide box. */
-    std::vector<int> x_total_before(W - 1, 0), x_total_after(W - 1, 0);
-    std::vector<int> y_total_before(H - 1, 0), y_total_after(H - 1, 0);
+    std::vector<size_t> x_total_before(W - 1, 0), x_total_after(W - 1, 0);
+    std::vector<size_t> y_total_before(H - 1, 0), y_total_after(H - 1, 0);
 
     for (auto net_id : nets) {
         t_bb bb = route_ctx.route_bb[net_id];
-        size_t fanouts = netlist.net_sinks(net_id).size();
+        size_t fanouts = net_weight(netlist, net_id);
 
         /* Inclusive start and end coords of the bbox relative to x1. Clamp to [x1, x2]. */
         int x_start = std::max(x1, bb.xmin) - x1;
@@ -57,18 +64,21 @@ std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>&
         }
     }
 
-    int best_score = std::numeric_limits<int>::max();
+    /* The nets on the cutline are routed before either side, and then both sides are
+     * routed in parallel. "before" and "after" both include the cutline nets, so the time
+     * to route this subtree is roughly max(before, after): minimize that. */
+    size_t best_score = std::numeric_limits<size_t>::max();
     float best_pos = std::numeric_limits<double>::quiet_NaN();
     Axis best_axis = Axis::X;
 
-    int max_x_before = x_total_before[W - 2];
-    int max_x_after = x_total_after[0];
+    size_t max_x_before = x_total_before[W - 2];
+    size_t max_x_after = x_total_after[0];
     for (int x = 0; x < W - 1; x++) {
-        int before = x_total_before[x];
-        int after = x_total_after[x];
+        size_t before = x_total_before[x];
+        size_t after = x_total_after[x];
         if (before == max_x_before || after == max_x_after) /* Cutting here would leave no nets to the left or right */
             continue;
-        int score = abs(x_total_before[x] - x_total_after[x]);
+        size_t score = std::max(before, after);
         if (score < best_score) {
             best_score = score;
             best_pos = x1 + x + 0.5; /* Lookups are relative to (x1, y1) */
@@ -76,14 +86,14 @@ std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>&
         }
     }
 
-    int max_y_before = y_total_before[H - 2];
-    int max_y_after = y_total_after[0];
+    size_t max_y_before = y_total_before[H - 2];
+    size_t max_y_after = y_total_after[0];
     for (int y = 0; y < H - 1; y++) {
-        int before = y_total_before[y];
-        int after = y_total_after[y];
+        size_t before = y_total_before[y];
+        size_t after = y_total_after[y];
         if (before == max_y_before || after == max_y_after) /* Cutting here would leave no nets to the left or right (sideways) */
             continue;
-        int score = abs(y_total_before[y] - y_total_after[y]);
+        size_t score = std::max(before, after);
         if (score < best_score) {
             best_score = score;
             best_pos = y1 + y + 0.5; /* Lookups are relative to (x1, y1) */
@@ -66,6 +66,8 @@ class PartitionTreeNode {
     float cutline_pos = std::numeric_limits<float>::quiet_NaN();
     /* Bounding box of *this* node. (The cutline cuts this box) */
     t_bb bb;
+    /* Wall time spent routing the nets of this node (not its subtrees) in the last iteration, in seconds. */
+    float route_time_sec = 0;
 };
 
 /** Holds the root PartitionTreeNode and exposes top level operations. */
@@ -77,8 +79,10 @@ class PartitionTree {
     PartitionTree& operator=(const PartitionTree&) = delete;
     PartitionTree& operator=(PartitionTree&&) = default;
 
-    /** Can only be built from a netlist */
-    PartitionTree(const Netlist<>& netlist);
+    /** Can only be built from a netlist.
+     * If \p net_effort is given, nets are weighted by it when placing cutlines (see build_helper),
+     * otherwise by their fanout. Nets with zero (unknown) effort fall back to their fanout too. */
+    PartitionTree(const Netlist<>& netlist, const vtr::vector<ParentNetId, size_t>* net_effort = nullptr);
 
     /** Access root. Shouldn't cause a segfault, because PartitionTree constructor always makes a _root */
     inline PartitionTreeNode& root(void) { return *_root; }
@@ -86,6 +90,10 @@ class PartitionTree {
   private:
     std::unique_ptr<PartitionTreeNode> _root;
     std::unique_ptr<PartitionTreeNode> build_helper(const Netlist<>& netlist, const std::vector<ParentNetId>& nets, int x1, int y1, int x2, int y2);
+    /** Routing effort estimate for net_id, used to balance cutlines */
+    size_t net_weight(const Netlist<>& netlist, ParentNetId net_id) const;
+
+    const vtr::vector<ParentNetId, size_t>* _net_effort;
 };
 
 #ifdef VPR_DEBUG_PARTITION_TREE
@@ -148,6 +148,7 @@ void route_budgets::load_route_budgets(NetPinsMatrix<float>& net_delay,
     } else if (router_opts.routing_budgets_algorithm == SCALE_DELAY) {
         allocate_slack_using_delays_and_criticalities(net_delay, timing_info, netlist_pin_lookup, router_opts);
     }
+    free_sta_timing_infos();
     set = true;
 }
 
@@ -194,8 +195,13 @@ void route_budgets::allocate_slack_using_weights(NetPinsMatrix<float>& net_delay
     /*Preprocessing algorithm in order to consider short paths when setting initial maximum budgets.
      * Not necessary unless budgets are really hard to meet*/
     // process_negative_slack_using_minimax();
+
+    /*The connection delays do not change while the budgets are allocated, so their timing
+     * is only analyzed once and shared by all the passes below*/
+    original_timing_info = perform_sta(net_delay);
+
     if (negative_hold_slack) {
-        process_negative_slack_using_minimax(net_delay, netlist_pin_lookup);
+        process_negative_slack_using_minimax(original_timing_info, net_delay, netlist_pin_lookup);
     }
 
     iteration = 0;
@@ -205,8 +211,6 @@ void route_budgets::allocate_slack_using_weights(NetPinsMatrix<float>& net_delay
     // An experimentally derived constant that allows for a balance between budget calculation time, and quality
     constexpr float MAX_BUDGET_CHANGE_THRESHOLD = 5e-12;
 
-    original_timing_info = perform_sta(net_delay);
-
     /*This allocates long path slack and increases the budgets*/
     while ((iteration > 3 && max_budget_change > MAX_BUDGET_CHANGE_THRESHOLD) || iteration <= 3) {
         timing_info = perform_sta(delay_max_budget);
@@ -230,9 +234,6 @@ void route_budgets::allocate_slack_using_weights(NetPinsMatrix<float>& net_delay
     /*Set the minimum budgets equal to the maximum budgets*/
     set_min_max_budgets_equal();
 
-    original_timing_info = perform_sta(net_delay);
-    timing_info_min = perform_sta(delay_min_budget);
-
     iteration = 0;
     max_budget_change = 900e-12;
 
@@ -253,7 +254,6 @@ void route_budgets::allocate_slack_using_weights(NetPinsMatrix<float>& net_delay
     max_budget_change = 900e-12;
     float bottom_range = -1e-9;
 
-    original_timing_info = perform_sta(net_delay);
     while (iteration < 5 && max_budget_change > MAX_BUDGET_CHANGE_THRESHOLD) {
         /*budgets must be in bounds before timing analysis*/
         if (iteration != 0) {
@@ -267,7 +267,9 @@ void route_budgets::allocate_slack_using_weights(NetPinsMatrix<float>& net_delay
     keep_budget_above_value(delay_min_budget, bottom_range);
 }
 
-void route_budgets::process_negative_slack_using_minimax(NetPinsMatrix<float>& net_delay, const ClusteredPinAtomPinsLookup& netlist_pin_lookup) {
+void route_budgets::process_negative_slack_using_minimax(std::shared_ptr<SetupHoldTimingInfo> original_timing_info,
+                                                         NetPinsMatrix<float>& net_delay,
+                                                         const ClusteredPinAtomPinsLookup& netlist_pin_lookup) {
     /*This function is an optional pre-processing for the maximum budgets.
      * This ensures that the short path slacks are also taken into account for the maximum budgets.
      * Ensures that maximum budgets will always be above minimum budgets.
@@ -275,12 +277,10 @@ void route_budgets::process_negative_slack_using_minimax(NetPinsMatrix<float>& n
     unsigned iteration;
     float max_budget_change;
     std::shared_ptr<SetupHoldTimingInfo> timing_info = nullptr;
-    std::shared_ptr<SetupHoldTimingInfo> original_timing_info = nullptr;
 
     iteration = 0;
     max_budget_change = 900e-12;
     float second_max_budget_change = 900e-12;
-    original_timing_info = perform_sta(net_delay);
 
     // Cutoff threshold so if budgets aren't changing, stop early
     constexpr float MAX_BUDGET_CHANGE_THRESHOLD_PREPROCESSING = 5e-12;
@@ -659,21 +659,33 @@ void route_budgets::check_if_budgets_in_bounds() {
 }
 
 std::shared_ptr<SetupHoldTimingInfo> route_budgets::perform_sta(NetPinsMatrix<float>& temp_budgets) {
-    auto& atom_ctx = g_vpr_ctx.atom();
-    /*Perform static timing analysis to get the delay and path weights for slack allocation*/
-    std::shared_ptr<RoutingDelayCalculator> routing_delay_calc = std::make_shared<RoutingDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, temp_budgets, is_flat_);
-
-    //TODO: now that we support incremental timing updates, we should avoid re-building the timing analyzer from scratch and try
-    //      to calculate this incrementally
-    std::shared_ptr<SetupHoldTimingInfo> timing_info = make_setup_hold_timing_info(routing_delay_calc, e_timing_update_type::AUTO);
-
-    /*Unconstrained nodes should be warned in the main routing function, do not report it here*/
-    timing_info->set_warn_unconstrained(false);
+    /*Perform static timing analysis to get the delay and path weights for slack allocation.
+     * The delay calculator refers to temp_budgets, so the analyzer built the first time a matrix
+     * is analyzed is simply updated on the next analyses of that matrix. This avoids re-building
+     * the analyzer (and re-computing the delays within the clusters) on every iteration of the
+     * slack allocation loops; each update is still a full levelized (and parallel) walk of the
+     * timing graph, since every budget may have changed.
+     * Note the previous results of the matrix are overwritten.*/
+    auto& timing_info = sta_timing_infos_[&temp_budgets];
+    if (!timing_info) {
+        auto& atom_ctx = g_vpr_ctx.atom();
+        std::shared_ptr<RoutingDelayCalculator> routing_delay_calc = std::make_shared<RoutingDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, temp_budgets, is_flat_);
+
+        timing_info = make_setup_hold_timing_info(routing_delay_calc, e_timing_update_type::FULL);
+
+        /*Unconstrained nodes should be warned in the main routing function, do not report it here*/
+        timing_info->set_warn_unconstrained(false);
+    }
     timing_info->update();
 
     return timing_info;
 }
 
+void route_budgets::free_sta_timing_infos() {
+    /*The budget matrices are re-allocated when the budgets are next loaded*/
+    sta_timing_infos_.clear();
+}
+
 void route_budgets::update_congestion_times(ParentNetId net_id) {
     /*Calling this function indicates this net is congested in
      * this routing iteration. This vector keeps the number of
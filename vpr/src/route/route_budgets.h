@@ -79,10 +79,13 @@ class route_budgets {
                        bool keep_in_bounds,
                        slack_allocated_type slack_type = BOTH);
 
-    void process_negative_slack_using_minimax(NetPinsMatrix<float>& net_delay, const ClusteredPinAtomPinsLookup& netlist_pin_lookup);
+    void process_negative_slack_using_minimax(std::shared_ptr<SetupHoldTimingInfo> original_timing_info,
+                                              NetPinsMatrix<float>& net_delay,
+                                              const ClusteredPinAtomPinsLookup& netlist_pin_lookup);
 
     /*Perform static timing analysis*/
     std::shared_ptr<SetupHoldTimingInfo> perform_sta(NetPinsMatrix<float>& temp_budgets);
+    void free_sta_timing_infos();
 
     /*checks*/
     void keep_budget_in_bounds(NetPinsMatrix<float>& temp_budgets);
@@ -138,6 +141,10 @@ class route_budgets {
     /*flag to reroute each net for hold violation*/
     std::map<ParentNetId, bool> should_reroute_for_hold;
     std::map<ParentNetId, int> hold_fac;
+
+    /*timing analyzers of the delay matrices analyzed by perform_sta, re-used by every
+     * analysis of the same matrix while the budgets are being loaded*/
+    std::map<const NetPinsMatrix<float>*, std::shared_ptr<SetupHoldTimingInfo>> sta_timing_infos_;
 };
 
 #endif /* ROUTE_BUDGETS_H */
@@ -3,11 +3,14 @@
 #include <cmath>
 #include <algorithm>
 #include <vector>
+#include <atomic>
 #include <iostream>
 
 #include "route_tree.h"
+#include "place_congestion.h"
 #include "vtr_assert.h"
 #include "vtr_util.h"
+#include "vtr_math.h"
 #include "vtr_log.h"
 #include "vtr_digest.h"
 #include "vtr_memory.h"
@@ -31,6 +34,7 @@
 #include "atom_netlist_utils.h"
 
 #include "route_profiling.h"
+#include "read_route.h"
 
 #include "timing_util.h"
 #include "RoutingDelayCalculator.h"
@@ -40,6 +44,10 @@
 #include "bucket.h"
 #include "draw_global.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 /*  The numbering relation between the channels and clbs is:				*
  *																	        *
  *  |    IO     | chan_   |   CLB     | chan_   |   CLB     |               *
@@ -89,6 +97,8 @@ static t_clb_opins_used alloc_and_load_clb_opins_used_locally();
 
 static void adjust_one_rr_occ_and_acc_cost(RRNodeId inode, int add_or_sub, float acc_fac);
 
+static void add_overuse_candidate(RRNodeId inode);
+
 static vtr::vector<ParentNetId, uint8_t> load_is_clock_net(const Netlist<>& net_list,
                                                            bool is_flat);
 
@@ -101,7 +111,7 @@ void save_routing(vtr::vector<ParentNetId, vtr::optional<RouteTree>>& best_routi
                   t_clb_opins_used& saved_clb_opins_used_locally) {
     auto& route_ctx = g_vpr_ctx.routing();
 
-    best_routing = route_ctx.route_trees;
+    copy_route_trees(best_routing, route_ctx.route_trees);
 
     /* Save which OPINs are locally used. */
     saved_clb_opins_used_locally = clb_opins_used_locally;
@@ -114,7 +124,7 @@ void restore_routing(vtr::vector<ParentNetId, vtr::optional<RouteTree>>& best_ro
                      const t_clb_opins_used& saved_clb_opins_used_locally) {
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    route_ctx.route_trees = best_routing;
+    copy_route_trees(route_ctx.route_trees, best_routing);
 
     /* Restore which OPINs are locally used. */
     clb_opins_used_locally = saved_clb_opins_used_locally;
@@ -203,13 +213,17 @@ bool try_route(const Netlist<>& net_list,
                t_direct_inf* directs,
                int num_directs,
                ScreenUpdatePriority first_iteration_priority,
-               bool is_flat) {
+               bool is_flat,
+               t_rr_wire_history* warm_start_history) {
     /* Attempts a routing via an iterated maze router algorithm.  Width_fac *
      * specifies the relative width of the channels, while the members of   *
      * router_opts determine the value of the costs assigned to routing     *
      * resource node, etc.  det_routing_arch describes the detailed routing *
      * architecture (connection and switch boxes) of the FPGA; it is used   *
-     * only if a DETAILED routing has been selected.                        */
+     * only if a DETAILED routing has been selected.                        *
+     * If warm_start_history is given, routing starts from its congestion   *
+     * history and the router lookahead survives the RR graph rebuild; the  *
+     * congestion history of this routing is stored into it afterwards.     */
 
     auto& device_ctx = g_vpr_ctx.mutable_device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -230,6 +244,15 @@ bool try_route(const Netlist<>& net_list,
     /* Set up the routing resource graph defined by this FPGA architecture. */
     int warning_count;
 
+    /* Rebuilding the RR graph invalidates the cached router lookahead. Its cost *
+     * maps do not depend on the number of tracks, so keep it when warm starting */
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    auto warm_lookahead_key = route_ctx.router_lookahead_cache_key_;
+    std::unique_ptr<RouterLookahead> warm_lookahead;
+    if (warm_start_history) {
+        warm_lookahead.reset(route_ctx.cached_router_lookahead_.release());
+    }
+
     create_rr_graph(graph_type,
                     device_ctx.physical_tile_types,
                     device_ctx.grid,
@@ -250,11 +273,23 @@ bool try_route(const Netlist<>& net_list,
     /* Allocate and load additional rr_graph information needed only by the router. */
     alloc_and_load_rr_node_route_structs();
 
+    if (warm_lookahead) {
+        route_ctx.cached_router_lookahead_.set(warm_lookahead_key, std::move(warm_lookahead));
+    }
+    if (warm_start_history && !warm_start_history->wires.empty()) {
+        load_rr_wire_history(*warm_start_history);
+    }
+
     init_route_structs(net_list,
                        router_opts.bb_factor,
                        router_opts.has_choking_spot,
                        is_flat);
 
+    //Start an ECO routing from the still legal net routings of the previous routing
+    if (!router_opts.eco_route_file.empty()) {
+        read_eco_route(router_opts.eco_route_file.c_str(), net_list);
+    }
+
     if (net_list.nets().empty()) {
         VTR_LOG_WARN("No nets to route\n");
     }
@@ -306,9 +341,72 @@ bool try_route(const Netlist<>& net_list,
         profiling::time_on_fanout_analysis();
     }
 
+    if (warm_start_history) {
+        save_rr_wire_history(*warm_start_history);
+    }
+
     return (success);
 }
 
+void save_rr_wire_history(t_rr_wire_history& history) {
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    history.chan_width = device_ctx.chan_width;
+    history.wires.clear();
+
+    for (const RRNodeId& rr_id : rr_graph.nodes()) {
+        t_rr_type type = rr_graph.node_type(rr_id);
+        float acc_cost = route_ctx.rr_node_route_inf[rr_id].acc_cost;
+
+        /* Wires which were never overused have the initial acc_cost of 1 */
+        if ((type != CHANX && type != CHANY) || acc_cost <= 1.) {
+            continue;
+        }
+
+        history.wires.push_back({type,
+                                 rr_graph.node_layer(rr_id),
+                                 rr_graph.node_xlow(rr_id),
+                                 rr_graph.node_ylow(rr_id),
+                                 rr_graph.node_track_num(rr_id),
+                                 rr_graph.node_direction(rr_id),
+                                 acc_cost});
+    }
+}
+
+void load_rr_wire_history(const t_rr_wire_history& history) {
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    size_t num_loaded = 0;
+    for (const auto& wire : history.wires) {
+        int old_width = (wire.type == CHANX) ? history.chan_width.x_max : history.chan_width.y_max;
+        int new_width = (wire.type == CHANX) ? device_ctx.chan_width.x_max : device_ctx.chan_width.y_max;
+        if (old_width <= 0 || new_width <= 0) {
+            continue;
+        }
+
+        /* Keep the track's relative position in the channel, which roughly *
+         * preserves its segment type. Unidirectional tracks alternate in   *
+         * direction, so also try the neighbouring track.                   */
+        int track = static_cast<int>(static_cast<long>(wire.track) * new_width / old_width);
+        for (int candidate : {track, track ^ 1}) {
+            RRNodeId rr_id = rr_graph.node_lookup().find_node(wire.layer, wire.x, wire.y, wire.type, candidate);
+            if (rr_id && rr_graph.node_direction(rr_id) == wire.direction) {
+                auto& node_inf = route_ctx.rr_node_route_inf[rr_id];
+                node_inf.acc_cost = std::max(node_inf.acc_cost, wire.acc_cost);
+                ++num_loaded;
+                break;
+            }
+        }
+    }
+
+    VTR_LOG("Warm-started routing with the congestion history of %zu of %zu wires (channel width %d -> %d)\n",
+            num_loaded, history.wires.size(), history.chan_width.max, device_ctx.chan_width.max);
+}
+
 bool feasible_routing() {
     /* This routine checks to see if this is a resource-feasible routing.      *
      * That is, are all rr_node capacity limitations respected?  It assumes    *
@@ -318,7 +416,7 @@ bool feasible_routing() {
     const auto& rr_graph = device_ctx.rr_graph;
     auto& route_ctx = g_vpr_ctx.routing();
 
-    for (const RRNodeId& rr_id : rr_graph.nodes()) {
+    for (const RRNodeId& rr_id : route_ctx.overuse_candidates) {
         if (route_ctx.rr_node_route_inf[rr_id].occ() > rr_graph.node_capacity(rr_id)) {
             return (false);
         }
@@ -334,7 +432,7 @@ std::vector<RRNodeId> collect_congested_rr_nodes() {
     auto& route_ctx = g_vpr_ctx.routing();
 
     std::vector<RRNodeId> congested_rr_nodes;
-    for (const RRNodeId inode : device_ctx.rr_graph.nodes()) {
+    for (const RRNodeId inode : route_ctx.overuse_candidates) {
         short occ = route_ctx.rr_node_route_inf[inode].occ();
         short capacity = rr_graph.node_capacity(inode);
 
@@ -343,22 +441,35 @@ std::vector<RRNodeId> collect_congested_rr_nodes() {
         }
     }
 
+    //In RR node order, as when the whole RR graph was swept
+    std::sort(congested_rr_nodes.begin(), congested_rr_nodes.end());
+
     return congested_rr_nodes;
 }
 
-/* Returns a vector from [0..device_ctx.rr_nodes.size()-1] containing the set
- * of nets using each RR node */
-vtr::vector<RRNodeId, std::set<ClusterNetId>> collect_rr_node_nets() {
-    auto& device_ctx = g_vpr_ctx.device();
+/* Returns the nets (in ascending order) using each of rr_nodes. Only the given
+ * nodes are looked up, in a single pass over the route trees */
+std::unordered_map<RRNodeId, std::vector<ClusterNetId>> collect_rr_node_nets(const std::vector<RRNodeId>& rr_nodes) {
     auto& route_ctx = g_vpr_ctx.routing();
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    vtr::vector<RRNodeId, std::set<ClusterNetId>> rr_node_nets(device_ctx.rr_graph.num_nodes());
+    std::unordered_map<RRNodeId, std::vector<ClusterNetId>> rr_node_nets;
+    rr_node_nets.reserve(rr_nodes.size());
+    for (RRNodeId inode : rr_nodes) {
+        rr_node_nets[inode];
+    }
+
     for (ClusterNetId inet : cluster_ctx.clb_nlist.nets()) {
         if (!route_ctx.route_trees[inet])
             continue;
         for (auto& rt_node : route_ctx.route_trees[inet].value().all_nodes()) {
-            rr_node_nets[rt_node.inode].insert(inet);
+            auto itr = rr_node_nets.find(rt_node.inode);
+            if (itr == rr_node_nets.end())
+                continue;
+            //Nets are visited in order, so a net already recorded is the last one
+            if (itr->second.empty() || itr->second.back() != inet) {
+                itr->second.push_back(inet);
+            }
         }
     }
     return rr_node_nets;
@@ -370,10 +481,56 @@ void pathfinder_update_single_node_occupancy(RRNodeId inode, int add_or_sub) {
 
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    int occ = route_ctx.rr_node_route_inf[inode].occ() + add_or_sub;
-    route_ctx.rr_node_route_inf[inode].set_occ(occ);
+    int occ;
+    if (route_ctx.concurrent_occupancy_updates) {
+        occ = route_ctx.rr_node_route_inf[inode].add_occ_concurrent(add_or_sub);
+    } else {
+        occ = route_ctx.rr_node_route_inf[inode].occ() + add_or_sub;
+        route_ctx.rr_node_route_inf[inode].set_occ(occ);
+    }
     // can't have negative occupancy
     VTR_ASSERT(occ >= 0);
+
+    if (add_or_sub > 0 && occ > g_vpr_ctx.device().rr_graph.node_capacity(inode)) {
+        add_overuse_candidate(inode);
+    }
+}
+
+void pathfinder_reset_occupancy() {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    size_t num_nodes = route_ctx.rr_node_route_inf.size();
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_nodes, [&](size_t inode) {
+#else
+    for (size_t inode = 0; inode < num_nodes; ++inode) {
+#endif
+        route_ctx.rr_node_route_inf[RRNodeId(inode)].set_occ(0);
+#ifdef VPR_USE_TBB
+    });
+#else
+    }
+#endif
+
+    for (RRNodeId inode : route_ctx.overuse_candidates) {
+        route_ctx.is_overuse_candidate[inode] = 0;
+    }
+    route_ctx.overuse_candidates.clear();
+}
+
+/* Records that inode is (now) overused, see RoutingContext::overuse_candidates */
+static void add_overuse_candidate(RRNodeId inode) {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    //Claimed atomically, since the speculative parallel router may route several
+    //nets using this node at the same time. Only the thread claiming the flag
+    //adds the node to the list.
+    if (__atomic_exchange_n(&route_ctx.is_overuse_candidate[inode], 1, __ATOMIC_RELAXED)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(route_ctx.overuse_candidates_mutex);
+    route_ctx.overuse_candidates.push_back(inode);
 }
 
 void pathfinder_update_acc_cost_and_overuse_info(float acc_fac, OveruseInfo& overuse_info) {
@@ -382,26 +539,34 @@ void pathfinder_update_acc_cost_and_overuse_info(float acc_fac, OveruseInfo& ove
      * It updates the accumulated cost to by adding in the number of extra signals      *
      * sharing a resource right now (i.e. after each complete iteration) times acc_fac. *
      * THIS ROUTINE ASSUMES THE OCCUPANCY VALUES IN RR_NODE ARE UP TO DATE.             *
-     * This routine also creates a new overuse info for the current routing iteration.  */
+     * This routine also creates a new overuse info for the current routing iteration.  *
+     * Only the overuse candidates can be overused, so only they are visited.            */
 
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
     auto& route_ctx = g_vpr_ctx.mutable_routing();
     size_t overused_nodes = 0, total_overuse = 0, worst_overuse = 0;
 
-    for (const RRNodeId& rr_id : rr_graph.nodes()) {
+    auto& candidates = route_ctx.overuse_candidates;
+    size_t num_candidates = 0;
+    for (const RRNodeId rr_id : candidates) {
         int overuse = route_ctx.rr_node_route_inf[rr_id].occ() - rr_graph.node_capacity(rr_id);
 
         // If overused, update the acc_cost and add this node to the overuse info
-        // If not, do nothing
+        // If not, it stops being a candidate until its occupancy grows over capacity again
         if (overuse > 0) {
             route_ctx.rr_node_route_inf[rr_id].acc_cost += overuse * acc_fac;
 
             ++overused_nodes;
             total_overuse += overuse;
             worst_overuse = std::max(worst_overuse, size_t(overuse));
+
+            candidates[num_candidates++] = rr_id;
+        } else {
+            route_ctx.is_overuse_candidate[rr_id] = 0;
         }
     }
+    candidates.resize(num_candidates);
 
     // Update overuse info
     overuse_info.overused_nodes = overused_nodes;
@@ -466,17 +631,14 @@ void init_route_structs(const Netlist<>& net_list,
     }
 }
 
-/* The routine sets the path_cost to HUGE_POSITIVE_FLOAT for  *
- * all channel segments touched by previous routing phases.    */
-void reset_path_costs(const std::vector<RRNodeId>& visited_rr_nodes) {
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
-
-    for (auto node : visited_rr_nodes) {
-        route_ctx.rr_node_route_inf[node].path_cost = std::numeric_limits<float>::infinity();
-        route_ctx.rr_node_route_inf[node].backward_path_cost = std::numeric_limits<float>::infinity();
-        route_ctx.rr_node_route_inf[node].prev_node = RRNodeId::INVALID();
-        route_ctx.rr_node_route_inf[node].prev_edge = RREdgeId::INVALID();
-    }
+/* Returns a new path search epoch. Starting one resets the path search *
+ * fields of all the rr_nodes searched by the previous routing phases.   */
+uint64_t new_path_search_epoch() {
+    //Epochs are shared by all the routers (and threads), as several routers may search
+    //the same rr_node_path_inf (or copies of it). Epoch 0 is never returned, so that the path search
+    //fields of a node are stale until a path search stamps them.
+    static std::atomic<uint64_t> next_epoch(1);
+    return next_epoch++;
 }
 
 /* Returns the congestion cost of using this rr-node plus that of any      *
@@ -508,26 +670,26 @@ float get_rr_cong_cost(RRNodeId inode, float pres_fac) {
  * this number can occasionally be greater than 1 -- think of connecting   *
  * the same net to two inputs of an and-gate (and-gate inputs are logically *
  * equivalent, so both will connect to the same SINK).                      */
-void mark_ends(const Netlist<>& net_list, ParentNetId net_id) {
+void mark_ends(const Netlist<>& net_list, ParentNetId net_id, vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf) {
     unsigned int ipin;
     RRNodeId inode;
 
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    auto& route_ctx = g_vpr_ctx.routing();
 
     for (ipin = 1; ipin < net_list.net_pins(net_id).size(); ipin++) {
         inode = route_ctx.net_rr_terminals[net_id][ipin];
-        route_ctx.rr_node_route_inf[inode].target_flag++;
+        rr_node_path_inf[inode].target_flag++;
     }
 }
 
 /** like mark_ends, but only performs it for the remaining sinks of a net */
-void mark_remaining_ends(ParentNetId net_id) {
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
+void mark_remaining_ends(ParentNetId net_id, vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf) {
+    auto& route_ctx = g_vpr_ctx.routing();
     const auto& tree = route_ctx.route_trees[net_id].value();
 
     for (int sink_pin : tree.get_remaining_isinks()) {
         RRNodeId inode = route_ctx.net_rr_terminals[net_id][sink_pin];
-        ++route_ctx.rr_node_route_inf[inode].target_flag;
+        ++rr_node_path_inf[inode].target_flag;
     }
 }
 
@@ -617,6 +779,8 @@ void alloc_and_load_rr_node_route_structs() {
     auto& device_ctx = g_vpr_ctx.device();
 
     route_ctx.rr_node_route_inf.resize(device_ctx.rr_graph.num_nodes());
+    route_ctx.rr_node_path_inf.resize(device_ctx.rr_graph.num_nodes());
+    route_ctx.is_overuse_candidate.resize(device_ctx.rr_graph.num_nodes());
     route_ctx.non_configurable_bitset.resize(device_ctx.rr_graph.num_nodes());
     route_ctx.non_configurable_bitset.fill(false);
 
@@ -635,18 +799,25 @@ void reset_rr_node_route_structs() {
     auto& device_ctx = g_vpr_ctx.device();
 
     VTR_ASSERT(route_ctx.rr_node_route_inf.size() == size_t(device_ctx.rr_graph.num_nodes()));
+    VTR_ASSERT(route_ctx.rr_node_path_inf.size() == size_t(device_ctx.rr_graph.num_nodes()));
 
     for (const RRNodeId& rr_id : device_ctx.rr_graph.nodes()) {
         auto& node_inf = route_ctx.rr_node_route_inf[rr_id];
 
-        node_inf.prev_node = RRNodeId::INVALID();
-        node_inf.prev_edge = RREdgeId::INVALID();
         node_inf.acc_cost = 1.0;
-        node_inf.path_cost = std::numeric_limits<float>::infinity();
-        node_inf.backward_path_cost = std::numeric_limits<float>::infinity();
-        node_inf.target_flag = 0;
         node_inf.set_occ(0);
+
+        auto& path_inf = route_ctx.rr_node_path_inf[rr_id];
+
+        path_inf.prev_node = RRNodeId::INVALID();
+        path_inf.prev_edge = RREdgeId::INVALID();
+        path_inf.path_cost = std::numeric_limits<float>::infinity();
+        path_inf.backward_path_cost = std::numeric_limits<float>::infinity();
+        path_inf.target_flag = 0;
     }
+
+    route_ctx.overuse_candidates.clear();
+    route_ctx.is_overuse_candidate.assign(device_ctx.rr_graph.num_nodes(), 0);
 }
 
 /* Allocates and loads the route_ctx.net_rr_terminals data structure. For each net it stores the rr_node   *
@@ -870,6 +1041,74 @@ vtr::vector<ParentNetId, t_bb> load_route_bb(const Netlist<>& net_list,
     return route_bb;
 }
 
+vtr::vector<ParentNetId, t_bb> load_predicted_route_bb(const Netlist<>& net_list,
+                                                       int bb_factor) {
+    //The smallest predicted margin, so that nets can still detour around their terminals
+    constexpr int MIN_PREDICTED_BB_MARGIN = 1;
+
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.routing();
+    auto& grid = device_ctx.grid;
+
+    int max_dim = std::max<int>(grid.width() - 1, grid.height() - 1);
+    bb_factor = std::min(bb_factor, max_dim);
+
+    if (bb_factor <= MIN_PREDICTED_BB_MARGIN) {
+        return load_route_bb(net_list, bb_factor);
+    }
+
+    //The terminal bounding boxes (the clock nets already span the device)
+    vtr::vector<ParentNetId, t_bb> route_bb = load_route_bb(net_list, 0);
+
+    PlacerCongestionMap congestion_map(grid.width(), grid.height());
+    for (size_t x = 0; x < grid.width(); ++x) {
+        for (size_t y = 0; y < grid.height(); ++y) {
+            congestion_map.set_capacity(x, y, device_ctx.chan_width.x_list[y] + device_ctx.chan_width.y_list[x]);
+        }
+    }
+    for (ParentNetId net_id : net_list.nets()) {
+        if (route_ctx.is_clock_net[net_id] || net_list.net_is_ignored(net_id)) {
+            continue;
+        }
+        const t_bb& bb = route_bb[net_id];
+        congestion_map.add_net({bb.xmin, bb.ymin, bb.xmax, bb.ymax},
+                               (bb.xmax - bb.xmin + 1) + (bb.ymax - bb.ymin + 1));
+    }
+
+    size_t num_predicted_nets = 0;
+    size_t num_tight_nets = 0;
+    double total_margin = 0.;
+    for (ParentNetId net_id : net_list.nets()) {
+        if (route_ctx.is_clock_net[net_id]) {
+            continue;
+        }
+
+        const t_bb& bb = route_bb[net_id];
+        double demand = 0.;
+        double capacity = 0.;
+        for (int x = bb.xmin; x <= bb.xmax; ++x) {
+            for (int y = bb.ymin; y <= bb.ymax; ++y) {
+                demand += congestion_map.demand(x, y);
+                capacity += congestion_map.capacity(x, y);
+            }
+        }
+        double utilization = (capacity > 0.) ? demand / capacity : 1.;
+
+        int margin = std::ceil(bb_factor * utilization);
+        margin = std::min(bb_factor, std::max(MIN_PREDICTED_BB_MARGIN, margin));
+        route_bb[net_id] = load_net_route_bb(net_list, net_id, margin);
+
+        ++num_predicted_nets;
+        num_tight_nets += (margin < bb_factor);
+        total_margin += margin;
+    }
+
+    VTR_LOG("Predicted router bounding boxes: %zu of %zu nets with a margin below --bb_factor %d (average margin %.2f)\n",
+            num_tight_nets, num_predicted_nets, bb_factor, vtr::safe_ratio(total_margin, double(num_predicted_nets)));
+
+    return route_bb;
+}
+
 t_bb load_net_route_bb(const Netlist<>& net_list,
                        ParentNetId net_id,
                        int bb_factor) {
@@ -948,14 +1187,6 @@ t_bb load_net_route_bb(const Netlist<>& net_list,
     return bb;
 }
 
-void add_to_mod_list(RRNodeId inode, std::vector<RRNodeId>& modified_rr_node_inf) {
-    auto& route_ctx = g_vpr_ctx.routing();
-
-    if (std::isinf(route_ctx.rr_node_route_inf[inode].path_cost)) {
-        modified_rr_node_inf.push_back(inode);
-    }
-}
-
 //To ensure the router can only swap pins which are actually logically equivalent, some block output pins must be
 //reserved in certain cases.
 //
@@ -1031,9 +1262,14 @@ void reserve_locally_used_opins(HeapInterface* heap, float pres_fac, float acc_f
 
                 //Add the OPIN to the heap according to it's congestion cost
                 cost = get_rr_cong_cost(to_node, pres_fac);
-                add_node_to_heap(heap, route_ctx.rr_node_route_inf,
-                                 to_node, cost, RRNodeId::INVALID(), RREdgeId::INVALID(),
-                                 0., 0.);
+                t_heap* hptr = heap->alloc();
+                hptr->index = to_node;
+                hptr->cost = cost;
+                hptr->set_prev_node(RRNodeId::INVALID());
+                hptr->set_prev_edge(RREdgeId::INVALID());
+                hptr->backward_path_cost = 0.;
+                hptr->R_upstream = 0.;
+                heap->add_to_heap(hptr);
             }
 
             for (ipin = 0; ipin < num_local_opin; ipin++) {
@@ -1065,6 +1301,9 @@ static void adjust_one_rr_occ_and_acc_cost(RRNodeId inode, int add_or_sub, float
     int new_occ = route_ctx.rr_node_route_inf[inode].occ() + add_or_sub;
     int capacity = rr_graph.node_capacity(inode);
     route_ctx.rr_node_route_inf[inode].set_occ(new_occ);
+    if (add_or_sub == 1 && new_occ > capacity) {
+        add_overuse_candidate(inode);
+    }
 
     if (new_occ < capacity) {
     } else {
@@ -1121,13 +1360,24 @@ void print_invalid_routing_info(const Netlist<>& net_list, bool is_flat) {
     }
 }
 
+/* Returns the epoch of the latest path search recorded in rr_node_path_inf *
+ * (0 if none). The path search fields of the other epochs have been reset. */
+static uint64_t latest_path_epoch(const vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf) {
+    uint64_t latest_epoch = 0;
+    for (const t_rr_node_path_inf& inf : rr_node_path_inf) {
+        latest_epoch = std::max(latest_epoch, inf.path_epoch);
+    }
+    return latest_epoch;
+}
+
 void print_rr_node_route_inf() {
     auto& route_ctx = g_vpr_ctx.routing();
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
-    for (size_t inode = 0; inode < route_ctx.rr_node_route_inf.size(); ++inode) {
-        const auto& inf = route_ctx.rr_node_route_inf[RRNodeId(inode)];
-        if (!std::isinf(inf.path_cost)) {
+    uint64_t path_epoch = latest_path_epoch(route_ctx.rr_node_path_inf);
+    for (size_t inode = 0; inode < route_ctx.rr_node_path_inf.size(); ++inode) {
+        const auto& inf = route_ctx.rr_node_path_inf[RRNodeId(inode)];
+        if (path_epoch != 0 && inf.path_epoch == path_epoch) {
             RRNodeId prev_node = inf.prev_node;
             RREdgeId prev_edge = inf.prev_edge;
             auto switch_id = rr_graph.rr_nodes().edge_switch(prev_edge);
@@ -1149,21 +1399,23 @@ void print_rr_node_route_inf_dot() {
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
 
+    uint64_t path_epoch = latest_path_epoch(route_ctx.rr_node_path_inf);
+
     VTR_LOG("digraph G {\n");
     VTR_LOG("\tnode[shape=record]\n");
-    for (size_t inode = 0; inode < route_ctx.rr_node_route_inf.size(); ++inode) {
-        const auto& inf = route_ctx.rr_node_route_inf[RRNodeId(inode)];
-        if (!std::isinf(inf.path_cost)) {
+    for (size_t inode = 0; inode < route_ctx.rr_node_path_inf.size(); ++inode) {
+        const auto& inf = route_ctx.rr_node_path_inf[RRNodeId(inode)];
+        if (path_epoch != 0 && inf.path_epoch == path_epoch) {
             VTR_LOG("\tnode%zu[label=\"{%zu (%s)", inode, inode, rr_graph.node_type_string(RRNodeId(inode)));
-            if (inf.occ() > rr_graph.node_capacity(RRNodeId(inode))) {
+            if (route_ctx.rr_node_route_inf[RRNodeId(inode)].occ() > rr_graph.node_capacity(RRNodeId(inode))) {
                 VTR_LOG(" x");
             }
             VTR_LOG("}\"]\n");
         }
     }
-    for (size_t inode = 0; inode < route_ctx.rr_node_route_inf.size(); ++inode) {
-        const auto& inf = route_ctx.rr_node_route_inf[RRNodeId(inode)];
-        if (!std::isinf(inf.path_cost)) {
+    for (size_t inode = 0; inode < route_ctx.rr_node_path_inf.size(); ++inode) {
+        const auto& inf = route_ctx.rr_node_path_inf[RRNodeId(inode)];
+        if (path_epoch != 0 && inf.path_epoch == path_epoch) {
             RRNodeId prev_node = inf.prev_node;
             RREdgeId prev_edge = inf.prev_edge;
             auto switch_id = rr_graph.rr_nodes().edge_switch(prev_edge);
@@ -16,8 +16,22 @@ t_bb load_net_route_bb(const Netlist<>& net_list,
                        ParentNetId net_id,
                        int bb_factor);
 
+/**
+ * @brief Returns the router bounding boxes of the nets, like load_route_bb(), but with a per-net
+ *        margin (at most bb_factor) predicted from the routing congestion of the placement.
+ *
+ * The routing demand of each net is its half-perimeter wirelength spread uniformly over its
+ * terminal bounding box (RUDY, see place_congestion.h). A net is given a margin of bb_factor
+ * times the demand/capacity ratio of its terminal bounding box, and at least one channel.
+ */
+vtr::vector<ParentNetId, t_bb> load_predicted_route_bb(const Netlist<>& net_list,
+                                                       int bb_factor);
+
 void pathfinder_update_single_node_occupancy(RRNodeId inode, int add_or_sub);
 
+/** Sets the occupancy of all the RR nodes to zero */
+void pathfinder_reset_occupancy();
+
 void pathfinder_update_acc_cost_and_overuse_info(float acc_fac, OveruseInfo& overuse_info);
 
 /** Update pathfinder cost of all nodes under root (including root) */
@@ -25,7 +39,9 @@ void pathfinder_update_cost_from_route_tree(const RouteTreeNode& root, int add_o
 
 float update_pres_fac(float new_pres_fac);
 
-void reset_path_costs(const std::vector<RRNodeId>& visited_rr_nodes);
+/* Returns a new path search epoch, never returned before (by any thread). The path *
+ * search fields of t_rr_node_path_inf stamped with another epoch are stale.        */
+uint64_t new_path_search_epoch();
 
 float get_rr_cong_cost(RRNodeId inode, float pres_fac);
 
@@ -87,11 +103,9 @@ inline float get_single_rr_cong_cost(RRNodeId inode, float pres_fac) {
     return cost;
 }
 
-void mark_ends(const Netlist<>& net_list, ParentNetId net_id);
+void mark_ends(const Netlist<>& net_list, ParentNetId net_id, vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf);
 
-void mark_remaining_ends(ParentNetId net_id);
-
-void add_to_mod_list(RRNodeId inode, std::vector<RRNodeId>& modified_rr_node_inf);
+void mark_remaining_ends(ParentNetId net_id, vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf);
 
 void init_route_structs(const Netlist<>& net_list,
                         int bb_factor,
@@ -124,24 +138,24 @@ float get_cost_from_lookahead(const RouterLookahead& router_lookahead,
                               bool is_flat);
 
 /* Creates a new t_heap object to be placed on the heap, if the new cost    *
- * given is lower than the current path_cost to this channel segment.  The  *
- * index of its predecessor is stored to make traceback easy.  The index of *
- * the edge used to get from its predecessor to it is also stored to make   *
- * timing analysis, etc.                                                    *
+ * given is lower than the current path_cost to this channel segment (as    *
+ * seen by the current path search).  The index of its predecessor is       *
+ * stored to make traceback easy.  The index of the edge used to get from   *
+ * its predecessor to it is also stored to make timing analysis, etc.       *
  *                                                                          *
  * Returns t_heap suitable for adding to heap or nullptr if node is more    *
  * expensive than previously explored path.                                 */
-template<typename T, typename RouteInf>
+template<typename T>
 t_heap* prepare_to_add_node_to_heap(
     T* heap,
-    const RouteInf& rr_node_route_inf,
+    float node_path_cost,
     RRNodeId inode,
     float total_cost,
     RRNodeId prev_node,
     RREdgeId prev_edge,
     float backward_path_cost,
     float R_upstream) {
-    if (total_cost >= rr_node_route_inf[inode].path_cost)
+    if (total_cost >= node_path_cost)
         return nullptr;
 
     t_heap* hptr = heap->alloc();
@@ -155,33 +169,13 @@ t_heap* prepare_to_add_node_to_heap(
     return hptr;
 }
 
-/* Puts an rr_node on the heap if it is the cheapest path.    */
-template<typename T, typename RouteInf>
-void add_node_to_heap(
-    T* heap,
-    const RouteInf& rr_node_route_inf,
-    RRNodeId inode,
-    float total_cost,
-    RRNodeId prev_node,
-    RREdgeId prev_edge,
-    float backward_path_cost,
-    float R_upstream) {
-    t_heap* hptr = prepare_to_add_node_to_heap(
-        heap,
-        rr_node_route_inf, inode, total_cost, prev_node,
-        prev_edge, backward_path_cost, R_upstream);
-    if (hptr) {
-        heap->add_to_heap(hptr);
-    }
-}
-
-/* Puts an rr_node on the heap with the same condition as add_node_to_heap,
- * but do not fix heap property yet as that is more efficiently done from
- * bottom up with build_heap    */
-template<typename T, typename RouteInf>
+/* Puts an rr_node on the heap if it is the cheapest path, but do not fix
+ * heap property yet as that is more efficiently done from bottom up with
+ * build_heap    */
+template<typename T>
 void push_back_node(
     T* heap,
-    const RouteInf& rr_node_route_inf,
+    float node_path_cost,
     RRNodeId inode,
     float total_cost,
     RRNodeId prev_node,
@@ -190,7 +184,7 @@ void push_back_node(
     float R_upstream) {
     t_heap* hptr = prepare_to_add_node_to_heap(
         heap,
-        rr_node_route_inf, inode, total_cost, prev_node, prev_edge,
+        node_path_cost, inode, total_cost, prev_node, prev_edge,
         backward_path_cost, R_upstream);
     if (hptr) {
         heap->push_back(hptr);
@@ -2,10 +2,29 @@
  ******** are used outside the router modules.                     ***********/
 #include "vpr_types.h"
 #include <memory>
+#include <unordered_map>
 #include "timing_info_fwd.h"
 #include "route_common.h"
 #include "RoutingDelayCalculator.h"
 
+/* Congestion history (acc_cost) of the routing wires, keyed by location and track *
+ * rather than RRNodeId so it can seed routing on an RR graph built for another     *
+ * channel width (see save_rr_wire_history() and load_rr_wire_history()).            */
+struct t_rr_wire_history {
+    struct t_wire_cost {
+        t_rr_type type;
+        short layer;
+        short x;
+        short y;
+        int track;
+        Direction direction;
+        float acc_cost;
+    };
+
+    t_chan_width chan_width; ///<Channel widths of the RR graph the history was saved from
+    std::vector<t_wire_cost> wires;
+};
+
 void try_graph(int width_fac,
                const t_router_opts& router_opts,
                t_det_routing_arch* det_routing_arch,
@@ -28,13 +47,21 @@ bool try_route(const Netlist<>& net_list,
                t_direct_inf* directs,
                int num_directs,
                ScreenUpdatePriority first_iteration_priority,
-               bool is_flat);
+               bool is_flat,
+               t_rr_wire_history* warm_start_history = nullptr);
+
+/* Saves the congestion history of every wire which was congested during routing */
+void save_rr_wire_history(t_rr_wire_history& history);
+
+/* Adds a history saved by save_rr_wire_history() to the matching wires of the current *
+ * RR graph. Track numbers are scaled by the change in channel width.                  */
+void load_rr_wire_history(const t_rr_wire_history& history);
 
 bool feasible_routing();
 
 std::vector<RRNodeId> collect_congested_rr_nodes();
 
-vtr::vector<RRNodeId, std::set<ClusterNetId>> collect_rr_node_nets();
+std::unordered_map<RRNodeId, std::vector<ClusterNetId>> collect_rr_node_nets(const std::vector<RRNodeId>& rr_nodes);
 
 t_clb_opins_used alloc_route_structs();
 
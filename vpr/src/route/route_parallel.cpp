@@ -6,12 +6,15 @@
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
+#include <numeric>
 #include <iostream>
 #include <tuple>
 
 #include "binary_heap.h"
 #include "bucket.h"
+#include "four_ary_heap.h"
 #include "concrete_timing_info.h"
+#include "net_pin_criticalities.h"
 #include "connection_router.h"
 #include "draw.h"
 #include "globals.h"
@@ -25,13 +28,17 @@
 // all functions in profiling:: namespace, which are only activated if PROFILE is defined
 #include "route_profiling.h"
 #include "timing_util.h"
+#include "timing_metrics.h"
 #include "vtr_time.h"
 
 #include "NetPinTimingInvalidator.h"
 
 #ifdef VPR_USE_TBB
 
+#    include "tbb/blocked_range.h"
 #    include "tbb/enumerable_thread_specific.h"
+#    include "tbb/parallel_for.h"
+#    include "tbb/partitioner.h"
 #    include "tbb/task_group.h"
 
 /** route_net and similar functions need many bits of state collected from various
@@ -48,7 +55,6 @@ class RouteIterCtx {
     tbb::enumerable_thread_specific<RouterStats> router_stats;
     tbb::enumerable_thread_specific<timing_driven_route_structs> route_structs;
     NetPinsMatrix<float>& net_delay;
-    const ClusteredPinAtomPinsLookup& netlist_pin_lookup;
     std::shared_ptr<SetupHoldTimingInfo> timing_info;
     NetPinTimingInvalidator* pin_timing_invalidator;
     route_budgets& budgeting_inf;
@@ -56,6 +62,9 @@ class RouteIterCtx {
     const RoutingPredictor& routing_predictor;
     const vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>>& choking_spots;
     bool is_flat;
+    /** Heap pushes spent on each net in the last iteration (0 if unknown). Each net is routed
+     * by a single thread, so threads write disjoint elements. Used to balance the partition tree. */
+    vtr::vector<ParentNetId, size_t>& net_effort;
 };
 
 /** Helper for reduce_partition_tree. Traverse \p node's subtree and collect results into \p results */
@@ -107,6 +116,24 @@ static RouteIterResults route_with_partition_tree(tbb::task_group& g, RouteIterC
 template<typename ConnectionRouter>
 static RouteIterResults route_without_partition_tree(std::vector<ParentNetId>& nets_to_route, RouteIterCtx<ConnectionRouter>& ctx);
 
+template<typename ConnectionRouter>
+static RouteIterResults route_speculatively(RouteIterCtx<ConnectionRouter>& ctx);
+
+// Routes with the ConnectionRouter on HeapImplementation, specialized for the
+// common case if use_common_case_connection_router() allows it.
+template<typename HeapImplementation>
+static bool try_parallel_route_heap(const Netlist<>& net_list,
+                                    const t_det_routing_arch& det_routing_arch,
+                                    const t_router_opts& router_opts,
+                                    const t_analysis_opts& analysis_opts,
+                                    const std::vector<t_segment_inf>& segment_inf,
+                                    NetPinsMatrix<float>& net_delay,
+                                    const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                                    std::shared_ptr<SetupHoldTimingInfo> timing_info,
+                                    std::shared_ptr<RoutingDelayCalculator> delay_calc,
+                                    ScreenUpdatePriority first_iteration_priority,
+                                    bool is_flat);
+
 /************************ Subroutine definitions *****************************/
 
 bool try_parallel_route(const Netlist<>& net_list,
@@ -122,7 +149,73 @@ bool try_parallel_route(const Netlist<>& net_list,
                         bool is_flat) {
     switch (router_opts.router_heap) {
         case e_heap_type::BINARY_HEAP:
-            return try_parallel_route_tmpl<ConnectionRouter<BinaryHeap>>(net_list,
+            return try_parallel_route_heap<BinaryHeap>(net_list,
+                                                       det_routing_arch,
+                                                       router_opts,
+                                                       analysis_opts,
+                                                       segment_inf,
+                                                       net_delay,
+                                                       netlist_pin_lookup,
+                                                       timing_info,
+                                                       delay_calc,
+                                                       first_iteration_priority,
+                                                       is_flat);
+            break;
+        case e_heap_type::BUCKET_HEAP_APPROXIMATION:
+            return try_parallel_route_heap<Bucket>(net_list,
+                                                   det_routing_arch,
+                                                   router_opts,
+                                                   analysis_opts,
+                                                   segment_inf,
+                                                   net_delay,
+                                                   netlist_pin_lookup,
+                                                   timing_info,
+                                                   delay_calc,
+                                                   first_iteration_priority,
+                                                   is_flat);
+        case e_heap_type::FOUR_ARY_HEAP:
+            return try_parallel_route_heap<FourAryHeap>(net_list,
+                                                        det_routing_arch,
+                                                        router_opts,
+                                                        analysis_opts,
+                                                        segment_inf,
+                                                        net_delay,
+                                                        netlist_pin_lookup,
+                                                        timing_info,
+                                                        delay_calc,
+                                                        first_iteration_priority,
+                                                        is_flat);
+        default:
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Unknown heap type %d", router_opts.router_heap);
+    }
+}
+
+template<typename HeapImplementation>
+bool try_parallel_route_heap(const Netlist<>& net_list,
+                             const t_det_routing_arch& det_routing_arch,
+                             const t_router_opts& router_opts,
+                             const t_analysis_opts& analysis_opts,
+                             const std::vector<t_segment_inf>& segment_inf,
+                             NetPinsMatrix<float>& net_delay,
+                             const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                             std::shared_ptr<SetupHoldTimingInfo> timing_info,
+                             std::shared_ptr<RoutingDelayCalculator> delay_calc,
+                             ScreenUpdatePriority first_iteration_priority,
+                             bool is_flat) {
+    if (use_common_case_connection_router(router_opts, g_vpr_ctx.device().grid, is_flat)) {
+        return try_parallel_route_tmpl<CommonCaseConnectionRouter<HeapImplementation>>(net_list,
+                                                                                       det_routing_arch,
+                                                                                       router_opts,
+                                                                                       analysis_opts,
+                                                                                       segment_inf,
+                                                                                       net_delay,
+                                                                                       netlist_pin_lookup,
+                                                                                       timing_info,
+                                                                                       delay_calc,
+                                                                                       first_iteration_priority,
+                                                                                       is_flat);
+    }
+    return try_parallel_route_tmpl<ConnectionRouter<HeapImplementation>>(net_list,
                                                                          det_routing_arch,
                                                                          router_opts,
                                                                          analysis_opts,
@@ -133,22 +226,6 @@ bool try_parallel_route(const Netlist<>& net_list,
                                                                          delay_calc,
                                                                          first_iteration_priority,
                                                                          is_flat);
-            break;
-        case e_heap_type::BUCKET_HEAP_APPROXIMATION:
-            return try_parallel_route_tmpl<ConnectionRouter<Bucket>>(net_list,
-                                                                     det_routing_arch,
-                                                                     router_opts,
-                                                                     analysis_opts,
-                                                                     segment_inf,
-                                                                     net_delay,
-                                                                     netlist_pin_lookup,
-                                                                     timing_info,
-                                                                     delay_calc,
-                                                                     first_iteration_priority,
-                                                                     is_flat);
-        default:
-            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Unknown heap type %d", router_opts.router_heap);
-    }
 }
 
 template<typename ConnectionRouter>
@@ -171,6 +248,9 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
     const auto& atom_ctx = g_vpr_ctx.atom();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
+    //Recalculate the criticalities of the connections to route only when they change
+    ScopedNetPinCriticalityTracking net_pin_criticality_tracking(timing_info.get(), net_list, netlist_pin_lookup, is_flat);
+
     auto choking_spots = set_nets_choking_spots(net_list,
                                                 route_ctx.net_terminal_groups,
                                                 route_ctx.net_terminal_group_num,
@@ -187,15 +267,8 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
     /*
      * Configure the routing predictor
      */
-    RoutingPredictor routing_predictor;
-    float abort_iteration_threshold = std::numeric_limits<float>::infinity(); //Default no early abort
-    if (router_opts.routing_failure_predictor == SAFE) {
-        abort_iteration_threshold = ROUTING_PREDICTOR_ITERATION_ABORT_FACTOR_SAFE * router_opts.max_router_iterations;
-    } else if (router_opts.routing_failure_predictor == AGGRESSIVE) {
-        abort_iteration_threshold = ROUTING_PREDICTOR_ITERATION_ABORT_FACTOR_AGGRESSIVE * router_opts.max_router_iterations;
-    } else {
-        VTR_ASSERT_MSG(router_opts.routing_failure_predictor == OFF, "Unrecognized routing failure predictor setting");
-    }
+    RoutingPredictor routing_predictor = make_routing_predictor(router_opts);
+    float abort_iteration_threshold = routing_predictor_abort_threshold(router_opts);
 
     float high_effort_congestion_mode_iteration_threshold = router_opts.congested_routing_iteration_threshold_frac * router_opts.max_router_iterations;
 
@@ -212,11 +285,19 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
 
     CBRR connections_inf{net_list, route_ctx.net_rr_terminals, is_flat};
 
+    //Paths through the clock network used by the second stage of two stage clock routing
+    if (router_opts.two_stage_clock_routing && router_opts.clock_route_templates) {
+        route_ctx.clock_route_templates.build(device_ctx.rr_graph, RRNodeId(device_ctx.virtual_clock_network_root_idx));
+    } else {
+        route_ctx.clock_route_templates.clear();
+    }
+
     route_budgets budgeting_inf(net_list, is_flat);
 
     // This needs to be called before filling intra-cluster lookahead maps to ensure that the intra-cluster lookahead maps are initialized.
     const RouterLookahead* router_lookahead = get_cached_router_lookahead(det_routing_arch,
                                                                           router_opts.lookahead_type,
+                                                                          router_opts.base_cost_type,
                                                                           router_opts.write_router_lookahead,
                                                                           router_opts.read_router_lookahead,
                                                                           segment_inf,
@@ -237,6 +318,7 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
         route_ctx.cached_router_lookahead_.set(cache_key, std::move(mut_router_lookahead));
         router_lookahead = get_cached_router_lookahead(det_routing_arch,
                                                        router_opts.lookahead_type,
+                                                       router_opts.base_cost_type,
                                                        router_opts.write_router_lookahead,
                                                        router_opts.read_router_lookahead,
                                                        segment_inf,
@@ -259,6 +341,10 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
     constexpr float BB_SCALE_FACTOR = 2;
     constexpr int BB_SCALE_ITER_COUNT = 5;
 
+    if (router_opts.route_bb_prediction) {
+        route_ctx.route_bb = load_predicted_route_bb(net_list, bb_fac);
+    }
+
     size_t available_wirelength = calculate_wirelength_available();
 
     /*
@@ -328,7 +414,25 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
             atom_ctx.nlist,
             atom_ctx.lookup,
             *timing_info->timing_graph(),
-            is_flat);
+            is_flat,
+            delay_calc.get());
+    }
+
+    //The nets routed before the first iteration (an ECO routing, see --eco_route) are only rerouted
+    //if congested, so their delays are taken from their route trees rather than estimated
+    size_t num_prerouted_nets = 0;
+    for (auto net_id : net_list.nets()) {
+        if (!route_ctx.route_trees[net_id]) {
+            continue;
+        }
+        for (size_t isink = 1; isink < net_list.net_pins(net_id).size(); isink++) {
+            update_net_delay_from_isink(net_delay[net_id].data(), route_ctx.route_trees[net_id].value(), isink, net_list, net_id, timing_info.get(), pin_timing_invalidator.get());
+        }
+        ++num_prerouted_nets;
+    }
+    if (timing_info && num_prerouted_nets > 0) {
+        timing_info->update();
+        pin_timing_invalidator->reset();
     }
 
     tbb::task_group tbb_task_group;
@@ -336,19 +440,40 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
     /* Set up thread local storage.
      * tbb::enumerable_thread_specific will construct the elements as needed.
      * see https://spec.oneapi.io/versions/1.0-rev-3/elements/oneTBB/source/thread_local_storage/enumerable_thread_specific_cls/construct_destroy_copy.html */
-    auto routers = tbb::enumerable_thread_specific<ConnectionRouter>(ConnectionRouter(
-        device_ctx.grid,
-        *router_lookahead,
-        device_ctx.rr_graph.rr_nodes(),
-        &device_ctx.rr_graph,
-        device_ctx.rr_rc_data,
-        device_ctx.rr_graph.rr_switch(),
-        route_ctx.rr_node_route_inf,
-        is_flat)); /* Here we provide an "exemplar" to copy for each thread */
+    if (router_opts.bidir_search_threshold >= 0) {
+        //The bidirectional search walks the RR graph backwards from each sink
+        g_vpr_ctx.mutable_device().rr_graph_builder.init_fan_in_edges();
+    }
+    if (router_opts.hot_edge_layout) {
+        //Must be built before the router takes its view of the RR graph
+        g_vpr_ctx.mutable_device().rr_graph_builder.init_hot_edges();
+    }
+    if (router_opts.compact_rr_edges) {
+        //Edge source nodes are recomputed from the (final) partitioned edges
+        g_vpr_ctx.mutable_device().rr_graph_builder.compress_edge_src_nodes();
+    }
+
+    /* Each thread's router searches its own copy of the path search state, so that
+     * the concurrent path searches do not overwrite each other's tracebacks */
+    auto rr_node_path_infs = tbb::enumerable_thread_specific<vtr::vector<RRNodeId, t_rr_node_path_inf>>(route_ctx.rr_node_path_inf);
+    auto routers = tbb::enumerable_thread_specific<ConnectionRouter>([&]() {
+        ConnectionRouter router(
+            device_ctx.grid,
+            *router_lookahead,
+            device_ctx.rr_graph.rr_nodes(),
+            &device_ctx.rr_graph,
+            device_ctx.rr_rc_data,
+            device_ctx.rr_graph.rr_switch(),
+            rr_node_path_infs.local(),
+            is_flat);
+        router.set_bidirectional_search_threshold(router_opts.bidir_search_threshold);
+        return router;
+    });
     auto router_stats_thread = tbb::enumerable_thread_specific<RouterStats>();
     auto route_structs = tbb::enumerable_thread_specific<timing_driven_route_structs>(net_list);
 
     RouterStats router_stats;
+    vtr::vector<ParentNetId, size_t> net_effort(net_list.nets().size(), 0);
     float prev_iter_cumm_time = 0;
     vtr::Timer iteration_timer;
     int num_net_bounding_boxes_updated = 0;
@@ -366,6 +491,24 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
 
     int rcv_finished_count = RCV_FINISH_EARLY_COUNTDOWN;
 
+    //Used to decide whether an iteration changed enough of the routing to require timing analysis
+    size_t num_connections = 0;
+    for (auto net_id : net_list.nets()) {
+        if (!net_list.net_is_ignored(net_id)) {
+            num_connections += net_list.net_sinks(net_id).size();
+        }
+    }
+    int consecutive_timing_skips = 0;
+    int num_timing_updates = 0;
+    int num_timing_skips = 0;
+
+    //The net delays of the last timing analysis, to bound the criticality changes since (see --router_sta_skip_epsilon)
+    NetPinsMatrix<float> analyzed_net_delay;
+    if (router_opts.sta_skip_epsilon > 0.) {
+        analyzed_net_delay = net_delay;
+    }
+    int first_legal_iteration = -1;
+
     print_route_status_header();
     for (itry = 1; itry <= router_opts.max_router_iterations; ++itry) {
         for (auto& stats : router_stats_thread) {
@@ -404,17 +547,19 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
             router_stats_thread,
             route_structs,
             net_delay,
-            netlist_pin_lookup,
             route_timing_info,
             pin_timing_invalidator.get(),
             budgeting_inf,
             worst_negative_slack,
             routing_predictor,
             choking_spots,
-            is_flat};
+            is_flat,
+            net_effort};
 
         vtr::Timer net_routing_timer;
-        RouteIterResults iter_results = route_with_partition_tree(tbb_task_group, iter_ctx);
+        RouteIterResults iter_results = router_opts.speculative_parallel
+                                            ? route_speculatively(iter_ctx)
+                                            : route_with_partition_tree(tbb_task_group, iter_ctx);
         PartitionTreeDebug::log("Routing all nets took " + std::to_string(net_routing_timer.elapsed_sec()) + " s");
 
         if (!iter_results.is_routable) {
@@ -453,12 +598,26 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
         wirelength_info = calculate_wirelength_info(net_list, available_wirelength);
         routing_predictor.add_iteration_overuse(itry, overuse_info.overused_nodes);
 
-        if (timing_info) {
+        if (timing_info
+            && (should_skip_timing_update(router_opts, itry, routing_is_feasible, iter_results.stats.connections_routed, num_connections, consecutive_timing_skips)
+                || should_skip_timing_update_for_delay_change(router_opts, itry, routing_is_feasible, net_list, net_delay, analyzed_net_delay, *timing_info))) {
+            //Keep the previous criticalities. The invalidated pins are kept by
+            //pin_timing_invalidator and are updated by the next analysis
+            ++consecutive_timing_skips;
+            ++num_timing_skips;
+        } else if (timing_info) {
+            consecutive_timing_skips = 0;
+            ++num_timing_updates;
+
             //Update timing based on the new routing
             //Note that the net delays have already been updated by parallel_route_net
             timing_info->update();
+            record_timing_metrics("route", itry, *timing_info);
             timing_info->set_warn_unconstrained(false); //Don't warn again about unconstrained nodes again during routing
             pin_timing_invalidator->reset();
+            if (router_opts.sta_skip_epsilon > 0.) {
+                analyzed_net_delay = net_delay;
+            }
 
             //Use the real timing analysis criticalities for subsequent routing iterations
             //  'route_timing_info' is what is actually passed into the net/connection routers,
@@ -506,7 +665,7 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
 
             if (is_better_quality_routing(best_routing, best_routing_metrics, wirelength_info, timing_info)) {
                 //Save routing
-                best_routing = router_ctx.route_trees;
+                copy_route_trees(best_routing, router_ctx.route_trees);
                 best_clb_opins_used_locally = router_ctx.clb_opins_used_locally;
 
                 routing_is_successful = true;
@@ -535,6 +694,9 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
 
             ++legal_convergence_count;
             itry_since_last_convergence = 0;
+            if (first_legal_iteration < 0) {
+                first_legal_iteration = itry;
+            }
 
             VTR_ASSERT(routing_is_successful);
         }
@@ -598,6 +760,10 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
             num_net_bounding_boxes_updated = dynamic_update_bounding_boxes(iter_results.rerouted_nets, net_list, router_opts.high_fanout_threshold);
         }
 
+        if (router_opts.route_bb_prediction) {
+            num_net_bounding_boxes_updated += expand_predicted_bounding_boxes(iter_results.rerouted_nets, net_list, bb_fac);
+        }
+
         if (itry >= high_effort_congestion_mode_iteration_threshold) {
             //We are approaching the maximum number of routing iterations,
             //and still do not have a legal routing. Switch to a mode which
@@ -611,6 +777,11 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
         } else {
             pres_fac *= router_opts.pres_fac_mult;
 
+            if (router_opts.predictor_schedule && !routing_is_feasible && routing_predictor.is_overuse_slope_flat()) {
+                //Congestion is not being resolved at the current rate, make it more expensive faster
+                pres_fac *= router_opts.pres_fac_mult;
+            }
+
             /* Avoid overflow for high iteration counts, even if acc_cost is big */
             pres_fac = update_pres_fac(std::min(pres_fac, static_cast<float>(HUGE_POSITIVE_FLOAT / 1e5)));
 
@@ -666,7 +837,11 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
                 //Scale by BB_SCALE_FACTOR but clip to grid size to avoid overflow
                 bb_fac = std::min<int>(max_grid_dim, bb_fac * BB_SCALE_FACTOR);
 
-                route_ctx.route_bb = load_route_bb(net_list, bb_fac);
+                if (router_opts.route_bb_prediction) {
+                    route_ctx.route_bb = load_predicted_route_bb(net_list, bb_fac);
+                } else {
+                    route_ctx.route_bb = load_route_bb(net_list, bb_fac);
+                }
             }
 
             ++itry_conflicted_mode;
@@ -736,6 +911,12 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
         // profiling::time_on_criticality_analysis();
     }
 
+    print_routing_predictor_summary(routing_predictor, first_legal_iteration);
+    if (num_timing_skips > 0) {
+        VTR_LOG("Skipped %d of the %d timing analyses after routing iterations\n",
+                num_timing_skips, num_timing_skips + num_timing_updates);
+    }
+
     if (routing_is_successful) {
         VTR_LOG("Restoring best routing\n");
 
@@ -743,12 +924,16 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
 
         /* Restore congestion from best route */
         for (auto net_id : net_list.nets()) {
+            /* Unchanged since the best routing was saved */
+            if (route_ctx.route_trees[net_id] && best_routing[net_id]
+                && route_ctx.route_trees[net_id]->version() == best_routing[net_id]->version())
+                continue;
             if (route_ctx.route_trees[net_id])
                 pathfinder_update_cost_from_route_tree(route_ctx.route_trees[net_id]->root(), -1);
             if (best_routing[net_id])
                 pathfinder_update_cost_from_route_tree(best_routing[net_id]->root(), 1);
         }
-        router_ctx.route_trees = best_routing;
+        copy_route_trees(router_ctx.route_trees, best_routing);
         router_ctx.clb_opins_used_locally = best_clb_opins_used_locally;
 
         prune_unused_non_configurable_nets(connections_inf, net_list);
@@ -793,6 +978,8 @@ bool try_parallel_route_tmpl(const Netlist<>& net_list,
     VTR_LOG("total_number_of_adding_all_rt: %zu ", router_stats.add_all_rt);
     VTR_LOG("total_number_of_adding_high_fanout_rt: %zu ", router_stats.add_high_fanout_rt);
     VTR_LOG("total_number_of_adding_all_rt_from_calling_high_fanout_rt: %zu ", router_stats.add_all_rt_from_high_fanout);
+    VTR_LOG("heap_item_high_water: %zu heap_item_pool_size: %zu ", router_stats.heap_item_high_water, router_stats.heap_item_pool_size);
+    VTR_LOG("heap_rescales: %zu heap_expansions: %zu ", router_stats.heap_rescales, router_stats.heap_expansions);
     VTR_LOG("\n");
 
     PartitionTreeDebug::write("partition_tree.log");
@@ -816,7 +1003,6 @@ NetResultFlags try_parallel_route_net(ConnectionRouter& router,
                                       RouterStats& router_stats,
                                       std::vector<float>& pin_criticality,
                                       NetPinsMatrix<float>& net_delay,
-                                      const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
                                       std::shared_ptr<SetupHoldTimingInfo> timing_info,
                                       NetPinTimingInvalidator* pin_timing_invalidator,
                                       route_budgets& budgeting_inf,
@@ -854,7 +1040,6 @@ NetResultFlags try_parallel_route_net(ConnectionRouter& router,
                                         router_stats,
                                         pin_criticality,
                                         net_delay[net_id].data(),
-                                        netlist_pin_lookup,
                                         timing_info,
                                         pin_timing_invalidator,
                                         budgeting_inf,
@@ -878,6 +1063,80 @@ NetResultFlags try_parallel_route_net(ConnectionRouter& router,
     return flags;
 }
 
+/** Largest number of nets routed concurrently in one batch (see make_disjoint_net_batches()) */
+constexpr size_t MAX_NET_BATCH_SIZE = 64;
+
+/** Number of the most recent batches make_disjoint_net_batches() tries to fit a net into */
+constexpr size_t NET_BATCH_SEARCH_WINDOW = 8;
+
+/** Do two route bounding boxes not overlap? This is the separation the partition tree
+ * builds its cutlines on: nets on either side of a cutline can be routed in parallel. */
+static bool route_bbs_disjoint(const t_bb& a, const t_bb& b) {
+    return a.xmax < b.xmin || b.xmax < a.xmin
+           || a.ymax < b.ymin || b.ymax < a.ymin
+           || a.layer_max < b.layer_min || b.layer_max < a.layer_min;
+}
+
+/** Group \p nets into batches of nets with pairwise disjoint route bounding boxes, which can
+ * be routed concurrently. The nets are placed first-fit into the last few batches, so the
+ * batches keep roughly the order of \p nets. */
+static std::vector<std::vector<ParentNetId>> make_disjoint_net_batches(const std::vector<ParentNetId>& nets) {
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    std::vector<std::vector<ParentNetId>> batches;
+    for (ParentNetId net_id : nets) {
+        const t_bb& bb = route_ctx.route_bb[net_id];
+
+        size_t first_batch = batches.size() - std::min(batches.size(), NET_BATCH_SEARCH_WINDOW);
+        auto fits = [&](const std::vector<ParentNetId>& batch) {
+            return batch.size() < MAX_NET_BATCH_SIZE
+                   && std::all_of(batch.begin(), batch.end(), [&](ParentNetId other) {
+                          return route_bbs_disjoint(bb, route_ctx.route_bb[other]);
+                      });
+        };
+        auto it = std::find_if(batches.begin() + first_batch, batches.end(), fits);
+        if (it == batches.end()) {
+            batches.emplace_back();
+            it = batches.end() - 1;
+        }
+        it->push_back(net_id);
+    }
+    return batches;
+}
+
+/** Route a net on the calling thread's router, and record the effort spent on it. Returns its flags */
+template<typename ConnectionRouter>
+static NetResultFlags route_net_on_thread(RouteIterCtx<ConnectionRouter>& ctx, ParentNetId net_id) {
+    /* Keep the messages of a net together, and in net order whatever the scheduling */
+    vtr::ScopedLogBuffer log_buffer(static_cast<size_t>(net_id));
+
+    size_t heap_pushes_before = ctx.router_stats.local().heap_pushes;
+    auto flags = try_parallel_route_net(
+        ctx.routers.local(),
+        ctx.net_list,
+        net_id,
+        ctx.itry,
+        ctx.pres_fac,
+        ctx.router_opts,
+        ctx.connections_inf,
+        ctx.router_stats.local(),
+        ctx.route_structs.local().pin_criticality,
+        ctx.net_delay,
+        ctx.timing_info,
+        ctx.pin_timing_invalidator,
+        ctx.budgeting_inf,
+        ctx.worst_negative_slack,
+        ctx.routing_predictor,
+        ctx.choking_spots[net_id],
+        ctx.is_flat);
+
+    /* Nets which were not rerouted cost next to nothing, but keep them nonzero (0 means "unknown") */
+    size_t heap_pushes = ctx.router_stats.local().heap_pushes - heap_pushes_before;
+    ctx.net_effort[net_id] = flags.was_rerouted ? std::max<size_t>(heap_pushes, 1) : 1;
+
+    return flags;
+}
+
 /* Helper for route_partition_tree(). */
 template<typename ConnectionRouter>
 void route_partition_tree_helper(tbb::task_group& g,
@@ -893,27 +1152,13 @@ void route_partition_tree_helper(tbb::task_group& g,
     node.rerouted_nets.clear();
 
     vtr::Timer t;
-    for (auto net_id : node.nets) {
-        auto flags = try_parallel_route_net(
-            ctx.routers.local(),
-            ctx.net_list,
-            net_id,
-            ctx.itry,
-            ctx.pres_fac,
-            ctx.router_opts,
-            ctx.connections_inf,
-            ctx.router_stats.local(),
-            ctx.route_structs.local().pin_criticality,
-            ctx.net_delay,
-            ctx.netlist_pin_lookup,
-            ctx.timing_info,
-            ctx.pin_timing_invalidator,
-            ctx.budgeting_inf,
-            ctx.worst_negative_slack,
-            ctx.routing_predictor,
-            ctx.choking_spots[net_id],
-            ctx.is_flat);
 
+    auto route_net = [&](ParentNetId net_id) {
+        return route_net_on_thread(ctx, net_id);
+    };
+
+    std::vector<ParentNetId> retried_nets;
+    auto record_net = [&](ParentNetId net_id, const NetResultFlags& flags) {
         if (!flags.success && !flags.retry_with_full_bb) {
             node.is_routable = false;
         }
@@ -921,14 +1166,48 @@ void route_partition_tree_helper(tbb::task_group& g,
             node.rerouted_nets.push_back(net_id);
         }
         /* If we need to retry this net with full-device BB, it will go up to the top
-         * of the tree, so remove it from this node and keep track of it */
+         * of the tree, so remove it from this node (below) and keep track of it */
         if (flags.retry_with_full_bb) {
-            node.nets.erase(std::remove(node.nets.begin(), node.nets.end(), net_id), node.nets.end());
+            retried_nets.push_back(net_id);
             nets_to_retry[net_id] = true;
         }
+    };
+
+    /* The high fanout nets are routed one at a time, then the low fanout nets
+     * (if batching is enabled) in batches of nets with disjoint bounding boxes */
+    int batch_max_fanout = ctx.router_opts.batch_max_fanout;
+    auto first_low_fanout = node.nets.end();
+    if (batch_max_fanout > 0) {
+        first_low_fanout = std::find_if(node.nets.begin(), node.nets.end(), [&](ParentNetId net_id) {
+            return ctx.net_list.net_sinks(net_id).size() <= size_t(batch_max_fanout);
+        });
+    }
+
+    for (auto it = node.nets.begin(); it != first_low_fanout; ++it) {
+        record_net(*it, route_net(*it));
+    }
+
+    std::vector<ParentNetId> low_fanout_nets(first_low_fanout, node.nets.end());
+    for (const auto& batch : make_disjoint_net_batches(low_fanout_nets)) {
+        std::vector<NetResultFlags> batch_flags(batch.size());
+        if (batch.size() == 1) {
+            batch_flags[0] = route_net(batch[0]);
+        } else {
+            tbb::parallel_for(size_t(0), batch.size(), [&](size_t i) {
+                batch_flags[i] = route_net(batch[i]);
+            });
+        }
+        for (size_t i = 0; i < batch.size(); i++) {
+            record_net(batch[i], batch_flags[i]);
+        }
     }
 
-    PartitionTreeDebug::log("Node with " + std::to_string(node.nets.size()) + " nets routed in " + std::to_string(t.elapsed_sec()) + " s");
+    for (ParentNetId net_id : retried_nets) {
+        node.nets.erase(std::remove(node.nets.begin(), node.nets.end(), net_id), node.nets.end());
+    }
+
+    node.route_time_sec = t.elapsed_sec();
+    PartitionTreeDebug::log("Node with " + std::to_string(node.nets.size()) + " nets routed in " + std::to_string(node.route_time_sec) + " s");
 
     /* add left and right trees to task queue */
     if (node.left && node.right) {
@@ -943,6 +1222,92 @@ void route_partition_tree_helper(tbb::task_group& g,
     }
 }
 
+/** Get the routing time summed over the subtree rooted at \p node (the work) and the
+ * routing time along its slowest root to leaf path (the span). With unlimited threads
+ * the partition tree scheduler can't route faster than the span, since a node's nets
+ * are routed only after all of its ancestors' nets. */
+static void partition_tree_work_and_span(const PartitionTreeNode& node, float& work, float& span) {
+    float left_work = 0, left_span = 0, right_work = 0, right_span = 0;
+    if (node.left)
+        partition_tree_work_and_span(*node.left, left_work, left_span);
+    if (node.right)
+        partition_tree_work_and_span(*node.right, right_work, right_span);
+
+    work = node.route_time_sec + left_work + right_work;
+    span = node.route_time_sec + std::max(left_span, right_span);
+}
+
+/** Assign the nodes of the subtree rooted at \p node to \p num_ranks ranks starting at \p first_rank,
+ * as subtrees would be distributed over the ranks (machines) of a distributed router: a subtree given
+ * a single rank is owned by it entirely, while the nets of a node whose subtree spans several ranks
+ * cross between ranks, and are owned by the coordinator (rank -1). */
+static void assign_partition_tree_ranks(const PartitionTreeNode& node, int first_rank, int num_ranks, std::vector<std::pair<const PartitionTreeNode*, int>>& node_ranks) {
+    if (num_ranks == 1 || !node.left) {
+        node_ranks.emplace_back(&node, first_rank);
+        if (node.left) {
+            assign_partition_tree_ranks(*node.left, first_rank, 1, node_ranks);
+            assign_partition_tree_ranks(*node.right, first_rank, 1, node_ranks);
+        }
+        return;
+    }
+
+    node_ranks.emplace_back(&node, -1);
+    int num_left_ranks = num_ranks - num_ranks / 2;
+    assign_partition_tree_ranks(*node.left, first_rank, num_left_ranks, node_ranks);
+    assign_partition_tree_ranks(*node.right, first_rank + num_left_ranks, num_ranks / 2, node_ranks);
+}
+
+/** Report how the last iteration would have been split with the partition tree distributed over \p num_ranks
+ * ranks (see assign_partition_tree_ranks): the routing time and nets of the coordinator and of each rank, and
+ * the boundary RR nodes used by the nets of more than one rank (or the coordinator), whose occupancy deltas
+ * the ranks would have to exchange between iterations. */
+static void report_partition_tree_distribution(const PartitionTreeNode& root, int num_ranks) {
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    std::vector<std::pair<const PartitionTreeNode*, int>> node_ranks;
+    assign_partition_tree_ranks(root, 0, num_ranks, node_ranks);
+
+    constexpr int UNUSED = -2;
+    constexpr int SHARED = -3;
+    std::vector<int> rr_node_owner(device_ctx.rr_graph.num_nodes(), UNUSED);
+    size_t num_boundary_nodes = 0;
+
+    //Index 0 is the coordinator, index rank + 1 a rank
+    std::vector<float> route_time_sec(num_ranks + 1, 0);
+    std::vector<size_t> num_nets(num_ranks + 1, 0);
+    for (const auto& [node, rank] : node_ranks) {
+        route_time_sec[rank + 1] += node->route_time_sec;
+        num_nets[rank + 1] += node->nets.size();
+
+        for (ParentNetId net_id : node->nets) {
+            if (!route_ctx.route_trees[net_id]) {
+                continue;
+            }
+            for (const RouteTreeNode& rt_node : route_ctx.route_trees[net_id]->all_nodes()) {
+                int& owner = rr_node_owner[size_t(rt_node.inode)];
+                if (owner == UNUSED) {
+                    owner = rank;
+                } else if (owner != rank && owner != SHARED) {
+                    owner = SHARED;
+                    ++num_boundary_nodes;
+                }
+            }
+        }
+    }
+
+    float max_rank_time = *std::max_element(route_time_sec.begin() + 1, route_time_sec.end());
+    float total_time = std::accumulate(route_time_sec.begin(), route_time_sec.end(), 0.f);
+    float distributed_time = route_time_sec[0] + max_rank_time;
+    VTR_LOG("# Partition tree over %d ranks: coordinator routes %zu nets in %g s, slowest rank %g s, %.2fx maximum speedup\n",
+            num_ranks, num_nets[0], route_time_sec[0], max_rank_time, distributed_time > 0 ? total_time / distributed_time : 1.f);
+    for (int rank = 0; rank < num_ranks; ++rank) {
+        VTR_LOG("#   rank %d: %zu nets in %g s\n", rank, num_nets[rank + 1], route_time_sec[rank + 1]);
+    }
+    VTR_LOG("#   %zu boundary RR nodes, ~%zu kB of occupancy deltas to exchange per iteration\n",
+            num_boundary_nodes, num_boundary_nodes * (sizeof(RRNodeId) + sizeof(int)) / 1024);
+}
+
 /** Reduce results from partition tree into a single RouteIterResults */
 static void reduce_partition_tree_helper(const PartitionTreeNode& node, RouteIterResults& results) {
     results.is_routable &= node.is_routable;
@@ -976,6 +1341,15 @@ RouteIterResults route_partition_tree(tbb::task_group& g,
 
     route_partition_tree_helper(g, tree.root(), ctx, nets_to_retry);
     g.wait();
+    vtr::flush_log_buffers();
+
+    float work, span;
+    partition_tree_work_and_span(tree.root(), work, span);
+    VTR_LOG("# Partition tree: %g s routing work, %g s critical path (%g s on the %zu root cutline nets), %.2fx maximum speedup\n",
+            work, span, tree.root().route_time_sec, tree.root().nets.size(), span > 0 ? work / span : 1.f);
+    if (ctx.router_opts.partition_tree_report_ranks > 1) {
+        report_partition_tree_distribution(tree.root(), ctx.router_opts.partition_tree_report_ranks);
+    }
 
     /* grow bounding box and add to top level if there is any net to retry */
     for (const auto& kv : nets_to_retry) {
@@ -997,6 +1371,10 @@ RouteIterResults route_partition_tree(tbb::task_group& g,
     for (auto& thread_stats : ctx.router_stats) {
         update_router_stats(out.stats, thread_stats);
     }
+    /* All nets are routed: rewind each thread's heap item pools for the next iteration */
+    for (auto& router : ctx.routers) {
+        router.reset_heap_item_pools(out.stats);
+    }
     return out;
 }
 
@@ -1004,13 +1382,104 @@ RouteIterResults route_partition_tree(tbb::task_group& g,
 template<typename ConnectionRouter>
 static RouteIterResults route_with_partition_tree(tbb::task_group& g, RouteIterCtx<ConnectionRouter>& ctx) {
     vtr::Timer t2;
-    PartitionTree partition_tree(ctx.net_list);
+    PartitionTree partition_tree(ctx.net_list, &ctx.net_effort);
     float total_prep_time = t2.elapsed_sec();
     VTR_LOG("# Built partition tree in %f seconds\n", total_prep_time);
 
     return route_partition_tree(g, partition_tree, ctx);
 }
 
+/** Set the routing time of each node of \p node's subtree to the sum of the routing times of its nets */
+static void set_partition_tree_route_times(PartitionTreeNode& node, const vtr::vector<ParentNetId, float>& net_route_time) {
+    node.route_time_sec = 0;
+    for (ParentNetId net_id : node.nets) {
+        node.route_time_sec += net_route_time[net_id];
+    }
+    if (node.left)
+        set_partition_tree_route_times(*node.left, net_route_time);
+    if (node.right)
+        set_partition_tree_route_times(*node.right, net_route_time);
+}
+
+/** Route all the nets concurrently, whether or not their bounding boxes overlap (--router_speculative_parallel).
+ *
+ * Nets routed at the same time share the congestion state of the RR nodes: the occupancies are
+ * updated atomically, so they are exact once all the nets are routed, but a net may not see the
+ * occupancy of a net routed at the same time, so both may use (and overuse) the same node. Like
+ * any other overuse, the next PathFinder iteration resolves it. The path search state is per thread
+ * (see the routers' rr_node_path_inf in try_parallel_route_tmpl()).
+ *
+ * To report the speedup, the routing times of the nets are also scheduled on the partition tree,
+ * whose critical path bounds the routing time of route_partition_tree() with unlimited threads. */
+template<typename ConnectionRouter>
+static RouteIterResults route_speculatively(RouteIterCtx<ConnectionRouter>& ctx) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    std::vector<ParentNetId> nets(ctx.net_list.nets().begin(), ctx.net_list.nets().end());
+
+    /* Sort so net with most sinks is routed first, and the longest nets do not start last */
+    std::sort(nets.begin(), nets.end(), [&](const ParentNetId id1, const ParentNetId id2) -> bool {
+        return ctx.net_list.net_sinks(id1).size() > ctx.net_list.net_sinks(id2).size();
+    });
+
+    vtr::vector<ParentNetId, NetResultFlags> net_flags(nets.size());
+    vtr::vector<ParentNetId, float> net_route_time(nets.size(), 0.f);
+
+    vtr::Timer t;
+    route_ctx.concurrent_occupancy_updates = true;
+    /* One net per task, since the nets' routing times vary by orders of magnitude */
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, nets.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                vtr::Timer net_timer;
+                net_flags[nets[i]] = route_net_on_thread(ctx, nets[i]);
+                net_route_time[nets[i]] = net_timer.elapsed_sec();
+            }
+        },
+        tbb::simple_partitioner());
+    route_ctx.concurrent_occupancy_updates = false;
+    vtr::flush_log_buffers();
+    float route_time = t.elapsed_sec();
+
+    PartitionTree tree(ctx.net_list, &ctx.net_effort);
+    set_partition_tree_route_times(tree.root(), net_route_time);
+    float work, span;
+    partition_tree_work_and_span(tree.root(), work, span);
+    VTR_LOG("# Speculative routing: %g s (%g s routing work), %.2fx speedup over the %g s critical path of the partition tree\n",
+            route_time, work, route_time > 0 ? span / route_time : 1.f, span);
+
+    RouteIterResults out;
+    for (ParentNetId net_id : nets) {
+        const NetResultFlags& flags = net_flags[net_id];
+        if (!flags.success && !flags.retry_with_full_bb) {
+            out.is_routable = false;
+        }
+        if (flags.was_rerouted) {
+            out.rerouted_nets.push_back(net_id);
+        }
+        /* Retried with a full-device BB in the next iteration, as by route_partition_tree() */
+        if (flags.retry_with_full_bb) {
+            route_ctx.route_bb[net_id] = {
+                0,
+                (int)(device_ctx.grid.width() - 1),
+                0,
+                (int)(device_ctx.grid.height() - 1),
+                0,
+                (int)(device_ctx.grid.get_num_layers() - 1)};
+        }
+    }
+
+    for (auto& thread_stats : ctx.router_stats) {
+        update_router_stats(out.stats, thread_stats);
+    }
+    /* All nets are routed: rewind each thread's heap item pools for the next iteration */
+    for (auto& router : ctx.routers) {
+        router.reset_heap_item_pools(out.stats);
+    }
+    return out;
+}
+
 /* Route serially */
 template<typename ConnectionRouter>
 static RouteIterResults route_without_partition_tree(std::vector<ParentNetId>& nets_to_route, RouteIterCtx<ConnectionRouter>& ctx) {
@@ -1034,7 +1503,6 @@ static RouteIterResults route_without_partition_tree(std::vector<ParentNetId>& n
             ctx.route_structs.local().pin_criticality,
             ctx.route_structs.local().rt_node_of_sink,
             ctx.net_delay,
-            ctx.netlist_pin_lookup,
             ctx.timing_info,
             ctx.pin_timing_invalidator,
             ctx.budgeting_inf,
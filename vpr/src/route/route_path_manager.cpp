@@ -39,20 +39,20 @@ void PathManager::mark_node_visited(RRNodeId node) {
     }
 }
 
-void PathManager::insert_backwards_path_into_traceback(t_heap_path* path_data, float cost, float backward_path_cost, RoutingContext& route_ctx) {
+void PathManager::insert_backwards_path_into_traceback(t_heap_path* path_data, float cost, float backward_path_cost, vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf) {
     if (!is_enabled_) return;
 
     for (unsigned i = 1; i < path_data->edge.size() - 1; i++) {
         RRNodeId node_2 = path_data->path_rr[i];
         RREdgeId edge = path_data->edge[i - 1];
-        route_ctx.rr_node_route_inf[node_2].prev_node = path_data->path_rr[i - 1];
-        route_ctx.rr_node_route_inf[node_2].prev_edge = edge;
-        route_ctx.rr_node_route_inf[node_2].path_cost = cost;
-        route_ctx.rr_node_route_inf[node_2].backward_path_cost = backward_path_cost;
+        rr_node_path_inf[node_2].prev_node = path_data->path_rr[i - 1];
+        rr_node_path_inf[node_2].prev_edge = edge;
+        rr_node_path_inf[node_2].path_cost = cost;
+        rr_node_path_inf[node_2].backward_path_cost = backward_path_cost;
     }
 }
 
-bool PathManager::is_enabled() {
+bool PathManager::is_enabled() const {
     return is_enabled_;
 }
 
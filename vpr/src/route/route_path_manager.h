@@ -1,5 +1,6 @@
 #include "rr_graph_fwd.h"
 #include "vtr_assert.h"
+#include "vtr_vector.h"
 
 #include <set>
 #include <list>
@@ -27,8 +28,8 @@ struct t_heap_path {
     float backward_cong = 0.;
 };
 
-// Forward declaration of RoutingContext needed for traceback insertion
-class RoutingContext;
+// Forward declaration of t_rr_node_path_inf needed for traceback insertion
+struct t_rr_node_path_inf;
 
 /* A class to manage the extra data required for RCV
  * It manages a set containing all the nodes that currently exist in the route tree
@@ -68,13 +69,13 @@ class PathManager {
     void mark_node_visited(RRNodeId node);
 
     // Check if this structure is enabled/is RCV enabled
-    bool is_enabled();
+    bool is_enabled() const;
 
     // Enable/disable path manager class and therefore RCV
     void set_enabled(bool enable);
 
-    // Insert the partial path data into the main route context traceback
-    void insert_backwards_path_into_traceback(t_heap_path* path_data, float cost, float backward_path_cost, RoutingContext& route_ctx);
+    // Insert the partial path data into the traceback (the path search state of the router)
+    void insert_backwards_path_into_traceback(t_heap_path* path_data, float cost, float backward_path_cost, vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf);
 
     // Dynamically create a t_heap_path structure to be used in the heap
     // Will return unless RCV is enabled
@@ -13,6 +13,7 @@
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
+#include "vtr_profile.h"
 
 #include "vpr_utils.h"
 #include "vpr_types.h"
@@ -37,14 +38,19 @@
 #include "route_profiling.h"
 
 #include "concrete_timing_info.h"
+#include "net_pin_criticalities.h"
 #include "timing_util.h"
+#include "timing_metrics.h"
 #include "route_budgets.h"
 #include "binary_heap.h"
 #include "bucket.h"
+#include "four_ary_heap.h"
 #include "connection_router.h"
 
 #include "tatum/TimingReporter.hpp"
 #include "overuse_report.h"
+#include "async_file_writer.h"
+#include "perf_metrics.h"
 
 /*
  * File-scope variables
@@ -117,6 +123,25 @@ static std::tuple<bool, bool> timing_driven_pre_route_to_clock_root(ConnectionRo
                                                                     bool is_flat,
                                                                     bool can_grow_bb);
 
+/** Routes the connection to target_pin of a clock net along its clock route template
+ * from drive_point, which the first clock routing stage has added to the route tree.
+ * Returns false, leaving the route tree unchanged, if the sink is not reachable from
+ * drive_point or the template path uses a node which is already at capacity. */
+template<typename ConnectionRouter>
+static bool timing_driven_route_clock_sink_from_template(ConnectionRouter& router,
+                                                         const ClockRouteTemplates& templates,
+                                                         RRNodeId drive_point,
+                                                         ParentNetId net_id,
+                                                         int target_pin,
+                                                         bool high_fanout,
+                                                         RouteTree& tree,
+                                                         SpatialRouteTreeLookup& spatial_rt_lookup,
+                                                         bool is_flat);
+
+static void order_sinks_by_cluster(std::vector<int>& remaining_targets,
+                                   ParentNetId net_id,
+                                   const SpatialRouteTreeLookup& spatial_rt_lookup);
+
 static void setup_routing_resources(int itry,
                                     ParentNetId net_id,
                                     const Netlist<>& net_list,
@@ -124,7 +149,8 @@ static void setup_routing_resources(int itry,
                                     int min_incremental_reroute_fanout,
                                     CBRR& connections_inf,
                                     const t_router_opts& router_opts,
-                                    bool ripup_high_fanout_nets);
+                                    bool ripup_high_fanout_nets,
+                                    vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf);
 
 static void update_net_delays_from_route_tree(float* net_delay,
                                               const Netlist<>& net_list,
@@ -135,12 +161,10 @@ static void update_net_delays_from_route_tree(float* net_delay,
 static bool check_hold(const t_router_opts& router_opts, float worst_neg_slack);
 
 static float get_net_pin_criticality(const std::shared_ptr<SetupHoldTimingInfo> timing_info,
-                                     const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
                                      float max_criticality,
                                      float criticality_exp,
                                      ParentNetId net_id,
-                                     ParentPinId pin_id,
-                                     bool is_flat);
+                                     int ipin);
 
 struct more_sinks_than {
     const Netlist<>& net_list_;
@@ -151,6 +175,10 @@ struct more_sinks_than {
     }
 };
 
+static void sort_nets_by_fanout_and_locality(std::vector<ParentNetId>& sorted_nets,
+                                             const Netlist<>& net_list,
+                                             const vtr::vector<ParentNetId, t_bb>& route_bb);
+
 static bool is_high_fanout(int fanout, int fanout_threshold);
 
 // The reason that try_timing_driven_route_tmpl (and descendents) are being
@@ -172,6 +200,21 @@ static bool try_timing_driven_route_tmpl(const Netlist<>& netlist,
                                          ScreenUpdatePriority first_iteration_priority,
                                          bool is_flat);
 
+// Routes with the ConnectionRouter on HeapImplementation, specialized for the
+// common case if use_common_case_connection_router() allows it.
+template<typename HeapImplementation>
+static bool try_timing_driven_route_heap(const Netlist<>& net_list,
+                                         const t_det_routing_arch& det_routing_arch,
+                                         const t_router_opts& router_opts,
+                                         const t_analysis_opts& analysis_opts,
+                                         const std::vector<t_segment_inf>& segment_inf,
+                                         NetPinsMatrix<float>& net_delay,
+                                         const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                                         std::shared_ptr<SetupHoldTimingInfo> timing_info,
+                                         std::shared_ptr<RoutingDelayCalculator> delay_calc,
+                                         ScreenUpdatePriority first_iteration_priority,
+                                         bool is_flat);
+
 /************************ Subroutine definitions *****************************/
 bool try_timing_driven_route(const Netlist<>& net_list,
                              const t_det_routing_arch& det_routing_arch,
@@ -186,7 +229,73 @@ bool try_timing_driven_route(const Netlist<>& net_list,
                              bool is_flat) {
     switch (router_opts.router_heap) {
         case e_heap_type::BINARY_HEAP:
-            return try_timing_driven_route_tmpl<ConnectionRouter<BinaryHeap>>(net_list,
+            return try_timing_driven_route_heap<BinaryHeap>(net_list,
+                                                            det_routing_arch,
+                                                            router_opts,
+                                                            analysis_opts,
+                                                            segment_inf,
+                                                            net_delay,
+                                                            netlist_pin_lookup,
+                                                            timing_info,
+                                                            delay_calc,
+                                                            first_iteration_priority,
+                                                            is_flat);
+            break;
+        case e_heap_type::BUCKET_HEAP_APPROXIMATION:
+            return try_timing_driven_route_heap<Bucket>(net_list,
+                                                        det_routing_arch,
+                                                        router_opts,
+                                                        analysis_opts,
+                                                        segment_inf,
+                                                        net_delay,
+                                                        netlist_pin_lookup,
+                                                        timing_info,
+                                                        delay_calc,
+                                                        first_iteration_priority,
+                                                        is_flat);
+        case e_heap_type::FOUR_ARY_HEAP:
+            return try_timing_driven_route_heap<FourAryHeap>(net_list,
+                                                             det_routing_arch,
+                                                             router_opts,
+                                                             analysis_opts,
+                                                             segment_inf,
+                                                             net_delay,
+                                                             netlist_pin_lookup,
+                                                             timing_info,
+                                                             delay_calc,
+                                                             first_iteration_priority,
+                                                             is_flat);
+        default:
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Unknown heap type %d", router_opts.router_heap);
+    }
+}
+
+template<typename HeapImplementation>
+bool try_timing_driven_route_heap(const Netlist<>& net_list,
+                                  const t_det_routing_arch& det_routing_arch,
+                                  const t_router_opts& router_opts,
+                                  const t_analysis_opts& analysis_opts,
+                                  const std::vector<t_segment_inf>& segment_inf,
+                                  NetPinsMatrix<float>& net_delay,
+                                  const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                                  std::shared_ptr<SetupHoldTimingInfo> timing_info,
+                                  std::shared_ptr<RoutingDelayCalculator> delay_calc,
+                                  ScreenUpdatePriority first_iteration_priority,
+                                  bool is_flat) {
+    if (use_common_case_connection_router(router_opts, g_vpr_ctx.device().grid, is_flat)) {
+        return try_timing_driven_route_tmpl<CommonCaseConnectionRouter<HeapImplementation>>(net_list,
+                                                                                            det_routing_arch,
+                                                                                            router_opts,
+                                                                                            analysis_opts,
+                                                                                            segment_inf,
+                                                                                            net_delay,
+                                                                                            netlist_pin_lookup,
+                                                                                            timing_info,
+                                                                                            delay_calc,
+                                                                                            first_iteration_priority,
+                                                                                            is_flat);
+    }
+    return try_timing_driven_route_tmpl<ConnectionRouter<HeapImplementation>>(net_list,
                                                                               det_routing_arch,
                                                                               router_opts,
                                                                               analysis_opts,
@@ -197,22 +306,6 @@ bool try_timing_driven_route(const Netlist<>& net_list,
                                                                               delay_calc,
                                                                               first_iteration_priority,
                                                                               is_flat);
-            break;
-        case e_heap_type::BUCKET_HEAP_APPROXIMATION:
-            return try_timing_driven_route_tmpl<ConnectionRouter<Bucket>>(net_list,
-                                                                          det_routing_arch,
-                                                                          router_opts,
-                                                                          analysis_opts,
-                                                                          segment_inf,
-                                                                          net_delay,
-                                                                          netlist_pin_lookup,
-                                                                          timing_info,
-                                                                          delay_calc,
-                                                                          first_iteration_priority,
-                                                                          is_flat);
-        default:
-            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Unknown heap type %d", router_opts.router_heap);
-    }
 }
 
 template<typename ConnectionRouter>
@@ -238,6 +331,9 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
     const auto& atom_ctx = g_vpr_ctx.atom();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
+    //Recalculate the criticalities of the connections to route only when they change
+    ScopedNetPinCriticalityTracking net_pin_criticality_tracking(timing_info.get(), net_list, netlist_pin_lookup, is_flat);
+
     auto choking_spots = set_nets_choking_spots(net_list,
                                                 route_ctx.net_terminal_groups,
                                                 route_ctx.net_terminal_group_num,
@@ -253,20 +349,19 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
 
     //sort so net with most sinks is routed first.
     auto sorted_nets = std::vector<ParentNetId>(net_list.nets().begin(), net_list.nets().end());
-    std::sort(sorted_nets.begin(), sorted_nets.end(), more_sinks_than(net_list));
+    if (router_opts.net_locality_order) {
+        //The routing time of each iteration is reported in the iteration table, to compare both orders
+        VTR_LOG("Routing the nets of similar fanout in the order of their bounding box locations\n");
+        sort_nets_by_fanout_and_locality(sorted_nets, net_list, route_ctx.route_bb);
+    } else {
+        std::sort(sorted_nets.begin(), sorted_nets.end(), more_sinks_than(net_list));
+    }
 
     /*
      * Configure the routing predictor
      */
-    RoutingPredictor routing_predictor;
-    float abort_iteration_threshold = std::numeric_limits<float>::infinity(); //Default no early abort
-    if (router_opts.routing_failure_predictor == SAFE) {
-        abort_iteration_threshold = ROUTING_PREDICTOR_ITERATION_ABORT_FACTOR_SAFE * router_opts.max_router_iterations;
-    } else if (router_opts.routing_failure_predictor == AGGRESSIVE) {
-        abort_iteration_threshold = ROUTING_PREDICTOR_ITERATION_ABORT_FACTOR_AGGRESSIVE * router_opts.max_router_iterations;
-    } else {
-        VTR_ASSERT_MSG(router_opts.routing_failure_predictor == OFF, "Unrecognized routing failure predictor setting");
-    }
+    RoutingPredictor routing_predictor = make_routing_predictor(router_opts);
+    float abort_iteration_threshold = routing_predictor_abort_threshold(router_opts);
 
     float high_effort_congestion_mode_iteration_threshold = router_opts.congested_routing_iteration_threshold_frac * router_opts.max_router_iterations;
 
@@ -283,11 +378,19 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
 
     CBRR connections_inf{net_list, route_ctx.net_rr_terminals, is_flat};
 
+    //Paths through the clock network used by the second stage of two stage clock routing
+    if (router_opts.two_stage_clock_routing && router_opts.clock_route_templates) {
+        route_ctx.clock_route_templates.build(device_ctx.rr_graph, RRNodeId(device_ctx.virtual_clock_network_root_idx));
+    } else {
+        route_ctx.clock_route_templates.clear();
+    }
+
     route_budgets budgeting_inf(net_list, is_flat);
 
     // This needs to be called before filling intra-cluster lookahead maps to ensure that the intra-cluster lookahead maps are initialized.
     const RouterLookahead* router_lookahead = get_cached_router_lookahead(det_routing_arch,
                                                                           router_opts.lookahead_type,
+                                                                          router_opts.base_cost_type,
                                                                           router_opts.write_router_lookahead,
                                                                           router_opts.read_router_lookahead,
                                                                           segment_inf,
@@ -308,6 +411,7 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
         route_ctx.cached_router_lookahead_.set(cache_key, std::move(mut_router_lookahead));
         router_lookahead = get_cached_router_lookahead(det_routing_arch,
                                                        router_opts.lookahead_type,
+                                                       router_opts.base_cost_type,
                                                        router_opts.write_router_lookahead,
                                                        router_opts.read_router_lookahead,
                                                        segment_inf,
@@ -330,6 +434,10 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
     constexpr float BB_SCALE_FACTOR = 2;
     constexpr int BB_SCALE_ITER_COUNT = 5;
 
+    if (router_opts.route_bb_prediction) {
+        route_ctx.route_bb = load_predicted_route_bb(net_list, bb_fac);
+    }
+
     size_t available_wirelength = calculate_wirelength_available();
 
     /*
@@ -350,6 +458,19 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
     RoutingMetrics best_routing_metrics;
     int legal_convergence_count = 0;
 
+    if (router_opts.bidir_search_threshold >= 0) {
+        //The bidirectional search walks the RR graph backwards from each sink
+        g_vpr_ctx.mutable_device().rr_graph_builder.init_fan_in_edges();
+    }
+    if (router_opts.hot_edge_layout) {
+        //Must be built before the router takes its view of the RR graph
+        g_vpr_ctx.mutable_device().rr_graph_builder.init_hot_edges();
+    }
+    if (router_opts.compact_rr_edges) {
+        //Edge source nodes are recomputed from the (final) partitioned edges
+        g_vpr_ctx.mutable_device().rr_graph_builder.compress_edge_src_nodes();
+    }
+
     ConnectionRouter router(
         device_ctx.grid,
         *router_lookahead,
@@ -357,8 +478,9 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
         &device_ctx.rr_graph,
         device_ctx.rr_rc_data,
         device_ctx.rr_graph.rr_switch(),
-        route_ctx.rr_node_route_inf,
+        route_ctx.rr_node_path_inf,
         is_flat);
+    router.set_bidirectional_search_threshold(router_opts.bidir_search_threshold);
 
     /*
      * On the first routing iteration ignore congestion to get reasonable net
@@ -408,7 +530,22 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
             atom_ctx.nlist,
             atom_ctx.lookup,
             *timing_info->timing_graph(),
-            is_flat);
+            is_flat,
+            delay_calc.get());
+    }
+
+    //The nets routed before the first iteration (an ECO routing, see --eco_route) are only rerouted
+    //if congested, so their delays are taken from their route trees rather than estimated
+    size_t num_prerouted_nets = 0;
+    for (auto net_id : net_list.nets()) {
+        if (route_ctx.route_trees[net_id]) {
+            update_net_delays_from_route_tree(net_delay[net_id].data(), net_list, net_id, timing_info.get(), pin_timing_invalidator.get());
+            ++num_prerouted_nets;
+        }
+    }
+    if (timing_info && num_prerouted_nets > 0) {
+        timing_info->update();
+        pin_timing_invalidator->reset();
     }
 
     RouterStats router_stats;
@@ -431,8 +568,27 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
 
     int rcv_finished_count = RCV_FINISH_EARLY_COUNTDOWN;
 
+    //Used to decide whether an iteration changed enough of the routing to require timing analysis
+    size_t num_connections = 0;
+    for (auto net_id : net_list.nets()) {
+        if (!net_list.net_is_ignored(net_id)) {
+            num_connections += net_list.net_sinks(net_id).size();
+        }
+    }
+    int consecutive_timing_skips = 0;
+    int num_timing_updates = 0;
+    int num_timing_skips = 0;
+
+    //The net delays of the last timing analysis, to bound the criticality changes since (see --router_sta_skip_epsilon)
+    NetPinsMatrix<float> analyzed_net_delay;
+    if (router_opts.sta_skip_epsilon > 0.) {
+        analyzed_net_delay = net_delay;
+    }
+    int first_legal_iteration = -1;
+
     print_route_status_header();
     for (itry = 1; itry <= router_opts.max_router_iterations; ++itry) {
+        vtr::ProfileZone iteration_zone("route_iteration", itry);
         RouterStats router_iteration_stats;
         init_router_stats(router_iteration_stats);
         std::vector<ParentNetId> rerouted_nets;
@@ -467,7 +623,6 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
                                                                router_iteration_stats,
                                                                route_structs.pin_criticality,
                                                                net_delay,
-                                                               netlist_pin_lookup,
                                                                route_timing_info,
                                                                pin_timing_invalidator.get(),
                                                                budgeting_inf,
@@ -488,6 +643,8 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
             }
         }
 
+        router.reset_heap_item_pools(router_iteration_stats);
+
         // Make sure any CLB OPINs used up by subblocks being hooked directly to them are reserved for that purpose
         bool rip_up_local_opins = (itry == 1 ? false : true);
         if (!is_flat) {
@@ -511,12 +668,26 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
         wirelength_info = calculate_wirelength_info(net_list, available_wirelength);
         routing_predictor.add_iteration_overuse(itry, overuse_info.overused_nodes);
 
-        if (timing_info) {
+        if (timing_info
+            && (should_skip_timing_update(router_opts, itry, routing_is_feasible, router_iteration_stats.connections_routed, num_connections, consecutive_timing_skips)
+                || should_skip_timing_update_for_delay_change(router_opts, itry, routing_is_feasible, net_list, net_delay, analyzed_net_delay, *timing_info))) {
+            //Keep the previous criticalities. The invalidated pins are kept by
+            //pin_timing_invalidator and are updated by the next analysis
+            ++consecutive_timing_skips;
+            ++num_timing_skips;
+        } else if (timing_info) {
+            consecutive_timing_skips = 0;
+            ++num_timing_updates;
+
             //Update timing based on the new routing
             //Note that the net delays have already been updated by timing_driven_route_net
             timing_info->update();
+            record_timing_metrics("route", itry, *timing_info);
             timing_info->set_warn_unconstrained(false); //Don't warn again about unconstrained nodes again during routing
             pin_timing_invalidator->reset();
+            if (router_opts.sta_skip_epsilon > 0.) {
+                analyzed_net_delay = net_delay;
+            }
 
             //Use the real timing analysis criticalities for subsequent routing iterations
             //  'route_timing_info' is what is actually passed into the net/connection routers,
@@ -537,6 +708,8 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
 
         //Output progress
         print_route_status(itry, iter_elapsed_time, pres_fac, num_net_bounding_boxes_updated, router_iteration_stats, overuse_info, wirelength_info, timing_info, est_success_iteration);
+        vtr::profile_counter("route_overused_nodes", overuse_info.overused_nodes);
+        vtr::profile_counter("route_pres_fac", pres_fac);
 
         prev_iter_cumm_time = iter_cumm_time;
 
@@ -563,7 +736,7 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
 
             if (is_better_quality_routing(best_routing, best_routing_metrics, wirelength_info, timing_info)) {
                 //Save routing
-                best_routing = router_ctx.route_trees;
+                copy_route_trees(best_routing, router_ctx.route_trees);
                 best_clb_opins_used_locally = router_ctx.clb_opins_used_locally;
 
                 routing_is_successful = true;
@@ -592,6 +765,9 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
 
             ++legal_convergence_count;
             itry_since_last_convergence = 0;
+            if (first_legal_iteration < 0) {
+                first_legal_iteration = itry;
+            }
 
             VTR_ASSERT(routing_is_successful);
         }
@@ -655,6 +831,10 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
             num_net_bounding_boxes_updated = dynamic_update_bounding_boxes(rerouted_nets, net_list, router_opts.high_fanout_threshold);
         }
 
+        if (router_opts.route_bb_prediction) {
+            num_net_bounding_boxes_updated += expand_predicted_bounding_boxes(rerouted_nets, net_list, bb_fac);
+        }
+
         if (itry >= high_effort_congestion_mode_iteration_threshold) {
             //We are approaching the maximum number of routing iterations,
             //and still do not have a legal routing. Switch to a mode which
@@ -668,6 +848,11 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
         } else {
             pres_fac *= router_opts.pres_fac_mult;
 
+            if (router_opts.predictor_schedule && !routing_is_feasible && routing_predictor.is_overuse_slope_flat()) {
+                //Congestion is not being resolved at the current rate, make it more expensive faster
+                pres_fac *= router_opts.pres_fac_mult;
+            }
+
             /* Avoid overflow for high iteration counts, even if acc_cost is big */
             pres_fac = update_pres_fac(std::min(pres_fac, static_cast<float>(HUGE_POSITIVE_FLOAT / 1e5)));
 
@@ -723,7 +908,11 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
                 //Scale by BB_SCALE_FACTOR but clip to grid size to avoid overflow
                 bb_fac = std::min<int>(max_grid_dim, bb_fac * BB_SCALE_FACTOR);
 
-                route_ctx.route_bb = load_route_bb(net_list, bb_fac);
+                if (router_opts.route_bb_prediction) {
+                    route_ctx.route_bb = load_predicted_route_bb(net_list, bb_fac);
+                } else {
+                    route_ctx.route_bb = load_route_bb(net_list, bb_fac);
+                }
             }
 
             ++itry_conflicted_mode;
@@ -790,6 +979,12 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
         // profiling::time_on_criticality_analysis();
     }
 
+    print_routing_predictor_summary(routing_predictor, first_legal_iteration);
+    if (num_timing_skips > 0) {
+        VTR_LOG("Skipped %d of the %d timing analyses after routing iterations\n",
+                num_timing_skips, num_timing_skips + num_timing_updates);
+    }
+
     if (routing_is_successful) {
         VTR_LOG("Restoring best routing\n");
 
@@ -797,12 +992,16 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
 
         /* Restore congestion from best route */
         for (auto net_id : net_list.nets()) {
+            /* Unchanged since the best routing was saved */
+            if (route_ctx.route_trees[net_id] && best_routing[net_id]
+                && route_ctx.route_trees[net_id]->version() == best_routing[net_id]->version())
+                continue;
             if (route_ctx.route_trees[net_id])
                 pathfinder_update_cost_from_route_tree(route_ctx.route_trees[net_id]->root(), -1);
             if (best_routing[net_id])
                 pathfinder_update_cost_from_route_tree(best_routing[net_id]->root(), 1);
         }
-        router_ctx.route_trees = best_routing;
+        copy_route_trees(router_ctx.route_trees, best_routing);
         router_ctx.clb_opins_used_locally = best_clb_opins_used_locally;
 
         prune_unused_non_configurable_nets(connections_inf, net_list);
@@ -836,6 +1035,14 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
         router_stats.nets_routed, router_stats.connections_routed, router_stats.heap_pushes, router_stats.heap_pops,
         router_stats.intra_cluster_node_pushes, router_stats.intra_cluster_node_pops,
         router_stats.inter_cluster_node_pushes, router_stats.inter_cluster_node_pops);
+
+    //Accumulated over all routing attempts (e.g. of a minimum channel width search)
+    PerfMetrics& metrics = perf_metrics();
+    metrics.add("route.heap_pushes", router_stats.heap_pushes, e_perf_metric_type::WORK);
+    metrics.add("route.connections_routed", router_stats.connections_routed, e_perf_metric_type::WORK);
+    metrics.set("route.heap_pushes_per_connection",
+                metrics.value("route.heap_pushes") / std::max(metrics.value("route.connections_routed"), 1.),
+                e_perf_metric_type::WORK);
     for (int node_type_idx = 0; node_type_idx < t_rr_type::NUM_RR_TYPES; node_type_idx++) {
         VTR_LOG("total_external_%s_pushes: %zu ", rr_node_typename[node_type_idx], router_stats.inter_cluster_node_type_cnt_pushes[node_type_idx]);
         VTR_LOG("total_external_%s_pops: %zu ", rr_node_typename[node_type_idx], router_stats.inter_cluster_node_type_cnt_pops[node_type_idx]);
@@ -849,6 +1056,8 @@ bool try_timing_driven_route_tmpl(const Netlist<>& net_list,
     VTR_LOG("total_number_of_adding_all_rt: %zu ", router_stats.add_all_rt);
     VTR_LOG("total_number_of_adding_high_fanout_rt: %zu ", router_stats.add_high_fanout_rt);
     VTR_LOG("total_number_of_adding_all_rt_from_calling_high_fanout_rt: %zu ", router_stats.add_all_rt_from_high_fanout);
+    VTR_LOG("heap_item_high_water: %zu heap_item_pool_size: %zu ", router_stats.heap_item_high_water, router_stats.heap_item_pool_size);
+    VTR_LOG("heap_rescales: %zu heap_expansions: %zu ", router_stats.heap_rescales, router_stats.heap_expansions);
     VTR_LOG("\n");
 
     return routing_is_successful;
@@ -865,7 +1074,6 @@ NetResultFlags try_timing_driven_route_net(ConnectionRouter& router,
                                            RouterStats& router_stats,
                                            std::vector<float>& pin_criticality,
                                            NetPinsMatrix<float>& net_delay,
-                                           const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
                                            std::shared_ptr<SetupHoldTimingInfo> timing_info,
                                            NetPinTimingInvalidator* pin_timing_invalidator,
                                            route_budgets& budgeting_inf,
@@ -890,6 +1098,8 @@ NetResultFlags try_timing_driven_route_net(ConnectionRouter& router,
     } else if (!(reroute_for_hold) && !should_route_net(net_id, connections_inf, true)) {
         flags.success = true;
     } else {
+        vtr::ProfileZone net_zone("route_net", size_t(net_id));
+
         // track time spent vs fanout
         profiling::net_fanout_start();
 
@@ -903,7 +1113,6 @@ NetResultFlags try_timing_driven_route_net(ConnectionRouter& router,
                                         router_stats,
                                         pin_criticality,
                                         net_delay[net_id].data(),
-                                        netlist_pin_lookup,
                                         timing_info,
                                         pin_timing_invalidator,
                                         budgeting_inf,
@@ -948,7 +1157,6 @@ NetResultFlags timing_driven_route_net(ConnectionRouter& router,
                                        RouterStats& router_stats,
                                        std::vector<float>& pin_criticality,
                                        float* net_delay,
-                                       const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
                                        std::shared_ptr<SetupHoldTimingInfo> timing_info,
                                        NetPinTimingInvalidator* pin_timing_invalidator,
                                        route_budgets& budgeting_inf,
@@ -974,7 +1182,8 @@ NetResultFlags timing_driven_route_net(ConnectionRouter& router,
         router_opts.min_incremental_reroute_fanout,
         connections_inf,
         router_opts,
-        check_hold(router_opts, worst_neg_slack));
+        check_hold(router_opts, worst_neg_slack),
+        router.mutable_rr_node_path_inf());
 
     VTR_ASSERT(route_ctx.route_trees[net_id]);
     RouteTree& tree = route_ctx.route_trees[net_id].value();
@@ -996,14 +1205,11 @@ NetResultFlags timing_driven_route_net(ConnectionRouter& router,
     // calculate criticality of remaining target pins
     for (int ipin : remaining_targets) {
         if (timing_info) {
-            auto pin = net_list.net_pin(net_id, ipin);
             pin_criticality[ipin] = get_net_pin_criticality(timing_info,
-                                                            netlist_pin_lookup,
                                                             router_opts.max_criticality,
                                                             router_opts.criticality_exp,
                                                             net_id,
-                                                            pin,
-                                                            is_flat);
+                                                            ipin);
 
         } else {
             //No timing info, implies we want a min delay routing, so use criticality of 1.
@@ -1016,6 +1222,10 @@ NetResultFlags timing_driven_route_net(ConnectionRouter& router,
         return pin_criticality[a] > pin_criticality[b];
     });
 
+    if (high_fanout && router_opts.high_fanout_sink_clustering) {
+        order_sinks_by_cluster(remaining_targets, net_id, spatial_route_tree_lookup);
+    }
+
     /* Update base costs according to fanout and criticality rules */
     update_rr_base_costs(num_sinks);
 
@@ -1027,6 +1237,7 @@ NetResultFlags timing_driven_route_net(ConnectionRouter& router,
     cost_params.delay_budget = ((budgeting_inf.if_set()) ? &conn_delay_budget : nullptr);
 
     // Pre-route to clock source for clock nets (marked as global nets)
+    RRNodeId clock_drive_point = RRNodeId::INVALID();
     if (net_list.net_is_global(net_id) && router_opts.two_stage_clock_routing) {
         //VTR_ASSERT(router_opts.clock_modeling == DEDICATED_NETWORK);
         RRNodeId sink_node(device_ctx.virtual_clock_network_root_idx);
@@ -1056,7 +1267,18 @@ NetResultFlags timing_driven_route_net(ConnectionRouter& router,
                                                                                                   is_flat,
                                                                                                   can_grow_bb);
 
-        return flags;
+        if (!flags.success)
+            return flags;
+
+        // The second stage starts from the clock network drive point the first stage reached
+        if (!route_ctx.clock_route_templates.empty()) {
+            for (const RouteTreeNode& rt_node : tree.all_nodes()) {
+                if (route_ctx.clock_route_templates.is_drive_point(rt_node.inode)) {
+                    clock_drive_point = rt_node.inode;
+                    break;
+                }
+            }
+        }
     }
 
     if (budgeting_inf.if_set()) {
@@ -1069,6 +1291,20 @@ NetResultFlags timing_driven_route_net(ConnectionRouter& router,
 
         RRNodeId sink_rr = route_ctx.net_rr_terminals[net_id][target_pin];
 
+        if (clock_drive_point
+            && timing_driven_route_clock_sink_from_template(router,
+                                                            route_ctx.clock_route_templates,
+                                                            clock_drive_point,
+                                                            net_id,
+                                                            target_pin,
+                                                            high_fanout,
+                                                            tree,
+                                                            spatial_route_tree_lookup,
+                                                            is_flat)) {
+            ++router_stats.connections_routed;
+            continue;
+        }
+
         enable_router_debug(router_opts, net_id, sink_rr, itry, &router);
 
         cost_params.criticality = pin_criticality[target_pin];
@@ -1202,7 +1438,7 @@ static std::tuple<bool, bool> timing_driven_pre_route_to_clock_root(ConnectionRo
      * points. Therefore, we can set the net pin index of the sink node to      *
      * OPEN (meaning illegal) as it is not meaningful for this sink.            */
     vtr::optional<const RouteTreeNode&> new_branch, new_sink;
-    std::tie(new_branch, new_sink) = tree.update_from_heap(&cheapest, OPEN, ((high_fanout) ? &spatial_rt_lookup : nullptr), is_flat);
+    std::tie(new_branch, new_sink) = tree.update_from_heap(&cheapest, OPEN, ((high_fanout) ? &spatial_rt_lookup : nullptr), is_flat, &router.rr_node_path_inf());
 
     VTR_ASSERT_DEBUG(!high_fanout || validate_route_tree_spatial_lookup(tree.root(), spatial_rt_lookup));
 
@@ -1228,6 +1464,65 @@ static std::tuple<bool, bool> timing_driven_pre_route_to_clock_root(ConnectionRo
     return std::make_tuple(true, false);
 }
 
+template<typename ConnectionRouter>
+static bool timing_driven_route_clock_sink_from_template(ConnectionRouter& router,
+                                                         const ClockRouteTemplates& templates,
+                                                         RRNodeId drive_point,
+                                                         ParentNetId net_id,
+                                                         int target_pin,
+                                                         bool high_fanout,
+                                                         RouteTree& tree,
+                                                         SpatialRouteTreeLookup& spatial_rt_lookup,
+                                                         bool is_flat) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    RRNodeId sink_node = route_ctx.net_rr_terminals[net_id][target_pin];
+
+    /* Check the template path up to the existing routing before recording it in
+     * the router's rr_node_path_inf, where RouteTree::update_from_heap() picks it up */
+    std::vector<const ClockRouteTemplates::t_template_edge*> path;
+    RRNodeId node = sink_node;
+    while (!tree.find_by_rr_id(node)) {
+        const ClockRouteTemplates::t_template_edge* template_edge = templates.template_edge(drive_point, node);
+        if (!template_edge || route_ctx.rr_node_route_inf[node].occ() >= rr_graph.node_capacity(node)) {
+            return false;
+        }
+        path.push_back(template_edge);
+        node = template_edge->prev_node;
+    }
+    if (path.empty()) {
+        return false;
+    }
+
+    auto& rr_node_path_inf = router.mutable_rr_node_path_inf();
+    node = sink_node;
+    for (const ClockRouteTemplates::t_template_edge* template_edge : path) {
+        rr_node_path_inf[node].prev_node = template_edge->prev_node;
+        rr_node_path_inf[node].prev_edge = template_edge->prev_edge;
+        node = template_edge->prev_node;
+    }
+
+    t_heap sink_heap;
+    sink_heap.index = sink_node;
+    sink_heap.set_prev_node(path.front()->prev_node);
+    sink_heap.set_prev_edge(path.front()->prev_edge);
+
+    vtr::optional<const RouteTreeNode&> new_branch, new_sink;
+    std::tie(new_branch, new_sink) = tree.update_from_heap(&sink_heap, target_pin, ((high_fanout) ? &spatial_rt_lookup : nullptr), is_flat, &router.rr_node_path_inf());
+
+    if (new_branch)
+        pathfinder_update_cost_from_route_tree(new_branch.value(), 1);
+
+    // The template path is not stamped with the current path search epoch;
+    // start a new one so the next search can not pick it up.
+    router.reset_path_costs();
+
+    VTR_LOGV_DEBUG(f_router_debug, "Net %zu Target %d routed along clock route template\n", size_t(net_id), target_pin);
+
+    return true;
+}
+
 template<typename ConnectionRouter>
 static NetResultFlags timing_driven_route_sink(ConnectionRouter& router,
                                                const Netlist<>& net_list,
@@ -1312,10 +1607,10 @@ static NetResultFlags timing_driven_route_sink(ConnectionRouter& router,
     profiling::sink_criticality_end(cost_params.criticality);
 
     RRNodeId inode(cheapest.index);
-    route_ctx.rr_node_route_inf[inode].target_flag--; /* Connected to this SINK. */
+    router.mutable_rr_node_path_inf()[inode].target_flag--; /* Connected to this SINK. */
 
     vtr::optional<const RouteTreeNode&> new_branch, new_sink;
-    std::tie(new_branch, new_sink) = tree.update_from_heap(&cheapest, target_pin, ((high_fanout) ? &spatial_rt_lookup : nullptr), is_flat);
+    std::tie(new_branch, new_sink) = tree.update_from_heap(&cheapest, target_pin, ((high_fanout) ? &spatial_rt_lookup : nullptr), is_flat, &router.rr_node_path_inf());
 
     VTR_ASSERT_DEBUG(!high_fanout || validate_route_tree_spatial_lookup(tree.root(), spatial_rt_lookup));
 
@@ -1350,7 +1645,8 @@ static void setup_routing_resources(int itry,
                                     int min_incremental_reroute_fanout,
                                     CBRR& connections_inf,
                                     const t_router_opts& router_opts,
-                                    bool ripup_high_fanout_nets) {
+                                    bool ripup_high_fanout_nets,
+                                    vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf) {
     /* Build and return a partial route tree from the legal connections from last iteration.
      * along the way do:
      * 	update pathfinder costs to be accurate to the partial route tree
@@ -1361,8 +1657,13 @@ static void setup_routing_resources(int itry,
     vtr::optional<RouteTree>& tree = route_ctx.route_trees[net_id];
 
     // for nets below a certain size (min_incremental_reroute_fanout), rip up any old routing
-    // otherwise, we incrementally reroute by reusing legal parts of the previous iteration
-    if ((int)num_sinks < min_incremental_reroute_fanout || itry == 1 || ripup_high_fanout_nets) {
+    // otherwise, we incrementally reroute by reusing legal parts of the previous iteration.
+    // In late iterations (incremental_reroute_all_nets_iter) all nets are rerouted incrementally,
+    // so only the connections through overused nodes are ripped up
+    bool incremental_reroute_all_nets = router_opts.incremental_reroute_all_nets_iter >= 0
+                                        && itry >= router_opts.incremental_reroute_all_nets_iter;
+    bool small_net = (int)num_sinks < min_incremental_reroute_fanout && !incremental_reroute_all_nets;
+    if (small_net || itry == 1 || ripup_high_fanout_nets) {
         profiling::net_rerouted();
 
         /* rip up the whole net */
@@ -1380,7 +1681,7 @@ static void setup_routing_resources(int itry,
         // when we don't prune the tree, we also don't know the sink node indices
         // thus we'll use functions that act on pin indices like mark_ends instead
         // of their versions that act on node indices directly like mark_remaining_ends
-        mark_ends(net_list, net_id);
+        mark_ends(net_list, net_id, rr_node_path_inf);
     } else {
         profiling::net_rebuild_start();
 
@@ -1430,10 +1731,10 @@ static void setup_routing_resources(int itry,
         VTR_ASSERT_SAFE(tree.value().is_uncongested());
 
         // mark remaining ends
-        mark_remaining_ends(net_id);
+        mark_remaining_ends(net_id, rr_node_path_inf);
 
-        // mark the lookup (rr_node_route_inf) for existing tree elements as NO_PREVIOUS so add_to_path stops when it reaches one of them
-        update_rr_route_inf_from_tree(tree.value().root());
+        // mark the lookup (rr_node_path_inf) for existing tree elements as NO_PREVIOUS so add_to_path stops when it reaches one of them
+        update_rr_route_inf_from_tree(tree.value().root(), rr_node_path_inf);
     }
 
     // completed constructing the partial route tree and updated all other data structures to match
@@ -1450,27 +1751,29 @@ void update_rr_base_costs(int fanout) {
     factor = sqrt(fanout);
 
     for (index = CHANX_COST_INDEX_START; index < device_ctx.rr_indexed_data.size(); index++) {
-        if (device_ctx.rr_indexed_data[RRIndexedDataId(index)].T_quadratic > 0.) { /* pass transistor */
-            device_ctx.rr_indexed_data[RRIndexedDataId(index)].base_cost = device_ctx.rr_indexed_data[RRIndexedDataId(index)].saved_base_cost * factor;
-        } else {
-            device_ctx.rr_indexed_data[RRIndexedDataId(index)].base_cost = device_ctx.rr_indexed_data[RRIndexedDataId(index)].saved_base_cost;
+        auto& indexed_data = device_ctx.rr_indexed_data[RRIndexedDataId(index)];
+        float base_cost = indexed_data.saved_base_cost;
+        if (indexed_data.T_quadratic > 0.) { /* pass transistor */
+            base_cost *= factor;
+        }
+        /* Only written when changed, so that concurrent delay profilers (which all
+         * use a fanout of 1) only read the base costs once they are set */
+        if (indexed_data.base_cost != base_cost) {
+            indexed_data.base_cost = base_cost;
         }
     }
 }
 
-void update_rr_route_inf_from_tree(const RouteTreeNode& rt_node) {
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
-
+void update_rr_route_inf_from_tree(const RouteTreeNode& rt_node, vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf) {
     for (auto& child : rt_node.child_nodes()) {
         RRNodeId inode = child.inode;
-        route_ctx.rr_node_route_inf[inode].prev_node = RRNodeId::INVALID();
-        route_ctx.rr_node_route_inf[inode].prev_edge = RREdgeId::INVALID();
+        rr_node_path_inf[inode].prev_node = RRNodeId::INVALID();
+        rr_node_path_inf[inode].prev_edge = RREdgeId::INVALID();
 
-        // path cost should be unset
-        VTR_ASSERT(std::isinf(route_ctx.rr_node_route_inf[inode].path_cost));
-        VTR_ASSERT(std::isinf(route_ctx.rr_node_route_inf[inode].backward_path_cost));
+        // path costs are not checked: they are only valid within the path search
+        // which set them (see ConnectionRouter::reset_path_costs())
 
-        update_rr_route_inf_from_tree(child);
+        update_rr_route_inf_from_tree(child, rr_node_path_inf);
     }
 }
 
@@ -1552,7 +1855,7 @@ bool should_route_net(ParentNetId net_id,
         if (rt_node.is_leaf()) { //End of a branch
             // even if net is fully routed, not complete if parts of it should get ripped up (EXPERIMENTAL)
             if (if_force_reroute) {
-                if (connections_inf.should_force_reroute_connection(net_id, inode)) {
+                if (connections_inf.should_force_reroute_connection(net_id, rt_node.net_pin_index)) {
                     return true;
                 }
             }
@@ -1589,22 +1892,18 @@ static bool check_hold(const t_router_opts& router_opts, float worst_neg_slack)
 }
 
 static float get_net_pin_criticality(const std::shared_ptr<SetupHoldTimingInfo> timing_info,
-                                     const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
                                      float max_criticality,
                                      float criticality_exp,
                                      ParentNetId net_id,
-                                     ParentPinId pin_id,
-                                     bool is_flat) {
+                                     int ipin) {
     float pin_criticality = 0.0;
     const auto& route_ctx = g_vpr_ctx.routing();
 
     if (route_ctx.is_clock_net[net_id]) {
         pin_criticality = max_criticality;
     } else {
-        pin_criticality = calculate_clb_net_pin_criticality(*timing_info,
-                                                            netlist_pin_lookup,
-                                                            pin_id,
-                                                            is_flat);
+        //Kept up to date by the timing info after each timing update (see try_timing_driven_route_tmpl())
+        pin_criticality = timing_info->net_pin_criticalities()[net_id][ipin];
     }
 
     /* Pin criticality is between 0 and 1.
@@ -1789,7 +2088,101 @@ void print_overused_nodes_status(const t_router_opts& router_opts, const Overuse
     VTR_LOG("\n");
 }
 
+/* Reorders the (criticality sorted) sinks of a high fanout net by geographic cluster, the bins
+ * of the spatial route tree lookup. The most critical sink of every cluster comes first, so the
+ * first connections build a trunk to every cluster; the remaining sinks follow one cluster at a
+ * time, so that they branch off the trunk (found through the spatial lookup) close to them.
+ * Within a cluster, and among the trunk sinks, the criticality order is kept. */
+static void order_sinks_by_cluster(std::vector<int>& remaining_targets,
+                                   ParentNetId net_id,
+                                   const SpatialRouteTreeLookup& spatial_rt_lookup) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    size_t num_bins_y = spatial_rt_lookup.dim_size(1);
+    std::unordered_map<size_t, std::vector<int>> cluster_sinks;
+    std::vector<size_t> cluster_order;
+    for (int ipin : remaining_targets) {
+        RRNodeId sink_rr = route_ctx.net_rr_terminals[net_id][ipin];
+        size_t bin_x = grid_to_bin_x(rr_graph.node_xlow(sink_rr), spatial_rt_lookup);
+        size_t bin_y = grid_to_bin_y(rr_graph.node_ylow(sink_rr), spatial_rt_lookup);
+        size_t cluster = bin_x * num_bins_y + bin_y;
+
+        auto& sinks = cluster_sinks[cluster];
+        if (sinks.empty()) {
+            cluster_order.push_back(cluster);
+        }
+        sinks.push_back(ipin);
+    }
+
+    remaining_targets.clear();
+    for (size_t cluster : cluster_order) {
+        remaining_targets.push_back(cluster_sinks[cluster].front());
+    }
+    for (size_t cluster : cluster_order) {
+        const auto& sinks = cluster_sinks[cluster];
+        remaining_targets.insert(remaining_targets.end(), sinks.begin() + 1, sinks.end());
+    }
+}
+
 //Returns true if the specified net fanout is classified as high fanout
+// Interleaves the bits of x with 0's, so that the interleaved X and Y coordinates
+// can be OR'ed together into their Morton (Z-order) code (as in router_lookahead_sampling.cpp)
+static uint64_t interleave(uint32_t x) {
+    uint64_t i = x;
+    i = (i ^ (i << 16)) & 0x0000ffff0000ffff;
+    i = (i ^ (i << 8)) & 0x00ff00ff00ff00ff;
+    i = (i ^ (i << 4)) & 0x0f0f0f0f0f0f0f0f;
+    i = (i ^ (i << 2)) & 0x3333333333333333;
+    i = (i ^ (i << 1)) & 0x5555555555555555;
+    return i;
+}
+
+// Sorts the nets into fanout buckets (fanouts within a factor of two), the largest fanouts
+// first as with more_sinks_than. Within a bucket, the nets are sorted in the Z-order of
+// their bounding box centres, so that consecutive nets touch nearby parts of the RR graph
+// (and of the router's per node data), rather than jumping across the device.
+static void sort_nets_by_fanout_and_locality(std::vector<ParentNetId>& sorted_nets,
+                                             const Netlist<>& net_list,
+                                             const vtr::vector<ParentNetId, t_bb>& route_bb) {
+    struct t_net_order_key {
+        int fanout_bucket;
+        uint64_t location_order;
+        ParentNetId net_id;
+    };
+
+    std::vector<t_net_order_key> keys;
+    keys.reserve(sorted_nets.size());
+    for (ParentNetId net_id : sorted_nets) {
+        size_t fanout = net_list.net_sinks(net_id).size();
+        int fanout_bucket = 0;
+        while (fanout > 1) {
+            fanout >>= 1;
+            ++fanout_bucket;
+        }
+
+        const t_bb& bb = route_bb[net_id];
+        uint32_t x = std::max(0, bb.xmin + bb.xmax) / 2;
+        uint32_t y = std::max(0, bb.ymin + bb.ymax) / 2;
+
+        keys.push_back({fanout_bucket, interleave(x) | (interleave(y) << 1), net_id});
+    }
+
+    std::sort(keys.begin(), keys.end(), [](const t_net_order_key& lhs, const t_net_order_key& rhs) {
+        if (lhs.fanout_bucket != rhs.fanout_bucket) {
+            return lhs.fanout_bucket > rhs.fanout_bucket;
+        }
+        if (lhs.location_order != rhs.location_order) {
+            return lhs.location_order < rhs.location_order;
+        }
+        return lhs.net_id < rhs.net_id;
+    });
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        sorted_nets[i] = keys[i].net_id;
+    }
+}
+
 static bool is_high_fanout(int fanout, int fanout_threshold) {
     if (fanout_threshold < 0 || fanout < fanout_threshold) return false;
     return true;
@@ -1899,6 +2292,39 @@ size_t dynamic_update_bounding_boxes(const std::vector<ParentNetId>& updated_net
     return num_bb_updated;
 }
 
+//A connection which found no path within its net's predicted bounding box is routed with the
+//full device bounding box (by the connection router, or on the next iteration by the parallel
+//router), so its routing leaves the net's bounding box. Such nets likely need the margin of the
+//nominal bb_factor, which saves re-trying the full device on every iteration.
+size_t expand_predicted_bounding_boxes(const std::vector<ParentNetId>& updated_nets,
+                                       const Netlist<>& net_list,
+                                       int bb_factor) {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    size_t num_bb_updated = 0;
+
+    for (ParentNetId net : updated_nets) {
+        if (!route_ctx.route_trees[net])
+            continue; // Skip if no routing
+
+        t_bb curr_bb = calc_current_bb(route_ctx.route_trees[net].value());
+        t_bb& router_bb = route_ctx.route_bb[net];
+
+        if (curr_bb.xmin >= router_bb.xmin && curr_bb.xmax <= router_bb.xmax
+            && curr_bb.ymin >= router_bb.ymin && curr_bb.ymax <= router_bb.ymax) {
+            continue; //Routed within its bounding box
+        }
+
+        t_bb nominal_bb = load_net_route_bb(net_list, net, bb_factor);
+        router_bb.xmin = std::min({router_bb.xmin, nominal_bb.xmin, curr_bb.xmin});
+        router_bb.ymin = std::min({router_bb.ymin, nominal_bb.ymin, curr_bb.ymin});
+        router_bb.xmax = std::max({router_bb.xmax, nominal_bb.xmax, curr_bb.xmax});
+        router_bb.ymax = std::max({router_bb.ymax, nominal_bb.ymax, curr_bb.ymax});
+        ++num_bb_updated;
+    }
+    return num_bb_updated;
+}
+
 //Returns the bounding box of a net's used routing resources
 t_bb calc_current_bb(const RouteTree& tree) {
     auto& device_ctx = g_vpr_ctx.device();
@@ -1959,6 +2385,119 @@ void enable_router_debug(
 #endif
 }
 
+RoutingPredictor make_routing_predictor(const t_router_opts& router_opts) {
+    if (router_opts.predictor_schedule && router_opts.min_chan_width_search) {
+        //Predict from a shorter history so that channel widths which are
+        //too narrow are given up on after only a few iterations
+        return RoutingPredictor(ROUTING_PREDICTOR_MIN_W_SEARCH_MIN_HISTORY);
+    }
+    return RoutingPredictor();
+}
+
+float routing_predictor_abort_threshold(const t_router_opts& router_opts) {
+    float abort_iteration_threshold = std::numeric_limits<float>::infinity(); //Default no early abort
+    if (router_opts.routing_failure_predictor == SAFE) {
+        abort_iteration_threshold = ROUTING_PREDICTOR_ITERATION_ABORT_FACTOR_SAFE * router_opts.max_router_iterations;
+    } else if (router_opts.routing_failure_predictor == AGGRESSIVE) {
+        abort_iteration_threshold = ROUTING_PREDICTOR_ITERATION_ABORT_FACTOR_AGGRESSIVE * router_opts.max_router_iterations;
+    } else {
+        VTR_ASSERT_MSG(router_opts.routing_failure_predictor == OFF, "Unrecognized routing failure predictor setting");
+    }
+
+    if (router_opts.predictor_schedule && router_opts.min_chan_width_search && router_opts.routing_failure_predictor != OFF) {
+        //A failed attempt only tells the binary search to try a wider channel,
+        //so there is little to be gained from routing it for long
+        abort_iteration_threshold = std::min(abort_iteration_threshold,
+                                             ROUTING_PREDICTOR_ITERATION_ABORT_FACTOR_AGGRESSIVE * router_opts.max_router_iterations);
+    }
+    return abort_iteration_threshold;
+}
+
+bool should_skip_timing_update(const t_router_opts& router_opts,
+                               int itry,
+                               bool routing_is_feasible,
+                               size_t connections_routed,
+                               size_t num_connections,
+                               int consecutive_timing_skips) {
+    if (!router_opts.predictor_schedule || itry == 1 || routing_is_feasible) {
+        //Legal routings are always analyzed, since they may become the best routing
+        return false;
+    }
+    if (consecutive_timing_skips >= ROUTING_PREDICTOR_MAX_CONSECUTIVE_TIMING_SKIPS) {
+        return false;
+    }
+
+    //Few connections changed, so the criticalities could not change much
+    return connections_routed < ROUTING_PREDICTOR_TIMING_SKIP_CONNECTION_FRACTION * num_connections;
+}
+
+float bound_criticality_change(const Netlist<>& net_list,
+                               const NetPinsMatrix<float>& net_delay,
+                               const NetPinsMatrix<float>& analyzed_net_delay,
+                               const SetupTimingInfo& timing_info,
+                               float criticality_exp) {
+    float max_delay_change = 0.;
+    double total_delay_change = 0.;
+    for (auto net_id : net_list.nets()) {
+        if (net_list.net_is_ignored(net_id)) {
+            continue;
+        }
+        for (size_t ipin = 1; ipin < net_list.net_pins(net_id).size(); ++ipin) {
+            float delay_change = std::abs(net_delay[net_id][ipin] - analyzed_net_delay[net_id][ipin]);
+            max_delay_change = std::max(max_delay_change, delay_change);
+            total_delay_change += delay_change;
+        }
+    }
+
+    float critical_path_delay = timing_info.least_slack_critical_path().delay();
+    if (!(critical_path_delay > 0.)) {
+        return std::numeric_limits<float>::infinity();
+    }
+
+    size_t num_levels = timing_info.timing_graph()->levels().size();
+    float path_delay_change = std::min<double>(num_levels * double(max_delay_change), total_delay_change);
+
+    //Criticalities are (1 - slack / critical path delay) ^ criticality_exp: both the slack and the
+    //critical path delay changed by at most path_delay_change, so the base of the power changed by at
+    //most base_change. On [0, 1], x^e changes by at most e * base_change for e >= 1, but for e < 1 the
+    //power is steepest near 0, and only base_change^e bounds its change.
+    float base_change = 2 * path_delay_change / critical_path_delay;
+    if (criticality_exp < 1.) {
+        return std::pow(base_change, criticality_exp);
+    }
+    return criticality_exp * base_change;
+}
+
+bool should_skip_timing_update_for_delay_change(const t_router_opts& router_opts,
+                                                int itry,
+                                                bool routing_is_feasible,
+                                                const Netlist<>& net_list,
+                                                const NetPinsMatrix<float>& net_delay,
+                                                const NetPinsMatrix<float>& analyzed_net_delay,
+                                                const SetupTimingInfo& timing_info) {
+    if (router_opts.sta_skip_epsilon <= 0. || itry == 1 || routing_is_feasible) {
+        //Legal routings are always analyzed, since they may become the best routing
+        return false;
+    }
+
+    return bound_criticality_change(net_list, net_delay, analyzed_net_delay, timing_info, router_opts.criticality_exp) < router_opts.sta_skip_epsilon;
+}
+
+void print_routing_predictor_summary(const RoutingPredictor& routing_predictor, int first_legal_iteration) {
+    float first_estimate = routing_predictor.first_success_iteration_estimate();
+    if (std::isnan(first_estimate)) {
+        return; //Routing finished (or failed) before enough history was available to predict
+    }
+
+    if (first_legal_iteration > 0) {
+        VTR_LOG("Routing predictor: predicted legal routing at iteration %.1f (after %zu iterations), actual %d\n",
+                first_estimate, routing_predictor.first_estimate_iteration(), first_legal_iteration);
+    } else {
+        VTR_LOG("Routing predictor: predicted legal routing at iteration %.1f (after %zu iterations), none found\n",
+                first_estimate, routing_predictor.first_estimate_iteration());
+    }
+}
+
 bool is_iteration_complete(bool routing_is_feasible, const t_router_opts& router_opts, int itry, std::shared_ptr<const SetupHoldTimingInfo> timing_info, bool rcv_finished) {
     //This function checks if a routing iteration has completed.
     //When VPR is run normally, we check if routing_budgets_algorithm is disabled, and if the routing is legal
@@ -2058,7 +2597,8 @@ void generate_route_timing_reports(const t_router_opts& router_opts,
 
     tatum::TimingReporter timing_reporter(resolver, *timing_ctx.graph, *timing_ctx.constraints);
 
-    timing_reporter.report_timing_setup(router_opts.first_iteration_timing_report_file, *timing_info.setup_analyzer(), analysis_opts.timing_report_npaths);
+    AsyncOutputFile os(router_opts.first_iteration_timing_report_file);
+    timing_reporter.report_timing_setup(os, *timing_info.setup_analyzer(), analysis_opts.timing_report_npaths);
 }
 
 // If a route is ripped up during routing, non-configurable sets are left
@@ -2138,6 +2678,10 @@ void update_router_stats(RouterStats& router_stats, RouterStats& router_iteratio
     router_stats.add_all_rt += router_iteration_stats.add_all_rt;
     router_stats.add_all_rt_from_high_fanout += router_iteration_stats.add_all_rt_from_high_fanout;
     router_stats.add_high_fanout_rt += router_iteration_stats.add_high_fanout_rt;
+    router_stats.heap_item_high_water = std::max(router_stats.heap_item_high_water, router_iteration_stats.heap_item_high_water);
+    router_stats.heap_item_pool_size = std::max(router_stats.heap_item_pool_size, router_iteration_stats.heap_item_pool_size);
+    router_stats.heap_rescales += router_iteration_stats.heap_rescales;
+    router_stats.heap_expansions += router_iteration_stats.heap_expansions;
 }
 
 void init_router_stats(RouterStats& router_stats) {
@@ -2161,6 +2705,10 @@ void init_router_stats(RouterStats& router_stats) {
     router_stats.add_all_rt = 0;
     router_stats.add_high_fanout_rt = 0;
     router_stats.add_all_rt_from_high_fanout = 0;
+    router_stats.heap_item_high_water = 0;
+    router_stats.heap_item_pool_size = 0;
+    router_stats.heap_rescales = 0;
+    router_stats.heap_expansions = 0;
 }
 
 vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>> set_nets_choking_spots(const Netlist<>& net_list,
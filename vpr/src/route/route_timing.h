@@ -89,6 +89,12 @@ size_t dynamic_update_bounding_boxes(const std::vector<ParentNetId>& updated_net
                                      const Netlist<>& net_list,
                                      int high_fanout_threshold);
 
+/** Gives the nets whose routing left their predicted bounding box (see load_predicted_route_bb())
+ * their bb_factor bounding box. Returns the number of bounding boxes expanded */
+size_t expand_predicted_bounding_boxes(const std::vector<ParentNetId>& updated_nets,
+                                       const Netlist<>& net_list,
+                                       int bb_factor);
+
 /** Early exit code for cases where it is obvious that a successful route will not be found
  * Heuristic: If total wirelength used in first routing iteration is X% of total available wirelength, exit */
 bool early_exit_heuristic(const t_router_opts& router_opts, const WirelengthInfo& wirelength_info);
@@ -126,6 +132,9 @@ bool is_better_quality_routing(const vtr::vector<ParentNetId, vtr::optional<Rout
 
 bool is_iteration_complete(bool routing_is_feasible, const t_router_opts& router_opts, int itry, std::shared_ptr<const SetupHoldTimingInfo> timing_info, bool rcv_finished);
 
+/** Returns the routing predictor to use with router_opts */
+RoutingPredictor make_routing_predictor(const t_router_opts& router_opts);
+
 /** Print the index of this routing failure */
 void print_overused_nodes_status(const t_router_opts& router_opts, const OveruseInfo& overuse_info);
 
@@ -146,6 +155,9 @@ void print_router_criticality_histogram(const Netlist<>& net_list,
                                         const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
                                         bool is_flat);
 
+/** Logs the first predicted success iteration against the first legal iteration (<0 if none) */
+void print_routing_predictor_summary(const RoutingPredictor& routing_predictor, int first_legal_iteration);
+
 /** If a route is ripped up during routing, non-configurable sets are left
  * behind. As a result, the final routing may have stubs at
  * non-configurable sets. This function tracks non-configurable set usage,
@@ -153,6 +165,9 @@ void print_router_criticality_histogram(const Netlist<>& net_list,
 void prune_unused_non_configurable_nets(CBRR& connections_inf,
                                         const Netlist<>& net_list);
 
+/** Returns the estimated success iteration above which routing is aborted */
+float routing_predictor_abort_threshold(const t_router_opts& router_opts);
+
 /**
  * If flat_routing and has_choking_spot are true, there are some choke points inside the cluster which would increase the convergence time of routing.
  * To address this issue, the congestion cost of those choke points needs to decrease. This function identify those choke points for each net,
@@ -181,6 +196,39 @@ bool should_route_net(ParentNetId net_id,
 
 bool should_setup_lower_bound_connection_delays(int itry, const t_router_opts& router_opts);
 
+/** Returns true if timing analysis can be skipped after a routing iteration (--routing_predictor_schedule) */
+bool should_skip_timing_update(const t_router_opts& router_opts,
+                               int itry,
+                               bool routing_is_feasible,
+                               size_t connections_routed,
+                               size_t num_connections,
+                               int consecutive_timing_skips);
+
+/**
+ * @brief Returns a bound on how much any connection criticality can have changed since the timing
+ *        analysis of analyzed_net_delay, given the current net_delay
+ *
+ * No timing path crosses more connections than the timing graph has levels (nor more than all of them),
+ * so no slack nor the critical path delay changed by more than
+ * min(num_levels * max connection delay change, total connection delay change).
+ * The bound on the criticality change follows from that and criticality_exp.
+ */
+float bound_criticality_change(const Netlist<>& net_list,
+                               const NetPinsMatrix<float>& net_delay,
+                               const NetPinsMatrix<float>& analyzed_net_delay,
+                               const SetupTimingInfo& timing_info,
+                               float criticality_exp);
+
+/** Returns true if timing analysis can be skipped after a routing iteration since the net delays
+ * changed too little since the last analysis (--router_sta_skip_epsilon) */
+bool should_skip_timing_update_for_delay_change(const t_router_opts& router_opts,
+                                                int itry,
+                                                bool routing_is_feasible,
+                                                const Netlist<>& net_list,
+                                                const NetPinsMatrix<float>& net_delay,
+                                                const NetPinsMatrix<float>& analyzed_net_delay,
+                                                const SetupTimingInfo& timing_info);
+
 bool timing_driven_check_net_delays(const Netlist<>& net_list,
                                     NetPinsMatrix<float>& net_delay);
 
@@ -209,8 +257,7 @@ bool try_timing_driven_route(const Netlist<>& net_list,
  * @param pin_criticality
  * @param rt_node_of_sink Lookup from target_pin-like indices (indicating SINK nodes) to RouteTreeNodes
  * @param net_delay
- * @param netlist_pin_lookup
- * @param timing_info
+ * @param timing_info Its net_pin_criticalities() must be tracked for net_list
  * @param pin_timing_invalidator
  * @param budgeting_inf
  * @param worst_neg_slack
@@ -229,7 +276,6 @@ NetResultFlags timing_driven_route_net(ConnectionRouter& router,
                                        RouterStats& router_stats,
                                        std::vector<float>& pin_criticality,
                                        float* net_delay,
-                                       const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
                                        std::shared_ptr<SetupHoldTimingInfo> timing_info,
                                        NetPinTimingInvalidator* pin_timing_invalidator,
                                        route_budgets& budgeting_inf,
@@ -249,7 +295,6 @@ NetResultFlags try_timing_driven_route_net(ConnectionRouter& router,
                                            RouterStats& router_stats,
                                            std::vector<float>& pin_criticality,
                                            NetPinsMatrix<float>& net_delay,
-                                           const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
                                            std::shared_ptr<SetupHoldTimingInfo> timing_info,
                                            NetPinTimingInvalidator* pin_timing_invalidator,
                                            route_budgets& budgeting_inf,
@@ -286,6 +331,6 @@ void update_router_info_and_check_bp(bp_router_type type, int net_id);
 
 void update_rr_base_costs(int fanout);
 
-/** Traverses down a route tree and updates rr_node_inf for all nodes
+/** Traverses down a route tree and updates rr_node_path_inf for all nodes
  * to reflect that these nodes have already been routed to */
-void update_rr_route_inf_from_tree(const RouteTreeNode& rt_node);
+void update_rr_route_inf_from_tree(const RouteTreeNode& rt_node, vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf);
@@ -4,6 +4,7 @@
 #include "route_timing.h"
 #include "rr_graph_fwd.h"
 #include "vtr_math.h"
+#include "vtr_memory_usage.h"
 
 /* Construct a new RouteTreeNode.
  * Doesn't add the node to parent's child_nodes! (see add_child) */
@@ -74,6 +75,7 @@ RouteTree::RouteTree(RRNodeId _inode) {
     _root = new RouteTreeNode(_inode, RRSwitchId::INVALID(), nullptr);
     _net_id = ParentNetId::INVALID();
     _rr_node_to_rt_node[_inode] = _root;
+    _version = new_version();
 }
 
 RouteTree::RouteTree(ParentNetId _inet) {
@@ -87,6 +89,7 @@ RouteTree::RouteTree(ParentNetId _inet) {
     _num_sinks = route_ctx.net_rr_terminals[_inet].size() - 1;
     _isink_to_rt_node.resize(_num_sinks);     /* 0-indexed */
     _is_isink_reached.resize(_num_sinks + 1); /* 1-indexed */
+    _version = new_version();
 }
 
 /** Make a copy of rhs and return it.
@@ -112,9 +115,11 @@ void RouteTree::copy_tree_x(RouteTreeNode* lhs, const RouteTreeNode& rhs) {
 RouteTree::RouteTree(const RouteTree& rhs) {
     _isink_to_rt_node.resize(rhs._isink_to_rt_node.size());
     _net_id = rhs._net_id;
+    _rr_node_to_rt_node.reserve(rhs._rr_node_to_rt_node.size());
     _root = copy_tree(rhs._root);
     _is_isink_reached = rhs._is_isink_reached;
     _num_sinks = rhs._num_sinks;
+    _version = rhs._version;
 }
 
 /* Move constructor:
@@ -131,6 +136,7 @@ RouteTree::RouteTree(RouteTree&& rhs) {
     _isink_to_rt_node = std::move(rhs._isink_to_rt_node);
     _is_isink_reached = std::move(rhs._is_isink_reached);
     _num_sinks = rhs._num_sinks;
+    _version = rhs._version;
 }
 
 /* Copy assignment: free list, clear lookup, reload list. */
@@ -143,9 +149,11 @@ RouteTree& RouteTree::operator=(const RouteTree& rhs) {
     _isink_to_rt_node.clear();
     _isink_to_rt_node.resize(rhs._isink_to_rt_node.size());
     _net_id = rhs._net_id;
+    _rr_node_to_rt_node.reserve(rhs._rr_node_to_rt_node.size());
     _root = copy_tree(rhs._root);
     _is_isink_reached = rhs._is_isink_reached;
     _num_sinks = rhs._num_sinks;
+    _version = rhs._version;
     return *this;
 }
 
@@ -170,6 +178,7 @@ RouteTree& RouteTree::operator=(RouteTree&& rhs) {
     _isink_to_rt_node = std::move(rhs._isink_to_rt_node);
     _is_isink_reached = std::move(rhs._is_isink_reached);
     _num_sinks = rhs._num_sinks;
+    _version = rhs._version;
     return *this;
 }
 
@@ -178,6 +187,7 @@ RouteTree& RouteTree::operator=(RouteTree&& rhs) {
  * Note that update_from_heap already calls this. */
 void RouteTree::reload_timing(vtr::optional<RouteTreeNode&> from_node) {
     std::unique_lock<std::mutex> write_lock(_write_mutex);
+    _version = new_version();
     reload_timing_unlocked(from_node);
 }
 
@@ -194,6 +204,20 @@ void RouteTree::reload_timing_unlocked(vtr::optional<RouteTreeNode&> from_node)
     // Propagate C_downstream up from new subtree sinks to subtree root
     load_new_subtree_C_downstream(*from_node);
 
+    // A subtree hanging off a buffered switch without internal capacitance leaves the C_downstream
+    // of its ancestors unchanged, and so the delays of the rest of the tree: only the subtree's own
+    // delays need loading. This keeps adding a connection to a high fanout net cheap.
+    if (from_node->_parent) {
+        const auto& parent_switch = rr_graph.rr_switch_inf(from_node->parent_switch);
+        if (parent_switch.buffered() && parent_switch.Cinternal == 0.) {
+            float Tdel_start = from_node->_parent->Tdel;
+            Tdel_start += parent_switch.R * from_node->C_downstream;
+            Tdel_start += parent_switch.Tdel;
+            load_route_tree_Tdel(*from_node, Tdel_start);
+            return;
+        }
+    }
+
     // Propagate C_downstream up from the subtree root
     RouteTreeNode& unbuffered_subtree_rt_root = update_unbuffered_ancestors_C_downstream(*from_node);
 
@@ -353,6 +377,19 @@ vtr::optional<const RouteTreeNode&> RouteTree::find_by_rr_id(RRNodeId rr_node) c
     return vtr::nullopt;
 }
 
+/** Get the (approximate) heap memory used by this route tree, in bytes. */
+size_t RouteTree::memory_usage(void) const {
+    size_t num_nodes = 0;
+    for (auto& node : all_nodes()) {
+        (void)node;
+        num_nodes++;
+    }
+    return num_nodes * sizeof(RouteTreeNode)
+           + vtr::memory_usage(_rr_node_to_rt_node)
+           + vtr::memory_usage(_isink_to_rt_node)
+           + vtr::memory_usage(_is_isink_reached);
+}
+
 /** Check the consistency of this route tree. Looks for:
  * - invalid parent-child links
  * - invalid timing values
@@ -479,15 +516,18 @@ void RouteTree::print(void) const {
  * is the heap pointer of the SINK that was reached, and target_net_pin_index
  * is the net pin index corresponding to the SINK that was reached. This routine
  * returns a tuple: RouteTreeNode of the branch it adds to the route tree and
- * RouteTreeNode of the SINK it adds to the routing. */
+ * RouteTreeNode of the SINK it adds to the routing. The path is traced back
+ * through rr_node_path_inf (RoutingContext::rr_node_path_inf if nullptr). */
 std::tuple<vtr::optional<const RouteTreeNode&>, vtr::optional<const RouteTreeNode&>>
-RouteTree::update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRouteTreeLookup* spatial_rt_lookup, bool is_flat) {
+RouteTree::update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRouteTreeLookup* spatial_rt_lookup, bool is_flat, const vtr::vector<RRNodeId, t_rr_node_path_inf>* rr_node_path_inf) {
     /* Lock the route tree for writing. At least on Linux this shouldn't have an impact on single-threaded code */
     std::unique_lock<std::mutex> write_lock(_write_mutex);
+    _version = new_version();
 
     //Create a new subtree from the target in hptr to existing routing
     vtr::optional<RouteTreeNode&> start_of_new_subtree_rt_node, sink_rt_node;
-    std::tie(start_of_new_subtree_rt_node, sink_rt_node) = add_subtree_from_heap(hptr, target_net_pin_index, is_flat);
+    std::tie(start_of_new_subtree_rt_node, sink_rt_node) = add_subtree_from_heap(hptr, target_net_pin_index, is_flat,
+                                                                                 rr_node_path_inf ? *rr_node_path_inf : g_vpr_ctx.routing().rr_node_path_inf);
 
     if (!start_of_new_subtree_rt_node)
         return {vtr::nullopt, *sink_rt_node};
@@ -510,14 +550,13 @@ RouteTree::update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRoute
  * to the SINK indicated by hptr. Returns the first (most upstream) new rt_node,
  * and the rt_node of the new SINK. Traverses up from SINK  */
 std::tuple<vtr::optional<RouteTreeNode&>, vtr::optional<RouteTreeNode&>>
-RouteTree::add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is_flat) {
+RouteTree::add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is_flat, const vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf) {
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
-    auto& route_ctx = g_vpr_ctx.routing();
 
     RRNodeId sink_inode = RRNodeId(hptr->index);
 
-    /* Walk rr_node_route_inf up until we reach an existing RouteTreeNode */
+    /* Walk rr_node_path_inf up until we reach an existing RouteTreeNode */
     std::vector<RRNodeId> new_branch_inodes;
     std::vector<RRSwitchId> new_branch_iswitches;
 
@@ -533,13 +572,13 @@ RouteTree::add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is
     RRNodeId new_inode = RRNodeId(hptr->prev_node());
     RRSwitchId new_iswitch = RRSwitchId(rr_graph.rr_nodes().edge_switch(edge));
 
-    /* build a path, looking up rr nodes and switches from rr_node_route_inf */
+    /* build a path, looking up rr nodes and switches from rr_node_path_inf */
     new_branch_inodes.push_back(sink_inode);
     while (!_rr_node_to_rt_node.count(new_inode)) {
         new_branch_inodes.push_back(new_inode);
         new_branch_iswitches.push_back(new_iswitch);
-        edge = route_ctx.rr_node_route_inf[new_inode].prev_edge;
-        new_inode = RRNodeId(route_ctx.rr_node_route_inf[new_inode].prev_node);
+        edge = rr_node_path_inf[new_inode].prev_edge;
+        new_inode = RRNodeId(rr_node_path_inf[new_inode].prev_node);
         new_iswitch = RRSwitchId(rr_graph.rr_nodes().edge_switch(edge));
     }
     new_branch_iswitches.push_back(new_iswitch);
@@ -644,6 +683,7 @@ RouteTree::prune(CBRR& connections_inf, std::vector<int>* non_config_node_set_us
     auto& route_ctx = g_vpr_ctx.routing();
 
     std::unique_lock<std::mutex> write_lock(_write_mutex);
+    _version = new_version();
 
     VTR_ASSERT_MSG(rr_graph.node_type(root().inode) == SOURCE, "Root of route tree must be SOURCE");
 
@@ -680,7 +720,7 @@ RouteTree::prune_x(RouteTreeNode& rt_node, CBRR& connections_inf, bool force_pru
         force_prune = true;
     }
 
-    if (connections_inf.should_force_reroute_connection(_net_id, rt_node.inode)) {
+    if (connections_inf.should_force_reroute_connection(_net_id, rt_node.net_pin_index)) {
         //Forcibly re-route (e.g. to improve delay)
         force_prune = true;
     }
@@ -821,6 +861,7 @@ RouteTree::prune_x(RouteTreeNode& rt_node, CBRR& connections_inf, bool force_pru
  * TODO: is this function doing anything? Try running without it */
 void RouteTree::freeze(void) {
     std::unique_lock<std::mutex> write_lock(_write_mutex);
+    _version = new_version();
     return freeze_x(*_root);
 }
 
@@ -882,3 +923,20 @@ std::vector<int> RouteTree::get_non_config_node_set_usage(void) const {
 
     return usage;
 }
+
+void copy_route_trees(vtr::vector<ParentNetId, vtr::optional<RouteTree>>& to,
+                      const vtr::vector<ParentNetId, vtr::optional<RouteTree>>& from) {
+    if (to.size() != from.size()) {
+        to = from;
+        return;
+    }
+
+    for (size_t i = 0; i < from.size(); i++) {
+        ParentNetId net_id(i);
+        if (!from[net_id]) {
+            to[net_id] = vtr::nullopt;
+        } else if (!to[net_id] || to[net_id]->version() != from[net_id]->version()) {
+            to[net_id] = from[net_id];
+        }
+    }
+}
@@ -80,6 +80,8 @@
  * When the occupancy and timing data is up to date, a tree can be sanity checked using RouteTree::is_valid().
  */
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -88,11 +90,13 @@
 
 #include "connection_based_routing_fwd.h"
 #include "route_tree_fwd.h"
+#include "vtr_arena.h"
 #include "vtr_assert.h"
 #include "spatial_route_tree_lookup.h"
 #include "vtr_optional.h"
 #include "vtr_range.h"
 #include "vtr_vec_id_set.h"
+#include "vtr_vector.h"
 
 /**
  * @brief A single route tree node
@@ -112,6 +116,11 @@ class RouteTreeNode {
      * This constructor is only public for compatibility purposes. */
     RouteTreeNode(RRNodeId inode, RRSwitchId parent_switch, RouteTreeNode* parent);
 
+    /** Allocated from vtr::Arena: the router creates and frees many nodes, often
+     * from different threads in the parallel router. */
+    static void* operator new(size_t size) { return vtr::Arena::allocate(size); }
+    static void operator delete(void* ptr, size_t size) { vtr::Arena::deallocate(ptr, size); }
+
     /** ID of the rr_node that corresponds to this node. */
     RRNodeId inode;
     /** Switch type driving this node (by its parent). */
@@ -354,9 +363,11 @@ class RouteTree {
      * is the net pin index corresponding to the SINK that was reached. This routine
      * returns a tuple: RouteTreeNode of the branch it adds to the route tree and
      * RouteTreeNode of the SINK it adds to the routing.
+     * The path is traced back through rr_node_path_inf, the path search state of the
+     * router which found it (by default, the one of the routing context).
      * Locking operation: only one thread can update_from_heap() a RouteTree at a time. */
     std::tuple<vtr::optional<const RouteTreeNode&>, vtr::optional<const RouteTreeNode&>>
-    update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRouteTreeLookup* spatial_rt_lookup, bool is_flat);
+    update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRouteTreeLookup* spatial_rt_lookup, bool is_flat, const vtr::vector<RRNodeId, t_rr_node_path_inf>* rr_node_path_inf = nullptr);
 
     /** Reload timing values (R_upstream, C_downstream, Tdel).
      * Can take a RouteTreeNode& to do an incremental update.
@@ -395,6 +406,14 @@ class RouteTree {
     /** Print information about this route tree to stdout. */
     void print(void) const;
 
+    /** Get the (approximate) heap memory used by this route tree, in bytes. */
+    size_t memory_usage(void) const;
+
+    /** Get the version of this route tree. Every update gives the tree a new, globally unique
+     * version, while copies keep the version of the original: two trees with the same version
+     * hold the same routing. */
+    constexpr uint64_t version(void) const { return _version; }
+
     /** Prune overused nodes from the tree.
      * Also prune unused non-configurable nodes if non_config_node_set_usage is provided (see get_non_config_node_set_usage)
      * Returns nullopt if the entire tree is pruned.
@@ -488,7 +507,7 @@ class RouteTree {
 
   private:
     std::tuple<vtr::optional<RouteTreeNode&>, vtr::optional<RouteTreeNode&>>
-    add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is_flat);
+    add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is_flat, const vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf);
 
     void add_non_configurable_nodes(RouteTreeNode* rt_node,
                                     bool reached_by_non_configurable_edge,
@@ -634,7 +653,20 @@ class RouteTree {
     /** Number of sinks in this tree's net. Useful for iteration. */
     size_t _num_sinks;
 
+    /** See version(). Updated by the write operations through new_version(). */
+    uint64_t _version;
+    static uint64_t new_version(void) {
+        static std::atomic<uint64_t> next_version(0);
+        return next_version++;
+    }
+
     /** Write mutex on this RouteTree. Acquired by the write operations automatically:
      * the caller does not need to know about a lock. */
     std::mutex _write_mutex;
 };
+
+/** Copy the route trees in from to to, e.g. to save or restore the best routing.
+ * Trees of to which have the version of their counterpart in from are already copies and are left as they are,
+ * so this only copies the nets which were rerouted since the last copy. */
+void copy_route_trees(vtr::vector<ParentNetId, vtr::optional<RouteTree>>& to,
+                      const vtr::vector<ParentNetId, vtr::optional<RouteTree>>& from);
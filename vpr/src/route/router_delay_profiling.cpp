@@ -7,11 +7,20 @@
 #include "rr_graph.h"
 #include "vtr_time.h"
 #include "draw.h"
+#include "vtr_util.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <map>
 
 RouterDelayProfiler::RouterDelayProfiler(const Netlist<>& net_list,
                                          const RouterLookahead* lookahead,
-                                         bool is_flat)
+                                         bool is_flat,
+                                         vtr::vector<RRNodeId, t_rr_node_path_inf>* rr_node_path_inf)
     : net_list_(net_list)
+    , rr_node_path_inf_(rr_node_path_inf ? *rr_node_path_inf : g_vpr_ctx.mutable_routing().rr_node_path_inf)
     , router_(
           g_vpr_ctx.device().grid,
           *lookahead,
@@ -19,7 +28,7 @@ RouterDelayProfiler::RouterDelayProfiler(const Netlist<>& net_list,
           &g_vpr_ctx.device().rr_graph,
           g_vpr_ctx.device().rr_rc_data,
           g_vpr_ctx.device().rr_graph.rr_switch(),
-          g_vpr_ctx.mutable_routing().rr_node_route_inf,
+          rr_node_path_inf_,
           is_flat)
     , is_flat_(is_flat) {}
 
@@ -34,7 +43,6 @@ bool RouterDelayProfiler::calculate_delay(RRNodeId source_node,
      * case the rr_graph is disconnected and you can give up.                   */
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     //vtr::ScopedStartFinishTimer t(vtr::string_fmt("Profiling Delay from %s at %d,%d (%s) to %s at %d,%d (%s)",
     //rr_graph.node_type_string(RRNodeId(source_node)),
@@ -75,7 +83,7 @@ bool RouterDelayProfiler::calculate_delay(RRNodeId source_node,
     route_budgets budgeting_inf(net_list_, is_flat_);
 
     router_.clear_modified_rr_node_info();
-    RouterStats router_stats;
+    router_stats_ = RouterStats();
 
     bool found_path;
     t_heap cheapest;
@@ -88,7 +96,7 @@ bool RouterDelayProfiler::calculate_delay(RRNodeId source_node,
         sink_node,
         cost_params,
         bounding_box,
-        router_stats,
+        router_stats_,
         conn_params,
         true);
 
@@ -96,15 +104,15 @@ bool RouterDelayProfiler::calculate_delay(RRNodeId source_node,
         VTR_ASSERT(cheapest.index == sink_node);
 
         vtr::optional<const RouteTreeNode&> rt_node_of_sink;
-        std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, is_flat_);
+        std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, is_flat_, &rr_node_path_inf_);
 
         //find delay
         *net_delay = rt_node_of_sink->Tdel;
 
-        VTR_ASSERT_MSG(route_ctx.rr_node_route_inf[tree.root().inode].occ() <= rr_graph.node_capacity(tree.root().inode), "SOURCE should never be congested");
+        VTR_ASSERT_MSG(g_vpr_ctx.routing().rr_node_route_inf[tree.root().inode].occ() <= rr_graph.node_capacity(tree.root().inode), "SOURCE should never be congested");
     }
 
-    //VTR_LOG("Explored %zu of %zu (%.2f) RR nodes: path delay %g\n", router_stats.heap_pops, device_ctx.rr_nodes.size(), float(router_stats.heap_pops) / device_ctx.rr_nodes.size(), *net_delay);
+    //VTR_LOG("Explored %zu of %zu (%.2f) RR nodes: path delay %g\n", router_stats_.heap_pops, device_ctx.rr_nodes.size(), float(router_stats_.heap_pops) / device_ctx.rr_nodes.size(), *net_delay);
 
     //update_screen(ScreenUpdatePriority::MAJOR, "Profiled delay", ROUTING, nullptr);
 
@@ -117,9 +125,13 @@ bool RouterDelayProfiler::calculate_delay(RRNodeId source_node,
 //Returns the shortest path delay from src_node to all RR nodes in the RR graph, or NaN if no path exists
 vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src_rr_node,
                                                                     const t_router_opts& router_opts,
-                                                                    bool is_flat) {
+                                                                    bool is_flat,
+                                                                    vtr::vector<RRNodeId, t_rr_node_path_inf>* rr_node_path_inf) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
+    if (!rr_node_path_inf) {
+        rr_node_path_inf = &route_ctx.rr_node_path_inf;
+    }
 
     vtr::vector<RRNodeId, float> path_delays_to(device_ctx.rr_graph.num_nodes(), std::numeric_limits<float>::quiet_NaN());
 
@@ -142,7 +154,7 @@ vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src
     //be also passed
     VTR_ASSERT(is_flat == false);
     t_det_routing_arch det_routing_arch;
-    auto router_lookahead = make_router_lookahead(det_routing_arch, e_router_lookahead::NO_OP,
+    auto router_lookahead = make_router_lookahead(det_routing_arch, e_router_lookahead::NO_OP, router_opts.base_cost_type,
                                                   /*write_lookahead=*/"", /*read_lookahead=*/"",
                                                   /*segment_inf=*/{},
                                                   is_flat);
@@ -154,7 +166,7 @@ vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src
         &g_vpr_ctx.device().rr_graph,
         device_ctx.rr_rc_data,
         device_ctx.rr_graph.rr_switch(),
-        route_ctx.rr_node_route_inf,
+        *rr_node_path_inf,
         is_flat);
     RouterStats router_stats;
     ConnectionParameters conn_params(ParentNetId::INVALID(), OPEN, false, std::unordered_map<RRNodeId, int>());
@@ -177,7 +189,7 @@ vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src
             //Build the routing tree to get the delay
             tree = RouteTree(RRNodeId(src_rr_node));
             vtr::optional<const RouteTreeNode&> rt_node_of_sink;
-            std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&shortest_paths[sink_rr_node], OPEN, nullptr, router_opts.flat_routing);
+            std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&shortest_paths[sink_rr_node], OPEN, nullptr, router_opts.flat_routing, rr_node_path_inf);
 
             VTR_ASSERT(rt_node_of_sink->inode == RRNodeId(sink_rr_node));
 
@@ -215,6 +227,262 @@ vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src
     return path_delays_to;
 }
 
+namespace {
+
+///@brief Forwards to a router lookahead, timing its get_expected_cost() calls
+class TimedRouterLookahead : public RouterLookahead {
+  public:
+    TimedRouterLookahead(const RouterLookahead& lookahead)
+        : lookahead_(lookahead) {}
+
+    float get_expected_cost(RRNodeId node, RRNodeId target_node, const t_conn_cost_params& params, float R_upstream) const override {
+        auto start = std::chrono::steady_clock::now();
+        float cost = lookahead_.get_expected_cost(node, target_node, params, R_upstream);
+        expected_cost_time_ += std::chrono::steady_clock::now() - start;
+        ++num_expected_cost_calls_;
+        return cost;
+    }
+
+    std::pair<float, float> get_expected_delay_and_cong(RRNodeId node, RRNodeId target_node, const t_conn_cost_params& params, float R_upstream) const override {
+        return lookahead_.get_expected_delay_and_cong(node, target_node, params, R_upstream);
+    }
+
+    void compute(const std::vector<t_segment_inf>& /*segment_inf*/) override {
+        VPR_THROW(VPR_ERROR_ROUTE, "TimedRouterLookahead::compute unimplemented");
+    }
+
+    void compute_intra_tile() override {
+        VPR_THROW(VPR_ERROR_ROUTE, "TimedRouterLookahead::compute_intra_tile unimplemented");
+    }
+
+    void read(const std::string& /*file*/) override {
+        VPR_THROW(VPR_ERROR_ROUTE, "TimedRouterLookahead::read unimplemented");
+    }
+
+    void read_intra_cluster(const std::string& /*file*/) override {
+        VPR_THROW(VPR_ERROR_ROUTE, "TimedRouterLookahead::read_intra_cluster unimplemented");
+    }
+
+    void write(const std::string& file) const override {
+        lookahead_.write(file);
+    }
+
+    void write_intra_cluster(const std::string& file) const override {
+        lookahead_.write_intra_cluster(file);
+    }
+
+    size_t memory_usage() const override {
+        return lookahead_.memory_usage();
+    }
+
+    ///@brief Returns the time spent in get_expected_cost() so far, in seconds
+    double expected_cost_time() const { return std::chrono::duration<double>(expected_cost_time_).count(); }
+
+    size_t num_expected_cost_calls() const { return num_expected_cost_calls_; }
+
+  private:
+    const RouterLookahead& lookahead_;
+    mutable std::chrono::steady_clock::duration expected_cost_time_ = std::chrono::steady_clock::duration::zero();
+    mutable size_t num_expected_cost_calls_ = 0;
+};
+
+///@brief Lower bounds of the histogram bins of the ratio of the lookahead estimate to the routed value
+constexpr std::array<float, 8> LOOKAHEAD_RATIO_BINS = {0., 0.5, 0.75, 0.9, 1.1, 1.25, 1.5, 2.};
+
+///@brief The lookahead accuracy and cost of the sampled connections of one segment type and distance bucket
+struct t_lookahead_profile_bucket {
+    size_t num_connections = 0;
+    double sum_delay_ratio = 0.;
+    double sum_cost_ratio = 0.;
+    size_t num_expanded = 0;
+    size_t num_expected_cost_calls = 0;
+    double expected_cost_time = 0.;
+    std::array<size_t, LOOKAHEAD_RATIO_BINS.size()> delay_ratio_histogram = {};
+    std::array<size_t, LOOKAHEAD_RATIO_BINS.size()> cost_ratio_histogram = {};
+};
+
+void add_to_ratio_histogram(std::array<size_t, LOOKAHEAD_RATIO_BINS.size()>& histogram, float ratio) {
+    size_t ibin = std::upper_bound(LOOKAHEAD_RATIO_BINS.begin(), LOOKAHEAD_RATIO_BINS.end(), ratio) - LOOKAHEAD_RATIO_BINS.begin();
+    histogram[std::max<size_t>(ibin, 1) - 1]++;
+}
+
+void print_ratio_histogram(std::ofstream& os, const char* title, const std::array<size_t, LOOKAHEAD_RATIO_BINS.size()>& histogram, size_t num_connections) {
+    os << "    " << title << ":\n";
+    for (size_t ibin = 0; ibin < LOOKAHEAD_RATIO_BINS.size(); ++ibin) {
+        std::string range;
+        if (ibin + 1 < LOOKAHEAD_RATIO_BINS.size()) {
+            range = vtr::string_fmt("[%4.2f, %4.2f)", LOOKAHEAD_RATIO_BINS[ibin], LOOKAHEAD_RATIO_BINS[ibin + 1]);
+        } else {
+            range = vtr::string_fmt("[%4.2f,  inf)", LOOKAHEAD_RATIO_BINS[ibin]);
+        }
+        os << vtr::string_fmt("      %s %8zu (%5.1f%%)\n", range.c_str(), histogram[ibin], 100. * histogram[ibin] / num_connections);
+    }
+}
+
+///@brief Returns the name of distance bucket ibucket, which holds the distances of ibucket bits: 0, 1, 2-3, 4-7, ...
+std::string distance_bucket_name(int ibucket) {
+    if (ibucket <= 1) {
+        return std::to_string(ibucket);
+    }
+    int low = 1 << (ibucket - 1);
+    return vtr::string_fmt("%d-%d", low, 2 * low - 1);
+}
+
+} // namespace
+
+void profile_router_lookahead(const Netlist<>& net_list,
+                              const RouterLookahead* lookahead,
+                              const t_router_opts& router_opts,
+                              const std::vector<t_segment_inf>& segment_inf,
+                              const std::string& report_file,
+                              bool is_flat) {
+    vtr::ScopedStartFinishTimer timer("Profiling router lookahead");
+
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    TimedRouterLookahead timed_lookahead(*lookahead);
+    ConnectionRouter<BinaryHeap> router(
+        device_ctx.grid,
+        timed_lookahead,
+        rr_graph.rr_nodes(),
+        &rr_graph,
+        device_ctx.rr_rc_data,
+        rr_graph.rr_switch(),
+        route_ctx.rr_node_path_inf,
+        is_flat);
+
+    //Sample connections evenly across the netlist
+    size_t num_connections = 0;
+    for (ParentNetId net_id : net_list.nets()) {
+        if (!net_list.net_is_ignored(net_id)) {
+            num_connections += net_list.net_sinks(net_id).size();
+        }
+    }
+    constexpr size_t MAX_PROFILED_CONNECTIONS = 5000;
+    size_t sample_stride = std::max<size_t>(1, (num_connections + MAX_PROFILED_CONNECTIONS - 1) / MAX_PROFILED_CONNECTIONS);
+
+    //The connections are routed with the final congestion history, but without present congestion
+    //costs, so the nodes used by the final routing remain available to them
+    t_conn_cost_params cost_params;
+    cost_params.criticality = router_opts.max_criticality;
+    cost_params.astar_fac = router_opts.astar_fac;
+    cost_params.bend_cost = router_opts.bend_cost;
+    cost_params.pres_fac = 0.;
+
+    //Buckets by segment type of the first wire, then by distance
+    std::map<std::string, std::map<int, t_lookahead_profile_bucket>> buckets;
+    size_t num_profiled = 0;
+    size_t num_unrouted = 0;
+
+    size_t iconn = 0;
+    for (ParentNetId net_id : net_list.nets()) {
+        if (net_list.net_is_ignored(net_id)) {
+            continue;
+        }
+        for (size_t ipin = 1; ipin < route_ctx.net_rr_terminals[net_id].size(); ++ipin, ++iconn) {
+            if (iconn % sample_stride != 0) {
+                continue;
+            }
+            RRNodeId source_node = route_ctx.net_rr_terminals[net_id][0];
+            RRNodeId sink_node = route_ctx.net_rr_terminals[net_id][ipin];
+
+            float expected_delay, expected_cong;
+            std::tie(expected_delay, expected_cong) = lookahead->get_expected_delay_and_cong(source_node, sink_node, cost_params, 0.);
+            float expected_cost = lookahead->get_expected_cost(source_node, sink_node, cost_params, 0.);
+
+            RouteTree tree(source_node);
+            RouterStats router_stats;
+            ConnectionParameters conn_params(net_id, ipin, false, std::unordered_map<RRNodeId, int>());
+            size_t calls_before = timed_lookahead.num_expected_cost_calls();
+            double time_before = timed_lookahead.expected_cost_time();
+
+            bool found_path;
+            t_heap cheapest;
+            std::tie(found_path, std::ignore, cheapest) = router.timing_driven_route_connection_from_route_tree(
+                tree.root(),
+                sink_node,
+                cost_params,
+                route_ctx.route_bb[net_id],
+                router_stats,
+                conn_params,
+                true);
+
+            if (!found_path) {
+                ++num_unrouted;
+                router.reset_path_costs();
+                continue;
+            }
+
+            float routed_cost = cheapest.backward_path_cost;
+            vtr::optional<const RouteTreeNode&> rt_node_of_sink;
+            std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, is_flat);
+            float routed_delay = rt_node_of_sink->Tdel;
+            router.reset_path_costs();
+
+            std::string segment_name = "<no wire>";
+            for (const RouteTreeNode& rt_node : tree.all_nodes()) {
+                t_rr_type node_type = rr_graph.node_type(rt_node.inode);
+                if (node_type == CHANX || node_type == CHANY) {
+                    int seg_index = device_ctx.rr_indexed_data[rr_graph.node_cost_index(rt_node.inode)].seg_index;
+                    segment_name = segment_inf[seg_index].name;
+                    break;
+                }
+            }
+            int distance = std::abs(rr_graph.node_xlow(sink_node) - rr_graph.node_xlow(source_node))
+                           + std::abs(rr_graph.node_ylow(sink_node) - rr_graph.node_ylow(source_node));
+            int distance_bucket = 0;
+            while ((1 << distance_bucket) <= distance) {
+                ++distance_bucket;
+            }
+
+            t_lookahead_profile_bucket& bucket = buckets[segment_name][distance_bucket];
+            float delay_ratio = routed_delay > 0. ? expected_delay / routed_delay : 1.;
+            float cost_ratio = routed_cost > 0. ? expected_cost / routed_cost : 1.;
+            ++bucket.num_connections;
+            bucket.sum_delay_ratio += delay_ratio;
+            bucket.sum_cost_ratio += cost_ratio;
+            bucket.num_expanded += router_stats.heap_pops;
+            bucket.num_expected_cost_calls += timed_lookahead.num_expected_cost_calls() - calls_before;
+            bucket.expected_cost_time += timed_lookahead.expected_cost_time() - time_before;
+            add_to_ratio_histogram(bucket.delay_ratio_histogram, delay_ratio);
+            add_to_ratio_histogram(bucket.cost_ratio_histogram, cost_ratio);
+            ++num_profiled;
+        }
+    }
+
+    std::ofstream os(report_file);
+    if (!os) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to open router lookahead profile file '%s'\n", report_file.c_str());
+    }
+
+    os << "Router lookahead profile\n";
+    os << "Profiled connections: " << num_profiled << " (one in " << sample_stride << " of " << num_connections << "), unroutable: " << num_unrouted << "\n";
+    os << "Ratios are the lookahead estimate from the SOURCE over the routed value (criticality " << cost_params.criticality << ")\n";
+    os << "Connections are bucketed by the segment type of their first wire, then by Manhattan distance (tiles)\n";
+    os << "Time in get_expected_cost(): " << timed_lookahead.expected_cost_time() << " s over " << timed_lookahead.num_expected_cost_calls() << " calls\n";
+
+    for (const auto& segment_buckets : buckets) {
+        for (const auto& kv : segment_buckets.second) {
+            const t_lookahead_profile_bucket& bucket = kv.second;
+            os << "\nSegment " << segment_buckets.first << ", distance " << distance_bucket_name(kv.first) << ":\n";
+            os << vtr::string_fmt("    connections: %zu, mean delay ratio: %.3f, mean cost ratio: %.3f\n",
+                                  bucket.num_connections,
+                                  bucket.sum_delay_ratio / bucket.num_connections,
+                                  bucket.sum_cost_ratio / bucket.num_connections);
+            os << vtr::string_fmt("    mean nodes expanded: %.1f, mean get_expected_cost() calls: %.1f, mean time in get_expected_cost(): %g s\n",
+                                  double(bucket.num_expanded) / bucket.num_connections,
+                                  double(bucket.num_expected_cost_calls) / bucket.num_connections,
+                                  bucket.expected_cost_time / bucket.num_connections);
+            print_ratio_histogram(os, "delay ratio histogram", bucket.delay_ratio_histogram, bucket.num_connections);
+            print_ratio_histogram(os, "cost ratio histogram", bucket.cost_ratio_histogram, bucket.num_connections);
+        }
+    }
+
+    VTR_LOG("Profiled the router lookahead on %zu connections, see %s\n", num_profiled, report_file.c_str());
+}
+
 void alloc_routing_structs(t_chan_width chan_width,
                            const t_router_opts& router_opts,
                            t_det_routing_arch* det_routing_arch,
@@ -10,9 +10,15 @@
 
 class RouterDelayProfiler {
   public:
+    /**
+     * @brief The profiler routes with (and leaves reset) the path search state rr_node_path_inf, by default
+     *        the one of the routing context. Profilers with separate copies of the path search state can
+     *        calculate delays concurrently.
+     */
     RouterDelayProfiler(const Netlist<>& net_list,
                         const RouterLookahead* lookahead,
-                        bool is_flat);
+                        bool is_flat,
+                        vtr::vector<RRNodeId, t_rr_node_path_inf>* rr_node_path_inf = nullptr);
 
     /**
      * @brief Returns true as long as found some way to hook up this net, even if that
@@ -32,16 +38,44 @@ class RouterDelayProfiler {
                          float* net_delay,
                          int layer_num);
 
+    ///@brief Returns the router statistics (e.g. nodes expanded) of the last calculate_delay() call
+    const RouterStats& router_stats() const { return router_stats_; }
+
   private:
     const Netlist<>& net_list_;
+    vtr::vector<RRNodeId, t_rr_node_path_inf>& rr_node_path_inf_;
     RouterStats router_stats_;
     ConnectionRouter<BinaryHeap> router_;
     bool is_flat_;
 };
 
+/**
+ * @brief Returns the shortest path delay from src_rr_node to all RR nodes in the RR graph, or NaN if no path exists
+ *
+ * The search uses (and leaves reset) the path search state rr_node_path_inf, by default the one of the
+ * routing context. Searches with separate copies of the path search state can run concurrently.
+ */
 vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src_rr_node,
                                                                     const t_router_opts& router_opts,
-                                                                    bool is_flat);
+                                                                    bool is_flat,
+                                                                    vtr::vector<RRNodeId, t_rr_node_path_inf>* rr_node_path_inf = nullptr);
+
+/**
+ * @brief Profiles the accuracy and the cost of the router lookahead on a sample of the routed connections
+ *
+ * Each sampled connection is re-routed from its SOURCE, and the lookahead estimates from the SOURCE
+ * are compared to the delay and cost of the path found. Together with the number of nodes expanded
+ * and the time spent in get_expected_cost(), histograms of the estimate to routed ratios are
+ * written to report_file, per segment type (of the first wire of the path) and distance bucket.
+ *
+ * Must be called after a successful routing, whose congestion history is used by the connections.
+ */
+void profile_router_lookahead(const Netlist<>& net_list,
+                              const RouterLookahead* lookahead,
+                              const t_router_opts& router_opts,
+                              const std::vector<t_segment_inf>& segment_inf,
+                              const std::string& report_file,
+                              bool is_flat);
 
 void alloc_routing_structs(t_chan_width chan_width,
                            const t_router_opts& router_opts,
@@ -5,9 +5,21 @@
 #include "vpr_error.h"
 #include "globals.h"
 #include "route_timing.h"
+#include "artifact_cache.h"
+#include "connection_router_interface.h"
+#include "vtr_random.h"
+#include "vtr_digest.h"
+
+#include <algorithm>
+#include <cmath>
 
 static int get_expected_segs_to_target(RRNodeId inode, RRNodeId target_node, int* num_segs_ortho_dir_ptr);
 static int round_up(float x);
+static std::string get_router_lookahead_cache_file(const t_det_routing_arch& det_routing_arch,
+                                                   e_router_lookahead router_lookahead_type,
+                                                   e_base_cost_type base_cost_type,
+                                                   const std::vector<t_segment_inf>& segment_inf);
+static std::string rr_graph_digest(const RRGraphView& rr_graph, const vtr::vector<RRIndexedDataId, t_rr_indexed_data>& rr_indexed_data);
 
 static std::unique_ptr<RouterLookahead> make_router_lookahead_object(const t_det_routing_arch& det_routing_arch,
                                                                      e_router_lookahead router_lookahead_type,
@@ -28,6 +40,7 @@ static std::unique_ptr<RouterLookahead> make_router_lookahead_object(const t_det
 
 std::unique_ptr<RouterLookahead> make_router_lookahead(const t_det_routing_arch& det_routing_arch,
                                                        e_router_lookahead router_lookahead_type,
+                                                       e_base_cost_type base_cost_type,
                                                        std::string write_lookahead,
                                                        std::string read_lookahead,
                                                        const std::vector<t_segment_inf>& segment_inf,
@@ -36,8 +49,22 @@ std::unique_ptr<RouterLookahead> make_router_lookahead(const t_det_routing_arch&
                                                                                      router_lookahead_type,
                                                                                      is_flat);
 
+    std::string cache_file;
     if (read_lookahead.empty()) {
+        cache_file = get_router_lookahead_cache_file(det_routing_arch, router_lookahead_type, base_cost_type, segment_inf);
+    }
+
+    if (!cache_file.empty() && artifact_cache_contains(cache_file)) {
+        VTR_LOG("Loading router lookahead from artifact cache '%s'\n", cache_file.c_str());
+        router_lookahead->read(cache_file);
+    } else if (read_lookahead.empty()) {
         router_lookahead->compute(segment_inf);
+
+        if (!cache_file.empty()) {
+            artifact_cache_store(cache_file, [&](const std::string& file) {
+                router_lookahead->write(file);
+            });
+        }
     } else {
         router_lookahead->read(read_lookahead);
     }
@@ -46,9 +73,133 @@ std::unique_ptr<RouterLookahead> make_router_lookahead(const t_det_routing_arch&
         router_lookahead->write(write_lookahead);
     }
 
+    router_lookahead->sample_cost_scale(g_vpr_ctx.device().rr_graph);
+
     return router_lookahead;
 }
 
+void RouterLookahead::sample_cost_scale(const RRGraphView& rr_graph) {
+    // Few enough to be negligible next to loading the lookahead, enough for a stable percentile
+    constexpr size_t kNumSamples = 1000;
+    constexpr size_t kMaxDrawsPerSample = 100;
+
+    cost_scale_ = 0.f;
+    size_t num_nodes = rr_graph.num_nodes();
+    if (num_nodes == 0) {
+        return;
+    }
+
+    // Draws nodes until one of the requested types is found (or gives up)
+    vtr::RandomNumberGenerator rng(1);
+    auto draw_node = [&](bool want_sink) {
+        for (size_t idraw = 0; idraw < kMaxDrawsPerSample; ++idraw) {
+            RRNodeId node(rng.irand(int(num_nodes - 1)));
+            t_rr_type type = rr_graph.node_type(node);
+            if (want_sink ? (type == SINK) : (type == CHANX || type == CHANY)) {
+                return node;
+            }
+        }
+        return RRNodeId::INVALID();
+    };
+
+    t_conn_cost_params delay_params;
+    delay_params.criticality = 1.;
+    t_conn_cost_params cong_params;
+    cong_params.criticality = 0.;
+
+    std::vector<float> costs;
+    costs.reserve(kNumSamples);
+    for (size_t isample = 0; isample < kNumSamples; ++isample) {
+        RRNodeId from_node = draw_node(false);
+        RRNodeId to_node = draw_node(true);
+        if (!from_node || !to_node) {
+            continue;
+        }
+        float cost = std::max(get_expected_cost(from_node, to_node, delay_params, 0.),
+                              get_expected_cost(from_node, to_node, cong_params, 0.));
+        if (cost > 0. && std::isfinite(cost)) {
+            costs.push_back(cost);
+        }
+    }
+
+    if (!costs.empty()) {
+        auto percentile = costs.begin() + (costs.size() - 1) * 99 / 100;
+        std::nth_element(costs.begin(), percentile, costs.end());
+        cost_scale_ = *percentile;
+    }
+}
+
+static std::string get_router_lookahead_cache_file(const t_det_routing_arch& det_routing_arch,
+                                                   e_router_lookahead router_lookahead_type,
+                                                   e_base_cost_type base_cost_type,
+                                                   const std::vector<t_segment_inf>& segment_inf) {
+    //Only the map lookahead can be stored without capnproto, and is the one worth caching
+    if (det_routing_arch.artifact_cache_dir.empty() || router_lookahead_type != e_router_lookahead::MAP) {
+        return std::string();
+    }
+
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    ArtifactKey key(det_routing_arch.artifact_cache_dir, "router_lookahead", ".blob");
+    key.add_device(device_ctx.grid, device_ctx.chan_width)
+        .add("lookahead_type", int(router_lookahead_type))
+        .add("base_cost_type", int(base_cost_type))
+        .add("rr_graph", rr_graph_digest(device_ctx.rr_graph, device_ctx.rr_indexed_data));
+    std::vector<std::string> segment_names;
+    for (const t_segment_inf& seg : segment_inf) {
+        segment_names.push_back(seg.name);
+    }
+    key.add("segments", segment_names);
+    return key.path();
+}
+
+/**
+ * @brief Returns a digest of everything in the RR graph the map lookahead is computed from
+ *
+ * The RR graph may be read from a file (--read_rr_graph) or be modified after it is built,
+ * so the options it was built with do not identify it. The digest covers the nodes (and their
+ * cost indices and RC data), the edges, the switches and the indexed data (base costs).
+ * Hashing them is linear in the size of the graph, far cheaper than computing the lookahead.
+ */
+static std::string rr_graph_digest(const RRGraphView& rr_graph, const vtr::vector<RRIndexedDataId, t_rr_indexed_data>& rr_indexed_data) {
+    //The fields are copied out, as the padding of the node storage is not initialized
+    std::vector<int32_t> nodes;
+    std::vector<float> costs;
+    nodes.reserve(9 * rr_graph.num_nodes());
+    costs.reserve(2 * rr_graph.num_nodes());
+    for (RRNodeId inode : rr_graph.nodes()) {
+        nodes.push_back(rr_graph.node_type(inode));
+        nodes.push_back(rr_graph.node_xlow(inode));
+        nodes.push_back(rr_graph.node_ylow(inode));
+        nodes.push_back(rr_graph.node_xhigh(inode));
+        nodes.push_back(rr_graph.node_yhigh(inode));
+        nodes.push_back(rr_graph.node_ptc_num(inode));
+        nodes.push_back(rr_graph.node_layer(inode));
+        nodes.push_back(size_t(rr_graph.node_cost_index(inode)));
+        nodes.push_back(rr_graph.num_edges(inode));
+        costs.push_back(rr_graph.node_R(inode));
+        costs.push_back(rr_graph.node_C(inode));
+    }
+
+    for (size_t iswitch = 0; iswitch < rr_graph.num_rr_switches(); ++iswitch) {
+        const t_rr_switch_inf& rr_switch = rr_graph.rr_switch_inf(RRSwitchId(iswitch));
+        costs.insert(costs.end(), {rr_switch.R, rr_switch.Cin, rr_switch.Cout, rr_switch.Cinternal, rr_switch.Tdel});
+    }
+
+    for (const t_rr_indexed_data& data : rr_indexed_data) {
+        nodes.insert(nodes.end(), {data.ortho_cost_index, data.seg_index});
+        costs.insert(costs.end(), {data.base_cost, data.saved_base_cost, data.inv_length, data.T_linear, data.T_quadratic, data.C_load});
+    }
+
+    //Edges are stored grouped by source node, so the per-node edge counts above place them
+    auto edge_dest_nodes = rr_graph.rr_nodes().edge_dest_node_data();
+    auto edge_switches = rr_graph.rr_nodes().edge_switch_data();
+    return vtr::secure_digest_buffers({vtr::array_view<const char>(reinterpret_cast<const char*>(nodes.data()), nodes.size() * sizeof(int32_t)),
+                                       vtr::array_view<const char>(reinterpret_cast<const char*>(costs.data()), costs.size() * sizeof(float)),
+                                       vtr::array_view<const char>(reinterpret_cast<const char*>(edge_dest_nodes.data()), edge_dest_nodes.size() * sizeof(RRNodeId)),
+                                       vtr::array_view<const char>(reinterpret_cast<const char*>(edge_switches.data()), edge_switches.size() * sizeof(short))});
+}
+
 float ClassicLookahead::get_expected_cost(RRNodeId current_node, RRNodeId target_node, const t_conn_cost_params& params, float R_upstream) const {
     float delay_cost, cong_cost;
     std::tie(delay_cost, cong_cost) = get_expected_delay_and_cong(current_node, target_node, params, R_upstream);
@@ -198,6 +349,7 @@ void invalidate_router_lookahead_cache() {
 
 const RouterLookahead* get_cached_router_lookahead(const t_det_routing_arch& det_routing_arch,
                                                    e_router_lookahead router_lookahead_type,
+                                                   e_base_cost_type base_cost_type,
                                                    std::string write_lookahead,
                                                    std::string read_lookahead,
                                                    const std::vector<t_segment_inf>& segment_inf,
@@ -217,6 +369,7 @@ const RouterLookahead* get_cached_router_lookahead(const t_det_routing_arch& det
             cache_key,
             make_router_lookahead(det_routing_arch,
                                   router_lookahead_type,
+                                  base_cost_type,
                                   write_lookahead,
                                   read_lookahead,
                                   segment_inf,
@@ -5,6 +5,7 @@
 #include "vpr_error.h"
 
 struct t_conn_cost_params; //Forward declaration
+class RRGraphView;
 
 class RouterLookahead {
   public:
@@ -36,7 +37,23 @@ class RouterLookahead {
     // May be unimplemented, in which case method should throw an exception.
     virtual void write_intra_cluster(const std::string& file) const = 0;
 
+    // Returns the (approximate) heap memory used by the lookahead data, in bytes.
+    virtual size_t memory_usage() const = 0;
+
+    // The 99th percentile of the expected costs of a sample of connections
+    // (from wires to sinks, at criticality 0 and 1), e.g. to size the bucket
+    // heap (see HeapInterface::set_cost_scale_hint). 0 until sample_cost_scale()
+    // is called, and for lookaheads which expect no cost (NoOpLookahead).
+    float cost_scale() const { return cost_scale_; }
+
+    // Samples cost_scale() over rr_graph. Called by make_router_lookahead(),
+    // once the lookahead is computed or read.
+    void sample_cost_scale(const RRGraphView& rr_graph);
+
     virtual ~RouterLookahead() {}
+
+  private:
+    float cost_scale_ = 0.f;
 };
 
 // Force creation of lookahead object.
@@ -45,6 +62,7 @@ class RouterLookahead {
 // cannot be used.
 std::unique_ptr<RouterLookahead> make_router_lookahead(const t_det_routing_arch& det_routing_arch,
                                                        e_router_lookahead router_lookahead_type,
+                                                       e_base_cost_type base_cost_type,
                                                        std::string write_lookahead,
                                                        std::string read_lookahead,
                                                        const std::vector<t_segment_inf>& segment_inf,
@@ -59,6 +77,7 @@ void invalidate_router_lookahead_cache();
 // performed via this function.
 const RouterLookahead* get_cached_router_lookahead(const t_det_routing_arch& det_routing_arch,
                                                    e_router_lookahead router_lookahead_type,
+                                                   e_base_cost_type base_cost_type,
                                                    std::string write_lookahead,
                                                    std::string read_lookahead,
                                                    const std::vector<t_segment_inf>& segment_inf,
@@ -92,6 +111,10 @@ class ClassicLookahead : public RouterLookahead {
         VPR_THROW(VPR_ERROR_ROUTE, "ClassicLookahead::write_intra_cluster unimplemented");
     }
 
+    size_t memory_usage() const override {
+        return 0;
+    }
+
   private:
     float classic_wire_lookahead_cost(RRNodeId node, RRNodeId target_node, float criticality, float R_upstream) const;
 };
@@ -123,6 +146,10 @@ class NoOpLookahead : public RouterLookahead {
     void write_intra_cluster(const std::string& /*file*/) const override {
         VPR_THROW(VPR_ERROR_ROUTE, "write_intra_cluster not supported for NoOpLookahead");
     }
+
+    size_t memory_usage() const override {
+        return 0;
+    }
 };
 
 #endif
@@ -4,6 +4,7 @@
 #include "globals.h"
 #include "echo_files.h"
 #include "vtr_geometry.h"
+#include "vtr_memory_usage.h"
 
 #ifdef VTR_ENABLE_CAPNPROTO
 #    include "capnp/serialize.h"
@@ -331,6 +332,12 @@ void CostMap::print(int iseg) const {
 }
 
 // list segment type and chan type pairs that have empty cost maps (debug)
+size_t CostMap::memory_usage() const {
+    return vtr::memory_usage(cost_map_)
+           + vtr::memory_usage(offset_)
+           + vtr::memory_usage(penalty_);
+}
+
 std::vector<std::pair<int, int>> CostMap::list_empty() const {
     std::vector<std::pair<int, int>> results;
     for (int iseg = 0; iseg < (int)cost_map_.dim_size(0); iseg++) {
@@ -2,7 +2,6 @@
 
 #include <vector>
 #include <queue>
-#include <mutex>
 
 #include "rr_node.h"
 #include "router_lookahead_map_utils.h"
@@ -11,6 +10,7 @@
 #include "vtr_math.h"
 #include "vtr_time.h"
 #include "vtr_geometry.h"
+#include "vtr_memory_usage.h"
 #include "echo_files.h"
 #include "rr_graph.h"
 
@@ -26,7 +26,7 @@
 #endif
 
 #if defined(VPR_USE_TBB)
-#    include <tbb/parallel_for_each.h>
+#    include <tbb/parallel_for.h>
 #endif
 
 /* we're profiling routing cost over many tracks for each wire type, so we'll
@@ -58,12 +58,49 @@ static constexpr bool BREAK_ON_MISS = false;
  */
 static constexpr int MIN_PATH_COUNT = 1000;
 
+/**
+ * @brief Relative cost change below which an entry of a sample region is considered converged
+ *
+ * After each start node, the fraction of the region's cost entries it added, or lowered by more than this
+ * tolerance, measures how much the region's cost map still changes. Once SAMPLE_CONVERGED_NODES consecutive
+ * start nodes each changed less than this fraction of the entries, the sample region is complete (even if
+ * MIN_PATH_COUNT paths have not been found yet).
+ */
+static constexpr float SAMPLE_CONVERGENCE_TOLERANCE = 0.01;
+
+///@brief The number of consecutive start nodes which must leave a sample region's cost entries converged
+static constexpr int SAMPLE_CONVERGED_NODES = 3;
+
 template<typename Entry>
 static std::pair<float, int> run_dijkstra(RRNodeId start_node,
                                           std::vector<bool>* node_expanded,
                                           std::vector<util::Search_Path>* paths,
                                           util::RoutingCosts* routing_costs);
 
+/* Merges the cost entries found from a start node into those of its sample region, keeping the smallest
+ * (REPRESENTATIVE_ENTRY_METHOD == SMALLEST).
+ *
+ * Returns the fraction of the region's entries which were added, or lowered by more than
+ * SAMPLE_CONVERGENCE_TOLERANCE (relative); 1 if the region has no entries. */
+static float merge_sample_costs(const util::RoutingCosts& node_costs, util::RoutingCosts* region_costs) {
+    size_t num_changed = 0;
+    for (const auto& cost : node_costs) {
+        auto result = region_costs->insert(cost);
+        if (result.second) {
+            ++num_changed;
+        } else if (cost.second < result.first->second) {
+            if (cost.second < result.first->second * (1.f - SAMPLE_CONVERGENCE_TOLERANCE)) {
+                ++num_changed;
+            }
+            result.first->second = cost.second;
+        }
+    }
+    if (region_costs->empty()) {
+        return 1.f;
+    }
+    return float(num_changed) / region_costs->size();
+}
+
 std::pair<float, float> ExtendedMapLookahead::get_src_opin_cost(RRNodeId from_node, int delta_x, int delta_y, const t_conn_cost_params& params) const {
     auto& device_ctx = g_vpr_ctx.device();
     auto& rr_graph = device_ctx.rr_graph;
@@ -439,25 +476,51 @@ void ExtendedMapLookahead::compute(const std::vector<t_segment_inf>& segment_inf
     util::RoutingCosts all_delay_costs;
     util::RoutingCosts all_base_costs;
 
+    // The cost entries found from each sample region. They are combined in region order once all
+    // regions are done, so the lookahead does not depend on the order the workers finish in (SMALLEST
+    // keeps the first of several equal entries).
+    std::vector<util::RoutingCosts> region_delay_costs(sample_regions.size());
+    std::vector<util::RoutingCosts> region_base_costs(sample_regions.size());
+
+    // The start nodes expanded (out of those available) for each sample region, and the fraction of
+    // its cost entries changed by the last one (the error bound of the region's cost entries)
+    std::vector<size_t> region_sampled_nodes(sample_regions.size(), 0);
+    std::vector<size_t> region_available_nodes(sample_regions.size(), 0);
+    std::vector<float> region_last_change(sample_regions.size(), 1.f);
+
     /* run Dijkstra's algorithm for each segment type & channel type combination */
 #if defined(VPR_USE_TBB) // Run in parallel
-    std::mutex all_costs_mutex;
-    tbb::parallel_for_each(sample_regions, [&](const SampleRegion& region) {
+    tbb::parallel_for(size_t(0), sample_regions.size(), [&](size_t iregion) {
 #else // Run serially
-    for (const auto& region : sample_regions) {
+    for (size_t iregion = 0; iregion < sample_regions.size(); ++iregion) {
 #endif
+        // buffer the messages of the region, so they are logged in region order
+        vtr::ScopedLogBuffer log_buffer(iregion);
+
+        const SampleRegion& region = sample_regions[iregion];
+
         // holds the cost entries for a run
-        util::RoutingCosts delay_costs;
-        util::RoutingCosts base_costs;
+        util::RoutingCosts& delay_costs = region_delay_costs[iregion];
+        util::RoutingCosts& base_costs = region_base_costs[iregion];
         int total_path_count = 0;
+        int num_converged_nodes = 0;
         std::vector<bool> node_expanded(device_ctx.rr_graph.num_nodes());
         std::vector<util::Search_Path> paths(device_ctx.rr_graph.num_nodes());
 
+        // the cost entries found from the current start node
+        util::RoutingCosts node_delay_costs;
+        util::RoutingCosts node_base_costs;
+
+        for (const auto& point : region.points) {
+            region_available_nodes[iregion] += point.nodes.size();
+        }
+
         // Each point in a sample region contains a set of nodes. Each node becomes a starting node
         // for the dijkstra expansions, and different paths are explored to reach different locations.
         //
-        // If the nodes get exhausted or the minimum number of paths is reached (set by MIN_PATH_COUNT)
-        // the routine exits and the costs added to the collection of all the costs found so far.
+        // If the nodes get exhausted, the minimum number of paths is reached (set by MIN_PATH_COUNT)
+        // or the region's cost entries converge (see SAMPLE_CONVERGENCE_TOLERANCE) the routine exits
+        // and the costs added to the collection of all the costs found so far.
         for (auto& point : region.points) {
             // statistics
             vtr::Timer run_timer;
@@ -473,15 +536,27 @@ void ExtendedMapLookahead::compute(const std::vector<t_segment_inf>& segment_inf
                 //       Experiments have shown that the having two separate expansions lead to better results for Series 7 devices, but
                 //       this might not be true for Stratix ones.
                 {
-                    auto result = run_dijkstra<util::PQ_Entry_Delay>(node, &node_expanded, &paths, &delay_costs);
+                    auto result = run_dijkstra<util::PQ_Entry_Delay>(node, &node_expanded, &paths, &node_delay_costs);
                     max_delay_cost = std::max(max_delay_cost, result.first);
                     path_count += result.second;
                 }
                 {
-                    auto result = run_dijkstra<util::PQ_Entry_Base_Cost>(node, &node_expanded, &paths, &base_costs);
+                    auto result = run_dijkstra<util::PQ_Entry_Base_Cost>(node, &node_expanded, &paths, &node_base_costs);
                     max_base_cost = std::max(max_base_cost, result.first);
                     path_count += result.second;
                 }
+
+                float change = std::max(merge_sample_costs(node_delay_costs, &delay_costs),
+                                        merge_sample_costs(node_base_costs, &base_costs));
+                node_delay_costs.clear();
+                node_base_costs.clear();
+
+                ++region_sampled_nodes[iregion];
+                region_last_change[iregion] = change;
+                num_converged_nodes = (change < SAMPLE_CONVERGENCE_TOLERANCE) ? num_converged_nodes + 1 : 0;
+                if (num_converged_nodes >= SAMPLE_CONVERGED_NODES) {
+                    break;
+                }
             }
 
             if (path_count > 0) {
@@ -494,29 +569,39 @@ void ExtendedMapLookahead::compute(const std::vector<t_segment_inf>& segment_inf
             }
 
             total_path_count += path_count;
-            if (total_path_count > MIN_PATH_COUNT) {
+            if (total_path_count > MIN_PATH_COUNT || num_converged_nodes >= SAMPLE_CONVERGED_NODES) {
                 break;
             }
         }
 
-#if defined(VPR_USE_TBB)
-        // The mutex locks the common data structures that each worker uses to store the routing
-        // expansion data.
-        //
-        // This because delay_costs and base_costs are in the worker's scope, so they can be run parallely and
-        // no data is shared among workers.
-        // Instead, all_delay_costs and all_base_costs is a shared object between all the workers, hence the
-        // need of a mutex when modifying their entries.
-        all_costs_mutex.lock();
-#endif
-
         if (total_path_count == 0) {
             VTR_LOG_WARN("No paths found for sample region %s(%d, %d)\n",
                          segment_inf[region.segment_type].name.c_str(), region.grid_location.x(), region.grid_location.y());
         }
+#if defined(VPR_USE_TBB)
+    });
+#else
+    }
+#endif
+    vtr::flush_log_buffers();
+
+    size_t num_sampled_nodes = 0;
+    size_t num_available_nodes = 0;
+    size_t num_converged_regions = 0;
+    float max_last_change = 0.f;
+    for (size_t iregion = 0; iregion < sample_regions.size(); ++iregion) {
+        num_sampled_nodes += region_sampled_nodes[iregion];
+        num_available_nodes += region_available_nodes[iregion];
+        num_converged_regions += (region_last_change[iregion] < SAMPLE_CONVERGENCE_TOLERANCE);
+        max_last_change = std::max(max_last_change, region_last_change[iregion]);
+    }
+    VTR_LOG("Expanded %zu of %zu sample start nodes; %zu of %zu sample regions converged, with at most %g of a region's cost entries changed (by more than %g) by its last start node\n",
+            num_sampled_nodes, num_available_nodes, num_converged_regions, sample_regions.size(),
+            max_last_change, SAMPLE_CONVERGENCE_TOLERANCE);
 
+    for (size_t iregion = 0; iregion < sample_regions.size(); ++iregion) {
         // combine the cost map from this run with the final cost maps for each segment
-        for (const auto& cost : delay_costs) {
+        for (const auto& cost : region_delay_costs[iregion]) {
             const auto& val = cost.second;
             auto result = all_delay_costs.insert(std::make_pair(cost.first, val));
             if (!result.second) {
@@ -524,7 +609,7 @@ void ExtendedMapLookahead::compute(const std::vector<t_segment_inf>& segment_inf
                 result.first->second = std::min(result.first->second, val);
             }
         }
-        for (const auto& cost : base_costs) {
+        for (const auto& cost : region_base_costs[iregion]) {
             const auto& val = cost.second;
             auto result = all_base_costs.insert(std::make_pair(cost.first, val));
             if (!result.second) {
@@ -533,12 +618,10 @@ void ExtendedMapLookahead::compute(const std::vector<t_segment_inf>& segment_inf
             }
         }
 
-#if defined(VPR_USE_TBB)
-        all_costs_mutex.unlock();
-    });
-#else
+        // the region's entries are no longer needed
+        region_delay_costs[iregion] = util::RoutingCosts();
+        region_base_costs[iregion] = util::RoutingCosts();
     }
-#endif
 
     VTR_LOG("Combining results\n");
     /* boil down the cost list in routing_cost_map at each coordinate to a
@@ -624,3 +707,10 @@ void ExtendedMapLookahead::write(const std::string& file) const {
 }
 
 #endif
+
+size_t ExtendedMapLookahead::memory_usage() const {
+    return vtr::memory_usage(src_opin_delays)
+           + vtr::memory_usage(src_opin_inter_layer_delays)
+           + vtr::memory_usage(chan_ipins_delays)
+           + cost_map_.memory_usage();
+}
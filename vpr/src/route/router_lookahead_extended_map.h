@@ -106,6 +106,11 @@ class ExtendedMapLookahead : public RouterLookahead {
     void write_intra_cluster(const std::string& /*file*/) const override {
         VPR_THROW(VPR_ERROR_ROUTE, "ExtendedMapLookahead::write_intra_cluster unimplemented");
     }
+
+    /**
+     * @brief Returns the (approximate) heap memory used by the extended lookahead map, in bytes
+     */
+    size_t memory_usage() const override;
 };
 
 #endif
@@ -34,6 +34,9 @@
 #include "vtr_assert.h"
 #include "vtr_time.h"
 #include "vtr_geometry.h"
+#include "vtr_flat_blob.h"
+#include "vtr_memory_usage.h"
+#include "vtr_util.h"
 #include "router_lookahead_map.h"
 #include "router_lookahead_map_utils.h"
 #include "rr_graph2.h"
@@ -50,6 +53,11 @@
 #    include "serdes_utils.h"
 #endif /* VTR_ENABLE_CAPNPROTO */
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/enumerable_thread_specific.h>
+#    include <tbb/parallel_for.h>
+#endif
+
 /* we will profile delay/congestion using this many tracks for each wire type */
 #define MAX_TRACK_OFFSET 16
 
@@ -102,6 +110,12 @@ class Expansion_Cost_Entry {
     void clear_cost_entries() {
         this->cost_vector.clear();
     }
+    /* adds the entries of another expansion, in the order they were recorded there */
+    void merge_cost_entries(const Expansion_Cost_Entry& other) {
+        for (const Cost_Entry& cost_entry : other.cost_vector) {
+            this->add_cost_entry(cost_entry.delay, cost_entry.congestion);
+        }
+    }
 
     Cost_Entry get_representative_cost_entry(e_representative_entry_method method) {
         float nan = std::numeric_limits<float>::quiet_NaN();
@@ -204,6 +218,12 @@ struct t_dijkstra_data {
 //Look-up table from CHANX/CHANY (to SINKs) for various distances
 t_wire_cost_map f_wire_cost_map;
 
+//Read-only view of the wire lookahead used for all queries. It refers either
+//to f_wire_cost_map, or directly to a memory-mapped flat blob (f_wire_cost_blob)
+//when the lookahead was loaded from one
+vtr::NdMatrixView<Cost_Entry, 5, t_wire_cost_layout> f_wire_cost_view;
+std::unique_ptr<vtr::FlatBlobReader> f_wire_cost_blob;
+
 /******** File-Scope Functions ********/
 
 /***
@@ -228,16 +248,15 @@ static void compute_tiles_lookahead(std::unordered_map<int, util::t_ipin_primiti
                                     const t_det_routing_arch& det_routing_arch,
                                     const DeviceContext& device_ctx);
 /***
- * @brief Compute the cose from tile pins to tile sinks
- * @param inter_tile_pin_primitive_pin_delay [physical_tile_type_idx][from_pin_ptc_num][sink_ptc_num] -> cost
+ * @brief Compute the cost from tile pins to tile sinks
  * @param physical_tile
  * @param det_routing_arch
  * @param delayless_switch
+ * @return [from_pin_ptc_num][sink_ptc_num] -> cost
  */
-static void compute_tile_lookahead(std::unordered_map<int, util::t_ipin_primitive_sink_delays>& inter_tile_pin_primitive_pin_delay,
-                                   t_physical_tile_type_ptr physical_tile,
-                                   const t_det_routing_arch& det_routing_arch,
-                                   const int delayless_switch);
+static util::t_ipin_primitive_sink_delays compute_tile_lookahead(t_physical_tile_type_ptr physical_tile,
+                                                                 const t_det_routing_arch& det_routing_arch,
+                                                                 const int delayless_switch);
 
 /***
  * @brief Compute the minimum cost to get to the sinks from pins on the cluster
@@ -253,7 +272,7 @@ static void store_min_cost_to_sinks(std::unordered_map<int, std::unordered_map<i
  * @brief Iterate over the first and second dimension of f_wire_cost_map to get the minimum cost for each dx and dy_
  * @param internal_opin_global_cost_map This map is populated in this function. [dx][dy] -> cost
  */
-static void min_global_cost_map(vtr::NdMatrix<util::Cost_Entry, 3>& internal_opin_global_cost_map);
+static void min_global_cost_map(vtr::NdMatrix<util::Cost_Entry, 3, vtr::NdMatrixTiled<>>& internal_opin_global_cost_map);
 
 /**
  * @brief Iterate over all of the wire segments accessible from the SOURCE/OPIN (stored in src_opin_delay_map) and return the minimum cost (congestion and delay) across them to the sink
@@ -305,6 +324,14 @@ static void adjust_rr_wire_position(const RRNodeId rr, int& x, int& y);
 static void adjust_rr_src_sink_position(const RRNodeId rr, int& x, int& y);
 
 static void print_wire_cost_map(int layer_num, const std::vector<t_segment_inf>& segment_inf);
+/* points f_wire_cost_view at f_wire_cost_map, releasing any memory-mapped lookahead */
+static void view_wire_cost_map();
+/* returns true if file should be read/written as a memory-mapped flat blob rather than a capnp message */
+static bool is_flat_blob_file(const std::string& file);
+/* returns a copy of the wire lookahead currently being queried */
+static t_wire_cost_map copy_wire_cost_view();
+static void read_router_lookahead_blob(const std::string& file);
+static void write_router_lookahead_blob(const std::string& file);
 static void print_router_cost_map(const t_routing_cost_map& router_cost_map);
 
 /******** Interface class member function definitions ********/
@@ -582,7 +609,7 @@ void MapLookahead::read_intra_cluster(const std::string& file) {
     vtr::ScopedStartFinishTimer timer("Loading router intra cluster lookahead map");
     is_flat_ = true;
     // Maps related to global resources should not be empty
-    VTR_ASSERT(!f_wire_cost_map.empty());
+    VTR_ASSERT(!f_wire_cost_view.empty());
     read_intra_cluster_router_lookahead(inter_tile_pin_primitive_pin_delay,
                                         file);
 
@@ -609,6 +636,22 @@ void MapLookahead::write_intra_cluster(const std::string& file) const {
                                          inter_tile_pin_primitive_pin_delay);
 }
 
+size_t MapLookahead::memory_usage() const {
+    size_t bytes = vtr::memory_usage(src_opin_delays)
+                   + vtr::memory_usage(inter_tile_pin_primitive_pin_delay)
+                   + vtr::memory_usage(tile_min_cost)
+                   + vtr::memory_usage(distance_based_min_cost)
+                   + vtr::memory_usage(src_opin_inter_layer_delays);
+
+    //The wire cost map is either owned, or memory-mapped from a flat blob
+    if (f_wire_cost_blob) {
+        bytes += f_wire_cost_view.storage_size() * sizeof(Cost_Entry);
+    } else {
+        bytes += vtr::memory_usage(f_wire_cost_map);
+    }
+    return bytes;
+}
+
 /******** Function Definitions ********/
 
 Cost_Entry get_wire_cost_entry(e_rr_type rr_type, int seg_index, int layer_num, int delta_x, int delta_y) {
@@ -619,11 +662,11 @@ Cost_Entry get_wire_cost_entry(e_rr_type rr_type, int seg_index, int layer_num,
         chan_index = 1;
     }
 
-    VTR_ASSERT_SAFE(layer_num < (int)f_wire_cost_map.dim_size(0));
-    VTR_ASSERT_SAFE(delta_x < (int)f_wire_cost_map.dim_size(3));
-    VTR_ASSERT_SAFE(delta_y < (int)f_wire_cost_map.dim_size(4));
+    VTR_ASSERT_SAFE(layer_num < (int)f_wire_cost_view.dim_size(0));
+    VTR_ASSERT_SAFE(delta_x < (int)f_wire_cost_view.dim_size(3));
+    VTR_ASSERT_SAFE(delta_y < (int)f_wire_cost_view.dim_size(4));
 
-    return f_wire_cost_map[layer_num][chan_index][seg_index][delta_x][delta_y];
+    return f_wire_cost_view[layer_num][chan_index][seg_index][delta_x][delta_y];
 }
 
 static void compute_router_wire_lookahead(const std::vector<t_segment_inf>& segment_inf) {
@@ -664,6 +707,13 @@ static void compute_router_wire_lookahead(const std::vector<t_segment_inf>& segm
     int target_x = device_ctx.grid.width() - 2;
     int target_y = device_ctx.grid.height() - 2;
 
+    //Dijkstra search state, one per worker thread when running in parallel
+#if defined(VPR_USE_TBB)
+    tbb::enumerable_thread_specific<t_dijkstra_data> dijkstra_data;
+#else
+    t_dijkstra_data dijkstra_data;
+#endif
+
     //Profile each wire segment type
     for (int layer_num = 0; layer_num < grid.get_num_layers(); layer_num++) {
         //if arch file specifies die_number="layer_num" doesn't require inter-cluster
@@ -738,8 +788,12 @@ static void compute_router_wire_lookahead(const std::vector<t_segment_inf>& segm
 
             //Finally, now that we have a list of sample locations, run a Djikstra flood from
             //each sample location to profile the routing network from this type
+            //
+            //The floods are independent, so (with TBB) they run in parallel, each filling a
+            //private cost map. The private maps are then combined in sample order, which gives
+            //the same lookahead as running the floods one after the other, whatever the number
+            //of threads.
 
-            t_dijkstra_data dijkstra_data;
             t_routing_cost_map routing_cost_map({device_ctx.grid.width(), device_ctx.grid.height()});
 
             for (e_rr_type chan_type : chan_types) {
@@ -749,10 +803,11 @@ static void compute_router_wire_lookahead(const std::vector<t_segment_inf>& segm
                                  segment_inf[iseg].name.c_str(),
                                  segment_inf[iseg].length);
                 } else {
-                    //reset cost for this segment
-                    routing_cost_map.fill(Expansion_Cost_Entry());
+                    const std::vector<RRNodeId>& chan_sample_nodes = sample_nodes[chan_type];
+                    std::vector<t_routing_cost_map> sample_cost_maps(chan_sample_nodes.size());
 
-                    for (RRNodeId sample_node : sample_nodes[chan_type]) {
+                    auto run_sample = [&](size_t isample, t_dijkstra_data& thread_dijkstra_data) {
+                        RRNodeId sample_node = chan_sample_nodes[isample];
                         int sample_x = rr_graph.node_xlow(sample_node);
                         int sample_y = rr_graph.node_ylow(sample_node);
 
@@ -761,12 +816,33 @@ static void compute_router_wire_lookahead(const std::vector<t_segment_inf>& segm
                             sample_y = rr_graph.node_yhigh(sample_node);
                         }
 
+                        sample_cost_maps[isample] = t_routing_cost_map({device_ctx.grid.width(), device_ctx.grid.height()});
                         run_dijkstra(sample_node,
                                      layer_num,
                                      sample_x,
                                      sample_y,
-                                     routing_cost_map,
-                                     &dijkstra_data);
+                                     sample_cost_maps[isample],
+                                     &thread_dijkstra_data);
+                    };
+
+#if defined(VPR_USE_TBB) // Run in parallel
+                    tbb::parallel_for(size_t(0), chan_sample_nodes.size(), [&](size_t isample) {
+                        run_sample(isample, dijkstra_data.local());
+                    });
+#else // Run serially
+                    for (size_t isample = 0; isample < chan_sample_nodes.size(); ++isample) {
+                        run_sample(isample, dijkstra_data);
+                    }
+#endif
+
+                    //reset cost for this segment, and combine the samples in order
+                    routing_cost_map.fill(Expansion_Cost_Entry());
+                    for (const t_routing_cost_map& sample_cost_map : sample_cost_maps) {
+                        for (size_t ix = 0; ix < routing_cost_map.dim_size(0); ix++) {
+                            for (size_t iy = 0; iy < routing_cost_map.dim_size(1); iy++) {
+                                routing_cost_map[ix][iy].merge_cost_entries(sample_cost_map[ix][iy]);
+                            }
+                        }
                     }
 
                     if (false) print_router_cost_map(routing_cost_map);
@@ -783,6 +859,8 @@ static void compute_router_wire_lookahead(const std::vector<t_segment_inf>& segm
         }
         if (false) print_wire_cost_map(layer_num, segment_inf);
     }
+
+    view_wire_cost_map();
 }
 
 /* returns index of a node from which to start routing */
@@ -1360,6 +1438,51 @@ static void print_wire_cost_map(int layer_num, const std::vector<t_segment_inf>&
     }
 }
 
+static void view_wire_cost_map() {
+    f_wire_cost_blob.reset();
+    f_wire_cost_view = vtr::NdMatrixView<Cost_Entry, 5, t_wire_cost_layout>(f_wire_cost_map);
+}
+
+static bool is_flat_blob_file(const std::string& file) {
+    return vtr::check_file_name_extension(file, ".blob");
+}
+
+static void read_router_lookahead_blob(const std::string& file) {
+    vtr::ScopedStartFinishTimer timer("Mapping router wire lookahead blob");
+
+    //Queries go straight to the mapped file, so the computed map is no longer needed
+    f_wire_cost_map.clear();
+    try {
+        f_wire_cost_blob = std::make_unique<vtr::FlatBlobReader>(file);
+        f_wire_cost_view = f_wire_cost_blob->matrix<Cost_Entry, 5, t_wire_cost_layout>(0);
+    } catch (const vtr::VtrError& e) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to load router lookahead blob: %s\n", e.what());
+    }
+}
+
+static t_wire_cost_map copy_wire_cost_view() {
+    //The view may refer to a mapped blob, in which case f_wire_cost_map is empty
+    t_wire_cost_map cost_map({f_wire_cost_view.dim_size(0),
+                              f_wire_cost_view.dim_size(1),
+                              f_wire_cost_view.dim_size(2),
+                              f_wire_cost_view.dim_size(3),
+                              f_wire_cost_view.dim_size(4)});
+    if (!cost_map.empty()) {
+        std::copy(f_wire_cost_view.data(), f_wire_cost_view.data() + f_wire_cost_view.storage_size(), &cost_map.get(0));
+    }
+    return cost_map;
+}
+
+static void write_router_lookahead_blob(const std::string& file) {
+    vtr::FlatBlobWriter writer;
+    writer.add_matrix(copy_wire_cost_view());
+    try {
+        writer.write(file);
+    } catch (const vtr::VtrError& e) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to write router lookahead blob: %s\n", e.what());
+    }
+}
+
 static void print_router_cost_map(const t_routing_cost_map& router_cost_map) {
     VTR_LOG("Djikstra Flood Costs:\n");
     for (size_t x = 0; x < router_cost_map.dim_size(0); x++) {
@@ -1380,25 +1503,44 @@ static void compute_tiles_lookahead(std::unordered_map<int, util::t_ipin_primiti
                                     const DeviceContext& device_ctx) {
     const auto& tiles = device_ctx.physical_tile_types;
 
-    for (const auto& tile : tiles) {
+    //Each tile type is profiled on its own private RR graph, so (with TBB) the tile types are
+    //profiled in parallel. The results are stored in tile type order afterwards.
+    std::vector<util::t_ipin_primitive_sink_delays> tile_pin_delays(tiles.size());
+    auto compute_tile = [&](size_t itile) {
+        if (is_empty_type(&tiles[itile])) {
+            return;
+        }
+        tile_pin_delays[itile] = compute_tile_lookahead(&tiles[itile],
+                                                        det_routing_arch,
+                                                        device_ctx.delayless_switch_idx);
+    };
+
+#if defined(VPR_USE_TBB) // Run in parallel
+    tbb::parallel_for(size_t(0), tiles.size(), compute_tile);
+#else // Run serially
+    for (size_t itile = 0; itile < tiles.size(); ++itile) {
+        compute_tile(itile);
+    }
+#endif
+
+    for (size_t itile = 0; itile < tiles.size(); ++itile) {
+        const auto& tile = tiles[itile];
         if (is_empty_type(&tile)) {
             continue;
         }
 
-        compute_tile_lookahead(inter_tile_pin_primitive_pin_delay,
-                               &tile,
-                               det_routing_arch,
-                               device_ctx.delayless_switch_idx);
+        auto insert_res = inter_tile_pin_primitive_pin_delay.insert(std::make_pair(tile.index, std::move(tile_pin_delays[itile])));
+        VTR_ASSERT(insert_res.second);
+
         store_min_cost_to_sinks(tile_min_cost,
                                 &tile,
                                 inter_tile_pin_primitive_pin_delay);
     }
 }
 
-static void compute_tile_lookahead(std::unordered_map<int, util::t_ipin_primitive_sink_delays>& inter_tile_pin_primitive_pin_delay,
-                                   t_physical_tile_type_ptr physical_tile,
-                                   const t_det_routing_arch& det_routing_arch,
-                                   const int delayless_switch) {
+static util::t_ipin_primitive_sink_delays compute_tile_lookahead(t_physical_tile_type_ptr physical_tile,
+                                                                 const t_det_routing_arch& det_routing_arch,
+                                                                 const int delayless_switch) {
     RRGraphBuilder rr_graph_builder;
     int layer = 0;
     int x = 1;
@@ -1426,10 +1568,9 @@ static void compute_tile_lookahead(std::unordered_map<int, util::t_ipin_primitiv
                                                                                       x,
                                                                                       y);
 
-    auto insert_res = inter_tile_pin_primitive_pin_delay.insert(std::make_pair(physical_tile->index, pin_delays));
-    VTR_ASSERT(insert_res.second);
-
     rr_graph_builder.clear();
+
+    return pin_delays;
 }
 
 static void store_min_cost_to_sinks(std::unordered_map<int, std::unordered_map<int, util::Cost_Entry>>& tile_min_cost,
@@ -1462,7 +1603,7 @@ static void store_min_cost_to_sinks(std::unordered_map<int, std::unordered_map<i
     VTR_ASSERT(insert_res.second);
 }
 
-static void min_global_cost_map(vtr::NdMatrix<util::Cost_Entry, 3>& internal_opin_global_cost_map) {
+static void min_global_cost_map(vtr::NdMatrix<util::Cost_Entry, 3, vtr::NdMatrixTiled<>>& internal_opin_global_cost_map) {
     int num_layers = g_vpr_ctx.device().grid.get_num_layers();
     int width = (int)g_vpr_ctx.device().grid.width();
     int height = (int)g_vpr_ctx.device().grid.height();
@@ -1474,10 +1615,10 @@ static void min_global_cost_map(vtr::NdMatrix<util::Cost_Entry, 3>& internal_opi
         for (int dx = 0; dx < width; dx++) {
             for (int dy = 0; dy < height; dy++) {
                 util::Cost_Entry min_cost(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
-                for (int chan_idx = 0; chan_idx < (int)f_wire_cost_map.dim_size(1); chan_idx++) {
-                    for (int seg_idx = 0; seg_idx < (int)f_wire_cost_map.dim_size(2); seg_idx++) {
-                        auto cost = util::Cost_Entry(f_wire_cost_map[layer_num][chan_idx][seg_idx][dx][dy].delay,
-                                                     f_wire_cost_map[layer_num][chan_idx][seg_idx][dx][dy].congestion);
+                for (int chan_idx = 0; chan_idx < (int)f_wire_cost_view.dim_size(1); chan_idx++) {
+                    for (int seg_idx = 0; seg_idx < (int)f_wire_cost_view.dim_size(2); seg_idx++) {
+                        auto cost = util::Cost_Entry(f_wire_cost_view[layer_num][chan_idx][seg_idx][dx][dy].delay,
+                                                     f_wire_cost_view[layer_num][chan_idx][seg_idx][dx][dy].congestion);
                         if (cost.delay < min_cost.delay) {
                             min_cost.delay = cost.delay;
                             min_cost.congestion = cost.congestion;
@@ -1562,11 +1703,19 @@ static std::pair<float, float> get_cost_from_src_opin(const std::map<int, util::
         "is disabled because VTR_ENABLE_CAPNPROTO=OFF." \
         "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
 
-void read_router_lookahead(const std::string& /*file*/) {
+void read_router_lookahead(const std::string& file) {
+    if (is_flat_blob_file(file)) {
+        read_router_lookahead_blob(file);
+        return;
+    }
     VPR_THROW(VPR_ERROR_PLACE, "MapLookahead::read " DISABLE_ERROR);
 }
 
 void write_router_lookahead(const std::string& file) {
+    if (is_flat_blob_file(file)) {
+        write_router_lookahead_blob(file);
+        return;
+    }
     VPR_THROW(VPR_ERROR_PLACE, "MapLookahead::write " DISABLE_ERROR);
 }
 
@@ -1751,6 +1900,11 @@ static void write_intra_cluster_router_lookahead(const std::string& file,
 }
 
 void read_router_lookahead(const std::string& file) {
+    if (is_flat_blob_file(file)) {
+        read_router_lookahead_blob(file);
+        return;
+    }
+
     vtr::ScopedStartFinishTimer timer("Loading router wire lookahead map");
     MmapFile f(file);
 
@@ -1760,16 +1914,25 @@ void read_router_lookahead(const std::string& file) {
 
     auto map = reader.getRoot<VprMapLookahead>();
 
-    ToNdMatrix<5, VprMapCostEntry, Cost_Entry>(&f_wire_cost_map, map.getCostMap(), ToCostEntry);
+    //The file holds the map in row-major order
+    vtr::NdMatrix<Cost_Entry, 5> cost_map;
+    ToNdMatrix<5, VprMapCostEntry, Cost_Entry>(&cost_map, map.getCostMap(), ToCostEntry);
+    f_wire_cost_map = t_wire_cost_map(cost_map);
+    view_wire_cost_map();
 }
 
 void write_router_lookahead(const std::string& file) {
+    if (is_flat_blob_file(file)) {
+        write_router_lookahead_blob(file);
+        return;
+    }
+
     ::capnp::MallocMessageBuilder builder;
 
     auto map = builder.initRoot<VprMapLookahead>();
 
     auto cost_map = map.initCostMap();
-    FromNdMatrix<5, VprMapCostEntry, Cost_Entry>(&cost_map, f_wire_cost_map, FromCostEntry);
+    FromNdMatrix<5, VprMapCostEntry, Cost_Entry>(&cost_map, vtr::NdMatrix<Cost_Entry, 5>(copy_wire_cost_view()), FromCostEntry);
 
     writeMessageToFile(file, &builder);
 }
@@ -10,6 +10,10 @@ class MapLookahead : public RouterLookahead {
   public:
     explicit MapLookahead(const t_det_routing_arch& det_routing_arch, bool is_flat);
 
+    // Final, so that the CommonCaseConnectionRouter calls them directly
+    float get_expected_cost(RRNodeId node, RRNodeId target_node, const t_conn_cost_params& params, float R_upstream) const final;
+    std::pair<float, float> get_expected_delay_and_cong(RRNodeId from_node, RRNodeId to_node, const t_conn_cost_params& params, float R_upstream) const final;
+
   private:
     //Look-up table from SOURCE/OPIN to CHANX/CHANY of various types
     util::t_src_opin_delays src_opin_delays;
@@ -18,7 +22,7 @@ class MapLookahead : public RouterLookahead {
     // Lookup table to store the minimum cost to reach to a primitive pin from the root-level IPINs
     std::unordered_map<int, std::unordered_map<int, util::Cost_Entry>> tile_min_cost; // [physical_tile_type][sink_physical_num] -> cost
     // Lookup table to store the minimum cost for each dx and dy
-    vtr::NdMatrix<util::Cost_Entry, 3> distance_based_min_cost; // [layer_num][dx][dy] -> cost
+    vtr::NdMatrix<util::Cost_Entry, 3, vtr::NdMatrixTiled<>> distance_based_min_cost; // [layer_num][dx][dy] -> cost
     // [tile_index][from_layer_num][to_layer_num] -> pair<seg_index, t_reachable_wire_inf>
     util::t_src_opin_inter_layer_delays src_opin_inter_layer_delays;
 
@@ -26,15 +30,13 @@ class MapLookahead : public RouterLookahead {
     bool is_flat_;
 
   protected:
-    float get_expected_cost(RRNodeId node, RRNodeId target_node, const t_conn_cost_params& params, float R_upstream) const override;
-    std::pair<float, float> get_expected_delay_and_cong(RRNodeId from_node, RRNodeId to_node, const t_conn_cost_params& params, float R_upstream) const override;
-
     void compute(const std::vector<t_segment_inf>& segment_inf) override;
     void compute_intra_tile() override;
     void read(const std::string& file) override;
     void read_intra_cluster(const std::string& file) override;
     void write(const std::string& file) const override;
     void write_intra_cluster(const std::string& file) const override;
+    size_t memory_usage() const override;
 };
 
 /* f_cost_map is an array of these cost entries that specifies delay/congestion estimates
@@ -56,8 +58,10 @@ class Cost_Entry {
 };
 
 /* provides delay/congestion estimates to travel specified distances
- * in the x/y direction */
-typedef vtr::NdMatrix<Cost_Entry, 5> t_wire_cost_map; //[0..num_layers][0..1][[0..num_seg_types-1]0..device_ctx.grid.width()-1][0..device_ctx.grid.height()-1]
+ * in the x/y direction. Stored in tiles over [dx][dy], since successive
+ * queries (of one connection, or of nearby ones) differ by small dx and dy */
+typedef vtr::NdMatrixTiled<> t_wire_cost_layout;
+typedef vtr::NdMatrix<Cost_Entry, 5, t_wire_cost_layout> t_wire_cost_map; //[0..num_layers][0..1][[0..num_seg_types-1]0..device_ctx.grid.width()-1][0..device_ctx.grid.height()-1]
                                                       //[0..1] entry distinguish between CHANX/CHANY start nodes respectively
 
 void read_router_lookahead(const std::string& file);
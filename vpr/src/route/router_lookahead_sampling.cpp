@@ -1,5 +1,9 @@
 #include "router_lookahead_sampling.h"
 
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
 #include <vector>
 
 #include "globals.h"
@@ -67,6 +71,54 @@ static std::vector<SamplePoint> choose_points(const vtr::Matrix<int>& counts,
     return points;
 }
 
+// Returns the class of identical columns (or rows, if by_row) of each column (row) of the device:
+// the columns with the same tiles, bottom to top on each layer, have the same class.
+static std::vector<int> identical_line_classes(bool by_row) {
+    auto& grid = g_vpr_ctx.device().grid;
+    size_t num_lines = by_row ? grid.height() : grid.width();
+    size_t line_length = by_row ? grid.width() : grid.height();
+
+    std::map<std::vector<int>, int> class_ids;
+    std::vector<int> classes(num_lines);
+    for (size_t i = 0; i < num_lines; i++) {
+        std::vector<int> tiles;
+        for (int layer = 0; layer < grid.get_num_layers(); layer++) {
+            for (size_t j = 0; j < line_length; j++) {
+                t_physical_tile_loc loc = by_row ? t_physical_tile_loc(j, i, layer) : t_physical_tile_loc(i, j, layer);
+                tiles.push_back(grid.get_physical_type(loc)->index);
+                tiles.push_back(by_row ? grid.get_width_offset(loc) : grid.get_height_offset(loc));
+            }
+        }
+        classes[i] = class_ids.emplace(std::move(tiles), class_ids.size()).first->second;
+    }
+    return classes;
+}
+
+// Moves the first point of each class of translation-equivalent locations (whose columns and rows
+// are identical, so they see the same tiles around them) ahead of the other points, keeping the
+// distance order within both groups.
+//
+// The expansions from the leading points then explore the distinct neighbourhoods first, and the
+// equivalent points (which mostly repeat the cost entries already found) are only reached if the
+// entries have not converged by then (see ExtendedMapLookahead::compute()).
+static void order_by_translation_class(std::vector<SamplePoint>& points,
+                                       const std::vector<int>& column_classes,
+                                       const std::vector<int>& row_classes) {
+    std::set<std::pair<int, int>> sampled_classes;
+    std::vector<SamplePoint> leading_points;
+    std::vector<SamplePoint> equivalent_points;
+    for (auto& point : points) {
+        auto point_class = std::make_pair(column_classes[point.location.x()], row_classes[point.location.y()]);
+        if (sampled_classes.insert(point_class).second) {
+            leading_points.push_back(std::move(point));
+        } else {
+            equivalent_points.push_back(std::move(point));
+        }
+    }
+    points = std::move(leading_points);
+    std::move(equivalent_points.begin(), equivalent_points.end(), std::back_inserter(points));
+}
+
 // histogram is a map from segment count to number of locations having that count
 static int quantile(const std::map<int, int>& histogram, float ratio) {
     if (histogram.empty()) {
@@ -154,6 +206,9 @@ static void compute_sample_regions(std::vector<SampleRegion>& sample_regions,
                                    std::vector<vtr::Matrix<int>>& segment_counts,
                                    std::vector<vtr::Rect<int>>& bounding_box_for_segment,
                                    int num_segments) {
+    std::vector<int> column_classes = identical_line_classes(false);
+    std::vector<int> row_classes = identical_line_classes(true);
+
     // select sample points
     for (int i = 0; i < num_segments; i++) {
         const auto& counts = segment_counts[i];
@@ -171,6 +226,8 @@ static void compute_sample_regions(std::vector<SampleRegion>& sample_regions,
                     /* .points = */ choose_points(counts, window, quantile(histogram, kSamplingCountLowerQuantile), quantile(histogram, kSamplingCountUpperQuantile)),
                     /* .order = */ 0};
                 if (!region.points.empty()) {
+                    order_by_translation_class(region.points, column_classes, row_classes);
+
                     /* In order to improve caching, the list of sample points are
                      * sorted to keep points that are nearby on the Euclidean plane also
                      * nearby in the vector of sample points.
@@ -23,7 +23,9 @@ struct SampleRegion {
 
     // locations to try
     // The computation will keep expanding each of the points
-    // until a number of paths (segment -> connection box) are found.
+    // until a number of paths (segment -> connection box) are found,
+    // or the cost entries converge. One point of each class of
+    // translation-equivalent locations comes first.
     std::vector<SamplePoint> points;
 
     // used to sort the regions to improve caching
@@ -51,6 +51,16 @@ struct RouterStats {
     size_t add_all_rt_from_high_fanout = 0;
     size_t add_high_fanout_rt = 0;
     size_t add_all_rt = 0;
+
+    // Heap item pools: peak number of live items in any single router, and
+    // the number of pooled items summed over all routers (threads)
+    size_t heap_item_high_water = 0;
+    size_t heap_item_pool_size = 0;
+
+    // Number of times the heaps rescaled (re-laid out) their items, and grew
+    // their layout (see HeapInterface::num_rescales)
+    size_t heap_rescales = 0;
+    size_t heap_expansions = 0;
 };
 
 class WirelengthInfo {
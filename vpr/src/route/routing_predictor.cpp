@@ -153,6 +153,8 @@ LinearModel fit_model(std::vector<size_t> iterations, std::vector<size_t> overus
 RoutingPredictor::RoutingPredictor(size_t min_history, float history_factor)
     : min_history_(min_history)
     , history_factor_(history_factor)
+    , first_success_iteration_estimate_(std::numeric_limits<float>::quiet_NaN())
+    , first_estimate_iteration_(0)
     , slope_(-1) {
     //nop
 }
@@ -169,11 +171,38 @@ float RoutingPredictor::estimate_success_iteration() {
             //and the intercept is before the y-axis
             success_iteration = std::numeric_limits<float>::infinity();
         }
+
+        if (std::isnan(first_success_iteration_estimate_) && std::isfinite(success_iteration)) {
+            first_success_iteration_estimate_ = success_iteration;
+            first_estimate_iteration_ = iterations_.back();
+        }
     }
 
     return success_iteration;
 }
 
+bool RoutingPredictor::is_overuse_slope_flat() {
+    if (iteration_overused_rr_node_counts_.empty() || iteration_overused_rr_node_counts_.back() == 0) {
+        return false;
+    }
+
+    float slope = estimate_overuse_slope();
+    if (std::isnan(slope)) {
+        return false; //Not enough history
+    }
+
+    //A negative slope means overuse is falling
+    return -slope < ROUTING_PREDICTOR_FLAT_SLOPE_FRACTION * iteration_overused_rr_node_counts_.back();
+}
+
+float RoutingPredictor::first_success_iteration_estimate() const {
+    return first_success_iteration_estimate_;
+}
+
+size_t RoutingPredictor::first_estimate_iteration() const {
+    return first_estimate_iteration_;
+}
+
 float RoutingPredictor::estimate_overuse_slope() {
     //We use a fixed size sliding window of history to estimate the slope
     //This makes the slope estimate more 'recent' than the values used to estimate
@@ -13,6 +13,21 @@ constexpr float ROUTING_PREDICTOR_ITERATION_ABORT_FACTOR_AGGRESSIVE = 1.5;
 // This avoids giving up when solutions are nearly legal, but converging slowly
 constexpr size_t ROUTING_PREDICTOR_MIN_ABSOLUTE_OVERUSE_THRESHOLD = 100;
 
+//The overuse slope is considered flat when overuse is predicted to fall by less
+//than this fraction of the current overuse per iteration. While it is flat the
+//predictor driven schedule grows pres_fac twice as fast
+constexpr float ROUTING_PREDICTOR_FLAT_SLOPE_FRACTION = 0.02;
+
+//Timing analysis may be skipped after iterations which re-routed less than
+//this fraction of all connections, for at most the given number of
+//consecutive iterations (net criticalities are stale while skipping)
+constexpr float ROUTING_PREDICTOR_TIMING_SKIP_CONNECTION_FRACTION = 0.05;
+constexpr int ROUTING_PREDICTOR_MAX_CONSECUTIVE_TIMING_SKIPS = 2;
+
+//History required before predicting during the minimum channel width search,
+//so that routings predicted to fail are aborted within a few iterations
+constexpr size_t ROUTING_PREDICTOR_MIN_W_SEARCH_MIN_HISTORY = 4;
+
 class RoutingPredictor {
   public:
     RoutingPredictor(size_t min_history = 8, float history_factor = 0.5);
@@ -27,10 +42,22 @@ class RoutingPredictor {
 
     float get_slope() const;
 
+    //Returns true if the overuse is predicted to fall by less than
+    //ROUTING_PREDICTOR_FLAT_SLOPE_FRACTION of its latest value per iteration
+    bool is_overuse_slope_flat();
+
+    //Returns the first (finite) estimate made by estimate_success_iteration()
+    //(NaN if none) and the number of iterations seen when it was made
+    float first_success_iteration_estimate() const;
+    size_t first_estimate_iteration() const;
+
   private:
     size_t min_history_;
     float history_factor_;
 
+    float first_success_iteration_estimate_;
+    size_t first_estimate_iteration_;
+
     std::vector<size_t> iterations_;
     std::vector<size_t> iteration_overused_rr_node_counts_;
     float slope_;
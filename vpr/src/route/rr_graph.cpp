@@ -3,6 +3,9 @@
 #include <cmath>
 #include <ctime>
 #include <algorithm>
+#include <map>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "vtr_assert.h"
@@ -36,10 +39,15 @@
 #include "rr_graph_clock.h"
 #include "edge_groups.h"
 #include "rr_graph_builder.h"
+#include "artifact_cache.h"
 
 #include "rr_types.h"
 #include "echo_files.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 //#define VERBOSE
 //used for getting the exact count of each edge type and printing it to std out.
 
@@ -79,6 +87,29 @@ struct t_pin_spec {
     RRNodeId pin_rr_node_id;
 };
 
+/**
+ * @brief The intra-cluster edges of a cluster, in terms of the pin physical numbers of its tile
+ *
+ * The internal edges (and collapsed pin chains) of a cluster only depend on its physical and logical
+ * types and on the pins it uses, i.e. on the pb modes it selects. They are thus built once for each
+ * of these, and only instantiated at the location of the other clusters using the same pins.
+ */
+struct t_intra_cluster_edge_template {
+    struct t_pin_edge {
+        int from_pin;
+        int to_pin;
+        short switch_type;
+        bool remapped;
+    };
+
+    std::vector<t_pin_edge> edges;
+    int num_collapsed_nodes = 0;
+    bool valid = true; ///<False if an edge is not between pins of the cluster, which then need their own edges
+};
+
+///@brief The key of a t_intra_cluster_edge_template: [physical type, logical block type, cluster pins]
+typedef std::tuple<t_physical_tile_type_ptr, t_logical_block_type_ptr, std::vector<int>> t_intra_cluster_edge_template_key;
+
 /******************* Variables local to this module. ***********************/
 
 /********************* Subroutines local to this module. *******************/
@@ -325,6 +356,15 @@ static void add_intra_cluster_edges_rr_graph(RRGraphBuilder& rr_graph_builder,
                                              bool is_flat,
                                              bool load_rr_graph);
 
+static t_intra_cluster_edge_template get_intra_cluster_edge_template(RRGraphBuilder& rr_graph_builder,
+                                                                     t_physical_tile_type_ptr physical_type,
+                                                                     const std::vector<int>& cluster_pins,
+                                                                     const t_rr_edge_info_set& cluster_edges,
+                                                                     int num_collapsed_nodes,
+                                                                     int layer,
+                                                                     int i,
+                                                                     int j);
+
 static void add_intra_tile_edges_rr_graph(RRGraphBuilder& rr_graph_builder,
                                           t_rr_edge_info_set& rr_edges_to_create,
                                           t_physical_tile_type_ptr physical_tile,
@@ -461,26 +501,46 @@ static float get_min_delay_to_chain(t_physical_tile_type_ptr physical_type,
 
 static std::unordered_set<int> get_chain_pins(std::vector<t_pin_chain_node> chain);
 
-static void build_rr_chan(RRGraphBuilder& rr_graph_builder,
-                          const int layer,
-                          const int i,
-                          const int j,
-                          const t_rr_type chan_type,
-                          const t_track_to_pin_lookup& track_to_pin_lookup,
-                          t_sb_connection_map* sb_conn_map,
-                          const vtr::NdMatrix<std::vector<int>, 3>& switch_block_conn,
-                          const int cost_index_offset,
-                          const t_chan_width& nodes_per_chan,
-                          const DeviceGrid& grid,
-                          const int tracks_per_chan,
-                          t_sblock_pattern& sblock_pattern,
-                          const int Fs_per_side,
-                          const t_chan_details& chan_details_x,
-                          const t_chan_details& chan_details_y,
-                          t_rr_edge_info_set& created_rr_edges,
-                          const int wire_to_ipin_switch,
-                          const int wire_to_pin_between_dice_switch,
-                          const enum e_directionality directionality);
+/**
+ * @brief Records the edges leaving the wires which start in the channel segment at (i, j) in created_rr_edges.
+ *
+ * Only reads the RR graph (and writes disjoint sblock_pattern entries for the wires of this channel), so
+ * channel segments may be processed concurrently, each with its own created_rr_edges.
+ */
+static void build_rr_chan_edges(RRGraphBuilder& rr_graph_builder,
+                                const int layer,
+                                const int i,
+                                const int j,
+                                const t_rr_type chan_type,
+                                const t_track_to_pin_lookup& track_to_pin_lookup,
+                                t_sb_connection_map* sb_conn_map,
+                                const vtr::NdMatrix<std::vector<int>, 3>& switch_block_conn,
+                                const t_chan_width& nodes_per_chan,
+                                const DeviceGrid& grid,
+                                const int tracks_per_chan,
+                                t_sblock_pattern& sblock_pattern,
+                                const int Fs_per_side,
+                                const t_chan_details& chan_details_x,
+                                const t_chan_details& chan_details_y,
+                                t_rr_edge_info_set& created_rr_edges,
+                                const int wire_to_ipin_switch,
+                                const int wire_to_pin_between_dice_switch,
+                                const enum e_directionality directionality);
+
+/**
+ * @brief Sets the properties (cost index, coordinates, RC data...) of the wires which start in the channel segment at (i, j).
+ *
+ * Not thread safe, since RC data is shared between nodes.
+ */
+static void load_rr_chan_nodes(RRGraphBuilder& rr_graph_builder,
+                               const int layer,
+                               const int i,
+                               const int j,
+                               const t_rr_type chan_type,
+                               const int cost_index_offset,
+                               const int tracks_per_chan,
+                               const t_chan_details& chan_details_x,
+                               const t_chan_details& chan_details_y);
 
 void uniquify_edges(t_rr_edge_info_set& rr_edges_to_create);
 
@@ -655,6 +715,13 @@ static void build_intra_cluster_rr_graph(const t_graph_type graph_type,
                                          bool is_flat,
                                          bool load_rr_graph);
 
+/* Returns the artifact cache file of the RR graph built from these options, or an empty string if not caching */
+static std::string get_rr_graph_cache_file(const t_graph_type graph_type,
+                                           const DeviceGrid& grid,
+                                           const t_chan_width& nodes_per_chan,
+                                           const t_det_routing_arch& det_routing_arch,
+                                           const t_router_opts& router_opts);
+
 /******************* Subroutine definitions *******************************/
 
 void create_rr_graph(const t_graph_type graph_type,
@@ -673,6 +740,10 @@ void create_rr_graph(const t_graph_type graph_type,
     bool echo_enabled = getEchoEnabled() && isEchoFileEnabled(E_ECHO_RR_GRAPH_INDEXED_DATA);
     const char* echo_file_name = getEchoFileName(E_ECHO_RR_GRAPH_INDEXED_DATA);
     bool load_rr_graph = !det_routing_arch->read_rr_graph_filename.empty();
+    std::string cache_file;
+    if (!load_rr_graph) {
+        cache_file = get_rr_graph_cache_file(graph_type, grid, nodes_per_chan, *det_routing_arch, router_opts);
+    }
 
     if (channel_widths_unchanged(device_ctx.chan_width, nodes_per_chan) && !device_ctx.rr_graph.empty()) {
         //No change in channel width, so skip re-building RR graph
@@ -705,6 +776,7 @@ void create_rr_graph(const t_graph_type graph_type,
                              det_routing_arch->read_rr_graph_filename.c_str(),
                              &det_routing_arch->read_rr_graph_filename,
                              router_opts.read_rr_edge_metadata,
+                             router_opts.attach_rr_graph,
                              router_opts.do_check_rr_graph,
                              echo_enabled,
                              echo_file_name,
@@ -715,6 +787,37 @@ void create_rr_graph(const t_graph_type graph_type,
                                                                       router_opts.reorder_rr_graph_nodes_seed);
                 }
             }
+        } else if (!cache_file.empty() && artifact_cache_contains(cache_file)) {
+            free_rr_graph();
+
+            //Load the previously built graph from the artifact cache. Edge metadata is always
+            //read and nodes are not reordered, so the graph matches the one that was built.
+            VTR_LOG("Loading RR graph from artifact cache '%s'\n", cache_file.c_str());
+            std::string loaded_rr_graph_filename;
+            load_rr_file(&mutable_device_ctx.rr_graph_builder,
+                         &mutable_device_ctx.rr_graph,
+                         device_ctx.physical_tile_types,
+                         segment_inf,
+                         &mutable_device_ctx.rr_indexed_data,
+                         &mutable_device_ctx.rr_rc_data,
+                         grid,
+                         device_ctx.arch_switch_inf,
+                         graph_type,
+                         device_ctx.arch,
+                         &mutable_device_ctx.chan_width,
+                         router_opts.base_cost_type,
+                         device_ctx.virtual_clock_network_root_idx,
+                         &det_routing_arch->wire_to_rr_ipin_switch,
+                         &det_routing_arch->wire_to_arch_ipin_switch_between_dice,
+                         cache_file.c_str(),
+                         &loaded_rr_graph_filename,
+                         /*read_edge_metadata=*/true,
+                         router_opts.attach_rr_graph,
+                         router_opts.do_check_rr_graph,
+                         echo_enabled,
+                         echo_file_name,
+                         is_flat);
+            load_rr_graph = true;
         } else {
             free_rr_graph();
             build_rr_graph(graph_type,
@@ -737,6 +840,26 @@ void create_rr_graph(const t_graph_type graph_type,
                            &det_routing_arch->wire_to_rr_ipin_switch,
                            is_flat,
                            Warnings);
+
+            if (!cache_file.empty()) {
+                artifact_cache_store(cache_file, [&](const std::string& file) {
+                    write_rr_graph(&mutable_device_ctx.rr_graph_builder,
+                                   &mutable_device_ctx.rr_graph,
+                                   device_ctx.physical_tile_types,
+                                   &mutable_device_ctx.rr_indexed_data,
+                                   &mutable_device_ctx.rr_rc_data,
+                                   grid,
+                                   device_ctx.arch_switch_inf,
+                                   device_ctx.arch,
+                                   &mutable_device_ctx.chan_width,
+                                   file.c_str(),
+                                   device_ctx.virtual_clock_network_root_idx,
+                                   /*echo_enabled=*/false,
+                                   echo_file_name,
+                                   /*is_flat=*/false,
+                                   /*is_checked=*/true); //build_rr_graph() always checks the graph
+                });
+            }
         }
     }
 
@@ -763,6 +886,9 @@ void create_rr_graph(const t_graph_type graph_type,
 
     process_non_config_sets();
 
+    //The graph is complete: flatten the node look-up, which the rest of the flow only queries
+    mutable_device_ctx.rr_graph_builder.node_lookup().compact();
+
     verify_rr_node_indices(grid,
                            device_ctx.rr_graph,
                            device_ctx.rr_indexed_data,
@@ -789,10 +915,31 @@ void create_rr_graph(const t_graph_type graph_type,
                        device_ctx.virtual_clock_network_root_idx,
                        echo_enabled,
                        echo_file_name,
-                       is_flat);
+                       is_flat,
+                       /*is_checked=*/!load_rr_graph || router_opts.do_check_rr_graph);
     }
 }
 
+static std::string get_rr_graph_cache_file(const t_graph_type graph_type,
+                                           const DeviceGrid& grid,
+                                           const t_chan_width& nodes_per_chan,
+                                           const t_det_routing_arch& det_routing_arch,
+                                           const t_router_opts& router_opts) {
+    if (det_routing_arch.artifact_cache_dir.empty()) {
+        return std::string();
+    }
+
+    //The native flat binary format is the fastest to load
+    ArtifactKey key(det_routing_arch.artifact_cache_dir, "rr_graph", ".blob");
+    key.add_device(grid, nodes_per_chan)
+        .add("graph_type", int(graph_type))
+        .add("switch_block_type", int(det_routing_arch.switch_block_type))
+        .add("Fs", det_routing_arch.Fs)
+        .add("base_cost_type", int(router_opts.base_cost_type))
+        .add("clock_modeling", int(router_opts.clock_modeling));
+    return key.path();
+}
+
 static void add_intra_cluster_edges_rr_graph(RRGraphBuilder& rr_graph_builder,
                                              t_rr_edge_info_set& rr_edges_to_create,
                                              const DeviceGrid& grid,
@@ -808,33 +955,105 @@ static void add_intra_cluster_edges_rr_graph(RRGraphBuilder& rr_graph_builder,
     auto& place_ctx = g_vpr_ctx.placement();
     auto& cluster_net_list = g_vpr_ctx.clustering().clb_nlist;
     int num_collapsed_nodes = 0;
+    int num_instantiated_clusters = 0;
+    std::map<t_intra_cluster_edge_template_key, t_intra_cluster_edge_template> edge_templates;
     for (auto cluster_blk_id : cluster_net_list.blocks()) {
         auto block_loc = place_ctx.block_locs[cluster_blk_id].loc;
         int i = block_loc.x;
         int j = block_loc.y;
         int layer = block_loc.layer;
         int abs_cap = block_loc.sub_tile;
-        build_cluster_internal_edges(rr_graph_builder,
-                                     num_collapsed_nodes,
-                                     cluster_blk_id,
-                                     layer,
-                                     i,
-                                     j,
-                                     abs_cap,
-                                     R_minW_nmos,
-                                     R_minW_pmos,
-                                     rr_edges_to_create,
-                                     nodes_to_collapse[cluster_blk_id],
-                                     grid,
-                                     is_flat,
-                                     load_rr_graph);
-        uniquify_edges(rr_edges_to_create);
+
+        t_physical_tile_type_ptr physical_type;
+        t_logical_block_type_ptr logical_block;
+        std::tie(physical_type, std::ignore, std::ignore, logical_block) = get_cluster_blk_physical_spec(cluster_blk_id);
+        t_intra_cluster_edge_template_key key(physical_type,
+                                              logical_block,
+                                              get_cluster_block_pins(physical_type, cluster_blk_id, abs_cap));
+
+        auto template_it = edge_templates.find(key);
+        if (template_it != edge_templates.end() && template_it->second.valid) {
+            // Same pins as an already built cluster: instantiate its edges at this location
+            for (const auto& edge : template_it->second.edges) {
+                RRNodeId from_node = get_pin_rr_node_id(rr_graph_builder.node_lookup(), physical_type, layer, i, j, edge.from_pin);
+                RRNodeId to_node = get_pin_rr_node_id(rr_graph_builder.node_lookup(), physical_type, layer, i, j, edge.to_pin);
+                VTR_ASSERT(from_node != RRNodeId::INVALID() && to_node != RRNodeId::INVALID());
+                rr_edges_to_create.emplace_back(from_node, to_node, edge.switch_type, edge.remapped);
+            }
+            num_collapsed_nodes += template_it->second.num_collapsed_nodes;
+            ++num_instantiated_clusters;
+            uniquify_edges(rr_edges_to_create);
+        } else {
+            int num_cluster_collapsed_nodes = 0;
+            build_cluster_internal_edges(rr_graph_builder,
+                                         num_cluster_collapsed_nodes,
+                                         cluster_blk_id,
+                                         layer,
+                                         i,
+                                         j,
+                                         abs_cap,
+                                         R_minW_nmos,
+                                         R_minW_pmos,
+                                         rr_edges_to_create,
+                                         nodes_to_collapse[cluster_blk_id],
+                                         grid,
+                                         is_flat,
+                                         load_rr_graph);
+            num_collapsed_nodes += num_cluster_collapsed_nodes;
+            uniquify_edges(rr_edges_to_create);
+            if (template_it == edge_templates.end()) {
+                auto edge_template = get_intra_cluster_edge_template(rr_graph_builder,
+                                                                     physical_type,
+                                                                     std::get<2>(key),
+                                                                     rr_edges_to_create,
+                                                                     num_cluster_collapsed_nodes,
+                                                                     layer,
+                                                                     i,
+                                                                     j);
+                edge_templates.emplace(std::move(key), std::move(edge_template));
+            }
+        }
         alloc_and_load_edges(rr_graph_builder, rr_edges_to_create);
         num_edges += rr_edges_to_create.size();
         rr_edges_to_create.clear();
     }
 
     VTR_LOG("Number of collapsed nodes: %d\n", num_collapsed_nodes);
+    VTR_LOG("Intra-cluster edges built for %zu distinct clusters, and instantiated for %d clusters\n",
+            edge_templates.size(), num_instantiated_clusters);
+}
+
+static t_intra_cluster_edge_template get_intra_cluster_edge_template(RRGraphBuilder& rr_graph_builder,
+                                                                     t_physical_tile_type_ptr physical_type,
+                                                                     const std::vector<int>& cluster_pins,
+                                                                     const t_rr_edge_info_set& cluster_edges,
+                                                                     int num_collapsed_nodes,
+                                                                     int layer,
+                                                                     int i,
+                                                                     int j) {
+    t_intra_cluster_edge_template edge_template;
+    edge_template.num_collapsed_nodes = num_collapsed_nodes;
+
+    std::unordered_map<RRNodeId, int> node_pins;
+    for (int pin_physical_num : cluster_pins) {
+        RRNodeId node_id = get_pin_rr_node_id(rr_graph_builder.node_lookup(), physical_type, layer, i, j, pin_physical_num);
+        if (node_id != RRNodeId::INVALID()) {
+            node_pins.insert(std::make_pair(node_id, pin_physical_num));
+        }
+    }
+
+    edge_template.edges.reserve(cluster_edges.size());
+    for (const auto& edge : cluster_edges) {
+        auto from_it = node_pins.find(edge.from_node);
+        auto to_it = node_pins.find(edge.to_node);
+        if (from_it == node_pins.end() || to_it == node_pins.end()) {
+            edge_template.valid = false;
+            edge_template.edges.clear();
+            break;
+        }
+        edge_template.edges.push_back({from_it->second, to_it->second, edge.switch_type, edge.remapped});
+    }
+    return edge_template;
 }
 
 static void add_intra_tile_edges_rr_graph(RRGraphBuilder& rr_graph_builder,
@@ -2117,46 +2336,73 @@ static std::function<void(t_chan_width*)> alloc_and_load_rr_graph(RRGraphBuilder
         if (!device_ctx.inter_cluster_prog_routing_resources.at(layer)) {
             continue;
         }
-        for (size_t i = 0; i < grid.width() - 1; ++i) {
-            for (size_t j = 0; j < grid.height() - 1; ++j) {
-                if (i > 0) {
-                    int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.x_list[j]);
-                    build_rr_chan(rr_graph_builder, layer, i, j, CHANX, track_to_pin_lookup_x, sb_conn_map, switch_block_conn,
-                                  CHANX_COST_INDEX_START,
-                                  chan_width, grid, tracks_per_chan,
-                                  sblock_pattern, Fs / 3, chan_details_x, chan_details_y,
-                                  rr_edges_to_create,
-                                  wire_to_ipin_switch,
-                                  wire_to_pin_between_dice_switch,
-                                  directionality);
 
-                    //Create the actual CHAN->CHAN edges
-                    uniquify_edges(rr_edges_to_create);
-                    alloc_and_load_edges(rr_graph_builder, rr_edges_to_create);
-                    num_edges += rr_edges_to_create.size();
+        auto build_chan_edges = [&](size_t i, size_t j, t_rr_type chan_type, t_rr_edge_info_set& chan_edges) {
+            int tracks_per_chan = ((is_global_graph) ? 1 : (chan_type == CHANX ? chan_width.x_list[j] : chan_width.y_list[i]));
+            build_rr_chan_edges(rr_graph_builder, layer, i, j, chan_type,
+                                (chan_type == CHANX) ? track_to_pin_lookup_x : track_to_pin_lookup_y,
+                                sb_conn_map, switch_block_conn,
+                                chan_width, grid, tracks_per_chan,
+                                sblock_pattern, Fs / 3, chan_details_x, chan_details_y,
+                                chan_edges,
+                                wire_to_ipin_switch,
+                                wire_to_pin_between_dice_switch,
+                                directionality);
+            uniquify_edges(chan_edges);
+        };
 
-                    rr_edges_to_create.clear();
+        auto load_chan = [&](size_t i, size_t j, t_rr_type chan_type, t_rr_edge_info_set& chan_edges) {
+            int tracks_per_chan = ((is_global_graph) ? 1 : (chan_type == CHANX ? chan_width.x_list[j] : chan_width.y_list[i]));
+            int cost_index_offset = (chan_type == CHANX) ? CHANX_COST_INDEX_START : CHANX_COST_INDEX_START + num_seg_types_x;
+            load_rr_chan_nodes(rr_graph_builder, layer, i, j, chan_type, cost_index_offset,
+                               tracks_per_chan, chan_details_x, chan_details_y);
+
+            //Create the actual CHAN->CHAN edges
+            alloc_and_load_edges(rr_graph_builder, chan_edges);
+            num_edges += chan_edges.size();
+            chan_edges.clear();
+        };
+
+#ifdef VPR_USE_TBB
+        //The edges of each channel segment in a column are generated (and uniquified) concurrently into
+        //per-segment buffers. Nodes and edges are then loaded serially, in the same order as a serial
+        //build, so the resulting RR graph is identical. Going column by column bounds the extra memory
+        //held in the buffers.
+        std::vector<t_rr_edge_info_set> chanx_edges(grid.height() - 1);
+        std::vector<t_rr_edge_info_set> chany_edges(grid.height() - 1);
+        for (size_t i = 0; i < grid.width() - 1; ++i) {
+            tbb::parallel_for(size_t(0), grid.height() - 1, [&](size_t j) {
+                if (i > 0) {
+                    build_chan_edges(i, j, CHANX, chanx_edges[j]);
                 }
                 if (j > 0) {
-                    int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.y_list[i]);
-                    build_rr_chan(rr_graph_builder, layer, i, j, CHANY, track_to_pin_lookup_y, sb_conn_map, switch_block_conn,
-                                  CHANX_COST_INDEX_START + num_seg_types_x,
-                                  chan_width, grid, tracks_per_chan,
-                                  sblock_pattern, Fs / 3, chan_details_x, chan_details_y,
-                                  rr_edges_to_create,
-                                  wire_to_ipin_switch,
-                                  wire_to_pin_between_dice_switch,
-                                  directionality);
-
-                    //Create the actual CHAN->CHAN edges
-                    uniquify_edges(rr_edges_to_create);
-                    alloc_and_load_edges(rr_graph_builder, rr_edges_to_create);
-                    num_edges += rr_edges_to_create.size();
+                    build_chan_edges(i, j, CHANY, chany_edges[j]);
+                }
+            });
 
-                    rr_edges_to_create.clear();
+            for (size_t j = 0; j < grid.height() - 1; ++j) {
+                if (i > 0) {
+                    load_chan(i, j, CHANX, chanx_edges[j]);
+                }
+                if (j > 0) {
+                    load_chan(i, j, CHANY, chany_edges[j]);
+                }
+            }
+        }
+#else
+        for (size_t i = 0; i < grid.width() - 1; ++i) {
+            for (size_t j = 0; j < grid.height() - 1; ++j) {
+                if (i > 0) {
+                    build_chan_edges(i, j, CHANX, rr_edges_to_create);
+                    load_chan(i, j, CHANX, rr_edges_to_create);
+                }
+                if (j > 0) {
+                    build_chan_edges(i, j, CHANY, rr_edges_to_create);
+                    load_chan(i, j, CHANY, rr_edges_to_create);
                 }
             }
         }
+#endif
     }
     VTR_LOG("CHAN->CHAN type edge count:%d\n", num_edges);
     num_edges = 0;
@@ -2236,12 +2482,22 @@ static void alloc_and_load_intra_cluster_rr_graph(RRGraphBuilder& rr_graph_build
                                                   bool load_rr_graph) {
     t_rr_edge_info_set rr_edges_to_create;
     int num_edges = 0;
+    int num_tiles = 0;
+    int num_occupied_tiles = 0;
 
     for (int layer = 0; layer < grid.get_num_layers(); layer++) {
         for (int i = 0; i < (int)grid.width(); ++i) {
             for (int j = 0; j < (int)grid.height(); ++j) {
                 if (grid.get_width_offset({i, j, layer}) == 0 && grid.get_height_offset({i, j, layer}) == 0) {
                     t_physical_tile_type_ptr physical_tile = grid.get_physical_type({i, j, layer});
+                    ++num_tiles;
+                    //Intra-cluster resources are only materialized for the clusters placed in a tile
+                    //(and the pb modes they use), so there is nothing to add for unoccupied tiles
+                    if (is_tile_unoccupied(layer, i, j, physical_tile)) {
+                        continue;
+                    }
+                    ++num_occupied_tiles;
+
                     std::vector<int> class_num_vec;
                     std::vector<int> pin_num_vec;
                     class_num_vec = get_cluster_netlist_intra_tile_classes_at_loc(layer, i, j, physical_tile);
@@ -2284,6 +2540,7 @@ static void alloc_and_load_intra_cluster_rr_graph(RRGraphBuilder& rr_graph_build
         }
     }
 
+    VTR_LOG("Intra-cluster resources added for %d of %d tiles\n", num_occupied_tiles, num_tiles);
     VTR_LOG("Internal SOURCE->OPIN and IPIN->SINK edge count:%d\n", num_edges);
     num_edges = 0;
     {
@@ -3022,33 +3279,30 @@ static std::unordered_set<int> get_chain_pins(std::vector<t_pin_chain_node> chai
     return chain_pins;
 }
 
-/* Allocates/loads edges for nodes belonging to specified channel segment and initializes
- * node properties such as cost, occupancy and capacity */
-static void build_rr_chan(RRGraphBuilder& rr_graph_builder,
-                          const int layer,
-                          const int x_coord,
-                          const int y_coord,
-                          const t_rr_type chan_type,
-                          const t_track_to_pin_lookup& track_to_pin_lookup,
-                          t_sb_connection_map* sb_conn_map,
-                          const vtr::NdMatrix<std::vector<int>, 3>& switch_block_conn,
-                          const int cost_index_offset,
-                          const t_chan_width& nodes_per_chan,
-                          const DeviceGrid& grid,
-                          const int tracks_per_chan,
-                          t_sblock_pattern& sblock_pattern,
-                          const int Fs_per_side,
-                          const t_chan_details& chan_details_x,
-                          const t_chan_details& chan_details_y,
-                          t_rr_edge_info_set& rr_edges_to_create,
-                          const int wire_to_ipin_switch,
-                          const int wire_to_pin_between_dice_switch,
-                          const enum e_directionality directionality) {
+/* Collects the edges of the nodes belonging to specified channel segment */
+static void build_rr_chan_edges(RRGraphBuilder& rr_graph_builder,
+                                const int layer,
+                                const int x_coord,
+                                const int y_coord,
+                                const t_rr_type chan_type,
+                                const t_track_to_pin_lookup& track_to_pin_lookup,
+                                t_sb_connection_map* sb_conn_map,
+                                const vtr::NdMatrix<std::vector<int>, 3>& switch_block_conn,
+                                const t_chan_width& nodes_per_chan,
+                                const DeviceGrid& grid,
+                                const int tracks_per_chan,
+                                t_sblock_pattern& sblock_pattern,
+                                const int Fs_per_side,
+                                const t_chan_details& chan_details_x,
+                                const t_chan_details& chan_details_y,
+                                t_rr_edge_info_set& rr_edges_to_create,
+                                const int wire_to_ipin_switch,
+                                const int wire_to_pin_between_dice_switch,
+                                const enum e_directionality directionality) {
     /* this function builds both x and y-directed channel segments, so set up our
      * coordinates based on channel type */
 
     auto& device_ctx = g_vpr_ctx.device();
-    auto& mutable_device_ctx = g_vpr_ctx.mutable_device();
 
     //Initally assumes CHANX
     int seg_coord = x_coord;                           //The absolute coordinate of this segment within the channel
@@ -3182,8 +3436,55 @@ static void build_rr_chan(RRGraphBuilder& rr_graph_builder,
                 }
             }
         }
+    }
+}
+
+/* Initializes node properties such as cost, occupancy and capacity of the nodes
+ * belonging to specified channel segment */
+static void load_rr_chan_nodes(RRGraphBuilder& rr_graph_builder,
+                               const int layer,
+                               const int x_coord,
+                               const int y_coord,
+                               const t_rr_type chan_type,
+                               const int cost_index_offset,
+                               const int tracks_per_chan,
+                               const t_chan_details& chan_details_x,
+                               const t_chan_details& chan_details_y) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& mutable_device_ctx = g_vpr_ctx.mutable_device();
+
+    //Initally assumes CHANX
+    int seg_coord = x_coord;                           //The absolute coordinate of this segment within the channel
+    int chan_coord = y_coord;                          //The absolute coordinate of this channel within the device
+    int seg_dimension = device_ctx.grid.width() - 2;   //-2 for no perim channels
+    int chan_dimension = device_ctx.grid.height() - 2; //-2 for no perim channels
+    const t_chan_details& from_chan_details = (chan_type == CHANX) ? chan_details_x : chan_details_y;
+    if (chan_type == CHANY) {
+        //Swap values since CHANX was assumed above
+        std::swap(seg_coord, chan_coord);
+        std::swap(seg_dimension, chan_dimension);
+    }
+
+    const t_chan_seg_details* seg_details = from_chan_details[x_coord][y_coord].data();
+
+    /* Loads up all the routing resource nodes in the current channel segment */
+    for (int track = 0; track < tracks_per_chan; ++track) {
+        if (seg_details[track].length() == 0)
+            continue;
+
+        int start = get_seg_start(seg_details, track, chan_coord, seg_coord);
+        int end = get_seg_end(seg_details, track, start, chan_coord, seg_dimension);
+
+        if (seg_coord > start)
+            continue; /* Only process segments which start at this location */
+        VTR_ASSERT(seg_coord == start);
+
+        RRNodeId node = rr_graph_builder.node_lookup().find_node(layer, x_coord, y_coord, chan_type, track);
+
+        if (!node) {
+            continue;
+        }
 
-        /* Edge arrays have now been built up.  Do everything else.  */
         /* AA: The cost_index should be w.r.t the index of the segment to its **parallel** 
          * segment_inf vector. Note that when building channels, we use the indices
          * w.r.t segment_inf_x and segment_inf_y as computed earlier in 
@@ -4034,6 +4335,10 @@ static void build_unidir_rr_opins(RRGraphBuilder& rr_graph_builder,
     int width_offset = grid.get_width_offset({i, j, layer});
     int height_offset = grid.get_height_offset({i, j, layer});
 
+    /* All the pins on this side connect to the same chan seg, so the wire muxes of each
+     * segment type are labelled for the first pin and reused for the others. */
+    std::vector<t_opin_wire_muxes> seg_wire_muxes(num_seg_types);
+
     /* Go through each pin and find its fanout. */
     for (int pin_index = 0; pin_index < type->num_pins; ++pin_index) {
         /* Skip global pins and pins that are not of DRIVER type */
@@ -4103,13 +4408,19 @@ static void build_unidir_rr_opins(RRGraphBuilder& rr_graph_builder,
             /* Get the list of opin to mux connections for that chan seg. */
             bool clipped;
 
+            t_opin_wire_muxes& wire_muxes = seg_wire_muxes[iseg];
+            if (!wire_muxes.is_loaded) {
+                load_opin_wire_muxes(chan, seg, seg_index, chan_type, seg_details, max_len, nodes_per_chan, wire_muxes);
+            }
+
             for (auto connected_layer : get_layers_pin_is_connected_to(type, layer, pin_index)) {
                 /* Check the pin physical layer and connect it to the same layer if necessary */
                 rr_edge_count += get_unidir_opin_connections(rr_graph_builder, layer, connected_layer, chan, seg,
                                                              seg_type_Fc, seg_index, chan_type, seg_details,
+                                                             wire_muxes,
                                                              opin_node_index,
                                                              rr_edges_to_create,
-                                                             Fc_ofs, max_len, nodes_per_chan,
+                                                             Fc_ofs,
                                                              &clipped);
             }
 
@@ -760,6 +760,31 @@ int get_bidir_opin_connections(RRGraphBuilder& rr_graph_builder,
  *
  * 
  */
+void load_opin_wire_muxes(const int chan,
+                          const int seg,
+                          const int seg_type_index,
+                          const t_rr_type chan_type,
+                          const t_chan_seg_details* seg_details,
+                          const int max_len,
+                          const t_chan_width& nodes_per_chan,
+                          t_opin_wire_muxes& wire_muxes) {
+    /* Labels the muxes of the specified seg_type_index that OPINs can drive in
+     * the given chan seg, for get_unidir_opin_connections. */
+
+    int x = ((CHANX == chan_type) ? seg : chan);
+    int y = ((CHANX == chan_type) ? chan : seg);
+
+    int num_muxes, dummy;
+    /* AA: Determine the channel width instead of using max channels to not create hanging nodes*/
+    int max_chan_width = (CHANX == chan_type) ? nodes_per_chan.x_list[y] : nodes_per_chan.y_list[x];
+
+    label_wire_muxes(chan, seg, seg_details, seg_type_index, max_len,
+                     Direction::INC, max_chan_width, true, wire_muxes.inc_muxes, &num_muxes, &dummy);
+    label_wire_muxes(chan, seg, seg_details, seg_type_index, max_len,
+                     Direction::DEC, max_chan_width, true, wire_muxes.dec_muxes, &num_muxes, &dummy);
+    wire_muxes.is_loaded = true;
+}
+
 int get_unidir_opin_connections(RRGraphBuilder& rr_graph_builder,
                                 const int opin_layer,
                                 const int track_layer,
@@ -769,14 +794,15 @@ int get_unidir_opin_connections(RRGraphBuilder& rr_graph_builder,
                                 const int seg_type_index,
                                 const t_rr_type chan_type,
                                 const t_chan_seg_details* seg_details,
+                                const t_opin_wire_muxes& wire_muxes,
                                 RRNodeId from_rr_node,
                                 t_rr_edge_info_set& rr_edges_to_create,
                                 vtr::NdMatrix<int, 3>& Fc_ofs,
-                                const int max_len,
-                                const t_chan_width& nodes_per_chan,
                                 bool* Fc_clipped) {
     /* Gets a linked list of Fc nodes of specified seg_type_index to connect
-     * to in given chan seg. Fc_ofs is used for the opin staggering pattern. */
+     * to in given chan seg. Fc_ofs is used for the opin staggering pattern.
+     * wire_muxes are the muxes of seg_type_index in this chan seg, as loaded
+     * by load_opin_wire_muxes. */
 
     int num_inc_muxes, num_dec_muxes, iconn;
     int inc_mux, dec_mux;
@@ -794,16 +820,11 @@ int get_unidir_opin_connections(RRGraphBuilder& rr_graph_builder,
     y = ((CHANX == chan_type) ? chan : seg);
 
     /* Get the lists of possible muxes. */
-    int dummy;
-    std::vector<int> inc_muxes;
-    std::vector<int> dec_muxes;
-    /* AA: Determine the channel width instead of using max channels to not create hanging nodes*/
-    int max_chan_width = (CHANX == chan_type) ? nodes_per_chan.x_list[y] : nodes_per_chan.y_list[x];
-
-    label_wire_muxes(chan, seg, seg_details, seg_type_index, max_len,
-                     Direction::INC, max_chan_width, true, inc_muxes, &num_inc_muxes, &dummy);
-    label_wire_muxes(chan, seg, seg_details, seg_type_index, max_len,
-                     Direction::DEC, max_chan_width, true, dec_muxes, &num_dec_muxes, &dummy);
+    VTR_ASSERT(wire_muxes.is_loaded);
+    const std::vector<int>& inc_muxes = wire_muxes.inc_muxes;
+    const std::vector<int>& dec_muxes = wire_muxes.dec_muxes;
+    num_inc_muxes = inc_muxes.size();
+    num_dec_muxes = dec_muxes.size();
 
     /* Clip Fc to the number of muxes. */
     if (((Fc / 2) > num_inc_muxes) || ((Fc / 2) > num_dec_muxes)) {
@@ -1378,6 +1399,9 @@ void alloc_and_load_intra_cluster_rr_node_indices(RRGraphBuilder& rr_graph_build
                 //Process each block from it's root location
                 if (grid.get_width_offset({x, y, layer}) == 0 && grid.get_height_offset({x, y, layer}) == 0) {
                     t_physical_tile_type_ptr physical_type = grid.get_physical_type({x, y, layer});
+                    if (is_tile_unoccupied(layer, x, y, physical_type)) {
+                        continue;
+                    }
                     //Assign indices for SINKs and SOURCEs
                     // Note that SINKS/SOURCES have no side, so we always use side 0
                     std::vector<int> class_num_vec;
@@ -2049,10 +2073,11 @@ static int get_track_to_chan_seg(RRGraphBuilder& rr_graph_builder,
 
     /* get coordinate to index into the SB map */
     Switchblock_Lookup sb_coord(tile_x, tile_y, from_side, to_side);
-    if (sb_conn_map->count(sb_coord) > 0) {
+    auto sb_conns = sb_conn_map->find(sb_coord);
+    if (sb_conns != sb_conn_map->end()) {
         /* get reference to the connections vector which lists all destination wires for a given source wire
-         * at a specific coordinate sb_coord */
-        std::vector<t_switchblock_edge>& conn_vector = (*sb_conn_map)[sb_coord];
+         * at a specific coordinate sb_coord (looked up without inserting, since channels may be built concurrently) */
+        const std::vector<t_switchblock_edge>& conn_vector = sb_conns->second;
 
         /* go through the connections... */
         for (int iconn = 0; iconn < (int)conn_vector.size(); ++iconn) {
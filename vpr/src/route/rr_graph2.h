@@ -19,6 +19,15 @@
  * originally initialized to UN_SET until alloc_and_load_sb is called */
 typedef vtr::NdMatrix<short, 6> t_sblock_pattern;
 
+/* The wire muxes (tracks) of one segment type which OPINs can drive in a channel segment,
+ * in each direction. They are the same for every OPIN connecting to that channel segment,
+ * so they are labelled once (by load_opin_wire_muxes) and reused for all of them. */
+struct t_opin_wire_muxes {
+    bool is_loaded = false;
+    std::vector<int> inc_muxes;
+    std::vector<int> dec_muxes;
+};
+
 /******************* Subroutines exported by rr_graph2.c *********************/
 
 void alloc_and_load_rr_node_indices(RRGraphBuilder& rr_graph_builder,
@@ -137,6 +146,15 @@ int get_bidir_opin_connections(RRGraphBuilder& rr_graph_builder,
                                const t_chan_details& chan_details_x,
                                const t_chan_details& chan_details_y);
 
+void load_opin_wire_muxes(const int chan,
+                          const int seg,
+                          const int seg_type_index,
+                          const t_rr_type chan_type,
+                          const t_chan_seg_details* seg_details,
+                          const int max_len,
+                          const t_chan_width& nodes_per_chan,
+                          t_opin_wire_muxes& wire_muxes);
+
 int get_unidir_opin_connections(RRGraphBuilder& rr_graph_builder,
                                 const int opin_layer,
                                 const int track_layer,
@@ -146,11 +164,10 @@ int get_unidir_opin_connections(RRGraphBuilder& rr_graph_builder,
                                 const int seg_type_index,
                                 const t_rr_type chan_type,
                                 const t_chan_seg_details* seg_details,
+                                const t_opin_wire_muxes& wire_muxes,
                                 RRNodeId from_rr_node,
                                 t_rr_edge_info_set& rr_edges_to_create,
                                 vtr::NdMatrix<int, 3>& Fc_ofs,
-                                const int max_len,
-                                const t_chan_width& nodes_per_chan,
                                 bool* Fc_clipped);
 
 int get_track_to_pins(RRGraphBuilder& rr_graph_builder,
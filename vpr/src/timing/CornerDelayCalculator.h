@@ -0,0 +1,78 @@
+#ifndef VPR_CORNER_DELAY_CALCULATOR_H
+#define VPR_CORNER_DELAY_CALCULATOR_H
+
+#include <cmath>
+
+#include "tatum/Time.hpp"
+#include "tatum/TimingGraph.hpp"
+#include "tatum/delay_calc/DelayCalculator.hpp"
+#include "tatum/util/tatum_linear_map.hpp"
+
+#include "vpr_types.h"
+
+//The nominal delays of every (enabled) timing graph edge, recorded once from another delay
+//calculator so they can be shared by the delay calculators of several timing corners.
+//
+//Clock capture edges record their setup and hold times as their max and min delays.
+class NominalEdgeDelays {
+  public:
+    NominalEdgeDelays(const tatum::TimingGraph& tg, const tatum::DelayCalculator& delay_calc)
+        : max_delays_(tg.edges().size(), tatum::Time(NAN))
+        , min_delays_(tg.edges().size(), tatum::Time(NAN)) {
+        for (tatum::EdgeId edge : tg.edges()) {
+            if (tg.edge_disabled(edge)) continue;
+
+            if (tg.edge_type(edge) == tatum::EdgeType::PRIMITIVE_CLOCK_CAPTURE) {
+                max_delays_[edge] = delay_calc.setup_time(tg, edge);
+                min_delays_[edge] = delay_calc.hold_time(tg, edge);
+            } else {
+                max_delays_[edge] = delay_calc.max_edge_delay(tg, edge);
+                min_delays_[edge] = delay_calc.min_edge_delay(tg, edge);
+            }
+        }
+    }
+
+    tatum::Time max_delay(tatum::EdgeId edge) const { return max_delays_[edge]; }
+    tatum::Time min_delay(tatum::EdgeId edge) const { return min_delays_[edge]; }
+
+  private:
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> max_delays_;
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> min_delays_;
+};
+
+//Delay calculator for a timing corner (see t_timing_corner), whose delays are the nominal
+//delays scaled by the corner's derating factors: max delays and setup times by the corner's
+//max_delay_scale, and min delays and hold times by its min_delay_scale.
+//
+//It only reads the shared nominal delays, so the calculators of different corners may be
+//used concurrently.
+class CornerDelayCalculator : public tatum::DelayCalculator {
+  public:
+    CornerDelayCalculator(const NominalEdgeDelays& nominal_delays, const t_timing_corner& corner)
+        : nominal_delays_(nominal_delays)
+        , corner_(corner) {}
+
+    const t_timing_corner& corner() const { return corner_; }
+
+    tatum::Time max_edge_delay(const tatum::TimingGraph& /*tg*/, tatum::EdgeId edge) const override {
+        return tatum::Time(corner_.max_delay_scale * nominal_delays_.max_delay(edge).value());
+    }
+
+    tatum::Time min_edge_delay(const tatum::TimingGraph& /*tg*/, tatum::EdgeId edge) const override {
+        return tatum::Time(corner_.min_delay_scale * nominal_delays_.min_delay(edge).value());
+    }
+
+    tatum::Time setup_time(const tatum::TimingGraph& /*tg*/, tatum::EdgeId edge) const override {
+        return tatum::Time(corner_.max_delay_scale * nominal_delays_.max_delay(edge).value());
+    }
+
+    tatum::Time hold_time(const tatum::TimingGraph& /*tg*/, tatum::EdgeId edge) const override {
+        return tatum::Time(corner_.min_delay_scale * nominal_delays_.min_delay(edge).value());
+    }
+
+  private:
+    const NominalEdgeDelays& nominal_delays_;
+    t_timing_corner corner_;
+};
+
+#endif
@@ -3,6 +3,7 @@
 #include "netlist_fwd.h"
 #include "tatum/TimingGraphFwd.hpp"
 #include "timing_info.h"
+#include "PostClusterDelayCalculator.h"
 #include "vtr_range.h"
 
 #include "vtr_vec_id_set.h"
@@ -29,6 +30,10 @@ class NetPinTimingInvalidator {
 //For efficiency, it pre-calculates and stores the mapping from ClusterPinId -> tatum::EdgeIds,
 //and tracks whether a particular ClusterPinId has been already invalidated (to avoid the expense
 //of invalidating it multiple times)
+//
+//If given the delay calculator of the timing analysis, it also invalidates the delays the
+//calculator caches for the edges, letting it memoize the delays of all edges (see
+//PostClusterDelayCalculator::set_memoize_net_delays()) while this invalidator exists.
 class IncrNetPinTimingInvalidator : public NetPinTimingInvalidator {
   public:
     IncrNetPinTimingInvalidator(const Netlist<>& net_list,
@@ -36,7 +41,9 @@ class IncrNetPinTimingInvalidator : public NetPinTimingInvalidator {
                                 const AtomNetlist& atom_nlist,
                                 const AtomLookup& atom_lookup,
                                 const tatum::TimingGraph& timing_graph,
-                                bool is_flat) {
+                                bool is_flat,
+                                PostClusterDelayCalculator* delay_calc = nullptr)
+        : delay_calc_(delay_calc) {
         size_t num_pins = net_list.pins().size();
         pin_first_edge_.reserve(num_pins + 1); //Exact
         timing_edges_.reserve(num_pins + 1);   //Lower bound
@@ -70,6 +77,16 @@ class IncrNetPinTimingInvalidator : public NetPinTimingInvalidator {
         pin_first_edge_.push_back(timing_edges_.size());
 
         VTR_ASSERT(pin_first_edge_.size() == net_list.pins().size() + 1);
+
+        if (delay_calc_) {
+            delay_calc_->set_memoize_net_delays(true);
+        }
+    }
+
+    ~IncrNetPinTimingInvalidator() {
+        if (delay_calc_) {
+            delay_calc_->set_memoize_net_delays(false);
+        }
     }
 
     //Returns the set of timing edges associated with the specified cluster pin
@@ -87,6 +104,9 @@ class IncrNetPinTimingInvalidator : public NetPinTimingInvalidator {
 
         for (tatum::EdgeId edge : pin_timing_edges(pin)) {
             timing_info->invalidate_delay(edge);
+            if (delay_calc_) {
+                delay_calc_->invalidate_net_delay(edge);
+            }
         }
 
         invalidated_pins_.insert(pin);
@@ -130,6 +150,8 @@ class IncrNetPinTimingInvalidator : public NetPinTimingInvalidator {
     std::vector<int> pin_first_edge_; //Indices into timing_edges corresponding
     std::vector<tatum::EdgeId> timing_edges_;
 
+    PostClusterDelayCalculator* delay_calc_ = nullptr;
+
     /** Cache for invalidated pins. Use concurrent set when TBB is turned on, since the
      * invalidator may be shared between threads */
 #ifdef VPR_USE_TBB
@@ -155,7 +177,8 @@ class NoopNetPinTimingInvalidator : public NetPinTimingInvalidator {
     }
 };
 
-/** Make a NetPinTimingInvalidator depending on update_type. Will return a NoopInvalidator if it's not INCREMENTAL. */
+/** Make a NetPinTimingInvalidator depending on update_type. Will return a NoopInvalidator if it's not INCREMENTAL.
+ * If delay_calc is the delay calculator of the timing analysis, its cached edge delays are invalidated too. */
 inline std::unique_ptr<NetPinTimingInvalidator> make_net_pin_timing_invalidator(
     e_timing_update_type update_type,
     const Netlist<>& net_list,
@@ -163,11 +186,12 @@ inline std::unique_ptr<NetPinTimingInvalidator> make_net_pin_timing_invalidator(
     const AtomNetlist& atom_nlist,
     const AtomLookup& atom_lookup,
     const tatum::TimingGraph& timing_graph,
-    bool is_flat) {
+    bool is_flat,
+    PostClusterDelayCalculator* delay_calc = nullptr) {
     if (update_type == e_timing_update_type::FULL || update_type == e_timing_update_type::AUTO) {
         return std::make_unique<NoopNetPinTimingInvalidator>();
     } else {
         VTR_ASSERT(update_type == e_timing_update_type::INCREMENTAL);
-        return std::make_unique<IncrNetPinTimingInvalidator>(net_list, clb_atom_pin_lookup, atom_nlist, atom_lookup, timing_graph, is_flat);
+        return std::make_unique<IncrNetPinTimingInvalidator>(net_list, clb_atom_pin_lookup, atom_nlist, atom_lookup, timing_graph, is_flat, delay_calc);
     }
 }
\ No newline at end of file
@@ -31,6 +31,16 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
 
     void clear_cache();
 
+    //Also cache the full delays of edges which depend on net delays (i.e. connections between
+    //clusters), rather than re-combining their cached cluster delays with the current net delay
+    //on each call. This is only valid if invalidate_net_delay() is called on each edge whose net
+    //delay changes (see IncrNetPinTimingInvalidator). Disabling forgets the cached net-dependent delays.
+    void set_memoize_net_delays(bool enable);
+
+    //Forgets the cached delay of an edge whose net delay has changed (if memoizing net delays).
+    //Is concurrently safe for different edges.
+    void invalidate_net_delay(tatum::EdgeId edge) const;
+
     void set_tsu_margin_relative(float val);
     void set_tsu_margin_absolute(float val);
 
@@ -86,6 +96,7 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
     mutable vtr::vector<tatum::EdgeId, tatum::Time> sink_clb_max_delay_cache_;
     mutable vtr::vector<tatum::EdgeId, std::pair<ParentPinId, ParentPinId>> pin_cache_min_;
     mutable vtr::vector<tatum::EdgeId, std::pair<ParentPinId, ParentPinId>> pin_cache_max_;
+    bool memoize_net_delays_ = false;
     bool is_flat_;
 };
 
@@ -39,6 +39,28 @@ inline void PostClusterDelayCalculator::clear_cache() {
     std::fill(pin_cache_max_.begin(), pin_cache_max_.end(), std::pair<ParentPinId, ParentPinId>(ParentPinId::INVALID(), ParentPinId::INVALID()));
 }
 
+inline void PostClusterDelayCalculator::set_memoize_net_delays(bool enable) {
+    if (memoize_net_delays_ && !enable) {
+        for (tatum::EdgeId edge : g_vpr_ctx.timing().graph->edges()) {
+            invalidate_net_delay(edge);
+        }
+    }
+    memoize_net_delays_ = enable;
+}
+
+inline void PostClusterDelayCalculator::invalidate_net_delay(tatum::EdgeId edge) const {
+    if (!memoize_net_delays_) return;
+
+    //Only edges with cached net pins depend on net delays (the full delays of other edges,
+    //e.g. those completely within a cluster, do not change)
+    if (pin_cache_max_[edge].second) {
+        edge_max_delay_cache_[edge] = tatum::Time(NAN);
+    }
+    if (pin_cache_min_[edge].second) {
+        edge_min_delay_cache_[edge] = tatum::Time(NAN);
+    }
+}
+
 inline void PostClusterDelayCalculator::set_tsu_margin_relative(float new_margin) {
     tsu_margin_rel_ = new_margin;
 }
@@ -245,6 +267,9 @@ inline tatum::Time PostClusterDelayCalculator::atom_net_delay(const tatum::Timin
                 // For the atom nets, launch_cluster_delay and capture are equal to zero.
                 edge_delay = /* driver_clb_delay=0 + */ net_delay /* + sink_clb_delay=0 */;
                 set_cached_pins(edge_id, delay_type, (ParentPinId&)atom_src_pin, (ParentPinId&)atom_sink_pin);
+                if (memoize_net_delays_) {
+                    set_cached_delay(edge_id, delay_type, edge_delay);
+                }
 
             } else {
                 ClusterBlockId clb_src_block;
@@ -307,6 +332,9 @@ inline tatum::Time PostClusterDelayCalculator::atom_net_delay(const tatum::Timin
                     VTR_ASSERT(cluster_src_pin != ClusterPinId::INVALID());
                     VTR_ASSERT(cluster_sink_pin != ClusterPinId::INVALID());
                     set_cached_pins(edge_id, delay_type, (ParentPinId&)cluster_src_pin, (ParentPinId&)cluster_sink_pin);
+                    if (memoize_net_delays_) {
+                        set_cached_delay(edge_id, delay_type, edge_delay);
+                    }
 
 #ifdef POST_CLUSTER_DELAY_CALC_DEBUG
                     VTR_LOG("  Edge %zu net delay: %g = %g + %g + %g (= clb_driver + net + clb_sink) [UNcached]\n",
@@ -363,6 +391,11 @@ inline tatum::Time PostClusterDelayCalculator::atom_net_delay(const tatum::Timin
 
                 edge_delay = driver_clb_delay + net_delay + sink_clb_delay;
             }
+
+            if (memoize_net_delays_) {
+                //Valid until the net delay is invalidated
+                set_cached_delay(edge_id, delay_type, edge_delay);
+            }
 #ifdef POST_CLUSTER_DELAY_CALC_DEBUG
             VTR_LOG("  Edge %zu net delay: %g = %g + %g + %g (= clb_driver + net + clb_sink) [Cached]\n",
                     size_t(edge_id),
@@ -1,6 +1,7 @@
 #ifndef PRE_CLUSTER_DELAY_CALCULATOR_H
 #define PRE_CLUSTER_DELAY_CALCULATOR_H
 #include "vtr_assert.h"
+#include "vtr_vector.h"
 
 #include "tatum/Time.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
@@ -10,6 +11,7 @@
 
 #include "atom_netlist.h"
 #include "atom_lookup.h"
+#include "clustered_netlist_fwd.h"
 #include "physical_types.h"
 
 class PreClusterDelayCalculator : public tatum::DelayCalculator {
@@ -38,6 +40,11 @@ class PreClusterDelayCalculator : public tatum::DelayCalculator {
         } else {
             VTR_ASSERT(edge_type == tatum::EdgeType::INTERCONNECT);
 
+            if (is_intra_cluster_edge(src_node, sink_node)) {
+                //Both atoms are packed in the same cluster
+                return tatum::Time(INTRA_CLUSTER_NET_DELAY);
+            }
+
             //External net delay
             return tatum::Time(inter_cluster_net_delay_);
         }
@@ -67,6 +74,47 @@ class PreClusterDelayCalculator : public tatum::DelayCalculator {
         return max_edge_delay(tg, edge_id);
     }
 
+    /**
+     * @brief Returns the cluster the delays of the connections of blk assume it is packed in
+     *
+     * Until set_atom_clb() is first called all connections are assumed to be between clusters.
+     */
+    ClusterBlockId atom_clb(const AtomBlockId blk) const {
+        if (atom_clb_.empty()) {
+            return ClusterBlockId::INVALID();
+        }
+        return atom_clb_[blk];
+    }
+
+    /**
+     * @brief Sets the cluster the delays of the connections of blk assume it is packed in
+     *
+     * The clustering is a snapshot rather than the live AtomLookup, so the timing graph edges
+     * whose delays change can be invalidated before the next incremental timing update.
+     */
+    void set_atom_clb(const AtomBlockId blk, const ClusterBlockId clb) {
+        if (atom_clb_.empty()) {
+            atom_clb_.resize(netlist_.blocks().size(), ClusterBlockId::INVALID());
+        }
+        atom_clb_[blk] = clb;
+    }
+
+    ///@brief Returns true if the interconnect edge between src_node and sink_node is within a cluster
+    bool is_intra_cluster_edge(tatum::NodeId src_node, tatum::NodeId sink_node) const {
+        if (atom_clb_.empty()) {
+            return false;
+        }
+
+        AtomPinId src_pin = netlist_lookup_.tnode_atom_pin(src_node);
+        AtomPinId sink_pin = netlist_lookup_.tnode_atom_pin(sink_node);
+        if (!src_pin || !sink_pin) {
+            return false;
+        }
+
+        ClusterBlockId src_clb = atom_clb_[netlist_.pin_block(src_pin)];
+        return src_clb && src_clb == atom_clb_[netlist_.pin_block(sink_pin)];
+    }
+
     tatum::Time hold_time(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const override {
         //Currently return the same as hold time
         //TODO: use true hold time
@@ -166,6 +214,13 @@ class PreClusterDelayCalculator : public tatum::DelayCalculator {
     const AtomLookup& netlist_lookup_;
     const float inter_cluster_net_delay_;
     const std::unordered_map<AtomBlockId, t_pb_graph_node*> block_to_pb_gnode_;
+
+    //Delay assumed for the connections within a cluster, whose routing through the cluster's
+    //local interconnect is not known yet
+    static constexpr float INTRA_CLUSTER_NET_DELAY = 0.;
+
+    vtr::vector<AtomBlockId, ClusterBlockId> atom_clb_; //Empty until the clustering is first set
+
 };
 
 #endif
@@ -46,6 +46,10 @@ std::string VprTimingGraphResolver::node_type_name(tatum::NodeId node) const {
     return name;
 }
 
+bool VprTimingGraphResolver::is_thread_safe() const {
+    return detail_level() == e_timing_report_detail::NETLIST;
+}
+
 tatum::EdgeDelayBreakdown VprTimingGraphResolver::edge_delay_breakdown(tatum::EdgeId edge, tatum::DelayType tatum_delay_type) const {
     tatum::EdgeDelayBreakdown delay_breakdown;
 
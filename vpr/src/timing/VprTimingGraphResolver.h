@@ -19,6 +19,10 @@ class VprTimingGraphResolver : public tatum::TimingGraphNameResolver {
 
     tatum::EdgeDelayBreakdown edge_delay_breakdown(tatum::EdgeId edge, tatum::DelayType delay_type) const override;
 
+    //Only true at the netlist detail level, since the delay breakdowns of the more
+    //detailed levels fill the (unsynchronized) caches of the delay calculator
+    bool is_thread_safe() const override;
+
     void set_detail_level(e_timing_report_detail report_detail);
 
   private:
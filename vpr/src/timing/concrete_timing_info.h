@@ -2,10 +2,12 @@
 #define VPR_CONCRETE_TIMING_INFO_H
 
 #include "vtr_log.h"
+#include "vtr_profile.h"
 #include "timing_info.h"
 #include "timing_util.h"
 #include "vpr_error.h"
 #include "slack_evaluation.h"
+#include "net_pin_criticalities.h"
 #include "globals.h"
 
 #include "tatum/report/graphviz_dot_writer.hpp"
@@ -82,6 +84,10 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
         return slack_crit_.pins_with_modified_criticality();
     }
 
+    const NetPinsMatrix<float>& net_pin_criticalities() const override {
+        return net_pin_crits_.criticalities();
+    }
+
     std::shared_ptr<const tatum::TimingAnalyzer> analyzer() const override { return setup_analyzer(); }
 
     std::shared_ptr<const tatum::SetupTimingAnalyzer> setup_analyzer() const override { return setup_analyzer_; }
@@ -111,6 +117,7 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
         //Update the arrival and required times and re-calculate slacks
         double sta_wallclock_time = 0.;
         {
+            vtr::ProfileZone sta_zone("sta_setup");
             auto start_time = Clock::now();
 
             setup_analyzer_->update_setup_timing();
@@ -120,6 +127,7 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
 
         double slack_wallclock_time = 0.;
         {
+            vtr::ProfileZone slack_zone("sta_slacks");
             auto start_time = Clock::now();
 
             update_setup_slacks();
@@ -139,6 +147,14 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
     void update_setup_slacks() {
         clear_cache();
         slack_crit_.update_slacks_and_criticalities(*timing_graph_, *setup_analyzer_);
+
+        if (net_pin_crits_.tracking()) {
+            net_pin_crits_.update(*this);
+        }
+    }
+
+    void track_net_pin_criticalities(const Netlist<>* net_list, const ClusteredPinAtomPinsLookup* pin_lookup, bool is_flat) override {
+        net_pin_crits_.track(net_list, pin_lookup, is_flat, *this);
     }
 
     void set_warn_unconstrained(bool val) override { warn_unconstrained_ = val; }
@@ -151,6 +167,7 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
     std::shared_ptr<tatum::SetupTimingAnalyzer> setup_analyzer_;
 
     SetupSlackCrit slack_crit_;
+    NetPinCriticalities net_pin_crits_;
 
     //Cached values
     mutable float sTNS_ = std::numeric_limits<float>::quiet_NaN();
@@ -229,6 +246,7 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
     void update_hold() override {
         double sta_wallclock_time = 0.;
         {
+            vtr::ProfileZone sta_zone("sta_hold");
             auto start_time = Clock::now();
 
             hold_analyzer_->update_hold_timing();
@@ -238,6 +256,7 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
 
         double slack_wallclock_time = 0.;
         {
+            vtr::ProfileZone slack_zone("sta_slacks");
             auto start_time = Clock::now();
 
             update_hold_slacks();
@@ -302,7 +321,9 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
     float setup_pin_criticality(AtomPinId pin) const override { return setup_timing_.setup_pin_criticality(pin); }
 
     pin_range pins_with_modified_setup_slack() const override { return setup_timing_.pins_with_modified_setup_slack(); }
-    pin_range pins_with_modified_setup_criticality() const override { return setup_timing_.pins_with_modified_setup_slack(); }
+    pin_range pins_with_modified_setup_criticality() const override { return setup_timing_.pins_with_modified_setup_criticality(); }
+
+    const NetPinsMatrix<float>& net_pin_criticalities() const override { return setup_timing_.net_pin_criticalities(); }
 
     std::shared_ptr<const tatum::SetupTimingAnalyzer> setup_analyzer() const override { return setup_timing_.setup_analyzer(); }
 
@@ -337,6 +358,7 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
     void update() override {
         double sta_wallclock_time = 0.;
         {
+            vtr::ProfileZone sta_zone("sta_setup_hold");
             auto start_time = Clock::now();
 
             setup_hold_analyzer_->update_timing();
@@ -346,6 +368,7 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
 
         double slack_wallclock_time = 0.;
         {
+            vtr::ProfileZone slack_zone("sta_slacks");
             auto start_time = Clock::now();
 
             setup_timing_.update_setup_slacks();
@@ -371,6 +394,10 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
     //Update setup only
     void update_setup() override { setup_timing_.update_setup(); }
 
+    void track_net_pin_criticalities(const Netlist<>* net_list, const ClusteredPinAtomPinsLookup* pin_lookup, bool is_flat) override {
+        setup_timing_.track_net_pin_criticalities(net_list, pin_lookup, is_flat);
+    }
+
     void set_warn_unconstrained(bool val) override { warn_unconstrained_ = val; }
 
   private:
@@ -414,6 +441,8 @@ class ConstantTimingInfo : public SetupHoldTimingInfo {
     pin_range pins_with_modified_setup_slack() const override { return vtr::make_range(modified_pins_); }
     pin_range pins_with_modified_setup_criticality() const override { return vtr::make_range(modified_pins_); }
 
+    const NetPinsMatrix<float>& net_pin_criticalities() const override { return net_pin_crits_.criticalities(); }
+
     std::shared_ptr<const tatum::SetupTimingAnalyzer> setup_analyzer() const override { return nullptr; }
 
     //Hold related
@@ -443,14 +472,26 @@ class ConstantTimingInfo : public SetupHoldTimingInfo {
     void update_hold() override {}
     void update_setup() override {}
 
+    void track_net_pin_criticalities(const Netlist<>* net_list, const ClusteredPinAtomPinsLookup* pin_lookup, bool is_flat) override {
+        net_pin_crits_.track(net_list, pin_lookup, is_flat, *this);
+    }
+
   private:
     std::vector<AtomPinId> modified_pins_; /* always empty */
+    NetPinCriticalities net_pin_crits_;    /* never updated, since the criticalities are constant */
     float criticality_;
 
     typedef std::chrono::duration<double> dsec;
     typedef std::chrono::high_resolution_clock Clock;
 };
 
+/** The graph walker of incremental timing updates: levels of the invalidated nodes are processed in parallel when tatum uses TBB */
+#ifdef TATUM_USE_TBB
+using IncrTimingGraphWalker = tatum::ParallelIncrWalker;
+#else
+using IncrTimingGraphWalker = tatum::SerialIncrWalker;
+#endif
+
 /** Create a SetupTimingInfo for the given delay calculator */
 template<class DelayCalc>
 std::unique_ptr<SetupTimingInfo> make_setup_timing_info(std::shared_ptr<DelayCalc> delay_calculator, e_timing_update_type update_type) {
@@ -462,7 +503,7 @@ std::unique_ptr<SetupTimingInfo> make_setup_timing_info(std::shared_ptr<DelayCal
         analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     } else {
         VTR_ASSERT(update_type == e_timing_update_type::INCREMENTAL);
-        analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, tatum::SerialIncrWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
+        analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, IncrTimingGraphWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     }
 
     return std::make_unique<ConcreteSetupTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer);
@@ -478,7 +519,7 @@ std::unique_ptr<HoldTimingInfo> make_hold_timing_info(std::shared_ptr<DelayCalc>
         analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     } else {
         VTR_ASSERT(update_type == e_timing_update_type::INCREMENTAL);
-        analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis, tatum::SerialIncrWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
+        analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis, IncrTimingGraphWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     }
 
     return std::make_unique<ConcreteHoldTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer);
@@ -494,7 +535,7 @@ std::unique_ptr<SetupHoldTimingInfo> make_setup_hold_timing_info(std::shared_ptr
         analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     } else {
         VTR_ASSERT(update_type == e_timing_update_type::INCREMENTAL);
-        analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, tatum::SerialIncrWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
+        analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, IncrTimingGraphWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     }
 
     return std::make_unique<ConcreteSetupHoldTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer);
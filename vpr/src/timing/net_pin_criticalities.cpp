@@ -0,0 +1,87 @@
+#include "net_pin_criticalities.h"
+
+#include <algorithm>
+#include <limits>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+#include "vtr_assert.h"
+
+#include "netlist.h"
+#include "timing_info.h"
+#include "timing_util.h"
+
+void NetPinCriticalities::track(const Netlist<>* net_list, const ClusteredPinAtomPinsLookup* pin_lookup, bool is_flat, const SetupTimingInfo& timing_info) {
+    net_list_ = net_list;
+    pin_lookup_ = pin_lookup;
+    is_flat_ = is_flat;
+
+    if (!net_list_) {
+        criticalities_ = NetPinsMatrix<float>();
+        return;
+    }
+
+    VTR_ASSERT(pin_lookup_);
+    criticalities_ = make_net_pins_matrix<float>(*net_list_, std::numeric_limits<float>::quiet_NaN());
+
+    modified_pins_.clear();
+    for (ParentPinId pin : net_list_->pins()) {
+        modified_pins_.push_back(pin);
+    }
+    update_pins(modified_pins_, timing_info);
+}
+
+void NetPinCriticalities::update(const SetupTimingInfo& timing_info) {
+    VTR_ASSERT(tracking());
+
+    modified_pins_.clear();
+    for (AtomPinId atom_pin : timing_info.pins_with_modified_setup_criticality()) {
+        if (is_flat_) {
+            modified_pins_.push_back(ParentPinId(size_t(atom_pin)));
+        } else {
+            ClusterPinId clb_pin = pin_lookup_->connected_clb_pin(atom_pin);
+
+            //Connections completely contained within a cluster have no clustered pin
+            if (!clb_pin) continue;
+
+            modified_pins_.push_back(ParentPinId(size_t(clb_pin)));
+        }
+    }
+
+    //Several atom pins may connect to the same clustered pin, which must only be updated once
+    //(by one thread)
+    std::sort(modified_pins_.begin(), modified_pins_.end());
+    modified_pins_.erase(std::unique(modified_pins_.begin(), modified_pins_.end()), modified_pins_.end());
+
+    update_pins(modified_pins_, timing_info);
+}
+
+void NetPinCriticalities::update_pins(const std::vector<ParentPinId>& pins, const SetupTimingInfo& timing_info) {
+    auto update_pin = [&](size_t i) {
+        ParentPinId pin = pins[i];
+        criticalities_[net_list_->pin_net(pin)][net_list_->pin_net_index(pin)] = calculate_clb_net_pin_criticality(timing_info, *pin_lookup_, pin, is_flat_);
+    };
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), pins.size(), update_pin);
+#else
+    for (size_t i = 0; i < pins.size(); ++i) {
+        update_pin(i);
+    }
+#endif
+}
+
+ScopedNetPinCriticalityTracking::ScopedNetPinCriticalityTracking(SetupTimingInfo* timing_info, const Netlist<>& net_list, const ClusteredPinAtomPinsLookup& pin_lookup, bool is_flat)
+    : timing_info_(timing_info) {
+    if (timing_info_) {
+        timing_info_->track_net_pin_criticalities(&net_list, &pin_lookup, is_flat);
+    }
+}
+
+ScopedNetPinCriticalityTracking::~ScopedNetPinCriticalityTracking() {
+    if (timing_info_) {
+        timing_info_->track_net_pin_criticalities(nullptr, nullptr, false);
+    }
+}
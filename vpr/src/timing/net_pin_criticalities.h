@@ -0,0 +1,67 @@
+#ifndef VPR_NET_PIN_CRITICALITIES_H
+#define VPR_NET_PIN_CRITICALITIES_H
+
+#include <vector>
+
+#include "netlist_fwd.h"
+#include "timing_info_fwd.h"
+#include "vpr_net_pins_matrix.h"
+
+class ClusteredPinAtomPinsLookup;
+
+//The setup criticalities of the pins of a netlist being optimized (e.g. the clustered
+//netlist, or the atom netlist when routing flat), packed into a net x pin matrix.
+//
+//They are kept up to date by the timing info which owns them (see
+//SetupTimingInfo::track_net_pin_criticalities()): after each timing update only the
+//pins connected to atom pins with modified criticality are recalculated, in parallel
+//if VPR is built with TBB.
+class NetPinCriticalities {
+  public:
+    //Accessors
+
+    //Returns whether criticalities are tracked
+    bool tracking() const { return net_list_ != nullptr; }
+
+    //Returns the criticalities of the pins of each net, indexed by net and net pin index
+    const NetPinsMatrix<float>& criticalities() const { return criticalities_; }
+
+  public:
+    //Mutators
+
+    //Start tracking the criticalities of the pins of net_list (whose cluster pins are
+    //mapped to atom pins with pin_lookup, unless is_flat, in which case net_list is the
+    //atom netlist), and calculate them all from timing_info. A null net_list stops tracking
+    void track(const Netlist<>* net_list, const ClusteredPinAtomPinsLookup* pin_lookup, bool is_flat, const SetupTimingInfo& timing_info);
+
+    //Recalculate the criticalities of the pins connected to the atom pins whose setup
+    //criticalities were modified by the last update of timing_info
+    void update(const SetupTimingInfo& timing_info);
+
+  private:
+    void update_pins(const std::vector<ParentPinId>& pins, const SetupTimingInfo& timing_info);
+
+  private:
+    const Netlist<>* net_list_ = nullptr;
+    const ClusteredPinAtomPinsLookup* pin_lookup_ = nullptr;
+    bool is_flat_ = false;
+
+    NetPinsMatrix<float> criticalities_;
+
+    std::vector<ParentPinId> modified_pins_; //Scratch, to avoid re-allocating each update
+};
+
+//Tracks the net pin criticalities of a timing info (if any) while in scope
+class ScopedNetPinCriticalityTracking {
+  public:
+    ScopedNetPinCriticalityTracking(SetupTimingInfo* timing_info, const Netlist<>& net_list, const ClusteredPinAtomPinsLookup& pin_lookup, bool is_flat);
+    ~ScopedNetPinCriticalityTracking();
+
+    ScopedNetPinCriticalityTracking(const ScopedNetPinCriticalityTracking&) = delete;
+    ScopedNetPinCriticalityTracking& operator=(const ScopedNetPinCriticalityTracking&) = delete;
+
+  private:
+    SetupTimingInfo* timing_info_;
+};
+
+#endif
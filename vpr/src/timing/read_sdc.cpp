@@ -1,6 +1,6 @@
 #include "read_sdc.h"
 
-#include <regex>
+#include <chrono>
 
 #include "vtr_log.h"
 #include "vtr_assert.h"
@@ -15,6 +15,7 @@
 #include "atom_netlist.h"
 #include "atom_netlist_utils.h"
 #include "atom_lookup.h"
+#include "sdc_name_index.h"
 
 void apply_default_timing_constraints(const AtomNetlist& netlist,
                                       const AtomLookup& lookup,
@@ -49,8 +50,6 @@ void constrain_all_ios(const AtomNetlist& netlist,
 std::map<std::string, AtomPinId> find_netlist_primary_ios(const AtomNetlist& netlist);
 std::string orig_blif_name(std::string name);
 
-std::regex glob_pattern_to_regex(const std::string& glob_pattern);
-
 class SdcParseCallback : public sdcparse::Callback {
   public:
     SdcParseCallback(const AtomNetlist& netlist,
@@ -67,6 +66,11 @@ class SdcParseCallback : public sdcparse::Callback {
     void start_parse() override {
         netlist_clock_drivers_ = find_netlist_logical_clock_drivers(netlist_);
         netlist_primary_ios_ = find_netlist_primary_ios(netlist_);
+
+        for (const auto& kv : netlist_primary_ios_) {
+            port_index_.add(kv.first, kv.second);
+        }
+        port_index_.build();
     }
 
     //Sets current filename
@@ -77,7 +81,7 @@ class SdcParseCallback : public sdcparse::Callback {
 
     //Individual commands
     void create_clock(const sdcparse::CreateClock& cmd) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "create_clock");
 
         if (cmd.is_virtual) {
             //Create a virtual clock
@@ -102,9 +106,8 @@ class SdcParseCallback : public sdcparse::Callback {
             for (const std::string& clock_name_glob_pattern : cmd.targets.strings) {
                 bool found = false;
 
-                //We interpret each SDC target as glob-style pattern matches, which we
-                //convert to a regex
-                auto clock_name_regex = glob_pattern_to_regex(clock_name_glob_pattern);
+                //We interpret each SDC target as glob-style pattern matches
+                SdcNamePattern clock_name_pattern(clock_name_glob_pattern);
 
                 //Look for matching netlist clocks
                 for (AtomPinId clock_pin : netlist_clock_drivers_) {
@@ -114,7 +117,7 @@ class SdcParseCallback : public sdcparse::Callback {
                     auto net_aliases = netlist_.net_aliases(clock_name);
 
                     for (const auto& alias : net_aliases) {
-                        if (std::regex_match(alias, clock_name_regex)) {
+                        if (clock_name_pattern.matches(alias)) {
                             found = true;
                             //Create netlist clock
                             tatum::DomainId netlist_clk = tc_.create_clock_domain(clock_name);
@@ -151,7 +154,7 @@ class SdcParseCallback : public sdcparse::Callback {
     }
 
     void set_io_delay(const sdcparse::SetIoDelay& cmd) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "set_io_delay");
 
         tatum::DomainId domain;
 
@@ -249,7 +252,7 @@ class SdcParseCallback : public sdcparse::Callback {
     }
 
     void set_clock_groups(const sdcparse::SetClockGroups& cmd) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "set_clock_groups");
 
         if (cmd.type != sdcparse::ClockGroupsType::EXCLUSIVE) {
             vpr_throw(VPR_ERROR_SDC, fname_.c_str(), lineno_,
@@ -278,7 +281,7 @@ class SdcParseCallback : public sdcparse::Callback {
     }
 
     void set_false_path(const sdcparse::SetFalsePath& cmd) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "set_false_path");
 
         auto from_clocks = get_clocks(cmd.from);
         auto to_clocks = get_clocks(cmd.to);
@@ -305,7 +308,7 @@ class SdcParseCallback : public sdcparse::Callback {
     }
 
     void set_min_max_delay(const sdcparse::SetMinMaxDelay& cmd) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "set_min_max_delay");
 
         auto from_clocks = get_clocks(cmd.from);
         auto to_clocks = get_clocks(cmd.to);
@@ -341,7 +344,7 @@ class SdcParseCallback : public sdcparse::Callback {
     }
 
     void set_multicycle_path(const sdcparse::SetMulticyclePath& cmd) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "set_multicycle_path");
 
         std::set<tatum::DomainId> from_clocks;
         std::set<tatum::DomainId> to_clocks;
@@ -417,7 +420,7 @@ class SdcParseCallback : public sdcparse::Callback {
     }
 
     void set_clock_uncertainty(const sdcparse::SetClockUncertainty& cmd) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "set_clock_uncertainty");
 
         auto from_clocks = get_clocks(cmd.from);
         auto to_clocks = get_clocks(cmd.to);
@@ -454,7 +457,7 @@ class SdcParseCallback : public sdcparse::Callback {
     }
 
     void set_clock_latency(const sdcparse::SetClockLatency& cmd) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "set_clock_latency");
 
         if (cmd.type != sdcparse::ClockLatencyType::SOURCE) {
             vpr_throw(VPR_ERROR_SDC, fname_.c_str(), lineno_, "set_clock_latency only supports specifying -source latency");
@@ -486,7 +489,7 @@ class SdcParseCallback : public sdcparse::Callback {
     }
 
     void set_disable_timing(const sdcparse::SetDisableTiming& cmd) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "set_disable_timing");
 
         //Collect the specified pins
         auto from_pins = get_pins(cmd.from);
@@ -541,7 +544,7 @@ class SdcParseCallback : public sdcparse::Callback {
     }
 
     void set_timing_derate(const sdcparse::SetTimingDerate& /*cmd*/) override {
-        ++num_commands_;
+        ScopedCommand command(*this, "set_timing_derate");
         vpr_throw(VPR_ERROR_SDC, fname_.c_str(), lineno_, "set_timing_derate currently unsupported");
     }
 
@@ -565,7 +568,57 @@ class SdcParseCallback : public sdcparse::Callback {
   public:
     size_t num_commands() { return num_commands_; }
 
+    //Logs the number of commands of each type and the time spent applying them
+    void log_command_stats() const {
+        VTR_LOG("SDC command application time breakdown:\n");
+        for (const auto& kv : command_stats_) {
+            VTR_LOG("  %-24s %9zu commands %9.3f sec\n", kv.first.c_str(), kv.second.count, kv.second.time);
+        }
+        if (pin_index_.size() != 0) {
+            VTR_LOG("  (including %.3f sec to index %zu pin names)\n", pin_index_time_, pin_index_.size());
+        }
+    }
+
   private:
+    struct t_command_stats {
+        size_t count = 0;
+        double time = 0.; //Seconds spent applying the commands
+    };
+
+    //Counts an SDC command, and measures the time spent applying it while in scope
+    class ScopedCommand {
+      public:
+        ScopedCommand(SdcParseCallback& callback, const char* name)
+            : stats_(callback.command_stats_[name])
+            , start_(std::chrono::steady_clock::now()) {
+            ++callback.num_commands_;
+            ++stats_.count;
+        }
+
+        ~ScopedCommand() {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+            stats_.time += elapsed.count();
+        }
+
+      private:
+        t_command_stats& stats_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    //Index all netlist pins by name (only done once get_pins is used, since it is expensive
+    //for large netlists)
+    void build_pin_index() {
+        auto start = std::chrono::steady_clock::now();
+
+        for (AtomPinId pin : netlist_.pins()) {
+            pin_index_.add(netlist_.pin_name(pin), pin);
+        }
+        pin_index_.build();
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        pin_index_time_ = elapsed.count();
+    }
+
     void resolve_clock_constraints() {
         //Set the clock constraints
         for (tatum::DomainId launch_clock : tc_.clock_domains()) {
@@ -871,19 +924,9 @@ class SdcParseCallback : public sdcparse::Callback {
 
         std::set<AtomPinId> pins;
         for (const auto& port_pattern : port_group.strings) {
-            std::regex port_regex = glob_pattern_to_regex(port_pattern);
-
-            bool found = false;
-            for (const auto& kv : netlist_primary_ios_) {
-                const std::string& io_name = kv.first;
-                if (std::regex_match(io_name, port_regex)) {
-                    found = true;
-
-                    AtomPinId pin = kv.second;
-
-                    pins.insert(pin);
-                }
-            }
+            bool found = port_index_.for_each_match(SdcNamePattern(port_pattern), [&](AtomPinId pin) {
+                pins.insert(pin);
+            });
 
             if (!found) {
                 VTR_LOGF_WARN(fname_.c_str(), lineno_,
@@ -908,7 +951,7 @@ class SdcParseCallback : public sdcparse::Callback {
         }
 
         for (const auto& clock_glob_pattern : clock_group.strings) {
-            std::regex clock_regex = glob_pattern_to_regex(clock_glob_pattern);
+            SdcNamePattern clock_pattern(clock_glob_pattern);
 
             bool found = false;
             for (tatum::DomainId domain : tc_.clock_domains()) {
@@ -919,14 +962,14 @@ class SdcParseCallback : public sdcparse::Callback {
                 //
                 // If the SDC contains virtual clocks, the name of these does not
                 // appear in the net aliases data structure, therefore there is no
-                // need to iterate through the vector and a direct regex match can
+                // need to iterate through the vector and a direct match can
                 // be applied.
                 //
                 // Furthermore, a virtual clock name would cause an error as there
                 // is no net associated with that when getting the net aliases from
                 // the netlist.
                 if (tc_.is_virtual_clock(domain)) {
-                    if (std::regex_match(clock_name, clock_regex)) {
+                    if (clock_pattern.matches(clock_name)) {
                         found = true;
 
                         domains.insert(domain);
@@ -935,7 +978,7 @@ class SdcParseCallback : public sdcparse::Callback {
                     auto net_aliases = netlist_.net_aliases(clock_name);
 
                     for (const auto& alias : net_aliases) {
-                        if (std::regex_match(alias, clock_regex)) {
+                        if (clock_pattern.matches(alias)) {
                             found = true;
 
                             domains.insert(domain);
@@ -968,19 +1011,14 @@ class SdcParseCallback : public sdcparse::Callback {
                       "Expected pin collection via get_pins");
         }
 
-        for (const auto& pin_pattern : pin_group.strings) {
-            std::regex pin_regex = glob_pattern_to_regex(pin_pattern);
-
-            bool found = false;
-            for (AtomPinId pin : netlist_.pins()) {
-                const std::string& pin_name = netlist_.pin_name(pin);
-
-                if (std::regex_match(pin_name, pin_regex)) {
-                    found = true;
+        if (pin_index_.size() == 0) {
+            build_pin_index();
+        }
 
-                    pins.insert(pin);
-                }
-            }
+        for (const auto& pin_pattern : pin_group.strings) {
+            bool found = pin_index_.for_each_match(SdcNamePattern(pin_pattern), [&](AtomPinId pin) {
+                pins.insert(pin);
+            });
 
             if (!found) {
                 VTR_LOGF_WARN(fname_.c_str(), lineno_,
@@ -1047,6 +1085,12 @@ class SdcParseCallback : public sdcparse::Callback {
     std::set<AtomPinId> netlist_clock_drivers_;
     std::map<std::string, AtomPinId> netlist_primary_ios_;
 
+    SdcNameIndex<AtomPinId> port_index_;
+    SdcNameIndex<AtomPinId> pin_index_;
+    double pin_index_time_ = 0.;
+
+    std::map<std::string, t_command_stats> command_stats_;
+
     std::set<std::pair<tatum::DomainId, tatum::DomainId>> disabled_domain_pairs_;
     std::map<std::pair<tatum::DomainId, tatum::DomainId>, float> setup_override_constraints_;
     std::map<std::pair<tatum::DomainId, tatum::DomainId>, float> hold_override_constraints_;
@@ -1087,6 +1131,7 @@ std::unique_ptr<tatum::TimingConstraints> read_sdc(const t_timing_inf& timing_in
             } else {
                 VTR_LOG("\n");
                 VTR_LOG("Applied %zu SDC commands from '%s'\n", callback.num_commands(), timing_inf.SDCFile.c_str());
+                callback.log_command_stats();
             }
         }
     }
@@ -1312,22 +1357,3 @@ std::string orig_blif_name(std::string name) {
 
     return name;
 }
-
-//Converts a glob pattern to a std::regex
-std::regex glob_pattern_to_regex(const std::string& glob_pattern) {
-    //In glob (i.e. unix-shell style):
-    //   '*' is a wildcard match of zero or more instances of any characters
-    //
-    //In regex:
-    //   '*' matches zero or more of the preceeding character
-    //   '.' matches any character
-    //
-    //To convert a glob to a regex we need to:
-    //   Convert '.' to "\.", so literal '.' in glob is treated as literal in the regex
-    //   Convert '*' to ".*" so literal '*' in glob matches any sequence
-
-    std::string regex_str = vtr::replace_all(glob_pattern, ".", "\\.");
-    regex_str = vtr::replace_all(regex_str, "*", ".*");
-
-    return std::regex(regex_str);
-}
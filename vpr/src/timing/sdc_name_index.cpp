@@ -0,0 +1,114 @@
+#include "sdc_name_index.h"
+
+#include <cstring>
+
+#include "vtr_assert.h"
+#include "vtr_util.h"
+
+//Characters which have a special meaning in the regexes produced by glob_pattern_to_regex(),
+//other than the '.' and '*' of the glob syntax itself
+static const char* REGEX_SPECIAL_CHARS = "\\^$|?+()[]{}";
+
+static bool glob_match(std::string_view glob, std::string_view name);
+
+SdcNamePattern::SdcNamePattern(const std::string& pattern)
+    : pattern_(pattern) {
+    //Regex special characters escaped with a backslash are matched literally, but
+    //unescaped (or any other escape sequence, e.g. '\d') need a real regex
+    bool is_regex = false;
+    for (size_t i = 0; i < pattern_.size(); ++i) {
+        char c = pattern_[i];
+        if (c == '\\' && i + 1 < pattern_.size() && std::strchr(REGEX_SPECIAL_CHARS, pattern_[i + 1])) {
+            glob_ += pattern_[++i];
+        } else if (std::strchr(REGEX_SPECIAL_CHARS, c)) {
+            is_regex = true;
+            break;
+        } else {
+            glob_ += c;
+        }
+    }
+
+    if (is_regex) {
+        kind_ = Kind::REGEX;
+        glob_.clear();
+        regex_ = glob_pattern_to_regex(pattern_);
+        return;
+    }
+
+    prefix_len_ = glob_.find('*');
+    if (prefix_len_ == std::string::npos) {
+        kind_ = Kind::EXACT;
+        prefix_len_ = glob_.size();
+    } else {
+        kind_ = Kind::GLOB;
+    }
+}
+
+std::string_view SdcNamePattern::literal_prefix() const {
+    return std::string_view(glob_).substr(0, prefix_len_);
+}
+
+bool SdcNamePattern::matches(std::string_view name) const {
+    switch (kind_) {
+        case Kind::EXACT:
+            return name == glob_;
+        case Kind::GLOB:
+            return glob_match(glob_, name);
+        default:
+            VTR_ASSERT(kind_ == Kind::REGEX);
+            return std::regex_match(name.begin(), name.end(), regex_);
+    }
+}
+
+//Converts a glob pattern to a std::regex
+std::regex glob_pattern_to_regex(const std::string& glob_pattern) {
+    //In glob (i.e. unix-shell style):
+    //   '*' is a wildcard match of zero or more instances of any characters
+    //
+    //In regex:
+    //   '*' matches zero or more of the preceeding character
+    //   '.' matches any character
+    //
+    //To convert a glob to a regex we need to:
+    //   Convert '.' to "\.", so literal '.' in glob is treated as literal in the regex
+    //   Convert '*' to ".*" so literal '*' in glob matches any sequence
+
+    std::string regex_str = vtr::replace_all(glob_pattern, ".", "\\.");
+    regex_str = vtr::replace_all(regex_str, "*", ".*");
+
+    return std::regex(regex_str);
+}
+
+//Returns true if all of name matches glob, where '*' matches any (possibly empty)
+//sequence of characters and all other characters match themselves
+static bool glob_match(std::string_view glob, std::string_view name) {
+    size_t iglob = 0;
+    size_t iname = 0;
+
+    //Position of the last '*' seen, and of the name character it is currently matched up to,
+    //to backtrack to when the characters after it do not match
+    size_t star_glob = std::string_view::npos;
+    size_t star_name = 0;
+
+    while (iname < name.size()) {
+        if (iglob < glob.size() && glob[iglob] == '*') {
+            star_glob = iglob++;
+            star_name = iname;
+        } else if (iglob < glob.size() && glob[iglob] == name[iname]) {
+            ++iglob;
+            ++iname;
+        } else if (star_glob != std::string_view::npos) {
+            //Let the last '*' match one more character
+            iglob = star_glob + 1;
+            iname = ++star_name;
+        } else {
+            return false;
+        }
+    }
+
+    //Any remaining glob must only be '*'s matching nothing
+    while (iglob < glob.size() && glob[iglob] == '*') {
+        ++iglob;
+    }
+    return iglob == glob.size();
+}
@@ -0,0 +1,135 @@
+#ifndef VPR_SDC_NAME_INDEX_H
+#define VPR_SDC_NAME_INDEX_H
+#include <algorithm>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//Converts a glob pattern to a std::regex
+std::regex glob_pattern_to_regex(const std::string& glob_pattern);
+
+//A name or pattern targeted by an SDC command (e.g. in get_pins/get_ports/get_clocks)
+//
+//SDC targets are glob-style patterns ('*' matches any sequence of characters), which
+//are matched as regexes (see glob_pattern_to_regex()), so they may also use other regex
+//syntax. Since building and running a std::regex is slow, patterns which use no other
+//regex syntax (except backslash-escaped literal characters, e.g. 'out\[0\]') are matched
+//directly, and patterns without any '*' are exact names.
+class SdcNamePattern {
+  public:
+    explicit SdcNamePattern(const std::string& pattern);
+
+    const std::string& str() const { return pattern_; }
+
+    //Returns true if the pattern only matches the name equal to it
+    bool is_exact() const { return kind_ == Kind::EXACT; }
+
+    //Returns true if the pattern must be matched as a regex
+    bool is_regex() const { return kind_ == Kind::REGEX; }
+
+    //Returns the prefix of all the names the pattern matches (empty for regexes),
+    //which is the whole matching name for exact patterns
+    std::string_view literal_prefix() const;
+
+    //Returns true if name matches the pattern
+    bool matches(std::string_view name) const;
+
+  private:
+    enum class Kind {
+        EXACT, //No wildcards
+        GLOB,  //Only '*' wildcards
+        REGEX  //Other regex syntax
+    };
+
+    std::string pattern_;
+    Kind kind_;
+    std::string glob_;      //Pattern with escapes removed, where each '*' is a wildcard (not for Kind::REGEX)
+    size_t prefix_len_ = 0; //Length of the literal prefix of glob_ before the first wildcard
+    std::regex regex_;      //Only built for Kind::REGEX
+};
+
+//An index of named objects (e.g. netlist pins) to look up the objects matching SDC name patterns.
+//
+//Exact names are looked up in a hash table, and glob patterns only scan the (sorted) names
+//starting with their literal prefix before the first wildcard. Only real regexes scan all names.
+//
+//All names must be added before build(), which must be called before any lookups.
+template<typename T>
+class SdcNameIndex {
+  public:
+    SdcNameIndex() = default;
+
+    //The hashed names refer to the sorted names, so are only valid for this object
+    SdcNameIndex(const SdcNameIndex&) = delete;
+    SdcNameIndex& operator=(const SdcNameIndex&) = delete;
+
+    void add(std::string name, T object) {
+        entries_.emplace_back(std::move(name), object);
+    }
+
+    void build() {
+        std::stable_sort(entries_.begin(), entries_.end(), [](const Entry& lhs, const Entry& rhs) {
+            return lhs.first < rhs.first;
+        });
+
+        //Names with several objects are adjacent after sorting, so only their first entry is hashed
+        exact_.clear();
+        exact_.reserve(entries_.size());
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            exact_.emplace(std::string_view(entries_[i].first), i);
+        }
+    }
+
+    size_t size() const { return entries_.size(); }
+
+    //Calls callback(object) for each object whose name matches pattern,
+    //in name order. Returns true if any matched.
+    template<typename F>
+    bool for_each_match(const SdcNamePattern& pattern, F&& callback) const {
+        size_t begin = 0;
+        size_t end = entries_.size();
+
+        if (pattern.is_exact()) {
+            std::string_view name = pattern.literal_prefix();
+            auto iter = exact_.find(name);
+            if (iter == exact_.end()) {
+                return false;
+            }
+            begin = iter->second;
+            end = begin;
+            while (end < entries_.size() && entries_[end].first == name) {
+                ++end;
+            }
+        } else if (!pattern.is_regex()) {
+            std::string_view prefix = pattern.literal_prefix();
+            auto first = std::lower_bound(entries_.begin(), entries_.end(), prefix, [](const Entry& entry, std::string_view value) {
+                return std::string_view(entry.first) < value;
+            });
+            begin = first - entries_.begin();
+            end = begin;
+            while (end < entries_.size() && std::string_view(entries_[end].first).substr(0, prefix.size()) == prefix) {
+                ++end;
+            }
+        }
+
+        bool found = false;
+        for (size_t i = begin; i < end; ++i) {
+            if (pattern.is_exact() || pattern.matches(entries_[i].first)) {
+                found = true;
+                callback(entries_[i].second);
+            }
+        }
+        return found;
+    }
+
+  private:
+    typedef std::pair<std::string, T> Entry;
+
+    std::vector<Entry> entries_;                          //Sorted by name
+    std::unordered_map<std::string_view, size_t> exact_; //Name -> first index in entries_
+};
+
+#endif
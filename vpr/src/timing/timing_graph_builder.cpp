@@ -216,8 +216,13 @@
  * for convenience (i.e. both map to the same tnode).
  *
  */
+#include <numeric>
 #include <set>
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 #include "vtr_log.h"
 #include "vtr_linear_map.h"
 
@@ -234,6 +239,18 @@ using tatum::NodeId;
 using tatum::NodeType;
 using tatum::TimingGraph;
 
+//Calls func(i) for each i in [0, num), in parallel if VPR is built with TBB
+template<typename F>
+static void parallel_for_index(size_t num, const F& func) {
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num, func);
+#else
+    for (size_t i = 0; i < num; ++i) {
+        func(i);
+    }
+#endif
+}
+
 template<class K, class V>
 tatum::util::linear_map<K, V> remap_valid(const tatum::util::linear_map<K, V>& data, const tatum::util::linear_map<K, K>& id_map) {
     tatum::util::linear_map<K, V> new_data;
@@ -278,10 +295,8 @@ void TimingGraphBuilder::build(bool allow_dangling_combinational_nodes) {
     // Set by `--allow_dangling_combinational_nodes on`. Default value is false
     tg_->set_allow_dangling_combinational_nodes(allow_dangling_combinational_nodes);
 
-    //Walk through the netlist blocks creating the timing sub-graphs corresponding to
-    //each block (i.e. the timing nodes and internal edges of the block)
-    //
-    //Note that this does not add timing graph edges which are external to each block.
+    //Walk through the netlist blocks creating the timing nodes corresponding to
+    //each block
     for (AtomBlockId blk : netlist_.blocks()) {
         AtomBlockType blk_type = netlist_.block_type(blk);
 
@@ -294,12 +309,10 @@ void TimingGraphBuilder::build(bool allow_dangling_combinational_nodes) {
         }
     }
 
-    //Walk through the netlist nets adding the edges representing each net to
-    //the timiing graph. This connects the timing graph nodes of each netlist
-    //block together.
-    for (AtomNetId net : netlist_.nets()) {
-        add_net_to_timing_graph(net);
-    }
+    //Create the internal edges of each block (completing the timing sub-graph
+    //corresponding to each block), and the edges representing each net (which
+    //connect the timing sub-graphs of the netlist blocks together)
+    add_timing_edges();
 
     //Break any combinational loops (i.e. if the graph is not a DAG)
     fix_comb_loops();
@@ -356,7 +369,7 @@ void TimingGraphBuilder::add_io_to_timing_graph(const AtomBlockId blk) {
     netlist_lookup_.set_atom_pin_tnode(pin, tnode, BlockTnode::EXTERNAL);
 }
 
-//Creates the timing graph nodes and internal edges for a netlist block
+//Creates the timing graph nodes for a netlist block (its internal edges are created by add_timing_edges())
 void TimingGraphBuilder::add_block_to_timing_graph(const AtomBlockId blk) {
     /*
      * How the code builds the primtive timing sub-graph
@@ -368,8 +381,9 @@ void TimingGraphBuilder::add_block_to_timing_graph(const AtomBlockId blk) {
      * tnodes (note that if internal sequentail paths exist within the primitive 
      * this also creates the appropriate internal tnodes).
      *
-     * Once all nodes have been created the edges are added between them according
-     * to what was specified in the architecture file models.
+     * Once the nodes of all blocks have been created the edges are added between them
+     * (see add_timing_edges()) according to what was specified in the architecture file
+     * models.
      *
      * Note that to minimize the size of the timing graph we only create tnodes and 
      * edges where they actually exist within the netlist. This means we do not create 
@@ -391,15 +405,14 @@ void TimingGraphBuilder::add_block_to_timing_graph(const AtomBlockId blk) {
      * SOURCE (and leave any combinational inputs to that node disconnected).
      */
 
-    auto clock_generator_tnodes = create_block_timing_nodes(blk);
-    create_block_internal_data_timing_edges(blk, clock_generator_tnodes);
-    create_block_internal_clock_timing_edges(blk, clock_generator_tnodes);
+    create_block_timing_nodes(blk);
 }
 
 //Constructs the timing graph nodes for the specified block
 //
-//Returns the set of created tnodese which are clock generators
-std::set<tatum::NodeId> TimingGraphBuilder::create_block_timing_nodes(const AtomBlockId blk) {
+//Note that the output pins which are clock generators (see is_netlist_clock_source())
+//are SOURCE tnodes
+void TimingGraphBuilder::create_block_timing_nodes(const AtomBlockId blk) {
     std::set<std::string> output_ports_used_as_combinational_sinks;
 
     //Create the tnodes corresponding to input pins
@@ -458,7 +471,6 @@ std::set<tatum::NodeId> TimingGraphBuilder::create_block_timing_nodes(const Atom
     }
 
     //Create the output pins
-    std::set<tatum::NodeId> clock_generator_tnodes;
     for (AtomPinId output_pin : netlist_.block_output_pins(blk)) {
         AtomPortId output_port = netlist_.pin_port(output_pin);
 
@@ -470,8 +482,6 @@ std::set<tatum::NodeId> TimingGraphBuilder::create_block_timing_nodes(const Atom
             //A generated clock source
             tnode = tg_->add_node(NodeType::SOURCE);
 
-            clock_generator_tnodes.insert(tnode);
-
             if (!model_port->is_clock) {
                 //An implicit clock source, possibly clock derived from data
 
@@ -512,18 +522,103 @@ std::set<tatum::NodeId> TimingGraphBuilder::create_block_timing_nodes(const Atom
         //Record as external tnode
         netlist_lookup_.set_atom_pin_tnode(output_pin, tnode, BlockTnode::EXTERNAL);
     }
+}
+
+//Creates the timing graph edges, in parallel if VPR is built with TBB
+void TimingGraphBuilder::add_timing_edges() {
+    //The edges are generated directly into preallocated arrays, which are then added
+    //to the timing graph at once. The edges of each block (and net) are counted first to
+    //find where they go in the arrays, so the edges (and their ids) are in the same order
+    //as when created one block at a time: each block's internal edges in block order,
+    //followed by each net's edges in net order.
+    std::vector<AtomBlockId> blocks(netlist_.blocks().begin(), netlist_.blocks().end());
+    std::vector<AtomNetId> nets(netlist_.nets().begin(), netlist_.nets().end());
+
+    //The edges of block i begin at edges_begin[i], and those of net i at edges_begin[blocks.size() + i]
+    std::vector<size_t> edges_begin(blocks.size() + nets.size() + 1, 0);
+
+    //Count the internal edges of each block
+    std::vector<char> block_has_messages(blocks.size(), false); //Not vector<bool>, which can not be written concurrently
+    parallel_for_index(blocks.size(), [&](size_t iblk) {
+        size_t num_edges = 0;
+        block_has_messages[iblk] = create_block_internal_timing_edges(blocks[iblk], /*report=*/false, [&](tatum::EdgeType, NodeId, NodeId) {
+            ++num_edges;
+        });
+        edges_begin[iblk + 1] = num_edges;
+    });
+
+    //Report any messages about the block edges serially, so they are in a deterministic order
+    for (size_t iblk = 0; iblk < blocks.size(); ++iblk) {
+        if (!block_has_messages[iblk]) continue;
+
+        create_block_internal_timing_edges(blocks[iblk], /*report=*/true, [](tatum::EdgeType, NodeId, NodeId) {});
+    }
 
-    return clock_generator_tnodes;
+    //Count the edges of each net
+    for (size_t inet = 0; inet < nets.size(); ++inet) {
+        AtomNetId net = nets[inet];
+        if (!netlist_.net_driver(net)) {
+            //Undriven nets have no timing dependencies, and hence no edges
+            VTR_LOG_WARN("Net %s has no driver and will be ignored for timing purposes\n", netlist_.net_name(net).c_str());
+            continue;
+        }
+        edges_begin[blocks.size() + inet + 1] = netlist_.net_sinks(net).size();
+    }
+
+    std::partial_sum(edges_begin.begin(), edges_begin.end(), edges_begin.begin());
+
+    //Generate the edges
+    size_t num_edges = edges_begin.back();
+    std::vector<tatum::EdgeType> edge_types(num_edges);
+    std::vector<NodeId> edge_src_tnodes(num_edges);
+    std::vector<NodeId> edge_sink_tnodes(num_edges);
+
+    auto generate_edges = [&](size_t ibegin, auto&& create_edges) {
+        size_t iedge = edges_begin[ibegin];
+        create_edges([&](tatum::EdgeType type, NodeId src_tnode, NodeId sink_tnode) {
+            edge_types[iedge] = type;
+            edge_src_tnodes[iedge] = src_tnode;
+            edge_sink_tnodes[iedge] = sink_tnode;
+            ++iedge;
+        });
+        VTR_ASSERT_SAFE(iedge == edges_begin[ibegin + 1]);
+    };
+
+    parallel_for_index(blocks.size(), [&](size_t iblk) {
+        generate_edges(iblk, [&](auto&& add_edge) {
+            create_block_internal_timing_edges(blocks[iblk], /*report=*/false, add_edge);
+        });
+    });
+
+    parallel_for_index(nets.size(), [&](size_t inet) {
+        generate_edges(blocks.size() + inet, [&](auto&& add_edge) {
+            create_net_timing_edges(nets[inet], add_edge);
+        });
+    });
+
+    tg_->add_edges(edge_types, edge_src_tnodes, edge_sink_tnodes);
+}
+
+template<typename F>
+bool TimingGraphBuilder::create_block_internal_timing_edges(const AtomBlockId blk, bool report, F&& add_edge) const {
+    if (netlist_.block_type(blk) != AtomBlockType::BLOCK) return false; //Primary I/Os have no internal edges
+
+    bool has_messages = create_block_internal_data_timing_edges(blk, report, add_edge);
+    has_messages |= create_block_internal_clock_timing_edges(blk, report, add_edge);
+    return has_messages;
 }
 
-void TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBlockId blk, const std::set<tatum::NodeId>& clock_generator_tnodes) {
+template<typename F>
+bool TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBlockId blk, bool report, F&& add_edge) const {
+    bool has_messages = false;
+
     //Connect the clock pins to the sources and sinks
     for (AtomPinId pin : netlist_.block_pins(blk)) {
         for (auto blk_tnode_type : {BlockTnode::EXTERNAL, BlockTnode::INTERNAL}) {
             NodeId tnode = netlist_lookup_.atom_pin_tnode(pin, blk_tnode_type);
             if (!tnode) continue;
 
-            if (clock_generator_tnodes.count(tnode)) continue; //Clock sources don't have incoming clock pin connections
+            if (is_netlist_clock_source(pin)) continue; //Clock sources don't have incoming clock pin connections
 
             auto node_type = tg_->node_type(tnode);
 
@@ -564,7 +659,7 @@ void TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBloc
             }
 
             //Add the edge from the clock to the source/sink
-            tg_->add_edge(type, clk_tnode, tnode);
+            add_edge(type, clk_tnode, tnode);
         }
     }
 
@@ -590,14 +685,23 @@ void TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBloc
                 //Get the tnode of the sink
                 NodeId sink_tnode = netlist_lookup_.atom_pin_tnode(sink_pin, BlockTnode::EXTERNAL);
 
-                tg_->add_edge(tatum::EdgeType::PRIMITIVE_COMBINATIONAL, src_tnode, sink_tnode);
-                VTR_LOG("Adding edge from '%s' (tnode: %zu) -> '%s' (tnode: %zu) to allow clocks to propagate\n", netlist_.pin_name(src_clock_pin).c_str(), size_t(src_tnode), netlist_.pin_name(sink_pin).c_str(), size_t(sink_tnode));
+                add_edge(tatum::EdgeType::PRIMITIVE_COMBINATIONAL, src_tnode, sink_tnode);
+
+                has_messages = true;
+                if (report) {
+                    VTR_LOG("Adding edge from '%s' (tnode: %zu) -> '%s' (tnode: %zu) to allow clocks to propagate\n", netlist_.pin_name(src_clock_pin).c_str(), size_t(src_tnode), netlist_.pin_name(sink_pin).c_str(), size_t(sink_tnode));
+                }
             }
         }
     }
+
+    return has_messages;
 }
 
-void TimingGraphBuilder::create_block_internal_data_timing_edges(const AtomBlockId blk, const std::set<tatum::NodeId>& clock_generator_tnodes) {
+template<typename F>
+bool TimingGraphBuilder::create_block_internal_data_timing_edges(const AtomBlockId blk, bool report, F&& add_edge) const {
+    bool has_messages = false;
+
     //Connect the combinational edges from data input pins
     //
     //These edges may represent an intermediate (combinational) sub-path of a
@@ -634,12 +738,14 @@ void TimingGraphBuilder::create_block_internal_data_timing_edges(const AtomBlock
 
                 if (!sink_tnode) {
                     //No tnode found, either a combinational clock generator or an error
+                    has_messages = true;
+                    if (!report) continue;
 
                     //Try again looking for an external tnode
                     sink_tnode = netlist_lookup_.atom_pin_tnode(sink_pin, BlockTnode::EXTERNAL);
 
                     //Is the sink a clock generator?
-                    if (sink_tnode && clock_generator_tnodes.count(sink_tnode)) {
+                    if (sink_tnode && is_netlist_clock_source(sink_pin)) {
                         //Do not create the edge
                         VTR_LOG_WARN("Timing edge from %s to %s will not be created since %s has been identified as a clock generator\n",
                                      netlist_.pin_name(src_pin).c_str(), netlist_.pin_name(sink_pin).c_str(), netlist_.pin_name(sink_pin).c_str());
@@ -660,23 +766,23 @@ void TimingGraphBuilder::create_block_internal_data_timing_edges(const AtomBlock
                                    "Internal primitive combinational edges must be between {IPIN, SOURCE} and {OPIN, SINK}");
 
                     //Add the edge between the pins
-                    tg_->add_edge(tatum::EdgeType::PRIMITIVE_COMBINATIONAL, src_tnode, sink_tnode);
+                    add_edge(tatum::EdgeType::PRIMITIVE_COMBINATIONAL, src_tnode, sink_tnode);
                 }
             }
         }
     }
+
+    return has_messages;
 }
 
-void TimingGraphBuilder::add_net_to_timing_graph(const AtomNetId net) {
+template<typename F>
+void TimingGraphBuilder::create_net_timing_edges(const AtomNetId net, F&& add_edge) const {
     //Create edges from the driver to sink tnodes
 
     AtomPinId driver_pin = netlist_.net_driver(net);
 
-    if (!driver_pin) {
-        //Undriven nets have no timing dependencies, and hence no edges
-        VTR_LOG_WARN("Net %s has no driver and will be ignored for timing purposes\n", netlist_.net_name(net).c_str());
-        return;
-    }
+    //Undriven nets have no timing dependencies, and hence no edges
+    if (!driver_pin) return;
 
     NodeId driver_tnode = netlist_lookup_.atom_pin_tnode(driver_pin);
     VTR_ASSERT(driver_tnode);
@@ -685,7 +791,7 @@ void TimingGraphBuilder::add_net_to_timing_graph(const AtomNetId net) {
         NodeId sink_tnode = netlist_lookup_.atom_pin_tnode(sink_pin);
         VTR_ASSERT(sink_tnode);
 
-        tg_->add_edge(tatum::EdgeType::INTERCONNECT, driver_tnode, sink_tnode);
+        add_edge(tatum::EdgeType::INTERCONNECT, driver_tnode, sink_tnode);
     }
 }
 
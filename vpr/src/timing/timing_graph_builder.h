@@ -29,12 +29,23 @@ class TimingGraphBuilder {
 
     void add_io_to_timing_graph(const AtomBlockId blk);
     void add_block_to_timing_graph(const AtomBlockId blk);
-    void add_net_to_timing_graph(const AtomNetId net);
+    void add_timing_edges();
 
     //Helper functions for add_block_to_timing_graph()
-    std::set<tatum::NodeId> create_block_timing_nodes(const AtomBlockId blk);
-    void create_block_internal_data_timing_edges(const AtomBlockId blk, const std::set<tatum::NodeId>& clock_generator_tnodes);
-    void create_block_internal_clock_timing_edges(const AtomBlockId blk, const std::set<tatum::NodeId>& clock_generator_tnodes);
+    void create_block_timing_nodes(const AtomBlockId blk);
+
+    //Helper functions for add_timing_edges(), which call add_edge(type, src_tnode, sink_tnode)
+    //for each edge (in order). They only read the netlist and timing graph so may be called concurrently,
+    //and the block functions only report messages (and errors) about the edges if report is true,
+    //returning whether there were any
+    template<typename F>
+    bool create_block_internal_timing_edges(const AtomBlockId blk, bool report, F&& add_edge) const;
+    template<typename F>
+    bool create_block_internal_data_timing_edges(const AtomBlockId blk, bool report, F&& add_edge) const;
+    template<typename F>
+    bool create_block_internal_clock_timing_edges(const AtomBlockId blk, bool report, F&& add_edge) const;
+    template<typename F>
+    void create_net_timing_edges(const AtomNetId net, F&& add_edge) const;
 
     void fix_comb_loops();
     tatum::EdgeId find_scc_edge_to_break(std::vector<tatum::NodeId> scc);
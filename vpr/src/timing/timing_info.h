@@ -6,6 +6,7 @@
 #include "tatum/analyzer_factory.hpp"
 #include "tatum/timing_paths.hpp"
 #include "timing_util.h"
+#include "vpr_net_pins_matrix.h"
 
 //Generic inteface which provides functionality to update (but not
 //access) timing information.
@@ -86,9 +87,18 @@ class SetupTimingInfo : public virtual TimingInfo {
     //Return the range of pins with modified setup criticality
     virtual pin_range pins_with_modified_setup_criticality() const = 0;
 
+    //Return the setup criticalities of the pins of the netlist passed to track_net_pin_criticalities(),
+    //indexed by net and net pin index
+    virtual const NetPinsMatrix<float>& net_pin_criticalities() const = 0;
+
   public:
     //Mutators
     virtual void update_setup() = 0;
+
+    //Keep the net_pin_criticalities() of the pins of net_list up to date (only recalculating
+    //the pins with modified criticality after each update), until called with a null net_list.
+    //The cluster pins of net_list are mapped to atom pins with pin_lookup, unless is_flat.
+    virtual void track_net_pin_criticalities(const Netlist<>* net_list, const ClusteredPinAtomPinsLookup* pin_lookup, bool is_flat) = 0;
 };
 
 //Generic interface which provides setup-related timing information
@@ -0,0 +1,106 @@
+#include "timing_metrics.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/analyzers/SetupTimingAnalyzer.hpp"
+
+#include "globals.h"
+#include "vpr_error.h"
+#include "timing_info.h"
+#include "timing_util.h"
+
+TimingMetricsLog::TimingMetricsLog(const std::string& filename, size_t buffer_size, float flush_interval)
+    : os_(filename)
+    , buffer_size_(std::max<size_t>(buffer_size, 1))
+    , flush_interval_(flush_interval) {
+    if (!os_) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to open timing metrics file '%s'\n", filename.c_str());
+    }
+    buffer_.reserve(buffer_size_);
+
+    os_ << "{\"slack_histogram_upper_bounds_ns\":[";
+    for (size_t ibound = 0; ibound < SLACK_BUCKET_UPPER_BOUNDS_NS.size(); ++ibound) {
+        if (ibound != 0) os_ << ",";
+        os_ << SLACK_BUCKET_UPPER_BOUNDS_NS[ibound];
+    }
+    os_ << "]}\n";
+    os_.flush();
+}
+
+TimingMetricsLog::~TimingMetricsLog() {
+    flush();
+}
+
+void TimingMetricsLog::record(const char* stage, size_t iteration, const tatum::TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& setup_analyzer) {
+    Sample sample = make_sample(timing_graph, setup_analyzer);
+    sample.stage = stage;
+    sample.iteration = iteration;
+    sample.elapsed_sec = timer_.elapsed_sec();
+    buffer_.push_back(sample);
+
+    if (buffer_.size() >= buffer_size_ || sample.elapsed_sec - last_flush_sec_ >= flush_interval_) {
+        flush();
+    }
+}
+
+void TimingMetricsLog::flush() {
+    for (const Sample& sample : buffer_) {
+        write_sample(sample);
+    }
+    buffer_.clear();
+    os_.flush();
+
+    last_flush_sec_ = timer_.elapsed_sec();
+}
+
+TimingMetricsLog::Sample TimingMetricsLog::make_sample(const tatum::TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& setup_analyzer) {
+    Sample sample;
+    sample.stage = "";
+    sample.iteration = 0;
+    sample.elapsed_sec = 0.;
+    sample.wns = 0.;
+    sample.tns = 0.;
+    sample.slack_histogram.fill(0);
+
+    for (tatum::NodeId node : timing_graph.logical_outputs()) {
+        for (tatum::TimingTag tag : setup_analyzer.setup_slacks(node)) {
+            float slack = tag.time().value();
+            if (std::isnan(slack)) continue;
+
+            if (slack < 0.) {
+                sample.wns = std::min(sample.wns, slack);
+                sample.tns += slack;
+            }
+
+            //The first bucket whose upper bound is not below the slack
+            size_t ibucket = std::lower_bound(SLACK_BUCKET_UPPER_BOUNDS_NS.begin(), SLACK_BUCKET_UPPER_BOUNDS_NS.end(), float(sec_to_nanosec(slack)))
+                             - SLACK_BUCKET_UPPER_BOUNDS_NS.begin();
+            ++sample.slack_histogram[ibucket];
+        }
+    }
+
+    return sample;
+}
+
+void TimingMetricsLog::write_sample(const Sample& sample) {
+    os_ << "{\"stage\":\"" << sample.stage << "\""
+        << ",\"iteration\":" << sample.iteration
+        << ",\"elapsed_s\":" << sample.elapsed_sec
+        << ",\"wns_ns\":" << sec_to_nanosec(sample.wns)
+        << ",\"tns_ns\":" << sec_to_nanosec(sample.tns)
+        << ",\"slack_histogram\":[";
+    for (size_t ibucket = 0; ibucket < sample.slack_histogram.size(); ++ibucket) {
+        if (ibucket != 0) os_ << ",";
+        os_ << sample.slack_histogram[ibucket];
+    }
+    os_ << "]}\n";
+}
+
+void record_timing_metrics(const char* stage, size_t iteration, const SetupTimingInfo& timing_info) {
+    const auto& metrics_log = g_vpr_ctx.timing().metrics_log;
+    if (!metrics_log) return;
+
+    metrics_log->record(stage, iteration, *timing_info.timing_graph(), *timing_info.setup_analyzer());
+}
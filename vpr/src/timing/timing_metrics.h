@@ -0,0 +1,78 @@
+#ifndef VPR_TIMING_METRICS_H
+#define VPR_TIMING_METRICS_H
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "vtr_time.h"
+
+#include "tatum/TimingGraphFwd.hpp"
+#include "tatum/timing_analyzers_fwd.hpp"
+
+#include "timing_info_fwd.h"
+
+//Records a small, fixed-size summary of the setup timing after each timing update (e.g. in the
+//placer and router), so the progress of optimization can be monitored while VPR runs.
+//
+//The samples are recorded into a fixed-size buffer, which is written (appended) to the output file
+//as JSON lines when it is full, when flush_interval seconds have passed since it was last written,
+//and on destruction. The first line describes the slack histogram buckets, e.g.:
+//
+//  {"slack_histogram_upper_bounds_ns":[-5,-2,-1,-0.5,-0.2,-0.1,0,0.1,0.2,0.5,1,2,5]}
+//  {"stage":"route","iteration":3,"elapsed_s":12.5,"wns_ns":-0.25,"tns_ns":-3.5,"slack_histogram":[0,0,0,0,2,5,20,31,40,52,80,61,14,3]}
+//
+//where each slack histogram counts the setup slacks of all timing endpoints, and has one more bucket
+//than there are upper bounds (for the slacks above the largest bound).
+//
+//Recording a sample only walks the slacks of the timing endpoints (once), so is cheap compared to
+//the timing update itself.
+class TimingMetricsLog {
+  public:
+    //Upper bounds (inclusive) of the slack histogram buckets, except the last (which is unbounded)
+    static constexpr std::array<float, 13> SLACK_BUCKET_UPPER_BOUNDS_NS = {-5., -2., -1., -0.5, -0.2, -0.1, 0., 0.1, 0.2, 0.5, 1., 2., 5.};
+    static constexpr size_t NUM_SLACK_BUCKETS = SLACK_BUCKET_UPPER_BOUNDS_NS.size() + 1;
+
+    struct Sample {
+        const char* stage; //e.g. "place", "route"
+        size_t iteration;  //Stage specific progress, e.g. the router iteration
+        float elapsed_sec; //Since the log was created
+        float wns;         //Setup Worst Negative Slack (seconds)
+        float tns;         //Setup Total Negative Slack (seconds)
+        std::array<unsigned, NUM_SLACK_BUCKETS> slack_histogram;
+    };
+
+  public:
+    TimingMetricsLog(const std::string& filename, size_t buffer_size = 256, float flush_interval = 1.);
+    ~TimingMetricsLog();
+
+    TimingMetricsLog(const TimingMetricsLog&) = delete;
+    TimingMetricsLog& operator=(const TimingMetricsLog&) = delete;
+
+    //Records the setup timing of timing_graph analyzed by setup_analyzer (after a timing update)
+    void record(const char* stage, size_t iteration, const tatum::TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& setup_analyzer);
+
+    //Writes all buffered samples to the output file
+    void flush();
+
+    //Returns the summary of the setup timing of timing_graph analyzed by setup_analyzer
+    static Sample make_sample(const tatum::TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& setup_analyzer);
+
+  private:
+    void write_sample(const Sample& sample);
+
+  private:
+    std::ofstream os_;
+    std::vector<Sample> buffer_; //Samples not yet written (reserved to buffer_size)
+    size_t buffer_size_;
+    float flush_interval_;
+
+    vtr::Timer timer_;
+    float last_flush_sec_ = 0.;
+};
+
+//Records the current setup timing of timing_info into the timing metrics log, if there is one (see TimingContext::metrics_log)
+void record_timing_metrics(const char* stage, size_t iteration, const SetupTimingInfo& timing_info);
+
+#endif
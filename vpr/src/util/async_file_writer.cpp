@@ -0,0 +1,125 @@
+#include "async_file_writer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <new>
+
+#include <zlib.h>
+
+#include "vtr_util.h"
+
+AsyncFileWriter::AsyncFileWriter(size_t max_queued_bytes)
+    : max_queued_bytes_(max_queued_bytes) {}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    queued_cv_.notify_one();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void AsyncFileWriter::write(std::string file, std::string contents) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    //Contents larger than the whole queue are accepted once it is empty
+    written_cv_.wait(lock, [&]() {
+        return queue_.empty() || queued_bytes_ + contents.size() <= max_queued_bytes_;
+    });
+
+    queued_bytes_ += contents.size();
+    queue_.push_back({std::move(file), std::move(contents)});
+
+    if (!thread_.joinable()) {
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    lock.unlock();
+    queued_cv_.notify_one();
+}
+
+std::vector<std::string> AsyncFileWriter::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    written_cv_.wait(lock, [&]() { return queue_.empty() && !writing_; });
+
+    std::vector<std::string> failed_files;
+    std::swap(failed_files, failed_files_);
+    return failed_files;
+}
+
+void AsyncFileWriter::reset_after_fork() {
+    //The thread object refers to a thread of the parent process, so it is replaced without being joined
+    new (&thread_) std::thread();
+}
+
+void AsyncFileWriter::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        //On stop, the remaining queued files are still written
+        queued_cv_.wait(lock, [&]() { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            break;
+        }
+
+        t_queued_file queued = std::move(queue_.front());
+        queue_.pop_front();
+        writing_ = true;
+
+        lock.unlock();
+        bool ok = write_file(queued.file, queued.contents);
+        size_t num_bytes = queued.contents.size();
+        std::string().swap(queued.contents); //Free the contents before the space is given back
+        lock.lock();
+
+        if (!ok) {
+            failed_files_.push_back(std::move(queued.file));
+        }
+        queued_bytes_ -= num_bytes;
+        writing_ = false;
+        written_cv_.notify_all();
+    }
+}
+
+bool AsyncFileWriter::write_file(const std::string& file, const std::string& contents) {
+    if (vtr::check_file_name_extension(file, ".gz")) {
+        gzFile fp = gzopen(file.c_str(), "wb");
+        if (!fp) return false;
+
+        //gzwrite() takes an unsigned count, so large contents are written in chunks
+        constexpr size_t MAX_CHUNK_BYTES = 1 << 30;
+        bool ok = true;
+        for (size_t pos = 0; ok && pos < contents.size(); pos += MAX_CHUNK_BYTES) {
+            unsigned chunk_bytes = std::min(contents.size() - pos, MAX_CHUNK_BYTES);
+            ok = gzwrite(fp, contents.data() + pos, chunk_bytes) == int(chunk_bytes);
+        }
+        return gzclose(fp) == Z_OK && ok;
+    }
+
+    FILE* fp = std::fopen(file.c_str(), "wb");
+    if (!fp) return false;
+    bool ok = std::fwrite(contents.data(), 1, contents.size(), fp) == contents.size();
+    return std::fclose(fp) == 0 && ok;
+}
+
+AsyncFileWriter& async_file_writer() {
+    static AsyncFileWriter writer;
+    return writer;
+}
+
+AsyncOutputFile::AsyncOutputFile(std::string file)
+    : file_(std::move(file)) {}
+
+AsyncOutputFile::~AsyncOutputFile() {
+    close();
+}
+
+void AsyncOutputFile::close() {
+    if (closed_) return;
+    closed_ = true;
+
+    async_file_writer().write(std::move(file_), str());
+    str(std::string());
+}
@@ -0,0 +1,113 @@
+#ifndef VPR_ASYNC_FILE_WRITER_H
+#define VPR_ASYNC_FILE_WRITER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Writes files on a background thread
+ *
+ * Reports (e.g. the timing and routing overuse reports) and the packed netlist file
+ * are formatted in memory, then handed over to be written to disk (and gzip compressed,
+ * for files ending in ".gz") by a background thread, so the flow does not wait on the
+ * file system. Echo files are still written directly by their writers.
+ *
+ * The files waiting to be written are held in a bounded queue: write() only blocks
+ * the caller while the queue is full, and wait() (called at exit by vpr_free_all())
+ * blocks until all queued files are written.
+ *
+ * Only files which are not read back by VPR itself should be written this way (the packed
+ * netlist file is, but its contents are loaded from memory in the run which writes it).
+ *
+ * Example:
+ *
+ *      {
+ *          AsyncOutputFile os("report_overused_nodes.rpt");
+ *          os << "Total number of overused nodes = " << num_overused << '\n';
+ *      } //Queued to be written when os goes out of scope
+ */
+class AsyncFileWriter {
+  public:
+    ///@brief Default maximum bytes of contents waiting to be written
+    static constexpr size_t DEFAULT_MAX_QUEUED_BYTES = 256 * 1024 * 1024;
+
+    explicit AsyncFileWriter(size_t max_queued_bytes = DEFAULT_MAX_QUEUED_BYTES);
+
+    ///@brief Waits for the queued files to be written
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    /**
+     * @brief Queues contents to be written to file (replacing it), blocking while the queue is full
+     *
+     * Files of the same name are written in the order they are queued.
+     */
+    void write(std::string file, std::string contents);
+
+    ///@brief Blocks until all queued files are written, returning (and forgetting) those which could not be
+    std::vector<std::string> wait();
+
+    /**
+     * @brief Forgets the background thread, in a process forked (after wait()) from the one which started it
+     *
+     * The thread does not exist in the forked process, so the next write() starts a new one.
+     */
+    void reset_after_fork();
+
+  private:
+    struct t_queued_file {
+        std::string file;
+        std::string contents;
+    };
+
+    ///@brief Writes the queued files until stopped (run by the background thread)
+    void run();
+
+    static bool write_file(const std::string& file, const std::string& contents);
+
+    size_t max_queued_bytes_;
+
+    std::mutex mutex_;
+    std::condition_variable queued_cv_;  ///<Notified when a file is queued (or on stop)
+    std::condition_variable written_cv_; ///<Notified when a file has been written
+
+    //Protected by mutex_
+    std::deque<t_queued_file> queue_;
+    size_t queued_bytes_ = 0;
+    bool writing_ = false; ///<Whether the background thread is writing a file (taken off the queue)
+    bool stop_ = false;
+    std::vector<std::string> failed_files_;
+
+    std::thread thread_; ///<Started when the first file is queued
+};
+
+///@brief Returns VPR's background file writer
+AsyncFileWriter& async_file_writer();
+
+/**
+ * @brief An output stream to a file which is written by async_file_writer()
+ *
+ * Its contents are queued to be written on close() (or destruction).
+ */
+class AsyncOutputFile : public std::ostringstream {
+  public:
+    explicit AsyncOutputFile(std::string file);
+    ~AsyncOutputFile();
+
+    ///@brief Queues the contents to be written (further output is discarded)
+    void close();
+
+  private:
+    std::string file_;
+    bool closed_ = false;
+};
+
+#endif
@@ -0,0 +1,79 @@
+#include "buffered_file_writer.h"
+
+#include <charconv>
+#include <limits>
+
+///@brief Size of the output buffer, large enough that writes are rare
+constexpr size_t BUFFERED_FILE_WRITER_BUFFER_SIZE = 1 << 20;
+
+BufferedFileWriter::BufferedFileWriter(const char* file, e_vpr_error error_type)
+    : file_(file)
+    , error_type_(error_type)
+    , buffer_(BUFFERED_FILE_WRITER_BUFFER_SIZE) {
+    fp_ = std::fopen(file, "w");
+    if (!fp_) {
+        vpr_throw(error_type_, file, 0, "Could not open file '%s' for writing.\n", file);
+    }
+}
+
+BufferedFileWriter::~BufferedFileWriter() {
+    if (fp_) {
+        flush();
+        std::fclose(fp_);
+    }
+}
+
+void BufferedFileWriter::close() {
+    if (!fp_) return;
+
+    flush();
+    if (std::fclose(fp_) != 0) {
+        failed_ = true;
+    }
+    fp_ = nullptr;
+
+    if (failed_) {
+        vpr_throw(error_type_, file_.c_str(), 0, "Failed to write file '%s'.\n", file_.c_str());
+    }
+}
+
+BufferedFileWriter& BufferedFileWriter::write_right_aligned(const char* str, size_t width) {
+    size_t len = std::strlen(str);
+    for (size_t i = len; i < width; ++i) {
+        *this << ' ';
+    }
+    return write(str, len);
+}
+
+template<typename T>
+BufferedFileWriter& BufferedFileWriter::write_integer(T value) {
+    //Sign and every digit
+    constexpr size_t max_chars = std::numeric_limits<T>::digits10 + 2;
+    if (buffer_.size() - used_ < max_chars) {
+        flush();
+    }
+
+    std::to_chars_result result = std::to_chars(buffer_.data() + used_, buffer_.data() + buffer_.size(), value);
+    used_ = result.ptr - buffer_.data();
+    return *this;
+}
+
+template BufferedFileWriter& BufferedFileWriter::write_integer(int);
+template BufferedFileWriter& BufferedFileWriter::write_integer(long);
+template BufferedFileWriter& BufferedFileWriter::write_integer(long long);
+template BufferedFileWriter& BufferedFileWriter::write_integer(unsigned);
+template BufferedFileWriter& BufferedFileWriter::write_integer(unsigned long);
+template BufferedFileWriter& BufferedFileWriter::write_integer(unsigned long long);
+
+void BufferedFileWriter::flush() {
+    if (used_ > 0) {
+        write_through(buffer_.data(), used_);
+        used_ = 0;
+    }
+}
+
+void BufferedFileWriter::write_through(const char* data, size_t len) {
+    if (std::fwrite(data, 1, len, fp_) != len) {
+        failed_ = true;
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef VPR_BUFFERED_FILE_WRITER_H
+#define VPR_BUFFERED_FILE_WRITER_H
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "vpr_error.h"
+
+/**
+ * @brief Writes a text file through a large in-memory buffer
+ *
+ * Large output files (e.g. .place and .route) are made of millions of short
+ * tokens. Formatting each of them with fprintf() (or an ostream) re-parses a
+ * format string and takes the stream lock per token, which dominates the
+ * time to write the file. Tokens are instead appended to a buffer, with
+ * integers formatted by std::to_chars(), and the buffer written out in large
+ * chunks.
+ *
+ * Example:
+ *
+ *      BufferedFileWriter out("circuit.place", VPR_ERROR_PLACE_F);
+ *      out << "Net " << size_t(net_id) << " (" << net_name << ")\n";
+ *      out.close();
+ */
+class BufferedFileWriter {
+  public:
+    ///@brief Opens file for writing, throwing a VprError of error_type if it can not be opened
+    BufferedFileWriter(const char* file, e_vpr_error error_type);
+
+    ///@brief Flushes and closes the file (if not already closed), ignoring any errors
+    ~BufferedFileWriter();
+
+    BufferedFileWriter(const BufferedFileWriter&) = delete;
+    BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+    ///@brief Flushes and closes the file, throwing a VprError if any of it could not be written
+    void close();
+
+    ///@brief Appends the len characters of str
+    BufferedFileWriter& write(const char* str, size_t len) {
+        if (len > buffer_.size() - used_) {
+            flush();
+            if (len > buffer_.size()) {
+                write_through(str, len);
+                return *this;
+            }
+        }
+        std::memcpy(buffer_.data() + used_, str, len);
+        used_ += len;
+        return *this;
+    }
+
+    ///@brief Appends str right-aligned in a field of width characters (like printf's %<width>s)
+    BufferedFileWriter& write_right_aligned(const char* str, size_t width);
+
+    ///@brief Appends str, or "(null)" if str is nullptr (as glibc's printf does)
+    BufferedFileWriter& operator<<(const char* str) {
+        if (!str) str = "(null)";
+        return write(str, std::strlen(str));
+    }
+    BufferedFileWriter& operator<<(const std::string& str) { return write(str.data(), str.size()); }
+    BufferedFileWriter& operator<<(char c) {
+        if (used_ == buffer_.size()) flush();
+        buffer_[used_++] = c;
+        return *this;
+    }
+    BufferedFileWriter& operator<<(int value) { return write_integer(value); }
+    BufferedFileWriter& operator<<(long value) { return write_integer(value); }
+    BufferedFileWriter& operator<<(long long value) { return write_integer(value); }
+    BufferedFileWriter& operator<<(unsigned value) { return write_integer(value); }
+    BufferedFileWriter& operator<<(unsigned long value) { return write_integer(value); }
+    BufferedFileWriter& operator<<(unsigned long long value) { return write_integer(value); }
+
+  private:
+    template<typename T>
+    BufferedFileWriter& write_integer(T value);
+
+    void flush();
+    void write_through(const char* data, size_t len);
+
+    std::string file_;
+    e_vpr_error error_type_;
+    FILE* fp_ = nullptr;
+    bool failed_ = false;
+
+    std::vector<char> buffer_;
+    size_t used_ = 0;
+};
+
+#endif
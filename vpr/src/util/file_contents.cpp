@@ -0,0 +1,56 @@
+#include "file_contents.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#    include <sys/mman.h>
+#    include <unistd.h>
+#else
+#    include <fstream>
+#    include <iterator>
+#endif
+
+FileContents::FileContents(const char* file, e_vpr_error error_type) {
+#ifndef _WIN32
+    int fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        vpr_throw(error_type, file, 0, "Could not open file '%s'.\n", file);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        vpr_throw(error_type, file, 0, "Could not stat file '%s'.\n", file);
+    }
+    size_ = st.st_size;
+
+    if (size_ > 0) {
+        void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED) {
+            vpr_throw(error_type, file, 0, "Could not mmap file '%s'.\n", file);
+        }
+        data_ = static_cast<const char*>(addr);
+        madvise(addr, size_, MADV_SEQUENTIAL);
+    } else {
+        close(fd);
+    }
+#else
+    //No mmap, fall back to reading the whole file
+    std::ifstream is(file, std::ios::binary);
+    if (!is) {
+        vpr_throw(error_type, file, 0, "Could not open file '%s'.\n", file);
+    }
+    contents_.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    data_ = contents_.data();
+    size_ = contents_.size();
+#endif
+}
+
+FileContents::~FileContents() {
+#ifndef _WIN32
+    if (data_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+}
@@ -0,0 +1,36 @@
+#ifndef VPR_FILE_CONTENTS_H
+#define VPR_FILE_CONTENTS_H
+
+#include <cstddef>
+#include <string>
+
+#include "vpr_error.h"
+
+/**
+ * @brief The read-only contents of a file, memory-mapped where supported
+ *
+ * Mapped pages are backed by the file, so scanning a large input file
+ * through a FileContents does not grow the resident memory of the process
+ * beyond what the OS chooses to cache.
+ */
+class FileContents {
+  public:
+    ///@brief Maps file, throwing a VprError of error_type if it can not be read
+    FileContents(const char* file, e_vpr_error error_type);
+    ~FileContents();
+
+    FileContents(const FileContents&) = delete;
+    FileContents& operator=(const FileContents&) = delete;
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+  private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    std::string contents_;
+#endif
+};
+
+#endif
@@ -0,0 +1,211 @@
+#include "gzip_file_contents.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+
+#include <zlib.h>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/blocked_range.h>
+#    include <tbb/parallel_for.h>
+#endif
+
+#include "file_contents.h"
+
+namespace {
+
+constexpr size_t GZIP_HEADER_BYTES = 10;
+constexpr size_t GZIP_TRAILER_BYTES = 8; //CRC32 and ISIZE
+constexpr uint8_t GZIP_FLAG_EXTRA = 0x04;
+
+///@brief Maximum bytes passed to zlib at once (its counts are unsigned ints)
+constexpr size_t MAX_ZLIB_CHUNK_BYTES = 1 << 30;
+
+///@brief A gzip member whose compressed size is recorded in its header (see find_bgzf_members())
+struct t_gzip_member {
+    size_t offset;            ///<Offset of the member in the file
+    size_t compressed_size;   ///<Bytes of the member (header, deflate data and trailer)
+    size_t uncompressed_size; ///<Bytes of data the member inflates to
+};
+
+bool is_gzip(const char* data, size_t size) {
+    return size >= 2 && uint8_t(data[0]) == 0x1f && uint8_t(data[1]) == 0x8b;
+}
+
+uint16_t read_le16(const char* p) {
+    return uint16_t(uint8_t(p[0])) | (uint16_t(uint8_t(p[1])) << 8);
+}
+
+uint32_t read_le32(const char* p) {
+    return uint32_t(read_le16(p)) | (uint32_t(read_le16(p + 2)) << 16);
+}
+
+/**
+ * @brief Splits data into its gzip members if every one records its size in a BGZF ("BC")
+ *        extra field, returning false otherwise (e.g. for ordinary single-member gzip files)
+ */
+bool find_bgzf_members(const char* data, size_t size, std::vector<t_gzip_member>& members) {
+    for (size_t offset = 0; offset < size;) {
+        const char* header = data + offset;
+        size_t remaining = size - offset;
+        if (remaining < GZIP_HEADER_BYTES + 2 || !is_gzip(header, remaining) || !(uint8_t(header[3]) & GZIP_FLAG_EXTRA)) {
+            return false;
+        }
+
+        size_t extra_bytes = read_le16(header + GZIP_HEADER_BYTES);
+        if (remaining < GZIP_HEADER_BYTES + 2 + extra_bytes) {
+            return false;
+        }
+
+        //Look for the BGZF sub-field amongst the extra fields, holding the member size minus one
+        const char* extra = header + GZIP_HEADER_BYTES + 2;
+        size_t member_size = 0;
+        for (size_t pos = 0; pos + 4 <= extra_bytes;) {
+            size_t field_bytes = read_le16(extra + pos + 2);
+            if (extra[pos] == 'B' && extra[pos + 1] == 'C' && field_bytes == 2 && pos + 6 <= extra_bytes) {
+                member_size = size_t(read_le16(extra + pos + 4)) + 1;
+            }
+            pos += 4 + field_bytes;
+        }
+        if (member_size < GZIP_HEADER_BYTES + 2 + extra_bytes + GZIP_TRAILER_BYTES || member_size > remaining) {
+            return false;
+        }
+
+        //BGZF members inflate to at most 64KiB, so ISIZE (the size modulo 2^32) is exact
+        members.push_back({offset, member_size, read_le32(header + member_size - 4)});
+        offset += member_size;
+    }
+    return !members.empty();
+}
+
+///@brief Inflates the gzip member in[0..in_size) to exactly out_size bytes at out, returning false on failure
+bool inflate_member(const char* in, size_t in_size, char* out, size_t out_size) {
+    z_stream strm;
+    std::memset(&strm, 0, sizeof(strm));
+    if (inflateInit2(&strm, 16 + MAX_WBITS) != Z_OK) { //+16: expect a gzip header
+        return false;
+    }
+
+    char empty_out;
+    strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in));
+    strm.avail_in = in_size;
+    strm.next_out = reinterpret_cast<Bytef*>(out_size ? out : &empty_out);
+    strm.avail_out = out_size ? out_size : 1;
+
+    bool ok = inflate(&strm, Z_FINISH) == Z_STREAM_END && strm.total_out == out_size && strm.avail_in == 0;
+    inflateEnd(&strm);
+    return ok;
+}
+
+} // namespace
+
+GzipFileContents::GzipFileContents(const char* file, e_vpr_error error_type) {
+    FileContents compressed(file, error_type);
+    const char* data = compressed.data();
+    size_t size = compressed.size();
+
+    if (!is_gzip(data, size)) {
+        resize(size);
+        std::memcpy(mutable_data(), data, size);
+        return;
+    }
+
+    //Independent members with known sizes are inflated directly to their place in the output
+    std::vector<t_gzip_member> members;
+    if (find_bgzf_members(data, size, members)) {
+        std::vector<size_t> out_offsets(members.size() + 1, 0);
+        for (size_t imember = 0; imember < members.size(); ++imember) {
+            out_offsets[imember + 1] = out_offsets[imember] + members[imember].uncompressed_size;
+        }
+        resize(out_offsets.back());
+
+        std::atomic<bool> failed(false);
+        auto inflate_members = [&](size_t begin, size_t end) {
+            for (size_t imember = begin; imember < end && !failed; ++imember) {
+                const t_gzip_member& member = members[imember];
+                if (!inflate_member(data + member.offset, member.compressed_size,
+                                    mutable_data() + out_offsets[imember], member.uncompressed_size)) {
+                    failed = true;
+                }
+            }
+        };
+#ifdef VPR_USE_TBB
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, members.size(), 64), [&](const tbb::blocked_range<size_t>& range) {
+            inflate_members(range.begin(), range.end());
+        });
+#else
+        inflate_members(0, members.size());
+#endif
+        if (failed) {
+            vpr_throw(error_type, file, 0, "Failed to decompress gzip file '%s'.\n", file);
+        }
+        return;
+    }
+
+    //Otherwise inflate the stream serially, growing the output as needed. The trailer of the
+    //(last) member gives its size modulo 2^32, which is exact for most files.
+    resize(std::max<size_t>(read_le32(data + size - 4), 4 * size));
+    size_t capacity = size_;
+
+    z_stream strm;
+    std::memset(&strm, 0, sizeof(strm));
+    if (inflateInit2(&strm, 16 + MAX_WBITS) != Z_OK) { //+16: expect a gzip header
+        vpr_throw(error_type, file, 0, "Failed to initialize decompression of '%s'.\n", file);
+    }
+
+    size_t in_pos = 0;
+    size_t out_pos = 0;
+    bool ok = true;
+    while (true) {
+        if (strm.avail_in == 0 && in_pos < size) {
+            size_t chunk_bytes = std::min(size - in_pos, MAX_ZLIB_CHUNK_BYTES);
+            strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data + in_pos));
+            strm.avail_in = chunk_bytes;
+            in_pos += chunk_bytes;
+        }
+        if (out_pos == capacity) {
+            resize(2 * capacity);
+            capacity = size_;
+        }
+        size_t out_bytes = std::min(capacity - out_pos, MAX_ZLIB_CHUNK_BYTES);
+        strm.next_out = reinterpret_cast<Bytef*>(mutable_data() + out_pos);
+        strm.avail_out = out_bytes;
+
+        int ret = inflate(&strm, Z_NO_FLUSH);
+        out_pos += out_bytes - strm.avail_out;
+
+        if (ret == Z_STREAM_END) {
+            //Concatenated members are inflated as one stream (as gzread() does), while any
+            //other trailing data is ignored
+            size_t consumed = in_pos - strm.avail_in;
+            if (!is_gzip(data + consumed, size - consumed) || inflateReset(&strm) != Z_OK) {
+                break;
+            }
+        } else if (ret == Z_BUF_ERROR && strm.avail_out != 0) {
+            //No progress with room for output: the input is truncated
+            ok = false;
+            break;
+        } else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            ok = false;
+            break;
+        }
+    }
+    inflateEnd(&strm);
+
+    if (!ok) {
+        vpr_throw(error_type, file, 0, "Failed to decompress gzip file '%s'.\n", file);
+    }
+    resize(out_pos);
+}
+
+void GzipFileContents::resize(size_t num_bytes) {
+    size_t num_words = (num_bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    //Clear any bytes beyond the end in the last word (left over from a larger size)
+    if (num_words && num_words <= words_.size()) {
+        std::memset(mutable_data() + num_bytes, 0, num_words * sizeof(uint64_t) - num_bytes);
+    }
+    words_.resize(num_words);
+    size_ = num_bytes;
+}
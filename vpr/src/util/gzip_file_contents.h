@@ -0,0 +1,47 @@
+#ifndef VPR_GZIP_FILE_CONTENTS_H
+#define VPR_GZIP_FILE_CONTENTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "vpr_error.h"
+
+/**
+ * @brief The decompressed contents of a gzip'ed file
+ *
+ * The file is inflated directly into a single 8-byte aligned buffer, so binary formats
+ * such as capnp messages can be read from it in place (e.g. with a capnp::FlatArrayMessageReader)
+ * without any further copies.
+ *
+ * A gzip stream is normally a chain of dependent deflate blocks, so it can only be inflated
+ * serially. Files made of independent gzip members which record their own compressed sizes
+ * (the BGZF layout written by bgzip, and by block-parallel compressors) are instead inflated
+ * with a member per task when VPR is built with TBB.
+ *
+ * As with zlib's gzread(), files which are not gzip'ed are loaded as-is.
+ */
+class GzipFileContents {
+  public:
+    ///@brief Loads file, throwing a VprError of error_type if it can not be read or decompressed
+    GzipFileContents(const char* file, e_vpr_error error_type);
+
+    GzipFileContents(const GzipFileContents&) = delete;
+    GzipFileContents& operator=(const GzipFileContents&) = delete;
+
+    const char* data() const { return reinterpret_cast<const char*>(words_.data()); }
+    size_t size() const { return size_; }
+
+    ///@brief Returns the (8-byte aligned) contents as words, padded with zeros to a whole word
+    const std::vector<uint64_t>& words() const { return words_; }
+
+  private:
+    ///@brief Resizes the contents to hold num_bytes (preserving existing contents)
+    void resize(size_t num_bytes);
+    char* mutable_data() { return reinterpret_cast<char*>(words_.data()); }
+
+    std::vector<uint64_t> words_;
+    size_t size_ = 0;
+};
+
+#endif
@@ -19,13 +19,14 @@ using ClbNetPinsMatrix = NetPinsMatrix_<T, ClusterNetId>;
 template<typename T>
 using AtomNetPinsMatrix = NetPinsMatrix_<T, AtomNetId>;
 
-template<typename T>
-ClbNetPinsMatrix<T> make_net_pins_matrix(const ClusteredNetlist& nlist, T default_value = T()) {
-    auto pins_in_net = [&](ClusterNetId net) {
-        return nlist.net_pins(net).size();
+///@brief Indexed by ClusterNetId, or by ParentNetId (as the timing analysis expects) if NetId is ParentNetId
+template<typename T, typename NetId = ClusterNetId>
+NetPinsMatrix_<T, NetId> make_net_pins_matrix(const ClusteredNetlist& nlist, T default_value = T()) {
+    auto pins_in_net = [&](NetId net) {
+        return nlist.net_pins(ClusterNetId(size_t(net))).size();
     };
 
-    return ClbNetPinsMatrix<T>(nlist.nets().size(), pins_in_net, default_value);
+    return NetPinsMatrix_<T, NetId>(nlist.nets().size(), pins_in_net, default_value);
 }
 
 template<typename T>
@@ -1616,6 +1616,9 @@ void free_pb_stats(t_pb* pb) {
         if (pb->pb_stats->feasible_blocks) {
             delete[] pb->pb_stats->feasible_blocks;
         }
+        if (pb->pb_stats->feasible_block_gains) {
+            delete[] pb->pb_stats->feasible_block_gains;
+        }
         if (!pb->parent_pb) {
             pb->pb_stats->transitive_fanout_candidates.clear();
         }
@@ -2383,12 +2386,28 @@ bool node_in_same_physical_tile(RRNodeId node_first, RRNodeId node_second) {
     }
 }
 
+bool is_tile_unoccupied(int layer, int i, int j, t_physical_tile_type_ptr physical_type) {
+    const auto& grid_block = g_vpr_ctx.placement().grid_blocks;
+
+    for (int abs_cap = 0; abs_cap < physical_type->capacity; abs_cap++) {
+        if (!grid_block.is_sub_tile_empty({i, j, layer}, abs_cap)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::vector<int> get_cluster_netlist_intra_tile_classes_at_loc(int layer,
                                                                int i,
                                                                int j,
                                                                t_physical_tile_type_ptr physical_type) {
     std::vector<int> class_num_vec;
 
+    //Nothing is materialized for unoccupied tiles
+    if (is_tile_unoccupied(layer, i, j, physical_type)) {
+        return class_num_vec;
+    }
+
     const auto& place_ctx = g_vpr_ctx.placement();
     const auto& atom_lookup = g_vpr_ctx.atom().lookup;
     const auto& grid_block = place_ctx.grid_blocks;
@@ -2421,10 +2440,15 @@ std::vector<int> get_cluster_netlist_intra_tile_pins_at_loc(const int layer,
                                                             const vtr::vector<ClusterBlockId, t_cluster_pin_chain>& pin_chains,
                                                             const vtr::vector<ClusterBlockId, std::unordered_set<int>>& pin_chains_num,
                                                             t_physical_tile_type_ptr physical_type) {
-    auto& place_ctx = g_vpr_ctx.placement();
-    auto grid_block = place_ctx.grid_blocks;
-
     std::vector<int> pin_num_vec;
+
+    //Nothing is materialized for unoccupied tiles
+    if (is_tile_unoccupied(layer, i, j, physical_type)) {
+        return pin_num_vec;
+    }
+
+    const auto& grid_block = g_vpr_ctx.placement().grid_blocks;
+
     pin_num_vec.reserve(get_tile_num_internal_pin(physical_type));
 
     for (int abs_cap = 0; abs_cap < physical_type->capacity; abs_cap++) {
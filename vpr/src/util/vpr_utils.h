@@ -281,6 +281,9 @@ RRNodeId get_class_rr_node_id(const RRSpatialLookup& rr_spatial_lookup,
 // Check whether the given nodes are in the same cluster
 bool node_in_same_physical_tile(RRNodeId node_first, RRNodeId node_second);
 
+/// @brief Returns true if no cluster is placed at any sub tile of the tile rooted at (layer, i, j)
+bool is_tile_unoccupied(int layer, int i, int j, t_physical_tile_type_ptr physical_type);
+
 std::vector<int> get_cluster_netlist_intra_tile_classes_at_loc(int layer,
                                                                int i,
                                                                int j,
@@ -0,0 +1,83 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "async_file_writer.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+namespace {
+
+static std::string read_file(const std::string& file) {
+    std::ifstream is(file, std::ios::binary);
+    std::stringstream contents;
+    contents << is.rdbuf();
+    return contents.str();
+}
+
+static std::string read_gzip_file(const std::string& file) {
+    gzFile fp = gzopen(file.c_str(), "rb");
+    REQUIRE(fp);
+    std::string contents;
+    char buf[4096];
+    int num_read;
+    while ((num_read = gzread(fp, buf, sizeof(buf))) > 0) {
+        contents.append(buf, num_read);
+    }
+    gzclose(fp);
+    return contents;
+}
+
+TEST_CASE("async_file_writer_queue", "[vpr]") {
+    constexpr size_t kNumFiles = 20;
+    constexpr size_t kFileBytes = 100000;
+
+    std::vector<std::string> files;
+    std::vector<std::string> contents;
+    for (size_t i = 0; i < kNumFiles; ++i) {
+        files.push_back("test_async_file_writer_" + std::to_string(i) + (i % 5 == 0 ? ".rpt.gz" : ".rpt"));
+        contents.push_back(std::string(kFileBytes, char('a' + i)) + "\n");
+    }
+
+    {
+        //Smaller than two files, so writes block while the queue is full
+        AsyncFileWriter writer(/*max_queued_bytes=*/3 * kFileBytes / 2);
+        for (size_t i = 0; i < kNumFiles; ++i) {
+            writer.write(files[i], contents[i]);
+        }
+        //A file larger than the queue is still written
+        writer.write("test_async_file_writer_large.rpt", std::string(4 * kFileBytes, 'z'));
+        writer.write("test_async_file_writer_missing_dir/file.rpt", "lost");
+
+        REQUIRE(writer.wait() == std::vector<std::string>{"test_async_file_writer_missing_dir/file.rpt"});
+        REQUIRE(writer.wait().empty());
+    }
+
+    for (size_t i = 0; i < kNumFiles; ++i) {
+        if (i % 5 == 0) {
+            REQUIRE(read_gzip_file(files[i]) == contents[i]);
+        } else {
+            REQUIRE(read_file(files[i]) == contents[i]);
+        }
+        std::remove(files[i].c_str());
+    }
+    REQUIRE(read_file("test_async_file_writer_large.rpt") == std::string(4 * kFileBytes, 'z'));
+    std::remove("test_async_file_writer_large.rpt");
+}
+
+TEST_CASE("async_output_file", "[vpr]") {
+    const std::string file = "test_async_output_file.rpt";
+    {
+        AsyncOutputFile os(file);
+        os << "Total number of overused nodes = " << 42 << '\n';
+    }
+    REQUIRE(async_file_writer().wait().empty());
+    REQUIRE(read_file(file) == "Total number of overused nodes = 42\n");
+    std::remove(file.c_str());
+}
+
+} // namespace
@@ -0,0 +1,48 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "atom_lookup.h"
+
+namespace {
+
+TEST_CASE("atom_lookup_atom_pb", "[vpr]") {
+    AtomLookup lookup;
+    t_pb pb_a, pb_b;
+    AtomBlockId blk_0(0), blk_1(1);
+
+    REQUIRE(lookup.atom_pb(blk_0) == nullptr);
+    REQUIRE(lookup.pb_atom(&pb_a) == AtomBlockId::INVALID());
+    REQUIRE(lookup.pb_atom(nullptr) == AtomBlockId::INVALID());
+
+    lookup.set_atom_pb(blk_0, &pb_a);
+    lookup.set_atom_pb(blk_1, &pb_b);
+    REQUIRE(lookup.atom_pb(blk_0) == &pb_a);
+    REQUIRE(lookup.pb_atom(&pb_a) == blk_0);
+    REQUIRE(lookup.pb_atom(&pb_b) == blk_1);
+
+    SECTION("remove_by_atom") {
+        //The old pb is not read, it may already be freed
+        lookup.set_atom_pb(blk_0, nullptr);
+        REQUIRE(lookup.atom_pb(blk_0) == nullptr);
+        REQUIRE(lookup.pb_atom(&pb_a) == AtomBlockId::INVALID());
+        REQUIRE(lookup.pb_atom(&pb_b) == blk_1);
+    }
+
+    SECTION("remove_by_pb") {
+        lookup.set_atom_pb(AtomBlockId::INVALID(), &pb_b);
+        REQUIRE(lookup.atom_pb(blk_1) == nullptr);
+        REQUIRE(lookup.pb_atom(&pb_b) == AtomBlockId::INVALID());
+        REQUIRE(lookup.atom_pb(blk_0) == &pb_a);
+    }
+
+    SECTION("remap") {
+        //Mapping an atom to another pb unmaps its old pb...
+        lookup.set_atom_pb(blk_0, &pb_b);
+        REQUIRE(lookup.atom_pb(blk_0) == &pb_b);
+        REQUIRE(lookup.pb_atom(&pb_b) == blk_0);
+        REQUIRE(lookup.pb_atom(&pb_a) == AtomBlockId::INVALID());
+        //...and the atom previously mapped to that pb
+        REQUIRE(lookup.atom_pb(blk_1) == nullptr);
+    }
+}
+
+} // namespace
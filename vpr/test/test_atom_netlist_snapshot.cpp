@@ -0,0 +1,128 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "atom_netlist.h"
+#include "vtr_flat_blob.h"
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+static constexpr const char kSnapshotBlob[] = "test_atom_netlist_snapshot.blob";
+
+TEST_CASE("round_trip_atom_netlist_snapshot", "[vpr]") {
+    char input_name[] = ".input";
+    char output_name[] = ".output";
+    char lut_name[] = "lut";
+    char inpad_name[] = "inpad";
+    char outpad_name[] = "outpad";
+    char in_name[] = "in";
+    char out_name[] = "out";
+
+    t_model_ports inpad_port;
+    inpad_port.dir = OUT_PORT;
+    inpad_port.name = inpad_name;
+    inpad_port.size = 1;
+    t_model_ports outpad_port;
+    outpad_port.dir = IN_PORT;
+    outpad_port.name = outpad_name;
+    outpad_port.size = 1;
+    t_model_ports lut_in_port;
+    lut_in_port.dir = IN_PORT;
+    lut_in_port.name = in_name;
+    lut_in_port.size = 2;
+    t_model_ports lut_out_port;
+    lut_out_port.dir = OUT_PORT;
+    lut_out_port.name = out_name;
+    lut_out_port.size = 1;
+
+    t_model lut_model;
+    lut_model.name = lut_name;
+    lut_model.inputs = &lut_in_port;
+    lut_model.outputs = &lut_out_port;
+    t_model output_model;
+    output_model.name = output_name;
+    output_model.inputs = &outpad_port;
+    output_model.next = &lut_model;
+    t_model input_model;
+    input_model.name = input_name;
+    input_model.outputs = &inpad_port;
+    input_model.next = &output_model;
+
+    AtomNetlist netlist("top", "top_id");
+    netlist.set_block_types(&input_model, &output_model);
+
+    AtomBlockId a = netlist.create_block("a", &input_model);
+    AtomBlockId b = netlist.create_block("b", &input_model);
+    AtomNetlist::TruthTable truth_table = {{vtr::LogicValue::TRUE, vtr::LogicValue::TRUE, vtr::LogicValue::TRUE}};
+    AtomBlockId lut = netlist.create_block("lut", &lut_model, truth_table);
+    AtomBlockId out = netlist.create_block("out:y", &output_model);
+    netlist.set_block_param(lut, "INIT", "8");
+    netlist.set_block_attr(lut, "src", "top.v:3");
+
+    AtomNetId net_a = netlist.create_net("a");
+    AtomNetId net_b = netlist.create_net("b");
+    AtomNetId net_y = netlist.create_net("y");
+    netlist.create_pin(netlist.create_port(a, &inpad_port), 0, net_a, PinType::DRIVER);
+    netlist.create_pin(netlist.create_port(b, &inpad_port), 0, net_b, PinType::DRIVER);
+    AtomPortId lut_in = netlist.create_port(lut, &lut_in_port);
+    netlist.create_pin(lut_in, 0, net_a, PinType::SINK);
+    netlist.create_pin(lut_in, 1, net_b, PinType::SINK);
+    netlist.create_pin(netlist.create_port(lut, &lut_out_port), 0, net_y, PinType::DRIVER);
+    netlist.create_pin(netlist.create_port(out, &outpad_port), 0, net_y, PinType::SINK);
+    netlist.add_net_alias("y", "y_alias");
+    REQUIRE(netlist.verify());
+
+    {
+        vtr::FlatBlobWriter writer;
+        netlist.write_flat_blob_sections(writer);
+        writer.write(kSnapshotBlob);
+    }
+
+    vtr::FlatBlobReader reader(kSnapshotBlob);
+    AtomNetlist read;
+    size_t isection = 0;
+    read.read_flat_blob_sections(reader, isection, &input_model, nullptr);
+    REQUIRE(isection == reader.num_sections());
+    REQUIRE(read.verify());
+
+    REQUIRE(read.netlist_name() == "top");
+    REQUIRE(read.netlist_id() == "top_id");
+    REQUIRE(read.blocks().size() == netlist.blocks().size());
+    REQUIRE(read.ports().size() == netlist.ports().size());
+    REQUIRE(read.pins().size() == netlist.pins().size());
+    REQUIRE(read.nets().size() == netlist.nets().size());
+
+    for (AtomBlockId blk : netlist.blocks()) {
+        REQUIRE(read.block_name(blk) == netlist.block_name(blk));
+        REQUIRE(read.block_model(blk) == netlist.block_model(blk));
+        REQUIRE(read.block_type(blk) == netlist.block_type(blk));
+        REQUIRE(read.block_truth_table(blk) == netlist.block_truth_table(blk));
+        REQUIRE(read.find_block(netlist.block_name(blk)) == blk);
+    }
+    auto read_params = read.block_params(lut);
+    REQUIRE(std::map<std::string, std::string>(read_params.begin(), read_params.end()) == std::map<std::string, std::string>{{"INIT", "8"}});
+    auto read_attrs = read.block_attrs(lut);
+    REQUIRE(std::map<std::string, std::string>(read_attrs.begin(), read_attrs.end()) == std::map<std::string, std::string>{{"src", "top.v:3"}});
+
+    for (AtomPortId port : netlist.ports()) {
+        REQUIRE(read.port_name(port) == netlist.port_name(port));
+        REQUIRE(read.port_model(port) == netlist.port_model(port));
+        REQUIRE(read.port_block(port) == netlist.port_block(port));
+    }
+
+    for (AtomNetId net : netlist.nets()) {
+        REQUIRE(read.net_name(net) == netlist.net_name(net));
+        REQUIRE(read.net_driver(net) == netlist.net_driver(net));
+        REQUIRE(read.find_net(netlist.net_name(net)) == net);
+        REQUIRE(std::vector<AtomPinId>(read.net_sinks(net).begin(), read.net_sinks(net).end())
+                == std::vector<AtomPinId>(netlist.net_sinks(net).begin(), netlist.net_sinks(net).end()));
+    }
+    REQUIRE(read.net_aliases("y") == netlist.net_aliases("y"));
+
+    std::remove(kSnapshotBlob);
+}
+
+} // namespace
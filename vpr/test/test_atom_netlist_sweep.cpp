@@ -0,0 +1,180 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "atom_netlist.h"
+#include "atom_netlist_utils.h"
+
+#include <set>
+#include <string>
+
+namespace {
+
+/**
+ * @brief Builds a netlist of LUT chains (each fed by primary inputs) which exercises
+ *        every kind of sweep:
+ *  - a chain ending in a primary output (kept),
+ *  - a chain with no fanout (swept from its end back to its primary inputs),
+ *  - a constant LUT driving a primary output (swept as a constant output), and
+ *  - a primary output with no driver and an unused primary input (swept as dangling I/Os).
+ */
+class SweepNetlistBuilder {
+  public:
+    SweepNetlistBuilder() {
+        inpad_port.dir = OUT_PORT;
+        inpad_port.name = inpad_name;
+        inpad_port.size = 1;
+        outpad_port.dir = IN_PORT;
+        outpad_port.name = outpad_name;
+        outpad_port.size = 1;
+        lut_in_port.dir = IN_PORT;
+        lut_in_port.name = in_name;
+        lut_in_port.size = 2;
+        lut_in_port.combinational_sink_ports = {out_name};
+        lut_out_port.dir = OUT_PORT;
+        lut_out_port.name = out_name;
+        lut_out_port.size = 1;
+
+        lut_model.name = lut_name;
+        lut_model.inputs = &lut_in_port;
+        lut_model.outputs = &lut_out_port;
+        output_model.name = output_name;
+        output_model.inputs = &outpad_port;
+        output_model.next = &lut_model;
+        input_model.name = input_name;
+        input_model.outputs = &inpad_port;
+        input_model.next = &output_model;
+    }
+
+    void build(AtomNetlist& netlist, size_t chain_length) {
+        netlist.set_block_types(&input_model, &output_model);
+
+        AtomNetId kept = build_chain(netlist, "kept", chain_length);
+        netlist.create_pin(netlist.create_port(netlist.create_block("out:kept", &output_model), &outpad_port), 0, kept, PinType::SINK);
+
+        build_chain(netlist, "dangling", chain_length);
+
+        AtomBlockId vcc = netlist.create_block("vcc", &lut_model, {{vtr::LogicValue::TRUE}});
+        AtomNetId vcc_net = netlist.create_net("vcc");
+        netlist.create_pin(netlist.create_port(vcc, &lut_out_port), 0, vcc_net, PinType::DRIVER, true);
+        netlist.create_pin(netlist.create_port(netlist.create_block("out:vcc", &output_model), &outpad_port), 0, vcc_net, PinType::SINK);
+
+        netlist.create_port(netlist.create_block("out:undriven", &output_model), &outpad_port);
+        netlist.create_port(netlist.create_block("unused", &input_model), &inpad_port);
+    }
+
+  private:
+    AtomNetId build_chain(AtomNetlist& netlist, const std::string& prefix, size_t chain_length) {
+        AtomNetlist::TruthTable truth_table = {{vtr::LogicValue::TRUE, vtr::LogicValue::TRUE, vtr::LogicValue::TRUE}};
+        AtomNetId prev_net = AtomNetId::INVALID();
+        for (size_t i = 0; i < chain_length; ++i) {
+            std::string name = prefix + std::to_string(i);
+            AtomBlockId in = netlist.create_block("in_" + name, &input_model);
+            AtomNetId in_net = netlist.create_net("in_" + name);
+            netlist.create_pin(netlist.create_port(in, &inpad_port), 0, in_net, PinType::DRIVER);
+
+            AtomBlockId lut = netlist.create_block(name, &lut_model, truth_table);
+            AtomPortId lut_in = netlist.create_port(lut, &lut_in_port);
+            netlist.create_pin(lut_in, 0, in_net, PinType::SINK);
+            if (prev_net) {
+                netlist.create_pin(lut_in, 1, prev_net, PinType::SINK);
+            }
+            prev_net = netlist.create_net(name);
+            netlist.create_pin(netlist.create_port(lut, &lut_out_port), 0, prev_net, PinType::DRIVER);
+        }
+        return prev_net;
+    }
+
+    char input_name[7] = ".input";
+    char output_name[8] = ".output";
+    char lut_name[4] = "lut";
+    char inpad_name[6] = "inpad";
+    char outpad_name[7] = "outpad";
+    char in_name[3] = "in";
+    char out_name[4] = "out";
+
+    t_model_ports inpad_port;
+    t_model_ports outpad_port;
+    t_model_ports lut_in_port;
+    t_model_ports lut_out_port;
+
+    t_model lut_model;
+    t_model output_model;
+    t_model input_model;
+};
+
+std::set<std::string> block_names(const AtomNetlist& netlist) {
+    std::set<std::string> names;
+    for (AtomBlockId blk : netlist.blocks()) {
+        if (blk) names.insert(netlist.block_name(blk));
+    }
+    return names;
+}
+
+std::set<std::string> net_names(const AtomNetlist& netlist) {
+    std::set<std::string> names;
+    for (AtomNetId net : netlist.nets()) {
+        if (net) names.insert(netlist.net_name(net));
+    }
+    return names;
+}
+
+TEST_CASE("sweep_iterative_matches_repeated_sweeps", "[vpr]") {
+    constexpr size_t kChainLength = 20;
+    SweepNetlistBuilder builder;
+
+    AtomNetlist netlist("top", "top_id");
+    builder.build(netlist, kChainLength);
+    size_t num_swept = sweep_iterative(netlist, true, true, true, true, e_const_gen_inference::COMB, 0);
+
+    //Reference: sweep the whole netlist with each individual sweep until nothing changes
+    AtomNetlist expected("top", "top_id");
+    builder.build(expected, kChainLength);
+    size_t num_expected_swept = 0;
+    size_t pass_swept;
+    do {
+        pass_swept = sweep_inputs(expected, 0)
+                     + sweep_outputs(expected, 0)
+                     + sweep_blocks(expected, 0)
+                     + sweep_nets(expected, 0)
+                     + sweep_constant_primary_outputs(expected, 0);
+        num_expected_swept += pass_swept;
+        pass_swept += mark_constant_generators(expected, e_const_gen_inference::COMB, 0);
+    } while (pass_swept != 0);
+
+    REQUIRE(num_swept == num_expected_swept);
+    REQUIRE(block_names(netlist) == block_names(expected));
+    REQUIRE(net_names(netlist) == net_names(expected));
+
+    //Only the chain driving a primary output survives
+    REQUIRE(netlist.find_block("kept0"));
+    REQUIRE(netlist.find_block("out:kept"));
+    REQUIRE(!netlist.find_block("dangling0"));
+    REQUIRE(!netlist.find_block("in_dangling0"));
+    REQUIRE(!netlist.find_block("vcc"));
+    REQUIRE(!netlist.find_block("out:vcc"));
+    REQUIRE(!netlist.find_block("out:undriven"));
+    REQUIRE(!netlist.find_block("unused"));
+    REQUIRE(block_names(netlist).size() == 2 * kChainLength + 1);
+
+    netlist.remove_and_compress();
+    REQUIRE(netlist.verify());
+}
+
+TEST_CASE("sweep_iterative_respects_disabled_sweeps", "[vpr]") {
+    constexpr size_t kChainLength = 5;
+    SweepNetlistBuilder builder;
+
+    AtomNetlist netlist("top", "top_id");
+    builder.build(netlist, kChainLength);
+    size_t num_blocks = block_names(netlist).size();
+
+    //Without sweeping nets, the dangling chain's last net keeps every block driving something
+    sweep_iterative(netlist, true, false, true, false, e_const_gen_inference::COMB, 0);
+    REQUIRE(netlist.find_block("dangling0"));
+    REQUIRE(netlist.find_block("vcc"));
+    REQUIRE(netlist.find_block("out:vcc"));
+    REQUIRE(!netlist.find_block("out:undriven"));
+    REQUIRE(!netlist.find_block("unused"));
+    REQUIRE(block_names(netlist).size() == num_blocks - 2);
+}
+
+} // namespace
@@ -0,0 +1,58 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "buffered_file_writer.h"
+
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+static constexpr const char kWriterFile[] = "test_buffered_file_writer.txt";
+
+static std::string read_file(const char* file) {
+    std::ifstream fp(file);
+    std::stringstream contents;
+    contents << fp.rdbuf();
+    return contents.str();
+}
+
+TEST_CASE("buffered_file_writer_matches_printf", "[vpr]") {
+    std::string expected;
+    char buf[128];
+    {
+        BufferedFileWriter out(kWriterFile, VPR_ERROR_OTHER);
+
+        out << "Net " << size_t(12345) << " (" << std::string("top.n") << ")\n";
+        snprintf(buf, sizeof(buf), "Net %zu (%s)\n", size_t(12345), "top.n");
+        expected += buf;
+
+        out << 0 << ' ' << -7 << ' ' << INT_MIN << ' ' << INT_MAX << ' ' << LLONG_MIN << ' ' << ULLONG_MAX << '\n';
+        snprintf(buf, sizeof(buf), "%d %d %d %d %lld %llu\n", 0, -7, INT_MIN, INT_MAX, LLONG_MIN, ULLONG_MAX);
+        expected += buf;
+
+        out.write_right_aligned("CHANX", 6).write_right_aligned("SOURCE", 6).write_right_aligned("toolongname", 6) << '\n';
+        snprintf(buf, sizeof(buf), "%6s%6s%6s\n", "CHANX", "SOURCE", "toolongname");
+        expected += buf;
+
+        //Enough output to flush the buffer several times, including writes larger than the buffer
+        for (int i = 0; i < 200000; ++i) {
+            out << "block_" << i << '\t' << i % 97 << '\n';
+            snprintf(buf, sizeof(buf), "block_%d\t%d\n", i, i % 97);
+            expected += buf;
+        }
+        std::string large(3 << 20, 'x');
+        out << large;
+        expected += large;
+
+        out.close();
+    }
+
+    REQUIRE(read_file(kWriterFile) == expected);
+
+    std::remove(kWriterFile);
+}
+
+} // namespace
@@ -0,0 +1,102 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "arch_util.h"
+#include "compiled_arch.h"
+#include "echo_arch.h"
+#include "read_xml_arch_file.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+static constexpr const char kArchFile[] = "test_read_arch_metadata.xml";
+static constexpr const char kOtherArchFile[] = "test_post_verilog_arch.xml";
+static constexpr const char kCompiledFile[] = "test_compiled_arch.blob";
+
+struct t_loaded_arch {
+    t_arch arch;
+    std::vector<t_physical_tile_type> physical_tile_types;
+    std::vector<t_logical_block_type> logical_block_types;
+
+    ~t_loaded_arch() {
+        free_type_descriptors(logical_block_types);
+        free_type_descriptors(physical_tile_types);
+        free_arch(&arch);
+    }
+};
+
+///@brief Returns the EchoArch() output of arch
+std::string echo_arch(const t_loaded_arch& loaded) {
+    const char* echo_file = "test_compiled_arch.echo";
+    EchoArch(echo_file, loaded.physical_tile_types, loaded.logical_block_types, &loaded.arch);
+
+    std::ifstream file(echo_file);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::remove(echo_file);
+    return contents.str();
+}
+
+TEST_CASE("compiled_arch", "[vpr]") {
+    t_loaded_arch xml;
+    XmlReadArch(kArchFile, /*timing_enabled=*/true,
+                &xml.arch, xml.physical_tile_types, xml.logical_block_types);
+    WriteCompiledArch(kCompiledFile, xml.arch, xml.physical_tile_types, xml.logical_block_types, /*timing_enabled=*/true);
+
+    {
+        t_loaded_arch compiled;
+        REQUIRE(ReadCompiledArch(kCompiledFile, kArchFile, /*timing_enabled=*/true,
+                                 &compiled.arch, compiled.physical_tile_types, compiled.logical_block_types));
+
+        REQUIRE(echo_arch(compiled) == echo_arch(xml));
+        REQUIRE(std::string(compiled.arch.architecture_id) == xml.arch.architecture_id);
+
+        //Pointers between the structures are re-linked
+        for (const t_physical_tile_type& tile : compiled.physical_tile_types) {
+            for (const t_sub_tile& sub_tile : tile.sub_tiles) {
+                for (t_logical_block_type_ptr site : sub_tile.equivalent_sites) {
+                    REQUIRE(site >= compiled.logical_block_types.data());
+                    REQUIRE(site < compiled.logical_block_types.data() + compiled.logical_block_types.size());
+                }
+            }
+        }
+
+        //As is the shared grid location metadata
+        auto type_str = compiled.arch.strings.intern_string(vtr::string_view("type"));
+        bool found_io_meta = false;
+        for (const auto& grid_def : compiled.arch.grid_layouts) {
+            for (const auto& loc_def : grid_def.layers.at(0).loc_defs) {
+                if (loc_def.block_type == "io") {
+                    REQUIRE(loc_def.meta != nullptr);
+                    REQUIRE(loc_def.meta->one(type_str) != nullptr);
+                    REQUIRE(loc_def.meta->one(type_str)->as_string().get(&compiled.arch.strings) == "io");
+                    found_io_meta = true;
+                }
+            }
+        }
+        REQUIRE(found_io_meta);
+    }
+
+    SECTION("Stale compiled architectures are not loaded") {
+        //Nothing is loaded, so there is nothing to free
+        t_arch arch;
+        std::vector<t_physical_tile_type> physical_tile_types;
+        std::vector<t_logical_block_type> logical_block_types;
+        REQUIRE(!ReadCompiledArch(kCompiledFile, kArchFile, /*timing_enabled=*/false,
+                                  &arch, physical_tile_types, logical_block_types));
+        REQUIRE(!ReadCompiledArch(kCompiledFile, kOtherArchFile, /*timing_enabled=*/true,
+                                  &arch, physical_tile_types, logical_block_types));
+        REQUIRE(!ReadCompiledArch(kArchFile, kArchFile, /*timing_enabled=*/true,
+                                  &arch, physical_tile_types, logical_block_types));
+        REQUIRE(physical_tile_types.empty());
+        REQUIRE(logical_block_types.empty());
+    }
+
+    std::remove(kCompiledFile);
+}
+
+} // namespace
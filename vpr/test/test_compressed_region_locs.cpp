@@ -0,0 +1,44 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "move_utils.h"
+
+#include <set>
+#include <utility>
+
+namespace {
+
+TEST_CASE("test_find_compatible_compressed_loc_in_region", "[vpr_move_utils]") {
+    //One layer of 4 compressed columns, with the region locations sparse in y
+    t_compressed_region_locs region_locs;
+    region_locs.column_rows = {{{0, 2}, {}, {1}, {0, 1, 2, 3}}};
+
+    SECTION("Picks every location in range except the from location") {
+        t_bb search_range(0, 2, 0, 2, 0, 0);
+        t_physical_tile_loc from_loc(0, 2, 0);
+
+        std::set<std::pair<int, int>> found;
+        for (int i = 0; i < 1000; ++i) {
+            t_physical_tile_loc to_loc;
+            REQUIRE(find_compatible_compressed_loc_in_region(region_locs, from_loc, search_range, to_loc));
+            REQUIRE(to_loc.layer_num == 0);
+            found.insert({to_loc.x, to_loc.y});
+        }
+        REQUIRE(found == std::set<std::pair<int, int>>{{0, 0}, {2, 1}});
+    }
+
+    SECTION("Only the from location in range") {
+        t_bb search_range(2, 2, 0, 3, 0, 0);
+        t_physical_tile_loc from_loc(2, 1, 0);
+        t_physical_tile_loc to_loc;
+        REQUIRE(!find_compatible_compressed_loc_in_region(region_locs, from_loc, search_range, to_loc));
+    }
+
+    SECTION("No locations in range") {
+        t_bb search_range(1, 1, 0, 3, 0, 0);
+        t_physical_tile_loc from_loc(3, 0, 0);
+        t_physical_tile_loc to_loc;
+        REQUIRE(!find_compatible_compressed_loc_in_region(region_locs, from_loc, search_range, to_loc));
+    }
+}
+
+} // namespace
@@ -14,7 +14,8 @@ static constexpr int kMaxHops = 10;
 
 namespace {
 
-// Route from source_node to sink_node, returning either the delay, or infinity if unroutable.
+// Route from source_node to sink_node with a Router, returning either the delay, or infinity if unroutable.
+template<typename Router = ConnectionRouter<BinaryHeap>>
 static float do_one_route(RRNodeId source_node,
                           RRNodeId sink_node,
                           const t_det_routing_arch& det_routing_arch,
@@ -48,19 +49,20 @@ static float do_one_route(RRNodeId source_node,
     RouterStats router_stats;
     auto router_lookahead = make_router_lookahead(det_routing_arch,
                                                   router_opts.lookahead_type,
+                                                  router_opts.base_cost_type,
                                                   router_opts.write_router_lookahead,
                                                   router_opts.read_router_lookahead,
                                                   segment_inf,
                                                   is_flat);
 
-    ConnectionRouter<BinaryHeap> router(
+    Router router(
         device_ctx.grid,
         *router_lookahead,
         device_ctx.rr_graph.rr_nodes(),
         &device_ctx.rr_graph,
         device_ctx.rr_rc_data,
         device_ctx.rr_graph.rr_switch(),
-        g_vpr_ctx.mutable_routing().rr_node_route_inf,
+        g_vpr_ctx.mutable_routing().rr_node_path_inf,
         is_flat);
 
     // Find the cheapest route if possible.
@@ -186,6 +188,15 @@ TEST_CASE("connection_router", "[vpr]") {
     // Check that a route was found
     REQUIRE(delay < std::numeric_limits<float>::infinity());
 
+    // The router specialized for the common case finds the same route
+    REQUIRE(use_common_case_connection_router(router_opts, g_vpr_ctx.device().grid, router_opts.flat_routing));
+    float common_case_delay = do_one_route<CommonCaseConnectionRouter<BinaryHeap>>(source_rr_node,
+                                                                                   sink_rr_node,
+                                                                                   vpr_setup.RoutingArch,
+                                                                                   vpr_setup.RouterOpts,
+                                                                                   vpr_setup.Segments);
+    REQUIRE(common_case_delay == delay);
+
     // Clean up
     free_routing_structs();
     vpr_free_all(arch,
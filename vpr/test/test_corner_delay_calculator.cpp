@@ -0,0 +1,61 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include <cmath>
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/delay_calc/FixedDelayCalculator.hpp"
+
+#include "CornerDelayCalculator.h"
+
+namespace {
+
+TEST_CASE("corner_delay_calculator", "[vpr]") {
+    tatum::TimingGraph tg;
+    tatum::NodeId src = tg.add_node(tatum::NodeType::SOURCE);
+    tatum::NodeId opin = tg.add_node(tatum::NodeType::OPIN);
+    tatum::NodeId cpin = tg.add_node(tatum::NodeType::CPIN);
+    tatum::NodeId sink = tg.add_node(tatum::NodeType::SINK);
+
+    tatum::EdgeId comb_edge = tg.add_edge(tatum::EdgeType::PRIMITIVE_COMBINATIONAL, src, opin);
+    tatum::EdgeId net_edge = tg.add_edge(tatum::EdgeType::INTERCONNECT, opin, sink);
+    tatum::EdgeId capture_edge = tg.add_edge(tatum::EdgeType::PRIMITIVE_CLOCK_CAPTURE, cpin, sink);
+    tatum::EdgeId disabled_edge = tg.add_edge(tatum::EdgeType::INTERCONNECT, opin, cpin);
+    tg.disable_edge(disabled_edge);
+
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> max_delays(tg.edges().size(), tatum::Time(NAN));
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> min_delays(tg.edges().size(), tatum::Time(NAN));
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> setup_times(tg.edges().size(), tatum::Time(NAN));
+    tatum::util::linear_map<tatum::EdgeId, tatum::Time> hold_times(tg.edges().size(), tatum::Time(NAN));
+    max_delays[comb_edge] = tatum::Time(2.);
+    min_delays[comb_edge] = tatum::Time(1.);
+    max_delays[net_edge] = tatum::Time(4.);
+    min_delays[net_edge] = tatum::Time(3.);
+    setup_times[capture_edge] = tatum::Time(0.5);
+    hold_times[capture_edge] = tatum::Time(0.25);
+    tatum::FixedDelayCalculator fixed_delay_calc(max_delays, setup_times, min_delays, hold_times);
+
+    NominalEdgeDelays nominal_delays(tg, fixed_delay_calc);
+    REQUIRE(std::isnan(nominal_delays.max_delay(disabled_edge).value()));
+
+    SECTION("Nominal corner") {
+        CornerDelayCalculator delay_calc(nominal_delays, t_timing_corner{"nominal", 1., 1.});
+        for (tatum::EdgeId edge : {comb_edge, net_edge}) {
+            REQUIRE(delay_calc.max_edge_delay(tg, edge).value() == fixed_delay_calc.max_edge_delay(tg, edge).value());
+            REQUIRE(delay_calc.min_edge_delay(tg, edge).value() == fixed_delay_calc.min_edge_delay(tg, edge).value());
+        }
+        REQUIRE(delay_calc.setup_time(tg, capture_edge).value() == fixed_delay_calc.setup_time(tg, capture_edge).value());
+        REQUIRE(delay_calc.hold_time(tg, capture_edge).value() == fixed_delay_calc.hold_time(tg, capture_edge).value());
+    }
+
+    SECTION("Derated corner") {
+        CornerDelayCalculator delay_calc(nominal_delays, t_timing_corner{"slow", 2., 0.5});
+        REQUIRE(delay_calc.max_edge_delay(tg, comb_edge).value() == 4.);
+        REQUIRE(delay_calc.min_edge_delay(tg, comb_edge).value() == 0.5);
+        REQUIRE(delay_calc.max_edge_delay(tg, net_edge).value() == 8.);
+        REQUIRE(delay_calc.min_edge_delay(tg, net_edge).value() == 1.5);
+        REQUIRE(delay_calc.setup_time(tg, capture_edge).value() == 1.);
+        REQUIRE(delay_calc.hold_time(tg, capture_edge).value() == 0.125);
+    }
+}
+
+} // namespace
@@ -0,0 +1,67 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/catch_approx.hpp"
+
+#include <cmath>
+
+#include "electrostatic_density.h"
+
+namespace {
+
+using Catch::Approx;
+
+ElectrostaticDensity uniform_density(size_t width, size_t height) {
+    ElectrostaticDensity density(width, height);
+    for (size_t x = 0; x < width; ++x) {
+        for (size_t y = 0; y < height; ++y) {
+            density.set_capacity(x, y, 1.);
+        }
+    }
+    return density;
+}
+
+TEST_CASE("electrostatic_density_overflow", "[vpr]") {
+    ElectrostaticDensity density = uniform_density(4, 3);
+    REQUIRE(density.overflow() == 0.);
+
+    density.add_charge(1., 1., 1.);
+    density.add_charge(1., 1., 1.);
+    REQUIRE(density.overflow() == Approx(0.5));
+
+    //Half-way between two bins, the charge is split between them
+    density.clear_charges();
+    density.add_charge(1.5, 1., 2.);
+    REQUIRE(density.overflow() == Approx(0.));
+}
+
+TEST_CASE("electrostatic_density_field", "[vpr]") {
+    ElectrostaticDensity density = uniform_density(11, 9);
+
+    //A block at the center is pushed away from itself, symmetrically
+    density.add_charge(5., 4., 4.);
+    density.solve();
+    REQUIRE(density.field_x(5., 4.) == Approx(0.).margin(1e-9));
+    REQUIRE(density.field_y(5., 4.) == Approx(0.).margin(1e-9));
+    REQUIRE(density.field_x(7., 4.) > 0.);
+    REQUIRE(density.field_x(3., 4.) < 0.);
+    REQUIRE(density.field_x(7., 4.) == Approx(-density.field_x(3., 4.)));
+    REQUIRE(density.field_y(5., 6.) > 0.);
+    REQUIRE(density.field_y(5., 2.) < 0.);
+
+    //No field leaves the device
+    REQUIRE(std::abs(density.field_x(0., 4.)) < std::abs(density.field_x(3., 4.)));
+
+    SECTION("heterogeneous") {
+        //Blocks are pulled towards the only tiles which can hold them
+        ElectrostaticDensity column(11, 9);
+        for (size_t y = 0; y < 9; ++y) {
+            column.set_capacity(9, y, 1.);
+        }
+        column.add_charge(2., 4., 1.);
+        column.solve();
+        REQUIRE(column.field_x(2., 4.) > 0.);
+        REQUIRE(column.field_x(5., 4.) > 0.);
+        REQUIRE(column.overflow() == Approx(1.));
+    }
+}
+
+} // namespace
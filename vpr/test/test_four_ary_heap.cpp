@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "four_ary_heap.h"
+
+namespace {
+
+constexpr size_t kNumNodes = 1000;
+
+// Builds a set of (node, cost) pairs where most nodes are pushed many times
+std::vector<std::pair<size_t, float>> make_entries(size_t num_entries) {
+    std::minstd_rand rng(1);
+    std::uniform_int_distribution<size_t> node_dist(0, kNumNodes - 1);
+    std::uniform_real_distribution<float> cost_dist(0., 100.);
+
+    std::vector<std::pair<size_t, float>> entries;
+    for (size_t i = 0; i < num_entries; ++i) {
+        entries.emplace_back(node_dist(rng), cost_dist(rng));
+    }
+    return entries;
+}
+
+// Returns the lowest cost seen for each node
+std::vector<float> min_costs(const std::vector<std::pair<size_t, float>>& entries) {
+    std::vector<float> best(kNumNodes, std::numeric_limits<float>::infinity());
+    for (const auto& entry : entries) {
+        best[entry.first] = std::min(best[entry.first], entry.second);
+    }
+    return best;
+}
+
+void check_pops(FourAryHeap& heap, const std::vector<std::pair<size_t, float>>& entries) {
+    std::vector<float> best = min_costs(entries);
+    std::vector<bool> popped(kNumNodes, false);
+
+    float last_cost = -std::numeric_limits<float>::infinity();
+    while (!heap.is_empty_heap()) {
+        t_heap* head = heap.get_heap_head();
+        size_t inode = size_t(head->index);
+
+        // Popped in cost order, once per node, with the cheapest cost
+        REQUIRE(head->cost >= last_cost);
+        REQUIRE(!popped[inode]);
+        REQUIRE(head->cost == best[inode]);
+
+        last_cost = head->cost;
+        popped[inode] = true;
+        heap.free(head);
+    }
+
+    for (size_t inode = 0; inode < kNumNodes; ++inode) {
+        REQUIRE(popped[inode] == std::isfinite(best[inode]));
+    }
+}
+
+TEST_CASE("four_ary_heap_decrease_key", "[vpr]") {
+    FourAryHeap heap;
+    heap.set_prune_limit(kNumNodes, kNumNodes * 4);
+
+    auto entries = make_entries(10 * kNumNodes);
+    for (const auto& entry : entries) {
+        t_heap* hptr = heap.alloc();
+        hptr->index = RRNodeId(entry.first);
+        hptr->cost = entry.second;
+        heap.add_to_heap(hptr);
+        REQUIRE(heap.is_valid());
+    }
+
+    check_pops(heap, entries);
+}
+
+TEST_CASE("four_ary_heap_build_heap", "[vpr]") {
+    FourAryHeap heap;
+    heap.set_prune_limit(kNumNodes, kNumNodes * 4);
+
+    auto entries = make_entries(5 * kNumNodes);
+    for (const auto& entry : entries) {
+        t_heap* hptr = heap.alloc();
+        hptr->index = RRNodeId(entry.first);
+        hptr->cost = entry.second;
+        heap.push_back(hptr);
+    }
+    heap.build_heap();
+    REQUIRE(heap.is_valid());
+
+    check_pops(heap, entries);
+}
+
+TEST_CASE("four_ary_heap_add_batch", "[vpr]") {
+    FourAryHeap heap;
+    heap.set_prune_limit(kNumNodes, kNumNodes * 4);
+
+    // Batches of 16 items, first heapified (while the heap is small) then sifted up
+    constexpr size_t kBatchSize = 16;
+    auto entries = make_entries(5 * kNumNodes);
+    for (size_t first = 0; first < entries.size(); first += kBatchSize) {
+        t_heap* batch[kBatchSize];
+        size_t num_items = std::min(kBatchSize, entries.size() - first);
+        for (size_t i = 0; i < num_items; ++i) {
+            batch[i] = heap.alloc();
+            batch[i]->index = RRNodeId(entries[first + i].first);
+            batch[i]->cost = entries[first + i].second;
+        }
+        heap.add_batch_to_heap(batch, num_items);
+        REQUIRE(heap.is_valid());
+    }
+
+    check_pops(heap, entries);
+}
+
+TEST_CASE("four_ary_heap_empty_heap", "[vpr]") {
+    // No set_prune_limit(): the node lookup should grow on demand
+    FourAryHeap heap;
+
+    auto entries = make_entries(kNumNodes);
+    for (const auto& entry : entries) {
+        t_heap* hptr = heap.alloc();
+        hptr->index = RRNodeId(entry.first);
+        hptr->cost = entry.second;
+        heap.add_to_heap(hptr);
+    }
+    REQUIRE(!heap.is_empty_heap());
+
+    heap.empty_heap();
+    REQUIRE(heap.is_empty_heap());
+
+    // Nodes must be insertable again after the heap was emptied
+    entries = make_entries(kNumNodes);
+    for (const auto& entry : entries) {
+        t_heap* hptr = heap.alloc();
+        hptr->index = RRNodeId(entry.first);
+        hptr->cost = entry.second;
+        heap.add_to_heap(hptr);
+    }
+    check_pops(heap, entries);
+}
+
+TEST_CASE("four_ary_heap_item_pool", "[vpr]") {
+    FourAryHeap heap;
+    heap.set_prune_limit(kNumNodes, kNumNodes * 4);
+
+    std::vector<t_heap*> first_items;
+    for (size_t i = 0; i < kNumNodes; ++i) {
+        first_items.push_back(heap.alloc());
+    }
+    REQUIRE(heap.item_high_water_mark() == kNumNodes);
+    REQUIRE(heap.item_pool_size() == kNumNodes);
+
+    for (t_heap* hptr : first_items) {
+        heap.free(hptr);
+    }
+    heap.reset_item_pool();
+    REQUIRE(heap.item_high_water_mark() == 0);
+
+    // After a reset items are handed out again in their original order
+    for (size_t i = 0; i < kNumNodes; ++i) {
+        t_heap* hptr = heap.alloc();
+        REQUIRE(hptr == first_items[i]);
+        hptr->index = RRNodeId(i);
+        hptr->cost = float(kNumNodes - i);
+        heap.add_to_heap(hptr);
+    }
+    REQUIRE(heap.item_pool_size() == kNumNodes);
+
+    heap.empty_heap();
+    REQUIRE(heap.item_high_water_mark() == kNumNodes);
+}
+
+} // namespace
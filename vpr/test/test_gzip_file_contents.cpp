@@ -0,0 +1,104 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "gzip_file_contents.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+namespace {
+
+static constexpr const char kGzipFile[] = "test_gzip_file_contents.gz";
+
+static std::string make_contents(size_t num_bytes) {
+    std::string contents;
+    for (size_t i = 0; contents.size() < num_bytes; ++i) {
+        contents += "cell_" + std::to_string(i * 7919 % 100003) + ' ';
+    }
+    contents.resize(num_bytes);
+    return contents;
+}
+
+static void write_file(const std::string& data) {
+    FILE* fp = std::fopen(kGzipFile, "wb");
+    REQUIRE(fp);
+    REQUIRE(std::fwrite(data.data(), 1, data.size(), fp) == data.size());
+    std::fclose(fp);
+}
+
+///@brief Returns data compressed as a single gzip member, optionally with a BGZF extra field
+static std::string gzip_member(const std::string& data, bool bgzf) {
+    z_stream strm = {};
+    REQUIRE(deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+    std::string deflated(deflateBound(&strm, data.size()), '\0');
+    //zlib's next_in is not const (unless ZLIB_CONST), so deflate from a mutable copy
+    std::vector<unsigned char> in(data.begin(), data.end());
+    strm.next_in = in.data();
+    strm.avail_in = in.size();
+    strm.next_out = reinterpret_cast<Bytef*>(&deflated[0]);
+    strm.avail_out = deflated.size();
+    REQUIRE(deflate(&strm, Z_FINISH) == Z_STREAM_END);
+    deflated.resize(strm.total_out);
+    deflateEnd(&strm);
+
+    auto le = [](std::string& s, uint32_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) s += char((value >> (8 * i)) & 0xff);
+    };
+
+    std::string member = {'\x1f', '\x8b', 8, char(bgzf ? 4 : 0), 0, 0, 0, 0, 0, '\xff'};
+    if (bgzf) {
+        le(member, 6, 2);
+        member += "BC";
+        le(member, 2, 2);
+        le(member, member.size() + 2 + deflated.size() + 8 - 1, 2);
+    }
+    member += deflated;
+    le(member, crc32(0, in.data(), in.size()), 4);
+    le(member, data.size(), 4);
+    return member;
+}
+
+static void require_contents(const std::string& expected) {
+    GzipFileContents contents(kGzipFile, VPR_ERROR_OTHER);
+    REQUIRE(contents.size() == expected.size());
+    REQUIRE(std::string(contents.data(), contents.size()) == expected);
+    REQUIRE(contents.words().size() == (expected.size() + 7) / 8);
+    REQUIRE(reinterpret_cast<uintptr_t>(contents.data()) % 8 == 0);
+}
+
+TEST_CASE("gzip_file_contents", "[vpr]") {
+    std::string data = make_contents(1 << 20);
+
+    SECTION("uncompressed") {
+        write_file(data);
+        require_contents(data);
+    }
+    SECTION("single member") {
+        write_file(gzip_member(data, /*bgzf=*/false));
+        require_contents(data);
+    }
+    SECTION("concatenated members") {
+        write_file(gzip_member(data.substr(0, 1000), false) + gzip_member(data.substr(1000), false));
+        require_contents(data);
+    }
+    SECTION("bgzf members") {
+        std::string file_data;
+        for (size_t offset = 0; offset < data.size(); offset += 60000) {
+            file_data += gzip_member(data.substr(offset, 60000), /*bgzf=*/true);
+        }
+        file_data += gzip_member("", /*bgzf=*/true); //BGZF end-of-file marker
+        write_file(file_data);
+        require_contents(data);
+    }
+    SECTION("truncated") {
+        std::string member = gzip_member(data, false);
+        write_file(member.substr(0, member.size() / 2));
+        REQUIRE_THROWS(GzipFileContents(kGzipFile, VPR_ERROR_OTHER));
+    }
+
+    std::remove(kGzipFile);
+}
+
+} // namespace
@@ -0,0 +1,95 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "net_bb_util.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+TEST_CASE("test_coord_extent", "[net_bb_util]") {
+    SECTION("Single pin") {
+        std::vector<int> coords = {3};
+        t_coord_extent extent = coord_extent(coords.data(), coords.size());
+        REQUIRE(extent.min == 3);
+        REQUIRE(extent.max == 3);
+        REQUIRE(extent.num_on_min == 1);
+        REQUIRE(extent.num_on_max == 1);
+    }
+
+    SECTION("Pins on both edges") {
+        std::vector<int> coords = {4, 1, 7, 7, 1, 5, 1, 2, 7, 3, 6, 1, 4, 2, 5, 3, 6};
+        t_coord_extent extent = coord_extent(coords.data(), coords.size());
+        REQUIRE(extent.min == 1);
+        REQUIRE(extent.max == 7);
+        REQUIRE(extent.num_on_min == 4);
+        REQUIRE(extent.num_on_max == 3);
+
+        t_coord_extent min_max = coord_min_max(coords.data(), coords.size());
+        REQUIRE(min_max.min == extent.min);
+        REQUIRE(min_max.max == extent.max);
+    }
+
+    SECTION("All pins on one coordinate") {
+        std::vector<int> coords(33, 2);
+        t_coord_extent extent = coord_extent(coords.data(), coords.size());
+        REQUIRE(extent.min == 2);
+        REQUIRE(extent.max == 2);
+        REQUIRE(extent.num_on_min == 33);
+        REQUIRE(extent.num_on_max == 33);
+    }
+}
+
+TEST_CASE("test_coord_extent_first_pins", "[net_bb_util]") {
+    std::vector<int> coords = {4, 1, 7, 7, 1, 5, 1, 2, 7, 3};
+    t_coord_extent_pins extent = coord_extent_first_pins(coords.data(), coords.size());
+    REQUIRE(extent.min == 1);
+    REQUIRE(extent.max == 7);
+    REQUIRE(extent.first_on_min == 1);
+    REQUIRE(extent.first_on_max == 2);
+
+    extent = coord_extent_first_pins(coords.data() + 2, coords.size() - 2);
+    REQUIRE(extent.first_on_min == 2);
+    REQUIRE(extent.first_on_max == 0);
+
+    extent = coord_extent_first_pins(coords.data(), 1);
+    REQUIRE(extent.min == 4);
+    REQUIRE(extent.max == 4);
+    REQUIRE(extent.first_on_min == 0);
+    REQUIRE(extent.first_on_max == 0);
+}
+
+//The scan the directed moves used per net, for comparison. Hidden, run with: test_vpr "[.net_bb_util_benchmark]"
+TEST_CASE("benchmark_coord_extent_first_pins", "[.net_bb_util_benchmark]") {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> dist(1, 100);
+    std::vector<int> coords(10);
+    for (int& coord : coords) {
+        coord = dist(rng);
+    }
+
+    BENCHMARK("branchy scan") {
+        int min = coords[0];
+        int max = coords[0];
+        size_t first_on_min = 0;
+        size_t first_on_max = 0;
+        for (size_t i = 1; i < coords.size(); ++i) {
+            if (coords[i] < min) {
+                min = coords[i];
+                first_on_min = i;
+            } else if (coords[i] > max) {
+                max = coords[i];
+                first_on_max = i;
+            }
+        }
+        return min + max + first_on_min + first_on_max;
+    };
+
+    BENCHMARK("coord_extent_first_pins") {
+        t_coord_extent_pins extent = coord_extent_first_pins(coords.data(), coords.size());
+        return extent.min + extent.max + extent.first_on_min + extent.first_on_max;
+    };
+}
+
+} // namespace
@@ -0,0 +1,155 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "atom_netlist.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+// Large enough that compress() takes its parallel paths when built with TBB
+static constexpr size_t kNumLuts = 40 * 1000;
+
+/**
+ * @brief A chain of two-input LUTs, each fed by a primary input and the
+ *        previous LUT, with the last LUT driving a primary output
+ */
+class LutChain {
+  public:
+    LutChain() {
+        inpad_port.dir = OUT_PORT;
+        inpad_port.name = inpad_name;
+        inpad_port.size = 1;
+        outpad_port.dir = IN_PORT;
+        outpad_port.name = outpad_name;
+        outpad_port.size = 1;
+        lut_in_port.dir = IN_PORT;
+        lut_in_port.name = in_name;
+        lut_in_port.size = 2;
+        lut_out_port.dir = OUT_PORT;
+        lut_out_port.name = out_name;
+        lut_out_port.size = 1;
+
+        lut_model.name = lut_name;
+        lut_model.inputs = &lut_in_port;
+        lut_model.outputs = &lut_out_port;
+        output_model.name = output_name;
+        output_model.inputs = &outpad_port;
+        output_model.next = &lut_model;
+        input_model.name = input_name;
+        input_model.outputs = &inpad_port;
+        input_model.next = &output_model;
+    }
+
+    void build(AtomNetlist& netlist, size_t num_luts) {
+        netlist.set_block_types(&input_model, &output_model);
+
+        AtomNetlist::TruthTable truth_table = {{vtr::LogicValue::TRUE, vtr::LogicValue::TRUE, vtr::LogicValue::TRUE}};
+        AtomNetId prev_net = AtomNetId::INVALID();
+        for (size_t i = 0; i < num_luts; ++i) {
+            std::string suffix = std::to_string(i);
+            AtomBlockId in = netlist.create_block("in" + suffix, &input_model);
+            AtomNetId in_net = netlist.create_net("in" + suffix);
+            netlist.create_pin(netlist.create_port(in, &inpad_port), 0, in_net, PinType::DRIVER);
+
+            AtomBlockId lut = netlist.create_block("lut" + suffix, &lut_model, truth_table);
+            AtomPortId lut_in = netlist.create_port(lut, &lut_in_port);
+            netlist.create_pin(lut_in, 0, in_net, PinType::SINK);
+            if (prev_net) {
+                netlist.create_pin(lut_in, 1, prev_net, PinType::SINK);
+            }
+            prev_net = netlist.create_net("lut" + suffix);
+            netlist.create_pin(netlist.create_port(lut, &lut_out_port), 0, prev_net, PinType::DRIVER);
+        }
+        AtomBlockId out = netlist.create_block("out:y", &output_model);
+        netlist.create_pin(netlist.create_port(out, &outpad_port), 0, prev_net, PinType::SINK);
+    }
+
+    ///@brief Removes every stride'th primary input, leaving the nets they drove unused (or undriven)
+    void remove_inputs(AtomNetlist& netlist, size_t num_luts, size_t stride) {
+        for (size_t i = 0; i < num_luts; i += stride) {
+            netlist.remove_block(netlist.find_block("in" + std::to_string(i)));
+        }
+    }
+
+  private:
+    char input_name[7] = ".input";
+    char output_name[8] = ".output";
+    char lut_name[4] = "lut";
+    char inpad_name[6] = "inpad";
+    char outpad_name[7] = "outpad";
+    char in_name[3] = "in";
+    char out_name[4] = "out";
+
+    t_model_ports inpad_port;
+    t_model_ports outpad_port;
+    t_model_ports lut_in_port;
+    t_model_ports lut_out_port;
+
+  public:
+    t_model lut_model;
+    t_model output_model;
+    t_model input_model;
+};
+
+TEST_CASE("compress_large_atom_netlist", "[vpr]") {
+    constexpr size_t kStride = 3;
+    LutChain chain;
+    AtomNetlist netlist("top", "top_id");
+    chain.build(netlist, kNumLuts);
+    REQUIRE(netlist.verify());
+
+    size_t num_removed = (kNumLuts + kStride - 1) / kStride;
+    chain.remove_inputs(netlist, kNumLuts, kStride);
+    auto id_map = netlist.compress();
+    REQUIRE(netlist.verify());
+
+    // The removed inputs' nets are kept (as undriven nets), only the blocks are gone
+    REQUIRE(netlist.blocks().size() == 2 * kNumLuts + 1 - num_removed);
+    REQUIRE(netlist.nets().size() == 2 * kNumLuts);
+
+    for (size_t i = 0; i < kNumLuts; ++i) {
+        std::string suffix = std::to_string(i);
+        AtomBlockId in = netlist.find_block("in" + suffix);
+        AtomNetId in_net = netlist.find_net("in" + suffix);
+        REQUIRE(in_net);
+        if (i % kStride == 0) {
+            REQUIRE(!in);
+            REQUIRE(!netlist.net_driver(in_net));
+        } else {
+            REQUIRE(in);
+            REQUIRE(netlist.block_name(in) == "in" + suffix);
+            REQUIRE(netlist.net_driver_block(in_net) == in);
+        }
+
+        AtomBlockId lut = netlist.find_block("lut" + suffix);
+        REQUIRE(lut);
+        REQUIRE(netlist.net_sinks(in_net).size() == 1);
+        REQUIRE(netlist.pin_block(*netlist.net_sinks(in_net).begin()) == lut);
+        REQUIRE(netlist.net_driver_block(netlist.find_net("lut" + suffix)) == lut);
+    }
+
+    REQUIRE(id_map.new_block_id(AtomBlockId(0)) == AtomBlockId::INVALID());
+    REQUIRE(id_map.new_block_id(AtomBlockId(1)) == AtomBlockId(0));
+
+    // Nothing was left unused, so another pass must not change the netlist
+    netlist.remove_and_compress();
+    REQUIRE(netlist.verify());
+    REQUIRE(netlist.blocks().size() == 2 * kNumLuts + 1 - num_removed);
+    REQUIRE(netlist.nets().size() == 2 * kNumLuts);
+}
+
+TEST_CASE("benchmark_netlist_compress", "[.netlist_compress_benchmark]") {
+    LutChain chain;
+    BENCHMARK_ADVANCED("compress")(Catch::Benchmark::Chronometer meter) {
+        std::vector<AtomNetlist> netlists(meter.runs());
+        for (AtomNetlist& netlist : netlists) {
+            chain.build(netlist, 4 * kNumLuts);
+            chain.remove_inputs(netlist, 4 * kNumLuts, 3);
+        }
+        meter.measure([&](int i) { return netlists[i].remove_and_compress(); });
+    };
+}
+
+} // namespace
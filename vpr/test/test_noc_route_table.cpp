@@ -0,0 +1,134 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "bfs_routing.h"
+#include "noc_route_table.h"
+#include "xy_routing.h"
+
+namespace {
+
+TEST_CASE("test_route_table_matches_routing_algorithm", "[vpr_noc_route_table]") {
+    /*
+     * A 4x4 mesh NoC, where the numbers indicate the NoC router id.
+     *
+     * 12   13   14   15
+     * 8    9    10   11
+     * 4    5    6    7
+     * 0    1    2    3
+     *
+     */
+    NocStorage noc_model;
+    noc_model.set_device_grid_spec((int)4, 0);
+
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            noc_model.add_router((i * 4) + j, j, i, 0);
+        }
+    }
+
+    noc_model.make_room_for_noc_router_link_list();
+
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            NocRouterId router_id = (NocRouterId)((i * 4) + j);
+            if ((j - 1) >= 0) {
+                noc_model.add_link(router_id, (NocRouterId)(((i * 4) + j) - 1));
+            }
+            if ((i + 1) <= 3) {
+                noc_model.add_link(router_id, (NocRouterId)(((i * 4) + j) + 4));
+            }
+            if ((j + 1) <= 3) {
+                noc_model.add_link(router_id, (NocRouterId)(((i * 4) + j) + 1));
+            }
+            if ((i - 1) >= 0) {
+                noc_model.add_link(router_id, (NocRouterId)(((i * 4) + j) - 4));
+            }
+        }
+    }
+
+    SECTION("XY routing") {
+        XYRouting routing_algorithm;
+        NocRouteTable route_table(std::make_unique<XYRouting>());
+
+        // route every pair twice, so the second pass is served from the table
+        for (int pass = 0; pass < 2; pass++) {
+            for (int src = 0; src < 16; src++) {
+                for (int sink = 0; sink < 16; sink++) {
+                    std::vector<NocLinkId> golden_route;
+                    routing_algorithm.route_flow((NocRouterId)src, (NocRouterId)sink, golden_route, noc_model);
+
+                    // start from a stale route, which must be replaced
+                    std::vector<NocLinkId> found_route = {(NocLinkId)0, (NocLinkId)1};
+                    route_table.route_flow((NocRouterId)src, (NocRouterId)sink, found_route, noc_model);
+                    REQUIRE(found_route == golden_route);
+                }
+            }
+        }
+    }
+
+    SECTION("BFS routing") {
+        BFSRouting routing_algorithm;
+        NocRouteTable route_table(std::make_unique<BFSRouting>());
+
+        for (int pass = 0; pass < 2; pass++) {
+            for (int src = 0; src < 16; src++) {
+                for (int sink = 0; sink < 16; sink++) {
+                    std::vector<NocLinkId> golden_route;
+                    routing_algorithm.route_flow((NocRouterId)src, (NocRouterId)sink, golden_route, noc_model);
+
+                    std::vector<NocLinkId> found_route = {(NocLinkId)0, (NocLinkId)1};
+                    route_table.route_flow((NocRouterId)src, (NocRouterId)sink, found_route, noc_model);
+                    REQUIRE(found_route == golden_route);
+                }
+            }
+        }
+    }
+
+    SECTION("Routes built up-front") {
+        BFSRouting routing_algorithm;
+        NocRouteTable route_table(std::make_unique<BFSRouting>());
+        route_table.build(noc_model);
+
+        for (int src = 0; src < 16; src++) {
+            for (int sink = 0; sink < 16; sink++) {
+                std::vector<NocLinkId> golden_route;
+                routing_algorithm.route_flow((NocRouterId)src, (NocRouterId)sink, golden_route, noc_model);
+
+                std::vector<NocLinkId> found_route;
+                route_table.route_flow((NocRouterId)src, (NocRouterId)sink, found_route, noc_model);
+                REQUIRE(found_route == golden_route);
+            }
+        }
+    }
+}
+
+TEST_CASE("test_route_table_build_with_unroutable_pairs", "[vpr_noc_route_table]") {
+    /*
+     * Three routers in a row, with links only going right:
+     *
+     * 0 -> 1 -> 2
+     *
+     */
+    NocStorage noc_model;
+    noc_model.set_device_grid_spec((int)3, 0);
+
+    for (int i = 0; i < 3; i++) {
+        noc_model.add_router(i, i, 0, 0);
+    }
+
+    noc_model.make_room_for_noc_router_link_list();
+    noc_model.add_link((NocRouterId)0, (NocRouterId)1);
+    noc_model.add_link((NocRouterId)1, (NocRouterId)2);
+
+    NocRouteTable route_table(std::make_unique<BFSRouting>());
+
+    // the pairs going left have no route, which is only an error once a traffic flow needs one
+    REQUIRE_NOTHROW(route_table.build(noc_model));
+
+    std::vector<NocLinkId> found_route;
+    route_table.route_flow((NocRouterId)0, (NocRouterId)2, found_route, noc_model);
+    REQUIRE(found_route == std::vector<NocLinkId>{(NocLinkId)0, (NocLinkId)1});
+
+    REQUIRE_THROWS(route_table.route_flow((NocRouterId)2, (NocRouterId)0, found_route, noc_model));
+}
+
+} // namespace
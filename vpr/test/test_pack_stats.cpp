@@ -0,0 +1,74 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "pack_stats.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+std::vector<std::string> read_lines(const std::string& file) {
+    std::ifstream is(file);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(is, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+TEST_CASE("pack_stats_snapshots", "[vpr]") {
+    SECTION("Disabled") {
+        PackStats stats;
+        stats.init("", 0.);
+        REQUIRE(!stats.enabled());
+        stats.snapshot(1, 2, 3, true);
+    }
+
+    SECTION("CSV") {
+        const std::string file = "test_pack_stats.csv";
+        PackStats stats;
+        stats.init(file, 0.);
+        REQUIRE(stats.enabled());
+
+        stats.add_phase_time(PACK_PHASE_TRY_PACK_MOLECULE, 0.5);
+        stats.add_phase_time(PACK_PHASE_TRY_PACK_MOLECULE, 0.25);
+
+        //Without an interval, only the last snapshot is taken
+        stats.snapshot(1, 2, 10, false);
+        REQUIRE(read_lines(file).empty());
+        stats.snapshot(4, 10, 10, true);
+
+        auto lines = read_lines(file);
+        REQUIRE(lines.size() == 2);
+        REQUIRE(lines[0].find("try_pack_molecule_time,try_pack_molecule_runs") != std::string::npos);
+        REQUIRE(lines[1].find(",4,10,10,") != std::string::npos);
+        REQUIRE(lines[1].find(",0.75,2,") != std::string::npos);
+
+        std::remove(file.c_str());
+    }
+
+    SECTION("JSON") {
+        const std::string file = "test_pack_stats.json";
+        PackStats stats;
+        stats.init(file, 1e-9);
+
+        {
+            ScopedPackPhaseTimer timer(stats, PACK_PHASE_SEED_SELECTION);
+        }
+        stats.snapshot(1, 1, 2, false);
+        stats.snapshot(2, 2, 2, true);
+
+        std::stringstream json;
+        json << std::ifstream(file).rdbuf();
+        REQUIRE(json.str().find("\"clusters\": 1,") != std::string::npos);
+        REQUIRE(json.str().find("\"clusters\": 2,") != std::string::npos);
+        REQUIRE(json.str().find("\"seed_selection\": {\"time\": ") != std::string::npos);
+        REQUIRE(json.str().find("\"runs\": 1}") != std::string::npos);
+
+        std::remove(file.c_str());
+    }
+}
+
+} // namespace
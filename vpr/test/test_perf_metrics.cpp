@@ -0,0 +1,69 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "perf_metrics.h"
+#include "vtr_time.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+static std::string read_file(const std::string& file) {
+    std::ifstream is(file);
+    std::stringstream contents;
+    contents << is.rdbuf();
+    return contents.str();
+}
+
+TEST_CASE("perf_metrics", "[vpr]") {
+    PerfMetrics metrics;
+
+    SECTION("set and add") {
+        REQUIRE(metrics.value("route.heap_pushes") == 0.);
+
+        metrics.set("place.bb_cost", 10., e_perf_metric_type::QOR);
+        metrics.set("place.bb_cost", 12., e_perf_metric_type::QOR);
+        REQUIRE(metrics.value("place.bb_cost") == 12.);
+
+        metrics.add("route.heap_pushes", 100., e_perf_metric_type::WORK);
+        metrics.add("route.heap_pushes", 50., e_perf_metric_type::WORK);
+        REQUIRE(metrics.value("route.heap_pushes") == 150.);
+
+        //Recorded in first recorded order
+        REQUIRE(metrics.metrics().size() == 2);
+        REQUIRE(metrics.metrics()[0].name == "place.bb_cost");
+        REQUIRE(metrics.metrics()[1].name == "route.heap_pushes");
+    }
+
+    SECTION("stages") {
+        vtr::Timer timer;
+        metrics.record_stage("route", timer);
+        metrics.record_stage("route", timer);
+
+        REQUIRE(metrics.metrics().size() == 2);
+        REQUIRE(metrics.metrics()[0].name == "route.wall_sec");
+        REQUIRE(metrics.metrics()[0].type == e_perf_metric_type::RUNTIME);
+        REQUIRE(metrics.value("route.wall_sec") >= 0.);
+        REQUIRE(metrics.metrics()[1].name == "route.max_rss_mib");
+        REQUIRE(metrics.metrics()[1].type == e_perf_metric_type::MEMORY);
+        REQUIRE(metrics.value("route.max_rss_mib") > 0.);
+    }
+
+    SECTION("json") {
+        metrics.set("place.moves_per_sec", 2.5e6, e_perf_metric_type::WORK, true);
+        metrics.set("analysis.cpd_ns", 4.25, e_perf_metric_type::QOR);
+
+        const std::string file = "test_perf_metrics.json";
+        REQUIRE(metrics.write_json(file));
+
+        std::string contents = read_file(file);
+        REQUIRE(contents.find("\"vpr_version\": ") != std::string::npos);
+        REQUIRE(contents.find("\"place.moves_per_sec\": {\"value\": 2500000, \"type\": \"work\", \"higher_is_better\": true},\n") != std::string::npos);
+        REQUIRE(contents.find("\"analysis.cpd_ns\": {\"value\": 4.25, \"type\": \"qor\", \"higher_is_better\": false}\n") != std::string::npos);
+        std::remove(file.c_str());
+    }
+}
+
+} // namespace
@@ -0,0 +1,73 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "place_checkpoint.h"
+#include "globals.h"
+
+#include <cstdio>
+
+namespace {
+
+static constexpr const char kCheckpointBlob[] = "test_anneal_checkpoint.blob";
+
+TEST_CASE("round_trip_anneal_checkpoint", "[vpr]") {
+    t_logical_block_type clb_block;
+    char clb[] = "clb";
+    clb_block.name = clb;
+    t_pb clb_pb;
+
+    auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
+    cluster_ctx.clb_nlist = ClusteredNetlist("test_netlist", "test_netlist_id");
+    char blk_a[] = "a";
+    char blk_b[] = "b";
+    cluster_ctx.clb_nlist.create_block(blk_a, &clb_pb, &clb_block);
+    cluster_ctx.clb_nlist.create_block(blk_b, &clb_pb, &clb_block);
+
+    t_anneal_checkpoint checkpoint;
+    checkpoint.t = 1.5e-3;
+    checkpoint.restart_t = 2.5e-3;
+    checkpoint.alpha = 0.9;
+    checkpoint.rlim = 7.25;
+    checkpoint.crit_exponent = 3.5;
+    checkpoint.num_temps = 42;
+    checkpoint.move_lim = 1234;
+    checkpoint.move_lim_max = 5678;
+    checkpoint.tot_iter = 98765;
+    checkpoint.moves_since_cost_recompute = 12;
+    checkpoint.outer_crit_iter_count = 1;
+    checkpoint.agent_state = 1;
+    checkpoint.rand_state = 4000000000u;
+    checkpoint.block_locs = {t_pl_loc(1, 2, 0, 0), t_pl_loc(3, 4, 1, 0)};
+    checkpoint.move_generator_state = {4, 0.25, -0.5, 1e-9, 0.125, 10, 20, 30, 40, 0, 1, 2, 1};
+
+    write_anneal_checkpoint(kCheckpointBlob, checkpoint);
+
+    SECTION("Round trip") {
+        t_anneal_checkpoint read = read_anneal_checkpoint(kCheckpointBlob);
+        REQUIRE(read.t == checkpoint.t);
+        REQUIRE(read.restart_t == checkpoint.restart_t);
+        REQUIRE(read.alpha == checkpoint.alpha);
+        REQUIRE(read.rlim == checkpoint.rlim);
+        REQUIRE(read.crit_exponent == checkpoint.crit_exponent);
+        REQUIRE(read.num_temps == checkpoint.num_temps);
+        REQUIRE(read.move_lim == checkpoint.move_lim);
+        REQUIRE(read.move_lim_max == checkpoint.move_lim_max);
+        REQUIRE(read.tot_iter == checkpoint.tot_iter);
+        REQUIRE(read.moves_since_cost_recompute == checkpoint.moves_since_cost_recompute);
+        REQUIRE(read.outer_crit_iter_count == checkpoint.outer_crit_iter_count);
+        REQUIRE(read.agent_state == checkpoint.agent_state);
+        REQUIRE(read.rand_state == checkpoint.rand_state);
+        REQUIRE(read.block_locs == checkpoint.block_locs);
+        REQUIRE(read.move_generator_state == checkpoint.move_generator_state);
+        REQUIRE(read.move_generator2_state.empty());
+    }
+
+    SECTION("Different netlist") {
+        cluster_ctx.clb_nlist = ClusteredNetlist("test_netlist", "other_netlist_id");
+        REQUIRE_THROWS_AS(read_anneal_checkpoint(kCheckpointBlob), VprError);
+    }
+
+    std::remove(kCheckpointBlob);
+    cluster_ctx.clb_nlist = ClusteredNetlist();
+}
+
+} // namespace
@@ -0,0 +1,79 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/catch_approx.hpp"
+
+#include "place_congestion.h"
+
+namespace {
+
+using Catch::Approx;
+
+PlacerCongestionMap uniform_map(size_t width, size_t height, double capacity) {
+    PlacerCongestionMap map(width, height);
+    for (size_t x = 0; x < width; ++x) {
+        for (size_t y = 0; y < height; ++y) {
+            map.set_capacity(x, y, capacity);
+        }
+    }
+    return map;
+}
+
+TEST_CASE("place_congestion_demand", "[vpr]") {
+    PlacerCongestionMap map = uniform_map(4, 3, 2.);
+    REQUIRE(map.cost() == 0.);
+
+    //A net spreads its wirelength over its bounding box
+    map.add_net({1, 0, 2, 1}, 8.);
+    REQUIRE(map.demand(1, 0) == Approx(2.));
+    REQUIRE(map.demand(2, 1) == Approx(2.));
+    REQUIRE(map.demand(0, 0) == 0.);
+    REQUIRE(map.demand(3, 2) == 0.);
+    REQUIRE(map.cost() == 0.);
+
+    //Each tile is then 1 track (half its capacity) over capacity
+    map.add_net({1, 0, 2, 1}, 4.);
+    REQUIRE(map.cost() == Approx(4 * 0.5));
+
+    map.add_net({1, 0, 2, 1}, -4.);
+    REQUIRE(map.cost() == Approx(0.));
+
+    map.clear_demand();
+    REQUIRE(map.demand(1, 0) == 0.);
+}
+
+TEST_CASE("place_congestion_proposed_moves", "[vpr]") {
+    PlacerCongestionMap map = uniform_map(5, 5, 1.);
+    map.add_net({0, 0, 1, 1}, 8.);
+    map.add_net({2, 2, 2, 2}, 1.);
+    double start_cost = map.cost();
+    REQUIRE(start_cost == Approx(4.));
+
+    //Two nets moving onto the same tile are priced together
+    map.propose_net({0, 0, 1, 1}, 8., {3, 3, 3, 3}, 2.);
+    map.propose_net({2, 2, 2, 2}, 1., {3, 3, 3, 3}, 1.);
+    double delta_cost = map.proposed_delta_cost();
+    REQUIRE(delta_cost == Approx(2. - 4.));
+
+    SECTION("revert") {
+        map.revert_proposed();
+        REQUIRE(map.proposed_delta_cost() == 0.);
+        REQUIRE(map.cost() == Approx(start_cost));
+        REQUIRE(map.demand(3, 3) == 0.);
+    }
+
+    SECTION("commit") {
+        map.commit_proposed();
+        REQUIRE(map.proposed_delta_cost() == 0.);
+        REQUIRE(map.cost() == Approx(start_cost + delta_cost));
+        REQUIRE(map.demand(3, 3) == Approx(3.));
+        REQUIRE(map.demand(0, 0) == Approx(0.));
+        REQUIRE(map.demand(2, 2) == Approx(0.));
+    }
+
+    SECTION("unmoved_net") {
+        map.revert_proposed();
+        map.propose_net({2, 2, 2, 2}, 1., {2, 2, 2, 2}, 1.);
+        REQUIRE(map.proposed_delta_cost() == 0.);
+    }
+}
+
+} // namespace
@@ -0,0 +1,69 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "vpr_api.h"
+#include "globals.h"
+#include "place_constraints.h"
+
+static constexpr const char kArchFile[] = "test_read_arch_metadata.xml";
+
+// Half of the inputs of place_region.eblif are constrained (by place_region.xml) to a
+// single, full, io tile, so most region moves of (or swaps with) them are illegal.
+static void require_floorplan_legal_placement(std::vector<const char*> extra_args) {
+    auto options = t_options();
+    auto arch = t_arch();
+    auto vpr_setup = t_vpr_setup();
+
+    vpr_initialize_logging();
+
+    std::vector<const char*> argv = {
+        "test_vpr",
+        kArchFile,
+        "place_region.eblif",
+        "--read_vpr_constraints", "place_region.xml",
+        "--seed", "3"};
+    argv.insert(argv.end(), extra_args.begin(), extra_args.end());
+    vpr_init(int(argv.size()), argv.data(),
+             &options, &vpr_setup, &arch);
+
+    vpr_pack_flow(vpr_setup, arch);
+    vpr_create_device(vpr_setup, arch, /*is_flat=*/false);
+
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    REQUIRE(vpr_place_flow((const Netlist<>&)cluster_ctx.clb_nlist, vpr_setup, arch));
+
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    int num_constrained = 0;
+    for (ClusterBlockId blk : cluster_ctx.clb_nlist.blocks()) {
+        if (is_cluster_constrained(blk)) {
+            ++num_constrained;
+        }
+        REQUIRE(cluster_floorplanning_legal(blk, place_ctx.block_locs[blk].loc));
+    }
+    REQUIRE(num_constrained == 8);
+
+    vpr_free_all(arch, vpr_setup);
+}
+
+TEST_CASE("place_parallel_regions_floorplan", "[vpr]") {
+    require_floorplan_legal_placement({"--place_parallel_regions", "4"});
+}
+
+// Many moves in small regions, most of them swapping an unconstrained block into the
+// constrained io tile
+TEST_CASE("place_parallel_regions_swap_floorplan", "[vpr]") {
+    require_floorplan_legal_placement({"--place_parallel_regions", "9", "--inner_num", "10"});
+}
+
+TEST_CASE("place_greedy_refine_floorplan", "[vpr]") {
+    require_floorplan_legal_placement({"--place_greedy_refine_passes", "4"});
+}
+
+// Defers the timing analysis of the temperatures to overlap it with the annealing moves
+// (if there is a second hardware thread), with the placement checkpoints saved late in
+// the anneal
+TEST_CASE("place_overlap_timing_analysis", "[vpr]") {
+    require_floorplan_legal_placement({"--place_overlap_timing_analysis", "on",
+                                       "--place_checkpointing", "on",
+                                       "--place_agent_multistate", "on"});
+}
@@ -0,0 +1,56 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include <sstream>
+
+#include "PowerSpicedComponent.h"
+
+namespace {
+
+float scaled_usage(int num_inputs, float transistor_size) {
+    return num_inputs * transistor_size;
+}
+
+void add_data_points(PowerSpicedComponent& component) {
+    component.add_data_point(2, 1., 3.);
+    component.add_data_point(2, 4., 10.);
+    component.add_data_point(4, 1., 9.);
+    component.add_data_point(4, 4., 15.);
+}
+
+TEST_CASE("power_callibration_cache", "[vpr]") {
+    PowerSpicedComponent callibrated("mux", scaled_usage);
+    add_data_points(callibrated);
+    callibrated.callibrate();
+
+    std::stringstream cache;
+    callibrated.write_callibration(cache);
+
+    SECTION("matching_data_points") {
+        PowerSpicedComponent cached("mux", scaled_usage);
+        add_data_points(cached);
+        REQUIRE(cached.read_callibration(cache));
+        REQUIRE(cached.is_done_callibration());
+
+        for (int num_inputs : {2, 3, 4}) {
+            for (float transistor_size : {1., 2.5, 4.}) {
+                REQUIRE(cached.scale_factor(num_inputs, transistor_size) == callibrated.scale_factor(num_inputs, transistor_size));
+            }
+        }
+    }
+
+    SECTION("different_data_points") {
+        PowerSpicedComponent cached("mux", scaled_usage);
+        cached.add_data_point(2, 1., 3.);
+        cached.add_data_point(2, 8., 10.);
+        REQUIRE(!cached.read_callibration(cache));
+        REQUIRE(!cached.is_done_callibration());
+    }
+
+    SECTION("different_component") {
+        PowerSpicedComponent cached("lut", scaled_usage);
+        add_data_points(cached);
+        REQUIRE(!cached.read_callibration(cache));
+    }
+}
+
+} // namespace
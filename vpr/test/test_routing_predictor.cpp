@@ -0,0 +1,55 @@
+#include <cmath>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "routing_predictor.h"
+
+namespace {
+
+TEST_CASE("routing_predictor_flat_slope", "[vpr]") {
+    SECTION("Falling overuse") {
+        RoutingPredictor predictor;
+        for (size_t itry = 1; itry <= 10; ++itry) {
+            //Halves every iteration
+            predictor.add_iteration_overuse(itry, 100000 >> itry);
+        }
+        REQUIRE(!predictor.is_overuse_slope_flat());
+    }
+
+    SECTION("Stalled overuse") {
+        RoutingPredictor predictor;
+        for (size_t itry = 1; itry <= 10; ++itry) {
+            predictor.add_iteration_overuse(itry, 1000 - itry);
+        }
+        REQUIRE(predictor.is_overuse_slope_flat());
+    }
+
+    SECTION("Not enough history") {
+        RoutingPredictor predictor;
+        predictor.add_iteration_overuse(1, 1000);
+        predictor.add_iteration_overuse(2, 1000);
+        REQUIRE(!predictor.is_overuse_slope_flat());
+    }
+}
+
+TEST_CASE("routing_predictor_first_estimate", "[vpr]") {
+    RoutingPredictor predictor(/*min_history=*/4);
+    REQUIRE(std::isnan(predictor.first_success_iteration_estimate()));
+
+    for (size_t itry = 1; itry <= 10; ++itry) {
+        predictor.estimate_success_iteration();
+        predictor.add_iteration_overuse(itry, 100000 >> itry);
+    }
+
+    //First estimated once more than min_history iterations were seen
+    REQUIRE(predictor.first_estimate_iteration() == 5);
+    float first_estimate = predictor.first_success_iteration_estimate();
+    REQUIRE(std::isfinite(first_estimate));
+    REQUIRE(first_estimate > 5);
+
+    //Later estimates do not replace the first one
+    predictor.estimate_success_iteration();
+    REQUIRE(predictor.first_success_iteration_estimate() == first_estimate);
+}
+
+} // namespace
@@ -0,0 +1,83 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "sdc_name_index.h"
+
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<int> find_matches(const SdcNameIndex<int>& index, const std::string& pattern) {
+    std::vector<int> matches;
+    index.for_each_match(SdcNamePattern(pattern), [&](int obj) {
+        matches.push_back(obj);
+    });
+    return matches;
+}
+
+TEST_CASE("sdc_name_pattern", "[vpr]") {
+    REQUIRE(SdcNamePattern("a.b").is_exact());
+    REQUIRE(SdcNamePattern("a.b").matches("a.b"));
+    REQUIRE(!SdcNamePattern("a.b").matches("axb"));
+
+    REQUIRE(!SdcNamePattern("a*").is_exact());
+    REQUIRE(!SdcNamePattern("a*").is_regex());
+    REQUIRE(SdcNamePattern("ab*cd").literal_prefix() == "ab");
+
+    REQUIRE(SdcNamePattern("q[3]").is_regex());
+    REQUIRE(SdcNamePattern("q\\[3\\]").is_exact());
+    REQUIRE(SdcNamePattern("q\\[3\\]").matches("q[3]"));
+    REQUIRE(SdcNamePattern("q\\d").is_regex());
+
+    //Non-regex patterns must match exactly as their regexes would
+    const std::vector<std::string> patterns = {"*", "a*", "*b", "a*b", "a*b*", "*.*", "a**b", "ab.c", "a*a*a", "a\\[0\\]*", "\\(a\\)"};
+    const std::vector<std::string> names = {"", "a", "b", "ab", "aab", "abb", "abab", "ab.c", "abxc", "a.b", "aaa", "aa", "ba", "a[0]", "a[0]b", "a0", "(a)"};
+    for (const auto& pattern : patterns) {
+        std::regex regex = glob_pattern_to_regex(pattern);
+        for (const auto& name : names) {
+            INFO(pattern << " " << name);
+            REQUIRE(SdcNamePattern(pattern).matches(name) == std::regex_match(name, regex));
+        }
+    }
+}
+
+TEST_CASE("sdc_name_index", "[vpr]") {
+    SdcNameIndex<int> index;
+    index.add("top.b.out[0]", 0);
+    index.add("top.a.in[0]", 1);
+    index.add("top.a.in[1]", 2);
+    index.add("top.a.out[0]", 3);
+    index.add("other", 4);
+    index.add("top.a.in[0]", 5);
+    index.build();
+
+    REQUIRE(index.size() == 6);
+
+    SECTION("Exact") {
+        REQUIRE(find_matches(index, "other") == std::vector<int>{4});
+        REQUIRE(find_matches(index, "top.a.out\\[0\\]") == std::vector<int>{3});
+        REQUIRE(find_matches(index, "top.a").empty());
+        REQUIRE(find_matches(index, "missing").empty());
+    }
+
+    SECTION("Duplicate names") {
+        REQUIRE(find_matches(index, "top.a.in\\[0\\]") == std::vector<int>({1, 5}));
+    }
+
+    SECTION("Glob") {
+        REQUIRE(find_matches(index, "top.a.*") == std::vector<int>({1, 5, 2, 3}));
+        REQUIRE(find_matches(index, "*out*") == std::vector<int>({3, 0}));
+        REQUIRE(find_matches(index, "top.c*").empty());
+        REQUIRE(find_matches(index, "*").size() == 6);
+    }
+
+    SECTION("Regex") {
+        //'[0]' is a regex character class, so matches 'in0' but not 'in[0]' (as with std::regex)
+        REQUIRE(find_matches(index, "top.a.in[0]").empty());
+        REQUIRE(find_matches(index, "top.a.in\\[[01]\\]") == std::vector<int>({1, 5, 2}));
+        REQUIRE(find_matches(index, "top.(a|b).out*") == std::vector<int>({3, 0}));
+    }
+}
+
+} // namespace
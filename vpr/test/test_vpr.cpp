@@ -4,6 +4,8 @@
 #include "read_xml_arch_file.h"
 #include "rr_metadata.h"
 #include "rr_graph_writer.h"
+#include "rr_graph_storage.h"
+#include "rr_spatial_lookup.h"
 #include "arch_util.h"
 #include "vpr_api.h"
 #include "echo_files.h"
@@ -16,6 +18,7 @@ using Catch::Matchers::Equals;
 
 static constexpr const char kArchFile[] = "test_read_arch_metadata.xml";
 static constexpr const char kRrGraphFile[] = "test_read_rrgraph_metadata.xml";
+static constexpr const char kRrGraphBlobFile[] = "test_read_rrgraph_metadata.blob";
 
 TEST_CASE("read_arch_metadata", "[vpr]") {
     t_arch arch;
@@ -119,6 +122,21 @@ TEST_CASE("read_rr_graph_metadata", "[vpr]") {
     int sink_inode = -1;
     short switch_id = -1;
 
+    //Round trip through each RR graph format
+    const char* rr_graph_file = kRrGraphFile;
+    bool attach_rr_graph = false;
+    SECTION("xml") {
+        rr_graph_file = kRrGraphFile;
+    }
+    SECTION("blob") {
+        rr_graph_file = kRrGraphBlobFile;
+    }
+    SECTION("blob_attached") {
+        //The node reordering copies the attached arrays
+        rr_graph_file = kRrGraphBlobFile;
+        attach_rr_graph = true;
+    }
+
     {
         t_vpr_setup vpr_setup;
         t_arch arch;
@@ -164,10 +182,11 @@ TEST_CASE("read_rr_graph_metadata", "[vpr]") {
                        device_ctx.arch_switch_inf,
                        device_ctx.arch,
                        &mutable_device_ctx.chan_width,
-                       kRrGraphFile,
+                       rr_graph_file,
                        device_ctx.virtual_clock_network_root_idx,
                        echo_enabled,
                        echo_file_name,
+                       false,
                        false);
         vpr_free_all(arch, vpr_setup);
 
@@ -194,12 +213,13 @@ TEST_CASE("read_rr_graph_metadata", "[vpr]") {
         "--reorder_rr_graph_nodes_algorithm",
         "random_shuffle", // Tests node reordering with metadata
         "--read_rr_graph",
-        kRrGraphFile,
+        rr_graph_file,
     };
 
     vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
              &options, &vpr_setup, &arch);
     vpr_setup.RouterOpts.read_rr_edge_metadata = true;
+    vpr_setup.RouterOpts.attach_rr_graph = attach_rr_graph;
     vpr_create_device(vpr_setup, arch, false);
 
     const auto& device_ctx = g_vpr_ctx.device();
@@ -241,4 +261,162 @@ TEST_CASE("read_rr_graph_metadata", "[vpr]") {
     atom_ctx.atom_molecules.clear();
 }
 
+TEST_CASE("compress_edge_src_nodes", "[vpr]") {
+    t_rr_graph_storage rr_nodes;
+    const size_t num_nodes = 6;
+    for (size_t inode = 0; inode < num_nodes; ++inode) {
+        rr_nodes.emplace_back();
+    }
+
+    //Nodes 1 and 5 have no out-going edges
+    std::vector<std::pair<size_t, size_t>> edges = {{3, 0}, {0, 1}, {2, 4}, {0, 5}, {4, 0}, {2, 3}};
+    for (const auto& edge : edges) {
+        rr_nodes.emplace_back_edge(RRNodeId(edge.first), RRNodeId(edge.second), 0, true);
+    }
+
+    vtr::vector<RRSwitchId, t_rr_switch_inf> rr_switches(1);
+    rr_switches[RRSwitchId(0)].set_type(SwitchType::MUX);
+    rr_nodes.mark_edges_as_rr_switch_ids();
+    rr_nodes.partition_edges(rr_switches);
+
+    std::vector<RRNodeId> src_nodes;
+    for (size_t iedge = 0; iedge < edges.size(); ++iedge) {
+        src_nodes.push_back(rr_nodes.edge_src_node(RREdgeId(iedge)));
+    }
+
+    rr_nodes.compress_edge_src_nodes();
+    REQUIRE(rr_nodes.edge_src_nodes_compressed());
+    for (size_t iedge = 0; iedge < edges.size(); ++iedge) {
+        REQUIRE(rr_nodes.edge_src_node(RREdgeId(iedge)) == src_nodes[iedge]);
+    }
+
+    size_t num_edges = 0;
+    rr_nodes.for_each_edge([&](RREdgeId edge, RRNodeId src, RRNodeId /*sink*/) {
+        REQUIRE(src == src_nodes[size_t(edge)]);
+        ++num_edges;
+    });
+    REQUIRE(num_edges == edges.size());
+
+    rr_nodes.expand_edge_src_nodes();
+    REQUIRE(!rr_nodes.edge_src_nodes_compressed());
+    for (size_t iedge = 0; iedge < edges.size(); ++iedge) {
+        REQUIRE(rr_nodes.edge_src_node_data()[iedge] == src_nodes[iedge]);
+    }
+}
+
+template<typename T>
+static vtr::array_view<const T> const_view(const std::vector<T>& vec) {
+    return vtr::array_view<const T>(vec.data(), vec.size());
+}
+
+TEST_CASE("rr_graph_storage_mapped_arrays", "[vpr]") {
+    //Arrays as they would be viewed in a memory-mapped file, edges already partitioned
+    std::vector<t_rr_node_data> nodes(3);
+    std::vector<t_rr_node_ptc_data> node_ptc(3);
+    std::vector<short> node_layer(3, 0);
+    std::vector<short> node_ptc_twist_incr(3, 0);
+    std::vector<RRNodeId> src_nodes = {RRNodeId(0), RRNodeId(0), RRNodeId(2)};
+    std::vector<RRNodeId> dest_nodes = {RRNodeId(1), RRNodeId(2), RRNodeId(1)};
+    std::vector<short> switches = {0, 0, 0};
+    auto mapped_data = std::make_shared<int>(0);
+
+    t_rr_graph_storage rr_nodes;
+    rr_nodes.load_nodes(const_view(nodes), const_view(node_ptc), const_view(node_layer), const_view(node_ptc_twist_incr), mapped_data);
+    rr_nodes.load_edges(const_view(src_nodes), const_view(dest_nodes), const_view(switches), mapped_data);
+    size_t mapped_bytes = rr_nodes.mapped_memory_usage();
+    REQUIRE(mapped_bytes == 3 * (sizeof(t_rr_node_data) + sizeof(t_rr_node_ptc_data) + 2 * sizeof(short) + 2 * sizeof(RRNodeId) + sizeof(short)));
+
+    vtr::vector<RRSwitchId, t_rr_switch_inf> rr_switches(1);
+    rr_switches[RRSwitchId(0)].set_type(SwitchType::MUX);
+    rr_nodes.mark_edges_as_rr_switch_ids();
+    rr_nodes.partition_edges(rr_switches);
+    rr_nodes.init_fan_in();
+
+    //Reading (and partitioning already sorted edges) keeps the arrays viewed
+    REQUIRE(rr_nodes.mapped_memory_usage() == mapped_bytes);
+    REQUIRE(rr_nodes.edge_src_node_data().data() == src_nodes.data());
+    REQUIRE(rr_nodes.num_edges(RRNodeId(0)) == 2);
+    REQUIRE(rr_nodes.edge_sink_node(RRNodeId(2), 0) == RRNodeId(1));
+    REQUIRE(rr_nodes.fan_in(RRNodeId(1)) == 2);
+
+    //Modifying a node only copies the node array
+    rr_nodes.set_node_capacity(RRNodeId(1), 2);
+    REQUIRE(rr_nodes.node_capacity(RRNodeId(1)) == 2);
+    REQUIRE(nodes[1].capacity_ == 0);
+    REQUIRE(rr_nodes.node_data().data() != nodes.data());
+    REQUIRE(rr_nodes.mapped_memory_usage() == mapped_bytes - 3 * sizeof(t_rr_node_data));
+    REQUIRE(rr_nodes.edge_dest_node_data().data() == dest_nodes.data());
+
+    rr_nodes.clear();
+    REQUIRE(rr_nodes.mapped_memory_usage() == 0);
+}
+
+TEST_CASE("compact_rr_spatial_lookup", "[vpr]") {
+    RRSpatialLookup lookup;
+    for (t_rr_type type : {SOURCE, SINK, IPIN, OPIN, CHANX, CHANY}) {
+        lookup.resize_nodes(1, 2, 2, type, NUM_SIDES);
+    }
+    //CHANX nodes are registered at (y, x), see RRSpatialLookup::find_node()
+    lookup.add_node(RRNodeId(0), 0, 1, 2, CHANX, 3);
+    lookup.add_node(RRNodeId(1), 0, 1, 2, CHANX, 0);
+    lookup.add_node(RRNodeId(2), 0, 2, 1, CHANY, 1);
+    lookup.add_node(RRNodeId(3), 0, 1, 1, IPIN, 4, RIGHT);
+    lookup.add_node(RRNodeId(4), 0, 1, 1, OPIN, 0, LEFT);
+    lookup.add_node(RRNodeId(5), 1, 1, 1, SOURCE, 2);
+    lookup.mirror_nodes(1, vtr::Point<int>(1, 1), vtr::Point<int>(1, 2), SOURCE, SIDES[0]);
+
+    //Queries over a range larger than the look-up, so out of range locations are also compared
+    auto find_all = [&]() {
+        std::vector<RRNodeId> found;
+        for (t_rr_type type : {SOURCE, SINK, IPIN, OPIN, CHANX, CHANY}) {
+            for (int layer = -1; layer <= 2; ++layer) {
+                for (int x = -1; x <= 3; ++x) {
+                    for (int y = -1; y <= 3; ++y) {
+                        for (int ptc = -1; ptc <= 5; ++ptc) {
+                            for (e_side side : SIDES) {
+                                found.push_back(lookup.find_node(layer, x, y, type, ptc, side));
+                            }
+                        }
+                        if (type == CHANX || type == CHANY) {
+                            auto nodes = lookup.find_channel_nodes(layer, x, y, type);
+                            found.insert(found.end(), nodes.begin(), nodes.end());
+                        } else if (layer >= 0 && x >= 0 && y >= 0) {
+                            auto nodes = lookup.find_grid_nodes_at_all_sides(layer, x, y, type);
+                            found.insert(found.end(), nodes.begin(), nodes.end());
+                        }
+                    }
+                }
+            }
+        }
+        return found;
+    };
+
+    std::vector<RRNodeId> expected = find_all();
+    lookup.compact();
+    REQUIRE(lookup.compacted());
+    REQUIRE(find_all() == expected);
+    REQUIRE(lookup.find_node(0, 2, 1, CHANX, 3) == RRNodeId(0));
+    REQUIRE(lookup.find_node(1, 1, 2, SOURCE, 2) == RRNodeId(5));
+    REQUIRE(!lookup.find_node(0, 2, 1, CHANX, 1));
+
+    //Re-ordering nodes keeps the look-up compacted
+    vtr::vector<RRNodeId, RRNodeId> dest_order;
+    for (size_t inode = 0; inode < 6; ++inode) {
+        dest_order.push_back(RRNodeId(5 - inode));
+    }
+    lookup.reorder(dest_order);
+    REQUIRE(lookup.compacted());
+    REQUIRE(lookup.find_node(0, 2, 1, CHANX, 3) == RRNodeId(5));
+    REQUIRE(lookup.find_node(0, 1, 1, IPIN, 4, RIGHT) == RRNodeId(2));
+    lookup.reorder(dest_order);
+    REQUIRE(find_all() == expected);
+
+    //Adding a node expands the look-up first
+    lookup.add_node(RRNodeId(6), 0, 2, 1, CHANY, 0);
+    REQUIRE(!lookup.compacted());
+    REQUIRE(lookup.find_node(0, 2, 1, CHANY, 0) == RRNodeId(6));
+    REQUIRE(lookup.find_node(0, 2, 1, CHANY, 1) == RRNodeId(2));
+    REQUIRE(lookup.find_node(0, 1, 1, OPIN, 0, LEFT) == RRNodeId(4));
+}
+
 } // namespace
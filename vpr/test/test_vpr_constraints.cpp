@@ -8,6 +8,7 @@
 #include "partition.h"
 #include "region.h"
 #include "place_constraints.h"
+#include "constraints_load.h"
 
 /**
  * This file contains unit tests that check the functionality of all classes related to vpr constraints. These classes include
@@ -64,6 +65,48 @@ TEST_CASE("PartitionRegion", "[vpr]") {
     REQUIRE(pr_reg_coord.ymax == 7);
 }
 
+//Test locations inside, between and outside (the bounding box of) the regions of a PartitionRegion
+TEST_CASE("PartitionRegionIsLocIn", "[vpr]") {
+    Region r1;
+    Region r2;
+
+    r1.set_region_rect({0, 0, 2, 2, 0});
+    r2.set_region_rect({6, 6, 8, 8, 0});
+    r2.set_sub_tile(1);
+
+    PartitionRegion pr1;
+    REQUIRE(!pr1.is_loc_in_part_reg(t_pl_loc(0, 0, 0, 0)));
+
+    pr1.add_to_part_region(r1);
+    pr1.add_to_part_region(r2);
+
+    REQUIRE(pr1.is_loc_in_part_reg(t_pl_loc(2, 2, 3, 0)));
+    REQUIRE(pr1.is_loc_in_part_reg(t_pl_loc(8, 8, 1, 0)));
+    REQUIRE(!pr1.is_loc_in_part_reg(t_pl_loc(8, 8, 0, 0)));
+    REQUIRE(!pr1.is_loc_in_part_reg(t_pl_loc(4, 4, 0, 0)));
+    REQUIRE(!pr1.is_loc_in_part_reg(t_pl_loc(9, 0, 0, 0)));
+    REQUIRE(!pr1.is_loc_in_part_reg(t_pl_loc(1, 1, 0, 1)));
+
+    //Replacing the regions replaces the bounding box
+    PartitionRegion pr2;
+    pr2.set_partition_region({r2});
+    REQUIRE(!pr2.is_loc_in_part_reg(t_pl_loc(1, 1, 0, 0)));
+    REQUIRE(pr2.is_loc_in_part_reg(t_pl_loc(7, 7, 1, 0)));
+
+    //PartitionRegions without overlapping regions (or bounding boxes) do not intersect
+    PartitionRegion pr3;
+    Region r3;
+    r3.set_region_rect({3, 3, 5, 5, 0});
+    pr3.add_to_part_region(r3);
+    REQUIRE(intersection(pr1, pr3).empty());
+    REQUIRE(intersection(pr2, pr3).empty());
+
+    update_cluster_part_reg(pr1, pr2);
+    REQUIRE(pr1.get_partition_region().size() == 1);
+    REQUIRE(pr1.get_partition_region()[0] == r2);
+    REQUIRE(!pr1.is_loc_in_part_reg(t_pl_loc(1, 1, 0, 0)));
+}
+
 //Test Partition class accessors and mutators
 TEST_CASE("Partition", "[vpr]") {
     Partition part;
@@ -131,6 +174,51 @@ TEST_CASE("VprConstraints", "[vpr]") {
     REQUIRE(partition_atoms.size() == 3);
 }
 
+//Test matching add_atom name patterns to atoms
+TEST_CASE("NamePatternAtoms", "[vpr]") {
+    char input_name[] = ".input";
+    char output_name[] = ".output";
+    char inpad_name[] = "inpad";
+    char outpad_name[] = "outpad";
+
+    t_model_ports inpad_port;
+    inpad_port.dir = OUT_PORT;
+    inpad_port.name = inpad_name;
+    inpad_port.size = 1;
+    t_model_ports outpad_port;
+    outpad_port.dir = IN_PORT;
+    outpad_port.name = outpad_name;
+    outpad_port.size = 1;
+
+    t_model output_model;
+    output_model.name = output_name;
+    output_model.inputs = &outpad_port;
+    t_model input_model;
+    input_model.name = input_name;
+    input_model.outputs = &inpad_port;
+    input_model.next = &output_model;
+
+    AtomNetlist netlist("top", "top_id");
+    netlist.set_block_types(&input_model, &output_model);
+
+    AtomBlockId a0 = netlist.create_block("a[0]", &input_model);
+    AtomBlockId a1 = netlist.create_block("a[1]", &input_model);
+    AtomBlockId ab = netlist.create_block("ab", &input_model);
+    AtomBlockId b = netlist.create_block("b", &input_model);
+
+    //Exact names, even with regex special characters
+    REQUIRE(find_name_pattern_atoms(netlist, "a[0]") == std::vector<AtomBlockId>{a0});
+    REQUIRE(find_name_pattern_atoms(netlist, "b") == std::vector<AtomBlockId>{b});
+
+    //Literal patterns are searched for as substrings, as regex_search would
+    REQUIRE(find_name_pattern_atoms(netlist, "a") == std::vector<AtomBlockId>{a0, a1, ab});
+
+    //Regular expressions
+    REQUIRE(find_name_pattern_atoms(netlist, "^a\\[[0-9]\\]$") == std::vector<AtomBlockId>{a0, a1});
+    REQUIRE(find_name_pattern_atoms(netlist, ".*b") == std::vector<AtomBlockId>{ab, b});
+    REQUIRE(find_name_pattern_atoms(netlist, "c").empty());
+}
+
 //Test intersection function for Regions
 TEST_CASE("RegionIntersect", "[vpr]") {
     //Test partial intersection